@@ -0,0 +1,17 @@
+// Included by vertex shaders which hide primitives by map distance threshold
+// and selected time
+
+uniform float uMapDistance;
+uniform int   uSelectedTime;
+
+bool isDisplayed(in int threshold, in ivec2 timeRange)
+{
+   return (threshold == 0 ||                              // If Threshold: 0 was specified, no threshold
+           uMapDistance == 0 ||                           // If uMapDistance is zero, threshold is disabled
+           (threshold < 0 && -(threshold) <= uMapDistance) || // If Threshold is negative and below current map distance
+           threshold >= uMapDistance ||                   // If Threshold is above current map distance
+           threshold >= 999) &&                           // If Threshold: 999 was specified (or greater), no threshold
+          (timeRange[0] == 0 ||                           // If there is no start time specified
+           (timeRange[0] <= uSelectedTime &&              // If the selected time is after the start time
+            uSelectedTime < timeRange[1]));               // If the selected time is before the end time
+}
@@ -16,18 +16,11 @@ layout (location = 5) in int   aThreshold;
 layout (location = 6) in ivec2 aTimeRange;
 layout (location = 7) in int   aDisplayed;
 
-uniform mat4 uMVPMatrix;
-uniform mat4 uMapMatrix;
-uniform vec2 uMapScreenCoord;
+uniform mat4  uMVPMatrix;
+uniform mat4  uMapMatrix;
+uniform vec2  uMapScreenCoord;
 
-out VertexData
-{
-   int   threshold;
-   vec3  texCoord;
-   vec4  color;
-   ivec2 timeRange;
-   int   displayed;
-} vsOut;
+#include "display.glsl"
 
 smooth out vec3 texCoord;
 smooth out vec4 color;
@@ -43,19 +36,9 @@ vec2 latLngToScreenCoordinate(in vec2 latLng)
 
 void main()
 {
-   // Pass displayed to the geometry shader
-   vsOut.displayed = aDisplayed;
-
-   // Pass the threshold and time range to the geometry shader
-   vsOut.threshold = aThreshold;
-   vsOut.timeRange = aTimeRange;
-
-   // Pass the texture coordinate and color modulate to the geometry and
-   // fragment shaders
-   vsOut.texCoord = aTexCoord;
-   vsOut.color    = aModulate;
-   texCoord       = aTexCoord;
-   color          = aModulate;
+   // Pass the texture coordinate and color modulate to the fragment shader
+   texCoord = aTexCoord;
+   color    = aModulate;
 
    vec2 p = latLngToScreenCoordinate(aLatLong) - uMapScreenCoord;
 
@@ -67,4 +50,11 @@ void main()
    // Transform the position to screen coordinates
    gl_Position = uMapMatrix * vec4(p, 0.0f, 1.0f) +
                  uMVPMatrix * vec4(rotate * aXYOffset, 0.0f, 0.0f);
+
+   // Hide primitives which are not displayed by moving them outside of the
+   // clip volume
+   if (aDisplayed == 0 || !isDisplayed(aThreshold, aTimeRange))
+   {
+      gl_Position = vec4(2.0f, 2.0f, 2.0f, 1.0f);
+   }
 }
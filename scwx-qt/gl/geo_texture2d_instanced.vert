@@ -0,0 +1,69 @@
+#version 330 core
+
+#define DEGREES_MAX   360.0f
+#define LATITUDE_MAX  85.051128779806604f
+#define LONGITUDE_MAX 180.0f
+#define PI            3.1415926535897932384626433f
+#define RAD2DEG       57.295779513082320876798156332941f
+#define DEG2RAD       0.0174532925199432957692369055556f
+
+// Per-vertex attributes
+layout (location = 0) in vec2  aVertex;
+
+// Per-instance attributes
+layout (location = 1) in vec2  aLatLong;
+layout (location = 2) in vec4  aXYRect;
+layout (location = 3) in vec4  aTexRect;
+layout (location = 4) in float aTexLayer;
+layout (location = 5) in vec4  aModulate;
+layout (location = 6) in float aAngleDeg;
+layout (location = 7) in int   aThreshold;
+layout (location = 8) in ivec2 aTimeRange;
+layout (location = 9) in int   aDisplayed;
+
+uniform mat4  uMVPMatrix;
+uniform mat4  uMapMatrix;
+uniform vec2  uMapScreenCoord;
+
+#include "display.glsl"
+
+smooth out vec3 texCoord;
+smooth out vec4 color;
+
+vec2 latLngToScreenCoordinate(in vec2 latLng)
+{
+   vec2 p;
+   latLng.x = clamp(latLng.x, -LATITUDE_MAX, LATITUDE_MAX);
+   p.xy     = vec2(LONGITUDE_MAX + latLng.y,
+                   -(LONGITUDE_MAX - RAD2DEG * log(tan(PI / 4 + latLng.x * PI / DEGREES_MAX))));
+   return p;
+}
+
+void main()
+{
+   // Select the corner of the rectangle (0, 0) = bottom left, (1, 1) = top right
+   vec2 xyOffset = mix(aXYRect.xy, aXYRect.zw, aVertex);
+   vec3 tc       = vec3(mix(aTexRect.xy, aTexRect.zw, aVertex), aTexLayer);
+
+   // Pass the texture coordinate and color modulate to the fragment shader
+   texCoord = tc;
+   color    = aModulate;
+
+   vec2 p = latLngToScreenCoordinate(aLatLong) - uMapScreenCoord;
+
+   // Rotate clockwise
+   float angle  = aAngleDeg * DEG2RAD;
+   mat2  rotate = mat2(cos(angle), -sin(angle),
+                       sin(angle), cos(angle));
+
+   // Transform the position to screen coordinates
+   gl_Position = uMapMatrix * vec4(p, 0.0f, 1.0f) +
+                 uMVPMatrix * vec4(rotate * xyOffset, 0.0f, 0.0f);
+
+   // Hide primitives which are not displayed by moving them outside of the
+   // clip volume
+   if (aDisplayed == 0 || !isDisplayed(aThreshold, aTimeRange))
+   {
+      gl_Position = vec4(2.0f, 2.0f, 2.0f, 1.0f);
+   }
+}
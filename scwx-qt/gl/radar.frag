@@ -3,22 +3,185 @@
 // Lower the default precision to medium
 precision mediump float;
 
+#define DEGREES_MAX   360.0f
+#define LONGITUDE_MAX 180.0f
+#define PI            3.1415926535897932384626433f
+#define RAD2DEG       57.295779513082320876798156332941f
+
 uniform sampler1D uTexture;
 uniform uint uDataMomentOffset;
 uniform float uDataMomentScale;
 
 uniform bool uCFPEnabled;
+uniform bool uHideZeroMoments;
+
+// Data level below which bins are hidden, or 0 if no bins are hidden
+uniform float uMomentThreshold;
+
+// Sweep texture, sampled in place of the interpolated data moment
+uniform bool       uSweepTextureEnabled;
+uniform usampler2D uMomentTexture;
+uniform sampler1D  uAzimuthTexture;
+uniform int        uFirstRadial;
+uniform vec2       uRadarLatLong;
+uniform vec2       uEarthRadii;
+uniform float      uGateSizeMeters;
+uniform int        uStartGate;
+uniform int        uGateSize;
+
+// Storm motion, subtracted from radial velocities along the radial azimuth
+uniform bool uStormRelative;
+uniform vec2 uStormMotion; // Heading (radians), speed (data levels)
 
 in float dataMoment;
 in float cfpMoment;
+in vec2  mapCoord;
+
+// Azimuth of the radial containing the bin, or negative if unknown
+flat in float binAzimuth;
 
 layout (location = 0) out vec4 fragColor;
 
+vec2 screenCoordinateToLatLng(in vec2 p)
+{
+   float lat = (atan(exp((p.y + LONGITUDE_MAX) / RAD2DEG)) - PI / 4) *
+               DEGREES_MAX / PI;
+   return vec2(lat, p.x - LONGITUDE_MAX);
+}
+
+float radialAzimuth(in int index, in int radials)
+{
+   // Near edge of the radial, in order of increasing azimuth
+   return texelFetch(uAzimuthTexture, (uFirstRadial + index) % radials, 0).r;
+}
+
+float radialCenter(in vec2 edges)
+{
+   float span = mod(edges.y - edges.x + DEGREES_MAX, DEGREES_MAX);
+   return mod(edges.x + span / 2.0f, DEGREES_MAX);
+}
+
+float fragmentAzimuth()
+{
+   vec2 latLng = screenCoordinateToLatLng(mapCoord);
+
+   // Inverse of the spherical destination used to generate polar grids
+   float lat1 = radians(uRadarLatLong.x);
+   float lat2 = radians(latLng.x);
+   float dLon = radians(latLng.y - uRadarLatLong.y);
+
+   float y = sin(dLon) * cos(lat2);
+   float x = cos(lat1) * sin(lat2) - sin(lat1) * cos(lat2) * cos(dLon);
+   return mod(degrees(atan(y, x)) + DEGREES_MAX, DEGREES_MAX);
+}
+
+bool sampleSweepTexture(out float moment, out float sampleAzimuth)
+{
+   vec2 latLng = screenCoordinateToLatLng(mapCoord);
+
+   float lat1    = radians(uRadarLatLong.x);
+   float lat2    = radians(latLng.x);
+   float dLon    = radians(latLng.y - uRadarLatLong.y);
+   float azimuth = fragmentAzimuth();
+
+   float sinDLat = sin((lat2 - lat1) / 2.0f);
+   float sinDLon = sin(dLon / 2.0f);
+   float h       = sinDLat * sinDLat + cos(lat1) * cos(lat2) * sinDLon * sinDLon;
+   float d       = 2.0f * asin(sqrt(min(h, 1.0f)));
+
+   float a      = radians(azimuth);
+   float cosA   = cos(a);
+   float sinA   = sin(a);
+   float radius = 1.0f / (cosA * cosA / uEarthRadii.x + sinA * sinA / uEarthRadii.y);
+   float gate   = d * radius / uGateSizeMeters;
+
+   ivec2 size    = textureSize(uMomentTexture, 0);
+   int   bins    = size.x;
+   int   radials = size.y;
+
+   if (gate < float(uStartGate))
+   {
+      return false;
+   }
+
+   int bin = int((gate - float(uStartGate)) / float(uGateSize));
+   if (bin >= bins)
+   {
+      return false;
+   }
+
+   // Find the last radial whose near edge precedes the azimuth. An azimuth
+   // before the first radial belongs to the last radial, which wraps 360.
+   int index = radials - 1;
+   if (azimuth >= radialAzimuth(0, radials))
+   {
+      int low  = 0;
+      int high = radials - 1;
+      while (low < high)
+      {
+         int mid = (low + high + 1) / 2;
+         if (radialAzimuth(mid, radials) <= azimuth)
+         {
+            low = mid;
+         }
+         else
+         {
+            high = mid - 1;
+         }
+      }
+      index = low;
+   }
+
+   int  radial = (uFirstRadial + index) % radials;
+   vec2 edges  = texelFetch(uAzimuthTexture, radial, 0).rg;
+
+   float span   = mod(edges.y - edges.x + DEGREES_MAX, DEGREES_MAX);
+   float offset = mod(azimuth - edges.x + DEGREES_MAX, DEGREES_MAX);
+   if (offset >= span)
+   {
+      return false;
+   }
+
+   moment        = float(texelFetch(uMomentTexture, ivec2(bin, radial), 0).r);
+   sampleAzimuth = radialCenter(edges);
+   return true;
+}
+
 void main()
 {
-   float texCoord = (dataMoment - float(uDataMomentOffset)) / uDataMomentScale;
+   float moment  = dataMoment;
+   float azimuth = binAzimuth;
+
+   if (uSweepTextureEnabled && !sampleSweepTexture(moment, azimuth))
+   {
+      discard;
+   }
+
+   if (uHideZeroMoments && moment < 0.5f)
+   {
+      discard;
+   }
+
+   // Levels below 2 are below threshold or range folded
+   if (uStormRelative && moment >= 2.0f)
+   {
+      if (azimuth < 0.0f)
+      {
+         azimuth = fragmentAzimuth();
+      }
+
+      moment -= uStormMotion.y * cos(radians(azimuth) - uStormMotion.x);
+      moment = max(moment, 2.0f);
+   }
+
+   if (moment < uMomentThreshold)
+   {
+      discard;
+   }
+
+   float texCoord = (moment - float(uDataMomentOffset)) / uDataMomentScale;
 
-   if (uCFPEnabled && cfpMoment > 8u)
+   if (uCFPEnabled && !uSweepTextureEnabled && cfpMoment > 8u)
    {
       texCoord = texCoord - float(cfpMoment - 8u) / 2.0f;
    }
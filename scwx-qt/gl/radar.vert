@@ -13,8 +13,29 @@ layout (location = 2) in uint aCfpMoment;
 uniform mat4 uMVPMatrix;
 uniform vec2 uMapScreenCoord;
 
+// Polar grid, used to generate bin vertices in place of aLatLong
+uniform bool      uPolarGridEnabled;
+uniform sampler1D uAzimuthTexture;
+uniform vec2      uRadarLatLong;
+uniform vec2      uEarthRadii;
+uniform float     uGateSizeMeters;
+uniform int       uStartGate;
+uniform int       uGateSize;
+uniform int       uRadialVertices;
+
+// Sweep texture, sampled by the fragment shader over a bounding quad
+uniform bool uSweepTextureEnabled;
+
+// Quantized vertices, as offsets from the radar site (origin.xy, scale.zw)
+uniform bool uVertexQuantized;
+uniform vec4 uVertexQuantization;
+
 out float dataMoment;
 out float cfpMoment;
+out vec2  mapCoord;
+
+// Azimuth of the radial containing the bin, or negative if unknown
+flat out float binAzimuth;
 
 vec2 latLngToScreenCoordinate(in vec2 latLng)
 {
@@ -25,13 +46,94 @@ vec2 latLngToScreenCoordinate(in vec2 latLng)
    return p;
 }
 
+vec2 polarToLatLng(in float azimuth, in float range)
+{
+   // Spherical destination, using the radius of curvature of the ellipsoid at
+   // the radar site in the direction of the azimuth
+   float a      = radians(azimuth);
+   float cosA   = cos(a);
+   float sinA   = sin(a);
+   float radius = 1.0f / (cosA * cosA / uEarthRadii.x + sinA * sinA / uEarthRadii.y);
+   float d      = range / radius;
+
+   float lat1 = radians(uRadarLatLong.x);
+   float lat2 = asin(sin(lat1) * cos(d) + cos(lat1) * sin(d) * cosA);
+   float dLon = atan(sinA * sin(d) * cos(lat1), cos(d) - sin(lat1) * sin(lat2));
+
+   return vec2(degrees(lat2), uRadarLatLong.y + degrees(dLon));
+}
+
+float radialCenter(in vec2 edges)
+{
+   float span = mod(edges.y - edges.x + DEGREES_MAX, DEGREES_MAX);
+   return mod(edges.x + span / 2.0f, DEGREES_MAX);
+}
+
+vec2 polarGridLatLng()
+{
+   int radialIndex = gl_VertexID / uRadialVertices;
+   int vertex      = gl_VertexID % uRadialVertices;
+   int gate        = uStartGate;
+
+   vec2 azimuths = texelFetch(uAzimuthTexture, radialIndex, 0).rg;
+
+   binAzimuth = radialCenter(azimuths);
+
+   if (uStartGate == 0)
+   {
+      if (vertex < 3)
+      {
+         // The origin bin is a single triangle from the radar site
+         if (vertex == 0)
+         {
+            return uRadarLatLong;
+         }
+
+         float azimuth = (vertex == 1) ? azimuths.x : azimuths.y;
+         return polarToLatLng(azimuth, uGateSizeMeters);
+      }
+
+      vertex -= 3;
+      gate += uGateSize;
+   }
+
+   gate += (vertex / 6) * uGateSize;
+
+   // Two triangles per bin, with corners ordered 1, 2, 4, 1, 3, 4
+   //
+   // 2 +---+ 4
+   //   |  /|
+   //   | / |
+   //   |/  |
+   // 1 +---+ 3
+   int  corner = vertex % 6;
+   bool isNext = (corner == 2 || corner == 4 || corner == 5);
+   bool isFar  = (corner == 1 || corner == 2 || corner == 5);
+
+   float azimuth = isNext ? azimuths.y : azimuths.x;
+   float range   = float(isFar ? gate + uGateSize : gate) * uGateSizeMeters;
+
+   return polarToLatLng(azimuth, range);
+}
+
 void main()
 {
    // Pass the coded data moment to the fragment shader
    dataMoment = aDataMoment;
    cfpMoment  = aCfpMoment;
+   binAzimuth = -1.0f;
+
+   vec2 latLng =
+      (uPolarGridEnabled && !uSweepTextureEnabled) ? polarGridLatLng() : aLatLong;
+
+   if (uVertexQuantized)
+   {
+      latLng = uVertexQuantization.xy + aLatLong * uVertexQuantization.zw;
+   }
+
+   mapCoord = latLngToScreenCoordinate(latLng);
 
-   vec2 p = latLngToScreenCoordinate(aLatLong) - uMapScreenCoord;
+   vec2 p = mapCoord - uMapScreenCoord;
 
    // Transform the position to screen coordinates
    gl_Position = uMVPMatrix * vec4(p, 0.0f, 1.0f);
@@ -0,0 +1,83 @@
+#version 330 core
+
+#define DEGREES_MAX   360.0f
+#define LONGITUDE_MAX 180.0f
+#define PI            3.1415926535897932384626433f
+#define RAD2DEG       57.295779513082320876798156332941f
+
+// Number of levels encoded below each range step
+#define LEVELS 256.0f
+
+// Range steps of the nearest radar encoding, which must be exactly
+// representable when multiplied by the number of levels
+#define RANGE_STEPS     8192.0f
+#define RANGE_STEP_SIZE 100.0f
+
+// Mosaic sweep, with rows of fixed azimuth width
+uniform usampler2D uMomentTexture;
+uniform vec2       uRadarLatLong;
+uniform vec2       uEarthRadii;
+uniform float      uFirstGateRange;
+uniform float      uGateSizeMeters;
+uniform bool       uNearestRadar;
+
+in vec2 mapCoord;
+
+layout (location = 0) out float mosaicValue;
+
+vec2 screenCoordinateToLatLng(in vec2 p)
+{
+   float lat = (atan(exp((p.y + LONGITUDE_MAX) / RAD2DEG)) - PI / 4) *
+               DEGREES_MAX / PI;
+   return vec2(lat, p.x - LONGITUDE_MAX);
+}
+
+void main()
+{
+   vec2 latLng = screenCoordinateToLatLng(mapCoord);
+
+   // Inverse of the spherical destination used to generate polar grids
+   float lat1 = radians(uRadarLatLong.x);
+   float lat2 = radians(latLng.x);
+   float dLon = radians(latLng.y - uRadarLatLong.y);
+
+   float y       = sin(dLon) * cos(lat2);
+   float x       = cos(lat1) * sin(lat2) - sin(lat1) * cos(lat2) * cos(dLon);
+   float azimuth = mod(degrees(atan(y, x)) + DEGREES_MAX, DEGREES_MAX);
+
+   float sinDLat = sin((lat2 - lat1) / 2.0f);
+   float sinDLon = sin(dLon / 2.0f);
+   float h       = sinDLat * sinDLat + cos(lat1) * cos(lat2) * sinDLon * sinDLon;
+   float d       = 2.0f * asin(sqrt(min(h, 1.0f)));
+
+   float a      = radians(azimuth);
+   float cosA   = cos(a);
+   float sinA   = sin(a);
+   float radius = 1.0f / (cosA * cosA / uEarthRadii.x + sinA * sinA / uEarthRadii.y);
+   float range  = d * radius;
+
+   ivec2 size = textureSize(uMomentTexture, 0);
+   int   bin  = int(floor((range - uFirstGateRange) / uGateSizeMeters));
+   int   row  = min(int(azimuth * float(size.y) / DEGREES_MAX), size.y - 1);
+
+   if (bin < 0 || bin >= size.x)
+   {
+      discard;
+   }
+
+   uint level = texelFetch(uMomentTexture, ivec2(bin, row), 0).r;
+
+   // Bins which are not covered by a radial do not contribute to the mosaic
+   if (level == 0u)
+   {
+      discard;
+   }
+
+   // The mosaic is blended by maximum value. The nearest radar is selected by
+   // encoding the range above the level, such that nearer bins are greater.
+   float rangeStep = min(floor(range / RANGE_STEP_SIZE), RANGE_STEPS - 1.0f);
+   float encodedRange =
+      uNearestRadar ? (RANGE_STEPS - 1.0f - rangeStep) * LEVELS : 0.0f;
+
+   mosaicValue = encodedRange + float(level);
+}
@@ -0,0 +1,29 @@
+#version 330 core
+
+// Number of levels encoded below each range step
+#define LEVELS 256.0f
+
+uniform sampler2D uMosaicTexture;
+uniform sampler1D uColorTable;
+uniform ivec2     uViewportOrigin;
+uniform int       uColorTableMin;
+
+layout (location = 0) out vec4 fragColor;
+
+void main()
+{
+   float value =
+      texelFetch(uMosaicTexture, ivec2(gl_FragCoord.xy) - uViewportOrigin, 0).r;
+
+   int level = int(mod(value, LEVELS) + 0.5f);
+
+   // Bins with no data, and pixels with no coverage, are transparent
+   if (level <= 1)
+   {
+      discard;
+   }
+
+   int index = clamp(level - uColorTableMin, 0, textureSize(uColorTable, 0) - 1);
+
+   fragColor = texelFetch(uColorTable, index, 0);
+}
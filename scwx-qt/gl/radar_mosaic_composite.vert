@@ -0,0 +1,10 @@
+#version 330 core
+
+void main()
+{
+   // Full screen triangle, generated from the vertex ID
+   vec2 p = vec2(float((gl_VertexID & 1) << 2) - 1.0f,
+                 float((gl_VertexID & 2) << 1) - 1.0f);
+
+   gl_Position = vec4(p, 0.0f, 1.0f);
+}
@@ -11,33 +11,14 @@ layout (location = 5) in int   aDisplayed;
 
 uniform mat4 uMVPMatrix;
 
-out VertexData
-{
-   int   threshold;
-   vec3  texCoord;
-   vec4  color;
-   ivec2 timeRange;
-   int   displayed;
-} vsOut;
-
 smooth out vec3 texCoord;
 smooth out vec4 color;
 
 void main()
 {
-   // Always set threshold and time range to zero
-   vsOut.threshold = 0;
-   vsOut.timeRange = ivec2(0, 0);
-
-   // Pass displayed to the geometry shader
-   vsOut.displayed = aDisplayed;
-
-   // Pass the texture coordinate and color modulate to the geometry and
-   // fragment shaders
-   vsOut.texCoord = aTexCoord;
-   vsOut.color    = aModulate;
-   texCoord       = aTexCoord;
-   color          = aModulate;
+   // Pass the texture coordinate and color modulate to the fragment shader
+   texCoord = aTexCoord;
+   color    = aModulate;
 
    // Rotate clockwise
    float angle  = aAngleDeg * DEG2RAD;
@@ -45,4 +26,11 @@ void main()
                        sin(angle), cos(angle));
 
    gl_Position = uMVPMatrix * vec4(aVertex + rotate * aXYOffset, 0.0f, 1.0f);
+
+   // Hide primitives which are not displayed by moving them outside of the
+   // clip volume
+   if (aDisplayed == 0)
+   {
+      gl_Position = vec4(2.0f, 2.0f, 2.0f, 1.0f);
+   }
 }
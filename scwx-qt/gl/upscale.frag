@@ -0,0 +1,15 @@
+#version 330 core
+
+uniform sampler2D uTexture;
+uniform vec4      uViewport; // Origin and size of the viewport (pixels)
+
+layout (location = 0) out vec4 fragColor;
+
+void main()
+{
+   // The texture covers the viewport at a reduced resolution, and is sampled
+   // with linear filtering. Colors are premultiplied by alpha.
+   vec2 texCoord = (gl_FragCoord.xy - uViewport.xy) / uViewport.zw;
+
+   fragColor = texture(uTexture, texCoord);
+}
@@ -59,13 +59,28 @@ set(HDR_CONFIG source/scwx/qt/config/county_database.hpp
                source/scwx/qt/config/radar_site.hpp)
 set(SRC_CONFIG source/scwx/qt/config/county_database.cpp
                source/scwx/qt/config/radar_site.cpp)
-set(SRC_EXTERNAL source/scwx/qt/external/stb_image.cpp
+set(SRC_EXTERNAL source/scwx/qt/external/stb_dxt.cpp
+                 source/scwx/qt/external/stb_image.cpp
                  source/scwx/qt/external/stb_rect_pack.cpp)
-set(HDR_GL source/scwx/qt/gl/gl.hpp
+set(HDR_GL source/scwx/qt/gl/dynamic_buffer.hpp
+           source/scwx/qt/gl/frame_readback.hpp
+           source/scwx/qt/gl/gl.hpp
            source/scwx/qt/gl/gl_context.hpp
-           source/scwx/qt/gl/shader_program.hpp)
-set(SRC_GL source/scwx/qt/gl/gl_context.cpp
-           source/scwx/qt/gl/shader_program.cpp)
+           source/scwx/qt/gl/scaled_framebuffer.hpp
+           source/scwx/qt/gl/shader_program.hpp
+           source/scwx/qt/gl/state_cache.hpp
+           source/scwx/qt/gl/upload_scheduler.hpp
+           source/scwx/qt/gl/upload_worker.hpp
+           source/scwx/qt/gl/viewport_culler.hpp)
+set(SRC_GL source/scwx/qt/gl/dynamic_buffer.cpp
+           source/scwx/qt/gl/frame_readback.cpp
+           source/scwx/qt/gl/gl_context.cpp
+           source/scwx/qt/gl/scaled_framebuffer.cpp
+           source/scwx/qt/gl/shader_program.cpp
+           source/scwx/qt/gl/state_cache.cpp
+           source/scwx/qt/gl/upload_scheduler.cpp
+           source/scwx/qt/gl/upload_worker.cpp
+           source/scwx/qt/gl/viewport_culler.cpp)
 set(HDR_GL_DRAW source/scwx/qt/gl/draw/draw_item.hpp
                 source/scwx/qt/gl/draw/geo_icons.hpp
                 source/scwx/qt/gl/draw/geo_lines.hpp
@@ -94,34 +109,46 @@ set(HDR_MANAGER source/scwx/qt/manager/alert_manager.hpp
                 source/scwx/qt/manager/download_manager.hpp
                 source/scwx/qt/manager/font_manager.hpp
                 source/scwx/qt/manager/hotkey_manager.hpp
+                source/scwx/qt/manager/local_data_manager.hpp
                 source/scwx/qt/manager/log_manager.hpp
                 source/scwx/qt/manager/media_manager.hpp
+                source/scwx/qt/manager/metrics_manager.hpp
                 source/scwx/qt/manager/placefile_manager.hpp
                 source/scwx/qt/manager/marker_manager.hpp
                 source/scwx/qt/manager/position_manager.hpp
+                source/scwx/qt/manager/radar_mosaic_manager.hpp
                 source/scwx/qt/manager/radar_product_manager.hpp
                 source/scwx/qt/manager/radar_product_manager_notifier.hpp
+                source/scwx/qt/manager/radar_site_prefetch_manager.hpp
                 source/scwx/qt/manager/resource_manager.hpp
+                source/scwx/qt/manager/session_manager.hpp
                 source/scwx/qt/manager/settings_manager.hpp
                 source/scwx/qt/manager/text_event_manager.hpp
                 source/scwx/qt/manager/thread_manager.hpp
+                source/scwx/qt/manager/tile_server_manager.hpp
                 source/scwx/qt/manager/timeline_manager.hpp
                 source/scwx/qt/manager/update_manager.hpp)
 set(SRC_MANAGER source/scwx/qt/manager/alert_manager.cpp
                 source/scwx/qt/manager/download_manager.cpp
                 source/scwx/qt/manager/font_manager.cpp
                 source/scwx/qt/manager/hotkey_manager.cpp
+                source/scwx/qt/manager/local_data_manager.cpp
                 source/scwx/qt/manager/log_manager.cpp
                 source/scwx/qt/manager/media_manager.cpp
+                source/scwx/qt/manager/metrics_manager.cpp
                 source/scwx/qt/manager/placefile_manager.cpp
                 source/scwx/qt/manager/marker_manager.cpp
                 source/scwx/qt/manager/position_manager.cpp
+                source/scwx/qt/manager/radar_mosaic_manager.cpp
                 source/scwx/qt/manager/radar_product_manager.cpp
                 source/scwx/qt/manager/radar_product_manager_notifier.cpp
+                source/scwx/qt/manager/radar_site_prefetch_manager.cpp
                 source/scwx/qt/manager/resource_manager.cpp
+                source/scwx/qt/manager/session_manager.cpp
                 source/scwx/qt/manager/settings_manager.cpp
                 source/scwx/qt/manager/text_event_manager.cpp
                 source/scwx/qt/manager/thread_manager.cpp
+                source/scwx/qt/manager/tile_server_manager.cpp
                 source/scwx/qt/manager/timeline_manager.cpp
                 source/scwx/qt/manager/update_manager.cpp)
 set(HDR_MAP source/scwx/qt/map/alert_layer.hpp
@@ -130,6 +157,7 @@ set(HDR_MAP source/scwx/qt/map/alert_layer.hpp
             source/scwx/qt/map/generic_layer.hpp
             source/scwx/qt/map/layer_wrapper.hpp
             source/scwx/qt/map/map_context.hpp
+            source/scwx/qt/map/map_prefetcher.hpp
             source/scwx/qt/map/map_provider.hpp
             source/scwx/qt/map/map_settings.hpp
             source/scwx/qt/map/map_widget.hpp
@@ -137,6 +165,7 @@ set(HDR_MAP source/scwx/qt/map/alert_layer.hpp
             source/scwx/qt/map/overlay_product_layer.hpp
             source/scwx/qt/map/placefile_layer.hpp
             source/scwx/qt/map/marker_layer.hpp
+            source/scwx/qt/map/radar_mosaic_layer.hpp
             source/scwx/qt/map/radar_product_layer.hpp
             source/scwx/qt/map/radar_range_layer.hpp
             source/scwx/qt/map/radar_site_layer.hpp)
@@ -146,12 +175,14 @@ set(SRC_MAP source/scwx/qt/map/alert_layer.cpp
             source/scwx/qt/map/generic_layer.cpp
             source/scwx/qt/map/layer_wrapper.cpp
             source/scwx/qt/map/map_context.cpp
+            source/scwx/qt/map/map_prefetcher.cpp
             source/scwx/qt/map/map_provider.cpp
             source/scwx/qt/map/map_widget.cpp
             source/scwx/qt/map/overlay_layer.cpp
             source/scwx/qt/map/overlay_product_layer.cpp
             source/scwx/qt/map/placefile_layer.cpp
             source/scwx/qt/map/marker_layer.cpp
+            source/scwx/qt/map/radar_mosaic_layer.cpp
             source/scwx/qt/map/radar_product_layer.cpp
             source/scwx/qt/map/radar_range_layer.cpp
             source/scwx/qt/map/radar_site_layer.cpp)
@@ -174,9 +205,11 @@ set(SRC_MODEL source/scwx/qt/model/alert_model.cpp
               source/scwx/qt/model/tree_item.cpp
               source/scwx/qt/model/tree_model.cpp)
 set(HDR_REQUEST source/scwx/qt/request/download_request.hpp
-                source/scwx/qt/request/nexrad_file_request.hpp)
+                source/scwx/qt/request/nexrad_file_request.hpp
+                source/scwx/qt/request/nexrad_load_group.hpp)
 set(SRC_REQUEST source/scwx/qt/request/download_request.cpp
-                source/scwx/qt/request/nexrad_file_request.cpp)
+                source/scwx/qt/request/nexrad_file_request.cpp
+                source/scwx/qt/request/nexrad_load_group.cpp)
 set(HDR_SETTINGS source/scwx/qt/settings/alert_palette_settings.hpp
                  source/scwx/qt/settings/audio_settings.hpp
                  source/scwx/qt/settings/general_settings.hpp
@@ -219,11 +252,13 @@ set(HDR_TYPES source/scwx/qt/types/alert_types.hpp
               source/scwx/qt/types/hotkey_types.hpp
               source/scwx/qt/types/icon_types.hpp
               source/scwx/qt/types/imgui_font.hpp
+              source/scwx/qt/types/latency_types.hpp
               source/scwx/qt/types/layer_types.hpp
               source/scwx/qt/types/location_types.hpp
               source/scwx/qt/types/map_types.hpp
               source/scwx/qt/types/media_types.hpp
               source/scwx/qt/types/marker_types.hpp
+              source/scwx/qt/types/mosaic_types.hpp
               source/scwx/qt/types/qt_types.hpp
               source/scwx/qt/types/radar_product_record.hpp
               source/scwx/qt/types/text_event_key.hpp
@@ -236,10 +271,12 @@ set(SRC_TYPES source/scwx/qt/types/alert_types.cpp
               source/scwx/qt/types/hotkey_types.cpp
               source/scwx/qt/types/icon_types.cpp
               source/scwx/qt/types/imgui_font.cpp
+              source/scwx/qt/types/latency_types.cpp
               source/scwx/qt/types/layer_types.cpp
               source/scwx/qt/types/location_types.cpp
               source/scwx/qt/types/map_types.cpp
               source/scwx/qt/types/media_types.cpp
+              source/scwx/qt/types/mosaic_types.cpp
               source/scwx/qt/types/qt_types.cpp
               source/scwx/qt/types/radar_product_record.cpp
               source/scwx/qt/types/text_event_key.cpp
@@ -253,6 +290,7 @@ set(HDR_UI source/scwx/qt/ui/about_dialog.hpp
            source/scwx/qt/ui/animation_dock_widget.hpp
            source/scwx/qt/ui/collapsible_group.hpp
            source/scwx/qt/ui/county_dialog.hpp
+           source/scwx/qt/ui/cross_section_dock_widget.hpp
            source/scwx/qt/ui/download_dialog.hpp
            source/scwx/qt/ui/edit_line_dialog.hpp
            source/scwx/qt/ui/flow_layout.hpp
@@ -266,6 +304,8 @@ set(HDR_UI source/scwx/qt/ui/about_dialog.hpp
            source/scwx/qt/ui/level2_settings_widget.hpp
            source/scwx/qt/ui/level3_products_widget.hpp
            source/scwx/qt/ui/line_label.hpp
+           source/scwx/qt/ui/loop_export_dialog.hpp
+           source/scwx/qt/ui/map_prefetch_dialog.hpp
            source/scwx/qt/ui/open_url_dialog.hpp
            source/scwx/qt/ui/placefile_dialog.hpp
            source/scwx/qt/ui/placefile_settings_widget.hpp
@@ -283,6 +323,7 @@ set(SRC_UI source/scwx/qt/ui/about_dialog.cpp
            source/scwx/qt/ui/animation_dock_widget.cpp
            source/scwx/qt/ui/collapsible_group.cpp
            source/scwx/qt/ui/county_dialog.cpp
+           source/scwx/qt/ui/cross_section_dock_widget.cpp
            source/scwx/qt/ui/download_dialog.cpp
            source/scwx/qt/ui/edit_line_dialog.cpp
            source/scwx/qt/ui/flow_layout.cpp
@@ -296,6 +337,8 @@ set(SRC_UI source/scwx/qt/ui/about_dialog.cpp
            source/scwx/qt/ui/level2_settings_widget.cpp
            source/scwx/qt/ui/level3_products_widget.cpp
            source/scwx/qt/ui/line_label.cpp
+           source/scwx/qt/ui/loop_export_dialog.cpp
+           source/scwx/qt/ui/map_prefetch_dialog.cpp
            source/scwx/qt/ui/open_url_dialog.cpp
            source/scwx/qt/ui/placefile_dialog.cpp
            source/scwx/qt/ui/placefile_settings_widget.cpp
@@ -348,61 +391,102 @@ set(SRC_UI_SETUP source/scwx/qt/ui/setup/audio_codec_page.cpp
                  source/scwx/qt/ui/setup/map_provider_page.cpp
                  source/scwx/qt/ui/setup/setup_wizard.cpp
                  source/scwx/qt/ui/setup/welcome_page.cpp)
-set(HDR_UTIL source/scwx/qt/util/color.hpp
+set(HDR_UTIL source/scwx/qt/util/alert_index.hpp
+             source/scwx/qt/util/azimuth_index.hpp
+             source/scwx/qt/util/cluster_index.hpp
+             source/scwx/qt/util/coalesced_signal.hpp
+             source/scwx/qt/util/color.hpp
+             source/scwx/qt/util/cross_section.hpp
+             source/scwx/qt/util/elevation_scan_inspector.hpp
              source/scwx/qt/util/file.hpp
              source/scwx/qt/util/geographic_lib.hpp
              source/scwx/qt/util/imgui.hpp
              source/scwx/qt/util/json.hpp
+             source/scwx/qt/util/line_simplification.hpp
              source/scwx/qt/util/maplibre.hpp
+             source/scwx/qt/util/mosaic_sweep.hpp
              source/scwx/qt/util/network.hpp
+             source/scwx/qt/util/position_filter.hpp
              source/scwx/qt/util/streams.hpp
              source/scwx/qt/util/texture_atlas.hpp
+             source/scwx/qt/util/texture_compression.hpp
              source/scwx/qt/util/q_file_buffer.hpp
              source/scwx/qt/util/q_file_input_stream.hpp
+             source/scwx/qt/util/spatial_index.hpp
              source/scwx/qt/util/time.hpp
              source/scwx/qt/util/tooltip.hpp)
-set(SRC_UTIL source/scwx/qt/util/color.cpp
+set(SRC_UTIL source/scwx/qt/util/alert_index.cpp
+             source/scwx/qt/util/azimuth_index.cpp
+             source/scwx/qt/util/cluster_index.cpp
+             source/scwx/qt/util/coalesced_signal.cpp
+             source/scwx/qt/util/color.cpp
+             source/scwx/qt/util/cross_section.cpp
+             source/scwx/qt/util/elevation_scan_inspector.cpp
              source/scwx/qt/util/file.cpp
              source/scwx/qt/util/geographic_lib.cpp
              source/scwx/qt/util/imgui.cpp
              source/scwx/qt/util/json.cpp
+             source/scwx/qt/util/line_simplification.cpp
              source/scwx/qt/util/maplibre.cpp
+             source/scwx/qt/util/mosaic_sweep.cpp
              source/scwx/qt/util/network.cpp
+             source/scwx/qt/util/position_filter.cpp
              source/scwx/qt/util/texture_atlas.cpp
+             source/scwx/qt/util/texture_compression.cpp
              source/scwx/qt/util/q_file_buffer.cpp
              source/scwx/qt/util/q_file_input_stream.cpp
+             source/scwx/qt/util/spatial_index.cpp
              source/scwx/qt/util/time.cpp
              source/scwx/qt/util/tooltip.cpp)
-set(HDR_VIEW source/scwx/qt/view/level2_product_view.hpp
+set(HDR_VIEW source/scwx/qt/view/color_table_cache.hpp
+             source/scwx/qt/view/color_table_lut_cache.hpp
+             source/scwx/qt/view/cross_section_view.hpp
+             source/scwx/qt/view/level2_product_view.hpp
+             source/scwx/qt/view/level2_sweep_cache.hpp
              source/scwx/qt/view/level3_product_view.hpp
              source/scwx/qt/view/level3_radial_view.hpp
              source/scwx/qt/view/level3_raster_view.hpp
+             source/scwx/qt/view/level3_sweep_cache.hpp
              source/scwx/qt/view/overlay_product_view.hpp
              source/scwx/qt/view/radar_product_view.hpp
-             source/scwx/qt/view/radar_product_view_factory.hpp)
-set(SRC_VIEW source/scwx/qt/view/level2_product_view.cpp
+             source/scwx/qt/view/radar_product_view_factory.hpp
+             source/scwx/qt/view/radar_product_view_pool.hpp)
+set(SRC_VIEW source/scwx/qt/view/color_table_cache.cpp
+             source/scwx/qt/view/color_table_lut_cache.cpp
+             source/scwx/qt/view/cross_section_view.cpp
+             source/scwx/qt/view/level2_product_view.cpp
+             source/scwx/qt/view/level2_sweep_cache.cpp
              source/scwx/qt/view/level3_product_view.cpp
              source/scwx/qt/view/level3_radial_view.cpp
              source/scwx/qt/view/level3_raster_view.cpp
+             source/scwx/qt/view/level3_sweep_cache.cpp
              source/scwx/qt/view/overlay_product_view.cpp
              source/scwx/qt/view/radar_product_view.cpp
-             source/scwx/qt/view/radar_product_view_factory.cpp)
+             source/scwx/qt/view/radar_product_view_factory.cpp
+             source/scwx/qt/view/radar_product_view_pool.cpp)
 
 set(RESOURCE_FILES scwx-qt.qrc)
 
 set(SHADER_FILES gl/color.frag
                  gl/color.vert
+                 gl/display.glsl
                  gl/geo_line.vert
                  gl/geo_texture2d.vert
+                 gl/geo_texture2d_instanced.vert
                  gl/map_color.vert
                  gl/radar.frag
                  gl/radar.vert
+                 gl/radar_mosaic.frag
+                 gl/radar_mosaic.vert
+                 gl/radar_mosaic_composite.frag
+                 gl/radar_mosaic_composite.vert
                  gl/texture1d.frag
                  gl/texture1d.vert
                  gl/texture2d.frag
                  gl/texture2d_array.frag
                  gl/texture2d_array.vert
-                 gl/threshold.geom)
+                 gl/upscale.frag
+                 gl/upscale.vert)
 
 set(CMAKE_FILES scwx-qt.cmake)
 
@@ -1,13 +1,13 @@
 #include <scwx/qt/config/county_database.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
-#include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
-#include <QFile>
-#include <QStandardPaths>
+#include <QResource>
 #include <sqlite3.h>
 
 namespace scwx
@@ -24,56 +24,47 @@ static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
 static const std::string countyDatabaseFilename_ = ":/res/db/counties.db";
 
+// Maximum number of states, per county or zone format, kept loaded
+static constexpr std::size_t kMaxLoadedStates_ = 16u;
+
 typedef std::unordered_map<std::string, std::string> CountyMap;
-typedef std::unordered_map<std::string, CountyMap>   StateMap;
-typedef std::unordered_map<char, StateMap>           FormatMap;
 
-static bool                                         initialized_ {false};
-static FormatMap                                    countyDatabase_;
+static std::once_flag                               initializeFlag_ {};
 static std::unordered_map<std::string, std::string> stateMap_;
 static std::unordered_map<std::string, std::string> wfoMap_;
 
-void Initialize()
-{
-   if (initialized_)
-   {
-      return;
-   }
+// The bundled database is opened in place, and counties are loaded by state
+// on demand
+static std::mutex    databaseMutex_ {};
+static QByteArray    databaseData_ {};
+static sqlite3*      db_ {nullptr};
+static sqlite3_stmt* countiesStatement_ {nullptr};
 
-   logger_->debug("Loading database");
-
-   // Generate UUID for temporary file
-   boost::uuids::uuid uuid = boost::uuids::random_generator()();
+// Loaded counties, keyed by state and format (e.g., "MOC"), most recently used
+// last
+static std::vector<std::pair<std::string, CountyMap>> loadedStates_ {};
 
-   std::string tempPath {
-      QStandardPaths::writableLocation(QStandardPaths::TempLocation)
-         .toStdString()};
-   std::string countyDatabaseCache {tempPath + "/scwx-" +
-                                    boost::uuids::to_string(uuid)};
+static void             LoadDatabase();
+static const CountyMap& GetStateCounties(const std::string& prefix);
 
-   // Create cache directory if it doesn't exist
-   if (!std::filesystem::exists(tempPath))
-   {
-      if (!std::filesystem::create_directories(tempPath))
-      {
-         logger_->error("Unable to create temp directory: \"{}\"", tempPath);
-         return;
-      }
-   }
+void Initialize()
+{
+   // Concurrent callers wait for the database to be loaded
+   std::call_once(initializeFlag_, LoadDatabase);
+}
 
-   // Remove existing county database if it exists
-   if (std::filesystem::exists(countyDatabaseCache))
-   {
-      std::filesystem::remove(countyDatabaseCache);
-   }
+static void LoadDatabase()
+{
+   logger_->debug("Loading database");
 
-   // Create a fresh copy of the county database in the temporary directory
-   QFile countyDatabaseFile(QString::fromStdString(countyDatabaseFilename_));
-   if (!countyDatabaseFile.copy(QString::fromStdString(countyDatabaseCache)))
+   // Use the bundled database in place. Data that is not compressed in the
+   // resource is not copied.
+   QResource resource {QString::fromStdString(countyDatabaseFilename_)};
+   databaseData_ = resource.uncompressedData();
+   if (databaseData_.isEmpty())
    {
-      logger_->error("Unable to create cached copy of database: \"{}\" ({})",
-                     countyDatabaseCache,
-                     countyDatabaseFile.errorString().toStdString());
+      logger_->error("Unable to load database: \"{}\"",
+                     countyDatabaseFilename_);
       return;
    }
 
@@ -82,58 +73,26 @@ void Initialize()
    int      rc;
    char*    errorMessage = nullptr;
 
-   rc = sqlite3_open(countyDatabaseCache.c_str(), &db);
-   if (rc != SQLITE_OK)
+   rc = sqlite3_open(":memory:", &db);
+   if (rc == SQLITE_OK)
    {
-      logger_->error("Unable to open database: \"{}\"", countyDatabaseCache);
-      sqlite3_close(db);
-      std::filesystem::remove(countyDatabaseCache);
-      return;
+      // SQLite does not modify a read-only database, and does not take
+      // ownership of the data
+      rc = sqlite3_deserialize(
+         db,
+         "main",
+         reinterpret_cast<unsigned char*>(
+            const_cast<char*>(databaseData_.constData())),
+         databaseData_.size(),
+         databaseData_.size(),
+         SQLITE_DESERIALIZE_READONLY);
    }
-
-   // Ensure counties exists
-   countyDatabase_.emplace('C', StateMap {});
-
-   // Query database for counties
-   rc = sqlite3_exec(
-      db,
-      "SELECT * FROM counties",
-      [](void* /* param */,
-         int    columns,
-         char** columnText,
-         char** /* columnName */) -> int
-      {
-         int status = 0;
-
-         if (columns == 2 && std::strlen(columnText[0]) == 6)
-         {
-            std::string fipsId = columnText[0];
-            std::string state  = fipsId.substr(0, 2);
-            char        type   = fipsId.at(2);
-
-            countyDatabase_[type][state].emplace(fipsId, columnText[1]);
-         }
-         else if (columns != 2)
-         {
-            logger_->error(
-               "County database format error, invalid number of columns: {}",
-               columns);
-            status = -1;
-         }
-         else
-         {
-            logger_->error("Invalid FIPS ID: {}", columnText[0]);
-            status = -1;
-         }
-
-         return status;
-      },
-      nullptr,
-      &errorMessage);
    if (rc != SQLITE_OK)
    {
-      logger_->error("SQL error: {}", errorMessage);
-      sqlite3_free(errorMessage);
+      logger_->error("Unable to open database: {}", sqlite3_errmsg(db));
+      sqlite3_close(db);
+      databaseData_.clear();
+      return;
    }
 
    // Query database for states
@@ -202,42 +161,90 @@ void Initialize()
       sqlite3_free(errorMessage);
    }
 
-   // Close database
-   sqlite3_close(db);
+   // Prepare the county query, by the first three characters of the ID
+   rc = sqlite3_prepare_v2(db,
+                           "SELECT id, name FROM counties "
+                           "WHERE id >= ?1 AND id < ?2",
+                           -1,
+                           &countiesStatement_,
+                           nullptr);
+   if (rc != SQLITE_OK)
+   {
+      logger_->error("SQL error: {}", sqlite3_errmsg(db));
+   }
+
+   db_ = db;
+}
+
+static const CountyMap& GetStateCounties(const std::string& prefix)
+{
+   // The database mutex must be held by the caller
+   auto it = std::find_if(loadedStates_.begin(),
+                          loadedStates_.end(),
+                          [&](const auto& entry)
+                          { return entry.first == prefix; });
+
+   if (it != loadedStates_.end())
+   {
+      // Mark the state as most recently used
+      std::rotate(it, std::next(it), loadedStates_.end());
+      return loadedStates_.back().second;
+   }
+
+   if (loadedStates_.size() >= kMaxLoadedStates_)
+   {
+      // Evict the least recently used
+      loadedStates_.erase(loadedStates_.begin());
+   }
+
+   CountyMap counties {};
 
-   // Remove temporary file
-   std::error_code error;
-   if (!std::filesystem::remove(countyDatabaseCache, error))
+   if (countiesStatement_ != nullptr)
    {
-      logger_->warn("Unable to remove cached copy of database: {}",
-                    error.message());
+      // Select each ID beginning with the prefix
+      std::string upperBound = prefix;
+      ++upperBound.back();
+
+      sqlite3_bind_text(
+         countiesStatement_, 1, prefix.c_str(), -1, SQLITE_TRANSIENT);
+      sqlite3_bind_text(
+         countiesStatement_, 2, upperBound.c_str(), -1, SQLITE_TRANSIENT);
+
+      while (sqlite3_step(countiesStatement_) == SQLITE_ROW)
+      {
+         const char* id = reinterpret_cast<const char*>(
+            sqlite3_column_text(countiesStatement_, 0));
+         const char* name = reinterpret_cast<const char*>(
+            sqlite3_column_text(countiesStatement_, 1));
+
+         if (id != nullptr && name != nullptr && std::strlen(id) == 6)
+         {
+            counties.emplace(id, name);
+         }
+      }
+
+      sqlite3_reset(countiesStatement_);
+      sqlite3_clear_bindings(countiesStatement_);
    }
 
-   initialized_ = true;
+   loadedStates_.emplace_back(prefix, std::move(counties));
+   return loadedStates_.back().second;
 }
 
 std::string GetCountyName(const std::string& id)
 {
+   Initialize();
+
    if (id.length() > 3)
    {
       // SSFNNN
-      char        format = id.at(2);
-      std::string state  = id.substr(0, 2);
+      std::unique_lock lock {databaseMutex_};
 
-      auto stateIt = countyDatabase_.find(format);
-      if (stateIt != countyDatabase_.cend())
+      const CountyMap& counties = GetStateCounties(id.substr(0, 3));
+      auto             it       = counties.find(id);
+      if (it != counties.cend())
       {
-         StateMap& states   = stateIt->second;
-         auto      countyIt = states.find(state);
-         if (countyIt != states.cend())
-         {
-            CountyMap& counties = countyIt->second;
-            auto       it       = counties.find(id);
-            if (it != counties.cend())
-            {
-               return it->second;
-            }
-         }
+         return it->second;
       }
    }
 
@@ -247,30 +254,31 @@ std::string GetCountyName(const std::string& id)
 std::unordered_map<std::string, std::string>
 GetCounties(const std::string& state)
 {
-   std::unordered_map<std::string, std::string> counties {};
+   Initialize();
 
-   StateMap& states = countyDatabase_.at('C');
-   auto      it     = states.find(state);
-   if (it != states.cend())
-   {
-      counties = it->second;
-   }
+   std::unique_lock lock {databaseMutex_};
 
-   return counties;
+   return GetStateCounties(state + 'C');
 }
 
 const std::unordered_map<std::string, std::string>& GetStates()
 {
+   Initialize();
+
    return stateMap_;
 }
 
 const std::unordered_map<std::string, std::string>& GetWFOs()
 {
+   Initialize();
+
    return wfoMap_;
 }
 
 const std::string& GetWFOName(const std::string& wfoId)
 {
+   Initialize();
+
    auto wfo = wfoMap_.find(wfoId);
    if (wfo == wfoMap_.end())
    {
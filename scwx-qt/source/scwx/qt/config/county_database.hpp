@@ -14,6 +14,13 @@ namespace config
 namespace CountyDatabase
 {
 
+/**
+ * @brief Opens the county database, and loads states and WFOs. Counties are
+ * loaded by state when first looked up. Initialization may run on a
+ * background thread. The database is opened on first use if it has not been
+ * initialized, and lookups wait for initialization in progress on another
+ * thread.
+ */
 void        Initialize();
 std::string GetCountyName(const std::string& id);
 std::unordered_map<std::string, std::string>
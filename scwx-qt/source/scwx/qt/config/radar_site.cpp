@@ -4,10 +4,17 @@
 #include <scwx/common/sites.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <numbers>
 #include <shared_mutex>
 #include <unordered_map>
 
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+#include <boost/iterator/function_output_iterator.hpp>
 #include <boost/json.hpp>
 
 #if (__cpp_lib_chrono < 201907L)
@@ -30,12 +37,27 @@ static const std::string defaultRadarSiteFile_ =
 static const std::unordered_map<std::string, std::string> typeNameMap_ {
    {"wsr88d", "WSR-88D"}, {"tdwr", "TDWR"}, {"?", "?"}};
 
+// Number of sites nearest on the sphere whose distance on the ellipsoid is
+// compared when finding the nearest site
+static constexpr std::size_t kNearestCandidates_ = 8u;
+
+namespace bg  = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+// Radar sites are indexed by their position on the unit sphere. The sites
+// nearest by straight line distance are the sites nearest on the sphere.
+typedef bg::model::point<double, 3, bg::cs::cartesian> SitePoint;
+typedef std::pair<SitePoint, std::shared_ptr<RadarSite>> SiteValue;
+
 static std::unordered_map<std::string, std::shared_ptr<RadarSite>>
                                                     radarSiteMap_;
 static std::unordered_map<std::string, std::string> siteIdMap_;
 static std::shared_mutex                            siteMutex_;
 
-static bool ValidateJsonEntry(const boost::json::object& o);
+static bgi::rtree<SiteValue, bgi::quadratic<16>> siteIndex_ {};
+
+static SitePoint ToSitePoint(double latitude, double longitude);
+static bool      ValidateJsonEntry(const boost::json::object& o);
 
 class RadarSiteImpl
 {
@@ -180,32 +202,78 @@ std::shared_ptr<RadarSite> RadarSite::FindNearest(
    std::shared_ptr<RadarSite> nearestRadarSite = nullptr;
    double                     nearestDistance  = 0.0;
 
-   for (const auto& site : radarSiteMap_)
-   {
-      auto& radarSite = site.second;
+   // Compare the distance on the ellipsoid of the sites nearest on the sphere
+   siteIndex_.query(
+      bgi::nearest(ToSitePoint(latitude, longitude), kNearestCandidates_) &&
+         bgi::satisfies(
+            [&](const SiteValue& value)
+            {
+               // If the type filter doesn't match, skip
+               return !type.has_value() || value.second->type() == type;
+            }),
+      boost::make_function_output_iterator(
+         [&](const SiteValue& value)
+         {
+            auto& radarSite = value.second;
+
+            // Calculate distance to radar site
+            util::GeographicLib::DefaultGeodesic().Inverse(
+               latitude,
+               longitude,
+               radarSite->latitude(),
+               radarSite->longitude(),
+               distanceInMeters);
+
+            // If the radar site is the closer, record it as the closest
+            if (nearestRadarSite == nullptr ||
+                distanceInMeters < nearestDistance)
+            {
+               nearestRadarSite = radarSite;
+               nearestDistance  = distanceInMeters;
+            }
+         }));
 
-      // If the type filter doesn't match, skip
-      if (type.has_value() && radarSite->type() != type)
-      {
-         continue;
-      }
+   return nearestRadarSite;
+}
 
-      // Calculate distance to radar site
-      util::GeographicLib::DefaultGeodesic().Inverse(latitude,
-                                                     longitude,
-                                                     radarSite->latitude(),
-                                                     radarSite->longitude(),
-                                                     distanceInMeters);
+std::vector<std::shared_ptr<RadarSite>>
+RadarSite::FindNearby(double latitude, double longitude, std::size_t count)
+{
+   std::shared_lock lock(siteMutex_);
 
-      // If the radar site is the closer, record it as the closest
-      if (nearestRadarSite == nullptr || distanceInMeters < nearestDistance)
-      {
-         nearestRadarSite = radarSite;
-         nearestDistance  = distanceInMeters;
-      }
+   std::vector<std::pair<double, std::shared_ptr<RadarSite>>> candidates {};
+
+   // Order the sites nearest on the sphere by their distance on the ellipsoid
+   siteIndex_.query(
+      bgi::nearest(ToSitePoint(latitude, longitude), count),
+      boost::make_function_output_iterator(
+         [&](const SiteValue& value)
+         {
+            auto&  radarSite = value.second;
+            double distanceInMeters;
+
+            util::GeographicLib::DefaultGeodesic().Inverse(
+               latitude,
+               longitude,
+               radarSite->latitude(),
+               radarSite->longitude(),
+               distanceInMeters);
+
+            candidates.emplace_back(distanceInMeters, radarSite);
+         }));
+
+   std::sort(candidates.begin(),
+             candidates.end(),
+             [](auto& a, auto& b) { return a.first < b.first; });
+
+   std::vector<std::shared_ptr<RadarSite>> nearbyRadarSites {};
+   nearbyRadarSites.reserve(candidates.size());
+   for (auto& candidate : candidates)
+   {
+      nearbyRadarSites.push_back(candidate.second);
    }
 
-   return nearestRadarSite;
+   return nearbyRadarSites;
 }
 
 std::string GetRadarIdFromSiteId(const std::string& siteId)
@@ -288,6 +356,9 @@ size_t RadarSite::ReadConfig(const std::string& path)
             if (!radarSiteMap_.contains(site->p->id_))
             {
                radarSiteMap_[site->p->id_] = site;
+               siteIndex_.insert(
+                  {ToSitePoint(site->p->latitude_, site->p->longitude_),
+                   site});
                ++sitesAdded;
             }
 
@@ -310,6 +381,16 @@ size_t RadarSite::ReadConfig(const std::string& path)
    return sitesAdded;
 }
 
+static SitePoint ToSitePoint(double latitude, double longitude)
+{
+   const double lat = latitude * std::numbers::pi / 180.0;
+   const double lon = longitude * std::numbers::pi / 180.0;
+
+   return {std::cos(lat) * std::cos(lon),
+           std::cos(lat) * std::sin(lon),
+           std::sin(lat)};
+}
+
 static bool ValidateJsonEntry(const boost::json::object& o)
 {
    return (o.contains("type") && o.at("type").is_string() &&       //
@@ -58,6 +58,18 @@ public:
                double                     longitude,
                std::optional<std::string> type = std::nullopt);
 
+   /**
+    * Find the radar sites nearest to the supplied location.
+    *
+    * @param latitude Latitude in degrees
+    * @param longitude Longitude in degrees
+    * @param count Maximum number of radar sites
+    *
+    * @return Nearest radar sites, ordered from nearest to farthest
+    */
+   static std::vector<std::shared_ptr<RadarSite>>
+   FindNearby(double latitude, double longitude, std::size_t count);
+
    static void   Initialize();
    static size_t ReadConfig(const std::string& path);
 
@@ -0,0 +1,2 @@
+#define STB_DXT_IMPLEMENTATION
+#include <stb_dxt.h>
@@ -1,11 +1,13 @@
 #include <scwx/qt/gl/draw/geo_icons.hpp>
+#include <scwx/qt/gl/dynamic_buffer.hpp>
 #include <scwx/qt/types/icon_types.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
 
-#include <execution>
+#include <algorithm>
 
 #include <boost/unordered/unordered_flat_map.hpp>
 #include <boost/unordered/unordered_flat_set.hpp>
@@ -22,21 +24,22 @@ namespace draw
 static const std::string logPrefix_ = "scwx::qt::gl::draw::geo_icons";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
-static constexpr std::size_t kNumRectangles        = 1;
-static constexpr std::size_t kNumTriangles         = kNumRectangles * 2;
-static constexpr std::size_t kVerticesPerTriangle  = 3;
-static constexpr std::size_t kVerticesPerRectangle = kVerticesPerTriangle * 2;
-static constexpr std::size_t kPointsPerVertex      = 9;
-static constexpr std::size_t kPointsPerTexCoord    = 3;
-static constexpr std::size_t kIconBufferLength =
-   kNumTriangles * kVerticesPerTriangle * kPointsPerVertex;
-static constexpr std::size_t kTextureBufferLength =
-   kNumTriangles * kVerticesPerTriangle * kPointsPerTexCoord;
+// Each icon is an instance of a single rectangle, drawn as a triangle strip
+static constexpr std::size_t kVerticesPerRectangle = 4;
+static constexpr std::size_t kPointsPerVertex      = 2;
+
+// Latitude, longitude, X/Y rectangle, modulate, angle
+static constexpr std::size_t kIconBufferLength = 11;
+
+// Texture rectangle, layer
+static constexpr std::size_t kTextureBufferLength = 5;
 
 // Threshold, start time, end time, displayed
-static constexpr std::size_t kIntegersPerVertex_ = 4;
-static constexpr std::size_t kIntegerBufferLength_ =
-   kNumTriangles * kVerticesPerTriangle * kIntegersPerVertex_;
+static constexpr std::size_t kIntegerBufferLength_ = 4;
+
+// BL, TL, BR, TR
+static constexpr std::array<float, kVerticesPerRectangle * kPointsPerVertex>
+   kRectangleVertices_ {0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.0f};
 
 struct GeoIconDrawItem
 {
@@ -82,7 +85,7 @@ public:
        uSelectedTimeLocation_(GL_INVALID_INDEX),
        vao_ {GL_INVALID_INDEX},
        vbo_ {GL_INVALID_INDEX},
-       numVertices_ {0}
+       numInstances_ {0}
    {
    }
 
@@ -95,8 +98,12 @@ public:
                                   std::vector<GLint>&          integerBuffer,
                                   std::vector<IconHoverEntry>& hoverIcons);
    void        UpdateTextureBuffer();
+   void
+   UpdateSingleTextureBuffer(const std::shared_ptr<GeoIconDrawItem>& di,
+                             std::size_t                             iconIndex);
    void        UpdateModifiedIconBuffers();
    void        Update(bool textureAtlasChanged);
+   void        UpdateHoverIndex();
 
    std::shared_ptr<GlContext> context_;
 
@@ -127,9 +134,16 @@ public:
 
    std::vector<float> textureBuffer_ {};
 
+   DynamicBuffer iconDynamicBuffer_ {kIconBufferLength * sizeof(float)};
+   DynamicBuffer textureDynamicBuffer_ {kTextureBufferLength * sizeof(float)};
+   DynamicBuffer integerDynamicBuffer_ {kIntegerBufferLength_ * sizeof(GLint)};
+
    std::vector<IconHoverEntry> currentHoverIcons_ {};
    std::vector<IconHoverEntry> newHoverIcons_ {};
 
+   util::SpatialIndex hoverIndex_ {};
+   bool               hoverIndexDirty_ {false};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
    GLint                          uMapMatrixLocation_;
@@ -138,9 +152,9 @@ public:
    GLint                          uSelectedTimeLocation_;
 
    GLuint                vao_;
-   std::array<GLuint, 3> vbo_;
+   std::array<GLuint, 4> vbo_;
 
-   GLsizei numVertices_;
+   GLsizei numInstances_;
 };
 
 GeoIcons::GeoIcons(const std::shared_ptr<GlContext>& context) :
@@ -168,8 +182,7 @@ void GeoIcons::Initialize()
    gl::OpenGLFunctions& gl = p->context_->gl();
 
    p->shaderProgram_ = p->context_->GetShaderProgram(
-      {{GL_VERTEX_SHADER, ":/gl/geo_texture2d.vert"},
-       {GL_GEOMETRY_SHADER, ":/gl/threshold.geom"},
+      {{GL_VERTEX_SHADER, ":/gl/geo_texture2d_instanced.vert"},
        {GL_FRAGMENT_SHADER, ":/gl/texture2d_array.frag"}});
 
    p->uMVPMatrixLocation_ = p->shaderProgram_->GetUniformLocation("uMVPMatrix");
@@ -185,10 +198,15 @@ void GeoIcons::Initialize()
    gl.glGenBuffers(static_cast<GLsizei>(p->vbo_.size()), p->vbo_.data());
 
    gl.glBindVertexArray(p->vao_);
+
+   // Rectangle vertices, shared by each instance
    gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
-   gl.glBufferData(GL_ARRAY_BUFFER, 0u, nullptr, GL_DYNAMIC_DRAW);
+   gl.glBufferData(GL_ARRAY_BUFFER,
+                   sizeof(kRectangleVertices_),
+                   kRectangleVertices_.data(),
+                   GL_STATIC_DRAW);
 
-   // aLatLong
+   // aVertex
    gl.glVertexAttribPointer(0,
                             2,
                             GL_FLOAT,
@@ -197,72 +215,101 @@ void GeoIcons::Initialize()
                             static_cast<void*>(0));
    gl.glEnableVertexAttribArray(0);
 
-   // aXYOffset
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
+   gl.glBufferData(GL_ARRAY_BUFFER, 0u, nullptr, GL_DYNAMIC_DRAW);
+
+   // aLatLong
    gl.glVertexAttribPointer(1,
                             2,
                             GL_FLOAT,
                             GL_FALSE,
-                            kPointsPerVertex * sizeof(float),
-                            reinterpret_cast<void*>(2 * sizeof(float)));
+                            kIconBufferLength * sizeof(float),
+                            static_cast<void*>(0));
+   gl.glVertexAttribDivisor(1, 1);
    gl.glEnableVertexAttribArray(1);
 
+   // aXYRect
+   gl.glVertexAttribPointer(2,
+                            4,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kIconBufferLength * sizeof(float),
+                            reinterpret_cast<void*>(2 * sizeof(float)));
+   gl.glVertexAttribDivisor(2, 1);
+   gl.glEnableVertexAttribArray(2);
+
    // aModulate
-   gl.glVertexAttribPointer(3,
+   gl.glVertexAttribPointer(5,
                             4,
                             GL_FLOAT,
                             GL_FALSE,
-                            kPointsPerVertex * sizeof(float),
-                            reinterpret_cast<void*>(4 * sizeof(float)));
-   gl.glEnableVertexAttribArray(3);
+                            kIconBufferLength * sizeof(float),
+                            reinterpret_cast<void*>(6 * sizeof(float)));
+   gl.glVertexAttribDivisor(5, 1);
+   gl.glEnableVertexAttribArray(5);
 
    // aAngle
-   gl.glVertexAttribPointer(4,
+   gl.glVertexAttribPointer(6,
                             1,
                             GL_FLOAT,
                             GL_FALSE,
-                            kPointsPerVertex * sizeof(float),
-                            reinterpret_cast<void*>(8 * sizeof(float)));
-   gl.glEnableVertexAttribArray(4);
+                            kIconBufferLength * sizeof(float),
+                            reinterpret_cast<void*>(10 * sizeof(float)));
+   gl.glVertexAttribDivisor(6, 1);
+   gl.glEnableVertexAttribArray(6);
 
-   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[2]);
    gl.glBufferData(GL_ARRAY_BUFFER, 0u, nullptr, GL_DYNAMIC_DRAW);
 
-   // aTexCoord
-   gl.glVertexAttribPointer(2,
-                            3,
+   // aTexRect
+   gl.glVertexAttribPointer(3,
+                            4,
                             GL_FLOAT,
                             GL_FALSE,
-                            kPointsPerTexCoord * sizeof(float),
+                            kTextureBufferLength * sizeof(float),
                             static_cast<void*>(0));
-   gl.glEnableVertexAttribArray(2);
+   gl.glVertexAttribDivisor(3, 1);
+   gl.glEnableVertexAttribArray(3);
 
-   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[2]);
+   // aTexLayer
+   gl.glVertexAttribPointer(4,
+                            1,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kTextureBufferLength * sizeof(float),
+                            reinterpret_cast<void*>(4 * sizeof(float)));
+   gl.glVertexAttribDivisor(4, 1);
+   gl.glEnableVertexAttribArray(4);
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[3]);
    gl.glBufferData(GL_ARRAY_BUFFER, 0u, nullptr, GL_DYNAMIC_DRAW);
 
    // aThreshold
-   gl.glVertexAttribIPointer(5, //
+   gl.glVertexAttribIPointer(7,
                              1,
                              GL_INT,
-                             0,
+                             kIntegerBufferLength_ * sizeof(GLint),
                              static_cast<void*>(0));
-   gl.glEnableVertexAttribArray(5);
+   gl.glVertexAttribDivisor(7, 1);
+   gl.glEnableVertexAttribArray(7);
 
    // aTimeRange
-   gl.glVertexAttribIPointer(6, //
+   gl.glVertexAttribIPointer(8,
                              2,
                              GL_INT,
-                             kIntegersPerVertex_ * sizeof(GLint),
+                             kIntegerBufferLength_ * sizeof(GLint),
                              reinterpret_cast<void*>(1 * sizeof(GLint)));
-   gl.glEnableVertexAttribArray(6);
+   gl.glVertexAttribDivisor(8, 1);
+   gl.glEnableVertexAttribArray(8);
 
    // aDisplayed
-   gl.glVertexAttribPointer(7,
-                            1,
-                            GL_INT,
-                            GL_FALSE,
-                            kIntegersPerVertex_ * sizeof(GLint),
-                            reinterpret_cast<void*>(3 * sizeof(float)));
-   gl.glEnableVertexAttribArray(7);
+   gl.glVertexAttribIPointer(9,
+                             1,
+                             GL_INT,
+                             kIntegerBufferLength_ * sizeof(GLint),
+                             reinterpret_cast<void*>(3 * sizeof(GLint)));
+   gl.glVertexAttribDivisor(9, 1);
+   gl.glEnableVertexAttribArray(9);
 
    p->dirty_ = true;
 }
@@ -286,7 +333,7 @@ void GeoIcons::Render(const QMapLibre::CustomLayerRenderParameters& params,
    {
       gl::OpenGLFunctions& gl = p->context_->gl();
 
-      gl.glBindVertexArray(p->vao_);
+      p->context_->state_cache().BindVertexArray(p->vao_);
 
       p->Update(textureAtlasChanged);
       p->shaderProgram_->Use();
@@ -323,7 +370,8 @@ void GeoIcons::Render(const QMapLibre::CustomLayerRenderParameters& params,
       gl.glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
       // Draw icons
-      gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+      gl.glDrawArraysInstanced(
+         GL_TRIANGLE_STRIP, 0, kVerticesPerRectangle, p->numInstances_);
    }
 }
 
@@ -342,6 +390,8 @@ void GeoIcons::Deinitialize()
    p->currentIconBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->textureBuffer_.clear();
+   p->hoverIndex_.Clear();
+   p->hoverIndexDirty_ = false;
 }
 
 void GeoIcons::SetVisible(bool visible)
@@ -404,6 +454,12 @@ std::shared_ptr<GeoIconDrawItem> GeoIcons::AddIcon()
    return p->newIconList_.emplace_back(std::make_shared<GeoIconDrawItem>());
 }
 
+void GeoIcons::RemoveIcon(const std::shared_ptr<GeoIconDrawItem>& di)
+{
+   std::erase(p->newIconList_, di);
+   p->dirtyIcons_.erase(di);
+}
+
 void GeoIcons::SetIconVisible(const std::shared_ptr<GeoIconDrawItem>& di,
                               bool                                    visible)
 {
@@ -530,7 +586,8 @@ void GeoIcons::FinishIcons()
    p->newHoverIcons_.clear();
 
    // Mark the draw item dirty
-   p->dirty_ = true;
+   p->dirty_           = true;
+   p->hoverIndexDirty_ = true;
 }
 
 void GeoIcons::Impl::UpdateBuffers()
@@ -538,8 +595,7 @@ void GeoIcons::Impl::UpdateBuffers()
    newIconBuffer_.clear();
    newIconBuffer_.reserve(newIconList_.size() * kIconBufferLength);
    newIntegerBuffer_.clear();
-   newIntegerBuffer_.reserve(newIconList_.size() * kVerticesPerRectangle *
-                             kIntegersPerVertex_);
+   newIntegerBuffer_.reserve(newIconList_.size() * kIntegerBufferLength_);
    newValidIconList_.clear();
    newHoverIcons_.clear();
 
@@ -638,21 +694,8 @@ void GeoIcons::Impl::UpdateSingleBuffer(
    const GLint v = static_cast<GLint>(di->visible_);
 
    // Icon initialize list data
-   const auto iconData = {
-      // Icon
-      lat, lon, lx, by, mc0, mc1, mc2, mc3, a, // BL
-      lat, lon, lx, ty, mc0, mc1, mc2, mc3, a, // TL
-      lat, lon, rx, by, mc0, mc1, mc2, mc3, a, // BR
-      lat, lon, rx, by, mc0, mc1, mc2, mc3, a, // BR
-      lat, lon, rx, ty, mc0, mc1, mc2, mc3, a, // TR
-      lat, lon, lx, ty, mc0, mc1, mc2, mc3, a  // TL
-   };
-   const auto integerData = {thresholdValue, startTime, endTime, v,
-                             thresholdValue, startTime, endTime, v,
-                             thresholdValue, startTime, endTime, v,
-                             thresholdValue, startTime, endTime, v,
-                             thresholdValue, startTime, endTime, v,
-                             thresholdValue, startTime, endTime, v};
+   const auto iconData    = {lat, lon, lx, by, rx, ty, mc0, mc1, mc2, mc3, a};
+   const auto integerData = {thresholdValue, startTime, endTime, v};
 
    // Buffer position data
    auto iconBufferPosition = iconBuffer.end();
@@ -728,90 +771,61 @@ void GeoIcons::Impl::UpdateSingleBuffer(
 
 void GeoIcons::Impl::UpdateTextureBuffer()
 {
-   textureBuffer_.clear();
-   textureBuffer_.reserve(currentIconList_.size() * kTextureBufferLength);
+   textureBuffer_.resize(currentIconList_.size() * kTextureBufferLength);
 
-   for (auto& di : currentIconList_)
+   for (std::size_t i = 0; i < currentIconList_.size(); ++i)
    {
-      auto it = currentIconSheets_.find(di->iconSheet_);
-      if (it == currentIconSheets_.cend())
-      {
-         // No file found. Should not get here, but insert empty data to match
-         // up with data already buffered
-         logger_->error("Could not find icon sheet: {}", di->iconSheet_);
-
-         // clang-format off
-         textureBuffer_.insert(
-            textureBuffer_.end(),
-            {
-               // Icon
-               0.0f, 0.0f, 0.0f, // BL
-               0.0f, 0.0f, 0.0f, // TL
-               0.0f, 0.0f, 0.0f, // BR
-               0.0f, 0.0f, 0.0f, // BR
-               0.0f, 0.0f, 0.0f, // TR
-               0.0f, 0.0f, 0.0f  // TL
-            });
-         // clang-format on
+      UpdateSingleTextureBuffer(currentIconList_[i], i);
+   }
+}
 
-         continue;
-      }
+void GeoIcons::Impl::UpdateSingleTextureBuffer(
+   const std::shared_ptr<GeoIconDrawItem>& di, std::size_t iconIndex)
+{
+   auto textureBufferPosition =
+      textureBuffer_.begin() + iconIndex * kTextureBufferLength;
 
-      auto& icon = it->second;
+   auto it = currentIconSheets_.find(di->iconSheet_);
+   if (it == currentIconSheets_.cend())
+   {
+      // No file found. Should not get here, but buffer empty data to match up
+      // with data already buffered
+      logger_->error("Could not find icon sheet: {}", di->iconSheet_);
 
-      // Validate icon
-      if (di->iconIndex_ >= icon->numIcons_)
-      {
-         // No icon found
-         logger_->error("Invalid icon index: {}", di->iconIndex_);
-
-         // Will get here if a texture changes, and the texture shrunk such that
-         // the icon is no longer found
-
-         // clang-format off
-         textureBuffer_.insert(
-            textureBuffer_.end(),
-            {
-               // Icon
-               0.0f, 0.0f, 0.0f, // BL
-               0.0f, 0.0f, 0.0f, // TL
-               0.0f, 0.0f, 0.0f, // BR
-               0.0f, 0.0f, 0.0f, // BR
-               0.0f, 0.0f, 0.0f, // TR
-               0.0f, 0.0f, 0.0f  // TL
-            });
-         // clang-format on
+      std::fill_n(textureBufferPosition, kTextureBufferLength, 0.0f);
+      return;
+   }
 
-         continue;
-      }
+   auto& icon = it->second;
 
-      // Texture coordinates
-      const std::size_t iconRow    = (di->iconIndex_) / icon->columns_;
-      const std::size_t iconColumn = (di->iconIndex_) % icon->columns_;
+   // Validate icon
+   if (di->iconIndex_ >= icon->numIcons_)
+   {
+      // No icon found
+      logger_->error("Invalid icon index: {}", di->iconIndex_);
 
-      const float iconX = iconColumn * icon->scaledWidth_;
-      const float iconY = iconRow * icon->scaledHeight_;
+      // Will get here if a texture changes, and the texture shrunk such that
+      // the icon is no longer found
+      std::fill_n(textureBufferPosition, kTextureBufferLength, 0.0f);
+      return;
+   }
 
-      const float ls = icon->texture_.sLeft_ + iconX;
-      const float rs = ls + icon->scaledWidth_;
-      const float tt = icon->texture_.tTop_ + iconY;
-      const float bt = tt + icon->scaledHeight_;
-      const float r  = static_cast<float>(icon->texture_.layerId_);
+   // Texture coordinates
+   const std::size_t iconRow    = (di->iconIndex_) / icon->columns_;
+   const std::size_t iconColumn = (di->iconIndex_) % icon->columns_;
 
-      // clang-format off
-      textureBuffer_.insert(
-         textureBuffer_.end(),
-         {
-            // Icon
-            ls, bt, r, // BL
-            ls, tt, r, // TL
-            rs, bt, r, // BR
-            rs, bt, r, // BR
-            rs, tt, r, // TR
-            ls, tt, r  // TL
-         });
-      // clang-format on
-   }
+   const float iconX = iconColumn * icon->scaledWidth_;
+   const float iconY = iconRow * icon->scaledHeight_;
+
+   const float ls = icon->texture_.sLeft_ + iconX;
+   const float rs = ls + icon->scaledWidth_;
+   const float tt = icon->texture_.tTop_ + iconY;
+   const float bt = tt + icon->scaledHeight_;
+   const float r  = static_cast<float>(icon->texture_.layerId_);
+
+   const auto textureData = {ls, bt, rs, tt, r};
+
+   std::copy(textureData.begin(), textureData.end(), textureBufferPosition);
 }
 
 void GeoIcons::Impl::UpdateModifiedIconBuffers()
@@ -829,21 +843,30 @@ void GeoIcons::Impl::UpdateModifiedIconBuffers()
          continue;
       }
 
-      auto iconIndex = std::distance(currentIconList_.cbegin(), it);
+      auto iconIndex = static_cast<std::size_t>(
+         std::distance(currentIconList_.cbegin(), it));
 
       UpdateSingleBuffer(di,
                          iconIndex,
                          currentIconBuffer_,
                          currentIntegerBuffer_,
                          currentHoverIcons_);
+
+      // The texture buffer is rebuilt when all icons are updated
+      if (!dirty_)
+      {
+         UpdateSingleTextureBuffer(di, iconIndex);
+      }
+
+      iconDynamicBuffer_.Modify(iconIndex);
+      textureDynamicBuffer_.Modify(iconIndex);
+      integerDynamicBuffer_.Modify(iconIndex);
+
+      hoverIndexDirty_ = true;
    }
 
    // Clear list of modified icons
-   if (!dirtyIcons_.empty())
-   {
-      dirtyIcons_.clear();
-      dirty_ = true;
-   }
+   dirtyIcons_.clear();
 }
 
 void GeoIcons::Impl::Update(bool textureAtlasChanged)
@@ -864,37 +887,26 @@ void GeoIcons::Impl::Update(bool textureAtlasChanged)
       // Update OpenGL texture buffer data
       UpdateTextureBuffer();
 
-      // Buffer texture data
-      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[1]);
-      gl.glBufferData(GL_ARRAY_BUFFER,
-                      sizeof(float) * textureBuffer_.size(),
-                      textureBuffer_.data(),
-                      GL_DYNAMIC_DRAW);
+      textureDynamicBuffer_.Invalidate();
 
       lastTextureAtlasChanged_ = false;
    }
 
-   // If buffers need updating
+   // If the icons have been updated, the entire buffer is reallocated
    if (dirty_)
    {
-      // Buffer vertex data
-      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
-      gl.glBufferData(GL_ARRAY_BUFFER,
-                      sizeof(float) * currentIconBuffer_.size(),
-                      currentIconBuffer_.data(),
-                      GL_DYNAMIC_DRAW);
-
-      // Buffer threshold data
-      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[2]);
-      gl.glBufferData(GL_ARRAY_BUFFER,
-                      sizeof(GLint) * currentIntegerBuffer_.size(),
-                      currentIntegerBuffer_.data(),
-                      GL_DYNAMIC_DRAW);
-
-      numVertices_ =
-         static_cast<GLsizei>(currentIconBuffer_.size() / kPointsPerVertex);
+      iconDynamicBuffer_.Invalidate();
+      integerDynamicBuffer_.Invalidate();
+
+      numInstances_ =
+         static_cast<GLsizei>(currentIconBuffer_.size() / kIconBufferLength);
    }
 
+   // Otherwise, only modified icons are buffered
+   iconDynamicBuffer_.Upload(gl, vbo_[1], currentIconBuffer_);
+   textureDynamicBuffer_.Upload(gl, vbo_[2], textureBuffer_);
+   integerDynamicBuffer_.Upload(gl, vbo_[3], currentIntegerBuffer_);
+
    dirty_ = false;
 }
 
@@ -931,13 +943,23 @@ bool GeoIcons::RunMousePicking(
          std::chrono::system_clock::now() :
          p->selectedTime_;
 
-   // For each pickable icon
+   if (p->hoverIndexDirty_)
+   {
+      p->UpdateHoverIndex();
+   }
+
+   // For each pickable icon near the mouse cursor
+   const auto candidates =
+      p->hoverIndex_.Query(mouseCoords, std::max(scale.x, scale.y));
+
    auto it = std::find_if(
-      std::execution::par_unseq,
-      p->currentHoverIcons_.crbegin(),
-      p->currentHoverIcons_.crend(),
-      [&mapDistance, &selectedTime, &mapMatrix, &mouseCoords](const auto& icon)
+      candidates.cbegin(),
+      candidates.cend(),
+      [this, &mapDistance, &selectedTime, &mapMatrix, &mouseCoords](
+         std::size_t index)
       {
+         const auto& icon = p->currentHoverIcons_[index];
+
          if ((
                 // Geo icon is thresholded
                 mapDistance > units::length::meters<double> {0.0} &&
@@ -989,15 +1011,38 @@ bool GeoIcons::RunMousePicking(
          return util::maplibre::IsPointInPolygon({tl, bl, br, tr}, mouseCoords);
       });
 
-   if (it != p->currentHoverIcons_.crend())
+   if (it != candidates.cend())
    {
       itemPicked = true;
-      util::tooltip::Show(it->di_->hoverText_, mouseGlobalPos);
+      util::tooltip::Show(p->currentHoverIcons_[*it].di_->hoverText_,
+                          mouseGlobalPos);
    }
 
    return itemPicked;
 }
 
+void GeoIcons::Impl::UpdateHoverIndex()
+{
+   std::vector<glm::vec4> bounds {};
+   bounds.reserve(currentHoverIcons_.size());
+
+   float maxPixelOffset = 0.0f;
+
+   for (auto& icon : currentHoverIcons_)
+   {
+      bounds.emplace_back(icon.p_, icon.p_);
+
+      maxPixelOffset = std::max({maxPixelOffset,
+                                 glm::length(icon.otl_),
+                                 glm::length(icon.otr_),
+                                 glm::length(icon.obl_),
+                                 glm::length(icon.obr_)});
+   }
+
+   hoverIndex_.Build(bounds, maxPixelOffset);
+   hoverIndexDirty_ = false;
+}
+
 } // namespace draw
 } // namespace gl
 } // namespace qt
@@ -94,6 +94,15 @@ public:
     */
    std::shared_ptr<GeoIconDrawItem> AddIcon();
 
+   /**
+    * Removes a geo icon from the internal draw list. Icons may be added and
+    * removed after FinishIcons() without starting a new set of icons, and are
+    * applied by calling FinishIcons() again.
+    *
+    * @param [in] di Geo icon draw item
+    */
+   void RemoveIcon(const std::shared_ptr<GeoIconDrawItem>& di);
+
    /**
     * @param [in] di Geo icon draw item
     * @param [in] visible Visibility of the icon
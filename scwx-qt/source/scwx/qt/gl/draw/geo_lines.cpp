@@ -1,10 +1,13 @@
 #include <scwx/qt/gl/draw/geo_lines.hpp>
+#include <scwx/qt/gl/dynamic_buffer.hpp>
+#include <scwx/qt/gl/viewport_culler.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
 
-#include <execution>
+#include <algorithm>
 
 #include <boost/unordered/unordered_flat_set.hpp>
 #include <units/angle.h>
@@ -50,6 +53,9 @@ struct GeoLineDrawItem : types::EventHandler
    units::angle::degrees<float> angle_ {};
    std::string                  hoverText_ {};
    GeoLines::HoverCallback      hoverCallback_ {nullptr};
+
+   // Index of the line in the line list
+   std::size_t lineIndex_ {};
 };
 
 class GeoLines::Impl
@@ -84,13 +90,15 @@ public:
 
    void BufferLine(const std::shared_ptr<const GeoLineDrawItem>& di);
    void Update();
+   void UpdateHoverIndex();
    void UpdateBuffers();
-   void UpdateModifiedLineBuffers();
+   bool UpdateModifiedLineBuffers();
    void UpdateSingleBuffer(const std::shared_ptr<GeoLineDrawItem>& di,
                            std::size_t                             lineIndex,
                            std::vector<float>&                     linesBuffer,
                            std::vector<GLint>&          integerBuffer,
-                           std::vector<LineHoverEntry>& hoverLines);
+                           std::vector<LineHoverEntry>& hoverLines,
+                           bool                         rebuild);
 
    std::shared_ptr<GlContext> context_;
 
@@ -98,8 +106,15 @@ public:
    bool dirty_ {false};
    bool thresholded_ {false};
 
+   DynamicBuffer linesDynamicBuffer_ {kLineBufferLength_ * sizeof(float)};
+   DynamicBuffer integerDynamicBuffer_ {kIntegerBufferLength_ * sizeof(GLint)};
+
    boost::unordered_flat_set<std::shared_ptr<GeoLineDrawItem>> dirtyLines_ {};
 
+   // Whether a modified line moved, or changed its size or hover state. Lines
+   // with only a changed color or time range keep their spatial indices.
+   bool geometryModified_ {false};
+
    std::chrono::system_clock::time_point selectedTime_ {};
 
    std::mutex lineMutex_ {};
@@ -115,6 +130,9 @@ public:
    std::vector<LineHoverEntry> currentHoverLines_ {};
    std::vector<LineHoverEntry> newHoverLines_ {};
 
+   util::SpatialIndex hoverIndex_ {};
+   bool               hoverIndexDirty_ {false};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
    GLint                          uMapMatrixLocation_;
@@ -124,6 +142,10 @@ public:
 
    GLuint                vao_;
    std::array<GLuint, 2> vbo_;
+
+   ViewportCuller viewportCuller_ {kPointsPerVertex,
+                                  kVerticesPerRectangle,
+                                  ViewportCuller::Coordinates::LatLong};
 };
 
 GeoLines::GeoLines(std::shared_ptr<GlContext> context) :
@@ -152,7 +174,6 @@ void GeoLines::Initialize()
 
    p->shaderProgram_ = p->context_->GetShaderProgram(
       {{GL_VERTEX_SHADER, ":/gl/geo_texture2d.vert"},
-       {GL_GEOMETRY_SHADER, ":/gl/threshold.geom"},
        {GL_FRAGMENT_SHADER, ":/gl/color.frag"}});
 
    p->uMVPMatrixLocation_ = p->shaderProgram_->GetUniformLocation("uMVPMatrix");
@@ -254,7 +275,7 @@ void GeoLines::Render(const QMapLibre::CustomLayerRenderParameters& params)
    {
       gl::OpenGLFunctions& gl = p->context_->gl();
 
-      gl.glBindVertexArray(p->vao_);
+      p->context_->state_cache().BindVertexArray(p->vao_);
 
       p->Update();
       p->shaderProgram_->Use();
@@ -286,11 +307,12 @@ void GeoLines::Render(const QMapLibre::CustomLayerRenderParameters& params)
                                selectedTime.time_since_epoch())
                                .count()));
 
-      // Draw icons
-      gl.glDrawArrays(GL_TRIANGLES,
-                      0,
-                      static_cast<GLsizei>(p->currentLineList_.size() *
-                                           kVerticesPerRectangle));
+      // Draw lines within the viewport
+      p->viewportCuller_.Draw(
+         gl,
+         params,
+         static_cast<GLsizei>(p->currentLineList_.size() *
+                              kVerticesPerRectangle));
    }
 }
 
@@ -306,6 +328,8 @@ void GeoLines::Deinitialize()
    p->currentLinesBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->currentHoverLines_.clear();
+   p->hoverIndex_.Clear();
+   p->hoverIndexDirty_ = false;
 }
 
 void GeoLines::SetVisible(bool visible)
@@ -324,7 +348,10 @@ void GeoLines::StartLines()
 
 std::shared_ptr<GeoLineDrawItem> GeoLines::AddLine()
 {
-   return p->newLineList_.emplace_back(std::make_shared<GeoLineDrawItem>());
+   auto di        = std::make_shared<GeoLineDrawItem>();
+   di->lineIndex_ = p->newLineList_.size();
+
+   return p->newLineList_.emplace_back(std::move(di));
 }
 
 void GeoLines::SetLineLocation(const std::shared_ptr<GeoLineDrawItem>& di,
@@ -334,13 +361,14 @@ void GeoLines::SetLineLocation(const std::shared_ptr<GeoLineDrawItem>& di,
                                float longitude2)
 {
    if (di->latitude1_ != latitude1 || di->longitude1_ != longitude1 ||
-       di->latitude2_ != latitude1 || di->longitude2_ != longitude1)
+       di->latitude2_ != latitude2 || di->longitude2_ != longitude2)
    {
       di->latitude1_  = latitude1;
       di->longitude1_ = longitude1;
       di->latitude2_  = latitude2;
       di->longitude2_ = longitude2;
       p->dirtyLines_.insert(di);
+      p->geometryModified_ = true;
    }
 }
 
@@ -376,6 +404,7 @@ void GeoLines::SetLineWidth(const std::shared_ptr<GeoLineDrawItem>& di,
    {
       di->width_ = width;
       p->dirtyLines_.insert(di);
+      p->geometryModified_ = true;
    }
 }
 
@@ -386,6 +415,7 @@ void GeoLines::SetLineVisible(const std::shared_ptr<GeoLineDrawItem>& di,
    {
       di->visible_ = visible;
       p->dirtyLines_.insert(di);
+      p->geometryModified_ = true;
    }
 }
 
@@ -396,6 +426,7 @@ void GeoLines::SetLineHoverCallback(const std::shared_ptr<GeoLineDrawItem>& di,
    {
       di->hoverCallback_ = callback;
       p->dirtyLines_.insert(di);
+      p->geometryModified_ = true;
    }
 }
 
@@ -406,6 +437,7 @@ void GeoLines::SetLineHoverText(const std::shared_ptr<GeoLineDrawItem>& di,
    {
       di->hoverText_ = text;
       p->dirtyLines_.insert(di);
+      p->geometryModified_ = true;
    }
 }
 
@@ -453,7 +485,8 @@ void GeoLines::FinishLines()
    p->newHoverLines_.clear();
 
    // Mark the draw item dirty
-   p->dirty_ = true;
+   p->dirty_           = true;
+   p->hoverIndexDirty_ = true;
 }
 
 void GeoLines::Impl::UpdateBuffers()
@@ -471,49 +504,64 @@ void GeoLines::Impl::UpdateBuffers()
 
       // Update line buffer
       UpdateSingleBuffer(
-         di, i, newLinesBuffer_, newIntegerBuffer_, newHoverLines_);
+         di, i, newLinesBuffer_, newIntegerBuffer_, newHoverLines_, true);
    }
 
    // All lines have been updated
    dirtyLines_.clear();
+   geometryModified_ = false;
 }
 
-void GeoLines::Impl::UpdateModifiedLineBuffers()
+bool GeoLines::Impl::UpdateModifiedLineBuffers()
 {
-   // Synchronize line list
-   currentLineList_ = newLineList_;
-   currentLinesBuffer_.resize(currentLineList_.size() * kLineBufferLength_);
-   currentIntegerBuffer_.resize(currentLineList_.size() *
-                                kVerticesPerRectangle * kIntegersPerVertex_);
+   // Synchronize line list, appending lines added since the last update
+   const bool linesAdded = currentLineList_.size() != newLineList_.size();
+
+   if (currentLineList_.size() < newLineList_.size())
+   {
+      currentLineList_.insert(currentLineList_.end(),
+                              newLineList_.cbegin() + currentLineList_.size(),
+                              newLineList_.cend());
+   }
+   else if (linesAdded)
+   {
+      currentLineList_ = newLineList_;
+   }
+
+   if (linesAdded)
+   {
+      currentLinesBuffer_.resize(currentLineList_.size() * kLineBufferLength_);
+      currentIntegerBuffer_.resize(currentLineList_.size() *
+                                   kVerticesPerRectangle * kIntegersPerVertex_);
+   }
 
    // Update buffers for modified lines
    for (auto& di : dirtyLines_)
    {
-      // Find modified line in the current list
-      auto it =
-         std::find(currentLineList_.cbegin(), currentLineList_.cend(), di);
+      const std::size_t lineIndex = di->lineIndex_;
 
-      // Ignore invalid lines
-      if (it == currentLineList_.cend())
+      // Ignore lines not in the current list
+      if (lineIndex >= currentLineList_.size() ||
+          currentLineList_[lineIndex] != di)
       {
          continue;
       }
 
-      auto lineIndex = std::distance(currentLineList_.cbegin(), it);
-
       UpdateSingleBuffer(di,
                          lineIndex,
                          currentLinesBuffer_,
                          currentIntegerBuffer_,
-                         currentHoverLines_);
+                         currentHoverLines_,
+                         false);
+
+      linesDynamicBuffer_.Modify(lineIndex);
+      integerDynamicBuffer_.Modify(lineIndex);
    }
 
    // Clear list of modified lines
-   if (!dirtyLines_.empty())
-   {
-      dirtyLines_.clear();
-      dirty_ = true;
-   }
+   dirtyLines_.clear();
+
+   return linesAdded;
 }
 
 void GeoLines::Impl::UpdateSingleBuffer(
@@ -521,7 +569,8 @@ void GeoLines::Impl::UpdateSingleBuffer(
    std::size_t                             lineIndex,
    std::vector<float>&                     lineBuffer,
    std::vector<GLint>&                     integerBuffer,
-   std::vector<LineHoverEntry>&            hoverLines)
+   std::vector<LineHoverEntry>&            hoverLines,
+   bool                                    rebuild)
 {
    // Threshold value
    units::length::nautical_miles<double> threshold = di->threshold_;
@@ -621,9 +670,12 @@ void GeoLines::Impl::UpdateSingleBuffer(
       std::copy(integerData.begin(), integerData.end(), integerBufferPosition);
    }
 
-   auto hoverIt = std::find_if(hoverLines.begin(),
-                               hoverLines.end(),
-                               [&di](auto& entry) { return entry.di_ == di; });
+   // When rebuilding every line, the line has no existing hover entry
+   auto hoverIt =
+      rebuild ? hoverLines.end() :
+                std::find_if(hoverLines.begin(),
+                             hoverLines.end(),
+                             [&di](auto& entry) { return entry.di_ == di; });
 
    if (di->visible_ && (!di->hoverText_.empty() ||
                         di->hoverCallback_ != nullptr || di->event_ != nullptr))
@@ -666,29 +718,31 @@ void GeoLines::Impl::UpdateSingleBuffer(
 
 void GeoLines::Impl::Update()
 {
-   UpdateModifiedLineBuffers();
+   const bool linesAdded       = UpdateModifiedLineBuffers();
+   const bool geometryModified = dirty_ || linesAdded || geometryModified_;
+
+   gl::OpenGLFunctions& gl = context_->gl();
 
-   // If the lines have been updated
+   // If the lines have been updated, the entire buffer is reallocated
    if (dirty_)
    {
-      gl::OpenGLFunctions& gl = context_->gl();
-
-      // Buffer lines data
-      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
-      gl.glBufferData(GL_ARRAY_BUFFER,
-                      sizeof(float) * currentLinesBuffer_.size(),
-                      currentLinesBuffer_.data(),
-                      GL_DYNAMIC_DRAW);
-
-      // Buffer threshold data
-      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[1]);
-      gl.glBufferData(GL_ARRAY_BUFFER,
-                      sizeof(GLint) * currentIntegerBuffer_.size(),
-                      currentIntegerBuffer_.data(),
-                      GL_DYNAMIC_DRAW);
+      linesDynamicBuffer_.Invalidate();
+      integerDynamicBuffer_.Invalidate();
+   }
+
+   // Otherwise, only modified lines are buffered
+   linesDynamicBuffer_.Upload(gl, vbo_[0], currentLinesBuffer_);
+   integerDynamicBuffer_.Upload(gl, vbo_[1], currentIntegerBuffer_);
+
+   // Lines modified only in color or time range keep their spatial indices
+   if (geometryModified)
+   {
+      viewportCuller_.Build(currentLinesBuffer_);
+      hoverIndexDirty_ = true;
    }
 
-   dirty_ = false;
+   dirty_            = false;
+   geometryModified_ = false;
 }
 
 bool GeoLines::RunMousePicking(
@@ -724,13 +778,23 @@ bool GeoLines::RunMousePicking(
          std::chrono::system_clock::now() :
          p->selectedTime_;
 
-   // For each pickable line
+   if (p->hoverIndexDirty_)
+   {
+      p->UpdateHoverIndex();
+   }
+
+   // For each pickable line near the mouse cursor
+   const auto candidates =
+      p->hoverIndex_.Query(mouseCoords, std::max(scale.x, scale.y));
+
    auto it = std::find_if(
-      std::execution::par_unseq,
-      p->currentHoverLines_.rbegin(),
-      p->currentHoverLines_.rend(),
-      [&mapDistance, &selectedTime, &mapMatrix, &mouseCoords](const auto& line)
+      candidates.cbegin(),
+      candidates.cend(),
+      [this, &mapDistance, &selectedTime, &mapMatrix, &mouseCoords](
+         std::size_t index)
       {
+         const auto& line = p->currentHoverLines_[index];
+
          if ((
                 // Placefile is thresholded
                 mapDistance > units::length::meters<double> {0.0} &&
@@ -784,30 +848,55 @@ bool GeoLines::RunMousePicking(
          return util::maplibre::IsPointInPolygon({tl, bl, br, tr}, mouseCoords);
       });
 
-   if (it != p->currentHoverLines_.crend())
+   if (it != candidates.cend())
    {
+      const auto& line = p->currentHoverLines_[*it];
+
       itemPicked = true;
 
-      if (!it->di_->hoverText_.empty())
+      if (!line.di_->hoverText_.empty())
       {
          // Show tooltip
-         util::tooltip::Show(it->di_->hoverText_, mouseGlobalPos);
+         util::tooltip::Show(line.di_->hoverText_, mouseGlobalPos);
       }
-      else if (it->di_->hoverCallback_ != nullptr)
+      else if (line.di_->hoverCallback_ != nullptr)
       {
-         it->di_->hoverCallback_(it->di_, mouseGlobalPos);
+         line.di_->hoverCallback_(line.di_, mouseGlobalPos);
       }
 
-      if (it->di_->event_ != nullptr)
+      if (line.di_->event_ != nullptr)
       {
          // Register event handler
-         eventHandler = it->di_;
+         eventHandler = line.di_;
       }
    }
 
    return itemPicked;
 }
 
+void GeoLines::Impl::UpdateHoverIndex()
+{
+   std::vector<glm::vec4> bounds {};
+   bounds.reserve(currentHoverLines_.size());
+
+   float maxPixelOffset = 0.0f;
+
+   for (auto& line : currentHoverLines_)
+   {
+      bounds.emplace_back(glm::min(line.p1_, line.p2_),
+                          glm::max(line.p1_, line.p2_));
+
+      maxPixelOffset = std::max({maxPixelOffset,
+                                 glm::length(line.otl_),
+                                 glm::length(line.otr_),
+                                 glm::length(line.obl_),
+                                 glm::length(line.obr_)});
+   }
+
+   hoverIndex_.Build(bounds, maxPixelOffset);
+   hoverIndexDirty_ = false;
+}
+
 void GeoLines::RegisterEventHandler(
    const std::shared_ptr<GeoLineDrawItem>& di,
    const std::function<void(QEvent*)>&     eventHandler)
@@ -1,4 +1,5 @@
 #include <scwx/qt/gl/draw/icons.hpp>
+#include <scwx/qt/gl/dynamic_buffer.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/qt/util/tooltip.hpp>
@@ -76,6 +77,9 @@ public:
                                   std::vector<float>&          iconBuffer,
                                   std::vector<IconHoverEntry>& hoverIcons);
    void        UpdateTextureBuffer();
+   void
+   UpdateSingleTextureBuffer(const std::shared_ptr<IconDrawItem>& di,
+                             std::size_t                          iconIndex);
    void        UpdateModifiedIconBuffers();
    void        Update(bool textureAtlasChanged);
 
@@ -103,6 +107,9 @@ public:
 
    std::vector<float> textureBuffer_ {};
 
+   DynamicBuffer iconDynamicBuffer_ {kIconBufferLength * sizeof(float)};
+   DynamicBuffer textureDynamicBuffer_ {kTextureBufferLength * sizeof(float)};
+
    std::vector<IconHoverEntry> currentHoverIcons_ {};
    std::vector<IconHoverEntry> newHoverIcons_ {};
 
@@ -130,7 +137,6 @@ void Icons::Initialize()
 
    p->shaderProgram_ = p->context_->GetShaderProgram(
       {{GL_VERTEX_SHADER, ":/gl/texture2d_array.vert"},
-       {GL_GEOMETRY_SHADER, ":/gl/threshold.geom"},
        {GL_FRAGMENT_SHADER, ":/gl/texture2d_array.frag"}});
 
    p->uMVPMatrixLocation_ = p->shaderProgram_->GetUniformLocation("uMVPMatrix");
@@ -221,7 +227,7 @@ void Icons::Render(const QMapLibre::CustomLayerRenderParameters& params,
    {
       gl::OpenGLFunctions& gl = p->context_->gl();
 
-      gl.glBindVertexArray(p->vao_);
+      p->context_->state_cache().BindVertexArray(p->vao_);
 
       p->Update(textureAtlasChanged);
       p->shaderProgram_->Use();
@@ -563,90 +569,71 @@ void Icons::Impl::UpdateSingleBuffer(const std::shared_ptr<IconDrawItem>& di,
 
 void Icons::Impl::UpdateTextureBuffer()
 {
-   textureBuffer_.clear();
-   textureBuffer_.reserve(currentIconList_.size() * kTextureBufferLength);
+   textureBuffer_.resize(currentIconList_.size() * kTextureBufferLength);
 
-   for (auto& di : currentIconList_)
+   for (std::size_t i = 0; i < currentIconList_.size(); ++i)
    {
-      auto it = currentIconSheets_.find(di->iconSheet_);
-      if (it == currentIconSheets_.cend())
-      {
-         // No file found. Should not get here, but insert empty data to match
-         // up with data already buffered
-         logger_->error("Could not find icon sheet: {}", di->iconSheet_);
-
-         // clang-format off
-         textureBuffer_.insert(
-            textureBuffer_.end(),
-            {
-               // Icon
-               0.0f, 0.0f, 0.0f, // BL
-               0.0f, 0.0f, 0.0f, // TL
-               0.0f, 0.0f, 0.0f, // BR
-               0.0f, 0.0f, 0.0f, // BR
-               0.0f, 0.0f, 0.0f, // TR
-               0.0f, 0.0f, 0.0f  // TL
-            });
-         // clang-format on
+      UpdateSingleTextureBuffer(currentIconList_[i], i);
+   }
+}
 
-         continue;
-      }
+void Icons::Impl::UpdateSingleTextureBuffer(
+   const std::shared_ptr<IconDrawItem>& di, std::size_t iconIndex)
+{
+   auto textureBufferPosition =
+      textureBuffer_.begin() + iconIndex * kTextureBufferLength;
 
-      auto& icon = it->second;
+   auto it = currentIconSheets_.find(di->iconSheet_);
+   if (it == currentIconSheets_.cend())
+   {
+      // No file found. Should not get here, but buffer empty data to match up
+      // with data already buffered
+      logger_->error("Could not find icon sheet: {}", di->iconSheet_);
 
-      // Validate icon
-      if (di->iconIndex_ >= icon->numIcons_)
-      {
-         // No icon found
-         logger_->error("Invalid icon index: {}", di->iconIndex_);
-
-         // Will get here if a texture changes, and the texture shrunk such that
-         // the icon is no longer found
-
-         // clang-format off
-         textureBuffer_.insert(
-            textureBuffer_.end(),
-            {
-               // Icon
-               0.0f, 0.0f, 0.0f, // BL
-               0.0f, 0.0f, 0.0f, // TL
-               0.0f, 0.0f, 0.0f, // BR
-               0.0f, 0.0f, 0.0f, // BR
-               0.0f, 0.0f, 0.0f, // TR
-               0.0f, 0.0f, 0.0f  // TL
-            });
-         // clang-format on
+      std::fill_n(textureBufferPosition, kTextureBufferLength, 0.0f);
+      return;
+   }
 
-         continue;
-      }
+   auto& icon = it->second;
 
-      // Texture coordinates
-      const std::size_t iconRow    = (di->iconIndex_) / icon->columns_;
-      const std::size_t iconColumn = (di->iconIndex_) % icon->columns_;
-
-      const float iconX = iconColumn * icon->scaledWidth_;
-      const float iconY = iconRow * icon->scaledHeight_;
-
-      const float ls = icon->texture_.sLeft_ + iconX;
-      const float rs = ls + icon->scaledWidth_;
-      const float tt = icon->texture_.tTop_ + iconY;
-      const float bt = tt + icon->scaledHeight_;
-      const float r  = static_cast<float>(icon->texture_.layerId_);
-
-      // clang-format off
-      textureBuffer_.insert(
-         textureBuffer_.end(),
-         {
-            // Icon
-            ls, bt, r, // BL
-            ls, tt, r, // TL
-            rs, bt, r, // BR
-            rs, bt, r, // BR
-            rs, tt, r, // TR
-            ls, tt, r  // TL
-         });
-      // clang-format on
+   // Validate icon
+   if (di->iconIndex_ >= icon->numIcons_)
+   {
+      // No icon found
+      logger_->error("Invalid icon index: {}", di->iconIndex_);
+
+      // Will get here if a texture changes, and the texture shrunk such that
+      // the icon is no longer found
+      std::fill_n(textureBufferPosition, kTextureBufferLength, 0.0f);
+      return;
    }
+
+   // Texture coordinates
+   const std::size_t iconRow    = (di->iconIndex_) / icon->columns_;
+   const std::size_t iconColumn = (di->iconIndex_) % icon->columns_;
+
+   const float iconX = iconColumn * icon->scaledWidth_;
+   const float iconY = iconRow * icon->scaledHeight_;
+
+   const float ls = icon->texture_.sLeft_ + iconX;
+   const float rs = ls + icon->scaledWidth_;
+   const float tt = icon->texture_.tTop_ + iconY;
+   const float bt = tt + icon->scaledHeight_;
+   const float r  = static_cast<float>(icon->texture_.layerId_);
+
+   // clang-format off
+   const auto textureData = {
+      // Icon
+      ls, bt, r, // BL
+      ls, tt, r, // TL
+      rs, bt, r, // BR
+      rs, bt, r, // BR
+      rs, tt, r, // TR
+      ls, tt, r  // TL
+   };
+   // clang-format on
+
+   std::copy(textureData.begin(), textureData.end(), textureBufferPosition);
 }
 
 void Icons::Impl::UpdateModifiedIconBuffers()
@@ -664,17 +651,23 @@ void Icons::Impl::UpdateModifiedIconBuffers()
          continue;
       }
 
-      auto iconIndex = std::distance(currentIconList_.cbegin(), it);
+      auto iconIndex = static_cast<std::size_t>(
+         std::distance(currentIconList_.cbegin(), it));
 
       UpdateSingleBuffer(di, iconIndex, currentIconBuffer_, currentHoverIcons_);
+
+      // The texture buffer is rebuilt when all icons are updated
+      if (!dirty_)
+      {
+         UpdateSingleTextureBuffer(di, iconIndex);
+      }
+
+      iconDynamicBuffer_.Modify(iconIndex);
+      textureDynamicBuffer_.Modify(iconIndex);
    }
 
    // Clear list of modified icons
-   if (!dirtyIcons_.empty())
-   {
-      dirtyIcons_.clear();
-      dirty_ = true;
-   }
+   dirtyIcons_.clear();
 }
 
 void Icons::Impl::Update(bool textureAtlasChanged)
@@ -695,30 +688,24 @@ void Icons::Impl::Update(bool textureAtlasChanged)
       // Update OpenGL texture buffer data
       UpdateTextureBuffer();
 
-      // Buffer texture data
-      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[1]);
-      gl.glBufferData(GL_ARRAY_BUFFER,
-                      sizeof(float) * textureBuffer_.size(),
-                      textureBuffer_.data(),
-                      GL_DYNAMIC_DRAW);
+      textureDynamicBuffer_.Invalidate();
 
       lastTextureAtlasChanged_ = false;
    }
 
-   // If buffers need updating
+   // If the icons have been updated, the entire buffer is reallocated
    if (dirty_)
    {
-      // Buffer vertex data
-      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
-      gl.glBufferData(GL_ARRAY_BUFFER,
-                      sizeof(float) * currentIconBuffer_.size(),
-                      currentIconBuffer_.data(),
-                      GL_DYNAMIC_DRAW);
+      iconDynamicBuffer_.Invalidate();
 
       numVertices_ =
          static_cast<GLsizei>(currentIconBuffer_.size() / kPointsPerVertex);
    }
 
+   // Otherwise, only modified icons are buffered
+   iconDynamicBuffer_.Upload(gl, vbo_[0], currentIconBuffer_);
+   textureDynamicBuffer_.Upload(gl, vbo_[1], textureBuffer_);
+
    dirty_ = false;
 }
 
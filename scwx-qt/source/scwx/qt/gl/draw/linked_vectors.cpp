@@ -21,11 +21,21 @@ static const boost::gil::rgba32f_pixel_t kBlack {0.0f, 0.0f, 0.0f, 1.0f};
 struct LinkedVectorDrawItem
 {
    LinkedVectorDrawItem(
+      const common::Coordinate& center,
+      const std::shared_ptr<const wsr88d::rpg::LinkedVectorPacket>&
+         vectorPacket) :
+       coordinates_ {GetCoordinates(center, vectorPacket)}
+   {
+   }
+
+   static std::vector<common::Coordinate> GetCoordinates(
       const common::Coordinate& center,
       const std::shared_ptr<const wsr88d::rpg::LinkedVectorPacket>&
          vectorPacket)
    {
-      coordinates_.push_back(util::GeographicLib::GetCoordinate(
+      std::vector<common::Coordinate> coordinates {};
+
+      coordinates.push_back(util::GeographicLib::GetCoordinate(
          center, vectorPacket->start_i_km(), vectorPacket->start_j_km()));
 
       const auto endI = vectorPacket->end_i_km();
@@ -35,13 +45,22 @@ struct LinkedVectorDrawItem
          boost::make_zip_iterator(
             boost::make_tuple(endI.begin(), endJ.begin())),
          boost::make_zip_iterator(boost::make_tuple(endI.end(), endJ.end())),
-         [this,
+         [&coordinates,
           &center](const boost::tuple<units::length::kilometers<double>,
                                       units::length::kilometers<double>>& p)
          {
-            coordinates_.push_back(util::GeographicLib::GetCoordinate(
+            coordinates.push_back(util::GeographicLib::GetCoordinate(
                center, p.get<0>(), p.get<1>()));
          });
+
+      return coordinates;
+   }
+
+   std::size_t line_count() const
+   {
+      const std::size_t segmentCount =
+         (coordinates_.size() > 0) ? coordinates_.size() - 1 : 0;
+      return ticksEnabled_ ? segmentCount * 2 : segmentCount;
    }
 
    std::vector<std::shared_ptr<GeoLineDrawItem>> borderDrawItems_ {};
@@ -69,6 +88,9 @@ public:
 
    ~Impl() {}
 
+   void UpdateLines(const std::shared_ptr<LinkedVectorDrawItem>& di,
+                    bool                                         border);
+
    std::shared_ptr<GlContext> context_;
 
    bool borderEnabled_ {true};
@@ -198,141 +220,134 @@ void LinkedVectors::SetVectorTickRadiusIncrement(
    di->tickRadiusIncrement_ = radiusIncrement;
 }
 
-void LinkedVectors::FinishVectors()
+bool LinkedVectors::UpdateVector(
+   const std::shared_ptr<LinkedVectorDrawItem>&                  di,
+   const common::Coordinate&                                     center,
+   const std::shared_ptr<const wsr88d::rpg::LinkedVectorPacket>& vectorPacket)
 {
-   // Generate borders
-   if (p->borderEnabled_)
-   {
-      for (auto& di : p->vectorList_)
-      {
-         auto tickRadius = di->tickRadius_;
+   auto coordinates =
+      LinkedVectorDrawItem::GetCoordinates(center, vectorPacket);
 
-         for (std::size_t i = 0; i < di->coordinates_.size() - 1; ++i)
-         {
-            auto borderLine = p->geoLines_->AddLine();
+   const std::size_t borderCount = p->borderEnabled_ ? di->line_count() : 0;
 
-            const common::Coordinate& coordinate1 = di->coordinates_[i];
-            const common::Coordinate& coordinate2 = di->coordinates_[i + 1];
+   // The existing geo lines can only be reused if the line count is unchanged
+   if (coordinates.size() != di->coordinates_.size() ||
+       di->lineDrawItems_.size() != di->line_count() ||
+       di->borderDrawItems_.size() != borderCount)
+   {
+      return false;
+   }
 
-            const double& latitude1  = coordinate1.latitude_;
-            const double& longitude1 = coordinate1.longitude_;
-            const double& latitude2  = coordinate2.latitude_;
-            const double& longitude2 = coordinate2.longitude_;
+   di->coordinates_ = std::move(coordinates);
 
-            p->geoLines_->SetLineLocation(
-               borderLine, latitude1, longitude1, latitude2, longitude2);
+   // Modified lines are rebuffered on the next render
+   if (p->borderEnabled_)
+   {
+      p->UpdateLines(di, true);
+   }
+   p->UpdateLines(di, false);
 
-            p->geoLines_->SetLineModulate(borderLine, kBlack);
-            p->geoLines_->SetLineWidth(borderLine, di->width_ + 2.0f);
-            p->geoLines_->SetLineVisible(borderLine, di->visible_);
-            p->geoLines_->SetLineHoverText(borderLine, di->hoverText_);
+   return true;
+}
 
-            di->borderDrawItems_.emplace_back(std::move(borderLine));
+void LinkedVectors::FinishVectors()
+{
+   // Generate borders
+   if (p->borderEnabled_)
+   {
+      for (auto& di : p->vectorList_)
+      {
+         p->UpdateLines(di, true);
+      }
+   }
 
-            if (di->ticksEnabled_)
-            {
-               auto angle = util::GeographicLib::GetAngle(
-                  latitude1, longitude1, latitude2, longitude2);
-               auto angle1 = angle + units::angle::degrees<double>(90.0);
-               auto angle2 = angle - units::angle::degrees<double>(90.0);
+   // Generate geo lines
+   for (auto& di : p->vectorList_)
+   {
+      p->UpdateLines(di, false);
+   }
 
-               auto tickCoord1 = util::GeographicLib::GetCoordinate(
-                  coordinate2, angle1, tickRadius);
-               auto tickCoord2 = util::GeographicLib::GetCoordinate(
-                  coordinate2, angle2, tickRadius);
+   // Finish geo lines
+   p->geoLines_->FinishLines();
+}
 
-               const double& tickLat1 = tickCoord1.latitude_;
-               const double& tickLon1 = tickCoord1.longitude_;
-               const double& tickLat2 = tickCoord2.latitude_;
-               const double& tickLon2 = tickCoord2.longitude_;
+void LinkedVectors::Impl::UpdateLines(
+   const std::shared_ptr<LinkedVectorDrawItem>& di, bool border)
+{
+   auto& drawItems = border ? di->borderDrawItems_ : di->lineDrawItems_;
 
-               auto tickBorderLine = p->geoLines_->AddLine();
+   const boost::gil::rgba32f_pixel_t modulate =
+      border ? kBlack : di->modulate_;
+   const float width = border ? di->width_ + 2.0f : di->width_;
 
-               p->geoLines_->SetLineLocation(
-                  tickBorderLine, tickLat1, tickLon1, tickLat2, tickLon2);
+   // If the border is not enabled, the line must have hover text instead
+   const bool hoverEnabled = border || !borderEnabled_;
 
-               p->geoLines_->SetLineModulate(tickBorderLine, kBlack);
-               p->geoLines_->SetLineWidth(tickBorderLine, di->width_ + 2.0f);
-               p->geoLines_->SetLineVisible(tickBorderLine, di->visible_);
-               p->geoLines_->SetLineHoverText(tickBorderLine, di->hoverText_);
+   std::size_t lineIndex = 0;
 
-               tickRadius += di->tickRadiusIncrement_;
-            }
-         }
+   // Reuse existing geo lines, adding new lines as required
+   auto SetLine = [&](double latitude1,
+                      double longitude1,
+                      double latitude2,
+                      double longitude2)
+   {
+      if (lineIndex == drawItems.size())
+      {
+         drawItems.emplace_back(geoLines_->AddLine());
       }
-   }
 
-   // Generate geo lines
-   for (auto& di : p->vectorList_)
-   {
-      auto tickRadius = di->tickRadius_;
+      auto& geoLine = drawItems[lineIndex++];
 
-      for (std::size_t i = 0; i < di->coordinates_.size() - 1; ++i)
-      {
-         auto geoLine = p->geoLines_->AddLine();
+      geoLines_->SetLineLocation(geoLine,
+                                 static_cast<float>(latitude1),
+                                 static_cast<float>(longitude1),
+                                 static_cast<float>(latitude2),
+                                 static_cast<float>(longitude2));
 
-         const common::Coordinate& coordinate1 = di->coordinates_[i];
-         const common::Coordinate& coordinate2 = di->coordinates_[i + 1];
+      geoLines_->SetLineModulate(geoLine, modulate);
+      geoLines_->SetLineWidth(geoLine, width);
+      geoLines_->SetLineVisible(geoLine, di->visible_);
 
-         const double& latitude1  = coordinate1.latitude_;
-         const double& longitude1 = coordinate1.longitude_;
-         const double& latitude2  = coordinate2.latitude_;
-         const double& longitude2 = coordinate2.longitude_;
+      if (hoverEnabled)
+      {
+         geoLines_->SetLineHoverText(geoLine, di->hoverText_);
+      }
+   };
 
-         p->geoLines_->SetLineLocation(
-            geoLine, latitude1, longitude1, latitude2, longitude2);
+   auto tickRadius = di->tickRadius_;
 
-         p->geoLines_->SetLineModulate(geoLine, di->modulate_);
-         p->geoLines_->SetLineWidth(geoLine, di->width_);
-         p->geoLines_->SetLineVisible(geoLine, di->visible_);
+   for (std::size_t i = 0; i + 1 < di->coordinates_.size(); ++i)
+   {
+      const common::Coordinate& coordinate1 = di->coordinates_[i];
+      const common::Coordinate& coordinate2 = di->coordinates_[i + 1];
 
-         // If the border is not enabled, this line must have hover text instead
-         if (!p->borderEnabled_)
-         {
-            p->geoLines_->SetLineHoverText(geoLine, di->hoverText_);
-         }
+      const double& latitude1  = coordinate1.latitude_;
+      const double& longitude1 = coordinate1.longitude_;
+      const double& latitude2  = coordinate2.latitude_;
+      const double& longitude2 = coordinate2.longitude_;
 
-         di->lineDrawItems_.emplace_back(std::move(geoLine));
+      SetLine(latitude1, longitude1, latitude2, longitude2);
 
-         if (di->ticksEnabled_)
-         {
-            auto angle = util::GeographicLib::GetAngle(
-               latitude1, longitude1, latitude2, longitude2);
-            auto angle1 = angle + units::angle::degrees<double>(90.0);
-            auto angle2 = angle - units::angle::degrees<double>(90.0);
-
-            auto tickCoord1 = util::GeographicLib::GetCoordinate(
-               coordinate2, angle1, tickRadius);
-            auto tickCoord2 = util::GeographicLib::GetCoordinate(
-               coordinate2, angle2, tickRadius);
-
-            const double& tickLat1 = tickCoord1.latitude_;
-            const double& tickLon1 = tickCoord1.longitude_;
-            const double& tickLat2 = tickCoord2.latitude_;
-            const double& tickLon2 = tickCoord2.longitude_;
-
-            auto tickGeoLine = p->geoLines_->AddLine();
-
-            p->geoLines_->SetLineLocation(
-               tickGeoLine, tickLat1, tickLon1, tickLat2, tickLon2);
-
-            p->geoLines_->SetLineModulate(tickGeoLine, di->modulate_);
-            p->geoLines_->SetLineWidth(tickGeoLine, di->width_);
-            p->geoLines_->SetLineVisible(tickGeoLine, di->visible_);
-
-            // If the border is not enabled, this line must have hover text
-            if (!p->borderEnabled_)
-            {
-               p->geoLines_->SetLineHoverText(tickGeoLine, di->hoverText_);
-            }
-
-            tickRadius += di->tickRadiusIncrement_;
-         }
+      if (di->ticksEnabled_)
+      {
+         auto angle = util::GeographicLib::GetAngle(
+            latitude1, longitude1, latitude2, longitude2);
+         auto angle1 = angle + units::angle::degrees<double>(90.0);
+         auto angle2 = angle - units::angle::degrees<double>(90.0);
+
+         auto tickCoord1 =
+            util::GeographicLib::GetCoordinate(coordinate2, angle1, tickRadius);
+         auto tickCoord2 =
+            util::GeographicLib::GetCoordinate(coordinate2, angle2, tickRadius);
+
+         SetLine(tickCoord1.latitude_,
+                 tickCoord1.longitude_,
+                 tickCoord2.latitude_,
+                 tickCoord2.longitude_);
+
+         tickRadius += di->tickRadiusIncrement_;
       }
    }
-
-   // Finish geo lines
-   p->geoLines_->FinishLines();
 }
 
 bool LinkedVectors::RunMousePicking(
@@ -163,6 +163,25 @@ public:
    SetVectorTickRadiusIncrement(const std::shared_ptr<LinkedVectorDrawItem>& di,
                                 units::length::meters<double> radiusIncrement);
 
+   /**
+    * Updates an existing linked vector in place, after its properties have
+    * been modified. Only modified lines are rebuffered. If the number of lines
+    * in the linked vector would change, the linked vector is not updated, and
+    * a new set of linked vectors must be started.
+    *
+    * @param [in] di Linked vector draw item
+    * @param [in] center Center coordinate on which the linked vectors are based
+    * @param [in] vectorPacket Linked vector packet containing start and end
+    * points
+    *
+    * @return true if the linked vector was updated
+    */
+   bool
+   UpdateVector(const std::shared_ptr<LinkedVectorDrawItem>& di,
+                const common::Coordinate&                    center,
+                const std::shared_ptr<const wsr88d::rpg::LinkedVectorPacket>&
+                   vectorPacket);
+
    /**
     * Finalizes the draw item after adding new linked vectors.
     */
@@ -1,14 +1,20 @@
 #include <scwx/qt/gl/draw/placefile_icons.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/qt/util/cluster_index.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/memory.hpp>
 
-#include <execution>
+#include <algorithm>
+#include <limits>
 
 #include <QDir>
 #include <QUrl>
 #include <boost/unordered/unordered_flat_map.hpp>
+#include <fmt/format.h>
 
 namespace scwx
 {
@@ -22,19 +28,25 @@ namespace draw
 static const std::string logPrefix_ = "scwx::qt::gl::draw::placefile_icons";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
-static constexpr std::size_t kNumRectangles        = 1;
-static constexpr std::size_t kNumTriangles         = kNumRectangles * 2;
-static constexpr std::size_t kVerticesPerTriangle  = 3;
-static constexpr std::size_t kVerticesPerRectangle = kVerticesPerTriangle * 2;
-static constexpr std::size_t kPointsPerVertex      = 9;
-static constexpr std::size_t kPointsPerTexCoord    = 3;
-static constexpr std::size_t kIconBufferLength =
-   kNumTriangles * kVerticesPerTriangle * kPointsPerVertex;
-static constexpr std::size_t kTextureBufferLength =
-   kNumTriangles * kVerticesPerTriangle * kPointsPerTexCoord;
+// Each icon is an instance of a single rectangle, drawn as a triangle strip
+static constexpr std::size_t kVerticesPerRectangle = 4;
+static constexpr std::size_t kPointsPerVertex      = 2;
+
+// Latitude, longitude, X/Y rectangle, modulate, angle
+static constexpr std::size_t kIconBufferLength = 11;
+
+// Texture rectangle, layer
+static constexpr std::size_t kTextureBufferLength = 5;
 
 // Threshold, start time, end time
-static constexpr std::size_t kIntegersPerVertex_ = 3;
+static constexpr std::size_t kIntegerBufferLength_ = 3;
+
+// Hover text of at most this many icons in a cluster is shown
+static constexpr std::size_t kMaxClusterHoverItems_ = 10;
+
+// BL, TL, BR, TR
+static constexpr std::array<float, kVerticesPerRectangle * kPointsPerVertex>
+   kRectangleVertices_ {0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.0f};
 
 struct PlacefileIconInfo
 {
@@ -85,16 +97,22 @@ public:
        uMapDistanceLocation_(GL_INVALID_INDEX),
        uSelectedTimeLocation_(GL_INVALID_INDEX),
        vao_ {GL_INVALID_INDEX},
-       vbo_ {GL_INVALID_INDEX},
-       numVertices_ {0}
+       vbo_ {GL_INVALID_INDEX}
    {
    }
 
    ~Impl() {}
 
    void UpdateBuffers();
+   void UpdateClusterIndex();
    void UpdateTextureBuffer();
    void Update(bool textureAtlasChanged);
+   void UpdateHoverIndex();
+
+   static bool
+   IsDisplayed(const gr::Placefile::IconDrawItem&    di,
+               units::length::meters<double>         mapDistance,
+               std::chrono::system_clock::time_point selectedTime);
 
    std::shared_ptr<GlContext> context_;
 
@@ -121,11 +139,27 @@ public:
    std::vector<float> newIconBuffer_ {};
    std::vector<GLint> newIntegerBuffer_ {};
 
+   // Current buffers, and their copies in GPU memory
+   scwx::util::MemoryCounter bufferMemory_ {"Placefile Draw Items"};
+
    std::vector<float> textureBuffer_ {};
 
+   // Hover entries of every icon, including those without hover text, which
+   // may represent a cluster of icons with hover text
    std::vector<IconHoverEntry> currentHoverIcons_ {};
    std::vector<IconHoverEntry> newHoverIcons_ {};
 
+   // Icons are ordered by cluster level, such that the icons drawn at each
+   // level are a prefix of the buffered icons
+   util::ClusterIndex currentClusterIndex_ {};
+   util::ClusterIndex newClusterIndex_ {};
+
+   // Number of buffered icons drawn at each cluster level
+   std::array<GLsizei, util::ClusterIndex::kLevelCount> clusterCounts_ {};
+
+   util::SpatialIndex hoverIndex_ {};
+   bool               hoverIndexDirty_ {false};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
    GLint                          uMapMatrixLocation_;
@@ -134,9 +168,7 @@ public:
    GLint                          uSelectedTimeLocation_;
 
    GLuint                vao_;
-   std::array<GLuint, 3> vbo_;
-
-   GLsizei numVertices_;
+   std::array<GLuint, 4> vbo_;
 };
 
 PlacefileIcons::PlacefileIcons(const std::shared_ptr<GlContext>& context) :
@@ -165,8 +197,7 @@ void PlacefileIcons::Initialize()
    auto&                gl30 = p->context_->gl30();
 
    p->shaderProgram_ = p->context_->GetShaderProgram(
-      {{GL_VERTEX_SHADER, ":/gl/geo_texture2d.vert"},
-       {GL_GEOMETRY_SHADER, ":/gl/threshold.geom"},
+      {{GL_VERTEX_SHADER, ":/gl/geo_texture2d_instanced.vert"},
        {GL_FRAGMENT_SHADER, ":/gl/texture2d_array.frag"}});
 
    p->uMVPMatrixLocation_ = p->shaderProgram_->GetUniformLocation("uMVPMatrix");
@@ -182,10 +213,15 @@ void PlacefileIcons::Initialize()
    gl.glGenBuffers(static_cast<GLsizei>(p->vbo_.size()), p->vbo_.data());
 
    gl.glBindVertexArray(p->vao_);
+
+   // Rectangle vertices, shared by each instance
    gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
-   gl.glBufferData(GL_ARRAY_BUFFER, 0u, nullptr, GL_DYNAMIC_DRAW);
+   gl.glBufferData(GL_ARRAY_BUFFER,
+                   sizeof(kRectangleVertices_),
+                   kRectangleVertices_.data(),
+                   GL_STATIC_DRAW);
 
-   // aLatLong
+   // aVertex
    gl.glVertexAttribPointer(0,
                             2,
                             GL_FLOAT,
@@ -194,66 +230,95 @@ void PlacefileIcons::Initialize()
                             static_cast<void*>(0));
    gl.glEnableVertexAttribArray(0);
 
-   // aXYOffset
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
+   gl.glBufferData(GL_ARRAY_BUFFER, 0u, nullptr, GL_DYNAMIC_DRAW);
+
+   // aLatLong
    gl.glVertexAttribPointer(1,
                             2,
                             GL_FLOAT,
                             GL_FALSE,
-                            kPointsPerVertex * sizeof(float),
-                            reinterpret_cast<void*>(2 * sizeof(float)));
+                            kIconBufferLength * sizeof(float),
+                            static_cast<void*>(0));
+   gl.glVertexAttribDivisor(1, 1);
    gl.glEnableVertexAttribArray(1);
 
+   // aXYRect
+   gl.glVertexAttribPointer(2,
+                            4,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kIconBufferLength * sizeof(float),
+                            reinterpret_cast<void*>(2 * sizeof(float)));
+   gl.glVertexAttribDivisor(2, 1);
+   gl.glEnableVertexAttribArray(2);
+
    // aModulate
-   gl.glVertexAttribPointer(3,
+   gl.glVertexAttribPointer(5,
                             4,
                             GL_FLOAT,
                             GL_FALSE,
-                            kPointsPerVertex * sizeof(float),
-                            reinterpret_cast<void*>(4 * sizeof(float)));
-   gl.glEnableVertexAttribArray(3);
+                            kIconBufferLength * sizeof(float),
+                            reinterpret_cast<void*>(6 * sizeof(float)));
+   gl.glVertexAttribDivisor(5, 1);
+   gl.glEnableVertexAttribArray(5);
 
    // aAngle
-   gl.glVertexAttribPointer(4,
+   gl.glVertexAttribPointer(6,
                             1,
                             GL_FLOAT,
                             GL_FALSE,
-                            kPointsPerVertex * sizeof(float),
-                            reinterpret_cast<void*>(8 * sizeof(float)));
-   gl.glEnableVertexAttribArray(4);
+                            kIconBufferLength * sizeof(float),
+                            reinterpret_cast<void*>(10 * sizeof(float)));
+   gl.glVertexAttribDivisor(6, 1);
+   gl.glEnableVertexAttribArray(6);
 
-   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[2]);
    gl.glBufferData(GL_ARRAY_BUFFER, 0u, nullptr, GL_DYNAMIC_DRAW);
 
-   // aTexCoord
-   gl.glVertexAttribPointer(2,
-                            3,
+   // aTexRect
+   gl.glVertexAttribPointer(3,
+                            4,
                             GL_FLOAT,
                             GL_FALSE,
-                            kPointsPerTexCoord * sizeof(float),
+                            kTextureBufferLength * sizeof(float),
                             static_cast<void*>(0));
-   gl.glEnableVertexAttribArray(2);
+   gl.glVertexAttribDivisor(3, 1);
+   gl.glEnableVertexAttribArray(3);
 
-   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[2]);
+   // aTexLayer
+   gl.glVertexAttribPointer(4,
+                            1,
+                            GL_FLOAT,
+                            GL_FALSE,
+                            kTextureBufferLength * sizeof(float),
+                            reinterpret_cast<void*>(4 * sizeof(float)));
+   gl.glVertexAttribDivisor(4, 1);
+   gl.glEnableVertexAttribArray(4);
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[3]);
    gl.glBufferData(GL_ARRAY_BUFFER, 0u, nullptr, GL_DYNAMIC_DRAW);
 
    // aThreshold
-   gl.glVertexAttribIPointer(5, //
+   gl.glVertexAttribIPointer(7,
                              1,
                              GL_INT,
-                             0,
+                             kIntegerBufferLength_ * sizeof(GLint),
                              static_cast<void*>(0));
-   gl.glEnableVertexAttribArray(5);
+   gl.glVertexAttribDivisor(7, 1);
+   gl.glEnableVertexAttribArray(7);
 
    // aTimeRange
-   gl.glVertexAttribIPointer(6, //
+   gl.glVertexAttribIPointer(8,
                              2,
                              GL_INT,
-                             kIntegersPerVertex_ * sizeof(GLint),
+                             kIntegerBufferLength_ * sizeof(GLint),
                              reinterpret_cast<void*>(1 * sizeof(GLint)));
-   gl.glEnableVertexAttribArray(6);
+   gl.glVertexAttribDivisor(8, 1);
+   gl.glEnableVertexAttribArray(8);
 
    // aDisplayed
-   gl30.glVertexAttribI1i(7, 1);
+   gl30.glVertexAttribI1i(9, 1);
 
    p->dirty_ = true;
 }
@@ -268,7 +333,7 @@ void PlacefileIcons::Render(
    {
       gl::OpenGLFunctions& gl = p->context_->gl();
 
-      gl.glBindVertexArray(p->vao_);
+      p->context_->state_cache().BindVertexArray(p->vao_);
 
       p->Update(textureAtlasChanged);
       p->shaderProgram_->Use();
@@ -304,8 +369,20 @@ void PlacefileIcons::Render(
       gl.glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
       gl.glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
+      // Draw the cluster representatives at the current zoom
+      const std::size_t clusterLevel =
+         settings::GeneralSettings::Instance()
+               .placefile_icon_clustering()
+               .GetValue() ?
+            util::ClusterIndex::GetClusterLevel(
+               util::maplibre::GetMapPixelScale(params)) :
+            0u;
+
       // Draw icons
-      gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+      gl.glDrawArraysInstanced(GL_TRIANGLE_STRIP,
+                               0,
+                               kVerticesPerRectangle,
+                               p->clusterCounts_[clusterLevel]);
    }
 }
 
@@ -324,6 +401,11 @@ void PlacefileIcons::Deinitialize()
    p->currentIconBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->textureBuffer_.clear();
+   p->bufferMemory_.set_bytes(0);
+   p->currentClusterIndex_.Clear();
+   p->clusterCounts_.fill(0);
+   p->hoverIndex_.Clear();
+   p->hoverIndexDirty_ = false;
 }
 
 void PlacefileIconInfo::UpdateTextureInfo()
@@ -401,6 +483,7 @@ void PlacefileIcons::FinishIcons()
 
    // Update buffers
    p->UpdateBuffers();
+   p->UpdateClusterIndex();
 
    std::unique_lock lock {p->iconMutex_};
 
@@ -410,6 +493,7 @@ void PlacefileIcons::FinishIcons()
    p->currentIconBuffer_.swap(p->newIconBuffer_);
    p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
    p->currentHoverIcons_.swap(p->newHoverIcons_);
+   std::swap(p->currentClusterIndex_, p->newClusterIndex_);
 
    // Clear the new buffers
    p->newIconList_.clear();
@@ -420,7 +504,8 @@ void PlacefileIcons::FinishIcons()
    p->newHoverIcons_.clear();
 
    // Mark the draw item dirty
-   p->dirty_ = true;
+   p->dirty_           = true;
+   p->hoverIndexDirty_ = true;
 }
 
 void PlacefileIcons::Impl::UpdateBuffers()
@@ -428,8 +513,7 @@ void PlacefileIcons::Impl::UpdateBuffers()
    newIconBuffer_.clear();
    newIconBuffer_.reserve(newIconList_.size() * kIconBufferLength);
    newIntegerBuffer_.clear();
-   newIntegerBuffer_.reserve(newIconList_.size() * kVerticesPerRectangle *
-                             kIntegersPerVertex_);
+   newIntegerBuffer_.reserve(newIconList_.size() * kIntegerBufferLength_);
 
    for (auto& di : newIconList_)
    {
@@ -437,7 +521,9 @@ void PlacefileIcons::Impl::UpdateBuffers()
       if (it == newIconFiles_.cend())
       {
          // No file found
-         logger_->trace("Could not find file number: {}", di->fileNumber_);
+         SPDLOG_LOGGER_TRACE(logger_,
+                             "Could not find file number: {}",
+                             di->fileNumber_);
          continue;
       }
 
@@ -447,7 +533,9 @@ void PlacefileIcons::Impl::UpdateBuffers()
       if (di->iconNumber_ == 0 || di->iconNumber_ > icon.numIcons_)
       {
          // No icon found
-         logger_->trace("Invalid icon number: {}", di->iconNumber_);
+         SPDLOG_LOGGER_TRACE(logger_,
+                             "Invalid icon number: {}",
+                             di->iconNumber_);
          continue;
       }
 
@@ -501,55 +589,82 @@ void PlacefileIcons::Impl::UpdateBuffers()
       const float mc3 = di->modulate_[3] / 255.0f;
 
       newIconBuffer_.insert(newIconBuffer_.end(),
-                            {
-                               // Icon
-                               lat, lon, lx, by, mc0, mc1, mc2, mc3, a, // BL
-                               lat, lon, lx, ty, mc0, mc1, mc2, mc3, a, // TL
-                               lat, lon, rx, by, mc0, mc1, mc2, mc3, a, // BR
-                               lat, lon, rx, by, mc0, mc1, mc2, mc3, a, // BR
-                               lat, lon, rx, ty, mc0, mc1, mc2, mc3, a, // TR
-                               lat, lon, lx, ty, mc0, mc1, mc2, mc3, a  // TL
-                            });
+                            {lat, lon, lx, by, rx, ty, mc0, mc1, mc2, mc3, a});
       newIntegerBuffer_.insert(newIntegerBuffer_.end(),
-                               {thresholdValue,
-                                startTime,
-                                endTime,
-                                thresholdValue,
-                                startTime,
-                                endTime,
-                                thresholdValue,
-                                startTime,
-                                endTime,
-                                thresholdValue,
-                                startTime,
-                                endTime,
-                                thresholdValue,
-                                startTime,
-                                endTime,
-                                thresholdValue,
-                                startTime,
-                                endTime});
-
-      if (!di->hoverText_.empty())
-      {
-         const units::angle::radians<double> radians = angle;
+                               {thresholdValue, startTime, endTime});
 
-         const auto sc = util::maplibre::LatLongToScreenCoordinate({lat, lon});
+      const units::angle::radians<double> radians = angle;
 
-         const float cosAngle = cosf(static_cast<float>(radians.value()));
-         const float sinAngle = sinf(static_cast<float>(radians.value()));
+      const auto sc = util::maplibre::LatLongToScreenCoordinate({lat, lon});
 
-         const glm::mat2 rotate {cosAngle, -sinAngle, sinAngle, cosAngle};
+      const float cosAngle = cosf(static_cast<float>(radians.value()));
+      const float sinAngle = sinf(static_cast<float>(radians.value()));
 
-         const glm::vec2 otl = rotate * glm::vec2 {lx, ty};
-         const glm::vec2 otr = rotate * glm::vec2 {rx, ty};
-         const glm::vec2 obl = rotate * glm::vec2 {lx, by};
-         const glm::vec2 obr = rotate * glm::vec2 {rx, by};
+      const glm::mat2 rotate {cosAngle, -sinAngle, sinAngle, cosAngle};
 
-         newHoverIcons_.emplace_back(
-            IconHoverEntry {di, sc, otl, otr, obl, obr});
-      }
+      const glm::vec2 otl = rotate * glm::vec2 {lx, ty};
+      const glm::vec2 otr = rotate * glm::vec2 {rx, ty};
+      const glm::vec2 obl = rotate * glm::vec2 {lx, by};
+      const glm::vec2 obr = rotate * glm::vec2 {rx, by};
+
+      newHoverIcons_.emplace_back(IconHoverEntry {di, sc, otl, otr, obl, obr});
+   }
+}
+
+void PlacefileIcons::Impl::UpdateClusterIndex()
+{
+   const std::size_t numIcons = newValidIconList_.size();
+
+   std::vector<glm::vec2>    points {};
+   std::vector<std::int64_t> priorities {};
+   points.reserve(numIcons);
+   priorities.reserve(numIcons);
+
+   for (auto& icon : newHoverIcons_)
+   {
+      points.push_back(icon.p_);
+
+      // Icons which are displayed latest represent a cluster, such that
+      // expiring icons do not hide the cluster
+      priorities.push_back(
+         (icon.di_->startTime_ == std::chrono::system_clock::time_point {}) ?
+            std::numeric_limits<std::int64_t>::max() :
+            std::chrono::duration_cast<std::chrono::minutes>(
+               icon.di_->endTime_.time_since_epoch())
+               .count());
+   }
+
+   const std::vector<std::size_t> order =
+      newClusterIndex_.Build(points, priorities);
+
+   // Reorder icons by cluster level
+   std::vector<std::shared_ptr<const gr::Placefile::IconDrawItem>> iconList {};
+   std::vector<float>          iconBuffer {};
+   std::vector<GLint>          integerBuffer {};
+   std::vector<IconHoverEntry> hoverIcons {};
+   iconList.reserve(numIcons);
+   iconBuffer.reserve(newIconBuffer_.size());
+   integerBuffer.reserve(newIntegerBuffer_.size());
+   hoverIcons.reserve(numIcons);
+
+   for (std::size_t i : order)
+   {
+      iconList.push_back(newValidIconList_[i]);
+      iconBuffer.insert(
+         iconBuffer.end(),
+         newIconBuffer_.cbegin() + i * kIconBufferLength,
+         newIconBuffer_.cbegin() + (i + 1) * kIconBufferLength);
+      integerBuffer.insert(
+         integerBuffer.end(),
+         newIntegerBuffer_.cbegin() + i * kIntegerBufferLength_,
+         newIntegerBuffer_.cbegin() + (i + 1) * kIntegerBufferLength_);
+      hoverIcons.push_back(newHoverIcons_[i]);
    }
+
+   newValidIconList_.swap(iconList);
+   newIconBuffer_.swap(iconBuffer);
+   newIntegerBuffer_.swap(integerBuffer);
+   newHoverIcons_.swap(hoverIcons);
 }
 
 void PlacefileIcons::Impl::UpdateTextureBuffer()
@@ -566,19 +681,8 @@ void PlacefileIcons::Impl::UpdateTextureBuffer()
          // up with data already buffered
          logger_->error("Could not find file number: {}", di->fileNumber_);
 
-         // clang-format off
-         textureBuffer_.insert(
-            textureBuffer_.end(),
-            {
-               // Icon
-               0.0f, 0.0f, 0.0f, // BL
-               0.0f, 0.0f, 0.0f, // TL
-               0.0f, 0.0f, 0.0f, // BR
-               0.0f, 0.0f, 0.0f, // BR
-               0.0f, 0.0f, 0.0f, // TR
-               0.0f, 0.0f, 0.0f  // TL
-            });
-         // clang-format on
+         textureBuffer_.insert(textureBuffer_.end(),
+                               {0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
 
          continue;
       }
@@ -589,24 +693,15 @@ void PlacefileIcons::Impl::UpdateTextureBuffer()
       if (di->iconNumber_ == 0 || di->iconNumber_ > icon.numIcons_)
       {
          // No icon found
-         logger_->trace("Invalid icon number: {}", di->iconNumber_);
+         SPDLOG_LOGGER_TRACE(logger_,
+                             "Invalid icon number: {}",
+                             di->iconNumber_);
 
          // Will get here if a texture changes, and the texture shrunk such that
          // the icon is no longer found
 
-         // clang-format off
-         textureBuffer_.insert(
-            textureBuffer_.end(),
-            {
-               // Icon
-               0.0f, 0.0f, 0.0f, // BL
-               0.0f, 0.0f, 0.0f, // TL
-               0.0f, 0.0f, 0.0f, // BR
-               0.0f, 0.0f, 0.0f, // BR
-               0.0f, 0.0f, 0.0f, // TR
-               0.0f, 0.0f, 0.0f  // TL
-            });
-         // clang-format on
+         textureBuffer_.insert(textureBuffer_.end(),
+                               {0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
 
          continue;
       }
@@ -624,19 +719,7 @@ void PlacefileIcons::Impl::UpdateTextureBuffer()
       const float bt = tt + icon.scaledHeight_;
       const float r  = static_cast<float>(icon.texture_.layerId_);
 
-      // clang-format off
-      textureBuffer_.insert(
-         textureBuffer_.end(),
-         {
-            // Icon
-            ls, bt, r, // BL
-            ls, tt, r, // TL
-            rs, bt, r, // BR
-            rs, bt, r, // BR
-            rs, tt, r, // TR
-            ls, tt, r  // TL
-         });
-      // clang-format on
+      textureBuffer_.insert(textureBuffer_.end(), {ls, bt, rs, tt, r});
    }
 }
 
@@ -644,6 +727,19 @@ void PlacefileIcons::Impl::Update(bool textureAtlasChanged)
 {
    gl::OpenGLFunctions& gl = context_->gl();
 
+   // The previously buffered icons are drawn until the upload is granted. The
+   // texture coordinates are updated with the icons.
+   if (dirty_ && !context_->upload_scheduler().Request(
+                    this,
+                    sizeof(float) * (currentIconBuffer_.size() +
+                                     currentIconList_.size() *
+                                        kTextureBufferLength) +
+                       sizeof(GLint) * currentIntegerBuffer_.size(),
+                    UploadPriority::Low))
+   {
+      return;
+   }
+
    // If the texture atlas has changed
    if (dirty_ || textureAtlasChanged)
    {
@@ -657,7 +753,7 @@ void PlacefileIcons::Impl::Update(bool textureAtlasChanged)
       UpdateTextureBuffer();
 
       // Buffer texture data
-      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[1]);
+      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[2]);
       gl.glBufferData(GL_ARRAY_BUFFER,
                       sizeof(float) * textureBuffer_.size(),
                       textureBuffer_.data(),
@@ -667,22 +763,30 @@ void PlacefileIcons::Impl::Update(bool textureAtlasChanged)
    // If buffers need updating
    if (dirty_)
    {
-      // Buffer vertex data
-      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
+      // Buffer instance data
+      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[1]);
       gl.glBufferData(GL_ARRAY_BUFFER,
                       sizeof(float) * currentIconBuffer_.size(),
                       currentIconBuffer_.data(),
                       GL_DYNAMIC_DRAW);
 
       // Buffer threshold data
-      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[2]);
+      gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[3]);
       gl.glBufferData(GL_ARRAY_BUFFER,
                       sizeof(GLint) * currentIntegerBuffer_.size(),
                       currentIntegerBuffer_.data(),
                       GL_DYNAMIC_DRAW);
 
-      numVertices_ =
-         static_cast<GLsizei>(currentIconBuffer_.size() / kPointsPerVertex);
+      for (std::size_t level = 0; level < clusterCounts_.size(); ++level)
+      {
+         clusterCounts_[level] =
+            static_cast<GLsizei>(currentClusterIndex_.count(level));
+      }
+
+      bufferMemory_.set_bytes(
+         2 * (sizeof(float) * currentIconBuffer_.size() +
+              sizeof(float) * textureBuffer_.size() +
+              sizeof(GLint) * currentIntegerBuffer_.size()));
    }
 
    dirty_ = false;
@@ -721,35 +825,37 @@ bool PlacefileIcons::RunMousePicking(
          std::chrono::system_clock::now() :
          p->selectedTime_;
 
-   // For each pickable icon
-   auto it = std::find_if(
-      std::execution::par_unseq,
-      p->currentHoverIcons_.crbegin(),
-      p->currentHoverIcons_.crend(),
-      [&mapDistance, &selectedTime, &mapMatrix, &mouseCoords](const auto& icon)
-      {
-         if ((
-                // Placefile is thresholded
-                mapDistance > units::length::meters<double> {0.0} &&
-
-                // Placefile threshold is < 999 nmi
-                static_cast<int>(std::round(
-                   units::length::nautical_miles<double> {icon.di_->threshold_}
-                      .value())) < 999 &&
+   // Icons drawn at the current zoom
+   const std::size_t clusterLevel =
+      settings::GeneralSettings::Instance()
+            .placefile_icon_clustering()
+            .GetValue() ?
+         util::ClusterIndex::GetClusterLevel(
+            util::maplibre::GetMapPixelScale(params)) :
+         0u;
+   const std::size_t drawnIcons = p->currentClusterIndex_.count(clusterLevel);
+
+   if (p->hoverIndexDirty_)
+   {
+      p->UpdateHoverIndex();
+   }
 
-                // Map distance is beyond the threshold
-                icon.di_->threshold_ < mapDistance) ||
+   // Hover text of the picked icon, or of the icons in its cluster
+   std::string hoverText {};
 
-             (
-                // Line has a start time
-                icon.di_->startTime_ !=
-                   std::chrono::system_clock::time_point {} &&
+   // For each pickable icon near the mouse cursor
+   const auto candidates =
+      p->hoverIndex_.Query(mouseCoords, std::max(scale.x, scale.y));
 
-                // The time range has not yet started
-                (selectedTime < icon.di_->startTime_ ||
+   auto it = std::find_if(
+      candidates.cbegin(),
+      candidates.cend(),
+      [&](std::size_t index)
+      {
+         const auto& icon = p->currentHoverIcons_[index];
 
-                 // The time range has ended
-                 icon.di_->endTime_ <= selectedTime)))
+         if (index >= drawnIcons ||
+             !p->IsDisplayed(*icon.di_, mapDistance, selectedTime))
          {
             // Icon is not pickable
             return false;
@@ -776,18 +882,106 @@ bool PlacefileIcons::RunMousePicking(
          tr += otr;
 
          // Test point against polygon bounds
-         return util::maplibre::IsPointInPolygon({tl, bl, br, tr}, mouseCoords);
+         if (!util::maplibre::IsPointInPolygon({tl, bl, br, tr}, mouseCoords))
+         {
+            return false;
+         }
+
+         // Resolve the cluster represented by the icon to its members
+         std::size_t hoverItems = 0u;
+         std::size_t moreItems  = 0u;
+
+         for (std::size_t member :
+              p->currentClusterIndex_.members(index, clusterLevel))
+         {
+            const auto& di = p->currentHoverIcons_[member].di_;
+
+            if (di->hoverText_.empty() ||
+                !p->IsDisplayed(*di, mapDistance, selectedTime))
+            {
+               continue;
+            }
+
+            if (hoverItems == kMaxClusterHoverItems_)
+            {
+               ++moreItems;
+               continue;
+            }
+
+            if (hoverItems++ > 0u)
+            {
+               hoverText += "\n\n";
+            }
+            hoverText += di->hoverText_;
+         }
+
+         if (moreItems > 0u)
+         {
+            hoverText += fmt::format("\n\n+{} more", moreItems);
+         }
+
+         return hoverItems > 0u;
       });
 
-   if (it != p->currentHoverIcons_.crend())
+   if (it != candidates.cend())
    {
       itemPicked = true;
-      util::tooltip::Show(it->di_->hoverText_, mouseGlobalPos);
+      util::tooltip::Show(hoverText, mouseGlobalPos);
    }
 
    return itemPicked;
 }
 
+bool PlacefileIcons::Impl::IsDisplayed(
+   const gr::Placefile::IconDrawItem&    di,
+   units::length::meters<double>         mapDistance,
+   std::chrono::system_clock::time_point selectedTime)
+{
+   return !((
+               // Placefile is thresholded
+               mapDistance > units::length::meters<double> {0.0} &&
+
+               // Placefile threshold is < 999 nmi
+               static_cast<int>(std::round(
+                  units::length::nautical_miles<double> {di.threshold_}
+                     .value())) < 999 &&
+
+               // Map distance is beyond the threshold
+               di.threshold_ < mapDistance) ||
+
+            (
+               // Line has a start time
+               di.startTime_ != std::chrono::system_clock::time_point {} &&
+
+               // The time range has not yet started
+               (selectedTime < di.startTime_ ||
+
+                // The time range has ended
+                di.endTime_ <= selectedTime)));
+}
+
+void PlacefileIcons::Impl::UpdateHoverIndex()
+{
+   std::vector<glm::vec4> bounds {};
+   bounds.reserve(currentHoverIcons_.size());
+
+   float maxPixelOffset = 0.0f;
+
+   for (auto& icon : currentHoverIcons_)
+   {
+      bounds.emplace_back(icon.p_, icon.p_);
+
+      maxPixelOffset = std::max({maxPixelOffset,
+                                 glm::length(icon.otl_),
+                                 glm::length(icon.otr_),
+                                 glm::length(icon.obl_),
+                                 glm::length(icon.obr_)});
+   }
+
+   hoverIndex_.Build(bounds, maxPixelOffset);
+   hoverIndexDirty_ = false;
+}
+
 } // namespace draw
 } // namespace gl
 } // namespace qt
@@ -2,6 +2,7 @@
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/memory.hpp>
 
 #include <QDir>
 #include <QUrl>
@@ -101,6 +102,9 @@ public:
    std::vector<float> newImageBuffer_ {};
    std::vector<GLint> newIntegerBuffer_ {};
 
+   // Current buffers, and their copies in GPU memory
+   scwx::util::MemoryCounter bufferMemory_ {"Placefile Draw Items"};
+
    std::vector<float> textureBuffer_ {};
 
    std::shared_ptr<ShaderProgram> shaderProgram_;
@@ -144,7 +148,6 @@ void PlacefileImages::Initialize()
 
    p->shaderProgram_ = p->context_->GetShaderProgram(
       {{GL_VERTEX_SHADER, ":/gl/geo_texture2d.vert"},
-       {GL_GEOMETRY_SHADER, ":/gl/threshold.geom"},
        {GL_FRAGMENT_SHADER, ":/gl/texture2d_array.frag"}});
 
    p->uMVPMatrixLocation_ = p->shaderProgram_->GetUniformLocation("uMVPMatrix");
@@ -237,7 +240,7 @@ void PlacefileImages::Render(
    {
       gl::OpenGLFunctions& gl = p->context_->gl();
 
-      gl.glBindVertexArray(p->vao_);
+      p->context_->state_cache().BindVertexArray(p->vao_);
 
       p->Update(textureAtlasChanged);
       p->shaderProgram_->Use();
@@ -292,6 +295,7 @@ void PlacefileImages::Deinitialize()
    p->currentImageBuffer_.clear();
    p->currentIntegerBuffer_.clear();
    p->textureBuffer_.clear();
+   p->bufferMemory_.set_bytes(0);
 }
 
 void PlacefileImageInfo::UpdateTextureInfo()
@@ -441,6 +445,19 @@ void PlacefileImages::Impl::Update(bool textureAtlasChanged)
 {
    gl::OpenGLFunctions& gl = context_->gl();
 
+   // The previously buffered images are drawn until the upload is granted. The
+   // texture coordinates are updated with the images.
+   if (dirty_ && !context_->upload_scheduler().Request(
+                    this,
+                    sizeof(float) * (currentImageBuffer_.size() +
+                                     currentImageList_.size() *
+                                        kTextureBufferLength) +
+                       sizeof(GLint) * currentIntegerBuffer_.size(),
+                    UploadPriority::Low))
+   {
+      return;
+   }
+
    // If the texture atlas has changed
    if (dirty_ || textureAtlasChanged)
    {
@@ -480,6 +497,11 @@ void PlacefileImages::Impl::Update(bool textureAtlasChanged)
 
       numVertices_ =
          static_cast<GLsizei>(currentImageBuffer_.size() / kPointsPerVertex);
+
+      bufferMemory_.set_bytes(
+         2 * (sizeof(float) * currentImageBuffer_.size() +
+              sizeof(float) * textureBuffer_.size() +
+              sizeof(GLint) * currentIntegerBuffer_.size()));
    }
 
    dirty_ = false;
@@ -1,10 +1,15 @@
 #include <scwx/qt/gl/draw/placefile_lines.hpp>
+#include <scwx/qt/gl/viewport_culler.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/line_simplification.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/memory.hpp>
 
-#include <execution>
+#include <algorithm>
 
 namespace scwx
 {
@@ -59,6 +64,7 @@ public:
    ~Impl() {}
 
    void BufferLine(const std::shared_ptr<const gr::Placefile::LineDrawItem>& di,
+                   std::size_t                         level,
                    const gr::Placefile::LineDrawItem::Element&               e1,
                    const gr::Placefile::LineDrawItem::Element&               e2,
                    const float                         width,
@@ -71,6 +77,7 @@ public:
    void
    UpdateBuffers(const std::shared_ptr<const gr::Placefile::LineDrawItem>& di);
    void Update();
+   void UpdateHoverIndex();
 
    std::shared_ptr<GlContext> context_;
 
@@ -86,12 +93,30 @@ public:
 
    std::vector<float> currentLinesBuffer_ {};
    std::vector<GLint> currentIntegerBuffer_ {};
-   std::vector<float> newLinesBuffer_ {};
-   std::vector<GLint> newIntegerBuffer_ {};
+
+   // Current buffers, and their copies in GPU memory
+   scwx::util::MemoryCounter bufferMemory_ {"Placefile Draw Items"};
+
+   // New buffers and whether each has been simplified, by level of detail
+   std::array<std::vector<float>, util::kLevelOfDetailCount>
+      newLinesBuffers_ {};
+   std::array<std::vector<GLint>, util::kLevelOfDetailCount>
+                                               newIntegerBuffers_ {};
+   std::array<bool, util::kLevelOfDetailCount> newLevelSimplified_ {};
+
+   // First vertex and vertex count of each level of detail, of the current
+   // lines and of the buffered lines
+   std::array<std::pair<GLint, GLsizei>, util::kLevelOfDetailCount>
+      currentLevelRanges_ {};
+   std::array<std::pair<GLint, GLsizei>, util::kLevelOfDetailCount>
+      levelRanges_ {};
 
    std::vector<LineHoverEntry> currentHoverLines_ {};
    std::vector<LineHoverEntry> newHoverLines_ {};
 
+   util::SpatialIndex hoverIndex_ {};
+   bool               hoverIndexDirty_ {false};
+
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
    GLint                          uMapMatrixLocation_;
@@ -102,6 +127,10 @@ public:
    GLuint                vao_;
    std::array<GLuint, 2> vbo_;
 
+   ViewportCuller viewportCuller_ {kPointsPerVertex,
+                                  kVerticesPerRectangle,
+                                  ViewportCuller::Coordinates::LatLong};
+
    GLsizei numVertices_;
 };
 
@@ -132,7 +161,6 @@ void PlacefileLines::Initialize()
 
    p->shaderProgram_ = p->context_->GetShaderProgram(
       {{GL_VERTEX_SHADER, ":/gl/geo_texture2d.vert"},
-       {GL_GEOMETRY_SHADER, ":/gl/threshold.geom"},
        {GL_FRAGMENT_SHADER, ":/gl/color.frag"}});
 
    p->uMVPMatrixLocation_ = p->shaderProgram_->GetUniformLocation("uMVPMatrix");
@@ -221,7 +249,7 @@ void PlacefileLines::Render(
    {
       gl::OpenGLFunctions& gl = p->context_->gl();
 
-      gl.glBindVertexArray(p->vao_);
+      p->context_->state_cache().BindVertexArray(p->vao_);
 
       p->Update();
       p->shaderProgram_->Use();
@@ -229,32 +257,41 @@ void PlacefileLines::Render(
       UseMapProjection(
          params, p->uMapMatrixLocation_, p->uMapScreenCoordLocation_);
 
-      if (p->thresholded_)
-      {
-         // If thresholding is enabled, set the map distance
-         units::length::nautical_miles<float> mapDistance =
-            util::maplibre::GetMapDistance(params);
-         gl.glUniform1f(p->uMapDistanceLocation_, mapDistance.value());
-      }
-      else
-      {
-         // If thresholding is disabled, set the map distance to 0
-         gl.glUniform1f(p->uMapDistanceLocation_, 0.0f);
-      }
+      // If thresholding is disabled, set the map distance to 0
+      const units::length::nautical_miles<float> mapDistance =
+         (p->thresholded_) ? util::maplibre::GetMapDistance(params) :
+                             units::length::meters<double> {0.0};
+      gl.glUniform1f(p->uMapDistanceLocation_, mapDistance.value());
 
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
             std::chrono::system_clock::now() :
             p->selectedTime_;
-      gl.glUniform1i(
-         p->uSelectedTimeLocation_,
+      const GLint selectedMinutes =
          static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
                                selectedTime.time_since_epoch())
-                               .count()));
+                               .count());
+      gl.glUniform1i(p->uSelectedTimeLocation_, selectedMinutes);
+
+      // Hidden primitives may also be filtered on the CPU, so their vertices
+      // are not drawn at all
+      if (settings::GeneralSettings::Instance()
+             .cpu_primitive_filtering()
+             .GetValue())
+      {
+         p->viewportCuller_.SetFilter(mapDistance.value(), selectedMinutes);
+      }
+      else
+      {
+         p->viewportCuller_.ClearFilter();
+      }
 
-      // Draw icons
-      gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+         // Draw lines within the viewport at the current level of detail
+      const auto [first, count] =
+         p->levelRanges_[util::GetLevelOfDetail(
+            util::maplibre::GetMapPixelScale(params))];
+      p->viewportCuller_.Draw(gl, params, p->numVertices_, first, count);
    }
 }
 
@@ -269,14 +306,21 @@ void PlacefileLines::Deinitialize()
 
    p->currentLinesBuffer_.clear();
    p->currentIntegerBuffer_.clear();
+   p->bufferMemory_.set_bytes(0);
    p->currentHoverLines_.clear();
+   p->hoverIndex_.Clear();
+   p->hoverIndexDirty_ = false;
 }
 
 void PlacefileLines::StartLines()
 {
    // Clear the new buffers
-   p->newLinesBuffer_.clear();
-   p->newIntegerBuffer_.clear();
+   for (std::size_t level = 0; level < util::kLevelOfDetailCount; ++level)
+   {
+      p->newLinesBuffers_[level].clear();
+      p->newIntegerBuffers_[level].clear();
+      p->newLevelSimplified_[level] = false;
+   }
    p->newHoverLines_.clear();
 
    p->newNumLines_ = 0u;
@@ -296,23 +340,50 @@ void PlacefileLines::FinishLines()
 {
    std::unique_lock lock {p->lineMutex_};
 
-   // Swap buffers
-   p->currentLinesBuffer_.swap(p->newLinesBuffer_);
-   p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
-   p->currentHoverLines_.swap(p->newHoverLines_);
+   p->currentLinesBuffer_.clear();
+   p->currentIntegerBuffer_.clear();
 
-   // Clear the new buffers
-   p->newLinesBuffer_.clear();
-   p->newIntegerBuffer_.clear();
+   // Concatenate the levels of detail, reusing the previous level where
+   // simplification did not remove any vertices
+   for (std::size_t level = 0; level < util::kLevelOfDetailCount; ++level)
+   {
+      auto& linesBuffer   = p->newLinesBuffers_[level];
+      auto& integerBuffer = p->newIntegerBuffers_[level];
+
+      if (level > 0 && !p->newLevelSimplified_[level])
+      {
+         p->currentLevelRanges_[level] = p->currentLevelRanges_[level - 1];
+      }
+      else
+      {
+         p->currentLevelRanges_[level] = {
+            static_cast<GLint>(p->currentLinesBuffer_.size() /
+                               kPointsPerVertex),
+            static_cast<GLsizei>(linesBuffer.size() / kPointsPerVertex)};
+
+         p->currentLinesBuffer_.insert(p->currentLinesBuffer_.end(),
+                                       linesBuffer.cbegin(),
+                                       linesBuffer.cend());
+         p->currentIntegerBuffer_.insert(p->currentIntegerBuffer_.end(),
+                                         integerBuffer.cbegin(),
+                                         integerBuffer.cend());
+      }
+
+      // Clear the new buffers
+      linesBuffer.clear();
+      integerBuffer.clear();
+   }
+
+   // Swap hover lines
+   p->currentHoverLines_.swap(p->newHoverLines_);
    p->newHoverLines_.clear();
 
    // Update the number of lines
    p->currentNumLines_ = p->newNumLines_;
-   p->numVertices_ =
-      static_cast<GLsizei>(p->currentNumLines_ * kVerticesPerRectangle);
 
    // Mark the draw item dirty
-   p->dirty_ = true;
+   p->dirty_           = true;
+   p->hoverIndexDirty_ = true;
 }
 
 void PlacefileLines::Impl::UpdateBuffers(
@@ -332,53 +403,83 @@ void PlacefileLines::Impl::UpdateBuffers(
                             di->endTime_.time_since_epoch())
                             .count());
 
-   std::vector<units::angle::degrees<double>> angles {};
-   angles.reserve(di->elements_.size() - 1);
+   std::vector<glm::vec2> screenCoordinates {};
+   screenCoordinates.reserve(di->elements_.size());
 
-   // For each element pair inside a Line statement, render a black line
-   for (std::size_t i = 0; i < di->elements_.size() - 1; ++i)
+   for (auto& element : di->elements_)
    {
-      // Latitude and longitude coordinates in degrees
-      const float lat1 = static_cast<float>(di->elements_[i].latitude_);
-      const float lon1 = static_cast<float>(di->elements_[i].longitude_);
-      const float lat2 = static_cast<float>(di->elements_[i + 1].latitude_);
-      const float lon2 = static_cast<float>(di->elements_[i + 1].longitude_);
-
-      // Calculate angle
-      const units::angle::degrees<double> angle =
-         util::GeographicLib::GetAngle(lat1, lon1, lat2, lon2);
-      angles.push_back(angle);
-
-      // Buffer line with hover text
-      BufferLine(di,
-                 di->elements_[i],
-                 di->elements_[i + 1],
-                 di->width_ + 2,
-                 angle,
-                 kBlack_,
-                 thresholdValue,
-                 startTime,
-                 endTime,
-                 true);
+      screenCoordinates.push_back(util::maplibre::LatLongToScreenCoordinate(
+         {element.latitude_, element.longitude_}));
    }
 
-   // For each element pair inside a Line statement, render a colored line
-   for (std::size_t i = 0; i < di->elements_.size() - 1; ++i)
+   std::vector<std::size_t> previousIndices {};
+
+   for (std::size_t level = 0; level < util::kLevelOfDetailCount; ++level)
    {
-      BufferLine(di,
-                 di->elements_[i],
-                 di->elements_[i + 1],
-                 di->width_,
-                 angles[i],
-                 di->color_,
-                 thresholdValue,
-                 startTime,
-                 endTime);
+      const std::vector<std::size_t> indices = util::SimplifyLine(
+         screenCoordinates, util::GetLevelOfDetailTolerance(level));
+
+      if (level > 0 && indices != previousIndices)
+      {
+         newLevelSimplified_[level] = true;
+      }
+
+      std::vector<units::angle::degrees<double>> angles {};
+      angles.reserve(indices.size() - 1);
+
+      // For each element pair inside a Line statement, render a black line
+      for (std::size_t i = 0; i < indices.size() - 1; ++i)
+      {
+         const auto& e1 = di->elements_[indices[i]];
+         const auto& e2 = di->elements_[indices[i + 1]];
+
+         // Latitude and longitude coordinates in degrees
+         const float lat1 = static_cast<float>(e1.latitude_);
+         const float lon1 = static_cast<float>(e1.longitude_);
+         const float lat2 = static_cast<float>(e2.latitude_);
+         const float lon2 = static_cast<float>(e2.longitude_);
+
+         // Calculate angle
+         const units::angle::degrees<double> angle =
+            util::GeographicLib::GetAngle(lat1, lon1, lat2, lon2);
+         angles.push_back(angle);
+
+         // Buffer line, with hover text at full detail
+         BufferLine(di,
+                    level,
+                    e1,
+                    e2,
+                    di->width_ + 2,
+                    angle,
+                    kBlack_,
+                    thresholdValue,
+                    startTime,
+                    endTime,
+                    level == 0);
+      }
+
+      // For each element pair inside a Line statement, render a colored line
+      for (std::size_t i = 0; i < indices.size() - 1; ++i)
+      {
+         BufferLine(di,
+                    level,
+                    di->elements_[indices[i]],
+                    di->elements_[indices[i + 1]],
+                    di->width_,
+                    angles[i],
+                    di->color_,
+                    thresholdValue,
+                    startTime,
+                    endTime);
+      }
+
+      previousIndices = indices;
    }
 }
 
 void PlacefileLines::Impl::BufferLine(
    const std::shared_ptr<const gr::Placefile::LineDrawItem>& di,
+   std::size_t                                               level,
    const gr::Placefile::LineDrawItem::Element&               e1,
    const gr::Placefile::LineDrawItem::Element&               e2,
    const float                                               width,
@@ -418,35 +519,38 @@ void PlacefileLines::Impl::BufferLine(
    const float mc3 = color[3] / 255.0f;
 
    // Update buffers
-   newLinesBuffer_.insert(newLinesBuffer_.end(),
-                          {
-                             // Line
-                             lat1, lon1, lx, by, mc0, mc1, mc2, mc3, a, // BL
-                             lat2, lon2, lx, ty, mc0, mc1, mc2, mc3, a, // TL
-                             lat1, lon1, rx, by, mc0, mc1, mc2, mc3, a, // BR
-                             lat1, lon1, rx, by, mc0, mc1, mc2, mc3, a, // BR
-                             lat2, lon2, rx, ty, mc0, mc1, mc2, mc3, a, // TR
-                             lat2, lon2, lx, ty, mc0, mc1, mc2, mc3, a  // TL
-                          });
-   newIntegerBuffer_.insert(newIntegerBuffer_.end(),
-                            {threshold,
-                             startTime,
-                             endTime,
-                             threshold,
-                             startTime,
-                             endTime,
-                             threshold,
-                             startTime,
-                             endTime,
-                             threshold,
-                             startTime,
-                             endTime,
-                             threshold,
-                             startTime,
-                             endTime,
-                             threshold,
-                             startTime,
-                             endTime});
+   auto& newLinesBuffer   = newLinesBuffers_[level];
+   auto& newIntegerBuffer = newIntegerBuffers_[level];
+
+   newLinesBuffer.insert(newLinesBuffer.end(),
+                         {
+                            // Line
+                            lat1, lon1, lx, by, mc0, mc1, mc2, mc3, a, // BL
+                            lat2, lon2, lx, ty, mc0, mc1, mc2, mc3, a, // TL
+                            lat1, lon1, rx, by, mc0, mc1, mc2, mc3, a, // BR
+                            lat1, lon1, rx, by, mc0, mc1, mc2, mc3, a, // BR
+                            lat2, lon2, rx, ty, mc0, mc1, mc2, mc3, a, // TR
+                            lat2, lon2, lx, ty, mc0, mc1, mc2, mc3, a  // TL
+                         });
+   newIntegerBuffer.insert(newIntegerBuffer.end(),
+                           {threshold,
+                            startTime,
+                            endTime,
+                            threshold,
+                            startTime,
+                            endTime,
+                            threshold,
+                            startTime,
+                            endTime,
+                            threshold,
+                            startTime,
+                            endTime,
+                            threshold,
+                            startTime,
+                            endTime,
+                            threshold,
+                            startTime,
+                            endTime});
 
    if (bufferHover && !di->hoverText_.empty())
    {
@@ -477,6 +581,16 @@ void PlacefileLines::Impl::Update()
    {
       gl::OpenGLFunctions& gl = context_->gl();
 
+      // The previously buffered lines are drawn until the upload is granted
+      if (!context_->upload_scheduler().Request(
+             this,
+             sizeof(float) * currentLinesBuffer_.size() +
+                sizeof(GLint) * currentIntegerBuffer_.size(),
+             UploadPriority::Low))
+      {
+         return;
+      }
+
       // Buffer lines data
       gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
       gl.glBufferData(GL_ARRAY_BUFFER,
@@ -490,6 +604,16 @@ void PlacefileLines::Impl::Update()
                       sizeof(GLint) * currentIntegerBuffer_.size(),
                       currentIntegerBuffer_.data(),
                       GL_DYNAMIC_DRAW);
+
+      numVertices_ = static_cast<GLsizei>(currentLinesBuffer_.size() /
+                                          kPointsPerVertex);
+      levelRanges_ = currentLevelRanges_;
+
+      viewportCuller_.Build(currentLinesBuffer_, currentIntegerBuffer_);
+
+      bufferMemory_.set_bytes(
+         2 * (sizeof(float) * currentLinesBuffer_.size() +
+              sizeof(GLint) * currentIntegerBuffer_.size()));
    }
 
    dirty_ = false;
@@ -528,13 +652,23 @@ bool PlacefileLines::RunMousePicking(
          std::chrono::system_clock::now() :
          p->selectedTime_;
 
-   // For each pickable line
+   if (p->hoverIndexDirty_)
+   {
+      p->UpdateHoverIndex();
+   }
+
+   // For each pickable line near the mouse cursor
+   const auto candidates =
+      p->hoverIndex_.Query(mouseCoords, std::max(scale.x, scale.y));
+
    auto it = std::find_if(
-      std::execution::par_unseq,
-      p->currentHoverLines_.crbegin(),
-      p->currentHoverLines_.crend(),
-      [&mapDistance, &selectedTime, &mapMatrix, &mouseCoords](const auto& line)
+      candidates.cbegin(),
+      candidates.cend(),
+      [this, &mapDistance, &selectedTime, &mapMatrix, &mouseCoords](
+         std::size_t index)
       {
+         const auto& line = p->currentHoverLines_[index];
+
          if ((
                 // Placefile is thresholded
                 mapDistance > units::length::meters<double> {0.0} &&
@@ -588,15 +722,39 @@ bool PlacefileLines::RunMousePicking(
          return util::maplibre::IsPointInPolygon({tl, bl, br, tr}, mouseCoords);
       });
 
-   if (it != p->currentHoverLines_.crend())
+   if (it != candidates.cend())
    {
       itemPicked = true;
-      util::tooltip::Show(it->di_->hoverText_, mouseGlobalPos);
+      util::tooltip::Show(p->currentHoverLines_[*it].di_->hoverText_,
+                          mouseGlobalPos);
    }
 
    return itemPicked;
 }
 
+void PlacefileLines::Impl::UpdateHoverIndex()
+{
+   std::vector<glm::vec4> bounds {};
+   bounds.reserve(currentHoverLines_.size());
+
+   float maxPixelOffset = 0.0f;
+
+   for (auto& line : currentHoverLines_)
+   {
+      bounds.emplace_back(glm::min(line.p1_, line.p2_),
+                          glm::max(line.p1_, line.p2_));
+
+      maxPixelOffset = std::max({maxPixelOffset,
+                                 glm::length(line.otl_),
+                                 glm::length(line.otr_),
+                                 glm::length(line.obl_),
+                                 glm::length(line.obr_)});
+   }
+
+   hoverIndex_.Build(bounds, maxPixelOffset);
+   hoverIndexDirty_ = false;
+}
+
 } // namespace draw
 } // namespace gl
 } // namespace qt
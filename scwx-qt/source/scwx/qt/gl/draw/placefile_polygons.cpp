@@ -1,11 +1,19 @@
 #include <scwx/qt/gl/draw/placefile_polygons.hpp>
+#include <scwx/qt/gl/viewport_culler.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/qt/util/line_simplification.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/memory.hpp>
 
+#include <execution>
 #include <mutex>
+#include <numeric>
+#include <unordered_map>
 
 #include <GL/glu.h>
 #include <boost/container/stable_vector.hpp>
+#include <boost/container_hash/hash.hpp>
 
 #if defined(_WIN32)
 typedef void (*_GLUfuncptr)(void);
@@ -41,9 +49,26 @@ static constexpr std::size_t kTessVertexSize_    = kTessVertexA_ + 1;
 
 typedef std::array<GLdouble, kTessVertexSize_> TessVertexArray;
 
+// Triangles of each level of detail of a tessellated polygon
+struct Tessellation
+{
+   std::array<std::vector<GLfloat>, util::kLevelOfDetailCount> buffers_ {};
+
+   // Whether each level of detail differs from the previous level
+   std::array<bool, util::kLevelOfDetailCount> simplified_ {};
+};
+
 class PlacefilePolygons::Impl
 {
 public:
+   struct TessellationState
+   {
+      Tessellation* tessellation_;
+      std::size_t   level_ {};
+
+      boost::container::stable_vector<TessVertexArray> combineBuffer_ {};
+   };
+
    explicit Impl(const std::shared_ptr<GlContext>& context) :
        context_ {context},
        shaderProgram_ {nullptr},
@@ -56,30 +81,16 @@ public:
        vbo_ {GL_INVALID_INDEX},
        numVertices_ {0}
    {
-      tessellator_ = gluNewTess();
-
-      gluTessCallback(tessellator_, //
-                      GLU_TESS_COMBINE_DATA,
-                      (_GLUfuncptr) &TessellateCombineCallback);
-      gluTessCallback(tessellator_, //
-                      GLU_TESS_VERTEX_DATA,
-                      (_GLUfuncptr) &TessellateVertexCallback);
-
-      // Force GLU_TRIANGLES
-      gluTessCallback(tessellator_, //
-                      GLU_TESS_EDGE_FLAG,
-                      []() {});
-
-      gluTessCallback(tessellator_, //
-                      GLU_TESS_ERROR,
-                      (_GLUfuncptr) &TessellateErrorCallback);
    }
 
-   ~Impl() { gluDeleteTess(tessellator_); }
+   ~Impl() {}
 
    void Update();
 
-   void Tessellate(const std::shared_ptr<gr::Placefile::PolygonDrawItem>& di);
+   static std::size_t
+   GetContoursHash(const gr::Placefile::PolygonDrawItem& di);
+   static std::shared_ptr<const Tessellation>
+   Tessellate(const gr::Placefile::PolygonDrawItem& di);
 
    static void TessellateCombineCallback(GLdouble coords[3],
                                          void*    vertexData[4],
@@ -96,15 +107,24 @@ public:
 
    std::chrono::system_clock::time_point selectedTime_ {};
 
-   boost::container::stable_vector<TessVertexArray> tessCombineBuffer_ {};
+   std::vector<std::shared_ptr<gr::Placefile::PolygonDrawItem>> newPolygons_ {};
+
+   // Tessellated polygons of the last set of polygons, by contours hash
+   std::unordered_map<std::size_t, std::shared_ptr<const Tessellation>>
+      tessellationCache_ {};
 
    std::mutex           bufferMutex_ {};
    std::vector<GLfloat> currentBuffer_ {};
    std::vector<GLint>   currentIntegerBuffer_ {};
-   std::vector<GLfloat> newBuffer_ {};
-   std::vector<GLint>   newIntegerBuffer_ {};
 
-   GLUtesselator* tessellator_;
+   // Current buffers, and their copies in GPU memory
+   scwx::util::MemoryCounter bufferMemory_ {"Placefile Draw Items"};
+
+   // First vertex and vertex count of each level of detail
+   std::array<std::pair<GLint, GLsizei>, util::kLevelOfDetailCount>
+      currentLevelRanges_ {};
+   std::array<std::pair<GLint, GLsizei>, util::kLevelOfDetailCount>
+      levelRanges_ {};
 
    std::shared_ptr<ShaderProgram> shaderProgram_;
    GLint                          uMVPMatrixLocation_;
@@ -116,11 +136,11 @@ public:
    GLuint                vao_;
    std::array<GLuint, 2> vbo_;
 
-   GLsizei numVertices_;
+   ViewportCuller viewportCuller_ {kPointsPerVertex,
+                                  kVerticesPerTriangle,
+                                  ViewportCuller::Coordinates::MapScreen};
 
-   GLint currentThreshold_ {};
-   GLint currentStartTime_ {};
-   GLint currentEndTime_ {};
+   GLsizei numVertices_;
 };
 
 PlacefilePolygons::PlacefilePolygons(
@@ -151,7 +171,6 @@ void PlacefilePolygons::Initialize()
 
    p->shaderProgram_ = p->context_->GetShaderProgram(
       {{GL_VERTEX_SHADER, ":/gl/map_color.vert"},
-       {GL_GEOMETRY_SHADER, ":/gl/threshold.geom"},
        {GL_FRAGMENT_SHADER, ":/gl/color.frag"}});
 
    p->uMVPMatrixLocation_ = p->shaderProgram_->GetUniformLocation("uMVPMatrix");
@@ -226,7 +245,7 @@ void PlacefilePolygons::Render(
    {
       gl::OpenGLFunctions& gl = p->context_->gl();
 
-      gl.glBindVertexArray(p->vao_);
+      p->context_->state_cache().BindVertexArray(p->vao_);
 
       p->Update();
       p->shaderProgram_->Use();
@@ -234,32 +253,41 @@ void PlacefilePolygons::Render(
       UseMapProjection(
          params, p->uMapMatrixLocation_, p->uMapScreenCoordLocation_);
 
-      if (p->thresholded_)
-      {
-         // If thresholding is enabled, set the map distance
-         units::length::nautical_miles<float> mapDistance =
-            util::maplibre::GetMapDistance(params);
-         gl.glUniform1f(p->uMapDistanceLocation_, mapDistance.value());
-      }
-      else
-      {
-         // If thresholding is disabled, set the map distance to 0
-         gl.glUniform1f(p->uMapDistanceLocation_, 0.0f);
-      }
+      // If thresholding is disabled, set the map distance to 0
+      const units::length::nautical_miles<float> mapDistance =
+         (p->thresholded_) ? util::maplibre::GetMapDistance(params) :
+                             units::length::meters<double> {0.0};
+      gl.glUniform1f(p->uMapDistanceLocation_, mapDistance.value());
 
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
             std::chrono::system_clock::now() :
             p->selectedTime_;
-      gl.glUniform1i(
-         p->uSelectedTimeLocation_,
+      const GLint selectedMinutes =
          static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
                                selectedTime.time_since_epoch())
-                               .count()));
+                               .count());
+      gl.glUniform1i(p->uSelectedTimeLocation_, selectedMinutes);
+
+      // Hidden primitives may also be filtered on the CPU, so their vertices
+      // are not drawn at all
+      if (settings::GeneralSettings::Instance()
+             .cpu_primitive_filtering()
+             .GetValue())
+      {
+         p->viewportCuller_.SetFilter(mapDistance.value(), selectedMinutes);
+      }
+      else
+      {
+         p->viewportCuller_.ClearFilter();
+      }
 
-      // Draw icons
-      gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+      // Draw polygons within the viewport at the current level of detail
+      const auto [first, count] =
+         p->levelRanges_[util::GetLevelOfDetail(
+            util::maplibre::GetMapPixelScale(params))];
+      p->viewportCuller_.Draw(gl, params, p->numVertices_, first, count);
    }
 }
 
@@ -275,13 +303,13 @@ void PlacefilePolygons::Deinitialize()
    // Clear the current buffers
    p->currentBuffer_.clear();
    p->currentIntegerBuffer_.clear();
+   p->bufferMemory_.set_bytes(0);
 }
 
 void PlacefilePolygons::StartPolygons()
 {
-   // Clear the new buffers
-   p->newBuffer_.clear();
-   p->newIntegerBuffer_.clear();
+   // Clear the new polygons
+   p->newPolygons_.clear();
 }
 
 void PlacefilePolygons::AddPolygon(
@@ -289,24 +317,133 @@ void PlacefilePolygons::AddPolygon(
 {
    if (di != nullptr)
    {
-      p->Tessellate(di);
+      p->newPolygons_.push_back(di);
    }
 }
 
 void PlacefilePolygons::FinishPolygons()
 {
+   const auto& polygons = p->newPolygons_;
+
+   std::vector<std::size_t>                         hashes(polygons.size());
+   std::vector<std::shared_ptr<const Tessellation>> tessellations(
+      polygons.size());
+
+   // Reuse polygons which were tessellated in the last set of polygons
+   for (std::size_t i = 0; i < polygons.size(); ++i)
+   {
+      hashes[i] = Impl::GetContoursHash(*polygons[i]);
+
+      auto it = p->tessellationCache_.find(hashes[i]);
+      if (it != p->tessellationCache_.cend())
+      {
+         tessellations[i] = it->second;
+      }
+   }
+
+   // Tessellate the remaining polygons in parallel
+   std::vector<std::size_t> indices(polygons.size());
+   std::iota(indices.begin(), indices.end(), std::size_t {0});
+
+   std::for_each(std::execution::par,
+                 indices.cbegin(),
+                 indices.cend(),
+                 [&](std::size_t i)
+                 {
+                    if (tessellations[i] == nullptr)
+                    {
+                       tessellations[i] = Impl::Tessellate(*polygons[i]);
+                    }
+                 });
+
+   // Keep only the current polygons in the cache
+   p->tessellationCache_.clear();
+   for (std::size_t i = 0; i < polygons.size(); ++i)
+   {
+      p->tessellationCache_.emplace(hashes[i], tessellations[i]);
+   }
+
+   std::vector<GLfloat> buffer {};
+   std::vector<GLint>   integerBuffer {};
+
+   std::array<std::pair<GLint, GLsizei>, util::kLevelOfDetailCount>
+      levelRanges {};
+
+   // Concatenate the levels of detail, reusing the previous level where
+   // simplification did not remove any vertices
+   for (std::size_t level = 0; level < util::kLevelOfDetailCount; ++level)
+   {
+      const bool simplified =
+         std::any_of(tessellations.cbegin(),
+                     tessellations.cend(),
+                     [level](const auto& tessellation)
+                     { return tessellation->simplified_[level]; });
+
+      if (level > 0 && !simplified)
+      {
+         levelRanges[level] = levelRanges[level - 1];
+         continue;
+      }
+
+      const std::size_t first = buffer.size() / kPointsPerVertex;
+
+      for (std::size_t i = 0; i < polygons.size(); ++i)
+      {
+         const auto& di           = polygons[i];
+         const auto& tessellation = tessellations[i];
+
+         // Find the level of detail this level is the same as
+         std::size_t bufferLevel = level;
+         while (bufferLevel > 0 && !tessellation->simplified_[bufferLevel])
+         {
+            --bufferLevel;
+         }
+
+         const auto& levelBuffer = tessellation->buffers_[bufferLevel];
+         buffer.insert(buffer.end(), levelBuffer.cbegin(), levelBuffer.cend());
+
+         // Threshold
+         units::length::nautical_miles<double> threshold = di->threshold_;
+         const GLint                           thresholdValue =
+            static_cast<GLint>(std::round(threshold.value()));
+
+         // Start and end time
+         const GLint startTime =
+            static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
+                                  di->startTime_.time_since_epoch())
+                                  .count());
+         const GLint endTime =
+            static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
+                                  di->endTime_.time_since_epoch())
+                                  .count());
+
+         for (std::size_t v = 0; v < levelBuffer.size() / kPointsPerVertex;
+              ++v)
+         {
+            integerBuffer.insert(integerBuffer.end(),
+                                 {thresholdValue, startTime, endTime});
+         }
+      }
+
+      levelRanges[level] = {
+         static_cast<GLint>(first),
+         static_cast<GLsizei>(buffer.size() / kPointsPerVertex - first)};
+   }
+
    std::unique_lock lock {p->bufferMutex_};
 
    // Swap buffers
-   p->currentBuffer_.swap(p->newBuffer_);
-   p->currentIntegerBuffer_.swap(p->newIntegerBuffer_);
-
-   // Clear the new buffers
-   p->newBuffer_.clear();
-   p->newIntegerBuffer_.clear();
+   p->currentBuffer_.swap(buffer);
+   p->currentIntegerBuffer_.swap(integerBuffer);
+   p->currentLevelRanges_ = levelRanges;
 
    // Mark the draw item dirty
    p->dirty_ = true;
+
+   lock.unlock();
+
+   // Clear the new polygons
+   p->newPolygons_.clear();
 }
 
 void PlacefilePolygons::Impl::Update()
@@ -317,6 +454,17 @@ void PlacefilePolygons::Impl::Update()
 
       std::unique_lock lock {bufferMutex_};
 
+      // The previously buffered polygons are drawn until the upload is
+      // granted
+      if (!context_->upload_scheduler().Request(
+             this,
+             sizeof(GLfloat) * currentBuffer_.size() +
+                sizeof(GLint) * currentIntegerBuffer_.size(),
+             UploadPriority::Low))
+      {
+         return;
+      }
+
       // Buffer vertex data
       gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
       gl.glBufferData(GL_ARRAY_BUFFER,
@@ -333,39 +481,97 @@ void PlacefilePolygons::Impl::Update()
 
       numVertices_ =
          static_cast<GLsizei>(currentBuffer_.size() / kPointsPerVertex);
+      levelRanges_ = currentLevelRanges_;
+
+      viewportCuller_.Build(currentBuffer_, currentIntegerBuffer_);
+
+      bufferMemory_.set_bytes(
+         2 * (sizeof(GLfloat) * currentBuffer_.size() +
+              sizeof(GLint) * currentIntegerBuffer_.size()));
 
       dirty_ = false;
    }
 }
 
-void PlacefilePolygons::Impl::Tessellate(
-   const std::shared_ptr<gr::Placefile::PolygonDrawItem>& di)
+std::size_t PlacefilePolygons::Impl::GetContoursHash(
+   const gr::Placefile::PolygonDrawItem& di)
 {
-   // Vertex storage
-   boost::container::stable_vector<TessVertexArray> vertices {};
+   std::size_t seed = 0;
 
-   // Default color to "Color" statement
-   boost::gil::rgba8_pixel_t lastColor = di->color_;
+   boost::hash_combine(seed, di.color_[0]);
+   boost::hash_combine(seed, di.color_[1]);
+   boost::hash_combine(seed, di.color_[2]);
+   boost::hash_combine(seed, di.color_[3]);
+
+   for (auto& contour : di.contours_)
+   {
+      boost::hash_combine(seed, contour.size());
+
+      for (auto& element : contour)
+      {
+         boost::hash_combine(seed, element.latitude_);
+         boost::hash_combine(seed, element.longitude_);
+         boost::hash_combine(seed, element.x_);
+         boost::hash_combine(seed, element.y_);
+
+         if (element.color_.has_value())
+         {
+            boost::hash_combine(seed, (*element.color_)[0]);
+            boost::hash_combine(seed, (*element.color_)[1]);
+            boost::hash_combine(seed, (*element.color_)[2]);
+            boost::hash_combine(seed, (*element.color_)[3]);
+         }
+         else
+         {
+            boost::hash_combine(seed, -1);
+         }
+      }
+   }
 
-   // Current threshold
-   units::length::nautical_miles<double> threshold = di->threshold_;
-   currentThreshold_ = static_cast<GLint>(std::round(threshold.value()));
+   return seed;
+}
 
-   // Start and end time
-   currentStartTime_ =
-      static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
-                            di->startTime_.time_since_epoch())
-                            .count());
-   currentEndTime_ =
-      static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
-                            di->endTime_.time_since_epoch())
-                            .count());
+std::shared_ptr<const Tessellation>
+PlacefilePolygons::Impl::Tessellate(const gr::Placefile::PolygonDrawItem& di)
+{
+   auto              tessellation = std::make_shared<Tessellation>();
+   TessellationState state {tessellation.get()};
+
+   // Each tessellation uses its own tessellator, allowing polygons to be
+   // tessellated in parallel
+   GLUtesselator* tessellator = gluNewTess();
+
+   gluTessCallback(tessellator, //
+                   GLU_TESS_COMBINE_DATA,
+                   (_GLUfuncptr) &TessellateCombineCallback);
+   gluTessCallback(tessellator, //
+                   GLU_TESS_VERTEX_DATA,
+                   (_GLUfuncptr) &TessellateVertexCallback);
+
+   // Force GLU_TRIANGLES
+   gluTessCallback(tessellator, //
+                   GLU_TESS_EDGE_FLAG,
+                   []() {});
+
+   gluTessCallback(tessellator, //
+                   GLU_TESS_ERROR,
+                   (_GLUfuncptr) &TessellateErrorCallback);
+
+   // Vertex storage and screen coordinates, by contour
+   std::vector<std::vector<TessVertexArray>> vertices {};
+   std::vector<std::vector<glm::vec2>>       screenCoordinates {};
+   std::vector<bool>                         simplify {};
 
-   gluTessBeginPolygon(tessellator_, this);
+   // Default color to "Color" statement
+   boost::gil::rgba8_pixel_t lastColor = di.color_;
 
-   for (auto& contour : di->contours_)
+   for (auto& contour : di.contours_)
    {
-      gluTessBeginContour(tessellator_);
+      auto& contourVertices          = vertices.emplace_back();
+      auto& contourScreenCoordinates = screenCoordinates.emplace_back();
+
+      // Vertices with pixel offsets are not simplified
+      bool hasOffset = false;
 
       for (auto& element : contour)
       {
@@ -380,35 +586,93 @@ void PlacefilePolygons::Impl::Tessellate(
          }
 
          // Add vertex to temporary storage
-         auto& vertex =
-            vertices.emplace_back(TessVertexArray {screenCoordinate.x,
-                                                   screenCoordinate.y,
-                                                   0.0, // z
-                                                   element.x_,
-                                                   element.y_,
-                                                   lastColor[0] / 255.0,
-                                                   lastColor[1] / 255.0,
-                                                   lastColor[2] / 255.0,
-                                                   lastColor[3] / 255.0});
-
-         // Tessellate vertex
-         gluTessVertex(tessellator_, vertex.data(), vertex.data());
+         contourVertices.emplace_back(TessVertexArray {screenCoordinate.x,
+                                                       screenCoordinate.y,
+                                                       0.0, // z
+                                                       element.x_,
+                                                       element.y_,
+                                                       lastColor[0] / 255.0,
+                                                       lastColor[1] / 255.0,
+                                                       lastColor[2] / 255.0,
+                                                       lastColor[3] / 255.0});
+         contourScreenCoordinates.push_back(screenCoordinate);
+
+         hasOffset = hasOffset || element.x_ != 0.0 || element.y_ != 0.0;
       }
 
-      gluTessEndContour(tessellator_);
+      simplify.push_back(!hasOffset);
    }
 
-   gluTessEndPolygon(tessellator_);
-
-   // Clear temporary storage
-   tessCombineBuffer_.clear();
+   std::vector<std::vector<std::size_t>> previousIndices(vertices.size());
 
-   // Remove extra vertices that don't correspond to a full triangle
-   while (newBuffer_.size() % kVerticesPerTriangle != 0)
+   for (std::size_t level = 0; level < util::kLevelOfDetailCount; ++level)
    {
-      newBuffer_.pop_back();
-      newIntegerBuffer_.pop_back();
+      auto& buffer = tessellation->buffers_[level];
+
+      std::vector<std::vector<std::size_t>> indices(vertices.size());
+      bool                                  simplified = false;
+
+      for (std::size_t i = 0; i < vertices.size(); ++i)
+      {
+         const float tolerance =
+            simplify[i] ? util::GetLevelOfDetailTolerance(level) : 0.0f;
+
+         indices[i] = util::SimplifyLine(screenCoordinates[i], tolerance);
+
+         // Keep contours which would no longer enclose an area
+         if (indices[i].size() < 3)
+         {
+            indices[i] = util::SimplifyLine(screenCoordinates[i], 0.0f);
+         }
+
+         if (level > 0 && indices[i] != previousIndices[i])
+         {
+            simplified = true;
+         }
+      }
+
+      // Reuse the previous level of detail if no vertices were removed
+      if (level > 0 && !simplified)
+      {
+         continue;
+      }
+
+      tessellation->simplified_[level] = simplified;
+      state.level_                     = level;
+
+      gluTessBeginPolygon(tessellator, &state);
+
+      for (std::size_t i = 0; i < vertices.size(); ++i)
+      {
+         gluTessBeginContour(tessellator);
+
+         // Tessellate vertices
+         for (std::size_t index : indices[i])
+         {
+            auto& vertex = vertices[i][index];
+            gluTessVertex(tessellator, vertex.data(), vertex.data());
+         }
+
+         gluTessEndContour(tessellator);
+      }
+
+      gluTessEndPolygon(tessellator);
+
+      // Clear temporary storage
+      state.combineBuffer_.clear();
+
+      // Remove extra vertices that don't correspond to a full triangle
+      while (buffer.size() % (kVerticesPerTriangle * kPointsPerVertex) != 0)
+      {
+         buffer.pop_back();
+      }
+
+      previousIndices = std::move(indices);
    }
+
+   gluDeleteTess(tessellator);
+
+   return tessellation;
 }
 
 void PlacefilePolygons::Impl::TessellateCombineCallback(GLdouble coords[3],
@@ -420,10 +684,10 @@ void PlacefilePolygons::Impl::TessellateCombineCallback(GLdouble coords[3],
    static constexpr std::size_t r = kTessVertexR_;
    static constexpr std::size_t a = kTessVertexA_;
 
-   Impl* self = static_cast<Impl*>(polygonData);
+   auto* state = static_cast<TessellationState*>(polygonData);
 
    // Create new vertex data with given coordinates and interpolated color
-   auto& newVertexData = self->tessCombineBuffer_.emplace_back( //
+   auto& newVertexData = state->combineBuffer_.emplace_back( //
       TessVertexArray {
          coords[0],
          coords[1],
@@ -455,23 +719,21 @@ void PlacefilePolygons::Impl::TessellateCombineCallback(GLdouble coords[3],
 void PlacefilePolygons::Impl::TessellateVertexCallback(void* vertexData,
                                                        void* polygonData)
 {
-   Impl*     self = static_cast<Impl*>(polygonData);
-   GLdouble* data = static_cast<GLdouble*>(vertexData);
+   auto*     state = static_cast<TessellationState*>(polygonData);
+   GLdouble* data  = static_cast<GLdouble*>(vertexData);
+
+   auto& buffer = state->tessellation_->buffers_[state->level_];
 
    // Buffer vertex
-   self->newBuffer_.insert(self->newBuffer_.end(),
-                           {static_cast<float>(data[kTessVertexScreenX_]),
-                            static_cast<float>(data[kTessVertexScreenY_]),
-                            static_cast<float>(data[kTessVertexXOffset_]),
-                            static_cast<float>(data[kTessVertexYOffset_]),
-                            static_cast<float>(data[kTessVertexR_]),
-                            static_cast<float>(data[kTessVertexG_]),
-                            static_cast<float>(data[kTessVertexB_]),
-                            static_cast<float>(data[kTessVertexA_])});
-   self->newIntegerBuffer_.insert(self->newIntegerBuffer_.end(),
-                                  {self->currentThreshold_,
-                                   self->currentStartTime_,
-                                   self->currentEndTime_});
+   buffer.insert(buffer.end(),
+                 {static_cast<float>(data[kTessVertexScreenX_]),
+                  static_cast<float>(data[kTessVertexScreenY_]),
+                  static_cast<float>(data[kTessVertexXOffset_]),
+                  static_cast<float>(data[kTessVertexYOffset_]),
+                  static_cast<float>(data[kTessVertexR_]),
+                  static_cast<float>(data[kTessVertexG_]),
+                  static_cast<float>(data[kTessVertexB_]),
+                  static_cast<float>(data[kTessVertexA_])});
 }
 
 void PlacefilePolygons::Impl::TessellateErrorCallback(GLenum errorCode)
@@ -35,8 +35,11 @@ public:
 
    void RenderTextDrawItem(
       const QMapLibre::CustomLayerRenderParameters&             params,
+      ImDrawList*                                               drawList,
       const std::shared_ptr<const gr::Placefile::TextDrawItem>& di);
    void RenderText(const QMapLibre::CustomLayerRenderParameters& params,
+                   ImDrawList*                                   drawList,
+                   ImFont*                                       font,
                    const std::string&                            text,
                    const std::string&                            hoverText,
                    boost::gil::rgba8_pixel_t                     color,
@@ -51,7 +54,6 @@ public:
 
    std::chrono::system_clock::time_point selectedTime_ {};
 
-   std::uint32_t textId_ {};
    glm::vec2     mapScreenCoordLocation_ {};
    float         mapScale_ {1.0f};
    float         mapBearingCos_ {1.0f};
@@ -104,8 +106,7 @@ void PlacefileText::Render(const QMapLibre::CustomLayerRenderParameters& params)
 
    if (!p->textList_.empty())
    {
-      // Reset text ID per frame
-      p->textId_ = 0;
+      // Reset hover text per frame
       p->hoverText_.clear();
 
       // Update map screen coordinate and scale information
@@ -119,15 +120,41 @@ void PlacefileText::Render(const QMapLibre::CustomLayerRenderParameters& params)
       p->halfHeight_    = params.height * 0.5f;
       p->mapDistance_   = util::maplibre::GetMapDistance(params);
 
+      // Batch all text into the draw list of a single window covering the
+      // map, such that it is drawn from the shared font atlas in one pass,
+      // instead of creating a window per text item
+      const std::string windowName {
+         fmt::format("PlacefileText-{}", p->placefileName_)};
+
+      ImGui::SetNextWindowPos(ImVec2 {0.0f, 0.0f});
+      ImGui::SetNextWindowSize(ImVec2 {static_cast<float>(params.width),
+                                       static_cast<float>(params.height)});
+      ImGui::Begin(windowName.c_str(),
+                   nullptr,
+                   ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoNav |
+                      ImGuiWindowFlags_NoBackground |
+                      ImGuiWindowFlags_NoInputs |
+                      ImGuiWindowFlags_NoSavedSettings |
+                      ImGuiWindowFlags_NoFocusOnAppearing |
+                      ImGuiWindowFlags_NoBringToFrontOnFocus);
+
+      ImDrawList* drawList = ImGui::GetWindowDrawList();
+      drawList->PushClipRectFullScreen();
+
       for (auto& di : p->textList_)
       {
-         p->RenderTextDrawItem(params, di);
+         p->RenderTextDrawItem(params, drawList, di);
       }
+
+      drawList->PopClipRect();
+
+      ImGui::End();
    }
 }
 
 void PlacefileText::Impl::RenderTextDrawItem(
    const QMapLibre::CustomLayerRenderParameters&             params,
+   ImDrawList*                                               drawList,
    const std::shared_ptr<const gr::Placefile::TextDrawItem>& di)
 {
    // If no time has been selected, use the current time
@@ -163,8 +190,8 @@ void PlacefileText::Impl::RenderTextDrawItem(
       // Clamp font number to 0-8
       std::size_t fontNumber = std::clamp<std::size_t>(di->fontNumber_, 0, 8);
 
-      // Set the font for the drop shadow and text
-      ImGui::PushFont(fonts_[fontNumber]->font());
+      // Font for the drop shadow and text
+      ImFont* font = fonts_[fontNumber]->font();
 
       if (settings::TextSettings::Instance()
              .placefile_text_drop_shadow_enabled()
@@ -173,6 +200,8 @@ void PlacefileText::Impl::RenderTextDrawItem(
          // Draw a drop shadow 1 pixel to the lower right, in black, with the
          // original transparency level
          RenderText(params,
+                    drawList,
+                    font,
                     di->text_,
                     {},
                     boost::gil::rgba8_pixel_t {0, 0, 0, di->color_[3]},
@@ -182,54 +211,52 @@ void PlacefileText::Impl::RenderTextDrawItem(
 
       // Draw the text
       RenderText(params,
+                 drawList,
+                 font,
                  di->text_,
                  di->hoverText_,
                  di->color_,
                  rotatedX + di->x_ + halfWidth_,
                  rotatedY + di->y_ + halfHeight_);
-
-      // Reset the font
-      ImGui::PopFont();
    }
 }
 
 void PlacefileText::Impl::RenderText(
    const QMapLibre::CustomLayerRenderParameters& params,
+   ImDrawList*                                   drawList,
+   ImFont*                                       font,
    const std::string&                            text,
    const std::string&                            hoverText,
    boost::gil::rgba8_pixel_t                     color,
    float                                         x,
    float                                         y)
 {
-   const std::string windowName {
-      fmt::format("PlacefileText-{}-{}", placefileName_, ++textId_)};
+   const char* textBegin = text.c_str();
+   const char* textEnd   = textBegin + text.size();
 
    // Convert screen to ImGui coordinates
    y = params.height - y;
 
-   // Setup "window" to hold text
-   ImGui::SetNextWindowPos(
-      ImVec2 {x, y}, ImGuiCond_Always, ImVec2 {0.5f, 0.5f});
-   ImGui::Begin(windowName.c_str(),
-                nullptr,
-                ImGuiWindowFlags_AlwaysAutoResize |
-                   ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoNav |
-                   ImGuiWindowFlags_NoBackground);
+   // Center the text on the position
+   const ImVec2 textSize =
+      font->CalcTextSizeA(font->FontSize, FLT_MAX, 0.0f, textBegin, textEnd);
+   const ImVec2 textMin {x - textSize.x * 0.5f, y - textSize.y * 0.5f};
+   const ImVec2 textMax {textMin.x + textSize.x, textMin.y + textSize.y};
 
    // Render text
-   ImGui::PushStyleColor(ImGuiCol_Text,
-                         IM_COL32(color[0], color[1], color[2], color[3]));
-   ImGui::TextUnformatted(text.c_str());
-   ImGui::PopStyleColor();
+   drawList->AddText(font,
+                     font->FontSize,
+                     textMin,
+                     IM_COL32(color[0], color[1], color[2], color[3]),
+                     textBegin,
+                     textEnd);
 
    // Store hover text for mouse picking pass
-   if (!hoverText.empty() && ImGui::IsItemHovered())
+   if (!hoverText.empty() &&
+       ImGui::IsMouseHoveringRect(textMin, textMax, false))
    {
       hoverText_ = hoverText;
    }
-
-   // End window
-   ImGui::End();
 }
 
 void PlacefileText::Deinitialize()
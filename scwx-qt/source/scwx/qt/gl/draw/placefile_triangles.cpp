@@ -1,6 +1,9 @@
 #include <scwx/qt/gl/draw/placefile_triangles.hpp>
+#include <scwx/qt/gl/viewport_culler.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/memory.hpp>
 
 #include <mutex>
 
@@ -56,6 +59,9 @@ public:
 
    std::vector<GLfloat> currentBuffer_ {};
    std::vector<GLint>   currentIntegerBuffer_ {};
+
+   // Current buffers, and their copies in GPU memory
+   scwx::util::MemoryCounter bufferMemory_ {"Placefile Draw Items"};
    std::vector<GLfloat> newBuffer_ {};
    std::vector<GLint>   newIntegerBuffer_ {};
 
@@ -69,6 +75,10 @@ public:
    GLuint                vao_;
    std::array<GLuint, 2> vbo_;
 
+   ViewportCuller viewportCuller_ {kPointsPerVertex,
+                                  kVerticesPerTriangle,
+                                  ViewportCuller::Coordinates::MapScreen};
+
    GLsizei numVertices_;
 };
 
@@ -100,7 +110,6 @@ void PlacefileTriangles::Initialize()
 
    p->shaderProgram_ = p->context_->GetShaderProgram(
       {{GL_VERTEX_SHADER, ":/gl/map_color.vert"},
-       {GL_GEOMETRY_SHADER, ":/gl/threshold.geom"},
        {GL_FRAGMENT_SHADER, ":/gl/color.frag"}});
 
    p->uMVPMatrixLocation_ = p->shaderProgram_->GetUniformLocation("uMVPMatrix");
@@ -175,7 +184,7 @@ void PlacefileTriangles::Render(
    {
       gl::OpenGLFunctions& gl = p->context_->gl();
 
-      gl.glBindVertexArray(p->vao_);
+      p->context_->state_cache().BindVertexArray(p->vao_);
 
       p->Update();
       p->shaderProgram_->Use();
@@ -183,32 +192,38 @@ void PlacefileTriangles::Render(
       UseMapProjection(
          params, p->uMapMatrixLocation_, p->uMapScreenCoordLocation_);
 
-      if (p->thresholded_)
-      {
-         // If thresholding is enabled, set the map distance
-         units::length::nautical_miles<float> mapDistance =
-            util::maplibre::GetMapDistance(params);
-         gl.glUniform1f(p->uMapDistanceLocation_, mapDistance.value());
-      }
-      else
-      {
-         // If thresholding is disabled, set the map distance to 0
-         gl.glUniform1f(p->uMapDistanceLocation_, 0.0f);
-      }
+      // If thresholding is disabled, set the map distance to 0
+      const units::length::nautical_miles<float> mapDistance =
+         (p->thresholded_) ? util::maplibre::GetMapDistance(params) :
+                             units::length::meters<double> {0.0};
+      gl.glUniform1f(p->uMapDistanceLocation_, mapDistance.value());
 
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
             std::chrono::system_clock::now() :
             p->selectedTime_;
-      gl.glUniform1i(
-         p->uSelectedTimeLocation_,
+      const GLint selectedMinutes =
          static_cast<GLint>(std::chrono::duration_cast<std::chrono::minutes>(
                                selectedTime.time_since_epoch())
-                               .count()));
+                               .count());
+      gl.glUniform1i(p->uSelectedTimeLocation_, selectedMinutes);
+
+      // Hidden primitives may also be filtered on the CPU, so their vertices
+      // are not drawn at all
+      if (settings::GeneralSettings::Instance()
+             .cpu_primitive_filtering()
+             .GetValue())
+      {
+         p->viewportCuller_.SetFilter(mapDistance.value(), selectedMinutes);
+      }
+      else
+      {
+         p->viewportCuller_.ClearFilter();
+      }
 
-      // Draw icons
-      gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+      // Draw triangles within the viewport
+      p->viewportCuller_.Draw(gl, params, p->numVertices_);
    }
 }
 
@@ -224,6 +239,7 @@ void PlacefileTriangles::Deinitialize()
    // Clear the current buffers
    p->currentBuffer_.clear();
    p->currentIntegerBuffer_.clear();
+   p->bufferMemory_.set_bytes(0);
 }
 
 void PlacefileTriangles::StartTriangles()
@@ -324,6 +340,17 @@ void PlacefileTriangles::Impl::Update()
 
       std::unique_lock lock {bufferMutex_};
 
+      // The previously buffered triangles are drawn until the upload is
+      // granted
+      if (!context_->upload_scheduler().Request(
+             this,
+             sizeof(GLfloat) * currentBuffer_.size() +
+                sizeof(GLint) * currentIntegerBuffer_.size(),
+             UploadPriority::Low))
+      {
+         return;
+      }
+
       // Buffer vertex data
       gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
       gl.glBufferData(GL_ARRAY_BUFFER,
@@ -341,6 +368,12 @@ void PlacefileTriangles::Impl::Update()
       numVertices_ =
          static_cast<GLsizei>(currentBuffer_.size() / kPointsPerVertex);
 
+      viewportCuller_.Build(currentBuffer_, currentIntegerBuffer_);
+
+      bufferMemory_.set_bytes(
+         2 * (sizeof(GLfloat) * currentBuffer_.size() +
+              sizeof(GLint) * currentIntegerBuffer_.size()));
+
       dirty_ = false;
    }
 }
@@ -0,0 +1,114 @@
+#include <scwx/qt/gl/dynamic_buffer.hpp>
+#include <scwx/util/memory.hpp>
+#include <scwx/util/profiler.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+static std::atomic<std::uint64_t> uploadedBytes_ {0u};
+
+class DynamicBuffer::Impl
+{
+public:
+   explicit Impl(std::size_t recordSize) : recordSize_ {recordSize} {}
+   ~Impl() = default;
+
+   const std::size_t recordSize_;
+
+   bool        invalidated_ {true};
+   std::size_t bufferedSize_ {0};
+
+   // Range of records modified since the last upload
+   std::size_t modifiedBegin_ {0};
+   std::size_t modifiedEnd_ {0};
+
+   scwx::util::MemoryCounter bufferMemory_ {"GL Draw Buffers"};
+};
+
+DynamicBuffer::DynamicBuffer(std::size_t recordSize) :
+    p(std::make_unique<Impl>(recordSize))
+{
+}
+DynamicBuffer::~DynamicBuffer() = default;
+
+DynamicBuffer::DynamicBuffer(DynamicBuffer&&) noexcept            = default;
+DynamicBuffer& DynamicBuffer::operator=(DynamicBuffer&&) noexcept = default;
+
+void DynamicBuffer::Invalidate()
+{
+   p->invalidated_ = true;
+}
+
+void DynamicBuffer::Modify(std::size_t record)
+{
+   if (p->modifiedBegin_ == p->modifiedEnd_)
+   {
+      p->modifiedBegin_ = record;
+      p->modifiedEnd_   = record + 1;
+   }
+   else
+   {
+      p->modifiedBegin_ = std::min(p->modifiedBegin_, record);
+      p->modifiedEnd_   = std::max(p->modifiedEnd_, record + 1);
+   }
+}
+
+void DynamicBuffer::Upload(OpenGLFunctions& gl,
+                           GLuint           buffer,
+                           const void*      data,
+                           std::size_t      size)
+{
+   scwx::util::ScopedTimer timer {scwx::util::ProfileStage::GlUpload};
+
+   if (p->invalidated_ || p->bufferedSize_ != size)
+   {
+      // Reallocate the buffer
+      gl.glBindBuffer(GL_ARRAY_BUFFER, buffer);
+      gl.glBufferData(GL_ARRAY_BUFFER,
+                      static_cast<GLsizeiptr>(size),
+                      data,
+                      GL_DYNAMIC_DRAW);
+
+      p->bufferedSize_ = size;
+      p->bufferMemory_.set_bytes(size);
+      uploadedBytes_.fetch_add(size, std::memory_order_relaxed);
+   }
+   else if (p->modifiedBegin_ != p->modifiedEnd_)
+   {
+      // Buffer only the range of modified records
+      const std::size_t offset =
+         std::min(p->modifiedBegin_ * p->recordSize_, size);
+      const std::size_t end = std::min(p->modifiedEnd_ * p->recordSize_, size);
+
+      if (offset < end)
+      {
+         gl.glBindBuffer(GL_ARRAY_BUFFER, buffer);
+         gl.glBufferSubData(GL_ARRAY_BUFFER,
+                            static_cast<GLintptr>(offset),
+                            static_cast<GLsizeiptr>(end - offset),
+                            static_cast<const char*>(data) + offset);
+
+         uploadedBytes_.fetch_add(end - offset, std::memory_order_relaxed);
+      }
+   }
+
+   p->invalidated_   = false;
+   p->modifiedBegin_ = 0;
+   p->modifiedEnd_   = 0;
+}
+
+std::uint64_t DynamicBuffer::uploaded_bytes()
+{
+   return uploadedBytes_.load(std::memory_order_relaxed);
+}
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
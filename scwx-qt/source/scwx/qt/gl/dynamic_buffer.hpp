@@ -0,0 +1,84 @@
+#pragma once
+
+#include <scwx/qt/gl/gl.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+/**
+ * @brief Tracks the records modified in an array buffer, such that only the
+ * modified range is uploaded instead of reallocating the entire buffer.
+ */
+class DynamicBuffer
+{
+public:
+   /**
+    * @param recordSize Size in bytes of each record (e.g., one line or icon)
+    */
+   explicit DynamicBuffer(std::size_t recordSize);
+   ~DynamicBuffer();
+
+   DynamicBuffer(const DynamicBuffer&)            = delete;
+   DynamicBuffer& operator=(const DynamicBuffer&) = delete;
+
+   DynamicBuffer(DynamicBuffer&&) noexcept;
+   DynamicBuffer& operator=(DynamicBuffer&&) noexcept;
+
+   /**
+    * Marks the entire buffer as modified. The next upload reallocates the
+    * buffer.
+    */
+   void Invalidate();
+
+   /**
+    * Marks a single record as modified.
+    *
+    * @param [in] record Index of the record
+    */
+   void Modify(std::size_t record);
+
+   /**
+    * Uploads the modified records to the buffer. The buffer is reallocated if
+    * it has been invalidated, or if its size has changed.
+    *
+    * @param [in] gl OpenGL functions
+    * @param [in] buffer Array buffer
+    * @param [in] data Buffer contents
+    * @param [in] size Size of the buffer contents in bytes
+    */
+   void Upload(OpenGLFunctions& gl,
+               GLuint           buffer,
+               const void*      data,
+               std::size_t      size);
+
+   template<typename T>
+   void Upload(OpenGLFunctions& gl, GLuint buffer, const std::vector<T>& data)
+   {
+      Upload(gl, buffer, data.data(), data.size() * sizeof(T));
+   }
+
+   /**
+    * Gets the total number of bytes uploaded by all dynamic buffers. Used to
+    * measure the upload cost of draw items.
+    *
+    * @return Uploaded bytes
+    */
+   static std::uint64_t uploaded_bytes();
+
+private:
+   class Impl;
+
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,207 @@
+#include <scwx/qt/gl/frame_readback.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+static const std::string logPrefix_ = "scwx::qt::gl::frame_readback";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Wait up to 1 second for a read to complete when it is required
+static constexpr GLuint64 kReadTimeoutNs_ = 1'000'000'000u;
+
+class FrameReadback::Impl
+{
+public:
+   struct Buffer
+   {
+      GLuint        pbo_ {0u};
+      GLsync        fence_ {nullptr};
+      std::size_t   size_ {0u};
+      int           width_ {0};
+      int           height_ {0};
+      std::uint64_t tag_ {0u};
+   };
+
+   explicit Impl(std::size_t bufferCount) : buffers_(bufferCount) {}
+   ~Impl() = default;
+
+   bool Complete(OpenGLFunctions&     gl,
+                 Buffer&              buffer,
+                 bool                 wait,
+                 const FrameCallback& callback);
+   void CompletePending(OpenGLFunctions&     gl,
+                        bool                 wait,
+                        const FrameCallback& callback);
+
+   std::vector<Buffer>     buffers_;
+   std::deque<std::size_t> pending_ {};
+   std::size_t             next_ {0u};
+};
+
+FrameReadback::FrameReadback(std::size_t bufferCount) :
+    p(std::make_unique<Impl>(std::max<std::size_t>(bufferCount, 1u)))
+{
+}
+FrameReadback::~FrameReadback() = default;
+
+FrameReadback::FrameReadback(FrameReadback&&) noexcept            = default;
+FrameReadback& FrameReadback::operator=(FrameReadback&&) noexcept = default;
+
+void FrameReadback::Read(OpenGLFunctions&     gl,
+                         GLuint               framebuffer,
+                         int                  width,
+                         int                  height,
+                         std::uint64_t        tag,
+                         const FrameCallback& callback)
+{
+   if (width <= 0 || height <= 0)
+   {
+      return;
+   }
+
+   if (p->pending_.size() == p->buffers_.size())
+   {
+      // Every buffer is being read, so the oldest read must complete first
+      p->Complete(gl, p->buffers_[p->pending_.front()], true, callback);
+      p->pending_.pop_front();
+   }
+
+   const std::size_t index  = p->next_;
+   Impl::Buffer&     buffer = p->buffers_[index];
+   p->next_                 = (p->next_ + 1) % p->buffers_.size();
+
+   const std::size_t size = static_cast<std::size_t>(width) * height * 4u;
+
+   if (buffer.pbo_ == 0u)
+   {
+      gl.glGenBuffers(1, &buffer.pbo_);
+   }
+
+   gl.glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.pbo_);
+   if (buffer.size_ != size)
+   {
+      gl.glBufferData(GL_PIXEL_PACK_BUFFER,
+                      static_cast<GLsizeiptr>(size),
+                      nullptr,
+                      GL_STREAM_READ);
+      buffer.size_ = size;
+   }
+
+   // The copy into the buffer is queued, and does not wait on rendering
+   gl.glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+   gl.glPixelStorei(GL_PACK_ALIGNMENT, 4);
+   gl.glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+   gl.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0u);
+
+   buffer.fence_  = gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0u);
+   buffer.width_  = width;
+   buffer.height_ = height;
+   buffer.tag_    = tag;
+
+   p->pending_.push_back(index);
+
+   SCWX_GL_CHECK_ERROR();
+}
+
+void FrameReadback::Poll(OpenGLFunctions& gl, const FrameCallback& callback)
+{
+   p->CompletePending(gl, false, callback);
+}
+
+void FrameReadback::Finish(OpenGLFunctions& gl, const FrameCallback& callback)
+{
+   p->CompletePending(gl, true, callback);
+}
+
+void FrameReadback::Destroy(OpenGLFunctions& gl)
+{
+   for (auto& buffer : p->buffers_)
+   {
+      if (buffer.fence_ != nullptr)
+      {
+         gl.glDeleteSync(buffer.fence_);
+      }
+      if (buffer.pbo_ != 0u)
+      {
+         gl.glDeleteBuffers(1, &buffer.pbo_);
+      }
+
+      buffer = {};
+   }
+
+   p->pending_.clear();
+   p->next_ = 0u;
+}
+
+void FrameReadback::Impl::CompletePending(OpenGLFunctions&     gl,
+                                          bool                 wait,
+                                          const FrameCallback& callback)
+{
+   // Reads complete in order, so stop at the first read still in progress
+   while (!pending_.empty() &&
+          Complete(gl, buffers_[pending_.front()], wait, callback))
+   {
+      pending_.pop_front();
+   }
+}
+
+bool FrameReadback::Impl::Complete(OpenGLFunctions&     gl,
+                                   Buffer&              buffer,
+                                   bool                 wait,
+                                   const FrameCallback& callback)
+{
+   const GLenum status =
+      gl.glClientWaitSync(buffer.fence_,
+                          wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0u,
+                          wait ? kReadTimeoutNs_ : 0u);
+
+   if (status == GL_TIMEOUT_EXPIRED && !wait)
+   {
+      return false;
+   }
+
+   gl.glDeleteSync(buffer.fence_);
+   buffer.fence_ = nullptr;
+
+   if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+   {
+      logger_->warn("Frame read did not complete: {}", buffer.tag_);
+      return true;
+   }
+
+   QImage image {buffer.width_, buffer.height_, QImage::Format_RGBA8888};
+
+   gl.glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.pbo_);
+   const void* data = gl.glMapBufferRange(GL_PIXEL_PACK_BUFFER,
+                                          0,
+                                          static_cast<GLsizeiptr>(buffer.size_),
+                                          GL_MAP_READ_BIT);
+   if (data != nullptr)
+   {
+      // Rows of 4-byte pixels are not padded
+      std::memcpy(image.bits(), data, buffer.size_);
+      gl.glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+   }
+   gl.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0u);
+
+   if (data != nullptr && callback != nullptr)
+   {
+      callback(std::move(image), buffer.tag_);
+   }
+
+   return true;
+}
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <scwx/qt/gl/gl.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include <QImage>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+/**
+ * @brief Reads frames back from a framebuffer without stalling rendering.
+ * Pixels are copied into one of a ring of pixel buffer objects, and the
+ * buffer is mapped by a later frame once the copy has completed, rather than
+ * waiting on the GPU to finish rendering the frame being read.
+ */
+class FrameReadback
+{
+public:
+   /**
+    * @brief Receives a frame that has been read back. Rows are ordered from
+    * bottom to top, as read from OpenGL.
+    */
+   typedef std::function<void(QImage image, std::uint64_t tag)> FrameCallback;
+
+   /**
+    * @param [in] bufferCount Number of frames that may be read concurrently
+    */
+   explicit FrameReadback(std::size_t bufferCount = 3);
+   ~FrameReadback();
+
+   FrameReadback(const FrameReadback&)            = delete;
+   FrameReadback& operator=(const FrameReadback&) = delete;
+
+   FrameReadback(FrameReadback&&) noexcept;
+   FrameReadback& operator=(FrameReadback&&) noexcept;
+
+   /**
+    * Starts reading a frame from a framebuffer. If every buffer is still
+    * being read, the oldest read is completed first.
+    *
+    * @param [in] gl OpenGL functions
+    * @param [in] framebuffer Framebuffer to read
+    * @param [in] width Width of the frame in pixels
+    * @param [in] height Height of the frame in pixels
+    * @param [in] tag Identifies the frame to the frame callback
+    * @param [in] callback Receives the oldest frame, if it is completed
+    */
+   void Read(OpenGLFunctions&     gl,
+             GLuint               framebuffer,
+             int                  width,
+             int                  height,
+             std::uint64_t        tag,
+             const FrameCallback& callback);
+
+   /**
+    * Completes the reads that have finished, without waiting on the GPU.
+    *
+    * @param [in] gl OpenGL functions
+    * @param [in] callback Receives each completed frame, in read order
+    */
+   void Poll(OpenGLFunctions& gl, const FrameCallback& callback);
+
+   /**
+    * Completes every read, waiting on the GPU as required.
+    *
+    * @param [in] gl OpenGL functions
+    * @param [in] callback Receives each completed frame, in read order
+    */
+   void Finish(OpenGLFunctions& gl, const FrameCallback& callback);
+
+   /**
+    * Destroys the buffers. Reads in progress are discarded.
+    *
+    * @param [in] gl OpenGL functions
+    */
+   void Destroy(OpenGLFunctions& gl);
+
+private:
+   class Impl;
+
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
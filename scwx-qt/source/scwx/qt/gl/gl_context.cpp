@@ -13,15 +13,30 @@ namespace gl
 
 static const std::string logPrefix_ = "scwx::qt::gl::gl_context";
 
+/**
+ * All contexts belong to the same share group (Qt::AA_ShareOpenGLContexts), so
+ * textures are uploaded once and used by every context. Shader programs are not
+ * shared, as uniform values are program state, and layers in different panes
+ * set different values. Each context links its own program, and contexts after
+ * the first load the program binary cached by the first.
+ */
+struct SharedResources
+{
+   GLuint        textureAtlas_ {GL_INVALID_INDEX};
+   std::uint64_t textureBufferCount_ {};
+   std::mutex    textureMutex_ {};
+};
+
+static SharedResources sharedResources_ {};
+
 class GlContext::Impl
 {
 public:
    explicit Impl() :
        gl_ {},
+       stateCache_ {gl_},
        shaderProgramMap_ {},
-       shaderProgramMutex_ {},
-       textureAtlas_ {GL_INVALID_INDEX},
-       textureMutex_ {}
+       shaderProgramMutex_ {}
    {
    }
    ~Impl() {}
@@ -33,17 +48,14 @@ public:
 
    gl::OpenGLFunctions  gl_;
    QOpenGLFunctions_3_0 gl30_;
+   StateCache           stateCache_;
+   UploadScheduler      uploadScheduler_ {};
 
    bool glInitialized_ {false};
 
    std::unordered_map<std::size_t, std::shared_ptr<gl::ShaderProgram>>
               shaderProgramMap_;
    std::mutex shaderProgramMutex_;
-
-   GLuint     textureAtlas_;
-   std::mutex textureMutex_;
-
-   std::uint64_t textureBufferCount_ {};
 };
 
 GlContext::GlContext() : p(std::make_unique<Impl>()) {}
@@ -62,9 +74,20 @@ QOpenGLFunctions_3_0& GlContext::gl30()
    return p->gl30_;
 }
 
+StateCache& GlContext::state_cache()
+{
+   return p->stateCache_;
+}
+
+UploadScheduler& GlContext::upload_scheduler()
+{
+   return p->uploadScheduler_;
+}
+
 std::uint64_t GlContext::texture_buffer_count() const
 {
-   return p->textureBufferCount_;
+   std::unique_lock lock(sharedResources_.textureMutex_);
+   return sharedResources_.textureBufferCount_;
 }
 
 void GlContext::Impl::InitializeGL()
@@ -77,7 +100,12 @@ void GlContext::Impl::InitializeGL()
    gl_.initializeOpenGLFunctions();
    gl30_.initializeOpenGLFunctions();
 
-   gl_.glGenTextures(1, &textureAtlas_);
+   std::unique_lock lock(sharedResources_.textureMutex_);
+
+   if (sharedResources_.textureAtlas_ == GL_INVALID_INDEX)
+   {
+      gl_.glGenTextures(1, &sharedResources_.textureAtlas_);
+   }
 
    glInitialized_ = true;
 }
@@ -102,7 +130,8 @@ std::shared_ptr<gl::ShaderProgram> GlContext::GetShaderProgram(
 
    if (it == p->shaderProgramMap_.end())
    {
-      shaderProgram = std::make_shared<gl::ShaderProgram>(p->gl_);
+      shaderProgram =
+         std::make_shared<gl::ShaderProgram>(p->gl_, p->stateCache_);
       shaderProgram->Load(shaders);
       p->shaderProgramMap_[key] = shaderProgram;
    }
@@ -118,17 +147,21 @@ GLuint GlContext::GetTextureAtlas()
 {
    p->InitializeGL();
 
-   std::unique_lock lock(p->textureMutex_);
+   std::unique_lock lock(sharedResources_.textureMutex_);
 
    auto& textureAtlas = util::TextureAtlas::Instance();
 
-   if (p->textureBufferCount_ != textureAtlas.BuildCount())
+   // The first context to render after the atlas is updated uploads it
+   const std::uint64_t buildCount = textureAtlas.BuildCount();
+   if (sharedResources_.textureBufferCount_ != buildCount)
    {
-      p->textureBufferCount_ = textureAtlas.BuildCount();
-      textureAtlas.BufferAtlas(p->gl_, p->textureAtlas_);
+      textureAtlas.BufferAtlas(p->gl_,
+                               sharedResources_.textureAtlas_,
+                               sharedResources_.textureBufferCount_);
+      sharedResources_.textureBufferCount_ = buildCount;
    }
 
-   return p->textureAtlas_;
+   return sharedResources_.textureAtlas_;
 }
 
 void GlContext::Initialize()
@@ -142,6 +175,8 @@ void GlContext::StartFrame()
 
    gl.glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
    gl.glClear(GL_COLOR_BUFFER_BIT);
+
+   p->uploadScheduler_.StartFrame();
 }
 
 std::size_t GlContext::Impl::GetShaderKey(
@@ -2,6 +2,8 @@
 
 #include <scwx/qt/gl/gl.hpp>
 #include <scwx/qt/gl/shader_program.hpp>
+#include <scwx/qt/gl/state_cache.hpp>
+#include <scwx/qt/gl/upload_scheduler.hpp>
 
 #include <QOpenGLFunctions_3_0>
 
@@ -26,6 +28,8 @@ public:
 
    gl::OpenGLFunctions&  gl();
    QOpenGLFunctions_3_0& gl30();
+   StateCache&           state_cache();
+   UploadScheduler&      upload_scheduler();
 
    std::uint64_t texture_buffer_count() const;
 
@@ -0,0 +1,217 @@
+#include <scwx/qt/gl/scaled_framebuffer.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+static const std::string logPrefix_ = "scwx::qt::gl::scaled_framebuffer";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+class ScaledFramebuffer::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   bool UpdateTexture(GlContext& context, GLsizei width, GLsizei height);
+
+   std::shared_ptr<ShaderProgram> shaderProgram_ {nullptr};
+   GLint uViewportLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+
+   GLuint framebuffer_ {GL_INVALID_INDEX};
+   GLuint texture_ {GL_INVALID_INDEX};
+   GLuint vao_ {GL_INVALID_INDEX};
+
+   GLsizei textureWidth_ {0};
+   GLsizei textureHeight_ {0};
+
+   GLint                previousFramebuffer_ {0};
+   std::array<GLint, 4> viewport_ {};
+};
+
+ScaledFramebuffer::ScaledFramebuffer() : p(std::make_unique<Impl>()) {}
+ScaledFramebuffer::~ScaledFramebuffer() = default;
+
+ScaledFramebuffer::ScaledFramebuffer(ScaledFramebuffer&&) noexcept = default;
+ScaledFramebuffer&
+ScaledFramebuffer::operator=(ScaledFramebuffer&&) noexcept = default;
+
+void ScaledFramebuffer::Initialize(GlContext& context)
+{
+   OpenGLFunctions& gl = context.gl();
+
+   p->shaderProgram_ =
+      context.GetShaderProgram(":/gl/upscale.vert", ":/gl/upscale.frag");
+
+   p->uViewportLocation_ = p->shaderProgram_->GetUniformLocation("uViewport");
+
+   p->shaderProgram_->Use();
+   gl.glUniform1i(p->shaderProgram_->GetUniformLocation("uTexture"), 0);
+
+   // The full screen triangle is generated from the vertex ID, but a vertex
+   // array object must still be bound to draw
+   gl.glGenVertexArrays(1, &p->vao_);
+
+   gl.glGenFramebuffers(1, &p->framebuffer_);
+   gl.glGenTextures(1, &p->texture_);
+
+   p->textureWidth_  = 0;
+   p->textureHeight_ = 0;
+
+   SCWX_GL_CHECK_ERROR();
+}
+
+bool ScaledFramebuffer::Begin(GlContext& context, float scale)
+{
+   static constexpr float kMinScale_ = 0.25f;
+
+   if (scale >= 1.0f || p->framebuffer_ == GL_INVALID_INDEX)
+   {
+      return false;
+   }
+
+   OpenGLFunctions& gl = context.gl();
+
+   gl.glGetIntegerv(GL_VIEWPORT, p->viewport_.data());
+
+   scale = std::max(scale, kMinScale_);
+
+   const GLsizei width = std::max<GLsizei>(
+      static_cast<GLsizei>(std::lround(p->viewport_[2] * scale)), 1);
+   const GLsizei height = std::max<GLsizei>(
+      static_cast<GLsizei>(std::lround(p->viewport_[3] * scale)), 1);
+
+   if (p->viewport_[2] <= 0 || p->viewport_[3] <= 0 ||
+       !p->UpdateTexture(context, width, height))
+   {
+      return false;
+   }
+
+   static constexpr std::array<GLfloat, 4> kClearValue_ {};
+
+   gl.glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &p->previousFramebuffer_);
+
+   gl.glBindFramebuffer(GL_DRAW_FRAMEBUFFER, p->framebuffer_);
+   gl.glViewport(0, 0, width, height);
+   gl.glClearBufferfv(GL_COLOR, 0, kClearValue_.data());
+
+   // Accumulate premultiplied color, such that the target composites over the
+   // map as the layer would have blended directly
+   gl.glBlendFuncSeparate(
+      GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+   return true;
+}
+
+void ScaledFramebuffer::End(GlContext& context)
+{
+   OpenGLFunctions& gl = context.gl();
+
+   gl.glBindFramebuffer(GL_DRAW_FRAMEBUFFER,
+                        static_cast<GLuint>(p->previousFramebuffer_));
+   gl.glViewport(
+      p->viewport_[0], p->viewport_[1], p->viewport_[2], p->viewport_[3]);
+   gl.glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+   p->shaderProgram_->Use();
+
+   gl.glUniform4f(p->uViewportLocation_,
+                  static_cast<float>(p->viewport_[0]),
+                  static_cast<float>(p->viewport_[1]),
+                  static_cast<float>(p->viewport_[2]),
+                  static_cast<float>(p->viewport_[3]));
+
+   // Layers may bind textures without the state cache, so the upscaled texture
+   // is always bound
+   gl.glActiveTexture(GL_TEXTURE0);
+   gl.glBindTexture(GL_TEXTURE_2D, p->texture_);
+   gl.glBindVertexArray(p->vao_);
+   gl.glDrawArrays(GL_TRIANGLES, 0, 3);
+
+   gl.glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+   SCWX_GL_CHECK_ERROR();
+}
+
+void ScaledFramebuffer::Deinitialize(GlContext& context)
+{
+   OpenGLFunctions& gl = context.gl();
+
+   if (p->framebuffer_ != GL_INVALID_INDEX)
+   {
+      gl.glDeleteVertexArrays(1, &p->vao_);
+      gl.glDeleteFramebuffers(1, &p->framebuffer_);
+      gl.glDeleteTextures(1, &p->texture_);
+   }
+
+   p->shaderProgram_ = nullptr;
+   p->framebuffer_   = GL_INVALID_INDEX;
+   p->texture_       = GL_INVALID_INDEX;
+   p->vao_           = GL_INVALID_INDEX;
+   p->textureWidth_  = 0;
+   p->textureHeight_ = 0;
+}
+
+bool ScaledFramebuffer::Impl::UpdateTexture(GlContext& context,
+                                            GLsizei    width,
+                                            GLsizei    height)
+{
+   if (width == textureWidth_ && height == textureHeight_)
+   {
+      return true;
+   }
+
+   OpenGLFunctions& gl = context.gl();
+
+   context.state_cache().BindTexture(GL_TEXTURE0, GL_TEXTURE_2D, texture_);
+   gl.glTexImage2D(GL_TEXTURE_2D,
+                   0,
+                   GL_RGBA8,
+                   width,
+                   height,
+                   0,
+                   GL_RGBA,
+                   GL_UNSIGNED_BYTE,
+                   nullptr);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+   GLint previousFramebuffer = 0;
+   gl.glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousFramebuffer);
+
+   gl.glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer_);
+   gl.glFramebufferTexture2D(
+      GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture_, 0);
+
+   const GLenum status = gl.glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER);
+
+   gl.glBindFramebuffer(GL_DRAW_FRAMEBUFFER,
+                        static_cast<GLuint>(previousFramebuffer));
+
+   if (status != GL_FRAMEBUFFER_COMPLETE)
+   {
+      logger_->error("Scaled framebuffer is incomplete: {}", status);
+      textureWidth_  = 0;
+      textureHeight_ = 0;
+      return false;
+   }
+
+   textureWidth_  = width;
+   textureHeight_ = height;
+
+   return true;
+}
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <scwx/qt/gl/gl_context.hpp>
+
+#include <memory>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+/**
+ * @brief Offscreen target for rendering a layer below the resolution of the
+ * viewport. Draw calls issued between Begin() and End() are rendered into a
+ * texture scaled from the viewport, which is then upscaled over the viewport
+ * with linear filtering. Colors are accumulated premultiplied by alpha, such
+ * that the upscaled layer blends the same as if it were drawn directly.
+ */
+class ScaledFramebuffer
+{
+public:
+   explicit ScaledFramebuffer();
+   ~ScaledFramebuffer();
+
+   ScaledFramebuffer(const ScaledFramebuffer&)            = delete;
+   ScaledFramebuffer& operator=(const ScaledFramebuffer&) = delete;
+
+   ScaledFramebuffer(ScaledFramebuffer&&) noexcept;
+   ScaledFramebuffer& operator=(ScaledFramebuffer&&) noexcept;
+
+   /**
+    * Loads the upscale shader, and creates the framebuffer.
+    *
+    * @param [in] context OpenGL context
+    */
+   void Initialize(GlContext& context);
+
+   /**
+    * Redirects rendering to the scaled target. The current framebuffer and
+    * viewport are saved, and the blend function is set to accumulate
+    * premultiplied color.
+    *
+    * @param [in] context OpenGL context
+    * @param [in] scale Scale of the target relative to the viewport
+    *
+    * @return true if rendering was redirected, or false if the scale is full
+    * resolution or the target could not be created. End() must only be called
+    * if rendering was redirected.
+    */
+   bool Begin(GlContext& context, float scale);
+
+   /**
+    * Restores the saved framebuffer and viewport, and upscales the target over
+    * the viewport. The blend function is restored to source alpha blending.
+    *
+    * @param [in] context OpenGL context
+    */
+   void End(GlContext& context);
+
+   /**
+    * Destroys the framebuffer and texture.
+    *
+    * @param [in] context OpenGL context
+    */
+   void Deinitialize(GlContext& context);
+
+private:
+   class Impl;
+
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
@@ -1,7 +1,16 @@
 #include <scwx/qt/gl/shader_program.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include <boost/container_hash/hash.hpp>
+#include <fmt/format.h>
 #include <QFile>
+#include <QOpenGLContext>
+#include <QOpenGLExtraFunctions>
+#include <QStandardPaths>
 
 namespace scwx
 {
@@ -35,9 +44,19 @@ public:
       gl_.glDeleteProgram(id_);
    }
 
-   static std::string ShaderName(GLenum type);
+   static std::string            ShaderName(GLenum type);
+   static bool ReadSource(const std::string& path, std::string& source);
+   static const std::string&     BinaryCachePath();
+   static QOpenGLExtraFunctions* BinaryFunctions();
+
+   using ShaderSources = std::vector<std::pair<GLenum, std::string>>;
+
+   std::size_t GetBinaryKey(const ShaderSources& sources);
+   bool        LoadBinary(std::size_t key);
+   void        SaveBinary(std::size_t key);
 
    OpenGLFunctions& gl_;
+   StateCache*      stateCache_ {nullptr};
 
    GLuint id_;
 };
@@ -46,6 +65,11 @@ ShaderProgram::ShaderProgram(OpenGLFunctions& gl) :
     p(std::make_unique<Impl>(gl))
 {
 }
+ShaderProgram::ShaderProgram(OpenGLFunctions& gl, StateCache& stateCache) :
+    p(std::make_unique<Impl>(gl))
+{
+   p->stateCache_ = &stateCache;
+}
 ShaderProgram::~ShaderProgram() = default;
 
 ShaderProgram::ShaderProgram(ShaderProgram&&) noexcept            = default;
@@ -66,6 +90,52 @@ GLint ShaderProgram::GetUniformLocation(const std::string& name)
    return location;
 }
 
+bool ShaderProgram::Impl::ReadSource(const std::string& path,
+                                     std::string&       source)
+{
+   static const std::string kIncludeDirective_ {"#include \""};
+
+   QFile file(path.c_str());
+   file.open(QIODevice::ReadOnly | QIODevice::Text);
+
+   if (!file.isOpen())
+   {
+      return false;
+   }
+
+   QTextStream shaderStream(&file);
+   shaderStream.setEncoding(QStringConverter::Utf8);
+
+   // GLSL has no include directive. A line of the form #include "file" is
+   // replaced by the file, relative to the directory of the shader.
+   const std::string directory = path.substr(0, path.find_last_of('/') + 1);
+
+   while (!shaderStream.atEnd())
+   {
+      const std::string line = shaderStream.readLine().toStdString();
+
+      if (line.starts_with(kIncludeDirective_) && line.ends_with('"'))
+      {
+         const std::string includePath =
+            directory +
+            line.substr(kIncludeDirective_.size(),
+                        line.size() - kIncludeDirective_.size() - 1);
+
+         if (!ReadSource(includePath, source))
+         {
+            logger_->error("Could not include shader: {}", includePath);
+            return false;
+         }
+      }
+      else
+      {
+         source.append(line).append(1, '\n');
+      }
+   }
+
+   return true;
+}
+
 std::string ShaderProgram::Impl::ShaderName(GLenum type)
 {
    auto it = kShaderNames_.find(type);
@@ -95,6 +165,7 @@ bool ShaderProgram::Load(
    char    infoLog[kInfoLogBufSize];
    GLsizei logLength;
 
+   Impl::ShaderSources shaderSources {};
    std::vector<GLuint> shaderIds {};
 
    for (auto& shader : shaders)
@@ -103,21 +174,31 @@ bool ShaderProgram::Load(
                      Impl::ShaderName(shader.first),
                      shader.second);
 
-      QFile file(shader.second.c_str());
-      file.open(QIODevice::ReadOnly | QIODevice::Text);
+      std::string source {};
 
-      if (!file.isOpen())
+      if (!Impl::ReadSource(shader.second, source))
       {
          logger_->error("Could not load shader");
-         success = false;
-         break;
+         return false;
       }
 
-      QTextStream shaderStream(&file);
-      shaderStream.setEncoding(QStringConverter::Utf8);
+      shaderSources.emplace_back(shader.first, std::move(source));
+   }
+
+   // Programs linked by a previous run with the same driver are loaded from
+   // the program binary cache, without compiling the shaders
+   QOpenGLExtraFunctions* binaryFunctions = Impl::BinaryFunctions();
+   const std::size_t      binaryKey =
+      (binaryFunctions != nullptr) ? p->GetBinaryKey(shaderSources) : 0u;
 
-      std::string shaderSource  = shaderStream.readAll().toStdString();
-      const char* shaderSourceC = shaderSource.c_str();
+   if (binaryFunctions != nullptr && p->LoadBinary(binaryKey))
+   {
+      return true;
+   }
+
+   for (auto& shader : shaderSources)
+   {
+      const char* shaderSourceC = shader.second.c_str();
 
       // Create a shader
       GLuint shaderId = gl.glCreateShader(shader.first);
@@ -148,6 +229,11 @@ bool ShaderProgram::Load(
       {
          gl.glAttachShader(p->id_, shaderId);
       }
+      if (binaryFunctions != nullptr)
+      {
+         binaryFunctions->glProgramParameteri(
+            p->id_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+      }
       gl.glLinkProgram(p->id_);
 
       // Check for errors
@@ -167,15 +253,197 @@ bool ShaderProgram::Load(
    // Delete shaders
    for (auto& shaderId : shaderIds)
    {
+      gl.glDetachShader(p->id_, shaderId);
       gl.glDeleteShader(shaderId);
    }
 
+   if (success && binaryFunctions != nullptr)
+   {
+      p->SaveBinary(binaryKey);
+   }
+
    return success;
 }
 
+const std::string& ShaderProgram::Impl::BinaryCachePath()
+{
+   static const std::string cachePath = []()
+   {
+      std::string path {
+         QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            .toStdString() +
+         "/shaders"};
+
+      std::error_code error;
+      if (!std::filesystem::exists(path, error) &&
+          !std::filesystem::create_directories(path, error))
+      {
+         logger_->error(
+            "Unable to create shader cache directory: \"{}\" ({})",
+            path,
+            error.message());
+         return std::string {};
+      }
+
+      return path + "/";
+   }();
+
+   return cachePath;
+}
+
+QOpenGLExtraFunctions* ShaderProgram::Impl::BinaryFunctions()
+{
+   QOpenGLContext* context = QOpenGLContext::currentContext();
+   if (context == nullptr || BinaryCachePath().empty())
+   {
+      return nullptr;
+   }
+
+   // Program binaries are core in OpenGL 4.1, and available as an extension
+   // on earlier versions
+   const QSurfaceFormat format = context->format();
+   if (format.version() < qMakePair(4, 1) &&
+       !context->hasExtension("GL_ARB_get_program_binary"))
+   {
+      return nullptr;
+   }
+
+   QOpenGLExtraFunctions* functions = context->extraFunctions();
+
+   GLint formatCount = 0;
+   functions->glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+
+   return (formatCount > 0) ? functions : nullptr;
+}
+
+std::size_t ShaderProgram::Impl::GetBinaryKey(const ShaderSources& sources)
+{
+   // Program binaries are only valid for the driver which created them
+   std::size_t seed = 0;
+   for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+   {
+      const GLubyte* value = gl_.glGetString(name);
+      boost::hash_combine(
+         seed,
+         std::string {(value != nullptr) ?
+                         reinterpret_cast<const char*>(value) :
+                         ""});
+   }
+
+   for (auto& source : sources)
+   {
+      boost::hash_combine(seed, source.first);
+      boost::hash_combine(seed, source.second);
+   }
+
+   return seed;
+}
+
+bool ShaderProgram::Impl::LoadBinary(std::size_t key)
+{
+   const std::string filename =
+      fmt::format("{}{:016x}.bin", BinaryCachePath(), key);
+
+   std::ifstream ifs {filename, std::ios_base::in | std::ios_base::binary};
+   if (!ifs.is_open())
+   {
+      return false;
+   }
+
+   GLenum binaryFormat {};
+   ifs.read(reinterpret_cast<char*>(&binaryFormat), sizeof(binaryFormat));
+
+   std::vector<char> binary {std::istreambuf_iterator<char>(ifs),
+                             std::istreambuf_iterator<char>()};
+   if (!ifs.good() && !ifs.eof())
+   {
+      return false;
+   }
+
+   BinaryFunctions()->glProgramBinary(id_,
+                                      binaryFormat,
+                                      binary.data(),
+                                      static_cast<GLsizei>(binary.size()));
+
+   // A binary from an updated driver is rejected, and the program is linked
+   // from source again
+   GLint glSuccess = GL_FALSE;
+   gl_.glGetProgramiv(id_, GL_LINK_STATUS, &glSuccess);
+   if (!glSuccess)
+   {
+      logger_->debug("Cached shader program binary rejected");
+      return false;
+   }
+
+   logger_->debug("Loaded shader program binary: {}", filename);
+
+   return true;
+}
+
+void ShaderProgram::Impl::SaveBinary(std::size_t key)
+{
+   QOpenGLExtraFunctions* functions = BinaryFunctions();
+
+   GLint binaryLength = 0;
+   gl_.glGetProgramiv(id_, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+   if (binaryLength <= 0)
+   {
+      return;
+   }
+
+   std::vector<char> binary(static_cast<std::size_t>(binaryLength));
+   GLenum            binaryFormat {};
+   GLsizei           length = 0;
+   functions->glGetProgramBinary(
+      id_, binaryLength, &length, &binaryFormat, binary.data());
+   if (length <= 0)
+   {
+      return;
+   }
+
+   const std::string filename =
+      fmt::format("{}{:016x}.bin", BinaryCachePath(), key);
+   const std::string tempFilename = filename + ".tmp";
+
+   {
+      std::ofstream ofs {tempFilename,
+                         std::ios_base::out | std::ios_base::binary |
+                            std::ios_base::trunc};
+      ofs.write(reinterpret_cast<const char*>(&binaryFormat),
+                sizeof(binaryFormat));
+      ofs.write(binary.data(), length);
+
+      if (!ofs.good())
+      {
+         logger_->warn("Unable to write shader program binary: {}",
+                       tempFilename);
+         return;
+      }
+   }
+
+   // Rename the complete binary over any previous binary, so another process
+   // never loads a partially written file
+   std::error_code error;
+   std::filesystem::rename(tempFilename, filename, error);
+   if (error)
+   {
+      logger_->warn("Unable to save shader program binary: {} ({})",
+                    filename,
+                    error.message());
+      std::filesystem::remove(tempFilename, error);
+   }
+}
+
 void ShaderProgram::Use() const
 {
-   p->gl_.glUseProgram(p->id_);
+   if (p->stateCache_ != nullptr)
+   {
+      p->stateCache_->UseProgram(p->id_);
+   }
+   else
+   {
+      p->gl_.glUseProgram(p->id_);
+   }
 }
 
 } // namespace gl
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <scwx/qt/gl/gl.hpp>
+#include <scwx/qt/gl/state_cache.hpp>
 
 #ifdef _WIN32
 #   include <Windows.h>
@@ -20,6 +21,7 @@ class ShaderProgram
 {
 public:
    explicit ShaderProgram(OpenGLFunctions& gl);
+   explicit ShaderProgram(OpenGLFunctions& gl, StateCache& stateCache);
    virtual ~ShaderProgram();
 
    ShaderProgram(const ShaderProgram&)            = delete;
@@ -33,6 +35,12 @@ public:
    GLint GetUniformLocation(const std::string& name);
 
    bool Load(const std::string& vertexPath, const std::string& fragmentPath);
+   /**
+    * Compiles and links the shaders into the program. If a program binary was
+    * cached by the same driver for the same shader sources, the binary is
+    * loaded instead. Shader sources may include other files relative to the
+    * shader with a line of the form #include "file".
+    */
    bool Load(std::initializer_list<std::pair<GLenum, std::string>> shaderPaths);
 
    void Use() const;
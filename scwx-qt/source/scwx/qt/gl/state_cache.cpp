@@ -0,0 +1,82 @@
+#include <scwx/qt/gl/state_cache.hpp>
+
+#include <optional>
+#include <utility>
+
+#include <boost/unordered/unordered_flat_map.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+class StateCache::Impl
+{
+public:
+   explicit Impl(OpenGLFunctions& gl) : gl_ {gl} {}
+   ~Impl() = default;
+
+   OpenGLFunctions& gl_;
+
+   std::optional<GLuint> program_ {};
+   std::optional<GLuint> vao_ {};
+   std::optional<GLenum> activeTexture_ {};
+
+   // Bound textures, by texture unit and target
+   boost::unordered_flat_map<std::pair<GLenum, GLenum>, GLuint> textures_ {};
+};
+
+StateCache::StateCache(OpenGLFunctions& gl) : p(std::make_unique<Impl>(gl)) {}
+StateCache::~StateCache() = default;
+
+StateCache::StateCache(StateCache&&) noexcept            = default;
+StateCache& StateCache::operator=(StateCache&&) noexcept = default;
+
+void StateCache::BindTexture(GLenum unit, GLenum target, GLuint texture)
+{
+   auto [it, inserted] = p->textures_.try_emplace({unit, target}, texture);
+
+   if (inserted || it->second != texture)
+   {
+      if (p->activeTexture_ != unit)
+      {
+         p->gl_.glActiveTexture(unit);
+         p->activeTexture_ = unit;
+      }
+
+      p->gl_.glBindTexture(target, texture);
+      it->second = texture;
+   }
+}
+
+void StateCache::BindVertexArray(GLuint vao)
+{
+   if (p->vao_ != vao)
+   {
+      p->gl_.glBindVertexArray(vao);
+      p->vao_ = vao;
+   }
+}
+
+void StateCache::Reset()
+{
+   p->program_.reset();
+   p->vao_.reset();
+   p->activeTexture_.reset();
+   p->textures_.clear();
+}
+
+void StateCache::UseProgram(GLuint program)
+{
+   if (p->program_ != program)
+   {
+      p->gl_.glUseProgram(program);
+      p->program_ = program;
+   }
+}
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <scwx/qt/gl/gl.hpp>
+
+#include <memory>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+/**
+ * @brief Tracks the OpenGL state bound by the draw layers, such that redundant
+ * state changes between draw items are skipped.
+ *
+ * The map renderer changes OpenGL state between custom layers, so the cache
+ * must be reset before each layer is initialized, rendered or deinitialized.
+ */
+class StateCache
+{
+public:
+   explicit StateCache(OpenGLFunctions& gl);
+   ~StateCache();
+
+   StateCache(const StateCache&)            = delete;
+   StateCache& operator=(const StateCache&) = delete;
+
+   StateCache(StateCache&&) noexcept;
+   StateCache& operator=(StateCache&&) noexcept;
+
+   /**
+    * Binds a texture to a texture unit, unless it is already bound.
+    *
+    * @param [in] unit Texture unit (e.g., GL_TEXTURE0)
+    * @param [in] target Texture target
+    * @param [in] texture Texture
+    */
+   void BindTexture(GLenum unit, GLenum target, GLuint texture);
+
+   /**
+    * Binds a vertex array object, unless it is already bound.
+    *
+    * @param [in] vao Vertex array object
+    */
+   void BindVertexArray(GLuint vao);
+
+   /**
+    * Forgets all cached state. The next request for each state is always
+    * issued to OpenGL.
+    */
+   void Reset();
+
+   /**
+    * Installs a shader program, unless it is already in use.
+    *
+    * @param [in] program Shader program
+    */
+   void UseProgram(GLuint program);
+
+private:
+   class Impl;
+
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,88 @@
+#include <scwx/qt/gl/upload_scheduler.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+static const std::string logPrefix_ = "scwx::qt::gl::upload_scheduler";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+class UploadScheduler::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   std::size_t budget_ {0u};
+   std::size_t usedBytes_ {0u};
+
+   // Uploads deferred during the previous frame which have not been granted
+   // during the current frame, and uploads deferred during the current frame
+   std::unordered_map<const void*, UploadPriority> previousDeferred_ {};
+   std::unordered_map<const void*, UploadPriority> deferred_ {};
+};
+
+UploadScheduler::UploadScheduler() : p(std::make_unique<Impl>()) {}
+UploadScheduler::~UploadScheduler() = default;
+
+UploadScheduler::UploadScheduler(UploadScheduler&&) noexcept = default;
+UploadScheduler&
+UploadScheduler::operator=(UploadScheduler&&) noexcept = default;
+
+bool UploadScheduler::deferred() const
+{
+   return !p->deferred_.empty();
+}
+
+void UploadScheduler::set_budget(std::size_t bytes)
+{
+   p->budget_ = bytes;
+}
+
+void UploadScheduler::StartFrame()
+{
+   p->usedBytes_ = 0u;
+   p->previousDeferred_.swap(p->deferred_);
+   p->deferred_.clear();
+}
+
+bool UploadScheduler::Request(const void*    owner,
+                              std::size_t    bytes,
+                              UploadPriority priority)
+{
+   // Uploads deferred during the previous frame are granted first, unless
+   // they are of lower priority
+   const bool reserved = std::any_of(
+      p->previousDeferred_.cbegin(),
+      p->previousDeferred_.cend(),
+      [&](const auto& entry)
+      { return entry.first != owner && entry.second <= priority; });
+
+   const bool granted =
+      !reserved && (p->budget_ == 0u || p->usedBytes_ == 0u ||
+                    p->usedBytes_ + bytes <= p->budget_);
+
+   if (granted)
+   {
+      p->usedBytes_ += bytes;
+      p->previousDeferred_.erase(owner);
+   }
+   else
+   {
+      SPDLOG_LOGGER_TRACE(logger_, "Deferring upload of {} bytes", bytes);
+      p->deferred_[owner] = priority;
+   }
+
+   return granted;
+}
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
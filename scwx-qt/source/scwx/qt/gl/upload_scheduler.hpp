@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+enum class UploadPriority
+{
+   High,
+   Normal,
+   Low
+};
+
+/**
+ * @brief Spreads the uploads of a context across frames under a per-frame byte
+ * budget. Uploads which do not fit within the budget are deferred to a later
+ * frame, during which the previously uploaded data continues to be drawn.
+ *
+ * An upload deferred in one frame is granted before any upload of equal or
+ * lower priority in the next frame, such that uploads are not starved. An
+ * upload larger than the entire budget is granted when it is the first upload
+ * of a frame.
+ */
+class UploadScheduler
+{
+public:
+   explicit UploadScheduler();
+   ~UploadScheduler();
+
+   UploadScheduler(const UploadScheduler&)            = delete;
+   UploadScheduler& operator=(const UploadScheduler&) = delete;
+
+   UploadScheduler(UploadScheduler&&) noexcept;
+   UploadScheduler& operator=(UploadScheduler&&) noexcept;
+
+   /**
+    * Gets whether an upload was deferred during the current frame. If so,
+    * another frame must be rendered to complete it.
+    *
+    * @return true if an upload was deferred
+    */
+   bool deferred() const;
+
+   /**
+    * Sets the number of bytes which may be uploaded each frame.
+    *
+    * @param [in] bytes Budget in bytes, or 0 for no budget
+    */
+   void set_budget(std::size_t bytes);
+
+   /**
+    * Resets the budget at the start of a frame.
+    */
+   void StartFrame();
+
+   /**
+    * Requests an upload during the current frame. If the upload is granted, it
+    * is counted against the budget, and must be made. Otherwise, the owner
+    * keeps its pending data, and requests the upload again the next frame.
+    *
+    * @param [in] owner Object making the upload, identifying it across frames
+    * @param [in] bytes Size of the upload in bytes
+    * @param [in] priority Upload priority
+    *
+    * @return true if the upload is granted
+    */
+   bool Request(const void* owner, std::size_t bytes, UploadPriority priority);
+
+private:
+   class Impl;
+
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,267 @@
+#include <scwx/qt/gl/upload_worker.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/profiler.hpp>
+
+#include <future>
+#include <mutex>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <QOffscreenSurface>
+#include <QOpenGLContext>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+static const std::string logPrefix_ = "scwx::qt::gl::upload_worker";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Interval at which the upload thread checks the upload fence (ns)
+static constexpr GLuint64 kFenceTimeout_ = 100'000'000u;
+
+class UploadTask::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   std::mutex mutex_ {};
+   GLsync     fence_ {nullptr};
+   bool       finished_ {false};
+   bool       failed_ {false};
+   bool       discarded_ {false};
+};
+
+UploadTask::UploadTask() : p(std::make_unique<Impl>()) {}
+UploadTask::~UploadTask() = default;
+
+UploadTask::State UploadTask::Poll(OpenGLFunctions& gl)
+{
+   std::unique_lock lock(p->mutex_);
+
+   if (!p->finished_)
+   {
+      return State::Pending;
+   }
+
+   if (p->fence_ != nullptr)
+   {
+      // Waiting on the fence from the render context makes the uploaded data
+      // visible to it
+      const GLenum result = gl.glClientWaitSync(p->fence_, 0, 0);
+
+      if (result == GL_TIMEOUT_EXPIRED)
+      {
+         return State::Pending;
+      }
+
+      gl.glDeleteSync(p->fence_);
+      p->fence_ = nullptr;
+
+      if (result == GL_WAIT_FAILED)
+      {
+         logger_->error("Upload fence wait failed");
+         p->failed_ = true;
+      }
+   }
+
+   return p->failed_ ? State::Failed : State::Complete;
+}
+
+void UploadTask::Discard(OpenGLFunctions& gl)
+{
+   std::unique_lock lock(p->mutex_);
+
+   p->discarded_ = true;
+
+   if (p->fence_ != nullptr)
+   {
+      gl.glDeleteSync(p->fence_);
+      p->fence_ = nullptr;
+   }
+}
+
+class UploadWorker::Impl
+{
+public:
+   explicit Impl(UploadWorker* self) : self_ {self} {}
+   ~Impl()
+   {
+      // The context is released on the thread it is current on
+      boost::asio::post(threadPool_,
+                        [this]()
+                        {
+                           if (context_ != nullptr)
+                           {
+                              context_->doneCurrent();
+                              context_.reset();
+                           }
+                        });
+      threadPool_.join();
+   }
+
+   bool CreateContext(QOpenGLContext* shareContext);
+   void Upload(const std::shared_ptr<UploadTask>& task,
+               const UploadFunction&              function);
+
+   UploadWorker* self_;
+
+   std::unique_ptr<QOffscreenSurface> surface_ {};
+   std::unique_ptr<QOpenGLContext>    context_ {};
+   OpenGLFunctions                    gl_ {};
+
+   bool available_ {false};
+
+   boost::asio::thread_pool threadPool_ {1u};
+};
+
+UploadWorker::UploadWorker() : p(std::make_unique<Impl>(this))
+{
+   QOpenGLContext* shareContext = QOpenGLContext::globalShareContext();
+   if (shareContext == nullptr)
+   {
+      logger_->warn("Shared OpenGL context unavailable, uploading directly");
+      return;
+   }
+
+   // The surface is created on the GUI thread, and the context is created on
+   // the upload thread it will be current on
+   p->surface_ = std::make_unique<QOffscreenSurface>();
+   p->surface_->setFormat(shareContext->format());
+   p->surface_->create();
+
+   std::promise<bool> created {};
+   std::future<bool>  result = created.get_future();
+
+   boost::asio::post(p->threadPool_,
+                     [this, shareContext, &created]()
+                     { created.set_value(p->CreateContext(shareContext)); });
+
+   p->available_ = result.get();
+}
+
+UploadWorker::~UploadWorker() = default;
+
+bool UploadWorker::Impl::CreateContext(QOpenGLContext* shareContext)
+{
+   scwx::util::Profiler::SetThreadName("GL Upload");
+
+   context_ = std::make_unique<QOpenGLContext>();
+   context_->setFormat(shareContext->format());
+   context_->setShareContext(shareContext);
+
+   if (!context_->create() || !context_->makeCurrent(surface_.get()))
+   {
+      logger_->error("Unable to create OpenGL context for uploads");
+      context_.reset();
+      return false;
+   }
+
+   if (!gl_.initializeOpenGLFunctions())
+   {
+      logger_->error("Unable to initialize OpenGL functions for uploads");
+      context_->doneCurrent();
+      context_.reset();
+      return false;
+   }
+
+   return true;
+}
+
+std::shared_ptr<UploadTask> UploadWorker::Queue(UploadFunction function)
+{
+   if (!p->available_)
+   {
+      return nullptr;
+   }
+
+   auto task = std::make_shared<UploadTask>();
+
+   boost::asio::post(p->threadPool_,
+                     [this, task, function = std::move(function)]()
+                     { p->Upload(task, function); });
+
+   return task;
+}
+
+void UploadWorker::Impl::Upload(const std::shared_ptr<UploadTask>& task,
+                                const UploadFunction&              function)
+{
+   {
+      std::unique_lock lock(task->p->mutex_);
+      if (task->p->discarded_)
+      {
+         return;
+      }
+   }
+
+   bool   uploaded = function(gl_);
+   GLsync fence    = nullptr;
+
+   if (uploaded)
+   {
+      fence = gl_.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+      // Wait for the transfer to complete on this thread, such that the fence
+      // has signaled when the render thread is notified
+      GLenum result;
+      do
+      {
+         result = gl_.glClientWaitSync(
+            fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceTimeout_);
+      } while (result == GL_TIMEOUT_EXPIRED);
+
+      if (result == GL_WAIT_FAILED)
+      {
+         logger_->error("Upload fence wait failed");
+         gl_.glDeleteSync(fence);
+         fence    = nullptr;
+         uploaded = false;
+      }
+   }
+
+   {
+      std::unique_lock lock(task->p->mutex_);
+
+      if (task->p->discarded_)
+      {
+         if (fence != nullptr)
+         {
+            gl_.glDeleteSync(fence);
+         }
+         return;
+      }
+
+      task->p->fence_    = fence;
+      task->p->failed_   = !uploaded;
+      task->p->finished_ = true;
+   }
+
+   Q_EMIT self_->UploadFinished();
+}
+
+std::shared_ptr<UploadWorker> UploadWorker::Instance()
+{
+   static std::weak_ptr<UploadWorker> workerReference_ {};
+   static std::mutex                  instanceMutex_ {};
+
+   std::unique_lock lock(instanceMutex_);
+
+   std::shared_ptr<UploadWorker> worker = workerReference_.lock();
+
+   if (worker == nullptr)
+   {
+      worker           = std::make_shared<UploadWorker>();
+      workerReference_ = worker;
+   }
+
+   return worker;
+}
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <scwx/qt/gl/gl.hpp>
+
+#include <functional>
+#include <memory>
+
+#include <QObject>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+/**
+ * @brief Upload queued to the upload worker. The upload is complete once the
+ * fence inserted after it has signaled, at which point the uploaded objects
+ * may be used by any context in the share group.
+ */
+class UploadTask
+{
+public:
+   enum class State
+   {
+      Pending,
+      Complete,
+      Failed
+   };
+
+   explicit UploadTask();
+   ~UploadTask();
+
+   UploadTask(const UploadTask&)            = delete;
+   UploadTask& operator=(const UploadTask&) = delete;
+
+   /**
+    * Gets the state of the upload without blocking. Must be called with a
+    * context in the share group current.
+    *
+    * @param [in] gl OpenGL functions
+    *
+    * @return Upload state
+    */
+   State Poll(OpenGLFunctions& gl);
+
+   /**
+    * Abandons the upload, such that the objects it uploads may be deleted.
+    * Must be called with a context in the share group current.
+    *
+    * @param [in] gl OpenGL functions
+    */
+   void Discard(OpenGLFunctions& gl);
+
+private:
+   friend class UploadWorker;
+
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+/**
+ * @brief Uploads buffer and texture data on a background thread, using an
+ * OpenGL context shared with the render contexts. Large uploads are filled and
+ * transferred without stalling the frame being rendered, and the render thread
+ * swaps to the uploaded objects once the upload fence has signaled.
+ *
+ * Must be created on the GUI thread.
+ */
+class UploadWorker : public QObject
+{
+   Q_OBJECT
+   Q_DISABLE_COPY_MOVE(UploadWorker)
+
+public:
+   explicit UploadWorker();
+   ~UploadWorker();
+
+   /**
+    * The upload function is invoked on the upload thread with the shared
+    * context current, and returns false if the upload was abandoned.
+    */
+   typedef std::function<bool(OpenGLFunctions& gl)> UploadFunction;
+
+   /**
+    * Queues an upload. Objects written by the upload must be created before
+    * the upload is queued.
+    *
+    * @param [in] function Upload function
+    *
+    * @return Queued upload, or nullptr if a shared context is unavailable, in
+    * which case the caller must upload directly
+    */
+   std::shared_ptr<UploadTask> Queue(UploadFunction function);
+
+   static std::shared_ptr<UploadWorker> Instance();
+
+signals:
+   /**
+    * Emitted from the upload thread when an upload has completed or failed.
+    */
+   void UploadFinished();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
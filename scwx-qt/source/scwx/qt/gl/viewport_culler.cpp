@@ -0,0 +1,257 @@
+#include <scwx/qt/gl/viewport_culler.hpp>
+#include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/spatial_index.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+// Threshold, start time, end time
+static constexpr std::size_t kFilterIntegersPerVertex_ = 3;
+
+// Thresholds of 999 nmi or greater are never exceeded
+static constexpr GLint kMaxThreshold_ = 999;
+
+class ViewportCuller::Impl
+{
+public:
+   struct PrimitiveAttributes
+   {
+      GLint threshold_;
+      GLint startTime_;
+      GLint endTime_;
+   };
+
+   explicit Impl(std::size_t pointsPerVertex,
+                 std::size_t verticesPerPrimitive,
+                 Coordinates coordinates) :
+       pointsPerVertex_ {pointsPerVertex},
+       verticesPerPrimitive_ {verticesPerPrimitive},
+       coordinates_ {coordinates}
+   {
+   }
+   ~Impl() = default;
+
+   bool IsDisplayed(const PrimitiveAttributes& attributes) const;
+
+   const std::size_t pointsPerVertex_;
+   const std::size_t verticesPerPrimitive_;
+   const Coordinates coordinates_;
+
+   util::SpatialIndex spatialIndex_ {};
+
+   std::vector<PrimitiveAttributes> attributes_ {};
+
+   bool  filterEnabled_ {false};
+   float mapDistance_ {0.0f};
+   GLint selectedTime_ {0};
+
+   std::vector<GLint>   first_ {};
+   std::vector<GLsizei> count_ {};
+};
+
+ViewportCuller::ViewportCuller(std::size_t pointsPerVertex,
+                               std::size_t verticesPerPrimitive,
+                               Coordinates coordinates) :
+    p(std::make_unique<Impl>(
+       pointsPerVertex, verticesPerPrimitive, coordinates))
+{
+}
+ViewportCuller::~ViewportCuller() = default;
+
+ViewportCuller::ViewportCuller(ViewportCuller&&) noexcept            = default;
+ViewportCuller& ViewportCuller::operator=(ViewportCuller&&) noexcept = default;
+
+void ViewportCuller::Build(const std::vector<float>& vertices)
+{
+   const std::size_t primitiveLength =
+      p->pointsPerVertex_ * p->verticesPerPrimitive_;
+   const std::size_t primitiveCount = vertices.size() / primitiveLength;
+
+   std::vector<glm::vec4> bounds {};
+   bounds.reserve(primitiveCount);
+
+   float maxPixelOffset = 0.0f;
+
+   for (std::size_t i = 0; i < primitiveCount; ++i)
+   {
+      glm::vec2 min {std::numeric_limits<float>::max()};
+      glm::vec2 max {std::numeric_limits<float>::lowest()};
+
+      for (std::size_t j = 0; j < p->verticesPerPrimitive_; ++j)
+      {
+         const float* vertex =
+            &vertices[i * primitiveLength + j * p->pointsPerVertex_];
+
+         const glm::vec2 coordinate =
+            (p->coordinates_ == Coordinates::LatLong) ?
+               util::maplibre::LatLongToScreenCoordinate(
+                  {vertex[0], vertex[1]}) :
+               glm::vec2 {vertex[0], vertex[1]};
+
+         min = glm::min(min, coordinate);
+         max = glm::max(max, coordinate);
+
+         maxPixelOffset = std::max(
+            maxPixelOffset, glm::length(glm::vec2 {vertex[2], vertex[3]}));
+      }
+
+      bounds.emplace_back(min, max);
+   }
+
+   p->spatialIndex_.Build(bounds, maxPixelOffset);
+   p->attributes_.clear();
+}
+
+void ViewportCuller::Build(const std::vector<float>& vertices,
+                           const std::vector<GLint>& integers)
+{
+   Build(vertices);
+
+   const std::size_t vertexCount = vertices.size() / p->pointsPerVertex_;
+   if (vertexCount == 0 || integers.size() % vertexCount != 0 ||
+       integers.size() / vertexCount < kFilterIntegersPerVertex_)
+   {
+      return;
+   }
+
+   // Each vertex of a primitive shares the same attributes
+   const std::size_t primitiveLength =
+      integers.size() / vertexCount * p->verticesPerPrimitive_;
+   const std::size_t primitiveCount = vertexCount / p->verticesPerPrimitive_;
+
+   p->attributes_.reserve(primitiveCount);
+
+   for (std::size_t i = 0; i < primitiveCount; ++i)
+   {
+      const GLint* vertex = &integers[i * primitiveLength];
+      p->attributes_.push_back({vertex[0], vertex[1], vertex[2]});
+   }
+}
+
+void ViewportCuller::SetFilter(float mapDistance, GLint selectedTime)
+{
+   p->filterEnabled_ = true;
+   p->mapDistance_   = mapDistance;
+   p->selectedTime_  = selectedTime;
+}
+
+void ViewportCuller::ClearFilter()
+{
+   p->filterEnabled_ = false;
+}
+
+bool ViewportCuller::Impl::IsDisplayed(
+   const PrimitiveAttributes& attributes) const
+{
+   const GLint threshold = attributes.threshold_;
+
+   return (threshold == 0 || mapDistance_ == 0.0f ||
+           (threshold < 0 && static_cast<float>(-threshold) <= mapDistance_) ||
+           static_cast<float>(threshold) >= mapDistance_ ||
+           threshold >= kMaxThreshold_) &&
+          (attributes.startTime_ == 0 ||
+           (attributes.startTime_ <= selectedTime_ &&
+            selectedTime_ < attributes.endTime_));
+}
+
+void ViewportCuller::Draw(OpenGLFunctions&                              gl,
+                          const QMapLibre::CustomLayerRenderParameters& params,
+                          GLsizei vertexCount)
+{
+   Draw(gl, params, vertexCount, 0, vertexCount);
+}
+
+void ViewportCuller::Draw(OpenGLFunctions&                              gl,
+                          const QMapLibre::CustomLayerRenderParameters& params,
+                          GLsizei vertexCount,
+                          GLint   first,
+                          GLsizei count)
+{
+   const auto viewport = util::maplibre::GetMapScreenBounds(params);
+   const auto bounds   = p->spatialIndex_.bounds();
+
+   const bool indexed = static_cast<std::size_t>(vertexCount) ==
+                        p->spatialIndex_.size() * p->verticesPerPrimitive_;
+   const bool filtered = indexed && p->filterEnabled_ &&
+                         p->attributes_.size() == p->spatialIndex_.size();
+   const bool entirelyVisible =
+      !viewport.has_value() || !indexed ||
+      (viewport->x <= bounds.x && viewport->y <= bounds.y &&
+       viewport->z >= bounds.z && viewport->w >= bounds.w);
+
+   // Draw the entire range if it may be entirely visible
+   if (entirelyVisible && !filtered)
+   {
+      gl.glDrawArrays(GL_TRIANGLES, first, count);
+      return;
+   }
+
+   p->first_.clear();
+   p->count_.clear();
+
+   const auto verticesPerPrimitive =
+      static_cast<GLsizei>(p->verticesPerPrimitive_);
+
+   // Merge consecutive primitives within the range into a single range
+   const auto addPrimitive = [&](std::size_t index)
+   {
+      const auto vertex = static_cast<GLint>(index) * verticesPerPrimitive;
+
+      if (vertex < first || vertex >= first + count ||
+          (filtered && !p->IsDisplayed(p->attributes_[index])))
+      {
+         return;
+      }
+
+      if (!p->first_.empty() && p->first_.back() + p->count_.back() == vertex)
+      {
+         p->count_.back() += verticesPerPrimitive;
+      }
+      else
+      {
+         p->first_.push_back(vertex);
+         p->count_.push_back(verticesPerPrimitive);
+      }
+   };
+
+   if (entirelyVisible)
+   {
+      // Filter each primitive within the range
+      const std::size_t begin =
+         static_cast<std::size_t>(first) / p->verticesPerPrimitive_;
+      const std::size_t end =
+         static_cast<std::size_t>(first + count) / p->verticesPerPrimitive_;
+
+      for (std::size_t index = begin; index < end; ++index)
+      {
+         addPrimitive(index);
+      }
+   }
+   else
+   {
+      for (std::size_t index : p->spatialIndex_.Query(
+              *viewport, util::maplibre::GetMapPixelScale(params)))
+      {
+         addPrimitive(index);
+      }
+   }
+
+   if (!p->first_.empty())
+   {
+      gl.glMultiDrawArrays(GL_TRIANGLES,
+                           p->first_.data(),
+                           p->count_.data(),
+                           static_cast<GLsizei>(p->first_.size()));
+   }
+}
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
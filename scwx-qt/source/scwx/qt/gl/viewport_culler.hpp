@@ -0,0 +1,117 @@
+#pragma once
+
+#include <scwx/qt/gl/gl.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <qmaplibre.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+/**
+ * @brief Draws only the primitives of a vertex buffer which may be visible in
+ * the map viewport, using a spatial index over the vertex coordinates.
+ */
+class ViewportCuller
+{
+public:
+   enum class Coordinates
+   {
+      LatLong,  // Latitude and longitude in degrees
+      MapScreen // Map screen coordinates
+   };
+
+   /**
+    * @param [in] pointsPerVertex Number of floats in each vertex, beginning
+    * with the vertex coordinates and followed by its pixel offset
+    * @param [in] verticesPerPrimitive Number of vertices in each primitive
+    * @param [in] coordinates Type of vertex coordinates
+    */
+   explicit ViewportCuller(std::size_t pointsPerVertex,
+                           std::size_t verticesPerPrimitive,
+                           Coordinates coordinates);
+   ~ViewportCuller();
+
+   ViewportCuller(const ViewportCuller&)            = delete;
+   ViewportCuller& operator=(const ViewportCuller&) = delete;
+
+   ViewportCuller(ViewportCuller&&) noexcept;
+   ViewportCuller& operator=(ViewportCuller&&) noexcept;
+
+   /**
+    * Rebuilds the spatial index after the vertex buffer has changed.
+    *
+    * @param [in] vertices Vertex buffer contents
+    */
+   void Build(const std::vector<float>& vertices);
+
+   /**
+    * Rebuilds the spatial index after the vertex buffer has changed, along
+    * with the threshold and time range of each primitive used by the filter.
+    *
+    * @param [in] vertices Vertex buffer contents
+    * @param [in] integers Integer vertex buffer contents, with each vertex
+    * beginning with its threshold, start time and end time
+    */
+   void Build(const std::vector<float>& vertices,
+              const std::vector<GLint>& integers);
+
+   /**
+    * Filters thresholded and timed primitives on the CPU when drawing, in
+    * the same manner as the vertex shaders. Primitives are not filtered
+    * until the filter is set.
+    *
+    * @param [in] mapDistance Map distance in nautical miles, or 0 if
+    * thresholding is disabled
+    * @param [in] selectedTime Selected time in minutes since the epoch
+    */
+   void SetFilter(float mapDistance, GLint selectedTime);
+
+   /**
+    * Stops filtering primitives on the CPU, leaving it to the vertex shaders.
+    */
+   void ClearFilter();
+
+   /**
+    * Draws the primitives which may be visible as GL_TRIANGLES. The vertex
+    * array object must already be bound.
+    *
+    * @param [in] gl OpenGL functions
+    * @param [in] params Custom layer render parameters
+    * @param [in] vertexCount Number of vertices in the vertex buffer
+    */
+   void Draw(OpenGLFunctions&                              gl,
+             const QMapLibre::CustomLayerRenderParameters& params,
+             GLsizei                                       vertexCount);
+
+   /**
+    * Draws the primitives within a range of the vertex buffer which may be
+    * visible as GL_TRIANGLES. The vertex array object must already be bound.
+    *
+    * @param [in] gl OpenGL functions
+    * @param [in] params Custom layer render parameters
+    * @param [in] vertexCount Number of vertices in the vertex buffer
+    * @param [in] first First vertex of the range
+    * @param [in] count Number of vertices in the range
+    */
+   void Draw(OpenGLFunctions&                              gl,
+             const QMapLibre::CustomLayerRenderParameters& params,
+             GLsizei                                       vertexCount,
+             GLint                                         first,
+             GLsizei                                       count);
+
+private:
+   class Impl;
+
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
@@ -1,7 +1,16 @@
 #include <scwx/qt/main/application.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <mutex>
+
+#include <boost/signals2/signal.hpp>
+#include <fmt/chrono.h>
+#include <QCoreApplication>
+#include <QTimer>
 
 namespace scwx
 {
@@ -19,9 +28,30 @@ static std::mutex              initializationMutex_ {};
 static std::condition_variable initializationCondition_ {};
 static bool                    initialized_ {false};
 
+// Startup work queued once initialization has finished
+static boost::signals2::signal<void()> initializedSignal_ {};
+
+static const std::chrono::steady_clock::time_point startTime_ {
+   std::chrono::steady_clock::now()};
+static std::atomic<bool> radarImagePresented_ {false};
+
+// Lower priority startup work waits up to this long for the session restore
+static constexpr std::chrono::seconds kSessionRestoreTimeout_ {15};
+
+// Lower priority startup work is queued once initialization has finished, and
+// the session has been restored or the timeout has elapsed
+static std::mutex                      sessionRestoreMutex_ {};
+static bool                            sessionRestored_ {false};
+static bool                            sessionReady_ {false};
+static boost::signals2::signal<void()> sessionReadySignal_ {};
+
+static void NotifySessionReady(bool timedOut);
+
 void FinishInitialization()
 {
-   logger_->debug("Application initialization finished");
+   logger_->info("Application initialization finished in {}",
+                 std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - startTime_));
 
    // Set initialized to true
    std::unique_lock lock(initializationMutex_);
@@ -30,6 +60,43 @@ void FinishInitialization()
 
    // Notify any threads waiting for initialization
    initializationCondition_.notify_all();
+
+   // Queue startup work waiting for initialization
+   initializedSignal_();
+   initializedSignal_.disconnect_all_slots();
+
+   // Continue lower priority startup work if the session is not restored
+   // before the timeout
+   if (QCoreApplication::instance() != nullptr)
+   {
+      const auto timeout = std::max(
+         std::chrono::duration_cast<std::chrono::milliseconds>(
+            startTime_ + kSessionRestoreTimeout_ -
+            std::chrono::steady_clock::now()),
+         std::chrono::milliseconds {0});
+
+      QTimer::singleShot(timeout,
+                         QCoreApplication::instance(),
+                         []() { NotifySessionReady(true); });
+   }
+
+   NotifySessionReady(false);
+}
+
+boost::signals2::connection
+RunAfterInitialization(const std::function<void()>& callback)
+{
+   std::unique_lock lock(initializationMutex_);
+
+   if (!initialized_)
+   {
+      return initializedSignal_.connect(callback);
+   }
+
+   lock.unlock();
+   callback();
+
+   return {};
 }
 
 void WaitForInitialization()
@@ -52,6 +119,74 @@ void ResetInitilization()
    initialized_ = false;
 }
 
+void RadarImagePresented()
+{
+   if (!radarImagePresented_.exchange(true))
+   {
+      logger_->info("Time to first radar image: {}",
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::steady_clock::now() - startTime_));
+   }
+}
+
+void SessionRestored()
+{
+   std::unique_lock lock(sessionRestoreMutex_);
+   if (sessionRestored_)
+   {
+      return;
+   }
+   sessionRestored_ = true;
+   lock.unlock();
+
+   logger_->info("Session restored in {}",
+                 std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - startTime_));
+
+   NotifySessionReady(false);
+}
+
+boost::signals2::connection
+RunAfterSessionRestore(const std::function<void()>& callback)
+{
+   std::unique_lock lock(sessionRestoreMutex_);
+
+   if (!sessionReady_)
+   {
+      return sessionReadySignal_.connect(callback);
+   }
+
+   lock.unlock();
+   callback();
+
+   return {};
+}
+
+static void NotifySessionReady(bool timedOut)
+{
+   std::unique_lock initializationLock(initializationMutex_);
+   const bool       initialized = initialized_;
+   initializationLock.unlock();
+
+   std::unique_lock lock(sessionRestoreMutex_);
+
+   // Lower priority startup work is queued once
+   if (sessionReady_ || !initialized || !(sessionRestored_ || timedOut))
+   {
+      return;
+   }
+   sessionReady_ = true;
+   lock.unlock();
+
+   if (timedOut)
+   {
+      logger_->debug("Continuing before the session is restored");
+   }
+
+   sessionReadySignal_();
+   sessionReadySignal_.disconnect_all_slots();
+}
+
 } // namespace Application
 } // namespace main
 } // namespace qt
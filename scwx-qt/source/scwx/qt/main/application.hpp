@@ -1,5 +1,9 @@
 #pragma once
 
+#include <functional>
+
+#include <boost/signals2/connection.hpp>
+
 namespace scwx
 {
 namespace qt
@@ -11,9 +15,48 @@ namespace Application
 
 void FinishInitialization();
 void WaitForInitialization();
+
+/**
+ * @brief Runs a callback once application initialization has finished, on the
+ * thread finishing initialization. If initialization has already finished, the
+ * callback is run immediately. The callback should only queue work, such as to
+ * a strand, rather than wait on a thread.
+ *
+ * @param [in] callback Callback to run
+ *
+ * @return Connection of a callback not yet run, which may be disconnected
+ */
+boost::signals2::connection
+RunAfterInitialization(const std::function<void()>& callback);
 // Only use for test cases
 void ResetInitilization();
 
+/**
+ * @brief Records that a radar image has been presented. The time from
+ * application start to the first radar image is logged once.
+ */
+void RadarImagePresented();
+
+/**
+ * @brief Records that the panes of the previous session have been restored,
+ * including any animation loop that was playing.
+ */
+void SessionRestored();
+
+/**
+ * @brief Runs a callback once application initialization has finished and the
+ * panes of the previous session have been restored, such that lower priority
+ * startup work does not delay them. The callback is run after a timeout if the
+ * session is not restored. As with RunAfterInitialization, the callback should
+ * only queue work.
+ *
+ * @param [in] callback Callback to run
+ *
+ * @return Connection of a callback not yet run, which may be disconnected
+ */
+boost::signals2::connection
+RunAfterSessionRestore(const std::function<void()>& callback);
+
 } // namespace Application
 } // namespace main
 } // namespace qt
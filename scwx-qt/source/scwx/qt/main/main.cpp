@@ -5,18 +5,29 @@
 #include <scwx/qt/main/main_window.hpp>
 #include <scwx/qt/main/versions.hpp>
 #include <scwx/qt/manager/log_manager.hpp>
+#include <scwx/qt/manager/metrics_manager.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
 #include <scwx/qt/manager/resource_manager.hpp>
 #include <scwx/qt/manager/settings_manager.hpp>
+#include <scwx/qt/manager/text_event_manager.hpp>
 #include <scwx/qt/manager/thread_manager.hpp>
+#include <scwx/qt/manager/tile_server_manager.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/types/qt_types.hpp>
 #include <scwx/qt/ui/setup/setup_wizard.hpp>
 #include <scwx/network/cpr.hpp>
+#include <scwx/provider/nexrad_data_provider_factory.hpp>
 #include <scwx/util/environment.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/profiler.hpp>
 #include <scwx/util/threads.hpp>
+#include <scwx/util/time.hpp>
 
+#include <charconv>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -24,6 +35,7 @@
 #include <boost/asio.hpp>
 #include <fmt/format.h>
 #include <QApplication>
+#include <QHostAddress>
 #include <QStandardPaths>
 #include <QStyleHints>
 #include <QTranslator>
@@ -37,8 +49,10 @@
 static const std::string logPrefix_ = "scwx::main";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+static void ConfigureReplay(const std::string& directory);
 static void ConfigureTheme(const std::vector<std::string>& args);
 static void OverrideDefaultStyle(const std::vector<std::string>& args);
+static std::optional<std::uint16_t> ParsePort(const std::string& value);
 
 int main(int argc, char* argv[])
 {
@@ -57,6 +71,23 @@ int main(int argc, char* argv[])
                  scwx::qt::main::kVersionString_,
                  scwx::qt::main::kCommitString_);
 
+   // Record a profiler trace of the session if requested. The most recent
+   // samples of each thread are written on exit.
+   const std::string traceFile = scwx::util::GetEnvironment("SCWX_TRACE");
+   scwx::util::Profiler::SetThreadName("Main");
+   if (!traceFile.empty())
+   {
+      scwx::util::Profiler::SetEnabled(true);
+   }
+
+   // Replay a recorded data directory instead of live data if requested
+   const std::string replayDirectory =
+      scwx::util::GetEnvironment("SCWX_REPLAY");
+   if (!replayDirectory.empty())
+   {
+      ConfigureReplay(replayDirectory);
+   }
+
    QCoreApplication::setAttribute(Qt::AA_ShareOpenGLContexts, true);
 
    QApplication a(argc, argv);
@@ -84,6 +115,8 @@ int main(int argc, char* argv[])
    boost::asio::post(threadPool,
                      [&]()
                      {
+                        scwx::util::Profiler::SetThreadName("IO Context");
+
                         while (true)
                         {
                            try
@@ -99,20 +132,30 @@ int main(int argc, char* argv[])
                         }
                      });
 
-   // Initialize AWS SDK
-   Aws::SDKOptions awsSdkOptions;
-   Aws::InitAPI(awsSdkOptions);
+   // Initialize AWS SDK, which is not needed until radar sites are monitored
+   Aws::SDKOptions   awsSdkOptions;
+   std::future<void> awsInitialization = std::async(
+      std::launch::async, [&]() { Aws::InitAPI(awsSdkOptions); });
 
    // Initialize application
    logManager.InitializeLogFile();
+
+   // Load the county database in the background. Lookups made before it is
+   // loaded wait for it.
+   boost::asio::post(threadPool,
+                     []() { scwx::qt::config::CountyDatabase::Initialize(); });
+
+   // Settings are validated against radar sites, and fonts are initialized
+   // from settings
    scwx::qt::config::RadarSite::Initialize();
-   scwx::qt::config::CountyDatabase::Initialize();
    scwx::qt::manager::SettingsManager::Instance().Initialize();
    scwx::qt::manager::ResourceManager::Initialize();
 
    // Theme
    ConfigureTheme(args);
 
+   awsInitialization.wait();
+
    // Run initial setup if required
    if (scwx::qt::ui::setup::SetupWizard::IsSetupRequired())
    {
@@ -121,14 +164,84 @@ int main(int argc, char* argv[])
       a.exec();
    }
 
+   // Start monitoring radar sites in the background
+   scwx::qt::manager::RadarProductManager::InitializeMonitor();
+
+   // Serve metrics for monitoring if requested
+   const std::string metricsPort =
+      scwx::util::GetEnvironment("SCWX_METRICS_PORT");
+   std::shared_ptr<scwx::qt::manager::MetricsManager> metricsManager {};
+   if (!metricsPort.empty())
+   {
+      const std::optional<std::uint16_t> port = ParsePort(metricsPort);
+
+      if (port.has_value())
+      {
+         metricsManager = scwx::qt::manager::MetricsManager::Instance();
+         metricsManager->Start(*port);
+      }
+      else
+      {
+         logger_->error("Invalid metrics port (SCWX_METRICS_PORT): {}",
+                        metricsPort);
+      }
+   }
+
+   // Serve radar tiles without a main window if requested
+   const std::string tileServerPort =
+      scwx::util::GetEnvironment("SCWX_TILE_SERVER_PORT");
+   const std::string tileServerAddress =
+      scwx::util::GetEnvironment("SCWX_TILE_SERVER_ADDRESS");
+
    // Run Qt main loop
    int result;
+   if (!tileServerPort.empty())
+   {
+      const std::optional<std::uint16_t> port = ParsePort(tileServerPort);
+
+      // Tiles are served to the local machine, unless another address (e.g.,
+      // 0.0.0.0) is given
+      QHostAddress address {QHostAddress::LocalHost};
+
+      auto tileServerManager = scwx::qt::manager::TileServerManager::Instance();
+      if (!port.has_value())
+      {
+         logger_->error("Invalid tile server port (SCWX_TILE_SERVER_PORT): {}",
+                        tileServerPort);
+         result = EXIT_FAILURE;
+      }
+      else if (!tileServerAddress.empty() &&
+               !address.setAddress(QString::fromStdString(tileServerAddress)))
+      {
+         logger_->error(
+            "Invalid tile server address (SCWX_TILE_SERVER_ADDRESS): {}",
+            tileServerAddress);
+         result = EXIT_FAILURE;
+      }
+      else if (tileServerManager->Start(*port, address))
+      {
+         result = a.exec();
+         tileServerManager->Stop();
+      }
+      else
+      {
+         result = EXIT_FAILURE;
+      }
+   }
+   else
    {
       scwx::qt::main::MainWindow w;
       w.show();
       result = a.exec();
    }
 
+   if (!traceFile.empty())
+   {
+      std::ofstream trace {traceFile, std::ios_base::trunc};
+      scwx::util::Profiler::WriteTrace(trace);
+      logger_->info("Profiler trace written: {}", traceFile);
+   }
+
    // Deinitialize application
    scwx::qt::manager::RadarProductManager::Cleanup();
 
@@ -146,9 +259,67 @@ int main(int argc, char* argv[])
    // Shutdown AWS SDK
    Aws::ShutdownAPI(awsSdkOptions);
 
+   // Shutdown logger
+   logManager.Shutdown();
+
    return result;
 }
 
+static std::optional<std::uint16_t> ParsePort(const std::string& value)
+{
+   std::uint16_t port = 0;
+
+   const char* end    = value.data() + value.size();
+   const auto  result = std::from_chars(value.data(), end, port);
+
+   if (result.ec != std::errc {} || result.ptr != end || port == 0)
+   {
+      return std::nullopt;
+   }
+
+   return port;
+}
+
+static void ConfigureReplay(const std::string& directory)
+{
+   // The replay starts at SCWX_REPLAY_START (e.g., 2024-05-06T18:00:00Z), and
+   // advances at SCWX_REPLAY_SPEED times wall-clock time
+   const auto startTime =
+      scwx::util::TryParseDateTime<std::chrono::seconds>(
+         "%Y-%m-%dT%H:%M:%SZ", scwx::util::GetEnvironment("SCWX_REPLAY_START"));
+
+   if (!startTime.has_value())
+   {
+      logger_->error("Replay requires a start time (SCWX_REPLAY_START)");
+      return;
+   }
+
+   double      speed    = 1.0;
+   std::string speedStr = scwx::util::GetEnvironment("SCWX_REPLAY_SPEED");
+   if (!speedStr.empty())
+   {
+      try
+      {
+         speed = std::stod(speedStr);
+      }
+      catch (const std::exception&)
+      {
+         logger_->warn("Invalid replay speed: {}", speedStr);
+      }
+   }
+
+   auto clock =
+      std::make_shared<const scwx::provider::ReplayClock>(*startTime, speed);
+
+   scwx::provider::NexradDataProviderFactory::SetReplay(directory, clock);
+   scwx::qt::manager::TextEventManager::SetReplay(directory, clock);
+
+   logger_->info("Replaying {} from {} at {}x speed",
+                 directory,
+                 scwx::util::TimeString(*startTime),
+                 clock->speed());
+}
+
 static void ConfigureTheme(const std::vector<std::string>& args)
 {
    auto& generalSettings = scwx::qt::settings::GeneralSettings::Instance();
@@ -9,6 +9,8 @@
 #include <scwx/qt/manager/marker_manager.hpp>
 #include <scwx/qt/manager/position_manager.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/manager/radar_site_prefetch_manager.hpp>
+#include <scwx/qt/manager/session_manager.hpp>
 #include <scwx/qt/manager/text_event_manager.hpp>
 #include <scwx/qt/manager/timeline_manager.hpp>
 #include <scwx/qt/manager/update_manager.hpp>
@@ -23,6 +25,7 @@
 #include <scwx/qt/ui/alert_dock_widget.hpp>
 #include <scwx/qt/ui/animation_dock_widget.hpp>
 #include <scwx/qt/ui/collapsible_group.hpp>
+#include <scwx/qt/ui/cross_section_dock_widget.hpp>
 #include <scwx/qt/ui/flow_layout.hpp>
 #include <scwx/qt/ui/gps_info_dialog.hpp>
 #include <scwx/qt/ui/imgui_debug_dialog.hpp>
@@ -30,25 +33,34 @@
 #include <scwx/qt/ui/level2_products_widget.hpp>
 #include <scwx/qt/ui/level2_settings_widget.hpp>
 #include <scwx/qt/ui/level3_products_widget.hpp>
+#include <scwx/qt/ui/loop_export_dialog.hpp>
+#include <scwx/qt/ui/map_prefetch_dialog.hpp>
 #include <scwx/qt/ui/placefile_dialog.hpp>
 #include <scwx/qt/ui/marker_dialog.hpp>
 #include <scwx/qt/ui/radar_site_dialog.hpp>
 #include <scwx/qt/ui/settings_dialog.hpp>
 #include <scwx/qt/ui/update_dialog.hpp>
 #include <scwx/common/characters.hpp>
+#include <scwx/common/geographic.hpp>
 #include <scwx/common/products.hpp>
 #include <scwx/common/vcp.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/memory.hpp>
+#include <scwx/util/strand.hpp>
 #include <scwx/util/time.hpp>
+#include <scwx/wsr88d/ar2v_export.hpp>
 
+#include <optional>
 #include <set>
+#include <vector>
 
-#include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
+#include <fmt/chrono.h>
 #include <QDesktopServices>
 #include <QKeyEvent>
 #include <QFileDialog>
+#include <QInputDialog>
 #include <QMessageBox>
+#include <QSignalBlocker>
 #include <QSplitter>
 #include <QStandardPaths>
 #include <QTimer>
@@ -64,13 +76,23 @@ namespace main
 static const std::string logPrefix_ = "scwx::qt::main::main_window";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static const std::vector<QSize> kLoopExportSizes_ {
+   {1280, 720}, {1920, 1080}, {2560, 1440}, {3840, 2160}};
+static constexpr int kDefaultLoopExportSize_ = 1;
+
+// Pane layouts of additional windows, limited by the panes in map settings
+static const std::vector<QSize> kWindowGridSizes_ {
+   {1, 1}, {2, 1}, {1, 2}, {2, 2}};
+
 class MainWindowImpl : public QObject
 {
    Q_OBJECT
 
 public:
-   explicit MainWindowImpl(MainWindow* mainWindow) :
+   explicit MainWindowImpl(MainWindow* mainWindow, QSize gridSize) :
        mainWindow_ {mainWindow},
+       primary_ {gridSize.isEmpty()},
+       gridSize_ {gridSize},
        settings_ {},
        activeMap_ {nullptr},
        mapSettingsGroup_ {nullptr},
@@ -83,10 +105,13 @@ public:
        level3ProductsWidget_ {nullptr},
        alertDockWidget_ {nullptr},
        animationDockWidget_ {nullptr},
+       crossSectionDockWidget_ {nullptr},
        aboutDialog_ {nullptr},
        gpsInfoDialog_ {nullptr},
        imGuiDebugDialog_ {nullptr},
        layerDialog_ {nullptr},
+       loopExportDialog_ {nullptr},
+       mapPrefetchDialog_ {nullptr},
        placefileDialog_ {nullptr},
        markerDialog_ {nullptr},
        radarSiteDialog_ {nullptr},
@@ -96,6 +121,9 @@ public:
        placefileManager_ {manager::PlacefileManager::Instance()},
        markerManager_ {manager::MarkerManager::Instance()},
        positionManager_ {manager::PositionManager::Instance()},
+       radarSitePrefetchManager_ {
+          manager::RadarSitePrefetchManager::Instance()},
+       sessionManager_ {manager::SessionManager::Instance()},
        textEventManager_ {manager::TextEventManager::Instance()},
        timelineManager_ {manager::TimelineManager::Instance()},
        updateManager_ {manager::UpdateManager::Instance()},
@@ -130,7 +158,9 @@ public:
          settings_.setApiKey(QString {mapProviderApiKey.c_str()});
       }
       settings_.setCacheDatabasePath(QString {cacheDbPath.c_str()});
-      settings_.setCacheDatabaseMaximumSize(20 * 1024 * 1024);
+      settings_.setCacheDatabaseMaximumSize(
+         settings::GeneralSettings::Instance().map_cache_size().GetValue() *
+         1024 * 1024);
 
       if (settings::GeneralSettings::Instance().track_location().GetValue())
       {
@@ -150,7 +180,10 @@ public:
          customStyleDrawLayerChangedCallbackUuid_);
 
       clockTimer_.stop();
-      threadPool_.join();
+      memoryTimer_.stop();
+      strand_.Join();
+
+      timelineManager_->UnregisterMaps(maps_.size());
    }
 
    void AddRadarSitePreset(const std::string& id);
@@ -165,6 +198,8 @@ public:
    void InitializeLayerDisplayActions();
    void PopulateCustomMapStyle();
    void PopulateMapStyles();
+   void RestoreSession();
+   void ResumeSession();
    void SelectElevation(map::MapWidget* mapWidget, float elevation);
    void SelectRadarProduct(map::MapWidget*           mapWidget,
                            common::RadarProductGroup group,
@@ -177,16 +212,36 @@ public:
    void UpdateRadarProductSelection(common::RadarProductGroup group,
                                     const std::string&        product);
    void UpdateRadarProductSettings();
+   void UpdateRadarThresholdLabel();
+   void UpdateCrossSection(map::MapWidget* mapWidget);
    void UpdateRadarSite();
    void UpdateVcp();
 
-   boost::asio::thread_pool threadPool_ {1u};
+   /**
+    * @brief Gets a dialog, constructing it on first use. Dialogs are not
+    * constructed with the main window, as most are seldom opened.
+    */
+   template<class Dialog, class... Args>
+   Dialog* GetDialog(Dialog*& dialog, Args&&... args);
+   ui::RadarSiteDialog* GetRadarSiteDialog();
+
+   // Update checks wait on the network
+   scwx::util::Strand strand_ {"Main Window",
+                               scwx::util::Strand::Priority::Blocking};
 
    MainWindow*         mainWindow_;
    QMapLibre::Settings settings_;
+
+   // The first window saves its layout and pane settings, and additional
+   // windows use their own pane layout
+   const bool  primary_;
+   const QSize gridSize_;
    map::MapProvider    mapProvider_;
    map::MapWidget*     activeMap_;
 
+   // Version of the level 3 products displayed for the active map
+   std::uint64_t level3ProductsVersion_ {0u};
+
    ui::CollapsibleGroup*     mapSettingsGroup_;
    ui::CollapsibleGroup*     level2ProductsGroup_;
    ui::CollapsibleGroup*     level2SettingsGroup_;
@@ -200,19 +255,26 @@ public:
    QLabel* coordinateLabel_ {nullptr};
    QLabel* timeLabel_ {nullptr};
 
-   ui::AlertDockWidget*     alertDockWidget_;
-   ui::AnimationDockWidget* animationDockWidget_;
-   ui::AboutDialog*         aboutDialog_;
-   ui::GpsInfoDialog*       gpsInfoDialog_;
-   ui::ImGuiDebugDialog*    imGuiDebugDialog_;
-   ui::LayerDialog*         layerDialog_;
-   ui::PlacefileDialog*     placefileDialog_;
-   ui::MarkerDialog*        markerDialog_;
-   ui::RadarSiteDialog*     radarSiteDialog_;
-   ui::SettingsDialog*      settingsDialog_;
-   ui::UpdateDialog*        updateDialog_;
+   ui::AlertDockWidget*        alertDockWidget_;
+   ui::AnimationDockWidget*    animationDockWidget_;
+   ui::CrossSectionDockWidget* crossSectionDockWidget_;
+   ui::AboutDialog*            aboutDialog_;
+   ui::GpsInfoDialog*          gpsInfoDialog_;
+   ui::ImGuiDebugDialog*       imGuiDebugDialog_;
+   ui::LayerDialog*            layerDialog_;
+   ui::LoopExportDialog*       loopExportDialog_;
+   ui::MapPrefetchDialog*      mapPrefetchDialog_;
+   ui::PlacefileDialog*        placefileDialog_;
+   ui::MarkerDialog*           markerDialog_;
+   ui::RadarSiteDialog*        radarSiteDialog_;
+   ui::SettingsDialog*         settingsDialog_;
+   ui::UpdateDialog*           updateDialog_;
+
+   // Last location of the active map, for dialogs constructed since
+   std::optional<common::Coordinate> activeMapPosition_ {};
 
    QTimer clockTimer_ {};
+   QTimer memoryTimer_ {};
 
    bool               customStyleAvailable_ {false};
    boost::uuids::uuid customStyleDrawLayerChangedCallbackUuid_ {};
@@ -224,6 +286,8 @@ public:
    std::shared_ptr<manager::PlacefileManager> placefileManager_;
    std::shared_ptr<manager::MarkerManager>    markerManager_;
    std::shared_ptr<manager::PositionManager>  positionManager_;
+   std::shared_ptr<manager::RadarSitePrefetchManager> radarSitePrefetchManager_;
+   std::shared_ptr<manager::SessionManager>           sessionManager_;
    std::shared_ptr<manager::TextEventManager> textEventManager_;
    std::shared_ptr<manager::TimelineManager>  timelineManager_;
    std::shared_ptr<manager::UpdateManager>    updateManager_;
@@ -241,8 +305,20 @@ public:
 
    std::vector<map::MapWidget*> maps_;
 
+   // Timeline index of the first map of the window
+   std::size_t timelineMapIndex_ {0};
+
    std::chrono::system_clock::time_point selectedTime_ {};
 
+   // Maps with an updated radar sweep that has not yet been painted
+   std::set<std::size_t> radarSweepPresentPending_ {};
+
+   // The previous session is resumed once the first radar image is presented,
+   // and is restored once the loop of a resumed animation has been loaded
+   bool                  sessionResumed_ {false};
+   bool                  resumeAnimation_ {false};
+   types::AnimationState animationState_ {types::AnimationState::Pause};
+
 public slots:
    void UpdateMapParameters(double latitude,
                             double longitude,
@@ -251,9 +327,20 @@ public slots:
                             double pitch);
 };
 
-MainWindow::MainWindow(QWidget* parent) :
+template<class Dialog, class... Args>
+Dialog* MainWindowImpl::GetDialog(Dialog*& dialog, Args&&... args)
+{
+   if (dialog == nullptr)
+   {
+      dialog = new Dialog(std::forward<Args>(args)...);
+   }
+
+   return dialog;
+}
+
+MainWindow::MainWindow(QWidget* parent, QSize gridSize) :
     QMainWindow(parent),
-    p(std::make_unique<MainWindowImpl>(this)),
+    p(std::make_unique<MainWindowImpl>(this, gridSize)),
     ui(new Ui::MainWindow)
 {
    ui->setupUi(this);
@@ -283,8 +370,10 @@ MainWindow::MainWindow(QWidget* parent) :
    p->alertDockWidget_ = new ui::AlertDockWidget(this);
    addDockWidget(Qt::BottomDockWidgetArea, p->alertDockWidget_);
 
-   // GPS Info Dialog
-   p->gpsInfoDialog_ = new ui::GpsInfoDialog(this);
+   // Configure Cross Section Dock
+   p->crossSectionDockWidget_ = new ui::CrossSectionDockWidget(this);
+   addDockWidget(Qt::BottomDockWidgetArea, p->crossSectionDockWidget_);
+   p->crossSectionDockWidget_->setVisible(false);
 
    // Configure Menu
    ui->menuView->insertAction(ui->actionRadarToolbox,
@@ -297,33 +386,27 @@ MainWindow::MainWindow(QWidget* parent) :
    p->alertDockWidget_->toggleViewAction()->setText(tr("&Alerts"));
    ui->actionAlerts->setVisible(false);
 
+   ui->menuView->insertAction(ui->actionAlerts,
+                              p->crossSectionDockWidget_->toggleViewAction());
+   p->crossSectionDockWidget_->toggleViewAction()->setText(
+      tr("&Cross Section"));
+
    ui->menuDebug->menuAction()->setVisible(
       settings::GeneralSettings::Instance().debug_enabled().GetValue());
 
    // Configure Map
    p->ConfigureMapLayout();
 
-   // Radar Site Dialog
-   p->radarSiteDialog_ = new ui::RadarSiteDialog(this);
-
-   // Placefile Manager Dialog
-   p->placefileDialog_ = new ui::PlacefileDialog(this);
-
-   // Marker Manager Dialog
-   p->markerDialog_ = new ui::MarkerDialog(this);
-
-   // Layer Dialog
-   p->layerDialog_ = new ui::LayerDialog(this);
-
-   // Settings Dialog
-   p->settingsDialog_ = new ui::SettingsDialog(this);
-
    // Map Settings
    p->mapSettingsGroup_ = new ui::CollapsibleGroup(tr("Map Settings"), this);
    p->mapSettingsGroup_->GetContentsLayout()->addWidget(ui->mapStyleLabel);
    p->mapSettingsGroup_->GetContentsLayout()->addWidget(ui->mapStyleComboBox);
    p->mapSettingsGroup_->GetContentsLayout()->addWidget(
       ui->smoothRadarDataCheckBox);
+   p->mapSettingsGroup_->GetContentsLayout()->addWidget(
+      ui->radarThresholdLabel);
+   p->mapSettingsGroup_->GetContentsLayout()->addWidget(
+      ui->radarThresholdSlider);
    p->mapSettingsGroup_->GetContentsLayout()->addWidget(
       ui->trackLocationCheckBox);
    ui->radarToolboxScrollAreaContents->layout()->replaceWidget(
@@ -393,15 +476,6 @@ MainWindow::MainWindow(QWidget* parent) :
    statusBarLayout->addWidget(p->timeLabel_, 0, 1);
    ui->statusbar->addPermanentWidget(statusBarWidget);
 
-   // ImGui Debug Dialog
-   p->imGuiDebugDialog_ = new ui::ImGuiDebugDialog(this);
-
-   // About Dialog
-   p->aboutDialog_ = new ui::AboutDialog(this);
-
-   // Update Dialog
-   p->updateDialog_ = new ui::UpdateDialog(this);
-
    auto& mapSettings = settings::MapSettings::Instance();
    for (size_t i = 0; i < p->maps_.size(); i++)
    {
@@ -419,6 +493,7 @@ MainWindow::MainWindow(QWidget* parent) :
    p->ConnectAnimationSignals();
    p->ConnectOtherSignals();
    p->HandleFocusChange(p->activeMap_);
+   p->RestoreSession();
    p->AsyncSetup();
 
    Application::FinishInitialization();
@@ -452,10 +527,14 @@ void MainWindow::showEvent(QShowEvent* event)
    QMainWindow::showEvent(event);
    auto& uiSettings = settings::UiSettings::Instance();
 
-   // restore the geometry state
-   std::string uiGeometry = uiSettings.main_ui_geometry().GetValue();
-   restoreGeometry(
-      QByteArray::fromBase64(QByteArray::fromStdString(uiGeometry)));
+   // restore the geometry state, unless an additional window, which would be
+   // placed over the first window
+   if (p->primary_)
+   {
+      std::string uiGeometry = uiSettings.main_ui_geometry().GetValue();
+      restoreGeometry(
+         QByteArray::fromBase64(QByteArray::fromStdString(uiGeometry)));
+   }
 
    // restore the UI state
    std::string uiState = uiSettings.main_ui_state().GetValue();
@@ -470,6 +549,12 @@ void MainWindow::showEvent(QShowEvent* event)
 
 void MainWindow::closeEvent(QCloseEvent* event)
 {
+   if (!p->primary_)
+   {
+      QMainWindow::closeEvent(event);
+      return;
+   }
+
    auto& uiSettings = settings::UiSettings::Instance();
 
    // save the UI geometry
@@ -579,9 +664,135 @@ void MainWindow::on_actionOpenTextEvent_triggered()
    dialog->open();
 }
 
+void MainWindow::on_actionNewWindow_triggered()
+{
+   QStringList layouts {};
+   for (auto& gridSize : kWindowGridSizes_)
+   {
+      layouts.append(
+         QString("%1 x %2").arg(gridSize.width()).arg(gridSize.height()));
+   }
+
+   bool    ok = false;
+   QString selectedLayout = QInputDialog::getItem(
+      this, tr("New Window"), tr("Pane layout:"), layouts, 0, false, &ok);
+   if (!ok)
+   {
+      return;
+   }
+
+   const auto layoutIndex =
+      static_cast<std::size_t>(layouts.indexOf(selectedLayout));
+
+   // Additional windows are owned by the first window, and close with it
+   QWidget* owner = p->primary_ ? this : parentWidget();
+
+   MainWindow* window =
+      new MainWindow(owner, kWindowGridSizes_.at(layoutIndex));
+   window->setWindowFlag(Qt::WindowType::Window);
+   window->setAttribute(Qt::WA_DeleteOnClose);
+   window->show();
+}
+
+void MainWindow::on_actionExportLoop_triggered()
+{
+   if (p->loopExportDialog_ != nullptr && p->loopExportDialog_->is_exporting())
+   {
+      // Show the progress of the export already in progress
+      p->loopExportDialog_->show();
+      return;
+   }
+
+   QStringList sizes {};
+   for (auto& size : kLoopExportSizes_)
+   {
+      sizes.append(QString("%1 x %2").arg(size.width()).arg(size.height()));
+   }
+
+   bool    ok = false;
+   QString selectedSize =
+      QInputDialog::getItem(this,
+                            tr("Export Loop"),
+                            tr("Image size:"),
+                            sizes,
+                            kDefaultLoopExportSize_,
+                            false,
+                            &ok);
+   if (!ok)
+   {
+      return;
+   }
+
+   QString directory =
+      QFileDialog::getExistingDirectory(this, tr("Export Loop to Directory"));
+   if (directory.isEmpty())
+   {
+      return;
+   }
+
+   const auto sizeIndex = static_cast<std::size_t>(sizes.indexOf(selectedSize));
+
+   p->GetDialog(p->loopExportDialog_, this)->StartExport(
+      p->activeMap_, kLoopExportSizes_.at(sizeIndex), directory);
+}
+
+void MainWindow::on_actionExportRadarData_triggered()
+{
+   std::shared_ptr<wsr88d::Ar2vFile> volume = p->activeMap_->GetLevel2Volume();
+
+   if (volume == nullptr)
+   {
+      QMessageBox* messageBox = new QMessageBox(this);
+      messageBox->setIcon(QMessageBox::Warning);
+      messageBox->setWindowTitle(tr("Export Radar Data"));
+      messageBox->setText(tr("No Level 2 volume is selected."));
+      messageBox->setAttribute(Qt::WA_DeleteOnClose);
+      messageBox->open();
+      return;
+   }
+
+   QString directory = QFileDialog::getExistingDirectory(
+      this, tr("Export Radar Data to Directory"));
+   if (directory.isEmpty())
+   {
+      return;
+   }
+
+   const std::string path = fmt::format(
+      "{}/{}_{:%Y%m%d_%H%M%S}.zarr",
+      directory.toStdString(),
+      volume->icao(),
+      std::chrono::floor<std::chrono::seconds>(volume->start_time()));
+
+   // Decoded sweeps are compressed and written in the background
+   p->strand_.Post(
+      [this, volume, path]()
+      {
+         const bool exported = wsr88d::ExportZarr(*volume, path);
+
+         QMetaObject::invokeMethod(
+            this,
+            [this, exported, path]()
+            {
+               QMessageBox* messageBox = new QMessageBox(this);
+               messageBox->setIcon(exported ? QMessageBox::Information :
+                                              QMessageBox::Warning);
+               messageBox->setWindowTitle(tr("Export Radar Data"));
+               messageBox->setText(
+                  QString("%1\n%2").arg(exported ?
+                                            tr("Radar data exported to:") :
+                                            tr("Unable to export radar data:"),
+                                         QDir::toNativeSeparators(
+                                            QString::fromStdString(path))));
+               messageBox->setAttribute(Qt::WA_DeleteOnClose);
+               messageBox->open();
+            });
+      });
+}
+
 void MainWindow::on_actionSettings_triggered()
 {
-   p->settingsDialog_->show();
+   p->GetDialog(p->settingsDialog_, this)->show();
 }
 
 void MainWindow::on_actionExit_triggered()
@@ -591,7 +802,7 @@ void MainWindow::on_actionExit_triggered()
 
 void MainWindow::on_actionGpsInfo_triggered()
 {
-   p->gpsInfoDialog_->show();
+   p->GetDialog(p->gpsInfoDialog_, this)->show();
 }
 
 void MainWindow::on_actionColorTable_triggered(bool checked)
@@ -616,22 +827,65 @@ void MainWindow::on_actionRadarSites_triggered(bool checked)
 
 void MainWindow::on_actionPlacefileManager_triggered()
 {
-   p->placefileDialog_->show();
+   p->GetDialog(p->placefileDialog_, this)->show();
 }
 
 void MainWindow::on_actionMarkerManager_triggered()
 {
-   p->markerDialog_->show();
+   p->GetDialog(p->markerDialog_, this)->show();
 }
 
 void MainWindow::on_actionLayerManager_triggered()
 {
-   p->layerDialog_->show();
+   p->GetDialog(p->layerDialog_, this)->show();
+}
+
+void MainWindow::on_actionPrefetchMapTiles_triggered()
+{
+   if (p->mapPrefetchDialog_ != nullptr &&
+       p->mapPrefetchDialog_->is_prefetching())
+   {
+      // Show the progress of the prefetch already in progress
+      p->mapPrefetchDialog_->show();
+      return;
+   }
+
+   std::vector<std::string> radarSites =
+      manager::RadarProductManager::ParseRadarSites(
+         settings::GeneralSettings::Instance()
+            .map_prefetch_radar_sites()
+            .GetValue());
+
+   // If no radar sites are configured, prefetch around the displayed sites
+   if (radarSites.empty())
+   {
+      for (map::MapWidget* map : p->maps_)
+      {
+         auto radarSite = map->GetRadarSite();
+         if (radarSite != nullptr &&
+             std::find(radarSites.cbegin(),
+                       radarSites.cend(),
+                       radarSite->id()) == radarSites.cend())
+         {
+            radarSites.push_back(radarSite->id());
+         }
+      }
+   }
+
+   const std::string styleUrl = p->activeMap_->GetMapStyleUrl();
+   if (styleUrl.empty())
+   {
+      logger_->warn("Map style is not loaded, unable to prefetch map tiles");
+      return;
+   }
+
+   p->GetDialog(p->mapPrefetchDialog_, p->settings_, this)
+      ->StartPrefetch(p->mapProvider_, styleUrl, radarSites);
 }
 
 void MainWindow::on_actionImGuiDebug_triggered()
 {
-   p->imGuiDebugDialog_->show();
+   p->GetDialog(p->imGuiDebugDialog_, this)->show();
 }
 
 void MainWindow::on_actionDumpLayerList_triggered()
@@ -642,6 +896,7 @@ void MainWindow::on_actionDumpLayerList_triggered()
 void MainWindow::on_actionDumpRadarProductRecords_triggered()
 {
    manager::RadarProductManager::DumpRecords();
+   scwx::util::LogMemoryUsage();
 }
 
 void MainWindow::on_actionRadarWireframe_triggered(bool checked)
@@ -666,38 +921,30 @@ void MainWindow::on_actionGitHubRepository_triggered()
 
 void MainWindow::on_actionCheckForUpdates_triggered()
 {
-   boost::asio::post(
-      p->threadPool_,
+   p->strand_.Post(
       [this]()
       {
-         try
-         {
-            if (!p->updateManager_->CheckForUpdates(main::kVersionString_))
-            {
-               QMetaObject::invokeMethod(
-                  this,
-                  [this]()
-                  {
-                     QMessageBox* messageBox = new QMessageBox(this);
-                     messageBox->setIcon(QMessageBox::Icon::Information);
-                     messageBox->setWindowTitle(tr("Check for Updates"));
-                     messageBox->setText(tr("Supercell Wx is up to date."));
-                     messageBox->setStandardButtons(
-                        QMessageBox::StandardButton::Ok);
-                     messageBox->show();
-                  });
-            }
-         }
-         catch (const std::exception& ex)
+         if (!p->updateManager_->CheckForUpdates(main::kVersionString_))
          {
-            logger_->error(ex.what());
+            QMetaObject::invokeMethod(
+               this,
+               [this]()
+               {
+                  QMessageBox* messageBox = new QMessageBox(this);
+                  messageBox->setIcon(QMessageBox::Icon::Information);
+                  messageBox->setWindowTitle(tr("Check for Updates"));
+                  messageBox->setText(tr("Supercell Wx is up to date."));
+                  messageBox->setStandardButtons(
+                     QMessageBox::StandardButton::Ok);
+                  messageBox->show();
+               });
          }
       });
 }
 
 void MainWindow::on_actionAboutSupercellWx_triggered()
 {
-   p->aboutDialog_->show();
+   p->GetDialog(p->aboutDialog_, this)->show();
 }
 
 void MainWindow::on_radarSiteHomeButton_clicked()
@@ -715,30 +962,102 @@ void MainWindow::on_radarSiteHomeButton_clicked()
 
 void MainWindow::on_radarSiteSelectButton_clicked()
 {
-   p->radarSiteDialog_->show();
+   p->GetRadarSiteDialog()->show();
 }
 
 void MainWindowImpl::AsyncSetup()
 {
    auto& generalSettings = settings::GeneralSettings::Instance();
 
-   // Check for updates
-   if (generalSettings.update_notifications_enabled().GetValue())
+   // Check for updates, once for the application
+   if (primary_ &&
+       generalSettings.update_notifications_enabled().GetValue())
+   {
+      strand_.Post(
+         [this]()
+         {
+            manager::UpdateManager::RemoveTemporaryReleases();
+            updateManager_->CheckForUpdates(main::kVersionString_);
+         });
+   }
+}
+
+void MainWindowImpl::RestoreSession()
+{
+   // Only the first window records and restores the session
+   if (!primary_)
+   {
+      return;
+   }
+
+   auto session = sessionManager_->previous_session();
+
+   if (session.has_value() && session->viewType_ == types::MapTime::Archive &&
+       session->archiveTime_ != std::chrono::system_clock::time_point {})
+   {
+      // Panes select the archived frame before any loop frames are loaded
+      animationDockWidget_->SelectArchiveTime(session->archiveTime_);
+   }
+   else
+   {
+      // The archive time is selected again if the archive view is selected
+      sessionManager_->SetViewType(types::MapTime::Live);
+      sessionManager_->SetArchiveTime({});
+   }
+
+   resumeAnimation_ = session.has_value() && session->animating_;
+
+   connect(timelineManager_.get(),
+           &manager::TimelineManager::ViewTypeUpdated,
+           mainWindow_,
+           [this](types::MapTime viewType)
+           { sessionManager_->SetViewType(viewType); });
+   connect(animationDockWidget_,
+           &ui::AnimationDockWidget::DateTimeChanged,
+           mainWindow_,
+           [this](std::chrono::system_clock::time_point dateTime)
+           { sessionManager_->SetArchiveTime(dateTime); });
+   connect(timelineManager_.get(),
+           &manager::TimelineManager::AnimationStateUpdated,
+           mainWindow_,
+           [this](types::AnimationState state)
+           {
+              animationState_ = state;
+              sessionManager_->SetAnimating(state ==
+                                            types::AnimationState::Play);
+           });
+   connect(timelineManager_.get(),
+           &manager::TimelineManager::LoopFramesLoaded,
+           mainWindow_,
+           [this]()
+           {
+              if (resumeAnimation_)
+              {
+                 resumeAnimation_ = false;
+                 Application::SessionRestored();
+              }
+           });
+}
+
+void MainWindowImpl::ResumeSession()
+{
+   if (!primary_ || sessionResumed_)
+   {
+      return;
+   }
+
+   sessionResumed_ = true;
+
+   if (resumeAnimation_ && animationState_ == types::AnimationState::Pause)
+   {
+      // Visible frames have been presented, and loop frames are loaded next.
+      // Lower priority work waits until the loop has been loaded.
+      timelineManager_->AnimationPlayPause();
+   }
+   else
    {
-      boost::asio::post(threadPool_,
-                        [this]()
-                        {
-                           try
-                           {
-                              manager::UpdateManager::RemoveTemporaryReleases();
-                              updateManager_->CheckForUpdates(
-                                 main::kVersionString_);
-                           }
-                           catch (const std::exception& ex)
-                           {
-                              logger_->error(ex.what());
-                           }
-                        });
+      resumeAnimation_ = false;
+      Application::SessionRestored();
    }
 }
 
@@ -746,9 +1065,14 @@ void MainWindowImpl::ConfigureMapLayout()
 {
    auto& generalSettings = settings::GeneralSettings::Instance();
 
-   const int64_t gridWidth  = generalSettings.grid_width().GetValue();
-   const int64_t gridHeight = generalSettings.grid_height().GetValue();
-   const int64_t mapCount   = gridWidth * gridHeight;
+   int64_t gridWidth  = gridSize_.width();
+   int64_t gridHeight = gridSize_.height();
+   if (primary_)
+   {
+      gridWidth  = generalSettings.grid_width().GetValue();
+      gridHeight = generalSettings.grid_height().GetValue();
+   }
+   const int64_t mapCount = gridWidth * gridHeight;
 
    size_t mapIndex = 0;
 
@@ -756,7 +1080,7 @@ void MainWindowImpl::ConfigureMapLayout()
    vs->setHandleWidth(1);
 
    maps_.resize(mapCount);
-   timelineManager_->SetMapCount(mapCount);
+   timelineMapIndex_ = timelineManager_->RegisterMaps(maps_.size());
 
    auto MoveSplitter = [=, this](int /*pos*/, int /*index*/)
    {
@@ -824,7 +1148,7 @@ void MainWindowImpl::ConfigureMapStyles()
             UpdateMapStyle(styleName);
          }
       }
-      else if (!mapProviderInfo.mapStyles_.empty())
+      else if (primary_ && !mapProviderInfo.mapStyles_.empty())
       {
          // Stage first valid map style from map provider
          mapSettings.map_style(i).StageValue(
@@ -940,17 +1264,32 @@ void MainWindowImpl::ConnectMapSignals()
                UpdateRadarProductSettings();
                UpdateRadarSite();
                UpdateVcp();
+               UpdateCrossSection(mapWidget);
             }
          },
          Qt::QueuedConnection);
 
+      connect(mapWidget,
+              &map::MapWidget::CrossSectionLineChanged,
+              this,
+              [&]()
+              {
+                 if (mapWidget == activeMap_)
+                 {
+                    UpdateCrossSection(mapWidget);
+                 }
+              });
+
       connect(
          mapWidget,
          &map::MapWidget::Level3ProductsChanged,
          this,
          [&]()
          {
-            if (mapWidget == activeMap_)
+            // Changes queued before the products were last updated have
+            // already been displayed
+            if (mapWidget == activeMap_ &&
+                mapWidget->GetLevel3ProductsVersion() != level3ProductsVersion_)
             {
                UpdateAvailableLevel3Products();
             }
@@ -1004,6 +1343,7 @@ void MainWindowImpl::ConnectAnimationSignals()
 
    connect(timelineManager_.get(),
            &manager::TimelineManager::SelectedTimeUpdated,
+           mainWindow_,
            [this](std::chrono::system_clock::time_point dateTime)
            {
               selectedTime_ = dateTime;
@@ -1011,10 +1351,10 @@ void MainWindowImpl::ConnectAnimationSignals()
               for (auto map : maps_)
               {
                  map->SelectTime(dateTime);
-                 QMetaObject::invokeMethod(
-                    map, static_cast<void (QWidget::*)()>(&QWidget::update));
+                 map->RequestFrame();
               }
-           });
+           },
+           Qt::DirectConnection);
 
    connect(timelineManager_.get(),
            &manager::TimelineManager::AnimationStateUpdated,
@@ -1030,29 +1370,54 @@ void MainWindowImpl::ConnectAnimationSignals()
            &ui::AnimationDockWidget::UpdateLiveState);
    connect(timelineManager_.get(),
            &manager::TimelineManager::LiveStateUpdated,
+           mainWindow_,
            [this](bool isLive)
            {
               for (auto map : maps_)
               {
                  map->SetAutoUpdate(isLive);
               }
-           });
+           },
+           Qt::DirectConnection);
 
    for (std::size_t i = 0; i < maps_.size(); i++)
    {
+      // Maps are indexed by the timeline across every window
+      const std::size_t timelineIndex = timelineMapIndex_ + i;
+
       connect(maps_[i],
               &map::MapWidget::RadarSweepUpdated,
               timelineManager_.get(),
-              [=, this]() { timelineManager_->ReceiveRadarSweepUpdated(i); });
+              [=, this]()
+              { timelineManager_->ReceiveRadarSweepUpdated(timelineIndex); });
       connect(maps_[i],
               &map::MapWidget::RadarSweepNotUpdated,
               timelineManager_.get(),
               [=, this](types::NoUpdateReason reason)
-              { timelineManager_->ReceiveRadarSweepNotUpdated(i, reason); });
+              {
+                 timelineManager_->ReceiveRadarSweepNotUpdated(timelineIndex,
+                                                               reason);
+              });
       connect(maps_[i],
               &map::MapWidget::WidgetPainted,
               timelineManager_.get(),
-              [=, this]() { timelineManager_->ReceiveMapWidgetPainted(i); });
+              [=, this]()
+              { timelineManager_->ReceiveMapWidgetPainted(timelineIndex); });
+      connect(maps_[i],
+              &map::MapWidget::RadarSweepUpdated,
+              mainWindow_,
+              [=, this]() { radarSweepPresentPending_.insert(i); });
+      connect(maps_[i],
+              &map::MapWidget::WidgetPainted,
+              mainWindow_,
+              [=, this]()
+              {
+                 if (radarSweepPresentPending_.erase(i) > 0)
+                 {
+                    Application::RadarImagePresented();
+                    ResumeSession();
+                 }
+              });
       connect(maps_[i],
               &map::MapWidget::RadarSiteRequested,
               this,
@@ -1082,7 +1447,7 @@ void MainWindowImpl::ConnectOtherSignals()
               activeMap_->SetMapStyle(text.toStdString());
 
               // Update settings for active map
-              for (std::size_t i = 0; i < maps_.size(); ++i)
+              for (std::size_t i = 0; primary_ && i < maps_.size(); ++i)
               {
                  if (maps_[i] == activeMap_)
                  {
@@ -1101,7 +1466,7 @@ void MainWindowImpl::ConnectOtherSignals()
          const bool smoothingEnabled = (state == Qt::CheckState::Checked);
 
          auto it = std::find(maps_.cbegin(), maps_.cend(), activeMap_);
-         if (it != maps_.cend())
+         if (primary_ && it != maps_.cend())
          {
             const std::size_t i = std::distance(maps_.cbegin(), it);
             settings::MapSettings::Instance().smoothing_enabled(i).StageValue(
@@ -1111,6 +1476,20 @@ void MainWindowImpl::ConnectOtherSignals()
          // Turn on smoothing
          activeMap_->SetSmoothingEnabled(smoothingEnabled);
       });
+   connect(mainWindow_->ui->radarThresholdSlider,
+           &QSlider::valueChanged,
+           mainWindow_,
+           [this](int value)
+           {
+              // The minimum slider position shows all bins
+              const std::uint16_t level =
+                 (value > mainWindow_->ui->radarThresholdSlider->minimum()) ?
+                    static_cast<std::uint16_t>(value) :
+                    0u;
+
+              activeMap_->SetThresholdLevel(level);
+              UpdateRadarThresholdLabel();
+           });
    connect(mainWindow_->ui->trackLocationCheckBox,
            &QCheckBox::checkStateChanged,
            mainWindow_,
@@ -1144,6 +1523,16 @@ void MainWindowImpl::ConnectOtherSignals()
            &ui::Level2SettingsWidget::ElevationSelected,
            mainWindow_,
            [&](float elevation) { SelectElevation(activeMap_, elevation); });
+   connect(crossSectionDockWidget_,
+           &QDockWidget::visibilityChanged,
+           this,
+           [this](bool visible)
+           {
+              for (map::MapWidget* map : maps_)
+              {
+                 map->SetCrossSectionEnabled(visible);
+              }
+           });
    connect(mainWindow_,
            &MainWindow::ActiveMapMoved,
            alertDockWidget_,
@@ -1165,8 +1554,11 @@ void MainWindowImpl::ConnectOtherSignals()
       Qt::QueuedConnection);
    connect(mainWindow_,
            &MainWindow::ActiveMapMoved,
-           radarSiteDialog_,
-           &ui::RadarSiteDialog::HandleMapUpdate);
+           this,
+           [this](double latitude, double longitude)
+           {
+              activeMapPosition_ = common::Coordinate {latitude, longitude};
+           });
    connect(layerModel_.get(),
            &model::LayerModel::LayerDisplayChanged,
            this,
@@ -1200,22 +1592,9 @@ void MainWindowImpl::ConnectOtherSignals()
            &QAbstractItemModel::modelReset,
            this,
            [this]() { InitializeLayerDisplayActions(); });
-   connect(radarSiteDialog_,
-           &ui::RadarSiteDialog::accepted,
-           this,
-           [&]()
-           {
-              std::string selectedRadarSite = radarSiteDialog_->radar_site();
-
-              for (map::MapWidget* map : maps_)
-              {
-                 map->SelectRadarSite(selectedRadarSite);
-              }
-
-              UpdateRadarSite();
-           });
    connect(radarSiteModel_.get(),
            &model::RadarSiteModel::PresetToggled,
+           mainWindow_,
            [this](const std::string& siteId, bool isPreset)
            {
               if (isPreset && !radarSitePresetsActions_.contains(siteId))
@@ -1241,8 +1620,9 @@ void MainWindowImpl::ConnectOtherSignals()
            [this](const std::string&        latestVersion,
                   const types::gh::Release& latestRelease)
            {
-              updateDialog_->UpdateReleaseInfo(latestVersion, latestRelease);
-              updateDialog_->show();
+              auto updateDialog = GetDialog(updateDialog_, mainWindow_);
+              updateDialog->UpdateReleaseInfo(latestVersion, latestRelease);
+              updateDialog->show();
            });
 
    connect(&clockTimer_,
@@ -1255,6 +1635,13 @@ void MainWindowImpl::ConnectOtherSignals()
               timeLabel_->setVisible(true);
            });
    clockTimer_.start(1000);
+
+   // Periodically log memory usage, to track growth over long sessions
+   connect(&memoryTimer_,
+           &QTimer::timeout,
+           this,
+           []() { scwx::util::LogMemoryUsage(); });
+   memoryTimer_.start(std::chrono::minutes {10});
 }
 
 void MainWindowImpl::InitializeLayerDisplayActions()
@@ -1440,6 +1827,7 @@ void MainWindowImpl::SetActiveMap(map::MapWidget* mapWidget)
 
 void MainWindowImpl::UpdateAvailableLevel3Products()
 {
+   level3ProductsVersion_ = activeMap_->GetLevel3ProductsVersion();
    level3ProductsWidget_->UpdateAvailableProducts(
       activeMap_->GetAvailableLevel3Categories());
 }
@@ -1467,7 +1855,7 @@ void MainWindowImpl::UpdateMapStyle(const std::string& styleName)
       mainWindow_->ui->mapStyleComboBox->setCurrentIndex(index);
 
       // Update settings for active map
-      for (std::size_t i = 0; i < maps_.size(); ++i)
+      for (std::size_t i = 0; primary_ && i < maps_.size(); ++i)
       {
          if (maps_[i] == activeMap_)
          {
@@ -1504,6 +1892,63 @@ void MainWindowImpl::UpdateRadarProductSettings()
 
    mainWindow_->ui->actionRadarWireframe->setChecked(
       activeMap_->GetRadarWireframeEnabled());
+
+   // Threshold levels span the color table of the radar product
+   auto levelRange = activeMap_->GetDataLevelRange();
+   auto slider     = mainWindow_->ui->radarThresholdSlider;
+
+   const QSignalBlocker blocker {slider};
+   if (levelRange.has_value() && levelRange->first < levelRange->second)
+   {
+      const std::uint16_t level = activeMap_->GetThresholdLevel();
+
+      slider->setEnabled(true);
+      slider->setRange(levelRange->first, levelRange->second);
+      slider->setValue((level > 0u) ? level : levelRange->first);
+   }
+   else
+   {
+      slider->setEnabled(false);
+      slider->setRange(0, 0);
+   }
+
+   UpdateRadarThresholdLabel();
+}
+
+void MainWindowImpl::UpdateRadarThresholdLabel()
+{
+   const std::uint16_t level = activeMap_->GetThresholdLevel();
+   std::string         text {};
+
+   if (level > 0u)
+   {
+      text = activeMap_->GetDataLevelText(level);
+   }
+
+   mainWindow_->ui->radarThresholdLabel->setText(
+      tr("Minimum Value: %1")
+         .arg(text.empty() ? tr("Off") : QString::fromStdString(text)));
+}
+
+void MainWindowImpl::UpdateCrossSection(map::MapWidget* mapWidget)
+{
+   auto line = mapWidget->GetCrossSectionLine();
+   if (!line.has_value())
+   {
+      return;
+   }
+
+   common::Coordinate radarSiteCoordinate {};
+
+   std::shared_ptr<config::RadarSite> radarSite = mapWidget->GetRadarSite();
+   if (radarSite != nullptr)
+   {
+      radarSiteCoordinate = {radarSite->latitude(), radarSite->longitude()};
+   }
+
+   crossSectionDockWidget_->SelectVolume(mapWidget->GetLevel2Volume(),
+                                         radarSiteCoordinate);
+   crossSectionDockWidget_->SetLine(line->first, line->second);
 }
 
 void MainWindowImpl::UpdateRadarSite()
@@ -1560,6 +2005,43 @@ void MainWindowImpl::UpdateVcp()
    }
 }
 
+ui::RadarSiteDialog* MainWindowImpl::GetRadarSiteDialog()
+{
+   if (radarSiteDialog_ == nullptr)
+   {
+      radarSiteDialog_ = new ui::RadarSiteDialog(mainWindow_);
+
+      // Begin with the location of the active map when constructed
+      if (activeMapPosition_.has_value())
+      {
+         radarSiteDialog_->HandleMapUpdate(activeMapPosition_->latitude_,
+                                           activeMapPosition_->longitude_);
+      }
+
+      connect(mainWindow_,
+              &MainWindow::ActiveMapMoved,
+              radarSiteDialog_,
+              &ui::RadarSiteDialog::HandleMapUpdate);
+      connect(radarSiteDialog_,
+              &ui::RadarSiteDialog::accepted,
+              this,
+              [this]()
+              {
+                 std::string selectedRadarSite =
+                    radarSiteDialog_->radar_site();
+
+                 for (map::MapWidget* map : maps_)
+                 {
+                    map->SelectRadarSite(selectedRadarSite);
+                 }
+
+                 UpdateRadarSite();
+              });
+   }
+
+   return radarSiteDialog_;
+}
+
 } // namespace main
 } // namespace qt
 } // namespace scwx
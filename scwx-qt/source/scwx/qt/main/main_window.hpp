@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QMainWindow>
+#include <QSize>
 
 QT_BEGIN_NAMESPACE
 namespace Ui
@@ -23,7 +24,14 @@ class MainWindow : public QMainWindow
    Q_OBJECT
 
 public:
-   MainWindow(QWidget* parent = nullptr);
+   /**
+    * @param [in] parent Parent widget
+    * @param [in] gridSize Pane layout of an additional window, which shares
+    * radar data with the first window. An additional window does not save
+    * its layout or pane settings. The first window uses the layout in
+    * settings.
+    */
+   MainWindow(QWidget* parent = nullptr, QSize gridSize = {});
    ~MainWindow();
 
    void keyPressEvent(QKeyEvent* ev) override final;
@@ -37,6 +45,9 @@ signals:
 private slots:
    void on_actionOpenNexrad_triggered();
    void on_actionOpenTextEvent_triggered();
+   void on_actionNewWindow_triggered();
+   void on_actionExportLoop_triggered();
+   void on_actionExportRadarData_triggered();
    void on_actionSettings_triggered();
    void on_actionExit_triggered();
    void on_actionGpsInfo_triggered();
@@ -46,6 +57,7 @@ private slots:
    void on_actionPlacefileManager_triggered();
    void on_actionMarkerManager_triggered();
    void on_actionLayerManager_triggered();
+   void on_actionPrefetchMapTiles_triggered();
    void on_actionImGuiDebug_triggered();
    void on_actionDumpLayerList_triggered();
    void on_actionDumpRadarProductRecords_triggered();
@@ -6,11 +6,10 @@
 #include <scwx/qt/types/location_types.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/strand.hpp>
 #include <scwx/qt/config/radar_site.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 
-#include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include <QGeoPositionInfo>
 
@@ -43,29 +42,19 @@ public:
          self_,
          [this](const types::TextEventKey& key, size_t messageIndex)
          {
-            boost::asio::post(threadPool_,
-                              [=, this]()
-                              {
-                                 try
-                                 {
-                                    HandleAlert(key, messageIndex);
-                                 }
-                                 catch (const std::exception& ex)
-                                 {
-                                    logger_->error(ex.what());
-                                 }
-                              });
+            strand_.Post([=, this]() { HandleAlert(key, messageIndex); });
          });
    }
 
-   ~Impl() { threadPool_.join(); }
+   ~Impl() { strand_.Join(); }
 
    common::Coordinate
         CurrentCoordinate(types::LocationMethod locationMethod) const;
    void HandleAlert(const types::TextEventKey& key, size_t messageIndex) const;
    void UpdateLocationTracking(const std::string& value) const;
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::Strand strand_ {"Alert Manager",
+                               scwx::util::Strand::Priority::Background};
 
    AlertManager* self_;
 
@@ -148,8 +137,9 @@ void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
    types::LocationMethod    locationMethod = types::GetLocationMethod(
       audioSettings.alert_location_method().GetValue());
    common::Coordinate currentCoordinate = CurrentCoordinate(locationMethod);
-   std::string        alertCounty = audioSettings.alert_county().GetValue();
-   auto               alertRadius = units::length::kilometers<double>(
+   std::optional<std::uint32_t> alertCounty =
+      awips::Ugc::GetFipsCode(audioSettings.alert_county().GetValue());
+   auto alertRadius = units::length::kilometers<double>(
       audioSettings.alert_radius().GetValue());
    std::string alertWFO = audioSettings.alert_wfo().GetValue();
 
@@ -190,10 +180,13 @@ void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
       }
       else if (locationMethod == types::LocationMethod::County)
       {
-         // Determine if the alert contains the current county
-         auto fipsIds = segment->header_->ugc_.fips_ids();
-         auto it = std::find(fipsIds.cbegin(), fipsIds.cend(), alertCounty);
-         activeAtLocation = it != fipsIds.cend();
+         // Determine if the alert contains the current county, comparing FIPS
+         // codes instead of formatting and comparing FIPS ID strings
+         auto fipsCodes   = segment->header_->ugc_.fips_codes();
+         activeAtLocation = alertCounty.has_value() &&
+                            std::find(fipsCodes.cbegin(),
+                                      fipsCodes.cend(),
+                                      *alertCounty) != fipsCodes.cend();
       }
       else if (locationMethod == types::LocationMethod::WFO)
       {
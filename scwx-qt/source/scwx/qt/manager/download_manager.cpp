@@ -1,8 +1,15 @@
 #include <scwx/qt/manager/download_manager.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/network/cpr.hpp>
 #include <scwx/util/digest.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <array>
+#include <deque>
 #include <fstream>
+#include <mutex>
+#include <unordered_map>
 
 #include <boost/asio/post.hpp>
 #include <boost/asio/thread_pool.hpp>
@@ -18,16 +25,37 @@ namespace manager
 static const std::string logPrefix_ = "scwx::qt::manager::download_manager";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Maximum number of concurrent downloads, in total and to a single host
+static constexpr std::size_t kMaxDownloads_        = 4u;
+static constexpr std::size_t kMaxDownloadsPerHost_ = 2u;
+
+// Number of download request priorities
+static constexpr std::size_t kPriorityCount_ = 3u;
+
 class DownloadManager::Impl
 {
 public:
+   struct QueuedDownload
+   {
+      std::shared_ptr<request::DownloadRequest> request_;
+      std::string                               host_;
+   };
+
    explicit Impl(DownloadManager* self) : self_ {self} {}
 
    ~Impl() { threadPool_.join(); }
 
    void DownloadSync(const std::shared_ptr<request::DownloadRequest>& request);
+   void FinishDownload(const std::string& host);
+   void StartDownloads();
+
+   boost::asio::thread_pool threadPool_ {kMaxDownloads_};
 
-   boost::asio::thread_pool threadPool_ {1u};
+   // Queued downloads by priority, and the number of active downloads
+   std::array<std::deque<QueuedDownload>, kPriorityCount_> queue_ {};
+   std::unordered_map<std::string, std::size_t>            activeHosts_ {};
+   std::size_t                                             activeCount_ {0u};
+   std::mutex                                              queueMutex_ {};
 
    DownloadManager* self_;
 };
@@ -38,23 +66,82 @@ DownloadManager::~DownloadManager() = default;
 void DownloadManager::Download(
    const std::shared_ptr<request::DownloadRequest>& request)
 {
-   boost::asio::post(p->threadPool_,
-                     [=, this]()
-                     {
-                        try
-                        {
-                           p->DownloadSync(request);
-                        }
-                        catch (const std::exception& ex)
-                        {
-                           logger_->error(ex.what());
-                        }
-                     });
+   std::unique_lock lock {p->queueMutex_};
+
+   p->queue_.at(static_cast<std::size_t>(request->priority()))
+      .push_back({request, network::cpr::GetHost(request->url())});
+
+   p->StartDownloads();
+}
+
+void DownloadManager::Impl::StartDownloads()
+{
+   // Start the highest priority downloads first, skipping downloads to hosts
+   // which are at their connection limit
+   for (auto& lane : queue_)
+   {
+      for (auto it = lane.begin();
+           it != lane.end() && activeCount_ < kMaxDownloads_;)
+      {
+         if (activeHosts_[it->host_] >= kMaxDownloadsPerHost_)
+         {
+            ++it;
+            continue;
+         }
+
+         QueuedDownload download = std::move(*it);
+         it                      = lane.erase(it);
+
+         ++activeCount_;
+         ++activeHosts_[download.host_];
+
+         boost::asio::post(threadPool_,
+                           [download, this]()
+                           {
+                              try
+                              {
+                                 DownloadSync(download.request_);
+                              }
+                              catch (const std::exception& ex)
+                              {
+                                 logger_->error(ex.what());
+                              }
+
+                              FinishDownload(download.host_);
+                           });
+      }
+   }
+}
+
+void DownloadManager::Impl::FinishDownload(const std::string& host)
+{
+   std::unique_lock lock {queueMutex_};
+
+   --activeCount_;
+
+   auto it = activeHosts_.find(host);
+   if (it != activeHosts_.end() && --it->second == 0u)
+   {
+      activeHosts_.erase(it);
+   }
+
+   StartDownloads();
 }
 
 void DownloadManager::Impl::DownloadSync(
    const std::shared_ptr<request::DownloadRequest>& request)
 {
+   if (request->IsCanceled())
+   {
+      // Canceled while queued
+      logger_->info("Download request cancelled: {}", request->url());
+
+      Q_EMIT request->RequestComplete(
+         request::DownloadRequest::CompleteReason::Canceled);
+
+      return;
+   }
+
    // Prepare destination file
    const std::filesystem::path& destinationPath = request->destination_path();
 
@@ -122,45 +209,68 @@ void DownloadManager::Impl::DownloadSync(
    cpr::cpr_off_t                        lastDownloadNow {};
    cpr::cpr_off_t                        lastDownloadTotal {};
 
-   // Download file
-   cpr::Response response = cpr::Get(
-      cpr::Url {request->url()},
-      cpr::ProgressCallback(
-         [&](cpr::cpr_off_t downloadTotal,
-             cpr::cpr_off_t downloadNow,
-             cpr::cpr_off_t /* uploadTotal */,
-             cpr::cpr_off_t /* uploadNow */,
-             std::intptr_t /* userdata */)
-         {
-            using namespace std::chrono_literals;
-
-            std::chrono::system_clock::time_point now =
-               std::chrono::system_clock::now();
-
-            // Only emit an update every 100ms
-            if ((now > lastUpdated + 100ms || downloadNow == downloadTotal) &&
-                (downloadNow != lastDownloadNow ||
-                 downloadTotal != lastDownloadTotal))
-            {
-               logger_->trace(
-                  "Downloaded: {} / {}", downloadNow, downloadTotal);
-
-               Q_EMIT request->ProgressUpdated(downloadNow, downloadTotal);
-
-               lastUpdated       = now;
-               lastDownloadNow   = downloadNow;
-               lastDownloadTotal = downloadTotal;
-            }
-
-            return !request->IsCanceled();
-         }),
-      cpr::WriteCallback(
-         [&](const std::string_view& data, std::intptr_t /* userdata */)
+   // Download file. The session uses callbacks, so it is not pooled, but still
+   // shares TLS sessions and DNS lookups with pooled sessions.
+   cpr::Session session {};
+   session.SetUrl(cpr::Url {request->url()});
+   session.SetProgressCallback(cpr::ProgressCallback(
+      [&](cpr::cpr_off_t downloadTotal,
+          cpr::cpr_off_t downloadNow,
+          cpr::cpr_off_t /* uploadTotal */,
+          cpr::cpr_off_t /* uploadNow */,
+          std::intptr_t /* userdata */)
+      {
+         using namespace std::chrono_literals;
+
+         std::chrono::system_clock::time_point now =
+            std::chrono::system_clock::now();
+
+         // Only emit an update every 100ms
+         if ((now > lastUpdated + 100ms || downloadNow == downloadTotal) &&
+             (downloadNow != lastDownloadNow ||
+              downloadTotal != lastDownloadTotal))
          {
-            // Write file
-            ofs << data;
-            return !request->IsCanceled();
-         }));
+            SPDLOG_LOGGER_TRACE(logger_,
+                                "Downloaded: {} / {}",
+                                downloadNow,
+                                downloadTotal);
+
+            Q_EMIT request->ProgressUpdated(downloadNow, downloadTotal);
+
+            lastUpdated       = now;
+            lastDownloadNow   = downloadNow;
+            lastDownloadTotal = downloadTotal;
+         }
+
+         return !request->IsCanceled();
+      }));
+   session.SetWriteCallback(cpr::WriteCallback(
+      [&](const std::string_view& data, std::intptr_t /* userdata */)
+      {
+         // Write file
+         ofs << data;
+         return !request->IsCanceled();
+      }));
+   network::cpr::ConfigureSession(session);
+
+   // The bandwidth limit is shared between active downloads
+   auto&              generalSettings = settings::GeneralSettings::Instance();
+   const std::int64_t bandwidthLimit =
+      generalSettings.download_bandwidth_limit().GetValue();
+   if (bandwidthLimit > 0)
+   {
+      std::size_t activeCount;
+
+      {
+         std::unique_lock lock {queueMutex_};
+         activeCount = std::max<std::size_t>(activeCount_, 1u);
+      }
+
+      session.SetLimitRate(cpr::LimitRate {
+         bandwidthLimit * 1024 / static_cast<std::int64_t>(activeCount), 0});
+   }
+
+   cpr::Response response = session.Get();
 
    bool ofsGood = ofs.good();
    ofs.close();
@@ -1,8 +1,10 @@
 #include <scwx/qt/manager/font_manager.hpp>
 #include <scwx/qt/manager/settings_manager.hpp>
+#include <scwx/qt/model/imgui_context_model.hpp>
 #include <scwx/qt/settings/text_settings.hpp>
 #include <scwx/util/environment.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/strand.hpp>
 
 #include <filesystem>
 #include <fstream>
@@ -13,10 +15,12 @@
 #include <QGuiApplication>
 #include <QStandardPaths>
 #include <boost/container_hash/hash.hpp>
+#include <boost/timer/timer.hpp>
 #include <boost/unordered/unordered_flat_map.hpp>
 #include <boost/unordered/unordered_flat_set.hpp>
 #include <fmt/ranges.h>
 #include <fontconfig/fontconfig.h>
+#include <imgui.h>
 
 namespace scwx
 {
@@ -58,8 +62,13 @@ public:
       InitializeFontconfig();
       ConnectSignals();
    }
-   ~Impl() { FinalizeFontconfig(); }
+   ~Impl()
+   {
+      strand_.Join();
+      FinalizeFontconfig();
+   }
 
+   void BuildImGuiFontAtlasAsync();
    void ConnectSignals();
    void FinalizeFontconfig();
    void InitializeEnvironment();
@@ -102,6 +111,8 @@ public:
    std::mutex                                     dirtyFontsMutex_ {};
 
    boost::unordered_flat_map<types::Font, int> fontIds_ {};
+
+   scwx::util::Strand strand_ {"Font Manager"};
 };
 
 FontManager::FontManager() : p(std::make_unique<Impl>(this)) {}
@@ -145,6 +156,11 @@ void FontManager::Impl::ConnectSignals()
       {
          std::scoped_lock lock {dirtyFontsMutex_, fontCategoryMutex_};
 
+         if (dirtyFonts_.empty())
+         {
+            return;
+         }
+
          for (auto fontCategory : dirtyFonts_)
          {
             UpdateImGuiFont(fontCategory);
@@ -152,6 +168,8 @@ void FontManager::Impl::ConnectSignals()
          }
 
          dirtyFonts_.clear();
+
+         BuildImGuiFontAtlasAsync();
       });
 }
 
@@ -162,6 +180,39 @@ void FontManager::InitializeFonts()
       p->UpdateImGuiFont(fontCategory);
       p->UpdateQFont(fontCategory);
    }
+
+   p->BuildImGuiFontAtlasAsync();
+}
+
+void FontManager::Impl::BuildImGuiFontAtlasAsync()
+{
+   // Rasterize fonts added to the ImGui font atlas in the background, so the
+   // next frame only needs to upload the atlas texture. If a frame builds the
+   // atlas first, there is nothing left to do.
+   strand_.Post(
+      [this]()
+      {
+         std::unique_lock imguiFontAtlasLock {imguiFontAtlasMutex_};
+
+         ImFontAtlas* fontAtlas =
+            model::ImGuiContextModel::Instance().font_atlas();
+
+         if (!fontAtlas->IsBuilt())
+         {
+            boost::timer::cpu_timer timer {};
+
+            unsigned char* pixels;
+            int            width;
+            int            height;
+            fontAtlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+            timer.stop();
+            logger_->debug("ImGui font atlas ({}x{}) built in {}",
+                           width,
+                           height,
+                           timer.format(6, "%ws"));
+         }
+      });
 }
 
 void FontManager::Impl::UpdateImGuiFont(types::FontCategory fontCategory)
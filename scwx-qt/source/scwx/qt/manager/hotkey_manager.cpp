@@ -66,9 +66,10 @@ void HotkeyManager::Impl::UpdateHotkey(types::Hotkey      hotkey,
 
 bool HotkeyManager::HandleKeyPress(QKeyEvent* ev)
 {
-   logger_->trace("HandleKeyPress: {}, {}",
-                  ev->keyCombination().toCombined(),
-                  ev->isAutoRepeat());
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "HandleKeyPress: {}, {}",
+                       ev->keyCombination().toCombined(),
+                       ev->isAutoRepeat());
 
    bool hotkeyPressed = false;
 
@@ -87,7 +88,9 @@ bool HotkeyManager::HandleKeyPress(QKeyEvent* ev)
 
 bool HotkeyManager::HandleKeyRelease(QKeyEvent* ev)
 {
-   logger_->trace("HandleKeyRelease: {}", ev->keyCombination().toCombined());
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "HandleKeyRelease: {}",
+                       ev->keyCombination().toCombined());
 
    bool hotkeyReleased = false;
 
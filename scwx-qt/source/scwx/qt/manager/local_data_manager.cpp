@@ -0,0 +1,173 @@
+#include <scwx/qt/manager/local_data_manager.hpp>
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <filesystem>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <QCoreApplication>
+#include <QFileSystemWatcher>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+static const std::string logPrefix_ = "scwx::qt::manager::local_data_manager";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+class LocalDataManager::Impl
+{
+public:
+   explicit Impl()
+   {
+      // File system notifications are delivered to the main thread
+      context_->moveToThread(QCoreApplication::instance()->thread());
+   }
+   ~Impl() = default;
+
+   void HandleDirectoryChanged(const QString& path);
+   void Notify(const std::filesystem::path& file);
+   void Reset(const std::string& directory);
+   void Scan(const std::filesystem::path& directory, bool notify);
+
+   std::unique_ptr<QObject> context_ {std::make_unique<QObject>()};
+   QFileSystemWatcher*      watcher_ {nullptr};
+
+   std::filesystem::path directory_ {};
+
+   // Files known to exist, by watched directory
+   std::unordered_map<std::string, std::unordered_set<std::string>> files_ {};
+};
+
+LocalDataManager::LocalDataManager() : p(std::make_unique<Impl>()) {}
+LocalDataManager::~LocalDataManager() = default;
+
+void LocalDataManager::SetDirectory(const std::string& directory)
+{
+   QMetaObject::invokeMethod(p->context_.get(),
+                             [=, this]() { p->Reset(directory); });
+}
+
+void LocalDataManager::Impl::Reset(const std::string& directory)
+{
+   if (watcher_ != nullptr)
+   {
+      delete watcher_;
+      watcher_ = nullptr;
+   }
+
+   files_.clear();
+   directory_ = directory;
+
+   if (directory_.empty())
+   {
+      return;
+   }
+
+   std::error_code error {};
+   if (!std::filesystem::is_directory(directory_, error))
+   {
+      logger_->warn("Local data directory not found: {}", directory);
+      return;
+   }
+
+   logger_->info("Watching local data directory: {}", directory);
+
+   watcher_ = new QFileSystemWatcher(context_.get());
+
+   QObject::connect(watcher_,
+                    &QFileSystemWatcher::directoryChanged,
+                    context_.get(),
+                    [this](const QString& path)
+                    { HandleDirectoryChanged(path); });
+
+   // Existing files have already been listed by the providers
+   Scan(directory_, false);
+}
+
+void LocalDataManager::Impl::HandleDirectoryChanged(const QString& path)
+{
+   const std::filesystem::path directory {path.toStdString()};
+
+   std::error_code error {};
+   if (!std::filesystem::is_directory(directory, error))
+   {
+      // Removed directories are no longer watched
+      files_.erase(directory.string());
+      return;
+   }
+
+   Scan(directory, true);
+}
+
+void LocalDataManager::Impl::Scan(const std::filesystem::path& directory,
+                                  bool                         notify)
+{
+   auto [it, inserted] = files_.try_emplace(directory.string());
+   auto& files         = it->second;
+
+   if (inserted)
+   {
+      watcher_->addPath(QString::fromStdString(directory.string()));
+   }
+
+   std::error_code error {};
+
+   for (auto& entry : std::filesystem::directory_iterator(
+           directory,
+           std::filesystem::directory_options::skip_permission_denied,
+           error))
+   {
+      if (entry.is_directory(error))
+      {
+         // Watch new subdirectories, which have already been scanned otherwise
+         if (!files_.contains(entry.path().string()))
+         {
+            Scan(entry.path(), notify);
+         }
+      }
+      else if (entry.is_regular_file(error) &&
+               files.insert(entry.path().filename().string()).second && notify)
+      {
+         Notify(entry.path());
+      }
+   }
+}
+
+void LocalDataManager::Impl::Notify(const std::filesystem::path& file)
+{
+   const std::string filename = file.filename().string();
+
+   // Skip files which are still being written
+   if (filename.starts_with('.') || filename.ends_with(".tmp") ||
+       filename.ends_with(".part"))
+   {
+      return;
+   }
+
+   std::error_code   error {};
+   const std::string key =
+      std::filesystem::relative(file, directory_, error).generic_string();
+
+   if (!error)
+   {
+      SPDLOG_LOGGER_TRACE(logger_, "New file: {}", key);
+
+      RadarProductManager::NotifyObjectCreated(
+         key, std::chrono::system_clock::now());
+   }
+}
+
+LocalDataManager& LocalDataManager::Instance()
+{
+   static LocalDataManager localDataManager_ {};
+   return localDataManager_;
+}
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
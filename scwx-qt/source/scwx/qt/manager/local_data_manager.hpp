@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+/**
+ * @brief Watches a local directory tree for new NEXRAD files, such as those
+ * written by an LDM feed, and passes them to the radar product managers as
+ * soon as they are created.
+ */
+class LocalDataManager
+{
+public:
+   explicit LocalDataManager();
+   ~LocalDataManager();
+
+   LocalDataManager(const LocalDataManager&)            = delete;
+   LocalDataManager& operator=(const LocalDataManager&) = delete;
+
+   LocalDataManager(LocalDataManager&&) noexcept            = delete;
+   LocalDataManager& operator=(LocalDataManager&&) noexcept = delete;
+
+   /**
+    * @brief Sets the directory tree to watch, including any subdirectories
+    * created later. An empty directory stops watching.
+    *
+    * @param [in] directory Local data directory
+    */
+   void SetDirectory(const std::string& directory);
+
+   static LocalDataManager& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
@@ -47,6 +47,10 @@ void LogManager::Initialize()
    scwx::util::Logger::Initialize();
    spdlog::set_level(spdlog::level::debug);
 
+   // Write log messages on a background thread, so debug logging does not
+   // slow down the render and decode threads
+   scwx::util::Logger::SetAsync(true);
+
    // Install Qt Message Handler
    qInstallMessageHandler(&QtLogMessageHandler);
 }
@@ -74,6 +78,12 @@ void LogManager::InitializeLogFile()
    p->PruneLogFiles();
 }
 
+void LogManager::Shutdown()
+{
+   // Write any queued log messages
+   scwx::util::Logger::Shutdown();
+}
+
 void LogManager::Impl::PruneLogFiles()
 {
    using namespace std::chrono_literals;
@@ -92,7 +102,7 @@ void LogManager::Impl::PruneLogFiles()
       if (file.is_regular_file() && filename.starts_with("supercell-wx.") &&
           filename.ends_with(".log"))
       {
-         logger_->trace("Found log file: {}", filename);
+         SPDLOG_LOGGER_TRACE(logger_, "Found log file: {}", filename);
 
          try
          {
@@ -23,6 +23,7 @@ public:
 
    void Initialize();
    void InitializeLogFile();
+   void Shutdown();
 
    static LogManager& Instance();
 
@@ -3,16 +3,19 @@
 #include <scwx/qt/util/json.hpp>
 #include <scwx/qt/main/application.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/strand.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
+#include <mutex>
 #include <shared_mutex>
 #include <vector>
 #include <string>
 
 #include <QStandardPaths>
 #include <boost/json.hpp>
-#include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
+#include <boost/asio/steady_timer.hpp>
 
 namespace scwx
 {
@@ -28,13 +31,22 @@ static const std::string kNameName_      = "name";
 static const std::string kLatitudeName_  = "latitude";
 static const std::string kLongitudeName_ = "longitude";
 
+// Changes are written to the marker settings file after this delay, so a
+// series of edits is written once
+static constexpr std::chrono::seconds kWriteDelay_ {2};
+
 class MarkerManager::Impl
 {
 public:
    class MarkerRecord;
 
    explicit Impl(MarkerManager* self) : self_ {self} {}
-   ~Impl() { threadPool_.join(); }
+   ~Impl()
+   {
+      initializedConnection_.disconnect();
+      CancelWrite();
+      strand_.Join();
+   }
 
    std::string                                markerSettingsPath_ {""};
    std::vector<std::shared_ptr<MarkerRecord>> markerRecords_ {};
@@ -43,12 +55,22 @@ public:
 
    MarkerManager* self_;
 
-   boost::asio::thread_pool threadPool_ {1u};
-   std::shared_mutex        markerRecordLock_ {};
+   scwx::util::Strand strand_ {"Marker Manager",
+                               scwx::util::Strand::Priority::Background};
+   std::shared_mutex  markerRecordLock_ {};
+
+   boost::asio::steady_timer writeTimer_ {strand_.get_executor()};
+   std::mutex                writeMutex_ {};
+   std::mutex                fileMutex_ {};
+   bool                      writeScheduled_ {false};
+
+   boost::signals2::scoped_connection initializedConnection_ {};
 
    void                          InitializeMarkerSettings();
    void                          ReadMarkerSettings();
    void                          WriteMarkerSettings();
+   void                          QueueWrite();
+   void                          CancelWrite();
    std::shared_ptr<MarkerRecord> GetMarkerByName(const std::string& name);
 
    void InitalizeIds();
@@ -177,11 +199,56 @@ void MarkerManager::Impl::WriteMarkerSettings()
 {
    logger_->info("Saving location marker settings");
 
-   std::shared_lock lock(markerRecordLock_);
-   auto markerJson = boost::json::value_from(markerRecords_);
+   // Serialize the markers inside the file lock, so the last write always
+   // contains the latest markers
+   std::unique_lock fileLock(fileMutex_);
+
+   boost::json::value markerJson;
+   {
+      std::shared_lock lock(markerRecordLock_);
+      markerJson = boost::json::value_from(markerRecords_);
+   }
+
    util::json::WriteJsonFile(markerSettingsPath_, markerJson);
 }
 
+void MarkerManager::Impl::QueueWrite()
+{
+   std::unique_lock lock(writeMutex_);
+
+   if (writeScheduled_)
+   {
+      // Changes are included in the write already scheduled
+      return;
+   }
+
+   writeScheduled_ = true;
+
+   writeTimer_.expires_after(kWriteDelay_);
+   writeTimer_.async_wait(strand_.Wrap(
+      [this](const boost::system::error_code& e)
+      {
+         if (e != boost::system::errc::success)
+         {
+            return;
+         }
+
+         {
+            std::unique_lock lock(writeMutex_);
+            writeScheduled_ = false;
+         }
+
+         WriteMarkerSettings();
+      }));
+}
+
+void MarkerManager::Impl::CancelWrite()
+{
+   std::unique_lock lock(writeMutex_);
+   writeTimer_.cancel();
+   writeScheduled_ = false;
+}
+
 std::shared_ptr<MarkerManager::Impl::MarkerRecord>
 MarkerManager::Impl::GetMarkerByName(const std::string& name)
 {
@@ -200,26 +267,24 @@ MarkerManager::MarkerManager() : p(std::make_unique<Impl>(this))
 {
    p->InitializeMarkerSettings();
 
-   boost::asio::post(p->threadPool_,
-                     [this]()
-                     {
-                        try
-                        {
-                           // Read Marker settings on startup
-                           main::Application::WaitForInitialization();
-                           p->ReadMarkerSettings();
-
-                           Q_EMIT MarkersInitialized(p->markerRecords_.size());
-                        }
-                        catch (const std::exception& ex)
-                        {
-                           logger_->error(ex.what());
-                        }
-                     });
+   // Read Marker settings on startup
+   p->initializedConnection_ = main::Application::RunAfterInitialization(
+      [this]()
+      {
+         p->strand_.Post(
+            [this]()
+            {
+               p->ReadMarkerSettings();
+
+               Q_EMIT MarkersInitialized(p->markerRecords_.size());
+            });
+      });
 }
 
 MarkerManager::~MarkerManager()
 {
+   // Write any changes not yet written in the background
+   p->CancelWrite();
    p->WriteMarkerSettings();
 }
 
@@ -272,10 +337,11 @@ void MarkerManager::set_marker(types::MarkerId id, const types::MarkerInfo& mark
       }
       std::shared_ptr<MarkerManager::Impl::MarkerRecord>& markerRecord =
          p->markerRecords_[index];
-      markerRecord->markerInfo_ = marker;
+      markerRecord->markerInfo_    = marker;
+      markerRecord->markerInfo_.id = id;
    }
+   p->QueueWrite();
    Q_EMIT MarkerChanged(id);
-   Q_EMIT MarkersUpdated();
 }
 
 void MarkerManager::add_marker(const types::MarkerInfo& marker)
@@ -289,8 +355,8 @@ void MarkerManager::add_marker(const types::MarkerInfo& marker)
       p->markerRecords_.emplace_back(std::make_shared<Impl::MarkerRecord>(marker));
       p->markerRecords_[index]->markerInfo_.id = id;
    }
+   p->QueueWrite();
    Q_EMIT MarkerAdded(id);
-   Q_EMIT MarkersUpdated();
 }
 
 void MarkerManager::remove_marker(types::MarkerId id)
@@ -320,8 +386,8 @@ void MarkerManager::remove_marker(types::MarkerId id)
       }
    }
 
+   p->QueueWrite();
    Q_EMIT MarkerRemoved(id);
-   Q_EMIT MarkersUpdated();
 }
 
 void MarkerManager::move_marker(size_t from, size_t to)
@@ -332,17 +398,22 @@ void MarkerManager::move_marker(size_t from, size_t to)
       {
          return;
       }
-      std::shared_ptr<MarkerManager::Impl::MarkerRecord>& markerRecord =
+      if (from == to)
+      {
+         return;
+      }
+
+      // Copy the moved record, since its element is overwritten by the shift
+      std::shared_ptr<MarkerManager::Impl::MarkerRecord> movedRecord =
          p->markerRecords_[from];
 
-      if (from == to) {}
-      else if (from < to)
+      if (from < to)
       {
          for (size_t i = from; i < to; i++)
          {
             p->markerRecords_[i] = p->markerRecords_[i + 1];
          }
-         p->markerRecords_[to] = markerRecord;
+         p->markerRecords_[to] = movedRecord;
       }
       else
       {
@@ -350,10 +421,18 @@ void MarkerManager::move_marker(size_t from, size_t to)
          {
             p->markerRecords_[i] = p->markerRecords_[i - 1];
          }
-         p->markerRecords_[to] = markerRecord;
+         p->markerRecords_[to] = movedRecord;
+      }
+
+      // Update the index of each moved marker
+      for (size_t i = std::min(from, to); i <= std::max(from, to); i++)
+      {
+         p->idToIndex_[p->markerRecords_[i]->markerInfo_.id] = i;
       }
    }
-   Q_EMIT MarkersUpdated();
+
+   // Marker order does not change the map, only the marker settings file
+   p->QueueWrite();
 }
 
 void MarkerManager::for_each(std::function<MarkerForEachFunc> func)
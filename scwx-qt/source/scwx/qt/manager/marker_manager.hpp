@@ -38,6 +38,11 @@ public:
 
 signals:
    void MarkersInitialized(size_t count);
+
+   /**
+    * Emitted when the full set of markers is replaced. Individual marker
+    * changes are notified by MarkerAdded, MarkerChanged and MarkerRemoved.
+    */
    void MarkersUpdated();
    void MarkerChanged(types::MarkerId id);
    void MarkerAdded(types::MarkerId id);
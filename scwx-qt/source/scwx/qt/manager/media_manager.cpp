@@ -1,8 +1,23 @@
 #include <scwx/qt/manager/media_manager.hpp>
+#include <scwx/qt/settings/audio_settings.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/uuid/uuid.hpp>
+#include <QAudioBuffer>
+#include <QAudioDecoder>
 #include <QAudioDevice>
 #include <QAudioOutput>
+#include <QAudioSink>
+#include <QFile>
+#include <QIODevice>
 #include <QMediaDevices>
 #include <QMediaPlayer>
 #include <QUrl>
@@ -17,6 +32,135 @@ namespace manager
 static const std::string logPrefix_ = "scwx::qt::manager::media_manager";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Sounds are decoded to, and mixed in, a single output format
+static constexpr int kSampleRate_   = 48000;
+static constexpr int kChannelCount_ = 2;
+
+/**
+ * @brief Mixes decoded sounds for an audio sink in pull mode. A sound played
+ * while it is already playing restarts, and different sounds overlap.
+ */
+class AudioMixer : public QIODevice
+{
+public:
+   explicit AudioMixer(QObject* parent) : QIODevice(parent) {}
+   ~AudioMixer() override = default;
+
+   AudioMixer(const AudioMixer&)            = delete;
+   AudioMixer& operator=(const AudioMixer&) = delete;
+
+   AudioMixer(AudioMixer&&) noexcept            = delete;
+   AudioMixer& operator=(AudioMixer&&) noexcept = delete;
+
+   bool empty() const
+   {
+      std::unique_lock lock {mutex_};
+      return voices_.empty();
+   }
+
+   void Play(const std::string&                key,
+             std::shared_ptr<const QByteArray> samples)
+   {
+      std::unique_lock lock {mutex_};
+
+      auto it = std::find_if(voices_.begin(),
+                             voices_.end(),
+                             [&](const Voice& voice)
+                             { return voice.key_ == key; });
+
+      if (it != voices_.end())
+      {
+         it->samples_ = std::move(samples);
+         it->offset_  = 0;
+      }
+      else
+      {
+         voices_.push_back({key, std::move(samples), 0});
+      }
+   }
+
+   void Stop()
+   {
+      std::unique_lock lock {mutex_};
+      voices_.clear();
+   }
+
+   bool isSequential() const override { return true; }
+
+   qint64 bytesAvailable() const override
+   {
+      std::unique_lock lock {mutex_};
+
+      qint64 bytes = 0;
+      for (auto& voice : voices_)
+      {
+         bytes =
+            std::max<qint64>(bytes, voice.samples_->size() - voice.offset_);
+      }
+
+      return bytes + QIODevice::bytesAvailable();
+   }
+
+protected:
+   qint64 readData(char* data, qint64 maxSize) override
+   {
+      std::unique_lock lock {mutex_};
+
+      // Only whole frames are mixed
+      constexpr qint64 kFrameSize = kChannelCount_ * sizeof(std::int16_t);
+      const qint64     size       = maxSize - maxSize % kFrameSize;
+      qint64           mixedSize  = 0;
+
+      if (voices_.empty() || size <= 0)
+      {
+         return 0;
+      }
+
+      std::memset(data, 0, static_cast<std::size_t>(size));
+
+      std::int16_t* output = reinterpret_cast<std::int16_t*>(data);
+
+      for (auto& voice : voices_)
+      {
+         const qint64 voiceSize =
+            std::min<qint64>(size, voice.samples_->size() - voice.offset_);
+         const std::int16_t* input = reinterpret_cast<const std::int16_t*>(
+            voice.samples_->constData() + voice.offset_);
+
+         for (qint64 i = 0; i < voiceSize / 2; ++i)
+         {
+            // Saturate overlapping sounds
+            output[i] = static_cast<std::int16_t>(std::clamp<std::int32_t>(
+               output[i] + input[i],
+               std::numeric_limits<std::int16_t>::min(),
+               std::numeric_limits<std::int16_t>::max()));
+         }
+
+         voice.offset_ += voiceSize;
+         mixedSize = std::max(mixedSize, voiceSize);
+      }
+
+      std::erase_if(voices_,
+                    [](const Voice& voice)
+                    { return voice.offset_ >= voice.samples_->size(); });
+
+      return mixedSize;
+   }
+
+   qint64 writeData(const char*, qint64) override { return -1; }
+
+private:
+   struct Voice
+   {
+      std::string                       key_;
+      std::shared_ptr<const QByteArray> samples_;
+      qint64                            offset_;
+   };
+
+   std::vector<Voice> voices_ {};
+   mutable std::mutex mutex_ {};
+};
+
 class MediaManager::Impl
 {
 public:
@@ -24,25 +168,82 @@ public:
        self_ {self},
        mediaDevices_ {new QMediaDevices(self)},
        mediaPlayer_ {new QMediaPlayer(self)},
-       audioOutput_ {new QAudioOutput(self)}
+       audioOutput_ {new QAudioOutput(self)},
+       mixer_ {new AudioMixer(self)}
    {
       logger_->debug("Audio device: {}",
                      audioOutput_->device().description().toStdString());
 
       mediaPlayer_->setAudioOutput(audioOutput_);
 
+      format_.setSampleRate(kSampleRate_);
+      format_.setChannelCount(kChannelCount_);
+      format_.setSampleFormat(QAudioFormat::SampleFormat::Int16);
+
+      mixer_->open(QIODevice::OpenModeFlag::ReadOnly);
+
+      CreateAudioSink();
       ConnectSignals();
+
+      // Keep the configured alert sound decoded, such that alerts play
+      // without opening and decoding the file
+      auto& audioSettings = settings::AudioSettings::Instance();
+
+      alertSoundFileCallbackUuid_ =
+         audioSettings.alert_sound_file().RegisterValueChangedCallback(
+            [this](const std::string& value)
+            {
+               QMetaObject::invokeMethod(
+                  self_, [this, value]() { PreloadAlertSound(value); });
+            });
+
+      PreloadAlertSound(audioSettings.alert_sound_file().GetValue());
    }
 
-   ~Impl() {}
+   ~Impl()
+   {
+      settings::AudioSettings::Instance()
+         .alert_sound_file()
+         .UnregisterValueChangedCallback(alertSoundFileCallbackUuid_);
+   }
+
+   Impl(const Impl&)            = delete;
+   Impl& operator=(const Impl&) = delete;
+
+   Impl(Impl&&) noexcept            = delete;
+   Impl& operator=(Impl&&) noexcept = delete;
+
+   /**
+    * @brief A sound decoded to the mixer format. Samples are set once decoding
+    * has completed, and remain unset if decoding failed.
+    */
+   struct DecodedSound
+   {
+      std::shared_ptr<const QByteArray> samples_ {};
+   };
 
    void ConnectSignals();
+   void CreateAudioSink();
+   void Decode(const std::string& mediaPath);
+   void PlayMedia(const std::string& mediaPath);
+   void PreloadAlertSound(const std::string& mediaPath);
+
+   static QUrl MediaUrl(const std::string& mediaPath);
 
    MediaManager* self_;
 
    QMediaDevices* mediaDevices_;
    QMediaPlayer*  mediaPlayer_;
    QAudioOutput*  audioOutput_;
+
+   QAudioFormat format_ {};
+   AudioMixer*  mixer_;
+   QAudioSink*  audioSink_ {nullptr};
+
+   std::unordered_map<std::string, DecodedSound> decodedSounds_ {};
+   std::string                                   alertSoundPath_ {};
+
+   boost::uuids::uuid alertSoundFileCallbackUuid_ {};
 };
 
 MediaManager::MediaManager() : p(std::make_unique<Impl>(this)) {}
@@ -50,12 +251,15 @@ MediaManager::~MediaManager() = default;
 
 void MediaManager::Impl::ConnectSignals()
 {
-   QObject::connect(
-      mediaDevices_,
-      &QMediaDevices::audioOutputsChanged,
-      self_,
-      [this]()
-      { audioOutput_->setDevice(QMediaDevices::defaultAudioOutput()); });
+   QObject::connect(mediaDevices_,
+                    &QMediaDevices::audioOutputsChanged,
+                    self_,
+                    [this]()
+                    {
+                       audioOutput_->setDevice(
+                          QMediaDevices::defaultAudioOutput());
+                       CreateAudioSink();
+                    });
 
    QObject::connect(audioOutput_,
                     &QAudioOutput::deviceChanged,
@@ -78,34 +282,186 @@ void MediaManager::Impl::ConnectSignals()
                     });
 }
 
-void MediaManager::Play(types::AudioFile media)
+void MediaManager::Impl::CreateAudioSink()
 {
-   const std::string path = types::GetMediaPath(media);
+   const QAudioDevice device = QMediaDevices::defaultAudioOutput();
+
+   if (audioSink_ != nullptr)
+   {
+      audioSink_->stop();
+      audioSink_->deleteLater();
+      audioSink_ = nullptr;
+   }
+
+   if (device.isNull() || !device.isFormatSupported(format_))
+   {
+      // Sounds are played through the media player instead
+      logger_->debug("Audio device does not support the mixer format");
+      return;
+   }
+
+   audioSink_ = new QAudioSink(device, format_, self_);
+
+   QObject::connect(audioSink_,
+                    &QAudioSink::stateChanged,
+                    self_,
+                    [this](QAudio::State state)
+                    {
+                       if (state == QAudio::State::IdleState &&
+                           mixer_->empty())
+                       {
+                          // Release the device once each sound has played
+                          audioSink_->stop();
+                       }
+                    });
 }
 
-void MediaManager::Play(const std::string& mediaPath)
+void MediaManager::Impl::Decode(const std::string& mediaPath)
 {
-   logger_->debug("Playing audio: {}", mediaPath);
+   if (decodedSounds_.contains(mediaPath))
+   {
+      return;
+   }
+
+   logger_->debug("Decoding audio: {}", mediaPath);
+
+   decodedSounds_.emplace(mediaPath, DecodedSound {});
+
+   QAudioDecoder* decoder = new QAudioDecoder(self_);
+   auto           samples = std::make_shared<QByteArray>();
+
+   decoder->setAudioFormat(format_);
 
    if (mediaPath.starts_with(':'))
    {
-      p->mediaPlayer_->setSource(
-         QUrl(QString("qrc%1").arg(QString::fromStdString(mediaPath))));
+      // Resources are decoded from the resource file
+      QFile* file = new QFile(QString::fromStdString(mediaPath), decoder);
+      file->open(QIODevice::OpenModeFlag::ReadOnly);
+      decoder->setSourceDevice(file);
    }
    else
    {
-      p->mediaPlayer_->setSource(
-         QUrl::fromLocalFile(QString::fromStdString(mediaPath)));
+      decoder->setSource(MediaUrl(mediaPath));
+   }
+
+   QObject::connect(
+      decoder,
+      &QAudioDecoder::bufferReady,
+      self_,
+      [decoder, samples]()
+      {
+         const QAudioBuffer buffer = decoder->read();
+         samples->append(buffer.constData<char>(), buffer.byteCount());
+      });
+
+   QObject::connect(decoder,
+                    &QAudioDecoder::finished,
+                    self_,
+                    [this, decoder, samples, mediaPath]()
+                    {
+                       auto it = decodedSounds_.find(mediaPath);
+                       if (it != decodedSounds_.end())
+                       {
+                          logger_->debug("Decoded audio: {}", mediaPath);
+                          it->second.samples_ = samples;
+                       }
+
+                       decoder->deleteLater();
+                    });
+
+   QObject::connect(decoder,
+                    qOverload<QAudioDecoder::Error>(&QAudioDecoder::error),
+                    self_,
+                    [decoder, mediaPath](QAudioDecoder::Error)
+                    {
+                       // The sound is played through the media player instead
+                       logger_->warn("Could not decode audio {}: {}",
+                                     mediaPath,
+                                     decoder->errorString().toStdString());
+
+                       decoder->deleteLater();
+                    });
+
+   decoder->start();
+}
+
+void MediaManager::Impl::PreloadAlertSound(const std::string& mediaPath)
+{
+   if (mediaPath == alertSoundPath_)
+   {
+      return;
    }
 
-   p->mediaPlayer_->setPosition(0);
+   // Only the configured alert sound is retained
+   decodedSounds_.erase(alertSoundPath_);
+   alertSoundPath_ = mediaPath;
 
-   QMetaObject::invokeMethod(p->mediaPlayer_, &QMediaPlayer::play);
+   if (!mediaPath.empty())
+   {
+      Decode(mediaPath);
+   }
+}
+
+void MediaManager::Play(types::AudioFile media)
+{
+   const std::string path = types::GetMediaPath(media);
+   Play(path);
+}
+
+void MediaManager::Play(const std::string& mediaPath)
+{
+   QMetaObject::invokeMethod(this, [this, mediaPath]()
+                             { p->PlayMedia(mediaPath); });
+}
+
+void MediaManager::Impl::PlayMedia(const std::string& mediaPath)
+{
+   auto it = decodedSounds_.find(mediaPath);
+
+   if (audioSink_ != nullptr && it != decodedSounds_.cend() &&
+       it->second.samples_ != nullptr)
+   {
+      logger_->debug("Playing decoded audio: {}", mediaPath);
+
+      mixer_->Play(mediaPath, it->second.samples_);
+
+      if (audioSink_->state() != QAudio::State::ActiveState)
+      {
+         audioSink_->start(mixer_);
+      }
+
+      return;
+   }
+
+   logger_->debug("Playing audio: {}", mediaPath);
+
+   mediaPlayer_->setSource(MediaUrl(mediaPath));
+   mediaPlayer_->setPosition(0);
+   mediaPlayer_->play();
 }
 
 void MediaManager::Stop()
 {
-   QMetaObject::invokeMethod(p->mediaPlayer_, &QMediaPlayer::stop);
+   QMetaObject::invokeMethod(this,
+                             [this]()
+                             {
+                                p->mixer_->Stop();
+                                if (p->audioSink_ != nullptr)
+                                {
+                                   p->audioSink_->stop();
+                                }
+                                p->mediaPlayer_->stop();
+                             });
+}
+
+QUrl MediaManager::Impl::MediaUrl(const std::string& mediaPath)
+{
+   if (mediaPath.starts_with(':'))
+   {
+      return QUrl(QString("qrc%1").arg(QString::fromStdString(mediaPath)));
+   }
+
+   return QUrl::fromLocalFile(QString::fromStdString(mediaPath));
 }
 
 std::shared_ptr<MediaManager> MediaManager::Instance()
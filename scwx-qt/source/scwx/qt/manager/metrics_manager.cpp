@@ -0,0 +1,161 @@
+#include <scwx/qt/manager/metrics_manager.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
+
+#include <mutex>
+#include <sstream>
+
+#include <fmt/format.h>
+#include <QTcpServer>
+#include <QTcpSocket>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+static const std::string logPrefix_ = "scwx::qt::manager::metrics_manager";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Requests are small, and larger requests are not read
+static constexpr qint64 kMaxRequestSize_ = 8192;
+
+class MetricsManager::Impl
+{
+public:
+   explicit Impl(MetricsManager* self) :
+       self_ {self}, server_ {new QTcpServer(self)}
+   {
+      QObject::connect(server_,
+                       &QTcpServer::newConnection,
+                       self_,
+                       [this]() { HandleConnections(); });
+   }
+
+   ~Impl() {}
+
+   void HandleConnections();
+   void HandleRequest(QTcpSocket* socket);
+
+   MetricsManager* self_;
+   QTcpServer*     server_;
+};
+
+MetricsManager::MetricsManager() : p(std::make_unique<Impl>(this)) {}
+MetricsManager::~MetricsManager() = default;
+
+bool MetricsManager::Start(std::uint16_t port)
+{
+   // Metrics are only served to the local machine
+   if (!p->server_->listen(QHostAddress::LocalHost, port))
+   {
+      logger_->error("Unable to serve metrics on port {}: {}",
+                     port,
+                     p->server_->errorString().toStdString());
+      return false;
+   }
+
+   logger_->info("Serving metrics at http://localhost:{}/metrics", port);
+
+   scwx::util::Metrics::SetEnabled(true);
+
+   return true;
+}
+
+void MetricsManager::Stop()
+{
+   p->server_->close();
+
+   scwx::util::Metrics::SetEnabled(false);
+}
+
+void MetricsManager::Impl::HandleConnections()
+{
+   while (server_->hasPendingConnections())
+   {
+      QTcpSocket* socket = server_->nextPendingConnection();
+
+      QObject::connect(socket,
+                       &QTcpSocket::disconnected,
+                       socket,
+                       &QObject::deleteLater);
+      QObject::connect(socket,
+                       &QTcpSocket::readyRead,
+                       self_,
+                       [this, socket]() { HandleRequest(socket); });
+   }
+}
+
+void MetricsManager::Impl::HandleRequest(QTcpSocket* socket)
+{
+   // Wait for the request line, e.g., "GET /metrics HTTP/1.1"
+   if (!socket->canReadLine())
+   {
+      if (socket->bytesAvailable() > kMaxRequestSize_)
+      {
+         socket->abort();
+      }
+      return;
+   }
+
+   // Stop reading the remainder of the request
+   QObject::disconnect(socket, &QTcpSocket::readyRead, self_, nullptr);
+
+   const QList<QByteArray> request = socket->readLine().trimmed().split(' ');
+
+   std::string status = "200 OK";
+   std::string body {};
+
+   if (request.size() < 2 || request[0] != "GET")
+   {
+      status = "405 Method Not Allowed";
+   }
+   else if (request[1] != "/metrics")
+   {
+      status = "404 Not Found";
+   }
+   else
+   {
+      std::ostringstream os {};
+      scwx::util::Metrics::Write(os);
+      body = os.str();
+   }
+
+   const std::string header =
+      fmt::format("HTTP/1.1 {}\r\n"
+                  "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                  "Content-Length: {}\r\n"
+                  "Connection: close\r\n"
+                  "\r\n",
+                  status,
+                  body.size());
+
+   socket->write(header.data(), static_cast<qint64>(header.size()));
+   socket->write(body.data(), static_cast<qint64>(body.size()));
+   socket->disconnectFromHost();
+}
+
+std::shared_ptr<MetricsManager> MetricsManager::Instance()
+{
+   static std::weak_ptr<MetricsManager> metricsManagerReference_ {};
+   static std::mutex                    instanceMutex_ {};
+
+   std::unique_lock lock(instanceMutex_);
+
+   std::shared_ptr<MetricsManager> metricsManager =
+      metricsManagerReference_.lock();
+
+   if (metricsManager == nullptr)
+   {
+      metricsManager           = std::make_shared<MetricsManager>();
+      metricsManagerReference_ = metricsManager;
+   }
+
+   return metricsManager;
+}
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
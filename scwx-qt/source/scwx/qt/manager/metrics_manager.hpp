@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <QObject>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+/**
+ * @brief Serves runtime metrics in the Prometheus text format at
+ * http://localhost:<port>/metrics, for monitoring unattended displays.
+ */
+class MetricsManager : public QObject
+{
+   Q_OBJECT
+   Q_DISABLE_COPY_MOVE(MetricsManager)
+
+public:
+   explicit MetricsManager();
+   ~MetricsManager();
+
+   /**
+    * @brief Enables metrics, and begins listening for requests on the local
+    * interface.
+    *
+    * @param [in] port TCP port
+    *
+    * @return true if listening
+    */
+   bool Start(std::uint16_t port);
+
+   /**
+    * @brief Stops listening for requests, and disables metrics.
+    */
+   void Stop();
+
+   static std::shared_ptr<MetricsManager> Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
@@ -7,19 +7,26 @@
 #include <scwx/gr/placefile.hpp>
 #include <scwx/network/cpr.hpp>
 #include <scwx/util/logger.hpp>
-
+#include <scwx/util/priority_thread_pool.hpp>
+#include <scwx/util/profiler.hpp>
+#include <scwx/util/strand.hpp>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <optional>
 #include <shared_mutex>
+#include <sstream>
 #include <vector>
 
 #include <QDir>
 #include <QGuiApplication>
 #include <QScreen>
 #include <QStandardPaths>
+#include <QTimer>
 #include <QUrl>
 #include <boost/algorithm/string.hpp>
-#include <boost/asio/post.hpp>
 #include <boost/asio/steady_timer.hpp>
-#include <boost/asio/thread_pool.hpp>
 #include <boost/json.hpp>
 #include <boost/tokenizer.hpp>
 #include <cpr/cpr.h>
@@ -40,15 +47,42 @@ static const std::string kThresholdedName_ = "thresholded";
 static const std::string kTitleName_       = "title";
 static const std::string kNameName_        = "name";
 
+static constexpr std::size_t               kFetchThreadCount_ = 4u;
+static constexpr std::chrono::milliseconds kUpdateBatchInterval_ {16};
+
+// Placefiles at least this large are compiled to the disk cache, smaller
+// placefiles are parsed faster than they are read from disk
+static constexpr std::size_t kMinCompiledPlacefileSize_ = 64u * 1024u;
+
+typedef scwx::util::PriorityThreadPool::Priority Priority;
+
 class PlacefileManager::Impl
 {
 public:
    class PlacefileRecord;
 
    explicit Impl(PlacefileManager* self) : self_ {self} {}
-   ~Impl() { threadPool_.join(); }
+   ~Impl()
+   {
+      sessionRestoreConnection_.disconnect();
+      shutdown_ = true;
 
+      {
+         std::shared_lock lock {placefileRecordLock_};
+         for (auto& record : placefileRecords_)
+         {
+            record->CancelRefresh();
+         }
+      }
+
+      strand_.Join();
+      fetchPool_.Join();
+      parsePool_.Join();
+   }
+
+   void EmitUpdated();
    void InitializePlacefileSettings();
+   void QueueUpdated(const std::string& name);
    void ReadPlacefileSettings();
    void WritePlacefileSettings();
 
@@ -57,11 +91,31 @@ public:
    LoadFontResources(const std::shared_ptr<gr::Placefile>& placefile);
    static std::vector<std::shared_ptr<boost::gil::rgba8_image_t>>
    LoadImageResources(const std::shared_ptr<gr::Placefile>& placefile);
+   static std::shared_ptr<gr::Placefile> LoadPlacefile(const std::string& name,
+                                                       const std::string& text);
+   static const std::string&             CompiledPlacefileCachePath();
+
+   // Settings and refresh timers
+   scwx::util::Strand strand_ {"Placefile Manager",
+                               scwx::util::Strand::Priority::Background};
+
+   // Placefile updates of all records, with a bounded number of concurrent
+   // requests, and parsing and resource loading
+   scwx::util::PriorityThreadPool fetchPool_ {kFetchThreadCount_,
+                                              "Placefile Fetch"};
+   scwx::util::PriorityThreadPool parsePool_ {
+      scwx::util::PriorityThreadPool::HardwareThreadCount(),
+      "Placefile Parse"};
+   std::atomic<bool>              shutdown_ {false};
 
-   boost::asio::thread_pool threadPool_ {1u};
+   boost::signals2::scoped_connection sessionRestoreConnection_ {};
 
    PlacefileManager* self_;
 
+   // Placefiles updated since the last batch was handed to the layers
+   std::vector<std::string> updatedPlacefiles_ {};
+   std::mutex               updatedMutex_ {};
+
    std::string placefileSettingsPath_ {};
 
    std::shared_ptr<config::RadarSite> radarSite_ {};
@@ -72,7 +126,8 @@ public:
    std::shared_mutex placefileRecordLock_ {};
 };
 
-class PlacefileManager::Impl::PlacefileRecord
+class PlacefileManager::Impl::PlacefileRecord :
+    public std::enable_shared_from_this<PlacefileRecord>
 {
 public:
    explicit PlacefileRecord(Impl*                          impl,
@@ -88,16 +143,17 @@ public:
        enabled_ {enabled},
        thresholded_ {thresholded}
    {
+      if (impl != nullptr)
+      {
+         refreshTimer_.emplace(impl->strand_.get_executor());
+      }
    }
    ~PlacefileRecord()
    {
-      std::unique_lock refreshLock(refreshMutex_);
-      std::unique_lock timerLock(timerMutex_);
-      refreshTimer_.cancel();
-      timerLock.unlock();
-      refreshLock.unlock();
-
-      threadPool_.join();
+      if (refreshTimer_.has_value())
+      {
+         CancelRefresh();
+      }
    }
 
    bool                 refresh_enabled() const;
@@ -107,9 +163,22 @@ public:
    void ScheduleRefresh();
    void ScheduleRefresh(
       const std::chrono::system_clock::duration timeUntilNextUpdate);
-   void Update();
    void UpdateAsync();
 
+   void Update();
+   void Load(const std::string&                  name,
+             const std::string&                  request,
+             const std::shared_ptr<std::string>& body,
+             const network::cpr::Validators&     validators,
+             bool                                isLocalFile);
+   void Apply(const std::string&                    name,
+              const std::shared_ptr<gr::Placefile>& updatedPlacefile,
+              network::cpr::Validators              updatedValidators,
+              std::string                           request,
+              bool                                  isLocalFile);
+   void FinishUpdate();
+   void Post(scwx::util::PriorityThreadPool& pool, std::function<void()> stage);
+
    friend void tag_invoke(boost::json::value_from_tag,
                           boost::json::value&                     jv,
                           const std::shared_ptr<PlacefileRecord>& record)
@@ -139,10 +208,13 @@ public:
    std::shared_ptr<gr::Placefile> placefile_;
    bool                           enabled_;
    bool                           thresholded_;
-   boost::asio::thread_pool       threadPool_ {1u};
-   boost::asio::steady_timer      refreshTimer_ {threadPool_};
-   std::mutex                     refreshMutex_ {};
-   std::mutex                     timerMutex_ {};
+
+   // Updates run in stages on the shared pools, one at a time per record
+   std::atomic<bool> updating_ {false};
+   std::atomic<bool> updatePending_ {false};
+
+   std::optional<boost::asio::steady_timer> refreshTimer_ {};
+   std::mutex                               timerMutex_ {};
 
    boost::unordered_flat_map<std::size_t, std::shared_ptr<types::ImGuiFont>>
               fonts_ {};
@@ -153,28 +225,30 @@ public:
    std::string                           lastRadarSite_ {};
    std::chrono::system_clock::time_point lastUpdateTime_ {};
 
+   // Validators of the loaded placefile, and the request they were received
+   // for, as the request parameters depend on the radar site
+   network::cpr::Validators validators_ {};
+   std::string              validatorsRequest_ {};
+
    std::size_t failureCount_ {};
 };
 
 PlacefileManager::PlacefileManager() : p(std::make_unique<Impl>(this))
 {
-   boost::asio::post(p->threadPool_,
-                     [this]()
-                     {
-                        try
-                        {
-                           p->InitializePlacefileSettings();
-
-                           // Read placefile settings on startup
-                           main::Application::WaitForInitialization();
-                           p->ReadPlacefileSettings();
-                           Q_EMIT PlacefilesInitialized();
-                        }
-                        catch (const std::exception& ex)
-                        {
-                           logger_->error(ex.what());
-                        }
-                     });
+   p->strand_.Post([this]() { p->InitializePlacefileSettings(); });
+
+   // Read placefile settings on startup, once the panes of the previous
+   // session have been restored
+   p->sessionRestoreConnection_ = main::Application::RunAfterSessionRestore(
+      [this]()
+      {
+         p->strand_.Post(
+            [this]()
+            {
+               p->ReadPlacefileSettings();
+               Q_EMIT PlacefilesInitialized();
+            });
+      });
 }
 
 PlacefileManager::~PlacefileManager()
@@ -534,93 +608,232 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
 {
    logger_->debug("Update: {}", name_);
 
-   // Take unique lock before refreshing
-   std::unique_lock lock {refreshMutex_};
+   // Requests made from here on are handled by this update
+   updatePending_ = false;
 
    // Make a copy of name in the event it changes.
    const std::string name {name_};
 
-   std::shared_ptr<gr::Placefile> updatedPlacefile {};
+   scwx::util::ScopedTimer timer {scwx::util::ProfileStage::PlacefileRefresh,
+                                  scwx::util::Profiler::RegisterLabel(name)};
 
    QUrl url = QUrl::fromUserInput(QString::fromStdString(name));
    if (url.isLocalFile())
    {
-      updatedPlacefile = gr::Placefile::Load(name);
+      // Local placefiles are read by the parse stage
+      Post(p->parsePool_,
+           [this, name]() { Load(name, {}, nullptr, {}, true); });
+      return;
+   }
 
-      if (updatedPlacefile == nullptr)
-      {
-         logger_->error("Local placefile not found: {}", name);
-      }
+   std::string decodedUrl {name};
+   auto        queryPos = decodedUrl.find('?');
+   if (queryPos != std::string::npos)
+   {
+      decodedUrl.erase(queryPos);
    }
-   else
+
+   if (p->radarSite_ == nullptr)
    {
-      std::string decodedUrl {name};
-      auto        queryPos = decodedUrl.find('?');
-      if (queryPos != std::string::npos)
-      {
-         decodedUrl.erase(queryPos);
-      }
+      // Wait to process until a radar site is selected
+      FinishUpdate();
+      return;
+   }
 
-      if (p->radarSite_ == nullptr)
-      {
-         // Wait to process until a radar site is selected
-         return;
-      }
+   auto dpi = QGuiApplication::primaryScreen()->logicalDotsPerInch();
 
-      auto dpi = QGuiApplication::primaryScreen()->logicalDotsPerInch();
+   const std::string dpiString = fmt::format("{:0.0f}", dpi);
 
-      // Specify parameters
-      auto parameters = cpr::Parameters {
-         {"version", "1.5"}, // Placefile Version Supported
-         {"dpi", fmt::format("{:0.0f}", dpi)},
-         {"lat", fmt::format("{:0.3f}", p->radarSite_->latitude())},
-         {"lon", fmt::format("{:0.3f}", p->radarSite_->longitude())}};
+   // Specify parameters
+   auto parameters = cpr::Parameters {
+      {"version", "1.5"}, // Placefile Version Supported
+      {"dpi", dpiString},
+      {"lat", fmt::format("{:0.3f}", p->radarSite_->latitude())},
+      {"lon", fmt::format("{:0.3f}", p->radarSite_->longitude())}};
 
-      // Iterate through each query parameter in the URL
-      if (url.hasQuery())
-      {
-         auto query = url.query(QUrl::ComponentFormattingOption::PrettyDecoded)
-                         .toStdString();
+   // Iterate through each query parameter in the URL
+   if (url.hasQuery())
+   {
+      auto query = url.query(QUrl::ComponentFormattingOption::PrettyDecoded)
+                      .toStdString();
 
-         boost::char_separator<char> delimiter("&");
-         boost::tokenizer            tokens(query, delimiter);
+      boost::char_separator<char> delimiter("&");
+      boost::tokenizer            tokens(query, delimiter);
 
-         for (auto& token : tokens)
+      for (auto& token : tokens)
+      {
+         std::vector<std::string> split {};
+         boost::split(split, token, boost::is_any_of("="));
+         if (split.size() >= 2)
          {
-            std::vector<std::string> split {};
-            boost::split(split, token, boost::is_any_of("="));
-            if (split.size() >= 2)
-            {
-               // Token is a key=value parameter
-               parameters.Add({split[0], split[1]});
-            }
-            else
-            {
-               // Token is a single key with no value
-               parameters.Add({token, {}});
-            }
+            // Token is a key=value parameter
+            parameters.Add({split[0], split[1]});
+         }
+         else
+         {
+            // Token is a single key with no value
+            parameters.Add({token, {}});
          }
       }
+   }
 
-      // Send HTTP GET request
-      auto response =
-         cpr::Get(cpr::Url {decodedUrl}, network::cpr::GetHeader(), parameters);
+   // Only request the placefile if it has been modified since it was loaded
+   // with the same parameters
+   std::string request =
+      fmt::format("{} {} {}", name, p->radarSite_->id(), dpiString);
 
-      if (cpr::status::is_success(response.status_code))
-      {
-         std::istringstream responseBody {response.text};
-         updatedPlacefile = gr::Placefile::Load(name, responseBody);
-      }
-      else if (response.status_code == 0)
+   auto header = network::cpr::GetHeader();
+   if (placefile_ != nullptr && request == validatorsRequest_)
+   {
+      header = network::cpr::ConditionalHeader(header, validators_);
+   }
+
+   // Send HTTP GET request
+   auto response = network::cpr::Get(cpr::Url {decodedUrl}, header, parameters);
+
+   if (response.status_code == cpr::status::HTTP_NOT_MODIFIED &&
+       placefile_ != nullptr && name_ == name)
+   {
+      // The placefile is unchanged, and does not need to be parsed or redrawn
+      logger_->debug("Placefile not modified: {}", name);
+
+      lastUpdateTime_ = std::chrono::system_clock::now();
+      failureCount_   = 0;
+
+      ScheduleRefresh();
+      FinishUpdate();
+      return;
+   }
+
+   if (cpr::status::is_success(response.status_code))
+   {
+      // Parse the response on the parse pool, freeing the fetch worker
+      auto body = std::make_shared<std::string>(std::move(response.text));
+      auto validators = network::cpr::GetValidators(response);
+
+      Post(p->parsePool_,
+           [this, name, request, body, validators]()
+           { Load(name, request, body, validators, false); });
+      return;
+   }
+   else if (response.status_code == 0)
+   {
+      logger_->error("Error loading placefile: {}", response.error.message);
+   }
+   else
+   {
+      logger_->error("Error loading placefile: {}", response.status_line);
+   }
+
+   Apply(name, nullptr, {}, {}, false);
+}
+
+void PlacefileManager::Impl::PlacefileRecord::Load(
+   const std::string&                  name,
+   const std::string&                  request,
+   const std::shared_ptr<std::string>& body,
+   const network::cpr::Validators&     validators,
+   bool                                isLocalFile)
+{
+   scwx::util::ScopedTimer timer {scwx::util::ProfileStage::PlacefileRefresh,
+                                  scwx::util::Profiler::RegisterLabel(name)};
+
+   std::shared_ptr<gr::Placefile> updatedPlacefile {};
+
+   if (isLocalFile)
+   {
+      std::ifstream f {name, std::ios_base::in};
+
+      if (f.is_open())
       {
-         logger_->error("Error loading placefile: {}", response.error.message);
+         const std::string text {std::istreambuf_iterator<char>(f),
+                                 std::istreambuf_iterator<char>()};
+         updatedPlacefile = Impl::LoadPlacefile(name, text);
       }
       else
       {
-         logger_->error("Error loading placefile: {}", response.status_line);
+         logger_->error("Local placefile not found: {}", name);
       }
    }
+   else
+   {
+      updatedPlacefile = Impl::LoadPlacefile(name, *body);
+   }
+
+   Apply(name, updatedPlacefile, validators, request, isLocalFile);
+}
+
+std::shared_ptr<gr::Placefile>
+PlacefileManager::Impl::LoadPlacefile(const std::string& name,
+                                      const std::string& text)
+{
+   const std::string& cachePath = CompiledPlacefileCachePath();
+
+   if (text.size() < kMinCompiledPlacefileSize_ || cachePath.empty())
+   {
+      std::istringstream is {text};
+      return gr::Placefile::Load(name, is);
+   }
+
+   // Compiled placefiles are keyed by name, and are only loaded if compiled
+   // from the same text
+   const std::string compiledFilename = fmt::format(
+      "{}{:016x}.plc", cachePath, std::hash<std::string> {}(name));
+   const std::uint64_t contentHash = std::hash<std::string> {}(text);
+
+   auto placefile =
+      gr::Placefile::LoadCompiled(name, compiledFilename, contentHash);
+
+   if (placefile != nullptr)
+   {
+      logger_->debug("Loaded compiled placefile: {}", name);
+      return placefile;
+   }
+
+   std::istringstream is {text};
+   placefile = gr::Placefile::Load(name, is);
+
+   if (placefile->IsValid())
+   {
+      placefile->SaveCompiled(compiledFilename, contentHash);
+   }
+
+   return placefile;
+}
+
+const std::string& PlacefileManager::Impl::CompiledPlacefileCachePath()
+{
+   static const std::string cachePath = []()
+   {
+      std::string path {
+         QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            .toStdString() +
+         "/placefiles"};
+
+      std::error_code error;
+      if (!std::filesystem::exists(path, error) &&
+          !std::filesystem::create_directories(path, error))
+      {
+         logger_->error(
+            "Unable to create placefile cache directory: \"{}\" ({})",
+            path,
+            error.message());
+         return std::string {};
+      }
+
+      return path + "/";
+   }();
 
+   return cachePath;
+}
+
+void PlacefileManager::Impl::PlacefileRecord::Apply(
+   const std::string&                    name,
+   const std::shared_ptr<gr::Placefile>& updatedPlacefile,
+   network::cpr::Validators              updatedValidators,
+   std::string                           request,
+   bool                                  isLocalFile)
+{
    if (updatedPlacefile != nullptr)
    {
       // Load placefile resources
@@ -636,6 +849,9 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
          lastUpdateTime_ = std::chrono::system_clock::now();
          failureCount_   = 0;
 
+         validators_        = std::move(updatedValidators);
+         validatorsRequest_ = std::move(request);
+
          // Update font resources
          {
             std::unique_lock fontsLock {fontsMutex_};
@@ -653,7 +869,7 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
          }
 
          // Notify slots of the placefile update
-         Q_EMIT p->self_->PlacefileUpdated(name);
+         p->QueueUpdated(name);
       }
 
       // Update refresh timer
@@ -667,7 +883,7 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
 
       // Update refresh timer if the file failed to load, in case it is able to
       // be resolved later
-      if (url.isLocalFile())
+      if (isLocalFile)
       {
          ScheduleRefresh(10s);
       }
@@ -679,6 +895,8 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
             std::min<std::chrono::seconds>(15s * failureCount_, 60s));
       }
    }
+
+   FinishUpdate();
 }
 
 void PlacefileManager::Impl::PlacefileRecord::ScheduleRefresh()
@@ -691,8 +909,6 @@ void PlacefileManager::Impl::PlacefileRecord::ScheduleRefresh()
       return;
    }
 
-   std::unique_lock lock {timerMutex_};
-
    auto nextUpdateTime      = lastUpdateTime_ + refresh_time();
    auto timeUntilNextUpdate = nextUpdateTime - std::chrono::system_clock::now();
 
@@ -702,14 +918,21 @@ void PlacefileManager::Impl::PlacefileRecord::ScheduleRefresh()
 void PlacefileManager::Impl::PlacefileRecord::ScheduleRefresh(
    const std::chrono::system_clock::duration timeUntilNextUpdate)
 {
+   std::unique_lock lock {timerMutex_};
+
+   if (p->shutdown_)
+   {
+      return;
+   }
+
    logger_->debug(
       "Scheduled refresh in {:%M:%S} ({})",
       std::chrono::duration_cast<std::chrono::seconds>(timeUntilNextUpdate),
       name_);
 
-   refreshTimer_.expires_after(timeUntilNextUpdate);
-   refreshTimer_.async_wait(
-      [this](const boost::system::error_code& e)
+   refreshTimer_->expires_after(timeUntilNextUpdate);
+   refreshTimer_->async_wait(p->strand_.Wrap(
+      [weakRecord = weak_from_this()](const boost::system::error_code& e)
       {
          if (e == boost::asio::error::operation_aborted)
          {
@@ -719,33 +942,110 @@ void PlacefileManager::Impl::PlacefileRecord::ScheduleRefresh(
          {
             logger_->warn("Refresh timer error: {}", e.message());
          }
-         else
+         else if (auto record = weakRecord.lock())
          {
-            UpdateAsync();
+            record->UpdateAsync();
          }
-      });
+      }));
 }
 
 void PlacefileManager::Impl::PlacefileRecord::CancelRefresh()
 {
    std::unique_lock lock {timerMutex_};
-   refreshTimer_.cancel();
+   refreshTimer_->cancel();
 }
 
 void PlacefileManager::Impl::PlacefileRecord::UpdateAsync()
 {
-   boost::asio::post(threadPool_,
-                     [this]()
-                     {
-                        try
-                        {
-                           Update();
-                        }
-                        catch (const std::exception& ex)
-                        {
-                           logger_->error(ex.what());
-                        }
-                     });
+   // Mark the request before checking for an update in progress, so an update
+   // finishing concurrently will see it
+   updatePending_ = true;
+
+   if (p->shutdown_ || updating_.exchange(true))
+   {
+      // The update in progress will run again once it completes
+      return;
+   }
+
+   Post(p->fetchPool_, [this]() { Update(); });
+}
+
+void PlacefileManager::Impl::PlacefileRecord::FinishUpdate()
+{
+   updating_ = false;
+
+   // Run again if an update was requested while this one was in progress
+   if (updatePending_ && !p->shutdown_ && !updating_.exchange(true))
+   {
+      Post(p->fetchPool_, [this]() { Update(); });
+   }
+}
+
+void PlacefileManager::Impl::PlacefileRecord::Post(
+   scwx::util::PriorityThreadPool& pool, std::function<void()> stage)
+{
+   // Hidden placefiles are only loaded for their title
+   const auto priority = enabled_ ? Priority::High : Priority::Background;
+
+   pool.Post(priority,
+             [record = shared_from_this(), stage = std::move(stage)]()
+             {
+                try
+                {
+                   stage();
+                }
+                catch (const std::exception& ex)
+                {
+                   logger_->error(ex.what());
+                   record->FinishUpdate();
+                }
+             });
+}
+
+void PlacefileManager::Impl::QueueUpdated(const std::string& name)
+{
+   std::unique_lock lock {updatedMutex_};
+
+   const bool batchQueued = !updatedPlacefiles_.empty();
+
+   if (std::find(updatedPlacefiles_.cbegin(),
+                 updatedPlacefiles_.cend(),
+                 name) == updatedPlacefiles_.cend())
+   {
+      updatedPlacefiles_.push_back(name);
+   }
+
+   if (batchQueued)
+   {
+      // The queued batch will include this placefile
+      return;
+   }
+
+   // Placefiles parsed within the same frame are handed to the layers
+   // together, so their buffers are uploaded and drawn in a single frame
+   QMetaObject::invokeMethod(
+      self_,
+      [this]()
+      {
+         QTimer::singleShot(
+            kUpdateBatchInterval_, self_, [this]() { EmitUpdated(); });
+      },
+      Qt::QueuedConnection);
+}
+
+void PlacefileManager::Impl::EmitUpdated()
+{
+   std::vector<std::string> updatedPlacefiles {};
+
+   {
+      std::unique_lock lock {updatedMutex_};
+      updatedPlacefiles.swap(updatedPlacefiles_);
+   }
+
+   for (auto& name : updatedPlacefiles)
+   {
+      Q_EMIT self_->PlacefileUpdated(name);
+   }
 }
 
 std::shared_ptr<PlacefileManager> PlacefileManager::Instance()
@@ -174,9 +174,10 @@ void PositionManager::Impl::CreatePositionSource()
 
                           if (coordinate != position_.coordinate())
                           {
-                             logger_->trace("Position updated: {}, {}",
-                                            coordinate.latitude(),
-                                            coordinate.longitude());
+                             SPDLOG_LOGGER_TRACE(logger_,
+                                                 "Position updated: {}, {}",
+                                                 coordinate.latitude(),
+                                                 coordinate.longitude());
                           }
 
                           position_ = info;
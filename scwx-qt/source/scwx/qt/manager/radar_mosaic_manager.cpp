@@ -0,0 +1,522 @@
+#include <scwx/qt/manager/radar_mosaic_manager.hpp>
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/request/nexrad_file_request.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/qt/settings/palette_settings.hpp>
+#include <scwx/qt/types/mosaic_types.hpp>
+#include <scwx/qt/view/color_table_cache.hpp>
+#include <scwx/common/color_table.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/uuid/random_generator.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+static const std::string logPrefix_ = "scwx::qt::manager::radar_mosaic_manager";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Reflectivity levels mapped by the color table lookup table
+static constexpr std::uint16_t kLutMin_ = 1u;
+static constexpr std::uint16_t kLutMax_ = 255u;
+
+struct MosaicSite
+{
+   std::shared_ptr<RadarProductManager>        radarProductManager_ {};
+   std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan_ {};
+   std::size_t                                 radials_ {};
+   std::shared_ptr<const util::MosaicSweep>    sweep_ {};
+};
+
+class RadarMosaicManager::Impl
+{
+public:
+   explicit Impl(RadarMosaicManager* self) :
+       self_ {self}, refreshUuid_ {boost::uuids::random_generator()()}
+   {
+      auto& generalSettings = settings::GeneralSettings::Instance();
+      auto& paletteSetting  = settings::PaletteSettings::Instance().palette(
+         common::GetLevel2Palette(common::Level2Product::Reflectivity));
+
+      product_ =
+         types::GetMosaicProduct(generalSettings.mosaic_product().GetValue());
+
+      LoadColorTable();
+      SetRadarSites(RadarProductManager::ParseRadarSites(
+         generalSettings.mosaic_radar_sites().GetValue()));
+
+      radarSitesCallbackUuid_ =
+         generalSettings.mosaic_radar_sites().RegisterValueChangedCallback(
+            [this](const std::string& value)
+            { SetRadarSites(RadarProductManager::ParseRadarSites(value)); });
+      productCallbackUuid_ =
+         generalSettings.mosaic_product().RegisterValueChangedCallback(
+            [this](const std::string& value)
+            { SetProduct(types::GetMosaicProduct(value)); });
+      paletteCallbackUuid_ = paletteSetting.RegisterValueChangedCallback(
+         [this](const std::string&) { LoadColorTable(); });
+   }
+   ~Impl()
+   {
+      auto& generalSettings = settings::GeneralSettings::Instance();
+      auto& paletteSetting  = settings::PaletteSettings::Instance().palette(
+         common::GetLevel2Palette(common::Level2Product::Reflectivity));
+
+      generalSettings.mosaic_radar_sites().UnregisterValueChangedCallback(
+         radarSitesCallbackUuid_);
+      generalSettings.mosaic_product().UnregisterValueChangedCallback(
+         productCallbackUuid_);
+      paletteSetting.UnregisterValueChangedCallback(paletteCallbackUuid_);
+
+      threadPool_.join();
+
+      SetRadarSites({});
+   }
+
+   void LoadColorTable();
+   void LoadLatestData(const std::string&                    radarId,
+                       std::chrono::system_clock::time_point time);
+   void QueueUpdate(const std::string& radarId);
+   void SetProduct(types::MosaicProduct product);
+   void SetRadarSites(const std::vector<std::string>& radarSites);
+   void UpdateColorTableLut(float offset, float scale);
+   void UpdateSite(const std::string& radarId);
+
+   RadarMosaicManager* self_;
+
+   boost::uuids::uuid refreshUuid_;
+   boost::uuids::uuid radarSitesCallbackUuid_ {};
+   boost::uuids::uuid productCallbackUuid_ {};
+   boost::uuids::uuid paletteCallbackUuid_ {};
+
+   boost::asio::thread_pool threadPool_ {4u};
+
+   std::atomic<types::MosaicProduct> product_ {
+      types::MosaicProduct::LowestTilt};
+
+   mutable std::mutex                sitesMutex_ {};
+   std::map<std::string, MosaicSite> sites_ {};
+   std::set<std::string>             pendingSites_ {};
+
+   mutable std::mutex                         colorTableMutex_ {};
+   std::shared_ptr<common::ColorTable>        colorTable_ {};
+   std::shared_ptr<const view::ColorTableLut> colorTableLut_ {};
+   float                                      lutOffset_ {};
+   float                                      lutScale_ {};
+};
+
+RadarMosaicManager::RadarMosaicManager() : p(std::make_unique<Impl>(this)) {}
+RadarMosaicManager::~RadarMosaicManager() = default;
+
+std::shared_ptr<const view::ColorTableLut>
+RadarMosaicManager::color_table_lut() const
+{
+   std::unique_lock lock {p->colorTableMutex_};
+   return p->colorTableLut_;
+}
+
+std::vector<std::string> RadarMosaicManager::radar_sites() const
+{
+   std::unique_lock lock {p->sitesMutex_};
+
+   std::vector<std::string> radarSites {};
+   for (auto& site : p->sites_)
+   {
+      radarSites.push_back(site.first);
+   }
+
+   return radarSites;
+}
+
+std::shared_ptr<const util::MosaicSweep>
+RadarMosaicManager::sweep(const std::string& radarId) const
+{
+   std::unique_lock lock {p->sitesMutex_};
+
+   auto it = p->sites_.find(radarId);
+   return (it != p->sites_.cend()) ? it->second.sweep_ : nullptr;
+}
+
+void RadarMosaicManager::Impl::SetRadarSites(
+   const std::vector<std::string>& radarSites)
+{
+   std::vector<std::string> changedSites {};
+   std::vector<std::string> addedSites {};
+
+   {
+      std::unique_lock lock {sitesMutex_};
+
+      // Remove radar sites which are no longer listed
+      for (auto it = sites_.begin(); it != sites_.end();)
+      {
+         if (std::find(radarSites.cbegin(), radarSites.cend(), it->first) ==
+             radarSites.cend())
+         {
+            auto& radarProductManager = it->second.radarProductManager_;
+
+            QObject::disconnect(
+               radarProductManager.get(), nullptr, self_, nullptr);
+            radarProductManager->EnableRefresh(
+               common::RadarProductGroup::Level2, "", false, refreshUuid_);
+
+            changedSites.push_back(it->first);
+            it = sites_.erase(it);
+         }
+         else
+         {
+            ++it;
+         }
+      }
+
+      for (auto& radarId : radarSites)
+      {
+         if (sites_.contains(radarId))
+         {
+            continue;
+         }
+
+         if (config::RadarSite::Get(radarId) == nullptr)
+         {
+            logger_->warn("Cannot add unknown radar site: {}", radarId);
+            continue;
+         }
+
+         auto radarProductManager = RadarProductManager::Instance(radarId);
+
+         // Load the latest volume when new data is found, and resample the
+         // sweep as further elevations of the volume are loaded
+         QObject::connect(
+            radarProductManager.get(),
+            &RadarProductManager::NewDataAvailable,
+            self_,
+            [this, radarId](common::RadarProductGroup group,
+                            const std::string&,
+                            std::chrono::system_clock::time_point latestTime)
+            {
+               if (group == common::RadarProductGroup::Level2)
+               {
+                  LoadLatestData(radarId, latestTime);
+               }
+            });
+         QObject::connect(
+            radarProductManager.get(),
+            &RadarProductManager::DataReloaded,
+            self_,
+            [this, radarId](std::shared_ptr<types::RadarProductRecord> record)
+            {
+               if (record != nullptr && record->radar_product_group() ==
+                                           common::RadarProductGroup::Level2)
+               {
+                  QueueUpdate(radarId);
+               }
+            });
+
+         radarProductManager->EnableRefresh(
+            common::RadarProductGroup::Level2, "", true, refreshUuid_);
+
+         sites_.emplace(radarId, MosaicSite {radarProductManager});
+         addedSites.push_back(radarId);
+      }
+   }
+
+   for (auto& radarId : changedSites)
+   {
+      Q_EMIT self_->SweepUpdated(radarId);
+   }
+
+   // Display data which is already loaded
+   for (auto& radarId : addedSites)
+   {
+      QueueUpdate(radarId);
+   }
+}
+
+void RadarMosaicManager::Impl::SetProduct(types::MosaicProduct product)
+{
+   product_ = product;
+
+   std::vector<std::string> radarSites {};
+
+   {
+      std::unique_lock lock {sitesMutex_};
+
+      // Sweeps of the previous product are no longer displayed
+      for (auto& site : sites_)
+      {
+         site.second.elevationScan_ = nullptr;
+         site.second.radials_       = 0;
+         site.second.sweep_         = nullptr;
+         radarSites.push_back(site.first);
+      }
+   }
+
+   for (auto& radarId : radarSites)
+   {
+      Q_EMIT self_->SweepUpdated(radarId);
+      QueueUpdate(radarId);
+   }
+}
+
+void RadarMosaicManager::Impl::LoadLatestData(
+   const std::string& radarId, std::chrono::system_clock::time_point time)
+{
+   std::shared_ptr<RadarProductManager> radarProductManager = nullptr;
+
+   {
+      std::unique_lock lock {sitesMutex_};
+
+      auto it = sites_.find(radarId);
+      if (it == sites_.cend())
+      {
+         return;
+      }
+
+      radarProductManager = it->second.radarProductManager_;
+   }
+
+   auto request = std::make_shared<request::NexradFileRequest>(radarId);
+
+   QObject::connect(request.get(),
+                    &request::NexradFileRequest::RequestComplete,
+                    self_,
+                    [this, radarId](std::shared_ptr<request::NexradFileRequest>)
+                    { QueueUpdate(radarId); });
+
+   radarProductManager->LoadLevel2Data(time, request);
+}
+
+void RadarMosaicManager::Impl::QueueUpdate(const std::string& radarId)
+{
+   {
+      std::unique_lock lock {sitesMutex_};
+
+      // Only one update of a radar site is queued at a time
+      if (!pendingSites_.insert(radarId).second)
+      {
+         return;
+      }
+   }
+
+   boost::asio::post(threadPool_,
+                     [this, radarId]()
+                     {
+                        try
+                        {
+                           UpdateSite(radarId);
+                        }
+                        catch (const std::exception& ex)
+                        {
+                           logger_->error(ex.what());
+                        }
+                     });
+}
+
+void RadarMosaicManager::Impl::UpdateSite(const std::string& radarId)
+{
+   std::shared_ptr<RadarProductManager> radarProductManager = nullptr;
+
+   {
+      std::unique_lock lock {sitesMutex_};
+
+      // Data changed after this point will queue another update
+      pendingSites_.erase(radarId);
+
+      auto it = sites_.find(radarId);
+      if (it == sites_.cend())
+      {
+         return;
+      }
+
+      radarProductManager = it->second.radarProductManager_;
+   }
+
+   const types::MosaicProduct product = product_;
+
+   std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan = nullptr;
+   std::chrono::system_clock::time_point       time {};
+
+   // An elevation of 0 selects the lowest tilt of the latest volume
+   if (product == types::MosaicProduct::CompositeReflectivity)
+   {
+      std::tie(elevationScan, std::ignore, std::ignore, time) =
+         radarProductManager->GetDerivedLevel2Data(
+            common::Level2Product::CompositeReflectivity, 0.0f);
+   }
+   else
+   {
+      std::tie(elevationScan, std::ignore, std::ignore, time) =
+         radarProductManager->GetLevel2Data(
+            wsr88d::rda::DataBlockType::MomentRef, 0.0f);
+   }
+
+   // If the data is not yet loaded, the update is queued again once reloaded
+   if (elevationScan == nullptr)
+   {
+      return;
+   }
+
+   const std::size_t radials = elevationScan->size();
+
+   {
+      std::unique_lock lock {sitesMutex_};
+
+      auto it = sites_.find(radarId);
+      if (it == sites_.cend() || (it->second.elevationScan_ == elevationScan &&
+                                  it->second.radials_ == radials))
+      {
+         // The radar site was removed, or its sweep is unchanged
+         return;
+      }
+   }
+
+   std::shared_ptr<config::RadarSite> radarSite =
+      radarProductManager->radar_site();
+
+   std::shared_ptr<const util::MosaicSweep> sweep =
+      util::CreateMosaicSweep(*elevationScan,
+                              radarId,
+                              {radarSite->latitude(), radarSite->longitude()},
+                              time);
+
+   {
+      std::unique_lock lock {sitesMutex_};
+
+      auto it = sites_.find(radarId);
+      if (it == sites_.cend() || product != product_)
+      {
+         return;
+      }
+
+      it->second.elevationScan_ = elevationScan;
+      it->second.radials_       = radials;
+      it->second.sweep_         = sweep;
+   }
+
+   if (sweep != nullptr)
+   {
+      UpdateColorTableLut(sweep->offset_, sweep->scale_);
+   }
+
+   Q_EMIT self_->SweepUpdated(radarId);
+}
+
+void RadarMosaicManager::Impl::LoadColorTable()
+{
+   boost::asio::post(
+      threadPool_,
+      [this]()
+      {
+         try
+         {
+            const std::string colorTableFile =
+               settings::PaletteSettings::Instance()
+                  .palette(common::GetLevel2Palette(
+                     common::Level2Product::Reflectivity))
+                  .GetValue();
+
+            std::shared_ptr<common::ColorTable> colorTable = nullptr;
+
+            if (!colorTableFile.empty())
+            {
+               colorTable =
+                  view::ColorTableCache::Instance().Load(colorTableFile);
+            }
+
+            float offset;
+            float scale;
+
+            {
+               std::unique_lock lock {colorTableMutex_};
+               colorTable_    = std::move(colorTable);
+               colorTableLut_ = nullptr;
+               offset         = lutOffset_;
+               scale          = lutScale_;
+            }
+
+            // Rebuild the lookup table if a sweep has been loaded
+            if (scale != 0.0f)
+            {
+               UpdateColorTableLut(offset, scale);
+            }
+         }
+         catch (const std::exception& ex)
+         {
+            logger_->error(ex.what());
+         }
+      });
+}
+
+void RadarMosaicManager::Impl::UpdateColorTableLut(float offset, float scale)
+{
+   {
+      std::unique_lock lock {colorTableMutex_};
+
+      const bool unchanged = (colorTableLut_ != nullptr &&
+                              lutOffset_ == offset && lutScale_ == scale);
+
+      lutOffset_ = offset;
+      lutScale_  = scale;
+
+      if (unchanged || colorTable_ == nullptr || !colorTable_->IsValid() ||
+          scale == 0.0f)
+      {
+         // Nothing to update
+         return;
+      }
+
+      auto colorTableLut         = std::make_shared<view::ColorTableLut>();
+      colorTableLut->colorTable_ = colorTable_;
+      colorTableLut->min_        = kLutMin_;
+      colorTableLut->max_        = kLutMax_;
+      colorTableLut->lut_.resize(kLutMax_ - kLutMin_ + 1);
+
+      // Levels below the SNR threshold are not displayed, so range folding is
+      // not given a color
+      std::vector<float> values(colorTableLut->lut_.size());
+      for (std::uint16_t level = kLutMin_; level <= kLutMax_; ++level)
+      {
+         values[level - kLutMin_] = (level - offset) / scale;
+      }
+
+      colorTable_->Colors(values, colorTableLut->lut_);
+
+      colorTableLut_ = std::move(colorTableLut);
+   }
+
+   Q_EMIT self_->ColorTableLutUpdated();
+}
+
+std::shared_ptr<RadarMosaicManager> RadarMosaicManager::Instance()
+{
+   static std::weak_ptr<RadarMosaicManager> radarMosaicManagerReference_ {};
+   static std::mutex                        instanceMutex_ {};
+
+   std::unique_lock lock(instanceMutex_);
+
+   std::shared_ptr<RadarMosaicManager> radarMosaicManager =
+      radarMosaicManagerReference_.lock();
+
+   if (radarMosaicManager == nullptr)
+   {
+      radarMosaicManager           = std::make_shared<RadarMosaicManager>();
+      radarMosaicManagerReference_ = radarMosaicManager;
+   }
+
+   return radarMosaicManager;
+}
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
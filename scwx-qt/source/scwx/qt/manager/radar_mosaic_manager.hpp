@@ -0,0 +1,75 @@
+#pragma once
+
+#include <scwx/qt/util/mosaic_sweep.hpp>
+#include <scwx/qt/view/color_table_lut_cache.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <QObject>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+/**
+ * @brief Maintains the latest reflectivity sweep of each radar site listed in
+ * the mosaic radar sites setting, for compositing into a single mosaic. Level
+ * 2 refresh is enabled for each radar site, and a radar site's sweep is
+ * resampled only when its data changes.
+ */
+class RadarMosaicManager : public QObject
+{
+   Q_OBJECT
+   Q_DISABLE_COPY_MOVE(RadarMosaicManager)
+
+public:
+   explicit RadarMosaicManager();
+   ~RadarMosaicManager();
+
+   /**
+    * @brief Gets the lookup table mapping reflectivity levels to colors, or
+    * nullptr if no sweep or color table is loaded.
+    */
+   std::shared_ptr<const view::ColorTableLut> color_table_lut() const;
+
+   /**
+    * @brief Gets the radar sites in the mosaic.
+    */
+   std::vector<std::string> radar_sites() const;
+
+   /**
+    * @brief Gets the latest sweep of a radar site in the mosaic.
+    *
+    * @param [in] radarId Radar site ID
+    *
+    * @return Mosaic sweep, or nullptr if not loaded
+    */
+   std::shared_ptr<const util::MosaicSweep>
+   sweep(const std::string& radarId) const;
+
+   static std::shared_ptr<RadarMosaicManager> Instance();
+
+signals:
+   void ColorTableLutUpdated();
+
+   /**
+    * @brief Emitted when the sweep of a radar site is loaded, replaced, or
+    * removed from the mosaic.
+    *
+    * @param [in] radarId Radar site ID
+    */
+   void SweepUpdated(const std::string& radarId);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
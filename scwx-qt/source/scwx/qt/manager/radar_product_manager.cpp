@@ -1,19 +1,47 @@
 #include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/manager/local_data_manager.hpp>
 #include <scwx/qt/manager/radar_product_manager_notifier.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/types/time_types.hpp>
+#include <scwx/qt/util/coalesced_signal.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/provider/nexrad_data_provider_factory.hpp>
+#include <scwx/provider/object_cache.hpp>
+#include <scwx/provider/refresh_schedule.hpp>
+#include <scwx/util/detached_task.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/lru_cache.hpp>
 #include <scwx/util/map.hpp>
+#include <scwx/util/memory.hpp>
+#include <scwx/util/metrics.hpp>
+#include <scwx/util/priority_thread_pool.hpp>
+#include <scwx/util/profiler.hpp>
+#include <scwx/util/strand.hpp>
 #include <scwx/util/threads.hpp>
+#include <scwx/util/vectorbuf.hpp>
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
-
+#include <scwx/wsr88d/rda/derived_product.hpp>
+#include <scwx/wsr88d/rda/precipitation_accumulator.hpp>
+#include <scwx/wsr88d/rda/rda_types.hpp>
+#include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cstring>
 #include <execution>
+#include <filesystem>
+#include <fstream>
+#include <map>
 #include <mutex>
+#include <optional>
+#include <set>
 #include <shared_mutex>
+#include <span>
 #include <unordered_set>
+#include <utility>
 
 #if defined(_MSC_VER)
 #   pragma warning(push, 0)
@@ -23,11 +51,16 @@
 #include <boost/asio/steady_timer.hpp>
 #include <boost/asio/thread_pool.hpp>
 #include <boost/container_hash/hash.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
+#include <boost/uuid/random_generator.hpp>
 #include <fmt/chrono.h>
 #include <qmaplibre.hpp>
+#include <QCoreApplication>
+#include <QStandardPaths>
 #include <units/angle.h>
+#include <units/velocity.h>
 
 #if defined(_MSC_VER)
 #   pragma warning(pop)
@@ -49,17 +82,38 @@ typedef std::function<std::shared_ptr<wsr88d::NexradFile>()>
 typedef std::map<std::chrono::system_clock::time_point,
                  std::weak_ptr<types::RadarProductRecord>>
    RadarProductRecordMap;
-typedef std::list<std::shared_ptr<types::RadarProductRecord>>
-   RadarProductRecordList;
+typedef std::pair<std::string, std::string> RadarProductRecordGroup;
+typedef scwx::util::PriorityThreadPool::Priority LoadPriority;
 
 static constexpr uint32_t NUM_RADIAL_GATES_0_5_DEGREE =
    common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
 static constexpr uint32_t NUM_RADIAL_GATES_1_DEGREE =
    common::MAX_1_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
-static constexpr uint32_t NUM_COORIDNATES_0_5_DEGREE =
-   NUM_RADIAL_GATES_0_5_DEGREE * 2;
-static constexpr uint32_t NUM_COORIDNATES_1_DEGREE =
-   NUM_RADIAL_GATES_1_DEGREE * 2;
+
+/**
+ * @brief Header of a coordinate grid cache file, followed by the coordinates.
+ * The coordinates are recalculated if any parameter differs.
+ */
+struct CoordinateCacheHeader
+{
+   std::array<char, 4> magic_ {};
+   std::uint32_t       version_ {};
+   double              latitude_ {};
+   double              longitude_ {};
+   float               gateSize_ {};
+   float               radialAngle_ {};
+   float               angleOffset_ {};
+   float               gateRangeOffset_ {};
+   std::uint32_t       exact_ {};
+   std::uint32_t       reserved_ {};
+   std::uint64_t       count_ {};
+
+   bool operator==(const CoordinateCacheHeader&) const = default;
+};
+
+static constexpr std::array<char, 4> kCoordinateCacheMagic_ {
+   'S', 'C', 'G', 'R'};
+static constexpr std::uint32_t kCoordinateCacheVersion_ {2u};
 
 static const std::string kDefaultLevel3Product_ {"N0B"};
 
@@ -68,6 +122,15 @@ static constexpr std::size_t kTimerPlaces_ {6u};
 static constexpr std::chrono::seconds kFastRetryInterval_ {15};
 static constexpr std::chrono::seconds kSlowRetryInterval_ {120};
 
+// Maximum number of concurrent level 3 prefetch requests
+static constexpr std::size_t kPrefetchMaxInFlight_ {8u};
+
+// Maximum size of the decoded level 2 volume cache on disk (4 GiB)
+static constexpr std::uintmax_t kLevel2CacheMaxSize_ {4ull << 30};
+
+// Size of each range of a level 2 volume downloaded in ranges (512 KiB)
+static constexpr std::size_t kLevel2RangeSize_ {512u * 1024u};
+
 static std::unordered_map<std::string, std::weak_ptr<RadarProductManager>>
                          instanceMap_;
 static std::shared_mutex instanceMutex_;
@@ -77,8 +140,52 @@ static std::unordered_map<std::string,
                          fileIndex_;
 static std::shared_mutex fileIndexMutex_;
 
+// Requests waiting on each file being loaded
+static std::unordered_map<
+   std::string,
+   std::vector<std::shared_ptr<request::NexradFileRequest>>>
+                  fileLoads_;
+static std::mutex fileLoadsMutex_;
+
 static std::mutex fileLoadMutex_;
 
+static std::mutex level2CacheMutex_;
+
+// Recently used records of all radar sites, retained within the memory budget
+static util::LruCache<RadarProductRecordGroup, types::RadarProductRecord>
+                  recordCache_ {};
+static std::mutex recordCacheMutex_;
+
+static scwx::util::MemoryCounter recordCacheMemory_ {"Radar Product Records"};
+
+static const std::string kLevel2RecordGroup_ {"L2"};
+
+// Compressed level 2 volumes of all radar sites, grouped by radar site, from
+// which loop frames are restored once their records have been released
+static util::LruCache<std::string, const wsr88d::Ar2vFile::CompressedVolume>
+                  compressedVolumeCache_ {};
+static std::mutex compressedVolumeCacheMutex_;
+
+static scwx::util::MemoryCounter compressedVolumeMemory_ {
+   "Compressed Radar Volumes"};
+
+// Radar sites refreshed in the background, independently of the map panes.
+// Monitored sites are those configured, and those predicted to be needed.
+static std::map<std::string, std::shared_ptr<RadarProductManager>>
+                                monitoredSites_ {};
+static std::vector<std::string> configuredMonitoredSites_ {};
+static std::vector<std::string> predictedMonitoredSites_ {};
+static std::mutex               monitoredSitesMutex_;
+
+// Level 3 products last known to be available at each radar site, such that
+// a radar site selected again displays its products while they are refreshed
+static std::unordered_map<std::string, common::Level3ProductCategoryMap>
+                  availableCategoryCache_ {};
+static std::mutex availableCategoryCacheMutex_;
+
+static const boost::uuids::uuid kMonitorUuid_ =
+   boost::uuids::random_generator()();
+
 class ProviderManager : public QObject
 {
    Q_OBJECT
@@ -93,29 +200,64 @@ public:
                             const std::string&        radarId,
                             common::RadarProductGroup group,
                             const std::string&        product) :
-       radarId_ {radarId}, group_ {group}, product_ {product}
+       radarId_ {radarId},
+       group_ {group},
+       product_ {product},
+       newDataAvailable_ {QCoreApplication::instance(),
+                          [this, self]() { EmitNewDataAvailable(self); }}
    {
-      connect(this,
-              &ProviderManager::NewDataAvailable,
-              self,
-              &RadarProductManager::NewDataAvailable);
+      // Objects listed in a burst are forwarded once, with the latest time
+      connect(
+         this,
+         &ProviderManager::NewDataAvailable,
+         self,
+         [this](common::RadarProductGroup,
+                const std::string&,
+                std::chrono::system_clock::time_point latestTime)
+         {
+            {
+               std::unique_lock lock {pendingMutex_};
+               pendingLatestTime_ = std::max(pendingLatestTime_, latestTime);
+            }
+            newDataAvailable_.Notify();
+         },
+         Qt::DirectConnection);
    }
-   ~ProviderManager() { threadPool_.join(); };
+   ~ProviderManager() { strand_.Join(); };
 
    std::string name() const;
 
+   std::chrono::system_clock::time_point
+        listed_time(std::chrono::system_clock::time_point productTime) const;
+   void set_listed_time(std::chrono::system_clock::time_point productTime,
+                        std::chrono::system_clock::time_point listedTime);
+
    void Disable();
+   void EmitNewDataAvailable(RadarProductManager* self);
 
-   boost::asio::thread_pool threadPool_ {1u};
+   // Provider refreshes list objects from the network
+   scwx::util::Strand strand_ {"Provider Manager",
+                               scwx::util::Strand::Priority::Blocking};
 
    const std::string                             radarId_;
    const common::RadarProductGroup               group_;
    const std::string                             product_;
    bool                                          refreshEnabled_ {false};
-   boost::asio::steady_timer                     refreshTimer_ {threadPool_};
+   boost::asio::steady_timer                     refreshTimer_ {
+      strand_.get_executor()};
    std::mutex                                    refreshTimerMutex_ {};
    std::shared_ptr<provider::NexradDataProvider> provider_ {nullptr};
 
+   // Time at which the latest product was first listed
+   mutable std::mutex                    listedMutex_ {};
+   std::chrono::system_clock::time_point listedProductTime_ {};
+   std::chrono::system_clock::time_point listedTime_ {};
+
+   // Latest time listed since new data was last forwarded
+   std::mutex                            pendingMutex_ {};
+   std::chrono::system_clock::time_point pendingLatestTime_ {};
+   util::CoalescedSignal                 newDataAvailable_;
+
 signals:
    void NewDataAvailable(common::RadarProductGroup             group,
                          const std::string&                    product,
@@ -141,6 +283,20 @@ public:
          radarSite_ = std::make_shared<config::RadarSite>();
       }
 
+      InitializeObjectCache();
+      InitializeLocalData();
+      InitializeMirrors();
+
+      {
+         std::unique_lock lock {availableCategoryCacheMutex_};
+
+         auto it = availableCategoryCache_.find(radarId_);
+         if (it != availableCategoryCache_.cend())
+         {
+            availableCategoryMap_ = it->second;
+         }
+      }
+
       level2ProviderManager_->provider_ =
          provider::NexradDataProviderFactory::CreateLevel2DataProvider(radarId);
    }
@@ -158,17 +314,47 @@ public:
                        providerManager->Disable();
                     });
 
-      // Lock other mutexes before destroying, ensure loading is complete
-      std::unique_lock loadLevel2DataLock {loadLevel2DataMutex_};
-      std::unique_lock loadLevel3DataLock {loadLevel3DataMutex_};
+      // Stop loading prefetched frames, and complete loads in progress
+      // without data at their next stage
+      {
+         std::unique_lock prefetchLock {prefetchPlanMutex_};
+         ++prefetchPlan_.generation_;
+      }
+      loadsCancelled_ = true;
 
+      // Ensure loading is complete before destroying. Downloads queue
+      // decoding, so are joined first.
+      downloadPool_.Join();
+      decodePool_.Join();
       threadPool_.join();
+
+      // Release recently used records of this radar site
+      std::unique_lock recordCacheLock {recordCacheMutex_};
+      recordCache_.EraseGroup({radarId_, kLevel2RecordGroup_});
+      for (auto& product : level3ProductRecordsMap_)
+      {
+         recordCache_.EraseGroup({radarId_, product.first});
+      }
+      recordCacheMemory_.set_bytes(recordCache_.size_bytes());
+      recordCacheLock.unlock();
+
+      std::unique_lock compressedVolumeLock {compressedVolumeCacheMutex_};
+      compressedVolumeCache_.EraseGroup(radarId_);
+      compressedVolumeMemory_.set_bytes(compressedVolumeCache_.size_bytes());
    }
 
    RadarProductManager* self_;
 
+   // Product listings and refresh
    boost::asio::thread_pool threadPool_ {4u};
 
+   // Product downloads, and decoding and derived products, scheduled by
+   // priority so the selected time is loaded ahead of prefetched data
+   scwx::util::PriorityThreadPool downloadPool_ {DownloadThreadCount(),
+                                                 "Radar Download"};
+   scwx::util::PriorityThreadPool decodePool_ {
+      scwx::util::PriorityThreadPool::HardwareThreadCount(), "Radar Decode"};
+
    std::shared_ptr<ProviderManager>
    GetLevel3ProviderManager(const std::string& product);
 
@@ -177,43 +363,139 @@ public:
                       bool                             enabled);
    void RefreshData(std::shared_ptr<ProviderManager> providerManager);
    void RefreshDataSync(std::shared_ptr<ProviderManager> providerManager);
+   std::chrono::seconds
+   GetUpdatePeriod(const std::shared_ptr<ProviderManager>& providerManager);
+   void AddObject(const std::string&                    key,
+                  std::chrono::system_clock::time_point lastModified);
+
+   static void UpdateMonitoredSites();
+
+   void EnableMonitor(bool enabled);
+   bool IsRefreshEnabledForDisplay();
+   void LoadMonitoredData(std::chrono::system_clock::time_point time);
+   void ReleaseMonitoredRecord(
+      std::shared_ptr<types::RadarProductRecord> record);
 
    std::map<std::chrono::system_clock::time_point,
             std::shared_ptr<types::RadarProductRecord>>
-   GetLevel2ProductRecords(std::chrono::system_clock::time_point time);
+   GetLevel2ProductRecords(
+      std::chrono::system_clock::time_point            time,
+      const std::shared_ptr<request::NexradLoadGroup>& loadGroup);
+   std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+              float,
+              std::vector<float>,
+              std::chrono::system_clock::time_point,
+              std::shared_ptr<types::RadarProductRecord>>
+   GetLevel2Data(
+      wsr88d::rda::DataBlockType                       dataBlockType,
+      float                                            elevation,
+      std::chrono::system_clock::time_point            time,
+      const std::shared_ptr<request::NexradLoadGroup>& loadGroup = nullptr);
+   std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+              std::chrono::system_clock::time_point,
+              std::shared_ptr<types::RadarProductRecord>>
+   GetLatestCut(wsr88d::rda::DataBlockType            dataBlockType,
+                float                                 elevationCut,
+                std::chrono::system_clock::time_point time);
+   void IndexLevel2Record(
+      const std::shared_ptr<types::RadarProductRecord>& record);
    std::tuple<std::shared_ptr<types::RadarProductRecord>,
               std::chrono::system_clock::time_point>
-   GetLevel3ProductRecord(const std::string&                    product,
-                          std::chrono::system_clock::time_point time);
+   GetLevel3ProductRecord(
+      const std::string&                               product,
+      std::chrono::system_clock::time_point            time,
+      const std::shared_ptr<request::NexradLoadGroup>& loadGroup);
    std::shared_ptr<types::RadarProductRecord>
    StoreRadarProductRecord(std::shared_ptr<types::RadarProductRecord> record);
-   void UpdateRecentRecords(RadarProductRecordList& recentList,
+   void UpdateRecentRecords(const std::string&                         product,
                             std::shared_ptr<types::RadarProductRecord> record);
-
-   void LoadNexradFileAsync(
-      CreateNexradFileFunction                           load,
+   static void
+   TouchRecentRecord(const std::shared_ptr<types::RadarProductRecord>& record);
+   void ReleaseMemory();
+
+   void LoadProviderData(
+      std::chrono::system_clock::time_point              time,
+      std::shared_ptr<ProviderManager>                   providerManager,
+      RadarProductRecordMap&                             recordMap,
+      std::shared_mutex&                                 recordMutex,
       const std::shared_ptr<request::NexradFileRequest>& request,
-      std::mutex&                                        mutex,
-      std::chrono::system_clock::time_point              time);
-   void
-        LoadProviderData(std::chrono::system_clock::time_point time,
-                         std::shared_ptr<ProviderManager>      providerManager,
-                         RadarProductRecordMap&                recordMap,
-                         std::shared_mutex&                    recordMutex,
-                         std::mutex&                           loadDataMutex,
-                         const std::shared_ptr<request::NexradFileRequest>& request);
+      LoadPriority                                       priority);
+   std::shared_ptr<wsr88d::NexradFile>
+   LoadProviderObject(const std::shared_ptr<ProviderManager>&   providerManager,
+                      const std::string&                        key,
+                      std::chrono::system_clock::time_point     time,
+                      const std::shared_ptr<std::vector<char>>& data);
+   void LoadProviderObjectRanged(
+      const std::shared_ptr<ProviderManager>& providerManager,
+      const std::string&                      key,
+      std::chrono::system_clock::time_point   time,
+      const ProviderLoadKey&                  loadKey);
+   std::shared_ptr<types::RadarProductRecord> CompleteProviderLoad(
+      const ProviderManager*                providerManager,
+      std::chrono::system_clock::time_point time,
+      std::shared_ptr<wsr88d::NexradFile>   nexradFile,
+      std::chrono::system_clock::time_point downloadedTime = {});
+   std::string
+   Level2CacheFilename(const std::shared_ptr<ProviderManager>& providerManager,
+                       std::chrono::system_clock::time_point   time) const;
+   bool HasCompressedVolume(std::chrono::system_clock::time_point time);
+   std::shared_ptr<wsr88d::Ar2vFile>
+   LoadCompressedVolume(std::chrono::system_clock::time_point time);
+   void StoreCompressedVolume(std::chrono::system_clock::time_point      time,
+                              const std::shared_ptr<wsr88d::NexradFile>& file);
+   void QueuePrefetchPlan();
+   void PlanPrefetch(std::uint64_t generation);
+   void PrefetchNextFrames(std::uint64_t generation);
+   void PrefetchLevel3Data(const std::vector<std::string>&       products,
+                           std::chrono::system_clock::time_point startTime,
+                           std::chrono::system_clock::time_point endTime,
+                           std::uint64_t                         generation);
+   void CountPrefetchedFrame(std::uint64_t generation);
    void PopulateLevel2ProductTimes(std::chrono::system_clock::time_point time);
    void PopulateLevel3ProductTimes(const std::string& product,
                                    std::chrono::system_clock::time_point time);
 
    void UpdateAvailableProductsSync();
 
-   void
-   CalculateCoordinates(const boost::integer_range<std::uint32_t>& radialGates,
-                        const units::angle::degrees<float>         radialAngle,
-                        const units::angle::degrees<float>         angleOffset,
-                        const float         gateRangeOffset,
-                        std::vector<float>& outputCoordinates);
+   /**
+    * @brief Queues DataReloaded for a record. Records reloaded repeatedly in
+    * the same event loop iteration, such as while a volume is being received,
+    * are emitted once.
+    */
+   void QueueDataReloaded(std::shared_ptr<types::RadarProductRecord> record);
+   void EmitDataReloaded();
+
+   /**
+    * @brief Gate coordinates of a radial size, calculated on first use. The
+    * coordinates are saved to disk for each radar site, and memory mapped when
+    * loaded again.
+    */
+   struct CoordinateGrid
+   {
+      std::once_flag                       initialized_ {};
+      std::vector<float>                   calculated_ {};
+      boost::iostreams::mapped_file_source file_ {};
+      std::span<const float>               coordinates_ {};
+   };
+
+   std::span<const float> GetCoordinates(common::RadialSize radialSize,
+                                         bool               smoothingEnabled);
+   void                   LoadCoordinates(CoordinateGrid&    grid,
+                                          common::RadialSize radialSize,
+                                          bool               smoothingEnabled);
+   static bool MapCoordinates(CoordinateGrid&              grid,
+                              const std::string&           filename,
+                              const CoordinateCacheHeader& header);
+   static bool SaveCoordinates(const std::vector<float>&    coordinates,
+                               const std::string&           filename,
+                               const CoordinateCacheHeader& header);
+
+   void CalculateCoordinates(std::uint32_t                      radials,
+                             const units::angle::degrees<float> radialAngle,
+                             const units::angle::degrees<float> angleOffset,
+                             const float                        gateRangeOffset,
+                             bool                               exact,
+                             std::vector<float>& outputCoordinates);
 
    static void
    PopulateProductTimes(std::shared_ptr<ProviderManager> providerManager,
@@ -221,6 +503,17 @@ public:
                         std::shared_mutex&               productRecordMutex,
                         std::chrono::system_clock::time_point time);
 
+   static std::size_t DownloadThreadCount();
+   static bool IsElevationComplete(const wsr88d::rda::ElevationScan& scan);
+
+   static void               InitializeLocalData();
+   static void               InitializeMirrors();
+   static void               InitializeObjectCache();
+   static const std::string& CoordinateCachePath();
+   static const std::string& Level2CachePath();
+   static const std::string& PrecipitationPath();
+   static void               PruneLevel2Cache();
+
    static void
    LoadNexradFile(CreateNexradFileFunction                           load,
                   const std::shared_ptr<request::NexradFileRequest>& request,
@@ -234,20 +527,34 @@ public:
    std::shared_ptr<config::RadarSite> radarSite_;
    std::size_t                        cacheLimit_ {6u};
 
-   std::vector<float> coordinates0_5Degree_ {};
-   std::vector<float> coordinates0_5DegreeSmooth_ {};
-   std::vector<float> coordinates1Degree_ {};
-   std::vector<float> coordinates1DegreeSmooth_ {};
+   CoordinateGrid coordinates0_5Degree_ {};
+   CoordinateGrid coordinates0_5DegreeSmooth_ {};
+   CoordinateGrid coordinates1Degree_ {};
+   CoordinateGrid coordinates1DegreeSmooth_ {};
 
-   RadarProductRecordMap  level2ProductRecords_ {};
-   RadarProductRecordList level2ProductRecentRecords_ {};
+   RadarProductRecordMap level2ProductRecords_ {};
    std::unordered_map<std::string, RadarProductRecordMap>
-      level3ProductRecordsMap_ {};
-   std::unordered_map<std::string, RadarProductRecordList>
-                     level3ProductRecentRecordsMap_ {};
+                     level3ProductRecordsMap_ {};
    std::shared_mutex level2ProductRecordMutex_ {};
    std::shared_mutex level3ProductRecordMutex_ {};
 
+   /**
+    * @brief Elevation scans of each loaded level 2 volume, by data block type,
+    * coded elevation angle and scan time. Under SAILS and MESO-SAILS, the
+    * newest scan of an elevation may be in a volume still being received.
+    */
+   struct IndexedCut
+   {
+      std::weak_ptr<wsr88d::rda::ElevationScan> elevationScan_ {};
+      std::weak_ptr<types::RadarProductRecord>  record_ {};
+   };
+   std::unordered_map<
+      wsr88d::rda::DataBlockType,
+      std::map<std::uint16_t,
+               std::map<std::chrono::system_clock::time_point, IndexedCut>>>
+              cutIndex_ {};
+   std::mutex cutIndexMutex_ {};
+
    std::shared_ptr<ProviderManager> level2ProviderManager_;
    std::unordered_map<std::string, std::shared_ptr<ProviderManager>>
                      level3ProviderManagerMap_ {};
@@ -255,8 +562,89 @@ public:
 
    std::mutex initializeMutex_ {};
    std::mutex level3ProductsInitializeMutex_ {};
-   std::mutex loadLevel2DataMutex_ {};
-   std::mutex loadLevel3DataMutex_ {};
+
+   /**
+    * @brief Requests waiting on a provider object being loaded. An object is
+    * only loaded once, however many requests are made while it is in flight.
+    */
+   struct ProviderLoad
+   {
+      std::vector<std::shared_ptr<request::NexradFileRequest>> requests_ {};
+      LoadPriority priority_ {LoadPriority::Low};
+      bool         started_ {false};
+
+      bool cancelled() const
+      {
+         return std::ranges::all_of(
+            requests_,
+            [](const std::shared_ptr<request::NexradFileRequest>& request)
+            { return request != nullptr && request->is_cancelled(); });
+      }
+   };
+   typedef std::pair<const ProviderManager*,
+                     std::chrono::system_clock::time_point>
+      ProviderLoadKey;
+
+   std::map<ProviderLoadKey, ProviderLoad> providerLoads_ {};
+   std::mutex                              providerLoadsMutex_ {};
+   std::atomic<bool>                       loadsCancelled_ {false};
+
+   /**
+    * @brief Loads a provider object, as a coroutine moving between the
+    * download and decode pools: the object is listed, downloaded unless it is
+    * cached, decoded and cached, and the waiting requests are notified. The
+    * load is abandoned between stages, and its download interrupted, once it
+    * is no longer wanted.
+    */
+   scwx::util::DetachedTask
+   RunProviderLoad(ProviderLoadKey                  loadKey,
+                   std::shared_ptr<ProviderManager> providerManager,
+                   RadarProductRecordMap&           recordMap,
+                   std::shared_mutex&               recordMutex,
+                   LoadPriority                     priority);
+   /**
+    * @brief Whether a provider load is no longer wanted: loads have been
+    * cancelled, or each request waiting on the load has been cancelled by its
+    * requester. Loads with a request not owned by any requester, such as
+    * prefetching, are always wanted.
+    */
+   bool IsProviderLoadCancelled(const ProviderLoadKey& loadKey);
+   /**
+    * @brief Abandons a provider load if it is no longer wanted, completing
+    * the waiting requests without data.
+    *
+    * @return true if the load was abandoned
+    */
+   bool AbandonProviderLoad(const ProviderLoadKey& loadKey);
+   static std::shared_ptr<types::RadarProductRecord>
+   FindProviderRecord(RadarProductRecordMap&                recordMap,
+                      std::shared_mutex&                    recordMutex,
+                      std::chrono::system_clock::time_point time);
+
+   /**
+    * @brief Frames of a loop being prefetched, newest first. Each frame is the
+    * time of one product with refresh enabled.
+    */
+   struct PrefetchFrame
+   {
+      std::shared_ptr<ProviderManager>      providerManager_;
+      std::chrono::system_clock::time_point time_;
+   };
+   struct PrefetchPlan
+   {
+      std::uint64_t                         generation_ {0u};
+      std::chrono::system_clock::time_point startTime_ {};
+      std::chrono::system_clock::time_point endTime_ {};
+      std::vector<PrefetchFrame>            frames_ {};
+      std::size_t                           level3FrameCount_ {0u};
+      std::size_t                           nextFrame_ {0u};
+      std::size_t                           framesLoaded_ {0u};
+      std::size_t                           framesInFlight_ {0u};
+      bool                                  planned_ {false};
+   };
+
+   PrefetchPlan       prefetchPlan_ {};
+   mutable std::mutex prefetchPlanMutex_ {};
 
    common::Level3ProductCategoryMap availableCategoryMap_ {};
    std::shared_mutex                availableCategoryMutex_ {};
@@ -266,6 +654,74 @@ public:
                       boost::hash<boost::uuids::uuid>>
                      refreshMap_ {};
    std::shared_mutex refreshMapMutex_ {};
+
+   // Latest volume loaded while monitoring the radar site
+   QMetaObject::Connection                    monitorConnection_ {};
+   std::shared_ptr<types::RadarProductRecord> monitoredRecord_ {nullptr};
+   std::mutex                                 monitorMutex_ {};
+
+   /**
+    * @brief Derived level 2 data, keyed by product and the elevation scan it
+    * was derived from. Volume products are keyed by the lowest elevation scan.
+    */
+   struct DerivedLevel2Data
+   {
+      std::weak_ptr<wsr88d::rda::ElevationScan>   source_ {};
+      std::shared_ptr<wsr88d::rda::ElevationScan> derived_ {};
+      std::size_t                                 volumeScans_ {0u};
+      float                                       stormDirection_ {0.0f};
+      float                                       stormSpeed_ {0.0f};
+      std::uint64_t                               accumulationRevision_ {0u};
+      bool                                        computing_ {false};
+   };
+   typedef std::pair<common::Level2Product, const wsr88d::rda::ElevationScan*>
+      DerivedLevel2Key;
+
+   std::map<DerivedLevel2Key, DerivedLevel2Data> derivedLevel2Data_ {};
+   std::mutex                                    derivedLevel2DataMutex_ {};
+
+   /**
+    * @brief Column state of each volume, keyed by the lowest elevation scan,
+    * shared between the volume products of the volume. Each elevation scan is
+    * accumulated once as it completes.
+    */
+   struct ColumnAccumulatorData
+   {
+      std::weak_ptr<wsr88d::rda::ElevationScan>       source_ {};
+      std::shared_ptr<wsr88d::rda::ColumnAccumulator> accumulator_ {};
+   };
+
+   std::map<const wsr88d::rda::ElevationScan*, ColumnAccumulatorData>
+      columnAccumulators_ {};
+
+   /**
+    * @brief Precipitation accumulation of the radar site, loaded from disk
+    * when first used, and saved after volumes are accumulated.
+    */
+   std::shared_ptr<wsr88d::rda::PrecipitationAccumulator>
+                     precipitationAccumulator_ {};
+   std::mutex        precipitationAccumulatorMutex_ {};
+   std::atomic<bool> precipitationSavePending_ {false};
+
+   std::shared_ptr<const wsr88d::rda::PrecipitationAccumulator>
+        AccumulatePrecipitation(std::chrono::system_clock::time_point time);
+   void SavePrecipitation();
+   std::string PrecipitationFilename() const;
+
+   // Compressed level 2 volumes by volume time, held by compressedVolumeCache_
+   std::map<std::chrono::system_clock::time_point,
+            std::weak_ptr<const wsr88d::Ar2vFile::CompressedVolume>>
+      compressedVolumes_ {};
+
+   // Records reloaded since DataReloaded was last emitted
+   std::vector<std::shared_ptr<types::RadarProductRecord>> reloadedRecords_ {};
+   std::mutex reloadedRecordsMutex_ {};
+
+   util::CoalescedSignal dataReloaded_ {QCoreApplication::instance(),
+                                        [this]() { EmitDataReloaded(); }};
+   util::CoalescedSignal level3ProductsChanged_ {
+      QCoreApplication::instance(),
+      [this]() { Q_EMIT self_->Level3ProductsChanged(); }};
 };
 
 RadarProductManager::RadarProductManager(const std::string& radarId) :
@@ -294,6 +750,42 @@ std::string ProviderManager::name() const
    return name;
 }
 
+void ProviderManager::EmitNewDataAvailable(RadarProductManager* self)
+{
+   std::chrono::system_clock::time_point latestTime {};
+
+   {
+      std::unique_lock lock {pendingMutex_};
+      std::swap(latestTime, pendingLatestTime_);
+   }
+
+   if (latestTime != std::chrono::system_clock::time_point {})
+   {
+      Q_EMIT self->NewDataAvailable(group_, product_, latestTime);
+   }
+}
+
+std::chrono::system_clock::time_point ProviderManager::listed_time(
+   std::chrono::system_clock::time_point productTime) const
+{
+   std::unique_lock lock {listedMutex_};
+   return (productTime == listedProductTime_) ?
+             listedTime_ :
+             std::chrono::system_clock::time_point {};
+}
+
+void ProviderManager::set_listed_time(
+   std::chrono::system_clock::time_point productTime,
+   std::chrono::system_clock::time_point listedTime)
+{
+   std::unique_lock lock {listedMutex_};
+   if (productTime != listedProductTime_)
+   {
+      listedProductTime_ = productTime;
+      listedTime_        = listedTime;
+   }
+}
+
 void ProviderManager::Disable()
 {
    logger_->debug("Disabling refresh: {}", name());
@@ -305,6 +797,9 @@ void ProviderManager::Disable()
 
 void RadarProductManager::Cleanup()
 {
+   SetPredictedSites({});
+   SetMonitoredSites({});
+
    {
       std::unique_lock lock(fileIndexMutex_);
       fileIndex_.clear();
@@ -329,7 +824,9 @@ void RadarProductManager::DumpRecords()
             auto radarProductManager = instance.second.lock();
             if (radarProductManager != nullptr)
             {
-               logger_->info(" {}", radarProductManager->radar_site()->id());
+               logger_->info(" {} ({} bytes cached)",
+                             radarProductManager->radar_site()->id(),
+                             radarProductManager->cache_size_bytes());
                logger_->info("  Level 2");
 
                {
@@ -371,34 +868,21 @@ void RadarProductManager::DumpRecords()
       });
 }
 
-const std::vector<float>&
+std::size_t RadarProductManager::cache_size_bytes() const
+{
+   std::unique_lock lock {recordCacheMutex_};
+   return recordCache_.size_bytes_if(
+      [this](const RadarProductRecordGroup& group)
+      { return group.first == p->radarId_; });
+}
+
+std::span<const float>
 RadarProductManager::coordinates(common::RadialSize radialSize,
                                  bool               smoothingEnabled) const
 {
-   switch (radialSize)
-   {
-   case common::RadialSize::_0_5Degree:
-      if (smoothingEnabled)
-      {
-         return p->coordinates0_5DegreeSmooth_;
-      }
-      else
-      {
-         return p->coordinates0_5Degree_;
-      }
-   case common::RadialSize::_1Degree:
-      if (smoothingEnabled)
-      {
-         return p->coordinates1DegreeSmooth_;
-      }
-      else
-      {
-         return p->coordinates1Degree_;
-      }
-   default:
-      throw std::invalid_argument("Invalid radial size");
-   }
+   return p->GetCoordinates(radialSize, smoothingEnabled);
 }
+
 const scwx::util::time_zone* RadarProductManager::default_time_zone() const
 {
    types::DefaultTimeZone defaultTimeZone = types::GetDefaultTimeZone(
@@ -443,6 +927,24 @@ std::shared_ptr<config::RadarSite> RadarProductManager::radar_site() const
    return p->radarSite_;
 }
 
+std::optional<std::pair<std::size_t, std::size_t>>
+RadarProductManager::prefetch_progress() const
+{
+   std::unique_lock lock {p->prefetchPlanMutex_};
+
+   if (!p->prefetchPlan_.planned_)
+   {
+      return std::nullopt;
+   }
+
+   const std::size_t frameCount = p->prefetchPlan_.frames_.size() +
+                                  p->prefetchPlan_.level3FrameCount_;
+
+   // Level 3 frames listed after planning may complete beyond the count
+   return std::make_pair(std::min(p->prefetchPlan_.framesLoaded_, frameCount),
+                         frameCount);
+}
+
 void RadarProductManager::Initialize()
 {
    std::unique_lock lock {p->initializeMutex_};
@@ -454,108 +956,214 @@ void RadarProductManager::Initialize()
 
    logger_->debug("Initialize()");
 
-   boost::timer::cpu_timer timer;
+   // Coordinates are calculated or loaded from disk on first use
 
-   // Calculate half degree azimuth coordinates
-   timer.start();
-   std::vector<float>& coordinates0_5Degree = p->coordinates0_5Degree_;
+   p->initialized_ = true;
+}
 
-   coordinates0_5Degree.resize(NUM_COORIDNATES_0_5_DEGREE);
+std::span<const float>
+RadarProductManagerImpl::GetCoordinates(common::RadialSize radialSize,
+                                        bool               smoothingEnabled)
+{
+   CoordinateGrid* grid = nullptr;
 
-   const auto radialGates0_5Degree =
-      boost::irange<uint32_t>(0, NUM_RADIAL_GATES_0_5_DEGREE);
+   switch (radialSize)
+   {
+   case common::RadialSize::_0_5Degree:
+      grid = smoothingEnabled ? &coordinates0_5DegreeSmooth_ :
+                                &coordinates0_5Degree_;
+      break;
+   case common::RadialSize::_1Degree:
+      grid = smoothingEnabled ? &coordinates1DegreeSmooth_ :
+                                &coordinates1Degree_;
+      break;
+   default:
+      throw std::invalid_argument("Invalid radial size");
+   }
 
-   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
-   // descriptions
-   p->CalculateCoordinates(
-      radialGates0_5Degree,
-      units::angle::degrees<float> {0.5f}, // Radial angle
-      units::angle::degrees<float> {0.0f}, // Angle offset
-      // Far end of the first gate is the gate size distance from the radar site
-      1.0f,
-      coordinates0_5Degree);
-   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+   std::call_once(grid->initialized_,
+                  [&]()
+                  { LoadCoordinates(*grid, radialSize, smoothingEnabled); });
 
-   timer.stop();
-   logger_->debug("Coordinates (0.5 degree) calculated in {}",
-                  timer.format(kTimerPlaces_, "%ws"));
+   return grid->coordinates_;
+}
 
-   // Calculate half degree smooth azimuth coordinates
-   timer.start();
-   std::vector<float>& coordinates0_5DegreeSmooth =
-      p->coordinates0_5DegreeSmooth_;
+void RadarProductManagerImpl::LoadCoordinates(
+   CoordinateGrid& grid, common::RadialSize radialSize, bool smoothingEnabled)
+{
+   const bool halfDegree = (radialSize == common::RadialSize::_0_5Degree);
 
-   coordinates0_5DegreeSmooth.resize(NUM_COORIDNATES_0_5_DEGREE);
+   const std::uint32_t radialGates =
+      halfDegree ? NUM_RADIAL_GATES_0_5_DEGREE : NUM_RADIAL_GATES_1_DEGREE;
+   const std::string description =
+      fmt::format("{} degree{}",
+                  halfDegree ? "0.5" : "1",
+                  smoothingEnabled ? " smooth" : "");
 
    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
    // descriptions
-   p->CalculateCoordinates(radialGates0_5Degree,
-                           units::angle::degrees<float> {0.5f},  // Radial angle
-                           units::angle::degrees<float> {0.25f}, // Angle offset
-                           // Center of the first gate is half the gate size
-                           // distance from the radar site
-                           0.5f,
-                           coordinates0_5DegreeSmooth);
+   const float radialAngle = halfDegree ? 0.5f : 1.0f;
+   const float gateSize    = self_->gate_size();
+
+   // Coordinates are approximated unless exact geometry is requested, or the
+   // approximation is not accurate enough at this site
+   const bool exact =
+      settings::GeneralSettings::Instance().exact_radar_geometry().GetValue() ||
+      !util::GeographicLib::RadialGeodesic::IsAccurate(
+         radarSite_->latitude(),
+         radarSite_->longitude(),
+         (common::MAX_DATA_MOMENT_GATES + 1) * gateSize);
+
+   // Smooth coordinates are at the center of each bin. Otherwise, the far end
+   // of the first gate is the gate size distance from the radar site.
+   const CoordinateCacheHeader header {
+      .magic_           = kCoordinateCacheMagic_,
+      .version_         = kCoordinateCacheVersion_,
+      .latitude_        = radarSite_->latitude(),
+      .longitude_       = radarSite_->longitude(),
+      .gateSize_        = gateSize,
+      .radialAngle_     = radialAngle,
+      .angleOffset_     = smoothingEnabled ? radialAngle / 2 : 0.0f,
+      .gateRangeOffset_ = smoothingEnabled ? 0.5f : 1.0f,
+      .exact_           = exact ? 1u : 0u,
+      .count_           = static_cast<std::uint64_t>(radialGates) * 2};
    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
 
+   const std::string& cachePath = CoordinateCachePath();
+   std::string        cacheFilename {};
+   if (!cachePath.empty())
+   {
+      cacheFilename = fmt::format("{}{}_{}{}.sgrid",
+                                  cachePath,
+                                  radarId_,
+                                  halfDegree ? "0_5" : "1",
+                                  smoothingEnabled ? "_smooth" : "");
+   }
+
+   if (!cacheFilename.empty() && MapCoordinates(grid, cacheFilename, header))
+   {
+      logger_->debug("Coordinates ({}) loaded from disk cache", description);
+      return;
+   }
+
+   boost::timer::cpu_timer timer;
+
+   grid.calculated_.resize(header.count_);
+   CalculateCoordinates(radialGates / common::MAX_DATA_MOMENT_GATES,
+                        units::angle::degrees<float> {header.radialAngle_},
+                        units::angle::degrees<float> {header.angleOffset_},
+                        header.gateRangeOffset_,
+                        exact,
+                        grid.calculated_);
+
    timer.stop();
-   logger_->debug("Coordinates (0.5 degree smooth) calculated in {}",
+   logger_->debug("Coordinates ({}, {}) calculated in {}",
+                  description,
+                  exact ? "exact" : "approximate",
                   timer.format(kTimerPlaces_, "%ws"));
 
-   // Calculate 1 degree azimuth coordinates
-   timer.start();
-   std::vector<float>& coordinates1Degree = p->coordinates1Degree_;
+   if (!cacheFilename.empty() &&
+       SaveCoordinates(grid.calculated_, cacheFilename, header) &&
+       MapCoordinates(grid, cacheFilename, header))
+   {
+      // Release the calculated coordinates in favor of the mapped file
+      grid.calculated_ = {};
+      return;
+   }
 
-   coordinates1Degree.resize(NUM_COORIDNATES_1_DEGREE);
+   grid.coordinates_ = grid.calculated_;
+}
 
-   const auto radialGates1Degree =
-      boost::irange<uint32_t>(0, NUM_RADIAL_GATES_1_DEGREE);
+bool RadarProductManagerImpl::MapCoordinates(
+   CoordinateGrid&              grid,
+   const std::string&           filename,
+   const CoordinateCacheHeader& header)
+{
+   std::error_code error;
+   if (!std::filesystem::exists(filename, error))
+   {
+      return false;
+   }
 
-   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
-   // descriptions
-   p->CalculateCoordinates(
-      radialGates1Degree,
-      units::angle::degrees<float> {1.0f}, // Radial angle
-      units::angle::degrees<float> {0.0f}, // Angle offset
-      // Far end of the first gate is the gate size distance from the radar site
-      1.0f,
-      coordinates1Degree);
-   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+   try
+   {
+      grid.file_.open(filename);
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->warn("Unable to map coordinate cache: {}", ex.what());
+      return false;
+   }
 
-   timer.stop();
-   logger_->debug("Coordinates (1 degree) calculated in {}",
-                  timer.format(kTimerPlaces_, "%ws"));
+   CoordinateCacheHeader fileHeader {};
 
-   // Calculate 1 degree smooth azimuth coordinates
-   timer.start();
-   std::vector<float>& coordinates1DegreeSmooth = p->coordinates1DegreeSmooth_;
+   if (grid.file_.is_open() &&
+       grid.file_.size() ==
+          sizeof(CoordinateCacheHeader) + header.count_ * sizeof(float))
+   {
+      std::memcpy(&fileHeader, grid.file_.data(), sizeof(fileHeader));
+   }
 
-   coordinates1DegreeSmooth.resize(NUM_COORIDNATES_1_DEGREE);
+   if (fileHeader != header)
+   {
+      // The cache file is for a different radar site location or layout
+      grid.file_.close();
+      return false;
+   }
 
-   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Values are given
-   // descriptions
-   p->CalculateCoordinates(radialGates1Degree,
-                           units::angle::degrees<float> {1.0f}, // Radial angle
-                           units::angle::degrees<float> {0.5f}, // Angle offset
-                           // Center of the first gate is half the gate size
-                           // distance from the radar site
-                           0.5f,
-                           coordinates1DegreeSmooth);
-   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+   grid.coordinates_ = std::span<const float>(
+      reinterpret_cast<const float*>(grid.file_.data() +
+                                     sizeof(CoordinateCacheHeader)),
+      header.count_);
 
-   timer.stop();
-   logger_->debug("Coordinates (1 degree smooth) calculated in {}",
-                  timer.format(kTimerPlaces_, "%ws"));
+   return true;
+}
 
-   p->initialized_ = true;
+bool RadarProductManagerImpl::SaveCoordinates(
+   const std::vector<float>&    coordinates,
+   const std::string&           filename,
+   const CoordinateCacheHeader& header)
+{
+   // Write to a temporary file first, so a partially written file is never
+   // mapped
+   const std::string tempFilename = filename + ".tmp";
+
+   {
+      std::ofstream os {tempFilename, std::ios::binary | std::ios::trunc};
+
+      os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      os.write(reinterpret_cast<const char*>(coordinates.data()),
+               static_cast<std::streamsize>(coordinates.size() *
+                                            sizeof(float)));
+
+      if (!os.good())
+      {
+         logger_->warn("Unable to write coordinate cache: {}", filename);
+         return false;
+      }
+   }
+
+   std::error_code error;
+   std::filesystem::rename(tempFilename, filename, error);
+   if (error)
+   {
+      logger_->warn("Unable to write coordinate cache: {} ({})",
+                    filename,
+                    error.message());
+      std::filesystem::remove(tempFilename, error);
+      return false;
+   }
+
+   return true;
 }
 
 void RadarProductManagerImpl::CalculateCoordinates(
-   const boost::integer_range<std::uint32_t>& radialGates,
-   const units::angle::degrees<float>         radialAngle,
-   const units::angle::degrees<float>         angleOffset,
-   const float                                gateRangeOffset,
-   std::vector<float>&                        outputCoordinates)
+   std::uint32_t                      radials,
+   const units::angle::degrees<float> radialAngle,
+   const units::angle::degrees<float> angleOffset,
+   const float                        gateRangeOffset,
+   bool                               exact,
+   std::vector<float>&                outputCoordinates)
 {
    const GeographicLib::Geodesic& geodesic(
       util::GeographicLib::DefaultGeodesic());
@@ -565,31 +1173,49 @@ void RadarProductManagerImpl::CalculateCoordinates(
 
    const float gateSize = self_->gate_size();
 
+   const boost::integer_range<std::uint32_t> radialRange =
+      boost::irange<std::uint32_t>(0, radials);
+
    std::for_each(
       std::execution::par_unseq,
-      radialGates.begin(),
-      radialGates.end(),
-      [&](uint32_t radialGate)
+      radialRange.begin(),
+      radialRange.end(),
+      [&](std::uint32_t radial)
       {
-         const auto gate = static_cast<std::uint16_t>(
-            radialGate % common::MAX_DATA_MOMENT_GATES);
-         const auto radial = static_cast<std::uint16_t>(
-            radialGate / common::MAX_DATA_MOMENT_GATES);
-
          const float angle = static_cast<float>(radial) * radialAngle.value() +
                              angleOffset.value();
-         const float range =
-            (static_cast<float>(gate) + gateRangeOffset) * gateSize;
-         const std::size_t offset = static_cast<std::size_t>(radialGate) * 2;
+         const std::size_t offset = static_cast<std::size_t>(radial) *
+                                    common::MAX_DATA_MOMENT_GATES * 2;
 
-         double latitude  = 0.0;
-         double longitude = 0.0;
+         if (!exact)
+         {
+            // Evaluate the radial once, and step along it for each gate
+            const util::GeographicLib::RadialGeodesic radialGeodesic {
+               radar.first, radar.second, angle};
+
+            radialGeodesic.Positions(gateRangeOffset * gateSize,
+                                     gateSize,
+                                     common::MAX_DATA_MOMENT_GATES,
+                                     &outputCoordinates[offset]);
+            return;
+         }
+
+         for (std::uint32_t gate = 0; gate < common::MAX_DATA_MOMENT_GATES;
+              ++gate)
+         {
+            const float range =
+               (static_cast<float>(gate) + gateRangeOffset) * gateSize;
+            const std::size_t gateOffset = offset + gate * 2;
 
-         geodesic.Direct(
-            radar.first, radar.second, angle, range, latitude, longitude);
+            double latitude  = 0.0;
+            double longitude = 0.0;
 
-         outputCoordinates[offset]     = static_cast<float>(latitude);
-         outputCoordinates[offset + 1] = static_cast<float>(longitude);
+            geodesic.Direct(
+               radar.first, radar.second, angle, range, latitude, longitude);
+
+            outputCoordinates[gateOffset]     = static_cast<float>(latitude);
+            outputCoordinates[gateOffset + 1] = static_cast<float>(longitude);
+         }
       });
 }
 
@@ -716,6 +1342,9 @@ void RadarProductManagerImpl::EnableRefresh(
       if (enabled)
       {
          RefreshData(providerManager);
+
+         // Include the product in the loop being prefetched
+         QueuePrefetchPlan();
       }
    }
 }
@@ -747,7 +1376,9 @@ void RadarProductManagerImpl::RefreshData(
 void RadarProductManagerImpl::RefreshDataSync(
    std::shared_ptr<ProviderManager> providerManager)
 {
-   using namespace std::chrono_literals;
+   scwx::util::ScopedTimer timer {
+      scwx::util::ProfileStage::ProviderRefresh,
+      scwx::util::Profiler::RegisterLabel(providerManager->name())};
 
    auto [newObjects, totalObjects] = providerManager->provider_->Refresh();
 
@@ -758,30 +1389,23 @@ void RadarProductManagerImpl::RefreshDataSync(
       std::string key = providerManager->provider_->FindLatestKey();
       auto latestTime = providerManager->provider_->GetTimePointByKey(key);
 
-      auto updatePeriod      = providerManager->provider_->update_period();
-      auto lastModified      = providerManager->provider_->last_modified();
-      auto sinceLastModified = std::chrono::system_clock::now() - lastModified;
+      auto updatePeriod = GetUpdatePeriod(providerManager);
+      auto lastModified = providerManager->provider_->last_modified();
 
-      // For the default interval, assume products are updated at a
-      // constant rate. Expect the next product at a time based on the
-      // previous two.
-      interval = std::chrono::duration_cast<std::chrono::milliseconds>(
-         updatePeriod - sinceLastModified);
-
-      if (updatePeriod > 0s && sinceLastModified > updatePeriod * 5)
-      {
-         // If it has been at least 5 update periods since the file has
-         // been last modified, slow the retry period
-         interval = kSlowRetryInterval_;
-      }
-      else if (interval < std::chrono::milliseconds {kFastRetryInterval_})
-      {
-         // The interval should be no quicker than the fast retry interval
-         interval = kFastRetryInterval_;
-      }
+      // Refresh when the next product is expected, backing off while it is
+      // overdue
+      interval =
+         provider::GetRefreshInterval(lastModified,
+                                      updatePeriod,
+                                      std::chrono::system_clock::now(),
+                                      kFastRetryInterval_,
+                                      kSlowRetryInterval_);
 
       if (newObjects > 0)
       {
+         providerManager->set_listed_time(latestTime,
+                                          std::chrono::system_clock::now());
+
          Q_EMIT providerManager->NewDataAvailable(
             providerManager->group_, providerManager->product_, latestTime);
       }
@@ -806,85 +1430,430 @@ void RadarProductManagerImpl::RefreshDataSync(
       {
          providerManager->refreshTimer_.expires_after(interval);
          providerManager->refreshTimer_.async_wait(
-            [=, this](const boost::system::error_code& e)
-            {
-               if (e == boost::system::errc::success)
-               {
-                  RefreshData(providerManager);
-               }
-               else if (e == boost::asio::error::operation_aborted)
-               {
-                  logger_->debug("[{}] Data refresh timer cancelled",
-                                 providerManager->name());
-               }
-               else
+            providerManager->strand_.Wrap(
+               [=, this](const boost::system::error_code& e)
                {
-                  logger_->warn("[{}] Data refresh timer error: {}",
-                                providerManager->name(),
-                                e.message());
-               }
-            });
+                  if (e == boost::system::errc::success)
+                  {
+                     RefreshData(providerManager);
+                  }
+                  else if (e == boost::asio::error::operation_aborted)
+                  {
+                     logger_->debug("[{}] Data refresh timer cancelled",
+                                    providerManager->name());
+                  }
+                  else
+                  {
+                     logger_->warn("[{}] Data refresh timer error: {}",
+                                   providerManager->name(),
+                                   e.message());
+                  }
+               }));
       }
    }
 }
 
-std::set<std::chrono::system_clock::time_point>
-RadarProductManager::GetActiveVolumeTimes(
-   std::chrono::system_clock::time_point time)
+void RadarProductManager::InitializeMonitor()
 {
-   std::unordered_set<std::shared_ptr<provider::NexradDataProvider>>
-                                                   providers {};
-   std::set<std::chrono::system_clock::time_point> volumeTimes {};
-   std::mutex                                      volumeTimesMutex {};
+   auto& monitoredRadarSites =
+      settings::GeneralSettings::Instance().monitored_radar_sites();
 
-   // Return a default set of volume times if the default time point is given
-   if (time == std::chrono::system_clock::time_point {})
-   {
-      return volumeTimes;
-   }
+   const auto setMonitoredSites = [](const std::string& value)
+   { SetMonitoredSites(ParseRadarSites(value)); };
 
-   // Lock the refresh map
-   std::shared_lock refreshLock {p->refreshMapMutex_};
+   setMonitoredSites(monitoredRadarSites.GetValue());
+   monitoredRadarSites.RegisterValueChangedCallback(setMonitoredSites);
+}
 
-   // For each entry in the refresh map (refresh is enabled)
-   for (auto& refreshEntry : p->refreshMap_)
+void RadarProductManager::SetMonitoredSites(
+   const std::vector<std::string>& radarSites)
+{
    {
-      // Add the provider for the current entry
-      providers.insert(refreshEntry.second->provider_);
+      std::unique_lock lock {monitoredSitesMutex_};
+      configuredMonitoredSites_ = radarSites;
    }
 
-   // Unlock the refresh map
-   refreshLock.unlock();
+   RadarProductManagerImpl::UpdateMonitoredSites();
+}
 
-   const auto today     = std::chrono::floor<std::chrono::days>(time);
-   const auto yesterday = today - std::chrono::days {1};
-   const auto tomorrow  = today + std::chrono::days {1};
-   const auto dates     = {yesterday, today, tomorrow};
+void RadarProductManager::SetPredictedSites(
+   const std::vector<std::string>& radarSites)
+{
+   {
+      std::unique_lock lock {monitoredSitesMutex_};
 
-   // For each provider (in parallel)
-   std::for_each(
-      std::execution::par_unseq,
-      providers.begin(),
-      providers.end(),
-      [&](const std::shared_ptr<provider::NexradDataProvider>& provider)
+      if (radarSites == predictedMonitoredSites_)
       {
-         // For yesterday, today and tomorrow (in parallel)
-         std::for_each(std::execution::par_unseq,
-                       dates.begin(),
-                       dates.end(),
-                       [&](const auto& date)
-                       {
-                          // Don't query for a time point in the future
-                          if (date > std::chrono::system_clock::now())
-                          {
-                             return;
-                          }
+         return;
+      }
 
-                          // Query the provider for volume time points
-                          auto timePoints = provider->GetTimePointsByDate(date);
+      predictedMonitoredSites_ = radarSites;
+   }
 
-                          // TODO: Note, this will miss volume times present in
-                          // Level 2 products with a second scan
+   RadarProductManagerImpl::UpdateMonitoredSites();
+}
+
+void RadarProductManagerImpl::UpdateMonitoredSites()
+{
+   std::vector<std::shared_ptr<RadarProductManager>> releasedSites {};
+
+   {
+      std::unique_lock lock {monitoredSitesMutex_};
+
+      std::vector<std::string> radarSites {configuredMonitoredSites_};
+      for (auto& radarSite : predictedMonitoredSites_)
+      {
+         if (std::find(radarSites.cbegin(), radarSites.cend(), radarSite) ==
+             radarSites.cend())
+         {
+            radarSites.push_back(radarSite);
+         }
+      }
+
+      // Stop monitoring radar sites which are no longer listed
+      for (auto it = monitoredSites_.begin(); it != monitoredSites_.end();)
+      {
+         if (std::find(radarSites.cbegin(), radarSites.cend(), it->first) ==
+             radarSites.cend())
+         {
+            logger_->info("Stopped monitoring: {}", it->first);
+
+            it->second->p->EnableMonitor(false);
+            releasedSites.push_back(std::move(it->second));
+            it = monitoredSites_.erase(it);
+         }
+         else
+         {
+            ++it;
+         }
+      }
+
+      for (auto& radarSite : radarSites)
+      {
+         if (monitoredSites_.contains(radarSite))
+         {
+            continue;
+         }
+
+         if (config::RadarSite::Get(radarSite) == nullptr)
+         {
+            logger_->warn("Cannot monitor unknown radar site: {}", radarSite);
+            continue;
+         }
+
+         logger_->info("Monitoring: {}", radarSite);
+
+         auto radarProductManager = RadarProductManager::Instance(radarSite);
+         radarProductManager->p->EnableMonitor(true);
+         monitoredSites_.emplace(radarSite, std::move(radarProductManager));
+      }
+   }
+
+   // Released radar sites are destroyed outside of the lock if they are not
+   // displayed
+   releasedSites.clear();
+}
+
+std::vector<std::string> RadarProductManager::monitored_sites()
+{
+   std::unique_lock lock {monitoredSitesMutex_};
+
+   std::vector<std::string> radarSites {};
+   for (auto& monitoredSite : monitoredSites_)
+   {
+      radarSites.push_back(monitoredSite.first);
+   }
+
+   return radarSites;
+}
+
+void RadarProductManagerImpl::EnableMonitor(bool enabled)
+{
+   if (enabled)
+   {
+      // Load the latest volume when new data is found. The connection is
+      // direct, as monitored radar sites may not be displayed.
+      monitorConnection_ = QObject::connect(
+         level2ProviderManager_.get(),
+         &ProviderManager::NewDataAvailable,
+         self_,
+         [this](common::RadarProductGroup,
+                const std::string&,
+                std::chrono::system_clock::time_point latestTime)
+         { LoadMonitoredData(latestTime); },
+         Qt::DirectConnection);
+   }
+   else
+   {
+      QObject::disconnect(monitorConnection_);
+
+      std::shared_ptr<types::RadarProductRecord> record = nullptr;
+
+      {
+         std::unique_lock lock {monitorMutex_};
+         std::swap(record, monitoredRecord_);
+      }
+
+      ReleaseMonitoredRecord(std::move(record));
+   }
+
+   EnableRefresh(kMonitorUuid_, level2ProviderManager_, enabled);
+}
+
+bool RadarProductManagerImpl::IsRefreshEnabledForDisplay()
+{
+   std::shared_lock lock {refreshMapMutex_};
+
+   return std::any_of(refreshMap_.cbegin(),
+                      refreshMap_.cend(),
+                      [](const auto& refreshEntry)
+                      { return refreshEntry.first != kMonitorUuid_; });
+}
+
+void RadarProductManagerImpl::LoadMonitoredData(
+   std::chrono::system_clock::time_point time)
+{
+   logger_->debug("LoadMonitoredData: {}, {}",
+                  radarId_,
+                  scwx::util::TimeString(time));
+
+   auto request = std::make_shared<request::NexradFileRequest>(radarId_);
+
+   QObject::connect(
+      request.get(),
+      &request::NexradFileRequest::RequestComplete,
+      self_,
+      [this](std::shared_ptr<request::NexradFileRequest> request)
+      {
+         auto record = request->radar_product_record();
+         if (record == nullptr)
+         {
+            return;
+         }
+
+         std::shared_ptr<types::RadarProductRecord> previousRecord = nullptr;
+
+         {
+            std::unique_lock lock {monitorMutex_};
+            previousRecord = std::exchange(monitoredRecord_, record);
+         }
+
+         if (previousRecord != record)
+         {
+            ReleaseMonitoredRecord(std::move(previousRecord));
+         }
+      },
+      Qt::DirectConnection);
+
+   // Monitored data is loaded behind data requested for display
+   LoadProviderData(time,
+                    level2ProviderManager_,
+                    level2ProductRecords_,
+                    level2ProductRecordMutex_,
+                    request,
+                    LoadPriority::Low);
+}
+
+void RadarProductManagerImpl::ReleaseMonitoredRecord(
+   std::shared_ptr<types::RadarProductRecord> record)
+{
+   // Only the latest volume is retained for a radar site which is monitored,
+   // but not displayed
+   if (record != nullptr && !IsRefreshEnabledForDisplay())
+   {
+      std::unique_lock lock {recordCacheMutex_};
+      recordCache_.Erase(record);
+      recordCacheMemory_.set_bytes(recordCache_.size_bytes());
+   }
+}
+
+std::vector<std::string>
+RadarProductManager::ParseRadarSites(const std::string& value)
+{
+   std::vector<std::string> radarSites {};
+   std::string              radarSite {};
+
+   // Radar sites are separated by commas or whitespace
+   for (char c : value + ',')
+   {
+      if (c == ',' || std::isspace(static_cast<unsigned char>(c)))
+      {
+         if (!radarSite.empty())
+         {
+            radarSites.push_back(std::move(radarSite));
+            radarSite.clear();
+         }
+      }
+      else
+      {
+         radarSite.push_back(
+            static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+      }
+   }
+
+   return radarSites;
+}
+
+void RadarProductManager::NotifyObjectCreated(
+   const std::string& key, std::chrono::system_clock::time_point lastModified)
+{
+   std::vector<std::shared_ptr<RadarProductManager>> radarProductManagers {};
+
+   {
+      std::shared_lock lock {instanceMutex_};
+      for (auto& instance : instanceMap_)
+      {
+         auto radarProductManager = instance.second.lock();
+         if (radarProductManager != nullptr)
+         {
+            radarProductManagers.push_back(std::move(radarProductManager));
+         }
+      }
+   }
+
+   // Each provider ignores objects of other radar sites and products
+   for (auto& radarProductManager : radarProductManagers)
+   {
+      radarProductManager->p->AddObject(key, lastModified);
+   }
+}
+
+void RadarProductManagerImpl::AddObject(
+   const std::string& key, std::chrono::system_clock::time_point lastModified)
+{
+   std::vector<std::shared_ptr<ProviderManager>> providerManagers {
+      level2ProviderManager_};
+
+   {
+      std::shared_lock lock {level3ProviderManagerMutex_};
+      for (auto& providerManager : level3ProviderManagerMap_)
+      {
+         providerManagers.push_back(providerManager.second);
+      }
+   }
+
+   for (auto& providerManager : providerManagers)
+   {
+      if (providerManager->provider_->AddObject(key, lastModified))
+      {
+         logger_->debug("[{}] New object: {}", providerManager->name(), key);
+
+         // Load the new object now, rather than at the next refresh
+         if (providerManager->refreshEnabled_)
+         {
+            Q_EMIT providerManager->NewDataAvailable(
+               providerManager->group_,
+               providerManager->product_,
+               providerManager->provider_->GetTimePointByKey(key));
+         }
+
+         break;
+      }
+   }
+}
+
+std::chrono::seconds RadarProductManagerImpl::GetUpdatePeriod(
+   const std::shared_ptr<ProviderManager>& providerManager)
+{
+   using namespace std::chrono_literals;
+
+   auto updatePeriod = providerManager->provider_->update_period();
+
+   if (providerManager->group_ != common::RadarProductGroup::Level2)
+   {
+      return updatePeriod;
+   }
+
+   // The duration of the latest volume scan predicts the next volume, and
+   // follows VCP changes immediately
+   std::shared_ptr<types::RadarProductRecord> record = nullptr;
+
+   {
+      std::shared_lock lock {level2ProductRecordMutex_};
+      if (!level2ProductRecords_.empty())
+      {
+         record = level2ProductRecords_.crbegin()->second.lock();
+      }
+   }
+
+   auto level2File = (record != nullptr) ? record->level2_file() : nullptr;
+   auto vcpData    = (level2File != nullptr) ? level2File->vcp_data() : nullptr;
+
+   if (vcpData != nullptr)
+   {
+      const auto volumeScanDuration = vcpData->volume_scan_duration();
+
+      // Object intervals include antenna transitions, so are preferred unless
+      // the VCP has changed
+      if (volumeScanDuration > 0s &&
+          (updatePeriod <= 0s ||
+           std::chrono::abs(updatePeriod - volumeScanDuration) * 4 >
+              updatePeriod))
+      {
+         updatePeriod = volumeScanDuration;
+      }
+   }
+
+   return updatePeriod;
+}
+
+std::set<std::chrono::system_clock::time_point>
+RadarProductManager::GetActiveVolumeTimes(
+   std::chrono::system_clock::time_point time)
+{
+   std::unordered_set<std::shared_ptr<provider::NexradDataProvider>>
+                                                   providers {};
+   std::set<std::chrono::system_clock::time_point> volumeTimes {};
+   std::mutex                                      volumeTimesMutex {};
+
+   // Return a default set of volume times if the default time point is given
+   if (time == std::chrono::system_clock::time_point {})
+   {
+      return volumeTimes;
+   }
+
+   // Lock the refresh map
+   std::shared_lock refreshLock {p->refreshMapMutex_};
+
+   // For each entry in the refresh map (refresh is enabled)
+   for (auto& refreshEntry : p->refreshMap_)
+   {
+      // Add the provider for the current entry
+      providers.insert(refreshEntry.second->provider_);
+   }
+
+   // Unlock the refresh map
+   refreshLock.unlock();
+
+   const auto today     = std::chrono::floor<std::chrono::days>(time);
+   const auto yesterday = today - std::chrono::days {1};
+   const auto tomorrow  = today + std::chrono::days {1};
+   const auto dates     = {yesterday, today, tomorrow};
+
+   // For each provider (in parallel)
+   std::for_each(
+      std::execution::par_unseq,
+      providers.begin(),
+      providers.end(),
+      [&](const std::shared_ptr<provider::NexradDataProvider>& provider)
+      {
+         // For yesterday, today and tomorrow (in parallel)
+         std::for_each(std::execution::par_unseq,
+                       dates.begin(),
+                       dates.end(),
+                       [&](const auto& date)
+                       {
+                          // Don't query for a time point in the future
+                          if (date > std::chrono::system_clock::now())
+                          {
+                             return;
+                          }
+
+                          // Query the provider for volume time points
+                          auto timePoints = provider->GetTimePointsByDate(date);
+
+                          // TODO: Note, this will miss volume times present in
+                          // Level 2 products with a second scan
 
                           // Lock the merged volume time list
                           std::unique_lock volumeTimesLock {volumeTimesMutex};
@@ -906,105 +1875,1350 @@ void RadarProductManagerImpl::LoadProviderData(
    std::shared_ptr<ProviderManager>                   providerManager,
    RadarProductRecordMap&                             recordMap,
    std::shared_mutex&                                 recordMutex,
-   std::mutex&                                        loadDataMutex,
-   const std::shared_ptr<request::NexradFileRequest>& request)
+   const std::shared_ptr<request::NexradFileRequest>& request,
+   LoadPriority                                       priority)
 {
    logger_->debug("LoadProviderData: {}, {}",
                   providerManager->name(),
                   scwx::util::TimeString(time));
 
-   LoadNexradFileAsync(
-      [=, &recordMap, &recordMutex]() -> std::shared_ptr<wsr88d::NexradFile>
-      {
-         std::shared_ptr<types::RadarProductRecord> existingRecord = nullptr;
-         std::shared_ptr<wsr88d::NexradFile>        nexradFile     = nullptr;
+   const ProviderLoadKey loadKey {providerManager.get(), time};
 
-         {
-            std::shared_lock sharedLock {recordMutex};
+   {
+      std::unique_lock lock {providerLoadsMutex_};
 
-            auto it = recordMap.find(time);
-            if (it != recordMap.cend())
-            {
-               existingRecord = it->second.lock();
+      auto       it       = providerLoads_.find(loadKey);
+      const bool inFlight = (it != providerLoads_.end());
 
-               if (existingRecord != nullptr)
-               {
-                  logger_->debug(
-                     "Data previously loaded, loading from data cache");
-               }
-            }
-         }
+      if (!inFlight)
+      {
+         it = providerLoads_.emplace(loadKey, ProviderLoad {}).first;
+      }
 
-         if (existingRecord == nullptr)
-         {
-            std::string key = providerManager->provider_->FindKey(time);
+      ProviderLoad& load = it->second;
+      load.requests_.push_back(request);
 
-            if (!key.empty())
-            {
-               nexradFile = providerManager->provider_->LoadObjectByKey(key);
-            }
-            else
-            {
-               logger_->warn("Attempting to load object without key: {}",
-                             scwx::util::TimeString(time));
-            }
-         }
-         else
-         {
-            nexradFile = existingRecord->nexrad_file();
-         }
+      // Lower priority values are loaded first
+      if (inFlight && (load.started_ || priority >= load.priority_))
+      {
+         // The object is already being loaded, and completes this request
+         logger_->debug("Data is already loading");
+         return;
+      }
 
-         return nexradFile;
-      },
-      request,
-      loadDataMutex,
-      time);
+      // A prefetched object requested for display is queued again at a
+      // higher priority, and loaded by whichever task starts first
+      load.priority_ = priority;
+   }
+
+   RunProviderLoad(loadKey, providerManager, recordMap, recordMutex, priority);
 }
 
-void RadarProductManager::LoadLevel2Data(
-   std::chrono::system_clock::time_point              time,
-   const std::shared_ptr<request::NexradFileRequest>& request)
+scwx::util::DetachedTask RadarProductManagerImpl::RunProviderLoad(
+   ProviderLoadKey                  loadKey,
+   std::shared_ptr<ProviderManager> providerManager,
+   RadarProductRecordMap&           recordMap,
+   std::shared_mutex&               recordMutex,
+   LoadPriority                     priority)
 {
-   logger_->debug("LoadLevel2Data: {}", scwx::util::TimeString(time));
+   const std::chrono::system_clock::time_point time = loadKey.second;
 
-   p->LoadProviderData(time,
-                       p->level2ProviderManager_,
-                       p->level2ProductRecords_,
-                       p->level2ProductRecordMutex_,
-                       p->loadLevel2DataMutex_,
-                       request);
-}
+   std::shared_ptr<types::RadarProductRecord> residentRecord =
+      FindProviderRecord(recordMap, recordMutex, time);
 
-void RadarProductManager::LoadLevel3Data(
-   const std::string&                                 product,
-   std::chrono::system_clock::time_point              time,
-   const std::shared_ptr<request::NexradFileRequest>& request)
-{
-   logger_->debug("LoadLevel3Data: {}", scwx::util::TimeString(time));
+   if (residentRecord != nullptr)
+   {
+      // Resident data is not queued behind downloads
+      co_await decodePool_.Schedule(LoadPriority::High);
+
+      CompleteProviderLoad(
+         providerManager.get(), time, residentRecord->nexrad_file());
+      co_return;
+   }
+
+   // Objects in the disk or compressed volume cache do not need a download
+   // slot, and are read directly on the decode pool
+   const std::string cacheFilename = Level2CacheFilename(providerManager, time);
+   std::error_code   error;
+   const bool        cached =
+      (!cacheFilename.empty() &&
+       std::filesystem::exists(cacheFilename, error)) ||
+      HasCompressedVolume(time);
+
+   // List
+   co_await (cached ? decodePool_ : downloadPool_).Schedule(priority);
+
+   {
+      std::unique_lock lock {providerLoadsMutex_};
+
+      auto it = providerLoads_.find(loadKey);
+      if (it == providerLoads_.end() || it->second.started_)
+      {
+         // The object has been loaded by another task
+         co_return;
+      }
+
+      it->second.started_ = true;
+   }
+
+   if (AbandonProviderLoad(loadKey))
+   {
+      co_return;
+   }
+
+   std::shared_ptr<types::RadarProductRecord> existingRecord =
+      FindProviderRecord(recordMap, recordMutex, time);
+
+   if (existingRecord != nullptr)
+   {
+      logger_->debug("Data previously loaded, loading from data cache");
+      CompleteProviderLoad(
+         providerManager.get(), time, existingRecord->nexrad_file());
+      co_return;
+   }
+
+   std::string                           key {};
+   std::shared_ptr<std::vector<char>>    data = nullptr;
+   std::chrono::system_clock::time_point downloadedTime {};
+   bool                                  failed = false;
+
+   try
+   {
+      key = providerManager->provider_->FindKey(time);
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->error(ex.what());
+      failed = true;
+   }
+
+   if (!failed && key.empty())
+   {
+      logger_->warn("Attempting to load object without key: {}",
+                    scwx::util::TimeString(time));
+      failed = true;
+   }
+
+   if (failed)
+   {
+      CompleteProviderLoad(providerManager.get(), time, nullptr);
+      co_return;
+   }
+
+   if (!cached)
+   {
+      // Download
+      const bool rangedDownload =
+         priority == LoadPriority::High &&
+         providerManager->group_ == common::RadarProductGroup::Level2 &&
+         settings::GeneralSettings::Instance()
+            .radar_ranged_download()
+            .GetValue();
+
+      try
+      {
+         if (rangedDownload)
+         {
+            // Decode the volume as it is downloaded, such that the lowest
+            // elevations are displayed first
+            LoadProviderObjectRanged(providerManager, key, time, loadKey);
+            co_return;
+         }
+
+         data = providerManager->provider_->DownloadObjectByKey(
+            key,
+            [this, &loadKey]() { return IsProviderLoadCancelled(loadKey); });
+         downloadedTime = std::chrono::system_clock::now();
+      }
+      catch (const std::exception& ex)
+      {
+         logger_->error(ex.what());
+         failed = true;
+      }
+
+      if (AbandonProviderLoad(loadKey))
+      {
+         co_return;
+      }
+
+      if (failed)
+      {
+         CompleteProviderLoad(providerManager.get(), time, nullptr);
+         co_return;
+      }
+
+      // Decode on the decode pool, so further downloads are not held up by
+      // decoding
+      co_await decodePool_.Schedule(priority);
+   }
+
+   // Requests may have been superseded while waiting on the decode pool
+   if (AbandonProviderLoad(loadKey))
+   {
+      co_return;
+   }
+
+   // Decode and cache
+   std::shared_ptr<wsr88d::NexradFile> nexradFile = nullptr;
+
+   try
+   {
+      nexradFile = LoadProviderObject(providerManager, key, time, data);
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->error(ex.what());
+   }
+
+   // Notify
+   CompleteProviderLoad(
+      providerManager.get(), time, nexradFile, downloadedTime);
+}
+
+bool RadarProductManagerImpl::IsProviderLoadCancelled(
+   const ProviderLoadKey& loadKey)
+{
+   if (loadsCancelled_)
+   {
+      return true;
+   }
+
+   std::unique_lock lock {providerLoadsMutex_};
+
+   auto it = providerLoads_.find(loadKey);
+   return it == providerLoads_.end() || it->second.cancelled();
+}
+
+bool RadarProductManagerImpl::AbandonProviderLoad(
+   const ProviderLoadKey& loadKey)
+{
+   std::vector<std::shared_ptr<request::NexradFileRequest>> requests {};
+
+   {
+      std::unique_lock lock {providerLoadsMutex_};
+
+      auto it = providerLoads_.find(loadKey);
+      if (it != providerLoads_.end())
+      {
+         if (!loadsCancelled_ && !it->second.cancelled())
+         {
+            return false;
+         }
+
+         requests = std::move(it->second.requests_);
+         providerLoads_.erase(it);
+      }
+   }
+
+   if (!requests.empty())
+   {
+      logger_->debug("Provider load abandoned: {}",
+                     scwx::util::TimeString(loadKey.second));
+   }
+
+   for (auto& request : requests)
+   {
+      request->set_radar_product_record(nullptr);
+      Q_EMIT request->RequestComplete(request);
+   }
+
+   return true;
+}
+
+std::shared_ptr<types::RadarProductRecord>
+RadarProductManagerImpl::FindProviderRecord(
+   RadarProductRecordMap&                recordMap,
+   std::shared_mutex&                    recordMutex,
+   std::chrono::system_clock::time_point time)
+{
+   std::shared_lock lock {recordMutex};
+
+   auto it = recordMap.find(time);
+   if (it != recordMap.cend())
+   {
+      return it->second.lock();
+   }
+
+   return nullptr;
+}
+
+std::shared_ptr<wsr88d::NexradFile> RadarProductManagerImpl::LoadProviderObject(
+   const std::shared_ptr<ProviderManager>&   providerManager,
+   const std::string&                        key,
+   std::chrono::system_clock::time_point     time,
+   const std::shared_ptr<std::vector<char>>& data)
+{
+   scwx::util::ScopedTimer timer {scwx::util::ProfileStage::ProductLoad};
+
+   const std::string cacheFilename = Level2CacheFilename(providerManager, time);
+
+   if (providerManager->group_ == common::RadarProductGroup::Level2)
+   {
+      // Volumes released from memory are restored from their compressed form
+      // before the disk cache or provider is used
+      auto ar2vFile = LoadCompressedVolume(time);
+      if (ar2vFile != nullptr)
+      {
+         return ar2vFile;
+      }
+   }
+
+   if (data == nullptr && !cacheFilename.empty())
+   {
+      std::error_code error;
+      if (std::filesystem::exists(cacheFilename, error))
+      {
+         auto ar2vFile = std::make_shared<wsr88d::Ar2vFile>();
+
+         if (ar2vFile->LoadCacheFile(cacheFilename))
+         {
+            logger_->debug("Loaded level 2 data from disk cache: {}",
+                           cacheFilename);
+            StoreCompressedVolume(time, ar2vFile);
+            return ar2vFile;
+         }
+
+         // Remove the invalid cache file
+         std::filesystem::remove(cacheFilename, error);
+      }
+   }
+
+   std::shared_ptr<wsr88d::NexradFile> nexradFile = nullptr;
+
+   if (data != nullptr)
+   {
+      scwx::util::vectorbuf dataBuffer {*data};
+      dataBuffer.update_read_pointers(data->size());
+      std::istream is {&dataBuffer};
+
+      const auto decodeStart = std::chrono::steady_clock::now();
+
+      nexradFile = wsr88d::NexradFileFactory::Create(is);
+
+      scwx::util::Metrics::Observe(
+         scwx::util::Metric::DecodeSeconds,
+         common::GetRadarProductGroupName(providerManager->group_),
+         std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       decodeStart)
+            .count());
+   }
+   else
+   {
+      // The object was not downloaded, or the provider does not support
+      // separate downloads
+      nexradFile = providerManager->provider_->LoadObjectByKey(key);
+   }
+
+   if (providerManager->group_ == common::RadarProductGroup::Level2)
+   {
+      StoreCompressedVolume(time, nexradFile);
+   }
+
+   if (cacheFilename.empty())
+   {
+      return nexradFile;
+   }
+
+   // The volume has not yet been returned to any consumer, so its moment data
+   // has not been accessed and may be cached
+   auto ar2vFile = std::dynamic_pointer_cast<wsr88d::Ar2vFile>(nexradFile);
+   if (ar2vFile != nullptr && ar2vFile->SaveCacheFile(cacheFilename))
+   {
+      PruneLevel2Cache();
+   }
+
+   return nexradFile;
+}
+
+bool RadarProductManagerImpl::HasCompressedVolume(
+   std::chrono::system_clock::time_point time)
+{
+   std::unique_lock lock {compressedVolumeCacheMutex_};
+
+   auto it = compressedVolumes_.find(time);
+   return it != compressedVolumes_.cend() && !it->second.expired();
+}
+
+std::shared_ptr<wsr88d::Ar2vFile> RadarProductManagerImpl::LoadCompressedVolume(
+   std::chrono::system_clock::time_point time)
+{
+   std::shared_ptr<const wsr88d::Ar2vFile::CompressedVolume> volume = nullptr;
+
+   {
+      std::unique_lock lock {compressedVolumeCacheMutex_};
+
+      auto it = compressedVolumes_.find(time);
+      if (it != compressedVolumes_.cend())
+      {
+         volume = it->second.lock();
+         if (volume != nullptr)
+         {
+            compressedVolumeCache_.Touch(volume);
+         }
+         else
+         {
+            compressedVolumes_.erase(it);
+         }
+      }
+   }
+
+   if (volume == nullptr)
+   {
+      return nullptr;
+   }
+
+   // Decompression runs on the decode pool, so prefetched loop frames are
+   // restored ahead of playback
+   auto ar2vFile = std::make_shared<wsr88d::Ar2vFile>();
+   if (!ar2vFile->LoadCompressed(*volume))
+   {
+      return nullptr;
+   }
+
+   logger_->debug("Restored compressed level 2 volume: {}",
+                  scwx::util::TimeString(time));
+
+   return ar2vFile;
+}
+
+void RadarProductManagerImpl::StoreCompressedVolume(
+   std::chrono::system_clock::time_point      time,
+   const std::shared_ptr<wsr88d::NexradFile>& file)
+{
+   // Compressed volume cache size is specified in MiB, 0 is disabled
+   auto& generalSettings = settings::GeneralSettings::Instance();
+   const std::size_t byteLimit =
+      static_cast<std::size_t>(
+         generalSettings.radar_compressed_cache_size().GetValue())
+      << 20;
+
+   auto ar2vFile = std::dynamic_pointer_cast<wsr88d::Ar2vFile>(file);
+   if (byteLimit == 0 || ar2vFile == nullptr ||
+       time == std::chrono::system_clock::time_point {})
+   {
+      return;
+   }
+
+   if (HasCompressedVolume(time))
+   {
+      // The volume was restored from its compressed form
+      return;
+   }
+
+   // The volume has not yet been returned to any consumer, so its records are
+   // unmodified and may be compressed
+   auto volume = ar2vFile->Compress();
+   if (volume == nullptr)
+   {
+      return;
+   }
+
+   std::unique_lock lock {compressedVolumeCacheMutex_};
+
+   compressedVolumeCache_.set_byte_limit(byteLimit);
+   compressedVolumeCache_.Insert(radarId_, volume, volume->compressed_size());
+   compressedVolumeMemory_.set_bytes(compressedVolumeCache_.size_bytes());
+
+   // Release index entries of volumes evicted from the cache
+   std::erase_if(compressedVolumes_,
+                 [](const auto& entry) { return entry.second.expired(); });
+   compressedVolumes_[time] = volume;
+}
+
+void RadarProductManagerImpl::LoadProviderObjectRanged(
+   const std::shared_ptr<ProviderManager>& providerManager,
+   const std::string&                      key,
+   std::chrono::system_clock::time_point   time,
+   const ProviderLoadKey&                  loadKey)
+{
+   std::shared_ptr<types::RadarProductRecord> record              = nullptr;
+   std::shared_ptr<wsr88d::Ar2vFile>          rangedFile          = nullptr;
+   std::size_t                                completedElevations = 0;
+   std::size_t                                loadedElevations    = 0;
+
+   auto nexradFile = providerManager->provider_->LoadObjectByKeyRanged(
+      key,
+      kLevel2RangeSize_,
+      [&](const std::shared_ptr<wsr88d::NexradFile>& partialFile)
+      {
+         auto ar2vFile =
+            std::dynamic_pointer_cast<wsr88d::Ar2vFile>(partialFile);
+         if (ar2vFile == nullptr)
+         {
+            return;
+         }
+
+         if (rangedFile == nullptr)
+         {
+            // Elevations are completed while records are loaded, on this
+            // thread. Those already complete are reported immediately.
+            rangedFile = ar2vFile;
+            rangedFile->SetElevationCompleteCallback(
+               [&completedElevations](std::uint16_t, float)
+               { ++completedElevations; });
+         }
+
+         // Only elevations which have been completely loaded are indexed
+         if (completedElevations == loadedElevations)
+         {
+            return;
+         }
+
+         loadedElevations = completedElevations;
+
+         if (record == nullptr)
+         {
+            // Complete the request as soon as an elevation is available, and
+            // reload as further elevations complete
+            record = CompleteProviderLoad(providerManager.get(),
+                                          time,
+                                          ar2vFile,
+                                          std::chrono::system_clock::now());
+         }
+         else
+         {
+            QueueDataReloaded(record);
+         }
+      },
+      [this, &record, &loadKey]()
+      {
+         // Once the first elevation is available, the remainder of the volume
+         // is loaded into the stored record
+         return record == nullptr && IsProviderLoadCancelled(loadKey);
+      });
+
+   if (rangedFile != nullptr)
+   {
+      // The callback references this load
+      rangedFile->SetElevationCompleteCallback(nullptr);
+   }
+
+   if (record == nullptr)
+   {
+      if (!AbandonProviderLoad(loadKey))
+      {
+         CompleteProviderLoad(providerManager.get(), time, nexradFile);
+      }
+   }
+   else if (nexradFile == nullptr)
+   {
+      logger_->warn("Ranged load incomplete: {}", key);
+   }
+}
+
+std::shared_ptr<types::RadarProductRecord>
+RadarProductManagerImpl::CompleteProviderLoad(
+   const ProviderManager*                providerManager,
+   std::chrono::system_clock::time_point time,
+   std::shared_ptr<wsr88d::NexradFile>   nexradFile,
+   std::chrono::system_clock::time_point downloadedTime)
+{
+   std::shared_ptr<types::RadarProductRecord> record = nullptr;
+
+   if (nexradFile != nullptr)
+   {
+      record = types::RadarProductRecord::Create(nexradFile);
+
+      types::ProductLatency latency {};
+      latency.set_stage_time(types::LatencyStage::Listed,
+                             providerManager->listed_time(time));
+      latency.set_stage_time(types::LatencyStage::Downloaded, downloadedTime);
+      latency.set_stage_time(types::LatencyStage::Decoded,
+                             std::chrono::system_clock::now());
+      record->set_latency(latency);
+
+      // The time the object was requested for overrides the time in the file,
+      // which can be a few seconds off for level 2 data
+      if (time != std::chrono::system_clock::time_point {})
+      {
+         record->set_time(time);
+      }
+
+      self_->Initialize();
+      record = StoreRadarProductRecord(record);
+   }
+
+   std::vector<std::shared_ptr<request::NexradFileRequest>> requests {};
+
+   {
+      std::unique_lock lock {providerLoadsMutex_};
+
+      auto it = providerLoads_.find({providerManager, time});
+      if (it != providerLoads_.end())
+      {
+         requests = std::move(it->second.requests_);
+         providerLoads_.erase(it);
+      }
+   }
+
+   for (auto& request : requests)
+   {
+      if (request != nullptr)
+      {
+         request->set_radar_product_record(record);
+         Q_EMIT request->RequestComplete(request);
+      }
+   }
+
+   return record;
+}
+
+std::string RadarProductManagerImpl::Level2CacheFilename(
+   const std::shared_ptr<ProviderManager>& providerManager,
+   std::chrono::system_clock::time_point   time) const
+{
+   const std::string& cachePath = Level2CachePath();
+
+   if (providerManager->group_ != common::RadarProductGroup::Level2 ||
+       time == std::chrono::system_clock::time_point {} || cachePath.empty())
+   {
+      return {};
+   }
+
+   return cachePath + wsr88d::Ar2vFile::GetCacheFilename(radarId_, time);
+}
+
+std::size_t RadarProductManagerImpl::DownloadThreadCount()
+{
+   auto& generalSettings = settings::GeneralSettings::Instance();
+   return static_cast<std::size_t>(
+      generalSettings.radar_download_threads().GetValue());
+}
+
+bool RadarProductManagerImpl::IsElevationComplete(
+   const wsr88d::rda::ElevationScan& scan)
+{
+   using RadialStatus = wsr88d::rda::RadialStatus;
+
+   // The elevation is complete once its last radial has been received
+   const auto radialStatus =
+      static_cast<RadialStatus>(scan.crbegin()->second->radial_status());
+
+   return radialStatus == RadialStatus::EndOfElevation ||
+          radialStatus == RadialStatus::EndOfVolumeScan;
+}
+
+void RadarProductManagerImpl::InitializeLocalData()
+{
+   static std::once_flag initialized {};
+
+   std::call_once(
+      initialized,
+      []()
+      {
+         // Providers created after the directory changes will use it
+         const auto setDirectory = [](const std::string& directory)
+         {
+            provider::NexradDataProviderFactory::SetLocalDirectory(directory);
+            LocalDataManager::Instance().SetDirectory(directory);
+         };
+
+         auto& localDirectory =
+            settings::GeneralSettings::Instance().nexrad_local_directory();
+
+         // The first manager may be created from a worker thread
+         setDirectory(*localDirectory.GetSnapshot());
+
+         localDirectory.RegisterValueChangedCallback(setDirectory);
+      });
+}
+
+void RadarProductManagerImpl::InitializeMirrors()
+{
+   static std::once_flag initialized {};
+
+   std::call_once(
+      initialized,
+      []()
+      {
+         using Factory = provider::NexradDataProviderFactory;
+
+         // Providers created after the mirrors change will use them
+         const auto setLevel2Mirrors = [](const std::string& value)
+         { Factory::SetLevel2Mirrors(Factory::ParseMirrors(value)); };
+         const auto setLevel3Mirrors = [](const std::string& value)
+         { Factory::SetLevel3Mirrors(Factory::ParseMirrors(value)); };
+
+         auto& generalSettings = settings::GeneralSettings::Instance();
+         auto& level2Mirrors   = generalSettings.nexrad_level2_mirrors();
+         auto& level3Mirrors   = generalSettings.nexrad_level3_mirrors();
+
+         // The first manager may be created from a worker thread
+         setLevel2Mirrors(*level2Mirrors.GetSnapshot());
+         setLevel3Mirrors(*level3Mirrors.GetSnapshot());
+
+         level2Mirrors.RegisterValueChangedCallback(setLevel2Mirrors);
+         level3Mirrors.RegisterValueChangedCallback(setLevel3Mirrors);
+      });
+}
+
+void RadarProductManagerImpl::InitializeObjectCache()
+{
+   static std::once_flag initialized {};
+
+   std::call_once(
+      initialized,
+      []()
+      {
+         // Object cache size is specified in MiB
+         const auto setMaxSize = [](std::int64_t value)
+         {
+            provider::ObjectCache::Instance().SetMaxSize(
+               static_cast<std::size_t>(value) << 20);
+         };
+
+         auto& objectCacheSize =
+            settings::GeneralSettings::Instance().nexrad_object_cache_size();
+
+         setMaxSize(objectCacheSize.GetValue());
+         provider::ObjectCache::Instance().SetPath(
+            QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+               .toStdString() +
+            "/objects");
+
+         objectCacheSize.RegisterValueChangedCallback(setMaxSize);
+      });
+}
+
+const std::string& RadarProductManagerImpl::CoordinateCachePath()
+{
+   static const std::string cachePath = []()
+   {
+      std::string path {
+         QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            .toStdString() +
+         "/coordinates"};
+
+      std::error_code error;
+      if (!std::filesystem::exists(path, error) &&
+          !std::filesystem::create_directories(path, error))
+      {
+         logger_->error(
+            "Unable to create coordinate cache directory: \"{}\" ({})",
+            path,
+            error.message());
+         return std::string {};
+      }
+
+      return path + "/";
+   }();
+
+   return cachePath;
+}
+
+const std::string& RadarProductManagerImpl::PrecipitationPath()
+{
+   static const std::string path = []()
+   {
+      std::string path {
+         QStandardPaths::writableLocation(QStandardPaths::AppDataLocation)
+            .toStdString() +
+         "/precipitation"};
+
+      std::error_code error;
+      if (!std::filesystem::exists(path, error) &&
+          !std::filesystem::create_directories(path, error))
+      {
+         logger_->error(
+            "Unable to create precipitation directory: \"{}\" ({})",
+            path,
+            error.message());
+         return std::string {};
+      }
+
+      return path + "/";
+   }();
+
+   return path;
+}
+
+std::string RadarProductManagerImpl::PrecipitationFilename() const
+{
+   const std::string& path = PrecipitationPath();
+
+   return path.empty() ? std::string {} :
+                         fmt::format("{}{}.qpe", path, radarId_);
+}
+
+std::shared_ptr<const wsr88d::rda::PrecipitationAccumulator>
+RadarProductManagerImpl::AccumulatePrecipitation(
+   std::chrono::system_clock::time_point time)
+{
+   std::unique_lock lock {precipitationAccumulatorMutex_};
+
+   if (precipitationAccumulator_ == nullptr)
+   {
+      precipitationAccumulator_ =
+         std::make_shared<wsr88d::rda::PrecipitationAccumulator>();
+
+      // Continue the accumulation saved by a previous session
+      const std::string filename = PrecipitationFilename();
+      std::ifstream     is {filename, std::ios::binary};
+      if (is.is_open() && precipitationAccumulator_->Load(is))
+      {
+         logger_->debug("Precipitation accumulation loaded: {}", filename);
+      }
+   }
+
+   // Volumes loaded since the last volume accumulated, oldest first
+   std::vector<std::shared_ptr<types::RadarProductRecord>> records {};
+
+   {
+      std::shared_lock recordLock {level2ProductRecordMutex_};
+
+      for (auto it = level2ProductRecords_.upper_bound(
+              precipitationAccumulator_->end_time());
+           it != level2ProductRecords_.cend() && it->first <= time;
+           ++it)
+      {
+         auto record = it->second.lock();
+         if (record != nullptr && record->level2_file() != nullptr)
+         {
+            records.push_back(std::move(record));
+         }
+      }
+   }
+
+   std::size_t accumulated = 0u;
+
+   for (auto& record : records)
+   {
+      std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan = nullptr;
+
+      // The first scan of the lowest elevation is accumulated
+      std::tie(elevationScan, std::ignore) =
+         record->level2_file()->FindElevationScan(
+            wsr88d::rda::DataBlockType::MomentRef, 0.0f, record->time());
+
+      if (elevationScan == nullptr || elevationScan->empty() ||
+          !IsElevationComplete(*elevationScan))
+      {
+         continue;
+      }
+
+      auto& radial0  = elevationScan->cbegin()->second;
+      auto  scanTime = scwx::util::TimePoint(radial0->modified_julian_date(),
+                                            radial0->collection_time());
+
+      if (precipitationAccumulator_->Accumulate(elevationScan, scanTime))
+      {
+         ++accumulated;
+      }
+   }
+
+   if (accumulated > 0u)
+   {
+      logger_->debug("Accumulated precipitation of {} volumes", accumulated);
+
+      if (!precipitationSavePending_.exchange(true))
+      {
+         decodePool_.Post(LoadPriority::Background,
+                          [this]() { SavePrecipitation(); });
+      }
+   }
+
+   return precipitationAccumulator_;
+}
+
+void RadarProductManagerImpl::SavePrecipitation()
+{
+   precipitationSavePending_ = false;
+
+   const std::string filename = PrecipitationFilename();
+   if (filename.empty())
+   {
+      return;
+   }
+
+   // Write to a temporary file first, so a partially written file is never
+   // loaded
+   const std::string tempFilename = filename + ".tmp";
+
+   {
+      std::unique_lock lock {precipitationAccumulatorMutex_};
+      std::ofstream    os {tempFilename, std::ios::binary | std::ios::trunc};
+
+      if (!precipitationAccumulator_->Save(os) || !os.good())
+      {
+         logger_->warn("Unable to write precipitation accumulation: {}",
+                       filename);
+         return;
+      }
+   }
+
+   std::error_code error;
+   std::filesystem::rename(tempFilename, filename, error);
+   if (error)
+   {
+      logger_->warn("Unable to write precipitation accumulation: {} ({})",
+                    filename,
+                    error.message());
+      std::filesystem::remove(tempFilename, error);
+   }
+}
+
+const std::string& RadarProductManagerImpl::Level2CachePath()
+{
+   static const std::string cachePath = []()
+   {
+      std::string path {
+         QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            .toStdString() +
+         "/level2"};
+
+      std::error_code error;
+      if (!std::filesystem::exists(path, error) &&
+          !std::filesystem::create_directories(path, error))
+      {
+         logger_->error("Unable to create level 2 cache directory: \"{}\" ({})",
+                        path,
+                        error.message());
+         return std::string {};
+      }
+
+      return path + "/";
+   }();
+
+   return cachePath;
+}
+
+void RadarProductManagerImpl::PruneLevel2Cache()
+{
+   std::unique_lock lock {level2CacheMutex_};
+
+   std::vector<std::filesystem::directory_entry> entries {};
+   std::uintmax_t                                totalSize = 0;
+   std::error_code                               error;
+
+   for (auto& entry :
+        std::filesystem::directory_iterator(Level2CachePath(), error))
+   {
+      if (entry.is_regular_file(error) && entry.path().extension() == ".ar2c")
+      {
+         totalSize += entry.file_size(error);
+         entries.push_back(entry);
+      }
+   }
+
+   if (totalSize <= kLevel2CacheMaxSize_)
+   {
+      return;
+   }
+
+   // Remove the least recently written volumes first
+   std::sort(entries.begin(),
+             entries.end(),
+             [](const auto& a, const auto& b)
+             {
+                std::error_code ec;
+                return a.last_write_time(ec) < b.last_write_time(ec);
+             });
+
+   for (auto& entry : entries)
+   {
+      if (totalSize <= kLevel2CacheMaxSize_)
+      {
+         break;
+      }
+
+      std::uintmax_t fileSize = entry.file_size(error);
+      if (std::filesystem::remove(entry.path(), error))
+      {
+         SPDLOG_LOGGER_TRACE(logger_,
+                             "Pruned level 2 cache file: {}",
+                             entry.path().string());
+         totalSize -= fileSize;
+      }
+   }
+}
+
+void RadarProductManager::LoadLevel2Data(
+   std::chrono::system_clock::time_point              time,
+   const std::shared_ptr<request::NexradFileRequest>& request)
+{
+   logger_->debug("LoadLevel2Data: {}", scwx::util::TimeString(time));
+
+   p->LoadProviderData(time,
+                       p->level2ProviderManager_,
+                       p->level2ProductRecords_,
+                       p->level2ProductRecordMutex_,
+                       request,
+                       LoadPriority::High);
+}
+
+void RadarProductManager::PrefetchLoop(
+   std::chrono::system_clock::time_point startTime,
+   std::chrono::system_clock::time_point endTime)
+{
+   logger_->debug("PrefetchLoop: {} - {}",
+                  scwx::util::TimeString(startTime),
+                  scwx::util::TimeString(endTime));
+
+   {
+      std::unique_lock lock {p->prefetchPlanMutex_};
+      p->prefetchPlan_.startTime_ = startTime;
+      p->prefetchPlan_.endTime_   = endTime;
+   }
+
+   p->QueuePrefetchPlan();
+}
+
+void RadarProductManager::CancelPrefetch()
+{
+   logger_->debug("CancelPrefetch()");
+
+   std::unique_lock lock {p->prefetchPlanMutex_};
+
+   // Frames already loading are completed, but no further frames are loaded
+   const std::uint64_t generation = p->prefetchPlan_.generation_ + 1u;
+   p->prefetchPlan_               = {};
+   p->prefetchPlan_.generation_   = generation;
+}
+
+void RadarProductManagerImpl::QueuePrefetchPlan()
+{
+   std::uint64_t generation;
+
+   {
+      std::unique_lock lock {prefetchPlanMutex_};
+
+      if (prefetchPlan_.startTime_ == std::chrono::system_clock::time_point {})
+      {
+         // No loop is being prefetched
+         return;
+      }
+
+      generation = ++prefetchPlan_.generation_;
+      prefetchPlan_.planned_ = false;
+   }
+
+   boost::asio::post(threadPool_,
+                     [=, this]()
+                     {
+                        try
+                        {
+                           PlanPrefetch(generation);
+                        }
+                        catch (const std::exception& ex)
+                        {
+                           logger_->error(ex.what());
+                        }
+                     });
+}
+
+void RadarProductManagerImpl::PlanPrefetch(std::uint64_t generation)
+{
+   std::chrono::system_clock::time_point startTime;
+   std::chrono::system_clock::time_point endTime;
+
+   {
+      std::unique_lock lock {prefetchPlanMutex_};
+
+      if (generation != prefetchPlan_.generation_)
+      {
+         // The plan has been replaced
+         return;
+      }
+
+      startTime = prefetchPlan_.startTime_;
+      endTime   = prefetchPlan_.endTime_;
+   }
+
+   // Frames are loaded for each product with refresh enabled
+   std::set<std::shared_ptr<ProviderManager>> providerManagers {};
+
+   {
+      std::shared_lock lock {refreshMapMutex_};
+
+      for (auto& refreshEntry : refreshMap_)
+      {
+         providerManagers.insert(refreshEntry.second);
+      }
+   }
+
+   std::vector<PrefetchFrame> frames {};
+   std::vector<std::string>   level3Products {};
+   std::size_t                level3FrameCount {0u};
+
+   for (auto& providerManager : providerManagers)
+   {
+      // Dates in the range are listed concurrently
+      auto timePoints = providerManager->provider_->GetTimePointsByDateRange(
+         startTime, endTime);
+
+      const bool level3 =
+         (providerManager->group_ == common::RadarProductGroup::Level3);
+
+      if (level3)
+      {
+         level3Products.push_back(providerManager->product_);
+      }
+
+      for (auto& time : timePoints)
+      {
+         if (startTime <= time && time <= endTime)
+         {
+            if (level3)
+            {
+               // Level 3 frames are loaded in bulk, and are only counted
+               ++level3FrameCount;
+            }
+            else
+            {
+               frames.push_back({providerManager, time});
+            }
+         }
+      }
+   }
+
+   // Load the newest frames first, and all products of a frame together
+   std::stable_sort(frames.begin(),
+                    frames.end(),
+                    [](const PrefetchFrame& a, const PrefetchFrame& b)
+                    { return a.time_ > b.time_; });
+
+   logger_->debug("Prefetching {} frames", frames.size() + level3FrameCount);
+
+   {
+      std::unique_lock lock {prefetchPlanMutex_};
+
+      if (generation != prefetchPlan_.generation_)
+      {
+         // The plan has been replaced
+         return;
+      }
+
+      prefetchPlan_.frames_           = std::move(frames);
+      prefetchPlan_.level3FrameCount_ = level3FrameCount;
+      prefetchPlan_.nextFrame_        = 0u;
+      prefetchPlan_.framesLoaded_     = 0u;
+      prefetchPlan_.framesInFlight_   = 0u;
+      prefetchPlan_.planned_          = true;
+   }
+
+   if (!level3Products.empty())
+   {
+      PrefetchLevel3Data(level3Products, startTime, endTime, generation);
+   }
+
+   PrefetchNextFrames(generation);
+}
+
+void RadarProductManagerImpl::CountPrefetchedFrame(std::uint64_t generation)
+{
+   std::unique_lock lock {prefetchPlanMutex_};
+
+   if (generation == prefetchPlan_.generation_ && prefetchPlan_.planned_)
+   {
+      ++prefetchPlan_.framesLoaded_;
+   }
+}
+
+void RadarProductManagerImpl::PrefetchNextFrames(std::uint64_t generation)
+{
+   std::vector<PrefetchFrame> frames {};
+
+   {
+      std::unique_lock lock {prefetchPlanMutex_};
+
+      if (generation != prefetchPlan_.generation_)
+      {
+         // The plan has been replaced
+         return;
+      }
+
+      // Limit the frames in flight, so frames complete in order, and so later
+      // requests for display are not queued behind the entire loop
+      while (prefetchPlan_.framesInFlight_ < downloadPool_.thread_count() &&
+             prefetchPlan_.nextFrame_ < prefetchPlan_.frames_.size())
+      {
+         frames.push_back(prefetchPlan_.frames_[prefetchPlan_.nextFrame_++]);
+         ++prefetchPlan_.framesInFlight_;
+      }
+   }
+
+   for (auto& frame : frames)
+   {
+      auto request = std::make_shared<request::NexradFileRequest>(radarId_);
+
+      QObject::connect(
+         request.get(),
+         &request::NexradFileRequest::RequestComplete,
+         [=, this](std::shared_ptr<request::NexradFileRequest>)
+         {
+            {
+               std::unique_lock lock {prefetchPlanMutex_};
+
+               if (generation != prefetchPlan_.generation_)
+               {
+                  return;
+               }
+
+               --prefetchPlan_.framesInFlight_;
+               ++prefetchPlan_.framesLoaded_;
+            }
+
+            PrefetchNextFrames(generation);
+         });
+
+      if (frame.providerManager_->group_ == common::RadarProductGroup::Level2)
+      {
+         LoadProviderData(frame.time_,
+                          frame.providerManager_,
+                          level2ProductRecords_,
+                          level2ProductRecordMutex_,
+                          request,
+                          LoadPriority::Low);
+      }
+      else
+      {
+         std::unique_lock       productRecordLock {level3ProductRecordMutex_};
+         RadarProductRecordMap& level3ProductRecords =
+            level3ProductRecordsMap_[frame.providerManager_->product_];
+         productRecordLock.unlock();
+
+         LoadProviderData(frame.time_,
+                          frame.providerManager_,
+                          level3ProductRecords,
+                          level3ProductRecordMutex_,
+                          request,
+                          LoadPriority::Low);
+      }
+   }
+}
+
+void RadarProductManager::LoadLevel3Data(
+   const std::string&                                 product,
+   std::chrono::system_clock::time_point              time,
+   const std::shared_ptr<request::NexradFileRequest>& request)
+{
+   logger_->debug("LoadLevel3Data: {}", scwx::util::TimeString(time));
+
+   // Look up provider manager
+   std::shared_lock providerManagerLock(p->level3ProviderManagerMutex_);
+   auto level3ProviderManager = p->level3ProviderManagerMap_.find(product);
+   if (level3ProviderManager == p->level3ProviderManagerMap_.cend())
+   {
+      logger_->debug("No level 3 provider manager for product: {}", product);
+      return;
+   }
+   providerManagerLock.unlock();
+
+   // Look up product record
+   std::unique_lock       productRecordLock(p->level3ProductRecordMutex_);
+   RadarProductRecordMap& level3ProductRecords =
+      p->level3ProductRecordsMap_[product];
+   productRecordLock.unlock();
+
+   // Load provider data
+   p->LoadProviderData(time,
+                       level3ProviderManager->second,
+                       level3ProductRecords,
+                       p->level3ProductRecordMutex_,
+                       request,
+                       LoadPriority::High);
+}
+
+void RadarProductManager::PrefetchLevel3Data(
+   const std::vector<std::string>&       products,
+   std::chrono::system_clock::time_point startTime,
+   std::chrono::system_clock::time_point endTime)
+{
+   std::uint64_t generation;
+
+   {
+      std::unique_lock lock {p->prefetchPlanMutex_};
+      generation = p->prefetchPlan_.generation_;
+   }
+
+   p->PrefetchLevel3Data(products, startTime, endTime, generation);
+}
+
+void RadarProductManagerImpl::PrefetchLevel3Data(
+   const std::vector<std::string>&       products,
+   std::chrono::system_clock::time_point startTime,
+   std::chrono::system_clock::time_point endTime,
+   std::uint64_t                         generation)
+{
+   logger_->debug("PrefetchLevel3Data: {} products, {} - {}",
+                  products.size(),
+                  scwx::util::TimeString(startTime),
+                  scwx::util::TimeString(endTime));
+
+   std::vector<std::shared_ptr<provider::NexradDataProvider>> providers {};
+   std::map<const provider::NexradDataProvider*, RadarProductRecordMap*>
+      recordMaps {};
+
+   for (auto& product : products)
+   {
+      auto providerManager = GetLevel3ProviderManager(product);
+
+      std::unique_lock productRecordLock {level3ProductRecordMutex_};
+      recordMaps[providerManager->provider_.get()] =
+         &level3ProductRecordsMap_[product];
+      productRecordLock.unlock();
+
+      providers.push_back(providerManager->provider_);
+   }
+
+   boost::asio::post(
+      threadPool_,
+      [=, this]()
+      {
+         try
+         {
+            provider::NexradDataProvider::Prefetch(
+               providers,
+               startTime,
+               endTime,
+               [=, this](const std::shared_ptr<provider::NexradDataProvider>&,
+                         const std::string&,
+                         std::chrono::system_clock::time_point time,
+                         std::shared_ptr<wsr88d::NexradFile>   nexradFile)
+               {
+                  if (nexradFile != nullptr)
+                  {
+                     auto record =
+                        types::RadarProductRecord::Create(nexradFile);
+                     record->set_time(time);
+
+                     StoreRadarProductRecord(record);
+                  }
+
+                  CountPrefetchedFrame(generation);
+               },
+               kPrefetchMaxInFlight_,
+               [=, this](
+                  const std::shared_ptr<provider::NexradDataProvider>& provider,
+                  std::chrono::system_clock::time_point                time)
+               {
+                  {
+                     std::unique_lock lock {prefetchPlanMutex_};
 
-   // Look up provider manager
-   std::shared_lock providerManagerLock(p->level3ProviderManagerMutex_);
-   auto level3ProviderManager = p->level3ProviderManagerMap_.find(product);
-   if (level3ProviderManager == p->level3ProviderManagerMap_.cend())
-   {
-      logger_->debug("No level 3 provider manager for product: {}", product);
-      return;
-   }
-   providerManagerLock.unlock();
+                     if (generation != prefetchPlan_.generation_)
+                     {
+                        // The prefetch has been cancelled or replaced
+                        return false;
+                     }
+                  }
 
-   // Look up product record
-   std::unique_lock       productRecordLock(p->level3ProductRecordMutex_);
-   RadarProductRecordMap& level3ProductRecords =
-      p->level3ProductRecordsMap_[product];
-   productRecordLock.unlock();
+                  if (FindProviderRecord(*recordMaps.at(provider.get()),
+                                         level3ProductRecordMutex_,
+                                         time) != nullptr)
+                  {
+                     // Resident frames are not downloaded again
+                     CountPrefetchedFrame(generation);
+                     return false;
+                  }
 
-   // Load provider data
-   p->LoadProviderData(time,
-                       level3ProviderManager->second,
-                       level3ProductRecords,
-                       p->level3ProductRecordMutex_,
-                       p->loadLevel3DataMutex_,
-                       request);
+                  return true;
+               });
+         }
+         catch (const std::exception& ex)
+         {
+            logger_->error(ex.what());
+         }
+      });
 }
 
 void RadarProductManager::LoadData(
@@ -1044,18 +3258,60 @@ void RadarProductManager::LoadFile(
 
    if (existingRecord == nullptr)
    {
-      QObject::connect(request.get(),
-                       &request::NexradFileRequest::RequestComplete,
-                       [=](std::shared_ptr<request::NexradFileRequest> request)
-                       {
-                          auto record = request->radar_product_record();
+      {
+         std::unique_lock lock {fileLoadsMutex_};
 
-                          if (record != nullptr)
-                          {
-                             std::unique_lock lock {fileIndexMutex_};
-                             fileIndex_[filename] = record;
-                          }
-                       });
+         auto& requests = fileLoads_[filename];
+         requests.push_back(request);
+
+         if (requests.size() > 1u)
+         {
+            // The file is already being loaded, and completes this request
+            logger_->debug("File is already loading");
+            return;
+         }
+      }
+
+      // Load the file once for every request made while it is in flight
+      auto loadRequest = std::make_shared<request::NexradFileRequest>(
+         request != nullptr ? request->current_radar_site() : std::string {});
+
+      QObject::connect(
+         loadRequest.get(),
+         &request::NexradFileRequest::RequestComplete,
+         [=](std::shared_ptr<request::NexradFileRequest> loadRequest)
+         {
+            auto record = loadRequest->radar_product_record();
+
+            if (record != nullptr)
+            {
+               std::unique_lock lock {fileIndexMutex_};
+               fileIndex_[filename] = record;
+            }
+
+            std::vector<std::shared_ptr<request::NexradFileRequest>>
+               requests {};
+
+            {
+               std::unique_lock lock {fileLoadsMutex_};
+
+               auto it = fileLoads_.find(filename);
+               if (it != fileLoads_.end())
+               {
+                  requests = std::move(it->second);
+                  fileLoads_.erase(it);
+               }
+            }
+
+            for (auto& request : requests)
+            {
+               if (request != nullptr)
+               {
+                  request->set_radar_product_record(record);
+                  Q_EMIT request->RequestComplete(request);
+               }
+            }
+         });
 
       scwx::util::async(
          [=]()
@@ -1063,7 +3319,7 @@ void RadarProductManager::LoadFile(
             RadarProductManagerImpl::LoadNexradFile(
                [=]() -> std::shared_ptr<wsr88d::NexradFile>
                { return wsr88d::NexradFileFactory::Create(filename); },
-               request,
+               loadRequest,
                fileLoadMutex_);
          });
    }
@@ -1074,26 +3330,6 @@ void RadarProductManager::LoadFile(
    }
 }
 
-void RadarProductManagerImpl::LoadNexradFileAsync(
-   CreateNexradFileFunction                           load,
-   const std::shared_ptr<request::NexradFileRequest>& request,
-   std::mutex&                                        mutex,
-   std::chrono::system_clock::time_point              time)
-{
-   boost::asio::post(threadPool_,
-                     [=, &mutex]()
-                     {
-                        try
-                        {
-                           LoadNexradFile(load, request, mutex, time);
-                        }
-                        catch (const std::exception& ex)
-                        {
-                           logger_->error(ex.what());
-                        }
-                     });
-}
-
 void RadarProductManagerImpl::LoadNexradFile(
    CreateNexradFileFunction                           load,
    const std::shared_ptr<request::NexradFileRequest>& request,
@@ -1102,7 +3338,12 @@ void RadarProductManagerImpl::LoadNexradFile(
 {
    std::unique_lock lock {mutex};
 
-   std::shared_ptr<wsr88d::NexradFile> nexradFile = load();
+   std::shared_ptr<wsr88d::NexradFile> nexradFile = nullptr;
+
+   {
+      scwx::util::ScopedTimer timer {scwx::util::ProfileStage::ProductLoad};
+      nexradFile = load();
+   }
 
    std::shared_ptr<types::RadarProductRecord> record  = nullptr;
    std::shared_ptr<RadarProductManager>       manager = nullptr;
@@ -1232,7 +3473,8 @@ void RadarProductManagerImpl::PopulateProductTimes(
 std::map<std::chrono::system_clock::time_point,
          std::shared_ptr<types::RadarProductRecord>>
 RadarProductManagerImpl::GetLevel2ProductRecords(
-   std::chrono::system_clock::time_point time)
+   std::chrono::system_clock::time_point            time,
+   const std::shared_ptr<request::NexradLoadGroup>& loadGroup)
 {
    std::map<std::chrono::system_clock::time_point,
             std::shared_ptr<types::RadarProductRecord>>
@@ -1299,10 +3541,15 @@ RadarProductManagerImpl::GetLevel2ProductRecords(
             {
                if (request->radar_product_record() != nullptr)
                {
-                  Q_EMIT self_->DataReloaded(request->radar_product_record());
+                  QueueDataReloaded(request->radar_product_record());
                }
             });
 
+         if (loadGroup != nullptr)
+         {
+            loadGroup->Add(request);
+         }
+
          self_->LoadLevel2Data(recordTime, request);
       }
 
@@ -1319,7 +3566,9 @@ RadarProductManagerImpl::GetLevel2ProductRecords(
 std::tuple<std::shared_ptr<types::RadarProductRecord>,
            std::chrono::system_clock::time_point>
 RadarProductManagerImpl::GetLevel3ProductRecord(
-   const std::string& product, std::chrono::system_clock::time_point time)
+   const std::string&                               product,
+   std::chrono::system_clock::time_point            time,
+   const std::shared_ptr<request::NexradLoadGroup>& loadGroup)
 {
    std::shared_ptr<types::RadarProductRecord> record {nullptr};
    RadarProductRecordMap::const_pointer       recordPtr {nullptr};
@@ -1346,197 +3595,671 @@ RadarProductManagerImpl::GetLevel3ProductRecord(
       }
    }
 
-   // Lock is no longer needed
-   lock.unlock();
-
-   if (recordPtr != nullptr)
+   // Lock is no longer needed
+   lock.unlock();
+
+   if (recordPtr != nullptr)
+   {
+      // Don't check for an exact time match for level 3 products
+      recordTime = recordPtr->first;
+      record     = recordPtr->second.lock();
+   }
+
+   if (record != nullptr)
+   {
+      TouchRecentRecord(record);
+   }
+
+   if (recordPtr != nullptr && record == nullptr &&
+       recordTime != std::chrono::system_clock::time_point {})
+   {
+      // Product is expired, reload it
+      std::shared_ptr<request::NexradFileRequest> request =
+         std::make_shared<request::NexradFileRequest>(radarId_);
+
+      QObject::connect(
+         request.get(),
+         &request::NexradFileRequest::RequestComplete,
+         self_,
+         [this](std::shared_ptr<request::NexradFileRequest> request)
+         {
+            if (request->radar_product_record() != nullptr)
+            {
+               QueueDataReloaded(request->radar_product_record());
+            }
+         });
+
+      if (loadGroup != nullptr)
+      {
+         loadGroup->Add(request);
+      }
+
+      self_->LoadLevel3Data(product, recordTime, request);
+   }
+
+   return {record, recordTime};
+}
+
+std::shared_ptr<types::RadarProductRecord>
+RadarProductManagerImpl::StoreRadarProductRecord(
+   std::shared_ptr<types::RadarProductRecord> record)
+{
+   logger_->debug("StoreRadarProductRecord()");
+
+   std::shared_ptr<types::RadarProductRecord> storedRecord = nullptr;
+
+   auto timeInSeconds =
+      std::chrono::time_point_cast<std::chrono::seconds,
+                                   std::chrono::system_clock>(record->time());
+
+   if (record->radar_product_group() == common::RadarProductGroup::Level2)
+   {
+      std::unique_lock lock {level2ProductRecordMutex_};
+
+      auto it = level2ProductRecords_.find(timeInSeconds);
+      if (it != level2ProductRecords_.cend())
+      {
+         storedRecord = it->second.lock();
+
+         if (storedRecord != nullptr)
+         {
+            logger_->debug(
+               "Level 2 product previously loaded, loading from cache");
+         }
+      }
+
+      if (storedRecord == nullptr)
+      {
+         storedRecord                         = record;
+         level2ProductRecords_[timeInSeconds] = record;
+      }
+
+      UpdateRecentRecords(kLevel2RecordGroup_, storedRecord);
+   }
+
+   if (record->radar_product_group() == common::RadarProductGroup::Level2)
+   {
+      IndexLevel2Record(storedRecord);
+   }
+   else if (record->radar_product_group() == common::RadarProductGroup::Level3)
+   {
+      std::unique_lock lock {level3ProductRecordMutex_};
+
+      auto& productMap = level3ProductRecordsMap_[record->radar_product()];
+
+      auto it = productMap.find(timeInSeconds);
+      if (it != productMap.cend())
+      {
+         storedRecord = it->second.lock();
+
+         if (storedRecord != nullptr)
+         {
+            logger_->debug(
+               "Level 3 product previously loaded, loading from cache");
+         }
+      }
+
+      if (storedRecord == nullptr)
+      {
+         storedRecord              = record;
+         productMap[timeInSeconds] = record;
+      }
+
+      UpdateRecentRecords(record->radar_product(), storedRecord);
+   }
+
+   return storedRecord;
+}
+
+void RadarProductManagerImpl::UpdateRecentRecords(
+   const std::string&                         product,
+   std::shared_ptr<types::RadarProductRecord> record)
+{
+   const RadarProductRecordGroup group {radarId_, product};
+   const std::size_t             recordSize = record->data_size();
+
+   // Radar product cache size is specified in MiB
+   auto& generalSettings = settings::GeneralSettings::Instance();
+   const std::size_t byteLimit =
+      static_cast<std::size_t>(
+         generalSettings.radar_product_cache_size().GetValue())
+      << 20;
+
+   std::unique_lock lock {recordCacheMutex_};
+
+   // The most recently used records are retained, up to the cache limit for
+   // each product, while the records of all radar sites fit within the budget
+   recordCache_.set_count_limit(group, cacheLimit_);
+   recordCache_.set_byte_limit(byteLimit);
+   recordCache_.Insert(group, std::move(record), recordSize);
+   recordCacheMemory_.set_bytes(recordCache_.size_bytes());
+
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Recent records: {}/{} ({} bytes), total {} of {} bytes",
+                       radarId_,
+                       product,
+                       recordCache_.size_bytes(group),
+                       recordCache_.size_bytes(),
+                       byteLimit);
+
+   lock.unlock();
+
+   ReleaseMemory();
+}
+
+void RadarProductManagerImpl::TouchRecentRecord(
+   const std::shared_ptr<types::RadarProductRecord>& record)
+{
+   std::unique_lock lock {recordCacheMutex_};
+   recordCache_.Touch(record);
+}
+
+void RadarProductManagerImpl::ReleaseMemory()
+{
+   // Radar memory limit is specified in MiB, 0 is unlimited
+   auto& generalSettings = settings::GeneralSettings::Instance();
+   const std::size_t memoryLimit =
+      static_cast<std::size_t>(generalSettings.radar_memory_limit().GetValue())
+      << 20;
+
+   if (memoryLimit == 0)
+   {
+      return;
+   }
+
+   const std::size_t residentMemory = scwx::util::GetResidentMemory();
+   if (residentMemory <= memoryLimit)
+   {
+      return;
+   }
+
+   std::size_t released = 0;
+
+   {
+      // Release the least recently viewed records of all radar sites by the
+      // amount over the limit. Records still displayed remain loaded.
+      std::unique_lock lock {recordCacheMutex_};
+      released = recordCache_.Trim(residentMemory - memoryLimit);
+      recordCacheMemory_.set_bytes(recordCache_.size_bytes());
+   }
+
+   {
+      // Release data derived from volumes which are no longer loaded. Other
+      // radar sites release derived data when it is next requested.
+      std::unique_lock lock {derivedLevel2DataMutex_};
+      std::erase_if(derivedLevel2Data_,
+                    [](const auto& entry)
+                    { return entry.second.source_.expired(); });
+      std::erase_if(columnAccumulators_,
+                    [](const auto& entry)
+                    { return entry.second.source_.expired(); });
+   }
+
+   logger_->debug("Memory limit exceeded ({} of {} bytes), released {} bytes",
+                  residentMemory,
+                  memoryLimit,
+                  released);
+}
+
+std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+           float,
+           std::vector<float>,
+           std::chrono::system_clock::time_point,
+           std::shared_ptr<types::RadarProductRecord>>
+RadarProductManagerImpl::GetLevel2Data(
+   wsr88d::rda::DataBlockType                       dataBlockType,
+   float                                            elevation,
+   std::chrono::system_clock::time_point            time,
+   const std::shared_ptr<request::NexradLoadGroup>& loadGroup)
+{
+   std::shared_ptr<wsr88d::rda::ElevationScan> radarData    = nullptr;
+   float                                       elevationCut = 0.0f;
+   std::vector<float>                          elevationCuts {};
+   std::chrono::system_clock::time_point       foundTime {};
+   std::shared_ptr<types::RadarProductRecord>  foundRecord  = nullptr;
+
+   auto records = GetLevel2ProductRecords(time, loadGroup);
+
+   for (auto& recordPair : records)
+   {
+      auto& record = recordPair.second;
+
+      if (record != nullptr)
+      {
+         // Elevation cuts are only copied from the selected volume
+         auto [recordRadarData, recordElevationCut] =
+            record->level2_file()->FindElevationScan(
+               dataBlockType, elevation, time);
+
+         if (recordRadarData != nullptr)
+         {
+            auto& radarData0 = (*recordRadarData)[0];
+            auto  collectionTime =
+               scwx::util::TimePoint(radarData0->modified_julian_date(),
+                                     radarData0->collection_time());
+
+            // Find the newest radar data, not newer than the selected time
+            if (radarData == nullptr ||
+                (collectionTime <= time && foundTime < collectionTime))
+            {
+               radarData    = recordRadarData;
+               elevationCut = recordElevationCut;
+               foundTime    = collectionTime;
+               foundRecord  = record;
+            }
+         }
+      }
+   }
+
+   if (foundRecord != nullptr)
    {
-      // Don't check for an exact time match for level 3 products
-      recordTime = recordPtr->first;
-      record     = recordPtr->second.lock();
+      elevationCuts = foundRecord->level2_file()->elevation_cuts(dataBlockType);
+
+      TouchRecentRecord(foundRecord);
    }
 
-   if (recordPtr != nullptr && record == nullptr &&
-       recordTime != std::chrono::system_clock::time_point {})
-   {
-      // Product is expired, reload it
-      std::shared_ptr<request::NexradFileRequest> request =
-         std::make_shared<request::NexradFileRequest>(radarId_);
+   return {radarData, elevationCut, elevationCuts, foundTime, foundRecord};
+}
 
-      QObject::connect(
-         request.get(),
-         &request::NexradFileRequest::RequestComplete,
-         self_,
-         [this](std::shared_ptr<request::NexradFileRequest> request)
-         {
-            if (request->radar_product_record() != nullptr)
-            {
-               Q_EMIT self_->DataReloaded(request->radar_product_record());
-            }
-         });
+std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+           float,
+           std::vector<float>,
+           std::chrono::system_clock::time_point>
+RadarProductManager::GetLevel2Data(
+   wsr88d::rda::DataBlockType                       dataBlockType,
+   float                                            elevation,
+   std::chrono::system_clock::time_point            time,
+   const std::shared_ptr<request::NexradLoadGroup>& loadGroup)
+{
+   std::shared_ptr<wsr88d::rda::ElevationScan> radarData    = nullptr;
+   float                                       elevationCut = 0.0f;
+   std::vector<float>                          elevationCuts {};
+   std::chrono::system_clock::time_point       foundTime {};
 
-      self_->LoadLevel3Data(product, recordTime, request);
-   }
+   std::tie(radarData, elevationCut, elevationCuts, foundTime, std::ignore) =
+      p->GetLevel2Data(dataBlockType, elevation, time, loadGroup);
 
-   return {record, recordTime};
+   return {radarData, elevationCut, elevationCuts, foundTime};
 }
 
-std::shared_ptr<types::RadarProductRecord>
-RadarProductManagerImpl::StoreRadarProductRecord(
-   std::shared_ptr<types::RadarProductRecord> record)
+void RadarProductManagerImpl::IndexLevel2Record(
+   const std::shared_ptr<types::RadarProductRecord>& record)
 {
-   logger_->debug("StoreRadarProductRecord()");
+   std::shared_ptr<wsr88d::Ar2vFile> level2File =
+      (record != nullptr) ? record->level2_file() : nullptr;
 
-   std::shared_ptr<types::RadarProductRecord> storedRecord = nullptr;
+   if (level2File == nullptr)
+   {
+      return;
+   }
 
-   auto timeInSeconds =
-      std::chrono::time_point_cast<std::chrono::seconds,
-                                   std::chrono::system_clock>(record->time());
+   std::unique_lock lock {cutIndexMutex_};
 
-   if (record->radar_product_group() == common::RadarProductGroup::Level2)
+   for (wsr88d::rda::DataBlockType dataBlockType :
+        wsr88d::rda::MomentDataBlockTypeIterator())
    {
-      std::unique_lock lock {level2ProductRecordMutex_};
+      auto& cuts = cutIndex_[dataBlockType];
 
-      auto it = level2ProductRecords_.find(timeInSeconds);
-      if (it != level2ProductRecords_.cend())
+      for (auto& [codedElevation, elevationScans] :
+           level2File->elevation_scans(dataBlockType))
       {
-         storedRecord = it->second.lock();
+         auto& scans = cuts[codedElevation];
 
-         if (storedRecord != nullptr)
+         for (auto& [scanTime, elevationScan] : elevationScans)
          {
-            logger_->debug(
-               "Level 2 product previously loaded, loading from cache");
+            scans.insert_or_assign(scanTime,
+                                   IndexedCut {elevationScan, record});
          }
       }
 
-      if (storedRecord == nullptr)
+      // Remove cuts of volumes which are no longer loaded
+      for (auto cutIt = cuts.begin(); cutIt != cuts.end();)
       {
-         storedRecord                         = record;
-         level2ProductRecords_[timeInSeconds] = record;
+         std::erase_if(cutIt->second,
+                       [](const auto& scan)
+                       { return scan.second.record_.expired(); });
+
+         cutIt = cutIt->second.empty() ? cuts.erase(cutIt) : std::next(cutIt);
       }
+   }
+}
 
-      UpdateRecentRecords(level2ProductRecentRecords_, storedRecord);
+std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+           std::chrono::system_clock::time_point,
+           std::shared_ptr<types::RadarProductRecord>>
+RadarProductManagerImpl::GetLatestCut(
+   wsr88d::rda::DataBlockType            dataBlockType,
+   float                                 elevationCut,
+   std::chrono::system_clock::time_point time)
+{
+   std::unique_lock lock {cutIndexMutex_};
+
+   auto cutsIt = cutIndex_.find(dataBlockType);
+   if (cutsIt == cutIndex_.cend())
+   {
+      return {nullptr, {}, nullptr};
    }
-   else if (record->radar_product_group() == common::RadarProductGroup::Level3)
+
+   // Only scans of the selected elevation cut are considered
+   auto scansIt =
+      cutsIt->second.find(wsr88d::Ar2vFile::CodeElevation(elevationCut));
+   if (scansIt == cutsIt->second.cend())
    {
-      std::unique_lock lock {level3ProductRecordMutex_};
+      return {nullptr, {}, nullptr};
+   }
 
-      auto& productMap = level3ProductRecordsMap_[record->radar_product()];
+   // Find the newest scan, not newer than the selected time. A
+   // default-initialized time point selects the newest scan.
+   auto& scans  = scansIt->second;
+   auto  scanIt = (time == std::chrono::system_clock::time_point {}) ?
+                     scans.cend() :
+                     scans.upper_bound(time);
 
-      auto it = productMap.find(timeInSeconds);
-      if (it != productMap.cend())
-      {
-         storedRecord = it->second.lock();
+   while (scanIt != scans.cbegin())
+   {
+      --scanIt;
 
-         if (storedRecord != nullptr)
-         {
-            logger_->debug(
-               "Level 3 product previously loaded, loading from cache");
-         }
-      }
+      auto elevationScan = scanIt->second.elevationScan_.lock();
+      auto record        = scanIt->second.record_.lock();
 
-      if (storedRecord == nullptr)
+      if (elevationScan != nullptr && record != nullptr)
       {
-         storedRecord              = record;
-         productMap[timeInSeconds] = record;
+         return {elevationScan, scanIt->first, record};
       }
-
-      UpdateRecentRecords(
-         level3ProductRecentRecordsMap_[record->radar_product()], storedRecord);
    }
 
-   return storedRecord;
+   return {nullptr, {}, nullptr};
 }
 
-void RadarProductManagerImpl::UpdateRecentRecords(
-   RadarProductRecordList&                    recentList,
-   std::shared_ptr<types::RadarProductRecord> record)
+std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+           float,
+           std::vector<float>,
+           std::chrono::system_clock::time_point>
+RadarProductManager::GetLatestLevel2Data(
+   wsr88d::rda::DataBlockType                       dataBlockType,
+   float                                            elevation,
+   std::chrono::system_clock::time_point            time,
+   const std::shared_ptr<request::NexradLoadGroup>& loadGroup)
 {
-   const std::size_t recentListMaxSize {cacheLimit_};
-   bool              iteratorErased = false;
+   std::shared_ptr<wsr88d::rda::ElevationScan> radarData    = nullptr;
+   float                                       elevationCut = 0.0f;
+   std::vector<float>                          elevationCuts {};
+   std::chrono::system_clock::time_point       foundTime {};
+   std::shared_ptr<types::RadarProductRecord>  foundRecord = nullptr;
 
-   auto it = std::find(recentList.cbegin(), recentList.cend(), record);
-   if (it != recentList.cbegin() && it != recentList.cend())
-   {
-      // If the record exists beyond the front of the list, remove it
-      recentList.erase(it);
-      iteratorErased = true;
-   }
+   // Select the elevation cut from the volume, which also ensures the volume
+   // is loaded
+   std::tie(radarData, elevationCut, elevationCuts, foundTime, foundRecord) =
+      p->GetLevel2Data(dataBlockType, elevation, time, loadGroup);
 
-   if (iteratorErased || recentList.size() == 0 || it != recentList.cbegin())
+   if (radarData == nullptr)
    {
-      // Add the record to the front of the list, unless it's already there
-      recentList.push_front(record);
+      return {radarData, elevationCut, elevationCuts, foundTime};
    }
 
-   while (recentList.size() > recentListMaxSize)
+   auto [latestData, latestTime, latestRecord] =
+      p->GetLatestCut(dataBlockType, elevationCut, time);
+
+   if (latestData != nullptr && foundTime < latestTime)
    {
-      // Remove from the end of the list while it's too big
-      recentList.pop_back();
+      radarData = latestData;
+      foundTime = latestTime;
+
+      if (latestRecord != foundRecord)
+      {
+         RadarProductManagerImpl::TouchRecentRecord(latestRecord);
+      }
    }
+
+   return {radarData, elevationCut, elevationCuts, foundTime};
+}
+
+std::shared_ptr<wsr88d::Ar2vFile>
+RadarProductManager::GetLevel2Volume(std::chrono::system_clock::time_point time)
+{
+   std::shared_ptr<types::RadarProductRecord> record = nullptr;
+
+   // Every volume contains reflectivity
+   std::tie(std::ignore, std::ignore, std::ignore, std::ignore, record) =
+      p->GetLevel2Data(wsr88d::rda::DataBlockType::MomentRef, 0.0f, time);
+
+   return (record != nullptr) ? record->level2_file() : nullptr;
 }
 
 std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
            float,
            std::vector<float>,
            std::chrono::system_clock::time_point>
-RadarProductManager::GetLevel2Data(wsr88d::rda::DataBlockType dataBlockType,
-                                   float                      elevation,
-                                   std::chrono::system_clock::time_point time)
+RadarProductManager::GetDerivedLevel2Data(
+   common::Level2Product                            product,
+   float                                            elevation,
+   std::chrono::system_clock::time_point            time,
+   const std::shared_ptr<request::NexradLoadGroup>& loadGroup)
 {
-   std::shared_ptr<wsr88d::rda::ElevationScan> radarData    = nullptr;
+   auto derivedProduct = wsr88d::rda::DerivedProduct::Get(product);
+   if (derivedProduct == nullptr)
+   {
+      logger_->warn("Product is not derived: {}",
+                    common::GetLevel2Name(product));
+      return {nullptr, 0.0f, {}, {}};
+   }
+
+   const wsr88d::rda::DataBlockType dataBlockType =
+      derivedProduct->data_block_type();
+
+   std::shared_ptr<wsr88d::rda::ElevationScan> sourceData   = nullptr;
    float                                       elevationCut = 0.0f;
    std::vector<float>                          elevationCuts {};
    std::chrono::system_clock::time_point       foundTime {};
+   std::shared_ptr<types::RadarProductRecord>  record = nullptr;
 
-   auto records = p->GetLevel2ProductRecords(time);
+   std::tie(sourceData, elevationCut, elevationCuts, foundTime, record) =
+      p->GetLevel2Data(dataBlockType, elevation, time, loadGroup);
 
-   for (auto& recordPair : records)
+   if (derivedProduct->is_volume_product() && !elevationCuts.empty())
    {
-      auto& record = recordPair.second;
-
-      if (record != nullptr)
+      // Volume products are displayed at the lowest elevation only
+      const float lowestCut =
+         *std::min_element(elevationCuts.cbegin(), elevationCuts.cend());
+      if (lowestCut != elevationCut)
       {
-         std::shared_ptr<wsr88d::rda::ElevationScan> recordRadarData = nullptr;
-         float                                       recordElevationCut = 0.0f;
-         std::vector<float>                          recordElevationCuts;
+         std::tie(sourceData, elevationCut, std::ignore, foundTime, record) =
+            p->GetLevel2Data(dataBlockType, lowestCut, time, loadGroup);
+      }
 
-         std::tie(recordRadarData, recordElevationCut, recordElevationCuts) =
-            record->level2_file()->GetElevationScan(
-               dataBlockType, elevation, time);
+      elevationCuts = {elevationCut};
+   }
 
-         if (recordRadarData != nullptr)
+   if (sourceData == nullptr || record == nullptr || sourceData->empty() ||
+       !RadarProductManagerImpl::IsElevationComplete(*sourceData))
+   {
+      // Derived data is only computed from complete elevation scans
+      return {nullptr, elevationCut, elevationCuts, foundTime};
+   }
+
+   wsr88d::rda::DerivedProduct::Input input {};
+
+   if (derivedProduct->is_accumulation_product())
+   {
+      // Accumulations are laid out on the lowest elevation, and include each
+      // volume loaded up to the selected volume
+      input.volumeScans_.push_back(sourceData);
+      input.volumeElevations_.push_back(elevationCut);
+      input.precipitationAccumulator_ =
+         p->AccumulatePrecipitation(record->time());
+   }
+   else if (derivedProduct->is_volume_product())
+   {
+      auto vcpData = record->level2_file()->vcp_data();
+
+      input.volumeScans_.push_back(sourceData);
+      input.volumeElevations_.push_back(elevationCut);
+
+      for (auto& scan : record->level2_file()->radar_data())
+      {
+         auto& elevationScan = scan.second;
+
+         if (elevationScan != nullptr && elevationScan != sourceData &&
+             !elevationScan->empty() &&
+             elevationScan->cbegin()->second->moment_data_block(
+                dataBlockType) != nullptr &&
+             RadarProductManagerImpl::IsElevationComplete(*elevationScan))
          {
-            auto& radarData0 = (*recordRadarData)[0];
-            auto  collectionTime =
-               scwx::util::TimePoint(radarData0->modified_julian_date(),
-                                     radarData0->collection_time());
+            input.volumeScans_.push_back(elevationScan);
 
-            // Find the newest radar data, not newer than the selected time
-            if (radarData == nullptr ||
-                (collectionTime <= time && foundTime < collectionTime))
+            // Without the VCP, elevation angles are read from the radials
+            if (vcpData != nullptr &&
+                scan.first < vcpData->number_of_elevation_cuts() &&
+                input.volumeElevations_.size() + 1 == input.volumeScans_.size())
             {
-               radarData     = recordRadarData;
-               elevationCut  = recordElevationCut;
-               elevationCuts = std::move(recordElevationCuts);
-               foundTime     = collectionTime;
+               input.volumeElevations_.push_back(
+                  static_cast<float>(vcpData->elevation_angle(scan.first)));
             }
          }
       }
    }
+   else
+   {
+      input.elevationScan_ = sourceData;
+   }
 
-   return {radarData, elevationCut, elevationCuts, foundTime};
+   if (derivedProduct->is_storm_relative())
+   {
+      // Storm motion speed is specified in knots
+      auto& generalSettings = settings::GeneralSettings::Instance();
+      input.stormDirection_ = static_cast<float>(
+         generalSettings.storm_motion_direction().GetValue());
+      input.stormSpeed_ =
+         units::velocity::meters_per_second<float> {
+            units::velocity::knots<float> {static_cast<float>(
+               generalSettings.storm_motion_speed().GetValue())}}
+            .value();
+   }
+
+   const RadarProductManagerImpl::DerivedLevel2Key key {product,
+                                                        sourceData.get()};
+   const std::uint64_t accumulationRevision =
+      (input.precipitationAccumulator_ != nullptr) ?
+         input.precipitationAccumulator_->revision() :
+         0u;
+
+   std::shared_ptr<wsr88d::rda::ElevationScan> derivedData = nullptr;
+   bool                                        compute     = false;
+
+   {
+      std::unique_lock lock {p->derivedLevel2DataMutex_};
+
+      // Release derived data of volumes which are no longer loaded
+      std::erase_if(p->derivedLevel2Data_,
+                    [](const auto& entry)
+                    { return entry.second.source_.expired(); });
+
+      auto& entry = p->derivedLevel2Data_[key];
+      if (entry.source_.lock() != sourceData)
+      {
+         entry         = {};
+         entry.source_ = sourceData;
+      }
+
+      if (derivedProduct->is_volume_product() &&
+          !derivedProduct->is_accumulation_product())
+      {
+         std::erase_if(p->columnAccumulators_,
+                       [](const auto& accumulator)
+                       { return accumulator.second.source_.expired(); });
+
+         // Elevation scans already accumulated into the column state of the
+         // volume are skipped, so each update accumulates new elevations only
+         auto& accumulator = p->columnAccumulators_[sourceData.get()];
+         if (accumulator.source_.lock() != sourceData)
+         {
+            accumulator.source_ = sourceData;
+            accumulator.accumulator_ =
+               std::make_shared<wsr88d::rda::ColumnAccumulator>(*sourceData);
+         }
+
+         input.columnAccumulator_ = accumulator.accumulator_;
+      }
+
+      // Previously derived data is used until the update is computed, such
+      // as when another elevation of the volume has completed
+      derivedData = entry.derived_;
+
+      const bool current = entry.derived_ != nullptr &&
+                           entry.volumeScans_ == input.volumeScans_.size() &&
+                           entry.stormDirection_ == input.stormDirection_ &&
+                           entry.stormSpeed_ == input.stormSpeed_ &&
+                           entry.accumulationRevision_ == accumulationRevision;
+
+      if (!current && !entry.computing_)
+      {
+         entry.computing_ = true;
+         compute          = true;
+      }
+   }
+
+   if (compute)
+   {
+      p->decodePool_.Post(
+         LoadPriority::High,
+         [this,
+          key,
+          derivedProduct,
+          input = std::move(input),
+          accumulationRevision,
+          record]()
+         {
+            boost::timer::cpu_timer timer {};
+
+            auto derivedScan = derivedProduct->Compute(input);
+
+            timer.stop();
+            logger_->debug("Derived {} computed in {}",
+                           common::GetLevel2Name(key.first),
+                           timer.format(kTimerPlaces_, "%ws"));
+
+            {
+               std::unique_lock lock {p->derivedLevel2DataMutex_};
+
+               auto it = p->derivedLevel2Data_.find(key);
+               if (it != p->derivedLevel2Data_.end())
+               {
+                  it->second.computing_ = false;
+
+                  if (derivedScan != nullptr)
+                  {
+                     auto& entry                 = it->second;
+                     entry.derived_              = derivedScan;
+                     entry.volumeScans_          = input.volumeScans_.size();
+                     entry.stormDirection_       = input.stormDirection_;
+                     entry.stormSpeed_           = input.stormSpeed_;
+                     entry.accumulationRevision_ = accumulationRevision;
+                  }
+               }
+            }
+
+            if (derivedScan != nullptr)
+            {
+               p->QueueDataReloaded(record);
+            }
+         });
+   }
+
+   return {derivedData, elevationCut, elevationCuts, foundTime};
 }
 
 std::tuple<std::shared_ptr<wsr88d::rpg::Level3Message>,
            std::chrono::system_clock::time_point>
-RadarProductManager::GetLevel3Data(const std::string& product,
-                                   std::chrono::system_clock::time_point time)
+RadarProductManager::GetLevel3Data(
+   const std::string&                               product,
+   std::chrono::system_clock::time_point            time,
+   const std::shared_ptr<request::NexradLoadGroup>& loadGroup)
 {
    std::shared_ptr<wsr88d::rpg::Level3Message> message = nullptr;
 
    std::shared_ptr<types::RadarProductRecord> record;
-   std::tie(record, time) = p->GetLevel3ProductRecord(product, time);
+   std::tie(record, time) =
+      p->GetLevel3ProductRecord(product, time, loadGroup);
 
    if (record != nullptr)
    {
@@ -1546,6 +4269,54 @@ RadarProductManager::GetLevel3Data(const std::string& product,
    return {message, time};
 }
 
+types::ProductLatency RadarProductManager::GetProductLatency(
+   common::RadarProductGroup             group,
+   const std::string&                    product,
+   std::chrono::system_clock::time_point time)
+{
+   std::shared_ptr<types::RadarProductRecord> record = nullptr;
+
+   auto FindRecord = [&](const RadarProductRecordMap& recordMap)
+   {
+      RadarProductRecordMap::const_pointer recordPtr = nullptr;
+
+      if (time == std::chrono::system_clock::time_point {})
+      {
+         if (!recordMap.empty())
+         {
+            recordPtr = &(*recordMap.rbegin());
+         }
+      }
+      else
+      {
+         recordPtr = scwx::util::GetBoundedElementPointer(recordMap, time);
+      }
+
+      if (recordPtr != nullptr)
+      {
+         record = recordPtr->second.lock();
+      }
+   };
+
+   if (group == common::RadarProductGroup::Level2)
+   {
+      std::shared_lock lock {p->level2ProductRecordMutex_};
+      FindRecord(p->level2ProductRecords_);
+   }
+   else if (group == common::RadarProductGroup::Level3)
+   {
+      std::shared_lock lock {p->level3ProductRecordMutex_};
+
+      auto it = p->level3ProductRecordsMap_.find(product);
+      if (it != p->level3ProductRecordsMap_.cend())
+      {
+         FindRecord(it->second);
+      }
+   }
+
+   return (record != nullptr) ? record->latency() : types::ProductLatency {};
+}
+
 common::Level3ProductCategoryMap
 RadarProductManager::GetAvailableLevel3Categories()
 {
@@ -1595,6 +4366,51 @@ void RadarProductManager::UpdateAvailableProducts()
                      });
 }
 
+void RadarProductManagerImpl::QueueDataReloaded(
+   std::shared_ptr<types::RadarProductRecord> record)
+{
+   if (record == nullptr)
+   {
+      return;
+   }
+
+   if (record->radar_product_group() == common::RadarProductGroup::Level2)
+   {
+      // Index elevations received since the record was stored
+      IndexLevel2Record(record);
+   }
+
+   {
+      std::unique_lock lock {reloadedRecordsMutex_};
+
+      if (std::ranges::find(reloadedRecords_, record) !=
+          reloadedRecords_.cend())
+      {
+         // The record is already queued
+         return;
+      }
+
+      reloadedRecords_.push_back(std::move(record));
+   }
+
+   dataReloaded_.Notify();
+}
+
+void RadarProductManagerImpl::EmitDataReloaded()
+{
+   std::vector<std::shared_ptr<types::RadarProductRecord>> records {};
+
+   {
+      std::unique_lock lock {reloadedRecordsMutex_};
+      records.swap(reloadedRecords_);
+   }
+
+   for (auto& record : records)
+   {
+      Q_EMIT self_->DataReloaded(record);
+   }
+}
+
 void RadarProductManagerImpl::UpdateAvailableProductsSync()
 {
    auto level3ProviderManager =
@@ -1603,7 +4419,7 @@ void RadarProductManagerImpl::UpdateAvailableProductsSync()
    auto updatedAwipsIdList =
       level3ProviderManager->provider_->GetAvailableProducts();
 
-   std::unique_lock lock {availableCategoryMutex_};
+   common::Level3ProductCategoryMap updatedCategoryMap {};
 
    for (common::Level3ProductCategory category :
         common::Level3ProductCategoryIterator())
@@ -1638,16 +4454,28 @@ void RadarProductManagerImpl::UpdateAvailableProductsSync()
 
       if (!availableProducts.empty())
       {
-         availableCategoryMap_.insert_or_assign(category,
-                                                std::move(availableProducts));
+         updatedCategoryMap.emplace(category, std::move(availableProducts));
       }
-      else
+   }
+
+   {
+      std::unique_lock lock {availableCategoryCacheMutex_};
+      availableCategoryCache_.insert_or_assign(radarId_, updatedCategoryMap);
+   }
+
+   {
+      std::unique_lock lock {availableCategoryMutex_};
+
+      if (updatedCategoryMap == availableCategoryMap_)
       {
-         availableCategoryMap_.erase(category);
+         // Products displayed from the cache are unchanged
+         return;
       }
+
+      availableCategoryMap_ = std::move(updatedCategoryMap);
    }
 
-   Q_EMIT self_->Level3ProductsChanged();
+   level3ProductsChanged_.Notify();
 }
 
 std::shared_ptr<RadarProductManager>
@@ -4,13 +4,16 @@
 #include <scwx/common/types.hpp>
 #include <scwx/qt/config/radar_site.hpp>
 #include <scwx/qt/request/nexrad_file_request.hpp>
+#include <scwx/qt/request/nexrad_load_group.hpp>
 #include <scwx/qt/types/radar_product_record.hpp>
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/level3_file.hpp>
 
 #include <memory>
+#include <optional>
 #include <set>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -41,13 +44,87 @@ public:
     */
    static void DumpRecords();
 
-   [[nodiscard]] const std::vector<float>&
+   /**
+    * @brief Monitors the radar sites listed in the monitored radar sites
+    * setting, and follows changes to the setting.
+    */
+   static void InitializeMonitor();
+
+   /**
+    * @brief Sets the radar sites monitored in the background. Level 2 refresh
+    * remains enabled for monitored radar sites, and the latest volume is
+    * loaded at low priority, so switching a pane to a monitored radar site is
+    * immediate. Only the latest volume is retained for a monitored radar site
+    * which is not displayed.
+    *
+    * @param [in] radarSites Radar site IDs to monitor
+    */
+   static void SetMonitoredSites(const std::vector<std::string>& radarSites);
+
+   /**
+    * @brief Gets the radar sites monitored in the background.
+    */
+   [[nodiscard]] static std::vector<std::string> monitored_sites();
+
+   /**
+    * @brief Sets the radar sites predicted to be displayed next, such as while
+    * the tracked location is moving. Predicted radar sites are monitored in
+    * the background in addition to the monitored radar sites setting.
+    *
+    * @param [in] radarSites Radar site IDs, from most to least likely
+    */
+   static void SetPredictedSites(const std::vector<std::string>& radarSites);
+
+   /**
+    * @brief Parses a list of radar sites, separated by commas or whitespace,
+    * such as from a setting. Radar site IDs are converted to upper case.
+    *
+    * @param [in] value List of radar sites
+    *
+    * @return Radar site IDs
+    */
+   [[nodiscard]] static std::vector<std::string>
+   ParseRadarSites(const std::string& value);
+
+   /**
+    * @brief Adds a newly created NEXRAD object to the matching provider, such
+    * as from an object notification, without waiting for the next refresh.
+    * New data is signaled immediately if refresh is enabled for the product.
+    *
+    * @param [in] key NEXRAD data key
+    * @param [in] lastModified Time the object was created
+    */
+   static void
+   NotifyObjectCreated(const std::string&                    key,
+                       std::chrono::system_clock::time_point lastModified);
+
+   /**
+    * @brief Gets the number of bytes held by recently used products of the
+    * radar site.
+    */
+   [[nodiscard]] std::size_t cache_size_bytes() const;
+
+   /**
+    * @brief Gets the coordinates of each gate of a standard radial size, as
+    * latitude/longitude pairs ordered by radial, then by gate. Coordinates are
+    * calculated on first use.
+    */
+   [[nodiscard]] std::span<const float>
    coordinates(common::RadialSize radialSize, bool smoothingEnabled) const;
    [[nodiscard]] const scwx::util::time_zone*       default_time_zone() const;
    [[nodiscard]] float                              gate_size() const;
    [[nodiscard]] std::string                        radar_id() const;
    [[nodiscard]] std::shared_ptr<config::RadarSite> radar_site() const;
 
+   /**
+    * @brief Gets the progress of the loop being prefetched.
+    *
+    * @return Number of frames loaded and total number of frames, or
+    * std::nullopt if the frames of the loop have not yet been listed
+    */
+   [[nodiscard]] std::optional<std::pair<std::size_t, std::size_t>>
+   prefetch_progress() const;
+
    void Initialize();
 
    /**
@@ -85,6 +162,35 @@ public:
     * @param [in] dataBlockType Data block type
     * @param [in] elevation Elevation tilt
     * @param [in] time Radar product time
+    * @param [in] loadGroup Load group of the requester, to which reloads of
+    * expired data are added
+    *
+    * @return Level 2 radar data, selected elevation cut, available elevation
+    * cuts and selected time
+    */
+   std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+              float,
+              std::vector<float>,
+              std::chrono::system_clock::time_point>
+   GetLevel2Data(
+      wsr88d::rda::DataBlockType                       dataBlockType,
+      float                                            elevation,
+      std::chrono::system_clock::time_point            time      = {},
+      const std::shared_ptr<request::NexradLoadGroup>& loadGroup = nullptr);
+
+   /**
+    * @brief Get the newest level 2 radar data for a data block type,
+    * elevation, and time, across each loaded volume. Under SAILS and
+    * MESO-SAILS, the lowest elevation is scanned several times per volume.
+    * Rather than the first scan of the elevation in the selected volume, the
+    * newest scan of the elevation not newer than the selected time is
+    * returned, including scans from volumes still being received.
+    *
+    * @param [in] dataBlockType Data block type
+    * @param [in] elevation Elevation tilt
+    * @param [in] time Radar product time
+    * @param [in] loadGroup Load group of the requester, to which reloads of
+    * expired data are added
     *
     * @return Level 2 radar data, selected elevation cut, available elevation
     * cuts and selected time
@@ -93,22 +199,81 @@ public:
               float,
               std::vector<float>,
               std::chrono::system_clock::time_point>
-   GetLevel2Data(wsr88d::rda::DataBlockType            dataBlockType,
-                 float                                 elevation,
-                 std::chrono::system_clock::time_point time = {});
+   GetLatestLevel2Data(
+      wsr88d::rda::DataBlockType                       dataBlockType,
+      float                                            elevation,
+      std::chrono::system_clock::time_point            time      = {},
+      const std::shared_ptr<request::NexradLoadGroup>& loadGroup = nullptr);
+
+   /**
+    * @brief Get the level 2 volume containing the radar data for a time, such
+    * as to sample every elevation of the volume.
+    *
+    * @param [in] time Radar product time
+    *
+    * @return Level 2 volume, or nullptr if none is loaded
+    */
+   std::shared_ptr<wsr88d::Ar2vFile>
+   GetLevel2Volume(std::chrono::system_clock::time_point time = {});
+
+   /**
+    * @brief Get derived level 2 radar data for a product, elevation, and time.
+    * Derived data is computed from complete elevation scans on a worker
+    * thread, and cached with the volume it was derived from. If the derived
+    * data is not yet available, the radar data returned is nullptr, and
+    * DataReloaded is emitted once it has been computed.
+    *
+    * @param [in] product Derived level 2 product
+    * @param [in] elevation Elevation tilt
+    * @param [in] time Radar product time
+    * @param [in] loadGroup Load group of the requester, to which reloads of
+    * expired data are added
+    *
+    * @return Derived level 2 radar data, selected elevation cut, available
+    * elevation cuts and selected time
+    */
+   std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+              float,
+              std::vector<float>,
+              std::chrono::system_clock::time_point>
+   GetDerivedLevel2Data(
+      common::Level2Product                            product,
+      float                                            elevation,
+      std::chrono::system_clock::time_point            time      = {},
+      const std::shared_ptr<request::NexradLoadGroup>& loadGroup = nullptr);
 
    /**
     * @brief Get level 3 message data for a product and time.
     *
     * @param [in] product Radar product name
     * @param [in] time Radar product time
+    * @param [in] loadGroup Load group of the requester, to which reloads of
+    * expired data are added
     *
     * @return Level 3 message data and selected time
     */
    std::tuple<std::shared_ptr<wsr88d::rpg::Level3Message>,
               std::chrono::system_clock::time_point>
-   GetLevel3Data(const std::string&                    product,
-                 std::chrono::system_clock::time_point time = {});
+   GetLevel3Data(
+      const std::string&                               product,
+      std::chrono::system_clock::time_point            time      = {},
+      const std::shared_ptr<request::NexradLoadGroup>& loadGroup = nullptr);
+
+   /**
+    * @brief Get the latency of a loaded radar product. The product is not
+    * loaded if it is not resident.
+    *
+    * @param [in] group Radar product group
+    * @param [in] product Radar product name, for level 3 products
+    * @param [in] time Radar product time, or the time of data within the
+    * product. If default-initialized, the latest product is used.
+    *
+    * @return Product latency, with no stages set if the product is not loaded
+    */
+   types::ProductLatency
+   GetProductLatency(common::RadarProductGroup             group,
+                     const std::string&                    product,
+                     std::chrono::system_clock::time_point time = {});
 
    static std::shared_ptr<RadarProductManager>
    Instance(const std::string& radarSite);
@@ -121,6 +286,40 @@ public:
       std::chrono::system_clock::time_point              time,
       const std::shared_ptr<request::NexradFileRequest>& request = nullptr);
 
+   /**
+    * @brief Prefetch the frames of a loop for each product with refresh
+    * enabled. Level 2 frames are loaded concurrently from newest to oldest,
+    * behind data requested for display. Level 3 products are loaded in bulk
+    * with PrefetchLevel3Data. The plan replaces any previous plan, and is
+    * updated as products are enabled.
+    *
+    * @param [in] startTime Start of the loop
+    * @param [in] endTime End of the loop
+    */
+   void PrefetchLoop(std::chrono::system_clock::time_point startTime,
+                     std::chrono::system_clock::time_point endTime);
+
+   /**
+    * @brief Stop prefetching loop frames. Frames already loading are
+    * completed.
+    */
+   void CancelPrefetch();
+
+   /**
+    * @brief Prefetch level 3 data for a set of products over a time range.
+    * Listings and downloads for all products are issued concurrently, and
+    * each product is stored in the cache as it is loaded. Loop prefetch uses
+    * this for the level 3 products with refresh enabled. Loading stops when
+    * the loop prefetch is cancelled or replaced.
+    *
+    * @param [in] products Radar product names
+    * @param [in] startTime Start of the time range
+    * @param [in] endTime End of the time range
+    */
+   void PrefetchLevel3Data(const std::vector<std::string>&       products,
+                           std::chrono::system_clock::time_point startTime,
+                           std::chrono::system_clock::time_point endTime);
+
    static void LoadData(
       std::istream&                                      is,
       const std::shared_ptr<request::NexradFileRequest>& request = nullptr);
@@ -142,6 +341,9 @@ public:
    void UpdateAvailableProducts();
 
 signals:
+   // Signals are coalesced, and emitted on the main thread at most once per
+   // event loop iteration. DataReloaded is emitted once for each record
+   // reloaded, and NewDataAvailable with the latest time listed.
    void DataReloaded(std::shared_ptr<types::RadarProductRecord> record);
    void Level3ProductsChanged();
    void NewDataAvailable(common::RadarProductGroup             group,
@@ -0,0 +1,316 @@
+#include <scwx/qt/manager/radar_site_prefetch_manager.hpp>
+#include <scwx/qt/manager/position_manager.hpp>
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/qt/settings/map_settings.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <fmt/ranges.h>
+#include <QGeoPositionInfo>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+static const std::string logPrefix_ =
+   "scwx::qt::manager::radar_site_prefetch_manager";
+static const auto logger_ = scwx::util::Logger::Create(logPrefix_);
+
+// Below this speed, the tracked location is considered stationary (m/s)
+static constexpr double kMinSpeed_ = 3.0;
+
+// The tracked location is projected ahead by this duration of travel, up to
+// the maximum distance (s, m)
+static constexpr double kLookaheadTime_     = 30.0 * 60.0;
+static constexpr double kMaxLookahead_      = 150'000.0;
+static constexpr double kLookaheadInterval_ = 10'000.0;
+
+// Displacement required to derive heading and speed from position alone (m)
+static constexpr double kMinDisplacement_ = 200.0;
+
+static constexpr std::size_t kMaxPredictedSites_ = 2u;
+
+class RadarSitePrefetchManager::Impl
+{
+public:
+   explicit Impl(RadarSitePrefetchManager* self) : self_ {self}
+   {
+      auto& generalSettings = settings::GeneralSettings::Instance();
+
+      QObject::connect(positionManager_.get(),
+                       &PositionManager::PositionUpdated,
+                       self_,
+                       [this](const QGeoPositionInfo& position)
+                       { HandlePosition(position); });
+      QObject::connect(positionManager_.get(),
+                       &PositionManager::LocationTrackingChanged,
+                       self_,
+                       [this](bool trackingEnabled)
+                       {
+                          if (!trackingEnabled)
+                          {
+                             ClearPrediction();
+                          }
+                       });
+
+      predictiveRadarPrefetchCallbackUuid_ =
+         generalSettings.predictive_radar_prefetch()
+            .RegisterValueChangedCallback(
+               [this](const bool& enabled)
+               {
+                  if (!enabled)
+                  {
+                     ClearPrediction();
+                  }
+               });
+   }
+   ~Impl()
+   {
+      settings::GeneralSettings::Instance()
+         .predictive_radar_prefetch()
+         .UnregisterValueChangedCallback(predictiveRadarPrefetchCallbackUuid_);
+
+      threadPool_.join();
+   }
+
+   void ClearPrediction();
+   void HandlePosition(const QGeoPositionInfo& position);
+   void SetPrediction(const std::vector<std::string>& radarSites);
+   void WarmCoordinates(const std::vector<std::string>& radarSites);
+
+   RadarSitePrefetchManager* self_;
+
+   std::shared_ptr<PositionManager> positionManager_ {
+      PositionManager::Instance()};
+
+   boost::asio::thread_pool threadPool_ {1u};
+
+   // Last position from which heading and speed were derived
+   QGeoPositionInfo anchorPosition_ {};
+   double           heading_ {0.0};
+   double           speed_ {0.0};
+
+   std::vector<std::string> predictedSites_ {};
+
+   boost::uuids::uuid predictiveRadarPrefetchCallbackUuid_ {};
+};
+
+RadarSitePrefetchManager::RadarSitePrefetchManager() :
+    p(std::make_unique<Impl>(this))
+{
+}
+RadarSitePrefetchManager::~RadarSitePrefetchManager() = default;
+
+void RadarSitePrefetchManager::Impl::HandlePosition(
+   const QGeoPositionInfo& position)
+{
+   if (!settings::GeneralSettings::Instance()
+           .predictive_radar_prefetch()
+           .GetValue() ||
+       !positionManager_->IsLocationTracked() || !position.isValid())
+   {
+      ClearPrediction();
+      return;
+   }
+
+   const QGeoCoordinate coordinate = position.coordinate();
+
+   if (position.hasAttribute(QGeoPositionInfo::Attribute::GroundSpeed) &&
+       position.hasAttribute(QGeoPositionInfo::Attribute::Direction))
+   {
+      // Use the heading and speed reported by the position source
+      speed_   = position.attribute(QGeoPositionInfo::Attribute::GroundSpeed);
+      heading_ = position.attribute(QGeoPositionInfo::Attribute::Direction);
+      anchorPosition_ = position;
+   }
+   else if (!anchorPosition_.isValid())
+   {
+      anchorPosition_ = position;
+      return;
+   }
+   else
+   {
+      // Derive heading and speed once the position has moved far enough to
+      // exceed the noise of the position source
+      const QGeoCoordinate anchor   = anchorPosition_.coordinate();
+      const double         distance = anchor.distanceTo(coordinate);
+      const double         elapsed =
+         static_cast<double>(
+            anchorPosition_.timestamp().msecsTo(position.timestamp())) /
+         1000.0;
+
+      if (elapsed <= 0.0)
+      {
+         anchorPosition_ = position;
+         return;
+      }
+
+      if (distance < kMinDisplacement_)
+      {
+         if (distance / elapsed < kMinSpeed_)
+         {
+            // Stationary, or moving too slowly to predict
+            speed_ = 0.0;
+         }
+         else
+         {
+            // Keep the previous prediction until the position has moved far
+            // enough
+            return;
+         }
+      }
+      else
+      {
+         speed_          = distance / elapsed;
+         heading_        = anchor.azimuthTo(coordinate);
+         anchorPosition_ = position;
+      }
+   }
+
+   if (speed_ < kMinSpeed_)
+   {
+      ClearPrediction();
+      return;
+   }
+
+   auto currentSite = config::RadarSite::FindNearest(
+      coordinate.latitude(), coordinate.longitude(), "wsr88d");
+
+   // Find the nearest radar sites along the projected track, excluding the
+   // radar site nearest to the current position
+   const double lookahead = std::min(speed_ * kLookaheadTime_, kMaxLookahead_);
+
+   std::vector<std::string> radarSites {};
+
+   for (double distance = kLookaheadInterval_;
+        distance <= lookahead && radarSites.size() < kMaxPredictedSites_;
+        distance += kLookaheadInterval_)
+   {
+      const QGeoCoordinate projected =
+         coordinate.atDistanceAndAzimuth(distance, heading_);
+
+      auto radarSite = config::RadarSite::FindNearest(
+         projected.latitude(), projected.longitude(), "wsr88d");
+
+      if (radarSite != nullptr && radarSite != currentSite &&
+          std::find(radarSites.cbegin(), radarSites.cend(), radarSite->id()) ==
+             radarSites.cend())
+      {
+         radarSites.push_back(radarSite->id());
+      }
+   }
+
+   SetPrediction(radarSites);
+}
+
+void RadarSitePrefetchManager::Impl::ClearPrediction()
+{
+   anchorPosition_ = {};
+   speed_          = 0.0;
+
+   SetPrediction({});
+}
+
+void RadarSitePrefetchManager::Impl::SetPrediction(
+   const std::vector<std::string>& radarSites)
+{
+   if (radarSites == predictedSites_)
+   {
+      return;
+   }
+
+   logger_->info("Predicted radar sites: {}", fmt::join(radarSites, ", "));
+
+   std::vector<std::string> newSites {};
+   for (auto& radarSite : radarSites)
+   {
+      if (std::find(predictedSites_.cbegin(),
+                    predictedSites_.cend(),
+                    radarSite) == predictedSites_.cend())
+      {
+         newSites.push_back(radarSite);
+      }
+   }
+
+   predictedSites_ = radarSites;
+
+   // Predicted radar sites are monitored, which lists and loads the latest
+   // volume in the background
+   RadarProductManager::SetPredictedSites(predictedSites_);
+
+   WarmCoordinates(newSites);
+}
+
+void RadarSitePrefetchManager::Impl::WarmCoordinates(
+   const std::vector<std::string>& radarSites)
+{
+   if (radarSites.empty())
+   {
+      return;
+   }
+
+   // Calculate the base tilt coordinates for the smoothing modes of each map
+   auto&          mapSettings = settings::MapSettings::Instance();
+   std::set<bool> smoothingModes {};
+   for (std::size_t i = 0; i < mapSettings.count(); ++i)
+   {
+      smoothingModes.insert(mapSettings.smoothing_enabled(i).GetValue());
+   }
+
+   boost::asio::post(
+      threadPool_,
+      [radarSites, smoothingModes]()
+      {
+         for (auto& radarSite : radarSites)
+         {
+            try
+            {
+               auto radarProductManager =
+                  RadarProductManager::Instance(radarSite);
+
+               for (bool smoothingEnabled : smoothingModes)
+               {
+                  radarProductManager->coordinates(
+                     common::RadialSize::_0_5Degree, smoothingEnabled);
+               }
+            }
+            catch (const std::exception& ex)
+            {
+               logger_->error(ex.what());
+            }
+         }
+      });
+}
+
+std::shared_ptr<RadarSitePrefetchManager> RadarSitePrefetchManager::Instance()
+{
+   static std::weak_ptr<RadarSitePrefetchManager> managerReference_ {};
+   static std::mutex                              instanceMutex_ {};
+
+   std::unique_lock lock(instanceMutex_);
+
+   std::shared_ptr<RadarSitePrefetchManager> manager =
+      managerReference_.lock();
+
+   if (manager == nullptr)
+   {
+      manager           = std::make_shared<RadarSitePrefetchManager>();
+      managerReference_ = manager;
+   }
+
+   return manager;
+}
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
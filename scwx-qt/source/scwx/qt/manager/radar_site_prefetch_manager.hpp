@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+
+#include <QObject>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+/**
+ * @brief Predicts the radar sites which will be nearest while the tracked
+ * location is moving, and warms them in the background. The heading and speed
+ * of the tracked location are projected ahead, and the nearest WSR-88D radar
+ * sites along the projection are monitored, such that their listings and
+ * latest volume are loaded before they are selected. Coordinates of the base
+ * tilt are calculated ahead of time.
+ */
+class RadarSitePrefetchManager : public QObject
+{
+   Q_OBJECT
+   Q_DISABLE_COPY_MOVE(RadarSitePrefetchManager)
+
+public:
+   explicit RadarSitePrefetchManager();
+   ~RadarSitePrefetchManager();
+
+   static std::shared_ptr<RadarSitePrefetchManager> Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
@@ -1,6 +1,7 @@
 #include <scwx/qt/manager/resource_manager.hpp>
 #include <scwx/qt/manager/font_manager.hpp>
 #include <scwx/qt/model/imgui_context_model.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/types/texture_types.hpp>
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/util/logger.hpp>
@@ -69,7 +70,7 @@ LoadImageResources(const std::vector<std::string>& urlStrings)
    if (!images.empty())
    {
       util::TextureAtlas& textureAtlas = util::TextureAtlas::Instance();
-      textureAtlas.BuildAtlas(2048, 2048);
+      textureAtlas.UpdateAtlas(2048, 2048);
    }
 
    return images;
@@ -91,6 +92,7 @@ static void LoadTextures()
 {
    util::TextureAtlas& textureAtlas = util::TextureAtlas::Instance();
 
+   // Bundled textures are decoded and added to the atlas when first referenced
    for (auto imageTexture : types::ImageTextureIterator())
    {
       textureAtlas.RegisterTexture(GetTextureName(imageTexture),
@@ -103,6 +105,9 @@ static void LoadTextures()
                                    GetTexturePath(lineTexture));
    }
 
+   textureAtlas.SetCompressionEnabled(settings::GeneralSettings::Instance()
+                                         .texture_compression()
+                                         .GetValue());
    textureAtlas.BuildAtlas(2048, 2048);
 }
 
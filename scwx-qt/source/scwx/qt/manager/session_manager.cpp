@@ -0,0 +1,270 @@
+#include <scwx/qt/manager/session_manager.hpp>
+#include <scwx/qt/util/json.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/strand.hpp>
+
+#include <filesystem>
+#include <mutex>
+
+#include <boost/asio/steady_timer.hpp>
+#include <boost/json.hpp>
+#include <QStandardPaths>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+static const std::string logPrefix_ = "scwx::qt::manager::session_manager";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// The manifest is saved at this interval while the session is unchanged, such
+// that its saved time reflects when the application was last running
+static constexpr std::chrono::minutes kSaveInterval_ {1};
+
+// A session saved longer ago than this is not resumed
+static constexpr std::chrono::hours kMaxSessionAge_ {1};
+
+static const std::string kViewTypeKey_ {"view_type"};
+static const std::string kArchiveTimeKey_ {"archive_time"};
+static const std::string kAnimatingKey_ {"animating"};
+static const std::string kSavedTimeKey_ {"saved_time"};
+
+class SessionManager::Impl
+{
+public:
+   explicit Impl() : saveTimer_ {strand_.get_executor()}
+   {
+      previousSession_ = LoadSession();
+      session_         = previousSession_.value_or(Session {});
+
+      std::unique_lock lock {sessionMutex_};
+      SaveAsync();
+   }
+
+   ~Impl()
+   {
+      std::unique_lock lock {sessionMutex_};
+      shutdown_ = true;
+      saveTimer_.cancel();
+      lock.unlock();
+
+      strand_.Join();
+
+      // Record the time the application was closed
+      WriteManifest();
+   }
+
+   static const std::string& ManifestPath();
+
+   std::optional<Session> LoadSession();
+   void                   Save();
+   void                   SaveAsync();
+   void                   ScheduleSave(std::chrono::seconds delay);
+   void                   WriteManifest();
+
+   scwx::util::Strand strand_ {"Session Manager",
+                               scwx::util::Strand::Priority::Background};
+
+   boost::asio::steady_timer saveTimer_;
+
+   std::optional<Session> previousSession_ {};
+   Session                session_ {};
+   bool                   shutdown_ {false};
+   std::mutex             sessionMutex_ {};
+};
+
+SessionManager::SessionManager() : p(std::make_unique<Impl>()) {}
+SessionManager::~SessionManager() = default;
+
+std::optional<SessionManager::Session> SessionManager::previous_session() const
+{
+   return p->previousSession_;
+}
+
+void SessionManager::SetViewType(types::MapTime viewType)
+{
+   std::unique_lock lock {p->sessionMutex_};
+   if (p->session_.viewType_ != viewType)
+   {
+      p->session_.viewType_ = viewType;
+      p->SaveAsync();
+   }
+}
+
+void SessionManager::SetArchiveTime(
+   std::chrono::system_clock::time_point archiveTime)
+{
+   std::unique_lock lock {p->sessionMutex_};
+   if (p->session_.archiveTime_ != archiveTime)
+   {
+      p->session_.archiveTime_ = archiveTime;
+      p->SaveAsync();
+   }
+}
+
+void SessionManager::SetAnimating(bool animating)
+{
+   std::unique_lock lock {p->sessionMutex_};
+   if (p->session_.animating_ != animating)
+   {
+      p->session_.animating_ = animating;
+      p->SaveAsync();
+   }
+}
+
+std::optional<SessionManager::Session> SessionManager::Impl::LoadSession()
+{
+   const std::string& path = ManifestPath();
+   if (path.empty() || !std::filesystem::exists(path))
+   {
+      logger_->debug("No previous session found");
+      return std::nullopt;
+   }
+
+   try
+   {
+      const boost::json::object json =
+         util::json::ReadJsonFile(path).as_object();
+
+      const std::chrono::system_clock::time_point savedTime {
+         std::chrono::seconds {
+            json.at(kSavedTimeKey_).to_number<std::int64_t>()}};
+
+      if (std::chrono::system_clock::now() - savedTime > kMaxSessionAge_)
+      {
+         logger_->info("Previous session is too old to resume");
+         return std::nullopt;
+      }
+
+      Session session {};
+      session.viewType_ =
+         (json.at(kViewTypeKey_).as_string() ==
+          types::GetMapTimeName(types::MapTime::Archive)) ?
+            types::MapTime::Archive :
+            types::MapTime::Live;
+      session.archiveTime_ = std::chrono::system_clock::time_point {
+         std::chrono::seconds {
+            json.at(kArchiveTimeKey_).to_number<std::int64_t>()}};
+      session.animating_ = json.at(kAnimatingKey_).as_bool();
+
+      logger_->info("Resuming previous session");
+
+      return session;
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->warn("Invalid session manifest: {}", ex.what());
+      return std::nullopt;
+   }
+}
+
+void SessionManager::Impl::SaveAsync()
+{
+   // Replaces the scheduled save, such that a burst of changes is saved once
+   ScheduleSave(std::chrono::seconds {0});
+}
+
+void SessionManager::Impl::ScheduleSave(std::chrono::seconds delay)
+{
+   if (shutdown_)
+   {
+      return;
+   }
+
+   saveTimer_.expires_after(delay);
+   saveTimer_.async_wait(strand_.Wrap(
+      [this](const boost::system::error_code& e)
+      {
+         if (e != boost::asio::error::operation_aborted)
+         {
+            Save();
+         }
+      }));
+}
+
+void SessionManager::Impl::Save()
+{
+   WriteManifest();
+
+   // Save again once the interval elapses, unless the session changes first
+   std::unique_lock lock {sessionMutex_};
+   ScheduleSave(kSaveInterval_);
+}
+
+void SessionManager::Impl::WriteManifest()
+{
+   const std::string& path = ManifestPath();
+   if (path.empty())
+   {
+      return;
+   }
+
+   std::unique_lock lock {sessionMutex_};
+   const Session    session = session_;
+   lock.unlock();
+
+   const auto archiveTime = std::chrono::floor<std::chrono::seconds>(
+      session.archiveTime_.time_since_epoch());
+   const auto savedTime = std::chrono::floor<std::chrono::seconds>(
+      std::chrono::system_clock::now().time_since_epoch());
+
+   boost::json::object json {};
+   json[kViewTypeKey_]    = types::GetMapTimeName(session.viewType_);
+   json[kArchiveTimeKey_] = archiveTime.count();
+   json[kAnimatingKey_]   = session.animating_;
+   json[kSavedTimeKey_]   = savedTime.count();
+
+   util::json::WriteJsonFile(path, json);
+
+   SPDLOG_LOGGER_TRACE(logger_, "Saved session manifest");
+}
+
+const std::string& SessionManager::Impl::ManifestPath()
+{
+   static const std::string manifestPath = []()
+   {
+      std::string path {
+         QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            .toStdString()};
+
+      std::error_code error;
+      if (!std::filesystem::exists(path, error) &&
+          !std::filesystem::create_directories(path, error))
+      {
+         logger_->error("Unable to create cache directory: \"{}\" ({})",
+                        path,
+                        error.message());
+         return std::string {};
+      }
+
+      return path + "/session.json";
+   }();
+
+   return manifestPath;
+}
+
+std::shared_ptr<SessionManager> SessionManager::Instance()
+{
+   static std::weak_ptr<SessionManager> sessionManagerReference_ {};
+   static std::mutex                    instanceMutex_ {};
+
+   std::unique_lock lock(instanceMutex_);
+
+   std::shared_ptr<SessionManager> sessionManager =
+      sessionManagerReference_.lock();
+
+   if (sessionManager == nullptr)
+   {
+      sessionManager           = std::make_shared<SessionManager>();
+      sessionManagerReference_ = sessionManager;
+   }
+
+   return sessionManager;
+}
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <scwx/qt/types/map_types.hpp>
+
+#include <chrono>
+#include <memory>
+#include <optional>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+/**
+ * @brief Persists a manifest of the timeline session, such that a restart
+ * during an event resumes where it left off. Radar sites and products of each
+ * pane are already persisted in the map settings, and the manifest records
+ * the remaining timeline state. The manifest is saved whenever the session
+ * changes, and periodically, such that it is current after a crash.
+ */
+class SessionManager
+{
+public:
+   struct Session
+   {
+      types::MapTime                        viewType_ {types::MapTime::Live};
+      std::chrono::system_clock::time_point archiveTime_ {};
+      bool                                  animating_ {false};
+   };
+
+   explicit SessionManager();
+   ~SessionManager();
+
+   SessionManager(const SessionManager&)            = delete;
+   SessionManager& operator=(const SessionManager&) = delete;
+
+   SessionManager(SessionManager&&) noexcept            = delete;
+   SessionManager& operator=(SessionManager&&) noexcept = delete;
+
+   /**
+    * @brief Gets the session saved by the previous run of the application.
+    *
+    * @return Previous session, or std::nullopt if there was none, or it was
+    * last saved too long ago to be resumed
+    */
+   std::optional<Session> previous_session() const;
+
+   void SetViewType(types::MapTime viewType);
+   void SetArchiveTime(std::chrono::system_clock::time_point archiveTime);
+   void SetAnimating(bool animating);
+
+   static std::shared_ptr<SessionManager> Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
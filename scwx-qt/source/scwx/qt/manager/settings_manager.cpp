@@ -11,11 +11,17 @@
 #include <scwx/qt/settings/unit_settings.hpp>
 #include <scwx/qt/util/json.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/strand.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
+#include <optional>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <QDir>
 #include <QStandardPaths>
 
@@ -29,14 +35,27 @@ namespace manager
 static const std::string logPrefix_ = "scwx::qt::manager::settings_manager";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Minimum interval between writes of the settings file
+static constexpr std::chrono::seconds kWriteInterval_ {3};
+
 class SettingsManager::Impl
 {
 public:
    explicit Impl(SettingsManager* self) : self_ {self} {}
-   ~Impl() = default;
+   ~Impl()
+   {
+      {
+         std::unique_lock lock {writeMutex_};
+         writeTimer_.cancel();
+      }
+      writeStrand_.Join();
+   }
 
    void ValidateSettings();
 
+   void QueueWrite(boost::json::value settingsJson);
+   void WritePendingSettings();
+
    static boost::json::value ConvertSettingsToJson();
    static void               GenerateDefaultSettings();
    static bool LoadSettings(const boost::json::object& settingsJson);
@@ -45,6 +64,17 @@ public:
 
    bool        initialized_ {false};
    std::string settingsPath_ {};
+
+   // Settings are written in the background, at most once per write interval
+   scwx::util::Strand                    writeStrand_ {
+      "Settings Manager", scwx::util::Strand::Priority::Background};
+   boost::asio::steady_timer             writeTimer_ {
+      writeStrand_.get_executor()};
+   std::mutex                            writeMutex_ {};
+   std::mutex                            fileMutex_ {};
+   std::optional<boost::json::value>     pendingSettings_ {};
+   bool                                  writeScheduled_ {false};
+   std::chrono::steady_clock::time_point lastWrite_ {};
 };
 
 SettingsManager::SettingsManager() : p(std::make_unique<Impl>(this)) {}
@@ -106,13 +136,72 @@ void SettingsManager::SaveSettings()
    {
       logger_->info("Saving settings");
 
-      boost::json::value settingsJson = Impl::ConvertSettingsToJson();
-      util::json::WriteJsonFile(p->settingsPath_, settingsJson);
+      // Settings are serialized on the calling thread, and written to the
+      // settings file in the background
+      p->QueueWrite(Impl::ConvertSettingsToJson());
 
       Q_EMIT SettingsSaved();
    }
 }
 
+void SettingsManager::Impl::QueueWrite(boost::json::value settingsJson)
+{
+   std::unique_lock lock {writeMutex_};
+
+   // Replace any settings not yet written
+   pendingSettings_ = std::move(settingsJson);
+
+   if (writeScheduled_)
+   {
+      return;
+   }
+
+   writeScheduled_ = true;
+
+   // Write immediately, unless the settings file was written within the
+   // write interval
+   writeTimer_.expires_at(std::max(lastWrite_ + kWriteInterval_,
+                                   std::chrono::steady_clock::now()));
+   writeTimer_.async_wait(writeStrand_.Wrap(
+      [this](const boost::system::error_code& e)
+      {
+         if (e == boost::system::errc::success)
+         {
+            WritePendingSettings();
+         }
+      }));
+}
+
+void SettingsManager::Impl::WritePendingSettings()
+{
+   std::unique_lock fileLock {fileMutex_};
+   std::unique_lock lock {writeMutex_};
+
+   std::optional<boost::json::value> settingsJson {};
+   std::swap(settingsJson, pendingSettings_);
+   writeScheduled_ = false;
+   lastWrite_      = std::chrono::steady_clock::now();
+
+   lock.unlock();
+
+   if (!settingsJson.has_value())
+   {
+      return;
+   }
+
+   // Write to a temporary file, and replace the settings file once the write
+   // is complete
+   const std::string tempPath = settingsPath_ + ".tmp";
+   util::json::WriteJsonFile(tempPath, *settingsJson);
+
+   std::error_code error;
+   std::filesystem::rename(tempPath, settingsPath_, error);
+   if (error)
+   {
+      logger_->error("Unable to write settings file: {}", error.message());
+   }
+}
+
 void SettingsManager::Shutdown()
 {
    bool dataChanged = false;
@@ -126,6 +215,13 @@ void SettingsManager::Shutdown()
    {
       SaveSettings();
    }
+
+   // Write any pending settings before exiting
+   {
+      std::unique_lock lock {p->writeMutex_};
+      p->writeTimer_.cancel();
+   }
+   p->WritePendingSettings();
 }
 
 boost::json::value SettingsManager::Impl::ConvertSettingsToJson()
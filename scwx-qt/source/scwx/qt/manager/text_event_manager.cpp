@@ -1,16 +1,24 @@
 #include <scwx/qt/manager/text_event_manager.hpp>
 #include <scwx/qt/main/application.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/qt/util/alert_index.hpp>
 #include <scwx/awips/text_product_file.hpp>
-#include <scwx/provider/warnings_provider.hpp>
+#include <scwx/common/characters.hpp>
+#include <scwx/provider/replay_warnings_provider.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/memory.hpp>
+#include <scwx/util/profiler.hpp>
+#include <scwx/util/strand.hpp>
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <shared_mutex>
 #include <unordered_map>
 
-#include <boost/asio/post.hpp>
+#include <boost/algorithm/string/replace.hpp>
 #include <boost/asio/steady_timer.hpp>
-#include <boost/asio/thread_pool.hpp>
+#include <QStandardPaths>
 
 namespace scwx
 {
@@ -25,46 +33,65 @@ static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 static const std::string& kDefaultWarningsProviderUrl {
    "https://warnings.allisonhouse.com"};
 
+// Recorded warnings to replay instead of the warnings provider
+static std::string                                  replayDirectory_ {};
+static std::shared_ptr<const provider::ReplayClock> replayClock_ {};
+
+// Messages are compacted once they are superseded, or once their event has
+// ended for this long, checking at most once per interval
+static constexpr std::chrono::hours   kCompactAge_ {1};
+static constexpr std::chrono::minutes kCompactInterval_ {10};
+
+// The alert state is saved once updated, at most once per interval, and is
+// restored on startup before loading updates from the warnings provider
+static constexpr std::chrono::minutes kSnapshotInterval_ {5};
+static const std::string              kSnapshotVersion_ {"scwx-alerts 1"};
+static const std::string              kLineEnding_ {"\r\r\n"};
+
 class TextEventManager::Impl
 {
 public:
    explicit Impl(TextEventManager* self) :
        self_ {self},
-       refreshTimer_ {threadPool_},
+       refreshTimer_ {strand_.get_executor()},
        refreshMutex_ {},
        textEventMap_ {},
        textEventMutex_ {}
    {
       auto& generalSettings = settings::GeneralSettings::Instance();
 
-      warningsProvider_ = std::make_shared<provider::WarningsProvider>(
-         generalSettings.warnings_provider().GetValue());
+      warningsProvider_ =
+         CreateWarningsProvider(generalSettings.warnings_provider().GetValue());
 
       warningsProviderChangedCallbackUuid_ =
          generalSettings.warnings_provider().RegisterValueChangedCallback(
-            [this](const std::string& value) {
-               warningsProvider_ =
-                  std::make_shared<provider::WarningsProvider>(value);
-            });
-
-      boost::asio::post(threadPool_,
-                        [this]()
-                        {
-                           try
-                           {
-                              main::Application::WaitForInitialization();
-                              logger_->debug("Start Refresh");
-                              Refresh();
-                           }
-                           catch (const std::exception& ex)
-                           {
-                              logger_->error(ex.what());
-                           }
-                        });
+            [this](const std::string& value)
+            { warningsProvider_ = CreateWarningsProvider(value); });
+
+      // Replayed alerts are not saved, and previous alerts are not restored
+      if (replayClock_ != nullptr)
+      {
+         snapshotEnabled_ = false;
+      }
+
+      // Alerts are loaded once the panes of the previous session have been
+      // restored
+      sessionRestoreConnection_ = main::Application::RunAfterSessionRestore(
+         [this]()
+         {
+            strand_.Post(
+               [this]()
+               {
+                  logger_->debug("Start Refresh");
+                  Refresh();
+               });
+         });
    }
 
    ~Impl()
    {
+      sessionRestoreConnection_.disconnect();
+
       settings::GeneralSettings::Instance()
          .warnings_provider()
          .UnregisterValueChangedCallback(warningsProviderChangedCallbackUuid_);
@@ -73,26 +100,50 @@ public:
       refreshTimer_.cancel();
       lock.unlock();
 
-      threadPool_.join();
+      strand_.Join();
    }
 
+   static std::shared_ptr<provider::WarningsProvider>
+   CreateWarningsProvider(const std::string& baseUrl);
+
+   void CompactMessages();
    void HandleMessage(std::shared_ptr<awips::TextProductMessage> message);
+   bool LoadSnapshot(provider::WarningsProvider& warningsProvider);
+   void SaveSnapshot(const provider::WarningsProvider& warningsProvider);
+   static const std::string& SnapshotPath();
+   void UpdateIndex(
+      const types::TextEventKey&                                     key,
+      const std::vector<std::shared_ptr<awips::TextProductMessage>>& messages);
    void RefreshAsync();
    void Refresh();
 
-   boost::asio::thread_pool threadPool_ {1u};
+   // Refreshes download text products from the warnings provider
+   scwx::util::Strand strand_ {"Text Event Manager",
+                               scwx::util::Strand::Priority::Blocking};
 
    TextEventManager* self_;
 
    boost::asio::steady_timer refreshTimer_;
    std::mutex                refreshMutex_;
 
+   boost::signals2::scoped_connection sessionRestoreConnection_ {};
+
+   std::chrono::steady_clock::time_point lastCompactTime_ {};
+   std::chrono::steady_clock::time_point lastSnapshotTime_ {};
+   bool                                  snapshotEnabled_ {true};
+   bool                                  snapshotLoaded_ {false};
+   bool                                  snapshotUpdated_ {false};
+
    std::unordered_map<types::TextEventKey,
                       std::vector<std::shared_ptr<awips::TextProductMessage>>,
                       types::TextEventHash<types::TextEventKey>>
                      textEventMap_;
+   util::AlertIndex  textEventIndex_ {};
    std::shared_mutex textEventMutex_;
 
+   // Size of the stored messages, updated under the text event mutex
+   scwx::util::MemoryCounter textEventMemory_ {"Text Products"};
+
    std::shared_ptr<provider::WarningsProvider> warningsProvider_ {nullptr};
 
    boost::uuids::uuid warningsProviderChangedCallbackUuid_ {};
@@ -132,41 +183,65 @@ TextEventManager::message_list(const types::TextEventKey& key) const
    return messageList;
 }
 
+std::vector<types::TextEventKey>
+TextEventManager::QueryEvents(std::chrono::system_clock::time_point begin,
+                              std::chrono::system_clock::time_point end) const
+{
+   std::shared_lock lock(p->textEventMutex_);
+   return p->textEventIndex_.QueryTime(begin, end);
+}
+
+std::vector<types::TextEventKey> TextEventManager::QueryEvents(
+   const common::Coordinate&           point,
+   const units::length::meters<double> distance) const
+{
+   std::shared_lock lock(p->textEventMutex_);
+   return p->textEventIndex_.QueryArea(point, distance);
+}
+
+std::vector<types::TextEventKey>
+TextEventManager::QueryEvents(const std::string& fipsId) const
+{
+   auto fipsCode = awips::Ugc::GetFipsCode(fipsId);
+   if (!fipsCode.has_value())
+   {
+      return {};
+   }
+
+   std::shared_lock lock(p->textEventMutex_);
+   return p->textEventIndex_.QueryCounty(*fipsCode);
+}
+
 void TextEventManager::LoadFile(const std::string& filename)
 {
    logger_->debug("LoadFile: {}", filename);
 
-   boost::asio::post(p->threadPool_,
-                     [=, this]()
-                     {
-                        try
-                        {
-                           awips::TextProductFile file;
-
-                           // Load file
-                           bool fileLoaded = file.LoadFile(filename);
-                           if (!fileLoaded)
-                           {
-                              return;
-                           }
-
-                           // Process messages
-                           auto messages = file.messages();
-                           for (auto& message : messages)
-                           {
-                              p->HandleMessage(message);
-                           }
-                        }
-                        catch (const std::exception& ex)
-                        {
-                           logger_->error(ex.what());
-                        }
-                     });
+   p->strand_.Post(
+      [=, this]()
+      {
+         awips::TextProductFile file;
+
+         // Load file
+         bool fileLoaded = file.LoadFile(filename);
+         if (!fileLoaded)
+         {
+            return;
+         }
+
+         // Process messages
+         auto messages = file.messages();
+         for (auto& message : messages)
+         {
+            p->HandleMessage(message);
+         }
+      });
 }
 
 void TextEventManager::Impl::HandleMessage(
    std::shared_ptr<awips::TextProductMessage> message)
 {
+   scwx::util::ScopedTimer timer {scwx::util::ProfileStage::AlertUpdate};
+
    auto segments = message->segments();
 
    // If there are no segments, skip this message
@@ -199,7 +274,7 @@ void TextEventManager::Impl::HandleMessage(
    if (it == textEventMap_.cend())
    {
       // If there was no matching event, add the message to a new event
-      textEventMap_.emplace(key, std::vector {message});
+      it           = textEventMap_.emplace(key, std::vector {message}).first;
       messageIndex = 0;
       updated      = true;
    }
@@ -219,6 +294,13 @@ void TextEventManager::Impl::HandleMessage(
       updated = true;
    };
 
+   if (updated)
+   {
+      UpdateIndex(key, it->second);
+      textEventMemory_.set_bytes(textEventMemory_.bytes() +
+                                 message->data_size());
+   }
+
    lock.unlock();
 
    if (updated)
@@ -227,25 +309,102 @@ void TextEventManager::Impl::HandleMessage(
    }
 }
 
+void TextEventManager::Impl::UpdateIndex(
+   const types::TextEventKey&                                     key,
+   const std::vector<std::shared_ptr<awips::TextProductMessage>>& messages)
+{
+   // The event begins with the first message, and its end time and location
+   // are those of the most recent message
+   auto& lastMessage = messages.back();
+   auto  segments    = lastMessage->segments();
+
+   std::vector<std::vector<common::Coordinate>> areas {};
+   std::vector<std::uint32_t>                   fipsCodes {};
+
+   for (auto& segment : segments)
+   {
+      if (segment->codedLocation_.has_value())
+      {
+         areas.push_back(segment->codedLocation_->coordinates());
+      }
+
+      auto segmentFipsCodes = segment->header_->ugc_.fips_codes();
+      fipsCodes.insert(
+         fipsCodes.end(), segmentFipsCodes.cbegin(), segmentFipsCodes.cend());
+   }
+
+   std::sort(fipsCodes.begin(), fipsCodes.end());
+   fipsCodes.erase(std::unique(fipsCodes.begin(), fipsCodes.end()),
+                   fipsCodes.end());
+
+   textEventIndex_.Update(
+      key,
+      messages.front()->segment_event_begin(0),
+      segments.back()->header_->vtecString_[0].pVtec_.event_end(),
+      areas,
+      fipsCodes);
+}
+
+void TextEventManager::Impl::CompactMessages()
+{
+   SPDLOG_LOGGER_TRACE(logger_, "Compacting messages");
+
+   const auto  compactTime  = std::chrono::system_clock::now() - kCompactAge_;
+   std::size_t compactCount = 0;
+
+   std::shared_lock lock(textEventMutex_);
+
+   for (auto& textEvent : textEventMap_)
+   {
+      auto& messages = textEvent.second;
+
+      for (std::size_t i = 0; i < messages.size(); ++i)
+      {
+         auto& message = messages[i];
+
+         // The latest message of an event is kept until the event has ended
+         if (i + 1 == messages.size())
+         {
+            auto segments = message->segments();
+            if (segments.empty() || !segments.back()->header_.has_value() ||
+                segments.back()->event_end() > compactTime)
+            {
+               continue;
+            }
+         }
+
+         if (message->Compact())
+         {
+            ++compactCount;
+         }
+      }
+   }
+
+   // Messages are only added under an exclusive lock, so the total is
+   // consistent with concurrent updates
+   std::size_t totalBytes = 0;
+   for (auto& textEvent : textEventMap_)
+   {
+      for (auto& message : textEvent.second)
+      {
+         totalBytes += message->data_size();
+      }
+   }
+   textEventMemory_.set_bytes(totalBytes);
+
+   lock.unlock();
+
+   logger_->debug("Compacted {} messages", compactCount);
+}
+
 void TextEventManager::Impl::RefreshAsync()
 {
-   boost::asio::post(threadPool_,
-                     [this]()
-                     {
-                        try
-                        {
-                           Refresh();
-                        }
-                        catch (const std::exception& ex)
-                        {
-                           logger_->error(ex.what());
-                        }
-                     });
+   strand_.Post([this]() { Refresh(); });
 }
 
 void TextEventManager::Impl::Refresh()
 {
-   logger_->trace("Refresh");
+   SPDLOG_LOGGER_TRACE(logger_, "Refresh");
 
    // Take a unique lock before refreshing
    std::unique_lock lock(refreshMutex_);
@@ -254,6 +413,17 @@ void TextEventManager::Impl::Refresh()
    std::shared_ptr<provider::WarningsProvider> warningsProvider =
       warningsProvider_;
 
+   // Restore the alert state from the previous session, so active alerts are
+   // shown before loading updates
+   if (snapshotEnabled_ && !snapshotLoaded_)
+   {
+      if (LoadSnapshot(*warningsProvider))
+      {
+         lastSnapshotTime_ = std::chrono::steady_clock::now();
+      }
+      snapshotLoaded_ = true;
+   }
+
    // Update the file listing from the warnings provider
    auto [newFiles, totalFiles] = warningsProvider->ListFiles();
 
@@ -270,12 +440,40 @@ void TextEventManager::Impl::Refresh()
             HandleMessage(message);
          }
       }
+
+      if (!updatedFiles.empty())
+      {
+         snapshotUpdated_ = true;
+      }
    }
 
-   // Schedule another update in 15 seconds
+   // Save the alert state for the next session
+   if (snapshotEnabled_ && snapshotUpdated_ &&
+       std::chrono::steady_clock::now() - lastSnapshotTime_ >=
+          kSnapshotInterval_)
+   {
+      SaveSnapshot(*warningsProvider);
+      snapshotUpdated_  = false;
+      lastSnapshotTime_ = std::chrono::steady_clock::now();
+   }
+
+   // Reduce the memory used by messages which are kept for reference
+   if (std::chrono::steady_clock::now() - lastCompactTime_ >= kCompactInterval_)
+   {
+      CompactMessages();
+      lastCompactTime_ = std::chrono::steady_clock::now();
+   }
+
+   // Schedule another update in 15 seconds, or 15 seconds of replayed time
    using namespace std::chrono;
-   refreshTimer_.expires_after(15s);
-   refreshTimer_.async_wait(
+   steady_clock::duration refreshInterval = 15s;
+   if (replayClock_ != nullptr)
+   {
+      refreshInterval = std::max<steady_clock::duration>(
+         replayClock_->GetWallDuration(15s), 1s);
+   }
+   refreshTimer_.expires_after(refreshInterval);
+   refreshTimer_.async_wait(strand_.Wrap(
       [this](const boost::system::error_code& e)
       {
          if (e == boost::asio::error::operation_aborted)
@@ -290,7 +488,187 @@ void TextEventManager::Impl::Refresh()
          {
             RefreshAsync();
          }
-      });
+      }));
+}
+
+std::shared_ptr<provider::WarningsProvider>
+TextEventManager::Impl::CreateWarningsProvider(const std::string& baseUrl)
+{
+   if (replayClock_ != nullptr)
+   {
+      return std::make_shared<provider::ReplayWarningsProvider>(
+         replayDirectory_, replayClock_);
+   }
+
+   return std::make_shared<provider::WarningsProvider>(baseUrl);
+}
+
+bool TextEventManager::Impl::LoadSnapshot(
+   provider::WarningsProvider& warningsProvider)
+{
+   const std::string& path = SnapshotPath();
+   if (path.empty())
+   {
+      return false;
+   }
+
+   std::ifstream f {path, std::ios_base::in | std::ios_base::binary};
+   if (!f.is_open())
+   {
+      logger_->debug("No alert snapshot found");
+      return false;
+   }
+
+   // The snapshot is only valid for the same version and warnings provider
+   std::string version {};
+   std::string baseUrl {};
+   std::getline(f, version);
+   std::getline(f, baseUrl);
+
+   if (version != kSnapshotVersion_ || baseUrl != warningsProvider.base_url())
+   {
+      logger_->info("Alert snapshot is out of date");
+      return false;
+   }
+
+   // Loaded size of each warnings file
+   std::map<std::string, std::size_t> loadedSizes {};
+   std::size_t                        fileCount = 0;
+
+   f >> fileCount;
+   for (std::size_t i = 0; i < fileCount && f.good(); ++i)
+   {
+      std::string filename {};
+      std::size_t loadedSize = 0;
+      f >> filename >> loadedSize;
+      loadedSizes.emplace(filename, loadedSize);
+   }
+
+   if (f.fail())
+   {
+      logger_->warn("Invalid alert snapshot");
+      return false;
+   }
+
+   // Products follow the list of files
+   awips::TextProductFile file {};
+   if (!file.LoadData(f))
+   {
+      logger_->warn("Alert snapshot contains no products");
+      return false;
+   }
+
+   auto messages = file.messages();
+   for (auto& message : messages)
+   {
+      HandleMessage(message);
+   }
+
+   logger_->info("Restored {} messages from alert snapshot", messages.size());
+
+   // Products already contained in the snapshot are not loaded again
+   warningsProvider.RestoreLoadedSizes(loadedSizes);
+
+   return true;
+}
+
+void TextEventManager::Impl::SaveSnapshot(
+   const provider::WarningsProvider& warningsProvider)
+{
+   const std::string& path = SnapshotPath();
+   if (path.empty())
+   {
+      return;
+   }
+
+   SPDLOG_LOGGER_TRACE(logger_, "Saving alert snapshot");
+
+   // Products loaded from the warnings files up to these sizes are contained in
+   // the snapshot
+   const auto loadedSizes = warningsProvider.loaded_sizes();
+
+   std::string products {};
+   std::size_t messageCount = 0;
+
+   std::shared_lock lock(textEventMutex_);
+
+   for (auto& textEvent : textEventMap_)
+   {
+      for (auto& message : textEvent.second)
+      {
+         // Message content is stored with line endings normalized, and the
+         // parser expects the transmitted line endings
+         std::string content = message->message_content();
+         boost::replace_all(content, "\n", kLineEnding_);
+
+         products += common::Characters::SOH;
+         products += kLineEnding_;
+         products += content;
+         products += kLineEnding_;
+         products += common::Characters::ETX;
+         ++messageCount;
+      }
+   }
+
+   lock.unlock();
+
+   // Write to a temporary file, and replace the snapshot once complete
+   const std::string tempPath = path + ".tmp";
+
+   std::ofstream f {tempPath,
+                    std::ios_base::out | std::ios_base::binary |
+                       std::ios_base::trunc};
+
+   f << kSnapshotVersion_ << '\n';
+   f << warningsProvider.base_url() << '\n';
+   f << loadedSizes.size() << '\n';
+   for (auto& loadedSize : loadedSizes)
+   {
+      f << loadedSize.first << ' ' << loadedSize.second << '\n';
+   }
+   f.write(products.data(), static_cast<std::streamsize>(products.size()));
+   f.close();
+
+   std::error_code error;
+   if (f.fail())
+   {
+      logger_->warn("Unable to write alert snapshot: {}", tempPath);
+      std::filesystem::remove(tempPath, error);
+      return;
+   }
+
+   std::filesystem::rename(tempPath, path, error);
+   if (error)
+   {
+      logger_->warn("Unable to replace alert snapshot: {}", error.message());
+      return;
+   }
+
+   logger_->debug("Saved {} messages to alert snapshot", messageCount);
+}
+
+const std::string& TextEventManager::Impl::SnapshotPath()
+{
+   static const std::string snapshotPath = []()
+   {
+      std::string path {
+         QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            .toStdString()};
+
+      std::error_code error;
+      if (!std::filesystem::exists(path, error) &&
+          !std::filesystem::create_directories(path, error))
+      {
+         logger_->error("Unable to create cache directory: \"{}\" ({})",
+                        path,
+                        error.message());
+         return std::string {};
+      }
+
+      return path + "/alerts.snapshot";
+   }();
+
+   return snapshotPath;
 }
 
 std::shared_ptr<TextEventManager> TextEventManager::Instance()
@@ -312,6 +690,14 @@ std::shared_ptr<TextEventManager> TextEventManager::Instance()
    return textEventManager;
 }
 
+void TextEventManager::SetReplay(
+   const std::string&                                  directory,
+   const std::shared_ptr<const provider::ReplayClock>& clock)
+{
+   replayDirectory_ = directory;
+   replayClock_     = clock;
+}
+
 } // namespace manager
 } // namespace qt
 } // namespace scwx
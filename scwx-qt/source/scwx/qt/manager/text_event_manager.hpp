@@ -2,11 +2,15 @@
 
 #include <scwx/awips/text_product_message.hpp>
 #include <scwx/qt/types/text_event_key.hpp>
+#include <scwx/common/geographic.hpp>
+#include <scwx/provider/replay_clock.hpp>
 
+#include <chrono>
 #include <memory>
 #include <string>
 
 #include <QObject>
+#include <units/length.h>
 
 namespace scwx
 {
@@ -27,10 +31,56 @@ public:
    std::vector<std::shared_ptr<awips::TextProductMessage>>
    message_list(const types::TextEventKey& key) const;
 
+   /**
+    * @brief Finds the text events valid at any time within a time range.
+    *
+    * @param [in] begin Start of the time range
+    * @param [in] end End of the time range
+    *
+    * @return Text event keys
+    */
+   std::vector<types::TextEventKey>
+   QueryEvents(std::chrono::system_clock::time_point begin,
+               std::chrono::system_clock::time_point end) const;
+
+   /**
+    * @brief Finds the text events with an area within a distance of a point.
+    *
+    * @param [in] point Point
+    * @param [in] distance Distance from the point
+    *
+    * @return Text event keys
+    */
+   std::vector<types::TextEventKey>
+   QueryEvents(const common::Coordinate&           point,
+               const units::length::meters<double> distance) const;
+
+   /**
+    * @brief Finds the text events containing a county or zone.
+    *
+    * @param [in] fipsId FIPS ID of the county or zone
+    *
+    * @return Text event keys
+    */
+   std::vector<types::TextEventKey>
+   QueryEvents(const std::string& fipsId) const;
+
    void LoadFile(const std::string& filename);
 
    static std::shared_ptr<TextEventManager> Instance();
 
+   /**
+    * @brief Replays recorded warnings files instead of using the warnings
+    * provider. Must be called before the text event manager is created. The
+    * alert state is not saved or restored while replaying.
+    *
+    * @param [in] directory Recorded data directory
+    * @param [in] clock Replay clock
+    */
+   static void
+   SetReplay(const std::string&                                  directory,
+             const std::shared_ptr<const provider::ReplayClock>& clock);
+
 signals:
    void AlertUpdated(const types::TextEventKey& key, size_t messageIndex);
 
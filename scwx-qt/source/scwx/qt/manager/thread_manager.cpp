@@ -1,5 +1,6 @@
 #include <scwx/qt/manager/thread_manager.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/profiler.hpp>
 
 #include <execution>
 #include <mutex>
@@ -47,8 +48,17 @@ QThread* ThreadManager::thread(const std::string& id, bool autoStart)
       logger_->debug("Creating thread: {}", id);
 
       thread = new QThread(this);
+      thread->setObjectName(QString::fromStdString(id));
       p->threadMap_.insert_or_assign(id, thread);
 
+      // Name the thread in profiler traces, from the started thread
+      connect(
+         thread,
+         &QThread::started,
+         thread,
+         [id]() { scwx::util::Profiler::SetThreadName(id); },
+         Qt::DirectConnection);
+
       if (autoStart)
       {
          thread->start();
@@ -69,7 +79,9 @@ void ThreadManager::StopThreads()
                  p->threadMap_.end(),
                  [](auto& thread)
                  {
-                    logger_->trace("Stopping thread: {}", thread.first);
+                    SPDLOG_LOGGER_TRACE(logger_,
+                                        "Stopping thread: {}",
+                                        thread.first);
 
                     thread.second->quit();
                     if (!thread.second->wait(5000))
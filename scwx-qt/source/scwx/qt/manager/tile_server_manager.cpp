@@ -0,0 +1,631 @@
+#include <scwx/qt/manager/tile_server_manager.hpp>
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/settings/palette_settings.hpp>
+#include <scwx/qt/view/color_table_cache.hpp>
+#include <scwx/qt/view/radar_product_view.hpp>
+#include <scwx/qt/view/radar_product_view_factory.hpp>
+#include <scwx/common/color_table.hpp>
+#include <scwx/common/products.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <numbers>
+#include <optional>
+#include <tuple>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <fmt/format.h>
+#include <QBuffer>
+#include <QImage>
+#include <QPointer>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTimer>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+static const std::string logPrefix_ = "scwx::qt::manager::tile_server_manager";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Requests are small, and larger requests are not read
+static constexpr qint64 kMaxRequestSize_ = 8192;
+
+static constexpr int kTileSize_ = 256;
+static constexpr int kMaxZoom_  = 16;
+
+// Tiles cached for each radar product, until the next volume is computed
+static constexpr std::size_t kMaxCachedTiles_ = 4096u;
+
+// Each radar product holds a radar product manager and refreshes its data, so
+// a limited number are decoded, and are released when no longer requested
+static constexpr std::size_t          kMaxSources_ = 8u;
+static constexpr std::chrono::minutes kSourceIdleTimeout_ {10};
+static constexpr std::chrono::minutes kSourceExpiryInterval_ {1};
+
+struct TileResponse
+{
+   std::string status_ {"200 OK"};
+   std::string contentType_ {"text/plain"};
+   QByteArray  body_ {};
+};
+
+/**
+ * @brief Radar product decoded for rendering tiles, shared by every request
+ * for tiles of the radar site and product.
+ */
+struct TileSource
+{
+   std::string               radarSite_ {};
+   common::RadarProductGroup group_ {};
+   std::string               product_ {};
+
+   std::shared_ptr<RadarProductManager>    radarProductManager_ {};
+   std::shared_ptr<view::RadarProductView> view_ {};
+
+   // Accessed only from the main thread
+   QMetaObject::Connection               newDataConnection_ {};
+   std::chrono::steady_clock::time_point lastRequested_ {};
+
+   // Encoded tiles by zoom, x, y and format, of the computed volume
+   std::mutex                                                   cacheMutex_ {};
+   std::map<std::tuple<int, int, int, std::string>, QByteArray> cache_ {};
+};
+
+class TileServerManager::Impl
+{
+public:
+   explicit Impl(TileServerManager* self) :
+       self_ {self},
+       server_ {new QTcpServer(self)},
+       expiryTimer_ {new QTimer(self)},
+       uuid_ {boost::uuids::random_generator()()}
+   {
+      QObject::connect(server_,
+                       &QTcpServer::newConnection,
+                       self_,
+                       [this]() { HandleConnections(); });
+
+      expiryTimer_->setInterval(kSourceExpiryInterval_);
+      QObject::connect(expiryTimer_,
+                       &QTimer::timeout,
+                       self_,
+                       [this]() { ExpireSources(); });
+   }
+
+   ~Impl()
+   {
+      ReleaseSources();
+      threadPool_.join();
+   }
+
+   void HandleConnections();
+   void HandleRequest(QTcpSocket* socket);
+   void ExpireSources();
+   void ReleaseSource(TileSource& source);
+   void ReleaseSources();
+
+   std::shared_ptr<TileSource> GetSource(const std::string& radarSite,
+                                         const std::string& product);
+   void ServeTile(const QPointer<QTcpSocket>&        socket,
+                  const std::shared_ptr<TileSource>& source,
+                  int                                z,
+                  int                                x,
+                  int                                y,
+                  const std::string&                 format);
+   void WriteResponse(QTcpSocket* socket, const TileResponse& response);
+
+   static std::optional<QByteArray> RenderTile(TileSource&        source,
+                                               int                z,
+                                               int                x,
+                                               int                y,
+                                               const std::string& format);
+
+   TileServerManager* self_;
+   QTcpServer*        server_;
+   QTimer*            expiryTimer_;
+
+   boost::uuids::uuid uuid_;
+
+   boost::asio::thread_pool threadPool_ {4u};
+
+   // Accessed only from the main thread
+   std::map<std::pair<std::string, std::string>, std::shared_ptr<TileSource>>
+      sources_ {};
+};
+
+TileServerManager::TileServerManager() : p(std::make_unique<Impl>(this)) {}
+TileServerManager::~TileServerManager() = default;
+
+bool TileServerManager::Start(std::uint16_t port, const QHostAddress& address)
+{
+   if (!p->server_->listen(address, port))
+   {
+      logger_->error("Unable to serve tiles on {} port {}: {}",
+                     address.toString().toStdString(),
+                     port,
+                     p->server_->errorString().toStdString());
+      return false;
+   }
+
+   logger_->info("Serving tiles at http://{}:{}/tiles",
+                 address.toString().toStdString(),
+                 port);
+
+   p->expiryTimer_->start();
+
+   return true;
+}
+
+void TileServerManager::Stop()
+{
+   p->expiryTimer_->stop();
+   p->server_->close();
+   p->ReleaseSources();
+}
+
+void TileServerManager::Impl::HandleConnections()
+{
+   while (server_->hasPendingConnections())
+   {
+      QTcpSocket* socket = server_->nextPendingConnection();
+
+      QObject::connect(socket,
+                       &QTcpSocket::disconnected,
+                       socket,
+                       &QObject::deleteLater);
+      QObject::connect(socket,
+                       &QTcpSocket::readyRead,
+                       self_,
+                       [this, socket]() { HandleRequest(socket); });
+   }
+}
+
+void TileServerManager::Impl::HandleRequest(QTcpSocket* socket)
+{
+   // Wait for the request line, e.g., "GET /tiles/KLSX/REF/7/32/49.png
+   // HTTP/1.1"
+   if (!socket->canReadLine())
+   {
+      if (socket->bytesAvailable() > kMaxRequestSize_)
+      {
+         socket->abort();
+      }
+      return;
+   }
+
+   // Stop reading the remainder of the request
+   QObject::disconnect(socket, &QTcpSocket::readyRead, self_, nullptr);
+
+   const QList<QByteArray> request = socket->readLine().trimmed().split(' ');
+
+   if (request.size() < 2 || request[0] != "GET")
+   {
+      WriteResponse(socket, {.status_ {"405 Method Not Allowed"}});
+      return;
+   }
+
+   // Path: /tiles/<radar site>/<product>/<z>/<x>/<y>.<format>
+   const QList<QByteArray> path = request[1].split('/');
+   if (path.size() != 7 || !path[0].isEmpty() || path[1] != "tiles")
+   {
+      WriteResponse(socket, {.status_ {"404 Not Found"}});
+      return;
+   }
+
+   const QList<QByteArray> yFormat = path[6].split('.');
+
+   bool zValid = false;
+   bool xValid = false;
+   bool yValid = false;
+
+   const int z = path[4].toInt(&zValid);
+   const int x = path[5].toInt(&xValid);
+   const int y = yFormat[0].toInt(&yValid);
+
+   const std::string format =
+      (yFormat.size() == 2) ? yFormat[1].toLower().toStdString() : "";
+
+   if (!zValid || !xValid || !yValid || z < 0 || z > kMaxZoom_ || x < 0 ||
+       y < 0 || x >= (1 << z) || y >= (1 << z) ||
+       (format != "png" && format != "webp"))
+   {
+      WriteResponse(socket, {.status_ {"404 Not Found"}});
+      return;
+   }
+
+   std::shared_ptr<TileSource> source =
+      GetSource(path[2].toUpper().toStdString(), path[3].toStdString());
+   if (source == nullptr)
+   {
+      WriteResponse(socket, {.status_ {"404 Not Found"}});
+      return;
+   }
+
+   ServeTile(socket, source, z, x, y, format);
+}
+
+std::shared_ptr<TileSource>
+TileServerManager::Impl::GetSource(const std::string& radarSite,
+                                   const std::string& product)
+{
+   const auto now = std::chrono::steady_clock::now();
+
+   auto key = std::make_pair(radarSite, product);
+   auto it  = sources_.find(key);
+   if (it != sources_.cend())
+   {
+      it->second->lastRequested_ = now;
+      return it->second;
+   }
+
+   if (config::RadarSite::Get(radarSite) == nullptr)
+   {
+      return nullptr;
+   }
+
+   // Level 2 products are named, e.g., REF, and level 3 products are
+   // identified by AWIPS ID, e.g., N0B
+   common::RadarProductGroup group;
+   std::int16_t              productCode = 0;
+   std::string               palette {};
+
+   const common::Level2Product level2Product =
+      common::GetLevel2Product(product);
+   if (level2Product != common::Level2Product::Unknown)
+   {
+      group   = common::RadarProductGroup::Level2;
+      palette = common::GetLevel2Palette(level2Product);
+   }
+   else
+   {
+      group       = common::RadarProductGroup::Level3;
+      productCode = common::GetLevel3ProductCodeByAwipsId(product);
+      palette     = common::GetLevel3Palette(productCode);
+
+      if (productCode == 0)
+      {
+         return nullptr;
+      }
+   }
+
+   // Release the least recently requested radar product to make room
+   if (sources_.size() >= kMaxSources_)
+   {
+      auto oldest = std::min_element(
+         sources_.begin(),
+         sources_.end(),
+         [](const auto& lhs, const auto& rhs)
+         { return lhs.second->lastRequested_ < rhs.second->lastRequested_; });
+
+      ReleaseSource(*oldest->second);
+      sources_.erase(oldest);
+   }
+
+   logger_->info("Serving tiles of {} {}", radarSite, product);
+
+   auto source                  = std::make_shared<TileSource>();
+   source->radarSite_           = radarSite;
+   source->group_               = group;
+   source->product_             = product;
+   source->lastRequested_       = now;
+   source->radarProductManager_ = RadarProductManager::Instance(radarSite);
+   source->view_                = view::RadarProductViewFactory::Create(
+      group, product, productCode, source->radarProductManager_);
+
+   if (source->view_ == nullptr)
+   {
+      return nullptr;
+   }
+
+   sources_.emplace(key, source);
+
+   std::weak_ptr<TileSource> weakSource = source;
+
+   // The cache holds tiles of the computed volume only
+   QObject::connect(source->view_.get(),
+                    &view::RadarProductView::SweepComputed,
+                    self_,
+                    [weakSource]()
+                    {
+                       if (auto source = weakSource.lock())
+                       {
+                          std::unique_lock lock {source->cacheMutex_};
+                          source->cache_.clear();
+                       }
+                    });
+
+   // Select new data as it becomes available
+   source->newDataConnection_ = QObject::connect(
+      source->radarProductManager_.get(),
+      &RadarProductManager::NewDataAvailable,
+      self_,
+      [weakSource](common::RadarProductGroup             group,
+                   const std::string&                    product,
+                   std::chrono::system_clock::time_point latestTime)
+      {
+         auto source = weakSource.lock();
+         if (source != nullptr && source->group_ == group &&
+             (group == common::RadarProductGroup::Level2 ||
+              source->product_ == product))
+         {
+            source->view_->SelectTime(latestTime);
+            source->view_->Update();
+         }
+      });
+
+   source->radarProductManager_->EnableRefresh(
+      group, source->view_->GetRadarProductName(), true, uuid_);
+
+   // Load the color table, and compute the latest volume
+   boost::asio::post(
+      threadPool_,
+      [source, palette]()
+      {
+         try
+         {
+            const std::string colorTableFile =
+               settings::PaletteSettings::Instance()
+                  .palette(palette)
+                  .GetValue();
+            if (!colorTableFile.empty())
+            {
+               source->view_->LoadColorTable(
+                  view::ColorTableCache::Instance().Load(colorTableFile));
+            }
+
+            source->view_->Initialize();
+         }
+         catch (const std::exception& ex)
+         {
+            logger_->error(ex.what());
+         }
+      });
+
+   return source;
+}
+
+void TileServerManager::Impl::ServeTile(
+   const QPointer<QTcpSocket>&        socket,
+   const std::shared_ptr<TileSource>& source,
+   int                                z,
+   int                                x,
+   int                                y,
+   const std::string&                 format)
+{
+   const auto key = std::make_tuple(z, x, y, format);
+
+   const std::string contentType =
+      (format == "webp") ? "image/webp" : "image/png";
+
+   {
+      std::unique_lock lock {source->cacheMutex_};
+      auto             it = source->cache_.find(key);
+      if (it != source->cache_.cend())
+      {
+         WriteResponse(socket,
+                       {.contentType_ {contentType}, .body_ {it->second}});
+         return;
+      }
+   }
+
+   // Render on a worker thread, and respond from the socket's thread
+   boost::asio::post(
+      threadPool_,
+      [=, this]()
+      {
+         TileResponse response {};
+
+         try
+         {
+            std::optional<QByteArray> tile =
+               RenderTile(*source, z, x, y, format);
+
+            if (tile.has_value())
+            {
+               response.contentType_ = contentType;
+               response.body_        = *tile;
+            }
+            else
+            {
+               response.status_ = "500 Internal Server Error";
+            }
+         }
+         catch (const std::exception& ex)
+         {
+            logger_->error(ex.what());
+            response.status_ = "500 Internal Server Error";
+         }
+
+         QMetaObject::invokeMethod(self_,
+                                   [=, this]()
+                                   {
+                                      if (socket != nullptr)
+                                      {
+                                         WriteResponse(socket, response);
+                                      }
+                                   });
+      });
+}
+
+std::optional<QByteArray> TileServerManager::Impl::RenderTile(
+   TileSource& source, int z, int x, int y, const std::string& format)
+{
+   QImage image {kTileSize_, kTileSize_, QImage::Format_RGBA8888};
+   image.fill(Qt::transparent);
+
+   auto& view = source.view_;
+
+   // Tiles rendered before the first volume is computed are not cached
+   bool cacheable = false;
+
+   {
+      std::unique_lock sweepLock {view->sweep_mutex()};
+
+      cacheable =
+         (view->sweep_time() != std::chrono::system_clock::time_point {});
+
+      const std::vector<boost::gil::rgba8_pixel_t>& lut =
+         view->color_table_lut();
+      const double lutMin   = view->color_table_min();
+      const double lutRange = std::max(view->color_table_max() - lutMin, 1.0);
+      const bool   hideZero = view->hide_zero_moments();
+
+      // Web Mercator pixel coordinates of the tile
+      const double worldSize = static_cast<double>(kTileSize_) * (1 << z);
+
+      for (int row = 0; row < kTileSize_ && !lut.empty(); ++row)
+      {
+         const double mercatorY =
+            std::numbers::pi *
+            (1.0 - 2.0 * (y * kTileSize_ + row + 0.5) / worldSize);
+         const double latitude =
+            std::atan(std::sinh(mercatorY)) * 180.0 / std::numbers::pi;
+
+         uchar* line = image.scanLine(row);
+
+         for (int column = 0; column < kTileSize_; ++column)
+         {
+            const double longitude =
+               (x * kTileSize_ + column + 0.5) / worldSize * 360.0 - 180.0;
+
+            std::optional<std::uint16_t> level =
+               view->GetBinLevel({latitude, longitude});
+
+            if (!level.has_value() || (hideZero && *level == 0u))
+            {
+               continue;
+            }
+
+            // Sample the lookup table as the radar shader does
+            const double texCoord = (*level - lutMin) / lutRange;
+            const auto   index    = static_cast<std::size_t>(std::clamp(
+               texCoord * static_cast<double>(lut.size()),
+               0.0,
+               static_cast<double>(lut.size() - 1)));
+
+            const boost::gil::rgba8_pixel_t& color = lut[index];
+
+            uchar* pixel = line + static_cast<std::ptrdiff_t>(column) * 4;
+            pixel[0]     = color[0];
+            pixel[1]     = color[1];
+            pixel[2]     = color[2];
+            pixel[3]     = color[3];
+         }
+      }
+   }
+
+   QByteArray tile {};
+   QBuffer    buffer {&tile};
+   buffer.open(QIODevice::WriteOnly);
+
+   if (!image.save(&buffer, (format == "webp") ? "WEBP" : "PNG"))
+   {
+      logger_->error("Unable to encode {} tile", format);
+      return std::nullopt;
+   }
+
+   if (cacheable)
+   {
+      std::unique_lock lock {source.cacheMutex_};
+      if (source.cache_.size() >= kMaxCachedTiles_)
+      {
+         source.cache_.clear();
+      }
+      source.cache_.emplace(std::make_tuple(z, x, y, format), tile);
+   }
+
+   return tile;
+}
+
+void TileServerManager::Impl::WriteResponse(QTcpSocket*         socket,
+                                            const TileResponse& response)
+{
+   const std::string header = fmt::format("HTTP/1.1 {}\r\n"
+                                          "Content-Type: {}\r\n"
+                                          "Content-Length: {}\r\n"
+                                          "Access-Control-Allow-Origin: *\r\n"
+                                          "Connection: close\r\n"
+                                          "\r\n",
+                                          response.status_,
+                                          response.contentType_,
+                                          response.body_.size());
+
+   socket->write(header.data(), static_cast<qint64>(header.size()));
+   socket->write(response.body_);
+   socket->disconnectFromHost();
+}
+
+void TileServerManager::Impl::ExpireSources()
+{
+   const auto expiry = std::chrono::steady_clock::now() - kSourceIdleTimeout_;
+
+   for (auto it = sources_.begin(); it != sources_.end();)
+   {
+      if (it->second->lastRequested_ < expiry)
+      {
+         logger_->info("Releasing idle tiles of {} {}",
+                       it->second->radarSite_,
+                       it->second->product_);
+
+         ReleaseSource(*it->second);
+         it = sources_.erase(it);
+      }
+      else
+      {
+         ++it;
+      }
+   }
+}
+
+void TileServerManager::Impl::ReleaseSource(TileSource& source)
+{
+   // Tiles being rendered hold the source until they complete
+   QObject::disconnect(source.newDataConnection_);
+   source.radarProductManager_->EnableRefresh(
+      source.group_, source.view_->GetRadarProductName(), false, uuid_);
+}
+
+void TileServerManager::Impl::ReleaseSources()
+{
+   for (auto& source : sources_)
+   {
+      ReleaseSource(*source.second);
+   }
+
+   sources_.clear();
+}
+
+std::shared_ptr<TileServerManager> TileServerManager::Instance()
+{
+   static std::weak_ptr<TileServerManager> tileServerManagerReference_ {};
+   static std::mutex                       instanceMutex_ {};
+
+   std::unique_lock lock(instanceMutex_);
+
+   std::shared_ptr<TileServerManager> tileServerManager =
+      tileServerManagerReference_.lock();
+
+   if (tileServerManager == nullptr)
+   {
+      tileServerManager           = std::make_shared<TileServerManager>();
+      tileServerManagerReference_ = tileServerManager;
+   }
+
+   return tileServerManager;
+}
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <QHostAddress>
+#include <QObject>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+/**
+ * @brief Serves radar products rendered into XYZ map tiles at
+ * http://<host>:<port>/tiles/<radar site>/<product>/<z>/<x>/<y>.png (or
+ * .webp), so that clients can display radar data without decoding it. Each
+ * radar product is decoded once, refreshed as new data becomes available, and
+ * rendered tiles are cached until the next volume is computed. A limited
+ * number of radar products are decoded at once, and radar products which have
+ * not been requested recently are released.
+ */
+class TileServerManager : public QObject
+{
+   Q_OBJECT
+   Q_DISABLE_COPY_MOVE(TileServerManager)
+
+public:
+   explicit TileServerManager();
+   ~TileServerManager();
+
+   /**
+    * @brief Begins listening for tile requests. Requests are not
+    * authenticated, so tiles are only served to the local machine unless
+    * another address is given.
+    *
+    * @param [in] port TCP port
+    * @param [in] address Address to listen on
+    *
+    * @return true if listening
+    */
+   bool Start(std::uint16_t       port,
+              const QHostAddress& address = QHostAddress::LocalHost);
+
+   /**
+    * @brief Stops listening for requests, and releases radar products.
+    */
+   void Stop();
+
+   static std::shared_ptr<TileServerManager> Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
@@ -5,8 +5,13 @@
 #include <scwx/util/map.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <thread>
 
 #include <boost/asio/post.hpp>
 #include <boost/asio/steady_timer.hpp>
@@ -32,6 +37,14 @@ enum class Direction
 // Wait up to 5 seconds for radar sweeps to update
 static constexpr std::chrono::seconds kRadarSweepMonitorTimeout_ {5};
 
+// Wait up to 15 seconds for loop frames to be prefetched before playing
+static constexpr std::chrono::seconds kPrefetchTimeout_ {15};
+static constexpr std::chrono::milliseconds kPrefetchPollInterval_ {100};
+
+// Weight of the latest frame in the average frame time, used to skip frames
+// when the loop speed cannot be met
+static constexpr double kFrameTimeWeight_ = 0.25;
+
 class TimelineManager::Impl
 {
 public:
@@ -67,6 +80,13 @@ public:
    void RadarSweepMonitorReset();
    void RadarSweepMonitorWait(std::unique_lock<std::mutex>& lock);
 
+   void UpdatePrefetch();
+   void WaitForPrefetch();
+
+   bool ExportLoopSync(const ExportFrameCallback& frameCallback);
+
+   std::chrono::minutes GetFrameStep();
+
    void Pause();
    void Play();
    void PlaySync();
@@ -80,7 +100,8 @@ public:
    boost::asio::thread_pool playThreadPool_ {1};
    boost::asio::thread_pool selectThreadPool_ {1};
 
-   std::size_t                           mapCount_ {0};
+   std::atomic<std::size_t>              mapCount_ {0};
+   std::atomic<std::size_t>              nextMapIndex_ {0};
    std::string                           radarSite_ {"?"};
    std::string                           previousRadarSite_ {"?"};
    std::chrono::system_clock::time_point pinnedTime_ {};
@@ -98,18 +119,68 @@ public:
    std::set<std::size_t>   radarSweepsComplete_ {};
 
    types::AnimationState     animationState_ {types::AnimationState::Pause};
+   std::atomic<bool>         prefetchPending_ {false};
+   std::atomic<bool>         exporting_ {false};
    boost::asio::steady_timer animationTimer_ {playThreadPool_};
    std::mutex                animationTimerMutex_ {};
 
    std::mutex selectTimeMutex_ {};
+
+   // Time of the most recent asynchronous selection that has not yet started.
+   // Selections requested before it starts replace the queued time.
+   struct PendingSelection
+   {
+      std::chrono::system_clock::time_point time_ {};
+   };
+   std::shared_ptr<PendingSelection> pendingSelection_ {};
+   std::mutex                        pendingSelectionMutex_ {};
+
+   // Average time to prepare and present a frame during playback
+   std::chrono::duration<double, std::milli> frameTime_ {0.0};
 };
 
 TimelineManager::TimelineManager() : p(std::make_unique<Impl>(this)) {}
 TimelineManager::~TimelineManager() = default;
 
-void TimelineManager::SetMapCount(std::size_t mapCount)
+std::size_t TimelineManager::RegisterMaps(std::size_t mapCount)
 {
-   p->mapCount_ = mapCount;
+   // Maps of every window are indexed uniquely, and are not reused once a
+   // window is closed
+   p->mapCount_ += mapCount;
+   return p->nextMapIndex_.fetch_add(mapCount);
+}
+
+void TimelineManager::UnregisterMaps(std::size_t mapCount)
+{
+   p->mapCount_ -= mapCount;
+}
+
+void TimelineManager::ExportLoop(ExportFrameCallback    frameCallback,
+                                 ExportFinishedCallback finishedCallback)
+{
+   logger_->debug("ExportLoop");
+
+   p->Pause();
+   p->exporting_ = true;
+
+   // Export on the playback thread, after any step already in progress
+   boost::asio::post(p->playThreadPool_,
+                     [=, this]()
+                     {
+                        bool complete = false;
+
+                        try
+                        {
+                           complete = p->ExportLoopSync(frameCallback);
+                        }
+                        catch (const std::exception& ex)
+                        {
+                           logger_->error(ex.what());
+                        }
+
+                        p->exporting_ = false;
+                        finishedCallback(complete);
+                     });
 }
 
 void TimelineManager::SetRadarSite(const std::string& radarSite)
@@ -122,8 +193,19 @@ void TimelineManager::SetRadarSite(const std::string& radarSite)
 
    logger_->debug("SetRadarSite: {}", radarSite);
 
+   if (p->animationState_ == types::AnimationState::Play)
+   {
+      // Stop prefetching the loop of the previous radar site
+      manager::RadarProductManager::Instance(p->radarSite_)->CancelPrefetch();
+   }
+
    p->radarSite_ = radarSite;
 
+   if (p->animationState_ == types::AnimationState::Play)
+   {
+      p->UpdatePrefetch();
+   }
+
    if (p->viewType_ == types::MapTime::Live)
    {
       // If the selected view type is live, select the current products
@@ -177,6 +259,11 @@ void TimelineManager::SetLoopTime(std::chrono::minutes loopTime)
    logger_->debug("SetLoopTime: {}", loopTime);
 
    p->loopTime_ = loopTime;
+
+   if (p->animationState_ == types::AnimationState::Play)
+   {
+      p->UpdatePrefetch();
+   }
 }
 
 void TimelineManager::SetLoopSpeed(double loopSpeed)
@@ -227,6 +314,13 @@ void TimelineManager::AnimationStepBack()
 
 void TimelineManager::AnimationPlayPause()
 {
+   if (p->exporting_)
+   {
+      // The loop is stepped through by the export
+      logger_->debug("AnimationPlayPause ignored while exporting");
+      return;
+   }
+
    if (p->animationState_ == types::AnimationState::Pause)
    {
       logger_->debug("AnimationPlay");
@@ -318,7 +412,7 @@ void TimelineManager::ReceiveRadarSweepNotUpdated(std::size_t mapIndex,
    p->radarSweepsComplete_.insert(mapIndex);
 
    // If all sweeps have completed rendering
-   if (p->radarSweepsComplete_.size() == p->mapCount_)
+   if (p->radarSweepsComplete_.size() >= p->mapCount_)
    {
       // Notify monitors
       p->radarSweepMonitorActive_ = false;
@@ -343,7 +437,7 @@ void TimelineManager::ReceiveMapWidgetPainted(std::size_t mapIndex)
       p->radarSweepsComplete_.insert(mapIndex);
 
       // If all sweeps have completed rendering
-      if (p->radarSweepsComplete_.size() == p->mapCount_)
+      if (p->radarSweepsComplete_.size() >= p->mapCount_)
       {
          // Notify monitors
          p->radarSweepMonitorActive_ = false;
@@ -411,6 +505,13 @@ void TimelineManager::Impl::Play()
    {
       animationState_ = types::AnimationState::Play;
       Q_EMIT self_->AnimationStateUpdated(animationState_);
+
+      // Measure frame times from the start of playback
+      frameTime_ = {};
+
+      // Start playback once the frames of the loop have been loaded
+      UpdatePrefetch();
+      prefetchPending_ = true;
    }
 
    {
@@ -432,10 +533,97 @@ void TimelineManager::Impl::Play()
                      });
 }
 
+void TimelineManager::Impl::UpdatePrefetch()
+{
+   auto [startTime, endTime] = GetLoopStartAndEndTimes();
+   manager::RadarProductManager::Instance(radarSite_)
+      ->PrefetchLoop(startTime, endTime);
+}
+
+void TimelineManager::Impl::WaitForPrefetch()
+{
+   auto radarProductManager =
+      manager::RadarProductManager::Instance(radarSite_);
+   auto timeout = std::chrono::steady_clock::now() + kPrefetchTimeout_;
+
+   while ((animationState_ == types::AnimationState::Play || exporting_) &&
+          std::chrono::steady_clock::now() < timeout)
+   {
+      auto progress = radarProductManager->prefetch_progress();
+
+      if (progress.has_value() && progress->first >= progress->second)
+      {
+         logger_->debug("Loop frames loaded: {}", progress->second);
+         Q_EMIT self_->LoopFramesLoaded();
+         return;
+      }
+
+      std::this_thread::sleep_for(kPrefetchPollInterval_);
+   }
+
+   logger_->debug("Playing before all loop frames are loaded");
+   Q_EMIT self_->LoopFramesLoaded();
+}
+
+bool TimelineManager::Impl::ExportLoopSync(
+   const ExportFrameCallback& frameCallback)
+{
+   UpdatePrefetch();
+   WaitForPrefetch();
+
+   auto [startTime, endTime] = GetLoopStartAndEndTimes();
+   const auto loopMinutes =
+      std::chrono::floor<std::chrono::minutes>(endTime - startTime);
+   const std::size_t frameCount =
+      static_cast<std::size_t>(loopMinutes.count()) + 1u;
+
+   // Every frame of the loop is exported, without skipping frames
+   for (std::size_t frame = 0; frame < frameCount; ++frame)
+   {
+      const auto time = std::min(
+         startTime + std::chrono::minutes(static_cast<std::int64_t>(frame)),
+         endTime);
+
+      {
+         // Lock radar sweep monitor
+         std::unique_lock radarSweepMonitorLock {radarSweepMonitorMutex_};
+
+         // Reset radar sweep monitor in preparation for update
+         RadarSweepMonitorReset();
+
+         auto [volumeTimeUpdated, selectedTimeUpdated] = SelectTime(time);
+
+         if (volumeTimeUpdated || selectedTimeUpdated)
+         {
+            // Wait for every pane to present the frame
+            RadarSweepMonitorWait(radarSweepMonitorLock);
+         }
+         else
+         {
+            // The frame is unchanged from the previous frame
+            RadarSweepMonitorDisable();
+         }
+      }
+
+      if (!frameCallback(frame, frameCount, time))
+      {
+         logger_->debug("Loop export stopped at frame {}", frame);
+         return false;
+      }
+   }
+
+   return true;
+}
+
 void TimelineManager::Impl::PlaySync()
 {
    using namespace std::chrono_literals;
 
+   if (prefetchPending_.exchange(false))
+   {
+      WaitForPrefetch();
+   }
+
    // Take a lock for time selection
    std::unique_lock lock {selectTimeMutex_};
 
@@ -452,7 +640,7 @@ void TimelineManager::Impl::PlaySync()
    else
    {
       // If the currently selected time is in the loop, increment
-      newTime = currentTime + 1min;
+      newTime = std::min(currentTime + GetFrameStep(), endTime);
    }
 
    // Unlock prior to selecting time
@@ -464,33 +652,48 @@ void TimelineManager::Impl::PlaySync()
    // Reset radar sweep monitor in preparation for update
    RadarSweepMonitorReset();
 
-   // Select the time
-   auto selectTimeStart = std::chrono::steady_clock::now();
+   // Select the time. Each pane computes its sweep on its own thread, so the
+   // panes prepare the frame in parallel.
+   auto stepStart = std::chrono::steady_clock::now();
    SelectTime(newTime);
-   auto selectTimeEnd = std::chrono::steady_clock::now();
-   auto elapsedTime   = selectTimeEnd - selectTimeStart;
 
-   // Wait for radar sweeps to update
+   // Wait for every pane to present the frame
    RadarSweepMonitorWait(radarSweepMonitorLock);
 
-   // Calculate the interval until the next update, prior to selecting
+   // The next step is due one frame interval after this step began, so the
+   // time spent preparing and presenting the frame is part of the interval.
+   // If the slowest pane takes longer than the interval, the next step begins
+   // as soon as this frame is presented.
    std::chrono::milliseconds interval;
    if (newTime != endTime)
    {
       // Determine repeat interval (speed of 1.0 is 1 minute per second)
-      interval = std::chrono::duration_cast<std::chrono::milliseconds>(
-         std::chrono::milliseconds(std::lroundl(1000.0 / loopSpeed_)) -
-         elapsedTime);
+      interval = std::chrono::milliseconds(std::lroundl(1000.0 / loopSpeed_));
    }
    else
    {
       // Pause at the end of the loop
-      interval = std::chrono::duration_cast<std::chrono::milliseconds>(
-         loopDelay_ - elapsedTime);
+      interval = loopDelay_;
    }
 
+   const auto stepEnd = std::chrono::steady_clock::now();
+   SPDLOG_LOGGER_TRACE(
+      logger_,
+      "Frame presented in {}",
+      std::chrono::duration_cast<std::chrono::milliseconds>(stepEnd -
+                                                            stepStart));
+
+   // Update the average frame time
+   const std::chrono::duration<double, std::milli> frameTime =
+      stepEnd - stepStart;
+   frameTime_ = (frameTime_.count() == 0.0) ?
+                   frameTime :
+                   frameTime_ + (frameTime - frameTime_) * kFrameTimeWeight_;
+
    std::unique_lock animationTimerLock {animationTimerMutex_};
-   animationTimer_.expires_after(interval);
+   animationTimer_.expires_at(
+      std::max<std::chrono::steady_clock::time_point>(stepStart + interval,
+                                                      stepEnd));
    animationTimer_.async_wait(
       [this](const boost::system::error_code& e)
       {
@@ -512,15 +715,63 @@ void TimelineManager::Impl::PlaySync()
       });
 }
 
+std::chrono::minutes TimelineManager::Impl::GetFrameStep()
+{
+   using namespace std::chrono_literals;
+
+   if (!settings::GeneralSettings::Instance().loop_frame_skip().GetValue())
+   {
+      return 1min;
+   }
+
+   // If frames take longer to prepare and present than the loop speed allows,
+   // skip intermediate frames to keep the loop in real time
+   const std::chrono::duration<double, std::milli> interval {1000.0 /
+                                                            loopSpeed_};
+   const auto frames =
+      static_cast<std::int64_t>(std::ceil(frameTime_ / interval));
+   const std::chrono::minutes step {std::max<std::int64_t>(frames, 1)};
+
+   if (step > 1min)
+   {
+      SPDLOG_LOGGER_TRACE(logger_, "Skipping frames, step: {}", step);
+   }
+
+   return step;
+}
+
 void TimelineManager::Impl::SelectTimeAsync(
    std::chrono::system_clock::time_point selectedTime)
 {
+   std::unique_lock lock {pendingSelectionMutex_};
+
+   if (pendingSelection_ != nullptr)
+   {
+      // A selection is already queued, such as while the date/time is being
+      // scrolled. Select only the latest time once it starts.
+      pendingSelection_->time_ = selectedTime;
+      return;
+   }
+
+   auto selection    = std::make_shared<PendingSelection>();
+   selection->time_  = selectedTime;
+   pendingSelection_ = selection;
+
    boost::asio::post(selectThreadPool_,
                      [=, this]()
                      {
+                        std::unique_lock selectionLock {
+                           pendingSelectionMutex_};
+                        if (pendingSelection_ == selection)
+                        {
+                           pendingSelection_.reset();
+                        }
+                        const auto time = selection->time_;
+                        selectionLock.unlock();
+
                         try
                         {
-                           SelectTime(selectedTime);
+                           SelectTime(time);
                         }
                         catch (const std::exception& ex)
                         {
@@ -598,8 +849,9 @@ std::pair<bool, bool> TimelineManager::Impl::SelectTime(
                     scwx::util::TimeString(selectedTime));
    }
 
-   logger_->trace("Selected time updated: {}",
-                  scwx::util::TimeString(selectedTime));
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Selected time updated: {}",
+                       scwx::util::TimeString(selectedTime));
 
    selectedTime_       = selectedTime;
    selectedTimeUpdated = true;
@@ -612,6 +864,12 @@ std::pair<bool, bool> TimelineManager::Impl::SelectTime(
 
 void TimelineManager::Impl::StepAsync(Direction direction)
 {
+   {
+      // Selections requested after the step are queued after it
+      std::unique_lock lock {pendingSelectionMutex_};
+      pendingSelection_.reset();
+   }
+
    boost::asio::post(selectThreadPool_,
                      [=, this]()
                      {
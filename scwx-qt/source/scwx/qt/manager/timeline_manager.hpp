@@ -3,6 +3,7 @@
 #include <scwx/qt/types/map_types.hpp>
 
 #include <chrono>
+#include <functional>
 #include <memory>
 
 #include <QObject>
@@ -19,12 +20,56 @@ class TimelineManager : public QObject
    Q_OBJECT
 
 public:
+   /**
+    * @brief Receives a frame of a loop being exported, once it has been
+    * painted by every map.
+    *
+    * @return Whether to continue exporting the loop
+    */
+   typedef std::function<bool(std::size_t                           frame,
+                              std::size_t                           frameCount,
+                              std::chrono::system_clock::time_point time)>
+      ExportFrameCallback;
+
+   /**
+    * @brief Receives the result of a loop export, whether each frame was
+    * exported.
+    */
+   typedef std::function<void(bool complete)> ExportFinishedCallback;
+
    explicit TimelineManager();
    ~TimelineManager();
 
    static std::shared_ptr<TimelineManager> Instance();
 
-   void SetMapCount(std::size_t mapCount);
+   /**
+    * @brief Registers the maps of a window, which present each step of the
+    * animation.
+    *
+    * @param [in] mapCount Number of maps
+    *
+    * @return Index of the first map, with the maps indexed consecutively
+    */
+   std::size_t RegisterMaps(std::size_t mapCount);
+
+   /**
+    * @brief Unregisters the maps of a window, once they no longer present
+    * steps of the animation.
+    *
+    * @param [in] mapCount Number of maps
+    */
+   void UnregisterMaps(std::size_t mapCount);
+
+   /**
+    * @brief Pauses the animation, and steps through each frame of the loop,
+    * once the frames of the loop have been loaded. Callbacks are invoked on
+    * the playback thread.
+    *
+    * @param [in] frameCallback Receives each frame of the loop
+    * @param [in] finishedCallback Receives the result of the export
+    */
+   void ExportLoop(ExportFrameCallback    frameCallback,
+                   ExportFinishedCallback finishedCallback);
 
 public slots:
    void SetRadarSite(const std::string& radarSite);
@@ -55,6 +100,12 @@ signals:
    void LiveStateUpdated(bool isLive);
    void ViewTypeUpdated(types::MapTime viewType);
 
+   /**
+    * @brief Emitted once the frames of the loop have been loaded before
+    * playing or exporting, or loading has timed out.
+    */
+   void LoopFramesLoaded();
+
 private:
    class Impl;
    std::unique_ptr<Impl> p;
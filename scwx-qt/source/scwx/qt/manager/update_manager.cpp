@@ -1,4 +1,5 @@
 #include <scwx/qt/manager/update_manager.hpp>
+#include <scwx/network/cpr.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <mutex>
@@ -139,11 +140,11 @@ size_t UpdateManager::Impl::PopulateReleases()
    {
       const std::string pageString {fmt::format("{}", page)};
 
-      cpr::Response r = cpr::Get(
+      cpr::Response r = network::cpr::Get(
          cpr::Url {kScwxReleaseEndpoint},
-         cpr::Parameters {{"per_page", perPageString}, {"page", pageString}},
          cpr::Header {{"accept", "application/vnd.github+json"},
-                      {"X-GitHub-Api-Version", "2022-11-28"}});
+                      {"X-GitHub-Api-Version", "2022-11-28"}},
+         cpr::Parameters {{"per_page", perPageString}, {"page", pageString}});
 
       // Successful REST API query
       if (r.status_code == 200)
@@ -6,7 +6,9 @@
 #include <scwx/qt/util/color.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/strand.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <mutex>
 #include <ranges>
@@ -15,7 +17,6 @@
 
 #include <boost/algorithm/string/join.hpp>
 #include <boost/asio/system_timer.hpp>
-#include <boost/asio/thread_pool.hpp>
 #include <boost/container/stable_vector.hpp>
 #include <boost/container_hash/hash.hpp>
 #include <QEvent>
@@ -144,7 +145,7 @@ public:
       refreshTimer_.cancel();
       refreshLock.unlock();
 
-      threadPool_.join();
+      strand_.Join();
 
       receiver_ = nullptr;
 
@@ -189,11 +190,11 @@ public:
 
    static LineData CreateLineData(const settings::LineSettings& lineSettings);
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::Strand strand_ {"Alert Layer"};
 
    AlertLayer* self_;
 
-   boost::asio::system_timer refreshTimer_ {threadPool_};
+   boost::asio::system_timer refreshTimer_ {strand_.get_executor()};
    std::mutex                refreshMutex_;
 
    const awips::Phenomenon                   phenomenon_;
@@ -320,7 +321,7 @@ bool IsAlertActive(const std::shared_ptr<const awips::Segment>& segment)
 void AlertLayerHandler::HandleAlert(const types::TextEventKey& key,
                                     size_t                     messageIndex)
 {
-   logger_->trace("HandleAlert: {}", key.ToString());
+   SPDLOG_LOGGER_TRACE(logger_, "HandleAlert: {}", key.ToString());
 
    std::unordered_set<std::pair<awips::Phenomenon, bool>,
                       AlertTypeHash<std::pair<awips::Phenomenon, bool>>>
@@ -338,11 +339,22 @@ void AlertLayerHandler::HandleAlert(const types::TextEventKey& key,
    // Take a unique mutex before modifying segments
    std::unique_lock lock {alertMutex_};
 
+   // Each message of an event supersedes the polygons of the messages before
+   // it. Messages are not always received in order, so the new segments end
+   // when any later message already received begins.
+   std::chrono::system_clock::time_point supersededTime =
+      std::chrono::system_clock::time_point::max();
+
    // Update any existing segments with new end time
    auto& segmentsForKey = segmentsByKey_[key];
    for (auto& segmentRecord : segmentsForKey)
    {
-      if (segmentRecord->segmentEnd_ > segmentBegin)
+      if (segmentRecord->segmentBegin_ > segmentBegin)
+      {
+         supersededTime =
+            std::min(supersededTime, segmentRecord->segmentBegin_);
+      }
+      else if (segmentRecord->segmentEnd_ > segmentBegin)
       {
          segmentRecord->segmentEnd_ = segmentBegin;
 
@@ -368,6 +380,8 @@ void AlertLayerHandler::HandleAlert(const types::TextEventKey& key,
       // Insert segment into lists
       std::shared_ptr<SegmentRecord> segmentRecord =
          std::make_shared<SegmentRecord>(segment, key, message);
+      segmentRecord->segmentEnd_ =
+         std::min(segmentRecord->segmentEnd_, supersededTime);
 
       segmentsForKey.push_back(segmentRecord);
       segmentsForType.push_back(segmentRecord);
@@ -451,7 +465,7 @@ void AlertLayer::Impl::ScheduleRefresh()
          std::chrono::system_clock::now());
    refreshTimer_.expires_at(now + 1min);
 
-   refreshTimer_.async_wait(
+   refreshTimer_.async_wait(strand_.Wrap(
       [this](const boost::system::error_code& e)
       {
          if (e == boost::asio::error::operation_aborted)
@@ -467,7 +481,7 @@ void AlertLayer::Impl::ScheduleRefresh()
             Q_EMIT self_->NeedsRendering();
             ScheduleRefresh();
          }
-      });
+      }));
 }
 
 void AlertLayer::Impl::AddAlert(
@@ -34,7 +34,8 @@ public:
        vao_ {GL_INVALID_INDEX},
        texture_ {GL_INVALID_INDEX},
        colorTable_ {},
-       colorTableNeedsUpdate_ {true}
+       colorTableNeedsUpdate_ {true},
+       width_ {0}
    {
    }
    ~ColorTableLayerImpl() = default;
@@ -49,6 +50,7 @@ public:
    std::vector<boost::gil::rgba8_pixel_t> colorTable_;
 
    bool colorTableNeedsUpdate_;
+   int  width_;
 };
 
 ColorTableLayer::ColorTableLayer(std::shared_ptr<MapContext> context) :
@@ -158,28 +160,40 @@ void ColorTableLayer::Render(
       gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
       gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
       gl.glGenerateMipmap(GL_TEXTURE_1D);
+
+      p->colorTableNeedsUpdate_ = false;
    }
 
    if (p->colorTable_.size() > 0 && radarProductView->sweep_time() !=
                                        std::chrono::system_clock::time_point())
    {
-      // Color table panel vertices
-      const float vertexLX       = 0.0f;
-      const float vertexRX       = static_cast<float>(params.width);
-      const float vertexTY       = 10.0f;
-      const float vertexBY       = 0.0f;
-      const float vertices[6][2] = {{vertexLX, vertexTY}, // TL
-                                    {vertexLX, vertexBY}, // BL
-                                    {vertexRX, vertexTY}, // TR
-                                    //
-                                    {vertexLX, vertexBY},  // BL
-                                    {vertexRX, vertexTY},  // TR
-                                    {vertexRX, vertexBY}}; // BR
+      gl.glBindVertexArray(p->vao_);
+
+      // The panel vertices only change with the width of the map
+      if (p->width_ != params.width)
+      {
+         // Color table panel vertices
+         const float vertexLX       = 0.0f;
+         const float vertexRX       = static_cast<float>(params.width);
+         const float vertexTY       = 10.0f;
+         const float vertexBY       = 0.0f;
+         const float vertices[6][2] = {{vertexLX, vertexTY}, // TL
+                                       {vertexLX, vertexBY}, // BL
+                                       {vertexRX, vertexTY}, // TR
+                                       //
+                                       {vertexLX, vertexBY},  // BL
+                                       {vertexRX, vertexTY},  // TR
+                                       {vertexRX, vertexBY}}; // BR
+
+         gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
+         gl.glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
+
+         p->width_ = params.width;
+      }
 
       // Draw vertices
-      gl.glBindVertexArray(p->vao_);
-      gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
-      gl.glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
+      gl.glActiveTexture(GL_TEXTURE0);
+      gl.glBindTexture(GL_TEXTURE_1D, p->texture_);
       gl.glDrawArrays(GL_TRIANGLES, 0, 6);
 
       context()->set_color_table_margins(QMargins {0, 0, 0, 10});
@@ -206,6 +220,7 @@ void ColorTableLayer::Deinitialize()
    p->vao_                = GL_INVALID_INDEX;
    p->vbo_                = {GL_INVALID_INDEX};
    p->texture_            = GL_INVALID_INDEX;
+   p->width_              = 0;
 
    context()->set_color_table_margins(QMargins {});
 }
@@ -1,4 +1,5 @@
 #include <scwx/qt/map/draw_layer.hpp>
+#include <scwx/qt/gl/scaled_framebuffer.hpp>
 #include <scwx/qt/gl/shader_program.hpp>
 #include <scwx/util/logger.hpp>
 
@@ -26,6 +27,9 @@ public:
    GLuint                                           textureAtlas_;
 
    std::uint64_t textureAtlasBuildCount_ {};
+
+   bool                  dynamicResolutionEnabled_ {false};
+   gl::ScaledFramebuffer scaledFramebuffer_ {};
 };
 
 DrawLayer::DrawLayer(const std::shared_ptr<MapContext>& context) :
@@ -42,6 +46,11 @@ void DrawLayer::Initialize()
    {
       item->Initialize();
    }
+
+   if (p->dynamicResolutionEnabled_)
+   {
+      p->scaledFramebuffer_.Initialize(*p->context_);
+   }
 }
 
 void DrawLayer::Render(const QMapLibre::CustomLayerRenderParameters& params)
@@ -58,14 +67,23 @@ void DrawLayer::Render(const QMapLibre::CustomLayerRenderParameters& params)
    // Set OpenGL blend mode for transparency
    gl.glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-   gl.glActiveTexture(GL_TEXTURE0);
-   gl.glBindTexture(GL_TEXTURE_2D_ARRAY, p->textureAtlas_);
+   const bool scaled =
+      p->dynamicResolutionEnabled_ &&
+      p->scaledFramebuffer_.Begin(*p->context_, p->context_->render_scale());
+
+   p->context_->state_cache().BindTexture(
+      GL_TEXTURE0, GL_TEXTURE_2D_ARRAY, p->textureAtlas_);
 
    for (auto& item : p->drawList_)
    {
       item->Render(params, textureAtlasChanged);
    }
 
+   if (scaled)
+   {
+      p->scaledFramebuffer_.End(*p->context_);
+   }
+
    p->textureAtlasBuildCount_ = newTextureAtlasBuildCount;
 }
 
@@ -77,6 +95,11 @@ void DrawLayer::Deinitialize()
    {
       item->Deinitialize();
    }
+
+   if (p->dynamicResolutionEnabled_)
+   {
+      p->scaledFramebuffer_.Deinitialize(*p->context_);
+   }
 }
 
 bool DrawLayer::RunMousePicking(
@@ -114,6 +137,11 @@ void DrawLayer::AddDrawItem(const std::shared_ptr<gl::draw::DrawItem>& drawItem)
    p->drawList_.push_back(drawItem);
 }
 
+void DrawLayer::EnableDynamicResolution()
+{
+   p->dynamicResolutionEnabled_ = true;
+}
+
 } // namespace map
 } // namespace qt
 } // namespace scwx
@@ -33,6 +33,12 @@ public:
 protected:
    void AddDrawItem(const std::shared_ptr<gl::draw::DrawItem>& drawItem);
 
+   /**
+    * Renders the draw items at the render scale of the map context, which is
+    * reduced while the map is in motion. Must be called before Initialize().
+    */
+   void EnableDynamicResolution();
+
 private:
    std::unique_ptr<DrawLayerImpl> p;
 };
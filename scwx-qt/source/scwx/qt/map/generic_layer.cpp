@@ -18,6 +18,9 @@ public:
    ~GenericLayerImpl() {}
 
    std::shared_ptr<MapContext> context_;
+
+   bool initialized_ {false};
+   bool retained_ {false};
 };
 
 GenericLayer::GenericLayer(std::shared_ptr<MapContext> context) :
@@ -43,6 +46,39 @@ std::shared_ptr<MapContext> GenericLayer::context() const
    return p->context_;
 }
 
+bool GenericLayer::is_initialized() const
+{
+   return p->initialized_;
+}
+
+bool GenericLayer::is_retained() const
+{
+   return p->retained_;
+}
+
+void GenericLayer::set_retained(bool retained)
+{
+   p->retained_ = retained;
+}
+
+void GenericLayer::EnsureInitialized()
+{
+   if (!p->initialized_)
+   {
+      Initialize();
+      p->initialized_ = true;
+   }
+}
+
+void GenericLayer::EnsureDeinitialized()
+{
+   if (p->initialized_)
+   {
+      Deinitialize();
+      p->initialized_ = false;
+   }
+}
+
 } // namespace map
 } // namespace qt
 } // namespace scwx
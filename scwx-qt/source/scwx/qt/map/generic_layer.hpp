@@ -51,12 +51,37 @@ public:
                    const common::Coordinate&                     mouseGeoCoords,
                    std::shared_ptr<types::EventHandler>&         eventHandler);
 
+   std::shared_ptr<MapContext> context() const;
+
+   /**
+    * @brief Whether the layer is initialized
+    */
+   bool is_initialized() const;
+
+   /**
+    * @brief Whether the layer remains initialized when it is removed from the
+    * map, such that it can be added again without initializing it again. A
+    * retained layer is deinitialized by its owner.
+    */
+   bool is_retained() const;
+
+   void set_retained(bool retained);
+
+   /**
+    * @brief Initializes the layer, unless it is already initialized. The
+    * OpenGL context of the map must be current.
+    */
+   void EnsureInitialized();
+
+   /**
+    * @brief Deinitializes the layer, if it is initialized. The OpenGL context
+    * of the map must be current.
+    */
+   void EnsureDeinitialized();
+
 signals:
    void NeedsRendering();
 
-protected:
-   std::shared_ptr<MapContext> context() const;
-
 private:
    std::unique_ptr<GenericLayerImpl> p;
 };
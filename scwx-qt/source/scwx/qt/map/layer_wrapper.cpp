@@ -1,4 +1,10 @@
 #include <scwx/qt/map/layer_wrapper.hpp>
+#include <scwx/qt/gl/gl.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/profiler.hpp>
+
+#include <algorithm>
+#include <array>
 
 namespace scwx
 {
@@ -7,21 +13,59 @@ namespace qt
 namespace map
 {
 
+static const std::string logPrefix_ = "scwx::qt::map::layer_wrapper";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// GPU timer queries are read a few frames after they are issued, to avoid
+// stalling the pipeline
+static constexpr std::size_t kGpuQueryCount_ = 4u;
+
+// Interval between GPU time log messages for each layer
+static constexpr std::chrono::seconds kGpuLogInterval_ {10};
+
 class LayerWrapperImpl
 {
 public:
-   explicit LayerWrapperImpl(std::shared_ptr<GenericLayer> layer) :
-       layer_ {layer}
+   struct GpuQuery
+   {
+      GLuint                                query_ {};
+      std::chrono::steady_clock::time_point begin_ {};
+      bool                                  pending_ {false};
+   };
+
+   explicit LayerWrapperImpl(std::shared_ptr<GenericLayer> layer,
+                             const std::string&            name) :
+       layer_ {layer},
+       name_ {name},
+       profileLabel_ {scwx::util::Profiler::RegisterLabel(name)}
    {
    }
 
    ~LayerWrapperImpl() {}
 
+   void ResetState();
+
+   GpuQuery* BeginGpuQuery(gl::OpenGLFunctions& gl);
+   void      ReadGpuQueries(gl::OpenGLFunctions& gl);
+   void      DeleteGpuQueries(gl::OpenGLFunctions& gl);
+
    std::shared_ptr<GenericLayer> layer_;
+   const std::string             name_;
+   const std::uint16_t           profileLabel_;
+
+   std::array<GpuQuery, kGpuQueryCount_> gpuQueries_ {};
+   std::size_t                           nextGpuQuery_ {0u};
+   bool                                  gpuQueriesCreated_ {false};
+
+   std::chrono::nanoseconds              gpuTimeTotal_ {};
+   std::chrono::nanoseconds              gpuTimeMax_ {};
+   std::size_t                           gpuFrameCount_ {0u};
+   std::chrono::steady_clock::time_point gpuLogTime_ {};
 };
 
-LayerWrapper::LayerWrapper(std::shared_ptr<GenericLayer> layer) :
-    p(std::make_unique<LayerWrapperImpl>(layer))
+LayerWrapper::LayerWrapper(std::shared_ptr<GenericLayer> layer,
+                           const std::string&            name) :
+    p(std::make_unique<LayerWrapperImpl>(layer, name))
 {
 }
 LayerWrapper::~LayerWrapper() = default;
@@ -34,7 +78,11 @@ void LayerWrapper::initialize()
    auto& layer = p->layer_;
    if (layer != nullptr)
    {
-      layer->Initialize();
+      p->ResetState();
+
+      // A retained layer may already be initialized, if it was previously
+      // added to the map
+      layer->EnsureInitialized();
    }
 }
 
@@ -43,7 +91,27 @@ void LayerWrapper::render(const QMapLibre::CustomLayerRenderParameters& params)
    auto& layer = p->layer_;
    if (layer != nullptr)
    {
+      scwx::util::ScopedTimer timer {scwx::util::ProfileStage::LayerRender,
+                                     p->profileLabel_};
+
+      // GPU time is only measured while profiling
+      auto                        context  = layer->context();
+      gl::OpenGLFunctions*        gl       = nullptr;
+      LayerWrapperImpl::GpuQuery* gpuQuery = nullptr;
+      if (context != nullptr && scwx::util::Profiler::IsEnabled())
+      {
+         gl = &context->gl();
+         p->ReadGpuQueries(*gl);
+         gpuQuery = p->BeginGpuQuery(*gl);
+      }
+
+      p->ResetState();
       layer->Render(params);
+
+      if (gpuQuery != nullptr)
+      {
+         gl->glEndQuery(GL_TIME_ELAPSED);
+      }
    }
 }
 
@@ -53,11 +121,137 @@ void LayerWrapper::deinitialize()
    auto& layer = p->layer_;
    if (layer != nullptr)
    {
-      layer->Deinitialize();
+      p->ResetState();
+
+      auto context = layer->context();
+      if (context != nullptr)
+      {
+         p->DeleteGpuQueries(context->gl());
+      }
+
+      // A retained layer is deinitialized by its owner, such that it can be
+      // added to the map again without initializing it again
+      if (!layer->is_retained())
+      {
+         layer->EnsureDeinitialized();
+      }
       layer = nullptr;
    }
 }
 
+void LayerWrapperImpl::ResetState()
+{
+   // OpenGL state may have been modified by the map since the last layer
+   auto context = layer_->context();
+   if (context != nullptr)
+   {
+      context->state_cache().Reset();
+   }
+}
+
+LayerWrapperImpl::GpuQuery*
+LayerWrapperImpl::BeginGpuQuery(gl::OpenGLFunctions& gl)
+{
+   if (!gpuQueriesCreated_)
+   {
+      std::array<GLuint, kGpuQueryCount_> queries {};
+      gl.glGenQueries(static_cast<GLsizei>(queries.size()), queries.data());
+
+      for (std::size_t i = 0; i < kGpuQueryCount_; ++i)
+      {
+         gpuQueries_[i].query_ = queries[i];
+      }
+      gpuQueriesCreated_ = true;
+   }
+
+   GpuQuery& query = gpuQueries_[nextGpuQuery_];
+   if (query.pending_)
+   {
+      // The GPU is more than the query count behind, skip this frame
+      return nullptr;
+   }
+
+   nextGpuQuery_ = (nextGpuQuery_ + 1) % kGpuQueryCount_;
+
+   query.begin_   = std::chrono::steady_clock::now();
+   query.pending_ = true;
+   gl.glBeginQuery(GL_TIME_ELAPSED, query.query_);
+
+   return &query;
+}
+
+void LayerWrapperImpl::ReadGpuQueries(gl::OpenGLFunctions& gl)
+{
+   for (std::size_t i = 0; i < kGpuQueryCount_; ++i)
+   {
+      // Read the oldest queries first
+      GpuQuery& query = gpuQueries_[(nextGpuQuery_ + i) % kGpuQueryCount_];
+      if (!query.pending_)
+      {
+         continue;
+      }
+
+      GLint available = GL_FALSE;
+      gl.glGetQueryObjectiv(
+         query.query_, GL_QUERY_RESULT_AVAILABLE, &available);
+      if (available == GL_FALSE)
+      {
+         // Later queries are not yet available either
+         break;
+      }
+
+      GLuint64 elapsed = 0u;
+      gl.glGetQueryObjectui64v(query.query_, GL_QUERY_RESULT, &elapsed);
+      query.pending_ = false;
+
+      const std::chrono::nanoseconds duration {elapsed};
+
+      scwx::util::Profiler::Record(scwx::util::ProfileStage::GpuLayerRender,
+                                   profileLabel_,
+                                   query.begin_,
+                                   query.begin_ + duration);
+
+      gpuTimeTotal_ += duration;
+      gpuTimeMax_ = std::max(gpuTimeMax_, duration);
+      ++gpuFrameCount_;
+   }
+
+   const auto now = std::chrono::steady_clock::now();
+   if (gpuFrameCount_ > 0 && now - gpuLogTime_ >= kGpuLogInterval_)
+   {
+      using Milliseconds = std::chrono::duration<double, std::milli>;
+
+      logger_->debug("{} GPU time: mean {:.3f} ms, max {:.3f} ms ({} frames)",
+                     name_,
+                     Milliseconds(gpuTimeTotal_).count() /
+                        static_cast<double>(gpuFrameCount_),
+                     Milliseconds(gpuTimeMax_).count(),
+                     gpuFrameCount_);
+
+      gpuTimeTotal_  = {};
+      gpuTimeMax_    = {};
+      gpuFrameCount_ = 0u;
+      gpuLogTime_    = now;
+   }
+}
+
+void LayerWrapperImpl::DeleteGpuQueries(gl::OpenGLFunctions& gl)
+{
+   if (!gpuQueriesCreated_)
+   {
+      return;
+   }
+
+   for (auto& query : gpuQueries_)
+   {
+      gl.glDeleteQueries(1, &query.query_);
+      query = {};
+   }
+
+   nextGpuQuery_      = 0u;
+   gpuQueriesCreated_ = false;
+}
+
 } // namespace map
 } // namespace qt
 } // namespace scwx
@@ -14,7 +14,13 @@ class LayerWrapperImpl;
 class LayerWrapper : public QMapLibre::CustomLayerHostInterface
 {
 public:
-   explicit LayerWrapper(std::shared_ptr<GenericLayer> layer);
+   /**
+    * @param layer Layer to render
+    * @param name Name of the layer, used to label profiler samples and GPU
+    * timing log messages
+    */
+   explicit LayerWrapper(std::shared_ptr<GenericLayer> layer,
+                         const std::string&            name = {});
    ~LayerWrapper();
 
    LayerWrapper(const LayerWrapper&)            = delete;
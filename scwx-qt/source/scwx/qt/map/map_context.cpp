@@ -28,12 +28,14 @@ public:
    std::string                            radarProduct_ {"???"};
    int16_t                                radarProductCode_ {0};
    QMapLibre::CustomLayerRenderParameters renderParameters_ {};
+   float                                  renderScale_ {1.0f};
 
    MapProvider mapProvider_ {MapProvider::Unknown};
    std::string mapCopyrights_ {};
 
-   QMargins           colorTableMargins_ {};
-   common::Coordinate mouseCoordinate_ {};
+   QMargins              colorTableMargins_ {};
+   common::Coordinate    mouseCoordinate_ {};
+   types::ProductLatency productLatency_ {};
 
    std::shared_ptr<view::OverlayProductView> overlayProductView_ {nullptr};
    std::shared_ptr<view::RadarProductView>   radarProductView_;
@@ -95,6 +97,11 @@ std::shared_ptr<view::RadarProductView> MapContext::radar_product_view() const
    return p->radarProductView_;
 }
 
+types::ProductLatency MapContext::product_latency() const
+{
+   return p->productLatency_;
+}
+
 common::RadarProductGroup MapContext::radar_product_group() const
 {
    return p->radarProductGroup_;
@@ -115,6 +122,11 @@ QMapLibre::CustomLayerRenderParameters MapContext::render_parameters() const
    return p->renderParameters_;
 }
 
+float MapContext::render_scale() const
+{
+   return p->renderScale_;
+}
+
 void MapContext::set_map(const std::shared_ptr<QMapLibre::Map>& map)
 {
    p->map_ = map;
@@ -151,6 +163,11 @@ void MapContext::set_pixel_ratio(float pixelRatio)
    p->pixelRatio_ = pixelRatio;
 }
 
+void MapContext::set_product_latency(const types::ProductLatency& latency)
+{
+   p->productLatency_ = latency;
+}
+
 void MapContext::set_radar_product_view(
    const std::shared_ptr<view::RadarProductView>& radarProductView)
 {
@@ -179,6 +196,11 @@ void MapContext::set_render_parameters(
    p->renderParameters_ = params;
 }
 
+void MapContext::set_render_scale(float renderScale)
+{
+   p->renderScale_ = renderScale;
+}
+
 } // namespace map
 } // namespace qt
 } // namespace scwx
@@ -2,6 +2,7 @@
 
 #include <scwx/qt/gl/gl_context.hpp>
 #include <scwx/qt/map/map_provider.hpp>
+#include <scwx/qt/types/latency_types.hpp>
 #include <scwx/common/geographic.hpp>
 #include <scwx/common/products.hpp>
 
@@ -46,11 +47,13 @@ public:
    float                                     pixel_ratio() const;
    common::Coordinate                        mouse_coordinate() const;
    std::shared_ptr<view::OverlayProductView> overlay_product_view() const;
+   types::ProductLatency                     product_latency() const;
    std::shared_ptr<view::RadarProductView>   radar_product_view() const;
    common::RadarProductGroup                 radar_product_group() const;
    std::string                               radar_product() const;
    int16_t                                   radar_product_code() const;
    QMapLibre::CustomLayerRenderParameters    render_parameters() const;
+   float                                     render_scale() const;
 
    void set_map(const std::shared_ptr<QMapLibre::Map>& map);
    void set_map_copyrights(const std::string& copyrights);
@@ -60,6 +63,7 @@ public:
    void set_overlay_product_view(
       const std::shared_ptr<view::OverlayProductView>& overlayProductView);
    void set_pixel_ratio(float pixelRatio);
+   void set_product_latency(const types::ProductLatency& latency);
    void set_radar_product_view(
       const std::shared_ptr<view::RadarProductView>& radarProductView);
    void set_radar_product_group(common::RadarProductGroup radarProductGroup);
@@ -67,6 +71,7 @@ public:
    void set_radar_product_code(int16_t radarProductCode);
    void
    set_render_parameters(const QMapLibre::CustomLayerRenderParameters& params);
+   void set_render_scale(float renderScale);
 
 private:
    class Impl;
@@ -0,0 +1,436 @@
+#include <scwx/qt/map/map_prefetcher.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <numbers>
+
+#include <QOffscreenSurface>
+#include <QOpenGLContext>
+#include <QOpenGLFramebufferObject>
+#include <QTimer>
+
+namespace scwx
+{
+namespace qt
+{
+namespace map
+{
+
+static const std::string logPrefix_ = "scwx::qt::map::map_prefetcher";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Number of hidden maps rendered concurrently
+static constexpr std::size_t kMaxConcurrency_ = 2u;
+
+// Size of each hidden map, in pixels
+static const QSize kViewportSize_ {1024, 1024};
+
+// Width of a tile at zoom level 0, in pixels
+static constexpr double kTileSize_ = 512.0;
+
+// Latitude limit of the web mercator projection (degrees)
+static constexpr double kMaxLatitude_ = 85.0511;
+
+static constexpr double kEarthRadiusKm_ = 6371.0088;
+
+// Wait up to 30 seconds for a view to be completely rendered
+static constexpr std::chrono::seconds kViewTimeout_ {30};
+
+struct PrefetchView
+{
+   QMapLibre::Coordinate coordinate_ {};
+   double                zoom_ {};
+};
+
+struct PrefetchWorker
+{
+   std::unique_ptr<QMapLibre::Map>           map_ {};
+   std::unique_ptr<QOpenGLFramebufferObject> framebuffer_ {};
+   QTimer                                    timeoutTimer_ {};
+
+   bool styleLoaded_ {false};
+   bool viewActive_ {false};
+   bool renderPending_ {false};
+   bool finished_ {false};
+};
+
+class MapPrefetcher::Impl
+{
+public:
+   explicit Impl(MapPrefetcher* self, const QMapLibre::Settings& settings) :
+       self_ {self}, settings_ {settings}
+   {
+   }
+   ~Impl() { DestroyWorkers(); }
+
+   bool CreateContext();
+   void CreateWorker(const QString& styleUrl);
+   void DestroyWorkers();
+   void FinishView(PrefetchWorker* worker, bool rendered);
+   void FinishWorker(PrefetchWorker* worker);
+   void NextView(PrefetchWorker* worker);
+   void Render(PrefetchWorker* worker);
+
+   static std::deque<PrefetchView>
+   GetViews(const std::vector<MapPrefetchRegion>& regions);
+
+   MapPrefetcher*      self_;
+   QMapLibre::Settings settings_;
+
+   std::unique_ptr<QOffscreenSurface> surface_ {};
+   std::unique_ptr<QOpenGLContext>    context_ {};
+
+   std::vector<std::shared_ptr<PrefetchWorker>> workers_ {};
+   std::size_t                                  activeWorkers_ {0u};
+
+   std::deque<PrefetchView> views_ {};
+   std::size_t              totalViews_ {0u};
+   std::size_t              completedViews_ {0u};
+   std::size_t              failedViews_ {0u};
+
+   bool running_ {false};
+   bool cancelled_ {false};
+};
+
+MapPrefetcher::MapPrefetcher(const QMapLibre::Settings& settings,
+                             QObject*                   parent) :
+    QObject(parent), p {std::make_unique<Impl>(this, settings)}
+{
+}
+
+MapPrefetcher::~MapPrefetcher() = default;
+
+bool MapPrefetcher::is_running() const
+{
+   return p->running_;
+}
+
+std::size_t MapPrefetcher::failed_count() const
+{
+   return p->failedViews_;
+}
+
+void MapPrefetcher::Start(const QString&                        styleUrl,
+                          const std::vector<MapPrefetchRegion>& regions)
+{
+   if (p->running_)
+   {
+      logger_->warn("Map tiles are already being prefetched");
+      return;
+   }
+
+   p->DestroyWorkers();
+
+   p->views_          = Impl::GetViews(regions);
+   p->totalViews_     = p->views_.size();
+   p->completedViews_ = 0u;
+   p->failedViews_    = 0u;
+   p->cancelled_      = false;
+
+   logger_->info("Prefetching {} map views", p->totalViews_);
+
+   Q_EMIT ProgressUpdated(0u, p->totalViews_);
+
+   if (p->views_.empty() || !p->CreateContext())
+   {
+      Q_EMIT Finished(p->views_.empty());
+      return;
+   }
+
+   p->running_ = true;
+
+   const std::size_t workerCount = std::min(kMaxConcurrency_, p->totalViews_);
+   for (std::size_t i = 0; i < workerCount; ++i)
+   {
+      p->CreateWorker(styleUrl);
+   }
+}
+
+void MapPrefetcher::Cancel()
+{
+   if (!p->running_)
+   {
+      return;
+   }
+
+   logger_->info("Cancelling map prefetch");
+
+   p->cancelled_ = true;
+   p->views_.clear();
+
+   for (auto& worker : p->workers_)
+   {
+      p->FinishWorker(worker.get());
+   }
+}
+
+bool MapPrefetcher::Impl::CreateContext()
+{
+   if (context_ != nullptr)
+   {
+      return true;
+   }
+
+   surface_ = std::make_unique<QOffscreenSurface>();
+   surface_->create();
+
+   context_ = std::make_unique<QOpenGLContext>();
+   if (!context_->create() || !context_->makeCurrent(surface_.get()))
+   {
+      logger_->error("Unable to create OpenGL context for map prefetch");
+      context_.reset();
+      surface_.reset();
+      return false;
+   }
+
+   return true;
+}
+
+void MapPrefetcher::Impl::CreateWorker(const QString& styleUrl)
+{
+   auto& worker = workers_.emplace_back(std::make_shared<PrefetchWorker>());
+   auto  w      = worker.get();
+
+   std::weak_ptr<PrefetchWorker> weakWorker = worker;
+
+   context_->makeCurrent(surface_.get());
+
+   w->map_ =
+      std::make_unique<QMapLibre::Map>(nullptr, settings_, kViewportSize_);
+   w->framebuffer_ = std::make_unique<QOpenGLFramebufferObject>(
+      kViewportSize_, QOpenGLFramebufferObject::CombinedDepthStencil);
+   w->timeoutTimer_.setSingleShot(true);
+
+   QObject::connect(w->map_.get(),
+                    &QMapLibre::Map::needsRendering,
+                    self_,
+                    [this, w, weakWorker]()
+                    {
+                       // Render once control returns to the event loop, if
+                       // the worker has not been destroyed
+                       if (!w->renderPending_)
+                       {
+                          w->renderPending_ = true;
+                          QMetaObject::invokeMethod(
+                             self_,
+                             [this, weakWorker]()
+                             {
+                                if (auto worker = weakWorker.lock())
+                                {
+                                   Render(worker.get());
+                                }
+                             },
+                             Qt::QueuedConnection);
+                       }
+                    });
+   QObject::connect(w->map_.get(),
+                    &QMapLibre::Map::mapChanged,
+                    self_,
+                    [this, w](QMapLibre::Map::MapChange mapChange)
+                    {
+                       switch (mapChange)
+                       {
+                       case QMapLibre::Map::MapChangeDidFinishLoadingStyle:
+                          w->styleLoaded_ = true;
+                          NextView(w);
+                          break;
+
+                       case QMapLibre::Map::
+                          MapChangeDidFinishRenderingMapFullyRendered:
+                          if (w->viewActive_)
+                          {
+                             FinishView(w, true);
+                          }
+                          break;
+
+                       default:
+                          break;
+                       }
+                    });
+   QObject::connect(&w->timeoutTimer_,
+                    &QTimer::timeout,
+                    self_,
+                    [this, w]()
+                    {
+                       if (!w->styleLoaded_)
+                       {
+                          logger_->warn("Timed out loading map style");
+                          FinishWorker(w);
+                       }
+                       else if (w->viewActive_)
+                       {
+                          FinishView(w, false);
+                       }
+                    });
+
+   ++activeWorkers_;
+
+   w->map_->setStyleUrl(styleUrl);
+   w->timeoutTimer_.start(kViewTimeout_);
+}
+
+void MapPrefetcher::Impl::DestroyWorkers()
+{
+   if (workers_.empty())
+   {
+      return;
+   }
+
+   // Map resources are released using the context in which they were created
+   context_->makeCurrent(surface_.get());
+   workers_.clear();
+   context_->doneCurrent();
+}
+
+void MapPrefetcher::Impl::NextView(PrefetchWorker* worker)
+{
+   if (worker->finished_)
+   {
+      return;
+   }
+
+   if (views_.empty())
+   {
+      FinishWorker(worker);
+      return;
+   }
+
+   const PrefetchView view = views_.front();
+   views_.pop_front();
+
+   worker->viewActive_ = true;
+   worker->map_->setCoordinateZoom(view.coordinate_, view.zoom_);
+   worker->timeoutTimer_.start(kViewTimeout_);
+}
+
+void MapPrefetcher::Impl::FinishView(PrefetchWorker* worker, bool rendered)
+{
+   worker->viewActive_ = false;
+   worker->timeoutTimer_.stop();
+
+   ++completedViews_;
+   if (!rendered)
+   {
+      ++failedViews_;
+   }
+
+   Q_EMIT self_->ProgressUpdated(completedViews_, totalViews_);
+
+   NextView(worker);
+}
+
+void MapPrefetcher::Impl::FinishWorker(PrefetchWorker* worker)
+{
+   if (worker->finished_)
+   {
+      return;
+   }
+
+   // The map is kept until the next prefetch, as it may still emit signals
+   worker->finished_   = true;
+   worker->viewActive_ = false;
+   worker->timeoutTimer_.stop();
+
+   if (--activeWorkers_ == 0u)
+   {
+      running_ = false;
+
+      logger_->info("Map prefetch finished: {} of {} views rendered",
+                    completedViews_ - failedViews_,
+                    totalViews_);
+
+      Q_EMIT self_->Finished(!cancelled_);
+   }
+}
+
+void MapPrefetcher::Impl::Render(PrefetchWorker* worker)
+{
+   worker->renderPending_ = false;
+
+   if (worker->finished_ || !context_->makeCurrent(surface_.get()))
+   {
+      return;
+   }
+
+   worker->map_->resize(kViewportSize_);
+   worker->map_->setFramebufferObject(worker->framebuffer_->handle(),
+                                      kViewportSize_);
+   worker->map_->render();
+
+   context_->doneCurrent();
+}
+
+std::deque<PrefetchView>
+MapPrefetcher::Impl::GetViews(const std::vector<MapPrefetchRegion>& regions)
+{
+   std::deque<PrefetchView> views {};
+
+   // Web mercator coordinates, where the world spans [0, 1]
+   const auto toX = [](double longitude)
+   { return (longitude + 180.0) / 360.0; };
+   const auto toY = [](double latitude)
+   {
+      const double phi = latitude * std::numbers::pi / 180.0;
+      return (1.0 - std::asinh(std::tan(phi)) / std::numbers::pi) / 2.0;
+   };
+   const auto toLongitude = [](double x) { return x * 360.0 - 180.0; };
+   const auto toLatitude  = [](double y)
+   {
+      return std::atan(std::sinh(std::numbers::pi * (1.0 - 2.0 * y))) *
+             180.0 / std::numbers::pi;
+   };
+
+   for (auto& region : regions)
+   {
+      const double latitude = region.center_.latitude_;
+
+      const double latitudeExtent =
+         region.radius_ / kEarthRadiusKm_ * 180.0 / std::numbers::pi;
+      const double longitudeExtent = std::min(
+         latitudeExtent /
+            std::max(std::cos(latitude * std::numbers::pi / 180.0), 0.01),
+         180.0);
+
+      const double minX = toX(region.center_.longitude_ - longitudeExtent);
+      const double maxX = toX(region.center_.longitude_ + longitudeExtent);
+      const double minY =
+         toY(std::min(latitude + latitudeExtent, kMaxLatitude_));
+      const double maxY =
+         toY(std::max(latitude - latitudeExtent, -kMaxLatitude_));
+
+      for (int zoom = region.minZoom_; zoom <= region.maxZoom_; ++zoom)
+      {
+         // Step across the region one viewport at a time
+         const double worldSize = kTileSize_ * std::exp2(zoom);
+         const double stepX     = kViewportSize_.width() / worldSize;
+         const double stepY     = kViewportSize_.height() / worldSize;
+
+         const int columns =
+            std::max(1, static_cast<int>(std::ceil((maxX - minX) / stepX)));
+         const int rows =
+            std::max(1, static_cast<int>(std::ceil((maxY - minY) / stepY)));
+
+         for (int row = 0; row < rows; ++row)
+         {
+            for (int column = 0; column < columns; ++column)
+            {
+               const double x =
+                  minX + (maxX - minX) * (column + 0.5) / columns;
+               const double y = minY + (maxY - minY) * (row + 0.5) / rows;
+
+               views.push_back({{toLatitude(y), toLongitude(x)},
+                                static_cast<double>(zoom)});
+            }
+         }
+      }
+   }
+
+   return views;
+}
+
+} // namespace map
+} // namespace qt
+} // namespace scwx
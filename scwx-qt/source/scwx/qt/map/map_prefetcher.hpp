@@ -0,0 +1,83 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <QObject>
+#include <QString>
+#include <qmaplibre.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace map
+{
+
+/**
+ * @brief Area of the map for which tiles are prefetched
+ */
+struct MapPrefetchRegion
+{
+   common::Coordinate center_ {}; // Center of the region
+   double             radius_ {}; // Radius of the region (kilometers)
+   int                minZoom_ {};
+   int                maxZoom_ {};
+};
+
+/**
+ * @brief Downloads map tiles into the map cache ahead of time, by rendering
+ * each region at each zoom level using hidden maps. Tiles are stored in the
+ * same cache used by the map widgets, and are available when offline.
+ */
+class MapPrefetcher : public QObject
+{
+   Q_OBJECT
+   Q_DISABLE_COPY_MOVE(MapPrefetcher)
+
+public:
+   explicit MapPrefetcher(const QMapLibre::Settings& settings,
+                          QObject*                   parent = nullptr);
+   ~MapPrefetcher();
+
+   /**
+    * @brief Whether map tiles are being prefetched
+    */
+   bool is_running() const;
+
+   /**
+    * @brief Number of views which could not be completely rendered
+    */
+   std::size_t failed_count() const;
+
+   /**
+    * @brief Starts prefetching map tiles. At most a fixed number of hidden
+    * maps are rendered concurrently.
+    *
+    * @param [in] styleUrl Style URL of the map, including any API key
+    * @param [in] regions Regions to prefetch
+    */
+   void Start(const QString&                        styleUrl,
+              const std::vector<MapPrefetchRegion>& regions);
+
+   /**
+    * @brief Cancels prefetching. Views currently being rendered are abandoned,
+    * and Finished is emitted.
+    */
+   void Cancel();
+
+signals:
+   void ProgressUpdated(std::size_t completed, std::size_t total);
+   void Finished(bool complete);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace map
+} // namespace qt
+} // namespace scwx
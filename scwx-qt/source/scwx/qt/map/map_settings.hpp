@@ -1,5 +1,7 @@
 #pragma once
 
+#include <scwx/common/geographic.hpp>
+
 namespace scwx
 {
 namespace qt
@@ -20,6 +22,11 @@ struct MapSettings
 
    bool isActive_ {false};
    bool radarWireframeEnabled_ {false};
+
+   // Line along which a vertical cross section is sampled
+   bool               crossSectionVisible_ {false};
+   common::Coordinate crossSectionStart_ {};
+   common::Coordinate crossSectionEnd_ {};
 };
 
 } // namespace map
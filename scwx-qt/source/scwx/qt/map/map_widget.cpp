@@ -1,4 +1,5 @@
 #include <scwx/qt/map/map_widget.hpp>
+#include <scwx/qt/gl/frame_readback.hpp>
 #include <scwx/qt/gl/gl.hpp>
 #include <scwx/qt/manager/font_manager.hpp>
 #include <scwx/qt/manager/hotkey_manager.hpp>
@@ -13,30 +14,37 @@
 #include <scwx/qt/map/overlay_product_layer.hpp>
 #include <scwx/qt/map/placefile_layer.hpp>
 #include <scwx/qt/map/marker_layer.hpp>
+#include <scwx/qt/map/radar_mosaic_layer.hpp>
 #include <scwx/qt/map/radar_product_layer.hpp>
 #include <scwx/qt/map/radar_range_layer.hpp>
 #include <scwx/qt/map/radar_site_layer.hpp>
 #include <scwx/qt/model/imgui_context_model.hpp>
 #include <scwx/qt/model/layer_model.hpp>
+#include <scwx/qt/request/nexrad_load_group.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/settings/map_settings.hpp>
 #include <scwx/qt/settings/palette_settings.hpp>
-#include <scwx/qt/util/file.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/tooltip.hpp>
+#include <scwx/qt/view/color_table_cache.hpp>
 #include <scwx/qt/view/overlay_product_view.hpp>
-#include <scwx/qt/view/radar_product_view_factory.hpp>
+#include <scwx/qt/view/radar_product_view_pool.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
+#include <scwx/util/profiler.hpp>
+#include <scwx/util/strand.hpp>
 #include <scwx/util/time.hpp>
 
+#include <cctype>
+#include <mutex>
+#include <ranges>
 #include <set>
+#include <unordered_map>
 
 #include <backends/imgui_impl_opengl3.h>
 #include <backends/imgui_impl_qt.hpp>
 #include <boost/algorithm/string/erase.hpp>
 #include <boost/algorithm/string/trim.hpp>
-#include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
 #include <boost/range/join.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include <fmt/format.h>
@@ -50,8 +58,10 @@
 #include <QIcon>
 #include <QKeyEvent>
 #include <QMouseEvent>
+#include <QOpenGLFramebufferObject>
 #include <QString>
 #include <QTextDocument>
+#include <QTimer>
 
 namespace scwx
 {
@@ -63,6 +73,20 @@ namespace map
 static const std::string logPrefix_ = "scwx::qt::map::map_widget";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Minimum interval between frames which are not driven by map interaction
+static constexpr std::chrono::milliseconds kIdleFrameInterval_ {50};
+
+// Interval after the last map motion before layers are rendered at full
+// resolution
+static constexpr std::chrono::milliseconds kMotionSettleInterval_ {250};
+
+// Number of radar sites near the selected site whose range circles are
+// computed ahead of time
+static constexpr std::size_t kNearbyRadarSites_ = 8u;
+
+// Distance from a cross section endpoint within which it is picked (pixels)
+static constexpr qreal kCrossSectionPickDistance_ = 8.0;
+
 class MapWidgetImpl : public QObject
 {
    Q_OBJECT
@@ -72,6 +96,7 @@ public:
                           std::size_t                id,
                           const QMapLibre::Settings& settings) :
        id_ {id},
+       metricsLabel_ {fmt::format("{}", id + 1)},
        uuid_ {boost::uuids::random_generator()()},
        context_ {std::make_shared<MapContext>()},
        widget_ {widget},
@@ -128,6 +153,20 @@ public:
 
       InitializeCustomStyles();
 
+      // Initialize frame scheduling
+      frameTimer_.setSingleShot(true);
+      connect(&frameTimer_,
+              &QTimer::timeout,
+              widget_,
+              static_cast<void (QWidget::*)()>(&QWidget::update));
+
+      // Render a full resolution frame once the map has settled
+      motionTimer_.setSingleShot(true);
+      connect(&motionTimer_,
+              &QTimer::timeout,
+              widget_,
+              static_cast<void (QWidget::*)()>(&QWidget::update));
+
       ConnectSignals();
    }
 
@@ -148,7 +187,7 @@ public:
       // Destroy ImGui Context
       model::ImGuiContextModel::Instance().DestroyContext(imGuiContextName_);
 
-      threadPool_.join();
+      strand_.Join();
    }
 
    void AddLayer(types::LayerType        type,
@@ -157,19 +196,25 @@ public:
    void AddLayer(const std::string&            id,
                  std::shared_ptr<GenericLayer> layer,
                  const std::string&            before = {});
-   void AddLayers();
+   void AddLayers(bool reuseLayers = false);
    void AddPlacefileLayer(const std::string& placefileName,
                           const std::string& before);
    void ConnectMapSignals();
    void ConnectSignals();
    void DeinitializeCustomStyles() const;
+   void DeinitializeReleasedLayers();
+   void DragCrossSectionLine(const QPointF& position);
    void HandleHotkeyPressed(types::Hotkey hotkey, bool isAutoRepeat);
    void HandleHotkeyReleased(types::Hotkey hotkey);
    void HandleHotkeyUpdates();
    void ImGuiCheckFonts();
+   void NoteMotion();
+   void PaintCapture();
    void InitializeCustomStyles();
    void InitializeNewRadarProductView(const std::string& colorPalette);
+   void PrecomputeRadarRanges(float range, QMapLibre::Coordinate center);
    void RadarProductManagerConnect();
+   void ReleaseLayer(const std::string& id);
    void RadarProductManagerDisconnect();
    void RadarProductViewConnect();
    void RadarProductViewDisconnect();
@@ -178,19 +223,57 @@ public:
                                double                     longitude,
                                std::optional<std::string> type);
    void SetRadarSite(const std::string& radarSite);
+   void StartCrossSectionLine(const QPointF& position);
+   void UpdateDataMetrics(const std::string&                    radarSite,
+                          std::chrono::system_clock::time_point sweepTime);
+   void UpdateProductLatency(
+      const std::shared_ptr<view::RadarProductView>& radarProductView);
+   void UpdateProductLatencyPainted();
    void UpdateLoadedStyle();
    bool UpdateStoredMapParameters();
 
    std::string FindMapSymbologyLayer();
+   float       RenderScale() const;
+
+   // Gets the retained layer with the given ID, or creates and retains it
+   template<class T, class... Args>
+   std::shared_ptr<T>
+   RetainLayer(const std::string& id, bool& created, Args&&... args)
+   {
+      auto it = retainedLayers_.find(id);
+      if (it != retainedLayers_.cend())
+      {
+         auto layer = std::dynamic_pointer_cast<T>(it->second);
+         if (layer != nullptr)
+         {
+            created = false;
+            return layer;
+         }
+
+         ReleaseLayer(id);
+      }
+
+      auto layer = std::make_shared<T>(context_, std::forward<Args>(args)...);
+      layer->set_retained(true);
+      retainedLayers_.emplace(id, layer);
+
+      created = true;
+      return layer;
+   }
 
    common::Level2Product
    GetLevel2ProductOrDefault(const std::string& productName) const;
 
    static std::string GetPlacefileLayerName(const std::string& placefileName);
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::Strand strand_ {"Map Widget"};
+
+   // Loads of newly available data, superseded by the next data available
+   const std::shared_ptr<request::NexradLoadGroup> newDataLoadGroup_ {
+      std::make_shared<request::NexradLoadGroup>()};
 
    std::size_t        id_;
+   std::string        metricsLabel_;
    boost::uuids::uuid uuid_;
 
    std::shared_ptr<MapContext> context_;
@@ -202,6 +285,13 @@ public:
 
    std::vector<std::shared_ptr<GenericLayer>> genericLayers_ {};
 
+   // Layers created for the layer model, by layer ID. Layers remain
+   // initialized while hidden or reordered, and are deinitialized once
+   // released, when the OpenGL context is current.
+   std::unordered_map<std::string, std::shared_ptr<GenericLayer>>
+                                              retainedLayers_ {};
+   std::vector<std::shared_ptr<GenericLayer>> releasedLayers_ {};
+
    const std::vector<MapStyle> emptyStyles_ {};
    std::vector<MapStyle>       customStyles_ {
       MapStyle {.name_ {"Custom"}, .url_ {}, .drawBelow_ {}}};
@@ -225,6 +315,9 @@ public:
       manager::PlacefileManager::Instance()};
    std::shared_ptr<manager::RadarProductManager> radarProductManager_;
 
+   // Views of the products previously selected in the pane
+   view::RadarProductViewPool radarProductViewPool_ {};
+
    std::shared_ptr<RadarProductLayer>   radarProductLayer_;
    std::shared_ptr<OverlayLayer>        overlayLayer_;
    std::shared_ptr<OverlayProductLayer> overlayProductLayer_ {nullptr};
@@ -235,10 +328,21 @@ public:
 
    std::list<std::shared_ptr<PlacefileLayer>> placefileLayers_ {};
 
+   float                 radarRange_ {0.0f};
+   QMapLibre::Coordinate radarRangeCenter_ {};
+
    bool autoRefreshEnabled_;
    bool autoUpdateEnabled_;
    bool smoothingEnabled_ {false};
 
+   // Incremented each time the available level 3 products change
+   std::uint64_t level3ProductsVersion_ {0u};
+
+   // Whether a cross section line may be drawn, and the endpoint of the line
+   // being dragged, 0 for the start or 1 for the end
+   bool                       crossSectionEnabled_ {false};
+   std::optional<std::size_t> crossSectionEndpoint_ {};
+
    common::Level2Product selectedLevel2Product_;
 
    bool            hasMouse_ {false};
@@ -257,6 +361,25 @@ public:
 
    uint64_t frameDraws_;
 
+   QTimer                                frameTimer_ {};
+   QTimer                                motionTimer_ {};
+   std::chrono::steady_clock::time_point lastFrameTime_ {};
+
+   // Frame capture, guarded by the capture mutex except where only accessed
+   // while the OpenGL context is current
+   std::mutex                   captureMutex_ {};
+   QSize                        captureSize_ {};
+   MapWidget::CaptureCallback   captureCallback_ {};
+   std::optional<std::uint64_t> captureTag_ {};
+   std::promise<void>           capturePromise_ {};
+
+   std::unique_ptr<QOpenGLFramebufferObject> captureFramebuffer_ {};
+   gl::FrameReadback                         frameReadback_ {};
+
+   types::ProductLatency                 productLatency_ {};
+   std::chrono::system_clock::time_point productLatencySweepTime_ {};
+   bool                                  productLatencyPending_ {false};
+
    double prevLatitude_;
    double prevLongitude_;
    double prevZoom_;
@@ -267,6 +390,7 @@ public:
    std::chrono::system_clock::time_point prevHotkeyTime_ {};
 
 public slots:
+   void RequestFrame();
    void Update();
 };
 
@@ -289,6 +413,26 @@ MapWidget::~MapWidget()
 {
    // Make sure we have a valid context so we can delete the QMapLibre.
    makeCurrent();
+
+   // Retained layers are deinitialized while the context is valid
+   for (auto& layer : p->retainedLayers_ | std::views::values)
+   {
+      layer->set_retained(false);
+      layer->EnsureDeinitialized();
+   }
+   p->retainedLayers_.clear();
+   p->DeinitializeReleasedLayers();
+
+   // Capture resources are owned by the context
+   p->frameReadback_.Destroy(p->context_->gl());
+   p->captureFramebuffer_.reset();
+
+   std::unique_lock lock {p->captureMutex_};
+   if (p->captureTag_.has_value())
+   {
+      p->capturePromise_.set_value();
+      p->captureTag_.reset();
+   }
 }
 
 void MapWidgetImpl::InitializeCustomStyles()
@@ -361,8 +505,8 @@ void MapWidgetImpl::ConnectSignals()
 {
    connect(placefileManager_.get(),
            &manager::PlacefileManager::PlacefileUpdated,
-           widget_,
-           static_cast<void (QWidget::*)()>(&QWidget::update));
+           this,
+           &MapWidgetImpl::RequestFrame);
 
    // When the layer model changes, update the layers
    connect(layerModel_.get(),
@@ -385,19 +529,19 @@ void MapWidgetImpl::ConnectSignals()
                   (topLeft.column() <= enabledColumn &&
                    enabledColumn <= bottomRight.column()))
               {
-                 AddLayers();
+                 AddLayers(true);
               }
            });
    connect(layerModel_.get(),
            &QAbstractItemModel::modelReset,
            widget_,
-           [this]() { AddLayers(); });
+           [this]() { AddLayers(true); });
    connect(layerModel_.get(),
            &QAbstractItemModel::rowsInserted,
            widget_,
            [this](const QModelIndex& /* parent */, //
                   int /* first */,
-                  int /* last */) { AddLayers(); });
+                  int /* last */) { AddLayers(true); });
    connect(layerModel_.get(),
            &QAbstractItemModel::rowsMoved,
            widget_,
@@ -405,13 +549,13 @@ void MapWidgetImpl::ConnectSignals()
                   int /* sourceStart */,
                   int /* sourceEnd */,
                   const QModelIndex& /* destinationParent */,
-                  int /* destinationRow */) { AddLayers(); });
+                  int /* destinationRow */) { AddLayers(true); });
    connect(layerModel_.get(),
            &QAbstractItemModel::rowsRemoved,
            widget_,
            [this](const QModelIndex& /* parent */, //
                   int /* first */,
-                  int /* last */) { AddLayers(); });
+                  int /* last */) { AddLayers(true); });
 
    connect(hotkeyManager_.get(),
            &manager::HotkeyManager::HotkeyPressed,
@@ -427,6 +571,12 @@ void MapWidgetImpl::HandleHotkeyPressed(types::Hotkey hotkey, bool isAutoRepeat)
 {
    Q_UNUSED(isAutoRepeat);
 
+   if (!widget_->isActiveWindow())
+   {
+      // Hotkeys apply to the window in which they are pressed
+      return;
+   }
+
    switch (hotkey)
    {
    case types::Hotkey::ChangeMapStyle:
@@ -563,8 +713,11 @@ void MapWidgetImpl::HandleHotkeyUpdates()
       }
 
       default:
-         break;
+         // Not a map motion hotkey
+         continue;
       }
+
+      NoteMotion();
    }
 }
 
@@ -651,6 +804,11 @@ std::vector<std::string> MapWidget::GetLevel3Products()
    }
 }
 
+std::uint64_t MapWidget::GetLevel3ProductsVersion() const
+{
+   return p->level3ProductsVersion_;
+}
+
 std::string MapWidget::GetMapStyle() const
 {
    if (p->currentStyle_ != nullptr)
@@ -663,6 +821,18 @@ std::string MapWidget::GetMapStyle() const
    }
 }
 
+std::string MapWidget::GetMapStyleUrl() const
+{
+   if (p->currentStyle_ != nullptr)
+   {
+      return p->currentStyle_->url_;
+   }
+   else
+   {
+      return {};
+   }
+}
+
 common::RadarProductGroup MapWidget::GetRadarProductGroup() const
 {
    auto radarProductView = p->context_->radar_product_view();
@@ -732,6 +902,30 @@ std::uint16_t MapWidget::GetVcp() const
    }
 }
 
+std::optional<std::pair<common::Coordinate, common::Coordinate>>
+MapWidget::GetCrossSectionLine() const
+{
+   auto& settings = p->context_->settings();
+
+   if (!settings.crossSectionVisible_)
+   {
+      return std::nullopt;
+   }
+
+   return std::make_pair(settings.crossSectionStart_,
+                         settings.crossSectionEnd_);
+}
+
+std::shared_ptr<wsr88d::Ar2vFile> MapWidget::GetLevel2Volume() const
+{
+   if (p->radarProductManager_ == nullptr)
+   {
+      return nullptr;
+   }
+
+   return p->radarProductManager_->GetLevel2Volume(GetSelectedTime());
+}
+
 bool MapWidget::GetRadarWireframeEnabled() const
 {
    return p->context_->settings().radarWireframeEnabled_;
@@ -740,8 +934,7 @@ bool MapWidget::GetRadarWireframeEnabled() const
 void MapWidget::SetRadarWireframeEnabled(bool wireframeEnabled)
 {
    p->context_->settings().radarWireframeEnabled_ = wireframeEnabled;
-   QMetaObject::invokeMethod(
-      this, static_cast<void (QWidget::*)()>(&QWidget::update));
+   RequestFrame();
 }
 
 bool MapWidget::GetSmoothingEnabled() const
@@ -761,6 +954,89 @@ void MapWidget::SetSmoothingEnabled(bool smoothingEnabled)
    }
 }
 
+std::uint16_t MapWidget::GetThresholdLevel() const
+{
+   auto radarProductView = p->context_->radar_product_view();
+
+   if (radarProductView != nullptr)
+   {
+      return radarProductView->threshold_level();
+   }
+   else
+   {
+      return 0u;
+   }
+}
+
+void MapWidget::SetThresholdLevel(std::uint16_t level)
+{
+   auto radarProductView = p->context_->radar_product_view();
+   if (radarProductView != nullptr)
+   {
+      radarProductView->set_threshold_level(level);
+   }
+}
+
+std::optional<std::pair<std::uint16_t, std::uint16_t>>
+MapWidget::GetDataLevelRange() const
+{
+   auto radarProductView = p->context_->radar_product_view();
+
+   if (radarProductView == nullptr)
+   {
+      return std::nullopt;
+   }
+
+   return std::make_pair(radarProductView->color_table_min(),
+                         radarProductView->color_table_max());
+}
+
+std::string MapWidget::GetDataLevelText(std::uint16_t level) const
+{
+   auto radarProductView = p->context_->radar_product_view();
+
+   if (radarProductView == nullptr)
+   {
+      return {};
+   }
+
+   std::optional<float> value = radarProductView->GetDataValue(level);
+   if (!value.has_value())
+   {
+      return {};
+   }
+
+   // Scale the data value as when shown on hover
+   float       f     = value.value();
+   std::string units = radarProductView->units();
+   if (!units.empty())
+   {
+      f = f * radarProductView->unit_scale();
+   }
+   else if (auto colorTable = radarProductView->color_table();
+            colorTable != nullptr)
+   {
+      f     = f * colorTable->scale() + colorTable->offset();
+      units = colorTable->units();
+   }
+
+   if (units.empty() || units.starts_with("?") ||
+       radarProductView->IgnoreUnits())
+   {
+      return fmt::format("{:.1f}", f);
+   }
+   else if (std::isalpha(static_cast<unsigned char>(units.at(0))))
+   {
+      // dBZ, Kts, etc.
+      return fmt::format("{:.1f} {}", f, units);
+   }
+   else
+   {
+      // %, etc.
+      return fmt::format("{:.1f}{}", f, units);
+   }
+}
+
 void MapWidget::SelectElevation(float elevation)
 {
    auto radarProductView = p->context_->radar_product_view();
@@ -807,7 +1083,12 @@ void MapWidget::SelectRadarProduct(common::RadarProductGroup group,
    {
       p->RadarProductViewDisconnect();
 
-      radarProductView = view::RadarProductViewFactory::Create(
+      // Hold the previous view for reuse, in case its product is selected
+      // again
+      p->radarProductViewPool_.Release(radarProductView,
+                                       p->context_->radar_product_code());
+
+      radarProductView = p->radarProductViewPool_.Acquire(
          group, productName, productCode, p->radarProductManager_);
       radarProductView->set_smoothing_enabled(p->smoothingEnabled_);
       p->context_->set_radar_product_view(radarProductView);
@@ -832,6 +1113,8 @@ void MapWidget::SelectRadarProduct(common::RadarProductGroup group,
 
       if (radarProductViewCreated)
       {
+         // A reused view loads the color table again, in case the palette
+         // has changed, and computes its sweep from retained data
          const std::string palette =
             (group == common::RadarProductGroup::Level2) ?
                common::GetLevel2Palette(common::GetLevel2Product(productName)) :
@@ -933,13 +1216,101 @@ void MapWidget::SelectTime(std::chrono::system_clock::time_point time)
       // Trigger an update of the radar product view
       radarProductView->Update();
    }
+
+   // Animation frames are rendered at a reduced resolution
+   p->NoteMotion();
 }
 
-void MapWidget::SetActive(bool isActive)
+void MapWidget::StartCapture(QSize size, CaptureCallback callback)
 {
-   p->context_->settings().isActive_ = isActive;
+   {
+      std::unique_lock lock {p->captureMutex_};
+      p->captureSize_     = size;
+      p->captureCallback_ = std::move(callback);
+   }
+
+   update();
+}
+
+std::future<void> MapWidget::CaptureFrame(std::uint64_t tag)
+{
+   std::unique_lock lock {p->captureMutex_};
+
+   // A frame requested previously which has not been painted is superseded
+   if (p->captureTag_.has_value())
+   {
+      p->capturePromise_.set_value();
+      p->captureTag_.reset();
+   }
+
+   p->capturePromise_ = std::promise<void> {};
+   std::future<void> future = p->capturePromise_.get_future();
+
+   if (p->captureSize_.isEmpty())
+   {
+      // Capture is not started
+      p->capturePromise_.set_value();
+      return future;
+   }
+
+   p->captureTag_ = tag;
+   lock.unlock();
+
    QMetaObject::invokeMethod(
       this, static_cast<void (QWidget::*)()>(&QWidget::update));
+
+   return future;
+}
+
+void MapWidget::StopCapture()
+{
+   CaptureCallback callback {};
+   {
+      std::unique_lock lock {p->captureMutex_};
+      callback = std::move(p->captureCallback_);
+
+      p->captureSize_     = {};
+      p->captureCallback_ = nullptr;
+
+      if (p->captureTag_.has_value())
+      {
+         p->capturePromise_.set_value();
+         p->captureTag_.reset();
+      }
+   }
+
+   // Complete frames being read back before releasing the buffers
+   makeCurrent();
+   p->frameReadback_.Finish(p->context_->gl(), callback);
+   p->frameReadback_.Destroy(p->context_->gl());
+   p->captureFramebuffer_.reset();
+   doneCurrent();
+
+   update();
+}
+
+void MapWidget::SetActive(bool isActive)
+{
+   p->context_->settings().isActive_ = isActive;
+   RequestFrame();
+}
+
+void MapWidget::SetCrossSectionEnabled(bool enabled)
+{
+   p->crossSectionEnabled_ = enabled;
+   p->crossSectionEndpoint_.reset();
+
+   if (!enabled)
+   {
+      p->context_->settings().crossSectionVisible_ = false;
+   }
+
+   RequestFrame();
+}
+
+void MapWidget::RequestFrame()
+{
+   QMetaObject::invokeMethod(p.get(), &MapWidgetImpl::RequestFrame);
 }
 
 void MapWidget::SetAutoRefresh(bool enabled)
@@ -1065,8 +1436,7 @@ void MapWidget::UpdateMouseCoordinate(const common::Coordinate& coordinate)
           keyboardModifiers != Qt::KeyboardModifier::NoModifier ||
           keyboardModifiers != p->lastKeyboardModifiers_)
       {
-         QMetaObject::invokeMethod(
-            this, static_cast<void (QWidget::*)()>(&QWidget::update));
+         RequestFrame();
       }
 
       p->lastKeyboardModifiers_ = keyboardModifiers;
@@ -1150,7 +1520,7 @@ std::string MapWidgetImpl::FindMapSymbologyLayer()
    return before;
 }
 
-void MapWidgetImpl::AddLayers()
+void MapWidgetImpl::AddLayers(bool reuseLayers)
 {
    if (styleLayers_.isEmpty())
    {
@@ -1160,15 +1530,28 @@ void MapWidgetImpl::AddLayers()
 
    logger_->debug("Add Layers");
 
+   if (!reuseLayers)
+   {
+      // Layers are recreated, such as for a new radar product view
+      while (!retainedLayers_.empty())
+      {
+         ReleaseLayer(retainedLayers_.cbegin()->first);
+      }
+   }
+
    // Clear custom layers
    for (const std::string& id : layerList_)
    {
       map_->removeLayer(id.c_str());
    }
    layerList_.clear();
-   genericLayers_.clear();
    placefileLayers_.clear();
 
+   // Keep the previous layers until the new layers are added, such that
+   // shared state, such as the radar mosaic, is not recreated
+   std::vector<std::shared_ptr<GenericLayer>> previousLayers {};
+   previousLayers.swap(genericLayers_);
+
    // Update custom layer list from model
    customLayers_ = model::LayerModel::Instance()->GetLayers();
 
@@ -1203,6 +1586,53 @@ void MapWidgetImpl::AddLayers()
          AddLayer(it->type_, it->description_, before);
       }
    }
+
+   // Release layers which are no longer in the layer model. Layers which are
+   // only hidden are retained, such that they can be shown again.
+   std::set<std::string> modelLayers {};
+   for (auto& layer : customLayers_)
+   {
+      modelLayers.insert(types::GetLayerName(layer.type_, layer.description_));
+   }
+
+   std::vector<std::string> releasedIds {};
+   for (auto& [id, layer] : retainedLayers_)
+   {
+      if (!modelLayers.contains(id))
+      {
+         releasedIds.push_back(id);
+      }
+   }
+   for (auto& id : releasedIds)
+   {
+      ReleaseLayer(id);
+   }
+}
+
+void MapWidgetImpl::ReleaseLayer(const std::string& id)
+{
+   auto it = retainedLayers_.find(id);
+   if (it != retainedLayers_.end())
+   {
+      // If the layer is removed from the map after this point, it is
+      // deinitialized then
+      it->second->set_retained(false);
+      releasedLayers_.push_back(it->second);
+      retainedLayers_.erase(it);
+
+      RequestFrame();
+   }
+}
+
+void MapWidgetImpl::DeinitializeReleasedLayers()
+{
+   // Layers are released after they are removed from the map, so they are no
+   // longer rendered
+   for (auto& layer : releasedLayers_)
+   {
+      layer->EnsureDeinitialized();
+   }
+   releasedLayers_.clear();
 }
 
 void MapWidgetImpl::AddLayer(types::LayerType        type,
@@ -1210,6 +1640,7 @@ void MapWidgetImpl::AddLayer(types::LayerType        type,
                              const std::string&      before)
 {
    std::string layerName = types::GetLayerName(type, description);
+   bool        created   = false;
 
    auto radarProductView = context_->radar_product_view();
 
@@ -1218,7 +1649,8 @@ void MapWidgetImpl::AddLayer(types::LayerType        type,
       // If there is a radar product view, create the radar product layer
       if (radarProductView != nullptr)
       {
-         radarProductLayer_ = std::make_shared<RadarProductLayer>(context_);
+         radarProductLayer_ =
+            RetainLayer<RadarProductLayer>(layerName, created);
          AddLayer(layerName, radarProductLayer_, before);
       }
    }
@@ -1227,14 +1659,17 @@ void MapWidgetImpl::AddLayer(types::LayerType        type,
       auto phenomenon = std::get<awips::Phenomenon>(description);
 
       std::shared_ptr<AlertLayer> alertLayer =
-         std::make_shared<AlertLayer>(context_, phenomenon);
+         RetainLayer<AlertLayer>(layerName, created, phenomenon);
       AddLayer(fmt::format("alert.{}", awips::GetPhenomenonCode(phenomenon)),
                alertLayer,
                before);
-      connect(alertLayer.get(),
-              &AlertLayer::AlertSelected,
-              widget_,
-              &MapWidget::AlertSelected);
+      if (created)
+      {
+         connect(alertLayer.get(),
+                 &AlertLayer::AlertSelected,
+                 widget_,
+                 &MapWidget::AlertSelected);
+      }
    }
    else if (type == types::LayerType::Placefile)
    {
@@ -1251,7 +1686,7 @@ void MapWidgetImpl::AddLayer(types::LayerType        type,
       {
       // Create the map overlay layer
       case types::InformationLayer::MapOverlay:
-         overlayLayer_ = std::make_shared<OverlayLayer>(context_);
+         overlayLayer_ = RetainLayer<OverlayLayer>(layerName, created);
          AddLayer(layerName, overlayLayer_, before);
          break;
 
@@ -1259,25 +1694,29 @@ void MapWidgetImpl::AddLayer(types::LayerType        type,
       case types::InformationLayer::ColorTable:
          if (radarProductView != nullptr)
          {
-            colorTableLayer_ = std::make_shared<ColorTableLayer>(context_);
+            colorTableLayer_ =
+               RetainLayer<ColorTableLayer>(layerName, created);
             AddLayer(layerName, colorTableLayer_, before);
          }
          break;
 
       // Create the radar site layer
       case types::InformationLayer::RadarSite:
-         radarSiteLayer_ = std::make_shared<RadarSiteLayer>(context_);
+         radarSiteLayer_ = RetainLayer<RadarSiteLayer>(layerName, created);
          AddLayer(layerName, radarSiteLayer_, before);
-         connect(radarSiteLayer_.get(),
-                 &RadarSiteLayer::RadarSiteSelected,
-                 this,
-                 [this](const std::string& id)
-                 { widget_->RadarSiteRequested(id); });
+         if (created)
+         {
+            connect(radarSiteLayer_.get(),
+                    &RadarSiteLayer::RadarSiteSelected,
+                    this,
+                    [this](const std::string& id)
+                    { widget_->RadarSiteRequested(id); });
+         }
          break;
 
       // Create the location marker layer
       case types::InformationLayer::Markers:
-         markerLayer_ = std::make_shared<MarkerLayer>(context_);
+         markerLayer_ = RetainLayer<MarkerLayer>(layerName, created);
          AddLayer(layerName, markerLayer_, before);
          break;
 
@@ -1294,7 +1733,7 @@ void MapWidgetImpl::AddLayer(types::LayerType        type,
          if (radarProductView != nullptr)
          {
             overlayProductLayer_ =
-               std::make_shared<OverlayProductLayer>(context_);
+               RetainLayer<OverlayProductLayer>(layerName, created);
             AddLayer(layerName, overlayProductLayer_, before);
          }
          break;
@@ -1305,15 +1744,25 @@ void MapWidgetImpl::AddLayer(types::LayerType        type,
          {
             std::shared_ptr<config::RadarSite> radarSite =
                radarProductManager_->radar_site();
-            RadarRangeLayer::Add(
-               map_,
-               radarProductView->range(),
-               {radarSite->latitude(), radarSite->longitude()},
-               QString::fromStdString(before));
+            radarRange_       = radarProductView->range();
+            radarRangeCenter_ = {radarSite->latitude(), radarSite->longitude()};
+            RadarRangeLayer::Add(map_,
+                                 radarRange_,
+                                 radarRangeCenter_,
+                                 QString::fromStdString(before));
+            PrecomputeRadarRanges(radarRange_, radarRangeCenter_);
             layerList_.push_back(types::GetLayerName(type, description));
          }
          break;
 
+      // Create the radar mosaic layer, which does not depend on the radar
+      // product view
+      case types::DataLayer::RadarMosaic:
+         AddLayer(layerName,
+                  RetainLayer<RadarMosaicLayer>(layerName, created),
+                  before);
+         break;
+
       default:
          break;
       }
@@ -1323,16 +1772,22 @@ void MapWidgetImpl::AddLayer(types::LayerType        type,
 void MapWidgetImpl::AddPlacefileLayer(const std::string& placefileName,
                                       const std::string& before)
 {
+   const std::string layerName = GetPlacefileLayerName(placefileName);
+   bool              created   = false;
+
    std::shared_ptr<PlacefileLayer> placefileLayer =
-      std::make_shared<PlacefileLayer>(context_, placefileName);
+      RetainLayer<PlacefileLayer>(layerName, created, placefileName);
    placefileLayers_.push_back(placefileLayer);
-   AddLayer(GetPlacefileLayerName(placefileName), placefileLayer, before);
+   AddLayer(layerName, placefileLayer, before);
 
    // When the layer updates, trigger a map widget update
-   connect(placefileLayer.get(),
-           &PlacefileLayer::DataReloaded,
-           widget_,
-           static_cast<void (QWidget::*)()>(&QWidget::update));
+   if (created)
+   {
+      connect(placefileLayer.get(),
+              &PlacefileLayer::DataReloaded,
+              this,
+              &MapWidgetImpl::RequestFrame);
+   }
 }
 
 std::string
@@ -1345,9 +1800,11 @@ void MapWidgetImpl::AddLayer(const std::string&            id,
                              std::shared_ptr<GenericLayer> layer,
                              const std::string&            before)
 {
-   // QMapLibre::addCustomLayer will take ownership of the std::unique_ptr
+   // QMapLibre::addCustomLayer will take ownership of the std::unique_ptr.
+   // Profiler samples are labeled by map pane and layer.
    std::unique_ptr<QMapLibre::CustomLayerHostInterface> pHost =
-      std::make_unique<LayerWrapper>(layer);
+      std::make_unique<LayerWrapper>(layer,
+                                     fmt::format("Map {}: {}", id_ + 1, id));
 
    try
    {
@@ -1356,10 +1813,12 @@ void MapWidgetImpl::AddLayer(const std::string&            id,
       layerList_.push_back(id);
       genericLayers_.push_back(layer);
 
+      // Retained layers may already be connected
       connect(layer.get(),
               &GenericLayer::NeedsRendering,
-              widget_,
-              static_cast<void (QWidget::*)()>(&QWidget::update));
+              this,
+              &MapWidgetImpl::RequestFrame,
+              Qt::UniqueConnection);
    }
    catch (const std::exception&)
    {
@@ -1420,8 +1879,15 @@ void MapWidget::mousePressEvent(QMouseEvent* ev)
 
    if (ev->type() == QEvent::Type::MouseButtonPress)
    {
-      if (ev->buttons() ==
-          (Qt::MouseButton::LeftButton | Qt::MouseButton::RightButton))
+      if (p->crossSectionEnabled_ &&
+          ev->buttons() == Qt::MouseButton::LeftButton &&
+          ev->modifiers() == Qt::KeyboardModifier::ShiftModifier)
+      {
+         // Draw a cross section line on shift + left click
+         p->StartCrossSectionLine(p->lastPos_);
+      }
+      else if (ev->buttons() ==
+               (Qt::MouseButton::LeftButton | Qt::MouseButton::RightButton))
       {
          changeStyle();
       }
@@ -1438,10 +1904,12 @@ void MapWidget::mousePressEvent(QMouseEvent* ev)
    {
       if (ev->buttons() == Qt::MouseButton::LeftButton)
       {
+         p->NoteMotion();
          p->map_->scaleBy(2.0, p->lastPos_);
       }
       else if (ev->buttons() == Qt::MouseButton::RightButton)
       {
+         p->NoteMotion();
          p->map_->scaleBy(0.5, p->lastPos_);
       }
    }
@@ -1455,12 +1923,18 @@ void MapWidget::mouseMoveEvent(QMouseEvent* ev)
 
    if (!delta.isNull())
    {
-      if (ev->buttons() == Qt::MouseButton::LeftButton)
+      if (p->crossSectionEndpoint_.has_value())
       {
+         p->DragCrossSectionLine(ev->position());
+      }
+      else if (ev->buttons() == Qt::MouseButton::LeftButton)
+      {
+         p->NoteMotion();
          p->map_->moveBy(delta);
       }
       else if (ev->buttons() == Qt::MouseButton::RightButton)
       {
+         p->NoteMotion();
          p->map_->rotateBy(p->lastPos_, ev->position());
       }
    }
@@ -1470,6 +1944,16 @@ void MapWidget::mouseMoveEvent(QMouseEvent* ev)
    ev->accept();
 }
 
+void MapWidget::mouseReleaseEvent(QMouseEvent* ev)
+{
+   if (!(ev->buttons() & Qt::MouseButton::LeftButton))
+   {
+      p->crossSectionEndpoint_.reset();
+   }
+
+   ev->accept();
+}
+
 void MapWidget::wheelEvent(QWheelEvent* ev)
 {
    if (ev->angleDelta().y() == 0)
@@ -1483,6 +1967,7 @@ void MapWidget::wheelEvent(QWheelEvent* ev)
       factor = factor > -1 ? factor : 1 / factor;
    }
 
+   p->NoteMotion();
    p->map_->scaleBy(1 + factor, ev->position());
 
    ev->accept();
@@ -1540,6 +2025,8 @@ void MapWidget::initializeGL()
 
 void MapWidget::paintGL()
 {
+   scwx::util::ScopedTimer frameTimer {scwx::util::ProfileStage::Frame};
+
    p->isPainting_ = true;
 
    auto defaultFont = manager::FontManager::Instance().GetImGuiFont(
@@ -1547,8 +2034,22 @@ void MapWidget::paintGL()
 
    p->frameDraws_++;
 
+   // This frame satisfies any pending frame request
+   p->frameTimer_.stop();
+   p->lastFrameTime_ = std::chrono::steady_clock::now();
+   const auto frameStart = p->lastFrameTime_;
+
+   // Uploads are spread across frames under the upload budget (KB)
+   p->context_->upload_scheduler().set_budget(
+      static_cast<std::size_t>(settings::GeneralSettings::Instance()
+                                  .gpu_upload_budget()
+                                  .GetValue()) *
+      1024u);
    p->context_->StartFrame();
 
+   // Deinitialize layers which have been released since the last frame
+   p->DeinitializeReleasedLayers();
+
    // Handle hotkey updates
    p->HandleHotkeyUpdates();
 
@@ -1568,17 +2069,50 @@ void MapWidget::paintGL()
    // Set default font
    ImGui::PushFont(defaultFont->font());
 
+   // Frames being captured are rendered offscreen at the capture size
+   QSize captureSize {};
+   {
+      std::unique_lock lock {p->captureMutex_};
+      captureSize = p->captureSize_;
+   }
+   const bool capturing = !captureSize.isEmpty();
+
+   if (capturing)
+   {
+      if (p->captureFramebuffer_ == nullptr ||
+          p->captureFramebuffer_->size() != captureSize)
+      {
+         p->captureFramebuffer_ = std::make_unique<QOpenGLFramebufferObject>(
+            captureSize, QOpenGLFramebufferObject::CombinedDepthStencil);
+      }
+
+      ImGuiIO& io    = ImGui::GetIO();
+      io.DisplaySize = ImVec2(static_cast<float>(captureSize.width()),
+                              static_cast<float>(captureSize.height()));
+      io.DisplayFramebufferScale = ImVec2(1.0f, 1.0f);
+   }
+
    // Update pixel ratio
-   p->context_->set_pixel_ratio(pixelRatio());
+   p->context_->set_pixel_ratio(capturing ? 1.0f : pixelRatio());
+   p->context_->set_render_scale(capturing ? 1.0f : p->RenderScale());
 
    // Render QMapLibre Map
-   p->map_->resize(size());
-   p->map_->setFramebufferObject(defaultFramebufferObject(),
-                                 size() * pixelRatio());
+   if (capturing)
+   {
+      p->map_->resize(captureSize);
+      p->map_->setFramebufferObject(p->captureFramebuffer_->handle(),
+                                    captureSize);
+   }
+   else
+   {
+      p->map_->resize(size());
+      p->map_->setFramebufferObject(defaultFramebufferObject(),
+                                    size() * pixelRatio());
+   }
    p->map_->render();
 
-   // Perform mouse picking
-   if (p->hasMouse_)
+   // Perform mouse picking, unless the map is not rendered at the widget size
+   if (p->hasMouse_ && !capturing)
    {
       p->RunMousePicking();
    }
@@ -1594,18 +2128,120 @@ void MapWidget::paintGL()
    ImGui::PopFont();
 
    // Render ImGui Frame
-   ImGui::Render();
-   ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+   {
+      scwx::util::ScopedTimer imGuiTimer {scwx::util::ProfileStage::ImGui};
+
+      ImGui::Render();
+
+      if (capturing)
+      {
+         p->captureFramebuffer_->bind();
+      }
+
+      // The OpenGL backend saves and restores the GL state on every call, so
+      // only call it when a window, tooltip or text was drawn this frame
+      ImDrawData* drawData = ImGui::GetDrawData();
+      if (drawData != nullptr && drawData->TotalVtxCount > 0)
+      {
+         ImGui_ImplOpenGL3_RenderDrawData(drawData);
+      }
+   }
 
    // Unlock ImGui font atlas after rendering
    imguiFontAtlasLock.unlock();
 
+   if (capturing)
+   {
+      p->PaintCapture();
+   }
+
+   scwx::util::Metrics::Observe(
+      scwx::util::Metric::FrameSeconds,
+      p->metricsLabel_,
+      std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                    frameStart)
+         .count());
+
+   p->UpdateProductLatencyPainted();
+
+   // Render another frame to complete uploads deferred by the upload budget
+   if (p->context_->upload_scheduler().deferred())
+   {
+      p->RequestFrame();
+   }
+
    // Paint complete
    Q_EMIT WidgetPainted();
 
    p->isPainting_ = false;
 }
 
+void MapWidgetImpl::PaintCapture()
+{
+   gl::OpenGLFunctions& gl = context_->gl();
+
+   const QSize  captureSize = captureFramebuffer_->size();
+   const GLuint framebuffer = captureFramebuffer_->handle();
+
+   MapWidget::CaptureCallback   callback {};
+   std::optional<std::uint64_t> tag {};
+   {
+      std::unique_lock lock {captureMutex_};
+      callback = captureCallback_;
+      tag      = captureTag_;
+   }
+
+   // Start reading the requested frame, and complete reads of prior frames
+   // that have finished, without waiting on the GPU
+   if (tag.has_value())
+   {
+      frameReadback_.Read(gl,
+                          framebuffer,
+                          captureSize.width(),
+                          captureSize.height(),
+                          *tag,
+                          callback);
+
+      std::unique_lock lock {captureMutex_};
+      if (captureTag_ == tag)
+      {
+         capturePromise_.set_value();
+         captureTag_.reset();
+      }
+   }
+   frameReadback_.Poll(gl, callback);
+
+   // Scale the captured frame to fit the widget
+   const QSize  widgetSize = widget_->size() * widget_->pixelRatio();
+   const double scale =
+      std::min(static_cast<double>(widgetSize.width()) / captureSize.width(),
+               static_cast<double>(widgetSize.height()) / captureSize.height());
+   const int width  = static_cast<int>(captureSize.width() * scale);
+   const int height = static_cast<int>(captureSize.height() * scale);
+   const int x      = (widgetSize.width() - width) / 2;
+   const int y      = (widgetSize.height() - height) / 2;
+
+   const GLuint defaultFramebuffer = widget_->defaultFramebufferObject();
+
+   gl.glBindFramebuffer(GL_DRAW_FRAMEBUFFER, defaultFramebuffer);
+   gl.glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+   gl.glClear(GL_COLOR_BUFFER_BIT);
+
+   gl.glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+   gl.glBlitFramebuffer(0,
+                        0,
+                        captureSize.width(),
+                        captureSize.height(),
+                        x,
+                        y,
+                        x + width,
+                        y + height,
+                        GL_COLOR_BUFFER_BIT,
+                        GL_LINEAR);
+
+   gl.glBindFramebuffer(GL_FRAMEBUFFER, defaultFramebuffer);
+}
+
 void MapWidgetImpl::ImGuiCheckFonts()
 {
    // Update ImGui Fonts if required
@@ -1730,10 +2366,19 @@ void MapWidgetImpl::RadarProductManagerConnect()
 {
    if (radarProductManager_ != nullptr)
    {
+      // The available products of the new radar site differ. Products last
+      // known to be available are displayed while they are refreshed.
+      ++level3ProductsVersion_;
+      Q_EMIT widget_->Level3ProductsChanged();
+
       connect(radarProductManager_.get(),
               &manager::RadarProductManager::Level3ProductsChanged,
               this,
-              [this]() { Q_EMIT widget_->Level3ProductsChanged(); });
+              [this]()
+              {
+                 ++level3ProductsVersion_;
+                 Q_EMIT widget_->Level3ProductsChanged();
+              });
 
       connect(
          radarProductManager_.get(),
@@ -1753,6 +2398,9 @@ void MapWidgetImpl::RadarProductManagerConnect()
                   std::make_shared<request::NexradFileRequest>(
                      radarProductManager_->radar_id());
 
+               newDataLoadGroup_->NextGeneration();
+               newDataLoadGroup_->Add(request);
+
                // File request callback
                if (autoUpdateEnabled_)
                {
@@ -1782,26 +2430,18 @@ void MapWidgetImpl::RadarProductManagerConnect()
                }
 
                // Load file
-               boost::asio::post(
-                  threadPool_,
+               strand_.Post(
                   [=, this]()
                   {
-                     try
+                     if (group == common::RadarProductGroup::Level2)
                      {
-                        if (group == common::RadarProductGroup::Level2)
-                        {
-                           radarProductManager_->LoadLevel2Data(latestTime,
-                                                                request);
-                        }
-                        else
-                        {
-                           radarProductManager_->LoadLevel3Data(
-                              product, latestTime, request);
-                        }
+                        radarProductManager_->LoadLevel2Data(latestTime,
+                                                             request);
                      }
-                     catch (const std::exception& ex)
+                     else
                      {
-                        logger_->error(ex.what());
+                        radarProductManager_->LoadLevel3Data(
+                           product, latestTime, request);
                      }
                   });
             }
@@ -1819,39 +2459,32 @@ void MapWidgetImpl::RadarProductManagerDisconnect()
                  this,
                  nullptr);
    }
+
+   // Loads for the previous radar site are no longer wanted
+   newDataLoadGroup_->CancelAll();
 }
 
 void MapWidgetImpl::InitializeNewRadarProductView(
    const std::string& colorPalette)
 {
-   boost::asio::post(threadPool_,
-                     [=, this]()
-                     {
-                        try
-                        {
-                           auto radarProductView =
-                              context_->radar_product_view();
-
-                           std::string colorTableFile =
-                              settings::PaletteSettings::Instance()
-                                 .palette(colorPalette)
-                                 .GetValue();
-                           if (!colorTableFile.empty())
-                           {
-                              std::unique_ptr<std::istream> colorTableStream =
-                                 util::OpenFile(colorTableFile);
-                              std::shared_ptr<common::ColorTable> colorTable =
-                                 common::ColorTable::Load(*colorTableStream);
-                              radarProductView->LoadColorTable(colorTable);
-                           }
-
-                           radarProductView->Initialize();
-                        }
-                        catch (const std::exception& ex)
-                        {
-                           logger_->error(ex.what());
-                        }
-                     });
+   strand_.Post(
+      [=, this]()
+      {
+         auto radarProductView = context_->radar_product_view();
+
+         std::string colorTableFile =
+            settings::PaletteSettings::Instance()
+               .palette(colorPalette)
+               .GetValue();
+         if (!colorTableFile.empty())
+         {
+            std::shared_ptr<common::ColorTable> colorTable =
+               view::ColorTableCache::Instance().Load(colorTableFile);
+            radarProductView->LoadColorTable(colorTable);
+         }
+
+         radarProductView->Initialize();
+      });
 
    if (map_ != nullptr)
    {
@@ -1867,8 +2500,8 @@ void MapWidgetImpl::RadarProductViewConnect()
    {
       connect(radarProductView.get(),
               &view::RadarProductView::ColorTableLutUpdated,
-              widget_,
-              static_cast<void (QWidget::*)()>(&QWidget::update),
+              this,
+              &MapWidgetImpl::RequestFrame,
               Qt::QueuedConnection);
       connect(
          radarProductView.get(),
@@ -1876,14 +2509,34 @@ void MapWidgetImpl::RadarProductViewConnect()
          this,
          [=, this]()
          {
+            if (radarProductView->IsSuspended())
+            {
+               // The sweep completed after the view was released to the
+               // view pool, and is no longer displayed
+               return;
+            }
+
             std::shared_ptr<config::RadarSite> radarSite =
                radarProductManager_->radar_site();
 
-            RadarRangeLayer::Update(
-               map_,
-               radarProductView->range(),
-               {radarSite->latitude(), radarSite->longitude()});
-            widget_->update();
+            const float                 range = radarProductView->range();
+            const QMapLibre::Coordinate center {radarSite->latitude(),
+                                                radarSite->longitude()};
+
+            // Only update the range circle source when it has changed, as
+            // the map reprocesses the source on each update
+            if (range != radarRange_ || center != radarRangeCenter_)
+            {
+               radarRange_       = range;
+               radarRangeCenter_ = center;
+               RadarRangeLayer::Update(map_, range, center);
+               PrecomputeRadarRanges(range, center);
+            }
+
+            UpdateDataMetrics(radarSite->id(), radarProductView->sweep_time());
+            UpdateProductLatency(radarProductView);
+
+            RequestFrame();
             Q_EMIT widget_->RadarSweepUpdated();
          },
          Qt::QueuedConnection);
@@ -1902,7 +2555,7 @@ void MapWidgetImpl::RadarProductViewDisconnect()
    {
       disconnect(radarProductView.get(),
                  &view::RadarProductView::ColorTableLutUpdated,
-                 widget_,
+                 this,
                  nullptr);
       disconnect(radarProductView.get(),
                  &view::RadarProductView::SweepComputed,
@@ -1939,6 +2592,9 @@ void MapWidgetImpl::SetRadarSite(const std::string& radarSite)
       // Set new RadarProductManager
       radarProductManager_ = manager::RadarProductManager::Instance(radarSite);
 
+      // Views held for reuse retain data from the previous radar site
+      radarProductViewPool_.Clear();
+
       // Update views
       context_->overlay_product_view()->set_radar_product_manager(
          radarProductManager_);
@@ -1950,6 +2606,210 @@ void MapWidgetImpl::SetRadarSite(const std::string& radarSite)
    }
 }
 
+void MapWidgetImpl::UpdateDataMetrics(
+   const std::string&                    radarSite,
+   std::chrono::system_clock::time_point sweepTime)
+{
+   if (!scwx::util::Metrics::IsEnabled() ||
+       sweepTime == std::chrono::system_clock::time_point {})
+   {
+      return;
+   }
+
+   const auto now = std::chrono::system_clock::now();
+
+   scwx::util::Metrics::Set(
+      scwx::util::Metric::DataTime,
+      radarSite,
+      std::chrono::duration<double>(sweepTime.time_since_epoch()).count());
+   scwx::util::Metrics::Set(
+      scwx::util::Metric::DataLatency,
+      radarSite,
+      std::chrono::duration<double>(now - sweepTime).count());
+}
+
+void MapWidgetImpl::UpdateProductLatency(
+   const std::shared_ptr<view::RadarProductView>& radarProductView)
+{
+   const auto sweepTime = radarProductView->sweep_time();
+
+   types::ProductLatency latency = radarProductManager_->GetProductLatency(
+      radarProductView->GetRadarProductGroup(),
+      radarProductView->GetRadarProductName(),
+      sweepTime);
+
+   if (latency.productTime_ == productLatency_.productTime_ &&
+       sweepTime == productLatencySweepTime_)
+   {
+      // The same sweep was computed again, and was already painted
+      return;
+   }
+
+   latency.set_stage_time(types::LatencyStage::Computed,
+                          std::chrono::system_clock::now());
+
+   productLatency_          = latency;
+   productLatencySweepTime_ = sweepTime;
+   productLatencyPending_   = true;
+}
+
+void MapWidgetImpl::UpdateProductLatencyPainted()
+{
+   if (!productLatencyPending_)
+   {
+      return;
+   }
+
+   productLatency_.set_stage_time(types::LatencyStage::Painted,
+                                  std::chrono::system_clock::now());
+   productLatencyPending_ = false;
+
+   context_->set_product_latency(productLatency_);
+
+   if (productLatency_.productTime_ != std::chrono::system_clock::time_point {})
+   {
+      std::string stages {};
+      for (auto stage : types::LatencyStageIterator())
+      {
+         auto latency = productLatency_.latency(stage);
+         if (latency.has_value())
+         {
+            stages += fmt::format(", {} {:.1f} s",
+                                  types::GetLatencyStageName(stage),
+                                  latency->count() / 1000.0);
+         }
+      }
+
+      logger_->debug("Pane {} latency: {}{}",
+                     metricsLabel_,
+                     scwx::util::TimeString(productLatency_.productTime_),
+                     stages);
+   }
+}
+
+void MapWidgetImpl::PrecomputeRadarRanges(float                 range,
+                                          QMapLibre::Coordinate center)
+{
+   // Compute the range circles of nearby radar sites in the background, so
+   // switching to a nearby site does not compute them on the UI thread
+   strand_.Post(
+      [range, center]()
+      {
+         auto radarSites = config::RadarSite::FindNearby(
+            center.first, center.second, kNearbyRadarSites_);
+
+         for (auto& radarSite : radarSites)
+         {
+            RadarRangeLayer::Precompute(
+               range, {radarSite->latitude(), radarSite->longitude()});
+         }
+      });
+}
+
+void MapWidgetImpl::StartCrossSectionLine(const QPointF& position)
+{
+   auto& settings = context_->settings();
+
+   if (settings.crossSectionVisible_)
+   {
+      // Drag an existing endpoint if it was picked
+      const QPointF start = map_->pixelForCoordinate(
+         {settings.crossSectionStart_.latitude_,
+          settings.crossSectionStart_.longitude_});
+      const QPointF end = map_->pixelForCoordinate(
+         {settings.crossSectionEnd_.latitude_,
+          settings.crossSectionEnd_.longitude_});
+
+      if ((end - position).manhattanLength() <= kCrossSectionPickDistance_)
+      {
+         crossSectionEndpoint_ = 1u;
+         return;
+      }
+      if ((start - position).manhattanLength() <= kCrossSectionPickDistance_)
+      {
+         crossSectionEndpoint_ = 0u;
+         return;
+      }
+   }
+
+   // Otherwise, start a new line, and drag its end
+   const auto coordinate = map_->coordinateForPixel(position);
+
+   settings.crossSectionStart_   = {coordinate.first, coordinate.second};
+   settings.crossSectionEnd_     = settings.crossSectionStart_;
+   settings.crossSectionVisible_ = true;
+   crossSectionEndpoint_         = 1u;
+
+   widget_->update();
+}
+
+void MapWidgetImpl::DragCrossSectionLine(const QPointF& position)
+{
+   auto&      settings   = context_->settings();
+   const auto coordinate = map_->coordinateForPixel(position);
+
+   if (crossSectionEndpoint_ == 0u)
+   {
+      settings.crossSectionStart_ = {coordinate.first, coordinate.second};
+   }
+   else
+   {
+      settings.crossSectionEnd_ = {coordinate.first, coordinate.second};
+   }
+
+   // Map interaction is repainted immediately
+   widget_->update();
+
+   Q_EMIT widget_->CrossSectionLineChanged(settings.crossSectionStart_,
+                                           settings.crossSectionEnd_);
+}
+
+void MapWidgetImpl::NoteMotion()
+{
+   // Restarts the interval after which the map has settled
+   motionTimer_.start(kMotionSettleInterval_);
+}
+
+float MapWidgetImpl::RenderScale() const
+{
+   if (!motionTimer_.isActive())
+   {
+      return 1.0f;
+   }
+
+   const float scale =
+      static_cast<float>(settings::GeneralSettings::Instance()
+                            .dynamic_resolution_scale()
+                            .GetValue()) /
+      100.0f;
+
+   // Layers are not rendered below one pixel per logical pixel, such that
+   // only high DPI displays are reduced
+   return std::max(scale, 1.0f / context_->pixel_ratio());
+}
+
+void MapWidgetImpl::RequestFrame()
+{
+   // Coalesce requests with a frame which is already scheduled
+   if (frameTimer_.isActive())
+   {
+      return;
+   }
+
+   auto elapsed = std::chrono::steady_clock::now() - lastFrameTime_;
+
+   if (elapsed >= kIdleFrameInterval_)
+   {
+      widget_->update();
+   }
+   else
+   {
+      // Limit the frame rate while the map is idle
+      frameTimer_.start(std::chrono::ceil<std::chrono::milliseconds>(
+         kIdleFrameInterval_ - elapsed));
+   }
+}
+
 void MapWidgetImpl::Update()
 {
    QMetaObject::invokeMethod(
@@ -8,10 +8,15 @@
 #include <scwx/qt/types/text_event_key.hpp>
 
 #include <chrono>
+#include <functional>
+#include <future>
 #include <memory>
+#include <optional>
+#include <utility>
 
 #include <qmaplibre.hpp>
 
+#include <QImage>
 #include <QOpenGLWidget>
 #include <QPropertyAnimation>
 #include <QtGlobal>
@@ -34,6 +39,13 @@ class MapWidget : public QOpenGLWidget
    Q_OBJECT
 
 public:
+   /**
+    * @brief Receives a captured frame, with rows ordered from bottom to top.
+    * Called from the render thread, so frames should be processed elsewhere.
+    */
+   typedef std::function<void(QImage image, std::uint64_t tag)>
+      CaptureCallback;
+
    explicit MapWidget(std::size_t id, const QMapLibre::Settings&);
    ~MapWidget();
 
@@ -44,15 +56,53 @@ public:
    [[nodiscard]] float                     GetElevation() const;
    [[nodiscard]] std::vector<float>        GetElevationCuts() const;
    [[nodiscard]] std::vector<std::string>  GetLevel3Products();
+   [[nodiscard]] std::uint64_t             GetLevel3ProductsVersion() const;
    [[nodiscard]] std::string               GetMapStyle() const;
+   [[nodiscard]] std::string               GetMapStyleUrl() const;
    [[nodiscard]] common::RadarProductGroup GetRadarProductGroup() const;
    [[nodiscard]] std::string               GetRadarProductName() const;
    [[nodiscard]] std::shared_ptr<config::RadarSite> GetRadarSite() const;
    [[nodiscard]] bool GetRadarWireframeEnabled() const;
    [[nodiscard]] std::chrono::system_clock::time_point GetSelectedTime() const;
    [[nodiscard]] bool          GetSmoothingEnabled() const;
+   [[nodiscard]] std::uint16_t GetThresholdLevel() const;
    [[nodiscard]] std::uint16_t GetVcp() const;
 
+   /**
+    * @brief Gets the range of data levels of the radar product, over which a
+    * display threshold may be set.
+    *
+    * @return Minimum and maximum data level, if a radar product is selected
+    */
+   [[nodiscard]] std::optional<std::pair<std::uint16_t, std::uint16_t>>
+   GetDataLevelRange() const;
+
+   /**
+    * @brief Formats the data value of a data level of the radar product for
+    * display, in the selected units.
+    *
+    * @param [in] level Data level
+    *
+    * @return Formatted data value, or an empty string if the level has no value
+    */
+   [[nodiscard]] std::string GetDataLevelText(std::uint16_t level) const;
+
+   /**
+    * @brief Gets the line along which a vertical cross section is sampled.
+    *
+    * @return Start and end of the line, if a line has been drawn
+    */
+   [[nodiscard]] std::optional<
+      std::pair<common::Coordinate, common::Coordinate>>
+   GetCrossSectionLine() const;
+
+   /**
+    * @brief Gets the level 2 volume associated with the selected time.
+    *
+    * @return Level 2 volume, or nullptr if none is loaded
+    */
+   [[nodiscard]] std::shared_ptr<wsr88d::Ar2vFile> GetLevel2Volume() const;
+
    void SelectElevation(float elevation);
 
    /**
@@ -98,10 +148,51 @@ public:
     */
    void SelectTime(std::chrono::system_clock::time_point time);
 
+   /**
+    * @brief Requests a repaint of the map. Requests are coalesced, and limited
+    * to an idle frame rate. Map interaction is repainted immediately.
+    */
+   void RequestFrame();
+
+   /**
+    * @brief Starts capturing frames for export. While capturing, the map is
+    * rendered offscreen at the capture size, and scaled to fit the widget.
+    *
+    * @param [in] size Size of captured frames in pixels
+    * @param [in] callback Receives each captured frame
+    */
+   void StartCapture(QSize size, CaptureCallback callback);
+
+   /**
+    * @brief Captures the next frame painted, while capture is started. The
+    * frame is read back asynchronously, without stalling rendering. May be
+    * called from any thread.
+    *
+    * @param [in] tag Identifies the frame to the capture callback
+    *
+    * @return Future completed once the frame has been painted
+    */
+   std::future<void> CaptureFrame(std::uint64_t tag);
+
+   /**
+    * @brief Stops capturing frames, completing frames being read back.
+    */
+   void StopCapture();
+
    void SetActive(bool isActive);
    void SetAutoRefresh(bool enabled);
    void SetAutoUpdate(bool enabled);
 
+   /**
+    * @brief Enables drawing a cross section line. While enabled, a line is
+    * drawn by dragging the map with the shift key held, and an endpoint of
+    * the line is moved by dragging it with the shift key held. The line is
+    * hidden while disabled.
+    *
+    * @param [in] enabled Whether a cross section line may be drawn
+    */
+   void SetCrossSectionEnabled(bool enabled);
+
    /**
     * @brief Sets the current map location.
     *
@@ -123,6 +214,13 @@ public:
    void SetRadarWireframeEnabled(bool enabled);
    void SetSmoothingEnabled(bool enabled);
 
+   /**
+    * @brief Sets the data level below which radar bins are hidden.
+    *
+    * @param [in] level Threshold data level, or 0 to show all bins
+    */
+   void SetThresholdLevel(std::uint16_t level);
+
    /**
     * Updates the coordinates associated with mouse movement from another map.
     *
@@ -142,6 +240,7 @@ private:
    void leaveEvent(QEvent* ev) override final;
    void mousePressEvent(QMouseEvent* ev) override final;
    void mouseMoveEvent(QMouseEvent* ev) override final;
+   void mouseReleaseEvent(QMouseEvent* ev) override final;
    void wheelEvent(QWheelEvent* ev) override final;
 
    // QOpenGLWidget implementation.
@@ -157,6 +256,16 @@ private slots:
 
 signals:
    void AlertSelected(const types::TextEventKey& key);
+
+   /**
+    * @brief Emitted while the cross section line is drawn or moved.
+    *
+    * @param [in] start Start of the line
+    * @param [in] end End of the line
+    */
+   void CrossSectionLineChanged(common::Coordinate start,
+                                common::Coordinate end);
+
    void Level3ProductsChanged();
    void MapParametersChanged(double latitude,
                              double longitude,
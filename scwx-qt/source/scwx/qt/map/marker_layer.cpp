@@ -5,6 +5,8 @@
 #include <scwx/qt/types/texture_types.hpp>
 #include <scwx/qt/gl/draw/geo_icons.hpp>
 
+#include <unordered_map>
+
 namespace scwx
 {
 namespace qt
@@ -27,12 +29,19 @@ public:
 
    void ReloadMarkers();
    void ConnectSignals();
+   void AddMarker(types::MarkerId id);
+   void UpdateMarker(types::MarkerId id);
+   void RemoveMarker(types::MarkerId id);
 
    MarkerLayer* self_;
    const std::string& markerIconName_ {
       types::GetTextureName(types::ImageTexture::LocationMarker)};
 
    std::shared_ptr<gl::draw::GeoIcons> geoIcons_;
+
+   std::unordered_map<types::MarkerId,
+                      std::shared_ptr<gl::draw::GeoIconDrawItem>>
+      markerIcons_ {};
 };
 
 void MarkerLayer::Impl::ConnectSignals()
@@ -46,6 +55,18 @@ void MarkerLayer::Impl::ConnectSignals()
          {
             this->ReloadMarkers();
          });
+   QObject::connect(markerManager.get(),
+                    &manager::MarkerManager::MarkerAdded,
+                    self_,
+                    [this](types::MarkerId id) { AddMarker(id); });
+   QObject::connect(markerManager.get(),
+                    &manager::MarkerManager::MarkerChanged,
+                    self_,
+                    [this](types::MarkerId id) { UpdateMarker(id); });
+   QObject::connect(markerManager.get(),
+                    &manager::MarkerManager::MarkerRemoved,
+                    self_,
+                    [this](types::MarkerId id) { RemoveMarker(id); });
 }
 
 void MarkerLayer::Impl::ReloadMarkers()
@@ -54,6 +75,7 @@ void MarkerLayer::Impl::ReloadMarkers()
    auto markerManager = manager::MarkerManager::Instance();
 
    geoIcons_->StartIcons();
+   markerIcons_.clear();
 
    markerManager->for_each(
       [this](const types::MarkerInfo& marker)
@@ -61,12 +83,74 @@ void MarkerLayer::Impl::ReloadMarkers()
          std::shared_ptr<gl::draw::GeoIconDrawItem> icon = geoIcons_->AddIcon();
          geoIcons_->SetIconTexture(icon, markerIconName_, 0);
          geoIcons_->SetIconLocation(icon, marker.latitude, marker.longitude);
+         markerIcons_.insert_or_assign(marker.id, icon);
       });
 
    geoIcons_->FinishIcons();
    Q_EMIT self_->NeedsRendering();
 }
 
+void MarkerLayer::Impl::AddMarker(types::MarkerId id)
+{
+   if (markerIcons_.contains(id))
+   {
+      // The marker was added by a reload after it was created
+      UpdateMarker(id);
+      return;
+   }
+
+   auto marker = manager::MarkerManager::Instance()->get_marker(id);
+   if (!marker.has_value())
+   {
+      // The marker was removed before the notification was handled
+      return;
+   }
+
+   // Append the icon to the existing icons, without reloading every marker
+   std::shared_ptr<gl::draw::GeoIconDrawItem> icon = geoIcons_->AddIcon();
+   geoIcons_->SetIconTexture(icon, markerIconName_, 0);
+   geoIcons_->SetIconLocation(icon, marker->latitude, marker->longitude);
+   markerIcons_.emplace(id, icon);
+
+   geoIcons_->FinishIcons();
+   Q_EMIT self_->NeedsRendering();
+}
+
+void MarkerLayer::Impl::UpdateMarker(types::MarkerId id)
+{
+   auto it = markerIcons_.find(id);
+   if (it == markerIcons_.end())
+   {
+      AddMarker(id);
+      return;
+   }
+
+   auto marker = manager::MarkerManager::Instance()->get_marker(id);
+   if (!marker.has_value())
+   {
+      return;
+   }
+
+   // Only the buffers of the modified icon are updated
+   geoIcons_->SetIconLocation(it->second, marker->latitude, marker->longitude);
+   Q_EMIT self_->NeedsRendering();
+}
+
+void MarkerLayer::Impl::RemoveMarker(types::MarkerId id)
+{
+   auto it = markerIcons_.find(id);
+   if (it == markerIcons_.end())
+   {
+      return;
+   }
+
+   geoIcons_->RemoveIcon(it->second);
+   markerIcons_.erase(it);
+
+   geoIcons_->FinishIcons();
+   Q_EMIT self_->NeedsRendering();
+}
+
 MarkerLayer::MarkerLayer(const std::shared_ptr<MapContext>& context) :
     DrawLayer(context), p(std::make_unique<MarkerLayer::Impl>(this, context))
 {
@@ -1,5 +1,6 @@
 #include <scwx/qt/map/overlay_layer.hpp>
 #include <scwx/qt/gl/draw/geo_icons.hpp>
+#include <scwx/qt/gl/draw/geo_lines.hpp>
 #include <scwx/qt/gl/draw/icons.hpp>
 #include <scwx/qt/gl/draw/rectangle.hpp>
 #include <scwx/qt/manager/font_manager.hpp>
@@ -7,6 +8,8 @@
 #include <scwx/qt/map/map_settings.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/types/texture_types.hpp>
+#include <scwx/qt/util/position_filter.hpp>
+#include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/qt/view/radar_product_view.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
@@ -15,6 +18,7 @@
 #   pragma warning(push, 0)
 #endif
 
+#include <fmt/format.h>
 #include <imgui.h>
 #include <QGeoPositionInfo>
 #include <QGuiApplication>
@@ -43,6 +47,7 @@ public:
        activeBoxOuter_ {std::make_shared<gl::draw::Rectangle>(context)},
        activeBoxInner_ {std::make_shared<gl::draw::Rectangle>(context)},
        geoIcons_ {std::make_shared<gl::draw::GeoIcons>(context)},
+       geoLines_ {std::make_shared<gl::draw::GeoLines>(context)},
        icons_ {std::make_shared<gl::draw::Icons>(context)}
    {
       auto& generalSettings = settings::GeneralSettings::Instance();
@@ -100,11 +105,21 @@ public:
       manager::PositionManager::Instance()};
    QGeoPositionInfo currentPosition_ {};
 
+   // The location icon only moves when the change is visible on the map
+   util::PositionFilter locationFilter_ {
+      {.distance_  = units::length::meters<double> {5.0},
+       .interval_  = std::chrono::milliseconds {200},
+       .smoothing_ = 0.5}};
+
    std::shared_ptr<gl::draw::Rectangle> activeBoxOuter_;
    std::shared_ptr<gl::draw::Rectangle> activeBoxInner_;
    std::shared_ptr<gl::draw::GeoIcons>  geoIcons_;
+   std::shared_ptr<gl::draw::GeoLines>  geoLines_;
    std::shared_ptr<gl::draw::Icons>     icons_;
 
+   std::shared_ptr<gl::draw::GeoLineDrawItem> crossSectionBorder_ {};
+   std::shared_ptr<gl::draw::GeoLineDrawItem> crossSectionLine_ {};
+
    const std::string& locationIconName_ {
       types::GetTextureName(types::ImageTexture::Crosshairs24)};
    std::shared_ptr<gl::draw::GeoIconDrawItem> locationIcon_ {};
@@ -140,6 +155,10 @@ public:
    std::string sweepTimeString_ {};
    bool        sweepTimeNeedsUpdate_ {true};
    bool        sweepTimePicked_ {false};
+
+   // Clock format parsed from the settings variable, until its version changes
+   scwx::util::ClockFormat clockFormat_ {};
+   std::uint64_t           clockFormatVersion_ {0u};
 };
 
 OverlayLayer::OverlayLayer(std::shared_ptr<MapContext> context) :
@@ -147,6 +166,7 @@ OverlayLayer::OverlayLayer(std::shared_ptr<MapContext> context) :
 {
    AddDrawItem(p->activeBoxOuter_);
    AddDrawItem(p->activeBoxInner_);
+   AddDrawItem(p->geoLines_);
    AddDrawItem(p->geoIcons_);
    AddDrawItem(p->icons_);
 
@@ -173,6 +193,16 @@ void OverlayLayer::Initialize()
 
    p->currentPosition_ = p->positionManager_->position();
    auto coordinate     = p->currentPosition_.coordinate();
+   p->locationFilter_.Reset();
+
+   // Load the overlay textures together, rather than as each is referenced
+   util::TextureAtlas::Instance().LoadTextures({p->cursorIconName_,
+                                                p->locationIconName_,
+                                                p->cardinalPointIconName_,
+                                                p->compassIconName_,
+                                                p->mapCenterIconName_,
+                                                p->mapboxLogoImageName_,
+                                                p->mapTilerLogoImageName_});
 
    // Geo Icons
    p->geoIcons_->StartIconSheets();
@@ -194,6 +224,23 @@ void OverlayLayer::Initialize()
 
    p->geoIcons_->FinishIcons();
 
+   // Geo Lines
+   p->geoLines_->StartLines();
+
+   p->crossSectionBorder_ = p->geoLines_->AddLine();
+   p->geoLines_->SetLineModulate(p->crossSectionBorder_,
+                                 boost::gil::rgba8_pixel_t {0, 0, 0, 255});
+   p->geoLines_->SetLineWidth(p->crossSectionBorder_, 5.0f);
+   p->geoLines_->SetLineVisible(p->crossSectionBorder_, false);
+
+   p->crossSectionLine_ = p->geoLines_->AddLine();
+   p->geoLines_->SetLineModulate(
+      p->crossSectionLine_, boost::gil::rgba8_pixel_t {255, 255, 255, 255});
+   p->geoLines_->SetLineWidth(p->crossSectionLine_, 3.0f);
+   p->geoLines_->SetLineVisible(p->crossSectionLine_, false);
+
+   p->geoLines_->FinishLines();
+
    // Icons
    p->icons_->StartIconSheets();
    p->icons_->AddIconSheet(p->cardinalPointIconName_);
@@ -274,11 +321,13 @@ void OverlayLayer::Initialize()
            {
               auto coordinate = position.coordinate();
               if (position.isValid() &&
-                  p->currentPosition_.coordinate() != coordinate)
+                  p->locationFilter_.Update(
+                     {coordinate.latitude(), coordinate.longitude()}, {}))
               {
+                 auto filtered = *p->locationFilter_.coordinate();
                  p->geoIcons_->SetIconLocation(p->locationIcon_,
-                                               coordinate.latitude(),
-                                               coordinate.longitude());
+                                               filtered.latitude_,
+                                               filtered.longitude_);
                  Q_EMIT NeedsRendering();
               }
               p->currentPosition_ = position;
@@ -298,8 +347,15 @@ void OverlayLayer::Render(const QMapLibre::CustomLayerRenderParameters& params)
 
    if (radarProductView != nullptr)
    {
-      scwx::util::ClockFormat clockFormat = scwx::util::GetClockFormat(
-         settings::GeneralSettings::Instance().clock_format().GetValue());
+      auto& clockFormatVariable =
+         settings::GeneralSettings::Instance().clock_format();
+      if (clockFormatVariable.version() != p->clockFormatVersion_)
+      {
+         p->clockFormatVersion_ = clockFormatVariable.version();
+         p->clockFormat_ =
+            scwx::util::GetClockFormat(clockFormatVariable.GetValue());
+      }
+      const scwx::util::ClockFormat clockFormat = p->clockFormat_;
 
       auto radarProductManager = radarProductView->radar_product_manager();
 
@@ -343,6 +399,21 @@ void OverlayLayer::Render(const QMapLibre::CustomLayerRenderParameters& params)
          p->cursorIcon_, mouseCoordinate.latitude_, mouseCoordinate.longitude_);
    }
 
+   // Cross Section Line
+   for (auto& line : {p->crossSectionBorder_, p->crossSectionLine_})
+   {
+      p->geoLines_->SetLineVisible(line, settings.crossSectionVisible_);
+      if (settings.crossSectionVisible_)
+      {
+         p->geoLines_->SetLineLocation(
+            line,
+            static_cast<float>(settings.crossSectionStart_.latitude_),
+            static_cast<float>(settings.crossSectionStart_.longitude_),
+            static_cast<float>(settings.crossSectionEnd_.latitude_),
+            static_cast<float>(settings.crossSectionEnd_.longitude_));
+      }
+   }
+
    // Location Icon
    p->geoIcons_->SetIconVisible(p->locationIcon_,
                                 p->currentPosition_.isValid() &&
@@ -429,6 +500,36 @@ void OverlayLayer::Render(const QMapLibre::CustomLayerRenderParameters& params)
                ImGui::EndTable();
             }
          }
+
+         // Show the time from the scan to each stage of display
+         const types::ProductLatency latency = context()->product_latency();
+         if (latency.productTime_ != std::chrono::system_clock::time_point {})
+         {
+            ImGui::Separator();
+            ImGui::TextUnformatted("Latency");
+
+            if (ImGui::BeginTable("Latency", 2))
+            {
+               for (auto stage : types::LatencyStageIterator())
+               {
+                  auto        stageLatency = latency.latency(stage);
+                  std::string latencyString {"-"};
+                  if (stageLatency.has_value())
+                  {
+                     latencyString = fmt::format(
+                        "{:.1f} s", stageLatency->count() / 1000.0);
+                  }
+
+                  ImGui::TableNextRow();
+                  ImGui::TableNextColumn();
+                  ImGui::TextUnformatted(
+                     types::GetLatencyStageName(stage).c_str());
+                  ImGui::TableNextColumn();
+                  ImGui::TextUnformatted(latencyString.c_str());
+               }
+               ImGui::EndTable();
+            }
+         }
       }
       else
       {
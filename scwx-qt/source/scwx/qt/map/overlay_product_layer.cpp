@@ -11,6 +11,9 @@
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
+#include <map>
+
 namespace scwx
 {
 namespace qt
@@ -21,6 +24,22 @@ namespace map
 static const std::string logPrefix_ = "scwx::qt::map::overlay_product_layer";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+struct StormCellVector
+{
+   std::shared_ptr<const wsr88d::rpg::LinkedVectorPacket> packet_ {};
+   boost::gil::rgba32f_pixel_t                            color_ {};
+   units::length::nautical_miles<float>                   tickRadius_ {};
+   units::length::nautical_miles<float> tickRadiusIncrement_ {};
+
+   std::shared_ptr<gl::draw::LinkedVectorDrawItem> drawItem_ {};
+};
+
+struct StormCell
+{
+   std::string                  hoverText_ {};
+   std::vector<StormCellVector> vectors_ {};
+};
+
 class OverlayProductLayer::Impl
 {
 public:
@@ -68,20 +87,28 @@ public:
 
    static void HandleLinkedVectorPacket(
       const std::shared_ptr<const wsr88d::rpg::Packet>& packet,
-      const common::Coordinate&                         center,
-      const std::string&                                hoverText,
       boost::gil::rgba32f_pixel_t                       color,
       units::length::nautical_miles<float>              tickRadius,
       units::length::nautical_miles<float>              tickRadiusIncrement,
-      std::shared_ptr<gl::draw::LinkedVectors>&         linkedVectors);
+      StormCell&                                        stormCell);
    void HandleScitDataPacket(
       const std::shared_ptr<const wsr88d::rpg::StormTrackingInformationMessage>&
                                                         sti,
       const std::shared_ptr<const wsr88d::rpg::Packet>& packet,
-      const common::Coordinate&                         center,
       const std::string&                                stormId,
-      const std::string&                                hoverText,
-      std::shared_ptr<gl::draw::LinkedVectors>&         linkedVectors);
+      StormCell&                                        stormCell);
+
+   bool UpdateStormCells(std::map<std::string, StormCell>& stormCells,
+                         const common::Coordinate&         center);
+   void AddStormCells(std::map<std::string, StormCell>& stormCells,
+                      const common::Coordinate&         center);
+
+   static void SetVectorProperties(const StormCell&       stormCell,
+                                   const StormCellVector& vector);
+   static bool IsCellModified(const StormCell& previous,
+                              const StormCell& current);
+   static bool IsCellStructureEqual(const StormCell& previous,
+                                    const StormCell& current);
 
    static void HandleStormIdPacket(
       const std::shared_ptr<const wsr88d::rpg::StormTrackingInformationMessage>&
@@ -106,6 +133,10 @@ public:
    bool stiNeedsUpdate_ {false};
 
    std::shared_ptr<gl::draw::LinkedVectors> linkedVectors_;
+
+   // Storm cells currently drawn, by storm ID
+   std::map<std::string, StormCell> stormCells_ {};
+   common::Coordinate               stormCellCenter_ {0.0, 0.0};
 };
 
 OverlayProductLayer::OverlayProductLayer(std::shared_ptr<MapContext> context) :
@@ -185,7 +216,7 @@ void OverlayProductLayer::Impl::UpdateStormTrackingInformation()
       psb = sti->symbology_block();
    }
 
-   linkedVectors_->StartVectors();
+   std::map<std::string, StormCell> stormCells {};
 
    if (psb != nullptr)
    {
@@ -212,23 +243,21 @@ void OverlayProductLayer::Impl::UpdateStormTrackingInformation()
             {
             case static_cast<std::uint16_t>(wsr88d::rpg::PacketCode::StormId):
                HandleStormIdPacket(sti, packet, stormId, hoverText);
+               stormCells[stormId].hoverText_ = hoverText;
                break;
 
             case static_cast<std::uint16_t>(
                wsr88d::rpg::PacketCode::ScitPastData):
             case static_cast<std::uint16_t>(
                wsr88d::rpg::PacketCode::ScitForecastData):
-               HandleScitDataPacket(sti,
-                                    packet,
-                                    {latitude, longitude},
-                                    stormId,
-                                    hoverText,
-                                    linkedVectors_);
+               HandleScitDataPacket(
+                  sti, packet, stormId, stormCells[stormId]);
                break;
 
             default:
-               logger_->trace("Ignoring packet type: {}",
-                              packet->packet_code());
+               SPDLOG_LOGGER_TRACE(logger_,
+                                   "Ignoring packet type: {}",
+                                   packet->packet_code());
                break;
             }
          }
@@ -236,12 +265,149 @@ void OverlayProductLayer::Impl::UpdateStormTrackingInformation()
    }
    else
    {
-      logger_->trace("No Storm Tracking Information found");
+      SPDLOG_LOGGER_TRACE(logger_, "No Storm Tracking Information found");
+   }
+
+   const common::Coordinate center {latitude, longitude};
+
+   // Update only the modified storm cells if possible, otherwise rebuild
+   if (!UpdateStormCells(stormCells, center))
+   {
+      AddStormCells(stormCells, center);
+   }
+
+   stormCells_      = std::move(stormCells);
+   stormCellCenter_ = center;
+}
+
+bool OverlayProductLayer::Impl::UpdateStormCells(
+   std::map<std::string, StormCell>& stormCells,
+   const common::Coordinate&         center)
+{
+   // Storm cells can be updated in place if the same cells are present, with
+   // the same number of vectors and line segments
+   if (stormCells_.empty() || center != stormCellCenter_ ||
+       !std::equal(stormCells.cbegin(),
+                   stormCells.cend(),
+                   stormCells_.cbegin(),
+                   stormCells_.cend(),
+                   [](const auto& current, const auto& previous)
+                   {
+                      return current.first == previous.first &&
+                             IsCellStructureEqual(previous.second,
+                                                  current.second);
+                   }))
+   {
+      return false;
+   }
+
+   std::size_t modifiedCount = 0;
+
+   for (auto& [stormId, stormCell] : stormCells)
+   {
+      StormCell& previousCell = stormCells_.at(stormId);
+
+      for (std::size_t i = 0; i < stormCell.vectors_.size(); ++i)
+      {
+         stormCell.vectors_[i].drawItem_ = previousCell.vectors_[i].drawItem_;
+      }
+
+      if (!IsCellModified(previousCell, stormCell))
+      {
+         continue;
+      }
+
+      ++modifiedCount;
+
+      for (auto& vector : stormCell.vectors_)
+      {
+         SetVectorProperties(stormCell, vector);
+
+         if (!linkedVectors_->UpdateVector(
+                vector.drawItem_, center, vector.packet_))
+         {
+            return false;
+         }
+      }
+   }
+
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Updated {} of {} storm cells in place",
+                       modifiedCount,
+                       stormCells.size());
+
+   return true;
+}
+
+void OverlayProductLayer::Impl::AddStormCells(
+   std::map<std::string, StormCell>& stormCells,
+   const common::Coordinate&         center)
+{
+   linkedVectors_->StartVectors();
+
+   for (auto& stormCell : stormCells)
+   {
+      for (auto& vector : stormCell.second.vectors_)
+      {
+         vector.drawItem_ = linkedVectors_->AddVector(center, vector.packet_);
+         SetVectorProperties(stormCell.second, vector);
+      }
    }
 
    linkedVectors_->FinishVectors();
 }
 
+void OverlayProductLayer::Impl::SetVectorProperties(
+   const StormCell& stormCell, const StormCellVector& vector)
+{
+   auto& di = vector.drawItem_;
+
+   gl::draw::LinkedVectors::SetVectorWidth(di, 1.0f);
+   gl::draw::LinkedVectors::SetVectorModulate(di, vector.color_);
+   gl::draw::LinkedVectors::SetVectorHoverText(di, stormCell.hoverText_);
+   gl::draw::LinkedVectors::SetVectorTicksEnabled(di, true);
+   gl::draw::LinkedVectors::SetVectorTickRadius(di, vector.tickRadius_);
+   gl::draw::LinkedVectors::SetVectorTickRadiusIncrement(
+      di, vector.tickRadiusIncrement_);
+}
+
+bool OverlayProductLayer::Impl::IsCellStructureEqual(const StormCell& previous,
+                                                     const StormCell& current)
+{
+   return std::equal(previous.vectors_.cbegin(),
+                     previous.vectors_.cend(),
+                     current.vectors_.cbegin(),
+                     current.vectors_.cend(),
+                     [](const auto& v1, const auto& v2)
+                     {
+                        return v1.drawItem_ != nullptr &&
+                               v1.packet_->end_i().size() ==
+                                  v2.packet_->end_i().size();
+                     });
+}
+
+bool OverlayProductLayer::Impl::IsCellModified(const StormCell& previous,
+                                               const StormCell& current)
+{
+   auto IsVectorEqual = [](const StormCellVector& v1, const StormCellVector& v2)
+   {
+      const auto& p1 = v1.packet_;
+      const auto& p2 = v2.packet_;
+
+      return v1.color_ == v2.color_ && v1.tickRadius_ == v2.tickRadius_ &&
+             v1.tickRadiusIncrement_ == v2.tickRadiusIncrement_ &&
+             p1->start_i() == p2->start_i() && p1->start_j() == p2->start_j() &&
+             p1->end_i() == p2->end_i() && p1->end_j() == p2->end_j();
+   };
+
+   return previous.hoverText_ != current.hoverText_ ||
+          !std::equal(previous.vectors_.cbegin(),
+                      previous.vectors_.cend(),
+                      current.vectors_.cbegin(),
+                      current.vectors_.cend(),
+                      IsVectorEqual);
+}
+
 void OverlayProductLayer::Impl::HandleStormIdPacket(
    const std::shared_ptr<const wsr88d::rpg::StormTrackingInformationMessage>&
                                                      sti,
@@ -270,10 +436,8 @@ void OverlayProductLayer::Impl::HandleScitDataPacket(
    const std::shared_ptr<const wsr88d::rpg::StormTrackingInformationMessage>&
                                                      sti,
    const std::shared_ptr<const wsr88d::rpg::Packet>& packet,
-   const common::Coordinate&                         center,
    const std::string&                                stormId,
-   const std::string&                                hoverText,
-   std::shared_ptr<gl::draw::LinkedVectors>&         linkedVectors)
+   StormCell&                                        stormCell)
 {
    auto scitDataPacket =
       std::dynamic_pointer_cast<const wsr88d::rpg::ScitDataPacket>(packet);
@@ -322,17 +486,16 @@ void OverlayProductLayer::Impl::HandleScitDataPacket(
          case static_cast<std::uint16_t>(
             wsr88d::rpg::PacketCode::LinkedVectorNoValue):
             HandleLinkedVectorPacket(subpacket,
-                                     center,
-                                     hoverText,
                                      color,
                                      tickRadius,
                                      tickRadiusIncrement,
-                                     linkedVectors);
+                                     stormCell);
             break;
 
          default:
-            logger_->trace("Ignoring SCIT subpacket type: {}",
-                           subpacket->packet_code());
+            SPDLOG_LOGGER_TRACE(logger_,
+                                "Ignoring SCIT subpacket type: {}",
+                                subpacket->packet_code());
             break;
          }
       }
@@ -345,26 +508,18 @@ void OverlayProductLayer::Impl::HandleScitDataPacket(
 
 void OverlayProductLayer::Impl::HandleLinkedVectorPacket(
    const std::shared_ptr<const wsr88d::rpg::Packet>& packet,
-   const common::Coordinate&                         center,
-   const std::string&                                hoverText,
    boost::gil::rgba32f_pixel_t                       color,
    units::length::nautical_miles<float>              tickRadius,
    units::length::nautical_miles<float>              tickRadiusIncrement,
-   std::shared_ptr<gl::draw::LinkedVectors>&         linkedVectors)
+   StormCell&                                        stormCell)
 {
    auto linkedVectorPacket =
       std::dynamic_pointer_cast<const wsr88d::rpg::LinkedVectorPacket>(packet);
 
    if (linkedVectorPacket != nullptr)
    {
-      auto di = linkedVectors->AddVector(center, linkedVectorPacket);
-      gl::draw::LinkedVectors::SetVectorWidth(di, 1.0f);
-      gl::draw::LinkedVectors::SetVectorModulate(di, color);
-      gl::draw::LinkedVectors::SetVectorHoverText(di, hoverText);
-      gl::draw::LinkedVectors::SetVectorTicksEnabled(di, true);
-      gl::draw::LinkedVectors::SetVectorTickRadius(di, tickRadius);
-      gl::draw::LinkedVectors::SetVectorTickRadiusIncrement(
-         di, tickRadiusIncrement);
+      stormCell.vectors_.push_back(
+         {linkedVectorPacket, color, tickRadius, tickRadiusIncrement});
    }
    else
    {
@@ -8,9 +8,11 @@
 #include <scwx/qt/manager/placefile_manager.hpp>
 #include <scwx/qt/manager/timeline_manager.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/strand.hpp>
 
-#include <boost/asio/post.hpp>
-#include <boost/asio/thread_pool.hpp>
+#include <unordered_map>
+
+#include <boost/container_hash/hash.hpp>
 
 namespace scwx
 {
@@ -42,18 +44,25 @@ public:
    {
       ConnectSignals();
    }
-   ~Impl() { threadPool_.join(); }
+   ~Impl() { strand_.Join(); }
 
    void ConnectSignals();
    void ReloadDataSync();
 
-   boost::asio::thread_pool threadPool_ {1};
+   std::unordered_map<gr::Placefile::ItemType, std::size_t>
+   GetItemTypeHashes(const std::shared_ptr<gr::Placefile>& placefile);
+
+   scwx::util::Strand strand_ {"Placefile Layer"};
 
    PlacefileLayer* self_;
 
    std::string placefileName_;
    std::mutex  dataMutex_ {};
 
+   // Hash of the draw items of each type in the last reload
+   std::string                                              reloadedName_ {};
+   std::unordered_map<gr::Placefile::ItemType, std::size_t> itemTypeHashes_ {};
+
    std::shared_ptr<gl::draw::PlacefileIcons>     placefileIcons_;
    std::shared_ptr<gl::draw::PlacefileImages>    placefileImages_;
    std::shared_ptr<gl::draw::PlacefileLines>     placefileLines_;
@@ -76,6 +85,8 @@ PlacefileLayer::PlacefileLayer(const std::shared_ptr<MapContext>& context,
    AddDrawItem(p->placefileIcons_);
    AddDrawItem(p->placefileText_);
 
+   EnableDynamicResolution();
+
    ReloadData();
 }
 
@@ -164,22 +175,15 @@ void PlacefileLayer::Deinitialize()
    logger_->debug("Deinitialize()");
 
    DrawLayer::Deinitialize();
+
+   // Draw items no longer hold the last reload
+   std::unique_lock lock {p->dataMutex_};
+   p->itemTypeHashes_.clear();
 }
 
 void PlacefileLayer::ReloadData()
 {
-   boost::asio::post(p->threadPool_,
-                     [this]()
-                     {
-                        try
-                        {
-                           p->ReloadDataSync();
-                        }
-                        catch (const std::exception& ex)
-                        {
-                           logger_->error(ex.what());
-                        }
-                     });
+   p->strand_.Post([this]() { p->ReloadDataSync(); });
 }
 
 void PlacefileLayer::Impl::ReloadDataSync()
@@ -197,19 +201,67 @@ void PlacefileLayer::Impl::ReloadDataSync()
       return;
    }
 
+   // Only rebuild draw items whose placefile items have changed
+   auto itemTypeHashes = GetItemTypeHashes(placefile);
+   if (placefile->name() != reloadedName_)
+   {
+      itemTypeHashes_.clear();
+   }
+
+   auto changed = [&](gr::Placefile::ItemType itemType)
+   {
+      // Text is always rebuilt, as placefile fonts may have been reloaded
+      if (itemType == gr::Placefile::ItemType::Text)
+      {
+         return true;
+      }
+
+      auto newIt = itemTypeHashes.find(itemType);
+      auto oldIt = itemTypeHashes_.find(itemType);
+      return (newIt == itemTypeHashes.cend()) !=
+                (oldIt == itemTypeHashes_.cend()) ||
+             (newIt != itemTypeHashes.cend() && newIt->second != oldIt->second);
+   };
+
+   const bool iconsChanged     = changed(gr::Placefile::ItemType::Icon);
+   const bool imagesChanged    = changed(gr::Placefile::ItemType::Image);
+   const bool linesChanged     = changed(gr::Placefile::ItemType::Line);
+   const bool polygonsChanged  = changed(gr::Placefile::ItemType::Polygon);
+   const bool trianglesChanged = changed(gr::Placefile::ItemType::Triangles);
+
    // Start draw items
-   placefileIcons_->StartIcons();
-   placefileImages_->StartImages(placefile->name());
-   placefileLines_->StartLines();
-   placefilePolygons_->StartPolygons();
-   placefileTriangles_->StartTriangles();
+   if (iconsChanged)
+   {
+      placefileIcons_->StartIcons();
+      placefileIcons_->SetIconFiles(placefile->icon_files(),
+                                    placefile->name());
+   }
+   if (imagesChanged)
+   {
+      placefileImages_->StartImages(placefile->name());
+   }
+   if (linesChanged)
+   {
+      placefileLines_->StartLines();
+   }
+   if (polygonsChanged)
+   {
+      placefilePolygons_->StartPolygons();
+   }
+   if (trianglesChanged)
+   {
+      placefileTriangles_->StartTriangles();
+   }
    placefileText_->StartText();
-
-   placefileIcons_->SetIconFiles(placefile->icon_files(), placefile->name());
    placefileText_->SetFonts(placefileManager->placefile_fonts(placefileName_));
 
    for (auto& drawItem : placefile->GetDrawItems())
    {
+      if (!changed(drawItem->itemType_))
+      {
+         continue;
+      }
+
       switch (drawItem->itemType_)
       {
       case gr::Placefile::ItemType::Text:
@@ -249,16 +301,61 @@ void PlacefileLayer::Impl::ReloadDataSync()
    }
 
    // Finish draw items
-   placefileIcons_->FinishIcons();
-   placefileImages_->FinishImages();
-   placefileLines_->FinishLines();
-   placefilePolygons_->FinishPolygons();
-   placefileTriangles_->FinishTriangles();
+   if (iconsChanged)
+   {
+      placefileIcons_->FinishIcons();
+   }
+   if (imagesChanged)
+   {
+      placefileImages_->FinishImages();
+   }
+   if (linesChanged)
+   {
+      placefileLines_->FinishLines();
+   }
+   if (polygonsChanged)
+   {
+      placefilePolygons_->FinishPolygons();
+   }
+   if (trianglesChanged)
+   {
+      placefileTriangles_->FinishTriangles();
+   }
    placefileText_->FinishText();
 
+   reloadedName_ = placefile->name();
+   itemTypeHashes_.swap(itemTypeHashes);
+
    Q_EMIT self_->DataReloaded();
 }
 
+std::unordered_map<gr::Placefile::ItemType, std::size_t>
+PlacefileLayer::Impl::GetItemTypeHashes(
+   const std::shared_ptr<gr::Placefile>& placefile)
+{
+   std::unordered_map<gr::Placefile::ItemType, std::size_t> hashes {};
+
+   // Icons also depend on the icon files
+   for (auto& iconFile : placefile->icon_files())
+   {
+      std::size_t& seed = hashes[gr::Placefile::ItemType::Icon];
+      boost::hash_combine(seed, iconFile->fileNumber_);
+      boost::hash_combine(seed, iconFile->iconWidth_);
+      boost::hash_combine(seed, iconFile->iconHeight_);
+      boost::hash_combine(seed, iconFile->hotX_);
+      boost::hash_combine(seed, iconFile->hotY_);
+      boost::hash_combine(seed, iconFile->filename_);
+   }
+
+   for (auto& drawItem : placefile->GetDrawItems())
+   {
+      boost::hash_combine(hashes[drawItem->itemType_],
+                          gr::Placefile::GetDrawItemHash(*drawItem));
+   }
+
+   return hashes;
+}
+
 } // namespace map
 } // namespace qt
 } // namespace scwx
@@ -0,0 +1,601 @@
+#include <scwx/qt/map/radar_mosaic_layer.hpp>
+#include <scwx/qt/gl/shader_program.hpp>
+#include <scwx/qt/manager/radar_mosaic_manager.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/qt/types/mosaic_types.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/maplibre.hpp>
+#include <scwx/util/logger.hpp>
+
+#if defined(_MSC_VER)
+#   pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <numbers>
+#include <set>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <mbgl/util/constants.hpp>
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+namespace scwx
+{
+namespace qt
+{
+namespace map
+{
+
+static const std::string logPrefix_ = "scwx::qt::map::radar_mosaic_layer";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Scale applied to the sweep range when bounding the sweep quad
+static constexpr double kSweepQuadRangeScale_ = 1.02;
+
+// Each sweep quad is two triangles of latitude, longitude pairs
+static constexpr std::size_t kQuadVertices_ = 6u;
+static constexpr std::size_t kQuadFloats_   = kQuadVertices_ * 2u;
+
+class RadarMosaicLayer::Impl
+{
+public:
+   explicit Impl() :
+       radarMosaicManager_ {manager::RadarMosaicManager::Instance()}
+   {
+   }
+   ~Impl() = default;
+
+   struct SiteSweep
+   {
+      std::shared_ptr<const util::MosaicSweep> sweep_ {};
+      GLuint                                   texture_ {GL_INVALID_INDEX};
+      std::array<float, kQuadFloats_>          quad_ {};
+      glm::vec2                                earthRadii_ {};
+   };
+
+   void BufferSweepQuads(gl::OpenGLFunctions& gl);
+   void DeleteSiteSweeps(gl::OpenGLFunctions& gl);
+   void UpdateColorTable(gl::OpenGLFunctions& gl);
+   bool UpdateMosaicTexture(gl::OpenGLFunctions& gl,
+                            GLsizei              width,
+                            GLsizei              height);
+   void UpdateSites(gl::OpenGLFunctions& gl);
+   void UpdateSiteSweep(gl::OpenGLFunctions&                     gl,
+                        SiteSweep&                               siteSweep,
+                        std::shared_ptr<const util::MosaicSweep> sweep);
+
+   std::shared_ptr<manager::RadarMosaicManager> radarMosaicManager_;
+
+   std::shared_ptr<gl::ShaderProgram> mosaicShaderProgram_ {nullptr};
+   std::shared_ptr<gl::ShaderProgram> compositeShaderProgram_ {nullptr};
+
+   GLint uMVPMatrixLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uMapScreenCoordLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uRadarLatLongLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uEarthRadiiLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uFirstGateRangeLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uGateSizeMetersLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uNearestRadarLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uViewportOriginLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+   GLint uColorTableMinLocation_ {static_cast<GLint>(GL_INVALID_INDEX)};
+
+   GLuint vbo_ {GL_INVALID_INDEX};
+   GLuint vao_ {GL_INVALID_INDEX};
+   GLuint compositeVao_ {GL_INVALID_INDEX};
+   GLuint framebuffer_ {GL_INVALID_INDEX};
+   GLuint mosaicTexture_ {GL_INVALID_INDEX};
+   GLuint colorTableTexture_ {GL_INVALID_INDEX};
+
+   GLsizei mosaicTextureWidth_ {0};
+   GLsizei mosaicTextureHeight_ {0};
+
+   bool          colorTableLoaded_ {false};
+   std::uint16_t colorTableMin_ {};
+
+   // Blend mode parsed from the settings variable, until its version changes
+   types::MosaicBlendMode blendMode_ {types::MosaicBlendMode::Unknown};
+   std::uint64_t          blendModeVersion_ {0u};
+
+   // Sweeps are drawn in order of radar site, and their quads are buffered in
+   // the same order
+   std::map<std::string, SiteSweep> siteSweeps_ {};
+
+   std::mutex            updatedSitesMutex_ {};
+   std::set<std::string> updatedSites_ {};
+   std::atomic<bool>     colorTableNeedsUpdate_ {true};
+};
+
+RadarMosaicLayer::RadarMosaicLayer(std::shared_ptr<MapContext> context) :
+    GenericLayer(context), p(std::make_unique<Impl>())
+{
+   // Sweeps are updated from worker threads, and uploaded when rendered
+   connect(p->radarMosaicManager_.get(),
+           &manager::RadarMosaicManager::SweepUpdated,
+           this,
+           [this](const std::string& radarId)
+           {
+              {
+                 std::unique_lock lock {p->updatedSitesMutex_};
+                 p->updatedSites_.insert(radarId);
+              }
+              Q_EMIT NeedsRendering();
+           });
+   connect(p->radarMosaicManager_.get(),
+           &manager::RadarMosaicManager::ColorTableLutUpdated,
+           this,
+           [this]()
+           {
+              p->colorTableNeedsUpdate_ = true;
+              Q_EMIT NeedsRendering();
+           });
+}
+RadarMosaicLayer::~RadarMosaicLayer() = default;
+
+void RadarMosaicLayer::Initialize()
+{
+   logger_->debug("Initialize()");
+
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   // Load and configure the mosaic shader, which draws each radar site into the
+   // offscreen mosaic
+   p->mosaicShaderProgram_ = context()->GetShaderProgram(
+      ":/gl/radar_mosaic.vert", ":/gl/radar_mosaic.frag");
+
+   p->uMVPMatrixLocation_ =
+      p->mosaicShaderProgram_->GetUniformLocation("uMVPMatrix");
+   p->uMapScreenCoordLocation_ =
+      p->mosaicShaderProgram_->GetUniformLocation("uMapScreenCoord");
+   p->uRadarLatLongLocation_ =
+      p->mosaicShaderProgram_->GetUniformLocation("uRadarLatLong");
+   p->uEarthRadiiLocation_ =
+      p->mosaicShaderProgram_->GetUniformLocation("uEarthRadii");
+   p->uFirstGateRangeLocation_ =
+      p->mosaicShaderProgram_->GetUniformLocation("uFirstGateRange");
+   p->uGateSizeMetersLocation_ =
+      p->mosaicShaderProgram_->GetUniformLocation("uGateSizeMeters");
+   p->uNearestRadarLocation_ =
+      p->mosaicShaderProgram_->GetUniformLocation("uNearestRadar");
+
+   p->mosaicShaderProgram_->Use();
+   gl.glUniform1i(
+      p->mosaicShaderProgram_->GetUniformLocation("uMomentTexture"), 0);
+
+   // Load and configure the composite shader, which colors the mosaic
+   p->compositeShaderProgram_ =
+      context()->GetShaderProgram(":/gl/radar_mosaic_composite.vert",
+                                  ":/gl/radar_mosaic_composite.frag");
+
+   p->uViewportOriginLocation_ =
+      p->compositeShaderProgram_->GetUniformLocation("uViewportOrigin");
+   p->uColorTableMinLocation_ =
+      p->compositeShaderProgram_->GetUniformLocation("uColorTableMin");
+
+   p->compositeShaderProgram_->Use();
+   gl.glUniform1i(
+      p->compositeShaderProgram_->GetUniformLocation("uMosaicTexture"), 0);
+   gl.glUniform1i(
+      p->compositeShaderProgram_->GetUniformLocation("uColorTable"), 1);
+
+   // Generate a vertex array object for the sweep quads
+   gl.glGenVertexArrays(1, &p->vao_);
+   gl.glGenBuffers(1, &p->vbo_);
+
+   gl.glBindVertexArray(p->vao_);
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_);
+   gl.glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
+   gl.glEnableVertexAttribArray(0);
+
+   // The full screen triangle is generated from the vertex ID, but a vertex
+   // array object must still be bound to draw
+   gl.glGenVertexArrays(1, &p->compositeVao_);
+
+   gl.glGenFramebuffers(1, &p->framebuffer_);
+   gl.glGenTextures(1, &p->mosaicTexture_);
+   gl.glGenTextures(1, &p->colorTableTexture_);
+
+   // Upload each sweep already loaded
+   {
+      std::unique_lock lock {p->updatedSitesMutex_};
+      for (auto& radarId : p->radarMosaicManager_->radar_sites())
+      {
+         p->updatedSites_.insert(radarId);
+      }
+   }
+
+   p->colorTableNeedsUpdate_ = true;
+}
+
+void RadarMosaicLayer::Render(
+   const QMapLibre::CustomLayerRenderParameters& params)
+{
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   p->UpdateSites(gl);
+
+   if (p->colorTableNeedsUpdate_)
+   {
+      p->UpdateColorTable(gl);
+   }
+
+   if (p->siteSweeps_.empty() || !p->colorTableLoaded_)
+   {
+      // Nothing to draw
+      return;
+   }
+
+   std::array<GLint, 4> viewport {};
+   gl.glGetIntegerv(GL_VIEWPORT, viewport.data());
+
+   if (!p->UpdateMosaicTexture(gl, viewport[2], viewport[3]))
+   {
+      return;
+   }
+
+   const float scale = std::pow(2.0, params.zoom) * 2.0f *
+                       mbgl::util::tileSize_D / mbgl::util::DEGREES_MAX;
+   const float xScale = scale / params.width;
+   const float yScale = scale / params.height;
+
+   glm::mat4 uMVPMatrix(1.0f);
+   uMVPMatrix = glm::scale(uMVPMatrix, glm::vec3(xScale, yScale, 1.0f));
+   uMVPMatrix = glm::rotate(uMVPMatrix,
+                            glm::radians<float>(params.bearing),
+                            glm::vec3(0.0f, 0.0f, 1.0f));
+
+   auto& blendModeVariable =
+      settings::GeneralSettings::Instance().mosaic_blend_mode();
+   if (blendModeVariable.version() != p->blendModeVersion_)
+   {
+      p->blendModeVersion_ = blendModeVariable.version();
+      p->blendMode_ =
+         types::GetMosaicBlendMode(blendModeVariable.GetValue());
+   }
+   const types::MosaicBlendMode blendMode = p->blendMode_;
+   const bool nearestRadar = blendMode != types::MosaicBlendMode::MaximumValue;
+
+   // Draw each radar site into the offscreen mosaic, keeping the maximum
+   // encoded value of each pixel
+   GLint previousFramebuffer = 0;
+   gl.glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousFramebuffer);
+
+   static constexpr std::array<GLfloat, 4> kClearValue_ {};
+
+   gl.glBindFramebuffer(GL_DRAW_FRAMEBUFFER, p->framebuffer_);
+   gl.glViewport(0, 0, viewport[2], viewport[3]);
+   gl.glClearBufferfv(GL_COLOR, 0, kClearValue_.data());
+   gl.glBlendEquation(GL_MAX);
+
+   p->mosaicShaderProgram_->Use();
+
+   gl.glUniform2fv(p->uMapScreenCoordLocation_,
+                   1,
+                   glm::value_ptr(util::maplibre::LatLongToScreenCoordinate(
+                      {params.latitude, params.longitude})));
+   gl.glUniformMatrix4fv(
+      p->uMVPMatrixLocation_, 1, GL_FALSE, glm::value_ptr(uMVPMatrix));
+   gl.glUniform1i(p->uNearestRadarLocation_, nearestRadar ? 1 : 0);
+
+   gl.glBindVertexArray(p->vao_);
+   gl.glActiveTexture(GL_TEXTURE0);
+
+   const GLsizei quadVertices = static_cast<GLsizei>(kQuadVertices_);
+   GLint         first        = 0;
+   for (auto& siteSweep : p->siteSweeps_)
+   {
+      const util::MosaicSweep& sweep = *siteSweep.second.sweep_;
+
+      gl.glUniform2f(p->uRadarLatLongLocation_,
+                     static_cast<float>(sweep.radarSite_.latitude_),
+                     static_cast<float>(sweep.radarSite_.longitude_));
+      gl.glUniform2fv(p->uEarthRadiiLocation_,
+                      1,
+                      glm::value_ptr(siteSweep.second.earthRadii_));
+      gl.glUniform1f(p->uFirstGateRangeLocation_, sweep.firstGateRange_);
+      gl.glUniform1f(p->uGateSizeMetersLocation_, sweep.gateSize_);
+
+      gl.glBindTexture(GL_TEXTURE_2D, siteSweep.second.texture_);
+      gl.glDrawArrays(GL_TRIANGLES, first, quadVertices);
+
+      first += quadVertices;
+   }
+
+   // Restore the map framebuffer, and color the mosaic
+   gl.glBindFramebuffer(GL_DRAW_FRAMEBUFFER,
+                        static_cast<GLuint>(previousFramebuffer));
+   gl.glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+   gl.glBlendEquation(GL_FUNC_ADD);
+   gl.glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+   p->compositeShaderProgram_->Use();
+
+   gl.glUniform2i(p->uViewportOriginLocation_, viewport[0], viewport[1]);
+   gl.glUniform1i(p->uColorTableMinLocation_, p->colorTableMin_);
+
+   gl.glActiveTexture(GL_TEXTURE1);
+   gl.glBindTexture(GL_TEXTURE_1D, p->colorTableTexture_);
+   gl.glActiveTexture(GL_TEXTURE0);
+   gl.glBindTexture(GL_TEXTURE_2D, p->mosaicTexture_);
+   gl.glBindVertexArray(p->compositeVao_);
+   gl.glDrawArrays(GL_TRIANGLES, 0, 3);
+
+   SCWX_GL_CHECK_ERROR();
+}
+
+void RadarMosaicLayer::Deinitialize()
+{
+   logger_->debug("Deinitialize()");
+
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   p->DeleteSiteSweeps(gl);
+
+   gl.glDeleteVertexArrays(1, &p->vao_);
+   gl.glDeleteVertexArrays(1, &p->compositeVao_);
+   gl.glDeleteBuffers(1, &p->vbo_);
+   gl.glDeleteFramebuffers(1, &p->framebuffer_);
+   gl.glDeleteTextures(1, &p->mosaicTexture_);
+   gl.glDeleteTextures(1, &p->colorTableTexture_);
+
+   p->vao_               = GL_INVALID_INDEX;
+   p->compositeVao_      = GL_INVALID_INDEX;
+   p->vbo_               = GL_INVALID_INDEX;
+   p->framebuffer_       = GL_INVALID_INDEX;
+   p->mosaicTexture_     = GL_INVALID_INDEX;
+   p->colorTableTexture_ = GL_INVALID_INDEX;
+
+   p->mosaicTextureWidth_  = 0;
+   p->mosaicTextureHeight_ = 0;
+   p->colorTableLoaded_    = false;
+}
+
+void RadarMosaicLayer::Impl::UpdateSites(gl::OpenGLFunctions& gl)
+{
+   std::set<std::string> updatedSites {};
+
+   {
+      std::unique_lock lock {updatedSitesMutex_};
+      updatedSites.swap(updatedSites_);
+   }
+
+   if (updatedSites.empty())
+   {
+      return;
+   }
+
+   // Only the sweeps of updated radar sites are uploaded
+   for (auto& radarId : updatedSites)
+   {
+      std::shared_ptr<const util::MosaicSweep> sweep =
+         radarMosaicManager_->sweep(radarId);
+      auto it = siteSweeps_.find(radarId);
+
+      if (sweep == nullptr)
+      {
+         // The radar site was removed, or its sweep is not yet loaded
+         if (it != siteSweeps_.end())
+         {
+            gl.glDeleteTextures(1, &it->second.texture_);
+            siteSweeps_.erase(it);
+         }
+      }
+      else if (it == siteSweeps_.end())
+      {
+         SiteSweep siteSweep {};
+         gl.glGenTextures(1, &siteSweep.texture_);
+         UpdateSiteSweep(gl, siteSweep, sweep);
+         siteSweeps_.emplace(radarId, siteSweep);
+      }
+      else if (it->second.sweep_ != sweep)
+      {
+         UpdateSiteSweep(gl, it->second, sweep);
+      }
+   }
+
+   BufferSweepQuads(gl);
+}
+
+void RadarMosaicLayer::Impl::UpdateSiteSweep(
+   gl::OpenGLFunctions&                     gl,
+   SiteSweep&                               siteSweep,
+   std::shared_ptr<const util::MosaicSweep> sweep)
+{
+   const double latitude  = sweep->radarSite_.latitude_;
+   const double longitude = sweep->radarSite_.longitude_;
+
+   gl.glActiveTexture(GL_TEXTURE0);
+   gl.glBindTexture(GL_TEXTURE_2D, siteSweep.texture_);
+   gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+   gl.glTexImage2D(GL_TEXTURE_2D,
+                   0,
+                   GL_R8UI,
+                   static_cast<GLsizei>(sweep->gates_),
+                   static_cast<GLsizei>(util::MosaicSweep::kAzimuthRows),
+                   0,
+                   GL_RED_INTEGER,
+                   GL_UNSIGNED_BYTE,
+                   sweep->levels_.data());
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+   gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+   // Bound the sweep by its extent in each of the principal directions
+   const auto&  geodesic = util::GeographicLib::DefaultGeodesic();
+   const double range    = sweep->max_range() * kSweepQuadRangeScale_;
+
+   double minLatitude  = latitude;
+   double maxLatitude  = latitude;
+   double minLongitude = longitude;
+   double maxLongitude = longitude;
+
+   for (double azimuth = 0.0; azimuth < 360.0; azimuth += 45.0)
+   {
+      double lat2;
+      double lon2;
+
+      geodesic.Direct(latitude, longitude, azimuth, range, lat2, lon2);
+
+      minLatitude  = std::min(minLatitude, lat2);
+      maxLatitude  = std::max(maxLatitude, lat2);
+      minLongitude = std::min(minLongitude, lon2);
+      maxLongitude = std::max(maxLongitude, lon2);
+   }
+
+   const float lat1 = static_cast<float>(minLatitude);
+   const float lat2 = static_cast<float>(maxLatitude);
+   const float lon1 = static_cast<float>(minLongitude);
+   const float lon2 = static_cast<float>(maxLongitude);
+
+   siteSweep.quad_ = {
+      lat1, lon1, lat2, lon1, lat2, lon2, lat1, lon1, lat1, lon2, lat2, lon2};
+
+   // Radii of curvature of the ellipsoid at the radar site, in the
+   // meridian (M) and prime vertical (N)
+   const double a      = geodesic.EquatorialRadius();
+   const double f      = geodesic.Flattening();
+   const double e2     = f * (2.0 - f);
+   const double lat    = latitude * std::numbers::pi / 180.0;
+   const double sinLat = std::sin(lat);
+   const double w2     = 1.0 - e2 * sinLat * sinLat;
+   const double n      = a / std::sqrt(w2);
+   const double m      = a * (1.0 - e2) / (w2 * std::sqrt(w2));
+
+   siteSweep.earthRadii_ = {static_cast<float>(m), static_cast<float>(n)};
+   siteSweep.sweep_      = std::move(sweep);
+}
+
+void RadarMosaicLayer::Impl::BufferSweepQuads(gl::OpenGLFunctions& gl)
+{
+   std::vector<float> vertices {};
+   vertices.reserve(siteSweeps_.size() * kQuadFloats_);
+
+   for (auto& siteSweep : siteSweeps_)
+   {
+      vertices.insert(vertices.end(),
+                      siteSweep.second.quad_.cbegin(),
+                      siteSweep.second.quad_.cend());
+   }
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+   gl.glBufferData(GL_ARRAY_BUFFER,
+                   vertices.size() * sizeof(GLfloat),
+                   vertices.data(),
+                   GL_DYNAMIC_DRAW);
+}
+
+void RadarMosaicLayer::Impl::DeleteSiteSweeps(gl::OpenGLFunctions& gl)
+{
+   for (auto& siteSweep : siteSweeps_)
+   {
+      gl.glDeleteTextures(1, &siteSweep.second.texture_);
+   }
+   siteSweeps_.clear();
+}
+
+void RadarMosaicLayer::Impl::UpdateColorTable(gl::OpenGLFunctions& gl)
+{
+   colorTableNeedsUpdate_ = false;
+
+   std::shared_ptr<const view::ColorTableLut> lut =
+      radarMosaicManager_->color_table_lut();
+
+   if (lut == nullptr || lut->lut_.empty())
+   {
+      colorTableLoaded_ = false;
+      return;
+   }
+
+   gl.glActiveTexture(GL_TEXTURE1);
+   gl.glBindTexture(GL_TEXTURE_1D, colorTableTexture_);
+   gl.glTexImage1D(GL_TEXTURE_1D,
+                   0,
+                   GL_RGBA,
+                   static_cast<GLsizei>(lut->lut_.size()),
+                   0,
+                   GL_RGBA,
+                   GL_UNSIGNED_BYTE,
+                   lut->lut_.data());
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+   gl.glActiveTexture(GL_TEXTURE0);
+
+   colorTableMin_    = lut->min_;
+   colorTableLoaded_ = true;
+}
+
+bool RadarMosaicLayer::Impl::UpdateMosaicTexture(gl::OpenGLFunctions& gl,
+                                                 GLsizei              width,
+                                                 GLsizei              height)
+{
+   if (width <= 0 || height <= 0)
+   {
+      return false;
+   }
+
+   if (width == mosaicTextureWidth_ && height == mosaicTextureHeight_)
+   {
+      return true;
+   }
+
+   // Encoded values exceed 8 bits, and are stored as floating point
+   gl.glActiveTexture(GL_TEXTURE0);
+   gl.glBindTexture(GL_TEXTURE_2D, mosaicTexture_);
+   gl.glTexImage2D(GL_TEXTURE_2D,
+                   0,
+                   GL_R32F,
+                   width,
+                   height,
+                   0,
+                   GL_RED,
+                   GL_FLOAT,
+                   nullptr);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+   GLint previousFramebuffer = 0;
+   gl.glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousFramebuffer);
+
+   gl.glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer_);
+   gl.glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER,
+                             GL_COLOR_ATTACHMENT0,
+                             GL_TEXTURE_2D,
+                             mosaicTexture_,
+                             0);
+
+   const GLenum status = gl.glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER);
+
+   gl.glBindFramebuffer(GL_DRAW_FRAMEBUFFER,
+                        static_cast<GLuint>(previousFramebuffer));
+
+   if (status != GL_FRAMEBUFFER_COMPLETE)
+   {
+      logger_->error("Radar mosaic framebuffer is incomplete: {}", status);
+      mosaicTextureWidth_  = 0;
+      mosaicTextureHeight_ = 0;
+      return false;
+   }
+
+   mosaicTextureWidth_  = width;
+   mosaicTextureHeight_ = height;
+
+   return true;
+}
+
+} // namespace map
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <scwx/qt/map/generic_layer.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace map
+{
+
+/**
+ * @brief Draws the reflectivity of every radar site in the radar mosaic. Each
+ * site's sweep is drawn into an offscreen target with maximum blending, and the
+ * result is colored in a single full screen pass.
+ */
+class RadarMosaicLayer : public GenericLayer
+{
+public:
+   explicit RadarMosaicLayer(std::shared_ptr<MapContext> context);
+   ~RadarMosaicLayer();
+
+   void Initialize() override final;
+   void Render(const QMapLibre::CustomLayerRenderParameters&) override final;
+   void Deinitialize() override final;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace map
+} // namespace qt
+} // namespace scwx
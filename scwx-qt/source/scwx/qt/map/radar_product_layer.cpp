@@ -1,15 +1,24 @@
 #include <scwx/qt/map/radar_product_layer.hpp>
 #include <scwx/qt/map/map_settings.hpp>
+#include <scwx/qt/gl/scaled_framebuffer.hpp>
 #include <scwx/qt/gl/shader_program.hpp>
+#include <scwx/qt/gl/upload_worker.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/qt/view/radar_product_view.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/profiler.hpp>
 
 #if defined(_MSC_VER)
 #   pragma warning(push, 0)
 #endif
 
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
 #include <boost/algorithm/string.hpp>
 #include <boost/timer/timer.hpp>
 #include <fmt/format.h>
@@ -33,6 +42,71 @@ namespace map
 static const std::string logPrefix_ = "scwx::qt::map::radar_product_layer";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Scale applied to the sweep range when bounding the sweep texture quad
+static constexpr double kSweepQuadRangeScale_ = 1.02;
+
+// Maximum number of shared color tables kept resident as textures
+static constexpr std::size_t kMaxColorTableTextures_ = 8u;
+
+// Maximum number of sweep frames, and their total data moment size, kept
+// resident for animating loops
+static constexpr std::size_t kMaxSweepFrames_     = 32u;
+static constexpr std::size_t kMaxSweepFrameBytes_ = 256u * 1024u * 1024u;
+
+template<class T>
+static void GatherBinMoments(const T*                    moments,
+                             const view::RadarPolarGrid& polarGrid,
+                             std::vector<std::uint8_t>&  binMoments)
+{
+   // Each bin repeats its moment for every vertex. Take the first vertex of
+   // each bin, in radial-major order.
+   const std::size_t radials        = polarGrid.radials();
+   const std::size_t bins           = polarGrid.bins_;
+   const std::size_t radialVertices = polarGrid.radial_vertices();
+   const std::size_t firstBin       = (polarGrid.startGate_ == 0) ? 1 : 0;
+   const std::size_t originVertices = firstBin * 3;
+
+   binMoments.resize(radials * bins * sizeof(T));
+   T* dest = reinterpret_cast<T*>(binMoments.data());
+
+   for (std::size_t radial = 0; radial < radials; ++radial)
+   {
+      const T* radialMoments = moments + radial * radialVertices;
+      T*       radialDest    = dest + radial * bins;
+
+      // The origin bin is a single triangle, and every other bin is a pair
+      if (firstBin > 0)
+      {
+         radialDest[0] = radialMoments[0];
+      }
+      for (std::size_t bin = firstBin; bin < bins; ++bin)
+      {
+         radialDest[bin] = radialMoments[originVertices + (bin - firstBin) * 6];
+      }
+   }
+}
+
+static void
+UploadColorTable(gl::OpenGLFunctions&                          gl,
+                 GLuint                                        texture,
+                 const std::vector<boost::gil::rgba8_pixel_t>& colorTable)
+{
+   gl.glActiveTexture(GL_TEXTURE0);
+   gl.glBindTexture(GL_TEXTURE_1D, texture);
+   gl.glTexImage1D(GL_TEXTURE_1D,
+                   0,
+                   GL_RGBA,
+                   (GLsizei) colorTable.size(),
+                   0,
+                   GL_RGBA,
+                   GL_UNSIGNED_BYTE,
+                   colorTable.data());
+   gl.glGenerateMipmap(GL_TEXTURE_1D);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+}
+
 class RadarProductLayerImpl
 {
 public:
@@ -43,9 +117,26 @@ public:
        uDataMomentOffsetLocation_(GL_INVALID_INDEX),
        uDataMomentScaleLocation_(GL_INVALID_INDEX),
        uCFPEnabledLocation_(GL_INVALID_INDEX),
+       uHideZeroMomentsLocation_(GL_INVALID_INDEX),
+       uPolarGridEnabledLocation_(GL_INVALID_INDEX),
+       uRadarLatLongLocation_(GL_INVALID_INDEX),
+       uEarthRadiiLocation_(GL_INVALID_INDEX),
+       uGateSizeMetersLocation_(GL_INVALID_INDEX),
+       uStartGateLocation_(GL_INVALID_INDEX),
+       uGateSizeLocation_(GL_INVALID_INDEX),
+       uRadialVerticesLocation_(GL_INVALID_INDEX),
+       uSweepTextureEnabledLocation_(GL_INVALID_INDEX),
+       uFirstRadialLocation_(GL_INVALID_INDEX),
+       uVertexQuantizedLocation_(GL_INVALID_INDEX),
+       uVertexQuantizationLocation_(GL_INVALID_INDEX),
+       uStormRelativeLocation_(GL_INVALID_INDEX),
+       uStormMotionLocation_(GL_INVALID_INDEX),
+       uMomentThresholdLocation_(GL_INVALID_INDEX),
        vbo_ {GL_INVALID_INDEX},
        vao_ {GL_INVALID_INDEX},
        texture_ {GL_INVALID_INDEX},
+       azimuthTexture_ {GL_INVALID_INDEX},
+       momentTexture_ {GL_INVALID_INDEX},
        numVertices_ {0},
        cfpEnabled_ {false},
        colorTableNeedsUpdate_ {false},
@@ -54,6 +145,71 @@ public:
    }
    ~RadarProductLayerImpl() = default;
 
+   struct ColorTableTexture
+   {
+      std::weak_ptr<const view::ColorTableLut> lut_ {};
+      GLuint                                   texture_ {GL_INVALID_INDEX};
+   };
+
+   /**
+    * @brief Identifies the data moments of a complete sweep
+    */
+   struct SweepFrameKey
+   {
+      std::string                           radarId_ {};
+      std::string                           productName_ {};
+      float                                 elevation_ {};
+      std::chrono::system_clock::time_point sweepTime_ {};
+      bool                                  smoothingEnabled_ {};
+      bool                                  smoothedRangeFolding_ {};
+      std::size_t                           dataSize_ {};
+      std::size_t                           cfpDataSize_ {};
+
+      // Display levels of a moment quantization are specific to it
+      std::shared_ptr<const view::RadarMomentQuantization> quantization_ {};
+
+      bool operator==(const SweepFrameKey&) const = default;
+   };
+
+   struct SweepFrame
+   {
+      SweepFrameKey key_ {};
+      GLuint        momentBuffer_ {GL_INVALID_INDEX};
+      GLuint        cfpBuffer_ {GL_INVALID_INDEX};
+
+      // Data moments are uploaded in the background, unless a previous upload
+      // failed
+      std::shared_ptr<gl::UploadTask> upload_ {};
+      bool                            buffered_ {false};
+      bool                            uploadFailed_ {false};
+   };
+
+   GLuint GetColorTableTexture(gl::OpenGLFunctions& gl,
+                               std::shared_ptr<const view::ColorTableLut> lut);
+   void   DeleteColorTableTextures(gl::OpenGLFunctions& gl);
+
+   std::pair<SweepFrame*, bool> GetSweepFrame(gl::OpenGLFunctions& gl,
+                                              const SweepFrameKey& key);
+   void                         DeleteSweepFrames(gl::OpenGLFunctions& gl);
+   void PollSweepFrameUploads(gl::OpenGLFunctions& gl);
+   void QueueSweepFrameUpload(
+      gl::OpenGLFunctions&                           gl,
+      SweepFrame&                                    frame,
+      const std::shared_ptr<view::RadarProductView>& radarProductView);
+
+   void BufferSweepQuad(gl::OpenGLFunctions&        gl,
+                        const view::RadarPolarGrid& polarGrid);
+   void UpdatePolarGrid(gl::OpenGLFunctions&                        gl,
+                        std::shared_ptr<const view::RadarPolarGrid> polarGrid);
+   void UpdateStormMotion(
+      gl::OpenGLFunctions&                           gl,
+      const std::shared_ptr<view::RadarProductView>& radarProductView);
+   void UpdateMomentTexture(gl::OpenGLFunctions&        gl,
+                            const view::RadarPolarGrid& polarGrid,
+                            const void*                 data,
+                            std::size_t                 dataSize,
+                            std::size_t                 componentSize);
+
    std::shared_ptr<gl::ShaderProgram> shaderProgram_;
 
    GLint                 uMVPMatrixLocation_;
@@ -61,12 +217,55 @@ public:
    GLint                 uDataMomentOffsetLocation_;
    GLint                 uDataMomentScaleLocation_;
    GLint                 uCFPEnabledLocation_;
+   GLint                 uHideZeroMomentsLocation_;
+   GLint                 uPolarGridEnabledLocation_;
+   GLint                 uRadarLatLongLocation_;
+   GLint                 uEarthRadiiLocation_;
+   GLint                 uGateSizeMetersLocation_;
+   GLint                 uStartGateLocation_;
+   GLint                 uGateSizeLocation_;
+   GLint                 uRadialVerticesLocation_;
+   GLint                 uSweepTextureEnabledLocation_;
+   GLint                 uFirstRadialLocation_;
+   GLint                 uVertexQuantizedLocation_;
+   GLint                 uVertexQuantizationLocation_;
+   GLint                 uStormRelativeLocation_;
+   GLint                 uStormMotionLocation_;
+   GLint                 uMomentThresholdLocation_;
    std::array<GLuint, 3> vbo_;
    GLuint                vao_;
    GLuint                texture_;
+   GLuint                azimuthTexture_;
+   GLuint                momentTexture_;
 
    GLsizeiptr numVertices_;
 
+   std::weak_ptr<const std::vector<float>> bufferedVertices_ {};
+   GLsizeiptr                              bufferedDataSize_ {0};
+
+   std::weak_ptr<const view::RadarPolarGrid> bufferedPolarGrid_ {};
+
+   // Shared color tables, most recently used last
+   std::vector<ColorTableTexture> colorTableTextures_ {};
+   GLuint                         colorTableTexture_ {GL_INVALID_INDEX};
+
+   // Quantization of the buffered data moments
+   std::shared_ptr<const view::RadarMomentQuantization> momentQuantization_ {};
+
+   // Resident sweep frames, most recently used last
+   std::vector<SweepFrame> sweepFrames_ {};
+   std::size_t             sweepFrameBytes_ {0};
+
+   std::shared_ptr<gl::UploadWorker> uploadWorker_ {};
+
+   std::vector<std::uint8_t> binMoments_ {};
+   GLsizei                   momentTextureWidth_ {0};
+   GLsizei                   momentTextureHeight_ {0};
+   std::size_t               momentTextureComponentSize_ {0};
+
+   // Reduced resolution target while the map is in motion
+   gl::ScaledFramebuffer scaledFramebuffer_ {};
+
    bool cfpEnabled_;
 
    bool colorTableNeedsUpdate_;
@@ -85,6 +284,14 @@ RadarProductLayer::RadarProductLayer(std::shared_ptr<MapContext> context) :
            &view::RadarProductView::SweepComputed,
            this,
            [this]() { p->sweepNeedsUpdate_ = true; });
+   connect(radarProductView.get(),
+           &view::RadarProductView::StormMotionUpdated,
+           this,
+           &RadarProductLayer::NeedsRendering);
+   connect(radarProductView.get(),
+           &view::RadarProductView::ThresholdUpdated,
+           this,
+           &RadarProductLayer::NeedsRendering);
 }
 RadarProductLayer::~RadarProductLayer() = default;
 
@@ -133,14 +340,67 @@ void RadarProductLayer::Initialize()
       logger_->warn("Could not find uCFPEnabled");
    }
 
+   p->uHideZeroMomentsLocation_ =
+      gl.glGetUniformLocation(p->shaderProgram_->id(), "uHideZeroMoments");
+   if (p->uHideZeroMomentsLocation_ == -1)
+   {
+      logger_->warn("Could not find uHideZeroMoments");
+   }
+
+   p->uPolarGridEnabledLocation_ =
+      p->shaderProgram_->GetUniformLocation("uPolarGridEnabled");
+   p->uRadarLatLongLocation_ =
+      p->shaderProgram_->GetUniformLocation("uRadarLatLong");
+   p->uEarthRadiiLocation_ =
+      p->shaderProgram_->GetUniformLocation("uEarthRadii");
+   p->uGateSizeMetersLocation_ =
+      p->shaderProgram_->GetUniformLocation("uGateSizeMeters");
+   p->uStartGateLocation_ = p->shaderProgram_->GetUniformLocation("uStartGate");
+   p->uGateSizeLocation_  = p->shaderProgram_->GetUniformLocation("uGateSize");
+   p->uRadialVerticesLocation_ =
+      p->shaderProgram_->GetUniformLocation("uRadialVertices");
+   p->uSweepTextureEnabledLocation_ =
+      p->shaderProgram_->GetUniformLocation("uSweepTextureEnabled");
+   p->uFirstRadialLocation_ =
+      p->shaderProgram_->GetUniformLocation("uFirstRadial");
+   p->uVertexQuantizedLocation_ =
+      p->shaderProgram_->GetUniformLocation("uVertexQuantized");
+   p->uVertexQuantizationLocation_ =
+      p->shaderProgram_->GetUniformLocation("uVertexQuantization");
+   p->uStormRelativeLocation_ =
+      p->shaderProgram_->GetUniformLocation("uStormRelative");
+   p->uStormMotionLocation_ =
+      p->shaderProgram_->GetUniformLocation("uStormMotion");
+   p->uMomentThresholdLocation_ =
+      p->shaderProgram_->GetUniformLocation("uMomentThreshold");
+
    p->shaderProgram_->Use();
 
+   // Polar grid azimuths are sampled from texture unit 1, and sweep texture
+   // data moments from texture unit 2
+   gl.glUniform1i(p->shaderProgram_->GetUniformLocation("uAzimuthTexture"), 1);
+   gl.glUniform1i(p->shaderProgram_->GetUniformLocation("uMomentTexture"), 2);
+   gl.glGenTextures(1, &p->azimuthTexture_);
+   gl.glGenTextures(1, &p->momentTexture_);
+
    // Generate a vertex array object
    gl.glGenVertexArrays(1, &p->vao_);
 
    // Generate vertex buffer objects
    gl.glGenBuffers(3, p->vbo_.data());
 
+   // Sweep frames are uploaded in the background, and displayed once the
+   // upload has finished
+   p->uploadWorker_ = gl::UploadWorker::Instance();
+   connect(p->uploadWorker_.get(),
+           &gl::UploadWorker::UploadFinished,
+           this,
+           [this]()
+           {
+              p->sweepNeedsUpdate_ = true;
+              Q_EMIT NeedsRendering();
+           });
+
    // Update radar sweep
    p->sweepNeedsUpdate_ = true;
    UpdateSweep();
@@ -149,15 +409,16 @@ void RadarProductLayer::Initialize()
    gl.glGenTextures(1, &p->texture_);
    p->colorTableNeedsUpdate_ = true;
    UpdateColorTable();
-   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+
+   p->scaledFramebuffer_.Initialize(*context());
 }
 
 void RadarProductLayer::UpdateSweep()
 {
    logger_->debug("UpdateSweep()");
 
+   scwx::util::ScopedTimer uploadTimer {scwx::util::ProfileStage::GlUpload};
+
    gl::OpenGLFunctions& gl = context()->gl();
 
    boost::timer::cpu_timer timer;
@@ -175,31 +436,198 @@ void RadarProductLayer::UpdateSweep()
 
    p->sweepNeedsUpdate_ = false;
 
+   p->PollSweepFrameUploads(gl);
+
    const std::vector<float>& vertices = radarProductView->vertices();
+   std::shared_ptr<const std::vector<float>> sharedVertices =
+      radarProductView->shared_vertices();
+   std::shared_ptr<const view::RadarPolarGrid> polarGrid =
+      radarProductView->polar_grid();
+   std::optional<view::RadarVertexQuantization> quantization =
+      radarProductView->vertex_quantization();
+   std::shared_ptr<const view::RadarMomentQuantization> momentQuantization =
+      radarProductView->moment_quantization();
+
+   // Quantized vertices are 16-bit offsets from the radar site, decoded by the
+   // vertex shader
+   const bool vertexQuantized =
+      polarGrid == nullptr && quantization.has_value();
+   const std::vector<std::int16_t>& quantizedVertices =
+      radarProductView->quantized_vertices();
+   const void* vertexData =
+      vertexQuantized ? static_cast<const void*>(quantizedVertices.data()) :
+                        static_cast<const void*>(vertices.data());
+   const std::size_t vertexValues =
+      vertexQuantized ? quantizedVertices.size() : vertices.size();
+   const std::size_t vertexValueSize =
+      vertexQuantized ? sizeof(GLshort) : sizeof(GLfloat);
+
+   // Sweep textures replace the bin geometry with a single bounding quad
+   const bool sweepTextureEnabled =
+      polarGrid != nullptr &&
+      settings::GeneralSettings::Instance().radar_sweep_texture().GetValue();
+
+   // Data moments
+   const GLvoid* data;
+   GLsizeiptr    dataSize;
+   size_t        componentSize;
+   GLenum        type;
+
+   std::tie(data, dataSize, componentSize) = radarProductView->GetMomentData();
+
+   const GLvoid* cfpData;
+   GLsizeiptr    cfpDataSize;
+   size_t        cfpComponentSize;
+   GLenum        cfpType;
+
+   std::tie(cfpData, cfpDataSize, cfpComponentSize) =
+      radarProductView->GetCfpMomentData();
+
+   // The data moments of complete sweeps are kept resident as frames, if the
+   // vertices are not specific to the sweep. Returning to a sweep, such as
+   // when a loop is animated, binds its frame without buffering it again.
+   RadarProductLayerImpl::SweepFrame* frame         = nullptr;
+   bool                               frameResident = false;
+   const std::chrono::system_clock::time_point sweepTime =
+      radarProductView->sweep_time();
+
+   std::shared_ptr<manager::RadarProductManager> radarProductManager =
+      radarProductView->radar_product_manager();
+
+   if (!sweepTextureEnabled &&
+       (polarGrid != nullptr || sharedVertices != nullptr) &&
+       radarProductManager != nullptr &&
+       sweepTime != std::chrono::system_clock::time_point {})
+   {
+      RadarProductLayerImpl::SweepFrameKey key {};
+      key.radarId_          = radarProductManager->radar_id();
+      key.productName_      = radarProductView->GetRadarProductName();
+      key.elevation_        = radarProductView->elevation();
+      key.sweepTime_        = sweepTime;
+      key.smoothingEnabled_ = radarProductView->smoothing_enabled();
+      key.smoothedRangeFolding_ =
+         radarProductView->show_smoothed_range_folding();
+      key.dataSize_    = static_cast<std::size_t>(dataSize);
+      key.cfpDataSize_ =
+         (cfpData != nullptr) ? static_cast<std::size_t>(cfpDataSize) : 0u;
+      key.quantization_ = momentQuantization;
+
+      std::tie(frame, frameResident) = p->GetSweepFrame(gl, key);
+   }
+
+   // A frame being uploaded in the background is displayed once the upload
+   // has finished, and the previous sweep remains displayed until then
+   if (frame != nullptr && frame->upload_ != nullptr)
+   {
+      logger_->debug("Sweep frame upload pending");
+      return;
+   }
+   else if (frame != nullptr && !frameResident && !frame->uploadFailed_)
+   {
+      p->QueueSweepFrameUpload(gl, *frame, radarProductView);
+      if (frame->upload_ != nullptr)
+      {
+         logger_->debug("Sweep frame upload queued");
+         return;
+      }
+   }
+
+   // Direct uploads are spread across frames under the upload budget, and
+   // the previous sweep remains displayed until the upload is granted
+   std::size_t uploadBytes = 0;
+   if (!frameResident)
+   {
+      uploadBytes += static_cast<std::size_t>(dataSize);
+      uploadBytes +=
+         (cfpData != nullptr) ? static_cast<std::size_t>(cfpDataSize) : 0u;
+   }
+   if (polarGrid == nullptr && (sharedVertices == nullptr ||
+                                sharedVertices != p->bufferedVertices_.lock()))
+   {
+      uploadBytes += vertexValues * vertexValueSize;
+   }
+
+   if (uploadBytes > 0 &&
+       !context()->upload_scheduler().Request(
+          this, uploadBytes, gl::UploadPriority::High))
+   {
+      logger_->debug("Sweep upload deferred");
+      p->sweepNeedsUpdate_ = true;
+      return;
+   }
+
+   if (momentQuantization != p->momentQuantization_)
+   {
+      // Quantized data moments are rendered with the color table of their
+      // quantization
+      p->momentQuantization_    = momentQuantization;
+      p->colorTableNeedsUpdate_ = true;
+   }
 
    // Bind a vertex array object
    gl.glBindVertexArray(p->vao_);
 
-   // Buffer vertices
-   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
-   timer.start();
-   gl.glBufferData(GL_ARRAY_BUFFER,
-                   vertices.size() * sizeof(GLfloat),
-                   vertices.data(),
-                   GL_STATIC_DRAW);
-   timer.stop();
-   logger_->debug("Vertices buffered in {}", timer.format(6, "%ws"));
+   if (polarGrid != nullptr)
+   {
+      p->UpdatePolarGrid(gl, polarGrid);
+   }
 
-   gl.glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
-   gl.glEnableVertexAttribArray(0);
+   if (sweepTextureEnabled)
+   {
+      p->BufferSweepQuad(gl, *polarGrid);
+      p->bufferedVertices_.reset();
+   }
+   else if (polarGrid != nullptr)
+   {
+      // Vertices are generated by the vertex shader from the polar grid
+      gl.glDisableVertexAttribArray(0);
+      p->bufferedVertices_.reset();
+   }
+   else
+   {
+      // Buffer vertices, unless the same vertices are already resident
+      gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
+      if (sharedVertices == nullptr ||
+          sharedVertices != p->bufferedVertices_.lock())
+      {
+         timer.start();
+         gl.glBufferData(GL_ARRAY_BUFFER,
+                         static_cast<GLsizeiptr>(vertexValues *
+                                                 vertexValueSize),
+                         vertexData,
+                         GL_STATIC_DRAW);
+         timer.stop();
+         logger_->debug("Vertices buffered in {}", timer.format(6, "%ws"));
+
+         p->bufferedVertices_ = sharedVertices;
+      }
+      else
+      {
+         logger_->debug("Vertices resident, buffering data moments only");
+      }
 
-   // Buffer data moments
-   const GLvoid* data;
-   GLsizeiptr    dataSize;
-   size_t        componentSize;
-   GLenum        type;
+      gl.glVertexAttribPointer(0,
+                               2,
+                               vertexQuantized ? GL_SHORT : GL_FLOAT,
+                               GL_FALSE,
+                               0,
+                               static_cast<void*>(0));
+      gl.glEnableVertexAttribArray(0);
+   }
 
-   std::tie(data, dataSize, componentSize) = radarProductView->GetMomentData();
+   gl.glUniform1i(p->uVertexQuantizedLocation_, vertexQuantized ? 1 : 0);
+   if (vertexQuantized)
+   {
+      gl.glUniform4f(p->uVertexQuantizationLocation_,
+                     quantization->latitude_,
+                     quantization->longitude_,
+                     quantization->latitudeScale_,
+                     quantization->longitudeScale_);
+   }
+
+   gl.glUniform1i(p->uPolarGridEnabledLocation_, polarGrid != nullptr ? 1 : 0);
+   gl.glUniform1i(p->uSweepTextureEnabledLocation_,
+                  sweepTextureEnabled ? 1 : 0);
 
    if (componentSize == 1)
    {
@@ -210,25 +638,62 @@ void RadarProductLayer::UpdateSweep()
       type = GL_UNSIGNED_SHORT;
    }
 
-   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
-   timer.start();
-   gl.glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
-   timer.stop();
-   logger_->debug("Data moments buffered in {}", timer.format(6, "%ws"));
+   if (sweepTextureEnabled)
+   {
+      timer.start();
+      p->UpdateMomentTexture(gl,
+                             *polarGrid,
+                             data,
+                             static_cast<std::size_t>(dataSize),
+                             componentSize);
+      timer.stop();
+      logger_->debug("Sweep texture updated in {}", timer.format(6, "%ws"));
+
+      gl.glDisableVertexAttribArray(1);
+   }
+   else if (frame != nullptr)
+   {
+      gl.glBindBuffer(GL_ARRAY_BUFFER, frame->momentBuffer_);
+      if (frameResident)
+      {
+         logger_->debug("Sweep frame resident, binding data moments");
+      }
+      else
+      {
+         timer.start();
+         gl.glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
+         timer.stop();
+         logger_->debug("Sweep frame buffered in {}", timer.format(6, "%ws"));
 
-   gl.glVertexAttribIPointer(1, 1, type, 0, static_cast<void*>(0));
-   gl.glEnableVertexAttribArray(1);
+         frame->buffered_ = true;
+      }
 
-   // Buffer CFP data
-   const GLvoid* cfpData;
-   GLsizeiptr    cfpDataSize;
-   size_t        cfpComponentSize;
-   GLenum        cfpType;
+      gl.glVertexAttribIPointer(1, 1, type, 0, static_cast<void*>(0));
+      gl.glEnableVertexAttribArray(1);
+   }
+   else
+   {
+      gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
+      timer.start();
+      if (dataSize == p->bufferedDataSize_)
+      {
+         // Update the existing data store in place
+         gl.glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, data);
+      }
+      else
+      {
+         gl.glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_DYNAMIC_DRAW);
+         p->bufferedDataSize_ = dataSize;
+      }
+      timer.stop();
+      logger_->debug("Data moments buffered in {}", timer.format(6, "%ws"));
 
-   std::tie(cfpData, cfpDataSize, cfpComponentSize) =
-      radarProductView->GetCfpMomentData();
+      gl.glVertexAttribIPointer(1, 1, type, 0, static_cast<void*>(0));
+      gl.glEnableVertexAttribArray(1);
+   }
 
-   if (cfpData != nullptr)
+   // Buffer CFP data
+   if (cfpData != nullptr && !sweepTextureEnabled)
    {
       if (cfpComponentSize == 1)
       {
@@ -239,9 +704,18 @@ void RadarProductLayer::UpdateSweep()
          cfpType = GL_UNSIGNED_SHORT;
       }
 
-      gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[2]);
+      gl.glBindBuffer(GL_ARRAY_BUFFER,
+                      (frame != nullptr) ? frame->cfpBuffer_ : p->vbo_[2]);
       timer.start();
-      gl.glBufferData(GL_ARRAY_BUFFER, cfpDataSize, cfpData, GL_STATIC_DRAW);
+      if (frameResident)
+      {
+         // The frame CFP data moments are already resident
+      }
+      else
+      {
+         gl.glBufferData(
+            GL_ARRAY_BUFFER, cfpDataSize, cfpData, GL_STATIC_DRAW);
+      }
       timer.stop();
       logger_->debug("CFP moments buffered in {}", timer.format(6, "%ws"));
 
@@ -253,7 +727,243 @@ void RadarProductLayer::UpdateSweep()
       gl.glDisableVertexAttribArray(2);
    }
 
-   p->numVertices_ = vertices.size() / 2;
+   gl.glUniform1i(p->uHideZeroMomentsLocation_,
+                  radarProductView->hide_zero_moments() ? 1 : 0);
+
+   if (sweepTextureEnabled)
+   {
+      p->numVertices_ = 6;
+   }
+   else if (polarGrid != nullptr)
+   {
+      p->numVertices_ = static_cast<GLsizeiptr>(polarGrid->vertices());
+   }
+   else
+   {
+      p->numVertices_ = static_cast<GLsizeiptr>(vertexValues / 2);
+   }
+}
+
+void RadarProductLayerImpl::UpdatePolarGrid(
+   gl::OpenGLFunctions&                        gl,
+   std::shared_ptr<const view::RadarPolarGrid> polarGrid)
+{
+   if (polarGrid != bufferedPolarGrid_.lock())
+   {
+      gl.glActiveTexture(GL_TEXTURE1);
+      gl.glBindTexture(GL_TEXTURE_1D, azimuthTexture_);
+      gl.glTexImage1D(GL_TEXTURE_1D,
+                      0,
+                      GL_RG32F,
+                      static_cast<GLsizei>(polarGrid->radials()),
+                      0,
+                      GL_RG,
+                      GL_FLOAT,
+                      polarGrid->azimuths_.data());
+      gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+      gl.glActiveTexture(GL_TEXTURE0);
+
+      // The sweep texture searches radials in order of increasing azimuth,
+      // starting from the radial with the smallest near edge azimuth
+      GLint firstRadial = 0;
+      for (std::size_t i = 1; i < polarGrid->radials(); ++i)
+      {
+         if (polarGrid->azimuths_[i * 2] <
+             polarGrid->azimuths_[static_cast<std::size_t>(firstRadial) * 2])
+         {
+            firstRadial = static_cast<GLint>(i);
+         }
+      }
+      gl.glUniform1i(uFirstRadialLocation_, firstRadial);
+
+      bufferedPolarGrid_ = polarGrid;
+   }
+
+   // Radii of curvature of the ellipsoid at the radar site, in the
+   // meridian (M) and prime vertical (N)
+   const auto& geodesic = util::GeographicLib::DefaultGeodesic();
+   const double a       = geodesic.EquatorialRadius();
+   const double f       = geodesic.Flattening();
+   const double e2      = f * (2.0 - f);
+   const double lat     = polarGrid->latitude_ * std::numbers::pi / 180.0;
+   const double sinLat  = std::sin(lat);
+   const double w2      = 1.0 - e2 * sinLat * sinLat;
+   const double n       = a / std::sqrt(w2);
+   const double m       = a * (1.0 - e2) / (w2 * std::sqrt(w2));
+
+   gl.glUniform2f(uRadarLatLongLocation_,
+                  static_cast<float>(polarGrid->latitude_),
+                  static_cast<float>(polarGrid->longitude_));
+   gl.glUniform2f(uEarthRadiiLocation_,
+                  static_cast<float>(m),
+                  static_cast<float>(n));
+   gl.glUniform1f(uGateSizeMetersLocation_, polarGrid->gateSizeMeters_);
+   gl.glUniform1i(uStartGateLocation_,
+                  static_cast<GLint>(polarGrid->startGate_));
+   gl.glUniform1i(uGateSizeLocation_,
+                  static_cast<GLint>(polarGrid->gateSize_));
+   gl.glUniform1i(uRadialVerticesLocation_,
+                  static_cast<GLint>(polarGrid->radial_vertices()));
+}
+
+void RadarProductLayerImpl::UpdateStormMotion(
+   gl::OpenGLFunctions&                           gl,
+   const std::shared_ptr<view::RadarProductView>& radarProductView)
+{
+   // Storm motion is applied by the fragment shader each frame, so a change in
+   // storm motion does not require the sweep to be updated
+   const std::optional<view::RadarStormMotion> stormMotion =
+      radarProductView->storm_motion();
+   std::shared_ptr<manager::RadarProductManager> radarProductManager =
+      radarProductView->radar_product_manager();
+   std::shared_ptr<config::RadarSite> radarSite =
+      (radarProductManager != nullptr) ? radarProductManager->radar_site() :
+                                         nullptr;
+
+   const bool stormRelative = stormMotion.has_value() && radarSite != nullptr;
+
+   gl.glUniform1i(uStormRelativeLocation_, stormRelative ? 1 : 0);
+
+   if (stormRelative)
+   {
+      // Storms move toward the opposite of the direction they move from
+      const float heading =
+         (stormMotion->direction_ + 180.0f) * std::numbers::pi_v<float> /
+         180.0f;
+
+      gl.glUniform2f(uStormMotionLocation_,
+                     heading,
+                     stormMotion->speed_ * stormMotion->levelScale_);
+
+      // Fragments without a radial azimuth are located from the radar site
+      gl.glUniform2f(uRadarLatLongLocation_,
+                     static_cast<float>(radarSite->latitude()),
+                     static_cast<float>(radarSite->longitude()));
+   }
+}
+
+void RadarProductLayerImpl::BufferSweepQuad(
+   gl::OpenGLFunctions& gl, const view::RadarPolarGrid& polarGrid)
+{
+   const auto&  geodesic = util::GeographicLib::DefaultGeodesic();
+   const double range =
+      (polarGrid.startGate_ + polarGrid.bins_ * polarGrid.gateSize_) *
+      static_cast<double>(polarGrid.gateSizeMeters_) * kSweepQuadRangeScale_;
+
+   double minLatitude  = polarGrid.latitude_;
+   double maxLatitude  = polarGrid.latitude_;
+   double minLongitude = polarGrid.longitude_;
+   double maxLongitude = polarGrid.longitude_;
+
+   // Bound the sweep by its extent in each of the principal directions
+   for (double azimuth = 0.0; azimuth < 360.0; azimuth += 45.0)
+   {
+      double latitude;
+      double longitude;
+
+      geodesic.Direct(polarGrid.latitude_,
+                      polarGrid.longitude_,
+                      azimuth,
+                      range,
+                      latitude,
+                      longitude);
+
+      minLatitude  = std::min(minLatitude, latitude);
+      maxLatitude  = std::max(maxLatitude, latitude);
+      minLongitude = std::min(minLongitude, longitude);
+      maxLongitude = std::max(maxLongitude, longitude);
+   }
+
+   const float lat1 = static_cast<float>(minLatitude);
+   const float lat2 = static_cast<float>(maxLatitude);
+   const float lon1 = static_cast<float>(minLongitude);
+   const float lon2 = static_cast<float>(maxLongitude);
+
+   const std::array<float, 12> vertices {
+      lat1, lon1, lat2, lon1, lat2, lon2, lat1, lon1, lat1, lon2, lat2, lon2};
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, vbo_[0]);
+   gl.glBufferData(GL_ARRAY_BUFFER,
+                   vertices.size() * sizeof(GLfloat),
+                   vertices.data(),
+                   GL_STATIC_DRAW);
+   gl.glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
+   gl.glEnableVertexAttribArray(0);
+}
+
+void RadarProductLayerImpl::UpdateMomentTexture(
+   gl::OpenGLFunctions&        gl,
+   const view::RadarPolarGrid& polarGrid,
+   const void*                 data,
+   std::size_t                 dataSize,
+   std::size_t                 componentSize)
+{
+   const GLsizei width  = static_cast<GLsizei>(polarGrid.bins_);
+   const GLsizei height = static_cast<GLsizei>(polarGrid.radials());
+
+   if (data == nullptr || dataSize < polarGrid.vertices() * componentSize)
+   {
+      logger_->warn("Data moments do not match the polar grid");
+      binMoments_.assign(polarGrid.radials() * polarGrid.bins_ * componentSize,
+                         0);
+   }
+   else if (componentSize == 1)
+   {
+      GatherBinMoments(
+         static_cast<const std::uint8_t*>(data), polarGrid, binMoments_);
+   }
+   else
+   {
+      GatherBinMoments(
+         static_cast<const std::uint16_t*>(data), polarGrid, binMoments_);
+   }
+
+   const GLenum type =
+      (componentSize == 1) ? GL_UNSIGNED_BYTE : GL_UNSIGNED_SHORT;
+
+   gl.glActiveTexture(GL_TEXTURE2);
+   gl.glBindTexture(GL_TEXTURE_2D, momentTexture_);
+   gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+   if (width == momentTextureWidth_ && height == momentTextureHeight_ &&
+       componentSize == momentTextureComponentSize_)
+   {
+      // Update the existing texture in place
+      gl.glTexSubImage2D(GL_TEXTURE_2D,
+                         0,
+                         0,
+                         0,
+                         width,
+                         height,
+                         GL_RED_INTEGER,
+                         type,
+                         binMoments_.data());
+   }
+   else
+   {
+      gl.glTexImage2D(GL_TEXTURE_2D,
+                      0,
+                      (componentSize == 1) ? GL_R8UI : GL_R16UI,
+                      width,
+                      height,
+                      0,
+                      GL_RED_INTEGER,
+                      type,
+                      binMoments_.data());
+      gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+      gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+      momentTextureWidth_         = width;
+      momentTextureHeight_        = height;
+      momentTextureComponentSize_ = componentSize;
+   }
+
+   gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+   gl.glActiveTexture(GL_TEXTURE0);
 }
 
 void RadarProductLayer::Render(
@@ -266,6 +976,10 @@ void RadarProductLayer::Render(
    // Set OpenGL blend mode for transparency
    gl.glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
+   // Render at a reduced resolution while the map is in motion
+   const bool scaled =
+      p->scaledFramebuffer_.Begin(*context(), context()->render_scale());
+
    const bool wireframeEnabled = context()->settings().radarWireframeEnabled_;
    if (wireframeEnabled)
    {
@@ -273,14 +987,15 @@ void RadarProductLayer::Render(
       gl.glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
    }
 
-   if (p->colorTableNeedsUpdate_)
+   if (p->sweepNeedsUpdate_)
    {
-      UpdateColorTable();
+      UpdateSweep();
    }
 
-   if (p->sweepNeedsUpdate_)
+   // Updated after the sweep, which may change the moment quantization
+   if (p->colorTableNeedsUpdate_)
    {
-      UpdateSweep();
+      UpdateColorTable();
    }
 
    const float scale = std::pow(2.0, params.zoom) * 2.0f *
@@ -304,8 +1019,25 @@ void RadarProductLayer::Render(
 
    gl.glUniform1i(p->uCFPEnabledLocation_, p->cfpEnabled_ ? 1 : 0);
 
+   std::shared_ptr<view::RadarProductView> radarProductView =
+      context()->radar_product_view();
+
+   p->UpdateStormMotion(gl, radarProductView);
+
+   // Bins below the threshold are discarded by the fragment shader
+   std::uint16_t threshold = radarProductView->threshold_level();
+   if (p->momentQuantization_ != nullptr)
+   {
+      threshold = p->momentQuantization_->DisplayThreshold(threshold);
+   }
+   gl.glUniform1f(p->uMomentThresholdLocation_, static_cast<float>(threshold));
+
+   gl.glActiveTexture(GL_TEXTURE1);
+   gl.glBindTexture(GL_TEXTURE_1D, p->azimuthTexture_);
+   gl.glActiveTexture(GL_TEXTURE2);
+   gl.glBindTexture(GL_TEXTURE_2D, p->momentTexture_);
    gl.glActiveTexture(GL_TEXTURE0);
-   gl.glBindTexture(GL_TEXTURE_1D, p->texture_);
+   gl.glBindTexture(GL_TEXTURE_1D, p->colorTableTexture_);
    gl.glBindVertexArray(p->vao_);
    gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
 
@@ -315,6 +1047,11 @@ void RadarProductLayer::Render(
       gl.glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
    }
 
+   if (scaled)
+   {
+      p->scaledFramebuffer_.End(*context());
+   }
+
    SCWX_GL_CHECK_ERROR();
 }
 
@@ -326,15 +1063,50 @@ void RadarProductLayer::Deinitialize()
 
    gl.glDeleteVertexArrays(1, &p->vao_);
    gl.glDeleteBuffers(3, p->vbo_.data());
-
-   p->uMVPMatrixLocation_        = GL_INVALID_INDEX;
-   p->uMapScreenCoordLocation_   = GL_INVALID_INDEX;
-   p->uDataMomentOffsetLocation_ = GL_INVALID_INDEX;
-   p->uDataMomentScaleLocation_  = GL_INVALID_INDEX;
-   p->uCFPEnabledLocation_       = GL_INVALID_INDEX;
-   p->vao_                       = GL_INVALID_INDEX;
-   p->vbo_                       = {GL_INVALID_INDEX};
-   p->texture_                   = GL_INVALID_INDEX;
+   gl.glDeleteTextures(1, &p->azimuthTexture_);
+   gl.glDeleteTextures(1, &p->momentTexture_);
+   gl.glDeleteTextures(1, &p->texture_);
+   p->DeleteColorTableTextures(gl);
+   p->DeleteSweepFrames(gl);
+   p->scaledFramebuffer_.Deinitialize(*context());
+
+   disconnect(p->uploadWorker_.get(), nullptr, this, nullptr);
+   p->uploadWorker_.reset();
+
+   p->uMVPMatrixLocation_           = GL_INVALID_INDEX;
+   p->uMapScreenCoordLocation_      = GL_INVALID_INDEX;
+   p->uDataMomentOffsetLocation_    = GL_INVALID_INDEX;
+   p->uDataMomentScaleLocation_     = GL_INVALID_INDEX;
+   p->uCFPEnabledLocation_          = GL_INVALID_INDEX;
+   p->uHideZeroMomentsLocation_     = GL_INVALID_INDEX;
+   p->uPolarGridEnabledLocation_    = GL_INVALID_INDEX;
+   p->uRadarLatLongLocation_        = GL_INVALID_INDEX;
+   p->uEarthRadiiLocation_          = GL_INVALID_INDEX;
+   p->uGateSizeMetersLocation_      = GL_INVALID_INDEX;
+   p->uStartGateLocation_           = GL_INVALID_INDEX;
+   p->uGateSizeLocation_            = GL_INVALID_INDEX;
+   p->uRadialVerticesLocation_      = GL_INVALID_INDEX;
+   p->uSweepTextureEnabledLocation_ = GL_INVALID_INDEX;
+   p->uFirstRadialLocation_         = GL_INVALID_INDEX;
+   p->uVertexQuantizedLocation_     = GL_INVALID_INDEX;
+   p->uVertexQuantizationLocation_  = GL_INVALID_INDEX;
+   p->uStormRelativeLocation_       = GL_INVALID_INDEX;
+   p->uStormMotionLocation_         = GL_INVALID_INDEX;
+   p->uMomentThresholdLocation_     = GL_INVALID_INDEX;
+   p->vao_                          = GL_INVALID_INDEX;
+   p->vbo_                          = {GL_INVALID_INDEX};
+   p->texture_                      = GL_INVALID_INDEX;
+   p->colorTableTexture_            = GL_INVALID_INDEX;
+   p->azimuthTexture_               = GL_INVALID_INDEX;
+   p->momentTexture_                = GL_INVALID_INDEX;
+
+   p->bufferedVertices_.reset();
+   p->bufferedPolarGrid_.reset();
+   p->binMoments_.clear();
+   p->momentTextureWidth_         = 0;
+   p->momentTextureHeight_        = 0;
+   p->momentTextureComponentSize_ = 0;
+   p->bufferedDataSize_           = 0;
 }
 
 bool RadarProductLayer::RunMousePicking(
@@ -463,6 +1235,226 @@ bool RadarProductLayer::RunMousePicking(
    return itemPicked;
 }
 
+GLuint RadarProductLayerImpl::GetColorTableTexture(
+   gl::OpenGLFunctions& gl, std::shared_ptr<const view::ColorTableLut> lut)
+{
+   // Release textures of color tables no longer referenced by any view
+   std::erase_if(colorTableTextures_,
+                 [&](const ColorTableTexture& entry)
+                 {
+                    if (entry.lut_.expired())
+                    {
+                       gl.glDeleteTextures(1, &entry.texture_);
+                       return true;
+                    }
+                    return false;
+                 });
+
+   auto it = std::find_if(colorTableTextures_.begin(),
+                          colorTableTextures_.end(),
+                          [&](const ColorTableTexture& entry)
+                          { return entry.lut_.lock() == lut; });
+
+   ColorTableTexture entry {};
+
+   if (it != colorTableTextures_.end())
+   {
+      entry = *it;
+      colorTableTextures_.erase(it);
+   }
+   else
+   {
+      if (colorTableTextures_.size() >= kMaxColorTableTextures_)
+      {
+         // Evict the least recently used
+         gl.glDeleteTextures(1, &colorTableTextures_.front().texture_);
+         colorTableTextures_.erase(colorTableTextures_.begin());
+      }
+
+      entry.lut_ = lut;
+      gl.glGenTextures(1, &entry.texture_);
+      UploadColorTable(gl, entry.texture_, lut->lut_);
+   }
+
+   colorTableTextures_.push_back(entry);
+
+   return entry.texture_;
+}
+
+void RadarProductLayerImpl::DeleteColorTableTextures(gl::OpenGLFunctions& gl)
+{
+   for (auto& entry : colorTableTextures_)
+   {
+      gl.glDeleteTextures(1, &entry.texture_);
+   }
+   colorTableTextures_.clear();
+}
+
+std::pair<RadarProductLayerImpl::SweepFrame*, bool>
+RadarProductLayerImpl::GetSweepFrame(gl::OpenGLFunctions& gl,
+                                     const SweepFrameKey& key)
+{
+   const std::size_t frameBytes = key.dataSize_ + key.cfpDataSize_;
+
+   auto it = std::find_if(sweepFrames_.begin(),
+                          sweepFrames_.end(),
+                          [&](const SweepFrame& entry)
+                          { return entry.key_ == key; });
+
+   if (it != sweepFrames_.end())
+   {
+      // Mark the frame as most recently used
+      std::rotate(it, std::next(it), sweepFrames_.end());
+      return {&sweepFrames_.back(), sweepFrames_.back().buffered_};
+   }
+
+   if (frameBytes > kMaxSweepFrameBytes_)
+   {
+      return {nullptr, false};
+   }
+
+   // Evict the least recently used frames
+   while (!sweepFrames_.empty() &&
+          (sweepFrames_.size() >= kMaxSweepFrames_ ||
+           sweepFrameBytes_ + frameBytes > kMaxSweepFrameBytes_))
+   {
+      SweepFrame& front = sweepFrames_.front();
+      if (front.upload_ != nullptr)
+      {
+         front.upload_->Discard(gl);
+      }
+      gl.glDeleteBuffers(1, &front.momentBuffer_);
+      gl.glDeleteBuffers(1, &front.cfpBuffer_);
+      sweepFrameBytes_ -= front.key_.dataSize_ + front.key_.cfpDataSize_;
+      sweepFrames_.erase(sweepFrames_.begin());
+   }
+
+   SweepFrame frame {};
+   frame.key_ = key;
+   gl.glGenBuffers(1, &frame.momentBuffer_);
+   gl.glGenBuffers(1, &frame.cfpBuffer_);
+
+   sweepFrames_.push_back(std::move(frame));
+   sweepFrameBytes_ += frameBytes;
+
+   return {&sweepFrames_.back(), false};
+}
+
+void RadarProductLayerImpl::DeleteSweepFrames(gl::OpenGLFunctions& gl)
+{
+   for (auto& frame : sweepFrames_)
+   {
+      if (frame.upload_ != nullptr)
+      {
+         frame.upload_->Discard(gl);
+      }
+      gl.glDeleteBuffers(1, &frame.momentBuffer_);
+      gl.glDeleteBuffers(1, &frame.cfpBuffer_);
+   }
+   sweepFrames_.clear();
+   sweepFrameBytes_ = 0;
+}
+
+void RadarProductLayerImpl::PollSweepFrameUploads(gl::OpenGLFunctions& gl)
+{
+   for (auto& frame : sweepFrames_)
+   {
+      if (frame.upload_ == nullptr)
+      {
+         continue;
+      }
+
+      switch (frame.upload_->Poll(gl))
+      {
+      case gl::UploadTask::State::Complete:
+         frame.upload_.reset();
+         frame.buffered_ = true;
+         break;
+
+      case gl::UploadTask::State::Failed:
+         // The sweep changed before it was uploaded. The frame is buffered
+         // directly if it is displayed again.
+         frame.upload_.reset();
+         frame.uploadFailed_ = true;
+         break;
+
+      default:
+         break;
+      }
+   }
+}
+
+void RadarProductLayerImpl::QueueSweepFrameUpload(
+   gl::OpenGLFunctions&                           gl,
+   SweepFrame&                                    frame,
+   const std::shared_ptr<view::RadarProductView>& radarProductView)
+{
+   if (uploadWorker_ == nullptr)
+   {
+      return;
+   }
+
+   // Buffer objects are created when first bound, and must exist before they
+   // are written by the upload context
+   gl.glBindBuffer(GL_ARRAY_BUFFER, frame.momentBuffer_);
+   gl.glBindBuffer(GL_ARRAY_BUFFER, frame.cfpBuffer_);
+
+   std::weak_ptr<view::RadarProductView> weakView = radarProductView;
+
+   const SweepFrameKey key          = frame.key_;
+   const GLuint        momentBuffer = frame.momentBuffer_;
+   const GLuint        cfpBuffer    = frame.cfpBuffer_;
+
+   frame.upload_ = uploadWorker_->Queue(
+      [weakView, key, momentBuffer, cfpBuffer](gl::OpenGLFunctions& gl)
+      {
+         auto view = weakView.lock();
+         if (view == nullptr)
+         {
+            return false;
+         }
+
+         // Data moments are read under the sweep lock, and the upload is
+         // abandoned if the sweep has changed since it was queued
+         std::unique_lock sweepLock(view->sweep_mutex());
+
+         auto [data, dataSize, componentSize] = view->GetMomentData();
+         auto [cfpData, cfpDataSize, cfpComponentSize] =
+            view->GetCfpMomentData();
+
+         if (view->sweep_time() != key.sweepTime_ ||
+             view->elevation() != key.elevation_ ||
+             view->GetRadarProductName() != key.productName_ ||
+             dataSize != key.dataSize_ ||
+             (cfpData != nullptr ? cfpDataSize : 0u) != key.cfpDataSize_)
+         {
+            return false;
+         }
+
+         scwx::util::ScopedTimer uploadTimer {
+            scwx::util::ProfileStage::GlUpload};
+
+         gl.glBindBuffer(GL_ARRAY_BUFFER, momentBuffer);
+         gl.glBufferData(GL_ARRAY_BUFFER,
+                         static_cast<GLsizeiptr>(dataSize),
+                         data,
+                         GL_STATIC_DRAW);
+
+         if (cfpData != nullptr)
+         {
+            gl.glBindBuffer(GL_ARRAY_BUFFER, cfpBuffer);
+            gl.glBufferData(GL_ARRAY_BUFFER,
+                            static_cast<GLsizeiptr>(cfpDataSize),
+                            cfpData,
+                            GL_STATIC_DRAW);
+         }
+
+         gl.glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+         return true;
+      });
+}
+
 void RadarProductLayer::UpdateColorTable()
 {
    logger_->debug("UpdateColorTable()");
@@ -473,24 +1465,32 @@ void RadarProductLayer::UpdateColorTable()
    std::shared_ptr<view::RadarProductView> radarProductView =
       context()->radar_product_view();
 
-   const std::vector<boost::gil::rgba8_pixel_t>& colorTable =
-      radarProductView->color_table_lut();
-   const uint16_t rangeMin = radarProductView->color_table_min();
-   const uint16_t rangeMax = radarProductView->color_table_max();
+   std::shared_ptr<const view::ColorTableLut> sharedColorTable =
+      radarProductView->shared_color_table_lut();
+   uint16_t rangeMin = radarProductView->color_table_min();
+   uint16_t rangeMax = radarProductView->color_table_max();
+
+   if (p->momentQuantization_ != nullptr)
+   {
+      // Data moments are display levels of the quantization
+      sharedColorTable = p->momentQuantization_->colorTableLut_;
+      rangeMin         = sharedColorTable->min_;
+      rangeMax         = sharedColorTable->max_;
+   }
 
    const float scale = rangeMax - rangeMin;
 
-   gl.glActiveTexture(GL_TEXTURE0);
-   gl.glBindTexture(GL_TEXTURE_1D, p->texture_);
-   gl.glTexImage1D(GL_TEXTURE_1D,
-                   0,
-                   GL_RGBA,
-                   (GLsizei) colorTable.size(),
-                   0,
-                   GL_RGBA,
-                   GL_UNSIGNED_BYTE,
-                   colorTable.data());
-   gl.glGenerateMipmap(GL_TEXTURE_1D);
+   if (sharedColorTable != nullptr && !sharedColorTable->lut_.empty())
+   {
+      // Bind the resident texture of a shared color table, uploading it only
+      // if it is not yet resident
+      p->colorTableTexture_ = p->GetColorTableTexture(gl, sharedColorTable);
+   }
+   else
+   {
+      UploadColorTable(gl, p->texture_, radarProductView->color_table_lut());
+      p->colorTableTexture_ = p->texture_;
+   }
 
    gl.glUniform1ui(p->uDataMomentOffsetLocation_, rangeMin);
    gl.glUniform1f(p->uDataMomentScaleLocation_, scale);
@@ -3,6 +3,10 @@
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
 #include <glm/glm.hpp>
 
 namespace scwx
@@ -15,8 +19,21 @@ namespace map
 static const std::string logPrefix_ = "scwx::qt::map::radar_range_layer";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
-static std::shared_ptr<QMapLibre::Feature>
+// Maximum number of range circles retained in the cache
+static constexpr std::size_t kMaxCachedCircles_ = 32u;
+
+typedef std::tuple<float, double, double> RangeCircleKey;
+
+// Range circles are cached by range and center, so that switching between
+// radar sites and products does not repeat the geodesic calculations
+static std::map<RangeCircleKey, std::shared_ptr<const QMapLibre::Feature>>
+                  rangeCircleCache_ {};
+static std::mutex rangeCircleMutex_ {};
+
+static std::shared_ptr<const QMapLibre::Feature>
 GetRangeCircle(float range, QMapLibre::Coordinate center);
+static std::shared_ptr<const QMapLibre::Feature>
+CreateRangeCircle(float range, QMapLibre::Coordinate center);
 
 void RadarRangeLayer::Add(std::shared_ptr<QMapLibre::Map> map,
                           float                           range,
@@ -37,7 +54,7 @@ void RadarRangeLayer::Add(std::shared_ptr<QMapLibre::Map> map,
       map->removeSource("rangeCircleSource");
    }
 
-   std::shared_ptr<QMapLibre::Feature> rangeCircle =
+   std::shared_ptr<const QMapLibre::Feature> rangeCircle =
       GetRangeCircle(range, center);
 
    map->addSource(
@@ -52,15 +69,49 @@ void RadarRangeLayer::Update(std::shared_ptr<QMapLibre::Map> map,
                              float                           range,
                              QMapLibre::Coordinate           center)
 {
-   std::shared_ptr<QMapLibre::Feature> rangeCircle =
+   std::shared_ptr<const QMapLibre::Feature> rangeCircle =
       GetRangeCircle(range, center);
 
    map->updateSource("rangeCircleSource",
                      {{"data", QVariant::fromValue(*rangeCircle)}});
 }
 
-static std::shared_ptr<QMapLibre::Feature>
+void Precompute(float range, QMapLibre::Coordinate center)
+{
+   GetRangeCircle(range, center);
+}
+
+static std::shared_ptr<const QMapLibre::Feature>
 GetRangeCircle(float range, QMapLibre::Coordinate center)
+{
+   const RangeCircleKey key {range, center.first, center.second};
+
+   {
+      std::unique_lock lock {rangeCircleMutex_};
+
+      auto it = rangeCircleCache_.find(key);
+      if (it != rangeCircleCache_.cend())
+      {
+         return it->second;
+      }
+   }
+
+   // Create the range circle without holding the lock
+   std::shared_ptr<const QMapLibre::Feature> rangeCircle =
+      CreateRangeCircle(range, center);
+
+   std::unique_lock lock {rangeCircleMutex_};
+
+   if (rangeCircleCache_.size() >= kMaxCachedCircles_)
+   {
+      rangeCircleCache_.clear();
+   }
+
+   return rangeCircleCache_.emplace(key, rangeCircle).first->second;
+}
+
+static std::shared_ptr<const QMapLibre::Feature>
+CreateRangeCircle(float range, QMapLibre::Coordinate center)
 {
    const GeographicLib::Geodesic& geodesic(
       util::GeographicLib::DefaultGeodesic());
@@ -89,8 +140,8 @@ GetRangeCircle(float range, QMapLibre::Coordinate center)
       angle += angleDelta;
    }
 
-   std::shared_ptr<QMapLibre::Feature> rangeCircle =
-      std::make_shared<QMapLibre::Feature>(
+   std::shared_ptr<const QMapLibre::Feature> rangeCircle =
+      std::make_shared<const QMapLibre::Feature>(
          QMapLibre::Feature::LineStringType,
          std::initializer_list<QMapLibre::CoordinatesCollection> {
             std::initializer_list<QMapLibre::Coordinates> {geometry}});
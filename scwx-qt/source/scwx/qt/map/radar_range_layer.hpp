@@ -19,6 +19,12 @@ void Update(std::shared_ptr<QMapLibre::Map> map,
             float                           range,
             QMapLibre::Coordinate           center);
 
+/**
+ * Computes the range circle for a radar site ahead of time, so a later Add or
+ * Update does not need to compute it. May be called from any thread.
+ */
+void Precompute(float range, QMapLibre::Coordinate center);
+
 } // namespace RadarRangeLayer
 } // namespace map
 } // namespace qt
@@ -19,18 +19,30 @@ namespace map
 static const std::string logPrefix_ = "scwx::qt::map::radar_site_layer";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Distance outside of the viewport in which radar sites are still rendered
+static constexpr float kViewportMargin_ = 50.0f;
+
 class RadarSiteLayer::Impl
 {
 public:
+   struct RadarSiteRecord
+   {
+      std::shared_ptr<config::RadarSite> radarSite_;
+      std::string                        windowName_;
+      glm::vec2                          screenCoordinate_;
+   };
+
    explicit Impl(RadarSiteLayer* self) : self_ {self} {}
    ~Impl() = default;
 
    void RenderRadarSite(const QMapLibre::CustomLayerRenderParameters& params,
-                        std::shared_ptr<config::RadarSite>& radarSite);
+                        const RadarSiteRecord& record);
 
    RadarSiteLayer* self_;
 
-   std::vector<std::shared_ptr<config::RadarSite>> radarSites_ {};
+   // Radar sites do not move, so their names and map screen coordinates are
+   // computed once
+   std::vector<RadarSiteRecord> radarSites_ {};
 
    glm::vec2 mapScreenCoordLocation_ {};
    float     mapScale_ {1.0f};
@@ -53,7 +65,14 @@ void RadarSiteLayer::Initialize()
 {
    logger_->debug("Initialize()");
 
-   p->radarSites_ = config::RadarSite::GetAll();
+   for (auto& radarSite : config::RadarSite::GetAll())
+   {
+      p->radarSites_.push_back(
+         {radarSite,
+          fmt::format("radar-site-{}", radarSite->id()),
+          util::maplibre::LatLongToScreenCoordinate(
+             {radarSite->latitude(), radarSite->longitude()})});
+   }
 }
 
 void RadarSiteLayer::Render(
@@ -78,9 +97,9 @@ void RadarSiteLayer::Render(
    // Radar site ImGui windows shouldn't have padding
    ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2 {0.0f, 0.0f});
 
-   for (auto& radarSite : p->radarSites_)
+   for (auto& record : p->radarSites_)
    {
-      p->RenderRadarSite(params, radarSite);
+      p->RenderRadarSite(params, record);
    }
 
    ImGui::PopStyleVar();
@@ -90,15 +109,12 @@ void RadarSiteLayer::Render(
 
 void RadarSiteLayer::Impl::RenderRadarSite(
    const QMapLibre::CustomLayerRenderParameters& params,
-   std::shared_ptr<config::RadarSite>&           radarSite)
+   const RadarSiteRecord&                        record)
 {
-   const std::string windowName = fmt::format("radar-site-{}", radarSite->id());
+   auto& radarSite = record.radarSite_;
 
    const auto screenCoordinates =
-      (util::maplibre::LatLongToScreenCoordinate(
-          {radarSite->latitude(), radarSite->longitude()}) -
-       mapScreenCoordLocation_) *
-      mapScale_;
+      (record.screenCoordinate_ - mapScreenCoordLocation_) * mapScale_;
 
    // Rotate text according to map rotation
    float rotatedX = screenCoordinates.x;
@@ -115,10 +131,17 @@ void RadarSiteLayer::Impl::RenderRadarSite(
    float x = rotatedX + halfWidth_;
    float y = params.height - (rotatedY + halfHeight_);
 
+   // Skip radar sites which are not visible
+   if (x < -kViewportMargin_ || x > params.width + kViewportMargin_ ||
+       y < -kViewportMargin_ || y > params.height + kViewportMargin_)
+   {
+      return;
+   }
+
    // Setup window to hold text
    ImGui::SetNextWindowPos(
       ImVec2 {x, y}, ImGuiCond_Always, ImVec2 {0.5f, 0.5f});
-   if (ImGui::Begin(windowName.c_str(),
+   if (ImGui::Begin(record.windowName_.c_str(),
                     nullptr,
                     ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize |
                        ImGuiWindowFlags_AlwaysAutoResize))
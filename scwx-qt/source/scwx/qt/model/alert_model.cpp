@@ -10,10 +10,13 @@
 #include <scwx/util/strings.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
+#include <array>
 #include <format>
 
 #include <QApplication>
 #include <QFontMetrics>
+#include <QRegularExpression>
 
 namespace scwx
 {
@@ -30,6 +33,24 @@ static constexpr int kLastColumn =
    static_cast<int>(AlertModel::Column::Distance);
 static constexpr int kNumColumns = kLastColumn - kFirstColumn + 1;
 
+// Distances are recomputed once the position moves at least this far from the
+// position of the previous computation, such that small movements (e.g., GPS
+// updates or panning the map) do not re-sort the alerts
+static constexpr double kDistanceUpdateThresholdMeters_ = 500.0;
+
+// Sort and filter keys of an alert, computed when the alert is updated
+struct AlertKeys
+{
+   // Display text of each column, except for the distance, which depends on the
+   // distance unit setting
+   std::array<QString, kNumColumns> text_ {};
+
+   awips::ibw::ThreatCategory threatCategory_ {
+      awips::ibw::ThreatCategory::Base};
+   std::chrono::system_clock::time_point startTime_ {};
+   std::chrono::system_clock::time_point endTime_ {};
+};
+
 class AlertModelImpl
 {
 public:
@@ -43,15 +64,26 @@ public:
    static std::string GetCounties(const types::TextEventKey& key);
    static std::string GetState(const types::TextEventKey& key);
    static std::chrono::system_clock::time_point
-                      GetStartTime(const types::TextEventKey& key);
-   static std::string GetStartTimeString(const types::TextEventKey& key);
+   GetStartTime(const types::TextEventKey& key);
    static std::chrono::system_clock::time_point
-                      GetEndTime(const types::TextEventKey& key);
-   static std::string GetEndTimeString(const types::TextEventKey& key);
+   GetEndTime(const types::TextEventKey& key);
+
+   void UpdateAlert(const types::TextEventKey& alertKey, size_t messageIndex);
+   void UpdateKeys(const types::TextEventKey& alertKey);
 
    std::shared_ptr<manager::TextEventManager> textEventManager_;
 
    QList<types::TextEventKey> textEventKeys_;
+   std::unordered_map<types::TextEventKey,
+                      int,
+                      types::TextEventHash<types::TextEventKey>>
+      rowMap_ {};
+
+   std::unordered_map<types::TextEventKey,
+                      size_t,
+                      types::TextEventHash<types::TextEventKey>>
+        pendingAlerts_ {};
+   bool updatePending_ {false};
 
    const GeographicLib::Geodesic& geodesic_;
 
@@ -76,6 +108,12 @@ public:
                       types::TextEventHash<types::TextEventKey>>
                             distanceMap_;
    scwx::common::Coordinate previousPosition_;
+   bool                     previousPositionValid_ {false};
+
+   std::unordered_map<types::TextEventKey,
+                      AlertKeys,
+                      types::TextEventHash<types::TextEventKey>>
+      keysMap_ {};
 };
 
 AlertModel::AlertModel(QObject* parent) :
@@ -122,6 +160,7 @@ QVariant AlertModel::data(const QModelIndex& index, int role) const
    }
 
    const auto& textEventKey = p->textEventKeys_.at(index.row());
+   const auto& keys         = p->keysMap_.at(textEventKey);
 
    if (role == Qt::ItemDataRole::DisplayRole ||
        role == types::ItemDataRole::SortRole)
@@ -132,54 +171,31 @@ QVariant AlertModel::data(const QModelIndex& index, int role) const
          return textEventKey.etn_;
 
       case static_cast<int>(Column::OfficeId):
-         return QString::fromStdString(textEventKey.officeId_);
-
       case static_cast<int>(Column::Phenomenon):
-         return QString::fromStdString(
-            awips::GetPhenomenonText(textEventKey.phenomenon_));
-
       case static_cast<int>(Column::Significance):
-         return QString::fromStdString(
-            awips::GetSignificanceText(textEventKey.significance_));
+      case static_cast<int>(Column::State):
+      case static_cast<int>(Column::Counties):
+      case static_cast<int>(Column::StartTime):
+      case static_cast<int>(Column::EndTime):
+         return keys.text_[index.column()];
 
       case static_cast<int>(Column::Tornado):
-         if (textEventKey.phenomenon_ == awips::Phenomenon::Tornado &&
-             p->GetObserved(textEventKey))
+         if (!keys.text_[index.column()].isEmpty())
          {
-            return tr("Observed");
-         }
-         if (p->GetTornadoPossible(textEventKey))
-         {
-            return tr("Possible");
+            return keys.text_[index.column()];
          }
          break;
 
       case static_cast<int>(Column::ThreatCategory):
          if (role == Qt::DisplayRole)
          {
-            return QString::fromStdString(awips::ibw::GetThreatCategoryName(
-               p->GetThreatCategory(textEventKey)));
+            return keys.text_[index.column()];
          }
          else
          {
-            return static_cast<int>(p->GetThreatCategory(textEventKey));
+            return static_cast<int>(keys.threatCategory_);
          }
 
-      case static_cast<int>(Column::State):
-         return QString::fromStdString(AlertModelImpl::GetState(textEventKey));
-
-      case static_cast<int>(Column::Counties):
-         return QString::fromStdString(
-            AlertModelImpl::GetCounties(textEventKey));
-
-      case static_cast<int>(Column::StartTime):
-         return QString::fromStdString(
-            AlertModelImpl::GetStartTimeString(textEventKey));
-
-      case static_cast<int>(Column::EndTime):
-         return QString::fromStdString(
-            AlertModelImpl::GetEndTimeString(textEventKey));
-
       case static_cast<int>(Column::Distance):
          if (role == Qt::DisplayRole)
          {
@@ -211,10 +227,10 @@ QVariant AlertModel::data(const QModelIndex& index, int role) const
       switch (index.column())
       {
       case static_cast<int>(Column::StartTime):
-         return QVariant::fromValue(AlertModelImpl::GetStartTime(textEventKey));
+         return QVariant::fromValue(keys.startTime_);
 
       case static_cast<int>(Column::EndTime):
-         return QVariant::fromValue(AlertModelImpl::GetEndTime(textEventKey));
+         return QVariant::fromValue(keys.endTime_);
 
       default:
          break;
@@ -328,70 +344,176 @@ AlertModel::headerData(int section, Qt::Orientation orientation, int role) const
    return QVariant();
 }
 
-void AlertModel::HandleAlert(const types::TextEventKey& alertKey,
-                             size_t                     messageIndex)
+bool AlertModel::LessThan(const QModelIndex&  left,
+                          const QModelIndex&  right,
+                          Qt::CaseSensitivity caseSensitivity) const
 {
-   logger_->trace("Handle alert: {}", alertKey.ToString());
+   if (!left.isValid() || !right.isValid() ||
+       left.row() >= p->textEventKeys_.size() ||
+       right.row() >= p->textEventKeys_.size())
+   {
+      return false;
+   }
 
-   double distanceInMeters;
+   const auto& leftKey   = p->textEventKeys_.at(left.row());
+   const auto& rightKey  = p->textEventKeys_.at(right.row());
+   const auto& leftKeys  = p->keysMap_.at(leftKey);
+   const auto& rightKeys = p->keysMap_.at(rightKey);
 
-   // Get the most recent segment for the event
-   auto alertMessages = p->textEventManager_->message_list(alertKey);
-   std::shared_ptr<const awips::Segment> alertSegment =
-      alertMessages[messageIndex]->segments().back();
+   switch (left.column())
+   {
+   case static_cast<int>(Column::Etn):
+      return leftKey.etn_ < rightKey.etn_;
 
-   p->observedMap_.insert_or_assign(alertKey, alertSegment->observed_);
-   p->threatCategoryMap_.insert_or_assign(alertKey,
-                                          alertSegment->threatCategory_);
-   p->tornadoPossibleMap_.insert_or_assign(alertKey,
-                                           alertSegment->tornadoPossible_);
+   case static_cast<int>(Column::ThreatCategory):
+      return static_cast<int>(leftKeys.threatCategory_) <
+             static_cast<int>(rightKeys.threatCategory_);
 
-   if (alertSegment->codedLocation_.has_value())
-   {
-      // Update centroid and distance
-      common::Coordinate centroid =
-         common::GetCentroid(alertSegment->codedLocation_->coordinates());
+   case static_cast<int>(Column::StartTime):
+      return leftKeys.startTime_ < rightKeys.startTime_;
 
-      p->geodesic_.Inverse(p->previousPosition_.latitude_,
-                           p->previousPosition_.longitude_,
-                           centroid.latitude_,
-                           centroid.longitude_,
-                           distanceInMeters);
+   case static_cast<int>(Column::EndTime):
+      return leftKeys.endTime_ < rightKeys.endTime_;
+
+   case static_cast<int>(Column::Distance):
+      return p->distanceMap_.at(leftKey) < p->distanceMap_.at(rightKey);
 
-      p->centroidMap_.insert_or_assign(alertKey, centroid);
-      p->distanceMap_.insert_or_assign(alertKey, distanceInMeters);
+   default:
+      return QString::compare(leftKeys.text_[left.column()],
+                              rightKeys.text_[left.column()],
+                              caseSensitivity) < 0;
    }
-   else if (!p->centroidMap_.contains(alertKey))
+}
+
+bool AlertModel::RowMatches(int row, const QRegularExpression& expression) const
+{
+   if (row < 0 || row >= p->textEventKeys_.size())
    {
-      // The alert has no location, so provide a default
-      p->centroidMap_.insert_or_assign(alertKey, common::Coordinate {0.0, 0.0});
-      p->distanceMap_.insert_or_assign(alertKey, 0.0);
+      return false;
    }
 
-   // Update row
-   if (!p->textEventKeys_.contains(alertKey))
+   const auto& keys = p->keysMap_.at(p->textEventKeys_.at(row));
+
+   for (int column = kFirstColumn; column <= kLastColumn; ++column)
    {
-      int newIndex = p->textEventKeys_.size();
-      beginInsertRows(QModelIndex(), newIndex, newIndex);
-      p->textEventKeys_.push_back(alertKey);
-      endInsertRows();
+      const QString text =
+         (column == static_cast<int>(Column::Distance)) ?
+            data(createIndex(row, column)).toString() :
+            keys.text_[column];
+
+      if (expression.match(text).hasMatch())
+      {
+         return true;
+      }
+   }
+
+   return false;
+}
+
+void AlertModel::HandleAlert(const types::TextEventKey& alertKey,
+                             size_t                     messageIndex)
+{
+   SPDLOG_LOGGER_TRACE(logger_, "Handle alert: {}", alertKey.ToString());
+
+   // Alerts are updated in batches, once per event loop iteration, to avoid
+   // notifying views for each alert when many alerts are received at once
+   auto it = p->pendingAlerts_.find(alertKey);
+   if (it == p->pendingAlerts_.end())
+   {
+      p->pendingAlerts_.emplace(alertKey, messageIndex);
    }
    else
    {
-      const int   row         = p->textEventKeys_.indexOf(alertKey);
-      QModelIndex topLeft     = createIndex(row, kFirstColumn);
-      QModelIndex bottomRight = createIndex(row, kLastColumn);
+      it->second = std::max(it->second, messageIndex);
+   }
+
+   if (!p->updatePending_)
+   {
+      p->updatePending_ = true;
+      QMetaObject::invokeMethod(
+         this, [this]() { HandlePendingAlerts(); }, Qt::QueuedConnection);
+   }
+}
+
+void AlertModel::HandlePendingAlerts()
+{
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Handle pending alerts: {}",
+                       p->pendingAlerts_.size());
+
+   p->updatePending_ = false;
+
+   QList<types::TextEventKey> newKeys {};
+   int                        firstUpdatedRow = rowCount();
+   int                        lastUpdatedRow  = -1;
+
+   for (auto& pendingAlert : p->pendingAlerts_)
+   {
+      const types::TextEventKey& alertKey = pendingAlert.first;
+
+      p->UpdateAlert(alertKey, pendingAlert.second);
+
+      auto it = p->rowMap_.find(alertKey);
+      if (it == p->rowMap_.cend())
+      {
+         p->rowMap_.emplace(alertKey,
+                            static_cast<int>(p->textEventKeys_.size() +
+                                             newKeys.size()));
+         newKeys.push_back(alertKey);
+      }
+      else
+      {
+         firstUpdatedRow = std::min(firstUpdatedRow, it->second);
+         lastUpdatedRow  = std::max(lastUpdatedRow, it->second);
+      }
+   }
+
+   p->pendingAlerts_.clear();
+
+   // Update existing rows
+   if (lastUpdatedRow >= firstUpdatedRow)
+   {
+      QModelIndex topLeft     = createIndex(firstUpdatedRow, kFirstColumn);
+      QModelIndex bottomRight = createIndex(lastUpdatedRow, kLastColumn);
 
       Q_EMIT dataChanged(topLeft, bottomRight);
    }
+
+   // Insert new rows
+   if (!newKeys.empty())
+   {
+      const int firstRow = static_cast<int>(p->textEventKeys_.size());
+      const int lastRow  = firstRow + static_cast<int>(newKeys.size()) - 1;
+
+      beginInsertRows(QModelIndex(), firstRow, lastRow);
+      p->textEventKeys_.append(newKeys);
+      endInsertRows();
+   }
 }
 
 void AlertModel::HandleMapUpdate(double latitude, double longitude)
 {
-   logger_->trace("Handle map update: {}, {}", latitude, longitude);
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Handle map update: {}, {}",
+                       latitude,
+                       longitude);
 
    double distanceInMeters;
 
+   if (p->previousPositionValid_)
+   {
+      p->geodesic_.Inverse(p->previousPosition_.latitude_,
+                           p->previousPosition_.longitude_,
+                           latitude,
+                           longitude,
+                           distanceInMeters);
+
+      if (distanceInMeters < kDistanceUpdateThresholdMeters_)
+      {
+         return;
+      }
+   }
+
    for (const auto& textEvent : p->textEventKeys_)
    {
       auto& centroid = p->centroidMap_.at(textEvent);
@@ -407,7 +529,8 @@ void AlertModel::HandleMapUpdate(double latitude, double longitude)
       }
    }
 
-   p->previousPosition_ = {latitude, longitude};
+   p->previousPosition_      = {latitude, longitude};
+   p->previousPositionValid_ = true;
 
    QModelIndex topLeft = createIndex(0, static_cast<int>(Column::Distance));
    QModelIndex bottomRight =
@@ -425,6 +548,86 @@ AlertModelImpl::AlertModelImpl() :
 {
 }
 
+void AlertModelImpl::UpdateAlert(const types::TextEventKey& alertKey,
+                                 size_t                     messageIndex)
+{
+   double distanceInMeters;
+
+   // Get the most recent segment for the event
+   auto alertMessages = textEventManager_->message_list(alertKey);
+   std::shared_ptr<const awips::Segment> alertSegment =
+      alertMessages[messageIndex]->segments().back();
+
+   observedMap_.insert_or_assign(alertKey, alertSegment->observed_);
+   threatCategoryMap_.insert_or_assign(alertKey, alertSegment->threatCategory_);
+   tornadoPossibleMap_.insert_or_assign(alertKey,
+                                        alertSegment->tornadoPossible_);
+
+   if (alertSegment->codedLocation_.has_value())
+   {
+      // Update centroid and distance
+      common::Coordinate centroid =
+         common::GetCentroid(alertSegment->codedLocation_->coordinates());
+
+      geodesic_.Inverse(previousPosition_.latitude_,
+                        previousPosition_.longitude_,
+                        centroid.latitude_,
+                        centroid.longitude_,
+                        distanceInMeters);
+
+      centroidMap_.insert_or_assign(alertKey, centroid);
+      distanceMap_.insert_or_assign(alertKey, distanceInMeters);
+   }
+   else if (!centroidMap_.contains(alertKey))
+   {
+      // The alert has no location, so provide a default
+      centroidMap_.insert_or_assign(alertKey, common::Coordinate {0.0, 0.0});
+      distanceMap_.insert_or_assign(alertKey, 0.0);
+   }
+
+   UpdateKeys(alertKey);
+}
+
+void AlertModelImpl::UpdateKeys(const types::TextEventKey& alertKey)
+{
+   AlertKeys keys {};
+
+   keys.threatCategory_ = GetThreatCategory(alertKey);
+   keys.startTime_      = GetStartTime(alertKey);
+   keys.endTime_        = GetEndTime(alertKey);
+
+   auto SetText = [&keys](AlertModel::Column column, const std::string& text)
+   { keys.text_[static_cast<int>(column)] = QString::fromStdString(text); };
+
+   SetText(AlertModel::Column::Etn, std::to_string(alertKey.etn_));
+   SetText(AlertModel::Column::OfficeId, alertKey.officeId_);
+   SetText(AlertModel::Column::Phenomenon,
+           awips::GetPhenomenonText(alertKey.phenomenon_));
+   SetText(AlertModel::Column::Significance,
+           awips::GetSignificanceText(alertKey.significance_));
+   SetText(AlertModel::Column::ThreatCategory,
+           awips::ibw::GetThreatCategoryName(keys.threatCategory_));
+   SetText(AlertModel::Column::State, GetState(alertKey));
+   SetText(AlertModel::Column::Counties, GetCounties(alertKey));
+   SetText(AlertModel::Column::StartTime,
+           scwx::util::TimeString(keys.startTime_));
+   SetText(AlertModel::Column::EndTime, scwx::util::TimeString(keys.endTime_));
+
+   auto& tornadoText =
+      keys.text_[static_cast<int>(AlertModel::Column::Tornado)];
+   if (alertKey.phenomenon_ == awips::Phenomenon::Tornado &&
+       GetObserved(alertKey))
+   {
+      tornadoText = AlertModel::tr("Observed");
+   }
+   else if (GetTornadoPossible(alertKey))
+   {
+      tornadoText = AlertModel::tr("Possible");
+   }
+
+   keysMap_.insert_or_assign(alertKey, std::move(keys));
+}
+
 bool AlertModelImpl::GetObserved(const types::TextEventKey& key)
 {
    bool observed = false;
@@ -531,11 +734,6 @@ AlertModelImpl::GetStartTime(const types::TextEventKey& key)
    }
 }
 
-std::string AlertModelImpl::GetStartTimeString(const types::TextEventKey& key)
-{
-   return scwx::util::TimeString(GetStartTime(key));
-}
-
 std::chrono::system_clock::time_point
 AlertModelImpl::GetEndTime(const types::TextEventKey& key)
 {
@@ -556,11 +754,6 @@ AlertModelImpl::GetEndTime(const types::TextEventKey& key)
    }
 }
 
-std::string AlertModelImpl::GetEndTimeString(const types::TextEventKey& key)
-{
-   return scwx::util::TimeString(GetEndTime(key));
-}
-
 } // namespace model
 } // namespace qt
 } // namespace scwx
@@ -7,6 +7,8 @@
 
 #include <QAbstractTableModel>
 
+class QRegularExpression;
+
 namespace scwx
 {
 namespace qt
@@ -49,11 +51,39 @@ public:
                        Qt::Orientation orientation,
                        int             role = Qt::DisplayRole) const override;
 
+   /**
+    * Compares two rows by the sort key of the column of the left index. Sort
+    * keys are computed when an alert is updated, such that rows are compared
+    * without building item data.
+    *
+    * @param [in] left Index of the left row
+    * @param [in] right Index of the right row
+    * @param [in] caseSensitivity Case sensitivity of text comparisons
+    *
+    * @return true if the left row sorts before the right row
+    */
+   bool LessThan(const QModelIndex&  left,
+                 const QModelIndex&  right,
+                 Qt::CaseSensitivity caseSensitivity) const;
+
+   /**
+    * Determines whether the display text of any column in a row matches a
+    * regular expression, using the text computed when the alert was updated.
+    *
+    * @param [in] row Row
+    * @param [in] expression Regular expression
+    *
+    * @return true if any column matches
+    */
+   bool RowMatches(int row, const QRegularExpression& expression) const;
+
 public slots:
    void HandleAlert(const types::TextEventKey& alertKey, size_t messageIndex);
    void HandleMapUpdate(double latitude, double longitude);
 
 private:
+   void HandlePendingAlerts();
+
    std::unique_ptr<AlertModelImpl> p;
 
    friend class AlertModelImpl;
@@ -1,11 +1,14 @@
 #include <scwx/qt/model/alert_proxy_model.hpp>
 #include <scwx/qt/model/alert_model.hpp>
+#include <scwx/qt/manager/text_event_manager.hpp>
 #include <scwx/qt/types/qt_types.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <mutex>
+#include <unordered_set>
 
 #include <boost/asio/steady_timer.hpp>
 
@@ -25,12 +28,24 @@ public:
    explicit AlertProxyModelImpl(AlertProxyModel* self);
    ~AlertProxyModelImpl();
 
+   bool IsActive(const types::TextEventKey& key);
    void UpdateAlerts();
 
    AlertProxyModel* self_;
 
    bool alertActiveFilterEnabled_;
 
+   std::shared_ptr<manager::TextEventManager> textEventManager_ {
+      manager::TextEventManager::Instance()};
+
+   // Text events which have not ended, queried from the text event index when
+   // the filter is evaluated after an alert update
+   std::unordered_set<types::TextEventKey,
+                      types::TextEventHash<types::TextEventKey>>
+                     activeKeys_ {};
+   std::atomic<bool> activeKeysDirty_ {true};
+   std::mutex        activeKeysMutex_ {};
+
    boost::asio::steady_timer alertUpdateTimer_;
    std::mutex                alertMutex_ {};
 };
@@ -45,6 +60,7 @@ AlertProxyModel::~AlertProxyModel() = default;
 void AlertProxyModel::SetAlertActiveFilter(bool enabled)
 {
    p->alertActiveFilterEnabled_ = enabled;
+   p->activeKeysDirty_          = true;
    invalidateRowsFilter();
 }
 
@@ -53,28 +69,49 @@ bool AlertProxyModel::filterAcceptsRow(int                sourceRow,
 {
    bool acceptAlertActiveFilter = true;
 
-   if (p->alertActiveFilterEnabled_)
+   auto alertModel = dynamic_cast<AlertModel*>(sourceModel());
+
+   if (p->alertActiveFilterEnabled_ && alertModel != nullptr)
    {
-      // Get source model index
-      QModelIndex endTimeIndex =
-         sourceModel()->index(sourceRow,
-                              static_cast<int>(AlertModel::Column::EndTime),
-                              sourceParent);
-
-      // Get source end time
-      auto endTime = sourceModel()
-                        ->data(endTimeIndex, types::TimePointRole)
-                        .value<std::chrono::system_clock::time_point>();
-
-      // Compare end time to current
-      if (endTime < std::chrono::system_clock::now())
-      {
-         acceptAlertActiveFilter = false;
-      }
+      // Look up the event in the active events, instead of determining the
+      // end time of each event
+      QModelIndex index = alertModel->index(sourceRow, 0, sourceParent);
+      acceptAlertActiveFilter = p->IsActive(alertModel->key(index));
+   }
+
+   if (!acceptAlertActiveFilter)
+   {
+      return false;
    }
 
-   return acceptAlertActiveFilter &&
-          QSortFilterProxyModel::filterAcceptsRow(sourceRow, sourceParent);
+   // Match the filter against the display text computed when each alert was
+   // updated, instead of building the item data of each column
+   if (alertModel != nullptr && filterKeyColumn() == -1 &&
+       filterRole() == Qt::DisplayRole)
+   {
+      const QRegularExpression expression = filterRegularExpression();
+
+      return expression.pattern().isEmpty() ||
+             alertModel->RowMatches(sourceRow, expression);
+   }
+
+   return QSortFilterProxyModel::filterAcceptsRow(sourceRow, sourceParent);
+}
+
+bool AlertProxyModel::lessThan(const QModelIndex& sourceLeft,
+                               const QModelIndex& sourceRight) const
+{
+   auto alertModel = dynamic_cast<AlertModel*>(sourceModel());
+
+   // Compare the sort keys computed when each alert was updated, instead of
+   // building the item data of each row
+   if (alertModel != nullptr && sortRole() == types::ItemDataRole::SortRole)
+   {
+      return alertModel->LessThan(
+         sourceLeft, sourceRight, sortCaseSensitivity());
+   }
+
+   return QSortFilterProxyModel::lessThan(sourceLeft, sourceRight);
 }
 
 AlertProxyModelImpl::AlertProxyModelImpl(AlertProxyModel* self) :
@@ -82,6 +119,15 @@ AlertProxyModelImpl::AlertProxyModelImpl(AlertProxyModel* self) :
     alertActiveFilterEnabled_ {false},
     alertUpdateTimer_ {scwx::util::io_context()}
 {
+   // The text event index is updated before alerts are added to the alert
+   // model, so the active events are queried again before the filter is next
+   // evaluated
+   QObject::connect(textEventManager_.get(),
+                    &manager::TextEventManager::AlertUpdated,
+                    self_,
+                    [this]() { activeKeysDirty_ = true; },
+                    Qt::DirectConnection);
+
    // Schedule alert update
    UpdateAlerts();
 }
@@ -92,9 +138,26 @@ AlertProxyModelImpl::~AlertProxyModelImpl()
    alertUpdateTimer_.cancel();
 }
 
+bool AlertProxyModelImpl::IsActive(const types::TextEventKey& key)
+{
+   std::unique_lock lock(activeKeysMutex_);
+
+   if (activeKeysDirty_.exchange(false))
+   {
+      auto keys = textEventManager_->QueryEvents(
+         std::chrono::system_clock::now(),
+         std::chrono::system_clock::time_point::max());
+
+      activeKeys_.clear();
+      activeKeys_.insert(keys.cbegin(), keys.cend());
+   }
+
+   return activeKeys_.contains(key);
+}
+
 void AlertProxyModelImpl::UpdateAlerts()
 {
-   logger_->trace("UpdateAlerts");
+   SPDLOG_LOGGER_TRACE(logger_, "UpdateAlerts");
 
    // Take a unique lock before modifying feature lists
    std::unique_lock lock(alertMutex_);
@@ -102,6 +165,7 @@ void AlertProxyModelImpl::UpdateAlerts()
    // Re-evaluate for expired alerts
    if (alertActiveFilterEnabled_)
    {
+      activeKeysDirty_ = true;
       self_->invalidateRowsFilter();
    }
 
@@ -27,6 +27,10 @@ public:
    bool filterAcceptsRow(int                sourceRow,
                          const QModelIndex& sourceParent) const override;
 
+protected:
+   bool lessThan(const QModelIndex& sourceLeft,
+                 const QModelIndex& sourceRight) const override;
+
 private:
    std::unique_ptr<AlertProxyModelImpl> p;
 
@@ -309,7 +309,10 @@ QVariant RadarSiteModel::headerData(int             section,
 
 void RadarSiteModel::HandleMapUpdate(double latitude, double longitude)
 {
-   logger_->trace("Handle map update: {}, {}", latitude, longitude);
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Handle map update: {}, {}",
+                       latitude,
+                       longitude);
 
    double distanceInMeters;
 
@@ -1,5 +1,7 @@
 #include <scwx/qt/request/download_request.hpp>
 
+#include <atomic>
+
 namespace scwx
 {
 namespace qt
@@ -13,21 +15,24 @@ class DownloadRequest::Impl
 {
 public:
    explicit Impl(const std::string&           url,
-                 const std::filesystem::path& destinationPath) :
-       url_ {url}, destinationPath_ {destinationPath}
+                 const std::filesystem::path& destinationPath,
+                 Priority                     priority) :
+       url_ {url}, destinationPath_ {destinationPath}, priority_ {priority}
    {
    }
    ~Impl() = default;
 
    const std::string           url_;
    const std::filesystem::path destinationPath_;
+   const Priority              priority_;
 
-   bool canceled_ = false;
+   std::atomic<bool> canceled_ {false};
 };
 
 DownloadRequest::DownloadRequest(const std::string&           url,
-                                 const std::filesystem::path& destinationPath) :
-    p(std::make_unique<Impl>(url, destinationPath))
+                                 const std::filesystem::path& destinationPath,
+                                 Priority                     priority) :
+    p(std::make_unique<Impl>(url, destinationPath, priority))
 {
 }
 DownloadRequest::~DownloadRequest() = default;
@@ -42,6 +47,11 @@ const std::filesystem::path& DownloadRequest::destination_path() const
    return p->destinationPath_;
 }
 
+DownloadRequest::Priority DownloadRequest::priority() const
+{
+   return p->priority_;
+}
+
 void DownloadRequest::Cancel()
 {
    p->canceled_ = true;
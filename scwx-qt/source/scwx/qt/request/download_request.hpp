@@ -1,5 +1,7 @@
 #pragma once
 
+#include <scwx/util/priority_thread_pool.hpp>
+
 #include <filesystem>
 #include <memory>
 
@@ -26,13 +28,23 @@ public:
       DigestError
    };
 
-   explicit DownloadRequest(const std::string&           url,
-                            const std::filesystem::path& destinationPath);
+   typedef scwx::util::PriorityThreadPool::Priority Priority;
+
+   explicit DownloadRequest(
+      const std::string&           url,
+      const std::filesystem::path& destinationPath,
+      Priority                     priority = Priority::High);
    ~DownloadRequest();
 
    const std::string&           url() const;
    const std::filesystem::path& destination_path() const;
+   Priority                     priority() const;
 
+   /**
+    * @brief Cancels the request. A queued request completes without being
+    * downloaded, and a download in progress is stopped. This may be called
+    * from any thread.
+    */
    void Cancel();
 
    bool IsCanceled() const;
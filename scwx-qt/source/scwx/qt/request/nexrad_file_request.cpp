@@ -1,6 +1,8 @@
 #include <scwx/qt/request/nexrad_file_request.hpp>
 #include <scwx/qt/config/radar_site.hpp>
 
+#include <atomic>
+
 namespace scwx
 {
 namespace qt
@@ -25,6 +27,7 @@ public:
    std::shared_ptr<config::RadarSite> currentRadarSite_ {};
 
    std::shared_ptr<types::RadarProductRecord> radarProductRecord_ {nullptr};
+   std::atomic<bool>                          cancelled_ {false};
 };
 
 NexradFileRequest::NexradFileRequest(const std::string& currentRadarSite) :
@@ -44,12 +47,22 @@ NexradFileRequest::radar_product_record() const
    return p->radarProductRecord_;
 }
 
+bool NexradFileRequest::is_cancelled() const
+{
+   return p->cancelled_;
+}
+
 void NexradFileRequest::set_radar_product_record(
    const std::shared_ptr<types::RadarProductRecord>& record)
 {
    p->radarProductRecord_ = record;
 }
 
+void NexradFileRequest::Cancel()
+{
+   p->cancelled_ = true;
+}
+
 } // namespace request
 } // namespace qt
 } // namespace scwx
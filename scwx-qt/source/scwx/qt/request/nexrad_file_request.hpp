@@ -24,9 +24,22 @@ public:
    std::string                                current_radar_site() const;
    std::shared_ptr<types::RadarProductRecord> radar_product_record() const;
 
+   /**
+    * @brief Whether the request has been cancelled. A load is abandoned once
+    * every request waiting on it has been cancelled.
+    */
+   bool is_cancelled() const;
+
    void set_radar_product_record(
       const std::shared_ptr<types::RadarProductRecord>& record);
 
+   /**
+    * @brief Cancels the request, such as when superseded by a later
+    * selection. The request still completes, without a radar product record
+    * if its load was abandoned.
+    */
+   void Cancel();
+
 private:
    class Impl;
    std::unique_ptr<Impl> p;
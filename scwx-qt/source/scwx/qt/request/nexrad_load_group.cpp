@@ -0,0 +1,74 @@
+#include <scwx/qt/request/nexrad_load_group.hpp>
+
+#include <mutex>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace request
+{
+
+static const std::string logPrefix_ = "scwx::qt::request::nexrad_load_group";
+
+class NexradLoadGroup::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   std::vector<std::weak_ptr<NexradFileRequest>> requests_ {};
+   std::mutex                                    requestsMutex_ {};
+};
+
+NexradLoadGroup::NexradLoadGroup() : p(std::make_unique<Impl>()) {}
+NexradLoadGroup::~NexradLoadGroup()
+{
+   CancelAll();
+}
+
+void NexradLoadGroup::Add(const std::shared_ptr<NexradFileRequest>& request)
+{
+   if (request == nullptr)
+   {
+      return;
+   }
+
+   std::unique_lock lock {p->requestsMutex_};
+
+   // Completed requests are no longer held by their loads
+   std::erase_if(p->requests_,
+                 [](const auto& weakRequest) { return weakRequest.expired(); });
+
+   p->requests_.push_back(request);
+}
+
+void NexradLoadGroup::CancelAll()
+{
+   std::vector<std::weak_ptr<NexradFileRequest>> requests {};
+
+   {
+      std::unique_lock lock {p->requestsMutex_};
+      requests.swap(p->requests_);
+   }
+
+   for (auto& weakRequest : requests)
+   {
+      auto request = weakRequest.lock();
+      if (request != nullptr)
+      {
+         request->Cancel();
+      }
+   }
+}
+
+void NexradLoadGroup::NextGeneration()
+{
+   // Requests are only held until the generation ends
+   CancelAll();
+}
+
+} // namespace request
+} // namespace qt
+} // namespace scwx
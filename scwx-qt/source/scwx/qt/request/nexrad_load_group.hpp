@@ -0,0 +1,55 @@
+#pragma once
+
+#include <scwx/qt/request/nexrad_file_request.hpp>
+
+#include <memory>
+
+namespace scwx
+{
+namespace qt
+{
+namespace request
+{
+
+/**
+ * @brief Requests issued on behalf of one consumer, such as a radar product
+ * view. Each selection made by the consumer starts a new generation, and the
+ * requests of previous generations are cancelled, such that loads no longer
+ * wanted by any consumer are abandoned.
+ */
+class NexradLoadGroup
+{
+public:
+   explicit NexradLoadGroup();
+   ~NexradLoadGroup();
+
+   NexradLoadGroup(const NexradLoadGroup&)            = delete;
+   NexradLoadGroup& operator=(const NexradLoadGroup&) = delete;
+
+   NexradLoadGroup(NexradLoadGroup&&) noexcept            = delete;
+   NexradLoadGroup& operator=(NexradLoadGroup&&) noexcept = delete;
+
+   /**
+    * @brief Adds a request to the current generation
+    */
+   void Add(const std::shared_ptr<NexradFileRequest>& request);
+
+   /**
+    * @brief Cancels all outstanding requests
+    */
+   void CancelAll();
+
+   /**
+    * @brief Starts a new generation, cancelling the outstanding requests of
+    * previous generations
+    */
+   void NextGeneration();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace request
+} // namespace qt
+} // namespace scwx
@@ -4,6 +4,7 @@
 #include <scwx/qt/map/map_provider.hpp>
 #include <scwx/qt/types/alert_types.hpp>
 #include <scwx/qt/types/location_types.hpp>
+#include <scwx/qt/types/mosaic_types.hpp>
 #include <scwx/qt/types/qt_types.hpp>
 #include <scwx/qt/types/time_types.hpp>
 #include <scwx/util/time.hpp>
@@ -38,6 +39,10 @@ public:
          types::GetDefaultTimeZoneName(types::DefaultTimeZone::Radar);
       std::string defaultMapProviderValue =
          map::GetMapProviderName(map::MapProvider::MapTiler);
+      std::string defaultMosaicBlendModeValue =
+         types::GetMosaicBlendModeName(types::MosaicBlendMode::NearestRadar);
+      std::string defaultMosaicProductValue =
+         types::GetMosaicProductName(types::MosaicProduct::LowestTilt);
       std::string defaultPositioningPlugin =
          types::GetPositioningPluginName(types::PositioningPlugin::Default);
       std::string defaultThemeValue =
@@ -47,31 +52,66 @@ public:
       boost::to_lower(defaultDefaultAlertActionValue);
       boost::to_lower(defaultDefaultTimeZoneValue);
       boost::to_lower(defaultMapProviderValue);
+      boost::to_lower(defaultMosaicBlendModeValue);
+      boost::to_lower(defaultMosaicProductValue);
       boost::to_lower(defaultPositioningPlugin);
       boost::to_lower(defaultThemeValue);
 
       antiAliasingEnabled_.SetDefault(true);
       clockFormat_.SetDefault(defaultClockFormatValue);
+      cpuPrimitiveFiltering_.SetDefault(false);
       customStyleDrawLayer_.SetDefault(".*\\.annotations\\.points");
       debugEnabled_.SetDefault(false);
       defaultAlertAction_.SetDefault(defaultDefaultAlertActionValue);
       defaultRadarSite_.SetDefault("KLSX");
       defaultTimeZone_.SetDefault(defaultDefaultTimeZoneValue);
+      downloadBandwidthLimit_.SetDefault(0);
+      dynamicResolutionScale_.SetDefault(50);
+      exactRadarGeometry_.SetDefault(false);
       fontSizes_.SetDefault({16});
+      gpuRadarGeometry_.SetDefault(false);
+      gpuUploadBudget_.SetDefault(16384);
       loopDelay_.SetDefault(2500);
+      loopFrameSkip_.SetDefault(false);
       loopSpeed_.SetDefault(5.0);
       loopTime_.SetDefault(30);
       gridWidth_.SetDefault(1);
       gridHeight_.SetDefault(1);
+      mapCacheSize_.SetDefault(256);
+      mapPrefetchMaxZoom_.SetDefault(10);
+      mapPrefetchMinZoom_.SetDefault(4);
+      mapPrefetchRadarSites_.SetDefault("");
+      mapPrefetchRadius_.SetDefault(250);
       mapProvider_.SetDefault(defaultMapProviderValue);
       mapboxApiKey_.SetDefault("?");
       maptilerApiKey_.SetDefault("?");
+      monitoredRadarSites_.SetDefault("");
+      mosaicBlendMode_.SetDefault(defaultMosaicBlendModeValue);
+      mosaicProduct_.SetDefault(defaultMosaicProductValue);
+      mosaicRadarSites_.SetDefault("");
+      nexradLevel2Mirrors_.SetDefault("");
+      nexradLevel3Mirrors_.SetDefault("");
+      nexradLocalDirectory_.SetDefault("");
+      nexradObjectCacheSize_.SetDefault(4096);
       nmeaBaudRate_.SetDefault(9600);
       nmeaSource_.SetDefault("");
+      placefileIconClustering_.SetDefault(true);
       positioningPlugin_.SetDefault(defaultPositioningPlugin);
+      predictiveRadarPrefetch_.SetDefault(true);
+      radarCompressedCacheSize_.SetDefault(1024);
+      radarDownloadThreads_.SetDefault(4);
+      radarElevationCacheSize_.SetDefault(0);
+      radarLatestCut_.SetDefault(false);
+      radarMemoryLimit_.SetDefault(0);
+      radarProductCacheSize_.SetDefault(2048);
+      radarRangedDownload_.SetDefault(false);
+      radarSweepTexture_.SetDefault(false);
       showMapAttribution_.SetDefault(true);
       showMapCenter_.SetDefault(false);
       showMapLogo_.SetDefault(true);
+      stormMotionDirection_.SetDefault(0);
+      stormMotionSpeed_.SetDefault(0);
+      textureCompression_.SetDefault(false);
       theme_.SetDefault(defaultThemeValue);
       themeFile_.SetDefault("");
       trackLocation_.SetDefault(false);
@@ -79,10 +119,16 @@ public:
       warningsProvider_.SetDefault(defaultWarningsProviderValue);
       cursorIconAlwaysOn_.SetDefault(false);
 
+      downloadBandwidthLimit_.SetMinimum(0);
+      downloadBandwidthLimit_.SetMaximum(1048576);
+      dynamicResolutionScale_.SetMinimum(25);
+      dynamicResolutionScale_.SetMaximum(100);
       fontSizes_.SetElementMinimum(1);
       fontSizes_.SetElementMaximum(72);
       fontSizes_.SetValidator([](const std::vector<std::int64_t>& value)
                               { return !value.empty(); });
+      gpuUploadBudget_.SetMinimum(0);
+      gpuUploadBudget_.SetMaximum(1048576);
       gridWidth_.SetMinimum(1);
       gridWidth_.SetMaximum(2);
       gridHeight_.SetMinimum(1);
@@ -93,8 +139,32 @@ public:
       loopSpeed_.SetMaximum(99.99);
       loopTime_.SetMinimum(1);
       loopTime_.SetMaximum(1440);
+      mapCacheSize_.SetMinimum(1);
+      mapCacheSize_.SetMaximum(16384);
+      mapPrefetchMaxZoom_.SetMinimum(0);
+      mapPrefetchMaxZoom_.SetMaximum(14);
+      mapPrefetchMinZoom_.SetMinimum(0);
+      mapPrefetchMinZoom_.SetMaximum(14);
+      mapPrefetchRadius_.SetMinimum(10);
+      mapPrefetchRadius_.SetMaximum(1000);
+      nexradObjectCacheSize_.SetMinimum(0);
+      nexradObjectCacheSize_.SetMaximum(65536);
       nmeaBaudRate_.SetMinimum(1);
       nmeaBaudRate_.SetMaximum(999999999);
+      radarCompressedCacheSize_.SetMinimum(0);
+      radarCompressedCacheSize_.SetMaximum(65536);
+      radarDownloadThreads_.SetMinimum(1);
+      radarDownloadThreads_.SetMaximum(32);
+      radarElevationCacheSize_.SetMinimum(0);
+      radarElevationCacheSize_.SetMaximum(4096);
+      radarMemoryLimit_.SetMinimum(0);
+      radarMemoryLimit_.SetMaximum(262144);
+      radarProductCacheSize_.SetMinimum(256);
+      radarProductCacheSize_.SetMaximum(65536);
+      stormMotionDirection_.SetMinimum(0);
+      stormMotionDirection_.SetMaximum(359);
+      stormMotionSpeed_.SetMinimum(0);
+      stormMotionSpeed_.SetMaximum(200);
 
       customStyleDrawLayer_.SetTransform([](const std::string& value)
                                          { return boost::trim_copy(value); });
@@ -123,6 +193,14 @@ public:
                                  { return !value.empty(); });
       maptilerApiKey_.SetValidator([](const std::string& value)
                                    { return !value.empty(); });
+      mosaicBlendMode_.SetValidator(
+         SCWX_SETTINGS_ENUM_VALIDATOR(types::MosaicBlendMode,
+                                      types::MosaicBlendModeIterator(),
+                                      types::GetMosaicBlendModeName));
+      mosaicProduct_.SetValidator(
+         SCWX_SETTINGS_ENUM_VALIDATOR(types::MosaicProduct,
+                                      types::MosaicProductIterator(),
+                                      types::GetMosaicProductName));
       positioningPlugin_.SetValidator(
          SCWX_SETTINGS_ENUM_VALIDATOR(types::PositioningPlugin,
                                       types::PositioningPluginIterator(),
@@ -140,6 +218,8 @@ public:
 
    SettingsVariable<bool>        antiAliasingEnabled_ {"anti_aliasing_enabled"};
    SettingsVariable<std::string> clockFormat_ {"clock_format"};
+   SettingsVariable<bool>        cpuPrimitiveFiltering_ {
+      "cpu_primitive_filtering"};
    SettingsVariable<std::string> customStyleDrawLayer_ {
       "custom_style_draw_layer"};
    SettingsVariable<std::string> customStyleUrl_ {"custom_style_url"};
@@ -147,21 +227,77 @@ public:
    SettingsVariable<std::string> defaultAlertAction_ {"default_alert_action"};
    SettingsVariable<std::string> defaultRadarSite_ {"default_radar_site"};
    SettingsVariable<std::string> defaultTimeZone_ {"default_time_zone"};
+   SettingsVariable<std::int64_t>               downloadBandwidthLimit_ {
+      "download_bandwidth_limit"};
+   SettingsVariable<std::int64_t>               dynamicResolutionScale_ {
+      "dynamic_resolution_scale"};
+   SettingsVariable<bool>                       exactRadarGeometry_ {
+      "exact_radar_geometry"};
    SettingsContainer<std::vector<std::int64_t>> fontSizes_ {"font_sizes"};
+   SettingsVariable<bool>                       gpuRadarGeometry_ {
+      "gpu_radar_geometry"};
+   SettingsVariable<std::int64_t>               gpuUploadBudget_ {
+      "gpu_upload_budget"};
    SettingsVariable<std::int64_t>               gridWidth_ {"grid_width"};
    SettingsVariable<std::int64_t>               gridHeight_ {"grid_height"};
    SettingsVariable<std::int64_t>               loopDelay_ {"loop_delay"};
+   SettingsVariable<bool>                       loopFrameSkip_ {
+      "loop_frame_skip"};
    SettingsVariable<double>                     loopSpeed_ {"loop_speed"};
    SettingsVariable<std::int64_t>               loopTime_ {"loop_time"};
+   SettingsVariable<std::int64_t>               mapCacheSize_ {
+      "map_cache_size"};
+   SettingsVariable<std::int64_t>               mapPrefetchMaxZoom_ {
+      "map_prefetch_max_zoom"};
+   SettingsVariable<std::int64_t>               mapPrefetchMinZoom_ {
+      "map_prefetch_min_zoom"};
+   SettingsVariable<std::string>                mapPrefetchRadarSites_ {
+      "map_prefetch_radar_sites"};
+   SettingsVariable<std::int64_t>               mapPrefetchRadius_ {
+      "map_prefetch_radius"};
    SettingsVariable<std::string>                mapProvider_ {"map_provider"};
    SettingsVariable<std::string>  mapboxApiKey_ {"mapbox_api_key"};
    SettingsVariable<std::string>  maptilerApiKey_ {"maptiler_api_key"};
+   SettingsVariable<std::string>  monitoredRadarSites_ {
+      "monitored_radar_sites"};
+   SettingsVariable<std::string>  mosaicBlendMode_ {"mosaic_blend_mode"};
+   SettingsVariable<std::string>  mosaicProduct_ {"mosaic_product"};
+   SettingsVariable<std::string>  mosaicRadarSites_ {"mosaic_radar_sites"};
+   SettingsVariable<std::string>  nexradLevel2Mirrors_ {
+      "nexrad_level2_mirrors"};
+   SettingsVariable<std::string>  nexradLevel3Mirrors_ {
+      "nexrad_level3_mirrors"};
+   SettingsVariable<std::string>  nexradLocalDirectory_ {
+      "nexrad_local_directory"};
+   SettingsVariable<std::int64_t> nexradObjectCacheSize_ {
+      "nexrad_object_cache_size"};
    SettingsVariable<std::int64_t> nmeaBaudRate_ {"nmea_baud_rate"};
    SettingsVariable<std::string>  nmeaSource_ {"nmea_source"};
+   SettingsVariable<bool>         placefileIconClustering_ {
+      "placefile_icon_clustering"};
    SettingsVariable<std::string>  positioningPlugin_ {"positioning_plugin"};
+   SettingsVariable<bool>         predictiveRadarPrefetch_ {
+      "predictive_radar_prefetch"};
+   SettingsVariable<std::int64_t> radarCompressedCacheSize_ {
+      "radar_compressed_cache_size"};
+   SettingsVariable<std::int64_t> radarDownloadThreads_ {
+      "radar_download_threads"};
+   SettingsVariable<std::int64_t> radarElevationCacheSize_ {
+      "radar_elevation_cache_size"};
+   SettingsVariable<bool>         radarLatestCut_ {"radar_latest_cut"};
+   SettingsVariable<std::int64_t> radarMemoryLimit_ {"radar_memory_limit"};
+   SettingsVariable<std::int64_t> radarProductCacheSize_ {
+      "radar_product_cache_size"};
+   SettingsVariable<bool>         radarRangedDownload_ {
+      "radar_ranged_download"};
+   SettingsVariable<bool>         radarSweepTexture_ {"radar_sweep_texture"};
    SettingsVariable<bool>         showMapAttribution_ {"show_map_attribution"};
    SettingsVariable<bool>         showMapCenter_ {"show_map_center"};
    SettingsVariable<bool>         showMapLogo_ {"show_map_logo"};
+   SettingsVariable<std::int64_t> stormMotionDirection_ {
+      "storm_motion_direction"};
+   SettingsVariable<std::int64_t> stormMotionSpeed_ {"storm_motion_speed"};
+   SettingsVariable<bool>         textureCompression_ {"texture_compression"};
    SettingsVariable<std::string>  theme_ {"theme"};
    SettingsVariable<std::string>  themeFile_ {"theme_file"};
    SettingsVariable<bool>         trackLocation_ {"track_location"};
@@ -175,27 +311,60 @@ GeneralSettings::GeneralSettings() :
 {
    RegisterVariables({&p->antiAliasingEnabled_,
                       &p->clockFormat_,
+                      &p->cpuPrimitiveFiltering_,
                       &p->customStyleDrawLayer_,
                       &p->customStyleUrl_,
                       &p->debugEnabled_,
                       &p->defaultAlertAction_,
                       &p->defaultRadarSite_,
                       &p->defaultTimeZone_,
+                      &p->downloadBandwidthLimit_,
+                      &p->dynamicResolutionScale_,
+                      &p->exactRadarGeometry_,
                       &p->fontSizes_,
+                      &p->gpuRadarGeometry_,
+                      &p->gpuUploadBudget_,
                       &p->gridWidth_,
                       &p->gridHeight_,
                       &p->loopDelay_,
+                      &p->loopFrameSkip_,
                       &p->loopSpeed_,
                       &p->loopTime_,
+                      &p->mapCacheSize_,
+                      &p->mapPrefetchMaxZoom_,
+                      &p->mapPrefetchMinZoom_,
+                      &p->mapPrefetchRadarSites_,
+                      &p->mapPrefetchRadius_,
                       &p->mapProvider_,
                       &p->mapboxApiKey_,
                       &p->maptilerApiKey_,
+                      &p->monitoredRadarSites_,
+                      &p->mosaicBlendMode_,
+                      &p->mosaicProduct_,
+                      &p->mosaicRadarSites_,
+                      &p->nexradLevel2Mirrors_,
+                      &p->nexradLevel3Mirrors_,
+                      &p->nexradLocalDirectory_,
+                      &p->nexradObjectCacheSize_,
                       &p->nmeaBaudRate_,
                       &p->nmeaSource_,
+                      &p->placefileIconClustering_,
                       &p->positioningPlugin_,
+                      &p->predictiveRadarPrefetch_,
+                      &p->radarCompressedCacheSize_,
+                      &p->radarDownloadThreads_,
+                      &p->radarElevationCacheSize_,
+                      &p->radarLatestCut_,
+                      &p->radarMemoryLimit_,
+                      &p->radarProductCacheSize_,
+                      &p->radarRangedDownload_,
+                      &p->radarSweepTexture_,
                       &p->showMapAttribution_,
                       &p->showMapCenter_,
                       &p->showMapLogo_,
+                      &p->stormMotionDirection_,
+                      &p->stormMotionSpeed_,
+                      &p->textureCompression_,
                       &p->theme_,
                       &p->themeFile_,
                       &p->trackLocation_,
@@ -220,6 +389,11 @@ SettingsVariable<std::string>& GeneralSettings::clock_format() const
    return p->clockFormat_;
 }
 
+SettingsVariable<bool>& GeneralSettings::cpu_primitive_filtering() const
+{
+   return p->cpuPrimitiveFiltering_;
+}
+
 SettingsVariable<std::string>& GeneralSettings::custom_style_draw_layer() const
 {
    return p->customStyleDrawLayer_;
@@ -250,12 +424,39 @@ SettingsVariable<std::string>& GeneralSettings::default_time_zone() const
    return p->defaultTimeZone_;
 }
 
+SettingsVariable<std::int64_t>&
+GeneralSettings::download_bandwidth_limit() const
+{
+   return p->downloadBandwidthLimit_;
+}
+
+SettingsVariable<std::int64_t>&
+GeneralSettings::dynamic_resolution_scale() const
+{
+   return p->dynamicResolutionScale_;
+}
+
+SettingsVariable<bool>& GeneralSettings::exact_radar_geometry() const
+{
+   return p->exactRadarGeometry_;
+}
+
 SettingsContainer<std::vector<std::int64_t>>&
 GeneralSettings::font_sizes() const
 {
    return p->fontSizes_;
 }
 
+SettingsVariable<bool>& GeneralSettings::gpu_radar_geometry() const
+{
+   return p->gpuRadarGeometry_;
+}
+
+SettingsVariable<std::int64_t>& GeneralSettings::gpu_upload_budget() const
+{
+   return p->gpuUploadBudget_;
+}
+
 SettingsVariable<std::int64_t>& GeneralSettings::grid_height() const
 {
    return p->gridHeight_;
@@ -271,6 +472,11 @@ SettingsVariable<std::int64_t>& GeneralSettings::loop_delay() const
    return p->loopDelay_;
 }
 
+SettingsVariable<bool>& GeneralSettings::loop_frame_skip() const
+{
+   return p->loopFrameSkip_;
+}
+
 SettingsVariable<double>& GeneralSettings::loop_speed() const
 {
    return p->loopSpeed_;
@@ -281,6 +487,32 @@ SettingsVariable<std::int64_t>& GeneralSettings::loop_time() const
    return p->loopTime_;
 }
 
+SettingsVariable<std::int64_t>& GeneralSettings::map_cache_size() const
+{
+   return p->mapCacheSize_;
+}
+
+SettingsVariable<std::int64_t>& GeneralSettings::map_prefetch_max_zoom() const
+{
+   return p->mapPrefetchMaxZoom_;
+}
+
+SettingsVariable<std::int64_t>& GeneralSettings::map_prefetch_min_zoom() const
+{
+   return p->mapPrefetchMinZoom_;
+}
+
+SettingsVariable<std::string>&
+GeneralSettings::map_prefetch_radar_sites() const
+{
+   return p->mapPrefetchRadarSites_;
+}
+
+SettingsVariable<std::int64_t>& GeneralSettings::map_prefetch_radius() const
+{
+   return p->mapPrefetchRadius_;
+}
+
 SettingsVariable<std::string>& GeneralSettings::map_provider() const
 {
    return p->mapProvider_;
@@ -296,6 +528,47 @@ SettingsVariable<std::string>& GeneralSettings::maptiler_api_key() const
    return p->maptilerApiKey_;
 }
 
+SettingsVariable<std::string>& GeneralSettings::monitored_radar_sites() const
+{
+   return p->monitoredRadarSites_;
+}
+
+SettingsVariable<std::string>& GeneralSettings::mosaic_blend_mode() const
+{
+   return p->mosaicBlendMode_;
+}
+
+SettingsVariable<std::string>& GeneralSettings::mosaic_product() const
+{
+   return p->mosaicProduct_;
+}
+
+SettingsVariable<std::string>& GeneralSettings::mosaic_radar_sites() const
+{
+   return p->mosaicRadarSites_;
+}
+
+SettingsVariable<std::string>& GeneralSettings::nexrad_level2_mirrors() const
+{
+   return p->nexradLevel2Mirrors_;
+}
+
+SettingsVariable<std::string>& GeneralSettings::nexrad_level3_mirrors() const
+{
+   return p->nexradLevel3Mirrors_;
+}
+
+SettingsVariable<std::string>& GeneralSettings::nexrad_local_directory() const
+{
+   return p->nexradLocalDirectory_;
+}
+
+SettingsVariable<std::int64_t>&
+GeneralSettings::nexrad_object_cache_size() const
+{
+   return p->nexradObjectCacheSize_;
+}
+
 SettingsVariable<std::int64_t>& GeneralSettings::nmea_baud_rate() const
 {
    return p->nmeaBaudRate_;
@@ -306,11 +579,64 @@ SettingsVariable<std::string>& GeneralSettings::nmea_source() const
    return p->nmeaSource_;
 }
 
+SettingsVariable<bool>& GeneralSettings::placefile_icon_clustering() const
+{
+   return p->placefileIconClustering_;
+}
+
 SettingsVariable<std::string>& GeneralSettings::positioning_plugin() const
 {
    return p->positioningPlugin_;
 }
 
+SettingsVariable<bool>& GeneralSettings::predictive_radar_prefetch() const
+{
+   return p->predictiveRadarPrefetch_;
+}
+
+SettingsVariable<std::int64_t>&
+GeneralSettings::radar_compressed_cache_size() const
+{
+   return p->radarCompressedCacheSize_;
+}
+
+SettingsVariable<std::int64_t>& GeneralSettings::radar_download_threads() const
+{
+   return p->radarDownloadThreads_;
+}
+
+SettingsVariable<std::int64_t>&
+GeneralSettings::radar_elevation_cache_size() const
+{
+   return p->radarElevationCacheSize_;
+}
+
+SettingsVariable<bool>& GeneralSettings::radar_latest_cut() const
+{
+   return p->radarLatestCut_;
+}
+
+SettingsVariable<std::int64_t>& GeneralSettings::radar_memory_limit() const
+{
+   return p->radarMemoryLimit_;
+}
+
+SettingsVariable<std::int64_t>&
+GeneralSettings::radar_product_cache_size() const
+{
+   return p->radarProductCacheSize_;
+}
+
+SettingsVariable<bool>& GeneralSettings::radar_ranged_download() const
+{
+   return p->radarRangedDownload_;
+}
+
+SettingsVariable<bool>& GeneralSettings::radar_sweep_texture() const
+{
+   return p->radarSweepTexture_;
+}
+
 SettingsVariable<bool>& GeneralSettings::show_map_attribution() const
 {
    return p->showMapAttribution_;
@@ -326,6 +652,21 @@ SettingsVariable<bool>& GeneralSettings::show_map_logo() const
    return p->showMapLogo_;
 }
 
+SettingsVariable<std::int64_t>& GeneralSettings::storm_motion_direction() const
+{
+   return p->stormMotionDirection_;
+}
+
+SettingsVariable<std::int64_t>& GeneralSettings::storm_motion_speed() const
+{
+   return p->stormMotionSpeed_;
+}
+
+SettingsVariable<bool>& GeneralSettings::texture_compression() const
+{
+   return p->textureCompression_;
+}
+
 SettingsVariable<std::string>& GeneralSettings::theme() const
 {
    return p->theme_;
@@ -379,27 +720,63 @@ bool operator==(const GeneralSettings& lhs, const GeneralSettings& rhs)
 {
    return (lhs.p->antiAliasingEnabled_ == rhs.p->antiAliasingEnabled_ &&
            lhs.p->clockFormat_ == rhs.p->clockFormat_ &&
+           lhs.p->cpuPrimitiveFiltering_ == rhs.p->cpuPrimitiveFiltering_ &&
            lhs.p->customStyleDrawLayer_ == rhs.p->customStyleDrawLayer_ &&
            lhs.p->customStyleUrl_ == rhs.p->customStyleUrl_ &&
            lhs.p->debugEnabled_ == rhs.p->debugEnabled_ &&
            lhs.p->defaultAlertAction_ == rhs.p->defaultAlertAction_ &&
            lhs.p->defaultRadarSite_ == rhs.p->defaultRadarSite_ &&
            lhs.p->defaultTimeZone_ == rhs.p->defaultTimeZone_ &&
+           lhs.p->downloadBandwidthLimit_ == rhs.p->downloadBandwidthLimit_ &&
+           lhs.p->dynamicResolutionScale_ == rhs.p->dynamicResolutionScale_ &&
+           lhs.p->exactRadarGeometry_ == rhs.p->exactRadarGeometry_ &&
            lhs.p->fontSizes_ == rhs.p->fontSizes_ &&
+           lhs.p->gpuRadarGeometry_ == rhs.p->gpuRadarGeometry_ &&
+           lhs.p->gpuUploadBudget_ == rhs.p->gpuUploadBudget_ &&
            lhs.p->gridWidth_ == rhs.p->gridWidth_ &&
            lhs.p->gridHeight_ == rhs.p->gridHeight_ &&
            lhs.p->loopDelay_ == rhs.p->loopDelay_ &&
+           lhs.p->loopFrameSkip_ == rhs.p->loopFrameSkip_ &&
            lhs.p->loopSpeed_ == rhs.p->loopSpeed_ &&
            lhs.p->loopTime_ == rhs.p->loopTime_ &&
+           lhs.p->mapCacheSize_ == rhs.p->mapCacheSize_ &&
+           lhs.p->mapPrefetchMaxZoom_ == rhs.p->mapPrefetchMaxZoom_ &&
+           lhs.p->mapPrefetchMinZoom_ == rhs.p->mapPrefetchMinZoom_ &&
+           lhs.p->mapPrefetchRadarSites_ == rhs.p->mapPrefetchRadarSites_ &&
+           lhs.p->mapPrefetchRadius_ == rhs.p->mapPrefetchRadius_ &&
            lhs.p->mapProvider_ == rhs.p->mapProvider_ &&
            lhs.p->mapboxApiKey_ == rhs.p->mapboxApiKey_ &&
            lhs.p->maptilerApiKey_ == rhs.p->maptilerApiKey_ &&
+           lhs.p->monitoredRadarSites_ == rhs.p->monitoredRadarSites_ &&
+           lhs.p->mosaicBlendMode_ == rhs.p->mosaicBlendMode_ &&
+           lhs.p->mosaicProduct_ == rhs.p->mosaicProduct_ &&
+           lhs.p->mosaicRadarSites_ == rhs.p->mosaicRadarSites_ &&
+           lhs.p->nexradLevel2Mirrors_ == rhs.p->nexradLevel2Mirrors_ &&
+           lhs.p->nexradLevel3Mirrors_ == rhs.p->nexradLevel3Mirrors_ &&
+           lhs.p->nexradLocalDirectory_ == rhs.p->nexradLocalDirectory_ &&
+           lhs.p->nexradObjectCacheSize_ == rhs.p->nexradObjectCacheSize_ &&
            lhs.p->nmeaBaudRate_ == rhs.p->nmeaBaudRate_ &&
            lhs.p->nmeaSource_ == rhs.p->nmeaSource_ &&
+           lhs.p->placefileIconClustering_ ==
+              rhs.p->placefileIconClustering_ &&
            lhs.p->positioningPlugin_ == rhs.p->positioningPlugin_ &&
+           lhs.p->predictiveRadarPrefetch_ == rhs.p->predictiveRadarPrefetch_ &&
+           lhs.p->radarCompressedCacheSize_ ==
+              rhs.p->radarCompressedCacheSize_ &&
+           lhs.p->radarDownloadThreads_ == rhs.p->radarDownloadThreads_ &&
+           lhs.p->radarElevationCacheSize_ ==
+              rhs.p->radarElevationCacheSize_ &&
+           lhs.p->radarLatestCut_ == rhs.p->radarLatestCut_ &&
+           lhs.p->radarMemoryLimit_ == rhs.p->radarMemoryLimit_ &&
+           lhs.p->radarProductCacheSize_ == rhs.p->radarProductCacheSize_ &&
+           lhs.p->radarRangedDownload_ == rhs.p->radarRangedDownload_ &&
+           lhs.p->radarSweepTexture_ == rhs.p->radarSweepTexture_ &&
            lhs.p->showMapAttribution_ == rhs.p->showMapAttribution_ &&
            lhs.p->showMapCenter_ == rhs.p->showMapCenter_ &&
            lhs.p->showMapLogo_ == rhs.p->showMapLogo_ &&
+           lhs.p->stormMotionDirection_ == rhs.p->stormMotionDirection_ &&
+           lhs.p->stormMotionSpeed_ == rhs.p->stormMotionSpeed_ &&
+           lhs.p->textureCompression_ == rhs.p->textureCompression_ &&
            lhs.p->theme_ == rhs.p->theme_ &&
            lhs.p->themeFile_ == rhs.p->themeFile_ &&
            lhs.p->trackLocation_ == rhs.p->trackLocation_ &&
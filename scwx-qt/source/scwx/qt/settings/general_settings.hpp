@@ -27,27 +27,60 @@ public:
 
    SettingsVariable<bool>&        anti_aliasing_enabled() const;
    SettingsVariable<std::string>& clock_format() const;
+   SettingsVariable<bool>&        cpu_primitive_filtering() const;
    SettingsVariable<std::string>& custom_style_draw_layer() const;
    SettingsVariable<std::string>& custom_style_url() const;
    SettingsVariable<bool>&        debug_enabled() const;
    SettingsVariable<std::string>& default_alert_action() const;
    SettingsVariable<std::string>& default_radar_site() const;
    SettingsVariable<std::string>& default_time_zone() const;
+   SettingsVariable<std::int64_t>& download_bandwidth_limit() const;
+   SettingsVariable<std::int64_t>& dynamic_resolution_scale() const;
+   SettingsVariable<bool>&         exact_radar_geometry() const;
    SettingsContainer<std::vector<std::int64_t>>& font_sizes() const;
+   SettingsVariable<bool>&                       gpu_radar_geometry() const;
+   SettingsVariable<std::int64_t>&               gpu_upload_budget() const;
    SettingsVariable<std::int64_t>&               grid_height() const;
    SettingsVariable<std::int64_t>&               grid_width() const;
    SettingsVariable<std::int64_t>&               loop_delay() const;
+   SettingsVariable<bool>&                       loop_frame_skip() const;
    SettingsVariable<double>&                     loop_speed() const;
    SettingsVariable<std::int64_t>&               loop_time() const;
+   SettingsVariable<std::int64_t>&               map_cache_size() const;
+   SettingsVariable<std::int64_t>&               map_prefetch_max_zoom() const;
+   SettingsVariable<std::int64_t>&               map_prefetch_min_zoom() const;
+   SettingsVariable<std::string>& map_prefetch_radar_sites() const;
+   SettingsVariable<std::int64_t>&               map_prefetch_radius() const;
    SettingsVariable<std::string>&                map_provider() const;
    SettingsVariable<std::string>&                mapbox_api_key() const;
    SettingsVariable<std::string>&                maptiler_api_key() const;
+   SettingsVariable<std::string>&                monitored_radar_sites() const;
+   SettingsVariable<std::string>&                mosaic_blend_mode() const;
+   SettingsVariable<std::string>&                mosaic_product() const;
+   SettingsVariable<std::string>&                mosaic_radar_sites() const;
+   SettingsVariable<std::string>&                nexrad_level2_mirrors() const;
+   SettingsVariable<std::string>&                nexrad_level3_mirrors() const;
+   SettingsVariable<std::string>&                nexrad_local_directory() const;
+   SettingsVariable<std::int64_t>& nexrad_object_cache_size() const;
    SettingsVariable<std::int64_t>&               nmea_baud_rate() const;
    SettingsVariable<std::string>&                nmea_source() const;
+   SettingsVariable<bool>& placefile_icon_clustering() const;
    SettingsVariable<std::string>&                positioning_plugin() const;
+   SettingsVariable<bool>& predictive_radar_prefetch() const;
+   SettingsVariable<std::int64_t>& radar_compressed_cache_size() const;
+   SettingsVariable<std::int64_t>& radar_download_threads() const;
+   SettingsVariable<std::int64_t>& radar_elevation_cache_size() const;
+   SettingsVariable<bool>&         radar_latest_cut() const;
+   SettingsVariable<std::int64_t>& radar_memory_limit() const;
+   SettingsVariable<std::int64_t>& radar_product_cache_size() const;
+   SettingsVariable<bool>&                       radar_ranged_download() const;
+   SettingsVariable<bool>&                       radar_sweep_texture() const;
    SettingsVariable<bool>&                       show_map_attribution() const;
    SettingsVariable<bool>&                       show_map_center() const;
    SettingsVariable<bool>&                       show_map_logo() const;
+   SettingsVariable<std::int64_t>& storm_motion_direction() const;
+   SettingsVariable<std::int64_t>& storm_motion_speed() const;
+   SettingsVariable<bool>&         texture_compression() const;
    SettingsVariable<std::string>&                theme() const;
    SettingsVariable<std::string>&                theme_file() const;
    SettingsVariable<bool>&                       track_location() const;
@@ -49,6 +49,17 @@ public:
    }
    ~Impl() {}
 
+   // Color parsed from a settings variable, until its version changes
+   struct ColorCache
+   {
+      std::uint64_t               version_ {0u};
+      boost::gil::rgba32f_pixel_t color_ {};
+   };
+
+   static boost::gil::rgba32f_pixel_t
+   GetColorRgba32f(const SettingsVariable<std::string>& variable,
+                   ColorCache&                          cache);
+
    SettingsVariable<std::string> lineColor_ {"line_color"};
    SettingsVariable<std::string> highlightColor_ {"highlight_color"};
    SettingsVariable<std::string> borderColor_ {"border_color"};
@@ -56,8 +67,25 @@ public:
    SettingsVariable<std::int64_t> lineWidth_ {"line_width"};
    SettingsVariable<std::int64_t> highlightWidth_ {"highlight_width"};
    SettingsVariable<std::int64_t> borderWidth_ {"border_width"};
+
+   ColorCache lineColorCache_ {};
+   ColorCache highlightColorCache_ {};
+   ColorCache borderColorCache_ {};
 };
 
+boost::gil::rgba32f_pixel_t
+LineSettings::Impl::GetColorRgba32f(
+   const SettingsVariable<std::string>& variable, ColorCache& cache)
+{
+   const std::uint64_t version = variable.version();
+   if (version != cache.version_)
+   {
+      cache.color_   = util::color::ToRgba32fPixelT(variable.GetValue());
+      cache.version_ = version;
+   }
+   return cache.color_;
+}
+
 LineSettings::LineSettings(const std::string& name) :
     SettingsCategory(name), p(std::make_unique<Impl>())
 {
@@ -106,17 +134,17 @@ SettingsVariable<std::int64_t>& LineSettings::line_width() const
 
 boost::gil::rgba32f_pixel_t LineSettings::GetBorderColorRgba32f() const
 {
-   return util::color::ToRgba32fPixelT(p->borderColor_.GetValue());
+   return Impl::GetColorRgba32f(p->borderColor_, p->borderColorCache_);
 }
 
 boost::gil::rgba32f_pixel_t LineSettings::GetHighlightColorRgba32f() const
 {
-   return util::color::ToRgba32fPixelT(p->highlightColor_.GetValue());
+   return Impl::GetColorRgba32f(p->highlightColor_, p->highlightColorCache_);
 }
 
 boost::gil::rgba32f_pixel_t LineSettings::GetLineColorRgba32f() const
 {
-   return util::color::ToRgba32fPixelT(p->lineColor_.GetValue());
+   return Impl::GetColorRgba32f(p->lineColor_, p->lineColorCache_);
 }
 
 void LineSettings::StageValues(boost::gil::rgba8_pixel_t borderColor,
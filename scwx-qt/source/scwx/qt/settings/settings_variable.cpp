@@ -1,6 +1,8 @@
 #include <scwx/qt/settings/settings_variable.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <atomic>
+
 #include <boost/json.hpp>
 #include <boost/unordered/unordered_flat_map.hpp>
 #include <boost/uuid/random_generator.hpp>
@@ -21,9 +23,30 @@ template<class T>
 class SettingsVariable<T>::Impl
 {
 public:
-   explicit Impl() {}
+   explicit Impl() { Publish(); }
    ~Impl() {}
 
+   // Values which fit a lock-free atomic are published directly, other values
+   // are published as an immutable copy which is swapped on each change
+   static constexpr bool kAtomicValue_ = []
+   {
+      if constexpr (std::is_trivially_copyable_v<T>)
+      {
+         return std::atomic<T>::is_always_lock_free;
+      }
+      else
+      {
+         return false;
+      }
+   }();
+
+   using PublishedValue =
+      std::conditional_t<kAtomicValue_,
+                         std::atomic<T>,
+                         std::atomic<std::shared_ptr<const T>>>;
+
+   void Publish();
+
    T                             value_ {};
    T                             default_ {};
    std::optional<T>              staged_ {};
@@ -36,8 +59,27 @@ public:
       valueChangedCallbackFunctions_ {};
    boost::unordered_flat_map<boost::uuids::uuid, ValueCallbackFunction>
       valueStagedCallbackFunctions_ {};
+
+   PublishedValue             published_ {};
+   std::atomic<std::uint64_t> version_ {0u};
 };
 
+template<class T>
+void SettingsVariable<T>::Impl::Publish()
+{
+   if constexpr (kAtomicValue_)
+   {
+      published_.store(value_, std::memory_order_release);
+   }
+   else
+   {
+      published_.store(std::make_shared<const T>(value_),
+                       std::memory_order_release);
+   }
+
+   version_.fetch_add(1u, std::memory_order_release);
+}
+
 template<class T>
 SettingsVariable<T>::SettingsVariable(const std::string& name) :
     SettingsVariableBase(name), p(std::make_unique<Impl>())
@@ -81,7 +123,34 @@ bool SettingsVariable<T>::IsDefaultStaged() const
 template<class T>
 T SettingsVariable<T>::GetValue() const
 {
-   return p->value_;
+   if constexpr (Impl::kAtomicValue_)
+   {
+      return p->published_.load(std::memory_order_acquire);
+   }
+   else
+   {
+      return p->value_;
+   }
+}
+
+template<class T>
+std::shared_ptr<const T> SettingsVariable<T>::GetSnapshot() const
+{
+   if constexpr (Impl::kAtomicValue_)
+   {
+      return std::make_shared<const T>(
+         p->published_.load(std::memory_order_acquire));
+   }
+   else
+   {
+      return p->published_.load(std::memory_order_acquire);
+   }
+}
+
+template<class T>
+std::uint64_t SettingsVariable<T>::version() const
+{
+   return p->version_.load(std::memory_order_acquire);
 }
 
 template<class T>
@@ -93,6 +162,7 @@ bool SettingsVariable<T>::SetValue(const T& value)
    {
       p->value_ = (p->transform_ != nullptr) ? p->transform_(value) : value;
       validated = true;
+      p->Publish();
 
       changed_signal()();
       for (auto& callback : p->valueChangedCallbackFunctions_)
@@ -145,6 +215,8 @@ bool SettingsVariable<T>::SetValueOrDefault(const T& value)
       p->value_ = p->default_;
    }
 
+   p->Publish();
+
    changed_signal()();
    for (auto& callback : p->valueChangedCallbackFunctions_)
    {
@@ -164,6 +236,7 @@ template<class T>
 void SettingsVariable<T>::SetValueToDefault()
 {
    p->value_ = p->default_;
+   p->Publish();
 
    changed_signal()();
    for (auto& callback : p->valueChangedCallbackFunctions_)
@@ -237,6 +310,7 @@ bool SettingsVariable<T>::Commit()
       p->value_ = std::move(*p->staged_);
       p->staged_.reset();
       committed = true;
+      p->Publish();
 
       changed_signal()();
       for (auto& callback : p->valueChangedCallbackFunctions_)
@@ -364,6 +438,8 @@ bool SettingsVariable<T>::ReadValue(const boost::json::object& json)
       p->value_ = p->default_;
    }
 
+   p->Publish();
+
    changed_signal()();
    for (auto& callback : p->valueChangedCallbackFunctions_)
    {
@@ -2,7 +2,9 @@
 
 #include <scwx/qt/settings/settings_variable_base.hpp>
 
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <optional>
 
 #include <boost/uuid/uuid.hpp>
@@ -56,12 +58,32 @@ public:
    bool IsDefaultStaged() const override;
 
    /**
-    * Gets the current value of the settings variable.
+    * Gets the current value of the settings variable. Values which fit a
+    * lock-free atomic may be read from any thread. Other values are read
+    * directly, and should be read from another thread using GetSnapshot().
     *
     * @return Current value
     */
    T GetValue() const;
 
+   /**
+    * Gets an immutable snapshot of the current value of the settings variable.
+    * The snapshot is not modified when the value changes, and may be held
+    * without copying large values.
+    *
+    * @return Current value snapshot
+    */
+   std::shared_ptr<const T> GetSnapshot() const;
+
+   /**
+    * Gets the change version of the settings variable, which is incremented
+    * each time the current value is set. A reader may cache a value derived
+    * from the settings variable until the version changes.
+    *
+    * @return Change version
+    */
+   std::uint64_t version() const;
+
    /**
     * Sets the current value of the settings variable.
     *
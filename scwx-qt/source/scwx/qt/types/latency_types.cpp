@@ -0,0 +1,62 @@
+#include <scwx/qt/types/latency_types.hpp>
+
+#include <unordered_map>
+
+namespace scwx
+{
+namespace qt
+{
+namespace types
+{
+
+static const std::unordered_map<LatencyStage, std::string> latencyStageName_ {
+   {LatencyStage::Listed, "Listed"},
+   {LatencyStage::Downloaded, "Downloaded"},
+   {LatencyStage::Decoded, "Decoded"},
+   {LatencyStage::Computed, "Computed"},
+   {LatencyStage::Painted, "Painted"},
+   {LatencyStage::Unknown, "?"}};
+
+const std::string& GetLatencyStageName(LatencyStage stage)
+{
+   return latencyStageName_.at(stage);
+}
+
+std::chrono::system_clock::time_point
+ProductLatency::stage_time(LatencyStage stage) const
+{
+   if (stage == LatencyStage::Unknown)
+   {
+      return {};
+   }
+
+   return stageTimes_[static_cast<std::size_t>(stage)];
+}
+
+std::optional<std::chrono::milliseconds>
+ProductLatency::latency(LatencyStage stage) const
+{
+   const std::chrono::system_clock::time_point stageTime = stage_time(stage);
+
+   if (productTime_ == std::chrono::system_clock::time_point {} ||
+       stageTime == std::chrono::system_clock::time_point {})
+   {
+      return std::nullopt;
+   }
+
+   return std::chrono::duration_cast<std::chrono::milliseconds>(stageTime -
+                                                                productTime_);
+}
+
+void ProductLatency::set_stage_time(LatencyStage                          stage,
+                                    std::chrono::system_clock::time_point time)
+{
+   if (stage != LatencyStage::Unknown)
+   {
+      stageTimes_[static_cast<std::size_t>(stage)] = time;
+   }
+}
+
+} // namespace types
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <scwx/util/iterator.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace scwx
+{
+namespace qt
+{
+namespace types
+{
+
+enum class LatencyStage
+{
+   Listed,
+   Downloaded,
+   Decoded,
+   Computed,
+   Painted,
+   Unknown
+};
+typedef scwx::util::
+   Iterator<LatencyStage, LatencyStage::Listed, LatencyStage::Painted>
+      LatencyStageIterator;
+
+const std::string& GetLatencyStageName(LatencyStage stage);
+
+/**
+ * @brief Times at which a radar product passed through each stage, from being
+ * found in a product listing to being painted. Stages which were skipped, such
+ * as downloading a product loaded from disk, are not set.
+ */
+struct ProductLatency
+{
+   std::chrono::system_clock::time_point productTime_ {};
+   std::array<std::chrono::system_clock::time_point,
+              static_cast<std::size_t>(LatencyStage::Unknown)>
+      stageTimes_ {};
+
+   std::chrono::system_clock::time_point stage_time(LatencyStage stage) const;
+
+   /**
+    * @brief Time from the scan or issuance of the product to a stage.
+    *
+    * @param [in] stage Latency stage
+    *
+    * @return Latency, or std::nullopt if the stage or product time is not set
+    */
+   std::optional<std::chrono::milliseconds> latency(LatencyStage stage) const;
+
+   void set_stage_time(LatencyStage                          stage,
+                       std::chrono::system_clock::time_point time);
+};
+
+} // namespace types
+} // namespace qt
+} // namespace scwx
@@ -33,10 +33,11 @@ enum class DataLayer
 {
    OverlayProduct,
    RadarRange,
+   RadarMosaic,
    Unknown
 };
 typedef scwx::util::
-   Iterator<DataLayer, DataLayer::OverlayProduct, DataLayer::RadarRange>
+   Iterator<DataLayer, DataLayer::OverlayProduct, DataLayer::RadarMosaic>
       DataLayerIterator;
 
 enum class InformationLayer
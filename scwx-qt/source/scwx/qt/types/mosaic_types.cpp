@@ -0,0 +1,41 @@
+#include <scwx/qt/types/mosaic_types.hpp>
+#include <scwx/util/enum.hpp>
+
+#include <unordered_map>
+
+#include <boost/algorithm/string.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace types
+{
+
+static const std::unordered_map<MosaicBlendMode, std::string>
+   mosaicBlendModeName_ {{MosaicBlendMode::NearestRadar, "Nearest Radar"},
+                         {MosaicBlendMode::MaximumValue, "Maximum Value"},
+                         {MosaicBlendMode::Unknown, "?"}};
+
+static const std::unordered_map<MosaicProduct, std::string>
+   mosaicProductName_ {
+      {MosaicProduct::LowestTilt, "Lowest Tilt"},
+      {MosaicProduct::CompositeReflectivity, "Composite Reflectivity"},
+      {MosaicProduct::Unknown, "?"}};
+
+SCWX_GET_ENUM(MosaicBlendMode, GetMosaicBlendMode, mosaicBlendModeName_)
+SCWX_GET_ENUM(MosaicProduct, GetMosaicProduct, mosaicProductName_)
+
+const std::string& GetMosaicBlendModeName(MosaicBlendMode mosaicBlendMode)
+{
+   return mosaicBlendModeName_.at(mosaicBlendMode);
+}
+
+const std::string& GetMosaicProductName(MosaicProduct mosaicProduct)
+{
+   return mosaicProductName_.at(mosaicProduct);
+}
+
+} // namespace types
+} // namespace qt
+} // namespace scwx
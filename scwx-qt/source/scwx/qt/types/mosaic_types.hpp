@@ -0,0 +1,44 @@
+#pragma once
+
+#include <scwx/util/iterator.hpp>
+
+#include <string>
+
+namespace scwx
+{
+namespace qt
+{
+namespace types
+{
+
+enum class MosaicBlendMode
+{
+   NearestRadar,
+   MaximumValue,
+   Unknown
+};
+typedef scwx::util::Iterator<MosaicBlendMode,
+                             MosaicBlendMode::NearestRadar,
+                             MosaicBlendMode::MaximumValue>
+   MosaicBlendModeIterator;
+
+enum class MosaicProduct
+{
+   LowestTilt,
+   CompositeReflectivity,
+   Unknown
+};
+typedef scwx::util::Iterator<MosaicProduct,
+                             MosaicProduct::LowestTilt,
+                             MosaicProduct::CompositeReflectivity>
+   MosaicProductIterator;
+
+MosaicBlendMode    GetMosaicBlendMode(const std::string& name);
+const std::string& GetMosaicBlendModeName(MosaicBlendMode mosaicBlendMode);
+
+MosaicProduct      GetMosaicProduct(const std::string& name);
+const std::string& GetMosaicProductName(MosaicProduct mosaicProduct);
+
+} // namespace types
+} // namespace qt
+} // namespace scwx
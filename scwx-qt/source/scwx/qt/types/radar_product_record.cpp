@@ -29,6 +29,7 @@ public:
    ~RadarProductRecordImpl() {}
 
    std::shared_ptr<wsr88d::NexradFile>   nexradFile_;
+   ProductLatency                        latency_ {};
    int16_t                               productCode_;
    std::string                           radarId_;
    std::string                           radarProduct_;
@@ -55,6 +56,9 @@ RadarProductRecord::RadarProductRecord(
       p->productCode_       = 0;
       julianDate            = level2File->julian_date();
       milliseconds          = level2File->milliseconds();
+
+      // Volume scan start time
+      p->latency_.productTime_ = level2File->start_time();
    }
    else if (level3File != nullptr)
    {
@@ -77,6 +81,10 @@ RadarProductRecord::RadarProductRecord(
          milliseconds =
             level3File->message()->header().time_of_message() * 1000u;
       }
+
+      // Volume scan time, or the time the product was issued if the product
+      // has no description block
+      p->latency_.productTime_ = util::TimePoint(julianDate, milliseconds);
    }
 
    p->time_ = util::TimePoint(julianDate, milliseconds);
@@ -98,6 +106,16 @@ std::shared_ptr<wsr88d::Level3File> RadarProductRecord::level3_file() const
    return std::dynamic_pointer_cast<wsr88d::Level3File>(p->nexradFile_);
 }
 
+std::size_t RadarProductRecord::data_size() const
+{
+   return (p->nexradFile_ != nullptr) ? p->nexradFile_->data_size() : 0;
+}
+
+ProductLatency RadarProductRecord::latency() const
+{
+   return p->latency_;
+}
+
 std::shared_ptr<wsr88d::NexradFile> RadarProductRecord::nexrad_file() const
 {
    return p->nexradFile_;
@@ -133,6 +151,15 @@ std::chrono::system_clock::time_point RadarProductRecord::time() const
    return p->time_;
 }
 
+void RadarProductRecord::set_latency(const ProductLatency& latency)
+{
+   const std::chrono::system_clock::time_point productTime =
+      p->latency_.productTime_;
+
+   p->latency_              = latency;
+   p->latency_.productTime_ = productTime;
+}
+
 void RadarProductRecord::set_time(std::chrono::system_clock::time_point time)
 {
    p->time_ = time;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <scwx/qt/types/latency_types.hpp>
 #include <scwx/common/products.hpp>
 #include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/level3_file.hpp>
@@ -28,6 +29,8 @@ public:
    RadarProductRecord(RadarProductRecord&&) noexcept;
    RadarProductRecord& operator=(RadarProductRecord&&) noexcept;
 
+   std::size_t                           data_size() const;
+   ProductLatency                        latency() const;
    std::shared_ptr<wsr88d::Ar2vFile>     level2_file() const;
    std::shared_ptr<wsr88d::Level3File>   level3_file() const;
    std::shared_ptr<wsr88d::NexradFile>   nexrad_file() const;
@@ -38,6 +41,16 @@ public:
    std::string                           site_id() const;
    std::chrono::system_clock::time_point time() const;
 
+   /**
+    * @brief Sets the times at which the product was listed, downloaded and
+    * decoded. The product time is set from the scan or issuance time in the
+    * file, and is not modified.
+    *
+    * Must be set before the record is shared with other threads.
+    *
+    * @param [in] latency Product latency
+    */
+   void set_latency(const ProductLatency& latency);
    void set_time(std::chrono::system_clock::time_point time);
 
    static std::shared_ptr<RadarProductRecord>
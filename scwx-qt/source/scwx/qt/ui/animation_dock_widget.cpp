@@ -219,6 +219,13 @@ void AnimationDockWidgetImpl::ConnectSignals()
                     self_,
                     [this](types::Hotkey hotkey, bool /* isAutoRepeat */)
                     {
+                       if (!self_->isActiveWindow())
+                       {
+                          // Hotkeys apply to the window in which they are
+                          // pressed
+                          return;
+                       }
+
                        switch (hotkey)
                        {
                        case types::Hotkey::TimelineStepBegin:
@@ -286,6 +293,19 @@ void AnimationDockWidget::UpdateViewType(types::MapTime viewType)
    }
 }
 
+void AnimationDockWidget::SelectArchiveTime(
+   std::chrono::system_clock::time_point dateTime)
+{
+   const auto date = std::chrono::floor<std::chrono::days>(dateTime);
+   const auto time = std::chrono::floor<std::chrono::seconds>(dateTime - date);
+
+   ui->dateEdit->setDate(
+      QDate::fromJulianDay(QDate(1970, 1, 1).toJulianDay() +
+                           date.time_since_epoch().count()));
+   ui->timeEdit->setTime(QTime(0, 0).addSecs(static_cast<int>(time.count())));
+   ui->archiveViewRadioButton->setChecked(true);
+}
+
 void AnimationDockWidgetImpl::UpdateAutoUpdateLabel()
 {
    // Display "Auto Update: Enabled" if:
@@ -33,6 +33,14 @@ public slots:
    void UpdateLiveState(bool isLive);
    void UpdateViewType(types::MapTime viewType);
 
+   /**
+    * @brief Selects the archive view at a date and time, as if selected by
+    * the user.
+    *
+    * @param [in] dateTime Archive date and time
+    */
+   void SelectArchiveTime(std::chrono::system_clock::time_point dateTime);
+
 signals:
    void ViewTypeChanged(types::MapTime viewType);
    void DateTimeChanged(std::chrono::system_clock::time_point dateTime);
@@ -0,0 +1,304 @@
+#include <scwx/qt/ui/cross_section_dock_widget.hpp>
+#include <scwx/qt/view/cross_section_view.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+
+#include <QComboBox>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QPainter>
+#include <QVBoxLayout>
+
+namespace scwx
+{
+namespace qt
+{
+namespace ui
+{
+
+// Space for axis labels (pixels)
+static constexpr int kLeftMargin_   = 48;
+static constexpr int kBottomMargin_ = 20;
+static constexpr int kTopMargin_    = 8;
+static constexpr int kRightMargin_  = 8;
+
+static constexpr std::size_t kMaxTicks_ = 6u;
+
+static constexpr double kMetersPerKilometer_ = 1000.0;
+
+// Selectable heights of the top of the cross section (km)
+static constexpr std::array<int, 4> kMaxHeights_ {5, 10, 15, 20};
+static constexpr int                kDefaultMaxHeight_ {20};
+
+// Draws the cross section image with distance and height axes
+class CrossSectionImageWidget : public QWidget
+{
+public:
+   explicit CrossSectionImageWidget(QWidget* parent) : QWidget(parent)
+   {
+      setMinimumSize(kLeftMargin_ + kRightMargin_ + 100,
+                     kTopMargin_ + kBottomMargin_ + 60);
+   }
+
+   QRect plot_rect() const
+   {
+      return rect().adjusted(
+         kLeftMargin_, kTopMargin_, -kRightMargin_, -kBottomMargin_);
+   }
+
+   void SetImage(const QImage& image, double distance, double maxHeight)
+   {
+      image_     = image;
+      distance_  = distance;
+      maxHeight_ = maxHeight;
+      update();
+   }
+
+   std::function<void(const QSize&)> resizeCallback_ {};
+
+protected:
+   void paintEvent(QPaintEvent*) override;
+   void resizeEvent(QResizeEvent*) override
+   {
+      if (resizeCallback_ != nullptr)
+      {
+         resizeCallback_(plot_rect().size());
+      }
+   }
+
+private:
+   static double GetTickInterval(double range);
+
+   QImage image_ {};
+   double distance_ {};
+   double maxHeight_ {};
+};
+
+class CrossSectionDockWidget::Impl
+{
+public:
+   explicit Impl(CrossSectionDockWidget* self) :
+       self_ {self}, view_ {new view::CrossSectionView(self)}
+   {
+   }
+   ~Impl() = default;
+
+   void Update();
+
+   CrossSectionDockWidget*  self_;
+   view::CrossSectionView*  view_;
+   QComboBox*               productComboBox_ {nullptr};
+   QComboBox*               maxHeightComboBox_ {nullptr};
+   QLabel*                  hintLabel_ {nullptr};
+   CrossSectionImageWidget* imageWidget_ {nullptr};
+
+   bool lineSet_ {false};
+};
+
+CrossSectionDockWidget::CrossSectionDockWidget(QWidget* parent) :
+    QDockWidget(parent), p {std::make_unique<Impl>(this)}
+{
+   setObjectName("CrossSectionDockWidget");
+   setWindowTitle(tr("Cross Section"));
+
+   QWidget*     contents = new QWidget(this);
+   QVBoxLayout* layout   = new QVBoxLayout(contents);
+
+   p->productComboBox_ = new QComboBox(contents);
+   for (common::Level2Product product :
+        {common::Level2Product::Reflectivity,
+         common::Level2Product::Velocity,
+         common::Level2Product::SpectrumWidth,
+         common::Level2Product::DifferentialReflectivity,
+         common::Level2Product::DifferentialPhase,
+         common::Level2Product::CorrelationCoefficient,
+         common::Level2Product::ClutterFilterPowerRemoved})
+   {
+      p->productComboBox_->addItem(
+         QString::fromStdString(common::GetLevel2Description(product)),
+         static_cast<int>(product));
+   }
+
+   p->maxHeightComboBox_ = new QComboBox(contents);
+   for (int maxHeight : kMaxHeights_)
+   {
+      p->maxHeightComboBox_->addItem(QString("%1 km").arg(maxHeight),
+                                     maxHeight);
+   }
+   p->maxHeightComboBox_->setCurrentIndex(
+      p->maxHeightComboBox_->findData(kDefaultMaxHeight_));
+   p->view_->SetMaxHeight(kDefaultMaxHeight_ * kMetersPerKilometer_);
+
+   p->hintLabel_ = new QLabel(
+      tr("Hold Shift and drag on the map to draw a cross section."), contents);
+   p->hintLabel_->setWordWrap(true);
+
+   p->imageWidget_ = new CrossSectionImageWidget(contents);
+   p->imageWidget_->setVisible(false);
+
+   QHBoxLayout* selectionLayout = new QHBoxLayout();
+   selectionLayout->addWidget(p->productComboBox_, 1);
+   selectionLayout->addWidget(p->maxHeightComboBox_);
+
+   layout->addLayout(selectionLayout);
+   layout->addWidget(p->hintLabel_);
+   layout->addWidget(p->imageWidget_, 1);
+   setWidget(contents);
+
+   connect(p->productComboBox_,
+           &QComboBox::currentIndexChanged,
+           this,
+           [this]()
+           {
+              p->view_->SelectProduct(static_cast<common::Level2Product>(
+                 p->productComboBox_->currentData().toInt()));
+              p->Update();
+           });
+
+   connect(p->maxHeightComboBox_,
+           &QComboBox::currentIndexChanged,
+           this,
+           [this]()
+           {
+              p->view_->SetMaxHeight(
+                 p->maxHeightComboBox_->currentData().toInt() *
+                 kMetersPerKilometer_);
+              p->Update();
+           });
+
+   p->imageWidget_->resizeCallback_ = [this](const QSize& size)
+   {
+      p->view_->SetSize(static_cast<std::size_t>(std::max(size.width(), 0)),
+                        static_cast<std::size_t>(std::max(size.height(), 0)));
+      p->Update();
+   };
+
+   connect(p->view_,
+           &view::CrossSectionView::CrossSectionComputed,
+           this,
+           [this]()
+           {
+              p->imageWidget_->SetImage(p->view_->image(),
+                                        p->view_->distance(),
+                                        p->view_->max_height());
+           },
+           Qt::QueuedConnection);
+}
+
+CrossSectionDockWidget::~CrossSectionDockWidget() = default;
+
+void CrossSectionDockWidget::showEvent(QShowEvent* event)
+{
+   // Sample the cross section deferred while hidden
+   p->Update();
+
+   QDockWidget::showEvent(event);
+}
+
+void CrossSectionDockWidget::SelectVolume(
+   std::shared_ptr<wsr88d::Ar2vFile> volume,
+   const common::Coordinate&         radarSite)
+{
+   p->view_->SelectVolume(std::move(volume), radarSite);
+   p->Update();
+}
+
+void CrossSectionDockWidget::SetLine(const common::Coordinate& start,
+                                     const common::Coordinate& end)
+{
+   p->lineSet_ = true;
+   p->hintLabel_->setVisible(false);
+   p->imageWidget_->setVisible(true);
+
+   p->view_->SetLine(start, end);
+   p->Update();
+}
+
+void CrossSectionDockWidget::Impl::Update()
+{
+   // Cross sections are only sampled while visible
+   if (lineSet_ && self_->isVisible())
+   {
+      view_->Update();
+   }
+}
+
+double CrossSectionImageWidget::GetTickInterval(double range)
+{
+   static constexpr std::array<double, 9> kIntervals_ {
+      1.0, 2.0, 5.0, 10.0, 20.0, 50.0, 100.0, 200.0, 500.0};
+
+   // Select the smallest interval which does not exceed the maximum ticks
+   for (double interval : kIntervals_)
+   {
+      if (range / interval <= static_cast<double>(kMaxTicks_))
+      {
+         return interval;
+      }
+   }
+
+   return kIntervals_.back();
+}
+
+void CrossSectionImageWidget::paintEvent(QPaintEvent*)
+{
+   QPainter     painter(this);
+   const QRect  plotRect = plot_rect();
+   const QColor axisColor =
+      palette().color(QPalette::ColorRole::WindowText);
+
+   painter.fillRect(plotRect, Qt::GlobalColor::black);
+
+   if (image_.isNull() || distance_ <= 0.0 || maxHeight_ <= 0.0)
+   {
+      return;
+   }
+
+   painter.drawImage(plotRect, image_);
+
+   painter.setPen(axisColor);
+   painter.drawRect(plotRect);
+
+   const QFontMetrics metrics = painter.fontMetrics();
+
+   // Height axis (km)
+   const double maxHeight      = maxHeight_ / kMetersPerKilometer_;
+   const double heightInterval = GetTickInterval(maxHeight);
+   for (double height = 0.0; height <= maxHeight; height += heightInterval)
+   {
+      const int y =
+         plotRect.bottom() -
+         static_cast<int>(std::lround(height / maxHeight * plotRect.height()));
+      const QString label = QString("%1 km").arg(height);
+
+      painter.drawLine(plotRect.left() - 4, y, plotRect.left(), y);
+      painter.drawText(
+         QRect(0, y - metrics.height() / 2, kLeftMargin_ - 6, metrics.height()),
+         Qt::AlignmentFlag::AlignRight | Qt::AlignmentFlag::AlignVCenter,
+         label);
+   }
+
+   // Distance axis (km)
+   const double distance         = distance_ / kMetersPerKilometer_;
+   const double distanceInterval = GetTickInterval(distance);
+   for (double d = 0.0; d <= distance; d += distanceInterval)
+   {
+      const int x =
+         plotRect.left() +
+         static_cast<int>(std::lround(d / distance * plotRect.width()));
+      const QString label = QString("%1").arg(d);
+
+      painter.drawLine(x, plotRect.bottom(), x, plotRect.bottom() + 4);
+      painter.drawText(QRect(x - 30, plotRect.bottom() + 4, 60, kBottomMargin_),
+                       Qt::AlignmentFlag::AlignHCenter |
+                          Qt::AlignmentFlag::AlignTop,
+                       label);
+   }
+}
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+
+#include <memory>
+
+#include <QDockWidget>
+
+namespace scwx
+{
+namespace qt
+{
+namespace ui
+{
+
+/**
+ * @brief Displays a vertical cross section of the selected level 2 volume,
+ * along a line drawn on the map.
+ */
+class CrossSectionDockWidget : public QDockWidget
+{
+   Q_OBJECT
+   Q_DISABLE_COPY_MOVE(CrossSectionDockWidget)
+
+public:
+   explicit CrossSectionDockWidget(QWidget* parent = nullptr);
+   ~CrossSectionDockWidget();
+
+   /**
+    * @brief Selects the volume from which the cross section is sampled.
+    *
+    * @param [in] volume Level 2 volume, or nullptr if none is loaded
+    * @param [in] radarSite Radar site location
+    */
+   void SelectVolume(std::shared_ptr<wsr88d::Ar2vFile> volume,
+                     const common::Coordinate&         radarSite);
+
+   /**
+    * @brief Sets the line along which the cross section is sampled.
+    *
+    * @param [in] start Start of the line
+    * @param [in] end End of the line
+    */
+   void SetLine(const common::Coordinate& start, const common::Coordinate& end);
+
+protected:
+   void showEvent(QShowEvent* event) override;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
@@ -38,7 +38,7 @@ HotkeyEdit::HotkeyEdit(QWidget* parent) :
               this,
               [this](bool /* checked */)
               {
-                 logger_->trace("clearAction");
+                 SPDLOG_LOGGER_TRACE(logger_, "clearAction");
 
                  if (!p->sequence_.isEmpty())
                  {
@@ -70,7 +70,7 @@ void HotkeyEdit::set_key_sequence(const QKeySequence& sequence)
 
 void HotkeyEdit::focusInEvent(QFocusEvent* e)
 {
-   logger_->trace("focusInEvent");
+   SPDLOG_LOGGER_TRACE(logger_, "focusInEvent");
 
    // Replace text with placeholder prompting for input
    setPlaceholderText("Press any key");
@@ -81,7 +81,7 @@ void HotkeyEdit::focusInEvent(QFocusEvent* e)
 
 void HotkeyEdit::focusOutEvent(QFocusEvent* e)
 {
-   logger_->trace("focusOutEvent");
+   SPDLOG_LOGGER_TRACE(logger_, "focusOutEvent");
 
    // Replace text with saved sequence
    setPlaceholderText({});
@@ -92,7 +92,7 @@ void HotkeyEdit::focusOutEvent(QFocusEvent* e)
 
 void HotkeyEdit::keyPressEvent(QKeyEvent* e)
 {
-   logger_->trace("keyPressEvent");
+   SPDLOG_LOGGER_TRACE(logger_, "keyPressEvent");
 
    QKeySequence sequence {};
 
@@ -126,7 +126,7 @@ void HotkeyEdit::keyPressEvent(QKeyEvent* e)
 
 void HotkeyEdit::keyReleaseEvent(QKeyEvent*)
 {
-   logger_->trace("keyReleaseEvent");
+   SPDLOG_LOGGER_TRACE(logger_, "keyReleaseEvent");
 
    // Modifiers were released prior to pressing a non-modifier key
    setText({});
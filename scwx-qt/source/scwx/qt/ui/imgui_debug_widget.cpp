@@ -2,13 +2,23 @@
 #include <scwx/qt/gl/gl.hpp>
 #include <scwx/qt/manager/font_manager.hpp>
 #include <scwx/qt/model/imgui_context_model.hpp>
-
+#include <scwx/util/memory.hpp>
+#include <scwx/util/profiler.hpp>
+
+#include <algorithm>
+#include <cfloat>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <numeric>
 #include <set>
 
 #include <imgui.h>
 #include <backends/imgui_impl_opengl3.h>
 #include <backends/imgui_impl_qt.hpp>
+#include <fmt/chrono.h>
 #include <fmt/format.h>
+#include <QStandardPaths>
 
 namespace scwx
 {
@@ -19,6 +29,10 @@ namespace ui
 
 static const std::string logPrefix_ = "scwx::qt::ui::imgui_debug_widget";
 
+static constexpr std::chrono::seconds kProfileWindow_ {10};
+static constexpr std::size_t          kProfileFrameCount_ {240u};
+static constexpr std::size_t          kProfileHistogramBins_ {32u};
+
 class ImGuiDebugWidgetImpl
 {
 public:
@@ -53,6 +67,9 @@ public:
    }
 
    void ImGuiCheckFonts();
+   void RenderMemory();
+   void RenderProfiler();
+   void SaveTrace();
 
    ImGuiDebugWidget* self_;
    ImGuiContext*     context_;
@@ -65,6 +82,8 @@ public:
    std::set<ImGuiContext*> renderedSet_ {};
    bool                    imGuiRendererInitialized_ {false};
    std::uint64_t           imGuiFontsBuildCount_ {};
+
+   std::string traceStatus_ {};
 };
 
 ImGuiDebugWidget::ImGuiDebugWidget(QWidget* parent) :
@@ -147,6 +166,8 @@ void ImGuiDebugWidget::paintGL()
    }
 
    ImGui::ShowDemoWindow();
+   p->RenderProfiler();
+   p->RenderMemory();
 
    ImGui::Render();
    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
@@ -155,6 +176,36 @@ void ImGuiDebugWidget::paintGL()
    imguiFontAtlasLock.unlock();
 }
 
+void ImGuiDebugWidgetImpl::SaveTrace()
+{
+   const std::filesystem::path tracePath =
+      std::filesystem::path {
+         QStandardPaths::writableLocation(QStandardPaths::AppDataLocation)
+            .toStdString()} /
+      "traces";
+
+   std::error_code error;
+   std::filesystem::create_directories(tracePath, error);
+
+   const std::filesystem::path traceFile =
+      tracePath /
+      fmt::format("trace-{:%Y%m%d-%H%M%S}.json",
+                  std::chrono::floor<std::chrono::seconds>(
+                     std::chrono::system_clock::now()));
+
+   std::ofstream trace {traceFile, std::ios_base::trunc};
+   if (trace.is_open())
+   {
+      scwx::util::Profiler::WriteTrace(trace);
+      traceStatus_ = fmt::format("Trace saved: {}", traceFile.string());
+   }
+   else
+   {
+      traceStatus_ =
+         fmt::format("Could not save trace: {}", traceFile.string());
+   }
+}
+
 void ImGuiDebugWidgetImpl::ImGuiCheckFonts()
 {
    // Update ImGui Fonts if required
@@ -175,6 +226,227 @@ void ImGuiDebugWidgetImpl::ImGuiCheckFonts()
    }
 }
 
+void ImGuiDebugWidgetImpl::RenderProfiler()
+{
+   using Milliseconds = std::chrono::duration<float, std::milli>;
+
+   ImGui::Begin("Profiler");
+
+   bool enabled = scwx::util::Profiler::IsEnabled();
+   if (ImGui::Checkbox("Enable profiling", &enabled))
+   {
+      scwx::util::Profiler::SetEnabled(enabled);
+   }
+
+   if (!enabled)
+   {
+      ImGui::End();
+      return;
+   }
+
+   ImGui::SameLine();
+   if (ImGui::Button("Save Trace"))
+   {
+      SaveTrace();
+   }
+   if (!traceStatus_.empty())
+   {
+      ImGui::TextUnformatted(traceStatus_.c_str());
+   }
+
+   // Repaint continuously while profiling, to keep the graphs current
+   self_->update();
+
+   auto samples = scwx::util::Profiler::GetSamples(
+      std::chrono::steady_clock::now() - kProfileWindow_);
+
+   // Group sample durations by stage and label
+   std::vector<float> frameTimes {};
+   std::map<std::pair<scwx::util::ProfileStage, std::uint16_t>,
+            std::vector<float>>
+      stageTimes {};
+   std::map<std::pair<scwx::util::ProfileStage, std::uint16_t>,
+            scwx::util::AllocationCount>
+      stageAllocations {};
+
+   for (auto& sample : samples)
+   {
+      const float duration = Milliseconds(sample.duration_).count();
+
+      if (sample.stage_ == scwx::util::ProfileStage::Frame)
+      {
+         frameTimes.push_back(duration);
+      }
+      stageTimes[{sample.stage_, sample.label_}].push_back(duration);
+
+      auto& allocations = stageAllocations[{sample.stage_, sample.label_}];
+      allocations.allocations_ += sample.allocations_.allocations_;
+      allocations.bytes_ += sample.allocations_.bytes_;
+   }
+
+   if (frameTimes.size() > kProfileFrameCount_)
+   {
+      frameTimes.erase(frameTimes.begin(),
+                       frameTimes.end() - kProfileFrameCount_);
+   }
+
+   const float frameMax =
+      frameTimes.empty() ?
+         0.0f :
+         *std::max_element(frameTimes.cbegin(), frameTimes.cend());
+   const std::string frameOverlay =
+      frameTimes.empty() ? std::string {} :
+                           fmt::format("{:.2f} ms", frameTimes.back());
+
+   ImGui::PlotLines("Frame Time",
+                    frameTimes.data(),
+                    static_cast<int>(frameTimes.size()),
+                    0,
+                    frameOverlay.c_str(),
+                    0.0f,
+                    std::max(frameMax, 16.7f),
+                    ImVec2 {0.0f, 80.0f});
+
+   // Allocation columns are only shown when allocations are being counted
+   const bool showAllocations = scwx::util::AllocationTracker::IsAvailable();
+
+   if (ImGui::BeginTable(
+          "Stages", showAllocations ? 8 : 6, ImGuiTableFlags_Borders))
+   {
+      ImGui::TableSetupColumn("Stage");
+      ImGui::TableSetupColumn("Count");
+      ImGui::TableSetupColumn("Mean (ms)");
+      ImGui::TableSetupColumn("P95 (ms)");
+      ImGui::TableSetupColumn("Max (ms)");
+      if (showAllocations)
+      {
+         ImGui::TableSetupColumn("Allocs");
+         ImGui::TableSetupColumn("Alloc (KiB)");
+      }
+      ImGui::TableSetupColumn("Distribution");
+      ImGui::TableHeadersRow();
+
+      for (auto& [key, durations] : stageTimes)
+      {
+         auto& [stage, label] = key;
+
+         std::sort(durations.begin(), durations.end());
+
+         const float mean =
+            std::accumulate(durations.cbegin(), durations.cend(), 0.0f) /
+            static_cast<float>(durations.size());
+         const float p95 = durations[(durations.size() - 1) * 95 / 100];
+         const float max = durations.back();
+
+         // Bin the durations between zero and the maximum
+         std::vector<float> histogram(kProfileHistogramBins_, 0.0f);
+         for (float duration : durations)
+         {
+            const std::size_t bin =
+               (max > 0.0f) ?
+                  std::min(static_cast<std::size_t>(duration / max *
+                                                    kProfileHistogramBins_),
+                           kProfileHistogramBins_ - 1) :
+                  0u;
+            ++histogram[bin];
+         }
+
+         std::string name = scwx::util::GetProfileStageName(stage);
+         if (label != 0u)
+         {
+            name = fmt::format("{}: {}",
+                               name,
+                               scwx::util::Profiler::GetLabel(label));
+         }
+
+         ImGui::TableNextRow();
+         ImGui::TableNextColumn();
+         ImGui::TextUnformatted(name.c_str());
+         ImGui::TableNextColumn();
+         ImGui::Text("%zu", durations.size());
+         ImGui::TableNextColumn();
+         ImGui::Text("%.3f", mean);
+         ImGui::TableNextColumn();
+         ImGui::Text("%.3f", p95);
+         ImGui::TableNextColumn();
+         ImGui::Text("%.3f", max);
+         if (showAllocations)
+         {
+            // Mean allocations per sample
+            const scwx::util::AllocationCount& allocations =
+               stageAllocations[key];
+            const double count = static_cast<double>(durations.size());
+
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f",
+                        static_cast<double>(allocations.allocations_) / count);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f",
+                        static_cast<double>(allocations.bytes_) / count /
+                           1024.0);
+         }
+         ImGui::TableNextColumn();
+         ImGui::PushID(name.c_str());
+         ImGui::PlotHistogram("",
+                              histogram.data(),
+                              static_cast<int>(histogram.size()),
+                              0,
+                              nullptr,
+                              0.0f,
+                              FLT_MAX,
+                              ImVec2 {120.0f, 20.0f});
+         ImGui::PopID();
+      }
+
+      ImGui::EndTable();
+   }
+
+   ImGui::End();
+}
+
+void ImGuiDebugWidgetImpl::RenderMemory()
+{
+   static constexpr double kMebibyte = 1024.0 * 1024.0;
+
+   ImGui::Begin("Memory");
+
+   const std::vector<scwx::util::MemoryUsage> usage =
+      scwx::util::GetMemoryUsage();
+   const std::size_t total = std::accumulate(
+      usage.cbegin(),
+      usage.cend(),
+      std::size_t {0u},
+      [](std::size_t sum, auto& category) { return sum + category.bytes_; });
+
+   ImGui::Text("Resident: %.1f MiB",
+               static_cast<double>(scwx::util::GetResidentMemory()) /
+                  kMebibyte);
+   ImGui::Text("Accounted: %.1f MiB", static_cast<double>(total) / kMebibyte);
+
+   if (ImGui::BeginTable("Categories", 3, ImGuiTableFlags_Borders))
+   {
+      ImGui::TableSetupColumn("Category");
+      ImGui::TableSetupColumn("Size (MiB)");
+      ImGui::TableSetupColumn("Owners");
+      ImGui::TableHeadersRow();
+
+      for (auto& category : usage)
+      {
+         ImGui::TableNextRow();
+         ImGui::TableNextColumn();
+         ImGui::TextUnformatted(category.category_.c_str());
+         ImGui::TableNextColumn();
+         ImGui::Text("%.2f", static_cast<double>(category.bytes_) / kMebibyte);
+         ImGui::TableNextColumn();
+         ImGui::Text("%zu", category.owners_);
+      }
+
+      ImGui::EndTable();
+   }
+
+   ImGui::End();
+}
+
 } // namespace ui
 } // namespace qt
 } // namespace scwx
@@ -94,6 +94,12 @@ void Level2ProductsWidget::showEvent(QShowEvent* event)
 void Level2ProductsWidgetImpl::HandleHotkeyPressed(types::Hotkey hotkey,
                                                    bool          isAutoRepeat)
 {
+   if (!self_->isActiveWindow())
+   {
+      // Hotkeys apply to the window in which they are pressed
+      return;
+   }
+
    auto productIt = kHotkeyProductMap_.find(hotkey);
 
    if (productIt == kHotkeyProductMap_.cend())
@@ -102,9 +108,10 @@ void Level2ProductsWidgetImpl::HandleHotkeyPressed(types::Hotkey hotkey,
       return;
    }
 
-   logger_->trace("Handling hotkey: {}, repeat: {}",
-                  types::GetHotkeyShortName(hotkey),
-                  isAutoRepeat);
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Handling hotkey: {}, repeat: {}",
+                       types::GetHotkeyShortName(hotkey),
+                       isAutoRepeat);
 
    // Select product category hotkey
    SelectProduct(productIt->second);
@@ -116,6 +116,12 @@ void Level2SettingsWidget::showEvent(QShowEvent* event)
 void Level2SettingsWidgetImpl::HandleHotkeyPressed(types::Hotkey hotkey,
                                                    bool          isAutoRepeat)
 {
+   if (!self_->isActiveWindow())
+   {
+      // Hotkeys apply to the window in which they are pressed
+      return;
+   }
+
    if (hotkey != types::Hotkey::ProductTiltDecrease &&
        hotkey != types::Hotkey::ProductTiltIncrease)
    {
@@ -123,9 +129,10 @@ void Level2SettingsWidgetImpl::HandleHotkeyPressed(types::Hotkey hotkey,
       return;
    }
 
-   logger_->trace("Handling hotkey: {}, repeat: {}",
-                  types::GetHotkeyShortName(hotkey),
-                  isAutoRepeat);
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Handling hotkey: {}, repeat: {}",
+                       types::GetHotkeyShortName(hotkey),
+                       isAutoRepeat);
 
    if (!self_->isVisible() || currentElevationButton_ == nullptr)
    {
@@ -183,6 +183,10 @@ public:
    std::unordered_map<QAction*, std::string> awipsProductMap_;
    std::shared_mutex                         awipsProductMutex_;
 
+   // Products displayed as available, compared against updates such that only
+   // changed categories and products are updated
+   common::Level3ProductCategoryMap availableCategoryMap_ {};
+
    std::string currentAwipsId_ {};
    QAction*    currentProductTiltAction_ {nullptr};
 
@@ -207,6 +211,12 @@ void Level3ProductsWidget::showEvent(QShowEvent* event)
 void Level3ProductsWidgetImpl::HandleHotkeyPressed(types::Hotkey hotkey,
                                                    bool          isAutoRepeat)
 {
+   if (!self_->isActiveWindow())
+   {
+      // Hotkeys apply to the window in which they are pressed
+      return;
+   }
+
    auto productCategoryIt = kHotkeyProductCategoryMap_.find(hotkey);
 
    if (productCategoryIt == kHotkeyProductCategoryMap_.cend() &&
@@ -217,9 +227,10 @@ void Level3ProductsWidgetImpl::HandleHotkeyPressed(types::Hotkey hotkey,
       return;
    }
 
-   logger_->trace("Handling hotkey: {}, repeat: {}",
-                  types::GetHotkeyShortName(hotkey),
-                  isAutoRepeat);
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Handling hotkey: {}, repeat: {}",
+                       types::GetHotkeyShortName(hotkey),
+                       isAutoRepeat);
 
    if (productCategoryIt != kHotkeyProductCategoryMap_.cend())
    {
@@ -331,7 +342,7 @@ void Level3ProductsWidgetImpl::SelectProductCategory(
 void Level3ProductsWidget::UpdateAvailableProducts(
    const common::Level3ProductCategoryMap& updatedCategoryMap)
 {
-   logger_->trace("UpdateAvailableProducts()");
+   SPDLOG_LOGGER_TRACE(logger_, "UpdateAvailableProducts()");
 
    // Iterate through each category tool button
    std::for_each(
@@ -350,48 +361,75 @@ void Level3ProductsWidget::UpdateAvailableProducts(
          // Enable category if any products are available
          toolButton->setEnabled(categoryEnabled);
 
-         if (categoryEnabled)
+         if (!categoryEnabled)
+         {
+            // Product menus of a disabled category are left as displayed, and
+            // are compared against once the category is enabled again
+            return;
+         }
+
+         const auto& availableProductMap = availableProductMapIter->second;
+         auto&       previousProductMap = p->availableCategoryMap_[category];
+
+         if (availableProductMap == previousProductMap)
          {
-            const auto& availableProductMap = availableProductMapIter->second;
-            auto&       productMenus        = p->categoryMenuMap_.at(category);
-
-            // Iterate through each product menu
-            std::for_each(
-               productMenus.cbegin(),
-               productMenus.cend(),
-               [&](const auto productMenu)
+            return;
+         }
+
+         auto& productMenus = p->categoryMenuMap_.at(category);
+
+         // Iterate through each product menu
+         std::for_each(
+            productMenus.cbegin(),
+            productMenus.cend(),
+            [&](const auto productMenu)
+            {
+               auto availableAwipsIdIter =
+                  availableProductMap.find(productMenu.first);
+               const bool productEnabled =
+                  (availableAwipsIdIter != availableProductMap.cend());
+
+               auto previousAwipsIdIter =
+                  previousProductMap.find(productMenu.first);
+               const bool productPreviouslyEnabled =
+                  (previousAwipsIdIter != previousProductMap.cend());
+
+               if (productEnabled == productPreviouslyEnabled &&
+                   (!productEnabled ||
+                    availableAwipsIdIter->second ==
+                       previousAwipsIdIter->second))
                {
-                  auto availableAwipsIdIter =
-                     availableProductMap.find(productMenu.first);
-                  const bool productEnabled =
-                     (availableAwipsIdIter != availableProductMap.cend());
+                  // The product is unchanged
+                  return;
+               }
 
-                  // Enable product if it has AWIPS IDs available
-                  productMenu.second->menuAction()->setVisible(productEnabled);
+               // Enable product if it has AWIPS IDs available
+               productMenu.second->menuAction()->setVisible(productEnabled);
 
-                  if (productEnabled)
-                  {
-                     // Determine number of tilts to display
-                     const size_t numTilts =
-                        std::min(availableAwipsIdIter->second.size(),
-                                 common::kLevel3ProductMaxTilts);
+               if (productEnabled)
+               {
+                  // Determine number of tilts to display
+                  const size_t numTilts =
+                     std::min(availableAwipsIdIter->second.size(),
+                              common::kLevel3ProductMaxTilts);
 
-                     const std::vector<QAction*>& tiltActionList =
-                        p->productTiltMap_.at(productMenu.first);
+                  const std::vector<QAction*>& tiltActionList =
+                     p->productTiltMap_.at(productMenu.first);
 
-                     for (size_t i = 0; i < tiltActionList.size(); i++)
-                     {
-                        bool visible = (i < numTilts);
-                        tiltActionList[i]->setVisible(visible);
+                  std::unique_lock lock {p->awipsProductMutex_};
 
-                        std::unique_lock lock {p->awipsProductMutex_};
+                  for (size_t i = 0; i < tiltActionList.size(); i++)
+                  {
+                     bool visible = (i < numTilts);
+                     tiltActionList[i]->setVisible(visible);
 
-                        p->awipsProductMap_[tiltActionList[i]] =
-                           visible ? availableAwipsIdIter->second[i] : "?";
-                     }
+                     p->awipsProductMap_[tiltActionList[i]] =
+                        visible ? availableAwipsIdIter->second[i] : "?";
                   }
-               });
-         }
+               }
+            });
+
+         previousProductMap = availableProductMap;
       });
 }
 
@@ -177,7 +177,7 @@ QSize LineLabel::sizeHint() const
 
 void LineLabel::paintEvent(QPaintEvent* e)
 {
-   logger_->trace("paintEvent");
+   SPDLOG_LOGGER_TRACE(logger_, "paintEvent");
 
    QFrame::paintEvent(e);
 
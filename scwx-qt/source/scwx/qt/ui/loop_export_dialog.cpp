@@ -0,0 +1,240 @@
+#include <scwx/qt/ui/loop_export_dialog.hpp>
+#include <scwx/qt/manager/timeline_manager.hpp>
+#include <scwx/qt/map/map_widget.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/strand.hpp>
+#include <scwx/util/time.hpp>
+
+#include <atomic>
+#include <chrono>
+
+#include <fmt/format.h>
+#include <QDialogButtonBox>
+#include <QDir>
+#include <QPushButton>
+
+namespace scwx
+{
+namespace qt
+{
+namespace ui
+{
+
+static const std::string logPrefix_ = "scwx::qt::ui::loop_export_dialog";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Wait up to 5 seconds for a frame to be painted
+static constexpr std::chrono::seconds kCaptureTimeout_ {5};
+
+class LoopExportDialog::Impl
+{
+public:
+   explicit Impl(LoopExportDialog* self) : self_ {self} {};
+   ~Impl() = default;
+
+   void CaptureFrame(const QImage& image, std::uint64_t frame);
+   void FinishExport(bool complete);
+
+   LoopExportDialog* self_;
+
+   map::MapWidget* mapWidget_ {nullptr};
+   QString         directory_ {};
+
+   std::atomic<bool>        exporting_ {false};
+   std::atomic<bool>        cancelled_ {false};
+   std::atomic<std::size_t> framesWritten_ {0u};
+   std::atomic<std::size_t> writeErrors_ {0u};
+
+   // Images are encoded and written in order, without delaying rendering
+   scwx::util::Strand writeStrand_ {"Loop Export",
+                                    scwx::util::Strand::Priority::Background};
+};
+
+LoopExportDialog::LoopExportDialog(QWidget* parent) :
+    ProgressDialog(parent), p {std::make_unique<Impl>(this)}
+{
+   auto buttonBox = button_box();
+   buttonBox->setStandardButtons(QDialogButtonBox::StandardButton::Ok |
+                                 QDialogButtonBox::StandardButton::Cancel);
+
+   connect(buttonBox,
+           &QDialogButtonBox::rejected,
+           this,
+           &LoopExportDialog::CancelExport);
+
+   setWindowTitle(tr("Export Loop"));
+}
+
+LoopExportDialog::~LoopExportDialog()
+{
+   p->cancelled_ = true;
+}
+
+bool LoopExportDialog::is_exporting() const
+{
+   return p->exporting_;
+}
+
+void LoopExportDialog::StartExport(map::MapWidget* mapWidget,
+                                   const QSize&    size,
+                                   const QString&  directory)
+{
+   if (p->exporting_.exchange(true))
+   {
+      logger_->warn("Loop is already being exported");
+      return;
+   }
+
+   logger_->info("Exporting loop ({}x{}) to: {}",
+                 size.width(),
+                 size.height(),
+                 directory.toStdString());
+
+   p->mapWidget_     = mapWidget;
+   p->directory_     = directory;
+   p->cancelled_     = false;
+   p->framesWritten_ = 0u;
+   p->writeErrors_   = 0u;
+
+   // Hide the OK button until the export is finished
+   button_box()
+      ->button(QDialogButtonBox::StandardButton::Ok)
+      ->setVisible(false);
+   button_box()
+      ->button(QDialogButtonBox::StandardButton::Cancel)
+      ->setVisible(true);
+
+   SetRange(0, 0);
+   SetValue(0);
+   SetTopLabelText(tr("Exporting loop to %1").arg(directory));
+   SetBottomLabelText(tr("Loading loop frames..."));
+   show();
+
+   mapWidget->StartCapture(size,
+                           [this](QImage image, std::uint64_t frame)
+                           { p->CaptureFrame(image, frame); });
+
+   manager::TimelineManager::Instance()->ExportLoop(
+      [this](std::size_t                           frame,
+             std::size_t                           frameCount,
+             std::chrono::system_clock::time_point time)
+      {
+         if (p->cancelled_)
+         {
+            return false;
+         }
+
+         QMetaObject::invokeMethod(
+            this,
+            [=, this]()
+            {
+               SetRange(0, static_cast<int>(frameCount));
+               SetValue(static_cast<int>(frame));
+               SetBottomLabelText(
+                  tr("Exporting frame %1 of %2 (%3)")
+                     .arg(frame + 1)
+                     .arg(frameCount)
+                     .arg(QString::fromStdString(
+                        scwx::util::TimeString(time))));
+            });
+
+         // Wait for the frame to be painted before selecting the next frame
+         std::future<void> painted = p->mapWidget_->CaptureFrame(frame);
+         if (painted.wait_for(kCaptureTimeout_) == std::future_status::timeout)
+         {
+            logger_->warn("Frame {} was not painted", frame);
+         }
+
+         return !p->cancelled_;
+      },
+      [this](bool complete)
+      {
+         QMetaObject::invokeMethod(
+            this, [=, this]() { p->FinishExport(complete); });
+      });
+}
+
+void LoopExportDialog::CancelExport()
+{
+   if (p->exporting_)
+   {
+      logger_->info("Cancelling loop export");
+      p->cancelled_ = true;
+   }
+}
+
+void LoopExportDialog::Impl::CaptureFrame(const QImage& image,
+                                          std::uint64_t frame)
+{
+   writeStrand_.Post(
+      [=, this]()
+      {
+         const QString filename = QDir(directory_).filePath(
+            QString::fromStdString(fmt::format("frame_{:04}.png", frame)));
+
+         // Frames are read from OpenGL with rows ordered from bottom to top
+         if (image.mirrored().save(filename, "PNG"))
+         {
+            ++framesWritten_;
+         }
+         else
+         {
+            logger_->error("Could not write frame: {}", filename.toStdString());
+            ++writeErrors_;
+         }
+      });
+}
+
+void LoopExportDialog::Impl::FinishExport(bool complete)
+{
+   // Complete frames still being read back
+   mapWidget_->StopCapture();
+   mapWidget_ = nullptr;
+
+   // Report once every frame has been written
+   writeStrand_.Post(
+      [=, this]()
+      {
+         QMetaObject::invokeMethod(
+            self_,
+            [=, this]()
+            {
+               QString result;
+               if (writeErrors_ > 0u)
+               {
+                  result = tr("%1 frames exported, %2 frames not written")
+                              .arg(framesWritten_.load())
+                              .arg(writeErrors_.load());
+               }
+               else if (complete)
+               {
+                  result =
+                     tr("%1 frames exported").arg(framesWritten_.load());
+               }
+               else
+               {
+                  result = tr("Export cancelled, %1 frames exported")
+                              .arg(framesWritten_.load());
+               }
+
+               logger_->info(result.toStdString());
+
+               self_->SetRange(0, 1);
+               self_->SetValue(1);
+               self_->SetBottomLabelText(result);
+
+               self_->button_box()
+                  ->button(QDialogButtonBox::StandardButton::Ok)
+                  ->setVisible(true);
+               self_->button_box()
+                  ->button(QDialogButtonBox::StandardButton::Cancel)
+                  ->setVisible(false);
+
+               exporting_ = false;
+            });
+      });
+}
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
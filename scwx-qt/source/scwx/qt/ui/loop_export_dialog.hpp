@@ -0,0 +1,55 @@
+#pragma once
+
+#include <scwx/qt/ui/progress_dialog.hpp>
+
+#include <QSize>
+#include <QString>
+
+namespace scwx
+{
+namespace qt
+{
+namespace map
+{
+class MapWidget;
+} // namespace map
+
+namespace ui
+{
+class LoopExportDialog : public ProgressDialog
+{
+   Q_OBJECT
+   Q_DISABLE_COPY_MOVE(LoopExportDialog)
+
+public:
+   explicit LoopExportDialog(QWidget* parent = nullptr);
+   ~LoopExportDialog();
+
+   /**
+    * @brief Whether a loop is being exported
+    */
+   bool is_exporting() const;
+
+   /**
+    * @brief Exports each frame of the loop as a PNG image, captured from a
+    * map at the given size.
+    *
+    * @param [in] mapWidget Map to capture
+    * @param [in] size Size of exported images in pixels
+    * @param [in] directory Directory in which to write the images
+    */
+   void StartExport(map::MapWidget* mapWidget,
+                    const QSize&    size,
+                    const QString&  directory);
+
+public slots:
+   void CancelExport();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,185 @@
+#include <scwx/qt/ui/map_prefetch_dialog.hpp>
+#include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/map/map_prefetcher.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/qt/util/maplibre.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+
+#include <QDialogButtonBox>
+#include <QPushButton>
+
+namespace scwx
+{
+namespace qt
+{
+namespace ui
+{
+
+static const std::string logPrefix_ = "scwx::qt::ui::map_prefetch_dialog";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+class MapPrefetchDialog::Impl
+{
+public:
+   explicit Impl(MapPrefetchDialog*         self,
+                 const QMapLibre::Settings& settings) :
+       self_ {self}, prefetcher_ {settings}
+   {
+   }
+   ~Impl() = default;
+
+   void FinishPrefetch(bool complete);
+
+   MapPrefetchDialog* self_;
+   map::MapPrefetcher prefetcher_;
+};
+
+MapPrefetchDialog::MapPrefetchDialog(const QMapLibre::Settings& settings,
+                                     QWidget*                   parent) :
+    ProgressDialog(parent), p {std::make_unique<Impl>(this, settings)}
+{
+   auto buttonBox = button_box();
+   buttonBox->setStandardButtons(QDialogButtonBox::StandardButton::Ok |
+                                 QDialogButtonBox::StandardButton::Cancel);
+
+   connect(buttonBox,
+           &QDialogButtonBox::rejected,
+           this,
+           &MapPrefetchDialog::CancelPrefetch);
+   connect(&p->prefetcher_,
+           &map::MapPrefetcher::ProgressUpdated,
+           this,
+           [this](std::size_t completed, std::size_t total)
+           {
+              SetRange(0, static_cast<int>(total));
+              SetValue(static_cast<int>(completed));
+              SetBottomLabelText(
+                 tr("Downloaded %1 of %2 map views").arg(completed).arg(total));
+           });
+   connect(&p->prefetcher_,
+           &map::MapPrefetcher::Finished,
+           this,
+           [this](bool complete) { p->FinishPrefetch(complete); });
+
+   setWindowTitle(tr("Prefetch Map Tiles"));
+}
+
+MapPrefetchDialog::~MapPrefetchDialog() = default;
+
+bool MapPrefetchDialog::is_prefetching() const
+{
+   return p->prefetcher_.is_running();
+}
+
+void MapPrefetchDialog::StartPrefetch(
+   map::MapProvider                mapProvider,
+   const std::string&              styleUrl,
+   const std::vector<std::string>& radarSites)
+{
+   if (p->prefetcher_.is_running())
+   {
+      logger_->warn("Map tiles are already being prefetched");
+      return;
+   }
+
+   auto& generalSettings = settings::GeneralSettings::Instance();
+
+   const double radius =
+      static_cast<double>(generalSettings.map_prefetch_radius().GetValue());
+   int minZoom =
+      static_cast<int>(generalSettings.map_prefetch_min_zoom().GetValue());
+   int maxZoom =
+      static_cast<int>(generalSettings.map_prefetch_max_zoom().GetValue());
+
+   if (minZoom > maxZoom)
+   {
+      std::swap(minZoom, maxZoom);
+   }
+
+   std::vector<map::MapPrefetchRegion> regions {};
+   QStringList                         siteIds {};
+
+   for (auto& radarSite : radarSites)
+   {
+      auto site = config::RadarSite::Get(radarSite);
+      if (site == nullptr)
+      {
+         logger_->warn("Unknown radar site: {}", radarSite);
+         continue;
+      }
+
+      regions.push_back({{site->latitude(), site->longitude()},
+                         radius,
+                         minZoom,
+                         maxZoom});
+      siteIds.append(QString::fromStdString(site->id()));
+   }
+
+   logger_->info("Prefetching map tiles around: {}",
+                 siteIds.join(", ").toStdString());
+
+   // Hide the OK button until the prefetch is finished
+   button_box()
+      ->button(QDialogButtonBox::StandardButton::Ok)
+      ->setVisible(false);
+   button_box()
+      ->button(QDialogButtonBox::StandardButton::Cancel)
+      ->setVisible(true);
+
+   SetRange(0, 0);
+   SetValue(0);
+   SetTopLabelText(tr("Downloading map tiles within %1 km of %2 "
+                      "(zoom levels %3 to %4)")
+                      .arg(radius)
+                      .arg(siteIds.join(", "))
+                      .arg(minZoom)
+                      .arg(maxZoom));
+   SetBottomLabelText(tr("Loading map style..."));
+   show();
+
+   p->prefetcher_.Start(util::maplibre::GetMapStyleUrl(mapProvider, styleUrl),
+                        regions);
+}
+
+void MapPrefetchDialog::CancelPrefetch()
+{
+   p->prefetcher_.Cancel();
+}
+
+void MapPrefetchDialog::Impl::FinishPrefetch(bool complete)
+{
+   const std::size_t failed = prefetcher_.failed_count();
+
+   QString result;
+   if (!complete)
+   {
+      result = tr("Prefetch cancelled");
+   }
+   else if (failed > 0u)
+   {
+      result = tr("Prefetch finished, %1 map views could not be completely "
+                  "downloaded")
+                  .arg(failed);
+   }
+   else
+   {
+      result = tr("Prefetch finished");
+   }
+
+   self_->SetRange(0, 1);
+   self_->SetValue(1);
+   self_->SetBottomLabelText(result);
+
+   self_->button_box()
+      ->button(QDialogButtonBox::StandardButton::Ok)
+      ->setVisible(true);
+   self_->button_box()
+      ->button(QDialogButtonBox::StandardButton::Cancel)
+      ->setVisible(false);
+}
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <scwx/qt/map/map_provider.hpp>
+#include <scwx/qt/ui/progress_dialog.hpp>
+
+#include <string>
+#include <vector>
+
+#include <qmaplibre.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace ui
+{
+class MapPrefetchDialog : public ProgressDialog
+{
+   Q_OBJECT
+   Q_DISABLE_COPY_MOVE(MapPrefetchDialog)
+
+public:
+   explicit MapPrefetchDialog(const QMapLibre::Settings& settings,
+                              QWidget*                   parent = nullptr);
+   ~MapPrefetchDialog();
+
+   /**
+    * @brief Whether map tiles are being prefetched
+    */
+   bool is_prefetching() const;
+
+   /**
+    * @brief Prefetches map tiles around each radar site, using the radius and
+    * zoom levels in general settings.
+    *
+    * @param [in] mapProvider Map provider
+    * @param [in] styleUrl Style URL of the map
+    * @param [in] radarSites Radar sites around which to prefetch tiles
+    */
+   void StartPrefetch(map::MapProvider                mapProvider,
+                      const std::string&              styleUrl,
+                      const std::vector<std::string>& radarSites);
+
+public slots:
+   void CancelPrefetch();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
@@ -196,13 +196,23 @@ int SerialPortDialog::baud_rate()
 
 void SerialPortDialog::Impl::LogSerialPortInfo(const QSerialPortInfo& info)
 {
-   logger_->trace("Serial Port:    {}", info.portName().toStdString());
-   logger_->trace("  Description:  {}", info.description().toStdString());
-   logger_->trace("  System Loc:   {}", info.systemLocation().toStdString());
-   logger_->trace("  Manufacturer: {}", info.manufacturer().toStdString());
-   logger_->trace("  Vendor ID:    {}", info.vendorIdentifier());
-   logger_->trace("  Product ID:   {}", info.productIdentifier());
-   logger_->trace("  Serial No:    {}", info.serialNumber().toStdString());
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Serial Port:    {}",
+                       info.portName().toStdString());
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "  Description:  {}",
+                       info.description().toStdString());
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "  System Loc:   {}",
+                       info.systemLocation().toStdString());
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "  Manufacturer: {}",
+                       info.manufacturer().toStdString());
+   SPDLOG_LOGGER_TRACE(logger_, "  Vendor ID:    {}", info.vendorIdentifier());
+   SPDLOG_LOGGER_TRACE(logger_, "  Product ID:   {}", info.productIdentifier());
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "  Serial No:    {}",
+                       info.serialNumber().toStdString());
 }
 
 void SerialPortDialog::Impl::RefreshSerialDevices()
@@ -340,8 +350,10 @@ void SerialPortDialog::Impl::ReadComPortProperties(
       properties.busReportedDeviceDescription_ = GetDevicePropertyString(
          deviceInfoSet, deviceInfoData, DEVPKEY_Device_BusReportedDeviceDesc);
 
-      logger_->trace(
-         "Port: {} ({})", portName, properties.busReportedDeviceDescription_);
+      SPDLOG_LOGGER_TRACE(logger_,
+                          "Port: {} ({})",
+                          portName,
+                          properties.busReportedDeviceDescription_);
 
       portPropertiesMap.emplace(portName, std::move(properties));
 
@@ -436,7 +448,10 @@ void SerialPortDialog::Impl::ReadComPortSettings(
 
             std::string portData = buffer;
 
-            logger_->trace("Port Settings: {} ({})", portName, portData);
+            SPDLOG_LOGGER_TRACE(logger_,
+                                "Port Settings: {} ({})",
+                                portName,
+                                portData);
 
             StorePortSettings(portName, portData, portSettingsMap);
          }
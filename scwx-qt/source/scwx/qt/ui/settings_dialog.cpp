@@ -31,7 +31,8 @@
 #include <scwx/qt/ui/settings/unit_settings_widget.hpp>
 #include <scwx/qt/ui/wfo_dialog.hpp>
 #include <scwx/qt/util/color.hpp>
-#include <scwx/qt/util/file.hpp>
+#include <scwx/qt/util/position_filter.hpp>
+#include <scwx/qt/view/color_table_cache.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
 
@@ -103,6 +104,18 @@ static const std::unordered_map<std::string, ColorTableConversions>
                             {"VIL", {0u, 255u, 1.0f, 2.5f}},
                             {"???", {0u, 15u, 0.0f, 1.0f}}};
 
+// Settings pages, in the order of the page list
+enum class SettingsPage
+{
+   General,
+   Palettes,
+   Units,
+   Audio,
+   Text,
+   Hotkeys
+};
+static constexpr std::size_t kSettingsPageCount_ = 6u;
+
 class SettingsDialogImpl
 {
 public:
@@ -114,45 +127,7 @@ public:
        countyDialog_ {new CountyDialog(self)},
        wfoDialog_ {new WFODialog(self)},
        fontDialog_ {new QFontDialog(self)},
-       fontCategoryModel_ {new QStandardItemModel(self)},
-       settings_ {std::initializer_list<settings::SettingsInterfaceBase*> {
-          &defaultRadarSite_,
-          &gridWidth_,
-          &gridHeight_,
-          &mapProvider_,
-          &mapboxApiKey_,
-          &mapTilerApiKey_,
-          &theme_,
-          &themeFile_,
-          &defaultAlertAction_,
-          &clockFormat_,
-          &customStyleDrawLayer_,
-          &customStyleUrl_,
-          &defaultTimeZone_,
-          &positioningPlugin_,
-          &nmeaBaudRate_,
-          &nmeaSource_,
-          &warningsProvider_,
-          &antiAliasingEnabled_,
-          &showMapAttribution_,
-          &showMapCenter_,
-          &showMapLogo_,
-          &showSmoothedRangeFolding_,
-          &updateNotificationsEnabled_,
-          &cursorIconAlwaysOn_,
-          &debugEnabled_,
-          &alertAudioSoundFile_,
-          &alertAudioLocationMethod_,
-          &alertAudioLatitude_,
-          &alertAudioLongitude_,
-          &alertAudioRadarSite_,
-          &alertAudioRadius_,
-          &alertAudioCounty_,
-          &alertAudioWFO_,
-          &hoverTextWrap_,
-          &tooltipMethod_,
-          &placefileTextDropShadowEnabled_,
-          &radarSiteHoverTextEnabled_}}
+       fontCategoryModel_ {new QStandardItemModel(self)}
    {
       // Configure default alert phenomena colors
       auto& paletteSettings = settings::PaletteSettings::Instance();
@@ -179,6 +154,7 @@ public:
    ~SettingsDialogImpl() = default;
 
    void ConnectSignals();
+   void SetupPage(SettingsPage page);
    void SetupGeneralTab();
    void SetupPalettesColorTablesTab();
    void SetupPalettesAlertsTab();
@@ -227,6 +203,11 @@ public:
    std::shared_ptr<manager::PositionManager> positionManager_ {
       manager::PositionManager::Instance()};
 
+   // The tracked alert location is only displayed to about 0.001 degrees
+   util::PositionFilter alertLocationFilter_ {
+      {.distance_ = units::length::meters<double> {50.0},
+       .interval_ = std::chrono::milliseconds {1000}}};
+
    std::vector<SettingsPageWidget*> settingsPages_ {};
    AlertPaletteSettingsWidget*      alertPaletteSettingsWidget_ {};
    HotkeySettingsWidget*            hotkeySettingsWidget_ {};
@@ -287,7 +268,10 @@ public:
    settings::SettingsInterface<bool>         placefileTextDropShadowEnabled_ {};
    settings::SettingsInterface<bool>         radarSiteHoverTextEnabled_ {};
 
-   std::vector<settings::SettingsInterfaceBase*> settings_;
+   // Settings of the pages which have been set up
+   std::vector<settings::SettingsInterfaceBase*> settings_ {};
+
+   std::array<bool, kSettingsPageCount_> pageSetup_ {};
 };
 
 SettingsDialog::SettingsDialog(QWidget* parent) :
@@ -301,26 +285,8 @@ SettingsDialog::SettingsDialog(QWidget* parent) :
    ui->buttonBox->button(QDialogButtonBox::StandardButton::Ok)
       ->setDefault(true);
 
-   // General
-   p->SetupGeneralTab();
-
-   // Palettes > Color Tables
-   p->SetupPalettesColorTablesTab();
-
-   // Palettes > Alerts
-   p->SetupPalettesAlertsTab();
-
-   // Units
-   p->SetupUnitsTab();
-
-   // Audio
-   p->SetupAudioTab();
-
-   // Text
-   p->SetupTextTab();
-
-   // Hotkeys
-   p->SetupHotkeysTab();
+   // General. The remaining pages are set up when first selected.
+   p->SetupPage(SettingsPage::General);
 
    p->ConnectSignals();
 }
@@ -334,8 +300,17 @@ void SettingsDialogImpl::ConnectSignals()
 {
    QObject::connect(self_->ui->listWidget,
                     &QListWidget::currentRowChanged,
-                    self_->ui->stackedWidget,
-                    &QStackedWidget::setCurrentIndex);
+                    self_,
+                    [this](int currentRow)
+                    {
+                       if (currentRow >= 0 &&
+                           currentRow < static_cast<int>(kSettingsPageCount_))
+                       {
+                          SetupPage(static_cast<SettingsPage>(currentRow));
+                       }
+
+                       self_->ui->stackedWidget->setCurrentIndex(currentRow);
+                    });
 
    QObject::connect(self_->ui->radarSiteSelectButton,
                     &QAbstractButton::clicked,
@@ -429,36 +404,6 @@ void SettingsDialogImpl::ConnectSignals()
                     self_,
                     [this]() { mediaManager_->Stop(); });
 
-   QObject::connect(
-      self_->ui->fontListView->selectionModel(),
-      &QItemSelectionModel::selectionChanged,
-      self_,
-      [this](const QItemSelection& selected, const QItemSelection& deselected)
-      {
-         if (selected.size() == 0 && deselected.size() == 0)
-         {
-            // Items which stay selected but change their index are not
-            // included in selected and deselected. Thus, this signal might
-            // be emitted with both selected and deselected empty, if only
-            // the indices of selected items change.
-            return;
-         }
-
-         if (selected.size() > 0)
-         {
-            QModelIndex selectedIndex = selected[0].indexes()[0];
-            QVariant    variantData =
-               self_->ui->fontListView->model()->data(selectedIndex);
-            if (variantData.typeId() == QMetaType::QString)
-            {
-               types::FontCategory fontCategory =
-                  types::GetFontCategory(variantData.toString().toStdString());
-               SelectFontCategory(fontCategory);
-               UpdateFontDisplayData();
-            }
-         }
-      });
-
    QObject::connect(self_->ui->fontSelectButton,
                     &QAbstractButton::clicked,
                     self_,
@@ -526,6 +471,47 @@ void SettingsDialogImpl::ConnectSignals()
       });
 }
 
+void SettingsDialogImpl::SetupPage(SettingsPage page)
+{
+   bool& pageSetup = pageSetup_.at(static_cast<std::size_t>(page));
+   if (pageSetup)
+   {
+      return;
+   }
+   pageSetup = true;
+
+   switch (page)
+   {
+   case SettingsPage::General:
+      SetupGeneralTab();
+      break;
+
+   case SettingsPage::Palettes:
+      SetupPalettesColorTablesTab();
+      SetupPalettesAlertsTab();
+      break;
+
+   case SettingsPage::Units:
+      SetupUnitsTab();
+      break;
+
+   case SettingsPage::Audio:
+      SetupAudioTab();
+      break;
+
+   case SettingsPage::Text:
+      SetupTextTab();
+      break;
+
+   case SettingsPage::Hotkeys:
+      SetupHotkeysTab();
+      break;
+
+   default:
+      break;
+   }
+}
+
 void SettingsDialogImpl::SetupGeneralTab()
 {
    settings::GeneralSettings& generalSettings =
@@ -779,6 +765,33 @@ void SettingsDialogImpl::SetupGeneralTab()
 
    debugEnabled_.SetSettingsVariable(generalSettings.debug_enabled());
    debugEnabled_.SetEditWidget(self_->ui->debugEnabledCheckBox);
+
+   settings_.insert(settings_.end(),
+                    {&defaultRadarSite_,
+                     &gridWidth_,
+                     &gridHeight_,
+                     &mapProvider_,
+                     &mapboxApiKey_,
+                     &mapTilerApiKey_,
+                     &theme_,
+                     &themeFile_,
+                     &defaultAlertAction_,
+                     &clockFormat_,
+                     &customStyleDrawLayer_,
+                     &customStyleUrl_,
+                     &defaultTimeZone_,
+                     &positioningPlugin_,
+                     &nmeaBaudRate_,
+                     &nmeaSource_,
+                     &warningsProvider_,
+                     &antiAliasingEnabled_,
+                     &showMapAttribution_,
+                     &showMapCenter_,
+                     &showMapLogo_,
+                     &showSmoothedRangeFolding_,
+                     &updateNotificationsEnabled_,
+                     &cursorIconAlwaysOn_,
+                     &debugEnabled_});
 }
 
 void SettingsDialogImpl::SetupPalettesColorTablesTab()
@@ -1114,7 +1127,10 @@ void SettingsDialogImpl::SetupAudioTab()
          if (info.isValid() &&
              types::GetLocationMethod(
                 audioSettings.alert_location_method().GetValue()) ==
-                types::LocationMethod::Track)
+                types::LocationMethod::Track &&
+             alertLocationFilter_.Update({info.coordinate().latitude(),
+                                          info.coordinate().longitude()},
+                                         {}))
          {
             QGeoCoordinate coordinate = info.coordinate();
             self_->ui->alertAudioLatitudeSpinBox->setValue(
@@ -1202,6 +1218,16 @@ void SettingsDialogImpl::SetupAudioTab()
    alertAudioWFO_.SetEditWidget(self_->ui->alertAudioWFOLineEdit);
    alertAudioWFO_.SetResetButton(self_->ui->resetAlertAudioWFOButton);
    alertAudioWFO_.EnableTrimming();
+
+   settings_.insert(settings_.end(),
+                    {&alertAudioSoundFile_,
+                     &alertAudioLocationMethod_,
+                     &alertAudioLatitude_,
+                     &alertAudioLongitude_,
+                     &alertAudioRadarSite_,
+                     &alertAudioRadius_,
+                     &alertAudioCounty_,
+                     &alertAudioWFO_});
 }
 
 void SettingsDialogImpl::SetupTextTab()
@@ -1247,6 +1273,36 @@ void SettingsDialogImpl::SetupTextTab()
    SelectFontCategory(*types::FontCategoryIterator().begin());
    UpdateFontDisplayData();
 
+   QObject::connect(
+      self_->ui->fontListView->selectionModel(),
+      &QItemSelectionModel::selectionChanged,
+      self_,
+      [this](const QItemSelection& selected, const QItemSelection& deselected)
+      {
+         if (selected.size() == 0 && deselected.size() == 0)
+         {
+            // Items which stay selected but change their index are not
+            // included in selected and deselected. Thus, this signal might
+            // be emitted with both selected and deselected empty, if only
+            // the indices of selected items change.
+            return;
+         }
+
+         if (selected.size() > 0)
+         {
+            QModelIndex selectedIndex = selected[0].indexes()[0];
+            QVariant    variantData =
+               self_->ui->fontListView->model()->data(selectedIndex);
+            if (variantData.typeId() == QMetaType::QString)
+            {
+               types::FontCategory fontCategory =
+                  types::GetFontCategory(variantData.toString().toStdString());
+               SelectFontCategory(fontCategory);
+               UpdateFontDisplayData();
+            }
+         }
+      });
+
    hoverTextWrap_.SetSettingsVariable(textSettings.hover_text_wrap());
    hoverTextWrap_.SetEditWidget(self_->ui->hoverTextWrapSpinBox);
    hoverTextWrap_.SetResetButton(self_->ui->resetHoverTextWrapButton);
@@ -1267,6 +1323,12 @@ void SettingsDialogImpl::SetupTextTab()
       textSettings.radar_site_hover_text_enabled());
    radarSiteHoverTextEnabled_.SetEditWidget(
       self_->ui->radarSiteHoverTextCheckBox);
+
+   settings_.insert(settings_.end(),
+                    {&hoverTextWrap_,
+                     &tooltipMethod_,
+                     &placefileTextDropShadowEnabled_,
+                     &radarSiteHoverTextEnabled_});
 }
 
 void SettingsDialogImpl::SetupHotkeysTab()
@@ -1292,10 +1354,18 @@ QImage SettingsDialogImpl::GenerateColorTableImage(
                 static_cast<int>(height),
                 QImage::Format::Format_ARGB32);
 
+   std::vector<float> values(width);
    for (std::size_t i = min; i <= max; ++i)
    {
-      const float               value = (i - offset) / scale;
-      boost::gil::rgba8_pixel_t pixel = colorTable->Color(value);
+      values[i - min] = (i - offset) / scale;
+   }
+
+   std::vector<boost::gil::rgba8_pixel_t> pixels(width);
+   colorTable->Colors(values, pixels);
+
+   for (std::size_t i = min; i <= max; ++i)
+   {
+      const boost::gil::rgba8_pixel_t& pixel = pixels[i - min];
       image.setPixel(static_cast<int>(i - min),
                      0,
                      qRgba(static_cast<int>(pixel[0]),
@@ -1314,9 +1384,8 @@ void SettingsDialogImpl::LoadColorTablePreview(const std::string& key,
    scwx::util::async(
       [key, value, imageLabel]()
       {
-         std::unique_ptr<std::istream>       is = util::OpenFile(value);
          std::shared_ptr<common::ColorTable> colorTable =
-            common::ColorTable::Load(*is);
+            view::ColorTableCache::Instance().Load(value);
 
          if (colorTable->IsValid())
          {
@@ -1454,6 +1523,12 @@ void SettingsDialogImpl::ResetToDefault()
 {
    logger_->info("Restoring settings to default");
 
+   // Defaults are restored to every page, including those not yet selected
+   for (std::size_t page = 0; page < kSettingsPageCount_; ++page)
+   {
+      SetupPage(static_cast<SettingsPage>(page));
+   }
+
    for (auto& setting : settings_)
    {
       setting->StageDefault();
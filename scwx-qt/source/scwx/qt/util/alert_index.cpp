@@ -0,0 +1,262 @@
+#include <scwx/qt/util/alert_index.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/iterator/function_output_iterator.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+namespace bg  = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+// Time intervals are indexed as boxes of unit height, since the R-tree
+// algorithms are not implemented for one dimensional boxes
+typedef bg::model::point<double, 2, bg::cs::cartesian> Point;
+typedef bg::model::box<Point>                          Box;
+typedef Box                                            TimeBox;
+typedef std::pair<TimeBox, types::TextEventKey>        TimeValue;
+typedef Box                                            GeoBox;
+typedef std::pair<GeoBox, types::TextEventKey>         GeoValue;
+
+typedef std::unordered_set<types::TextEventKey,
+                           types::TextEventHash<types::TextEventKey>>
+   TextEventKeySet;
+
+class AlertIndex::Impl
+{
+public:
+   struct Entry
+   {
+      TimeBox                                      time_ {};
+      std::vector<GeoBox>                          bounds_ {};
+      std::vector<std::vector<common::Coordinate>> areas_ {};
+      std::vector<std::uint32_t>                   fipsCodes_ {};
+   };
+
+   explicit Impl() {}
+   ~Impl() = default;
+
+   static TimeBox ToTimeBox(std::chrono::system_clock::time_point begin,
+                            std::chrono::system_clock::time_point end);
+
+   std::unordered_map<types::TextEventKey,
+                      Entry,
+                      types::TextEventHash<types::TextEventKey>>
+      entries_ {};
+
+   bgi::rtree<TimeValue, bgi::quadratic<16>> timeIndex_ {};
+   bgi::rtree<GeoValue, bgi::quadratic<16>>  areaIndex_ {};
+
+   std::unordered_map<std::uint32_t, TextEventKeySet> countyIndex_ {};
+};
+
+AlertIndex::AlertIndex() : p(std::make_unique<Impl>()) {}
+AlertIndex::~AlertIndex() = default;
+
+AlertIndex::AlertIndex(AlertIndex&&) noexcept            = default;
+AlertIndex& AlertIndex::operator=(AlertIndex&&) noexcept = default;
+
+void AlertIndex::Update(
+   const types::TextEventKey&                          key,
+   std::chrono::system_clock::time_point               begin,
+   std::chrono::system_clock::time_point               end,
+   const std::vector<std::vector<common::Coordinate>>& areas,
+   const std::vector<std::uint32_t>&                   fipsCodes)
+{
+   Remove(key);
+
+   Impl::Entry entry {};
+
+   // An event without a begin time has a begin time of the epoch, and is valid
+   // from the beginning of time
+   entry.time_ = Impl::ToTimeBox(begin, std::max(begin, end));
+   p->timeIndex_.insert({entry.time_, key});
+
+   for (auto& area : areas)
+   {
+      if (area.empty())
+      {
+         continue;
+      }
+
+      auto [latMin, latMax] = std::minmax_element(
+         area.cbegin(),
+         area.cend(),
+         [](auto& a, auto& b) { return a.latitude_ < b.latitude_; });
+      auto [lonMin, lonMax] = std::minmax_element(
+         area.cbegin(),
+         area.cend(),
+         [](auto& a, auto& b) { return a.longitude_ < b.longitude_; });
+
+      GeoBox bounds {{lonMin->longitude_, latMin->latitude_},
+                     {lonMax->longitude_, latMax->latitude_}};
+
+      entry.bounds_.push_back(bounds);
+      entry.areas_.push_back(area);
+      p->areaIndex_.insert({bounds, key});
+   }
+
+   for (auto fipsCode : fipsCodes)
+   {
+      p->countyIndex_[fipsCode].insert(key);
+   }
+   entry.fipsCodes_ = fipsCodes;
+
+   p->entries_.emplace(key, std::move(entry));
+}
+
+void AlertIndex::Remove(const types::TextEventKey& key)
+{
+   auto it = p->entries_.find(key);
+   if (it == p->entries_.end())
+   {
+      return;
+   }
+
+   auto& entry = it->second;
+
+   p->timeIndex_.remove(TimeValue {entry.time_, key});
+
+   for (auto& bounds : entry.bounds_)
+   {
+      p->areaIndex_.remove(GeoValue {bounds, key});
+   }
+
+   for (auto fipsCode : entry.fipsCodes_)
+   {
+      auto countyIt = p->countyIndex_.find(fipsCode);
+      if (countyIt != p->countyIndex_.end())
+      {
+         countyIt->second.erase(key);
+         if (countyIt->second.empty())
+         {
+            p->countyIndex_.erase(countyIt);
+         }
+      }
+   }
+
+   p->entries_.erase(it);
+}
+
+void AlertIndex::Clear()
+{
+   p->entries_.clear();
+   p->timeIndex_.clear();
+   p->areaIndex_.clear();
+   p->countyIndex_.clear();
+}
+
+std::size_t AlertIndex::size() const
+{
+   return p->entries_.size();
+}
+
+std::vector<types::TextEventKey>
+AlertIndex::QueryTime(std::chrono::system_clock::time_point begin,
+                      std::chrono::system_clock::time_point end) const
+{
+   const TimeBox box = Impl::ToTimeBox(begin, end);
+
+   std::vector<types::TextEventKey> keys {};
+   p->timeIndex_.query(bgi::intersects(box),
+                       boost::make_function_output_iterator(
+                          [&keys](const TimeValue& value)
+                          { keys.push_back(value.second); }));
+
+   return keys;
+}
+
+std::vector<types::TextEventKey>
+AlertIndex::QueryArea(const common::Coordinate&           point,
+                      const units::length::meters<double> distance) const
+{
+   // Determine degree bounds which contain every point within the distance
+   auto [latDelta, lonDelta] =
+      GeographicLib::GetDistanceBounds(point, distance);
+
+   double minLon = point.longitude_ - lonDelta;
+   double maxLon = point.longitude_ + lonDelta;
+
+   // Bounds crossing the antimeridian include all longitudes
+   if (minLon < -180.0 || maxLon > 180.0)
+   {
+      minLon = -180.0;
+      maxLon = 180.0;
+   }
+
+   const GeoBox box {{minLon, point.latitude_ - latDelta},
+                     {maxLon, point.latitude_ + latDelta}};
+
+   TextEventKeySet                  candidates {};
+   std::vector<types::TextEventKey> keys {};
+
+   p->areaIndex_.query(
+      bgi::intersects(box),
+      boost::make_function_output_iterator(
+         [&](const GeoValue& value)
+         {
+            const types::TextEventKey& key = value.second;
+
+            // Events with multiple areas only need to be tested once
+            if (!candidates.insert(key).second)
+            {
+               return;
+            }
+
+            // Test the candidate against the area polygons
+            auto& areas = p->entries_.at(key).areas_;
+            if (std::any_of(areas.cbegin(),
+                            areas.cend(),
+                            [&](auto& area)
+                            {
+                               return GeographicLib::AreaInRangeOfPoint(
+                                  area, point, distance);
+                            }))
+            {
+               keys.push_back(key);
+            }
+         }));
+
+   return keys;
+}
+
+std::vector<types::TextEventKey>
+AlertIndex::QueryCounty(std::uint32_t fipsCode) const
+{
+   std::vector<types::TextEventKey> keys {};
+
+   auto it = p->countyIndex_.find(fipsCode);
+   if (it != p->countyIndex_.cend())
+   {
+      keys.assign(it->second.cbegin(), it->second.cend());
+   }
+
+   return keys;
+}
+
+TimeBox
+AlertIndex::Impl::ToTimeBox(std::chrono::system_clock::time_point begin,
+                            std::chrono::system_clock::time_point end)
+{
+   using Seconds = std::chrono::duration<double>;
+
+   return {{Seconds(begin.time_since_epoch()).count(), 0.0},
+           {Seconds(end.time_since_epoch()).count(), 1.0}};
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <scwx/qt/types/text_event_key.hpp>
+#include <scwx/common/geographic.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <units/length.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Index of text events by valid time, area and county, used to find the
+ * events matching a query without testing every event. The index is not
+ * thread safe.
+ */
+class AlertIndex
+{
+public:
+   explicit AlertIndex();
+   ~AlertIndex();
+
+   AlertIndex(const AlertIndex&)            = delete;
+   AlertIndex& operator=(const AlertIndex&) = delete;
+
+   AlertIndex(AlertIndex&&) noexcept;
+   AlertIndex& operator=(AlertIndex&&) noexcept;
+
+   /**
+    * @brief Adds an event to the index, replacing any previous entry for the
+    * event.
+    *
+    * @param [in] key Text event key
+    * @param [in] begin Event begin time
+    * @param [in] end Event end time
+    * @param [in] areas Polygon of each segment of the event
+    * @param [in] fipsCodes FIPS codes of the counties and zones of the event,
+    * as given by awips::Ugc::fips_codes()
+    */
+   void Update(const types::TextEventKey&                          key,
+               std::chrono::system_clock::time_point               begin,
+               std::chrono::system_clock::time_point               end,
+               const std::vector<std::vector<common::Coordinate>>& areas,
+               const std::vector<std::uint32_t>&                   fipsCodes);
+
+   /**
+    * @brief Removes an event from the index.
+    *
+    * @param [in] key Text event key
+    */
+   void Remove(const types::TextEventKey& key);
+
+   /**
+    * @brief Removes all events from the index.
+    */
+   void Clear();
+
+   /**
+    * @brief Gets the number of events in the index.
+    *
+    * @return Number of events
+    */
+   std::size_t size() const;
+
+   /**
+    * @brief Finds the events valid at any time within a time range.
+    *
+    * @param [in] begin Start of the time range
+    * @param [in] end End of the time range
+    *
+    * @return Text event keys
+    */
+   std::vector<types::TextEventKey>
+   QueryTime(std::chrono::system_clock::time_point begin,
+             std::chrono::system_clock::time_point end) const;
+
+   /**
+    * @brief Finds the events with an area within a distance of a point.
+    *
+    * @param [in] point Point
+    * @param [in] distance Distance from the point
+    *
+    * @return Text event keys
+    */
+   std::vector<types::TextEventKey>
+   QueryArea(const common::Coordinate&           point,
+             const units::length::meters<double> distance) const;
+
+   /**
+    * @brief Finds the events containing a county or zone.
+    *
+    * @param [in] fipsCode FIPS code of the county or zone
+    *
+    * @return Text event keys
+    */
+   std::vector<types::TextEventKey> QueryCounty(std::uint32_t fipsCode) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,150 @@
+#include <scwx/qt/util/azimuth_index.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+// Buckets are narrower than the narrowest radial (0.5 degrees), so each bucket
+// overlaps few radials
+static constexpr std::size_t kBucketsPerDegree_ = 10;
+static constexpr std::size_t kBucketCount_      = 360 * kBucketsPerDegree_;
+
+class AzimuthIndex::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() = default;
+
+   static std::size_t GetBucket(double azimuth);
+   static bool        Contains(const Radial& radial, double azimuth);
+
+   template<class Function>
+   static void ForEachBucket(const Radial& radial, Function&& function);
+
+   std::vector<Radial> radials_ {};
+
+   // Radials overlapping each bucket are candidates_[bucketOffsets_[b]] until
+   // candidates_[bucketOffsets_[b + 1]]
+   std::vector<std::uint32_t> bucketOffsets_ {};
+   std::vector<std::uint32_t> candidates_ {};
+};
+
+AzimuthIndex::AzimuthIndex() : p(std::make_unique<Impl>()) {}
+AzimuthIndex::~AzimuthIndex() = default;
+
+AzimuthIndex::AzimuthIndex(AzimuthIndex&&) noexcept            = default;
+AzimuthIndex& AzimuthIndex::operator=(AzimuthIndex&&) noexcept = default;
+
+std::size_t AzimuthIndex::Impl::GetBucket(double azimuth)
+{
+   const double bucket = azimuth * static_cast<double>(kBucketsPerDegree_);
+   return std::min(static_cast<std::size_t>(bucket), kBucketCount_ - 1);
+}
+
+bool AzimuthIndex::Impl::Contains(const Radial& radial, double azimuth)
+{
+   if (radial.startAngle_ < radial.endAngle_)
+   {
+      return radial.startAngle_ <= azimuth && azimuth < radial.endAngle_;
+   }
+
+   // If the radial crosses 0/360 degrees, special handling is needed
+   return radial.startAngle_ <= azimuth || azimuth < radial.endAngle_;
+}
+
+template<class Function>
+void AzimuthIndex::Impl::ForEachBucket(const Radial& radial,
+                                       Function&&    function)
+{
+   const std::size_t first = GetBucket(radial.startAngle_);
+   const std::size_t last  = GetBucket(radial.endAngle_);
+
+   for (std::size_t bucket = first;; bucket = (bucket + 1) % kBucketCount_)
+   {
+      function(bucket);
+
+      if (bucket == last)
+      {
+         break;
+      }
+   }
+}
+
+void AzimuthIndex::Build(const std::vector<Radial>& radials)
+{
+   p->radials_ = radials;
+
+   // Count the radials overlapping each bucket
+   p->bucketOffsets_.assign(kBucketCount_ + 1, 0u);
+   for (const Radial& radial : radials)
+   {
+      Impl::ForEachBucket(radial,
+                          [this](std::size_t bucket)
+                          { ++p->bucketOffsets_[bucket + 1]; });
+   }
+
+   for (std::size_t bucket = 0; bucket < kBucketCount_; ++bucket)
+   {
+      p->bucketOffsets_[bucket + 1] += p->bucketOffsets_[bucket];
+   }
+
+   // Fill each bucket in radial order
+   std::vector<std::uint32_t> next(p->bucketOffsets_.cbegin(),
+                                   p->bucketOffsets_.cend() - 1);
+   p->candidates_.resize(p->bucketOffsets_.back());
+   for (std::size_t i = 0; i < radials.size(); ++i)
+   {
+      Impl::ForEachBucket(radials[i],
+                          [&](std::size_t bucket)
+                          {
+                             p->candidates_[next[bucket]++] =
+                                static_cast<std::uint32_t>(i);
+                          });
+   }
+}
+
+void AzimuthIndex::Clear()
+{
+   p->radials_.clear();
+   p->bucketOffsets_.clear();
+   p->candidates_.clear();
+}
+
+std::optional<std::uint16_t> AzimuthIndex::Find(double azimuth) const
+{
+   if (p->radials_.empty() || !std::isfinite(azimuth))
+   {
+      return std::nullopt;
+   }
+
+   azimuth = std::fmod(azimuth, 360.0);
+   if (azimuth < 0.0)
+   {
+      azimuth += 360.0;
+   }
+
+   const std::size_t bucket = Impl::GetBucket(azimuth);
+
+   for (std::uint32_t i = p->bucketOffsets_[bucket];
+        i < p->bucketOffsets_[bucket + 1];
+        ++i)
+   {
+      const Radial& radial = p->radials_[p->candidates_[i]];
+      if (Impl::Contains(radial, azimuth))
+      {
+         return radial.index_;
+      }
+   }
+
+   return std::nullopt;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Index of the azimuths covered by each radial of a sweep, used to find
+ * the radial containing an azimuth without testing every radial. Azimuths are
+ * quantized into buckets, each listing the radials which overlap it.
+ */
+class AzimuthIndex
+{
+public:
+   struct Radial
+   {
+      std::uint16_t index_;      // Radial index
+      float         startAngle_; // Start angle [0, 360) degrees
+      float         endAngle_;   // Start angle of the next radial [0, 360)
+   };
+
+   explicit AzimuthIndex();
+   ~AzimuthIndex();
+
+   AzimuthIndex(const AzimuthIndex&)            = delete;
+   AzimuthIndex& operator=(const AzimuthIndex&) = delete;
+
+   AzimuthIndex(AzimuthIndex&&) noexcept;
+   AzimuthIndex& operator=(AzimuthIndex&&) noexcept;
+
+   /**
+    * @brief Rebuilds the index. A radial whose end angle is less than its
+    * start angle crosses 0/360 degrees.
+    *
+    * @param [in] radials Radials of the sweep, in ascending index order
+    */
+   void Build(const std::vector<Radial>& radials);
+
+   /**
+    * @brief Removes all radials from the index.
+    */
+   void Clear();
+
+   /**
+    * @brief Finds the radial containing an azimuth. If multiple radials
+    * contain the azimuth, the first radial given to Build is found.
+    *
+    * @param [in] azimuth Azimuth (degrees)
+    *
+    * @return Radial index, if found
+    */
+   std::optional<std::uint16_t> Find(double azimuth) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,184 @@
+#include <scwx/qt/util/cluster_index.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+
+#include <boost/unordered/unordered_flat_map.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+// Cell size of the first cluster level in map screen coordinates. Each level
+// doubles the cell size of the level below it.
+static constexpr float kBaseCellSize_ = 0.04f;
+
+// A level is used once its cells are smaller than this many pixels, which
+// first occurs near zoom 9
+static constexpr float kClusterPixels_ = 32.0f;
+
+class ClusterIndex::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() = default;
+
+   static float         GetCellSize(std::size_t level);
+   static std::uint64_t GetCellKey(const glm::vec2& point, std::size_t level);
+
+   std::vector<glm::vec2>               points_ {};
+   std::vector<std::size_t>             levels_ {};
+   std::array<std::size_t, kLevelCount> counts_ {};
+};
+
+ClusterIndex::ClusterIndex() : p(std::make_unique<Impl>()) {}
+ClusterIndex::~ClusterIndex() = default;
+
+ClusterIndex::ClusterIndex(ClusterIndex&&) noexcept            = default;
+ClusterIndex& ClusterIndex::operator=(ClusterIndex&&) noexcept = default;
+
+std::size_t ClusterIndex::GetClusterLevel(float pixelScale)
+{
+   const float maxCellSize = pixelScale * kClusterPixels_;
+
+   std::size_t level = 0;
+   while (level + 1 < kLevelCount &&
+          Impl::GetCellSize(level + 1) <= maxCellSize)
+   {
+      ++level;
+   }
+
+   return level;
+}
+
+float ClusterIndex::Impl::GetCellSize(std::size_t level)
+{
+   return std::ldexp(kBaseCellSize_, static_cast<int>(level) - 1);
+}
+
+std::uint64_t ClusterIndex::Impl::GetCellKey(const glm::vec2& point,
+                                             std::size_t      level)
+{
+   const float cellSize = GetCellSize(level);
+
+   const auto x = static_cast<std::int32_t>(std::floor(point.x / cellSize));
+   const auto y = static_cast<std::int32_t>(std::floor(point.y / cellSize));
+
+   return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+          static_cast<std::uint32_t>(y);
+}
+
+std::vector<std::size_t>
+ClusterIndex::Build(const std::vector<glm::vec2>&    points,
+                    const std::vector<std::int64_t>& priorities)
+{
+   const std::size_t numPoints = points.size();
+
+   // Every point is drawn at level 0
+   std::vector<std::size_t> levels(numPoints, 0u);
+
+   // A point is compared to other points by priority, then by its index
+   const auto precedes = [&priorities](std::size_t a, std::size_t b)
+   {
+      return priorities[a] > priorities[b] ||
+             (priorities[a] == priorities[b] && a < b);
+   };
+
+   boost::unordered_flat_map<std::uint64_t, std::size_t> representatives {};
+
+   for (std::size_t level = 1; level < kLevelCount; ++level)
+   {
+      representatives.clear();
+
+      for (std::size_t i = 0; i < numPoints; ++i)
+      {
+         // Only representatives of the level below may represent this level
+         if (levels[i] != level - 1)
+         {
+            continue;
+         }
+
+         auto [it, inserted] =
+            representatives.try_emplace(Impl::GetCellKey(points[i], level), i);
+
+         if (!inserted && precedes(i, it->second))
+         {
+            it->second = i;
+         }
+      }
+
+      for (auto& representative : representatives)
+      {
+         levels[representative.second] = level;
+      }
+   }
+
+   // Order points by descending level, retaining their order within a level
+   std::vector<std::size_t> order(numPoints);
+   std::iota(order.begin(), order.end(), std::size_t {0});
+   std::stable_sort(order.begin(),
+                    order.end(),
+                    [&levels](std::size_t a, std::size_t b)
+                    { return levels[a] > levels[b]; });
+
+   p->points_.resize(numPoints);
+   p->levels_.resize(numPoints);
+   p->counts_.fill(0u);
+
+   for (std::size_t i = 0; i < numPoints; ++i)
+   {
+      p->points_[i] = points[order[i]];
+      p->levels_[i] = levels[order[i]];
+
+      for (std::size_t level = 0; level <= p->levels_[i]; ++level)
+      {
+         ++p->counts_[level];
+      }
+   }
+
+   return order;
+}
+
+void ClusterIndex::Clear()
+{
+   p->points_.clear();
+   p->levels_.clear();
+   p->counts_.fill(0u);
+}
+
+std::size_t ClusterIndex::count(std::size_t level) const
+{
+   return p->counts_.at(level);
+}
+
+std::vector<std::size_t> ClusterIndex::members(std::size_t index,
+                                               std::size_t level) const
+{
+   if (level == 0)
+   {
+      return {index};
+   }
+
+   const std::uint64_t cellKey = Impl::GetCellKey(p->points_[index], level);
+
+   std::vector<std::size_t> indices {};
+
+   for (std::size_t i = 0; i < p->points_.size(); ++i)
+   {
+      if (Impl::GetCellKey(p->points_[i], level) == cellKey)
+      {
+         indices.push_back(i);
+      }
+   }
+
+   return indices;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
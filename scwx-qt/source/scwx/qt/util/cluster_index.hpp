@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Hierarchical clustering of points in map screen coordinates, using a
+ * pyramid of nested grids. At each cluster level, the points within a grid
+ * cell are represented by the point of highest priority, and each level
+ * doubles the cell size of the level below it. Level 0 does not cluster.
+ *
+ * The representative of a cell is also the representative of the finer cell
+ * containing it. Points are reordered by the coarsest level at which they are
+ * a representative, such that the points drawn at any level are a prefix of
+ * the reordered points.
+ */
+class ClusterIndex
+{
+public:
+   static constexpr std::size_t kLevelCount = 8;
+
+   explicit ClusterIndex();
+   ~ClusterIndex();
+
+   ClusterIndex(const ClusterIndex&)            = delete;
+   ClusterIndex& operator=(const ClusterIndex&) = delete;
+
+   ClusterIndex(ClusterIndex&&) noexcept;
+   ClusterIndex& operator=(ClusterIndex&&) noexcept;
+
+   /**
+    * @brief Gets the cluster level at which clusters are approximately the
+    * same size on screen at the current zoom.
+    *
+    * @param [in] pixelScale Map screen coordinate units per pixel
+    *
+    * @return Cluster level, from 0 (no clustering) to kLevelCount - 1
+    */
+   static std::size_t GetClusterLevel(float pixelScale);
+
+   /**
+    * @brief Rebuilds the index.
+    *
+    * @param [in] points Points in map screen coordinates
+    * @param [in] priorities Priority of each point. The point of highest
+    * priority in a cell represents the cell, and ties are broken by the point
+    * listed first.
+    *
+    * @return Original index of each reordered point. Indices passed to and
+    * returned by the index refer to the reordered points.
+    */
+   std::vector<std::size_t> Build(const std::vector<glm::vec2>&    points,
+                                  const std::vector<std::int64_t>& priorities);
+
+   /**
+    * @brief Removes all points from the index.
+    */
+   void Clear();
+
+   /**
+    * @brief Gets the number of points drawn at a cluster level, which are the
+    * first points in order.
+    *
+    * @param [in] level Cluster level
+    *
+    * @return Number of points
+    */
+   std::size_t count(std::size_t level) const;
+
+   /**
+    * @brief Gets the points represented by a point at a cluster level,
+    * including the point itself.
+    *
+    * @param [in] index Point index, drawn at the cluster level
+    * @param [in] level Cluster level
+    *
+    * @return Point indices in ascending order
+    */
+   std::vector<std::size_t> members(std::size_t index, std::size_t level) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
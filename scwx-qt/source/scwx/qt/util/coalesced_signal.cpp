@@ -0,0 +1,75 @@
+#include <scwx/qt/util/coalesced_signal.hpp>
+
+#include <atomic>
+
+#include <QMetaObject>
+#include <QObject>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::coalesced_signal";
+
+class CoalescedSignal::Impl
+{
+public:
+   explicit Impl(QObject* context, Emitter emitter) :
+       context_ {context}, emitter_ {std::move(emitter)}
+   {
+   }
+   ~Impl() = default;
+
+   QObject* context_;
+   Emitter  emitter_;
+
+   std::atomic<bool>          queued_ {false};
+   std::atomic<std::uint64_t> version_ {0u};
+};
+
+CoalescedSignal::CoalescedSignal(QObject* context, Emitter emitter) :
+    p(std::make_shared<Impl>(context, std::move(emitter)))
+{
+}
+CoalescedSignal::~CoalescedSignal() = default;
+
+std::uint64_t CoalescedSignal::version() const
+{
+   return p->version_;
+}
+
+std::uint64_t CoalescedSignal::Notify()
+{
+   const std::uint64_t version = ++p->version_;
+
+   if (!p->queued_.exchange(true))
+   {
+      // The emission is discarded if the signal is destroyed first
+      std::weak_ptr<Impl> weakImpl {p};
+
+      QMetaObject::invokeMethod(
+         p->context_,
+         [weakImpl]()
+         {
+            auto impl = weakImpl.lock();
+            if (impl == nullptr)
+            {
+               return;
+            }
+
+            // Notifications made while emitting queue a further emission
+            impl->queued_ = false;
+            impl->emitter_();
+         },
+         Qt::QueuedConnection);
+   }
+
+   return version;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+class QObject;
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Coalesces notifications made from any thread into a single emission,
+ * made on the thread of a context object at its next event loop iteration.
+ * Consumers react once to the final state of a burst of notifications, rather
+ * than once per notification.
+ *
+ * Each notification increments a version, such that a consumer reached by
+ * more than one emission can skip those made before it last reacted.
+ */
+class CoalescedSignal
+{
+public:
+   typedef std::function<void()> Emitter;
+
+   /**
+    * @brief Creates a coalesced signal.
+    *
+    * @param [in] context Object on whose thread emissions are made
+    * @param [in] emitter Emits the signal for the pending notifications
+    */
+   explicit CoalescedSignal(QObject* context, Emitter emitter);
+   ~CoalescedSignal();
+
+   CoalescedSignal(const CoalescedSignal&)            = delete;
+   CoalescedSignal& operator=(const CoalescedSignal&) = delete;
+
+   CoalescedSignal(CoalescedSignal&&) noexcept            = delete;
+   CoalescedSignal& operator=(CoalescedSignal&&) noexcept = delete;
+
+   /**
+    * @brief Version of the notified state, incremented by each notification
+    */
+   [[nodiscard]] std::uint64_t version() const;
+
+   /**
+    * @brief Notifies a change, queuing an emission if one is not already
+    * queued. Changes notified before the queued emission is made are emitted
+    * with it.
+    *
+    * @return Version of the notified state
+    */
+   std::uint64_t Notify();
+
+private:
+   class Impl;
+   std::shared_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
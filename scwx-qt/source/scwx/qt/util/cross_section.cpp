@@ -0,0 +1,161 @@
+#include <scwx/qt/util/cross_section.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <limits>
+
+#include <boost/range/irange.hpp>
+#include <GeographicLib/GeodesicLine.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+// Effective earth radius for standard refraction (meters)
+static constexpr double kEffectiveEarthRadius_ = 6371000.0 * 4.0 / 3.0;
+
+// Half of the WSR-88D beam width, rounded up to avoid gaps between adjacent
+// elevations (degrees)
+static constexpr double kHalfBeamWidth_ = 0.5;
+
+double GetBeamHeight(double groundRange, double elevation)
+{
+   // The beam is a straight line over an earth with the effective radius
+   const double theta = elevation * common::kDegreesToRadians;
+   const double phi   = groundRange / kEffectiveEarthRadius_;
+
+   return kEffectiveEarthRadius_ *
+          (std::cos(theta) / std::cos(theta + phi) - 1.0);
+}
+
+CrossSectionGrid
+ComputeCrossSection(const std::vector<CrossSectionElevation>& elevations,
+                    wsr88d::rda::DataBlockType                dataBlockType,
+                    const common::Coordinate&                 start,
+                    const common::Coordinate&                 end,
+                    std::size_t                               columns,
+                    std::size_t                               rows,
+                    double                                    maxHeight)
+{
+   CrossSectionGrid grid {};
+   grid.columns_   = columns;
+   grid.rows_      = rows;
+   grid.maxHeight_ = maxHeight;
+   grid.cells_.resize(columns * rows);
+
+   const ::GeographicLib::GeodesicLine line =
+      GeographicLib::DefaultGeodesic().InverseLine(start.latitude_,
+                                                   start.longitude_,
+                                                   end.latitude_,
+                                                   end.longitude_);
+   grid.distance_ = line.Distance();
+
+   if (columns == 0 || rows == 0 || elevations.empty())
+   {
+      return grid;
+   }
+
+   // Sample each column at its center
+   std::vector<common::Coordinate> points(columns);
+   for (std::size_t column = 0; column < columns; ++column)
+   {
+      line.Position(grid.distance_ * (static_cast<double>(column) + 0.5) /
+                       static_cast<double>(columns),
+                    points[column].latitude_,
+                    points[column].longitude_);
+   }
+
+   // Sample every elevation along the line
+   std::vector<std::vector<ElevationScanInspector::Sample>> samples(
+      elevations.size());
+   for (std::size_t i = 0; i < elevations.size(); ++i)
+   {
+      if (elevations[i].inspector_ != nullptr)
+      {
+         samples[i] = elevations[i].inspector_->Query(points);
+      }
+   }
+
+   struct Beam
+   {
+      double bottom_;
+      double center_;
+      double top_;
+
+      const std::optional<ElevationScanInspector::MomentValue>* moment_;
+   };
+
+   const auto columnRange = boost::irange<std::size_t>(0u, columns);
+
+   std::for_each(
+      std::execution::par_unseq,
+      columnRange.begin(),
+      columnRange.end(),
+      [&](std::size_t column)
+      {
+         // Find the extent of each beam with data at the column
+         std::vector<Beam> beams {};
+         beams.reserve(elevations.size());
+
+         for (std::size_t i = 0; i < elevations.size(); ++i)
+         {
+            if (samples[i].empty())
+            {
+               continue;
+            }
+
+            const ElevationScanInspector::Sample& sample = samples[i][column];
+
+            const auto&  moment = sample.moment(dataBlockType);
+            const double angle  = elevations[i].angle_;
+
+            if (moment.has_value())
+            {
+               beams.push_back(
+                  {GetBeamHeight(sample.range_, angle - kHalfBeamWidth_),
+                   GetBeamHeight(sample.range_, angle),
+                   GetBeamHeight(sample.range_, angle + kHalfBeamWidth_),
+                   &moment});
+            }
+         }
+
+         for (std::size_t row = 0; row < rows && !beams.empty(); ++row)
+         {
+            const double height = maxHeight *
+                                  (static_cast<double>(rows - row) - 0.5) /
+                                  static_cast<double>(rows);
+
+            // Where beams overlap, use the beam centered closest to the cell
+            const Beam* closestBeam     = nullptr;
+            double      closestDistance = std::numeric_limits<double>::max();
+
+            for (const Beam& beam : beams)
+            {
+               const double distance = std::abs(beam.center_ - height);
+
+               if (height >= beam.bottom_ && height <= beam.top_ &&
+                   distance < closestDistance)
+               {
+                  closestBeam     = &beam;
+                  closestDistance = distance;
+               }
+            }
+
+            if (closestBeam != nullptr)
+            {
+               grid.cells_[row * columns + column] = *closestBeam->moment_;
+            }
+         }
+      });
+
+   return grid;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <scwx/qt/util/elevation_scan_inspector.hpp>
+#include <scwx/common/geographic.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+struct CrossSectionElevation
+{
+   float                                         angle_ {}; // Degrees
+   std::shared_ptr<const ElevationScanInspector> inspector_ {};
+};
+
+struct CrossSectionGrid
+{
+   std::size_t columns_ {};
+   std::size_t rows_ {};
+   double      distance_ {};  // Length of the line (meters)
+   double      maxHeight_ {}; // Height above the radar of the top row (meters)
+
+   // Row-major, beginning with the top row
+   std::vector<std::optional<ElevationScanInspector::MomentValue>> cells_ {};
+
+   const std::optional<ElevationScanInspector::MomentValue>&
+   cell(std::size_t column, std::size_t row) const
+   {
+      return cells_[row * columns_ + column];
+   }
+};
+
+/**
+ * Get the height of a radar beam above the radar, using the 4/3 effective
+ * earth radius model of standard refraction.
+ *
+ * @param [in] groundRange Distance along the ground from the radar (meters)
+ * @param [in] elevation Elevation angle of the beam (degrees)
+ *
+ * @return Height above the radar (meters)
+ */
+double GetBeamHeight(double groundRange, double elevation);
+
+/**
+ * Sample a vertical cross section of a volume between two points. Each column
+ * is sampled from every elevation at the center of the column, and each cell
+ * takes the moment of the elevation whose beam covers the height of the cell.
+ * Cells between beams, or above the highest beam, are empty.
+ *
+ * @param [in] elevations Elevation scans of the volume
+ * @param [in] dataBlockType Moment to sample
+ * @param [in] start Start of the line
+ * @param [in] end End of the line
+ * @param [in] columns Number of columns along the line
+ * @param [in] rows Number of rows from the radar to the maximum height
+ * @param [in] maxHeight Height above the radar of the top row (meters)
+ *
+ * @return Cross section grid
+ */
+CrossSectionGrid
+ComputeCrossSection(const std::vector<CrossSectionElevation>& elevations,
+                    wsr88d::rda::DataBlockType                dataBlockType,
+                    const common::Coordinate&                 start,
+                    const common::Coordinate&                 end,
+                    std::size_t                               columns,
+                    std::size_t                               rows,
+                    double                                    maxHeight);
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
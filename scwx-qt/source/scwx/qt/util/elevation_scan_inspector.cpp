@@ -0,0 +1,373 @@
+#include <scwx/qt/util/elevation_scan_inspector.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/common/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+
+#include <boost/range/irange.hpp>
+#include <GeographicLib/GeodesicLine.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static constexpr std::uint16_t kRangeFolded_ = 1u;
+
+// Lowest data level, below which levels are codes
+static constexpr std::int16_t kMinThreshold_ = 2;
+
+// Clutter filter power removed levels below 8 are codes
+static constexpr std::uint16_t kCfpThreshold_ = 8u;
+
+// Assume the data is incomplete when the delta between the first and last
+// angles is greater than 2.5 degrees
+static constexpr units::degrees<float> kIncompleteDataAngleThreshold_ {2.5f};
+
+class ElevationScanInspector::Impl
+{
+public:
+   explicit Impl(std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan,
+                 const common::Coordinate&                   radarSite) :
+       elevationScan_ {std::move(elevationScan)}, radarSite_ {radarSite}
+   {
+      if (elevationScan_ != nullptr && !elevationScan_->empty())
+      {
+         azimuthIndex_.Build(GetRadials(*elevationScan_));
+      }
+   }
+   ~Impl() = default;
+
+   Sample GetSample(const common::Coordinate& coordinate,
+                    double                    distance) const;
+
+   static std::optional<MomentValue>
+   GetMomentValue(wsr88d::rda::DataBlockType dataBlockType,
+                  const wsr88d::rda::GenericRadarData::MomentDataBlock& block,
+                  double range);
+
+   std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan_;
+   common::Coordinate                          radarSite_;
+
+   AzimuthIndex azimuthIndex_ {};
+};
+
+ElevationScanInspector::ElevationScanInspector(
+   std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan,
+   const common::Coordinate&                   radarSite) :
+    p(std::make_unique<Impl>(std::move(elevationScan), radarSite))
+{
+}
+ElevationScanInspector::~ElevationScanInspector() = default;
+
+ElevationScanInspector::ElevationScanInspector(
+   ElevationScanInspector&&) noexcept = default;
+ElevationScanInspector&
+ElevationScanInspector::operator=(ElevationScanInspector&&) noexcept = default;
+
+const std::optional<ElevationScanInspector::MomentValue>&
+ElevationScanInspector::Sample::moment(
+   wsr88d::rda::DataBlockType dataBlockType) const
+{
+   static const std::optional<MomentValue> kNoMoment_ {};
+
+   const std::size_t index = MomentIndex(dataBlockType);
+   return (index < kMomentCount) ? moments_[index] : kNoMoment_;
+}
+
+std::size_t
+ElevationScanInspector::MomentIndex(wsr88d::rda::DataBlockType dataBlockType)
+{
+   const auto first =
+      static_cast<std::size_t>(wsr88d::rda::DataBlockType::MomentRef);
+   const auto type = static_cast<std::size_t>(dataBlockType);
+
+   return (type >= first && type - first < kMomentCount) ? type - first :
+                                                           kMomentCount;
+}
+
+std::vector<ElevationScanInspector::Sample> ElevationScanInspector::Query(
+   const std::vector<common::Coordinate>& points) const
+{
+   std::vector<Sample> samples(points.size());
+
+   std::transform(std::execution::par_unseq,
+                  points.cbegin(),
+                  points.cend(),
+                  samples.begin(),
+                  [this](const common::Coordinate& coordinate)
+                  { return p->GetSample(coordinate, 0.0); });
+
+   return samples;
+}
+
+std::vector<ElevationScanInspector::Sample>
+ElevationScanInspector::QueryPolyline(
+   const std::vector<common::Coordinate>& vertices, double spacing) const
+{
+   const ::GeographicLib::Geodesic& geodesic = GeographicLib::DefaultGeodesic();
+
+   std::vector<common::Coordinate> points {};
+   std::vector<double>             distances {};
+   double                          polylineDistance = 0.0;
+
+   // Divide each segment into even steps no longer than the spacing
+   for (std::size_t i = 0; i + 1 < vertices.size(); ++i)
+   {
+      const ::GeographicLib::GeodesicLine line =
+         geodesic.InverseLine(vertices[i].latitude_,
+                              vertices[i].longitude_,
+                              vertices[i + 1].latitude_,
+                              vertices[i + 1].longitude_);
+
+      const double segmentDistance = line.Distance();
+      const auto   steps           = std::max<std::size_t>(
+         1u,
+         static_cast<std::size_t>(
+            std::ceil(segmentDistance / std::max(spacing, 1.0))));
+
+      for (std::size_t step = 0; step < steps; ++step)
+      {
+         const double distance = segmentDistance *
+                                 static_cast<double>(step) /
+                                 static_cast<double>(steps);
+
+         double latitude;
+         double longitude;
+         line.Position(distance, latitude, longitude);
+
+         points.emplace_back(latitude, longitude);
+         distances.push_back(polylineDistance + distance);
+      }
+
+      polylineDistance += segmentDistance;
+   }
+
+   if (!vertices.empty())
+   {
+      points.push_back(vertices.back());
+      distances.push_back(polylineDistance);
+   }
+
+   std::vector<Sample> samples(points.size());
+
+   const auto indices = boost::irange<std::size_t>(0u, points.size());
+   std::for_each(std::execution::par_unseq,
+                 indices.begin(),
+                 indices.end(),
+                 [&](std::size_t i)
+                 { samples[i] = p->GetSample(points[i], distances[i]); });
+
+   return samples;
+}
+
+ElevationScanInspector::Sample
+ElevationScanInspector::Impl::GetSample(const common::Coordinate& coordinate,
+                                        double distance) const
+{
+   Sample sample {};
+   sample.coordinate_ = coordinate;
+   sample.distance_   = distance;
+
+   // Determine distance and azimuth of coordinate relative to radar location
+   double azi2; // Unused
+   GeographicLib::DefaultGeodesic().Inverse(radarSite_.latitude_,
+                                            radarSite_.longitude_,
+                                            coordinate.latitude_,
+                                            coordinate.longitude_,
+                                            sample.range_,
+                                            sample.azimuth_,
+                                            azi2);
+
+   if (std::isnan(sample.azimuth_))
+   {
+      // If a problem occurred with the geodesic inverse calculation
+      return sample;
+   }
+
+   // Azimuth is returned as [-180, 180) from the geodesic inverse
+   if (sample.azimuth_ < 0.0)
+   {
+      sample.azimuth_ += 360.0;
+   }
+
+   sample.radial_ = azimuthIndex_.Find(sample.azimuth_);
+   if (!sample.radial_.has_value())
+   {
+      return sample;
+   }
+
+   auto radialData = elevationScan_->find(*sample.radial_);
+   if (radialData == elevationScan_->cend())
+   {
+      return sample;
+   }
+
+   for (auto dataBlockType : wsr88d::rda::MomentDataBlockTypeIterator())
+   {
+      auto block = radialData->second->moment_data_block(dataBlockType);
+      if (block != nullptr)
+      {
+         sample.moments_[MomentIndex(dataBlockType)] =
+            GetMomentValue(dataBlockType, *block, sample.range_);
+      }
+   }
+
+   return sample;
+}
+
+std::optional<ElevationScanInspector::MomentValue>
+ElevationScanInspector::Impl::GetMomentValue(
+   wsr88d::rda::DataBlockType                            dataBlockType,
+   const wsr88d::rda::GenericRadarData::MomentDataBlock& block,
+   double                                                range)
+{
+   // The data moment range is to the center of the first gate
+   const double interval = block.data_moment_range_sample_interval_raw();
+   const double firstGateRange =
+      block.data_moment_range_raw() - std::floor(interval / 2.0);
+
+   if (interval <= 0.0 || range < firstGateRange)
+   {
+      return std::nullopt;
+   }
+
+   const auto gate =
+      static_cast<std::size_t>((range - firstGateRange) / interval);
+
+   if (gate >= block.number_of_data_moment_gates())
+   {
+      // Coordinate is beyond radar range
+      return std::nullopt;
+   }
+
+   std::uint16_t level;
+   if (block.data_word_size() == 8)
+   {
+      level = static_cast<const std::uint8_t*>(block.data_moments())[gate];
+   }
+   else
+   {
+      level = static_cast<const std::uint16_t*>(block.data_moments())[gate];
+   }
+
+   if (level == kRangeFolded_)
+   {
+      return MomentValue {level, std::nullopt};
+   }
+
+   // Compute threshold at which to display an individual bin
+   const auto snrThreshold = static_cast<std::uint16_t>(
+      std::max<std::int16_t>(kMinThreshold_, block.snr_threshold_raw()));
+
+   if (level < snrThreshold)
+   {
+      return std::nullopt;
+   }
+
+   MomentValue value {level, std::nullopt};
+
+   if ((dataBlockType != wsr88d::rda::DataBlockType::MomentCfp ||
+        level >= kCfpThreshold_) &&
+       block.scale() != 0.0f)
+   {
+      value.value_ = (level - block.offset()) / block.scale();
+   }
+
+   return value;
+}
+
+std::map<std::uint16_t, std::shared_ptr<const ElevationScanInspector>>
+ElevationScanInspector::CreateVolume(const wsr88d::Ar2vFile&   file,
+                                     const common::Coordinate& radarSite)
+{
+   std::map<std::uint16_t, std::shared_ptr<const ElevationScanInspector>>
+      inspectors {};
+
+   for (auto& [elevationIndex, elevationScan] : file.radar_data())
+   {
+      inspectors.emplace(elevationIndex,
+                         std::make_shared<const ElevationScanInspector>(
+                            elevationScan, radarSite));
+   }
+
+   return inspectors;
+}
+
+std::vector<AzimuthIndex::Radial> ElevationScanInspector::GetRadials(
+   const wsr88d::rda::ElevationScan& elevationScan)
+{
+   if (elevationScan.empty())
+   {
+      return {};
+   }
+
+   std::uint16_t numRadials =
+      static_cast<std::uint16_t>(elevationScan.crbegin()->first + 1);
+
+   // Add an extra radial when incomplete data exists
+   const units::degrees<float> angleDelta =
+      common::GetAngleDelta(elevationScan.cbegin()->second->azimuth_angle(),
+                            elevationScan.crbegin()->second->azimuth_angle());
+   if (angleDelta > kIncompleteDataAngleThreshold_)
+   {
+      ++numRadials;
+   }
+
+   // Limit radials
+   numRadials =
+      std::min<std::uint16_t>(numRadials, common::MAX_0_5_DEGREE_RADIALS);
+
+   std::vector<AzimuthIndex::Radial> radials {};
+   radials.reserve(numRadials);
+
+   for (std::uint16_t i = 0; i < numRadials; ++i)
+   {
+      auto radialData = elevationScan.find(i);
+      if (radialData == elevationScan.cend())
+      {
+         continue;
+      }
+
+      const units::degrees<float> startAngle =
+         radialData->second->azimuth_angle();
+      units::degrees<float> nextAngle {};
+
+      auto nextRadial = elevationScan.find((i + 1) % numRadials);
+      if (nextRadial != elevationScan.cend())
+      {
+         nextAngle = nextRadial->second->azimuth_angle();
+      }
+      else
+      {
+         // Next angle is not available, interpolate
+         auto prevRadial =
+            elevationScan.find((i >= 1) ? i - 1 : numRadials - (1 - i));
+
+         if (prevRadial == elevationScan.cend())
+         {
+            continue;
+         }
+
+         const units::degrees<float> prevAngle =
+            prevRadial->second->azimuth_angle();
+
+         const units::degrees<float> deltaAngle =
+            common::GetAngleDelta(startAngle, prevAngle);
+
+         nextAngle = startAngle + deltaAngle;
+      }
+
+      radials.push_back({i, startAngle.value(), nextAngle.value()});
+   }
+
+   return radials;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
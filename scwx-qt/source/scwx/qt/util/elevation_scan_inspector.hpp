@@ -0,0 +1,135 @@
+#pragma once
+
+#include <scwx/qt/util/azimuth_index.hpp>
+#include <scwx/common/geographic.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/rda/generic_radar_data.hpp>
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Reads every data moment of a Level 2 elevation scan at geographic
+ * points, such as for cursor readouts, point time series and cross sections.
+ * Radials are found with an azimuth index built when the inspector is created,
+ * and points are sampled in parallel.
+ */
+class ElevationScanInspector
+{
+public:
+   // Reflectivity through clutter filter power removed
+   static constexpr std::size_t kMomentCount = 7;
+
+   struct MomentValue
+   {
+      std::uint16_t        level_; // Data level, or 1 if range folded
+      std::optional<float> value_; // Value, unless the level is a code
+   };
+
+   struct Sample
+   {
+      common::Coordinate coordinate_ {};
+      double             distance_ {}; // Distance along a polyline (meters)
+      double             range_ {};    // Distance from the radar (meters)
+      double             azimuth_ {};  // Azimuth from the radar [0, 360)
+
+      std::optional<std::uint16_t> radial_ {}; // Radial index, if found
+
+      // Moments above threshold, by MomentIndex()
+      std::array<std::optional<MomentValue>, kMomentCount> moments_ {};
+
+      const std::optional<MomentValue>&
+      moment(wsr88d::rda::DataBlockType dataBlockType) const;
+   };
+
+   /**
+    * @param [in] elevationScan Elevation scan. Radials added after the
+    * inspector is created are not found.
+    * @param [in] radarSite Radar site location
+    */
+   explicit ElevationScanInspector(
+      std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan,
+      const common::Coordinate&                   radarSite);
+   ~ElevationScanInspector();
+
+   ElevationScanInspector(const ElevationScanInspector&)            = delete;
+   ElevationScanInspector& operator=(const ElevationScanInspector&) = delete;
+
+   ElevationScanInspector(ElevationScanInspector&&) noexcept;
+   ElevationScanInspector& operator=(ElevationScanInspector&&) noexcept;
+
+   /**
+    * @brief Samples the elevation scan at each point.
+    *
+    * @param [in] points Points to sample
+    *
+    * @return One sample for each point
+    */
+   std::vector<Sample>
+   Query(const std::vector<common::Coordinate>& points) const;
+
+   /**
+    * @brief Samples the elevation scan at even spacing along the geodesics
+    * between each pair of vertices, including both ends.
+    *
+    * @param [in] vertices Polyline vertices
+    * @param [in] spacing Largest distance between samples (meters)
+    *
+    * @return Samples in order along the polyline
+    */
+   std::vector<Sample>
+   QueryPolyline(const std::vector<common::Coordinate>& vertices,
+                 double                                 spacing) const;
+
+   /**
+    * @brief Creates an inspector for each elevation scan of a volume.
+    *
+    * @param [in] file Level 2 volume
+    * @param [in] radarSite Radar site location
+    *
+    * @return Inspectors by elevation index
+    */
+   static std::map<std::uint16_t, std::shared_ptr<const ElevationScanInspector>>
+   CreateVolume(const wsr88d::Ar2vFile&   file,
+                const common::Coordinate& radarSite);
+
+   /**
+    * @brief Gets the azimuths covered by each radial of an elevation scan.
+    * Each radial extends to the start of the next radial. If the scan is
+    * incomplete, the last radial is as wide as the radial before it.
+    *
+    * @param [in] elevationScan Elevation scan
+    *
+    * @return Radials for an azimuth index
+    */
+   static std::vector<AzimuthIndex::Radial>
+   GetRadials(const wsr88d::rda::ElevationScan& elevationScan);
+
+   /**
+    * @brief Gets the index of a moment within Sample::moments_.
+    *
+    * @param [in] dataBlockType Moment data block type
+    *
+    * @return Moment index, or kMomentCount if not a moment
+    */
+   static std::size_t MomentIndex(wsr88d::rda::DataBlockType dataBlockType);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -1,6 +1,8 @@
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <numbers>
 
 #include <GeographicLib/Gnomonic.hpp>
@@ -21,6 +23,20 @@ namespace GeographicLib
 static const std::string logPrefix_ = "scwx::qt::util::geographic_lib";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Shortest distance covered by one degree of latitude, such that distance
+// bounds are never too small
+static constexpr double kMinMetersPerDegree_ = 110000.0;
+
+static constexpr double kDegreesToRadians_ = std::numbers::pi / 180.0;
+static constexpr double kRadiansToDegrees_ = 180.0 / std::numbers::pi;
+
+// Iterations of Vincenty's direct formula. Two iterations converge to within a
+// few centimeters at radar ranges.
+static constexpr int kRadialIterations_ = 2;
+
+// Largest difference from Geodesic::Direct for approximated points (meters)
+static constexpr double kRadialTolerance_ = 0.1;
+
 const ::GeographicLib::Geodesic& DefaultGeodesic()
 {
    static const ::GeographicLib::Geodesic geodesic_ {
@@ -111,7 +127,7 @@ bool AreaContainsPoint(const std::vector<common::Coordinate>& area,
       }
       catch (const std::exception&)
       {
-         logger_->trace("Invalid area sequence");
+         SPDLOG_LOGGER_TRACE(logger_, "Invalid area sequence");
       }
    }
 
@@ -170,6 +186,173 @@ common::Coordinate GetCoordinate(const common::Coordinate& center,
    return {latitude, longitude};
 }
 
+RadialGeodesic::RadialGeodesic(double latitude,
+                               double longitude,
+                               double azimuth) :
+    longitude_ {longitude}
+{
+   const ::GeographicLib::Geodesic& geodesic = DefaultGeodesic();
+
+   const double a = geodesic.EquatorialRadius();
+   const double f = geodesic.Flattening();
+   const double b = a * (1.0 - f);
+
+   const double alpha1 = azimuth * kDegreesToRadians_;
+   const double tanU1  = (1.0 - f) * std::tan(latitude * kDegreesToRadians_);
+
+   cosU1_     = 1.0 / std::sqrt(1.0 + tanU1 * tanU1);
+   sinU1_     = tanU1 * cosU1_;
+   sinAlpha1_ = std::sin(alpha1);
+   cosAlpha1_ = std::cos(alpha1);
+   sigma1_    = std::atan2(tanU1, cosAlpha1_);
+   sinAlpha_  = cosU1_ * sinAlpha1_;
+
+   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Series coefficients
+   const double cos2Alpha = 1.0 - sinAlpha_ * sinAlpha_;
+   const double u2        = cos2Alpha * (a * a - b * b) / (b * b);
+   const double bigA =
+      1.0 + u2 / 16384.0 * (4096.0 + u2 * (-768.0 + u2 * (320.0 - 175.0 * u2)));
+
+   b_ = u2 / 1024.0 * (256.0 + u2 * (-128.0 + u2 * (74.0 - 47.0 * u2)));
+   c_ = f / 16.0 * cos2Alpha * (4.0 + f * (4.0 - 3.0 * cos2Alpha));
+   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+
+   sigmaScale_ = 1.0 / (b * bigA);
+   flattening_ = f;
+}
+
+void RadialGeodesic::Position(double  distance,
+                              double& latitude,
+                              double& longitude) const
+{
+   // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers): Series coefficients
+   const double sigma0 = distance * sigmaScale_;
+   double       sigma  = sigma0;
+
+   for (int i = 0; i < kRadialIterations_; ++i)
+   {
+      const double cos2SigmaM  = std::cos(2.0 * sigma1_ + sigma);
+      const double sinSigma    = std::sin(sigma);
+      const double cosSigma    = std::cos(sigma);
+      const double cos2SigmaM2 = cos2SigmaM * cos2SigmaM;
+
+      sigma = sigma0 +
+              b_ * sinSigma *
+                 (cos2SigmaM +
+                  b_ / 4.0 *
+                     (cosSigma * (-1.0 + 2.0 * cos2SigmaM2) -
+                      b_ / 6.0 * cos2SigmaM *
+                         (-3.0 + 4.0 * sinSigma * sinSigma) *
+                         (-3.0 + 4.0 * cos2SigmaM2)));
+   }
+
+   const double cos2SigmaM = std::cos(2.0 * sigma1_ + sigma);
+   const double sinSigma   = std::sin(sigma);
+   const double cosSigma   = std::cos(sigma);
+
+   const double x = sinU1_ * sinSigma - cosU1_ * cosSigma * cosAlpha1_;
+   const double y =
+      (1.0 - flattening_) * std::sqrt(sinAlpha_ * sinAlpha_ + x * x);
+   const double phi2 =
+      std::atan2(sinU1_ * cosSigma + cosU1_ * sinSigma * cosAlpha1_, y);
+   const double lambda =
+      std::atan2(sinSigma * sinAlpha1_,
+                 cosU1_ * cosSigma - sinU1_ * sinSigma * cosAlpha1_);
+   const double l =
+      lambda - (1.0 - c_) * flattening_ * sinAlpha_ *
+                  (sigma + c_ * sinSigma *
+                              (cos2SigmaM + c_ * cosSigma *
+                                               (-1.0 + 2.0 * cos2SigmaM *
+                                                          cos2SigmaM)));
+   // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+
+   latitude  = phi2 * kRadiansToDegrees_;
+   longitude = std::remainder(longitude_ + l * kRadiansToDegrees_, 360.0);
+}
+
+void RadialGeodesic::Positions(double      distance,
+                               double      step,
+                               std::size_t count,
+                               float*      coordinates) const
+{
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      double latitude;
+      double longitude;
+
+      Position(distance + static_cast<double>(i) * step, latitude, longitude);
+
+      coordinates[i * 2]     = static_cast<float>(latitude);
+      coordinates[i * 2 + 1] = static_cast<float>(longitude);
+   }
+}
+
+double
+RadialGeodesic::MaxError(double latitude, double longitude, double distance)
+{
+   const ::GeographicLib::Geodesic& geodesic = DefaultGeodesic();
+
+   double maxError = 0.0;
+
+   for (double azimuth = 0.0; azimuth < 360.0; azimuth += 45.0)
+   {
+      const RadialGeodesic radial {latitude, longitude, azimuth};
+
+      for (double d : {distance / 2.0, distance})
+      {
+         double exactLatitude;
+         double exactLongitude;
+         double latitude2;
+         double longitude2;
+         double error;
+
+         geodesic.Direct(
+            latitude, longitude, azimuth, d, exactLatitude, exactLongitude);
+         radial.Position(d, latitude2, longitude2);
+         geodesic.Inverse(
+            exactLatitude, exactLongitude, latitude2, longitude2, error);
+
+         maxError = std::max(maxError, error);
+      }
+   }
+
+   return maxError;
+}
+
+bool RadialGeodesic::IsAccurate(double latitude,
+                                double longitude,
+                                double distance)
+{
+   const double maxError = MaxError(latitude, longitude, distance);
+
+   if (maxError > kRadialTolerance_)
+   {
+      logger_->warn("Radial approximation error of {:.3f} m at {}, {}",
+                    maxError,
+                    latitude,
+                    longitude);
+      return false;
+   }
+
+   return true;
+}
+
+std::pair<double, double>
+GetDistanceBounds(const common::Coordinate&           point,
+                  const units::length::meters<double> distance)
+{
+   const double latDelta = distance.value() / kMinMetersPerDegree_;
+
+   // A degree of longitude is shortest at the latitude farthest from the
+   // equator within the bounds
+   const double maxLat = std::min(std::abs(point.latitude_) + latDelta, 90.0);
+   const double cosMaxLat = std::cos(maxLat * std::numbers::pi / 180.0);
+   const double lonDelta =
+      (cosMaxLat > 0.0) ? std::min(latDelta / cosMaxLat, 180.0) : 180.0;
+
+   return {latDelta, lonDelta};
+}
+
 units::length::meters<double>
 GetDistance(double lat1, double lon1, double lat2, double lon2)
 {
@@ -286,7 +469,44 @@ bool AreaInRangeOfPoint(const std::vector<common::Coordinate>& area,
                         const common::Coordinate&              point,
                         const units::length::meters<double>    distance)
 {
-    return GetDistanceAreaPoint(area, point) <= distance;
+   if (area.empty())
+   {
+      return false;
+   }
+
+   // Reject areas whose bounding box is outside of the distance bounds of the
+   // point before projecting the area, as most areas are far from the point
+   auto [latDelta, lonDelta] = GetDistanceBounds(point, distance);
+
+   double minLat = area.front().latitude_;
+   double maxLat = minLat;
+   double minLon = area.front().longitude_;
+   double maxLon = minLon;
+
+   for (auto& coordinate : area)
+   {
+      minLat = std::min(minLat, coordinate.latitude_);
+      maxLat = std::max(maxLat, coordinate.latitude_);
+      minLon = std::min(minLon, coordinate.longitude_);
+      maxLon = std::max(maxLon, coordinate.longitude_);
+   }
+
+   if (point.latitude_ + latDelta < minLat ||
+       point.latitude_ - latDelta > maxLat)
+   {
+      return false;
+   }
+
+   // Longitude bounds are not compared if they cross the antimeridian
+   if (point.longitude_ - lonDelta >= -180.0 &&
+       point.longitude_ + lonDelta <= 180.0 &&
+       (point.longitude_ + lonDelta < minLon ||
+        point.longitude_ - lonDelta > maxLon))
+   {
+      return false;
+   }
+
+   return GetDistanceAreaPoint(area, point) <= distance;
 }
 
 } // namespace GeographicLib
@@ -2,6 +2,8 @@
 
 #include <scwx/common/geographic.hpp>
 
+#include <cstddef>
+#include <utility>
 #include <vector>
 
 #include <GeographicLib/Geodesic.hpp>
@@ -90,6 +92,21 @@ common::Coordinate GetCoordinate(const common::Coordinate& center,
 units::length::meters<double>
 GetDistance(double lat1, double lon1, double lat2, double lon2);
 
+/**
+ * Get the latitude and longitude offsets from a point which bound every point
+ * within a distance of it. The offsets are conservative, such that a point
+ * outside of the bounds is never within the distance of the center point.
+ *
+ * @param [in] point The center point
+ * @param [in] distance The distance in meters
+ *
+ * @return latitude and longitude offsets (degrees). The longitude offset is
+ * 180 degrees if the distance reaches a pole.
+ */
+std::pair<double, double>
+GetDistanceBounds(const common::Coordinate&           point,
+                  const units::length::meters<double> distance);
+
 /**
  * Get the distance from an area to a point. If the area is less than a quarter
  * radius of the Earth away, this is the closest distance between the area and
@@ -109,7 +126,9 @@ GetDistanceAreaPoint(const std::vector<common::Coordinate>& area,
  * Determine if an area/ring, oriented in either direction, is within a
  * distance of a point. A point lying on the area boundary is considered to be
  * inside the area, and thus always in range. Any part of the area being inside
- * the radius counts as inside. Uses GetDistanceAreaPoint to get the distance.
+ * the radius counts as inside. Areas outside of the distance bounds of the
+ * point are rejected without projecting the area. Otherwise, uses
+ * GetDistanceAreaPoint to get the distance.
  *
  * @param [in] area A vector of Coordinates representing the area
  * @param [in] point The point to check against the area
@@ -121,6 +140,85 @@ bool AreaInRangeOfPoint(const std::vector<common::Coordinate>& area,
                         const common::Coordinate&              point,
                         const units::length::meters<double>    distance);
 
+/**
+ * Computes points along a geodesic from an origin at a fixed azimuth, such as
+ * the gates of a radar radial. Uses Vincenty's direct formula with a fixed
+ * number of iterations, so each point is computed without branching once the
+ * azimuth has been set up. Within 600 km of the origin, points are within a
+ * few centimeters of Geodesic::Direct.
+ */
+class RadialGeodesic
+{
+public:
+   /**
+    * @param [in] latitude Origin latitude (degrees)
+    * @param [in] longitude Origin longitude (degrees)
+    * @param [in] azimuth Azimuth at the origin (degrees)
+    */
+   explicit RadialGeodesic(double latitude, double longitude, double azimuth);
+
+   /**
+    * Get the point at a distance along the geodesic.
+    *
+    * @param [in] distance Distance from the origin (meters)
+    * @param [out] latitude Latitude of the point (degrees)
+    * @param [out] longitude Longitude of the point (degrees)
+    */
+   void Position(double distance, double& latitude, double& longitude) const;
+
+   /**
+    * Get points at evenly spaced distances along the geodesic.
+    *
+    * @param [in] distance Distance of the first point from the origin (meters)
+    * @param [in] step Distance between points (meters)
+    * @param [in] count Number of points
+    * @param [out] coordinates Latitude/longitude pairs (degrees), of size
+    * count * 2
+    */
+   void Positions(double      distance,
+                  double      step,
+                  std::size_t count,
+                  float*      coordinates) const;
+
+   /**
+    * Get the largest difference between the approximated points and
+    * Geodesic::Direct, sampled in each principal direction up to a distance
+    * from the origin.
+    *
+    * @param [in] latitude Origin latitude (degrees)
+    * @param [in] longitude Origin longitude (degrees)
+    * @param [in] distance Maximum distance from the origin (meters)
+    *
+    * @return Largest difference (meters)
+    */
+   static double MaxError(double latitude, double longitude, double distance);
+
+   /**
+    * Determine if approximated points are within a tenth of a meter of
+    * Geodesic::Direct up to a distance from the origin.
+    *
+    * @param [in] latitude Origin latitude (degrees)
+    * @param [in] longitude Origin longitude (degrees)
+    * @param [in] distance Maximum distance from the origin (meters)
+    *
+    * @return true if points may be approximated
+    */
+   static bool IsAccurate(double latitude, double longitude, double distance);
+
+private:
+   double longitude_;    // Origin longitude (degrees)
+   double sinU1_;        // Reduced latitude of the origin
+   double cosU1_;        //
+   double sinAlpha1_;    // Azimuth at the origin
+   double cosAlpha1_;    //
+   double sigma1_;       // Arc from the equator to the origin
+   double sinAlpha_;     // Azimuth at the equator
+   double sigmaScale_;   // Arc length per meter (1 / bA)
+   double b_;            // Vincenty's B
+   double c_;            // Vincenty's C
+   double flattening_;   // Ellipsoid flattening
+};
+
 } // namespace GeographicLib
 } // namespace util
 } // namespace qt
@@ -0,0 +1,125 @@
+#include <scwx/qt/util/line_simplification.hpp>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <utility>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+// Tolerance of each level of detail in map screen coordinates. A level is used
+// once its tolerance is less than half a pixel, which is near zoom 7, 5 and 3.
+static constexpr std::array<float, kLevelOfDetailCount> kTolerance_ {
+   0.0f, 0.0025f, 0.01f, 0.04f};
+
+static constexpr float kMaxTolerancePixels_ = 0.5f;
+
+static float DistanceToSegment(const glm::vec2& point,
+                               const glm::vec2& a,
+                               const glm::vec2& b);
+
+std::size_t GetLevelOfDetail(float pixelScale)
+{
+   const float maxTolerance = pixelScale * kMaxTolerancePixels_;
+
+   std::size_t level = 0;
+   while (level + 1 < kLevelOfDetailCount &&
+          kTolerance_[level + 1] <= maxTolerance)
+   {
+      ++level;
+   }
+
+   return level;
+}
+
+float GetLevelOfDetailTolerance(std::size_t level)
+{
+   return kTolerance_.at(level);
+}
+
+std::vector<std::size_t> SimplifyLine(const std::vector<glm::vec2>& points,
+                                      float                         tolerance)
+{
+   std::vector<std::size_t> indices {};
+
+   if (points.size() <= 2 || tolerance <= 0.0f)
+   {
+      indices.resize(points.size());
+      std::iota(indices.begin(), indices.end(), std::size_t {0});
+      return indices;
+   }
+
+   std::vector<bool> retained(points.size(), false);
+   retained.front() = true;
+   retained.back()  = true;
+
+   // Segments remaining to be simplified, avoiding recursion on long lines
+   std::vector<std::pair<std::size_t, std::size_t>> segments {
+      {0, points.size() - 1}};
+
+   while (!segments.empty())
+   {
+      const auto [first, last] = segments.back();
+      segments.pop_back();
+
+      float       maxDistance = 0.0f;
+      std::size_t maxIndex    = first;
+
+      for (std::size_t i = first + 1; i < last; ++i)
+      {
+         const float distance =
+            DistanceToSegment(points[i], points[first], points[last]);
+         if (distance > maxDistance)
+         {
+            maxDistance = distance;
+            maxIndex    = i;
+         }
+      }
+
+      // Keep the farthest vertex and simplify each side of it
+      if (maxDistance > tolerance)
+      {
+         retained[maxIndex] = true;
+         segments.emplace_back(first, maxIndex);
+         segments.emplace_back(maxIndex, last);
+      }
+   }
+
+   for (std::size_t i = 0; i < points.size(); ++i)
+   {
+      if (retained[i])
+      {
+         indices.push_back(i);
+      }
+   }
+
+   return indices;
+}
+
+static float DistanceToSegment(const glm::vec2& point,
+                               const glm::vec2& a,
+                               const glm::vec2& b)
+{
+   const glm::vec2 ab            = b - a;
+   const float     lengthSquared = glm::dot(ab, ab);
+
+   // The first and last vertices of a closed line are the same
+   if (lengthSquared == 0.0f)
+   {
+      return glm::distance(point, a);
+   }
+
+   const float t =
+      std::clamp(glm::dot(point - a, ab) / lengthSquared, 0.0f, 1.0f);
+
+   return glm::distance(point, a + t * ab);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Number of levels of detail, including full detail at level 0.
+ */
+static constexpr std::size_t kLevelOfDetailCount = 4;
+
+/**
+ * @brief Get the level of detail at which simplified lines are
+ * indistinguishable from full detail lines.
+ *
+ * @param [in] pixelScale Map screen coordinate units per pixel
+ *
+ * @return Level of detail, from 0 (full detail) to kLevelOfDetailCount - 1
+ */
+std::size_t GetLevelOfDetail(float pixelScale);
+
+/**
+ * @brief Get the simplification tolerance of a level of detail.
+ *
+ * @param [in] level Level of detail
+ *
+ * @return Tolerance in map screen coordinates, or 0 for full detail
+ */
+float GetLevelOfDetailTolerance(std::size_t level);
+
+/**
+ * @brief Simplify a line using the Douglas-Peucker algorithm.
+ *
+ * @param [in] points Line vertices
+ * @param [in] tolerance Maximum distance of a removed vertex from the
+ * simplified line
+ *
+ * @return Indices of the retained vertices in ascending order, always
+ * including the first and last vertices
+ */
+std::vector<std::size_t> SimplifyLine(const std::vector<glm::vec2>& points,
+                                      float                         tolerance);
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
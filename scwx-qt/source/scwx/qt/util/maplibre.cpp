@@ -43,6 +43,35 @@ glm::vec2 GetMapScale(const QMapLibre::CustomLayerRenderParameters& params)
    return glm::vec2 {xScale, yScale};
 }
 
+float GetMapPixelScale(const QMapLibre::CustomLayerRenderParameters& params)
+{
+   return static_cast<float>(
+      mbgl::util::DEGREES_MAX /
+      (std::pow(2.0, params.zoom) * mbgl::util::tileSize_D));
+}
+
+std::optional<glm::vec4>
+GetMapScreenBounds(const QMapLibre::CustomLayerRenderParameters& params)
+{
+   // The visible area of a pitched map is not bounded by the viewport size
+   if (params.pitch != 0.0)
+   {
+      return std::nullopt;
+   }
+
+   const glm::vec2 center =
+      LatLongToScreenCoordinate({params.latitude, params.longitude});
+   const double unitsPerPixel =
+      mbgl::util::DEGREES_MAX /
+      (std::pow(2.0, params.zoom) * mbgl::util::tileSize_D);
+
+   // Half of the viewport diagonal encloses the viewport at any bearing
+   const float halfExtent = static_cast<float>(
+      0.5 * std::hypot(params.width, params.height) * unitsPerPixel);
+
+   return glm::vec4 {center - halfExtent, center + halfExtent};
+}
+
 bool IsPointInPolygon(const std::vector<glm::vec2>& vertices,
                       const glm::vec2&              point)
 {
@@ -88,11 +117,8 @@ glm::vec2 LatLongToScreenCoordinate(const QMapLibre::Coordinate& coordinate)
    return screen;
 }
 
-void SetMapStyleUrl(const std::shared_ptr<map::MapContext>& mapContext,
-                    const std::string&                      url)
+QString GetMapStyleUrl(map::MapProvider mapProvider, const std::string& url)
 {
-   const auto mapProvider = mapContext->map_provider();
-
    QString qUrl = QString::fromStdString(url);
 
    if (mapProvider == map::MapProvider::MapTiler)
@@ -101,10 +127,16 @@ void SetMapStyleUrl(const std::shared_ptr<map::MapContext>& mapContext,
       qUrl.append(map::GetMapProviderApiKey(mapProvider));
    }
 
+   return qUrl;
+}
+
+void SetMapStyleUrl(const std::shared_ptr<map::MapContext>& mapContext,
+                    const std::string&                      url)
+{
    auto map = mapContext->map().lock();
    if (map != nullptr)
    {
-      map->setStyleUrl(qUrl);
+      map->setStyleUrl(GetMapStyleUrl(mapContext->map_provider(), url));
    }
 }
 
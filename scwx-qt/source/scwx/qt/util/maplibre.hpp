@@ -2,6 +2,8 @@
 
 #include <scwx/qt/map/map_context.hpp>
 
+#include <optional>
+
 #include <QMapLibre/Map>
 #include <QMapLibre/Types>
 #include <glm/gtc/type_ptr.hpp>
@@ -21,6 +23,26 @@ units::length::meters<double>
 glm::mat4 GetMapMatrix(const QMapLibre::CustomLayerRenderParameters& params);
 glm::vec2 GetMapScale(const QMapLibre::CustomLayerRenderParameters& params);
 
+/**
+ * @brief Get the size of a pixel in map screen coordinates
+ *
+ * @param [in] params Custom layer render parameters
+ *
+ * @return Map screen coordinate units per pixel
+ */
+float GetMapPixelScale(const QMapLibre::CustomLayerRenderParameters& params);
+
+/**
+ * @brief Get the area of the map visible in the viewport
+ *
+ * @param [in] params Custom layer render parameters
+ *
+ * @return Bounds in map screen coordinates (min x, min y, max x, max y) which
+ * enclose the viewport at any bearing, or empty if the map is pitched
+ */
+std::optional<glm::vec4>
+GetMapScreenBounds(const QMapLibre::CustomLayerRenderParameters& params);
+
 /**
  * @brief Determine whether a point lies within a polygon
  *
@@ -32,6 +54,17 @@ glm::vec2 GetMapScale(const QMapLibre::CustomLayerRenderParameters& params);
 bool IsPointInPolygon(const std::vector<glm::vec2>& vertices,
                       const glm::vec2&              point);
 
+/**
+ * @brief Get the URL used to load a map style, including any API key required
+ * by the map provider
+ *
+ * @param [in] mapProvider Map provider
+ * @param [in] url Map style URL
+ *
+ * @return Map style URL to load
+ */
+QString GetMapStyleUrl(map::MapProvider mapProvider, const std::string& url);
+
 glm::vec2 LatLongToScreenCoordinate(const QMapLibre::Coordinate& coordinate);
 
 void SetMapStyleUrl(const std::shared_ptr<map::MapContext>& mapContext,
@@ -0,0 +1,130 @@
+#include <scwx/qt/util/mosaic_sweep.hpp>
+#include <scwx/qt/util/azimuth_index.hpp>
+#include <scwx/qt/util/elevation_scan_inspector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+
+#include <boost/range/irange.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+// Lowest data level, below which levels are codes
+static constexpr std::int16_t kMinThreshold_ = 2;
+
+static constexpr double kDegreesPerRow_ =
+   360.0 / static_cast<double>(MosaicSweep::kAzimuthRows);
+
+std::shared_ptr<const MosaicSweep>
+CreateMosaicSweep(const wsr88d::rda::ElevationScan&     elevationScan,
+                  const std::string&                    radarId,
+                  const common::Coordinate&             radarSite,
+                  std::chrono::system_clock::time_point time)
+{
+   using wsr88d::rda::DataBlockType;
+
+   // Gate geometry is taken from the first radial with reflectivity
+   std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock> firstBlock =
+      nullptr;
+   for (auto& radial : elevationScan)
+   {
+      auto block = radial.second->moment_data_block(DataBlockType::MomentRef);
+      if (block != nullptr && block->data_word_size() == 8)
+      {
+         firstBlock = std::move(block);
+         break;
+      }
+   }
+
+   if (firstBlock == nullptr)
+   {
+      return nullptr;
+   }
+
+   // The data moment range is to the center of the first gate
+   const float interval = firstBlock->data_moment_range_sample_interval_raw();
+
+   auto sweep        = std::make_shared<MosaicSweep>();
+   sweep->radarId_   = radarId;
+   sweep->radarSite_ = radarSite;
+   sweep->time_      = time;
+   sweep->firstGateRange_ =
+      firstBlock->data_moment_range_raw() - std::floor(interval / 2.0f);
+   sweep->gateSize_ = interval;
+   sweep->gates_    = firstBlock->number_of_data_moment_gates();
+   sweep->offset_   = firstBlock->offset();
+   sweep->scale_    = firstBlock->scale();
+
+   if (sweep->gateSize_ <= 0.0f || sweep->gates_ == 0)
+   {
+      return nullptr;
+   }
+
+   sweep->levels_.resize(MosaicSweep::kAzimuthRows * sweep->gates_,
+                         MosaicSweep::kNoCoverageLevel);
+
+   AzimuthIndex azimuthIndex {};
+   azimuthIndex.Build(ElevationScanInspector::GetRadials(elevationScan));
+
+   const auto rowRange =
+      boost::irange<std::size_t>(0u, MosaicSweep::kAzimuthRows);
+
+   std::for_each(
+      std::execution::par_unseq,
+      rowRange.begin(),
+      rowRange.end(),
+      [&](std::size_t row)
+      {
+         const double azimuth = (static_cast<double>(row) + 0.5) *
+                                kDegreesPerRow_;
+
+         const auto radial = azimuthIndex.Find(azimuth);
+         if (!radial.has_value())
+         {
+            return;
+         }
+
+         auto radialData = elevationScan.find(*radial);
+         if (radialData == elevationScan.cend())
+         {
+            return;
+         }
+
+         auto block =
+            radialData->second->moment_data_block(DataBlockType::MomentRef);
+         if (block == nullptr || block->data_word_size() != 8)
+         {
+            return;
+         }
+
+         // Compute threshold at which to display an individual bin
+         const auto snrThreshold = static_cast<std::uint16_t>(
+            std::max<std::int16_t>(kMinThreshold_, block->snr_threshold_raw()));
+
+         const std::size_t gates = std::min<std::size_t>(
+            block->number_of_data_moment_gates(), sweep->gates_);
+         const auto* moments =
+            static_cast<const std::uint8_t*>(block->data_moments());
+         std::uint8_t* levels = &sweep->levels_[row * sweep->gates_];
+
+         // Gates beyond the radial are not covered
+         for (std::size_t gate = 0; gate < gates; ++gate)
+         {
+            levels[gate] = (moments[gate] < snrThreshold) ?
+                              MosaicSweep::kNoDataLevel :
+                              moments[gate];
+         }
+      });
+
+   return sweep;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
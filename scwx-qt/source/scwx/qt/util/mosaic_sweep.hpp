@@ -0,0 +1,78 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+#include <scwx/wsr88d/rda/generic_radar_data.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Reflectivity of a single radar site, resampled onto rows of fixed
+ * azimuth width, such that sweeps of any azimuthal resolution are composited
+ * into a mosaic alike.
+ */
+struct MosaicSweep
+{
+   // Rows of 0.5 degrees, matching super resolution radials
+   static constexpr std::size_t kAzimuthRows = 720u;
+
+   // Level of a covered bin with no data. Bins below the SNR threshold and
+   // range folded bins are not displayed, but hide data from other radars.
+   static constexpr std::uint8_t kNoDataLevel = 1u;
+
+   // Level of a bin which is not covered by a radial
+   static constexpr std::uint8_t kNoCoverageLevel = 0u;
+
+   std::string                           radarId_ {};
+   common::Coordinate                    radarSite_ {};
+   std::chrono::system_clock::time_point time_ {};
+
+   float       firstGateRange_ {}; // Near edge of the first gate (meters)
+   float       gateSize_ {};       // Gate size (meters)
+   std::size_t gates_ {};
+   float       offset_ {};
+   float       scale_ {};
+
+   // Data levels by azimuth row, then by gate
+   std::vector<std::uint8_t> levels_ {};
+
+   double max_range() const { return firstGateRange_ + gates_ * gateSize_; }
+
+   std::uint8_t level(std::size_t row, std::size_t gate) const
+   {
+      return levels_[row * gates_ + gate];
+   }
+};
+
+/**
+ * @brief Resamples the reflectivity of an elevation scan for a mosaic. Each
+ * azimuth row takes the gates of the radial containing the center of the row.
+ *
+ * @param [in] elevationScan Elevation scan, such as the lowest tilt or
+ * composite reflectivity
+ * @param [in] radarId Radar site ID
+ * @param [in] radarSite Radar site location
+ * @param [in] time Time of the elevation scan
+ *
+ * @return Mosaic sweep, or nullptr if the scan has no 8-bit reflectivity
+ */
+std::shared_ptr<const MosaicSweep>
+CreateMosaicSweep(const wsr88d::rda::ElevationScan&     elevationScan,
+                  const std::string&                    radarId,
+                  const common::Coordinate&             radarSite,
+                  std::chrono::system_clock::time_point time);
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,127 @@
+#include <scwx/qt/util/position_filter.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+class PositionFilter::Impl
+{
+public:
+   explicit Impl(const Thresholds& thresholds) :
+       thresholds_ {thresholds},
+       smoothing_ {std::clamp(thresholds.smoothing_, 0.01, 1.0)}
+   {
+   }
+   ~Impl() = default;
+
+   static double HeadingDifference(double a, double b);
+
+   const Thresholds thresholds_;
+   const double     smoothing_;
+
+   std::optional<common::Coordinate> smoothed_ {};
+
+   std::optional<common::Coordinate>     accepted_ {};
+   std::optional<double>                 acceptedHeading_ {};
+   std::chrono::steady_clock::time_point acceptedTime_ {};
+};
+
+PositionFilter::PositionFilter(const Thresholds& thresholds) :
+    p(std::make_unique<Impl>(thresholds))
+{
+}
+PositionFilter::~PositionFilter() = default;
+
+PositionFilter::PositionFilter(PositionFilter&&) noexcept            = default;
+PositionFilter& PositionFilter::operator=(PositionFilter&&) noexcept = default;
+
+std::optional<common::Coordinate> PositionFilter::coordinate() const
+{
+   return p->accepted_;
+}
+
+bool PositionFilter::Update(const common::Coordinate&             coordinate,
+                            std::optional<double>                 heading,
+                            std::chrono::steady_clock::time_point time)
+{
+   if (!p->smoothed_.has_value())
+   {
+      p->smoothed_ = coordinate;
+   }
+   else
+   {
+      // Smooth the longitude along the shortest path across the antimeridian
+      double lonDelta = coordinate.longitude_ - p->smoothed_->longitude_;
+      lonDelta        = std::remainder(lonDelta, 360.0);
+
+      double longitude = p->smoothed_->longitude_ + p->smoothing_ * lonDelta;
+      longitude        = std::remainder(longitude, 360.0);
+
+      p->smoothed_->latitude_ +=
+         p->smoothing_ * (coordinate.latitude_ - p->smoothed_->latitude_);
+      p->smoothed_->longitude_ = longitude;
+   }
+
+   bool accept = !p->accepted_.has_value();
+
+   if (!accept && time - p->acceptedTime_ < p->thresholds_.interval_)
+   {
+      // Rate limited
+      return false;
+   }
+
+   if (!accept)
+   {
+      double distance;
+      GeographicLib::DefaultGeodesic().Inverse(p->accepted_->latitude_,
+                                               p->accepted_->longitude_,
+                                               p->smoothed_->latitude_,
+                                               p->smoothed_->longitude_,
+                                               distance);
+
+      accept = (p->thresholds_.distance_.value() <= 0.0) ?
+                  (distance > 0.0) :
+                  (distance >= p->thresholds_.distance_.value());
+   }
+
+   if (!accept && heading.has_value() &&
+       p->thresholds_.heading_.value() > 0.0)
+   {
+      accept = !p->acceptedHeading_.has_value() ||
+               Impl::HeadingDifference(*heading, *p->acceptedHeading_) >=
+                  p->thresholds_.heading_.value();
+   }
+
+   if (accept)
+   {
+      p->accepted_        = p->smoothed_;
+      p->acceptedHeading_ = heading;
+      p->acceptedTime_    = time;
+   }
+
+   return accept;
+}
+
+void PositionFilter::Reset()
+{
+   p->smoothed_.reset();
+   p->accepted_.reset();
+   p->acceptedHeading_.reset();
+   p->acceptedTime_ = {};
+}
+
+double PositionFilter::Impl::HeadingDifference(double a, double b)
+{
+   return std::abs(std::remainder(a - b, 360.0));
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
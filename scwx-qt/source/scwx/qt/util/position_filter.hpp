@@ -0,0 +1,97 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+
+#include <chrono>
+#include <memory>
+#include <optional>
+
+#include <units/angle.h>
+#include <units/length.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Filters a stream of position updates for a single consumer, so the
+ * consumer only acts on updates which change its result. Positions may be
+ * smoothed, and are accepted when they have moved or turned far enough, no
+ * sooner than a minimum interval after the last accepted position.
+ */
+class PositionFilter
+{
+public:
+   struct Thresholds
+   {
+      /**
+       * Minimum distance from the last accepted position. A distance of zero
+       * accepts any change in position.
+       */
+      units::length::meters<double> distance_ {0.0};
+
+      /**
+       * Minimum change in heading from the last accepted position. A heading
+       * change of zero does not accept positions based on heading.
+       */
+      units::angle::degrees<double> heading_ {0.0};
+
+      /**
+       * Minimum interval between accepted positions.
+       */
+      std::chrono::milliseconds interval_ {0};
+
+      /**
+       * Weight of each new position in the smoothed position, between 0 and
+       * 1. A weight of 1 does not smooth positions.
+       */
+      double smoothing_ {1.0};
+   };
+
+   explicit PositionFilter(const Thresholds& thresholds);
+   ~PositionFilter();
+
+   PositionFilter(const PositionFilter&)            = delete;
+   PositionFilter& operator=(const PositionFilter&) = delete;
+
+   PositionFilter(PositionFilter&&) noexcept;
+   PositionFilter& operator=(PositionFilter&&) noexcept;
+
+   /**
+    * @brief Gets the last accepted position.
+    *
+    * @return Accepted position, or an empty optional if no position has been
+    * accepted
+    */
+   std::optional<common::Coordinate> coordinate() const;
+
+   /**
+    * @brief Adds a position update to the filter.
+    *
+    * @param [in] coordinate Position
+    * @param [in] heading Heading in degrees, if known
+    * @param [in] time Time of the update
+    *
+    * @return true if the consumer should act on the position
+    */
+   bool Update(const common::Coordinate&            coordinate,
+               std::optional<double>                heading,
+               std::chrono::steady_clock::time_point time =
+                  std::chrono::steady_clock::now());
+
+   /**
+    * @brief Clears the filter, so the next update is accepted.
+    */
+   void Reset();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -1,6 +1,8 @@
 #include <scwx/qt/util/q_file_buffer.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <cstring>
+
 #include <QFile>
 
 namespace scwx
@@ -23,11 +25,13 @@ public:
    explicit Impl(QFileBuffer* self) : self_ {self} {};
    ~Impl() = default;
 
-   void ResetPutback();
-   void SetPutback();
+   void     ResetPutback();
+   void     SetPutback();
+   pos_type SeekMapped(off_type pos);
 
    QFileBuffer* self_;
    QFile        file_ {};
+   uchar*       mapped_ {nullptr};
    char_type    putbackChar_ {};
    char_type*   putbackEback_ {nullptr};
    char_type*   putbackEgptr_ {nullptr};
@@ -53,6 +57,20 @@ void QFileBuffer::Impl::SetPutback()
    self_->setg(&putbackChar_, &putbackChar_, &putbackChar_ + 1);
 }
 
+QFileBuffer::pos_type QFileBuffer::Impl::SeekMapped(off_type pos)
+{
+   char_type* begin = self_->eback();
+   char_type* end   = self_->egptr();
+
+   if (pos < 0 || pos > end - begin)
+   {
+      return pos_type(off_type(-1));
+   }
+
+   self_->setg(begin, begin + pos, end);
+   return pos;
+}
+
 QFileBuffer::QFileBuffer() : std::streambuf(), p(std::make_unique<Impl>(this))
 {
    // Initialize read/write pointers
@@ -84,6 +102,11 @@ bool QFileBuffer::is_open() const
    return p->file_.isOpen();
 }
 
+bool QFileBuffer::is_mapped() const
+{
+   return p->mapped_ != nullptr;
+}
+
 QFileBuffer* QFileBuffer::open(const std::string&      filename,
                                std::ios_base::openmode mode)
 {
@@ -118,16 +141,35 @@ QFileBuffer* QFileBuffer::open(const std::string&      filename,
 
    if (isOpen)
    {
+      // Map binary files, such that reads do not copy through the QFile buffer
+      const qint64 size = p->file_.size();
+      if ((mode & std::ios_base::binary) && size > 0)
+      {
+         p->mapped_ = p->file_.map(0, size);
+      }
+
       // Seek to end if requested
       if (mode & std::ios_base::ate)
       {
          // Seek to end
-         p->file_.seek(p->file_.size());
+         p->file_.seek(size);
       }
 
       // Initialize read/write pointers
-      setg(0, 0, 0);
       setp(0, 0);
+
+      if (p->mapped_ != nullptr)
+      {
+         // The get area spans the mapped file
+         char_type* begin = reinterpret_cast<char_type*>(p->mapped_);
+         setg(begin,
+              begin + ((mode & std::ios_base::ate) ? size : 0),
+              begin + size);
+      }
+      else
+      {
+         setg(0, 0, 0);
+      }
    }
 
    return isOpen ? this : nullptr;
@@ -141,9 +183,16 @@ QFileBuffer* QFileBuffer::close()
       return nullptr;
    }
 
-   // Close the file
+   // Unmap and close the file
+   if (p->mapped_ != nullptr)
+   {
+      p->file_.unmap(p->mapped_);
+      p->mapped_ = nullptr;
+   }
    p->file_.close();
 
+   setg(0, 0, 0);
+
    return this;
 }
 
@@ -157,9 +206,10 @@ QFileBuffer::int_type QFileBuffer::pbackfail(int_type c)
       gbump(-1);
       return traits_type::not_eof(c);
    }
-   else if (!is_open() || traits_type::eq_int_type(traits_type::eof(), c))
+   else if (!is_open() || traits_type::eq_int_type(traits_type::eof(), c) ||
+            p->mapped_ != nullptr)
    {
-      // No open QFile or EOF, fail
+      // No open QFile or EOF, fail. Mapped data cannot be modified.
       return traits_type::eof();
    }
    else if (gptr() != &p->putbackChar_)
@@ -182,6 +232,22 @@ QFileBuffer::pos_type QFileBuffer::seekoff(off_type               off,
 {
    pos_type newPos {pos_type(off_type(-1))};
 
+   if (p->mapped_ != nullptr)
+   {
+      switch (dir)
+      {
+      case std::ios_base::beg:
+         return p->SeekMapped(off);
+      case std::ios_base::cur:
+         return p->SeekMapped(gptr() - eback() + off);
+      case std::ios_base::end:
+         return p->SeekMapped(egptr() - eback() + off);
+      default:
+         logger_->error("Got invalid seekdir value");
+         return newPos;
+      }
+   }
+
    switch (dir)
    {
    case std::ios_base::beg:
@@ -242,6 +308,11 @@ QFileBuffer::pos_type QFileBuffer::seekpos(pos_type pos,
 {
    pos_type newPos {pos_type(off_type(-1))};
 
+   if (p->mapped_ != nullptr)
+   {
+      return p->SeekMapped(pos);
+   }
+
    // Seek the file
    if (p->file_.seek(pos))
    {
@@ -288,9 +359,9 @@ QFileBuffer::int_type QFileBuffer::uflow()
       return c;
    }
 
-   if (!p->file_.isOpen())
+   if (!p->file_.isOpen() || p->mapped_ != nullptr)
    {
-      // No open QFile, fail
+      // No open QFile, or the end of mapped data, fail
       return traits_type::eof();
    }
 
@@ -305,6 +376,16 @@ QFileBuffer::int_type QFileBuffer::uflow()
 
 std::streamsize QFileBuffer::xsgetn(char_type* s, std::streamsize count)
 {
+   if (p->mapped_ != nullptr)
+   {
+      // Copy directly from the mapped data
+      const std::streamsize available =
+         std::min<std::streamsize>(count, egptr() - gptr());
+      std::memcpy(s, gptr(), static_cast<std::size_t>(available));
+      setg(eback(), gptr() + available, egptr());
+      return available;
+   }
+
    // Read up to count bytes, forwarding the return value from QFile::read
    // (return negative values as zero)
    return std::max<std::streamsize>(
@@ -15,7 +15,9 @@ namespace util
  * with C++ stream-based I/O.
  *
  * QFileBuffer has read-only support. Locales are ignored, and no conversions
- * are performed.
+ * are performed. Files opened in binary mode are memory mapped where possible,
+ * including Qt resources, and reads are then served directly from the mapped
+ * data.
  *
  * Documentation for functions derived from
  * https://en.cppreference.com/ SPDX-License-Identifier: CC BY-SA 3.0
@@ -61,6 +63,13 @@ public:
     */
    bool is_open() const;
 
+   /**
+    * @brief Checks if the associated file is memory mapped
+    *
+    * @return true if reads are served from mapped data, false otherwise
+    */
+   bool is_mapped() const;
+
    /**
     * @brief Opens a file and configures it as the associated character sequence
     *
@@ -0,0 +1,135 @@
+#include <scwx/qt/util/spatial_index.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+namespace bg  = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+typedef bg::model::point<float, 2, bg::cs::cartesian> Point;
+typedef bg::model::box<Point>                         Box;
+typedef std::pair<Box, std::size_t>                   Value;
+
+class SpatialIndex::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() = default;
+
+   std::vector<std::size_t> Query(const Box& box) const;
+
+   bgi::rtree<Value, bgi::quadratic<16>> rtree_ {};
+
+   float maxPixelOffset_ {0.0f};
+};
+
+SpatialIndex::SpatialIndex() : p(std::make_unique<Impl>()) {}
+SpatialIndex::~SpatialIndex() = default;
+
+SpatialIndex::SpatialIndex(SpatialIndex&&) noexcept            = default;
+SpatialIndex& SpatialIndex::operator=(SpatialIndex&&) noexcept = default;
+
+void SpatialIndex::Build(const std::vector<glm::vec4>& bounds,
+                       float                         maxPixelOffset)
+{
+   std::vector<Value> values {};
+   values.reserve(bounds.size());
+
+   for (std::size_t i = 0; i < bounds.size(); ++i)
+   {
+      const glm::vec4& b = bounds[i];
+      values.emplace_back(Box {{b.x, b.y}, {b.z, b.w}}, i);
+   }
+
+   // Bulk loading packs the tree, which is faster than inserting each entry
+   p->rtree_          = bgi::rtree<Value, bgi::quadratic<16>>(values);
+   p->maxPixelOffset_ = maxPixelOffset;
+}
+
+void SpatialIndex::Clear()
+{
+   p->rtree_.clear();
+   p->maxPixelOffset_ = 0.0f;
+}
+
+std::vector<std::size_t> SpatialIndex::Query(const glm::vec2& point,
+                                           float pixelScale) const
+{
+   // Pixel offsets are not stored in the index, so the point is expanded by
+   // the largest offset at the current map scale
+   const float offset = p->maxPixelOffset_ * pixelScale;
+
+   std::vector<std::size_t> indices =
+      p->Query({{point.x - offset, point.y - offset},
+                {point.x + offset, point.y + offset}});
+
+   // Later entries are drawn on top, and are picked first
+   std::sort(indices.begin(), indices.end(), std::greater {});
+
+   return indices;
+}
+
+std::vector<std::size_t> SpatialIndex::Query(const glm::vec4& area,
+                                             float pixelScale) const
+{
+   const float offset = p->maxPixelOffset_ * pixelScale;
+
+   std::vector<std::size_t> indices =
+      p->Query({{area.x - offset, area.y - offset},
+                {area.z + offset, area.w + offset}});
+
+   // Entries are returned in draw order
+   std::sort(indices.begin(), indices.end());
+
+   return indices;
+}
+
+std::vector<std::size_t> SpatialIndex::Impl::Query(const Box& box) const
+{
+   std::vector<Value> values {};
+   rtree_.query(bgi::intersects(box), std::back_inserter(values));
+
+   std::vector<std::size_t> indices {};
+   indices.reserve(values.size());
+   std::transform(values.cbegin(),
+                  values.cend(),
+                  std::back_inserter(indices),
+                  [](const Value& value) { return value.second; });
+
+   return indices;
+}
+
+glm::vec4 SpatialIndex::bounds() const
+{
+   if (p->rtree_.empty())
+   {
+      return {};
+   }
+
+   const Box box = p->rtree_.bounds();
+   return {box.min_corner().get<0>(),
+           box.min_corner().get<1>(),
+           box.max_corner().get<0>(),
+           box.max_corner().get<1>()};
+}
+
+std::size_t SpatialIndex::size() const
+{
+   return p->rtree_.size();
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
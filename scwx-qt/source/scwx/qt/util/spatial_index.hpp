@@ -0,0 +1,91 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Spatial index of draw item entries in map screen coordinates, used to
+ * find the entries near the mouse cursor or within the map viewport without
+ * testing every entry.
+ */
+class SpatialIndex
+{
+public:
+   explicit SpatialIndex();
+   ~SpatialIndex();
+
+   SpatialIndex(const SpatialIndex&)            = delete;
+   SpatialIndex& operator=(const SpatialIndex&) = delete;
+
+   SpatialIndex(SpatialIndex&&) noexcept;
+   SpatialIndex& operator=(SpatialIndex&&) noexcept;
+
+   /**
+    * @brief Rebuilds the index.
+    *
+    * @param [in] bounds Bounds of each entry in map screen coordinates (min x,
+    * min y, max x, max y), excluding pixel offsets
+    * @param [in] maxPixelOffset Largest pixel offset of any entry from its
+    * bounds
+    */
+   void Build(const std::vector<glm::vec4>& bounds, float maxPixelOffset);
+
+   /**
+    * @brief Removes all entries from the index.
+    */
+   void Clear();
+
+   /**
+    * @brief Gets the bounds of all entries, excluding pixel offsets.
+    *
+    * @return Bounds in map screen coordinates (min x, min y, max x, max y)
+    */
+   glm::vec4 bounds() const;
+
+   /**
+    * @brief Gets the number of entries in the index.
+    *
+    * @return Number of entries
+    */
+   std::size_t size() const;
+
+   /**
+    * @brief Finds the entries which may contain a point.
+    *
+    * @param [in] point Point in map screen coordinates
+    * @param [in] pixelScale Map screen coordinate units per pixel
+    *
+    * @return Indices of candidate entries, in descending order
+    */
+   std::vector<std::size_t> Query(const glm::vec2& point,
+                                  float            pixelScale) const;
+
+   /**
+    * @brief Finds the entries which may intersect an area.
+    *
+    * @param [in] area Area in map screen coordinates (min x, min y, max x,
+    * max y)
+    * @param [in] pixelScale Map screen coordinate units per pixel
+    *
+    * @return Indices of candidate entries, in ascending order
+    */
+   std::vector<std::size_t> Query(const glm::vec4& area,
+                                  float            pixelScale) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -1,9 +1,15 @@
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/qt/util/streams.hpp>
+#include <scwx/qt/util/texture_compression.hpp>
 #include <scwx/network/cpr.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/memory.hpp>
 
 #include <execution>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
 
@@ -17,11 +23,14 @@
 #include <boost/iostreams/stream.hpp>
 #include <boost/timer/timer.hpp>
 #include <cpr/cpr.h>
+#include <fmt/format.h>
 #include <stb_image.h>
 #include <stb_rect_pack.h>
 #include <QFile>
 #include <QFileInfo>
+#include <QOpenGLContext>
 #include <QPainter>
+#include <QStandardPaths>
 #include <QSvgRenderer>
 #include <QUrl>
 
@@ -33,6 +42,10 @@
 #   undef LoadImage
 #endif
 
+#if !defined(GL_COMPRESSED_RGBA_S3TC_DXT5_EXT)
+#   define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
 namespace scwx
 {
 namespace qt
@@ -43,12 +56,53 @@ namespace util
 static const std::string logPrefix_ = "scwx::qt::util::texture_atlas";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// GL_MAX_ARRAY_TEXTURE_LAYERS is guaranteed to be at least 256 in OpenGL 3.3
+static constexpr std::size_t kMaxLayers_ = 256u;
+
+// Regions updated in place are tracked until the atlas is rebuilt. Beyond this
+// many, the atlas is uploaded in full instead.
+static constexpr std::size_t kMaxDirtyRegions_ = 1024u;
+
+struct AtlasRect
+{
+   std::ptrdiff_t x_;
+   std::ptrdiff_t y_;
+   std::ptrdiff_t width_;
+   std::ptrdiff_t height_;
+};
+
+struct DirtyRegion
+{
+   std::uint64_t buildCount_;
+   std::size_t   layer_;
+   AtlasRect     rect_;
+};
+
 class TextureAtlas::Impl
 {
 public:
    explicit Impl() {}
    ~Impl() {}
 
+   bool AllocateRect(std::size_t          layer,
+                     std::ptrdiff_t       width,
+                     std::ptrdiff_t       height,
+                     boost::gil::point_t& position);
+   void FreeRect(std::size_t layer, const AtlasRect& rect);
+
+   void BufferCompressedRegions(gl::OpenGLFunctions& gl,
+                                GLuint               texture,
+                                std::uint64_t        bufferedCount,
+                                std::shared_lock<std::shared_mutex>& lock);
+   void BufferCompressedAtlas(gl::OpenGLFunctions&                 gl,
+                              GLuint                               texture,
+                              std::shared_lock<std::shared_mutex>& lock);
+
+   static bool IsCompressionSupported();
+
+   static const std::string& ImageCachePath();
+   static std::string        FetchImageData(const std::string& imageUrl);
+
    static std::shared_ptr<boost::gil::rgba8_image_t>
    LoadImage(const std::string& imagePath);
 
@@ -57,6 +111,8 @@ public:
    static std::shared_ptr<boost::gil::rgba8_image_t>
    ReadSvgFile(const QString& imagePath);
 
+   // Registered textures are loaded when first referenced
+   std::unordered_map<std::string, std::string> pendingTextures_ {};
    std::vector<std::shared_ptr<boost::gil::rgba8_image_t>>
                      registeredTextures_ {};
    std::shared_mutex registeredTextureMutex_ {};
@@ -69,7 +125,32 @@ public:
    std::unordered_map<std::string, TextureAttributes> atlasMap_ {};
    std::shared_mutex                                  atlasMutex_ {};
 
+   // Free space of each atlas layer, and the images packed in the atlas
+   std::vector<std::vector<AtlasRect>> freeRects_ {};
+   std::unordered_map<std::string, std::weak_ptr<boost::gil::rgba8_image_t>>
+      atlasImages_ {};
+
+   // Atlas layers compressed as S3TC DXT5, empty if compression is disabled
+   std::vector<std::vector<std::uint8_t>> compressedArray_ {};
+   bool                                   compressionEnabled_ {false};
+
+   // Regions updated since the atlas layout last changed
+   std::vector<DirtyRegion> dirtyRegions_ {};
+   std::uint64_t            layoutCount_ {0u};
+
    std::uint64_t buildCount_ {0u};
+
+   // Size of the atlas last built, used when adding textures on demand
+   std::size_t atlasWidth_ {2048u};
+   std::size_t atlasHeight_ {2048u};
+
+   // Serializes building and updating the atlas
+   std::mutex buildMutex_ {};
+
+   // The atlas is held in memory, and buffered to a texture shared by all
+   // OpenGL contexts
+   scwx::util::MemoryCounter atlasMemory_ {"Texture Atlas"};
+   scwx::util::MemoryCounter textureMemory_ {"Texture Atlas (GPU)"};
 };
 
 TextureAtlas::TextureAtlas() : p(std::make_unique<Impl>()) {}
@@ -83,13 +164,80 @@ std::uint64_t TextureAtlas::BuildCount() const
    return p->buildCount_;
 }
 
+void TextureAtlas::SetCompressionEnabled(bool enabled)
+{
+   std::unique_lock buildLock(p->buildMutex_);
+
+   p->compressionEnabled_ = enabled;
+}
+
 void TextureAtlas::RegisterTexture(const std::string& name,
                                    const std::string& path)
 {
    std::unique_lock lock(p->registeredTextureMutex_);
 
-   std::shared_ptr<boost::gil::rgba8_image_t> image = CacheTexture(name, path);
-   p->registeredTextures_.emplace_back(std::move(image));
+   p->pendingTextures_.insert_or_assign(name, path);
+}
+
+void TextureAtlas::LoadTextures(const std::vector<std::string>& names)
+{
+   std::unique_lock lock(p->registeredTextureMutex_);
+
+   std::vector<std::pair<std::string, std::string>> textures {};
+
+   for (auto& name : names)
+   {
+      auto it = p->pendingTextures_.find(name);
+      if (it != p->pendingTextures_.end())
+      {
+         textures.emplace_back(std::move(*it));
+         p->pendingTextures_.erase(it);
+      }
+   }
+
+   if (textures.empty())
+   {
+      return;
+   }
+
+   logger_->debug("Loading {} registered textures", textures.size());
+
+   std::mutex                                              m {};
+   std::vector<std::shared_ptr<boost::gil::rgba8_image_t>> images {};
+
+   std::for_each(std::execution::par_unseq,
+                 textures.begin(),
+                 textures.end(),
+                 [&](auto& texture)
+                 {
+                    auto image = CacheTexture(texture.first, texture.second);
+
+                    if (image != nullptr)
+                    {
+                       std::unique_lock imageLock {m};
+                       images.emplace_back(std::move(image));
+                    }
+                 });
+
+   if (images.empty())
+   {
+      return;
+   }
+
+   p->registeredTextures_.insert(p->registeredTextures_.end(),
+                                 std::make_move_iterator(images.begin()),
+                                 std::make_move_iterator(images.end()));
+
+   std::size_t width;
+   std::size_t height;
+   {
+      std::shared_lock atlasLock(p->atlasMutex_);
+      width  = p->atlasWidth_;
+      height = p->atlasHeight_;
+   }
+
+   // Add the textures to free space in the atlas, without repacking
+   UpdateAtlas(width, height);
 }
 
 std::shared_ptr<boost::gil::rgba8_image_t>
@@ -126,6 +274,8 @@ void TextureAtlas::BuildAtlas(std::size_t width, std::size_t height)
       return;
    }
 
+   std::unique_lock buildLock(p->buildMutex_);
+
    typedef std::vector<
       std::pair<std::string, std::shared_ptr<boost::gil::rgba8_image_t>>>
       ImageVector;
@@ -147,8 +297,9 @@ void TextureAtlas::BuildAtlas(std::size_t width, std::size_t height)
 
          if (image == nullptr)
          {
-            logger_->trace("Removing texture from the cache: {}",
-                           texture.first);
+            SPDLOG_LOGGER_TRACE(logger_,
+                                "Removing texture from the cache: {}",
+                                texture.first);
 
             // If the image is no longer cached, erase the iterator and continue
             it = p->textureCache_.erase(it);
@@ -174,9 +325,6 @@ void TextureAtlas::BuildAtlas(std::size_t width, std::size_t height)
       }
    }
 
-   // GL_MAX_ARRAY_TEXTURE_LAYERS is guaranteed to be at least 256 in OpenGL 3.3
-   constexpr std::size_t kMaxLayers = 256u;
-
    const float xStep = 1.0f / width;
    const float yStep = 1.0f / height;
    const float xMin  = xStep * 0.5f;
@@ -190,14 +338,17 @@ void TextureAtlas::BuildAtlas(std::size_t width, std::size_t height)
 
    std::vector<boost::gil::rgba8_image_t>             newAtlasArray {};
    std::unordered_map<std::string, TextureAttributes> newAtlasMap {};
+   std::vector<std::vector<AtlasRect>>                newFreeRects {};
+   std::unordered_map<std::string, std::weak_ptr<boost::gil::rgba8_image_t>>
+      newAtlasImages {};
 
-   for (std::size_t layer = 0; layer < kMaxLayers; ++layer)
+   for (std::size_t layer = 0; layer < kMaxLayers_; ++layer)
    {
-      logger_->trace("Processing layer {}", layer);
+      SPDLOG_LOGGER_TRACE(logger_, "Processing layer {}", layer);
 
       // Pack images
       {
-         logger_->trace("Packing {} images", images.size());
+         SPDLOG_LOGGER_TRACE(logger_, "Packing {} images", images.size());
 
          stbrp_init_target(&stbrpContext,
                            static_cast<int>(width),
@@ -218,7 +369,7 @@ void TextureAtlas::BuildAtlas(std::size_t width, std::size_t height)
                               boost::gil::rgba8_pixel_t {255, 0, 255, 255});
 
       // Populate atlas
-      logger_->trace("Populating atlas");
+      SPDLOG_LOGGER_TRACE(logger_, "Populating atlas");
 
       std::size_t numPackedImages = 0u;
 
@@ -262,6 +413,7 @@ void TextureAtlas::BuildAtlas(std::size_t width, std::size_t height)
                   sRight,
                   tTop,
                   tBottom));
+            newAtlasImages.emplace(images[i].first, images[i].second);
 
             numPackedImages++;
          }
@@ -276,6 +428,41 @@ void TextureAtlas::BuildAtlas(std::size_t width, std::size_t height)
       {
          // The new atlas layer has images that were able to be packed
          newAtlasArray.emplace_back(std::move(atlas));
+
+         // Track the space above the packing skyline as free, so textures can
+         // be added later without repacking. The space below the highest
+         // skyline node spans the full width of the layer.
+         std::vector<AtlasRect>& freeRects = newFreeRects.emplace_back();
+
+         std::ptrdiff_t skylineTop = 0;
+         for (stbrp_node* node = stbrpContext.active_head;
+              node != nullptr && node->next != nullptr;
+              node = node->next)
+         {
+            skylineTop = std::max<std::ptrdiff_t>(skylineTop, node->y);
+         }
+
+         for (stbrp_node* node = stbrpContext.active_head;
+              node != nullptr && node->next != nullptr;
+              node = node->next)
+         {
+            if (node->y < skylineTop)
+            {
+               freeRects.push_back({node->x,
+                                    node->y,
+                                    node->next->x - node->x,
+                                    skylineTop - node->y});
+            }
+         }
+
+         if (skylineTop < static_cast<std::ptrdiff_t>(height))
+         {
+            freeRects.push_back({0,
+                                 skylineTop,
+                                 static_cast<std::ptrdiff_t>(width),
+                                 static_cast<std::ptrdiff_t>(height) -
+                                    skylineTop});
+         }
       }
 
       if (unpackedImages.empty())
@@ -283,7 +470,7 @@ void TextureAtlas::BuildAtlas(std::size_t width, std::size_t height)
          // All images have been packed into the texture atlas
          break;
       }
-      else if (layer == kMaxLayers - 1u || numPackedImages == 0u)
+      else if (layer == kMaxLayers_ - 1u || numPackedImages == 0u)
       {
          // Some images were unable to be packed into the texture atlas
          for (auto& image : unpackedImages)
@@ -301,23 +488,345 @@ void TextureAtlas::BuildAtlas(std::size_t width, std::size_t height)
       }
    }
 
+   // Compress the atlas before it is swapped in, such that the previous atlas
+   // remains available while encoding
+   std::vector<std::vector<std::uint8_t>> newCompressedArray {};
+   std::size_t                            compressedSize = 0u;
+
+   if (p->compressionEnabled_)
+   {
+      if (IsCompressibleSize(width, height))
+      {
+         for (auto& layer : newAtlasArray)
+         {
+            newCompressedArray.emplace_back(
+               CompressImage(boost::gil::const_view(layer)));
+            compressedSize += newCompressedArray.back().size();
+         }
+      }
+      else
+      {
+         logger_->warn(
+            "Cannot compress texture atlas of size {}x{}", width, height);
+      }
+   }
+
    // Lock atlas
    std::unique_lock lock(p->atlasMutex_);
 
    p->atlasArray_.swap(newAtlasArray);
+   p->compressedArray_.swap(newCompressedArray);
    p->atlasMap_.swap(newAtlasMap);
+   p->freeRects_.swap(newFreeRects);
+   p->atlasImages_.swap(newAtlasImages);
+   p->atlasWidth_  = width;
+   p->atlasHeight_ = height;
+
+   p->atlasMemory_.set_bytes(width * height * p->atlasArray_.size() *
+                                sizeof(boost::gil::rgba8_pixel_t) +
+                             compressedSize);
 
-   // Mark the need to buffer the atlas
-   ++p->buildCount_;
+   // Mark the need to buffer the atlas in full
+   p->layoutCount_ = ++p->buildCount_;
+   p->dirtyRegions_.clear();
 
    timer.stop();
    logger_->debug("Texture atlas built in {}", timer.format(6, "%ws"));
 }
 
-void TextureAtlas::BufferAtlas(gl::OpenGLFunctions& gl, GLuint texture)
+void TextureAtlas::UpdateAtlas(std::size_t width, std::size_t height)
+{
+   logger_->debug("Updating {}x{} texture atlas", width, height);
+
+   boost::timer::cpu_timer timer {};
+   timer.start();
+
+   std::unique_lock buildLock(p->buildMutex_);
+
+   std::unordered_map<std::string, std::shared_ptr<boost::gil::rgba8_image_t>>
+      images {};
+
+   // Cached images
+   {
+      std::unique_lock textureCacheLock(p->textureCacheMutex_);
+
+      for (auto it = p->textureCache_.begin(); it != p->textureCache_.end();)
+      {
+         auto image = it->second.lock();
+
+         if (image == nullptr)
+         {
+            SPDLOG_LOGGER_TRACE(logger_,
+                                "Removing texture from the cache: {}",
+                                it->first);
+
+            it = p->textureCache_.erase(it);
+            continue;
+         }
+         else if (image->width() > 0u && image->height() > 0u)
+         {
+            images.emplace(it->first, std::move(image));
+         }
+
+         ++it;
+      }
+   }
+
+   std::unique_lock lock(p->atlasMutex_);
+
+   bool rebuild = p->atlasArray_.empty() ||
+                  p->atlasArray_[0].width() !=
+                     static_cast<std::ptrdiff_t>(width) ||
+                  p->atlasArray_[0].height() !=
+                     static_cast<std::ptrdiff_t>(height);
+
+   const float xStep = 1.0f / width;
+   const float yStep = 1.0f / height;
+   const float xMin  = xStep * 0.5f;
+   const float yMin  = yStep * 0.5f;
+
+   const std::uint64_t buildCount = p->buildCount_ + 1u;
+   bool                modified   = false;
+
+   const auto copyImage =
+      [&](const boost::gil::rgba8_image_t& image,
+          std::size_t                      layer,
+          const boost::gil::point_t&       position)
+   {
+      boost::gil::rgba8c_view_t imageView = boost::gil::const_view(image);
+      boost::gil::rgba8_view_t  atlasSubView =
+         boost::gil::subimage_view(boost::gil::view(p->atlasArray_[layer]),
+                                   position,
+                                   imageView.dimensions());
+
+      boost::gil::copy_pixels(imageView, atlasSubView);
+
+      if (!p->compressedArray_.empty())
+      {
+         CompressRegion(boost::gil::const_view(p->atlasArray_[layer]),
+                        position.x,
+                        position.y,
+                        imageView.width(),
+                        imageView.height(),
+                        p->compressedArray_[layer]);
+      }
+
+      p->dirtyRegions_.push_back({buildCount,
+                                  layer,
+                                  {position.x,
+                                   position.y,
+                                   imageView.width(),
+                                   imageView.height()}});
+      modified = true;
+   };
+
+   // Release textures no longer cached, and replace changed textures in place
+   for (auto it = p->atlasMap_.begin(); !rebuild && it != p->atlasMap_.end();)
+   {
+      auto imageIt = images.find(it->first);
+
+      if (imageIt != images.end())
+      {
+         auto& packedImage = p->atlasImages_[it->first];
+         auto& image       = imageIt->second;
+
+         if (packedImage.lock() == image)
+         {
+            // The texture is unchanged
+            images.erase(imageIt);
+            ++it;
+            continue;
+         }
+         else if (image->dimensions() == it->second.size_)
+         {
+            copyImage(*image, it->second.layerId_, it->second.position_);
+            packedImage = image;
+            images.erase(imageIt);
+            ++it;
+            continue;
+         }
+      }
+
+      p->FreeRect(it->second.layerId_,
+                  {it->second.position_.x,
+                   it->second.position_.y,
+                   it->second.size_.x,
+                   it->second.size_.y});
+      p->atlasImages_.erase(it->first);
+      it       = p->atlasMap_.erase(it);
+      modified = true;
+   }
+
+   // Add new textures, tallest first
+   std::vector<
+      std::pair<std::string, std::shared_ptr<boost::gil::rgba8_image_t>>>
+      newImages(images.begin(), images.end());
+   std::sort(newImages.begin(),
+             newImages.end(),
+             [](const auto& a, const auto& b)
+             { return a.second->height() > b.second->height(); });
+
+   for (auto& [name, image] : newImages)
+   {
+      if (rebuild)
+      {
+         break;
+      }
+
+      if (image->width() > static_cast<std::ptrdiff_t>(width) ||
+          image->height() > static_cast<std::ptrdiff_t>(height))
+      {
+         logger_->warn("Unable to pack texture: {}", name);
+         continue;
+      }
+
+      // Find free space in an existing layer
+      boost::gil::point_t position {};
+      std::size_t         layer = 0u;
+      for (; layer < p->atlasArray_.size(); ++layer)
+      {
+         if (p->AllocateRect(layer, image->width(), image->height(), position))
+         {
+            break;
+         }
+      }
+
+      if (layer == p->atlasArray_.size())
+      {
+         // The atlas is full, and must be repacked
+         rebuild = true;
+         break;
+      }
+
+      copyImage(*image, layer, position);
+
+      const float sLeft = position.x * xStep + xMin;
+      const float sRight =
+         sLeft + static_cast<float>(image->width() - 1) / width;
+      const float tTop = position.y * yStep + yMin;
+      const float tBottom =
+         tTop + static_cast<float>(image->height() - 1) / height;
+
+      p->atlasMap_.insert_or_assign(name,
+                                    TextureAttributes {layer,
+                                                       position,
+                                                       image->dimensions(),
+                                                       sLeft,
+                                                       sRight,
+                                                       tTop,
+                                                       tBottom});
+      p->atlasImages_.insert_or_assign(name, image);
+   }
+
+   if (!rebuild && modified)
+   {
+      // Mark the need to buffer the atlas
+      ++p->buildCount_;
+
+      if (p->dirtyRegions_.size() > kMaxDirtyRegions_)
+      {
+         // Too many regions to upload individually
+         p->layoutCount_ = p->buildCount_;
+         p->dirtyRegions_.clear();
+      }
+   }
+
+   lock.unlock();
+   buildLock.unlock();
+
+   if (rebuild)
+   {
+      BuildAtlas(width, height);
+      return;
+   }
+
+   timer.stop();
+   logger_->debug("Texture atlas updated in {}", timer.format(6, "%ws"));
+}
+
+void TextureAtlas::BufferAtlas(gl::OpenGLFunctions& gl,
+                               GLuint               texture,
+                               std::uint64_t        bufferedCount)
 {
    std::shared_lock lock(p->atlasMutex_);
 
+   // Compressed layers are uploaded if supported, otherwise the atlas is
+   // uploaded as RGBA8
+   const bool compressed =
+      !p->compressedArray_.empty() && Impl::IsCompressionSupported();
+
+   if (bufferedCount != 0u && bufferedCount >= p->layoutCount_ &&
+       !p->atlasArray_.empty())
+   {
+      if (compressed)
+      {
+         p->BufferCompressedRegions(gl, texture, bufferedCount, lock);
+         return;
+      }
+
+      // The texture has the current layout, only upload updated regions
+      std::vector<
+         std::pair<DirtyRegion, std::vector<boost::gil::rgba8_pixel_t>>>
+         regions {};
+
+      for (auto& region : p->dirtyRegions_)
+      {
+         if (region.buildCount_ <= bufferedCount)
+         {
+            continue;
+         }
+
+         const AtlasRect& rect = region.rect_;
+         auto&            pixelData =
+            regions
+               .emplace_back(region,
+                             std::vector<boost::gil::rgba8_pixel_t>(
+                                static_cast<std::size_t>(rect.width_ *
+                                                         rect.height_)))
+               .second;
+
+         boost::gil::copy_pixels(
+            boost::gil::subimage_view(
+               boost::gil::const_view(p->atlasArray_[region.layer_]),
+               static_cast<int>(rect.x_),
+               static_cast<int>(rect.y_),
+               static_cast<int>(rect.width_),
+               static_cast<int>(rect.height_)),
+            boost::gil::interleaved_view(
+               rect.width_,
+               rect.height_,
+               pixelData.data(),
+               rect.width_ * sizeof(boost::gil::rgba8_pixel_t)));
+      }
+
+      lock.unlock();
+
+      gl.glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+
+      for (auto& [region, pixelData] : regions)
+      {
+         gl.glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
+                            0,
+                            static_cast<GLint>(region.rect_.x_),
+                            static_cast<GLint>(region.rect_.y_),
+                            static_cast<GLint>(region.layer_),
+                            static_cast<GLsizei>(region.rect_.width_),
+                            static_cast<GLsizei>(region.rect_.height_),
+                            1,
+                            GL_RGBA,
+                            GL_UNSIGNED_BYTE,
+                            pixelData.data());
+      }
+
+      return;
+   }
+
+   if (compressed)
+   {
+      p->BufferCompressedAtlas(gl, texture, lock);
+      return;
+   }
+
    if (p->atlasArray_.size() > 0u && p->atlasArray_[0].width() > 0 &&
        p->atlasArray_[0].height() > 0)
    {
@@ -362,18 +871,284 @@ void TextureAtlas::BufferAtlas(gl::OpenGLFunctions& gl, GLuint texture)
                       GL_RGBA,
                       GL_UNSIGNED_BYTE,
                       pixelData.data());
+
+      p->textureMemory_.set_bytes(pixelData.size() *
+                                  sizeof(boost::gil::rgba8_pixel_t));
+   }
+}
+
+void TextureAtlas::Impl::BufferCompressedRegions(
+   gl::OpenGLFunctions&                 gl,
+   GLuint                               texture,
+   std::uint64_t                        bufferedCount,
+   std::shared_lock<std::shared_mutex>& lock)
+{
+   constexpr auto kBlockDimension =
+      static_cast<std::ptrdiff_t>(kCompressedBlockDimension);
+
+   const std::ptrdiff_t blocksPerRow = atlasArray_[0].width() / kBlockDimension;
+   const std::ptrdiff_t blockRows = atlasArray_[0].height() / kBlockDimension;
+
+   // Regions are expanded to whole blocks
+   std::vector<std::pair<DirtyRegion, std::vector<std::uint8_t>>> regions {};
+
+   for (auto& region : dirtyRegions_)
+   {
+      if (region.buildCount_ <= bufferedCount)
+      {
+         continue;
+      }
+
+      const AtlasRect&     rect      = region.rect_;
+      const std::ptrdiff_t blockLeft = rect.x_ / kBlockDimension;
+      const std::ptrdiff_t blockTop  = rect.y_ / kBlockDimension;
+      const std::ptrdiff_t blockRight =
+         std::min((rect.x_ + rect.width_ + kBlockDimension - 1) /
+                     kBlockDimension,
+                  blocksPerRow);
+      const std::ptrdiff_t blockBottom =
+         std::min((rect.y_ + rect.height_ + kBlockDimension - 1) /
+                     kBlockDimension,
+                  blockRows);
+      const std::size_t rowSize =
+         static_cast<std::size_t>(blockRight - blockLeft) *
+         kCompressedBlockSize;
+
+      auto& blockData =
+         regions
+            .emplace_back(
+               DirtyRegion {region.buildCount_,
+                            region.layer_,
+                            {blockLeft * kBlockDimension,
+                             blockTop * kBlockDimension,
+                             (blockRight - blockLeft) * kBlockDimension,
+                             (blockBottom - blockTop) * kBlockDimension}},
+               std::vector<std::uint8_t>(
+                  rowSize * static_cast<std::size_t>(blockBottom - blockTop)))
+            .second;
+
+      const std::vector<std::uint8_t>& layerBlocks =
+         compressedArray_[region.layer_];
+
+      for (std::ptrdiff_t blockY = blockTop; blockY < blockBottom; ++blockY)
+      {
+         auto rowBegin = layerBlocks.cbegin() +
+                         (blockY * blocksPerRow + blockLeft) *
+                            static_cast<std::ptrdiff_t>(kCompressedBlockSize);
+
+         std::copy(rowBegin,
+                   rowBegin + static_cast<std::ptrdiff_t>(rowSize),
+                   blockData.begin() +
+                      (blockY - blockTop) *
+                         static_cast<std::ptrdiff_t>(rowSize));
+      }
    }
+
+   lock.unlock();
+
+   gl.glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+
+   for (auto& [region, blockData] : regions)
+   {
+      gl.glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY,
+                                   0,
+                                   static_cast<GLint>(region.rect_.x_),
+                                   static_cast<GLint>(region.rect_.y_),
+                                   static_cast<GLint>(region.layer_),
+                                   static_cast<GLsizei>(region.rect_.width_),
+                                   static_cast<GLsizei>(region.rect_.height_),
+                                   1,
+                                   GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,
+                                   static_cast<GLsizei>(blockData.size()),
+                                   blockData.data());
+   }
+}
+
+void TextureAtlas::Impl::BufferCompressedAtlas(
+   gl::OpenGLFunctions&                 gl,
+   GLuint                               texture,
+   std::shared_lock<std::shared_mutex>& lock)
+{
+   const std::size_t numLayers = atlasArray_.size();
+   const std::size_t width     = atlasArray_[0].width();
+   const std::size_t height    = atlasArray_[0].height();
+   const std::size_t layerSize = GetCompressedSize(width, height);
+
+   std::vector<std::uint8_t> blockData(layerSize * numLayers);
+
+   for (std::size_t i = 0; i < numLayers; ++i)
+   {
+      std::copy(compressedArray_[i].cbegin(),
+                compressedArray_[i].cend(),
+                blockData.begin() + static_cast<std::ptrdiff_t>(i * layerSize));
+   }
+
+   lock.unlock();
+
+   gl.glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+
+   gl.glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+   gl.glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+   gl.glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+   gl.glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+   gl.glCompressedTexImage3D(GL_TEXTURE_2D_ARRAY,
+                             0,
+                             GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,
+                             static_cast<GLsizei>(width),
+                             static_cast<GLsizei>(height),
+                             static_cast<GLsizei>(numLayers),
+                             0,
+                             static_cast<GLsizei>(blockData.size()),
+                             blockData.data());
+
+   textureMemory_.set_bytes(blockData.size());
+}
+
+bool TextureAtlas::Impl::IsCompressionSupported()
+{
+   QOpenGLContext* context = QOpenGLContext::currentContext();
+
+   return context != nullptr &&
+          context->hasExtension("GL_EXT_texture_compression_s3tc");
+}
+
+bool TextureAtlas::Impl::AllocateRect(std::size_t          layer,
+                                      std::ptrdiff_t       width,
+                                      std::ptrdiff_t       height,
+                                      boost::gil::point_t& position)
+{
+   std::vector<AtlasRect>& freeRects = freeRects_[layer];
+
+   // Best short side fit
+   auto           bestIt  = freeRects.end();
+   std::ptrdiff_t bestFit = std::numeric_limits<std::ptrdiff_t>::max();
+
+   for (auto it = freeRects.begin(); it != freeRects.end(); ++it)
+   {
+      if (it->width_ >= width && it->height_ >= height)
+      {
+         std::ptrdiff_t fit =
+            std::min(it->width_ - width, it->height_ - height);
+         if (fit < bestFit)
+         {
+            bestIt  = it;
+            bestFit = fit;
+         }
+      }
+   }
+
+   if (bestIt == freeRects.end())
+   {
+      return false;
+   }
+
+   const AtlasRect rect = *bestIt;
+   freeRects.erase(bestIt);
+
+   position = {rect.x_, rect.y_};
+
+   // Split the remaining space along the shorter leftover axis
+   AtlasRect right {};
+   AtlasRect bottom {};
+   if (rect.width_ - width < rect.height_ - height)
+   {
+      right  = {rect.x_ + width, rect.y_, rect.width_ - width, height};
+      bottom = {rect.x_, rect.y_ + height, rect.width_, rect.height_ - height};
+   }
+   else
+   {
+      right  = {rect.x_ + width, rect.y_, rect.width_ - width, rect.height_};
+      bottom = {rect.x_, rect.y_ + height, width, rect.height_ - height};
+   }
+
+   for (const AtlasRect& r : {right, bottom})
+   {
+      if (r.width_ > 0 && r.height_ > 0)
+      {
+         freeRects.push_back(r);
+      }
+   }
+
+   return true;
+}
+
+void TextureAtlas::Impl::FreeRect(std::size_t layer, const AtlasRect& rect)
+{
+   std::vector<AtlasRect>& freeRects = freeRects_[layer];
+
+   AtlasRect merged = rect;
+
+   // Merge with free rectangles sharing a full edge, until none remain
+   bool mergedAny = true;
+   while (mergedAny)
+   {
+      mergedAny = false;
+
+      for (auto it = freeRects.begin(); it != freeRects.end(); ++it)
+      {
+         const AtlasRect& r = *it;
+
+         if (r.x_ == merged.x_ && r.width_ == merged.width_ &&
+             (r.y_ + r.height_ == merged.y_ ||
+              merged.y_ + merged.height_ == r.y_))
+         {
+            merged.y_ = std::min(r.y_, merged.y_);
+            merged.height_ += r.height_;
+         }
+         else if (r.y_ == merged.y_ && r.height_ == merged.height_ &&
+                  (r.x_ + r.width_ == merged.x_ ||
+                   merged.x_ + merged.width_ == r.x_))
+         {
+            merged.x_ = std::min(r.x_, merged.x_);
+            merged.width_ += r.width_;
+         }
+         else
+         {
+            continue;
+         }
+
+         freeRects.erase(it);
+         mergedAny = true;
+         break;
+      }
+   }
+
+   freeRects.push_back(merged);
 }
 
 TextureAttributes TextureAtlas::GetTextureAttributes(const std::string& name)
 {
    TextureAttributes attr {};
-   std::shared_lock  lock(p->atlasMutex_);
 
-   const auto& it = p->atlasMap_.find(name);
-   if (it != p->atlasMap_.cend())
    {
-      attr = it->second;
+      std::shared_lock lock(p->atlasMutex_);
+
+      const auto& it = p->atlasMap_.find(name);
+      if (it != p->atlasMap_.cend())
+      {
+         return it->second;
+      }
+   }
+
+   // Load the texture if it is registered, but has not yet been referenced
+   bool pending;
+   {
+      std::shared_lock lock(p->registeredTextureMutex_);
+      pending = p->pendingTextures_.contains(name);
+   }
+
+   if (pending)
+   {
+      LoadTextures({name});
+
+      std::shared_lock lock(p->atlasMutex_);
+
+      const auto& it = p->atlasMap_.find(name);
+      if (it != p->atlasMap_.cend())
+      {
+         attr = it->second;
+      }
    }
 
    return attr;
@@ -407,9 +1182,9 @@ TextureAtlas::Impl::LoadImage(const std::string& imagePath)
    }
    else
    {
-      auto response = cpr::Get(cpr::Url {imagePath}, network::cpr::GetHeader());
+      std::string imageData = FetchImageData(imagePath);
 
-      if (cpr::status::is_success(response.status_code))
+      if (!imageData.empty())
       {
          // Use stbi, since we can only guess the image format
          static constexpr int desiredChannels = 4;
@@ -419,9 +1194,9 @@ TextureAtlas::Impl::LoadImage(const std::string& imagePath)
          int numChannels;
 
          unsigned char* pixelData = stbi_load_from_memory(
-            reinterpret_cast<const unsigned char*>(response.text.data()),
+            reinterpret_cast<const unsigned char*>(imageData.data()),
             static_cast<int>(
-               std::clamp<std::size_t>(response.text.size(), 0, INT32_MAX)),
+               std::clamp<std::size_t>(imageData.size(), 0, INT32_MAX)),
             &width,
             &height,
             &numChannels,
@@ -464,17 +1239,134 @@ TextureAtlas::Impl::LoadImage(const std::string& imagePath)
 
          stbi_image_free(pixelData);
       }
-      else if (response.status_code == 0)
+   }
+
+   return image;
+}
+
+const std::string& TextureAtlas::Impl::ImageCachePath()
+{
+   static const std::string cachePath = []()
+   {
+      std::string path {
+         QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            .toStdString() +
+         "/images"};
+
+      std::error_code error;
+      if (!std::filesystem::exists(path, error) &&
+          !std::filesystem::create_directories(path, error))
       {
-         logger_->error("Error loading image: {}", response.error.message);
+         logger_->error("Unable to create image cache directory: \"{}\" ({})",
+                        path,
+                        error.message());
+         return std::string {};
       }
-      else
+
+      return path + "/";
+   }();
+
+   return cachePath;
+}
+
+std::string TextureAtlas::Impl::FetchImageData(const std::string& imageUrl)
+{
+   // Downloaded images are cached on disk by URL, along with their validators
+   // on the following line, so they are only downloaded again when modified
+   std::string imagePath {};
+   std::string validatorsPath {};
+
+   const std::string& cachePath = ImageCachePath();
+   if (!cachePath.empty())
+   {
+      imagePath = fmt::format(
+         "{}{:016x}", cachePath, std::hash<std::string> {}(imageUrl));
+      validatorsPath = imagePath + ".validators";
+   }
+
+   const auto readCachedImage = [&]()
+   {
+      std::string   imageData {};
+      std::ifstream ifs {imagePath, std::ios::binary};
+      if (ifs.is_open())
+      {
+         imageData.assign(std::istreambuf_iterator<char>(ifs),
+                          std::istreambuf_iterator<char>());
+      }
+      return imageData;
+   };
+
+   network::cpr::Validators validators {};
+   bool                     isCached = false;
+
+   if (!imagePath.empty())
+   {
+      std::error_code error;
+      std::ifstream   ifs {validatorsPath};
+      isCached = std::filesystem::exists(imagePath, error) && ifs.is_open();
+
+      if (isCached)
       {
-         logger_->error("Error loading image: {}", response.status_line);
+         std::getline(ifs, validators.eTag_);
+         std::getline(ifs, validators.lastModified_);
       }
    }
 
-   return image;
+   auto header = network::cpr::GetHeader();
+   if (isCached)
+   {
+      header = network::cpr::ConditionalHeader(header, validators);
+   }
+
+   auto response = network::cpr::Get(cpr::Url {imageUrl}, header);
+
+   if (isCached && response.status_code == cpr::status::HTTP_NOT_MODIFIED)
+   {
+      logger_->debug("Image not modified: {}", imageUrl);
+      return readCachedImage();
+   }
+
+   if (cpr::status::is_success(response.status_code))
+   {
+      validators = network::cpr::GetValidators(response);
+
+      // Only cache images the server can validate
+      if (!imagePath.empty() &&
+          (!validators.eTag_.empty() || !validators.lastModified_.empty()))
+      {
+         std::ofstream imageFile {imagePath, std::ios::binary};
+         imageFile.write(response.text.data(),
+                         static_cast<std::streamsize>(response.text.size()));
+
+         std::ofstream validatorsFile {validatorsPath};
+         validatorsFile << validators.eTag_ << '\n'
+                        << validators.lastModified_ << '\n';
+
+         if (!imageFile.good() || !validatorsFile.good())
+         {
+            logger_->warn("Unable to cache image: {}", imageUrl);
+         }
+      }
+
+      return std::move(response.text);
+   }
+   else if (response.status_code == 0)
+   {
+      logger_->error("Error loading image: {}", response.error.message);
+   }
+   else
+   {
+      logger_->error("Error loading image: {}", response.status_line);
+   }
+
+   if (isCached)
+   {
+      // Fall back to the cached image if the server cannot be reached
+      logger_->warn("Using cached image: {}", imageUrl);
+      return readCachedImage();
+   }
+
+   return {};
 }
 
 std::shared_ptr<boost::gil::rgba8_image_t>
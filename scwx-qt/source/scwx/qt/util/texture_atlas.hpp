@@ -4,6 +4,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/gil/point.hpp>
 #include <boost/gil/typedefs.hpp>
@@ -73,12 +74,70 @@ public:
 
    std::uint64_t BuildCount() const;
 
+   /**
+    * @brief Registers a texture to be loaded when it is first referenced. The
+    * image is not decoded until the texture is requested by
+    * GetTextureAttributes() or LoadTextures().
+    *
+    * @param [in] name Texture name
+    * @param [in] path Image path
+    */
    void RegisterTexture(const std::string& name, const std::string& path);
+
+   /**
+    * @brief Loads registered textures which have not yet been loaded, decoding
+    * the images in parallel, and adds them to the atlas.
+    *
+    * @param [in] names Texture names
+    */
+   void LoadTextures(const std::vector<std::string>& names);
+
    std::shared_ptr<boost::gil::rgba8_image_t>
         CacheTexture(const std::string& name, const std::string& path);
    void BuildAtlas(std::size_t width, std::size_t height);
-   void BufferAtlas(gl::OpenGLFunctions& gl, GLuint texture);
 
+   /**
+    * @brief Sets whether the atlas is compressed. Compressed layers are
+    * encoded when the atlas is built, and uploaded in place of RGBA8 if the
+    * OpenGL context supports S3TC. Takes effect when the atlas is next built.
+    *
+    * @param [in] enabled Compression enabled
+    */
+   void SetCompressionEnabled(bool enabled);
+
+   /**
+    * @brief Adds textures cached since the atlas was built to free space in
+    * the atlas, without moving the textures already packed. Changed textures
+    * are replaced in place, and the space of textures no longer cached is
+    * reused. The atlas is rebuilt if it is a different size, or is full.
+    *
+    * @param [in] width Atlas width
+    * @param [in] height Atlas height
+    */
+   void UpdateAtlas(std::size_t width, std::size_t height);
+
+   /**
+    * @brief Uploads the atlas to a texture array.
+    *
+    * @param [in] gl OpenGL functions
+    * @param [in] texture Texture array
+    * @param [in] bufferedCount Build count of the atlas previously uploaded to
+    * the texture. If the atlas layout has not changed since, only the regions
+    * modified since are uploaded.
+    */
+   void BufferAtlas(gl::OpenGLFunctions& gl,
+                    GLuint               texture,
+                    std::uint64_t        bufferedCount = 0u);
+
+   /**
+    * @brief Gets the attributes of a texture in the atlas. A registered texture
+    * is loaded and added to the atlas the first time it is referenced.
+    *
+    * @param [in] name Texture name
+    *
+    * @return Texture attributes, which are not valid if the texture is not in
+    * the atlas
+    */
    TextureAttributes GetTextureAttributes(const std::string& name);
 
 private:
@@ -0,0 +1,340 @@
+#include <scwx/qt/util/texture_compression.hpp>
+#include <scwx/util/digest.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <execution>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+
+#include <boost/gil.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/range/irange.hpp>
+#include <fmt/format.h>
+#include <stb_dxt.h>
+#include <QStandardPaths>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::texture_compression";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Compressed images retained on disk, least recently used are removed first
+static constexpr std::size_t kMaxCachedImages_ = 16u;
+
+static const std::string& CompressedImageCachePath();
+static std::string GetCachedImagePath(const boost::gil::rgba8c_view_t& view);
+static bool        ReadCachedImage(const std::string&         path,
+                                   std::vector<std::uint8_t>& blocks);
+static void        WriteCachedImage(const std::string&               path,
+                                    const std::vector<std::uint8_t>& blocks);
+static void        PruneCachedImages();
+static void        CompressBlocks(const boost::gil::rgba8c_view_t& view,
+                                  std::ptrdiff_t                   blockLeft,
+                                  std::ptrdiff_t                   blockTop,
+                                  std::ptrdiff_t                   blockRight,
+                                  std::ptrdiff_t                   blockBottom,
+                                  std::vector<std::uint8_t>&       blocks);
+
+bool IsCompressibleSize(std::size_t width, std::size_t height)
+{
+   return width > 0u && height > 0u &&
+          width % kCompressedBlockDimension == 0u &&
+          height % kCompressedBlockDimension == 0u;
+}
+
+std::size_t GetCompressedSize(std::size_t width, std::size_t height)
+{
+   return (width / kCompressedBlockDimension) *
+          (height / kCompressedBlockDimension) * kCompressedBlockSize;
+}
+
+std::vector<std::uint8_t> CompressImage(const boost::gil::rgba8c_view_t& view)
+{
+   std::vector<std::uint8_t> blocks(
+      GetCompressedSize(view.width(), view.height()));
+
+   const std::string cachePath = GetCachedImagePath(view);
+
+   if (!cachePath.empty() && ReadCachedImage(cachePath, blocks))
+   {
+      logger_->debug("Compressed image read from cache");
+      return blocks;
+   }
+
+   constexpr auto kBlockDimension =
+      static_cast<std::ptrdiff_t>(kCompressedBlockDimension);
+
+   CompressBlocks(view,
+                  0,
+                  0,
+                  view.width() / kBlockDimension,
+                  view.height() / kBlockDimension,
+                  blocks);
+
+   if (!cachePath.empty())
+   {
+      WriteCachedImage(cachePath, blocks);
+      PruneCachedImages();
+   }
+
+   return blocks;
+}
+
+void CompressRegion(const boost::gil::rgba8c_view_t& view,
+                    std::ptrdiff_t                   x,
+                    std::ptrdiff_t                   y,
+                    std::ptrdiff_t                   width,
+                    std::ptrdiff_t                   height,
+                    std::vector<std::uint8_t>&       blocks)
+{
+   constexpr auto kBlockDimension =
+      static_cast<std::ptrdiff_t>(kCompressedBlockDimension);
+
+   // Expand the region to whole blocks
+   const std::ptrdiff_t blockLeft   = x / kBlockDimension;
+   const std::ptrdiff_t blockTop    = y / kBlockDimension;
+   const std::ptrdiff_t blockRight  = std::min(
+      (x + width + kBlockDimension - 1) / kBlockDimension,
+      view.width() / kBlockDimension);
+   const std::ptrdiff_t blockBottom = std::min(
+      (y + height + kBlockDimension - 1) / kBlockDimension,
+      view.height() / kBlockDimension);
+
+   CompressBlocks(view, blockLeft, blockTop, blockRight, blockBottom, blocks);
+}
+
+static void CompressBlocks(const boost::gil::rgba8c_view_t& view,
+                           std::ptrdiff_t                   blockLeft,
+                           std::ptrdiff_t                   blockTop,
+                           std::ptrdiff_t                   blockRight,
+                           std::ptrdiff_t                   blockBottom,
+                           std::vector<std::uint8_t>&       blocks)
+{
+   static constexpr auto kBlockDimension =
+      static_cast<std::ptrdiff_t>(kCompressedBlockDimension);
+   static std::once_flag initFlag {};
+
+   typedef std::array<boost::gil::rgba8_pixel_t,
+                      kCompressedBlockDimension * kCompressedBlockDimension>
+      BlockTexels;
+
+   // Older versions of the encoder initialize tables on first use, which must
+   // not occur on several threads at once
+   std::call_once(initFlag,
+                  []()
+                  {
+                     BlockTexels                                    texels {};
+                     std::array<std::uint8_t, kCompressedBlockSize> block {};
+                     stb_compress_dxt_block(
+                        block.data(),
+                        reinterpret_cast<const unsigned char*>(texels.data()),
+                        1,
+                        STB_DXT_HIGHQUAL);
+                  });
+
+   const std::ptrdiff_t blocksPerRow = view.width() / kBlockDimension;
+   const auto           blockRows    = boost::irange(blockTop, blockBottom);
+
+   std::for_each(
+      std::execution::par,
+      blockRows.begin(),
+      blockRows.end(),
+      [&](std::ptrdiff_t blockY)
+      {
+         BlockTexels texels {};
+
+         for (std::ptrdiff_t blockX = blockLeft; blockX < blockRight; ++blockX)
+         {
+            boost::gil::copy_pixels(
+               boost::gil::subimage_view(view,
+                                         static_cast<int>(blockX *
+                                                          kBlockDimension),
+                                         static_cast<int>(blockY *
+                                                          kBlockDimension),
+                                         static_cast<int>(kBlockDimension),
+                                         static_cast<int>(kBlockDimension)),
+               boost::gil::interleaved_view(
+                  kBlockDimension,
+                  kBlockDimension,
+                  texels.data(),
+                  kBlockDimension * sizeof(boost::gil::rgba8_pixel_t)));
+
+            stb_compress_dxt_block(
+               blocks.data() +
+                  (blockY * blocksPerRow + blockX) * kCompressedBlockSize,
+               reinterpret_cast<const unsigned char*>(texels.data()),
+               1,
+               STB_DXT_HIGHQUAL);
+         }
+      });
+}
+
+static const std::string& CompressedImageCachePath()
+{
+   static const std::string cachePath = []()
+   {
+      std::string path {
+         QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            .toStdString() +
+         "/textures"};
+
+      std::error_code error;
+      if (!std::filesystem::exists(path, error) &&
+          !std::filesystem::create_directories(path, error))
+      {
+         logger_->error(
+            "Unable to create compressed texture cache directory: \"{}\" ({})",
+            path,
+            error.message());
+         return std::string {};
+      }
+
+      return path + "/";
+   }();
+
+   return cachePath;
+}
+
+static std::string GetCachedImagePath(const boost::gil::rgba8c_view_t& view)
+{
+   const std::string& cachePath = CompressedImageCachePath();
+
+   if (cachePath.empty() || !view.is_1d_traversable())
+   {
+      return {};
+   }
+
+   const char* pixelData = reinterpret_cast<const char*>(
+      boost::gil::interleaved_view_get_raw_data(view));
+   const std::size_t pixelDataSize =
+      view.size() * sizeof(boost::gil::rgba8_pixel_t);
+
+   boost::iostreams::stream<boost::iostreams::array_source> is {pixelData,
+                                                                pixelDataSize};
+   std::vector<std::uint8_t> digest {};
+
+   if (!scwx::util::ComputeDigest(EVP_sha256(), is, digest))
+   {
+      return {};
+   }
+
+   std::string digestString {};
+   for (std::uint8_t byte : digest)
+   {
+      digestString += fmt::format("{:02x}", byte);
+   }
+
+   return fmt::format(
+      "{}{}x{}-{}.bc3", cachePath, view.width(), view.height(), digestString);
+}
+
+static bool ReadCachedImage(const std::string&         path,
+                            std::vector<std::uint8_t>& blocks)
+{
+   std::error_code error;
+
+   if (std::filesystem::file_size(path, error) != blocks.size() || error)
+   {
+      return false;
+   }
+
+   std::ifstream ifs {path, std::ios_base::in | std::ios_base::binary};
+   ifs.read(reinterpret_cast<char*>(blocks.data()),
+            static_cast<std::streamsize>(blocks.size()));
+
+   if (!ifs.good())
+   {
+      logger_->warn("Unable to read compressed image: {}", path);
+      return false;
+   }
+
+   // Mark the image as recently used
+   std::filesystem::last_write_time(
+      path, std::filesystem::file_time_type::clock::now(), error);
+
+   return true;
+}
+
+static void WriteCachedImage(const std::string&               path,
+                             const std::vector<std::uint8_t>& blocks)
+{
+   // Write to a temporary file, such that a partially written image is not read
+   const std::string tempPath = path + ".tmp";
+
+   {
+      std::ofstream ofs {tempPath,
+                         std::ios_base::out | std::ios_base::binary |
+                            std::ios_base::trunc};
+      ofs.write(reinterpret_cast<const char*>(blocks.data()),
+                static_cast<std::streamsize>(blocks.size()));
+
+      if (!ofs.good())
+      {
+         logger_->warn("Unable to write compressed image: {}", tempPath);
+         ofs.close();
+         std::error_code error;
+         std::filesystem::remove(tempPath, error);
+         return;
+      }
+   }
+
+   std::error_code error;
+   std::filesystem::rename(tempPath, path, error);
+
+   if (error)
+   {
+      logger_->warn("Unable to write compressed image: {} ({})",
+                    path,
+                    error.message());
+      std::filesystem::remove(tempPath, error);
+   }
+}
+
+static void PruneCachedImages()
+{
+   typedef std::pair<std::filesystem::file_time_type, std::filesystem::path>
+      CachedImage;
+
+   std::vector<CachedImage> images {};
+   std::error_code          error;
+
+   for (auto& entry : std::filesystem::directory_iterator(
+           CompressedImageCachePath(), error))
+   {
+      if (entry.is_regular_file(error) &&
+          entry.path().extension() == ".bc3")
+      {
+         images.emplace_back(entry.last_write_time(error), entry.path());
+      }
+   }
+
+   if (images.size() <= kMaxCachedImages_)
+   {
+      return;
+   }
+
+   // Remove the least recently used images
+   std::sort(images.begin(),
+             images.end(),
+             [](const auto& a, const auto& b) { return a.first > b.first; });
+
+   for (auto it = images.begin() + kMaxCachedImages_; it != images.end(); ++it)
+   {
+      SPDLOG_LOGGER_TRACE(
+         logger_, "Removing compressed image: {}", it->second.string());
+      std::filesystem::remove(it->second, error);
+   }
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
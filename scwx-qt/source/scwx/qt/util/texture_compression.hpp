@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <boost/gil/typedefs.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Width and height of a compressed block in texels.
+ */
+static constexpr std::size_t kCompressedBlockDimension = 4u;
+
+/**
+ * @brief Size of a compressed block in bytes. Images are compressed as S3TC
+ * DXT5 (BC3), which stores each block of 4x4 texels in 16 bytes, one quarter
+ * the size of RGBA8.
+ */
+static constexpr std::size_t kCompressedBlockSize = 16u;
+
+/**
+ * @brief Determines whether an image of the given size may be compressed.
+ * Both dimensions must be a multiple of the block dimension.
+ *
+ * @param [in] width Image width
+ * @param [in] height Image height
+ *
+ * @return true if the image may be compressed
+ */
+bool IsCompressibleSize(std::size_t width, std::size_t height);
+
+/**
+ * @brief Gets the size of a compressed image.
+ *
+ * @param [in] width Image width, a multiple of the block dimension
+ * @param [in] height Image height, a multiple of the block dimension
+ *
+ * @return Size in bytes
+ */
+std::size_t GetCompressedSize(std::size_t width, std::size_t height);
+
+/**
+ * @brief Compresses an image. Compressed images are cached on disk by the
+ * digest of their pixel data, such that an unchanged image is only compressed
+ * once.
+ *
+ * @param [in] view Image, whose dimensions are a multiple of the block
+ * dimension
+ *
+ * @return Compressed blocks in row major order
+ */
+std::vector<std::uint8_t> CompressImage(const boost::gil::rgba8c_view_t& view);
+
+/**
+ * @brief Compresses the blocks of an image overlapping a region, replacing
+ * them in previously compressed blocks of the entire image.
+ *
+ * @param [in] view Image, whose dimensions are a multiple of the block
+ * dimension
+ * @param [in] x Left edge of the region
+ * @param [in] y Top edge of the region
+ * @param [in] width Region width
+ * @param [in] height Region height
+ * @param [in,out] blocks Compressed blocks of the entire image in row major
+ * order
+ */
+void CompressRegion(const boost::gil::rgba8c_view_t& view,
+                    std::ptrdiff_t                   x,
+                    std::ptrdiff_t                   y,
+                    std::ptrdiff_t                   width,
+                    std::ptrdiff_t                   height,
+                    std::vector<std::uint8_t>&       blocks);
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,92 @@
+#include <scwx/qt/view/color_table_cache.hpp>
+#include <scwx/qt/util/file.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string logPrefix_ = "scwx::qt::view::color_table_cache";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+class ColorTableCache::Impl
+{
+public:
+   typedef std::pair<std::string, std::filesystem::file_time_type> Key;
+
+   explicit Impl() {}
+   ~Impl() {}
+
+   std::map<Key, std::weak_ptr<common::ColorTable>> colorTables_ {};
+   mutable std::mutex                               colorTablesMutex_ {};
+};
+
+ColorTableCache::ColorTableCache() : p(std::make_unique<Impl>()) {}
+ColorTableCache::~ColorTableCache() = default;
+
+std::size_t ColorTableCache::size() const
+{
+   std::unique_lock lock {p->colorTablesMutex_};
+   return p->colorTables_.size();
+}
+
+std::shared_ptr<common::ColorTable>
+ColorTableCache::Load(const std::string& filename)
+{
+   // Qt resources cannot be modified, and have no modification time
+   std::filesystem::file_time_type modifiedTime {};
+
+   if (!filename.starts_with(':'))
+   {
+      std::error_code error;
+      modifiedTime = std::filesystem::last_write_time(filename, error);
+
+      if (error)
+      {
+         // The file cannot be opened, and is parsed as an invalid table
+         logger_->warn("Unable to read color table: \"{}\" ({})",
+                       filename,
+                       error.message());
+         return common::ColorTable::Load(*util::OpenFile(filename));
+      }
+   }
+
+   // Color tables are small, and are parsed while holding the lock so that
+   // views requesting the same table concurrently parse it once
+   std::unique_lock lock {p->colorTablesMutex_};
+
+   std::erase_if(p->colorTables_,
+                 [](const auto& entry) { return entry.second.expired(); });
+
+   auto& entry = p->colorTables_[{filename, modifiedTime}];
+
+   std::shared_ptr<common::ColorTable> colorTable = entry.lock();
+   if (colorTable != nullptr)
+   {
+      SPDLOG_LOGGER_TRACE(logger_, "Using cached color table: {}", filename);
+      return colorTable;
+   }
+
+   colorTable = common::ColorTable::Load(*util::OpenFile(filename));
+   entry      = colorTable;
+
+   return colorTable;
+}
+
+ColorTableCache& ColorTableCache::Instance()
+{
+   static ColorTableCache colorTableCache_ {};
+   return colorTableCache_;
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <scwx/common/color_table.hpp>
+
+#include <memory>
+#include <string>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+/**
+ * @brief Shares parsed color tables between product views. Tables are keyed by
+ * file name and modification time, such that an edited file is parsed again.
+ * Entries are held weakly, and expire once no view references them.
+ */
+class ColorTableCache
+{
+public:
+   explicit ColorTableCache();
+   ~ColorTableCache();
+
+   ColorTableCache(const ColorTableCache&)            = delete;
+   ColorTableCache& operator=(const ColorTableCache&) = delete;
+
+   ColorTableCache(ColorTableCache&&)            = delete;
+   ColorTableCache& operator=(ColorTableCache&&) = delete;
+
+   std::size_t size() const;
+
+   /**
+    * @brief Gets a parsed color table, loading and caching it if no view
+    * currently references the current version of the file.
+    *
+    * @param filename Color table file name, or Qt resource path
+    *
+    * @return Color table, which is not valid if the file could not be parsed
+    */
+   std::shared_ptr<common::ColorTable> Load(const std::string& filename);
+
+   static ColorTableCache& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
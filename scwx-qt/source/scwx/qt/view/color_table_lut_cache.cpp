@@ -0,0 +1,72 @@
+#include <scwx/qt/view/color_table_lut_cache.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <map>
+#include <mutex>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string logPrefix_ = "scwx::qt::view::color_table_lut_cache";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+class ColorTableLutCache::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() {}
+
+   std::map<ColorTableLutKey, std::weak_ptr<const ColorTableLut>> luts_ {};
+   mutable std::mutex lutsMutex_ {};
+};
+
+ColorTableLutCache::ColorTableLutCache() : p(std::make_unique<Impl>()) {}
+ColorTableLutCache::~ColorTableLutCache() = default;
+
+std::size_t ColorTableLutCache::size() const
+{
+   std::unique_lock lock {p->lutsMutex_};
+   return p->luts_.size();
+}
+
+std::shared_ptr<const ColorTableLut>
+ColorTableLutCache::GetOrBuild(const ColorTableLutKey& key,
+                               const BuildFunction&    build)
+{
+   // Lookup tables are small, and are built while holding the lock so that
+   // views requesting the same table concurrently build it once
+   std::unique_lock lock {p->lutsMutex_};
+
+   std::erase_if(p->luts_,
+                 [](const auto& entry) { return entry.second.expired(); });
+
+   auto& entry = p->luts_[key];
+
+   std::shared_ptr<const ColorTableLut> lut = entry.lock();
+   if (lut != nullptr)
+   {
+      SPDLOG_LOGGER_TRACE(logger_,
+                          "Using cached color table LUT: {}",
+                          key.product_);
+      return lut;
+   }
+
+   lut   = build();
+   entry = lut;
+
+   return lut;
+}
+
+ColorTableLutCache& ColorTableLutCache::Instance()
+{
+   static ColorTableLutCache colorTableLutCache_ {};
+   return colorTableLutCache_;
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
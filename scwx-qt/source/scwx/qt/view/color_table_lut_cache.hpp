@@ -0,0 +1,95 @@
+#pragma once
+
+#include <scwx/common/color_table.hpp>
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/gil/typedefs.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+struct ColorTableLutKey
+{
+   const common::ColorTable*     colorTable_ {nullptr};
+   std::string                   product_ {};
+   std::int16_t                  productCode_ {};
+   float                         offset_ {};
+   float                         scale_ {};
+   float                         logOffset_ {};
+   float                         logScale_ {};
+   std::uint16_t                 logStart_ {};
+   std::uint16_t                 threshold_ {};
+   std::uint16_t                 numberOfLevels_ {};
+   std::uint16_t                 rangeMin_ {};
+   std::uint16_t                 rangeMax_ {};
+   std::array<std::uint16_t, 16> dataLevelThresholds_ {};
+
+   auto operator<=>(const ColorTableLutKey&) const = default;
+};
+
+/**
+ * @brief Color table lookup table, mapping data moments in [min, max] to
+ * colors.
+ */
+struct ColorTableLut
+{
+   std::shared_ptr<common::ColorTable>    colorTable_ {};
+   std::vector<boost::gil::rgba8_pixel_t> lut_ {};
+   std::uint16_t                          min_ {};
+   std::uint16_t                          max_ {};
+};
+
+/**
+ * @brief Shares color table lookup tables between product views. Entries are
+ * held weakly, and expire once no view references them.
+ */
+class ColorTableLutCache
+{
+public:
+   typedef std::function<std::shared_ptr<const ColorTableLut>()> BuildFunction;
+
+   explicit ColorTableLutCache();
+   ~ColorTableLutCache();
+
+   ColorTableLutCache(const ColorTableLutCache&)            = delete;
+   ColorTableLutCache& operator=(const ColorTableLutCache&) = delete;
+
+   ColorTableLutCache(ColorTableLutCache&&)            = delete;
+   ColorTableLutCache& operator=(ColorTableLutCache&&) = delete;
+
+   std::size_t size() const;
+
+   /**
+    * @brief Gets a cached lookup table, building and caching it if no view
+    * currently references one for the key.
+    *
+    * @param key Lookup table key
+    * @param build Builds the lookup table if it is not cached
+    *
+    * @return Lookup table to use
+    */
+   std::shared_ptr<const ColorTableLut> GetOrBuild(const ColorTableLutKey& key,
+                                                   const BuildFunction& build);
+
+   static ColorTableLutCache& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
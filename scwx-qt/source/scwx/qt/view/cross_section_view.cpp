@@ -0,0 +1,351 @@
+#include <scwx/qt/view/cross_section_view.hpp>
+#include <scwx/qt/settings/palette_settings.hpp>
+#include <scwx/qt/util/cross_section.hpp>
+#include <scwx/qt/view/color_table_cache.hpp>
+#include <scwx/common/color_table.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/strand.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string logPrefix_ = "scwx::qt::view::cross_section_view";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr std::uint16_t RANGE_FOLDED = 1u;
+
+static constexpr double kDefaultMaxHeight_ = 20000.0;
+
+static const std::unordered_map<common::Level2Product,
+                                wsr88d::rda::DataBlockType>
+   blockTypes_ {
+      {common::Level2Product::Reflectivity,
+       wsr88d::rda::DataBlockType::MomentRef},
+      {common::Level2Product::Velocity, wsr88d::rda::DataBlockType::MomentVel},
+      {common::Level2Product::SpectrumWidth,
+       wsr88d::rda::DataBlockType::MomentSw},
+      {common::Level2Product::DifferentialReflectivity,
+       wsr88d::rda::DataBlockType::MomentZdr},
+      {common::Level2Product::DifferentialPhase,
+       wsr88d::rda::DataBlockType::MomentPhi},
+      {common::Level2Product::CorrelationCoefficient,
+       wsr88d::rda::DataBlockType::MomentRho},
+      {common::Level2Product::ClutterFilterPowerRemoved,
+       wsr88d::rda::DataBlockType::MomentCfp},
+      {common::Level2Product::DealiasedVelocity,
+       wsr88d::rda::DataBlockType::MomentVel},
+      {common::Level2Product::StormRelativeVelocity,
+       wsr88d::rda::DataBlockType::MomentVel},
+      {common::Level2Product::CompositeReflectivity,
+       wsr88d::rda::DataBlockType::MomentRef}};
+
+struct CrossSectionParameters
+{
+   common::Level2Product product_ {common::Level2Product::Reflectivity};
+
+   std::shared_ptr<wsr88d::Ar2vFile> volume_ {};
+   common::Coordinate                radarSite_ {};
+   bool                              lineSet_ {false};
+   common::Coordinate                start_ {};
+   common::Coordinate                end_ {};
+   std::size_t                       columns_ {};
+   std::size_t                       rows_ {};
+   double                            maxHeight_ {kDefaultMaxHeight_};
+};
+
+struct CachedElevation
+{
+   std::shared_ptr<wsr88d::rda::ElevationScan>         scan_ {};
+   std::size_t                                         radials_ {};
+   std::shared_ptr<const util::ElevationScanInspector> inspector_ {};
+};
+
+class CrossSectionView::Impl
+{
+public:
+   explicit Impl(CrossSectionView* self) : self_ {self} {}
+   ~Impl() { strand_.Join(); }
+
+   void   Compute();
+   void   LoadColorTable(common::Level2Product product);
+   QImage CreateImage(const util::CrossSectionGrid& grid) const;
+
+   std::vector<util::CrossSectionElevation>
+   GetElevations(const CrossSectionParameters& parameters,
+                 wsr88d::rda::DataBlockType    dataBlockType);
+
+   CrossSectionView* self_;
+
+   scwx::util::Strand strand_ {"Cross Section View"};
+   std::atomic<bool>  updatePending_ {false};
+
+   std::mutex             parametersMutex_ {};
+   CrossSectionParameters parameters_ {};
+
+   // Azimuth indices and the color table are only accessed by the worker
+   // thread
+   std::shared_ptr<wsr88d::Ar2vFile> cachedVolume_ {};
+   wsr88d::rda::DataBlockType        cachedDataBlockType_ {
+      wsr88d::rda::DataBlockType::Unknown};
+   std::map<float, CachedElevation> cachedElevations_ {};
+
+   common::Level2Product colorTableProduct_ {common::Level2Product::Unknown};
+   std::shared_ptr<common::ColorTable> colorTable_ {};
+
+   mutable std::mutex imageMutex_ {};
+   QImage             image_ {};
+   double             distance_ {};
+   double             maxHeight_ {};
+};
+
+CrossSectionView::CrossSectionView(QObject* parent) :
+    QObject(parent), p(std::make_unique<Impl>(this))
+{
+}
+CrossSectionView::~CrossSectionView() = default;
+
+QImage CrossSectionView::image() const
+{
+   std::unique_lock lock {p->imageMutex_};
+   return p->image_;
+}
+
+double CrossSectionView::distance() const
+{
+   std::unique_lock lock {p->imageMutex_};
+   return p->distance_;
+}
+
+double CrossSectionView::max_height() const
+{
+   std::unique_lock lock {p->imageMutex_};
+   return p->maxHeight_;
+}
+
+void CrossSectionView::SelectProduct(common::Level2Product product)
+{
+   std::unique_lock lock {p->parametersMutex_};
+   p->parameters_.product_ = product;
+}
+
+void CrossSectionView::SelectVolume(std::shared_ptr<wsr88d::Ar2vFile> volume,
+                                    const common::Coordinate&         radarSite)
+{
+   std::unique_lock lock {p->parametersMutex_};
+   p->parameters_.volume_    = std::move(volume);
+   p->parameters_.radarSite_ = radarSite;
+}
+
+void CrossSectionView::SetLine(const common::Coordinate& start,
+                               const common::Coordinate& end)
+{
+   std::unique_lock lock {p->parametersMutex_};
+   p->parameters_.lineSet_ = true;
+   p->parameters_.start_   = start;
+   p->parameters_.end_     = end;
+}
+
+void CrossSectionView::SetSize(std::size_t columns, std::size_t rows)
+{
+   std::unique_lock lock {p->parametersMutex_};
+   p->parameters_.columns_ = columns;
+   p->parameters_.rows_    = rows;
+}
+
+void CrossSectionView::SetMaxHeight(double maxHeight)
+{
+   std::unique_lock lock {p->parametersMutex_};
+   p->parameters_.maxHeight_ = maxHeight;
+}
+
+void CrossSectionView::Update()
+{
+   // Only one update is queued at a time. An update which is already queued
+   // will use the latest parameters.
+   if (!p->updatePending_.exchange(true))
+   {
+      p->strand_.Post([this]() { p->Compute(); });
+   }
+}
+
+void CrossSectionView::Impl::Compute()
+{
+   // Parameters changed after this point will queue another update
+   updatePending_ = false;
+
+   CrossSectionParameters parameters {};
+   {
+      std::unique_lock lock {parametersMutex_};
+      parameters = parameters_;
+   }
+
+   if (parameters.volume_ == nullptr || !parameters.lineSet_ ||
+       parameters.columns_ == 0 || parameters.rows_ == 0)
+   {
+      return;
+   }
+
+   auto it = blockTypes_.find(parameters.product_);
+   if (it == blockTypes_.cend())
+   {
+      logger_->warn("Unknown product: \"{}\"",
+                    common::GetLevel2Name(parameters.product_));
+      return;
+   }
+
+   if (parameters.product_ != colorTableProduct_)
+   {
+      LoadColorTable(parameters.product_);
+   }
+
+   const util::CrossSectionGrid grid =
+      util::ComputeCrossSection(GetElevations(parameters, it->second),
+                                it->second,
+                                parameters.start_,
+                                parameters.end_,
+                                parameters.columns_,
+                                parameters.rows_,
+                                parameters.maxHeight_);
+
+   QImage image = CreateImage(grid);
+
+   {
+      std::unique_lock lock {imageMutex_};
+      image_     = std::move(image);
+      distance_  = grid.distance_;
+      maxHeight_ = grid.maxHeight_;
+   }
+
+   Q_EMIT self_->CrossSectionComputed();
+}
+
+std::vector<util::CrossSectionElevation> CrossSectionView::Impl::GetElevations(
+   const CrossSectionParameters& parameters,
+   wsr88d::rda::DataBlockType    dataBlockType)
+{
+   static constexpr auto kLatestTime_ =
+      std::chrono::system_clock::time_point::max();
+
+   if (parameters.volume_ != cachedVolume_ ||
+       dataBlockType != cachedDataBlockType_)
+   {
+      cachedElevations_.clear();
+      cachedVolume_        = parameters.volume_;
+      cachedDataBlockType_ = dataBlockType;
+   }
+
+   const std::vector<float> elevationCuts =
+      parameters.volume_->elevation_cuts(dataBlockType);
+
+   std::vector<util::CrossSectionElevation> elevations {};
+   elevations.reserve(elevationCuts.size());
+
+   for (float cut : elevationCuts)
+   {
+      // Use the latest scan of each elevation cut
+      std::shared_ptr<wsr88d::rda::ElevationScan> scan         = nullptr;
+      float                                       elevationCut = 0.0f;
+      std::tie(scan, elevationCut) = parameters.volume_->FindElevationScan(
+         dataBlockType, cut, kLatestTime_);
+
+      if (scan == nullptr || scan->empty())
+      {
+         continue;
+      }
+
+      // Rebuild the index for a new scan, or when radials have been added to
+      // an incomplete scan
+      CachedElevation& cached = cachedElevations_[elevationCut];
+      if (cached.scan_ != scan || cached.radials_ != scan->size())
+      {
+         cached.scan_      = scan;
+         cached.radials_   = scan->size();
+         cached.inspector_ = std::make_shared<util::ElevationScanInspector>(
+            scan, parameters.radarSite_);
+      }
+
+      elevations.push_back({elevationCut, cached.inspector_});
+   }
+
+   return elevations;
+}
+
+void CrossSectionView::Impl::LoadColorTable(common::Level2Product product)
+{
+   colorTableProduct_ = product;
+   colorTable_        = nullptr;
+
+   const std::string colorTableFile =
+      settings::PaletteSettings::Instance()
+         .palette(common::GetLevel2Palette(product))
+         .GetValue();
+
+   if (!colorTableFile.empty())
+   {
+      colorTable_ = ColorTableCache::Instance().Load(colorTableFile);
+   }
+}
+
+QImage
+CrossSectionView::Impl::CreateImage(const util::CrossSectionGrid& grid) const
+{
+   QImage image(static_cast<int>(grid.columns_),
+                static_cast<int>(grid.rows_),
+                QImage::Format::Format_ARGB32);
+   image.fill(Qt::GlobalColor::transparent);
+
+   if (colorTable_ == nullptr || !colorTable_->IsValid())
+   {
+      return image;
+   }
+
+   for (std::size_t row = 0; row < grid.rows_; ++row)
+   {
+      for (std::size_t column = 0; column < grid.columns_; ++column)
+      {
+         const auto& cell = grid.cell(column, row);
+         if (!cell.has_value())
+         {
+            continue;
+         }
+
+         boost::gil::rgba8_pixel_t pixel;
+         if (cell->level_ == RANGE_FOLDED)
+         {
+            pixel = colorTable_->rf_color();
+         }
+         else if (cell->value_.has_value())
+         {
+            pixel = colorTable_->Color(*cell->value_);
+         }
+         else
+         {
+            continue;
+         }
+
+         image.setPixel(static_cast<int>(column),
+                        static_cast<int>(row),
+                        qRgba(static_cast<int>(pixel[0]),
+                              static_cast<int>(pixel[1]),
+                              static_cast<int>(pixel[2]),
+                              static_cast<int>(pixel[3])));
+      }
+   }
+
+   return image;
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+#include <scwx/common/products.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+
+#include <cstddef>
+#include <memory>
+
+#include <QImage>
+#include <QObject>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+/**
+ * @brief Builds a vertical cross section image from every elevation of a
+ * level 2 volume, along a line between two points. Cross sections are sampled
+ * on a worker thread. Requests made while a cross section is being sampled are
+ * coalesced, such that the line may be moved interactively. The azimuth index
+ * of each elevation is kept until the volume changes.
+ */
+class CrossSectionView : public QObject
+{
+   Q_OBJECT
+   Q_DISABLE_COPY_MOVE(CrossSectionView)
+
+public:
+   explicit CrossSectionView(QObject* parent = nullptr);
+   ~CrossSectionView();
+
+   /**
+    * @brief Gets the most recently computed cross section image. The top row
+    * is at the maximum height, and the left column is at the start of the
+    * line.
+    */
+   QImage image() const;
+
+   /**
+    * @brief Gets the length of the line of the most recent image (meters).
+    */
+   double distance() const;
+
+   /**
+    * @brief Gets the height above the radar of the top of the most recent
+    * image (meters).
+    */
+   double max_height() const;
+
+   /**
+    * @brief Selects a base level 2 product. Derived products are sampled from
+    * the moment from which they are derived.
+    *
+    * @param [in] product Level 2 product
+    */
+   void SelectProduct(common::Level2Product product);
+
+   /**
+    * @brief Selects the volume to sample.
+    *
+    * @param [in] volume Level 2 volume
+    * @param [in] radarSite Radar site location
+    */
+   void SelectVolume(std::shared_ptr<wsr88d::Ar2vFile> volume,
+                     const common::Coordinate&         radarSite);
+
+   /**
+    * @brief Sets the line along which the cross section is sampled.
+    *
+    * @param [in] start Start of the line
+    * @param [in] end End of the line
+    */
+   void SetLine(const common::Coordinate& start, const common::Coordinate& end);
+
+   /**
+    * @brief Sets the size of the image.
+    *
+    * @param [in] columns Columns along the line
+    * @param [in] rows Rows from the radar to the maximum height
+    */
+   void SetSize(std::size_t columns, std::size_t rows);
+
+   /**
+    * @brief Sets the height above the radar of the top of the image.
+    *
+    * @param [in] maxHeight Maximum height (meters)
+    */
+   void SetMaxHeight(double maxHeight);
+
+   /**
+    * @brief Requests the cross section be sampled with the current
+    * parameters. CrossSectionComputed is emitted when complete.
+    */
+   void Update();
+
+signals:
+   void CrossSectionComputed();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
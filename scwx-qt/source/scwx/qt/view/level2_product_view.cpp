@@ -1,15 +1,33 @@
 #include <scwx/qt/view/level2_product_view.hpp>
+#include <scwx/qt/view/level2_sweep_cache.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/settings/unit_settings.hpp>
 #include <scwx/qt/types/unit_types.hpp>
+#include <scwx/qt/util/azimuth_index.hpp>
+#include <scwx/qt/util/elevation_scan_inspector.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/characters.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/memory.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
+#include <scwx/wsr88d/rda/columnar_sweep.hpp>
+#include <scwx/wsr88d/rda/derived_product.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <execution>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <type_traits>
 
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
+#include <units/velocity.h>
 
 namespace scwx
 {
@@ -30,6 +48,12 @@ static constexpr std::uint8_t kDataWordSize8_ = 8u;
 static constexpr std::size_t kVerticesPerGate_       = 6u;
 static constexpr std::size_t kVerticesPerOriginGate_ = 3u;
 
+// Echo tops are coded in kilometers, and displayed in kilofeet
+static constexpr float kKilometersToKilofeet_ = 3.28084f;
+
+// Precipitation accumulations are coded in millimeters, and displayed in inches
+static constexpr float kMillimetersToInches_ = 0.0393701f;
+
 static constexpr uint16_t RANGE_FOLDED      = 1u;
 static constexpr uint32_t VERTICES_PER_BIN  = 6u;
 static constexpr uint32_t VALUES_PER_VERTEX = 2u;
@@ -49,14 +73,50 @@ static const std::unordered_map<common::Level2Product,
       {common::Level2Product::CorrelationCoefficient,
        wsr88d::rda::DataBlockType::MomentRho},
       {common::Level2Product::ClutterFilterPowerRemoved,
-       wsr88d::rda::DataBlockType::MomentCfp}};
+       wsr88d::rda::DataBlockType::MomentCfp},
+      {common::Level2Product::DealiasedVelocity,
+       wsr88d::rda::DataBlockType::MomentVel},
+      {common::Level2Product::StormRelativeVelocity,
+       wsr88d::rda::DataBlockType::MomentVel},
+      {common::Level2Product::CompositeReflectivity,
+       wsr88d::rda::DataBlockType::MomentRef},
+      {common::Level2Product::EchoTops,
+       wsr88d::rda::DataBlockType::MomentRef},
+      {common::Level2Product::OneHourPrecipitation,
+       wsr88d::rda::DataBlockType::MomentRef},
+      {common::Level2Product::ThreeHourPrecipitation,
+       wsr88d::rda::DataBlockType::MomentRef},
+      {common::Level2Product::StormTotalPrecipitation,
+       wsr88d::rda::DataBlockType::MomentRef}};
 
 static const std::unordered_map<common::Level2Product, std::string>
    productUnits_ {{common::Level2Product::Reflectivity, "dBZ"},
                   {common::Level2Product::DifferentialReflectivity, "dB"},
                   {common::Level2Product::DifferentialPhase, "\302\260"},
                   {common::Level2Product::CorrelationCoefficient, "%"},
-                  {common::Level2Product::ClutterFilterPowerRemoved, "dB"}};
+                  {common::Level2Product::ClutterFilterPowerRemoved, "dB"},
+                  {common::Level2Product::CompositeReflectivity, "dBZ"},
+                  {common::Level2Product::EchoTops, "kft"},
+                  {common::Level2Product::OneHourPrecipitation, "in"},
+                  {common::Level2Product::ThreeHourPrecipitation, "in"},
+                  {common::Level2Product::StormTotalPrecipitation, "in"}};
+
+template<typename T>
+static void CompactSlot(std::vector<T>& buffer,
+                        std::size_t     slotOffset,
+                        std::size_t     count,
+                        std::size_t     offset)
+{
+   if (buffer.empty() || slotOffset == offset)
+   {
+      return;
+   }
+
+   // The destination always precedes the slot, so a forward copy is safe
+   std::copy_n(buffer.begin() + static_cast<std::ptrdiff_t>(slotOffset),
+               count,
+               buffer.begin() + static_cast<std::ptrdiff_t>(offset));
+}
 
 class Level2ProductView::Impl
 {
@@ -76,15 +136,15 @@ public:
        sweepTime_ {},
        colorTable_ {},
        colorTableLut_ {},
-       colorTableMin_ {2},
-       colorTableMax_ {254},
        savedColorTable_ {nullptr},
        savedScale_ {0.0f},
        savedOffset_ {0.0f}
    {
-      auto& unitSettings = settings::UnitSettings::Instance();
+      auto& generalSettings = settings::GeneralSettings::Instance();
+      auto& unitSettings    = settings::UnitSettings::Instance();
 
       coordinates_.resize(kMaxCoordinates_);
+      quantizedCoordinates_.resize(kMaxCoordinates_);
 
       SetProduct(product);
 
@@ -95,19 +155,35 @@ public:
          unitSettings.speed_units().RegisterValueChangedCallback(
             [this](const std::string& value) { UpdateSpeedUnits(value); });
 
+      stormMotionDirectionCallbackUuid_ =
+         generalSettings.storm_motion_direction().RegisterValueChangedCallback(
+            [this](const std::int64_t&) { UpdateStormMotion(); });
+      stormMotionSpeedCallbackUuid_ =
+         generalSettings.storm_motion_speed().RegisterValueChangedCallback(
+            [this](const std::int64_t&) { UpdateStormMotion(); });
+
       UpdateOtherUnits(unitSettings.other_units().GetValue());
       UpdateSpeedUnits(unitSettings.speed_units().GetValue());
+      UpdateStormMotion();
    }
    ~Impl()
    {
-      auto& unitSettings = settings::UnitSettings::Instance();
+      auto& generalSettings = settings::GeneralSettings::Instance();
+      auto& unitSettings    = settings::UnitSettings::Instance();
 
       unitSettings.other_units().UnregisterValueChangedCallback(
          otherUnitsCallbackUuid_);
       unitSettings.speed_units().UnregisterValueChangedCallback(
          speedUnitsCallbackUuid_);
+      generalSettings.storm_motion_direction().UnregisterValueChangedCallback(
+         stormMotionDirectionCallbackUuid_);
+      generalSettings.storm_motion_speed().UnregisterValueChangedCallback(
+         stormMotionSpeedCallbackUuid_);
+
+      // Pending precomputation is abandoned
+      ++precomputeGeneration_;
 
-      threadPool_.join();
+      strand_.Join();
    };
 
    Impl(const Impl&)            = delete;
@@ -116,26 +192,145 @@ public:
    Impl(Impl&&) noexcept            = delete;
    Impl& operator=(Impl&&) noexcept = delete;
 
+   /**
+    * @brief Computed sweep output. One buffer is published for rendering
+    * while the next sweep is computed into the other.
+    */
+   struct SweepBuffer
+   {
+      std::vector<std::int16_t> vertices_ {};
+      std::vector<uint8_t>      dataMoments8_ {};
+      std::vector<uint16_t>     dataMoments16_ {};
+      std::vector<uint8_t>      cfpMoments_ {};
+
+      // Quantization of vertices_, which are offsets from the radar site
+      std::optional<RadarVertexQuantization> quantization_ {};
+
+      // If present, 16-bit data moments are stored in dataMoments8_ as
+      // display levels of the quantization
+      std::shared_ptr<const RadarMomentQuantization> momentQuantization_ {};
+
+      std::shared_ptr<const std::vector<float>> sharedVertices_ {};
+      std::shared_ptr<const RadarPolarGrid>     polarGrid_ {};
+      bool                                      hideZeroMoments_ {false};
+
+      // Source of the sweep, and view state published with it
+      std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan_ {};
+      std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
+                                 momentDataBlock0_ {};
+      wsr88d::rda::DataBlockType dataBlockType_ {
+         wsr88d::rda::DataBlockType::Unknown};
+      std::size_t                           radials_ {0u};
+      bool                                  smoothingEnabled_ {false};
+      bool                                  showSmoothedRangeFolding_ {false};
+      units::kilometers<float>              range_ {};
+      std::chrono::system_clock::time_point sweepTime_ {};
+      std::uint16_t                         vcp_ {};
+   };
+
+   struct SweepLayout
+   {
+      std::int32_t startGate_ {};
+      std::int32_t gateSize_ {};
+      std::int32_t endGate_ {};
+      bool         cfpEnabled_ {};
+   };
+
+   std::optional<SweepLayout>
+   GetUniformLayout(const wsr88d::rda::ColumnarSweep& columnarSweep,
+                    const wsr88d::rda::ColumnarSweep* cfpSweep,
+                    std::uint32_t                     gates) const;
+   void ComputeGridSweep(
+      const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+      const wsr88d::rda::ColumnarSweep&                  columnarSweep,
+      const wsr88d::rda::ColumnarSweep*                  cfpSweep,
+      const SweepLayout&                                 layout,
+      std::size_t                                        vertexRadials,
+      std::uint16_t                                      snrThreshold);
+   template<typename T>
+   void StoreBinVertices(std::vector<T>&       vertices,
+                         std::size_t&          vIndex,
+                         const std::vector<T>& coordinates,
+                         std::size_t           vertexRadials,
+                         std::uint16_t         radial,
+                         std::uint16_t         gate,
+                         std::uint16_t         gateSize) const;
+
    void ComputeCoordinates(
       const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
       bool                                               smoothingEnabled);
+   bool ComputeNextSweep(
+      const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+      bool                                               smoothingEnabled);
+   void PublishSweep();
+
+   std::list<std::unique_ptr<SweepBuffer>>::iterator FindRetainedSweep(
+      const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+      bool                                               smoothingEnabled);
+   void RetainSweep(std::unique_ptr<SweepBuffer>& sweep,
+                    bool                          precomputed = false);
+   bool RestoreSweep(
+      const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+      bool                                               smoothingEnabled);
+   void QueuePrecompute();
+   void PrecomputeSweep(std::uint64_t generation, float elevation);
+
+   std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+              float,
+              std::vector<float>,
+              std::chrono::system_clock::time_point>
+   GetLevel2Data(float elevation, std::chrono::system_clock::time_point time);
+
+   std::shared_ptr<const ColorTableLut> GetColorTableLut(float offset,
+                                                         float scale);
+   std::shared_ptr<const RadarMomentQuantization> GetMomentQuantization(
+      const wsr88d::rda::GenericRadarData::MomentDataBlock& momentData,
+      bool                                                  smoothingEnabled);
+   static void QuantizeMoments(SweepBuffer& sweep);
+   [[nodiscard]] bool IsQuantizationCurrent(const SweepBuffer& sweep) const;
+
+   static std::size_t SweepBytes(const SweepBuffer& sweep);
+   static std::size_t RetainedSweepBudget();
+   void               UpdateMemoryUsage();
 
    void SetProduct(const std::string& productName);
    void SetProduct(common::Level2Product product);
    void UpdateOtherUnits(const std::string& name);
    void UpdateSpeedUnits(const std::string& name);
+   void UpdateStormMotion();
+
+   struct SmoothingLutKey
+   {
+      wsr88d::rda::DataBlockType dataBlockType_ {};
+      std::uint16_t              edgeValue_ {};
+      std::uint16_t              snrThreshold_ {};
+      bool                       showSmoothedRangeFolding_ {};
+
+      auto operator<=>(const SmoothingLutKey&) const = default;
+   };
 
-   void ComputeEdgeValue();
+   void ComputeEdgeValue(float offset);
+   void UpdateSmoothingLuts(std::uint16_t snrThreshold, float offset);
+   [[nodiscard]] inline std::size_t Bucket16(std::uint16_t dataMoment) const;
    template<typename T>
    [[nodiscard]] inline T RemapDataMoment(T dataMoment) const;
+   template<typename T>
+   [[nodiscard]] inline bool
+   IsSmoothedBinHidden(T dm1, T dm2, T dm3, T dm4) const;
+   template<typename T>
+   inline void StoreSmoothedMoments(T* dest, T dm1, T dm2, T dm3, T dm4) const;
 
    static bool IsRadarDataIncomplete(
       const std::shared_ptr<const wsr88d::rda::ElevationScan>& radarData);
    static units::degrees<float> NormalizeAngle(units::degrees<float> angle);
 
+   std::optional<std::uint16_t>
+   FindRadial(const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+              double                                             azimuth);
+
    Level2ProductView* self_;
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::Strand strand_ {"Level 2 Product View"};
 
    common::Level2Product      product_;
    wsr88d::rda::DataBlockType dataBlockType_ {
@@ -147,15 +342,45 @@ public:
    std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
       momentDataBlock0_;
 
+   // Azimuth index of the most recently inspected elevation scan, used to
+   // find the bin under the cursor
+   std::mutex                                  azimuthIndexMutex_ {};
+   std::shared_ptr<wsr88d::rda::ElevationScan> azimuthIndexScan_ {};
+   std::size_t                                 azimuthIndexRadials_ {};
+   util::AzimuthIndex                          azimuthIndex_ {};
+
    bool lastShowSmoothedRangeFolding_ {false};
    bool lastSmoothingEnabled_ {false};
 
-   std::vector<float>    coordinates_ {};
-   std::vector<float>    vertices_ {};
-   std::vector<uint8_t>  dataMoments8_ {};
-   std::vector<uint16_t> dataMoments16_ {};
-   std::vector<uint8_t>  cfpMoments_ {};
-   std::uint16_t         edgeValue_ {};
+   std::vector<float> coordinates_ {};
+   std::uint16_t      edgeValue_ {};
+
+   // Coordinates quantized as offsets from the radar site
+   std::vector<std::int16_t> quantizedCoordinates_ {};
+   RadarVertexQuantization   quantization_ {};
+
+   // Smoothing lookup tables. 16-bit tables are bucketed, with the last
+   // bucket applying to every greater data moment.
+   std::optional<SmoothingLutKey> smoothingLutKey_ {};
+   std::array<std::uint8_t, 256>  remapLut8_ {};
+   std::array<std::uint8_t, 256>  hiddenLut8_ {};
+   std::vector<std::uint8_t>      visibleLut16_ {};
+   std::vector<std::uint8_t>      hiddenLut16_ {};
+
+   // The published sweep is guarded by the sweep mutex. The next sweep is
+   // computed under the compute mutex, and only swapped in once complete.
+   std::mutex                   computeMutex_ {};
+   std::unique_ptr<SweepBuffer> sweep_ {std::make_unique<SweepBuffer>()};
+   std::unique_ptr<SweepBuffer> nextSweep_ {std::make_unique<SweepBuffer>()};
+
+   // Complete sweeps of other elevations, most recently used first, retained
+   // within the elevation cache budget for instant elevation changes
+   std::list<std::unique_ptr<SweepBuffer>> retainedSweeps_ {};
+   std::size_t                             retainedBytes_ {0u};
+   std::atomic<std::uint64_t>              precomputeGeneration_ {0u};
+
+   // Published, next and retained sweeps
+   scwx::util::MemoryCounter sweepMemory_ {"Level 2 Sweep Buffers"};
 
    bool showSmoothedRangeFolding_ {false};
 
@@ -168,19 +393,28 @@ public:
 
    std::chrono::system_clock::time_point sweepTime_;
 
-   std::shared_ptr<common::ColorTable>    colorTable_;
-   std::vector<boost::gil::rgba8_pixel_t> colorTableLut_;
-   uint16_t                               colorTableMin_;
-   uint16_t                               colorTableMax_;
+   std::shared_ptr<common::ColorTable>  colorTable_;
+   std::shared_ptr<const ColorTableLut> colorTableLut_;
 
    std::shared_ptr<common::ColorTable> savedColorTable_;
    float                               savedScale_;
    float                               savedOffset_;
 
+   // Quantization of 16-bit data moments for display, created from a color
+   // table over data levels. Guarded by the compute mutex.
+   std::shared_ptr<const ColorTableLut>           momentQuantizationLut_ {};
+   std::shared_ptr<const RadarMomentQuantization> momentQuantization_ {};
+
    boost::uuids::uuid otherUnitsCallbackUuid_ {};
    boost::uuids::uuid speedUnitsCallbackUuid_ {};
    types::OtherUnits  otherUnits_ {types::OtherUnits::Unknown};
    types::SpeedUnits  speedUnits_ {types::SpeedUnits::Unknown};
+
+   // Storm motion is applied when rendered, and may be read from any thread
+   boost::uuids::uuid stormMotionDirectionCallbackUuid_ {};
+   boost::uuids::uuid stormMotionSpeedCallbackUuid_ {};
+   std::atomic<float> stormMotionDirection_ {0.0f}; // Degrees
+   std::atomic<float> stormMotionSpeed_ {0.0f};     // m/s
 };
 
 Level2ProductView::Level2ProductView(
@@ -194,6 +428,7 @@ Level2ProductView::Level2ProductView(
 
 Level2ProductView::~Level2ProductView()
 {
+   std::unique_lock computeLock {p->computeMutex_};
    std::unique_lock sweepLock {sweep_mutex()};
 }
 
@@ -221,9 +456,9 @@ void Level2ProductView::DisconnectRadarProductManager()
               nullptr);
 }
 
-boost::asio::thread_pool& Level2ProductView::thread_pool()
+scwx::util::Strand& Level2ProductView::strand()
 {
-   return p->threadPool_;
+   return p->strand_;
 }
 
 std::shared_ptr<common::ColorTable> Level2ProductView::color_table() const
@@ -234,40 +469,46 @@ std::shared_ptr<common::ColorTable> Level2ProductView::color_table() const
 const std::vector<boost::gil::rgba8_pixel_t>&
 Level2ProductView::color_table_lut() const
 {
-   if (p->colorTableLut_.size() == 0)
+   if (p->colorTableLut_ == nullptr || p->colorTableLut_->lut_.size() == 0)
    {
       return RadarProductView::color_table_lut();
    }
    else
    {
-      return p->colorTableLut_;
+      return p->colorTableLut_->lut_;
    }
 }
 
 uint16_t Level2ProductView::color_table_min() const
 {
-   if (p->colorTableLut_.size() == 0)
+   if (p->colorTableLut_ == nullptr || p->colorTableLut_->lut_.size() == 0)
    {
       return RadarProductView::color_table_min();
    }
    else
    {
-      return p->colorTableMin_;
+      return p->colorTableLut_->min_;
    }
 }
 
 uint16_t Level2ProductView::color_table_max() const
 {
-   if (p->colorTableLut_.size() == 0)
+   if (p->colorTableLut_ == nullptr || p->colorTableLut_->lut_.size() == 0)
    {
       return RadarProductView::color_table_max();
    }
    else
    {
-      return p->colorTableMax_;
+      return p->colorTableLut_->max_;
    }
 }
 
+std::shared_ptr<const ColorTableLut>
+Level2ProductView::shared_color_table_lut() const
+{
+   return p->colorTableLut_;
+}
+
 float Level2ProductView::elevation() const
 {
    return p->elevationCut_;
@@ -289,8 +530,18 @@ float Level2ProductView::unit_scale() const
    {
    case common::Level2Product::Velocity:
    case common::Level2Product::SpectrumWidth:
+   case common::Level2Product::DealiasedVelocity:
+   case common::Level2Product::StormRelativeVelocity:
       return types::GetSpeedUnitsScale(p->speedUnits_);
 
+   case common::Level2Product::EchoTops:
+      return kKilometersToKilofeet_;
+
+   case common::Level2Product::OneHourPrecipitation:
+   case common::Level2Product::ThreeHourPrecipitation:
+   case common::Level2Product::StormTotalPrecipitation:
+      return kMillimetersToInches_;
+
    default:
       break;
    }
@@ -304,6 +555,8 @@ std::string Level2ProductView::units() const
    {
    case common::Level2Product::Velocity:
    case common::Level2Product::SpectrumWidth:
+   case common::Level2Product::DealiasedVelocity:
+   case common::Level2Product::StormRelativeVelocity:
       return types::GetSpeedUnitsAbbreviation(p->speedUnits_);
 
    default:
@@ -329,7 +582,59 @@ uint16_t Level2ProductView::vcp() const
 
 const std::vector<float>& Level2ProductView::vertices() const
 {
-   return p->vertices_;
+   static const std::vector<float> kNoVertices_ {};
+
+   return (p->sweep_->sharedVertices_ != nullptr) ?
+             *p->sweep_->sharedVertices_ :
+             kNoVertices_;
+}
+
+const std::vector<std::int16_t>& Level2ProductView::quantized_vertices() const
+{
+   return p->sweep_->vertices_;
+}
+
+std::optional<RadarVertexQuantization>
+Level2ProductView::vertex_quantization() const
+{
+   return p->sweep_->quantization_;
+}
+
+std::shared_ptr<const RadarMomentQuantization>
+Level2ProductView::moment_quantization() const
+{
+   return p->sweep_->momentQuantization_;
+}
+
+std::optional<RadarStormMotion> Level2ProductView::storm_motion() const
+{
+   auto momentDataBlock0 = p->momentDataBlock0_;
+
+   if (p->product_ != common::Level2Product::StormRelativeVelocity ||
+       momentDataBlock0 == nullptr)
+   {
+      return std::nullopt;
+   }
+
+   return RadarStormMotion {p->stormMotionDirection_,
+                            p->stormMotionSpeed_,
+                            momentDataBlock0->scale()};
+}
+
+std::shared_ptr<const std::vector<float>>
+Level2ProductView::shared_vertices() const
+{
+   return p->sweep_->sharedVertices_;
+}
+
+bool Level2ProductView::hide_zero_moments() const
+{
+   return p->sweep_->hideZeroMoments_;
+}
+
+std::shared_ptr<const RadarPolarGrid> Level2ProductView::polar_grid() const
+{
+   return p->sweep_->polarGrid_;
 }
 
 common::RadarProductGroup Level2ProductView::GetRadarProductGroup() const
@@ -353,16 +658,16 @@ std::tuple<const void*, size_t, size_t> Level2ProductView::GetMomentData() const
    size_t      dataSize;
    size_t      componentSize;
 
-   if (p->dataMoments8_.size() > 0)
+   if (p->sweep_->dataMoments8_.size() > 0)
    {
-      data          = p->dataMoments8_.data();
-      dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
+      data          = p->sweep_->dataMoments8_.data();
+      dataSize      = p->sweep_->dataMoments8_.size() * sizeof(uint8_t);
       componentSize = 1;
    }
    else
    {
-      data          = p->dataMoments16_.data();
-      dataSize      = p->dataMoments16_.size() * sizeof(uint16_t);
+      data          = p->sweep_->dataMoments16_.data();
+      dataSize      = p->sweep_->dataMoments16_.size() * sizeof(uint16_t);
       componentSize = 2;
    }
 
@@ -376,10 +681,10 @@ Level2ProductView::GetCfpMomentData() const
    size_t      dataSize      = 0;
    size_t      componentSize = 1;
 
-   if (p->cfpMoments_.size() > 0)
+   if (p->sweep_->cfpMoments_.size() > 0)
    {
-      data     = p->cfpMoments_.data();
-      dataSize = p->cfpMoments_.size() * sizeof(uint8_t);
+      data     = p->sweep_->cfpMoments_.data();
+      dataSize = p->sweep_->cfpMoments_.size() * sizeof(uint8_t);
    }
 
    return std::tie(data, dataSize, componentSize);
@@ -434,6 +739,24 @@ void Level2ProductView::Impl::UpdateSpeedUnits(const std::string& name)
    speedUnits_ = types::GetSpeedUnitsFromName(name);
 }
 
+void Level2ProductView::Impl::UpdateStormMotion()
+{
+   // Storm motion speed is specified in knots
+   auto& generalSettings = settings::GeneralSettings::Instance();
+   stormMotionDirection_ = static_cast<float>(
+      generalSettings.storm_motion_direction().GetValue());
+   stormMotionSpeed_ =
+      units::velocity::meters_per_second<float> {
+         units::velocity::knots<float> {static_cast<float>(
+            generalSettings.storm_motion_speed().GetValue())}}
+         .value();
+
+   if (product_ == common::Level2Product::StormRelativeVelocity)
+   {
+      Q_EMIT self_->StormMotionUpdated();
+   }
+}
+
 void Level2ProductView::UpdateColorTableLut()
 {
    if (p->momentDataBlock0_ == nullptr || //
@@ -455,10 +778,22 @@ void Level2ProductView::UpdateColorTableLut()
       return;
    }
 
+   p->colorTableLut_ = p->GetColorTableLut(offset, scale);
+
+   p->savedColorTable_ = p->colorTable_;
+   p->savedOffset_     = offset;
+   p->savedScale_      = scale;
+
+   Q_EMIT ColorTableLutUpdated();
+}
+
+std::shared_ptr<const ColorTableLut>
+Level2ProductView::Impl::GetColorTableLut(float offset, float scale)
+{
    uint16_t rangeMin;
    uint16_t rangeMax;
 
-   switch (p->product_)
+   switch (product_)
    {
    case common::Level2Product::Reflectivity:
    case common::Level2Product::Velocity:
@@ -485,44 +820,106 @@ void Level2ProductView::UpdateColorTableLut()
       break;
    }
 
-   boost::integer_range<uint16_t> dataRange =
-      boost::irange<uint16_t>(rangeMin, rangeMax + 1);
+   ColorTableLutKey key {};
+   key.colorTable_ = colorTable_.get();
+   key.product_    = common::GetLevel2Name(product_);
+   key.offset_     = offset;
+   key.scale_      = scale;
+   key.rangeMin_   = rangeMin;
+   key.rangeMax_   = rangeMax;
+
+   // Views of the same product and color table share a lookup table
+   return ColorTableLutCache::Instance().GetOrBuild(
+      key,
+      [&]()
+      {
+         auto colorTableLut         = std::make_shared<ColorTableLut>();
+         colorTableLut->colorTable_ = colorTable_;
+         colorTableLut->min_        = rangeMin;
+         colorTableLut->max_        = rangeMax;
+
+         std::vector<boost::gil::rgba8_pixel_t>& lut = colorTableLut->lut_;
+         lut.resize(rangeMax - rangeMin + 1);
+
+         // Data values increase with the data moment, such that the color
+         // table is swept once for the range
+         std::vector<float> values(lut.size());
+         for (std::uint16_t i = rangeMin; i <= rangeMax; ++i)
+         {
+            values[i - rangeMin] = (i - offset) / scale;
+         }
 
-   std::vector<boost::gil::rgba8_pixel_t>& lut = p->colorTableLut_;
-   lut.resize(rangeMax - rangeMin + 1);
-   lut.shrink_to_fit();
+         colorTable_->Colors(values, lut);
 
-   std::for_each(std::execution::par_unseq,
-                 dataRange.begin(),
-                 dataRange.end(),
-                 [&](uint16_t i)
-                 {
-                    if (i == RANGE_FOLDED)
-                    {
-                       lut[i - *dataRange.begin()] = p->colorTable_->rf_color();
-                    }
-                    else
-                    {
-                       float f                     = (i - offset) / scale;
-                       lut[i - *dataRange.begin()] = p->colorTable_->Color(f);
-                    }
-                 });
+         if (rangeMin <= RANGE_FOLDED && RANGE_FOLDED <= rangeMax)
+         {
+            lut[RANGE_FOLDED - rangeMin] = colorTable_->rf_color();
+         }
 
-   p->colorTableMin_ = rangeMin;
-   p->colorTableMax_ = rangeMax;
+         return colorTableLut;
+      });
+}
 
-   p->savedColorTable_ = p->colorTable_;
-   p->savedOffset_     = offset;
-   p->savedScale_      = scale;
+std::shared_ptr<const RadarMomentQuantization>
+Level2ProductView::Impl::GetMomentQuantization(
+   const wsr88d::rda::GenericRadarData::MomentDataBlock& momentData,
+   bool                                                  smoothingEnabled)
+{
+   // Smoothed data moments are interpolated when rendered, which display
+   // levels do not support
+   if (smoothingEnabled ||
+       momentData.data_word_size() == kDataWordSize8_ ||
+       colorTable_ == nullptr || !colorTable_->IsValid())
+   {
+      return nullptr;
+   }
 
-   Q_EMIT ColorTableLutUpdated();
+   std::shared_ptr<const ColorTableLut> lut =
+      GetColorTableLut(momentData.offset(), momentData.scale());
+
+   if (lut != momentQuantizationLut_)
+   {
+      momentQuantizationLut_ = lut;
+      momentQuantization_    = RadarMomentQuantization::Create(lut);
+
+      logger_->debug("16-bit moment quantization {}",
+                     (momentQuantization_ != nullptr) ? "enabled" :
+                                                        "not supported");
+   }
+
+   return momentQuantization_;
 }
 
-void Level2ProductView::ComputeSweep()
+bool Level2ProductView::Impl::IsQuantizationCurrent(
+   const SweepBuffer& sweep) const
 {
-   logger_->trace("ComputeSweep()");
+   // Display levels are only current for the color table they were quantized
+   // with
+   return sweep.momentQuantization_ == nullptr ||
+          sweep.momentQuantization_->dataColorTableLut_->colorTable_ ==
+             colorTable_;
+}
 
-   boost::timer::cpu_timer timer;
+void Level2ProductView::Impl::QuantizeMoments(SweepBuffer& sweep)
+{
+   const RadarMomentQuantization& quantization = *sweep.momentQuantization_;
+
+   sweep.dataMoments8_.resize(sweep.dataMoments16_.size());
+   std::transform(std::execution::par_unseq,
+                  sweep.dataMoments16_.cbegin(),
+                  sweep.dataMoments16_.cend(),
+                  sweep.dataMoments8_.begin(),
+                  [&](std::uint16_t dataValue)
+                  { return quantization.DisplayLevel(dataValue); });
+
+   // The 16-bit data moments are not retained with the sweep
+   sweep.dataMoments16_.clear();
+   sweep.dataMoments16_.shrink_to_fit();
+}
+
+void Level2ProductView::ComputeSweep()
+{
+   SPDLOG_LOGGER_TRACE(logger_, "ComputeSweep()");
 
    if (p->dataBlockType_ == wsr88d::rda::DataBlockType::Unknown)
    {
@@ -530,7 +927,7 @@ void Level2ProductView::ComputeSweep()
       return;
    }
 
-   std::scoped_lock sweepLock(sweep_mutex());
+   std::scoped_lock computeLock(p->computeMutex_);
 
    std::shared_ptr<manager::RadarProductManager> radarProductManager =
       radar_product_manager();
@@ -541,16 +938,24 @@ void Level2ProductView::ComputeSweep()
    std::shared_ptr<wsr88d::rda::ElevationScan> radarData;
    std::chrono::system_clock::time_point       requestedTime {selected_time()};
    std::tie(radarData, p->elevationCut_, p->elevationCuts_, std::ignore) =
-      radarProductManager->GetLevel2Data(
-         p->dataBlockType_, p->selectedElevation_, requestedTime);
+      p->GetLevel2Data(p->selectedElevation_, requestedTime);
 
    if (radarData == nullptr)
    {
       Q_EMIT SweepNotComputed(types::NoUpdateReason::NotLoaded);
       return;
    }
+
+   if (is_update_pending())
+   {
+      // The selection has changed since the computation started, and a queued
+      // computation supersedes this one
+      return;
+   }
+
    if (radarData == p->elevationScan_ &&
        smoothingEnabled == p->lastSmoothingEnabled_ &&
+       p->IsQuantizationCurrent(*p->sweep_) &&
        (showSmoothedRangeFolding == p->lastShowSmoothedRangeFolding_ ||
         !smoothingEnabled))
    {
@@ -561,14 +966,50 @@ void Level2ProductView::ComputeSweep()
    p->lastShowSmoothedRangeFolding_ = showSmoothedRangeFolding;
    p->lastSmoothingEnabled_         = smoothingEnabled;
 
+   if (p->RestoreSweep(radarData, smoothingEnabled))
+   {
+      // The sweep was retained from an earlier selection, or precomputed
+      logger_->debug("Using retained sweep");
+
+      UpdateColorTableLut();
+
+      Q_EMIT SweepComputed();
+
+      p->QueuePrecompute();
+      return;
+   }
+
+   if (!p->ComputeNextSweep(radarData, smoothingEnabled))
+   {
+      Q_EMIT SweepNotComputed(types::NoUpdateReason::InvalidData);
+      return;
+   }
+
+   p->PublishSweep();
+
+   UpdateColorTableLut();
+
+   Q_EMIT SweepComputed();
+
+   p->QueuePrecompute();
+}
+
+bool Level2ProductView::Impl::ComputeNextSweep(
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+   bool                                               smoothingEnabled)
+{
    logger_->debug("Computing Sweep");
 
+   boost::timer::cpu_timer timer;
+
+   auto radarProductManager = self_->radar_product_manager();
+
    std::size_t radials       = radarData->crbegin()->first + 1;
    std::size_t vertexRadials = radials;
 
    // When there is missing data, insert another empty vertex radial at the end
    // to avoid stretching
-   const bool isRadarDataIncomplete = Impl::IsRadarDataIncomplete(radarData);
+   const bool isRadarDataIncomplete = IsRadarDataIncomplete(radarData);
    if (isRadarDataIncomplete)
    {
       ++vertexRadials;
@@ -579,71 +1020,144 @@ void Level2ProductView::ComputeSweep()
    vertexRadials =
       std::min<std::size_t>(vertexRadials, common::MAX_0_5_DEGREE_RADIALS);
 
-   p->ComputeCoordinates(radarData, smoothingEnabled);
-
-   const std::vector<float>& coordinates = p->coordinates_;
-
-   auto& radarData0     = (*radarData)[0];
-   auto  momentData0    = radarData0->moment_data_block(p->dataBlockType_);
-   p->elevationScan_    = radarData;
-   p->momentDataBlock0_ = momentData0;
+   auto& radarData0  = (*radarData)[0];
+   auto  momentData0 = radarData0->moment_data_block(dataBlockType_);
 
    if (momentData0 == nullptr)
    {
       logger_->warn("No moment data for {}",
-                    common::GetLevel2Name(p->product_));
-      Q_EMIT SweepNotComputed(types::NoUpdateReason::InvalidData);
-      return;
+                    common::GetLevel2Name(product_));
+      return false;
    }
 
    const uint32_t gates = momentData0->number_of_data_moment_gates();
 
    auto radarSite = radarProductManager->radar_site();
-   p->latitude_   = radarSite->latitude();
-   p->longitude_  = radarSite->longitude();
-   p->range_ =
+   latitude_      = radarSite->latitude();
+   longitude_     = radarSite->longitude();
+
+   // The view state is updated from the sweep once it is published
+   SweepBuffer& sweep = *nextSweep_;
+
+   sweep.elevationScan_            = radarData;
+   sweep.momentDataBlock0_         = momentData0;
+   sweep.dataBlockType_            = dataBlockType_;
+   sweep.radials_                  = radarData->size();
+   sweep.smoothingEnabled_         = smoothingEnabled;
+   sweep.showSmoothedRangeFolding_ = showSmoothedRangeFolding_;
+   sweep.range_ =
       momentData0->data_moment_range() +
       momentData0->data_moment_range_sample_interval() * (gates - 0.5f);
-   p->sweepTime_ = scwx::util::TimePoint(radarData0->modified_julian_date(),
-                                         radarData0->collection_time());
-   p->vcp_       = radarData0->volume_coverage_pattern_number();
+   sweep.sweepTime_ = scwx::util::TimePoint(radarData0->modified_julian_date(),
+                                            radarData0->collection_time());
+   sweep.vcp_       = radarData0->volume_coverage_pattern_number();
+   sweep.momentQuantization_ =
+      GetMomentQuantization(*momentData0, smoothingEnabled);
 
    // Calculate vertices
    timer.start();
 
+   std::vector<wsr88d::rda::ElevationScan::const_iterator> radialIterators {};
+   radialIterators.reserve(radarData->size());
+   for (auto it = radarData->cbegin(); it != radarData->cend(); ++it)
+   {
+      radialIterators.push_back(it);
+   }
+
+   // Compute threshold at which to display an individual bin (minimum of 2)
+   const std::uint16_t snrThreshold =
+      std::max<std::int16_t>(2, momentData0->snr_threshold_raw());
+
+   // Without smoothing, a sweep with the same gate layout on every radial uses
+   // a vertex grid covering every bin, shared between views and sweeps. Bins
+   // below the threshold are hidden by a zero data moment instead of being
+   // removed from the vertices.
+   std::shared_ptr<const wsr88d::rda::ColumnarSweep> columnarSweep = nullptr;
+   std::shared_ptr<const wsr88d::rda::ColumnarSweep> cfpSweep      = nullptr;
+   std::optional<SweepLayout>                        gridLayout {};
+   if (!smoothingEnabled)
+   {
+      // The grid sweep reads each moment linearly from a columnar copy
+      columnarSweep =
+         wsr88d::rda::ColumnarSweep::Get(radarData, dataBlockType_);
+      if (dataBlockType_ == wsr88d::rda::DataBlockType::MomentRef &&
+          radarData0->moment_data_block(
+             wsr88d::rda::DataBlockType::MomentCfp) != nullptr)
+      {
+         cfpSweep = wsr88d::rda::ColumnarSweep::Get(
+            radarData, wsr88d::rda::DataBlockType::MomentCfp);
+      }
+
+      if (columnarSweep != nullptr)
+      {
+         gridLayout = GetUniformLayout(*columnarSweep, cfpSweep.get(), gates);
+      }
+   }
+
+   if (gridLayout.has_value())
+   {
+      ComputeGridSweep(radarData,
+                       *columnarSweep,
+                       cfpSweep.get(),
+                       *gridLayout,
+                       vertexRadials,
+                       snrThreshold);
+
+      timer.stop();
+      logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
+
+      return true;
+   }
+
+   // Radials are computed in parallel. Each radial writes to its own slot,
+   // sized for every gate of the radial, and slots are compacted afterward.
+   const std::size_t radialSlots = radialIterators.size();
+   const std::size_t vertexSlotSize =
+      static_cast<std::size_t>(gates) * VERTICES_PER_BIN * VALUES_PER_VERTEX;
+   const std::size_t momentSlotSize =
+      static_cast<std::size_t>(gates) * VERTICES_PER_BIN;
+   const std::size_t momentSlots = std::max(radials, radialSlots);
+   const std::size_t vertexSlots = std::max(vertexRadials, radialSlots);
+
+   ComputeCoordinates(radarData, smoothingEnabled);
+
+   const std::vector<std::int16_t>& coordinates = quantizedCoordinates_;
+
+   sweep.sharedVertices_.reset();
+   sweep.polarGrid_.reset();
+   sweep.hideZeroMoments_ = false;
+   sweep.quantization_    = quantization_;
+
+   std::vector<std::int16_t>& vertices      = sweep.vertices_;
+   std::vector<uint8_t>&      dataMoments8  = sweep.dataMoments8_;
+   std::vector<uint16_t>&     dataMoments16 = sweep.dataMoments16_;
+   std::vector<uint8_t>&      cfpMoments    = sweep.cfpMoments_;
+
    // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
    vertices.clear();
-   vertices.resize(vertexRadials * gates * VERTICES_PER_BIN *
-                   VALUES_PER_VERTEX);
+   vertices.resize(vertexSlots * vertexSlotSize);
 
    // Setup data moment vector
-   std::vector<uint8_t>&  dataMoments8  = p->dataMoments8_;
-   std::vector<uint16_t>& dataMoments16 = p->dataMoments16_;
-   std::vector<uint8_t>&  cfpMoments    = p->cfpMoments_;
-   size_t                 mIndex        = 0;
-
    if (momentData0->data_word_size() == 8)
    {
       dataMoments16.resize(0);
       dataMoments16.shrink_to_fit();
 
-      dataMoments8.resize(radials * gates * VERTICES_PER_BIN);
+      dataMoments8.resize(momentSlots * momentSlotSize);
    }
    else
    {
       dataMoments8.resize(0);
       dataMoments8.shrink_to_fit();
 
-      dataMoments16.resize(radials * gates * VERTICES_PER_BIN);
+      dataMoments16.resize(momentSlots * momentSlotSize);
    }
 
-   if (p->dataBlockType_ == wsr88d::rda::DataBlockType::MomentRef &&
+   if (dataBlockType_ == wsr88d::rda::DataBlockType::MomentRef &&
        radarData0->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp) !=
           nullptr)
    {
-      cfpMoments.resize(radials * gates * VERTICES_PER_BIN);
+      cfpMoments.resize(momentSlots * momentSlotSize);
    }
    else
    {
@@ -651,346 +1165,291 @@ void Level2ProductView::ComputeSweep()
       cfpMoments.shrink_to_fit();
    }
 
-   // Compute threshold at which to display an individual bin (minimum of 2)
-   const std::uint16_t snrThreshold =
-      std::max<std::int16_t>(2, momentData0->snr_threshold_raw());
-
-   // Start radial is always 0, as coordinates are calculated for each sweep
-   constexpr std::uint16_t startRadial = 0u;
-
    // For most products other than reflectivity, the edge should not go to the
    // bottom of the color table
    if (smoothingEnabled)
    {
-      p->ComputeEdgeValue();
+      UpdateSmoothingLuts(snrThreshold, momentData0->offset());
    }
 
-   for (auto it = radarData->cbegin(); it != radarData->cend(); ++it)
-   {
-      const auto&   radialPair = *it;
-      std::uint16_t radial     = radialPair.first;
-      const auto&   radialData = radialPair.second;
-      const std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
-         momentData = radialData->moment_data_block(p->dataBlockType_);
-
-      if (momentData0->data_word_size() != momentData->data_word_size())
-      {
-         logger_->warn("Radial {} has different word size", radial);
-         continue;
-      }
-
-      // Compute gate interval
-      const std::int32_t dataMomentInterval =
-         momentData->data_moment_range_sample_interval_raw();
-      const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
-      const std::int32_t dataMomentRange     = std::max<std::int32_t>(
-         momentData->data_moment_range_raw(), dataMomentIntervalH);
-
-      // Compute gate size (number of base 250m gates per bin)
-      const std::int32_t gateSizeMeters =
-         static_cast<std::int32_t>(radarProductManager->gate_size());
-      const std::int32_t gateSize =
-         std::max<std::int32_t>(1, dataMomentInterval / gateSizeMeters);
-
-      // Compute gate range [startGate, endGate)
-      std::int32_t startGate =
-         (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
-      const std::int32_t numberOfDataMomentGates =
-         std::min<std::int32_t>(momentData->number_of_data_moment_gates(),
-                                static_cast<std::int32_t>(gates));
-      const std::int32_t endGate = std::min<std::int32_t>(
-         startGate + numberOfDataMomentGates * gateSize,
-         static_cast<std::int32_t>(common::MAX_DATA_MOMENT_GATES));
-
-      if (smoothingEnabled)
-      {
-         // If smoothing is enabled, the start gate is incremented by one, as we
-         // are skipping the radar site origin. The end gate is unaffected, as
-         // we need to draw one less data point.
-         ++startGate;
-      }
-
-      const std::uint8_t*  dataMomentsArray8      = nullptr;
-      const std::uint16_t* dataMomentsArray16     = nullptr;
-      const std::uint8_t*  nextDataMomentsArray8  = nullptr;
-      const std::uint16_t* nextDataMomentsArray16 = nullptr;
-      const std::uint8_t*  cfpMomentsArray        = nullptr;
+   std::vector<std::size_t> vertexCounts(radialSlots, 0u);
+   std::vector<std::size_t> momentCounts(radialSlots, 0u);
 
-      if (momentData->data_word_size() == 8)
-      {
-         dataMomentsArray8 =
-            reinterpret_cast<const std::uint8_t*>(momentData->data_moments());
-      }
-      else
-      {
-         dataMomentsArray16 =
-            reinterpret_cast<const std::uint16_t*>(momentData->data_moments());
-      }
+   // Compute gate size (number of base 250m gates per bin)
+   const std::int32_t gateSizeMeters =
+      static_cast<std::int32_t>(radarProductManager->gate_size());
 
-      if (cfpMoments.size() > 0)
-      {
-         cfpMomentsArray = reinterpret_cast<const std::uint8_t*>(
-            radialData->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp)
-               ->data_moments());
-      }
+   auto radialIndices = boost::irange<std::size_t>(0u, radialSlots);
 
-      std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
-                   nextMomentData              = nullptr;
-      std::int32_t numberOfNextDataMomentGates = 0;
-      if (smoothingEnabled)
+   std::for_each(
+      std::execution::par,
+      radialIndices.begin(),
+      radialIndices.end(),
+      [&](std::size_t radialIndex)
       {
-         // Smoothing requires the next radial pair as well
-         auto nextIt = std::next(it);
-         if (nextIt == radarData->cend())
+         auto          it         = radialIterators[radialIndex];
+         std::uint16_t radial     = it->first;
+         const auto&   radialData = it->second;
+         const std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
+            momentData = radialData->moment_data_block(dataBlockType_);
+
+         const std::size_t vBegin = radialIndex * vertexSlotSize;
+         const std::size_t mBegin = radialIndex * momentSlotSize;
+         std::size_t       vIndex = vBegin;
+         std::size_t       mIndex = mBegin;
+
+         if (momentData0->data_word_size() != momentData->data_word_size())
          {
-            nextIt = radarData->cbegin();
+            logger_->warn("Radial {} has different word size", radial);
+            return;
          }
 
-         const auto& nextRadialPair = *(nextIt);
-         const auto& nextRadialData = nextRadialPair.second;
-         nextMomentData = nextRadialData->moment_data_block(p->dataBlockType_);
-
-         if (momentData->data_word_size() != nextMomentData->data_word_size())
+         // Compute gate interval
+         const std::int32_t dataMomentInterval =
+            momentData->data_moment_range_sample_interval_raw();
+         const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
+         const std::int32_t dataMomentRange     = std::max<std::int32_t>(
+            momentData->data_moment_range_raw(), dataMomentIntervalH);
+
+         const std::int32_t gateSize =
+            std::max<std::int32_t>(1, dataMomentInterval / gateSizeMeters);
+
+         // Compute gate range [startGate, endGate)
+         std::int32_t startGate =
+            (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
+         const std::int32_t numberOfDataMomentGates =
+            std::min<std::int32_t>(momentData->number_of_data_moment_gates(),
+                                   static_cast<std::int32_t>(gates));
+         const std::int32_t endGate = std::min<std::int32_t>(
+            startGate + numberOfDataMomentGates * gateSize,
+            static_cast<std::int32_t>(common::MAX_DATA_MOMENT_GATES));
+
+         if (smoothingEnabled)
          {
-            // Data should be consistent between radials
-            logger_->warn("Invalid data moment size");
-            continue;
+            // If smoothing is enabled, the start gate is incremented by one, as
+            // we are skipping the radar site origin. The end gate is
+            // unaffected, as we need to draw one less data point.
+            ++startGate;
          }
 
-         if (nextMomentData->data_word_size() == kDataWordSize8_)
+         const std::uint8_t*  dataMomentsArray8      = nullptr;
+         const std::uint16_t* dataMomentsArray16     = nullptr;
+         const std::uint8_t*  nextDataMomentsArray8  = nullptr;
+         const std::uint16_t* nextDataMomentsArray16 = nullptr;
+         const std::uint8_t*  cfpMomentsArray        = nullptr;
+
+         if (momentData->data_word_size() == 8)
          {
-            nextDataMomentsArray8 = reinterpret_cast<const std::uint8_t*>(
-               nextMomentData->data_moments());
+            dataMomentsArray8 = reinterpret_cast<const std::uint8_t*>(
+               momentData->data_moments());
          }
          else
          {
-            nextDataMomentsArray16 = reinterpret_cast<const std::uint16_t*>(
-               nextMomentData->data_moments());
+            dataMomentsArray16 = reinterpret_cast<const std::uint16_t*>(
+               momentData->data_moments());
          }
 
-         numberOfNextDataMomentGates = std::min<std::int32_t>(
-            nextMomentData->number_of_data_moment_gates(),
-            static_cast<std::int32_t>(gates));
-      }
-
-      for (std::int32_t gate = startGate, i = 0; gate + gateSize <= endGate;
-           gate += gateSize, ++i)
-      {
-         if (gate < 0)
+         if (cfpMoments.size() > 0)
          {
-            continue;
+            cfpMomentsArray = reinterpret_cast<const std::uint8_t*>(
+               radialData
+                  ->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp)
+                  ->data_moments());
          }
 
-         const std::size_t vertexCount =
-            (gate > 0) ? kVerticesPerGate_ : kVerticesPerOriginGate_;
+         std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
+                      nextMomentData              = nullptr;
+         std::int32_t numberOfNextDataMomentGates = 0;
+         if (smoothingEnabled)
+         {
+            // Smoothing requires the next radial pair as well
+            const auto& nextRadialPair =
+               *radialIterators[(radialIndex + 1) % radialSlots];
+            const auto& nextRadialData = nextRadialPair.second;
+            nextMomentData =
+               nextRadialData->moment_data_block(dataBlockType_);
+
+            if (momentData->data_word_size() !=
+                nextMomentData->data_word_size())
+            {
+               // Data should be consistent between radials
+               logger_->warn("Invalid data moment size");
+               return;
+            }
+
+            if (nextMomentData->data_word_size() == kDataWordSize8_)
+            {
+               nextDataMomentsArray8 = reinterpret_cast<const std::uint8_t*>(
+                  nextMomentData->data_moments());
+            }
+            else
+            {
+               nextDataMomentsArray16 =
+                  reinterpret_cast<const std::uint16_t*>(
+                     nextMomentData->data_moments());
+            }
 
-         // Allow pointer arithmetic here, as bounds have already been checked
-         // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            numberOfNextDataMomentGates = std::min<std::int32_t>(
+               nextMomentData->number_of_data_moment_gates(),
+               static_cast<std::int32_t>(gates));
+         }
 
-         // Store data moment value
-         if (dataMomentsArray8 != nullptr)
+         for (std::int32_t gate = startGate, i = 0; gate + gateSize <= endGate;
+              gate += gateSize, ++i)
          {
-            if (!smoothingEnabled)
+            if (gate < 0)
             {
-               const std::uint8_t& dataValue = dataMomentsArray8[i];
-               if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-               {
-                  continue;
-               }
+               continue;
+            }
 
-               for (std::size_t m = 0; m < vertexCount; m++)
+            const std::size_t vertexCount =
+               (gate > 0) ? kVerticesPerGate_ : kVerticesPerOriginGate_;
+
+            // Allow pointer arithmetic here, as bounds have already been
+            // checked
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+            // Store data moment value
+            if (dataMomentsArray8 != nullptr)
+            {
+               if (!smoothingEnabled)
                {
-                  dataMoments8[mIndex++] = dataValue;
+                  const std::uint8_t& dataValue = dataMomentsArray8[i];
+                  if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+                  {
+                     continue;
+                  }
+
+                  std::fill_n(&dataMoments8[mIndex], vertexCount, dataValue);
 
                   if (cfpMomentsArray != nullptr)
                   {
-                     cfpMoments[mIndex - 1] = cfpMomentsArray[i];
+                     std::fill_n(
+                        &cfpMoments[mIndex], vertexCount, cfpMomentsArray[i]);
                   }
+
+                  mIndex += vertexCount;
                }
-            }
-            else if (gate > 0)
-            {
-               // Validate indices are all in range
-               if (i + 1 >= numberOfDataMomentGates ||
-                   i + 1 >= numberOfNextDataMomentGates)
+               else if (gate > 0)
                {
-                  continue;
-               }
+                  // Validate indices are all in range
+                  if (i + 1 >= numberOfDataMomentGates ||
+                      i + 1 >= numberOfNextDataMomentGates)
+                  {
+                     continue;
+                  }
 
-               const std::uint8_t& dm1 = dataMomentsArray8[i];
-               const std::uint8_t& dm2 = dataMomentsArray8[i + 1];
-               const std::uint8_t& dm3 = nextDataMomentsArray8[i];
-               const std::uint8_t& dm4 = nextDataMomentsArray8[i + 1];
-
-               if ((!showSmoothedRangeFolding && //
-                    (dm1 < snrThreshold || dm1 == RANGE_FOLDED) &&
-                    (dm2 < snrThreshold || dm2 == RANGE_FOLDED) &&
-                    (dm3 < snrThreshold || dm3 == RANGE_FOLDED) &&
-                    (dm4 < snrThreshold || dm4 == RANGE_FOLDED)) ||
-                   (showSmoothedRangeFolding && //
-                    dm1 < snrThreshold && dm1 != RANGE_FOLDED &&
-                    dm2 < snrThreshold && dm2 != RANGE_FOLDED &&
-                    dm3 < snrThreshold && dm3 != RANGE_FOLDED &&
-                    dm4 < snrThreshold && dm4 != RANGE_FOLDED))
-               {
-                  // Skip only if all data moments are hidden
-                  continue;
-               }
+                  const std::uint8_t& dm1 = dataMomentsArray8[i];
+                  const std::uint8_t& dm2 = dataMomentsArray8[i + 1];
+                  const std::uint8_t& dm3 = nextDataMomentsArray8[i];
+                  const std::uint8_t& dm4 = nextDataMomentsArray8[i + 1];
 
-               // The order must match the store vertices section below
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm2);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm3);
-               dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
+                  if (IsSmoothedBinHidden(dm1, dm2, dm3, dm4))
+                  {
+                     // Skip only if all data moments are hidden
+                     continue;
+                  }
 
-               // cfpMoments is unused, so not populated here
-            }
-            else
-            {
-               // If smoothing is enabled, gate should never start at zero
-               // (radar site origin)
-               logger_->error(
-                  "Smoothing enabled, gate should not start at zero");
-               continue;
-            }
-         }
-         else
-         {
-            if (!smoothingEnabled)
-            {
-               const std::uint16_t& dataValue = dataMomentsArray16[i];
-               if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-               {
-                  continue;
-               }
+                  // The order must match the store vertices section below
+                  StoreSmoothedMoments(
+                     &dataMoments8[mIndex], dm1, dm2, dm3, dm4);
+                  mIndex += kVerticesPerGate_;
 
-               for (std::size_t m = 0; m < vertexCount; m++)
+                  // cfpMoments is unused, so not populated here
+               }
+               else
                {
-                  dataMoments16[mIndex++] = dataValue;
+                  // If smoothing is enabled, gate should never start at zero
+                  // (radar site origin)
+                  logger_->error(
+                     "Smoothing enabled, gate should not start at zero");
+                  continue;
                }
             }
-            else if (gate > 0)
+            else
             {
-               // Validate indices are all in range
-               if (i + 1 >= numberOfDataMomentGates ||
-                   i + 1 >= numberOfNextDataMomentGates)
+               if (!smoothingEnabled)
                {
-                  continue;
+                  const std::uint16_t& dataValue = dataMomentsArray16[i];
+                  if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+                  {
+                     continue;
+                  }
+
+                  std::fill_n(&dataMoments16[mIndex], vertexCount, dataValue);
+                  mIndex += vertexCount;
                }
+               else if (gate > 0)
+               {
+                  // Validate indices are all in range
+                  if (i + 1 >= numberOfDataMomentGates ||
+                      i + 1 >= numberOfNextDataMomentGates)
+                  {
+                     continue;
+                  }
+
+                  const std::uint16_t& dm1 = dataMomentsArray16[i];
+                  const std::uint16_t& dm2 = dataMomentsArray16[i + 1];
+                  const std::uint16_t& dm3 = nextDataMomentsArray16[i];
+                  const std::uint16_t& dm4 = nextDataMomentsArray16[i + 1];
 
-               const std::uint16_t& dm1 = dataMomentsArray16[i];
-               const std::uint16_t& dm2 = dataMomentsArray16[i + 1];
-               const std::uint16_t& dm3 = nextDataMomentsArray16[i];
-               const std::uint16_t& dm4 = nextDataMomentsArray16[i + 1];
-
-               if ((!showSmoothedRangeFolding && //
-                    (dm1 < snrThreshold || dm1 == RANGE_FOLDED) &&
-                    (dm2 < snrThreshold || dm2 == RANGE_FOLDED) &&
-                    (dm3 < snrThreshold || dm3 == RANGE_FOLDED) &&
-                    (dm4 < snrThreshold || dm4 == RANGE_FOLDED)) ||
-                   (showSmoothedRangeFolding && //
-                    dm1 < snrThreshold && dm1 != RANGE_FOLDED &&
-                    dm2 < snrThreshold && dm2 != RANGE_FOLDED &&
-                    dm3 < snrThreshold && dm3 != RANGE_FOLDED &&
-                    dm4 < snrThreshold && dm4 != RANGE_FOLDED))
+                  if (IsSmoothedBinHidden(dm1, dm2, dm3, dm4))
+                  {
+                     // Skip only if all data moments are hidden
+                     continue;
+                  }
+
+                  // The order must match the store vertices section below
+                  StoreSmoothedMoments(
+                     &dataMoments16[mIndex], dm1, dm2, dm3, dm4);
+                  mIndex += kVerticesPerGate_;
+
+                  // cfpMoments is unused, so not populated here
+               }
+               else
                {
-                  // Skip only if all data moments are hidden
+                  // If smoothing is enabled, gate should never start at zero
+                  // (radar site origin)
                   continue;
                }
-
-               // The order must match the store vertices section below
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm2);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm4);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm1);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm3);
-               dataMoments16[mIndex++] = p->RemapDataMoment(dm4);
-
-               // cfpMoments is unused, so not populated here
             }
-            else
-            {
-               // If smoothing is enabled, gate should never start at zero
-               // (radar site origin)
-               continue;
-            }
-         }
 
-         // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-         // Store vertices
-         if (gate > 0)
-         {
-            // Draw two triangles per gate
-            //
-            // 2 +---+ 4
-            //   |  /|
-            //   | / |
-            //   |/  |
-            // 1 +---+ 3
-
-            const std::uint16_t baseCoord = gate - 1;
-
-            const std::size_t offset1 =
-               ((startRadial + radial) % vertexRadials *
-                   common::MAX_DATA_MOMENT_GATES +
-                baseCoord) *
-               2;
-            const std::size_t offset2 =
-               offset1 + static_cast<std::size_t>(gateSize) * 2;
-            const std::size_t offset3 =
-               (((startRadial + radial + 1) % vertexRadials) *
-                   common::MAX_DATA_MOMENT_GATES +
-                baseCoord) *
-               2;
-            const std::size_t offset4 =
-               offset3 + static_cast<std::size_t>(gateSize) * 2;
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertices[vIndex++] = coordinates[offset4];
-            vertices[vIndex++] = coordinates[offset4 + 1];
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset3];
-            vertices[vIndex++] = coordinates[offset3 + 1];
-
-            vertices[vIndex++] = coordinates[offset4];
-            vertices[vIndex++] = coordinates[offset4 + 1];
+            // Store vertices
+            StoreBinVertices(vertices,
+                             vIndex,
+                             coordinates,
+                             vertexRadials,
+                             radial,
+                             static_cast<std::uint16_t>(gate),
+                             static_cast<std::uint16_t>(gateSize));
          }
-         else
-         {
-            const std::uint16_t baseCoord = gate;
-
-            std::size_t offset1 = ((startRadial + radial) % vertexRadials *
-                                      common::MAX_DATA_MOMENT_GATES +
-                                   baseCoord) *
-                                  2;
-            std::size_t offset2 =
-               (((startRadial + radial + 1) % vertexRadials) *
-                   common::MAX_DATA_MOMENT_GATES +
-                baseCoord) *
-               2;
 
-            vertices[vIndex++] = p->latitude_;
-            vertices[vIndex++] = p->longitude_;
+         vertexCounts[radialIndex] = vIndex - vBegin;
+         momentCounts[radialIndex] = mIndex - mBegin;
+      });
 
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
+   // Compact the radial slots, in order
+   std::size_t vIndex = 0;
+   std::size_t mIndex = 0;
 
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-         }
-      }
+   for (std::size_t radialIndex = 0; radialIndex < radialSlots; ++radialIndex)
+   {
+      const std::size_t vBegin = radialIndex * vertexSlotSize;
+      const std::size_t mBegin = radialIndex * momentSlotSize;
+      const std::size_t vCount = vertexCounts[radialIndex];
+      const std::size_t mCount = momentCounts[radialIndex];
+
+      CompactSlot(vertices, vBegin, vCount, vIndex);
+      CompactSlot(dataMoments8, mBegin, mCount, mIndex);
+      CompactSlot(dataMoments16, mBegin, mCount, mIndex);
+      CompactSlot(cfpMoments, mBegin, mCount, mIndex);
+
+      vIndex += vCount;
+      mIndex += mCount;
    }
+
    vertices.resize(vIndex);
    vertices.shrink_to_fit();
 
@@ -1003,6 +1462,11 @@ void Level2ProductView::ComputeSweep()
    {
       dataMoments16.resize(mIndex);
       dataMoments16.shrink_to_fit();
+
+      if (sweep.momentQuantization_ != nullptr)
+      {
+         QuantizeMoments(sweep);
+      }
    }
 
    if (cfpMoments.size() > 0)
@@ -1014,15 +1478,634 @@ void Level2ProductView::ComputeSweep()
    timer.stop();
    logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
 
-   UpdateColorTableLut();
+   return true;
+}
 
-   Q_EMIT SweepComputed();
+std::optional<Level2ProductView::Impl::SweepLayout>
+Level2ProductView::Impl::GetUniformLayout(
+   const wsr88d::rda::ColumnarSweep& columnarSweep,
+   const wsr88d::rda::ColumnarSweep* cfpSweep,
+   std::uint32_t                     gates) const
+{
+   // Every radial must share the gate layout of the first radial
+   if (columnarSweep.radial_count() == 0 || !columnarSweep.complete() ||
+       !columnarSweep.uniform())
+   {
+      return std::nullopt;
+   }
+
+   SweepLayout layout {};
+   layout.cfpEnabled_ = cfpSweep != nullptr;
+
+   // Clutter filter power removed must cover every gate of every radial
+   if (layout.cfpEnabled_ &&
+       (!cfpSweep->complete() ||
+        cfpSweep->radial_count() != columnarSweep.radial_count() ||
+        cfpSweep->data_word_size() != kDataWordSize8_ ||
+        !std::ranges::all_of(cfpSweep->gate_counts(),
+                             [&](std::uint16_t cfpGates)
+                             { return cfpGates >= columnarSweep.stride(); })))
+   {
+      return std::nullopt;
+   }
+
+   // Compute gate interval
+   const std::int32_t dataMomentInterval =
+      columnarSweep.data_moment_range_sample_interval_raw();
+   const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
+   const std::int32_t dataMomentRange     = std::max<std::int32_t>(
+      columnarSweep.data_moment_range_raw(), dataMomentIntervalH);
+
+   // Compute gate size (number of base 250m gates per bin)
+   const std::int32_t gateSizeMeters =
+      static_cast<std::int32_t>(self_->radar_product_manager()->gate_size());
+   layout.gateSize_ =
+      std::max<std::int32_t>(1, dataMomentInterval / gateSizeMeters);
+
+   // Compute gate range [startGate, endGate)
+   layout.startGate_ = (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
+   const std::int32_t numberOfDataMomentGates =
+      std::min<std::int32_t>(columnarSweep.number_of_data_moment_gates(),
+                             static_cast<std::int32_t>(gates));
+   layout.endGate_ = std::min<std::int32_t>(
+      layout.startGate_ + numberOfDataMomentGates * layout.gateSize_,
+      static_cast<std::int32_t>(common::MAX_DATA_MOMENT_GATES));
+
+   return layout;
+}
+
+void Level2ProductView::Impl::ComputeGridSweep(
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+   const wsr88d::rda::ColumnarSweep&                  columnarSweep,
+   const wsr88d::rda::ColumnarSweep*                  cfpSweep,
+   const SweepLayout&                                 layout,
+   std::size_t                                        vertexRadials,
+   std::uint16_t                                      snrThreshold)
+{
+   auto& sweepCache = Level2SweepCache::Instance();
+
+   const std::int32_t startGate = layout.startGate_;
+   const std::int32_t gateSize  = layout.gateSize_;
+   const std::int32_t endGate   = layout.endGate_;
+
+   // Every radial holds the same number of data moments
+   std::size_t radialMoments = 0;
+   for (std::int32_t gate = startGate; gate + gateSize <= endGate;
+        gate += gateSize)
+   {
+      if (gate >= 0)
+      {
+         radialMoments +=
+            (gate > 0) ? kVerticesPerGate_ : kVerticesPerOriginGate_;
+      }
+   }
+   const std::size_t radialVertexValues = radialMoments * VALUES_PER_VERTEX;
+
+   const std::size_t radialCount = columnarSweep.radial_count();
+   const auto        radials     = columnarSweep.radials();
+   const auto        azimuths    = columnarSweep.azimuths();
+
+   auto radialIndices = boost::irange<std::size_t>(0u, radialCount);
+
+   std::shared_ptr<const std::vector<float>> grid      = nullptr;
+   std::shared_ptr<RadarPolarGrid>           polarGrid = nullptr;
+
+   // If every radial of the sweep is present, bin vertices may instead be
+   // generated when rendered, from the azimuth of each radial
+   if (IsPolarGridEnabled() && startGate >= 0 && radialCount == vertexRadials)
+   {
+      auto radarSite = self_->radar_product_manager()->radar_site();
+
+      polarGrid                  = std::make_shared<RadarPolarGrid>();
+      polarGrid->latitude_       = radarSite->latitude();
+      polarGrid->longitude_      = radarSite->longitude();
+      polarGrid->gateSizeMeters_ = self_->radar_product_manager()->gate_size();
+      polarGrid->startGate_      = static_cast<std::uint32_t>(startGate);
+      polarGrid->gateSize_       = static_cast<std::uint32_t>(gateSize);
+      polarGrid->bins_ =
+         static_cast<std::uint32_t>((endGate - startGate) / gateSize);
+
+      polarGrid->azimuths_.reserve(radialCount * 2);
+      for (std::size_t i = 0; i < radialCount; ++i)
+      {
+         polarGrid->azimuths_.push_back(azimuths[i]);
+         polarGrid->azimuths_.push_back(azimuths[(i + 1) % radialCount]);
+      }
+   }
+   else
+   {
+      Level2SweepGridKey gridKey {
+         self_->radar_product_manager()->radar_site()->id(),
+         latitude_,
+         longitude_,
+         static_cast<std::uint16_t>(vertexRadials),
+         startGate,
+         gateSize,
+         endGate,
+         {}};
+      gridKey.radials_.reserve(radialCount);
+      for (std::size_t i = 0; i < radialCount; ++i)
+      {
+         gridKey.radials_.emplace_back(
+            radials[i], Level2SweepCache::QuantizeAzimuth(azimuths[i]));
+      }
+
+      grid = sweepCache.GetGrid(gridKey);
+
+      if (grid == nullptr)
+      {
+         ComputeCoordinates(radarData, false);
+
+         auto newGrid = std::make_shared<std::vector<float>>(
+            radialCount * radialVertexValues);
+
+         std::for_each(
+            std::execution::par_unseq,
+            radialIndices.begin(),
+            radialIndices.end(),
+            [&](std::size_t radialIndex)
+            {
+               const std::uint16_t radial = radials[radialIndex];
+               std::size_t         vIndex = radialIndex * radialVertexValues;
+
+               for (std::int32_t gate = startGate; gate + gateSize <= endGate;
+                    gate += gateSize)
+               {
+                  if (gate >= 0)
+                  {
+                     StoreBinVertices(*newGrid,
+                                      vIndex,
+                                      coordinates_,
+                                      vertexRadials,
+                                      radial,
+                                      static_cast<std::uint16_t>(gate),
+                                      static_cast<std::uint16_t>(gateSize));
+                  }
+               }
+            });
+
+         grid = sweepCache.InsertGrid(gridKey, std::move(newGrid));
+      }
+      else
+      {
+         logger_->debug("Using shared sweep grid");
+      }
+   }
+
+   // Setup data moment vectors
+   SweepBuffer& sweep = *nextSweep_;
+
+   const bool wordSize8 =
+      sweep.momentDataBlock0_->data_word_size() == kDataWordSize8_;
+   const RadarMomentQuantization* quantization =
+      sweep.momentQuantization_.get();
+   const bool        storeMoments8 = wordSize8 || quantization != nullptr;
+   const std::size_t momentCount   = radialCount * radialMoments;
+
+   // Moment storage is retained between sweeps computed into this buffer.
+   // Quantized 16-bit data moments are stored as 8-bit display levels.
+   sweep.dataMoments8_.resize(storeMoments8 ? momentCount : 0u);
+   sweep.dataMoments16_.resize(storeMoments8 ? 0u : momentCount);
+   if (quantization != nullptr)
+   {
+      sweep.dataMoments16_.shrink_to_fit();
+   }
+   sweep.cfpMoments_.resize(layout.cfpEnabled_ ? momentCount : 0u);
+
+   std::for_each(
+      std::execution::par_unseq,
+      radialIndices.begin(),
+      radialIndices.end(),
+      [&](std::size_t radialIndex)
+      {
+         // Each radial is a contiguous row of the columnar sweep
+         const std::uint8_t*  dataMomentsArray8  = nullptr;
+         const std::uint16_t* dataMomentsArray16 = nullptr;
+         const std::uint8_t*  cfpMomentsArray    = nullptr;
+
+         if (wordSize8)
+         {
+            dataMomentsArray8 = columnarSweep.data_moments8(radialIndex).data();
+         }
+         else
+         {
+            dataMomentsArray16 =
+               columnarSweep.data_moments16(radialIndex).data();
+         }
+
+         if (layout.cfpEnabled_)
+         {
+            cfpMomentsArray = cfpSweep->data_moments8(radialIndex).data();
+         }
+
+         std::size_t mIndex = radialIndex * radialMoments;
+
+         for (std::int32_t gate = startGate, i = 0; gate + gateSize <= endGate;
+              gate += gateSize, ++i)
+         {
+            if (gate < 0)
+            {
+               continue;
+            }
+
+            const std::size_t vertexCount =
+               (gate > 0) ? kVerticesPerGate_ : kVerticesPerOriginGate_;
+
+            // Allow pointer arithmetic here, as bounds have already been
+            // checked
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+            // Hidden bins are stored with a data moment of zero
+            if (dataMomentsArray8 != nullptr)
+            {
+               std::uint8_t dataValue = dataMomentsArray8[i];
+               if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+               {
+                  dataValue = 0;
+               }
+
+               std::fill_n(
+                  &sweep.dataMoments8_[mIndex], vertexCount, dataValue);
+            }
+            else
+            {
+               std::uint16_t dataValue = dataMomentsArray16[i];
+               if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+               {
+                  dataValue = 0;
+               }
+
+               if (quantization != nullptr)
+               {
+                  std::fill_n(&sweep.dataMoments8_[mIndex],
+                              vertexCount,
+                              quantization->DisplayLevel(dataValue));
+               }
+               else
+               {
+                  std::fill_n(
+                     &sweep.dataMoments16_[mIndex], vertexCount, dataValue);
+               }
+            }
+
+            if (cfpMomentsArray != nullptr)
+            {
+               std::fill_n(
+                  &sweep.cfpMoments_[mIndex], vertexCount, cfpMomentsArray[i]);
+            }
+
+            // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+            mIndex += vertexCount;
+         }
+      });
+
+   sweep.vertices_.clear();
+   sweep.vertices_.shrink_to_fit();
+   sweep.quantization_.reset();
+
+   sweep.sharedVertices_  = std::move(grid);
+   sweep.polarGrid_       = std::move(polarGrid);
+   sweep.hideZeroMoments_ = true;
+}
+
+void Level2ProductView::Impl::PublishSweep()
+{
+   {
+      // The renderer reads the published sweep under the sweep mutex, which
+      // is only held by the computation for the swap itself
+      std::unique_lock sweepLock {self_->sweep_mutex()};
+      std::swap(sweep_, nextSweep_);
+   }
+
+   elevationScan_    = sweep_->elevationScan_;
+   momentDataBlock0_ = sweep_->momentDataBlock0_;
+   range_            = sweep_->range_;
+   sweepTime_        = sweep_->sweepTime_;
+   vcp_              = sweep_->vcp_;
+
+   // The previous sweep is retained, in case its elevation is selected again
+   RetainSweep(nextSweep_);
+
+   UpdateMemoryUsage();
+}
+
+std::list<std::unique_ptr<Level2ProductView::Impl::SweepBuffer>>::iterator
+Level2ProductView::Impl::FindRetainedSweep(
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+   bool                                               smoothingEnabled)
+{
+   return std::find_if(
+      retainedSweeps_.begin(),
+      retainedSweeps_.end(),
+      [&](const std::unique_ptr<SweepBuffer>& sweep)
+      {
+         // Sweeps computed with smoothing may be of incomplete elevations, and
+         // are only current if no radials have since been received
+         return sweep->elevationScan_ == radarData &&
+                sweep->radials_ == radarData->size() &&
+                sweep->dataBlockType_ == dataBlockType_ &&
+                IsQuantizationCurrent(*sweep) &&
+                sweep->smoothingEnabled_ == smoothingEnabled &&
+                (sweep->showSmoothedRangeFolding_ ==
+                    showSmoothedRangeFolding_ ||
+                 !smoothingEnabled);
+      });
+}
+
+void Level2ProductView::Impl::RetainSweep(std::unique_ptr<SweepBuffer>& sweep,
+                                          bool precomputed)
+{
+   const std::size_t budget = RetainedSweepBudget();
+
+   if (budget == 0u)
+   {
+      retainedSweeps_.clear();
+      retainedBytes_ = 0u;
+      return;
+   }
+
+   if (sweep->elevationScan_ == nullptr ||
+       (sweep->elevationScan_ == sweep_->elevationScan_ &&
+        sweep->smoothingEnabled_ == sweep_->smoothingEnabled_ &&
+        sweep->showSmoothedRangeFolding_ == sweep_->showSmoothedRangeFolding_))
+   {
+      // Only complete sweeps not currently published are retained
+      return;
+   }
+
+   // Replace any sweep previously retained for the same elevation scan
+   auto it = FindRetainedSweep(sweep->elevationScan_, sweep->smoothingEnabled_);
+   if (it != retainedSweeps_.end())
+   {
+      retainedBytes_ -= SweepBytes(**it);
+      retainedSweeps_.erase(it);
+   }
+
+   const std::size_t bytes = SweepBytes(*sweep);
+
+   if (precomputed)
+   {
+      // Precomputed sweeps have not been displayed, and do not displace
+      // retained sweeps
+      if (retainedBytes_ + bytes > budget)
+      {
+         return;
+      }
+
+      retainedSweeps_.push_back(std::move(sweep));
+   }
+   else
+   {
+      retainedSweeps_.push_front(std::move(sweep));
+   }
+
+   retainedBytes_ += bytes;
+   sweep = std::make_unique<SweepBuffer>();
+
+   // Evict the least recently used sweeps
+   while (retainedBytes_ > budget && !retainedSweeps_.empty())
+   {
+      retainedBytes_ -= SweepBytes(*retainedSweeps_.back());
+      retainedSweeps_.pop_back();
+   }
+}
+
+bool Level2ProductView::Impl::RestoreSweep(
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+   bool                                               smoothingEnabled)
+{
+   auto it = FindRetainedSweep(radarData, smoothingEnabled);
+   if (it == retainedSweeps_.end())
+   {
+      return false;
+   }
+
+   // Swap the retained sweep in, without copying its contents
+   retainedBytes_ -= SweepBytes(**it);
+   nextSweep_ = std::move(*it);
+   retainedSweeps_.erase(it);
+
+   PublishSweep();
+
+   return true;
 }
 
-void Level2ProductView::Impl::ComputeEdgeValue()
+void Level2ProductView::Impl::QueuePrecompute()
 {
-   const float offset = momentDataBlock0_->offset();
+   if (RetainedSweepBudget() == 0u)
+   {
+      return;
+   }
 
+   // Precompute the elevations nearest the selected elevation first
+   std::vector<float> elevations = elevationCuts_;
+   std::erase(elevations, elevationCut_);
+   std::stable_sort(elevations.begin(),
+                    elevations.end(),
+                    [this](float a, float b)
+                    {
+                       return std::abs(a - elevationCut_) <
+                              std::abs(b - elevationCut_);
+                    });
+
+   // Each elevation is posted separately, so sweeps requested for display are
+   // not queued behind the entire volume
+   const std::uint64_t generation = ++precomputeGeneration_;
+
+   for (float elevation : elevations)
+   {
+      strand_.Post([this, generation, elevation]()
+                   { PrecomputeSweep(generation, elevation); });
+   }
+}
+
+void Level2ProductView::Impl::PrecomputeSweep(std::uint64_t generation,
+                                              float         elevation)
+{
+   std::scoped_lock computeLock(computeMutex_);
+
+   if (generation != precomputeGeneration_ ||
+       sweep_->elevationScan_ == nullptr ||
+       retainedBytes_ >= RetainedSweepBudget())
+   {
+      // A newer sweep has been requested, or the elevation cache is full
+      return;
+   }
+
+   const bool smoothingEnabled = self_->smoothing_enabled();
+   showSmoothedRangeFolding_   = self_->show_smoothed_range_folding();
+
+   std::shared_ptr<wsr88d::rda::ElevationScan> radarData;
+   std::tie(radarData, std::ignore, std::ignore, std::ignore) =
+      GetLevel2Data(elevation, self_->selected_time());
+
+   if (radarData == nullptr || radarData == sweep_->elevationScan_ ||
+       FindRetainedSweep(radarData, smoothingEnabled) != retainedSweeps_.end())
+   {
+      // Nothing to precompute
+      return;
+   }
+
+   SPDLOG_LOGGER_TRACE(logger_, "Precomputing elevation {}", elevation);
+
+   if (ComputeNextSweep(radarData, smoothingEnabled, false, false))
+   {
+      RetainSweep(nextSweep_, true);
+      UpdateMemoryUsage();
+   }
+}
+
+std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+           float,
+           std::vector<float>,
+           std::chrono::system_clock::time_point>
+Level2ProductView::Impl::GetLevel2Data(
+   float elevation, std::chrono::system_clock::time_point time)
+{
+   auto radarProductManager = self_->radar_product_manager();
+
+   if (product_ == common::Level2Product::StormRelativeVelocity)
+   {
+      // Storm motion is subtracted from dealiased velocity when rendered, so
+      // the sweep does not depend on the storm motion
+      return radarProductManager->GetDerivedLevel2Data(
+         common::Level2Product::DealiasedVelocity,
+         elevation,
+         time,
+         self_->load_group());
+   }
+
+   if (wsr88d::rda::DerivedProduct::Get(product_) != nullptr)
+   {
+      // Derived products are computed and cached by the radar product manager
+      return radarProductManager->GetDerivedLevel2Data(
+         product_, elevation, time, self_->load_group());
+   }
+
+   if (settings::GeneralSettings::Instance().radar_latest_cut().GetValue())
+   {
+      // Display the newest cut of the elevation, including supplemental
+      // (SAILS/MESO-SAILS) scans received after the selected volume
+      return radarProductManager->GetLatestLevel2Data(
+         dataBlockType_, elevation, time, self_->load_group());
+   }
+
+   return radarProductManager->GetLevel2Data(
+      dataBlockType_, elevation, time, self_->load_group());
+}
+
+std::size_t Level2ProductView::Impl::SweepBytes(const SweepBuffer& sweep)
+{
+   // Shared vertices and polar grids are not owned by the sweep
+   return sweep.vertices_.capacity() * sizeof(std::int16_t) +
+          sweep.dataMoments8_.capacity() * sizeof(std::uint8_t) +
+          sweep.dataMoments16_.capacity() * sizeof(std::uint16_t) +
+          sweep.cfpMoments_.capacity() * sizeof(std::uint8_t);
+}
+
+void Level2ProductView::Impl::UpdateMemoryUsage()
+{
+   sweepMemory_.set_bytes(SweepBytes(*sweep_) + SweepBytes(*nextSweep_) +
+                          retainedBytes_);
+}
+
+std::size_t Level2ProductView::Impl::RetainedSweepBudget()
+{
+   // The elevation cache size is in megabytes
+   const std::int64_t cacheSize = settings::GeneralSettings::Instance()
+                                     .radar_elevation_cache_size()
+                                     .GetValue();
+   return static_cast<std::size_t>(std::max<std::int64_t>(cacheSize, 0)) *
+          1024u * 1024u;
+}
+
+template<typename T>
+void Level2ProductView::Impl::StoreBinVertices(
+   std::vector<T>&       vertices,
+   std::size_t&          vIndex,
+   const std::vector<T>& coordinates,
+   std::size_t           vertexRadials,
+   std::uint16_t         radial,
+   std::uint16_t         gate,
+   std::uint16_t         gateSize) const
+{
+   if (gate > 0)
+   {
+      // Draw two triangles per gate
+      //
+      // 2 +---+ 4
+      //   |  /|
+      //   | / |
+      //   |/  |
+      // 1 +---+ 3
+
+      const std::uint16_t baseCoord = gate - 1;
+
+      const std::size_t offset1 =
+         (radial % vertexRadials * common::MAX_DATA_MOMENT_GATES + baseCoord) *
+         2;
+      const std::size_t offset2 =
+         offset1 + static_cast<std::size_t>(gateSize) * 2;
+      const std::size_t offset3 = (((radial + 1) % vertexRadials) *
+                                      common::MAX_DATA_MOMENT_GATES +
+                                   baseCoord) *
+                                  2;
+      const std::size_t offset4 =
+         offset3 + static_cast<std::size_t>(gateSize) * 2;
+
+      vertices[vIndex++] = coordinates[offset1];
+      vertices[vIndex++] = coordinates[offset1 + 1];
+
+      vertices[vIndex++] = coordinates[offset2];
+      vertices[vIndex++] = coordinates[offset2 + 1];
+
+      vertices[vIndex++] = coordinates[offset4];
+      vertices[vIndex++] = coordinates[offset4 + 1];
+
+      vertices[vIndex++] = coordinates[offset1];
+      vertices[vIndex++] = coordinates[offset1 + 1];
+
+      vertices[vIndex++] = coordinates[offset3];
+      vertices[vIndex++] = coordinates[offset3 + 1];
+
+      vertices[vIndex++] = coordinates[offset4];
+      vertices[vIndex++] = coordinates[offset4 + 1];
+   }
+   else
+   {
+      const std::uint16_t baseCoord = gate;
+
+      const std::size_t offset1 =
+         (radial % vertexRadials * common::MAX_DATA_MOMENT_GATES + baseCoord) *
+         2;
+      const std::size_t offset2 = (((radial + 1) % vertexRadials) *
+                                      common::MAX_DATA_MOMENT_GATES +
+                                   baseCoord) *
+                                  2;
+
+      // The radar site is the origin of quantized vertices
+      if constexpr (std::is_same_v<T, float>)
+      {
+         vertices[vIndex++] = latitude_;
+         vertices[vIndex++] = longitude_;
+      }
+      else
+      {
+         vertices[vIndex++] = T {};
+         vertices[vIndex++] = T {};
+      }
+
+      vertices[vIndex++] = coordinates[offset1];
+      vertices[vIndex++] = coordinates[offset1 + 1];
+
+      vertices[vIndex++] = coordinates[offset2];
+      vertices[vIndex++] = coordinates[offset2 + 1];
+   }
+}
+
+void Level2ProductView::Impl::ComputeEdgeValue(float offset)
+{
    switch (dataBlockType_)
    {
    case wsr88d::rda::DataBlockType::MomentVel:
@@ -1046,20 +2129,116 @@ void Level2ProductView::Impl::ComputeEdgeValue()
    }
 }
 
+void Level2ProductView::Impl::UpdateSmoothingLuts(std::uint16_t snrThreshold,
+                                                  float         offset)
+{
+   ComputeEdgeValue(offset);
+
+   const SmoothingLutKey key {
+      dataBlockType_, edgeValue_, snrThreshold, showSmoothedRangeFolding_};
+
+   if (smoothingLutKey_ == key)
+   {
+      return;
+   }
+
+   logger_->debug("Updating smoothing tables");
+
+   auto IsVisible = [this](std::uint16_t dm)
+   {
+      return dm != 0 && (dm != RANGE_FOLDED || showSmoothedRangeFolding_);
+   };
+   auto IsHidden = [&](std::uint16_t dm)
+   {
+      return showSmoothedRangeFolding_ ?
+                (dm < snrThreshold && dm != RANGE_FOLDED) :
+                (dm < snrThreshold || dm == RANGE_FOLDED);
+   };
+
+   for (std::size_t i = 0; i < remapLut8_.size(); ++i)
+   {
+      const auto dm = static_cast<std::uint16_t>(i);
+      remapLut8_[i] =
+         static_cast<std::uint8_t>(IsVisible(dm) ? dm : edgeValue_);
+      hiddenLut8_[i] = IsHidden(dm) ? 1u : 0u;
+   }
+
+   // Every data moment at or above the threshold, other than the special
+   // codes, is visible and not hidden, and shares the last bucket
+   const std::size_t buckets =
+      std::max<std::size_t>(snrThreshold, RANGE_FOLDED + 1u) + 1u;
+
+   visibleLut16_.resize(buckets);
+   hiddenLut16_.resize(buckets);
+   for (std::size_t i = 0; i < buckets; ++i)
+   {
+      const auto dm    = static_cast<std::uint16_t>(i);
+      visibleLut16_[i] = IsVisible(dm) ? 1u : 0u;
+      hiddenLut16_[i]  = IsHidden(dm) ? 1u : 0u;
+   }
+
+   smoothingLutKey_ = key;
+}
+
+std::size_t Level2ProductView::Impl::Bucket16(std::uint16_t dataMoment) const
+{
+   return std::min<std::size_t>(dataMoment, visibleLut16_.size() - 1u);
+}
+
 template<typename T>
 T Level2ProductView::Impl::RemapDataMoment(T dataMoment) const
 {
-   if (dataMoment != 0 &&
-       (dataMoment != RANGE_FOLDED || showSmoothedRangeFolding_))
+   if constexpr (std::is_same_v<T, std::uint8_t>)
    {
-      return dataMoment;
+      return remapLut8_[dataMoment];
    }
    else
    {
-      return edgeValue_;
+      // Written as a select, so the remapping does not branch per bin
+      const bool visible = visibleLut16_[Bucket16(dataMoment)] != 0;
+      return visible ? dataMoment : static_cast<T>(edgeValue_);
    }
 }
 
+template<typename T>
+bool Level2ProductView::Impl::IsSmoothedBinHidden(T dm1,
+                                                  T dm2,
+                                                  T dm3,
+                                                  T dm4) const
+{
+   // A smoothed bin is hidden only if all of its data moments are hidden
+   if constexpr (std::is_same_v<T, std::uint8_t>)
+   {
+      return (hiddenLut8_[dm1] & hiddenLut8_[dm2] & hiddenLut8_[dm3] &
+              hiddenLut8_[dm4]) != 0;
+   }
+   else
+   {
+      return (hiddenLut16_[Bucket16(dm1)] & hiddenLut16_[Bucket16(dm2)] &
+              hiddenLut16_[Bucket16(dm3)] & hiddenLut16_[Bucket16(dm4)]) != 0;
+   }
+}
+
+template<typename T>
+void Level2ProductView::Impl::StoreSmoothedMoments(
+   T* dest, T dm1, T dm2, T dm3, T dm4) const
+{
+   const std::array<T, 4> remapped {RemapDataMoment(dm1),
+                                    RemapDataMoment(dm2),
+                                    RemapDataMoment(dm3),
+                                    RemapDataMoment(dm4)};
+
+   // Vertex order is 1, 2, 4, 1, 3, 4, matching the sweep triangles
+   // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+   dest[0] = remapped[0];
+   dest[1] = remapped[1];
+   dest[2] = remapped[3];
+   dest[3] = remapped[0];
+   dest[4] = remapped[2];
+   dest[5] = remapped[3];
+   // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
 void Level2ProductView::Impl::ComputeCoordinates(
    const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
    bool                                               smoothingEnabled)
@@ -1077,6 +2256,13 @@ void Level2ProductView::Impl::ComputeCoordinates(
    const double radarLatitude       = radarSite->latitude();
    const double radarLongitude      = radarSite->longitude();
 
+   // The quantization depends only on the radar site, so coordinates retained
+   // from a previous computation remain valid
+   quantization_ = RadarVertexQuantization::Create(
+      radarLatitude,
+      radarLongitude,
+      static_cast<double>(gateSize) * common::MAX_DATA_MOMENT_GATES);
+
    // Calculate azimuth coordinates
    timer.start();
 
@@ -1236,6 +2422,11 @@ void Level2ProductView::Impl::ComputeCoordinates(
 
                coordinates_[offset]     = static_cast<float>(latitude);
                coordinates_[offset + 1] = static_cast<float>(longitude);
+
+               quantizedCoordinates_[offset] =
+                  quantization_.QuantizeLatitude(latitude);
+               quantizedCoordinates_[offset + 1] =
+                  quantization_.QuantizeLongitude(longitude);
             });
       });
    timer.stop();
@@ -1259,6 +2450,26 @@ bool Level2ProductView::Impl::IsRadarDataIncomplete(
    return angleDelta > kIncompleteDataAngleThreshold_;
 }
 
+std::optional<std::uint16_t> Level2ProductView::Impl::FindRadial(
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData,
+   double                                             azimuth)
+{
+   std::unique_lock lock {azimuthIndexMutex_};
+
+   // Rebuild the index for a new elevation scan, or when radials have been
+   // added to an incomplete scan
+   if (radarData != azimuthIndexScan_ ||
+       radarData->size() != azimuthIndexRadials_)
+   {
+      azimuthIndex_.Build(
+         util::ElevationScanInspector::GetRadials(*radarData));
+      azimuthIndexScan_    = radarData;
+      azimuthIndexRadials_ = radarData->size();
+   }
+
+   return azimuthIndex_.Find(azimuth);
+}
+
 units::degrees<float>
 Level2ProductView::Impl::NormalizeAngle(units::degrees<float> angle)
 {
@@ -1320,87 +2531,9 @@ Level2ProductView::GetBinLevel(const common::Coordinate& coordinate) const
    }
 
    // Find Radial
-   std::uint16_t numRadials =
-      static_cast<std::uint16_t>(radarData->crbegin()->first + 1);
-
-   // Add an extra radial when incomplete data exists
-   if (Impl::IsRadarDataIncomplete(radarData))
-   {
-      ++numRadials;
-   }
-
-   // Limit radials
-   numRadials =
-      std::min<std::uint16_t>(numRadials, common::MAX_0_5_DEGREE_RADIALS);
-
-   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-
-   auto radial = std::find_if( //
-      std::execution::par_unseq,
-      radials.begin(),
-      radials.end(),
-      [&](std::uint32_t i)
-      {
-         bool hasNextAngle = false;
-         bool found        = false;
-
-         units::degrees<float> startAngle {};
-         units::degrees<float> nextAngle {};
-
-         auto radialData = radarData->find(i);
-         if (radialData != radarData->cend())
-         {
-            startAngle = radialData->second->azimuth_angle();
-
-            auto nextRadial = radarData->find((i + 1) % numRadials);
-            if (nextRadial != radarData->cend())
-            {
-               nextAngle    = nextRadial->second->azimuth_angle();
-               hasNextAngle = true;
-            }
-            else
-            {
-               // Next angle is not available, interpolate
-               auto prevRadial =
-                  radarData->find((i >= 1) ? i - 1 : numRadials - (1 - i));
-
-               if (prevRadial != radarData->cend())
-               {
-                  const units::degrees<float> prevAngle =
-                     prevRadial->second->azimuth_angle();
-
-                  const units::degrees<float> deltaAngle =
-                     common::GetAngleDelta(startAngle, prevAngle);
+   const std::optional<std::uint16_t> radial = p->FindRadial(radarData, azi1);
 
-                  nextAngle    = startAngle + deltaAngle;
-                  hasNextAngle = true;
-               }
-            }
-         }
-
-         if (hasNextAngle)
-         {
-            if (startAngle < nextAngle)
-            {
-               if (startAngle.value() <= azi1 && azi1 < nextAngle.value())
-               {
-                  found = true;
-               }
-            }
-            else
-            {
-               // If the bin crosses 0/360 degrees, special handling is needed
-               if (startAngle.value() <= azi1 || azi1 < nextAngle.value())
-               {
-                  found = true;
-               }
-            }
-         }
-
-         return found;
-      });
-
-   if (radial == radials.end())
+   if (!radial.has_value())
    {
       // No radial was found (not likely to happen without a gap in data)
       return std::nullopt;
@@ -1454,6 +2587,23 @@ Level2ProductView::GetBinLevel(const common::Coordinate& coordinate) const
       return std::nullopt;
    }
 
+   // Subtract storm motion along the radial, as when rendered
+   const std::optional<RadarStormMotion> stormMotion = storm_motion();
+   if (stormMotion.has_value() && level >= 2u)
+   {
+      const float maxLevel =
+         (momentData->data_word_size() == 8) ?
+            static_cast<float>(std::numeric_limits<std::uint8_t>::max()) :
+            static_cast<float>(std::numeric_limits<std::uint16_t>::max());
+      const float azimuth = (*radarData)[*radial]->azimuth_angle().value();
+
+      level = static_cast<std::uint16_t>(
+         std::clamp(std::round(static_cast<float>(level) -
+                               stormMotion->LevelOffset(azimuth)),
+                    2.0f,
+                    maxLevel));
+   }
+
    return level;
 }
 
@@ -1467,6 +2617,9 @@ Level2ProductView::GetDataLevelCode(std::uint16_t level) const
    case common::Level2Product::SpectrumWidth:
    case common::Level2Product::DifferentialReflectivity:
    case common::Level2Product::DifferentialPhase:
+   case common::Level2Product::DealiasedVelocity:
+   case common::Level2Product::StormRelativeVelocity:
+   case common::Level2Product::CompositeReflectivity:
    case common::Level2Product::CorrelationCoefficient:
       if (level == RANGE_FOLDED)
       {
@@ -1514,6 +2667,13 @@ std::optional<float> Level2ProductView::GetDataValue(std::uint16_t level) const
    case common::Level2Product::SpectrumWidth:
    case common::Level2Product::DifferentialReflectivity:
    case common::Level2Product::DifferentialPhase:
+   case common::Level2Product::DealiasedVelocity:
+   case common::Level2Product::StormRelativeVelocity:
+   case common::Level2Product::CompositeReflectivity:
+   case common::Level2Product::EchoTops:
+   case common::Level2Product::OneHourPrecipitation:
+   case common::Level2Product::ThreeHourPrecipitation:
+   case common::Level2Product::StormTotalPrecipitation:
    case common::Level2Product::CorrelationCoefficient:
       threshold = 2;
       break;
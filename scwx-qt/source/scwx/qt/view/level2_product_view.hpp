@@ -38,6 +38,18 @@ public:
    std::uint16_t                         vcp() const override;
    const std::vector<float>&             vertices() const override;
 
+   std::shared_ptr<const std::vector<float>> shared_vertices() const override;
+   bool                                      hide_zero_moments() const override;
+   std::shared_ptr<const RadarPolarGrid>     polar_grid() const override;
+
+   const std::vector<std::int16_t>& quantized_vertices() const override;
+   std::optional<RadarVertexQuantization> vertex_quantization() const override;
+   std::optional<RadarStormMotion>        storm_motion() const override;
+   std::shared_ptr<const RadarMomentQuantization>
+   moment_quantization() const override;
+
+   std::shared_ptr<const ColorTableLut> shared_color_table_lut() const override;
+
    void LoadColorTable(std::shared_ptr<common::ColorTable> colorTable) override;
    void SelectElevation(float elevation) override;
    void SelectProduct(const std::string& productName) override;
@@ -61,7 +73,7 @@ public:
           std::shared_ptr<manager::RadarProductManager> radarProductManager);
 
 protected:
-   boost::asio::thread_pool& thread_pool() override;
+   scwx::util::Strand& strand() override;
 
    void ConnectRadarProductManager() override;
    void DisconnectRadarProductManager() override;
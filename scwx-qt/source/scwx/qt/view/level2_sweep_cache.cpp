@@ -0,0 +1,104 @@
+#include <scwx/qt/view/level2_sweep_cache.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <cmath>
+#include <map>
+#include <mutex>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string logPrefix_ = "scwx::qt::view::level2_sweep_cache";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Azimuths are quantized to 0.01 degrees, well under the width of a bin
+static constexpr float kAzimuthQuantization_ = 100.0f;
+
+class Level2SweepCache::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() {}
+
+   void PurgeExpired();
+
+   std::map<Level2SweepGridKey, std::weak_ptr<const Geometry>> grids_ {};
+   mutable std::mutex                                          gridsMutex_ {};
+};
+
+void Level2SweepCache::Impl::PurgeExpired()
+{
+   std::erase_if(grids_,
+                 [](const auto& entry) { return entry.second.expired(); });
+}
+
+Level2SweepCache::Level2SweepCache() : p(std::make_unique<Impl>()) {}
+Level2SweepCache::~Level2SweepCache() = default;
+
+std::size_t Level2SweepCache::size() const
+{
+   std::unique_lock lock {p->gridsMutex_};
+   return p->grids_.size();
+}
+
+std::int32_t Level2SweepCache::QuantizeAzimuth(float azimuth)
+{
+   return static_cast<std::int32_t>(
+      std::lround(azimuth * kAzimuthQuantization_));
+}
+
+std::shared_ptr<const Level2SweepCache::Geometry>
+Level2SweepCache::GetGrid(const Level2SweepGridKey& key)
+{
+   std::unique_lock lock {p->gridsMutex_};
+
+   auto it = p->grids_.find(key);
+   if (it == p->grids_.end())
+   {
+      return nullptr;
+   }
+
+   std::shared_ptr<const Geometry> grid = it->second.lock();
+   if (grid != nullptr)
+   {
+      SPDLOG_LOGGER_TRACE(logger_, "Using cached grid: {}", key.radarId_);
+   }
+
+   return grid;
+}
+
+std::shared_ptr<const Level2SweepCache::Geometry>
+Level2SweepCache::InsertGrid(const Level2SweepGridKey&       key,
+                             std::shared_ptr<const Geometry> grid)
+{
+   std::unique_lock lock {p->gridsMutex_};
+
+   p->PurgeExpired();
+
+   auto& entry = p->grids_[key];
+
+   std::shared_ptr<const Geometry> existingGrid = entry.lock();
+   if (existingGrid != nullptr)
+   {
+      // Another view computed the same grid first
+      return existingGrid;
+   }
+
+   entry = grid;
+
+   return grid;
+}
+
+Level2SweepCache& Level2SweepCache::Instance()
+{
+   static Level2SweepCache level2SweepCache_ {};
+   return level2SweepCache_;
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+struct Level2SweepGridKey
+{
+   std::string   radarId_ {};
+   float         latitude_ {};
+   float         longitude_ {};
+   std::uint16_t vertexRadials_ {};
+   std::int32_t  startGate_ {};
+   std::int32_t  gateSize_ {};
+   std::int32_t  endGate_ {};
+
+   /**
+    * @brief Radial number and quantized azimuth angle of each radial, in sweep
+    * order.
+    */
+   std::vector<std::pair<std::uint16_t, std::int32_t>> radials_ {};
+
+   auto operator<=>(const Level2SweepGridKey&) const = default;
+};
+
+/**
+ * @brief Shares Level 2 sweep vertex grids between product views. A grid holds
+ * the vertices of every bin of a sweep, and depends only on the radar site,
+ * the radial layout and the gate range. Entries are held weakly, and expire
+ * once no view references them.
+ */
+class Level2SweepCache
+{
+public:
+   /**
+    * @brief Latitude/longitude pairs, holding the vertices of every bin.
+    */
+   typedef std::vector<float> Geometry;
+
+   explicit Level2SweepCache();
+   ~Level2SweepCache();
+
+   Level2SweepCache(const Level2SweepCache&)            = delete;
+   Level2SweepCache& operator=(const Level2SweepCache&) = delete;
+
+   Level2SweepCache(Level2SweepCache&&)            = delete;
+   Level2SweepCache& operator=(Level2SweepCache&&) = delete;
+
+   std::size_t size() const;
+
+   /**
+    * @brief Quantizes an azimuth angle for use in a grid key. Sweeps whose
+    * azimuths quantize to the same values share a grid.
+    *
+    * @param azimuth Azimuth angle (degrees)
+    *
+    * @return Quantized azimuth angle
+    */
+   static std::int32_t QuantizeAzimuth(float azimuth);
+
+   /**
+    * @brief Gets a cached grid.
+    *
+    * @param key Grid key
+    *
+    * @return Cached grid, or nullptr if none is cached
+    */
+   std::shared_ptr<const Geometry> GetGrid(const Level2SweepGridKey& key);
+
+   /**
+    * @brief Caches a grid. If another view cached a grid for the same key
+    * first, that grid is returned instead.
+    *
+    * @param key Grid key
+    * @param grid Computed grid
+    *
+    * @return Grid to use
+    */
+   std::shared_ptr<const Geometry>
+   InsertGrid(const Level2SweepGridKey&       key,
+              std::shared_ptr<const Geometry> grid);
+
+   static Level2SweepCache& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -47,8 +47,6 @@ public:
        graphicMessage_ {nullptr},
        colorTable_ {},
        colorTableLut_ {},
-       colorTableMin_ {2},
-       colorTableMax_ {254},
        savedColorTable_ {nullptr},
        savedScale_ {0.0f},
        savedOffset_ {0.0f}
@@ -98,10 +96,8 @@ public:
 
    std::shared_ptr<wsr88d::rpg::GraphicProductMessage> graphicMessage_;
 
-   std::shared_ptr<common::ColorTable>    colorTable_;
-   std::vector<boost::gil::rgba8_pixel_t> colorTableLut_;
-   uint16_t                               colorTableMin_;
-   uint16_t                               colorTableMax_;
+   std::shared_ptr<common::ColorTable>  colorTable_;
+   std::shared_ptr<const ColorTableLut> colorTableLut_;
 
    std::shared_ptr<common::ColorTable> savedColorTable_;
    float                               savedScale_ {1.0f};
@@ -165,40 +161,46 @@ std::shared_ptr<common::ColorTable> Level3ProductView::color_table() const
 const std::vector<boost::gil::rgba8_pixel_t>&
 Level3ProductView::color_table_lut() const
 {
-   if (p->colorTableLut_.size() == 0)
+   if (p->colorTableLut_ == nullptr || p->colorTableLut_->lut_.size() == 0)
    {
       return RadarProductView::color_table_lut();
    }
    else
    {
-      return p->colorTableLut_;
+      return p->colorTableLut_->lut_;
    }
 }
 
 uint16_t Level3ProductView::color_table_min() const
 {
-   if (p->colorTableLut_.size() == 0)
+   if (p->colorTableLut_ == nullptr || p->colorTableLut_->lut_.size() == 0)
    {
       return RadarProductView::color_table_min();
    }
    else
    {
-      return p->colorTableMin_;
+      return p->colorTableLut_->min_;
    }
 }
 
 uint16_t Level3ProductView::color_table_max() const
 {
-   if (p->colorTableLut_.size() == 0)
+   if (p->colorTableLut_ == nullptr || p->colorTableLut_->lut_.size() == 0)
    {
       return RadarProductView::color_table_max();
    }
    else
    {
-      return p->colorTableMax_;
+      return p->colorTableLut_->max_;
    }
 }
 
+std::shared_ptr<const ColorTableLut>
+Level3ProductView::shared_color_table_lut() const
+{
+   return p->colorTableLut_;
+}
+
 float Level3ProductView::unit_scale() const
 {
    switch (p->category_)
@@ -415,65 +417,98 @@ void Level3ProductView::UpdateColorTableLut()
       return;
    }
 
-   // Iterate over [rangeMin, numberOfLevels)
-   boost::integer_range<uint16_t> dataRange =
-      boost::irange<uint16_t>(rangeMin, numberOfLevels);
-
-   std::vector<boost::gil::rgba8_pixel_t>& lut = p->colorTableLut_;
-   lut.resize(numberOfLevels - rangeMin);
-   lut.shrink_to_fit();
+   ColorTableLutKey key {};
+   key.colorTable_     = p->colorTable_.get();
+   key.product_        = p->product_;
+   key.productCode_    = descriptionBlock->product_code();
+   key.offset_         = offset;
+   key.scale_          = scale;
+   key.logOffset_      = logOffset;
+   key.logScale_       = logScale;
+   key.logStart_       = logStart;
+   key.threshold_      = threshold;
+   key.numberOfLevels_ = numberOfLevels;
+   key.rangeMin_       = rangeMin;
+   key.rangeMax_       = rangeMax;
+
+   if (numberOfLevels <= 16)
+   {
+      // Data level coded products are described by their thresholds
+      for (std::size_t i = 0; i < key.dataLevelThresholds_.size(); ++i)
+      {
+         key.dataLevelThresholds_[i] =
+            descriptionBlock->data_level_threshold(i);
+      }
+   }
 
-   std::for_each(
-      std::execution::par_unseq,
-      dataRange.begin(),
-      dataRange.end(),
-      [&](uint16_t i)
+   // Views of the same product and color table share a lookup table
+   p->colorTableLut_ = ColorTableLutCache::Instance().GetOrBuild(
+      key,
+      [&]()
       {
-         const size_t lutIndex = i - *dataRange.begin();
+         auto colorTableLut         = std::make_shared<ColorTableLut>();
+         colorTableLut->colorTable_ = p->colorTable_;
+         colorTableLut->min_        = rangeMin;
+         colorTableLut->max_        = rangeMax;
+
+         // Iterate over [rangeMin, numberOfLevels)
+         boost::integer_range<uint16_t> dataRange =
+            boost::irange<uint16_t>(rangeMin, numberOfLevels);
+
+         std::vector<boost::gil::rgba8_pixel_t>& lut = colorTableLut->lut_;
+         lut.resize(numberOfLevels - rangeMin);
+
+         // Levels with data values are colored together, such that the color
+         // table is swept once when the values increase with the level
+         std::vector<float>       values {};
+         std::vector<std::size_t> valueIndices {};
+         values.reserve(lut.size());
+         valueIndices.reserve(lut.size());
+
+         for (std::uint16_t i : dataRange)
+         {
+            const size_t lutIndex = i - *dataRange.begin();
 
-         std::optional<float> f = descriptionBlock->data_value(i);
+            std::optional<float> f = descriptionBlock->data_value(i);
 
-         // Different products use different scale/offset formulas
-         if (numberOfLevels > 16 || !descriptionBlock->IsDataLevelCoded())
-         {
-            if (i == RANGE_FOLDED && threshold > RANGE_FOLDED)
+            bool rangeFolded;
+
+            // Different products use different scale/offset formulas
+            if (numberOfLevels > 16 || !descriptionBlock->IsDataLevelCoded())
             {
-               lut[lutIndex] = p->colorTable_->rf_color();
+               rangeFolded = (i == RANGE_FOLDED && threshold > RANGE_FOLDED);
             }
             else
             {
-               if (f.has_value())
-               {
-                  lut[lutIndex] = p->colorTable_->Color(f.value());
-               }
-               else
-               {
-                  lut[lutIndex] = boost::gil::rgba8_pixel_t {0, 0, 0, 0};
-               }
+               rangeFolded = (descriptionBlock->data_level_code(i) ==
+                              wsr88d::DataLevelCode::RangeFolded);
             }
-         }
-         else
-         {
-            std::optional<wsr88d::DataLevelCode> dataLevelCode =
-               descriptionBlock->data_level_code(i);
 
-            if (dataLevelCode == wsr88d::DataLevelCode::RangeFolded)
+            if (rangeFolded)
             {
                lut[lutIndex] = p->colorTable_->rf_color();
             }
             else if (f.has_value())
             {
-               lut[lutIndex] = p->colorTable_->Color(f.value());
+               values.push_back(f.value());
+               valueIndices.push_back(lutIndex);
             }
             else
             {
                lut[lutIndex] = boost::gil::rgba8_pixel_t {0, 0, 0, 0};
             }
          }
-      });
 
-   p->colorTableMin_ = rangeMin;
-   p->colorTableMax_ = rangeMax;
+         std::vector<boost::gil::rgba8_pixel_t> colors(values.size());
+         p->colorTable_->Colors(values, colors);
+
+         for (std::size_t j = 0; j < valueIndices.size(); ++j)
+         {
+            lut[valueIndices[j]] = colors[j];
+         }
+
+         return colorTableLut;
+      });
 
    p->savedColorTable_ = p->colorTable_;
    p->savedOffset_     = offset;
@@ -33,6 +33,8 @@ public:
    float         unit_scale() const override;
    std::string   units() const override;
 
+   std::shared_ptr<const ColorTableLut> shared_color_table_lut() const override;
+
    void LoadColorTable(std::shared_ptr<common::ColorTable> colorTable) override;
 
    common::RadarProductGroup GetRadarProductGroup() const override;
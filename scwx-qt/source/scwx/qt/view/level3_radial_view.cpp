@@ -1,4 +1,6 @@
 #include <scwx/qt/view/level3_radial_view.hpp>
+#include <scwx/qt/view/level3_sweep_cache.hpp>
+#include <scwx/qt/util/azimuth_index.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
@@ -41,7 +43,7 @@ public:
    {
       coordinates_.resize(kMaxCoordinates_);
    }
-   ~Impl() { threadPool_.join(); };
+   ~Impl() { strand_.Join(); };
 
    void ComputeCoordinates(
       const std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket>& radialData,
@@ -50,14 +52,26 @@ public:
    [[nodiscard]] inline std::uint8_t
    RemapDataMoment(std::uint8_t dataMoment) const;
 
+   inline void StoreBinVertices(std::vector<float>&    vertices,
+                                std::size_t&           vIndex,
+                                std::span<const float> coordinates,
+                                std::size_t            radials,
+                                std::uint16_t          startRadial,
+                                std::uint16_t          radial,
+                                std::uint16_t          gate,
+                                std::uint16_t          gateSize) const;
+
+   std::optional<std::uint16_t> FindRadial(
+      const std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket>& radialData,
+      double                                                       azimuth);
+
    Level3RadialView* self_;
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::Strand strand_ {"Level 3 Radial View"};
 
-   std::vector<float>        coordinates_ {};
-   std::vector<float>        vertices_ {};
-   std::vector<std::uint8_t> dataMoments8_ {};
-   std::uint8_t              edgeValue_ {};
+   std::vector<float>                 coordinates_ {};
+   std::shared_ptr<const Level3Sweep> sweep_ {};
+   std::uint8_t                       edgeValue_ {};
 
    bool showSmoothedRangeFolding_ {false};
 
@@ -65,6 +79,12 @@ public:
    bool lastShowSmoothedRangeFolding_ {false};
    bool lastSmoothingEnabled_ {false};
 
+   // Azimuth index of the most recently inspected radial data, used to find
+   // the bin under the cursor
+   std::mutex                                            azimuthIndexMutex_ {};
+   std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket> azimuthIndexData_ {};
+   util::AzimuthIndex                                    azimuthIndex_ {};
+
    float         latitude_;
    float         longitude_;
    float         range_;
@@ -86,9 +106,9 @@ Level3RadialView::~Level3RadialView()
    std::unique_lock sweepLock {sweep_mutex()};
 }
 
-boost::asio::thread_pool& Level3RadialView::thread_pool()
+scwx::util::Strand& Level3RadialView::strand()
 {
-   return p->threadPool_;
+   return p->strand_;
 }
 
 float Level3RadialView::range() const
@@ -108,7 +128,27 @@ uint16_t Level3RadialView::vcp() const
 
 const std::vector<float>& Level3RadialView::vertices() const
 {
-   return p->vertices_;
+   static const std::vector<float> kEmptyVertices_ {};
+
+   return (p->sweep_ != nullptr && p->sweep_->vertices_ != nullptr) ?
+             *p->sweep_->vertices_ :
+             kEmptyVertices_;
+}
+
+std::shared_ptr<const std::vector<float>>
+Level3RadialView::shared_vertices() const
+{
+   return (p->sweep_ != nullptr) ? p->sweep_->vertices_ : nullptr;
+}
+
+bool Level3RadialView::hide_zero_moments() const
+{
+   return (p->sweep_ != nullptr) ? p->sweep_->hideZeroMoments_ : false;
+}
+
+std::shared_ptr<const RadarPolarGrid> Level3RadialView::polar_grid() const
+{
+   return (p->sweep_ != nullptr) ? p->sweep_->polarGrid_ : nullptr;
 }
 
 std::tuple<const void*, size_t, size_t> Level3RadialView::GetMomentData() const
@@ -117,8 +157,16 @@ std::tuple<const void*, size_t, size_t> Level3RadialView::GetMomentData() const
    size_t      dataSize;
    size_t      componentSize;
 
-   data          = p->dataMoments8_.data();
-   dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
+   if (p->sweep_ != nullptr)
+   {
+      data     = p->sweep_->dataMoments8_.data();
+      dataSize = p->sweep_->dataMoments8_.size() * sizeof(uint8_t);
+   }
+   else
+   {
+      data     = nullptr;
+      dataSize = 0;
+   }
    componentSize = 1;
 
    return std::tie(data, dataSize, componentSize);
@@ -126,7 +174,7 @@ std::tuple<const void*, size_t, size_t> Level3RadialView::GetMomentData() const
 
 void Level3RadialView::ComputeSweep()
 {
-   logger_->trace("ComputeSweep()");
+   SPDLOG_LOGGER_TRACE(logger_, "ComputeSweep()");
 
    boost::timer::cpu_timer timer;
 
@@ -142,13 +190,13 @@ void Level3RadialView::ComputeSweep()
    std::shared_ptr<wsr88d::rpg::Level3Message> message;
    std::chrono::system_clock::time_point       requestedTime {selected_time()};
    std::chrono::system_clock::time_point       foundTime;
-   std::tie(message, foundTime) =
-      radarProductManager->GetLevel3Data(GetRadarProductName(), requestedTime);
+   std::tie(message, foundTime) = radarProductManager->GetLevel3Data(
+      GetRadarProductName(), requestedTime, load_group());
 
    // If a different time was found than what was requested, update it
    if (requestedTime != foundTime)
    {
-      SelectTime(foundTime);
+      SnapSelectedTime(foundTime);
    }
 
    if (message == nullptr)
@@ -158,6 +206,13 @@ void Level3RadialView::ComputeSweep()
       return;
    }
 
+   if (is_update_pending())
+   {
+      // The selection has changed since the computation started, and a queued
+      // computation supersedes this one
+      return;
+   }
+
    // A message with radial data should be a Graphic Product Message
    std::shared_ptr<wsr88d::rpg::GraphicProductMessage> gpm =
       std::dynamic_pointer_cast<wsr88d::rpg::GraphicProductMessage>(message);
@@ -282,9 +337,9 @@ void Level3RadialView::ComputeSweep()
       radialSize = common::RadialSize::NonStandard;
    }
 
-   const std::vector<float>& coordinates =
+   const std::span<const float> coordinates =
       (radialSize == common::RadialSize::NonStandard) ?
-         p->coordinates_ :
+         std::span<const float> {p->coordinates_} :
          radarProductManager->coordinates(radialSize, smoothingEnabled);
 
    // There should be a positive number of range bins in radial data
@@ -304,21 +359,29 @@ void Level3RadialView::ComputeSweep()
                             descriptionBlock->volume_scan_start_time() * 1000);
    p->vcp_ = descriptionBlock->volume_coverage_pattern();
 
-   // Calculate vertices
-   timer.start();
+   // Use the sweep computed by another view of the same product, if present
+   const Level3SweepKey sweepKey {radarProductManager->radar_site()->id(),
+                                  GetRadarProductName(),
+                                  foundTime,
+                                  smoothingEnabled,
+                                  showSmoothedRangeFolding};
 
-   // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
-   vertices.clear();
-   vertices.resize(radials * numberOfDataMomentGates * VERTICES_PER_BIN *
-                   VALUES_PER_VERTEX);
+   auto& sweepCache = Level3SweepCache::Instance();
 
-   // Setup data moment vector
-   std::vector<uint8_t>& dataMoments8 = p->dataMoments8_;
-   size_t                mIndex       = 0;
+   std::shared_ptr<const Level3Sweep> cachedSweep =
+      sweepCache.Get(sweepKey, gpm);
+   if (cachedSweep != nullptr)
+   {
+      p->sweep_ = cachedSweep;
 
-   dataMoments8.resize(radials * numberOfDataMomentGates * VERTICES_PER_BIN);
+      UpdateColorTableLut();
+
+      Q_EMIT SweepComputed();
+      return;
+   }
+
+   auto sweep      = std::make_shared<Level3Sweep>();
+   sweep->message_ = gpm;
 
    // Compute threshold at which to display an individual bin
    const uint16_t snrThreshold = descriptionBlock->threshold();
@@ -365,139 +428,227 @@ void Level3RadialView::ComputeSweep()
       p->edgeValue_ = ComputeEdgeValue();
    }
 
-   for (std::uint16_t radial = 0; radial < radialData->number_of_radials();
-        ++radial)
-   {
-      const auto& dataMomentsArray8 = radialData->level(radial);
+   // Without smoothing, a standard radial layout uses a vertex grid covering
+   // every bin, shared between sweeps. Bins below the threshold are hidden by
+   // a zero data moment instead of being removed from the vertices, so only
+   // the data moments change from one sweep to the next.
+   const bool useRadialGrid = !smoothingEnabled && snrThreshold > 0 &&
+                              radialSize != common::RadialSize::NonStandard;
 
-      const std::uint16_t nextRadial =
-         (radial == radialData->number_of_radials() - 1) ? 0 : radial + 1;
-      const auto& nextDataMomentsArray8 = radialData->level(nextRadial);
+   // Calculate vertices
+   timer.start();
 
-      for (std::uint16_t gate = startGate, i = 0; gate + gateSize <= endGate;
-           gate += gateSize, ++i)
+   // Setup data moment vector
+   std::vector<uint8_t>& dataMoments8 = sweep->dataMoments8_;
+   size_t                mIndex       = 0;
+
+   dataMoments8.resize(radials * numberOfDataMomentGates * VERTICES_PER_BIN);
+
+   if (useRadialGrid)
+   {
+      std::shared_ptr<const std::vector<float>> radialGrid = nullptr;
+
+      if (IsPolarGridEnabled())
       {
-         size_t vertexCount = (gate > 0) ? 6 : 3;
+         // Bin vertices are generated when rendered, from the azimuth of each
+         // radial in the standard layout
+         auto radarSite = radarProductManager->radar_site();
+         auto polarGrid = std::make_shared<RadarPolarGrid>();
+
+         const float radialAngle = 360.0f / static_cast<float>(radials);
+
+         polarGrid->latitude_       = radarSite->latitude();
+         polarGrid->longitude_      = radarSite->longitude();
+         polarGrid->gateSizeMeters_ = radarProductManager->gate_size();
+         polarGrid->startGate_      = startGate;
+         polarGrid->gateSize_       = gateSize;
+         polarGrid->bins_           = (endGate - startGate) / gateSize;
+
+         polarGrid->azimuths_.reserve(radials * 2);
+         for (std::size_t radial = 0; radial < radials; ++radial)
+         {
+            polarGrid->azimuths_.push_back(
+               static_cast<float>((startRadial + radial) % radials) *
+               radialAngle);
+            polarGrid->azimuths_.push_back(
+               static_cast<float>((startRadial + radial + 1) % radials) *
+               radialAngle);
+         }
 
-         if (!smoothingEnabled)
+         sweep->polarGrid_ = std::move(polarGrid);
+      }
+      else
+      {
+         const Level3RadialGridKey gridKey {
+            radarProductManager->radar_site()->id(),
+            p->latitude_,
+            p->longitude_,
+            static_cast<std::uint16_t>(radials),
+            startRadial,
+            gateSize,
+            endGate};
+
+         radialGrid = sweepCache.GetRadialGrid(gridKey);
+
+         if (radialGrid == nullptr)
          {
-            // Store data moment value
-            const uint8_t dataValue =
-               (i < dataMomentsArray8.size()) ? dataMomentsArray8[i] : 0;
-            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-            {
-               continue;
-            }
+            auto newRadialGrid = std::make_shared<std::vector<float>>();
+            newRadialGrid->resize(radials * numberOfDataMomentGates *
+                                  VERTICES_PER_BIN * VALUES_PER_VERTEX);
 
-            for (size_t m = 0; m < vertexCount; m++)
+            std::size_t vIndex = 0;
+
+            for (std::uint16_t radial = 0; radial < radials; ++radial)
             {
-               dataMoments8[mIndex++] = dataValue;
+               for (std::uint16_t gate = startGate; gate + gateSize <= endGate;
+                    gate += gateSize)
+               {
+                  p->StoreBinVertices(*newRadialGrid,
+                                      vIndex,
+                                      coordinates,
+                                      radials,
+                                      startRadial,
+                                      radial,
+                                      gate,
+                                      gateSize);
+               }
             }
+
+            newRadialGrid->resize(vIndex);
+            newRadialGrid->shrink_to_fit();
+
+            radialGrid =
+               sweepCache.InsertRadialGrid(gridKey, std::move(newRadialGrid));
          }
-         else if (gate > 0)
+      }
+
+      for (std::uint16_t radial = 0; radial < radials; ++radial)
+      {
+         const auto& dataMomentsArray8 = radialData->level(radial);
+
+         for (std::uint16_t gate = startGate, i = 0;
+              gate + gateSize <= endGate;
+              gate += gateSize, ++i)
          {
-            // Validate indices are all in range
-            if (i + 1 >= numberOfDataMomentGates)
+            const std::size_t vertexCount = (gate > 0) ? 6 : 3;
+
+            std::uint8_t dataValue =
+               (i < dataMomentsArray8.size()) ? dataMomentsArray8[i] : 0;
+            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
             {
-               continue;
+               dataValue = 0;
             }
 
-            const std::uint8_t& dm1 = dataMomentsArray8[i];
-            const std::uint8_t& dm2 = dataMomentsArray8[i + 1];
-            const std::uint8_t& dm3 = nextDataMomentsArray8[i];
-            const std::uint8_t& dm4 = nextDataMomentsArray8[i + 1];
-
-            if ((!showSmoothedRangeFolding && //
-                 (dm1 < snrThreshold || dm1 == RANGE_FOLDED) &&
-                 (dm2 < snrThreshold || dm2 == RANGE_FOLDED) &&
-                 (dm3 < snrThreshold || dm3 == RANGE_FOLDED) &&
-                 (dm4 < snrThreshold || dm4 == RANGE_FOLDED)) ||
-                (showSmoothedRangeFolding && //
-                 dm1 < snrThreshold && dm1 != RANGE_FOLDED &&
-                 dm2 < snrThreshold && dm2 != RANGE_FOLDED &&
-                 dm3 < snrThreshold && dm3 != RANGE_FOLDED &&
-                 dm4 < snrThreshold && dm4 != RANGE_FOLDED))
+            for (std::size_t m = 0; m < vertexCount; m++)
             {
-               // Skip only if all data moments are hidden
-               continue;
+               dataMoments8[mIndex++] = dataValue;
             }
-
-            // The order must match the store vertices section below
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm2);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm3);
-            dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
-         }
-         else
-         {
-            // If smoothing is enabled, gate should never start at zero
-            // (radar site origin)
-            logger_->error("Smoothing enabled, gate should not start at zero");
-            continue;
          }
+      }
 
-         // Store vertices
-         if (gate > 0)
-         {
-            const uint16_t baseCoord = gate - 1;
-
-            size_t offset1 = ((startRadial + radial) % radials *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-            size_t offset2 = offset1 + gateSize * 2;
-            size_t offset3 = (((startRadial + radial + 1) % radials) *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-            size_t offset4 = offset3 + gateSize * 2;
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
+      sweep->vertices_        = std::move(radialGrid);
+      sweep->hideZeroMoments_ = true;
+   }
+   else
+   {
+      // Setup vertex vector
+      auto sweepVertices = std::make_shared<std::vector<float>>();
 
-            vertices[vIndex++] = coordinates[offset4];
-            vertices[vIndex++] = coordinates[offset4 + 1];
+      std::vector<float>& vertices = *sweepVertices;
+      size_t              vIndex   = 0;
+      vertices.resize(radials * numberOfDataMomentGates * VERTICES_PER_BIN *
+                      VALUES_PER_VERTEX);
 
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
+      for (std::uint16_t radial = 0; radial < radialData->number_of_radials();
+           ++radial)
+      {
+         const auto& dataMomentsArray8 = radialData->level(radial);
 
-            vertices[vIndex++] = coordinates[offset3];
-            vertices[vIndex++] = coordinates[offset3 + 1];
+         const std::uint16_t nextRadial =
+            (radial == radialData->number_of_radials() - 1) ? 0 : radial + 1;
+         const auto& nextDataMomentsArray8 = radialData->level(nextRadial);
 
-            vertices[vIndex++] = coordinates[offset4];
-            vertices[vIndex++] = coordinates[offset4 + 1];
-         }
-         else
+         for (std::uint16_t gate = startGate, i = 0; gate + gateSize <= endGate;
+              gate += gateSize, ++i)
          {
-            const uint16_t baseCoord = gate;
-
-            size_t offset1 = ((startRadial + radial) % radials *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
-            size_t offset2 = (((startRadial + radial + 1) % radials) *
-                                 common::MAX_DATA_MOMENT_GATES +
-                              baseCoord) *
-                             2;
+            size_t vertexCount = (gate > 0) ? 6 : 3;
 
-            vertices[vIndex++] = p->latitude_;
-            vertices[vIndex++] = p->longitude_;
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
+            if (!smoothingEnabled)
+            {
+               // Store data moment value
+               const uint8_t dataValue =
+                  (i < dataMomentsArray8.size()) ? dataMomentsArray8[i] : 0;
+               if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+               {
+                  continue;
+               }
+
+               for (size_t m = 0; m < vertexCount; m++)
+               {
+                  dataMoments8[mIndex++] = dataValue;
+               }
+            }
+            else if (gate > 0)
+            {
+               // Validate indices are all in range
+               if (i + 1 >= numberOfDataMomentGates)
+               {
+                  continue;
+               }
+
+               const std::uint8_t& dm1 = dataMomentsArray8[i];
+               const std::uint8_t& dm2 = dataMomentsArray8[i + 1];
+               const std::uint8_t& dm3 = nextDataMomentsArray8[i];
+               const std::uint8_t& dm4 = nextDataMomentsArray8[i + 1];
+
+               if ((!showSmoothedRangeFolding && //
+                    (dm1 < snrThreshold || dm1 == RANGE_FOLDED) &&
+                    (dm2 < snrThreshold || dm2 == RANGE_FOLDED) &&
+                    (dm3 < snrThreshold || dm3 == RANGE_FOLDED) &&
+                    (dm4 < snrThreshold || dm4 == RANGE_FOLDED)) ||
+                   (showSmoothedRangeFolding && //
+                    dm1 < snrThreshold && dm1 != RANGE_FOLDED &&
+                    dm2 < snrThreshold && dm2 != RANGE_FOLDED &&
+                    dm3 < snrThreshold && dm3 != RANGE_FOLDED &&
+                    dm4 < snrThreshold && dm4 != RANGE_FOLDED))
+               {
+                  // Skip only if all data moments are hidden
+                  continue;
+               }
+
+               // The order must match the store vertices section below
+               dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
+               dataMoments8[mIndex++] = p->RemapDataMoment(dm2);
+               dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
+               dataMoments8[mIndex++] = p->RemapDataMoment(dm1);
+               dataMoments8[mIndex++] = p->RemapDataMoment(dm3);
+               dataMoments8[mIndex++] = p->RemapDataMoment(dm4);
+            }
+            else
+            {
+               // If smoothing is enabled, gate should never start at zero
+               // (radar site origin)
+               logger_->error(
+                  "Smoothing enabled, gate should not start at zero");
+               continue;
+            }
 
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
+            // Store vertices
+            p->StoreBinVertices(vertices,
+                                vIndex,
+                                coordinates,
+                                radials,
+                                startRadial,
+                                radial,
+                                gate,
+                                gateSize);
          }
       }
+      vertices.resize(vIndex);
+      vertices.shrink_to_fit();
+
+      sweep->vertices_ = std::move(sweepVertices);
    }
-   vertices.resize(vIndex);
-   vertices.shrink_to_fit();
 
    dataMoments8.resize(mIndex);
    dataMoments8.shrink_to_fit();
@@ -505,6 +656,8 @@ void Level3RadialView::ComputeSweep()
    timer.stop();
    logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
 
+   p->sweep_ = sweepCache.Insert(sweepKey, std::move(sweep));
+
    UpdateColorTableLut();
 
    Q_EMIT SweepComputed();
@@ -524,6 +677,73 @@ Level3RadialView::Impl::RemapDataMoment(std::uint8_t dataMoment) const
    }
 }
 
+void Level3RadialView::Impl::StoreBinVertices(
+   std::vector<float>&    vertices,
+   std::size_t&           vIndex,
+   std::span<const float> coordinates,
+   std::size_t            radials,
+   std::uint16_t          startRadial,
+   std::uint16_t          radial,
+   std::uint16_t          gate,
+   std::uint16_t          gateSize) const
+{
+   if (gate > 0)
+   {
+      const uint16_t baseCoord = gate - 1;
+
+      size_t offset1 = ((startRadial + radial) % radials *
+                           common::MAX_DATA_MOMENT_GATES +
+                        baseCoord) *
+                       2;
+      size_t offset2 = offset1 + gateSize * 2;
+      size_t offset3 = (((startRadial + radial + 1) % radials) *
+                           common::MAX_DATA_MOMENT_GATES +
+                        baseCoord) *
+                       2;
+      size_t offset4 = offset3 + gateSize * 2;
+
+      vertices[vIndex++] = coordinates[offset1];
+      vertices[vIndex++] = coordinates[offset1 + 1];
+
+      vertices[vIndex++] = coordinates[offset2];
+      vertices[vIndex++] = coordinates[offset2 + 1];
+
+      vertices[vIndex++] = coordinates[offset4];
+      vertices[vIndex++] = coordinates[offset4 + 1];
+
+      vertices[vIndex++] = coordinates[offset1];
+      vertices[vIndex++] = coordinates[offset1 + 1];
+
+      vertices[vIndex++] = coordinates[offset3];
+      vertices[vIndex++] = coordinates[offset3 + 1];
+
+      vertices[vIndex++] = coordinates[offset4];
+      vertices[vIndex++] = coordinates[offset4 + 1];
+   }
+   else
+   {
+      const uint16_t baseCoord = gate;
+
+      size_t offset1 = ((startRadial + radial) % radials *
+                           common::MAX_DATA_MOMENT_GATES +
+                        baseCoord) *
+                       2;
+      size_t offset2 = (((startRadial + radial + 1) % radials) *
+                           common::MAX_DATA_MOMENT_GATES +
+                        baseCoord) *
+                       2;
+
+      vertices[vIndex++] = latitude_;
+      vertices[vIndex++] = longitude_;
+
+      vertices[vIndex++] = coordinates[offset1];
+      vertices[vIndex++] = coordinates[offset1 + 1];
+
+      vertices[vIndex++] = coordinates[offset2];
+      vertices[vIndex++] = coordinates[offset2 + 1];
+   }
+}
+
 void Level3RadialView::Impl::ComputeCoordinates(
    const std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket>& radialData,
    bool smoothingEnabled)
@@ -668,39 +888,9 @@ Level3RadialView::GetBinLevel(const common::Coordinate& coordinate) const
    }
 
    // Find Radial
-   const std::uint16_t numRadials = radialData->number_of_radials();
-   auto                radials = boost::irange<std::uint32_t>(0u, numRadials);
-
-   auto radial = std::find_if( //
-      std::execution::par_unseq,
-      radials.begin(),
-      radials.end(),
-      [&](std::uint32_t i)
-      {
-         bool   found      = false;
-         double startAngle = radialData->start_angle(i);
-         double nextAngle  = radialData->start_angle((i + 1) % numRadials);
-
-         if (startAngle < nextAngle)
-         {
-            if (startAngle <= azi1 && azi1 < nextAngle)
-            {
-               found = true;
-            }
-         }
-         else
-         {
-            // If the bin crosses 0/360 degrees, special handling is needed
-            if (startAngle <= azi1 || azi1 < nextAngle)
-            {
-               found = true;
-            }
-         }
-
-         return found;
-      });
+   const std::optional<std::uint16_t> radial = p->FindRadial(radialData, azi1);
 
-   if (radial == radials.end())
+   if (!radial.has_value())
    {
       // No radial was found (not likely to happen without a gap in data)
       return std::nullopt;
@@ -718,6 +908,35 @@ Level3RadialView::GetBinLevel(const common::Coordinate& coordinate) const
    return level;
 }
 
+std::optional<std::uint16_t> Level3RadialView::Impl::FindRadial(
+   const std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket>& radialData,
+   double                                                       azimuth)
+{
+   std::unique_lock lock {azimuthIndexMutex_};
+
+   if (radialData != azimuthIndexData_)
+   {
+      const std::uint16_t numRadials = radialData->number_of_radials();
+
+      // Each radial extends to the start of the next radial
+      std::vector<util::AzimuthIndex::Radial> radials {};
+      radials.reserve(numRadials);
+      for (std::uint16_t i = 0; i < numRadials; ++i)
+      {
+         radials.push_back(
+            {i,
+             radialData->start_angle(i),
+             radialData->start_angle(
+                static_cast<std::uint16_t>((i + 1) % numRadials))});
+      }
+
+      azimuthIndex_.Build(radials);
+      azimuthIndexData_ = radialData;
+   }
+
+   return azimuthIndex_.Find(azimuth);
+}
+
 std::shared_ptr<Level3RadialView> Level3RadialView::Create(
    const std::string&                            product,
    std::shared_ptr<manager::RadarProductManager> radarProductManager)
@@ -28,6 +28,10 @@ public:
    std::uint16_t                         vcp() const override;
    const std::vector<float>&             vertices() const override;
 
+   std::shared_ptr<const std::vector<float>> shared_vertices() const override;
+   bool                                      hide_zero_moments() const override;
+   std::shared_ptr<const RadarPolarGrid>     polar_grid() const override;
+
    std::tuple<const void*, std::size_t, std::size_t>
    GetMomentData() const override;
 
@@ -39,7 +43,7 @@ public:
           std::shared_ptr<manager::RadarProductManager> radarProductManager);
 
 protected:
-   boost::asio::thread_pool& thread_pool() override;
+   scwx::util::Strand& strand() override;
 
 protected slots:
    void ComputeSweep() override;
@@ -1,4 +1,6 @@
 #include <scwx/qt/view/level3_raster_view.hpp>
+#include <scwx/qt/view/level3_sweep_cache.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
@@ -31,16 +33,16 @@ public:
        latitude_ {}, longitude_ {}, range_ {}, vcp_ {}, sweepTime_ {}
    {
    }
-   ~Level3RasterViewImpl() { threadPool_.join(); };
+   ~Level3RasterViewImpl() { strand_.Join(); };
 
    [[nodiscard]] inline std::uint8_t
    RemapDataMoment(std::uint8_t dataMoment) const;
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::Strand strand_ {"Level 3 Raster View"};
 
-   std::vector<float>        vertices_ {};
-   std::vector<std::uint8_t> dataMoments8_ {};
-   std::uint8_t              edgeValue_ {};
+   std::shared_ptr<const Level3Sweep>        sweep_ {};
+   std::shared_ptr<const std::vector<float>> rasterGrid_ {};
+   std::uint8_t                              edgeValue_ {};
 
    bool showSmoothedRangeFolding_ {false};
 
@@ -69,9 +71,9 @@ Level3RasterView::~Level3RasterView()
    std::unique_lock sweepLock {sweep_mutex()};
 }
 
-boost::asio::thread_pool& Level3RasterView::thread_pool()
+scwx::util::Strand& Level3RasterView::strand()
 {
-   return p->threadPool_;
+   return p->strand_;
 }
 
 float Level3RasterView::range() const
@@ -91,7 +93,15 @@ uint16_t Level3RasterView::vcp() const
 
 const std::vector<float>& Level3RasterView::vertices() const
 {
-   return p->vertices_;
+   static const std::vector<float> kEmptyVertices_ {};
+
+   return (p->sweep_ != nullptr) ? *p->sweep_->vertices_ : kEmptyVertices_;
+}
+
+std::shared_ptr<const std::vector<float>>
+Level3RasterView::shared_vertices() const
+{
+   return (p->sweep_ != nullptr) ? p->sweep_->vertices_ : nullptr;
 }
 
 std::tuple<const void*, size_t, size_t> Level3RasterView::GetMomentData() const
@@ -100,8 +110,16 @@ std::tuple<const void*, size_t, size_t> Level3RasterView::GetMomentData() const
    size_t      dataSize;
    size_t      componentSize;
 
-   data          = p->dataMoments8_.data();
-   dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
+   if (p->sweep_ != nullptr)
+   {
+      data     = p->sweep_->dataMoments8_.data();
+      dataSize = p->sweep_->dataMoments8_.size() * sizeof(uint8_t);
+   }
+   else
+   {
+      data     = nullptr;
+      dataSize = 0;
+   }
    componentSize = 1;
 
    return std::tie(data, dataSize, componentSize);
@@ -109,7 +127,7 @@ std::tuple<const void*, size_t, size_t> Level3RasterView::GetMomentData() const
 
 void Level3RasterView::ComputeSweep()
 {
-   logger_->trace("ComputeSweep()");
+   SPDLOG_LOGGER_TRACE(logger_, "ComputeSweep()");
 
    boost::timer::cpu_timer timer;
 
@@ -125,13 +143,13 @@ void Level3RasterView::ComputeSweep()
    std::shared_ptr<wsr88d::rpg::Level3Message> message;
    std::chrono::system_clock::time_point       requestedTime {selected_time()};
    std::chrono::system_clock::time_point       foundTime;
-   std::tie(message, foundTime) =
-      radarProductManager->GetLevel3Data(GetRadarProductName(), requestedTime);
+   std::tie(message, foundTime) = radarProductManager->GetLevel3Data(
+      GetRadarProductName(), requestedTime, load_group());
 
    // If a different time was found than what was requested, update it
    if (requestedTime != foundTime)
    {
-      SelectTime(foundTime);
+      SnapSelectedTime(foundTime);
    }
 
    if (message == nullptr)
@@ -141,6 +159,13 @@ void Level3RasterView::ComputeSweep()
       return;
    }
 
+   if (is_update_pending())
+   {
+      // The selection has changed since the computation started, and a queued
+      // computation supersedes this one
+      return;
+   }
+
    // A message with radial data should be a Graphic Product Message
    std::shared_ptr<wsr88d::rpg::GraphicProductMessage> gpm =
       std::dynamic_pointer_cast<wsr88d::rpg::GraphicProductMessage>(message);
@@ -245,6 +270,30 @@ void Level3RasterView::ComputeSweep()
                             descriptionBlock->volume_scan_start_time() * 1000);
    p->vcp_ = descriptionBlock->volume_coverage_pattern();
 
+   // Use the sweep computed by another view of the same product, if present
+   const Level3SweepKey sweepKey {radarProductManager->radar_site()->id(),
+                                  GetRadarProductName(),
+                                  foundTime,
+                                  smoothingEnabled,
+                                  showSmoothedRangeFolding};
+
+   auto& sweepCache = Level3SweepCache::Instance();
+
+   std::shared_ptr<const Level3Sweep> cachedSweep =
+      sweepCache.Get(sweepKey, gpm);
+   if (cachedSweep != nullptr)
+   {
+      p->sweep_ = cachedSweep;
+
+      UpdateColorTableLut();
+
+      Q_EMIT SweepComputed();
+      return;
+   }
+
+   auto sweep      = std::make_shared<Level3Sweep>();
+   sweep->message_ = gpm;
+
    const GeographicLib::Geodesic& geodesic =
       util::GeographicLib::DefaultGeodesic();
 
@@ -257,60 +306,126 @@ void Level3RasterView::ComputeSweep()
    const double xOffset = (smoothingEnabled) ? xResolution * 0.5 : 0.0;
    const double yOffset = (smoothingEnabled) ? yResolution * 0.5 : 0.0;
 
-   const std::size_t numCoordinates =
-      static_cast<size_t>(rows + 1) * static_cast<size_t>(maxColumns + 1);
-   const auto coordinateRange =
-      boost::irange<uint32_t>(0, static_cast<uint32_t>(numCoordinates));
+   const bool exactGeometry =
+      settings::GeneralSettings::Instance().exact_radar_geometry().GetValue();
+
+   // The grid geometry depends only on the radar location and the raster
+   // dimensions, and is shared between products and frames
+   const Level3RasterGridKey gridKey {
+      radarProductManager->radar_site()->id(),
+      p->latitude_,
+      p->longitude_,
+      p->range_,
+      rasterData->i_coordinate_start(),
+      rasterData->j_coordinate_start(),
+      rows,
+      static_cast<std::uint16_t>(maxColumns),
+      xResolution,
+      yResolution,
+      smoothingEnabled,
+      exactGeometry};
+
+   std::shared_ptr<const std::vector<float>> rasterGrid =
+      sweepCache.GetRasterGrid(gridKey);
+
+   if (rasterGrid == nullptr)
+   {
+      const std::size_t numCoordinates =
+         static_cast<size_t>(rows + 1) * static_cast<size_t>(maxColumns + 1);
+      const auto coordinateRange =
+         boost::irange<uint32_t>(0, static_cast<uint32_t>(numCoordinates));
 
-   std::vector<float> coordinates;
-   coordinates.resize(numCoordinates * 2);
+      auto newRasterGrid = std::make_shared<std::vector<float>>();
+      newRasterGrid->resize(numCoordinates * 2);
 
-   // Calculate coordinates
-   timer.start();
+      std::vector<float>& coordinates = *newRasterGrid;
 
-   std::for_each(
-      std::execution::par_unseq,
-      coordinateRange.begin(),
-      coordinateRange.end(),
-      [&](uint32_t index)
+      // The corners of the grid are the farthest points from the radar site
+      double maxRange = 0.0;
+      for (double i : {iCoordinate + xOffset,
+                       iCoordinate + xResolution * rows + xOffset})
       {
-         // For each row or column, there is one additional coordinate. Each bin
-         // is bounded by 4 coordinates.
-         const uint32_t col = index % (rows + 1);
-         const uint32_t row = index / (rows + 1);
+         for (double j : {jCoordinate - yOffset,
+                          jCoordinate - yResolution * maxColumns - yOffset})
+         {
+            maxRange = std::max(maxRange, std::hypot(i, j));
+         }
+      }
 
-         const double i = iCoordinate + xResolution * col + xOffset;
-         const double j = jCoordinate - yResolution * row - yOffset;
+      const bool approximate =
+         !exactGeometry && util::GeographicLib::RadialGeodesic::IsAccurate(
+                              p->latitude_, p->longitude_, maxRange);
 
-         // Calculate polar coordinates based on i and j
-         const double angle  = std::atan2(i, j) * 180.0 / M_PI;
-         const double range  = std::sqrt(i * i + j * j);
-         const size_t offset = static_cast<size_t>(index) * 2;
+      // Calculate coordinates
+      timer.start();
 
-         double latitude;
-         double longitude;
+      std::for_each(
+         std::execution::par_unseq,
+         coordinateRange.begin(),
+         coordinateRange.end(),
+         [&](uint32_t index)
+         {
+            // For each row or column, there is one additional coordinate.
+            // Each bin is bounded by 4 coordinates.
+            const uint32_t col = index % (rows + 1);
+            const uint32_t row = index / (rows + 1);
 
-         geodesic.Direct(
-            p->latitude_, p->longitude_, angle, range, latitude, longitude);
+            const double i = iCoordinate + xResolution * col + xOffset;
+            const double j = jCoordinate - yResolution * row - yOffset;
 
-         coordinates[offset]     = latitude;
-         coordinates[offset + 1] = longitude;
-      });
+            // Calculate polar coordinates based on i and j
+            const double angle  = std::atan2(i, j) * 180.0 / M_PI;
+            const double range  = std::sqrt(i * i + j * j);
+            const size_t offset = static_cast<size_t>(index) * 2;
 
-   timer.stop();
-   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+            double latitude;
+            double longitude;
+
+            if (approximate)
+            {
+               util::GeographicLib::RadialGeodesic(
+                  p->latitude_, p->longitude_, angle)
+                  .Position(range, latitude, longitude);
+            }
+            else
+            {
+               geodesic.Direct(p->latitude_,
+                               p->longitude_,
+                               angle,
+                               range,
+                               latitude,
+                               longitude);
+            }
+
+            coordinates[offset]     = latitude;
+            coordinates[offset + 1] = longitude;
+         });
+
+      timer.stop();
+      logger_->debug("Coordinates ({}) calculated in {}",
+                     approximate ? "approximate" : "exact",
+                     timer.format(6, "%ws"));
+
+      rasterGrid =
+         sweepCache.InsertRasterGrid(gridKey, std::move(newRasterGrid));
+   }
+
+   p->rasterGrid_ = rasterGrid;
+
+   const std::vector<float>& coordinates = *rasterGrid;
 
    // Calculate vertices
    timer.start();
 
    // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
+   auto                sweepVertices = std::make_shared<std::vector<float>>();
+   std::vector<float>& vertices      = *sweepVertices;
+   size_t              vIndex        = 0;
    vertices.clear();
    vertices.resize(rows * maxColumns * VERTICES_PER_BIN * VALUES_PER_VERTEX);
 
    // Setup data moment vector
-   std::vector<uint8_t>& dataMoments8 = p->dataMoments8_;
+   std::vector<uint8_t>& dataMoments8 = sweep->dataMoments8_;
    size_t                mIndex       = 0;
 
    dataMoments8.resize(rows * maxColumns * VERTICES_PER_BIN);
@@ -431,6 +546,9 @@ void Level3RasterView::ComputeSweep()
    timer.stop();
    logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
 
+   sweep->vertices_ = std::move(sweepVertices);
+   p->sweep_        = sweepCache.Insert(sweepKey, std::move(sweep));
+
    UpdateColorTableLut();
 
    Q_EMIT SweepComputed();
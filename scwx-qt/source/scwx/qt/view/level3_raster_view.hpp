@@ -30,6 +30,8 @@ public:
    std::uint16_t                         vcp() const override;
    const std::vector<float>&             vertices() const override;
 
+   std::shared_ptr<const std::vector<float>> shared_vertices() const override;
+
    std::tuple<const void*, std::size_t, std::size_t>
    GetMomentData() const override;
 
@@ -41,7 +43,7 @@ public:
           std::shared_ptr<manager::RadarProductManager> radarProductManager);
 
 protected:
-   boost::asio::thread_pool& thread_pool() override;
+   scwx::util::Strand& strand() override;
 
 protected slots:
    void ComputeSweep() override;
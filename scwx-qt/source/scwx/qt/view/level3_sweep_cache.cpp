@@ -0,0 +1,195 @@
+#include <scwx/qt/view/level3_sweep_cache.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <map>
+#include <mutex>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string logPrefix_ = "scwx::qt::view::level3_sweep_cache";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+class Level3SweepCache::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() {}
+
+   template<class Key>
+   using GeometryMap =
+      std::map<Key, std::weak_ptr<const Level3SweepCache::Geometry>>;
+
+   template<class Map>
+   static void PurgeExpired(Map& map);
+
+   template<class Key>
+   static std::shared_ptr<const Geometry>
+   GetGeometry(GeometryMap<Key>& map, std::mutex& mutex, const Key& key);
+
+   template<class Key>
+   static std::shared_ptr<const Geometry>
+   InsertGeometry(GeometryMap<Key>&               map,
+                  std::mutex&                     mutex,
+                  const Key&                      key,
+                  std::shared_ptr<const Geometry> geometry);
+
+   std::map<Level3SweepKey, std::weak_ptr<const Level3Sweep>> sweeps_ {};
+   mutable std::mutex                                          sweepsMutex_ {};
+
+   GeometryMap<Level3RadialGridKey> radialGrids_ {};
+   GeometryMap<Level3RasterGridKey> rasterGrids_ {};
+   mutable std::mutex               geometryMutex_ {};
+};
+
+template<class Map>
+void Level3SweepCache::Impl::PurgeExpired(Map& map)
+{
+   std::erase_if(map, [](const auto& entry) { return entry.second.expired(); });
+}
+
+template<class Key>
+std::shared_ptr<const Level3SweepCache::Geometry>
+Level3SweepCache::Impl::GetGeometry(GeometryMap<Key>& map,
+                                    std::mutex&       mutex,
+                                    const Key&        key)
+{
+   std::unique_lock lock {mutex};
+
+   auto it = map.find(key);
+   if (it == map.end())
+   {
+      return nullptr;
+   }
+
+   return it->second.lock();
+}
+
+template<class Key>
+std::shared_ptr<const Level3SweepCache::Geometry>
+Level3SweepCache::Impl::InsertGeometry(GeometryMap<Key>&               map,
+                                       std::mutex&                     mutex,
+                                       const Key&                      key,
+                                       std::shared_ptr<const Geometry> geometry)
+{
+   std::unique_lock lock {mutex};
+
+   PurgeExpired(map);
+
+   auto& entry = map[key];
+
+   std::shared_ptr<const Geometry> existingGeometry = entry.lock();
+   if (existingGeometry != nullptr)
+   {
+      // Another view computed the same geometry first
+      return existingGeometry;
+   }
+
+   entry = geometry;
+
+   return geometry;
+}
+
+Level3SweepCache::Level3SweepCache() : p(std::make_unique<Impl>()) {}
+Level3SweepCache::~Level3SweepCache() = default;
+
+std::size_t Level3SweepCache::size() const
+{
+   std::unique_lock lock {p->sweepsMutex_};
+   return p->sweeps_.size();
+}
+
+std::size_t Level3SweepCache::geometry_count() const
+{
+   std::unique_lock lock {p->geometryMutex_};
+   return p->radialGrids_.size() + p->rasterGrids_.size();
+}
+
+std::shared_ptr<const Level3Sweep> Level3SweepCache::Get(
+   const Level3SweepKey&                                       key,
+   const std::shared_ptr<wsr88d::rpg::GraphicProductMessage>& message)
+{
+   std::unique_lock lock {p->sweepsMutex_};
+
+   auto it = p->sweeps_.find(key);
+   if (it == p->sweeps_.end())
+   {
+      return nullptr;
+   }
+
+   std::shared_ptr<const Level3Sweep> sweep = it->second.lock();
+   if (sweep == nullptr || sweep->message_ != message)
+   {
+      // The sweep has expired, or was computed from data since reloaded
+      return nullptr;
+   }
+
+   SPDLOG_LOGGER_TRACE(logger_, "Using cached sweep: {}", key.product_);
+
+   return sweep;
+}
+
+std::shared_ptr<const Level3Sweep>
+Level3SweepCache::Insert(const Level3SweepKey&              key,
+                         std::shared_ptr<const Level3Sweep> sweep)
+{
+   std::unique_lock lock {p->sweepsMutex_};
+
+   Impl::PurgeExpired(p->sweeps_);
+
+   auto& entry = p->sweeps_[key];
+
+   std::shared_ptr<const Level3Sweep> existingSweep = entry.lock();
+   if (existingSweep != nullptr && sweep != nullptr &&
+       existingSweep->message_ == sweep->message_)
+   {
+      // Another view computed the same sweep first
+      return existingSweep;
+   }
+
+   entry = sweep;
+
+   return sweep;
+}
+
+std::shared_ptr<const Level3SweepCache::Geometry>
+Level3SweepCache::GetRadialGrid(const Level3RadialGridKey& key)
+{
+   return Impl::GetGeometry(p->radialGrids_, p->geometryMutex_, key);
+}
+
+std::shared_ptr<const Level3SweepCache::Geometry>
+Level3SweepCache::InsertRadialGrid(const Level3RadialGridKey&      key,
+                                   std::shared_ptr<const Geometry> grid)
+{
+   return Impl::InsertGeometry(
+      p->radialGrids_, p->geometryMutex_, key, std::move(grid));
+}
+
+std::shared_ptr<const Level3SweepCache::Geometry>
+Level3SweepCache::GetRasterGrid(const Level3RasterGridKey& key)
+{
+   return Impl::GetGeometry(p->rasterGrids_, p->geometryMutex_, key);
+}
+
+std::shared_ptr<const Level3SweepCache::Geometry>
+Level3SweepCache::InsertRasterGrid(const Level3RasterGridKey&      key,
+                                   std::shared_ptr<const Geometry> grid)
+{
+   return Impl::InsertGeometry(
+      p->rasterGrids_, p->geometryMutex_, key, std::move(grid));
+}
+
+Level3SweepCache& Level3SweepCache::Instance()
+{
+   static Level3SweepCache level3SweepCache_ {};
+   return level3SweepCache_;
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
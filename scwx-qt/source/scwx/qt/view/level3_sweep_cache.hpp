@@ -0,0 +1,163 @@
+#pragma once
+
+#include <scwx/qt/view/radar_product_view.hpp>
+#include <scwx/wsr88d/rpg/graphic_product_message.hpp>
+
+#include <chrono>
+#include <compare>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+struct Level3SweepKey
+{
+   std::string                           radarId_ {};
+   std::string                           product_ {};
+   std::chrono::system_clock::time_point time_ {};
+   bool                                  smoothingEnabled_ {false};
+   bool                                  showSmoothedRangeFolding_ {false};
+
+   auto operator<=>(const Level3SweepKey&) const = default;
+};
+
+struct Level3RadialGridKey
+{
+   std::string   radarId_ {};
+   float         latitude_ {};
+   float         longitude_ {};
+   std::uint16_t radials_ {};
+   std::uint16_t startRadial_ {};
+   std::uint16_t gateSize_ {};
+   std::uint16_t endGate_ {};
+
+   auto operator<=>(const Level3RadialGridKey&) const = default;
+};
+
+struct Level3RasterGridKey
+{
+   std::string   radarId_ {};
+   float         latitude_ {};
+   float         longitude_ {};
+   float         range_ {};
+   std::int16_t  iCoordinateStart_ {};
+   std::int16_t  jCoordinateStart_ {};
+   std::uint16_t rows_ {};
+   std::uint16_t columns_ {};
+   std::uint16_t xResolution_ {};
+   std::uint16_t yResolution_ {};
+   bool          smoothingEnabled_ {false};
+   bool          exactGeometry_ {false};
+
+   auto operator<=>(const Level3RasterGridKey&) const = default;
+};
+
+/**
+ * @brief Geometry and data moments computed from a Level 3 graphic product
+ * message, ready to be buffered for rendering.
+ */
+struct Level3Sweep
+{
+   std::shared_ptr<wsr88d::rpg::GraphicProductMessage> message_ {};
+   std::shared_ptr<const std::vector<float>>           vertices_ {};
+   std::shared_ptr<const RadarPolarGrid>               polarGrid_ {};
+   std::vector<std::uint8_t>                           dataMoments8_ {};
+   bool                                                hideZeroMoments_ {false};
+};
+
+/**
+ * @brief Shares computed Level 3 sweeps and raster grid geometry between
+ * product views. Entries are held weakly, and expire once no view references
+ * them.
+ */
+class Level3SweepCache
+{
+public:
+   /**
+    * @brief Latitude/longitude pairs. Radial grids hold the vertices of every
+    * bin. Raster grids hold the corners of every bin, in row-major order.
+    */
+   typedef std::vector<float> Geometry;
+
+   explicit Level3SweepCache();
+   ~Level3SweepCache();
+
+   Level3SweepCache(const Level3SweepCache&)            = delete;
+   Level3SweepCache& operator=(const Level3SweepCache&) = delete;
+
+   Level3SweepCache(Level3SweepCache&&)            = delete;
+   Level3SweepCache& operator=(Level3SweepCache&&) = delete;
+
+   std::size_t size() const;
+   std::size_t geometry_count() const;
+
+   /**
+    * @brief Gets a cached sweep.
+    *
+    * @param key Sweep key
+    * @param message Message the sweep must have been computed from
+    *
+    * @return Cached sweep, or nullptr if no current sweep is cached
+    */
+   std::shared_ptr<const Level3Sweep>
+   Get(const Level3SweepKey&                                       key,
+       const std::shared_ptr<wsr88d::rpg::GraphicProductMessage>& message);
+
+   /**
+    * @brief Caches a sweep. If another view cached a sweep for the same key
+    * and message first, that sweep is returned instead.
+    *
+    * @param key Sweep key
+    * @param sweep Computed sweep
+    *
+    * @return Sweep to use
+    */
+   std::shared_ptr<const Level3Sweep>
+   Insert(const Level3SweepKey&              key,
+          std::shared_ptr<const Level3Sweep> sweep);
+
+   /**
+    * @brief Gets cached grid geometry.
+    *
+    * @param key Grid key
+    *
+    * @return Cached grid, or nullptr if none is cached
+    */
+   std::shared_ptr<const Geometry>
+   GetRadialGrid(const Level3RadialGridKey& key);
+   std::shared_ptr<const Geometry>
+   GetRasterGrid(const Level3RasterGridKey& key);
+
+   /**
+    * @brief Caches grid geometry. If another view cached a grid for the same
+    * key first, that grid is returned instead.
+    *
+    * @param key Grid key
+    * @param grid Computed grid
+    *
+    * @return Grid to use
+    */
+   std::shared_ptr<const Geometry>
+   InsertRadialGrid(const Level3RadialGridKey&      key,
+                    std::shared_ptr<const Geometry> grid);
+   std::shared_ptr<const Geometry>
+   InsertRasterGrid(const Level3RasterGridKey&      key,
+                    std::shared_ptr<const Geometry> grid);
+
+   static Level3SweepCache& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
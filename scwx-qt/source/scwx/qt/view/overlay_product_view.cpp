@@ -1,12 +1,14 @@
 #include <scwx/qt/view/overlay_product_view.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/strand.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
 #include <mutex>
 
-#include <boost/asio.hpp>
 #include <boost/uuid/random_generator.hpp>
+#include <QTimer>
 
 namespace scwx
 {
@@ -20,25 +22,46 @@ static const auto        logger_    = util::Logger::Create(logPrefix_);
 
 static const std::string kNst_ = "NST";
 
+// Level 3 products displayed as overlays
+static const std::vector<std::string> kOverlayProducts_ {kNst_};
+
+// Overlay products of a volume scan arrive separately. Products loaded for the
+// same volume scan are applied together once each has arrived, or once the
+// batch window has elapsed.
+static constexpr std::chrono::seconds kBatchWindow_ {15};
+
 class OverlayProductView::Impl
 {
 public:
-   explicit Impl(OverlayProductView* self) : self_ {self} {}
-   ~Impl() { threadPool_.join(); }
+   explicit Impl(OverlayProductView* self) : self_ {self}
+   {
+      batchTimer_.setSingleShot(true);
+      batchTimer_.setInterval(kBatchWindow_);
+
+      QObject::connect(
+         &batchTimer_, &QTimer::timeout, self_, [this]() { CommitBatch(); });
+   }
+   ~Impl() { strand_.Join(); }
 
+   void CommitBatch();
    void ConnectRadarProductManager();
    void DisconnectRadarProductManager();
    void LoadProduct(const std::string&                    product,
                     std::chrono::system_clock::time_point time,
                     bool                                  autoUpdate);
    void ResetProducts();
-   void Update(const std::string& product);
+   void StageProduct(const std::string&                          product,
+                     std::chrono::system_clock::time_point       volumeTime,
+                     std::shared_ptr<wsr88d::rpg::Level3Message> message);
+   void Update();
    void UpdateAutoRefresh(bool enabled) const;
 
+   static bool IsOverlayProduct(const std::string& product);
+
    OverlayProductView* self_;
    boost::uuids::uuid  uuid_ {boost::uuids::random_generator()()};
 
-   boost::asio::thread_pool threadPool_ {1u};
+   scwx::util::Strand strand_ {"Overlay Product View"};
 
    bool autoRefreshEnabled_ {false};
    bool autoUpdateEnabled_ {false};
@@ -50,6 +73,13 @@ public:
    std::unordered_map<std::string, std::shared_ptr<wsr88d::rpg::Level3Message>>
               messageMap_ {};
    std::mutex messageMutex_ {};
+
+   // Products loaded for a volume scan, not yet applied. A null message
+   // removes the product.
+   std::chrono::system_clock::time_point batchVolumeTime_ {};
+   std::unordered_map<std::string, std::shared_ptr<wsr88d::rpg::Level3Message>>
+          batchMessageMap_ {};
+   QTimer batchTimer_ {};
 };
 
 OverlayProductView::OverlayProductView() : p(std::make_unique<Impl>(this)) {};
@@ -102,13 +132,13 @@ void OverlayProductView::Impl::ConnectRadarProductManager()
            {
               if (record->radar_product_group() ==
                      common::RadarProductGroup::Level3 &&
-                  record->radar_product() == kNst_ &&
+                  IsOverlayProduct(record->radar_product()) &&
                   std::chrono::floor<std::chrono::seconds>(record->time()) ==
                      selectedTime_)
               {
                  // If the data associated with the currently selected time is
                  // reloaded, update the view
-                 Update(record->radar_product());
+                 Update();
               }
            });
 
@@ -121,7 +151,8 @@ void OverlayProductView::Impl::ConnectRadarProductManager()
              std::chrono::system_clock::time_point latestTime)
       {
          if (autoRefreshEnabled_ &&
-             group == common::RadarProductGroup::Level3 && product == kNst_)
+             group == common::RadarProductGroup::Level3 &&
+             IsOverlayProduct(product))
          {
             LoadProduct(product, latestTime, autoUpdateEnabled_);
          }
@@ -168,10 +199,12 @@ void OverlayProductView::Impl::LoadProduct(
 
             std::shared_ptr<wsr88d::Level3File>         level3File = nullptr;
             std::shared_ptr<wsr88d::rpg::Level3Message> message    = nullptr;
+            std::chrono::system_clock::time_point       volumeTime {};
 
             if (record != nullptr)
             {
                level3File = record->level3_file();
+               volumeTime = record->time();
             }
             if (level3File != nullptr)
             {
@@ -185,80 +218,119 @@ void OverlayProductView::Impl::LoadProduct(
                auto        productTime = util::TimePoint(
                   header.date_of_message(), header.time_of_message() * 1000);
 
-               // If the record is from the last 30 minutes
-               if (productTime + 30min >= std::chrono::system_clock::now() ||
-                   (selectedTime_ != std::chrono::system_clock::time_point {} &&
-                    productTime + 30min >= selectedTime_))
+               // If product is more than 30 minutes old, discard
+               if (productTime + 30min < std::chrono::system_clock::now() &&
+                   (selectedTime_ == std::chrono::system_clock::time_point {} ||
+                    productTime + 30min < selectedTime_))
                {
-                  // Store loaded record
-                  std::unique_lock lock {messageMutex_};
-
-                  auto it = messageMap_.find(product);
-                  if (it == messageMap_.cend() || it->second != message)
-                  {
-                     messageMap_.insert_or_assign(product, message);
+                  SPDLOG_LOGGER_TRACE(logger_,
+                                      "Discarding stale data: {}",
+                                      util::TimeString(productTime));
 
-                     lock.unlock();
-
-                     Q_EMIT self_->ProductUpdated(product);
-                  }
-               }
-               else
-               {
-                  // If product is more than 30 minutes old, discard
-                  std::unique_lock lock {messageMutex_};
-                  std::size_t      elementsRemoved = messageMap_.erase(product);
-                  lock.unlock();
-
-                  if (elementsRemoved > 0)
-                  {
-                     Q_EMIT self_->ProductUpdated(product);
-                  }
-
-                  logger_->trace("Discarding stale data: {}",
-                                 util::TimeString(productTime));
+                  message = nullptr;
                }
             }
             else
             {
                // If the product doesn't exist, erase the stale product
-               std::unique_lock lock {messageMutex_};
-               std::size_t      elementsRemoved = messageMap_.erase(product);
-               lock.unlock();
-
-               if (elementsRemoved > 0)
-               {
-                  Q_EMIT self_->ProductUpdated(product);
-               }
-
-               logger_->trace("Removing stale product");
+               SPDLOG_LOGGER_TRACE(logger_, "Removing stale product");
             }
+
+            StageProduct(product, volumeTime, message);
          });
    }
 
    // Load file
-   boost::asio::post(threadPool_,
-                     [=, this]()
-                     {
-                        try
-                        {
-                           radarProductManager_->LoadLevel3Data(
-                              product, time, request);
-                        }
-                        catch (const std::exception& ex)
-                        {
-                           logger_->error(ex.what());
-                        }
-                     });
+   strand_.Post(
+      [=, this]()
+      { radarProductManager_->LoadLevel3Data(product, time, request); });
+}
+
+void OverlayProductView::Impl::StageProduct(
+   const std::string&                          product,
+   std::chrono::system_clock::time_point       volumeTime,
+   std::shared_ptr<wsr88d::rpg::Level3Message> message)
+{
+   if (!batchMessageMap_.empty() && volumeTime != batchVolumeTime_)
+   {
+      // Products of the previous volume scan are applied before those of the
+      // next volume scan are batched
+      CommitBatch();
+   }
+
+   batchVolumeTime_ = volumeTime;
+   batchMessageMap_.insert_or_assign(product, std::move(message));
+
+   if (batchMessageMap_.size() >= kOverlayProducts_.size())
+   {
+      // Each overlay product of the volume scan has arrived
+      CommitBatch();
+   }
+   else if (!batchTimer_.isActive())
+   {
+      batchTimer_.start();
+   }
+}
+
+void OverlayProductView::Impl::CommitBatch()
+{
+   batchTimer_.stop();
+
+   std::vector<std::string> updatedProducts {};
+
+   {
+      std::unique_lock lock {messageMutex_};
+
+      for (auto& [product, message] : batchMessageMap_)
+      {
+         auto it = messageMap_.find(product);
+
+         if (message == nullptr)
+         {
+            if (it != messageMap_.cend())
+            {
+               messageMap_.erase(it);
+               updatedProducts.push_back(product);
+            }
+         }
+         else if (it == messageMap_.cend() || it->second != message)
+         {
+            messageMap_.insert_or_assign(product, message);
+            updatedProducts.push_back(product);
+         }
+      }
+   }
+
+   batchMessageMap_.clear();
+
+   // Overlay layers defer rebuilding until rendered, so the products updated
+   // together are applied in a single layer update
+   for (auto& product : updatedProducts)
+   {
+      Q_EMIT self_->ProductUpdated(product);
+   }
 }
 
 void OverlayProductView::Impl::ResetProducts()
 {
+   batchTimer_.stop();
+   batchMessageMap_.clear();
+
    std::unique_lock lock {messageMutex_};
    messageMap_.clear();
    lock.unlock();
 
-   Q_EMIT self_->ProductUpdated(kNst_);
+   for (auto& product : kOverlayProducts_)
+   {
+      Q_EMIT self_->ProductUpdated(product);
+   }
+}
+
+bool OverlayProductView::Impl::IsOverlayProduct(const std::string& product)
+{
+   return std::find(kOverlayProducts_.cbegin(),
+                    kOverlayProducts_.cend(),
+                    product) != kOverlayProducts_.cend();
 }
 
 void OverlayProductView::SelectTime(std::chrono::system_clock::time_point time)
@@ -266,7 +338,7 @@ void OverlayProductView::SelectTime(std::chrono::system_clock::time_point time)
    if (time != p->selectedTime_)
    {
       p->selectedTime_ = time;
-      p->Update(kNst_);
+      p->Update();
    }
 }
 
@@ -279,37 +351,45 @@ void OverlayProductView::SetAutoRefresh(bool enabled)
    }
 }
 
-void OverlayProductView::Impl::Update(const std::string& product)
+void OverlayProductView::Impl::Update()
 {
-   // Retrieve message from Radar Product Manager
-   std::shared_ptr<wsr88d::rpg::Level3Message> message;
-   std::chrono::system_clock::time_point       requestedTime {selectedTime_};
-   std::chrono::system_clock::time_point       foundTime;
-   std::tie(message, foundTime) =
-      radarProductManager_->GetLevel3Data(product, requestedTime);
-
-   // If a different time was found than what was requested, update it
-   if (requestedTime != foundTime)
-   {
-      selectedTime_ = foundTime;
-   }
+   std::vector<std::string> updatedProducts {};
 
-   if (message == nullptr)
+   for (auto& product : kOverlayProducts_)
    {
-      logger_->debug("{} data not found", product);
-      return;
-   }
+      // Retrieve message from Radar Product Manager
+      std::shared_ptr<wsr88d::rpg::Level3Message> message;
+      std::chrono::system_clock::time_point       requestedTime {selectedTime_};
+      std::chrono::system_clock::time_point       foundTime;
+      std::tie(message, foundTime) =
+         radarProductManager_->GetLevel3Data(product, requestedTime);
+
+      // If a different time was found than what was requested, update it
+      if (requestedTime != foundTime)
+      {
+         selectedTime_ = foundTime;
+      }
 
-   std::unique_lock lock {messageMutex_};
+      if (message == nullptr)
+      {
+         logger_->debug("{} data not found", product);
+         continue;
+      }
 
-   // Update message in map
-   auto it = messageMap_.find(product);
-   if (it == messageMap_.cend() || it->second != message)
-   {
-      messageMap_.insert_or_assign(product, message);
+      std::unique_lock lock {messageMutex_};
 
-      lock.unlock();
+      // Update message in map
+      auto it = messageMap_.find(product);
+      if (it == messageMap_.cend() || it->second != message)
+      {
+         messageMap_.insert_or_assign(product, message);
+         updatedProducts.push_back(product);
+      }
+   }
 
+   // Products of the selected time are applied together
+   for (auto& product : updatedProducts)
+   {
       Q_EMIT self_->ProductUpdated(product);
    }
 }
@@ -318,8 +398,11 @@ void OverlayProductView::Impl::UpdateAutoRefresh(bool enabled) const
 {
    if (radarProductManager_ != nullptr)
    {
-      radarProductManager_->EnableRefresh(
-         common::RadarProductGroup::Level3, kNst_, enabled, uuid_);
+      for (auto& product : kOverlayProducts_)
+      {
+         radarProductManager_->EnableRefresh(
+            common::RadarProductGroup::Level3, product, enabled, uuid_);
+      }
    }
 }
 
@@ -1,9 +1,13 @@
 #include <scwx/qt/view/radar_product_view.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/settings/product_settings.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/profiler.hpp>
+
+#include <atomic>
+#include <numbers>
 
-#include <boost/asio.hpp>
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
 
@@ -25,6 +29,104 @@ static const std::vector<boost::gil::rgba8_pixel_t> kDefaultColorTable_ = {
 static const std::uint16_t kDefaultColorTableMin_ = 2u;
 static const std::uint16_t kDefaultColorTableMax_ = 255u;
 
+RadarVertexQuantization
+RadarVertexQuantization::Create(double latitude, double longitude, double range)
+{
+   static constexpr double kEarthRadius_ = 6371008.8;
+   static constexpr double kMinCosLat_   = 0.01;
+
+   // Leave a margin for the ellipsoid, and for the far edge of the last gate
+   const double latitudeExtent =
+      range * 1.05 / kEarthRadius_ * 180.0 / std::numbers::pi;
+   const double maxLatitude =
+      std::min(std::abs(latitude) + latitudeExtent, 90.0);
+   const double longitudeExtent =
+      std::min(latitudeExtent / std::max(std::cos(maxLatitude *
+                                                  std::numbers::pi / 180.0),
+                                         kMinCosLat_),
+               180.0);
+
+   constexpr double kMaxOffset = std::numeric_limits<std::int16_t>::max();
+
+   RadarVertexQuantization quantization {};
+   quantization.latitude_       = static_cast<float>(latitude);
+   quantization.longitude_      = static_cast<float>(longitude);
+   quantization.latitudeScale_ =
+      static_cast<float>(latitudeExtent / kMaxOffset);
+   quantization.longitudeScale_ =
+      static_cast<float>(longitudeExtent / kMaxOffset);
+   return quantization;
+}
+
+std::shared_ptr<const RadarMomentQuantization> RadarMomentQuantization::Create(
+   std::shared_ptr<const ColorTableLut> dataColorTableLut)
+{
+   if (dataColorTableLut == nullptr || dataColorTableLut->lut_.empty() ||
+       dataColorTableLut->min_ == 0u)
+   {
+      return nullptr;
+   }
+
+   const std::vector<boost::gil::rgba8_pixel_t>& lut = dataColorTableLut->lut_;
+   const std::uint16_t                           min = dataColorTableLut->min_;
+   const std::uint16_t max = static_cast<std::uint16_t>(min + lut.size() - 1);
+
+   auto quantization = std::make_shared<RadarMomentQuantization>();
+   quantization->dataColorTableLut_ = dataColorTableLut;
+   quantization->displayLevels_.resize(max + 1u, 0u);
+   quantization->dataLevels_.push_back(0u);
+
+   auto colorTableLut = std::make_shared<ColorTableLut>();
+   colorTableLut->colorTable_ = dataColorTableLut->colorTable_;
+
+   for (std::size_t i = 0; i < lut.size(); ++i)
+   {
+      // Begin a display level at each change in color, and after the first
+      // data level
+      if (i <= 1u || lut[i] != lut[i - 1])
+      {
+         if (colorTableLut->lut_.size() == kMaxDisplayLevels)
+         {
+            return nullptr;
+         }
+
+         colorTableLut->lut_.push_back(lut[i]);
+         quantization->dataLevels_.push_back(
+            static_cast<std::uint16_t>(min + i));
+      }
+
+      quantization->displayLevels_[min + i] =
+         static_cast<std::uint8_t>(colorTableLut->lut_.size());
+   }
+
+   if (colorTableLut->lut_.size() < 2u)
+   {
+      // A single display level cannot be scaled to the color table
+      return nullptr;
+   }
+
+   colorTableLut->min_ = 1u;
+   colorTableLut->max_ =
+      static_cast<std::uint16_t>(colorTableLut->lut_.size());
+
+   quantization->colorTableLut_ = std::move(colorTableLut);
+
+   return quantization;
+}
+
+std::uint16_t
+RadarMomentQuantization::DisplayThreshold(std::uint16_t dataLevel) const
+{
+   if (dataLevel == 0u)
+   {
+      return 0u;
+   }
+
+   auto it =
+      std::lower_bound(dataLevels_.cbegin() + 1, dataLevels_.cend(), dataLevel);
+   return static_cast<std::uint16_t>(it - dataLevels_.cbegin());
+}
+
 class RadarProductViewImpl
 {
 public:
@@ -55,19 +157,33 @@ public:
    bool       initialized_;
    std::mutex sweepMutex_;
 
+   // Set while a sweep computation is queued and has not yet started
+   std::atomic<bool> updatePending_ {false};
+
+   // Set while the view is held by a view pool
+   std::atomic<bool> suspended_ {false};
+
    std::chrono::system_clock::time_point selectedTime_;
    bool                                  showSmoothedRangeFolding_ {false};
    bool                                  smoothingEnabled_ {false};
+   std::uint16_t                         thresholdLevel_ {0u};
 
    std::shared_ptr<manager::RadarProductManager> radarProductManager_;
 
+   const std::shared_ptr<request::NexradLoadGroup> loadGroup_ {
+      std::make_shared<request::NexradLoadGroup>()};
+
    boost::signals2::scoped_connection connection_;
 };
 
 RadarProductView::RadarProductView(
    std::shared_ptr<manager::RadarProductManager> radarProductManager) :
     p(std::make_unique<RadarProductViewImpl>(this, radarProductManager)) {};
-RadarProductView::~RadarProductView() = default;
+RadarProductView::~RadarProductView()
+{
+   // Loads requested by the view are no longer wanted
+   p->loadGroup_->CancelAll();
+}
 
 const std::vector<boost::gil::rgba8_pixel_t>&
 RadarProductView::color_table_lut() const
@@ -90,6 +206,17 @@ float RadarProductView::elevation() const
    return 0.0f;
 }
 
+bool RadarProductView::is_update_pending() const
+{
+   return p->updatePending_;
+}
+
+const std::shared_ptr<request::NexradLoadGroup>&
+RadarProductView::load_group() const
+{
+   return p->loadGroup_;
+}
+
 std::shared_ptr<manager::RadarProductManager>
 RadarProductView::radar_product_manager() const
 {
@@ -116,11 +243,69 @@ bool RadarProductView::smoothing_enabled() const
    return p->smoothingEnabled_;
 }
 
+std::uint16_t RadarProductView::threshold_level() const
+{
+   return p->thresholdLevel_;
+}
+
 std::chrono::system_clock::time_point RadarProductView::sweep_time() const
 {
    return {};
 }
 
+std::shared_ptr<const std::vector<float>>
+RadarProductView::shared_vertices() const
+{
+   return nullptr;
+}
+
+std::shared_ptr<const ColorTableLut>
+RadarProductView::shared_color_table_lut() const
+{
+   return nullptr;
+}
+
+bool RadarProductView::hide_zero_moments() const
+{
+   return false;
+}
+
+std::shared_ptr<const RadarPolarGrid> RadarProductView::polar_grid() const
+{
+   return nullptr;
+}
+
+const std::vector<std::int16_t>& RadarProductView::quantized_vertices() const
+{
+   static const std::vector<std::int16_t> kNoVertices_ {};
+   return kNoVertices_;
+}
+
+std::optional<RadarVertexQuantization>
+RadarProductView::vertex_quantization() const
+{
+   return std::nullopt;
+}
+
+std::optional<RadarStormMotion> RadarProductView::storm_motion() const
+{
+   return std::nullopt;
+}
+
+std::shared_ptr<const RadarMomentQuantization>
+RadarProductView::moment_quantization() const
+{
+   return nullptr;
+}
+
+bool RadarProductView::IsPolarGridEnabled()
+{
+   auto& generalSettings = settings::GeneralSettings::Instance();
+
+   return generalSettings.gpu_radar_geometry().GetValue() ||
+          generalSettings.radar_sweep_texture().GetValue();
+}
+
 std::mutex& RadarProductView::sweep_mutex()
 {
    return p->sweepMutex_;
@@ -130,6 +315,7 @@ void RadarProductView::set_radar_product_manager(
    std::shared_ptr<manager::RadarProductManager> radarProductManager)
 {
    DisconnectRadarProductManager();
+   p->loadGroup_->NextGeneration();
    p->radarProductManager_ = radarProductManager;
    ConnectRadarProductManager();
 }
@@ -139,9 +325,21 @@ void RadarProductView::set_smoothing_enabled(bool smoothingEnabled)
    p->smoothingEnabled_ = smoothingEnabled;
 }
 
+void RadarProductView::set_threshold_level(std::uint16_t level)
+{
+   if (p->thresholdLevel_ != level)
+   {
+      p->thresholdLevel_ = level;
+      Q_EMIT ThresholdUpdated();
+   }
+}
+
 void RadarProductView::Initialize()
 {
-   ComputeSweep();
+   {
+      scwx::util::ScopedTimer timer {scwx::util::ProfileStage::ComputeSweep};
+      ComputeSweep();
+   }
 
    p->initialized_ = true;
 }
@@ -149,24 +347,71 @@ void RadarProductView::Initialize()
 void RadarProductView::SelectElevation(float /*elevation*/) {}
 
 void RadarProductView::SelectTime(std::chrono::system_clock::time_point time)
+{
+   if (time != p->selectedTime_)
+   {
+      // Loads requested for the previous time have been superseded
+      p->loadGroup_->NextGeneration();
+   }
+
+   p->selectedTime_ = time;
+}
+
+void RadarProductView::SnapSelectedTime(
+   std::chrono::system_clock::time_point time)
 {
    p->selectedTime_ = time;
 }
 
 void RadarProductView::Update()
 {
-   boost::asio::post(thread_pool(),
-                     [this]()
-                     {
-                        try
-                        {
-                           ComputeSweep();
-                        }
-                        catch (const std::exception& ex)
-                        {
-                           logger_->error(ex.what());
-                        }
-                     });
+   if (p->suspended_)
+   {
+      return;
+   }
+
+   // A queued computation uses the view state at the time it starts, so
+   // updates received before then do not need a computation of their own
+   if (p->updatePending_.exchange(true))
+   {
+      return;
+   }
+
+   strand().Post(
+      [this]()
+      {
+         p->updatePending_ = false;
+
+         scwx::util::ScopedTimer timer {scwx::util::ProfileStage::ComputeSweep};
+         ComputeSweep();
+      });
+}
+
+void RadarProductView::Suspend()
+{
+   if (p->suspended_.exchange(true))
+   {
+      return;
+   }
+
+   DisconnectRadarProductManager();
+
+   // Loads requested for the view are no longer wanted
+   p->loadGroup_->NextGeneration();
+}
+
+void RadarProductView::Resume(
+   std::shared_ptr<manager::RadarProductManager> radarProductManager)
+{
+   if (!p->suspended_)
+   {
+      return;
+   }
+
+   p->radarProductManager_ = std::move(radarProductManager);
+   ConnectRadarProductManager();
+
+   p->suspended_ = false;
 }
 
 bool RadarProductView::IsInitialized() const
@@ -174,6 +419,11 @@ bool RadarProductView::IsInitialized() const
    return p->initialized_;
 }
 
+bool RadarProductView::IsSuspended() const
+{
+   return p->suspended_;
+}
+
 std::vector<float> RadarProductView::GetElevationCuts() const
 {
    return {};
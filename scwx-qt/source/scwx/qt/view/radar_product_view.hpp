@@ -4,17 +4,25 @@
 #include <scwx/common/geographic.hpp>
 #include <scwx/common/products.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/request/nexrad_load_group.hpp>
+#include <scwx/qt/view/color_table_lut_cache.hpp>
 #include <scwx/qt/types/map_types.hpp>
+#include <scwx/util/strand.hpp>
 #include <scwx/wsr88d/wsr88d_types.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <numbers>
 #include <optional>
 #include <vector>
 
 #include <QObject>
-#include <boost/asio/thread_pool.hpp>
 
 namespace scwx
 {
@@ -25,6 +33,151 @@ namespace view
 
 class RadarProductViewImpl;
 
+/**
+ * @brief Polar layout of a sweep, from which bin vertices can be generated
+ * when rendered. Bins are ordered by radial, then by gate. Each bin has two
+ * triangles, except a bin at the radar site origin, which has one.
+ */
+struct RadarPolarGrid
+{
+   double        latitude_ {};       // Radar site latitude (degrees)
+   double        longitude_ {};      // Radar site longitude (degrees)
+   float         gateSizeMeters_ {}; // Base gate size (meters)
+   std::uint32_t startGate_ {};      // First gate (base gates)
+   std::uint32_t gateSize_ {};       // Bin size (base gates)
+   std::uint32_t bins_ {};           // Bins per radial
+
+   /**
+    * @brief Azimuth angle pairs (degrees) of the near and far edge of each
+    * radial, in sweep order.
+    */
+   std::vector<float> azimuths_ {};
+
+   std::size_t radials() const { return azimuths_.size() / 2; }
+   std::size_t radial_vertices() const
+   {
+      return (startGate_ == 0) ? bins_ * 6 - 3 : bins_ * 6;
+   }
+   std::size_t vertices() const { return radials() * radial_vertices(); }
+};
+
+/**
+ * @brief Quantization of vertices stored as 16-bit latitude and longitude
+ * offsets from the radar site. Vertices computed from the same coordinate
+ * quantize identically, so adjacent bins remain without gaps.
+ */
+struct RadarVertexQuantization
+{
+   float latitude_ {};       // Radar site latitude (degrees)
+   float longitude_ {};      // Radar site longitude (degrees)
+   float latitudeScale_ {};  // Latitude per offset unit (degrees)
+   float longitudeScale_ {}; // Longitude per offset unit (degrees)
+
+   /**
+    * @brief Creates a quantization covering a range from the radar site.
+    *
+    * @param latitude Radar site latitude (degrees)
+    * @param longitude Radar site longitude (degrees)
+    * @param range Range from the radar site to cover (meters)
+    */
+   static RadarVertexQuantization
+   Create(double latitude, double longitude, double range);
+
+   std::int16_t QuantizeLatitude(double latitude) const
+   {
+      return Quantize((latitude - latitude_) / latitudeScale_);
+   }
+   std::int16_t QuantizeLongitude(double longitude) const
+   {
+      // Offsets are taken across the antimeridian
+      double offset = longitude - longitude_;
+      offset -= 360.0 * std::round(offset / 360.0);
+      return Quantize(offset / longitudeScale_);
+   }
+
+private:
+   static std::int16_t Quantize(double offset)
+   {
+      return static_cast<std::int16_t>(std::clamp(
+         std::round(offset),
+         static_cast<double>(std::numeric_limits<std::int16_t>::min()),
+         static_cast<double>(std::numeric_limits<std::int16_t>::max())));
+   }
+};
+
+/**
+ * @brief Quantization of 16-bit data moments to 8-bit display levels, for a
+ * color table with no more than 255 distinct colors over the data range. Each
+ * display level is a run of consecutive data levels of the same color. Display
+ * level 0 is below threshold, and the first data level of the color table
+ * (range folded, for Level 2 products) is a display level of its own.
+ */
+struct RadarMomentQuantization
+{
+   static constexpr std::size_t kMaxDisplayLevels = 255u;
+
+   // Color table over data levels, from which the quantization was created
+   std::shared_ptr<const ColorTableLut> dataColorTableLut_ {};
+
+   // Color table over display levels
+   std::shared_ptr<const ColorTableLut> colorTableLut_ {};
+
+   // Display level of each data level, up to the color table maximum
+   std::vector<std::uint8_t> displayLevels_ {};
+
+   // First data level of each display level
+   std::vector<std::uint16_t> dataLevels_ {};
+
+   /**
+    * @brief Creates a quantization of a color table over data levels.
+    *
+    * @return Quantization, or nullptr if the color table has too many
+    * distinct colors
+    */
+   static std::shared_ptr<const RadarMomentQuantization>
+   Create(std::shared_ptr<const ColorTableLut> dataColorTableLut);
+
+   std::uint8_t DisplayLevel(std::uint16_t dataLevel) const
+   {
+      return displayLevels_[std::min<std::size_t>(dataLevel,
+                                                  displayLevels_.size() - 1)];
+   }
+
+   /**
+    * @brief Lowest display level at or above a data level threshold. A
+    * display level spanning the threshold is hidden with the data levels
+    * below it.
+    */
+   std::uint16_t DisplayThreshold(std::uint16_t dataLevel) const;
+};
+
+/**
+ * @brief Storm motion subtracted from radial velocities when a sweep is
+ * rendered. Data moments are unchanged, so a change in storm motion does not
+ * require the sweep to be computed again.
+ */
+struct RadarStormMotion
+{
+   float direction_ {};  // Direction the storm is moving from (degrees)
+   float speed_ {};      // Storm speed (m/s)
+   float levelScale_ {}; // Data levels per m/s
+
+   /**
+    * @brief Storm motion along a radial, in data levels
+    *
+    * @param [in] azimuth Azimuth of the radial (degrees)
+    */
+   float LevelOffset(float azimuth) const
+   {
+      constexpr float kDegreesToRadians = std::numbers::pi_v<float> / 180.0f;
+
+      // Storms move toward the opposite of the direction they move from
+      const float heading = (direction_ + 180.0f) * kDegreesToRadians;
+      return speed_ * levelScale_ *
+             std::cos(azimuth * kDegreesToRadians - heading);
+   }
+};
+
 class RadarProductView : public QObject
 {
    Q_OBJECT
@@ -47,6 +200,71 @@ public:
    virtual std::uint16_t                         vcp() const        = 0;
    virtual const std::vector<float>&             vertices() const   = 0;
 
+   /**
+    * @brief Vertices shared between sweeps. If consecutive sweeps return the
+    * same vertices, only the data moments need to be buffered.
+    *
+    * @return Shared vertices, or nullptr if the vertices are not shared
+    */
+   virtual std::shared_ptr<const std::vector<float>> shared_vertices() const;
+
+   /**
+    * @brief Color table lookup table shared between views. If consecutive
+    * products return the same lookup table, it does not need to be uploaded
+    * again.
+    *
+    * @return Shared lookup table, or nullptr if the lookup table is not shared
+    */
+   virtual std::shared_ptr<const ColorTableLut> shared_color_table_lut() const;
+
+   /**
+    * @brief Whether bins with a data moment of zero are hidden when rendered
+    */
+   virtual bool hide_zero_moments() const;
+
+   /**
+    * @brief Polar layout of the sweep. If present, vertices() is empty, and
+    * bin vertices are generated when rendered.
+    *
+    * @return Polar layout, or nullptr if the sweep has explicit vertices
+    */
+   virtual std::shared_ptr<const RadarPolarGrid> polar_grid() const;
+
+   /**
+    * @brief Vertices stored as 16-bit offsets from the radar site, as
+    * latitude/longitude offset pairs. If present, vertices() holds only the
+    * shared vertices, if any.
+    *
+    * @return Quantized vertices, or an empty vector if vertices are not
+    * quantized
+    */
+   virtual const std::vector<std::int16_t>& quantized_vertices() const;
+
+   /**
+    * @brief Quantization of the vertices returned by quantized_vertices()
+    *
+    * @return Vertex quantization, or std::nullopt if vertices are not
+    * quantized
+    */
+   virtual std::optional<RadarVertexQuantization> vertex_quantization() const;
+
+   /**
+    * @brief Storm motion to subtract from the data moments when rendered
+    *
+    * @return Storm motion, or std::nullopt if the sweep is not storm relative
+    */
+   virtual std::optional<RadarStormMotion> storm_motion() const;
+
+   /**
+    * @brief Quantization of the data moments returned by GetMomentData(). If
+    * present, the data moments are 8-bit display levels, to be rendered with
+    * the color table of the quantization in place of color_table_lut().
+    *
+    * @return Moment quantization, or nullptr if data moments are data levels
+    */
+   virtual std::shared_ptr<const RadarMomentQuantization>
+   moment_quantization() const;
+
    [[nodiscard]] std::shared_ptr<manager::RadarProductManager>
    radar_product_manager() const;
    [[nodiscard]] std::chrono::system_clock::time_point selected_time() const;
@@ -54,9 +272,19 @@ public:
    [[nodiscard]] bool        smoothing_enabled() const;
    [[nodiscard]] std::mutex& sweep_mutex();
 
+   /**
+    * @brief Data level below which bins are hidden when rendered. Applied by
+    * the shader, so a change in threshold does not require the sweep to be
+    * computed again.
+    *
+    * @return Threshold data level, or 0 if no bins are hidden
+    */
+   [[nodiscard]] std::uint16_t threshold_level() const;
+
    void set_radar_product_manager(
       std::shared_ptr<manager::RadarProductManager> radarProductManager);
    void set_smoothing_enabled(bool smoothingEnabled);
+   void set_threshold_level(std::uint16_t level);
 
    void Initialize();
    virtual void
@@ -66,7 +294,27 @@ public:
    void         SelectTime(std::chrono::system_clock::time_point time);
    void         Update();
 
+   /**
+    * @brief Suspends the view while it is not displayed. A suspended view
+    * does not compute sweeps, and does not respond to product updates.
+    */
+   void Suspend();
+
+   /**
+    * @brief Resumes a suspended view, retargeting it to the radar product
+    * manager if it has changed. The view is not updated until requested.
+    */
+   void Resume(
+      std::shared_ptr<manager::RadarProductManager> radarProductManager);
+
    bool IsInitialized() const;
+   bool IsSuspended() const;
+
+   /**
+    * @brief Determines whether sweeps in the uniform grid layout should be
+    * described by a polar grid, for rendering on the GPU.
+    */
+   static bool IsPolarGridEnabled();
 
    virtual common::RadarProductGroup GetRadarProductGroup() const = 0;
    virtual std::string               GetRadarProductName() const  = 0;
@@ -87,7 +335,26 @@ public:
    GetDescriptionFields() const;
 
 protected:
-   virtual boost::asio::thread_pool& thread_pool() = 0;
+   virtual scwx::util::Strand& strand() = 0;
+
+   /**
+    * @brief Load group of the view. Loads requested for a previous selected
+    * time are cancelled when a new time is selected.
+    */
+   [[nodiscard]] const std::shared_ptr<request::NexradLoadGroup>&
+   load_group() const;
+
+   /**
+    * @brief Whether a sweep computation has been queued since the current
+    * computation started, such that the current computation is superseded.
+    */
+   [[nodiscard]] bool is_update_pending() const;
+
+   /**
+    * @brief Snaps the selected time to the time of the product found for it.
+    * Unlike SelectTime, loads already requested are not cancelled.
+    */
+   void SnapSelectedTime(std::chrono::system_clock::time_point time);
 
    virtual void ConnectRadarProductManager()    = 0;
    virtual void DisconnectRadarProductManager() = 0;
@@ -99,6 +366,8 @@ protected slots:
 signals:
    void ColorTableLutUpdated();
    void SweepComputed();
+   void StormMotionUpdated();
+   void ThresholdUpdated();
    void SweepNotComputed(types::NoUpdateReason reason);
 
 private:
@@ -0,0 +1,108 @@
+#include <scwx/qt/view/radar_product_view_pool.hpp>
+#include <scwx/qt/view/radar_product_view_factory.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <list>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string logPrefix_ = "scwx::qt::view::radar_product_view_pool";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+class RadarProductViewPool::Impl
+{
+public:
+   struct Entry
+   {
+      common::RadarProductGroup         productGroup_;
+      std::string                       productName_;
+      std::int16_t                      productCode_;
+      std::shared_ptr<RadarProductView> view_;
+   };
+
+   explicit Impl(std::size_t capacity) : capacity_ {capacity} {}
+   ~Impl() = default;
+
+   std::size_t capacity_;
+
+   // Most recently released views first
+   std::list<Entry> entries_ {};
+};
+
+RadarProductViewPool::RadarProductViewPool(std::size_t capacity) :
+    p(std::make_unique<Impl>(capacity))
+{
+}
+RadarProductViewPool::~RadarProductViewPool() = default;
+
+std::size_t RadarProductViewPool::size() const
+{
+   return p->entries_.size();
+}
+
+std::shared_ptr<RadarProductView> RadarProductViewPool::Acquire(
+   common::RadarProductGroup                     productGroup,
+   const std::string&                            productName,
+   std::int16_t                                  productCode,
+   std::shared_ptr<manager::RadarProductManager> radarProductManager)
+{
+   auto it = std::find_if(p->entries_.begin(),
+                          p->entries_.end(),
+                          [&](const Impl::Entry& entry)
+                          {
+                             return entry.productGroup_ == productGroup &&
+                                    entry.productName_ == productName &&
+                                    entry.productCode_ == productCode;
+                          });
+
+   if (it != p->entries_.end())
+   {
+      logger_->trace("Reusing view: {}", productName);
+
+      std::shared_ptr<RadarProductView> view = std::move(it->view_);
+      p->entries_.erase(it);
+
+      view->Resume(radarProductManager);
+
+      return view;
+   }
+
+   return RadarProductViewFactory::Create(
+      productGroup, productName, productCode, radarProductManager);
+}
+
+void RadarProductViewPool::Release(std::shared_ptr<RadarProductView> view,
+                                   std::int16_t productCode)
+{
+   if (view == nullptr || p->capacity_ == 0u)
+   {
+      return;
+   }
+
+   view->Suspend();
+
+   p->entries_.push_front({view->GetRadarProductGroup(),
+                           view->GetRadarProductName(),
+                           productCode,
+                           std::move(view)});
+
+   while (p->entries_.size() > p->capacity_)
+   {
+      p->entries_.pop_back();
+   }
+}
+
+void RadarProductViewPool::Clear()
+{
+   p->entries_.clear();
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <scwx/common/products.hpp>
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/view/radar_product_view.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+/**
+ * @brief Recycles the product views of a map pane. A view that is replaced is
+ * suspended and held, with its buffers and computed sweeps, so that selecting
+ * its product again does not construct a new view. The least recently
+ * released views are destroyed once the pool is full.
+ */
+class RadarProductViewPool
+{
+public:
+   static constexpr std::size_t kDefaultCapacity = 3u;
+
+   explicit RadarProductViewPool(std::size_t capacity = kDefaultCapacity);
+   ~RadarProductViewPool();
+
+   RadarProductViewPool(const RadarProductViewPool&)            = delete;
+   RadarProductViewPool& operator=(const RadarProductViewPool&) = delete;
+
+   RadarProductViewPool(RadarProductViewPool&&)            = delete;
+   RadarProductViewPool& operator=(RadarProductViewPool&&) = delete;
+
+   std::size_t size() const;
+
+   /**
+    * @brief Gets a view of a product. A released view of the same product is
+    * resumed and returned if available, otherwise a new view is created.
+    *
+    * @param productGroup Radar product group
+    * @param productName Radar product name
+    * @param productCode Level 3 product code, or 0 for Level 2 products
+    * @param radarProductManager Radar product manager of the pane
+    *
+    * @return Product view, or nullptr if the product is not supported
+    */
+   std::shared_ptr<RadarProductView>
+   Acquire(common::RadarProductGroup                     productGroup,
+           const std::string&                            productName,
+           std::int16_t                                  productCode,
+           std::shared_ptr<manager::RadarProductManager> radarProductManager);
+
+   /**
+    * @brief Suspends a view which is no longer displayed, and holds it for
+    * reuse.
+    *
+    * @param view Product view
+    * @param productCode Level 3 product code of the view, or 0 for Level 2
+    * products
+    */
+   void Release(std::shared_ptr<RadarProductView> view,
+                std::int16_t                      productCode);
+
+   /**
+    * @brief Destroys all views held by the pool.
+    */
+   void Clear();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,154 @@
+cmake_minimum_required(VERSION 3.24)
+project(scwx-bench CXX)
+
+find_package(benchmark)
+find_package(Boost)
+
+if (NOT benchmark_FOUND)
+    message(STATUS "Google Benchmark not found, wxdata-bench will not be built")
+    return()
+endif()
+
+set(SRC_BENCH_MAIN source/scwx/bench_runner.cpp
+                   source/scwx/wxbench.cpp
+                   source/scwx/wxbench_main.cpp)
+set(HDR_BENCH_MAIN source/scwx/bench_runner.hpp
+                   source/scwx/wxbench.hpp)
+set(SRC_QT_BENCH_MAIN source/scwx/bench_runner.cpp
+                      source/scwx/qtbench.cpp)
+set(HDR_QT_BENCH_MAIN source/scwx/bench_runner.hpp
+                      source/scwx/qtbench.hpp)
+set(SRC_AWIPS_BENCH source/scwx/awips/pvtec.bench.cpp
+                    source/scwx/awips/text_product_file.bench.cpp
+                    source/scwx/awips/ugc.bench.cpp)
+set(SRC_GR_BENCH source/scwx/gr/placefile.bench.cpp)
+set(SRC_WSR88D_BENCH source/scwx/wsr88d/ar2v_file.bench.cpp
+                     source/scwx/wsr88d/level3_file.bench.cpp)
+set(SRC_QT_GL_DRAW_BENCH source/scwx/qt/gl/draw/geo_icons.bench.cpp
+                         source/scwx/qt/gl/draw/geo_lines.bench.cpp
+                         source/scwx/qt/gl/draw/placefile_items.bench.cpp)
+set(SRC_QT_VIEW_BENCH source/scwx/qt/view/radar_product_view.bench.cpp)
+
+set(BENCH_CMAKE_FILES bench.cmake)
+
+add_executable(wxdata-bench ${SRC_BENCH_MAIN}
+                            ${HDR_BENCH_MAIN}
+                            ${SRC_AWIPS_BENCH}
+                            ${SRC_GR_BENCH}
+                            ${SRC_WSR88D_BENCH}
+                            ${BENCH_CMAKE_FILES})
+
+source_group("Header Files\\main"    FILES ${HDR_BENCH_MAIN})
+source_group("Source Files\\main"    FILES ${SRC_BENCH_MAIN})
+source_group("Source Files\\awips"   FILES ${SRC_AWIPS_BENCH})
+source_group("Source Files\\gr"      FILES ${SRC_GR_BENCH})
+source_group("Source Files\\wsr88d"  FILES ${SRC_WSR88D_BENCH})
+
+target_include_directories(wxdata-bench PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/source)
+
+set_target_properties(wxdata-bench PROPERTIES CXX_STANDARD 20
+                                              CXX_STANDARD_REQUIRED ON
+                                              CXX_EXTENSIONS OFF)
+
+target_compile_definitions(wxdata-bench PRIVATE SCWX_TEST_DATA_DIR="${SCWX_DIR}/test/data")
+
+if (MSVC)
+    # Don't include Windows macros
+    target_compile_options(wxdata-bench PRIVATE -DNOMINMAX)
+
+    # Enable multi-processor compilation
+    target_compile_options(wxdata-bench PRIVATE "/MP")
+endif()
+
+target_link_libraries(wxdata-bench benchmark::benchmark
+                                   Boost::json
+                                   wxdata)
+
+# Render benchmarks, run headless with QT_QPA_PLATFORM=offscreen
+add_executable(scwx-bench ${SRC_QT_BENCH_MAIN}
+                          ${HDR_QT_BENCH_MAIN}
+                          ${SRC_QT_GL_DRAW_BENCH}
+                          ${SRC_QT_VIEW_BENCH}
+                          ${BENCH_CMAKE_FILES})
+
+source_group("Header Files\\main"        FILES ${HDR_QT_BENCH_MAIN})
+source_group("Source Files\\main"        FILES ${SRC_QT_BENCH_MAIN})
+source_group("Source Files\\qt\\gl\\draw" FILES ${SRC_QT_GL_DRAW_BENCH})
+source_group("Source Files\\qt\\view"    FILES ${SRC_QT_VIEW_BENCH})
+
+target_include_directories(scwx-bench PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/source)
+
+set_target_properties(scwx-bench PROPERTIES CXX_STANDARD 20
+                                            CXX_STANDARD_REQUIRED ON
+                                            CXX_EXTENSIONS OFF)
+
+target_compile_definitions(scwx-bench PRIVATE SCWX_TEST_DATA_DIR="${SCWX_DIR}/test/data")
+
+if (MSVC)
+    # Don't include Windows macros
+    target_compile_options(scwx-bench PRIVATE -DNOMINMAX)
+
+    # Enable multi-processor compilation
+    target_compile_options(scwx-bench PRIVATE "/MP")
+endif()
+
+target_link_libraries(scwx-bench benchmark::benchmark
+                                 Boost::json
+                                 scwx-qt
+                                 wxdata)
+
+# Performance regression tests compare the decoder and sweep benchmarks against
+# a baseline recorded on the same machine. Record the baselines by building the
+# scwx-perf-baseline target, and exclude the tests with ctest -LE perf.
+set(SCWX_PERF_THRESHOLD 10 CACHE STRING
+    "Benchmark slowdown in percent which fails the performance tests")
+
+cmake_host_system_information(RESULT SCWX_PERF_HOST QUERY HOSTNAME)
+set(SCWX_PERF_BASELINE_DIR "${SCWX_DIR}/test/baselines/${SCWX_PERF_HOST}"
+    CACHE PATH "Performance baselines for this machine")
+
+set(PERF_ARGS --benchmark_repetitions=5
+              --benchmark_report_aggregates_only=true)
+set(WXDATA_PERF_ARGS ${PERF_ARGS}
+                     "--benchmark_filter=^(Ar2vFileLoadData|Level3FileLoadData)/")
+set(SCWX_PERF_ARGS ${PERF_ARGS}
+                   --benchmark_filter=^RadarProductViewComputeSweep/)
+
+set(WXDATA_PERF_BASELINE ${SCWX_PERF_BASELINE_DIR}/wxdata-bench.json)
+set(SCWX_PERF_BASELINE   ${SCWX_PERF_BASELINE_DIR}/scwx-bench.json)
+
+add_custom_target(scwx-perf-baseline
+                  COMMAND ${CMAKE_COMMAND} -E make_directory ${SCWX_PERF_BASELINE_DIR}
+                  COMMAND wxdata-bench ${WXDATA_PERF_ARGS}
+                          --benchmark_out=${WXDATA_PERF_BASELINE}
+                          --benchmark_out_format=json
+                  COMMAND ${CMAKE_COMMAND} -E env QT_QPA_PLATFORM=offscreen
+                          $<TARGET_FILE:scwx-bench> ${SCWX_PERF_ARGS}
+                          --benchmark_out=${SCWX_PERF_BASELINE}
+                          --benchmark_out_format=json
+                  DEPENDS wxdata-bench scwx-bench
+                  USES_TERMINAL
+                  VERBATIM)
+
+if (EXISTS ${WXDATA_PERF_BASELINE})
+    add_test(NAME wxdata-perf
+             COMMAND wxdata-bench ${WXDATA_PERF_ARGS}
+                     --scwx_baseline=${WXDATA_PERF_BASELINE}
+                     --scwx_regression_threshold=${SCWX_PERF_THRESHOLD})
+    set_tests_properties(wxdata-perf PROPERTIES LABELS perf
+                                                RUN_SERIAL TRUE)
+else()
+    message(STATUS "No decoder performance baseline for ${SCWX_PERF_HOST}, wxdata-perf will not be run")
+endif()
+
+if (EXISTS ${SCWX_PERF_BASELINE})
+    add_test(NAME scwx-perf
+             COMMAND scwx-bench ${SCWX_PERF_ARGS}
+                     --scwx_baseline=${SCWX_PERF_BASELINE}
+                     --scwx_regression_threshold=${SCWX_PERF_THRESHOLD})
+    set_tests_properties(scwx-perf PROPERTIES LABELS perf
+                                              RUN_SERIAL TRUE
+                                              ENVIRONMENT QT_QPA_PLATFORM=offscreen)
+else()
+    message(STATUS "No sweep performance baseline for ${SCWX_PERF_HOST}, scwx-perf will not be run")
+endif()
@@ -0,0 +1,61 @@
+#include <scwx/wxbench.hpp>
+#include <scwx/awips/pvtec.hpp>
+
+#include <regex>
+#include <sstream>
+
+namespace scwx
+{
+namespace awips
+{
+
+static void PVtecParse(benchmark::State& state, const std::string& file)
+{
+   static const std::regex kPVtecRegex {"^/[OTEX]\\..*/$"};
+
+   std::vector<char> data = bench::ReadTestData(file);
+
+   // Collect the P-VTEC strings in the file
+   std::istringstream       is {std::string {data.cbegin(), data.cend()}};
+   std::vector<std::string> pvtecStrings {};
+   std::size_t              size = 0u;
+
+   for (std::string line; std::getline(is, line);)
+   {
+      if (!line.empty() && line.back() == '\r')
+      {
+         line.pop_back();
+      }
+      if (std::regex_match(line, kPVtecRegex))
+      {
+         size += line.size();
+         pvtecStrings.push_back(std::move(line));
+      }
+   }
+
+   if (pvtecStrings.empty())
+   {
+      state.SkipWithError("Could not read test data");
+      return;
+   }
+
+   bench::RunDecoder(state,
+                     size,
+                     [&]()
+                     {
+                        bool valid = true;
+                        for (auto& s : pvtecStrings)
+                        {
+                           PVtec pvtec;
+                           valid &= pvtec.Parse(s);
+                        }
+                        return valid;
+                     });
+}
+
+BENCHMARK_CAPTURE(PVtecParse,
+                  Warnings_20210604_21,
+                  std::string {"/warnings/warnings_20210604_21.txt"});
+
+} // namespace awips
+} // namespace scwx
@@ -111,6 +111,27 @@ TEST(PVtec, TornadoWarningContinued)
    EXPECT_EQ(eventEnd.second.minutes(), 0min);
 }
 
+TEST(PVtec, InvalidDateTime)
+{
+   using namespace std::chrono;
+
+   PVtec       pvtec;
+   std::string s = "/O.NEW.KLSX.SV.W.0012.210230T1200Z-992412T2460Z/";
+
+   EXPECT_TRUE(pvtec.Parse(s));
+
+   // February 30 and hour 24 are invalid
+   EXPECT_EQ(pvtec.event_begin(), std::chrono::system_clock::time_point {});
+   EXPECT_EQ(pvtec.event_end(), std::chrono::system_clock::time_point {});
+
+   // Two digit years before 69 are in the 21st century
+   s = "/O.NEW.KLSX.SV.W.0012.990101T0000Z-680101T0000Z/";
+
+   EXPECT_TRUE(pvtec.Parse(s));
+   EXPECT_EQ(GetDateTime(pvtec.event_begin()).first.year(), 1999y);
+   EXPECT_EQ(GetDateTime(pvtec.event_end()).first.year(), 2068y);
+}
+
 std::pair<std::chrono::year_month_day,
           std::chrono::hh_mm_ss<std::chrono::minutes>>
 GetDateTime(std::chrono::system_clock::time_point t)
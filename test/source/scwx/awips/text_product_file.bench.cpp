@@ -0,0 +1,46 @@
+#include <scwx/wxbench.hpp>
+#include <scwx/awips/text_product_file.hpp>
+#include <scwx/util/vectorbuf.hpp>
+
+#include <istream>
+
+namespace scwx
+{
+namespace awips
+{
+
+static void TextProductFileLoadData(benchmark::State&  state,
+                                    const std::string& file)
+{
+   std::vector<char> data = bench::ReadTestData(file);
+   if (data.empty())
+   {
+      state.SkipWithError("Could not read test data");
+      return;
+   }
+
+   bench::RunDecoder(state,
+                     data.size(),
+                     [&]()
+                     {
+                        util::vectorbuf buf {data};
+                        buf.update_read_pointers(data.size());
+                        std::istream is {&buf};
+
+                        TextProductFile textProductFile;
+                        return textProductFile.LoadData(is);
+                     });
+}
+
+BENCHMARK_CAPTURE(TextProductFileLoadData,
+                  Warnings_20210604_21,
+                  std::string {"/warnings/warnings_20210604_21.txt"});
+BENCHMARK_CAPTURE(TextProductFileLoadData,
+                  Warnings_20210606_15,
+                  std::string {"/warnings/warnings_20210606_15.txt"});
+BENCHMARK_CAPTURE(TextProductFileLoadData,
+                  WHPQ41,
+                  std::string {"/text/PGUM_WHPQ41_CFWPQ1_202201231710.nids"});
+
+} // namespace awips
+} // namespace scwx
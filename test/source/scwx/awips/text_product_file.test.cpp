@@ -1,5 +1,7 @@
 #include <scwx/awips/text_product_file.hpp>
 
+#include <sstream>
+
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -56,5 +58,28 @@ TEST(TextProductFile, Update)
    EXPECT_EQ(file.message_count(), 13);
 }
 
+TEST(TextProductFile, ConcatenatedProducts)
+{
+   const auto product = [](const std::string& sequence,
+                           const std::string& dateTime)
+   {
+      return "\x01\r\r\n" + sequence + " \r\r\n" + "WUUS53 KLSX " +
+             dateTime +
+             "\r\r\nSVSLSX\r\r\n\r\r\nBULLETIN\r\r\n\r\r\n$$\r\r\n\x03";
+   };
+
+   // Two products, followed by a duplicate of the first
+   std::istringstream is {product("101", "041404") +
+                          product("102", "041410") +
+                          product("101", "041404")};
+
+   TextProductFile file;
+   file.LoadData(is);
+
+   ASSERT_EQ(file.message_count(), 2);
+   EXPECT_EQ(file.message(0)->wmo_header()->sequence_number(), "101");
+   EXPECT_EQ(file.message(1)->wmo_header()->sequence_number(), "102");
+}
+
 } // namespace awips
 } // namespace scwx
@@ -0,0 +1,63 @@
+#include <scwx/awips/text_product_file.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace awips
+{
+
+TEST(TextProductMessage, Compact)
+{
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) +
+                               "/warnings/warnings_20210606_22-59.txt"};
+
+   TextProductFile file;
+   file.LoadFile(filename);
+
+   ASSERT_GT(file.message_count(), 0);
+
+   for (auto& message : file.messages())
+   {
+      const std::string messageContent = message->message_content();
+      const std::size_t segmentCount   = message->segment_count();
+      const std::string wmoDateTime    = message->wmo_header()->date_time();
+
+      std::vector<std::vector<std::string>> fipsIds {};
+      for (auto& segment : message->segments())
+      {
+         fipsIds.push_back(segment->header_.has_value() ?
+                              segment->header_->ugc_.fips_ids() :
+                              std::vector<std::string> {});
+      }
+
+      // Segments referenced outside of the message are not compacted
+      auto firstSegment = message->segment(0);
+      EXPECT_FALSE(message->Compact());
+      firstSegment.reset();
+
+      ASSERT_TRUE(message->Compact());
+
+      // Message content is decompressed when requested
+      EXPECT_EQ(message->message_content(), messageContent);
+      EXPECT_EQ(message->wmo_header()->date_time(), wmoDateTime);
+      EXPECT_TRUE(message->mnd_header().empty());
+
+      // Parsed segment information is kept, and product content is released
+      ASSERT_EQ(message->segment_count(), segmentCount);
+      for (std::size_t i = 0; i < segmentCount; ++i)
+      {
+         auto segment = message->segment(i);
+
+         EXPECT_TRUE(segment->productContent_.empty());
+         if (segment->header_.has_value())
+         {
+            EXPECT_EQ(segment->header_->ugc_.fips_ids(), fipsIds[i]);
+            EXPECT_TRUE(segment->header_->ugcString_.empty());
+         }
+      }
+   }
+}
+
+} // namespace awips
+} // namespace scwx
@@ -0,0 +1,71 @@
+#include <scwx/wxbench.hpp>
+#include <scwx/awips/ugc.hpp>
+
+#include <regex>
+#include <sstream>
+
+namespace scwx
+{
+namespace awips
+{
+
+static void UgcParse(benchmark::State& state, const std::string& file)
+{
+   static const std::regex kUgcBeginRegex {"^[A-Z]{2}[CZ][0-9A-Z]{3}[->].*"};
+   static const std::regex kUgcEndRegex {".*[0-9]{6}-$"};
+
+   std::vector<char> data = bench::ReadTestData(file);
+
+   // Collect the UGC strings in the file, which may span multiple lines
+   std::istringstream is {std::string {data.cbegin(), data.cend()}};
+   std::vector<std::vector<std::string>> ugcStrings {};
+   std::vector<std::string>              ugcString {};
+   std::size_t                           size = 0u;
+
+   for (std::string line; std::getline(is, line);)
+   {
+      if (!line.empty() && line.back() == '\r')
+      {
+         line.pop_back();
+      }
+      if (ugcString.empty() && !std::regex_match(line, kUgcBeginRegex))
+      {
+         continue;
+      }
+
+      size += line.size();
+      ugcString.push_back(line);
+
+      if (std::regex_match(line, kUgcEndRegex))
+      {
+         ugcStrings.push_back(std::move(ugcString));
+         ugcString.clear();
+      }
+   }
+
+   if (ugcStrings.empty())
+   {
+      state.SkipWithError("Could not read test data");
+      return;
+   }
+
+   bench::RunDecoder(state,
+                     size,
+                     [&]()
+                     {
+                        bool valid = true;
+                        for (auto& s : ugcStrings)
+                        {
+                           Ugc ugc;
+                           valid &= ugc.Parse(s);
+                        }
+                        return valid;
+                     });
+}
+
+BENCHMARK_CAPTURE(UgcParse,
+                  Warnings_20210604_21,
+                  std::string {"/warnings/warnings_20210604_21.txt"});
+
+} // namespace awips
+} // namespace scwx
@@ -132,5 +132,33 @@ TEST(Ugc, PartOfState3)
    EXPECT_EQ(expiration, "202300");
 }
 
+TEST(Ugc, FipsCodes)
+{
+   Ugc                      ugc;
+   std::vector<std::string> ugcString {"MOC189-510-ILC163-221500-"};
+
+   ugc.Parse(ugcString);
+
+   auto fipsIds   = ugc.fips_ids();
+   auto fipsCodes = ugc.fips_codes();
+
+   ASSERT_EQ(fipsIds.size(), 3u);
+   ASSERT_EQ(fipsCodes.size(), 3u);
+
+   for (std::size_t i = 0; i < fipsIds.size(); ++i)
+   {
+      EXPECT_EQ(Ugc::GetFipsCode(fipsIds[i]), fipsCodes[i]);
+   }
+
+   // Each state, format and number has a unique code
+   EXPECT_NE(Ugc::GetFipsCode("MOC189"), Ugc::GetFipsCode("MOZ189"));
+   EXPECT_NE(Ugc::GetFipsCode("MOC189"), Ugc::GetFipsCode("MNC189"));
+   EXPECT_NE(Ugc::GetFipsCode("MOC189"), Ugc::GetFipsCode("MOC190"));
+
+   EXPECT_EQ(Ugc::GetFipsCode(""), std::nullopt);
+   EXPECT_EQ(Ugc::GetFipsCode("MOX189"), std::nullopt);
+   EXPECT_EQ(Ugc::GetFipsCode("MOC18"), std::nullopt);
+}
+
 } // namespace awips
 } // namespace scwx
@@ -0,0 +1,253 @@
+#include <scwx/bench_runner.hpp>
+
+#include <charconv>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <string_view>
+
+#include <benchmark/benchmark.h>
+#include <boost/json.hpp>
+#include <fmt/format.h>
+
+namespace scwx
+{
+namespace bench
+{
+
+static constexpr std::string_view kBaselineFlag_ = "--scwx_baseline=";
+static constexpr std::string_view kThresholdFlag_ =
+   "--scwx_regression_threshold=";
+
+static constexpr double kDefaultThreshold_ = 10.0;
+
+// Real time in seconds, by benchmark name
+typedef std::map<std::string, double> ResultMap;
+
+static bool IsCompared(bool isAggregate, const std::string& aggregateName)
+{
+   // Compare single runs, or the median of repeated runs
+   return !isAggregate || aggregateName == "median";
+}
+
+class BaselineReporter : public benchmark::ConsoleReporter
+{
+public:
+   void ReportRuns(const std::vector<Run>& runs) override
+   {
+      ConsoleReporter::ReportRuns(runs);
+
+      for (auto& run : runs)
+      {
+         if (run.skipped || !IsCompared(run.run_type == Run::RT_Aggregate,
+                                        run.aggregate_name))
+         {
+            continue;
+         }
+
+         results_[run.benchmark_name()] =
+            run.GetAdjustedRealTime() /
+            benchmark::GetTimeUnitMultiplier(run.time_unit);
+      }
+   }
+
+   const ResultMap& results() const { return results_; }
+
+private:
+   ResultMap results_ {};
+};
+
+static double ParseTimeUnitMultiplier(std::string_view timeUnit)
+{
+   if (timeUnit == "ns")
+   {
+      return 1e9;
+   }
+   else if (timeUnit == "us")
+   {
+      return 1e6;
+   }
+   else if (timeUnit == "ms")
+   {
+      return 1e3;
+   }
+   return 1.0;
+}
+
+static bool ReadBaseline(const std::string& filename, ResultMap& baseline)
+{
+   std::ifstream     f {filename, std::ios_base::in | std::ios_base::binary};
+   const std::string data {std::istreambuf_iterator<char>(f),
+                           std::istreambuf_iterator<char>()};
+
+   boost::system::error_code ec;
+   boost::json::value        json = boost::json::parse(data, ec);
+
+   const boost::json::object* root = json.if_object();
+   const boost::json::value*  benchmarks =
+      (root != nullptr) ? root->if_contains("benchmarks") : nullptr;
+
+   if (ec || benchmarks == nullptr || !benchmarks->is_array())
+   {
+      fmt::print(stderr, "Could not read baseline: {}\n", filename);
+      return false;
+   }
+
+   try
+   {
+      for (auto& value : benchmarks->get_array())
+      {
+         const boost::json::object& benchmark = value.as_object();
+
+         const boost::json::value* aggregateName =
+            benchmark.if_contains("aggregate_name");
+
+         if (!IsCompared(benchmark.at("run_type").as_string() == "aggregate",
+                         (aggregateName != nullptr) ?
+                            std::string {aggregateName->as_string()} :
+                            std::string {}))
+         {
+            continue;
+         }
+
+         baseline[std::string {benchmark.at("name").as_string()}] =
+            benchmark.at("real_time").to_number<double>() /
+            ParseTimeUnitMultiplier(benchmark.at("time_unit").as_string());
+      }
+   }
+   catch (const std::exception& ex)
+   {
+      fmt::print(stderr, "Invalid baseline: {}: {}\n", filename, ex.what());
+      return false;
+   }
+
+   return true;
+}
+
+static bool CompareBaseline(const ResultMap& results,
+                            const ResultMap& baseline,
+                            double           threshold)
+{
+   static constexpr double kMilliseconds = 1e3;
+
+   std::size_t compared    = 0u;
+   std::size_t regressions = 0u;
+
+   fmt::print("\n{:<56} {:>13} {:>13} {:>8}\n",
+              "Benchmark",
+              "Baseline (ms)",
+              "Current (ms)",
+              "Change");
+
+   for (auto& [name, current] : results)
+   {
+      auto it = baseline.find(name);
+      if (it == baseline.cend())
+      {
+         fmt::print("{:<56} {:>13} {:>13.3f}\n",
+                    name,
+                    "-",
+                    current * kMilliseconds);
+         continue;
+      }
+
+      const double change    = (current / it->second - 1.0) * 100.0;
+      const bool   regressed = change > threshold;
+
+      fmt::print("{:<56} {:>13.3f} {:>13.3f} {:>+7.1f}%{}\n",
+                 name,
+                 it->second * kMilliseconds,
+                 current * kMilliseconds,
+                 change,
+                 regressed ? " REGRESSION" : "");
+
+      ++compared;
+      if (regressed)
+      {
+         ++regressions;
+      }
+   }
+
+   if (compared == 0u)
+   {
+      fmt::print(stderr, "No benchmarks were found in the baseline\n");
+      return false;
+   }
+
+   if (regressions > 0u)
+   {
+      fmt::print(stderr,
+                 "{} of {} benchmarks are more than {}% slower than the "
+                 "baseline\n",
+                 regressions,
+                 compared,
+                 threshold);
+      return false;
+   }
+
+   return true;
+}
+
+int RunBenchmarks(int argc, char** argv)
+{
+   std::string baselineFile {};
+   double      threshold = kDefaultThreshold_;
+
+   // Remove the flags handled here before Google Benchmark parses the rest
+   int count = 1;
+   for (int i = 1; i < argc; ++i)
+   {
+      const std::string_view arg {argv[i]};
+
+      if (arg.starts_with(kBaselineFlag_))
+      {
+         baselineFile = arg.substr(kBaselineFlag_.size());
+      }
+      else if (arg.starts_with(kThresholdFlag_))
+      {
+         const std::string_view value = arg.substr(kThresholdFlag_.size());
+         const char*            end   = value.data() + value.size();
+         auto [ptr, ec] = std::from_chars(value.data(), end, threshold);
+         if (ec != std::errc {} || ptr != end)
+         {
+            fmt::print(stderr, "Invalid regression threshold: {}\n", value);
+            return 1;
+         }
+      }
+      else
+      {
+         argv[count++] = argv[i];
+      }
+   }
+   argc = count;
+
+   ::benchmark::Initialize(&argc, argv);
+   if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+   {
+      return 1;
+   }
+
+   if (baselineFile.empty())
+   {
+      ::benchmark::RunSpecifiedBenchmarks();
+      ::benchmark::Shutdown();
+      return 0;
+   }
+
+   ResultMap baseline {};
+   if (!ReadBaseline(baselineFile, baseline))
+   {
+      ::benchmark::Shutdown();
+      return 1;
+   }
+
+   BaselineReporter reporter {};
+   ::benchmark::RunSpecifiedBenchmarks(&reporter);
+   ::benchmark::Shutdown();
+
+   return CompareBaseline(reporter.results(), baseline, threshold) ? 0 : 1;
+}
+
+} // namespace bench
+} // namespace scwx
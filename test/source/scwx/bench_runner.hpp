@@ -0,0 +1,30 @@
+#pragma once
+
+namespace scwx
+{
+namespace bench
+{
+
+/**
+ * @brief Runs the benchmarks selected on the command line.
+ *
+ * In addition to the Google Benchmark flags, the following flags are accepted:
+ *
+ * --scwx_baseline=<file>
+ *    Compares the results to a baseline written with --benchmark_out and
+ *    --benchmark_out_format=json. The run fails if any benchmark in the
+ *    baseline is slower than the regression threshold allows.
+ *
+ * --scwx_regression_threshold=<percent>
+ *    Slowdown relative to the baseline which is allowed before a benchmark is
+ *    considered a regression. Defaults to 10 percent.
+ *
+ * @param [in] argc Argument count
+ * @param [in] argv Arguments
+ *
+ * @return Process exit code
+ */
+int RunBenchmarks(int argc, char** argv);
+
+} // namespace bench
+} // namespace scwx
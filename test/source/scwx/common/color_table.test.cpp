@@ -1,5 +1,7 @@
 #include <scwx/common/color_table.hpp>
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -30,5 +32,32 @@ TEST(color_table, reflectivity)
    EXPECT_EQ(ct->Color(85), boost::gil::rgba8_pixel_t(128, 128, 128, 255));
 }
 
+TEST(color_table, colors)
+{
+   std::string filename(std::string(SCWX_TEST_DATA_DIR) +
+                        "/colors/reflectivity.pal");
+
+   std::shared_ptr<ColorTable> ct = ColorTable::Load(filename);
+
+   // Ascending values are swept once, descending values are searched
+   // individually, and both match the color of each value
+   for (float scale : {2.0f, -2.0f})
+   {
+      std::vector<float> values {};
+      for (int i = 0; i < 256; ++i)
+      {
+         values.push_back((i - 66.0f) / scale);
+      }
+
+      std::vector<boost::gil::rgba8_pixel_t> colors(values.size());
+      ct->Colors(values, colors);
+
+      for (std::size_t i = 0; i < values.size(); ++i)
+      {
+         EXPECT_EQ(colors[i], ct->Color(values[i])) << "value: " << values[i];
+      }
+   }
+}
+
 } // namespace common
 } // namespace scwx
@@ -0,0 +1,38 @@
+#include <scwx/wxbench.hpp>
+#include <scwx/gr/placefile.hpp>
+#include <scwx/util/vectorbuf.hpp>
+
+#include <istream>
+
+namespace scwx
+{
+namespace gr
+{
+
+static void PlacefileLoad(benchmark::State& state, const std::string& file)
+{
+   std::vector<char> data = bench::ReadTestData("/gr/placefiles/" + file);
+   if (data.empty())
+   {
+      state.SkipWithError("Could not read test data");
+      return;
+   }
+
+   bench::RunDecoder(state,
+                     data.size(),
+                     [&]()
+                     {
+                        util::vectorbuf buf {data};
+                        buf.update_read_pointers(data.size());
+                        std::istream is {&buf};
+
+                        return Placefile::Load(file, is) != nullptr;
+                     });
+}
+
+BENCHMARK_CAPTURE(PlacefileLoad,
+                  OldExample,
+                  std::string {"placefile-old-example.txt"});
+
+} // namespace gr
+} // namespace scwx
@@ -1,5 +1,8 @@
 #include <scwx/gr/placefile.hpp>
 
+#include <filesystem>
+#include <sstream>
+
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -17,5 +20,87 @@ TEST(PlacefileTest, OldExample)
    EXPECT_EQ(true, true);
 }
 
+TEST(PlacefileTest, DrawItemHash)
+{
+   auto loadDrawItems = [](const std::string& text)
+   {
+      std::istringstream is {text};
+      return Placefile::Load("test", is)->GetDrawItems();
+   };
+
+   const std::string line1 {"Line: 2, 0, \"Line 1\"\n"
+                            " 38.0, -90.0\n"
+                            " 38.5, -90.5\n"
+                            "End:\n"};
+   const std::string line2 {"Line: 2, 0, \"Line 1\"\n"
+                            " 38.0, -90.0\n"
+                            " 38.5, -90.6\n"
+                            "End:\n"};
+
+   auto items1 = loadDrawItems(line1);
+   auto items2 = loadDrawItems(line1);
+   auto items3 = loadDrawItems(line2);
+
+   ASSERT_EQ(items1.size(), 1u);
+   ASSERT_EQ(items2.size(), 1u);
+   ASSERT_EQ(items3.size(), 1u);
+
+   EXPECT_EQ(Placefile::GetDrawItemHash(*items1[0]),
+             Placefile::GetDrawItemHash(*items2[0]));
+   EXPECT_NE(Placefile::GetDrawItemHash(*items1[0]),
+             Placefile::GetDrawItemHash(*items3[0]));
+}
+
+TEST(PlacefileTest, Compiled)
+{
+   const std::string text {"Title: Compiled\n"
+                           "Refresh: 2\n"
+                           "Font: 1, 12, 1, \"Arial\"\n"
+                           "IconFile: 1, 20, 20, 10, 10, \"icons.png\"\n"
+                           "Icon: 38.0, -90.0, 45, 1, 2, \"Icon\"\n"
+                           "Text: 38.1, -90.1, 1, \"Text\"\n"
+                           "Line: 2, 0, \"Line 1\"\n"
+                           " 38.0, -90.0\n"
+                           " 38.5, -90.5\n"
+                           "End:\n"
+                           "Polygon:\n"
+                           " 38.0, -90.0, 255, 0, 0, 255\n"
+                           " 38.5, -90.0\n"
+                           " 38.5, -90.5\n"
+                           "End:\n"};
+
+   std::istringstream is {text};
+   auto               placefile = Placefile::Load("test", is);
+
+   const std::string filename =
+      (std::filesystem::temp_directory_path() / "scwx-placefile-test.plc")
+         .string();
+
+   ASSERT_TRUE(placefile->SaveCompiled(filename, 1u));
+
+   auto compiled = Placefile::LoadCompiled("test", filename, 1u);
+   auto outdated = Placefile::LoadCompiled("test", filename, 2u);
+
+   std::filesystem::remove(filename);
+
+   ASSERT_NE(compiled, nullptr);
+   EXPECT_EQ(outdated, nullptr);
+
+   EXPECT_EQ(compiled->title(), placefile->title());
+   EXPECT_EQ(compiled->refresh(), placefile->refresh());
+   EXPECT_EQ(compiled->icon_files().size(), placefile->icon_files().size());
+   EXPECT_EQ(compiled->fonts().size(), placefile->fonts().size());
+
+   auto items         = placefile->GetDrawItems();
+   auto compiledItems = compiled->GetDrawItems();
+
+   ASSERT_EQ(compiledItems.size(), items.size());
+   for (std::size_t i = 0; i < items.size(); ++i)
+   {
+      EXPECT_EQ(Placefile::GetDrawItemHash(*compiledItems[i]),
+                Placefile::GetDrawItemHash(*items[i]));
+   }
+}
+
 } // namespace gr
 } // namespace scwx
@@ -36,5 +36,113 @@ TEST(DirList, GetAlternateUrl)
    EXPECT_GT(records.size(), 0);
 }
 
+TEST(DirList, GetNotModified)
+{
+   cpr::Validators validators {};
+
+   auto records = DirList(kDefaultUrl, validators);
+
+   // No records or validators, skip test
+   if (!records.has_value() || records->size() == 0 ||
+       (validators.eTag_.empty() && validators.lastModified_.empty()))
+   {
+      GTEST_SKIP();
+   }
+
+   // An immediate second listing is unlikely to have been modified
+   auto unmodifiedRecords = DirList(kDefaultUrl, validators);
+
+   if (unmodifiedRecords.has_value())
+   {
+      // Modified in the meantime, or the server ignores validators
+      GTEST_SKIP();
+   }
+
+   EXPECT_FALSE(unmodifiedRecords.has_value());
+}
+
+TEST(DirList, ParsePreformatted)
+{
+   static const std::string kHtml {
+      "<html><body><h1>Index of /</h1><pre>"
+      "<img src=\"/icons/blank.gif\" alt=\"Icon \"> "
+      "<a href=\"?C=N;O=D\">Name</a> "
+      "<a href=\"?C=M;O=A\">Last modified</a> "
+      "<a href=\"?C=S;O=A\">Size</a><hr>"
+      "<img src=\"/icons/folder.gif\" alt=\"[DIR]\"> "
+      "<a href=\"archive/\">archive/</a>  2024-05-01 12:00    -   \n"
+      "<img src=\"/icons/text.gif\" alt=\"[TXT]\"> "
+      "<a href=\"warnings_20240501_12.txt\">warnings_20240501_12.txt</a>"
+      "  2024-05-01 12:59  1.5K  \n"
+      "<img src=\"/icons/text.gif\" alt=\"[TXT]\"> "
+      "<a href=\"warnings_20240501_13.txt\">warnings_20240501_13.txt</a>"
+      "  2024-05-01 13:30  512  \n"
+      "<hr></pre></body></html>"};
+
+   using namespace std::chrono_literals;
+   const auto kDate = std::chrono::sys_days {std::chrono::year {2024} /
+                                             std::chrono::May / 1};
+
+   auto records = ParseDirList(kHtml);
+
+   ASSERT_EQ(records.size(), 3);
+
+   EXPECT_EQ(records[0].filename_, "archive");
+   EXPECT_EQ(records[0].type_, std::filesystem::file_type::directory);
+   EXPECT_EQ(records[0].mtime_, kDate + 12h);
+
+   EXPECT_EQ(records[1].filename_, "warnings_20240501_12.txt");
+   EXPECT_EQ(records[1].type_, std::filesystem::file_type::regular);
+   EXPECT_EQ(records[1].mtime_, kDate + 12h + 59min);
+   EXPECT_EQ(records[1].size_, 1536u);
+
+   EXPECT_EQ(records[2].filename_, "warnings_20240501_13.txt");
+   EXPECT_EQ(records[2].mtime_, kDate + 13h + 30min);
+   EXPECT_EQ(records[2].size_, 512u);
+}
+
+TEST(DirList, ParseTable)
+{
+   static const std::string kHtml {
+      "<table><tr><th><a href=\"?C=N;O=D\">Name</a></th></tr>\n"
+      "<tr><td valign=\"top\"><a href=\"warnings_20240501_12.txt\">"
+      "<img src=\"/icons/text.gif\" alt=\"[TXT]\"></a></td>"
+      "<td><a href=\"warnings_20240501_12.txt\">warnings_20240501_12.txt"
+      "</a></td><td align=\"right\">2024-05-01 12:59  </td>"
+      "<td align=\"right\">2.0M</td><td>&nbsp;</td></tr>\n"
+      "<!-- <a href=\"hidden.txt\">hidden.txt</a> -->\n"
+      "<tr><td><A HREF='sub/'>sub/</A></td>"
+      "<td align=\"right\">2024-05-02 01:02  </td>"
+      "<td align=\"right\">  - </td></tr></table>"};
+
+   auto records = ParseDirList(kHtml);
+
+   ASSERT_EQ(records.size(), 2);
+
+   EXPECT_EQ(records[0].filename_, "warnings_20240501_12.txt");
+   EXPECT_EQ(records[0].size_, 2u * 1024u * 1024u);
+
+   EXPECT_EQ(records[1].filename_, "sub");
+   EXPECT_EQ(records[1].type_, std::filesystem::file_type::directory);
+}
+
+TEST(DirList, ParseFiltered)
+{
+   static const std::string kHtml {
+      "<pre><a href=\"warnings_20240501_12.txt\">12</a>"
+      "  2024-05-01 12:59  1.5K\n"
+      "<a href=\"warnings_20240501_13.txt\">13</a>  2024-05-01 13:30  512\n"
+      "</pre>"};
+
+   auto records =
+      ParseDirList(kHtml,
+                   [](std::string_view filename)
+                   { return filename == "warnings_20240501_13.txt"; });
+
+   ASSERT_EQ(records.size(), 1);
+   EXPECT_EQ(records[0].filename_, "warnings_20240501_13.txt");
+   EXPECT_EQ(records[0].size_, 512u);
+}
+
 } // namespace network
 } // namespace scwx
@@ -1,5 +1,7 @@
 #include <scwx/provider/aws_level2_data_provider.hpp>
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -23,6 +25,72 @@ TEST(AwsLevel2DataProvider, FindKeyFixed)
    EXPECT_EQ(key, "2021/05/27/KLSX/KLSX20210527_175717_V06");
 }
 
+TEST(AwsLevel2DataProvider, FailOverMirror)
+{
+   using namespace std::chrono;
+   using sys_days = time_point<system_clock, days>;
+
+   const auto date = sys_days {2021y / May / 27d};
+   const auto time = date + 17h + 59min;
+
+   const std::vector<AwsNexradDataProvider::Endpoint> mirrors {
+      {"noaa-nexrad-level2", "us-east-1", "http://127.0.0.1:1"}};
+
+   AwsLevel2DataProvider provider("KLSX", mirrors);
+
+   // The second listing is first attempted on the unmeasured, unreachable
+   // mirror, and fails over to the default bucket
+   provider.ListObjects(date);
+   auto [success, newObjects, totalObjects] = provider.ListObjects(date);
+
+   EXPECT_TRUE(success);
+   EXPECT_GT(totalObjects, 0);
+   EXPECT_EQ(provider.FindKey(time),
+             "2021/05/27/KLSX/KLSX20210527_175717_V06");
+}
+
+TEST(AwsLevel2DataProvider, GetTimePointsByDateRange)
+{
+   using namespace std::chrono;
+   using sys_days = time_point<system_clock, days>;
+
+   const auto firstDate = sys_days {2021y / May / 26d};
+   const auto lastDate  = sys_days {2021y / May / 28d};
+
+   AwsLevel2DataProvider provider("KLSX");
+
+   auto timePoints = provider.GetTimePointsByDateRange(firstDate, lastDate);
+
+   ASSERT_FALSE(timePoints.empty());
+   EXPECT_TRUE(std::is_sorted(timePoints.cbegin(), timePoints.cend()));
+   EXPECT_GE(timePoints.front(), firstDate);
+   EXPECT_LT(timePoints.back(), lastDate + days {1});
+
+   // Each date in the range has been listed
+   EXPECT_EQ(provider.FindKey(firstDate + days {1} + 17h + 59min),
+             "2021/05/27/KLSX/KLSX20210527_175717_V06");
+}
+
+TEST(AwsLevel2DataProvider, AddObject)
+{
+   const std::string key = "2022/04/21/KLSX/KLSX20220421_160055_V06";
+   const auto        lastModified = std::chrono::system_clock::now();
+
+   AwsLevel2DataProvider provider("KLSX");
+
+   EXPECT_TRUE(provider.AddObject(key, lastModified));
+   EXPECT_FALSE(provider.AddObject(key, lastModified));
+
+   // Objects of other radar sites and metadata objects are ignored
+   EXPECT_FALSE(
+      provider.AddObject("2022/04/21/KEAX/KEAX20220421_160055_V06", {}));
+   EXPECT_FALSE(
+      provider.AddObject("2022/04/21/KLSX/KLSX20220421_160055_V06_MDM", {}));
+
+   EXPECT_EQ(provider.FindLatestKey(), key);
+   EXPECT_EQ(provider.last_modified(), lastModified);
+}
+
 TEST(AwsLevel2DataProvider, FindKeyNow)
 {
    AwsLevel2DataProvider provider("KILX");
@@ -44,6 +112,27 @@ TEST(AwsLevel2DataProvider, LoadObjectByKey)
    EXPECT_NE(file, nullptr);
 }
 
+TEST(AwsLevel2DataProvider, LoadObjectByKeyRanged)
+{
+   const std::string key = "2022/04/21/KLSX/KLSX20220421_160055_V06";
+
+   AwsLevel2DataProvider provider("KLSX");
+
+   std::size_t rangesLoaded = 0;
+
+   auto file = provider.LoadObjectByKeyRanged(
+      key,
+      1024u * 1024u,
+      [&](const std::shared_ptr<wsr88d::NexradFile>& partialFile)
+      {
+         EXPECT_NE(partialFile, nullptr);
+         ++rangesLoaded;
+      });
+
+   EXPECT_NE(file, nullptr);
+   EXPECT_GT(rangesLoaded, 1u);
+}
+
 TEST(AwsLevel2DataProvider, Prune)
 {
    using namespace std::chrono;
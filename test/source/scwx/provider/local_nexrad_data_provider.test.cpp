@@ -0,0 +1,94 @@
+#include <scwx/provider/local_nexrad_data_provider.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+class LocalNexradDataProviderTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      path_ = std::filesystem::temp_directory_path() / "scwx-local-data-test";
+      std::filesystem::remove_all(path_);
+      std::filesystem::create_directories(path_ / "KLSX");
+      std::filesystem::create_directories(path_ / "level3");
+   }
+
+   void TearDown() override { std::filesystem::remove_all(path_); }
+
+   void CreateFile(const std::string& key)
+   {
+      std::ofstream os {path_ / key};
+      os << "data";
+   }
+
+   std::filesystem::path path_ {};
+};
+
+TEST_F(LocalNexradDataProviderTest, Level2ListObjects)
+{
+   using namespace std::chrono;
+   using sys_days = time_point<system_clock, days>;
+
+   CreateFile("KLSX/KLSX20210527_175717_V06");
+   CreateFile("KLSX/KLSX20210527_180535_V06");
+   CreateFile("KLSX/KLSX20210527_180535_V06_MDM");
+   CreateFile("KLSX/KLSX20210528_000219_V06");
+   CreateFile("KLSX/KEAX20210527_175717_V06");
+
+   LocalNexradDataProvider provider(path_.string(), "KLSX");
+
+   const auto date = sys_days {2021y / May / 27d};
+
+   auto [success, newObjects, totalObjects] = provider.ListObjects(date);
+
+   EXPECT_TRUE(success);
+   EXPECT_EQ(newObjects, 2u);
+   EXPECT_EQ(totalObjects, 2u);
+
+   EXPECT_EQ(provider.FindKey(date + 18h), "KLSX/KLSX20210527_175717_V06");
+   EXPECT_EQ(provider.FindLatestKey(), "KLSX/KLSX20210527_180535_V06");
+   EXPECT_EQ(provider.GetTimePointByKey("KLSX/KLSX20210527_180535_V06"),
+             date + 18h + 5min + 35s);
+
+   // The following date is listed on request
+   EXPECT_EQ(provider.GetTimePointsByDate(date + days {1}).size(), 1u);
+   EXPECT_EQ(provider.cache_size(), 3u);
+}
+
+TEST_F(LocalNexradDataProviderTest, Level3AddObject)
+{
+   using namespace std::chrono;
+
+   CreateFile("level3/LSX_N0B_2021_05_27_17_59_00");
+   CreateFile("level3/LSX_N0Q_2021_05_27_17_59_00");
+
+   LocalNexradDataProvider provider(path_.string(), "KLSX", "N0B");
+
+   EXPECT_TRUE(provider.AddObject("level3/LSX_N0B_2021_05_27_17_59_00",
+                                  system_clock::now()));
+   EXPECT_FALSE(provider.AddObject("level3/LSX_N0B_2021_05_27_17_59_00",
+                                   system_clock::now()));
+
+   // Objects of other products and files which do not exist are ignored
+   EXPECT_FALSE(provider.AddObject("level3/LSX_N0Q_2021_05_27_17_59_00",
+                                   system_clock::now()));
+   EXPECT_FALSE(provider.AddObject("level3/LSX_N0B_2021_05_27_18_05_00",
+                                   system_clock::now()));
+
+   EXPECT_EQ(provider.FindLatestKey(), "level3/LSX_N0B_2021_05_27_17_59_00");
+
+   provider.RequestAvailableProducts();
+   EXPECT_EQ(provider.GetAvailableProducts(),
+             (std::vector<std::string> {"N0B", "N0Q"}));
+}
+
+} // namespace provider
+} // namespace scwx
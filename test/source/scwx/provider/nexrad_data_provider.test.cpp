@@ -0,0 +1,199 @@
+#include <scwx/provider/nexrad_data_provider.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+
+#include <fmt/chrono.h>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+class TestNexradFile : public wsr88d::NexradFile
+{
+public:
+   std::size_t data_size() const override { return 0; }
+
+   bool LoadFile(const std::string&) override { return true; }
+   bool LoadData(std::istream&) override { return true; }
+};
+
+class TestNexradDataProvider : public NexradDataProvider
+{
+public:
+   explicit TestNexradDataProvider(
+      std::vector<std::chrono::system_clock::time_point> timePoints) :
+       timePoints_ {std::move(timePoints)}
+   {
+   }
+
+   size_t cache_size() const override { return timePoints_.size(); }
+
+   std::chrono::system_clock::time_point last_modified() const override
+   {
+      return {};
+   }
+   std::chrono::seconds update_period() const override { return {}; }
+
+   std::string FindKey(std::chrono::system_clock::time_point time) override
+   {
+      return fmt::format("{:%Y%m%d_%H%M%S}", time);
+   }
+   std::string FindLatestKey() override { return {}; }
+
+   std::tuple<bool, size_t, size_t>
+   ListObjects(std::chrono::system_clock::time_point) override
+   {
+      return {true, 0, 0};
+   }
+
+   std::shared_ptr<wsr88d::NexradFile>
+   LoadObjectByKey(const std::string& key) override
+   {
+      ++loadCount_;
+
+      return (!key.empty()) ? std::make_shared<TestNexradFile>() : nullptr;
+   }
+
+   std::pair<size_t, size_t> Refresh() override { return {0, 0}; }
+
+   std::chrono::system_clock::time_point
+   GetTimePointByKey(const std::string&) const override
+   {
+      return {};
+   }
+
+   std::vector<std::chrono::system_clock::time_point>
+   GetTimePointsByDate(std::chrono::system_clock::time_point date) override
+   {
+      std::vector<std::chrono::system_clock::time_point> timePoints {};
+
+      std::copy_if(timePoints_.cbegin(),
+                   timePoints_.cend(),
+                   std::back_inserter(timePoints),
+                   [&](const auto& time)
+                   {
+                      return std::chrono::floor<std::chrono::days>(time) ==
+                             std::chrono::floor<std::chrono::days>(date);
+                   });
+
+      ++listCount_;
+
+      return timePoints;
+   }
+
+   std::atomic<std::size_t> listCount_ {0};
+   std::atomic<std::size_t> loadCount_ {0};
+
+private:
+   std::vector<std::chrono::system_clock::time_point> timePoints_;
+};
+
+TEST(NexradDataProvider, PrefetchTimeRange)
+{
+   using namespace std::chrono;
+   using sys_days = time_point<system_clock, days>;
+
+   const auto date = sys_days {2021y / May / 27d};
+
+   // Time points spanning midnight on two products
+   auto provider1 = std::make_shared<TestNexradDataProvider>(
+      std::vector<system_clock::time_point> {date - 10min,
+                                             date + 23h + 50min,
+                                             date + 23h + 55min,
+                                             date + days {1} + 5min});
+   auto provider2 = std::make_shared<TestNexradDataProvider>(
+      std::vector<system_clock::time_point> {date + 23h + 52min,
+                                             date + days {1} + 2min,
+                                             date + days {1} + 2h});
+
+   std::mutex                                           resultsMutex {};
+   std::map<NexradDataProvider*, std::set<std::string>> results {};
+
+   const std::size_t loadedCount = NexradDataProvider::Prefetch(
+      {provider1, provider2},
+      date + 23h + 45min,
+      date + days {1} + 1h,
+      [&](const std::shared_ptr<NexradDataProvider>& provider,
+          const std::string&                         key,
+          system_clock::time_point,
+          std::shared_ptr<wsr88d::NexradFile> nexradFile)
+      {
+         EXPECT_NE(nexradFile, nullptr);
+
+         std::unique_lock lock {resultsMutex};
+         results[provider.get()].insert(key);
+      },
+      4);
+
+   EXPECT_EQ(loadedCount, 5u);
+
+   // Each provider lists each date in the range
+   EXPECT_EQ(provider1->listCount_, 2u);
+   EXPECT_EQ(provider2->listCount_, 2u);
+
+   // Only objects within the time range are loaded
+   EXPECT_EQ(provider1->loadCount_, 3u);
+   EXPECT_EQ(provider2->loadCount_, 2u);
+
+   EXPECT_EQ(results[provider1.get()],
+             (std::set<std::string> {
+                "20210527_235000", "20210527_235500", "20210528_000500"}));
+   EXPECT_EQ(results[provider2.get()],
+             (std::set<std::string> {"20210527_235200", "20210528_000200"}));
+}
+
+TEST(NexradDataProvider, PrefetchFilter)
+{
+   using namespace std::chrono;
+
+   const auto date = sys_days {2021y / May / 27d};
+
+   auto provider = std::make_shared<TestNexradDataProvider>(
+      std::vector<system_clock::time_point> {
+         date + 1h, date + 2h, date + 3h, date + 4h});
+
+   std::atomic<std::size_t> callbackCount {0u};
+
+   // Objects rejected by the filter are neither loaded nor reported
+   const std::size_t loadedCount = NexradDataProvider::Prefetch(
+      {provider},
+      date,
+      date + 5h,
+      [&](const std::shared_ptr<NexradDataProvider>&,
+          const std::string&,
+          system_clock::time_point time,
+          std::shared_ptr<wsr88d::NexradFile>)
+      {
+         EXPECT_NE(time, date + 2h);
+         ++callbackCount;
+      },
+      4,
+      [&](const std::shared_ptr<NexradDataProvider>&,
+          system_clock::time_point time) { return time != date + 2h; });
+
+   EXPECT_EQ(loadedCount, 3u);
+   EXPECT_EQ(callbackCount, 3u);
+   EXPECT_EQ(provider->loadCount_, 3u);
+}
+
+TEST(NexradDataProvider, PrefetchEmptyRange)
+{
+   using namespace std::chrono;
+
+   auto provider = std::make_shared<TestNexradDataProvider>(
+      std::vector<system_clock::time_point> {});
+
+   const auto now = system_clock::now();
+
+   EXPECT_EQ(NexradDataProvider::Prefetch({provider}, now, now - 1h, nullptr),
+             0u);
+   EXPECT_EQ(provider->listCount_, 0u);
+}
+
+} // namespace provider
+} // namespace scwx
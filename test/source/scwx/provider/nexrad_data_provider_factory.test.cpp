@@ -0,0 +1,35 @@
+#include <scwx/provider/nexrad_data_provider_factory.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+TEST(NexradDataProviderFactory, ParseMirrors)
+{
+   auto mirrors = NexradDataProviderFactory::ParseMirrors(
+      "unidata-nexrad-level2:us-east-1, "
+      "nexrad-mirror:local:http://localhost:9000\n"
+      "missing-region invalid: :us-east-1");
+
+   ASSERT_EQ(mirrors.size(), 2u);
+
+   EXPECT_EQ(mirrors[0].bucketName_, "unidata-nexrad-level2");
+   EXPECT_EQ(mirrors[0].region_, "us-east-1");
+   EXPECT_EQ(mirrors[0].endpointOverride_, "");
+
+   EXPECT_EQ(mirrors[1].bucketName_, "nexrad-mirror");
+   EXPECT_EQ(mirrors[1].region_, "local");
+   EXPECT_EQ(mirrors[1].endpointOverride_, "http://localhost:9000");
+}
+
+TEST(NexradDataProviderFactory, ParseMirrorsEmpty)
+{
+   EXPECT_TRUE(NexradDataProviderFactory::ParseMirrors("").empty());
+   EXPECT_TRUE(NexradDataProviderFactory::ParseMirrors(" ,\n").empty());
+}
+
+} // namespace provider
+} // namespace scwx
@@ -0,0 +1,99 @@
+#include <scwx/provider/object_cache.hpp>
+
+#include <chrono>
+#include <filesystem>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+class ObjectCacheTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      path_ = std::filesystem::temp_directory_path() / "scwx-object-cache-test";
+      std::filesystem::remove_all(path_);
+   }
+
+   void TearDown() override { std::filesystem::remove_all(path_); }
+
+   std::filesystem::path path_ {};
+};
+
+TEST_F(ObjectCacheTest, PutGet)
+{
+   ObjectCache cache {};
+
+   const std::vector<char> data {'a', 'b', 'c', 'd'};
+
+   // Disabled until a path is set
+   cache.SetMaxSize(1024u);
+   cache.Put("bucket/key", "\"etag\"", data);
+   EXPECT_FALSE(cache.enabled());
+   EXPECT_FALSE(cache.Get("bucket/key").has_value());
+
+   cache.SetPath(path_.string());
+   EXPECT_TRUE(cache.enabled());
+
+   cache.Put("bucket/key", "\"etag\"", data);
+   EXPECT_TRUE(cache.Contains("bucket/key"));
+
+   auto object = cache.Get("bucket/key");
+   ASSERT_TRUE(object.has_value());
+   EXPECT_EQ(object->eTag_, "\"etag\"");
+   ASSERT_NE(object->data_, nullptr);
+   EXPECT_EQ(*object->data_, data);
+
+   EXPECT_FALSE(cache.Get("bucket/other").has_value());
+
+   cache.Remove("bucket/key");
+   EXPECT_FALSE(cache.Contains("bucket/key"));
+   EXPECT_FALSE(cache.Get("bucket/key").has_value());
+}
+
+TEST_F(ObjectCacheTest, EvictsLeastRecentlyUsed)
+{
+   ObjectCache cache {};
+
+   const std::vector<char> data(400u, 'x');
+
+   cache.SetPath(path_.string());
+   cache.SetMaxSize(1000u);
+
+   cache.Put("key1", "1", data);
+   cache.Put("key2", "2", data);
+
+   // Order last use explicitly, as the file time resolution may be coarse
+   const auto lastUsed = std::filesystem::file_time_type::clock::now() -
+                         std::chrono::hours {1};
+   for (const auto& entry : std::filesystem::directory_iterator(path_))
+   {
+      std::filesystem::last_write_time(entry.path(), lastUsed);
+   }
+   ASSERT_TRUE(cache.Get("key1").has_value());
+
+   // Adding a third object exceeds the maximum size
+   cache.Put("key3", "3", data);
+
+   EXPECT_TRUE(cache.Get("key1").has_value());
+   EXPECT_FALSE(cache.Get("key2").has_value());
+   EXPECT_TRUE(cache.Get("key3").has_value());
+
+   // Reducing the maximum size evicts objects immediately
+   cache.SetMaxSize(500u);
+
+   std::size_t objectCount = 0u;
+   for (const auto& entry : std::filesystem::directory_iterator(path_))
+   {
+      (void) entry;
+      ++objectCount;
+   }
+   EXPECT_EQ(objectCount, 1u);
+}
+
+} // namespace provider
+} // namespace scwx
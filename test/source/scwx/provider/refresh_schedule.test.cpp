@@ -0,0 +1,52 @@
+#include <scwx/provider/refresh_schedule.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+using namespace std::chrono_literals;
+
+static constexpr std::chrono::seconds kFast_ {15};
+static constexpr std::chrono::seconds kSlow_ {120};
+
+TEST(RefreshScheduleTest, UnknownPeriod)
+{
+   const auto now = std::chrono::system_clock::now();
+
+   EXPECT_EQ(GetRefreshInterval({}, 300s, now, kFast_, kSlow_), kFast_);
+   EXPECT_EQ(GetRefreshInterval(now, 0s, now, kFast_, kSlow_), kFast_);
+}
+
+TEST(RefreshScheduleTest, WaitsForExpectedTime)
+{
+   const auto now = std::chrono::system_clock::now();
+
+   // The next object is expected in 4 minutes
+   EXPECT_EQ(GetRefreshInterval(now - 60s, 300s, now, kFast_, kSlow_), 240s);
+
+   // The next object is expected sooner than the fast interval
+   EXPECT_EQ(GetRefreshInterval(now - 295s, 300s, now, kFast_, kSlow_),
+             kFast_);
+}
+
+TEST(RefreshScheduleTest, BacksOffWhenOverdue)
+{
+   const auto now = std::chrono::system_clock::now();
+
+   // Overdue by less than one period
+   EXPECT_EQ(GetRefreshInterval(now - 400s, 300s, now, kFast_, kSlow_),
+             kFast_);
+
+   // Overdue by one and two periods
+   EXPECT_EQ(GetRefreshInterval(now - 700s, 300s, now, kFast_, kSlow_), 30s);
+   EXPECT_EQ(GetRefreshInterval(now - 1000s, 300s, now, kFast_, kSlow_), 60s);
+
+   // Overdue by many periods
+   EXPECT_EQ(GetRefreshInterval(now - 3h, 300s, now, kFast_, kSlow_), kSlow_);
+}
+
+} // namespace provider
+} // namespace scwx
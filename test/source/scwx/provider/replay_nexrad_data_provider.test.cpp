@@ -0,0 +1,89 @@
+#include <scwx/provider/replay_nexrad_data_provider.hpp>
+#include <scwx/provider/local_nexrad_data_provider.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+class ReplayNexradDataProviderTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      path_ = std::filesystem::temp_directory_path() / "scwx-replay-data-test";
+      std::filesystem::remove_all(path_);
+      std::filesystem::create_directories(path_ / "KLSX");
+   }
+
+   void TearDown() override { std::filesystem::remove_all(path_); }
+
+   void CreateFile(const std::string& key)
+   {
+      std::ofstream os {path_ / key};
+      os << "data";
+   }
+
+   std::filesystem::path path_ {};
+};
+
+TEST(ReplayClockTest, Speed)
+{
+   using namespace std::chrono;
+   using sys_days = time_point<system_clock, days>;
+
+   const system_clock::time_point start = sys_days {2021y / May / 27d} + 18h;
+   const system_clock::time_point wallStart {hours {1000}};
+
+   // Replay 6 hours in 10 minutes
+   ReplayClock clock {start, 36.0, wallStart};
+
+   EXPECT_EQ(clock.now(wallStart), start);
+   EXPECT_EQ(clock.now(wallStart + 10min), start + 6h);
+   EXPECT_EQ(clock.GetWallTime(start + 3h), wallStart + 5min);
+   EXPECT_EQ(clock.GetWallDuration(6h), 10min);
+}
+
+TEST_F(ReplayNexradDataProviderTest, Refresh)
+{
+   using namespace std::chrono;
+   using sys_days = time_point<system_clock, days>;
+
+   CreateFile("KLSX/KLSX20210527_175717_V06");
+   CreateFile("KLSX/KLSX20210527_180535_V06");
+   CreateFile("KLSX/KLSX20210527_181353_V06");
+
+   const system_clock::time_point date = sys_days {2021y / May / 27d};
+
+   // Replay begins one minute after the second object, at 4x speed
+   const auto wallStart = system_clock::now();
+   auto       clock     = std::make_shared<ReplayClock>(
+      date + 18h + 6min + 35s, 4.0, wallStart);
+
+   ReplayNexradDataProvider provider(
+      std::make_shared<LocalNexradDataProvider>(path_.string(), "KLSX"),
+      clock);
+
+   auto [newObjects, totalObjects] = provider.Refresh();
+
+   EXPECT_EQ(newObjects, 2u);
+   EXPECT_EQ(totalObjects, 2u);
+   EXPECT_EQ(provider.cache_size(), 2u);
+   EXPECT_EQ(provider.FindLatestKey(), "KLSX/KLSX20210527_180535_V06");
+   EXPECT_EQ(provider.FindKey(date + 19h), "KLSX/KLSX20210527_180535_V06");
+
+   // Objects which have not been reached are not listed
+   EXPECT_EQ(provider.GetTimePointsByDate(date).size(), 2u);
+
+   // Timing is reported in wall-clock time
+   EXPECT_EQ(provider.last_modified(), wallStart - 15s);
+   EXPECT_EQ(provider.update_period(), 124s);
+}
+
+} // namespace provider
+} // namespace scwx
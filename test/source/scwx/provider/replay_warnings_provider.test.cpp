@@ -0,0 +1,76 @@
+#include <scwx/provider/replay_warnings_provider.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+class ReplayWarningsProviderTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      path_ =
+         std::filesystem::temp_directory_path() / "scwx-replay-warnings-test";
+      std::filesystem::remove_all(path_);
+      std::filesystem::create_directories(path_);
+   }
+
+   void TearDown() override { std::filesystem::remove_all(path_); }
+
+   void CreateFile(const std::string&              filename,
+                   const std::vector<std::string>& wmoHeaders)
+   {
+      std::ofstream os {path_ / filename, std::ios_base::binary};
+      for (auto& wmoHeader : wmoHeaders)
+      {
+         os << "\x01\r\r\n000 \r\r\n"
+            << wmoHeader << "\r\r\nSVRLSX\r\r\n\r\r\n\x03";
+      }
+   }
+
+   std::filesystem::path path_ {};
+};
+
+TEST_F(ReplayWarningsProviderTest, ListFiles)
+{
+   using namespace std::chrono;
+   using sys_days = time_point<system_clock, days>;
+
+   CreateFile("warnings_20210527_17.txt",
+              {"WUUS53 KLSX 271755", "WUUS53 KLSX 271805"});
+   CreateFile("warnings_20210527_18.txt", {"WUUS53 KLSX 271830"});
+
+   const system_clock::time_point date = sys_days {2021y / May / 27d};
+
+   // Replay from 1800 UTC, only the first product has been reached
+   ReplayWarningsProvider provider(
+      path_.string(), std::make_shared<ReplayClock>(date + 18h, 1.0));
+
+   auto [newFiles, totalFiles] = provider.ListFiles();
+   EXPECT_EQ(newFiles, 1u);
+   EXPECT_EQ(totalFiles, 2u);
+
+   // Loaded products are not counted again
+   provider.LoadUpdatedFiles();
+
+   std::tie(newFiles, totalFiles) = provider.ListFiles();
+   EXPECT_EQ(newFiles, 0u);
+   EXPECT_EQ(totalFiles, 2u);
+
+   // Replay from 1831 UTC, all products have been reached
+   ReplayWarningsProvider laterProvider(
+      path_.string(), std::make_shared<ReplayClock>(date + 18h + 31min, 1.0));
+
+   std::tie(newFiles, totalFiles) = laterProvider.ListFiles();
+   EXPECT_EQ(newFiles, 2u);
+   EXPECT_EQ(totalFiles, 2u);
+}
+
+} // namespace provider
+} // namespace scwx
@@ -55,13 +55,42 @@ TEST_P(WarningsProviderTest, LoadUpdatedFiles)
    // (assumption that the previous newest file was updated, and a new file was
    // created on the hour)
    EXPECT_LE(newObjects2, 2);
-   EXPECT_EQ(updatedFiles2.size(), newObjects2);
+
+   // Updated files are only returned if complete products have been appended
+   EXPECT_LE(updatedFiles2.size(), newObjects2);
 
    // The total number of objects may have changed, since the oldest file could
    // have dropped off the list
    EXPECT_GT(totalObjects2, 0);
 }
 
+TEST_P(WarningsProviderTest, RestoreLoadedSizes)
+{
+   WarningsProvider provider(GetParam());
+
+   auto [newObjects, totalObjects] = provider.ListFiles();
+   provider.LoadUpdatedFiles();
+
+   // No objects, skip test
+   if (totalObjects == 0)
+   {
+      GTEST_SKIP();
+   }
+
+   auto loadedSizes = provider.loaded_sizes();
+   EXPECT_GT(loadedSizes.size(), 0);
+
+   // A provider restored from the loaded sizes only loads files which have been
+   // updated since (see LoadUpdatedFiles)
+   WarningsProvider restoredProvider(GetParam());
+   restoredProvider.RestoreLoadedSizes(loadedSizes);
+
+   auto [newObjects2, totalObjects2] = restoredProvider.ListFiles();
+
+   EXPECT_LE(newObjects2, 2);
+   EXPECT_GT(totalObjects2, 0);
+}
+
 INSTANTIATE_TEST_SUITE_P(WarningsProvider,
                          WarningsProviderTest,
                          testing::Values(kDefaultUrl, kAlternateUrl));
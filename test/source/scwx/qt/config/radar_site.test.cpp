@@ -64,6 +64,19 @@ TEST_F(RadarSiteTest, FindNearest)
    EXPECT_EQ(nearest4->id(), "TSTL");
 }
 
+TEST_F(RadarSiteTest, FindNearby)
+{
+   ASSERT_GT(numSites_, 0);
+
+   auto nearby = RadarSite::FindNearby(38.627222, -90.197778, 4u); // St Louis
+
+   ASSERT_EQ(nearby.size(), 4u);
+   EXPECT_EQ(nearby[0]->id(), "TSTL");
+   EXPECT_EQ(nearby[1]->id(), "KLSX");
+
+   EXPECT_TRUE(RadarSite::FindNearby(38.627222, -90.197778, 0u).empty());
+}
+
 } // namespace config
 } // namespace qt
 } // namespace scwx
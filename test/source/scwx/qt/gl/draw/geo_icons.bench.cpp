@@ -0,0 +1,115 @@
+#include <scwx/qtbench.hpp>
+#include <scwx/qt/gl/draw/geo_icons.hpp>
+#include <scwx/qt/types/texture_types.hpp>
+#include <scwx/qt/util/texture_atlas.hpp>
+
+#include <cmath>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+namespace draw
+{
+
+// Each icon is drawn as a rectangle
+static constexpr std::size_t kVerticesPerIcon_ = 4u;
+
+static const std::string kIconSheet_ =
+   types::GetTextureName(types::ImageTexture::Dot3);
+
+static void AddIcons(GeoIcons&                                      geoIcons,
+                     std::vector<std::shared_ptr<GeoIconDrawItem>>& icons,
+                     std::size_t                                    count)
+{
+   // Icons are distributed on a grid around the center of the map
+   const std::size_t columns = static_cast<std::size_t>(std::sqrt(count)) + 1u;
+
+   icons.clear();
+
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      auto di = geoIcons.AddIcon();
+      geoIcons.SetIconTexture(di, kIconSheet_, 0);
+      geoIcons.SetIconLocation(di,
+                               38.0 + static_cast<double>(i / columns) * 0.01,
+                               -91.5 + static_cast<double>(i % columns) * 0.01);
+      icons.push_back(std::move(di));
+   }
+}
+
+static void InitializeIcons(GeoIcons& geoIcons)
+{
+   // Load the icon sheet into the texture atlas, and buffer the atlas
+   util::TextureAtlas::Instance().LoadTextures({kIconSheet_});
+   bench::GlContext()->GetTextureAtlas();
+
+   geoIcons.StartIconSheets();
+   geoIcons.AddIconSheet(kIconSheet_);
+   geoIcons.FinishIconSheets();
+   geoIcons.Initialize();
+}
+
+static void GeoIconsFinishIcons(benchmark::State& state)
+{
+   const std::size_t count  = static_cast<std::size_t>(state.range(0));
+   const auto        params = bench::RenderParameters();
+
+   GeoIcons geoIcons {bench::GlContext()};
+   InitializeIcons(geoIcons);
+
+   std::vector<std::shared_ptr<GeoIconDrawItem>> icons {};
+
+   // Each frame replaces every icon, as when a layer is rebuilt
+   bench::RunFrames(state,
+                    count * kVerticesPerIcon_,
+                    [&]()
+                    {
+                       geoIcons.StartIcons();
+                       AddIcons(geoIcons, icons, count);
+                       geoIcons.FinishIcons();
+                       geoIcons.Render(params, false);
+                    });
+
+   geoIcons.Deinitialize();
+}
+
+static void GeoIconsMoveIcon(benchmark::State& state)
+{
+   const std::size_t count  = static_cast<std::size_t>(state.range(0));
+   const auto        params = bench::RenderParameters();
+
+   GeoIcons geoIcons {bench::GlContext()};
+   InitializeIcons(geoIcons);
+
+   std::vector<std::shared_ptr<GeoIconDrawItem>> icons {};
+
+   geoIcons.StartIcons();
+   AddIcons(geoIcons, icons, count);
+   geoIcons.FinishIcons();
+
+   double offset = 0.0;
+
+   // Each frame moves a single icon, as when a location marker is updated
+   bench::RunFrames(state,
+                    count * kVerticesPerIcon_,
+                    [&]()
+                    {
+                       offset = (offset == 0.0) ? 0.001 : 0.0;
+                       geoIcons.SetIconLocation(
+                          icons.front(), 38.0 + offset, -91.5 + offset);
+                       geoIcons.Render(params, false);
+                    });
+
+   geoIcons.Deinitialize();
+}
+
+BENCHMARK(GeoIconsFinishIcons)->RangeMultiplier(10)->Range(100, 100000);
+BENCHMARK(GeoIconsMoveIcon)->RangeMultiplier(10)->Range(100, 100000);
+
+} // namespace draw
+} // namespace gl
+} // namespace qt
+} // namespace scwx
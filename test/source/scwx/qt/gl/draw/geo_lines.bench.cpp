@@ -0,0 +1,90 @@
+#include <scwx/qtbench.hpp>
+#include <scwx/qt/gl/draw/geo_lines.hpp>
+
+#include <cmath>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+namespace draw
+{
+
+// Each line is drawn as two triangles
+static constexpr std::size_t kVerticesPerLine_ = 6u;
+
+static void AddLines(GeoLines& geoLines, std::size_t count, float offset)
+{
+   // Lines are distributed on a grid around the center of the map
+   const std::size_t columns = static_cast<std::size_t>(std::sqrt(count)) + 1u;
+
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      const float latitude =
+         38.0f + static_cast<float>(i / columns) * 0.01f + offset;
+      const float longitude =
+         -91.5f + static_cast<float>(i % columns) * 0.01f + offset;
+
+      auto di = geoLines.AddLine();
+      geoLines.SetLineLocation(
+         di, latitude, longitude, latitude + 0.005f, longitude + 0.005f);
+      geoLines.SetLineModulate(di, boost::gil::rgba8_pixel_t {255, 0, 0, 255});
+      geoLines.SetLineWidth(di, 2.0f);
+   }
+}
+
+static void GeoLinesFinishLines(benchmark::State& state)
+{
+   const std::size_t count  = static_cast<std::size_t>(state.range(0));
+   const auto        params = bench::RenderParameters();
+
+   GeoLines geoLines {bench::GlContext()};
+   geoLines.Initialize();
+
+   float offset = 0.0f;
+
+   // Each frame replaces every line, as when a layer is rebuilt
+   bench::RunFrames(state,
+                    count * kVerticesPerLine_,
+                    [&]()
+                    {
+                       geoLines.StartLines();
+                       AddLines(geoLines, count, offset);
+                       geoLines.FinishLines();
+                       geoLines.Render(params);
+
+                       offset = (offset == 0.0f) ? 0.001f : 0.0f;
+                    });
+
+   geoLines.Deinitialize();
+}
+
+static void GeoLinesRender(benchmark::State& state)
+{
+   const std::size_t count  = static_cast<std::size_t>(state.range(0));
+   const auto        params = bench::RenderParameters();
+
+   GeoLines geoLines {bench::GlContext()};
+   geoLines.Initialize();
+
+   geoLines.StartLines();
+   AddLines(geoLines, count, 0.0f);
+   geoLines.FinishLines();
+
+   // Each frame renders unchanged lines
+   bench::RunFrames(state,
+                    count * kVerticesPerLine_,
+                    [&]() { geoLines.Render(params); });
+
+   geoLines.Deinitialize();
+}
+
+BENCHMARK(GeoLinesFinishLines)->RangeMultiplier(10)->Range(100, 100000);
+BENCHMARK(GeoLinesRender)->RangeMultiplier(10)->Range(100, 100000);
+
+} // namespace draw
+} // namespace gl
+} // namespace qt
+} // namespace scwx
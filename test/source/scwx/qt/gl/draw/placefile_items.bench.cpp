@@ -0,0 +1,169 @@
+#include <scwx/qtbench.hpp>
+#include <scwx/qt/gl/draw/placefile_lines.hpp>
+#include <scwx/qt/gl/draw/placefile_polygons.hpp>
+#include <scwx/qt/gl/draw/placefile_triangles.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/gr/placefile.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+namespace draw
+{
+
+static void AddDrawItems(
+   PlacefileLines&                                              lines,
+   PlacefilePolygons&                                           polygons,
+   PlacefileTriangles&                                          triangles,
+   const std::vector<std::shared_ptr<gr::Placefile::DrawItem>>& drawItems)
+{
+   lines.StartLines();
+   polygons.StartPolygons();
+   triangles.StartTriangles();
+
+   for (auto& drawItem : drawItems)
+   {
+      switch (drawItem->itemType_)
+      {
+      case gr::Placefile::ItemType::Line:
+         lines.AddLine(
+            std::static_pointer_cast<gr::Placefile::LineDrawItem>(drawItem));
+         break;
+
+      case gr::Placefile::ItemType::Polygon:
+         polygons.AddPolygon(
+            std::static_pointer_cast<gr::Placefile::PolygonDrawItem>(
+               drawItem));
+         break;
+
+      case gr::Placefile::ItemType::Triangles:
+         triangles.AddTriangles(
+            std::static_pointer_cast<gr::Placefile::TrianglesDrawItem>(
+               drawItem));
+         break;
+
+      default:
+         break;
+      }
+   }
+
+   lines.FinishLines();
+   polygons.FinishPolygons();
+   triangles.FinishTriangles();
+}
+
+// Placefile icons, images and text depend on resources referenced by the
+// placefile, and are not measured. Placefile items buffer their vertices
+// directly, so only the number of items is reported.
+static void PlacefileItemsFinish(benchmark::State& state,
+                                 const std::string& file)
+{
+   auto placefile = gr::Placefile::Load(std::string(SCWX_TEST_DATA_DIR) +
+                                        "/gr/placefiles/" + file);
+   if (placefile == nullptr)
+   {
+      state.SkipWithError("Could not load test data");
+      return;
+   }
+
+   const auto params    = bench::RenderParameters();
+   const auto drawItems = placefile->GetDrawItems();
+
+   PlacefileLines     placefileLines {bench::GlContext()};
+   PlacefilePolygons  placefilePolygons {bench::GlContext()};
+   PlacefileTriangles placefileTriangles {bench::GlContext()};
+
+   placefileLines.Initialize();
+   placefilePolygons.Initialize();
+   placefileTriangles.Initialize();
+
+   // Each frame replaces every item, as when a placefile is refreshed
+   for (auto _ : state)
+   {
+      AddDrawItems(
+         placefileLines, placefilePolygons, placefileTriangles, drawItems);
+
+      placefileLines.Render(params);
+      placefilePolygons.Render(params);
+      placefileTriangles.Render(params);
+
+      bench::FinishFrame();
+   }
+
+   state.counters["items"] = static_cast<double>(drawItems.size());
+
+   placefileLines.Deinitialize();
+   placefilePolygons.Deinitialize();
+   placefileTriangles.Deinitialize();
+}
+
+// Renders unchanged placefile items, with thresholded and timed primitives
+// hidden by the vertex shaders alone (0), or also filtered on the CPU (1)
+static void PlacefileItemsRender(benchmark::State& state,
+                                 const std::string& file)
+{
+   auto placefile = gr::Placefile::Load(std::string(SCWX_TEST_DATA_DIR) +
+                                        "/gr/placefiles/" + file);
+   if (placefile == nullptr)
+   {
+      state.SkipWithError("Could not load test data");
+      return;
+   }
+
+   auto& cpuPrimitiveFiltering =
+      settings::GeneralSettings::Instance().cpu_primitive_filtering();
+   cpuPrimitiveFiltering.SetValue(state.range(0) != 0);
+
+   const auto params    = bench::RenderParameters();
+   const auto drawItems = placefile->GetDrawItems();
+
+   PlacefileLines     placefileLines {bench::GlContext()};
+   PlacefilePolygons  placefilePolygons {bench::GlContext()};
+   PlacefileTriangles placefileTriangles {bench::GlContext()};
+
+   placefileLines.Initialize();
+   placefilePolygons.Initialize();
+   placefileTriangles.Initialize();
+
+   placefileLines.set_thresholded(true);
+   placefilePolygons.set_thresholded(true);
+   placefileTriangles.set_thresholded(true);
+
+   AddDrawItems(
+      placefileLines, placefilePolygons, placefileTriangles, drawItems);
+
+   for (auto _ : state)
+   {
+      placefileLines.Render(params);
+      placefilePolygons.Render(params);
+      placefileTriangles.Render(params);
+
+      bench::FinishFrame();
+   }
+
+   state.counters["items"] = static_cast<double>(drawItems.size());
+
+   placefileLines.Deinitialize();
+   placefilePolygons.Deinitialize();
+   placefileTriangles.Deinitialize();
+
+   cpuPrimitiveFiltering.SetValueToDefault();
+}
+
+BENCHMARK_CAPTURE(PlacefileItemsFinish,
+                  OldExample,
+                  std::string {"placefile-old-example.txt"});
+BENCHMARK_CAPTURE(PlacefileItemsRender,
+                  OldExample,
+                  std::string {"placefile-old-example.txt"})
+   ->ArgName("cpuFiltering")
+   ->Arg(0)
+   ->Arg(1);
+
+} // namespace draw
+} // namespace gl
+} // namespace qt
+} // namespace scwx
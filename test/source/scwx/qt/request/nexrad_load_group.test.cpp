@@ -0,0 +1,57 @@
+#include <scwx/qt/request/nexrad_load_group.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace request
+{
+
+TEST(NexradLoadGroupTest, NextGenerationCancelsOutstandingRequests)
+{
+   NexradLoadGroup loadGroup {};
+
+   auto request1 = std::make_shared<NexradFileRequest>();
+   loadGroup.Add(request1);
+
+   loadGroup.NextGeneration();
+
+   auto request2 = std::make_shared<NexradFileRequest>();
+   loadGroup.Add(request2);
+
+   EXPECT_TRUE(request1->is_cancelled());
+   EXPECT_FALSE(request2->is_cancelled());
+}
+
+TEST(NexradLoadGroupTest, DestructionCancelsOutstandingRequests)
+{
+   auto request = std::make_shared<NexradFileRequest>();
+
+   {
+      NexradLoadGroup loadGroup {};
+      loadGroup.Add(request);
+   }
+
+   EXPECT_TRUE(request->is_cancelled());
+}
+
+TEST(NexradLoadGroupTest, RequestsAreNotRetained)
+{
+   NexradLoadGroup loadGroup {};
+
+   auto request = std::make_shared<NexradFileRequest>();
+   std::weak_ptr<NexradFileRequest> weakRequest {request};
+   loadGroup.Add(request);
+
+   request.reset();
+
+   EXPECT_TRUE(weakRequest.expired());
+
+   loadGroup.CancelAll();
+}
+
+} // namespace request
+} // namespace qt
+} // namespace scwx
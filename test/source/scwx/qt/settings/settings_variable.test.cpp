@@ -103,6 +103,40 @@ TEST(SettingsVariableTest, String)
    EXPECT_EQ(stringVariable.GetValue(), "Value 2");
 }
 
+TEST(SettingsVariableTest, Snapshot)
+{
+   SettingsVariable<std::string> stringVariable {"string"};
+   stringVariable.SetValue("Value 1");
+
+   auto          snapshot = stringVariable.GetSnapshot();
+   std::uint64_t version  = stringVariable.version();
+
+   // A rejected value does not change the version
+   stringVariable.SetValidator([](const std::string& value)
+                               { return !value.empty(); });
+   EXPECT_EQ(stringVariable.SetValue(""), false);
+   EXPECT_EQ(stringVariable.version(), version);
+
+   // Snapshots are not modified by a new value
+   EXPECT_EQ(stringVariable.SetValue("Value 2"), true);
+   EXPECT_GT(stringVariable.version(), version);
+   EXPECT_EQ(*snapshot, "Value 1");
+   EXPECT_EQ(*stringVariable.GetSnapshot(), "Value 2");
+
+   // Staged values are not visible until committed
+   version = stringVariable.version();
+   EXPECT_EQ(stringVariable.StageValue("Value 3"), true);
+   EXPECT_EQ(stringVariable.version(), version);
+   EXPECT_EQ(*stringVariable.GetSnapshot(), "Value 2");
+   stringVariable.Commit();
+   EXPECT_GT(stringVariable.version(), version);
+   EXPECT_EQ(*stringVariable.GetSnapshot(), "Value 3");
+
+   SettingsVariable<std::int64_t> intVariable {"int64_t"};
+   intVariable.SetValue(42);
+   EXPECT_EQ(*intVariable.GetSnapshot(), 42);
+}
+
 } // namespace settings
 } // namespace qt
 } // namespace scwx
@@ -0,0 +1,123 @@
+#include <scwx/qt/util/alert_index.hpp>
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static types::TextEventKey CreateKey(std::int16_t etn)
+{
+   types::TextEventKey key {};
+   key.officeId_ = "KLSX";
+   key.etn_      = etn;
+   return key;
+}
+
+static std::vector<std::int16_t>
+GetEtns(const std::vector<types::TextEventKey>& keys)
+{
+   std::vector<std::int16_t> etns {};
+   for (auto& key : keys)
+   {
+      etns.push_back(key.etn_);
+   }
+   std::sort(etns.begin(), etns.end());
+   return etns;
+}
+
+TEST(AlertIndexTest, QueryTime)
+{
+   using namespace std::chrono;
+
+   const system_clock::time_point t0 {hours {1000}};
+
+   AlertIndex index {};
+
+   index.Update(CreateKey(1), t0, t0 + 1h, {}, {});
+   index.Update(CreateKey(2), t0 + 2h, t0 + 3h, {}, {});
+   index.Update(CreateKey(3), {}, t0 + 30min, {}, {});
+
+   EXPECT_EQ(GetEtns(index.QueryTime(t0, t0)),
+             (std::vector<std::int16_t> {1, 3}));
+   EXPECT_EQ(GetEtns(index.QueryTime(t0 + 45min, t0 + 45min)),
+             (std::vector<std::int16_t> {1}));
+   EXPECT_EQ(
+      GetEtns(index.QueryTime(t0 + 45min, system_clock::time_point::max())),
+      (std::vector<std::int16_t> {1, 2}));
+   EXPECT_TRUE(index.QueryTime(t0 + 4h, t0 + 5h).empty());
+
+   // Updating an event replaces its previous entry
+   index.Update(CreateKey(1), t0, t0 + 4h, {}, {});
+   EXPECT_EQ(GetEtns(index.QueryTime(t0 + 4h, t0 + 5h)),
+             (std::vector<std::int16_t> {1}));
+   EXPECT_EQ(index.size(), 3u);
+
+   index.Remove(CreateKey(1));
+   EXPECT_TRUE(index.QueryTime(t0 + 4h, t0 + 5h).empty());
+   EXPECT_EQ(index.size(), 2u);
+}
+
+TEST(AlertIndexTest, QueryArea)
+{
+   AlertIndex index {};
+
+   const std::vector<common::Coordinate> area1 {
+      {38.0, -91.0}, {38.0, -90.0}, {39.0, -90.0}, {39.0, -91.0}};
+   const std::vector<common::Coordinate> area2 {
+      {40.0, -91.0}, {40.0, -90.0}, {41.0, -90.0}, {41.0, -91.0}};
+
+   index.Update(CreateKey(1), {}, {}, {area1}, {});
+   index.Update(CreateKey(2), {}, {}, {area2}, {});
+   index.Update(CreateKey(3), {}, {}, {area1, area2}, {});
+
+   // Inside the first area
+   EXPECT_EQ(GetEtns(index.QueryArea({38.5, -90.5},
+                                     units::length::meters<double> {0.0})),
+             (std::vector<std::int16_t> {1, 3}));
+
+   // Approximately 55 km north of the first area
+   EXPECT_TRUE(index
+                  .QueryArea({39.5, -90.5},
+                             units::length::meters<double> {50000.0})
+                  .empty());
+   EXPECT_EQ(GetEtns(index.QueryArea({39.5, -90.5},
+                                     units::length::meters<double> {60000.0})),
+             (std::vector<std::int16_t> {1, 2, 3}));
+
+   index.Clear();
+   EXPECT_TRUE(index
+                  .QueryArea({38.5, -90.5},
+                             units::length::meters<double> {0.0})
+                  .empty());
+}
+
+TEST(AlertIndexTest, QueryCounty)
+{
+   AlertIndex index {};
+
+   index.Update(CreateKey(1), {}, {}, {}, {189u, 510u});
+   index.Update(CreateKey(2), {}, {}, {}, {189u});
+
+   EXPECT_EQ(GetEtns(index.QueryCounty(189u)),
+             (std::vector<std::int16_t> {1, 2}));
+   EXPECT_EQ(GetEtns(index.QueryCounty(510u)),
+             (std::vector<std::int16_t> {1}));
+   EXPECT_TRUE(index.QueryCounty(163u).empty());
+
+   index.Update(CreateKey(1), {}, {}, {}, {163u});
+   EXPECT_EQ(GetEtns(index.QueryCounty(189u)),
+             (std::vector<std::int16_t> {2}));
+   EXPECT_TRUE(index.QueryCounty(510u).empty());
+   EXPECT_EQ(GetEtns(index.QueryCounty(163u)),
+             (std::vector<std::int16_t> {1}));
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,91 @@
+#include <scwx/qt/util/azimuth_index.hpp>
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static std::vector<AzimuthIndex::Radial>
+CreateRadials(std::uint16_t count, float startAngle)
+{
+   const float width = 360.0f / count;
+
+   std::vector<AzimuthIndex::Radial> radials {};
+   for (std::uint16_t i = 0; i < count; ++i)
+   {
+      radials.push_back(
+         {i,
+          std::fmod(startAngle + static_cast<float>(i) * width, 360.0f),
+          std::fmod(startAngle + static_cast<float>(i + 1) * width, 360.0f)});
+   }
+   return radials;
+}
+
+static std::optional<std::uint16_t>
+FindRadial(const std::vector<AzimuthIndex::Radial>& radials, double azimuth)
+{
+   for (auto& radial : radials)
+   {
+      if ((radial.startAngle_ < radial.endAngle_) ?
+             (radial.startAngle_ <= azimuth && azimuth < radial.endAngle_) :
+             (radial.startAngle_ <= azimuth || azimuth < radial.endAngle_))
+      {
+         return radial.index_;
+      }
+   }
+   return std::nullopt;
+}
+
+TEST(AzimuthIndexTest, FindMatchesSearch)
+{
+   for (std::uint16_t count : {360u, 720u})
+   {
+      const auto radials = CreateRadials(count, 127.3f);
+
+      AzimuthIndex index {};
+      index.Build(radials);
+
+      for (double azimuth = 0.0; azimuth < 360.0; azimuth += 0.013)
+      {
+         EXPECT_EQ(index.Find(azimuth), FindRadial(radials, azimuth))
+            << "azimuth " << azimuth;
+      }
+   }
+}
+
+TEST(AzimuthIndexTest, RadialCrossingNorth)
+{
+   AzimuthIndex index {};
+   index.Build({{0, 359.5f, 0.5f}, {1, 0.5f, 180.0f}, {2, 180.0f, 359.5f}});
+
+   EXPECT_EQ(index.Find(359.75), 0u);
+   EXPECT_EQ(index.Find(0.0), 0u);
+   EXPECT_EQ(index.Find(0.25), 0u);
+   EXPECT_EQ(index.Find(0.5), 1u);
+   EXPECT_EQ(index.Find(-90.0), 2u);
+   EXPECT_EQ(index.Find(360.25), 0u);
+}
+
+TEST(AzimuthIndexTest, MissingRadials)
+{
+   AzimuthIndex index {};
+   index.Build({{0, 10.0f, 11.0f}, {2, 12.0f, 13.0f}});
+
+   EXPECT_EQ(index.Find(10.5), 0u);
+   EXPECT_EQ(index.Find(11.5), std::nullopt);
+   EXPECT_EQ(index.Find(12.5), 2u);
+   EXPECT_EQ(index.Find(std::nan("")), std::nullopt);
+
+   index.Clear();
+   EXPECT_EQ(index.Find(10.5), std::nullopt);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
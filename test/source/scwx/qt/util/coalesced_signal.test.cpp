@@ -0,0 +1,91 @@
+#include <scwx/qt/util/coalesced_signal.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <QCoreApplication>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+class CoalescedSignalTest : public testing::Test
+{
+protected:
+   int              argc_    = 1;
+   const char*      argv_[2] = {"arg", nullptr};
+   QCoreApplication application_ {argc_, const_cast<char**>(argv_)};
+};
+
+TEST_F(CoalescedSignalTest, NotificationsAreEmittedOnce)
+{
+   int             emissions = 0;
+   CoalescedSignal signal {&application_, [&]() { ++emissions; }};
+
+   signal.Notify();
+   signal.Notify();
+   EXPECT_EQ(signal.Notify(), 3u);
+   EXPECT_EQ(emissions, 0);
+
+   QCoreApplication::processEvents();
+   EXPECT_EQ(emissions, 1);
+   EXPECT_EQ(signal.version(), 3u);
+
+   // A later notification is emitted separately
+   signal.Notify();
+   QCoreApplication::processEvents();
+   EXPECT_EQ(emissions, 2);
+}
+
+TEST_F(CoalescedSignalTest, NotificationsFromWorkerThreads)
+{
+   static constexpr int kThreads_       = 4;
+   static constexpr int kNotifications_ = 1000;
+
+   int             emissions = 0;
+   CoalescedSignal signal {&application_, [&]() { ++emissions; }};
+
+   std::vector<std::thread> threads {};
+   for (int i = 0; i < kThreads_; ++i)
+   {
+      threads.emplace_back(
+         [&]()
+         {
+            for (int j = 0; j < kNotifications_; ++j)
+            {
+               signal.Notify();
+            }
+         });
+   }
+   for (auto& thread : threads)
+   {
+      thread.join();
+   }
+
+   QCoreApplication::processEvents();
+   EXPECT_EQ(emissions, 1);
+   EXPECT_EQ(signal.version(),
+             static_cast<std::uint64_t>(kThreads_ * kNotifications_));
+}
+
+TEST_F(CoalescedSignalTest, DestroyedSignalIsNotEmitted)
+{
+   int emissions = 0;
+
+   {
+      CoalescedSignal signal {&application_, [&]() { ++emissions; }};
+      signal.Notify();
+   }
+
+   QCoreApplication::processEvents();
+   EXPECT_EQ(emissions, 0);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,62 @@
+#include <scwx/qt/util/cross_section.hpp>
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const common::Coordinate kStart_ {35.3331, -97.2778};
+static const common::Coordinate kEnd_ {35.3331, -96.2778};
+
+TEST(CrossSectionTest, BeamHeightAtRadar)
+{
+   EXPECT_NEAR(GetBeamHeight(0.0, 0.5), 0.0, 1e-6);
+   EXPECT_NEAR(GetBeamHeight(0.0, 19.5), 0.0, 1e-6);
+}
+
+TEST(CrossSectionTest, BeamHeightFlatElevation)
+{
+   // At 0 degrees, the beam rises only due to earth curvature
+   static constexpr double kRange_       = 100000.0;
+   static constexpr double kEarthRadius_ = 6371000.0 * 4.0 / 3.0;
+
+   EXPECT_NEAR(GetBeamHeight(kRange_, 0.0),
+               kRange_ * kRange_ / (2.0 * kEarthRadius_),
+               5.0);
+}
+
+TEST(CrossSectionTest, BeamHeightIncreases)
+{
+   EXPECT_LT(GetBeamHeight(50000.0, 0.5), GetBeamHeight(100000.0, 0.5));
+   EXPECT_LT(GetBeamHeight(50000.0, 0.5), GetBeamHeight(50000.0, 1.5));
+
+   // Approximately the range multiplied by the tangent of the elevation
+   EXPECT_NEAR(
+      GetBeamHeight(10000.0, 10.0), 10000.0 * std::tan(0.174533), 20.0);
+}
+
+TEST(CrossSectionTest, NoElevations)
+{
+   CrossSectionGrid grid = ComputeCrossSection(
+      {}, wsr88d::rda::DataBlockType::MomentRef, kStart_, kEnd_, 4, 3, 20000.0);
+
+   EXPECT_EQ(grid.columns_, 4u);
+   EXPECT_EQ(grid.rows_, 3u);
+   EXPECT_EQ(grid.cells_.size(), 12u);
+   EXPECT_GT(grid.distance_, 0.0);
+
+   for (const auto& cell : grid.cells_)
+   {
+      EXPECT_FALSE(cell.has_value());
+   }
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,239 @@
+#include <scwx/qt/util/elevation_scan_inspector.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+using wsr88d::rda::DataBlockType;
+using wsr88d::rda::ElevationScan;
+using wsr88d::rda::GenericRadarData;
+
+static const common::Coordinate kRadarSite_ {35.3331, -97.2778};
+
+// Gates are 1 km, with the first gate centered at 1 km
+class TestMomentDataBlock : public GenericRadarData::MomentDataBlock
+{
+public:
+   explicit TestMomentDataBlock(std::vector<std::uint8_t> dataMoments) :
+       dataMoments_ {std::move(dataMoments)}
+   {
+   }
+
+   std::uint16_t number_of_data_moment_gates() const override
+   {
+      return static_cast<std::uint16_t>(dataMoments_.size());
+   }
+   units::kilometers<float> data_moment_range() const override
+   {
+      return units::kilometers<float> {1.0f};
+   }
+   std::int16_t data_moment_range_raw() const override { return 1000; }
+   units::kilometers<float> data_moment_range_sample_interval() const override
+   {
+      return units::kilometers<float> {1.0f};
+   }
+   std::uint16_t data_moment_range_sample_interval_raw() const override
+   {
+      return 1000u;
+   }
+   std::int16_t snr_threshold_raw() const override { return 0; }
+   std::uint8_t data_word_size() const override { return 8; }
+   float        scale() const override { return 2.0f; }
+   float        offset() const override { return 66.0f; }
+   const void*  data_moments() const override { return dataMoments_.data(); }
+
+private:
+   std::vector<std::uint8_t> dataMoments_;
+};
+
+class TestRadarData : public GenericRadarData
+{
+public:
+   explicit TestRadarData(
+      float azimuth,
+      std::map<DataBlockType, std::shared_ptr<TestMomentDataBlock>> blocks) :
+       azimuth_ {azimuth}, blocks_ {std::move(blocks)}
+   {
+   }
+
+   std::uint32_t collection_time() const override { return 0u; }
+   std::uint16_t modified_julian_date() const override { return 0u; }
+   units::degrees<float> azimuth_angle() const override
+   {
+      return units::degrees<float> {azimuth_};
+   }
+   std::uint16_t azimuth_number() const override { return 0u; }
+   std::uint16_t radial_status() const override { return 0u; }
+   std::uint16_t elevation_number() const override { return 0u; }
+   std::uint16_t volume_coverage_pattern_number() const override
+   {
+      return 0u;
+   }
+
+   std::shared_ptr<GenericRadarData::MomentDataBlock>
+   moment_data_block(DataBlockType type) const override
+   {
+      auto it = blocks_.find(type);
+      return (it != blocks_.cend()) ? it->second : nullptr;
+   }
+
+   bool Parse(std::istream&) override { return true; }
+
+private:
+   float                                                         azimuth_;
+   std::map<DataBlockType, std::shared_ptr<TestMomentDataBlock>> blocks_;
+};
+
+// Creates 1 degree radials, where the reflectivity level of each gate is the
+// radial index plus 2, and velocity is range folded beyond the first gate
+static std::shared_ptr<ElevationScan> CreateElevationScan(std::uint16_t count)
+{
+   auto elevationScan = std::make_shared<ElevationScan>();
+
+   for (std::uint16_t i = 0; i < count; ++i)
+   {
+      const auto level = static_cast<std::uint8_t>(i % 200 + 2);
+
+      (*elevationScan)[i] = std::make_shared<TestRadarData>(
+         static_cast<float>(i),
+         std::map<DataBlockType, std::shared_ptr<TestMomentDataBlock>> {
+            {DataBlockType::MomentRef,
+             std::make_shared<TestMomentDataBlock>(
+                std::vector<std::uint8_t>(100, level))},
+            {DataBlockType::MomentVel,
+             std::make_shared<TestMomentDataBlock>(
+                std::vector<std::uint8_t> {100, 1, 1, 0})}});
+   }
+
+   return elevationScan;
+}
+
+static common::Coordinate GetCoordinate(double azimuth, double range)
+{
+   double latitude;
+   double longitude;
+   GeographicLib::DefaultGeodesic().Direct(kRadarSite_.latitude_,
+                                           kRadarSite_.longitude_,
+                                           azimuth,
+                                           range,
+                                           latitude,
+                                           longitude);
+   return {latitude, longitude};
+}
+
+TEST(ElevationScanInspector, MomentIndex)
+{
+   EXPECT_EQ(ElevationScanInspector::MomentIndex(DataBlockType::MomentRef), 0u);
+   EXPECT_EQ(ElevationScanInspector::MomentIndex(DataBlockType::MomentCfp),
+             ElevationScanInspector::kMomentCount - 1);
+   EXPECT_EQ(ElevationScanInspector::MomentIndex(DataBlockType::Unknown),
+             ElevationScanInspector::kMomentCount);
+}
+
+TEST(ElevationScanInspector, GetRadials)
+{
+   auto radials =
+      ElevationScanInspector::GetRadials(*CreateElevationScan(360u));
+
+   ASSERT_EQ(radials.size(), 360u);
+   EXPECT_EQ(radials[10].index_, 10u);
+   EXPECT_FLOAT_EQ(radials[10].startAngle_, 10.0f);
+   EXPECT_FLOAT_EQ(radials[10].endAngle_, 11.0f);
+   EXPECT_FLOAT_EQ(radials[359].endAngle_, 0.0f);
+
+   // The last radial of an incomplete scan is as wide as the one before it
+   radials = ElevationScanInspector::GetRadials(*CreateElevationScan(90u));
+
+   ASSERT_EQ(radials.size(), 90u);
+   EXPECT_FLOAT_EQ(radials[89].endAngle_, 90.0f);
+}
+
+TEST(ElevationScanInspector, Query)
+{
+   ElevationScanInspector inspector {CreateElevationScan(360u), kRadarSite_};
+
+   auto samples = inspector.Query({GetCoordinate(45.5, 1200.0),
+                                   GetCoordinate(-90.5, 2100.0),
+                                   GetCoordinate(10.5, 50000.0),
+                                   GetCoordinate(10.5, 200000.0)});
+
+   ASSERT_EQ(samples.size(), 4u);
+
+   // First gate, with reflectivity and velocity
+   EXPECT_EQ(samples[0].radial_, 45u);
+   EXPECT_NEAR(samples[0].range_, 1200.0, 0.01);
+   EXPECT_NEAR(samples[0].azimuth_, 45.5, 1e-6);
+
+   auto& ref = samples[0].moment(DataBlockType::MomentRef);
+   ASSERT_TRUE(ref.has_value());
+   EXPECT_EQ(ref->level_, 47u);
+   ASSERT_TRUE(ref->value_.has_value());
+   EXPECT_FLOAT_EQ(*ref->value_, (47.0f - 66.0f) / 2.0f);
+
+   auto& vel = samples[0].moment(DataBlockType::MomentVel);
+   ASSERT_TRUE(vel.has_value());
+   EXPECT_EQ(vel->level_, 100u);
+   EXPECT_FALSE(samples[0].moment(DataBlockType::MomentSw).has_value());
+
+   // Negative azimuths are normalized, and velocity is range folded
+   EXPECT_EQ(samples[1].radial_, 269u);
+   EXPECT_NEAR(samples[1].azimuth_, 269.5, 1e-6);
+   ASSERT_TRUE(samples[1].moment(DataBlockType::MomentVel).has_value());
+   EXPECT_EQ(samples[1].moment(DataBlockType::MomentVel)->level_, 1u);
+   EXPECT_FALSE(
+      samples[1].moment(DataBlockType::MomentVel)->value_.has_value());
+
+   // Beyond the velocity gates, and reflectivity is present
+   EXPECT_EQ(samples[2].radial_, 10u);
+   EXPECT_FALSE(samples[2].moment(DataBlockType::MomentVel).has_value());
+   ASSERT_TRUE(samples[2].moment(DataBlockType::MomentRef).has_value());
+   EXPECT_EQ(samples[2].moment(DataBlockType::MomentRef)->level_, 12u);
+
+   // Beyond radar range
+   EXPECT_EQ(samples[3].radial_, 10u);
+   EXPECT_FALSE(samples[3].moment(DataBlockType::MomentRef).has_value());
+}
+
+TEST(ElevationScanInspector, QueryMissingRadials)
+{
+   ElevationScanInspector inspector {CreateElevationScan(90u), kRadarSite_};
+
+   auto samples = inspector.Query({GetCoordinate(180.5, 1200.0)});
+
+   ASSERT_EQ(samples.size(), 1u);
+   EXPECT_FALSE(samples[0].radial_.has_value());
+   EXPECT_FALSE(samples[0].moment(DataBlockType::MomentRef).has_value());
+}
+
+TEST(ElevationScanInspector, QueryPolyline)
+{
+   ElevationScanInspector inspector {CreateElevationScan(360u), kRadarSite_};
+
+   const common::Coordinate start = GetCoordinate(20.5, 10000.0);
+   const common::Coordinate end   = GetCoordinate(20.5, 20000.0);
+
+   // Steps are no longer than the spacing
+   auto samples = inspector.QueryPolyline({start, end}, 1100.0);
+
+   ASSERT_EQ(samples.size(), 11u);
+   for (std::size_t i = 0; i < samples.size(); ++i)
+   {
+      EXPECT_NEAR(samples[i].distance_, 1000.0 * static_cast<double>(i), 0.01);
+      EXPECT_NEAR(
+         samples[i].range_, 10000.0 + 1000.0 * static_cast<double>(i), 0.01);
+      EXPECT_EQ(samples[i].radial_, 20u);
+   }
+
+   EXPECT_DOUBLE_EQ(samples.back().coordinate_.latitude_, end.latitude_);
+   EXPECT_DOUBLE_EQ(samples.back().coordinate_.longitude_, end.longitude_);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
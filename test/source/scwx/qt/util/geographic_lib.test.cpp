@@ -64,6 +64,83 @@ TEST(geographic_lib, area_in_range_far)
    EXPECT_EQ(value, true);
 }
 
+TEST(geographic_lib, distance_bounds)
+{
+   const units::length::meters<double> distance {100e3};
+
+   for (double latitude : {0.0, 36.9, -60.0, 89.5})
+   {
+      common::Coordinate center {latitude, -91.6};
+      auto [latDelta, lonDelta] =
+         scwx::qt::util::GeographicLib::GetDistanceBounds(center, distance);
+
+      // Every point at the distance is within the bounds
+      for (double angle = 0.0; angle < 360.0; angle += 15.0)
+      {
+         auto coordinate = scwx::qt::util::GeographicLib::GetCoordinate(
+            center, units::angle::degrees<double> {angle}, distance);
+
+         EXPECT_LE(std::abs(coordinate.latitude_ - center.latitude_),
+                   latDelta);
+         if (lonDelta < 180.0)
+         {
+            EXPECT_LE(std::abs(coordinate.longitude_ - center.longitude_),
+                      lonDelta);
+         }
+      }
+   }
+}
+
+TEST(geographic_lib, radial_geodesic_error)
+{
+   // Farthest gate of a super resolution radial
+   const double distance = 1841 * 250.0;
+
+   for (double latitude : {0.0, 13.5, 38.8, 64.8, -14.3, 89.5})
+   {
+      EXPECT_LT(scwx::qt::util::GeographicLib::RadialGeodesic::MaxError(
+                   latitude, -97.3, distance),
+                0.05);
+      EXPECT_TRUE(scwx::qt::util::GeographicLib::RadialGeodesic::IsAccurate(
+         latitude, -97.3, distance));
+   }
+}
+
+TEST(geographic_lib, radial_geodesic_positions)
+{
+   const GeographicLib::Geodesic& geodesic =
+      scwx::qt::util::GeographicLib::DefaultGeodesic();
+
+   // Radials crossing the antimeridian wrap longitude
+   const double latitude  = 51.9;
+   const double longitude = 179.5;
+
+   for (double azimuth = 0.5; azimuth < 360.0; azimuth += 30.0)
+   {
+      const scwx::qt::util::GeographicLib::RadialGeodesic radial {
+         latitude, longitude, azimuth};
+
+      std::vector<float> coordinates(20u);
+      radial.Positions(125.0, 25000.0, 10u, coordinates.data());
+
+      for (std::size_t i = 0; i < 10u; ++i)
+      {
+         const double distance = 125.0 + static_cast<double>(i) * 25000.0;
+
+         double exactLatitude;
+         double exactLongitude;
+         geodesic.Direct(latitude,
+                         longitude,
+                         azimuth,
+                         distance,
+                         exactLatitude,
+                         exactLongitude);
+
+         EXPECT_NEAR(coordinates[i * 2], exactLatitude, 1e-4);
+         EXPECT_NEAR(coordinates[i * 2 + 1], exactLongitude, 1e-4);
+      }
+   }
+}
 
 } // namespace util
 } // namespace scwx
@@ -0,0 +1,57 @@
+#include <scwx/qt/util/line_simplification.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+TEST(LineSimplificationTest, SimplifyLineRemovesNearbyVertices)
+{
+   const std::vector<glm::vec2> points {
+      {0.0f, 0.0f}, {1.0f, 0.01f}, {2.0f, 0.0f}, {3.0f, 1.0f}, {4.0f, 0.0f}};
+
+   EXPECT_EQ(SimplifyLine(points, 0.1f),
+             (std::vector<std::size_t> {0, 2, 3, 4}));
+   EXPECT_EQ(SimplifyLine(points, 2.0f), (std::vector<std::size_t> {0, 4}));
+   EXPECT_EQ(SimplifyLine(points, 0.0f),
+             (std::vector<std::size_t> {0, 1, 2, 3, 4}));
+}
+
+TEST(LineSimplificationTest, SimplifyLineKeepsClosedLineCorners)
+{
+   const std::vector<glm::vec2> points {{0.0f, 0.0f},
+                                        {0.5f, 0.0f},
+                                        {1.0f, 0.0f},
+                                        {1.0f, 1.0f},
+                                        {0.0f, 1.0f},
+                                        {0.0f, 0.0f}};
+
+   EXPECT_EQ(SimplifyLine(points, 0.1f),
+             (std::vector<std::size_t> {0, 2, 3, 4, 5}));
+}
+
+TEST(LineSimplificationTest, LevelOfDetailIncreasesWithPixelScale)
+{
+   std::size_t previousLevel = 0;
+
+   EXPECT_EQ(GetLevelOfDetail(0.0f), 0u);
+   EXPECT_EQ(GetLevelOfDetail(1.0f), kLevelOfDetailCount - 1);
+
+   for (float pixelScale = 0.0001f; pixelScale < 1.0f; pixelScale *= 2.0f)
+   {
+      const std::size_t level = GetLevelOfDetail(pixelScale);
+
+      EXPECT_GE(level, previousLevel);
+      EXPECT_LE(GetLevelOfDetailTolerance(level), pixelScale);
+
+      previousLevel = level;
+   }
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,148 @@
+#include <scwx/qt/util/mosaic_sweep.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+using wsr88d::rda::DataBlockType;
+using wsr88d::rda::ElevationScan;
+using wsr88d::rda::GenericRadarData;
+
+static const common::Coordinate kMosaicRadarSite_ {35.3331, -97.2778};
+
+// Gates are 250 m, with the first gate centered at 2 km
+class MosaicMomentDataBlock : public GenericRadarData::MomentDataBlock
+{
+public:
+   explicit MosaicMomentDataBlock(std::vector<std::uint8_t> dataMoments,
+                                  std::int16_t              snrThreshold) :
+       dataMoments_ {std::move(dataMoments)}, snrThreshold_ {snrThreshold}
+   {
+   }
+
+   std::uint16_t number_of_data_moment_gates() const override
+   {
+      return static_cast<std::uint16_t>(dataMoments_.size());
+   }
+   units::kilometers<float> data_moment_range() const override
+   {
+      return units::kilometers<float> {2.0f};
+   }
+   std::int16_t data_moment_range_raw() const override { return 2000; }
+   units::kilometers<float> data_moment_range_sample_interval() const override
+   {
+      return units::kilometers<float> {0.25f};
+   }
+   std::uint16_t data_moment_range_sample_interval_raw() const override
+   {
+      return 250u;
+   }
+   std::int16_t snr_threshold_raw() const override { return snrThreshold_; }
+   std::uint8_t data_word_size() const override { return 8; }
+   float        scale() const override { return 2.0f; }
+   float        offset() const override { return 66.0f; }
+   const void*  data_moments() const override { return dataMoments_.data(); }
+
+private:
+   std::vector<std::uint8_t> dataMoments_;
+   std::int16_t              snrThreshold_;
+};
+
+class MosaicRadarData : public GenericRadarData
+{
+public:
+   explicit MosaicRadarData(float                                  azimuth,
+                            std::shared_ptr<MosaicMomentDataBlock> block) :
+       azimuth_ {azimuth}, block_ {std::move(block)}
+   {
+   }
+
+   std::uint32_t collection_time() const override { return 0u; }
+   std::uint16_t modified_julian_date() const override { return 0u; }
+   units::degrees<float> azimuth_angle() const override
+   {
+      return units::degrees<float> {azimuth_};
+   }
+   std::uint16_t azimuth_number() const override { return 0u; }
+   std::uint16_t radial_status() const override { return 0u; }
+   std::uint16_t elevation_number() const override { return 0u; }
+   std::uint16_t volume_coverage_pattern_number() const override
+   {
+      return 0u;
+   }
+
+   std::shared_ptr<GenericRadarData::MomentDataBlock>
+   moment_data_block(DataBlockType type) const override
+   {
+      return (type == DataBlockType::MomentRef) ? block_ : nullptr;
+   }
+
+   bool Parse(std::istream&) override { return true; }
+
+private:
+   float                                  azimuth_;
+   std::shared_ptr<MosaicMomentDataBlock> block_;
+};
+
+// Creates 1 degree radials, where the reflectivity level of each gate is the
+// radial index plus 10, and the last gate is below the SNR threshold
+static std::shared_ptr<ElevationScan> CreateMosaicElevationScan()
+{
+   auto elevationScan = std::make_shared<ElevationScan>();
+
+   for (std::uint16_t i = 0; i < 360u; ++i)
+   {
+      std::vector<std::uint8_t> levels(
+         8, static_cast<std::uint8_t>(i % 200 + 10));
+      levels.back() = 5u;
+
+      (*elevationScan)[i] = std::make_shared<MosaicRadarData>(
+         static_cast<float>(i),
+         std::make_shared<MosaicMomentDataBlock>(std::move(levels), 8));
+   }
+
+   return elevationScan;
+}
+
+TEST(MosaicSweep, CreateMosaicSweep)
+{
+   auto sweep = CreateMosaicSweep(
+      *CreateMosaicElevationScan(), "KTLX", kMosaicRadarSite_, {});
+
+   ASSERT_NE(sweep, nullptr);
+   EXPECT_EQ(sweep->radarId_, "KTLX");
+   EXPECT_FLOAT_EQ(sweep->firstGateRange_, 1875.0f);
+   EXPECT_FLOAT_EQ(sweep->gateSize_, 250.0f);
+   EXPECT_EQ(sweep->gates_, 8u);
+   EXPECT_FLOAT_EQ(sweep->offset_, 66.0f);
+   EXPECT_FLOAT_EQ(sweep->scale_, 2.0f);
+   EXPECT_DOUBLE_EQ(sweep->max_range(), 3875.0);
+   ASSERT_EQ(sweep->levels_.size(), MosaicSweep::kAzimuthRows * 8u);
+
+   // Both half degree rows of a radial take its gates
+   EXPECT_EQ(sweep->level(0, 0), 10u);
+   EXPECT_EQ(sweep->level(1, 0), 10u);
+   EXPECT_EQ(sweep->level(91, 3), 55u);
+   EXPECT_EQ(sweep->level(719, 6), 169u);
+
+   // Gates below the SNR threshold are covered, with no data
+   EXPECT_EQ(sweep->level(91, 7), MosaicSweep::kNoDataLevel);
+}
+
+TEST(MosaicSweep, NoReflectivity)
+{
+   ElevationScan elevationScan {};
+   elevationScan[0] = std::make_shared<MosaicRadarData>(0.0f, nullptr);
+
+   EXPECT_EQ(
+      CreateMosaicSweep(elevationScan, "KTLX", kMosaicRadarSite_, {}), nullptr);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,76 @@
+#include <scwx/qt/util/position_filter.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+using namespace std::chrono_literals;
+
+static const std::chrono::steady_clock::time_point kTime_ {
+   std::chrono::hours {1}};
+
+TEST(PositionFilterTest, DistanceThreshold)
+{
+   PositionFilter filter {{.distance_ = units::length::meters<double> {50.0}}};
+
+   EXPECT_FALSE(filter.coordinate().has_value());
+
+   // The first position is always accepted
+   EXPECT_TRUE(filter.Update({38.0, -90.0}, {}, kTime_));
+   EXPECT_TRUE(filter.coordinate().has_value());
+
+   // Approximately 11 meters
+   EXPECT_FALSE(filter.Update({38.0001, -90.0}, {}, kTime_ + 1s));
+
+   // Approximately 111 meters
+   EXPECT_TRUE(filter.Update({38.001, -90.0}, {}, kTime_ + 2s));
+   EXPECT_DOUBLE_EQ(filter.coordinate()->latitude_, 38.001);
+
+   filter.Reset();
+   EXPECT_FALSE(filter.coordinate().has_value());
+   EXPECT_TRUE(filter.Update({38.001, -90.0}, {}, kTime_ + 3s));
+}
+
+TEST(PositionFilterTest, HeadingThreshold)
+{
+   PositionFilter filter {
+      {.distance_ = units::length::meters<double> {50.0},
+       .heading_  = units::angle::degrees<double> {10.0}}};
+
+   EXPECT_TRUE(filter.Update({38.0, -90.0}, 355.0, kTime_));
+   EXPECT_FALSE(filter.Update({38.0, -90.0}, 2.0, kTime_ + 1s));
+   EXPECT_TRUE(filter.Update({38.0, -90.0}, 6.0, kTime_ + 2s));
+}
+
+TEST(PositionFilterTest, Interval)
+{
+   PositionFilter filter {{.interval_ = 1000ms}};
+
+   EXPECT_TRUE(filter.Update({38.0, -90.0}, {}, kTime_));
+   EXPECT_FALSE(filter.Update({38.1, -90.0}, {}, kTime_ + 100ms));
+   EXPECT_TRUE(filter.Update({38.2, -90.0}, {}, kTime_ + 1000ms));
+
+   // Unchanged positions are not accepted
+   EXPECT_FALSE(filter.Update({38.2, -90.0}, {}, kTime_ + 2000ms));
+}
+
+TEST(PositionFilterTest, Smoothing)
+{
+   PositionFilter filter {{.smoothing_ = 0.5}};
+
+   EXPECT_TRUE(filter.Update({38.0, 179.5}, {}, kTime_));
+
+   // Longitudes are smoothed across the antimeridian
+   EXPECT_TRUE(filter.Update({39.0, -179.7}, {}, kTime_ + 1s));
+   EXPECT_DOUBLE_EQ(filter.coordinate()->latitude_, 38.5);
+   EXPECT_NEAR(filter.coordinate()->longitude_, 179.9, 1e-9);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -94,6 +94,40 @@ TEST(QFileInputStream, SeekOffset)
    EXPECT_EQ(s, "labor");
 }
 
+TEST(QFileInputStream, MappedRead)
+{
+   QFileInputStream is {kLoremIpsum_, std::ios_base::binary};
+
+   EXPECT_EQ(is.is_open(), true);
+   EXPECT_EQ(is.rdbuf()->is_mapped(), true);
+   EXPECT_EQ(is.good(), true);
+
+   std::string s;
+   s.resize(5u);
+   is.read(s.data(), 5u);
+   EXPECT_EQ(is.good(), true);
+   EXPECT_EQ(s, "Lorem");
+
+   is.seekg(1, std::ios_base::cur);
+   EXPECT_EQ(is.get(), 'i');
+   is.unget();
+
+   is.read(s.data(), 5u);
+   EXPECT_EQ(is.good(), true);
+   EXPECT_EQ(s, "ipsum");
+
+   is.seekg(-8, std::ios_base::end);
+   is.read(s.data(), 5u);
+   EXPECT_EQ(is.good(), true);
+   EXPECT_EQ(s, "labor");
+
+   // Reads past the end of the mapped data are short
+   is.seekg(-2, std::ios_base::end);
+   is.read(s.data(), 5u);
+   EXPECT_EQ(is.gcount(), 2);
+   EXPECT_EQ(is.eof(), true);
+}
+
 } // namespace util
 } // namespace qt
 } // namespace scwx
@@ -0,0 +1,65 @@
+#include <scwx/qt/util/spatial_index.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+TEST(SpatialIndexTest, QueryReturnsNearbyEntriesInDescendingOrder)
+{
+   SpatialIndex index {};
+
+   index.Build({{0.0f, 0.0f, 10.0f, 10.0f},
+                {5.0f, 5.0f, 5.0f, 5.0f},
+                {20.0f, 20.0f, 30.0f, 30.0f},
+                {4.0f, 4.0f, 6.0f, 6.0f}},
+               2.0f);
+
+   EXPECT_EQ(index.Query({5.0f, 5.0f}, 0.0f),
+             (std::vector<std::size_t> {3, 1, 0}));
+   EXPECT_EQ(index.Query({25.0f, 25.0f}, 0.0f),
+             (std::vector<std::size_t> {2}));
+   EXPECT_TRUE(index.Query({15.0f, 15.0f}, 0.0f).empty());
+}
+
+TEST(SpatialIndexTest, QueryIncludesPixelOffset)
+{
+   SpatialIndex index {};
+
+   index.Build({{0.0f, 0.0f, 0.0f, 0.0f}}, 10.0f);
+
+   // 10 pixels at 0.5 units per pixel reaches 5 units from the entry
+   EXPECT_EQ(index.Query({4.0f, 0.0f}, 0.5f).size(), 1u);
+   EXPECT_TRUE(index.Query({6.0f, 0.0f}, 0.5f).empty());
+
+   index.Clear();
+   EXPECT_TRUE(index.Query({0.0f, 0.0f}, 0.5f).empty());
+}
+
+TEST(SpatialIndexTest, QueryAreaReturnsEntriesInAscendingOrder)
+{
+   SpatialIndex index {};
+
+   index.Build({{0.0f, 0.0f, 1.0f, 1.0f},
+                {10.0f, 10.0f, 11.0f, 11.0f},
+                {2.0f, 2.0f, 3.0f, 3.0f}},
+               0.0f);
+
+   EXPECT_EQ(index.Query(glm::vec4 {-1.0f, -1.0f, 4.0f, 4.0f}, 1.0f),
+             (std::vector<std::size_t> {0, 2}));
+   EXPECT_EQ(index.size(), 3u);
+
+   const glm::vec4 bounds = index.bounds();
+   EXPECT_EQ(bounds.x, 0.0f);
+   EXPECT_EQ(bounds.y, 0.0f);
+   EXPECT_EQ(bounds.z, 11.0f);
+   EXPECT_EQ(bounds.w, 11.0f);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
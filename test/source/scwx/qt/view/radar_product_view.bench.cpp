@@ -0,0 +1,121 @@
+#include <scwx/qtbench.hpp>
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/request/nexrad_file_request.hpp>
+#include <scwx/qt/view/radar_product_view_factory.hpp>
+
+#include <future>
+
+#include <benchmark/benchmark.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static std::shared_ptr<types::RadarProductRecord>
+LoadRecord(const std::string& file)
+{
+   auto request = std::make_shared<request::NexradFileRequest>();
+
+   std::promise<std::shared_ptr<types::RadarProductRecord>> promise {};
+   auto future = promise.get_future();
+
+   QObject::connect(request.get(),
+                    &request::NexradFileRequest::RequestComplete,
+                    [&promise](std::shared_ptr<request::NexradFileRequest> r)
+                    { promise.set_value(r->radar_product_record()); });
+
+   manager::RadarProductManager::LoadFile(
+      std::string(SCWX_TEST_DATA_DIR) + "/nexrad/" + file, request);
+
+   return future.get();
+}
+
+static void RadarProductViewComputeSweep(benchmark::State&  state,
+                                         const std::string& file)
+{
+   auto record = LoadRecord(file);
+   if (record == nullptr)
+   {
+      state.SkipWithError("Could not load test data");
+      return;
+   }
+
+   auto radarProductManager =
+      manager::RadarProductManager::Instance(record->radar_id());
+
+   std::size_t vertices    = 0u;
+   std::size_t uploadBytes = 0u;
+
+   for (auto _ : state)
+   {
+      // Geometry caches only hold weak references, so each new view computes
+      // its sweep from the beginning
+      state.PauseTiming();
+      auto radarProductView =
+         RadarProductViewFactory::Create(record->radar_product_group(),
+                                         record->radar_product(),
+                                         record->product_code(),
+                                         radarProductManager);
+      radarProductView->SelectTime(record->time());
+      state.ResumeTiming();
+
+      // Computes the sweep synchronously
+      radarProductView->Initialize();
+
+      state.PauseTiming();
+      auto polarGrid = radarProductView->polar_grid();
+
+      vertices = (polarGrid != nullptr) ?
+                    polarGrid->vertices() :
+                    (radarProductView->vertices().size() +
+                     radarProductView->quantized_vertices().size()) /
+                       2u;
+
+      // Shared vertices are buffered once, and are not uploaded per sweep
+      uploadBytes = std::get<1>(radarProductView->GetMomentData()) +
+                    std::get<1>(radarProductView->GetCfpMomentData()) +
+                    radarProductView->quantized_vertices().size() *
+                       sizeof(std::int16_t);
+      if (radarProductView->shared_vertices() == nullptr)
+      {
+         uploadBytes += radarProductView->vertices().size() * sizeof(float);
+      }
+
+      radarProductView.reset();
+      state.ResumeTiming();
+   }
+
+   state.counters["vertices"]    = static_cast<double>(vertices);
+   state.counters["uploadBytes"] = benchmark::Counter(
+      static_cast<double>(uploadBytes),
+      benchmark::Counter::kDefaults,
+      benchmark::Counter::OneK::kIs1024);
+}
+
+BENCHMARK_CAPTURE(RadarProductViewComputeSweep,
+                  Level2_KLSX,
+                  std::string {"level2/Level2_KLSX_20210527_1757.ar2v"})
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(RadarProductViewComputeSweep,
+                  Level2_TSTL,
+                  std::string {"level2/Level2_TSTL_20220213_2357.ar2v"})
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(RadarProductViewComputeSweep,
+                  Level3Radial_N0Z,
+                  std::string {"level3/KLSX_SDUS73_N0ZLSX_202105042031"})
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(RadarProductViewComputeSweep,
+                  Level3Radial_N0V,
+                  std::string {"level3/KLSX_SDUS53_N0VLSX_202105042201"})
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(RadarProductViewComputeSweep,
+                  Level3Raster_NCR,
+                  std::string {"level3/Level3_STL_NCR_20211211_0200.nids"})
+   ->Unit(benchmark::kMillisecond);
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
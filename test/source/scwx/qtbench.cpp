@@ -0,0 +1,113 @@
+#include <scwx/qtbench.hpp>
+#include <scwx/bench_runner.hpp>
+#include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/manager/resource_manager.hpp>
+#include <scwx/qt/manager/thread_manager.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <spdlog/spdlog.h>
+#include <QGuiApplication>
+#include <QOffscreenSurface>
+#include <QOpenGLContext>
+#include <QOpenGLFramebufferObject>
+
+namespace scwx
+{
+namespace bench
+{
+
+static const std::string logPrefix_ = "scwx::qtbench";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr int kWidth_  = 1920;
+static constexpr int kHeight_ = 1080;
+
+static std::shared_ptr<qt::gl::GlContext> glContext_ {nullptr};
+
+std::shared_ptr<qt::gl::GlContext> GlContext()
+{
+   return glContext_;
+}
+
+QMapLibre::CustomLayerRenderParameters RenderParameters()
+{
+   QMapLibre::CustomLayerRenderParameters params {};
+
+   params.width     = kWidth_;
+   params.height    = kHeight_;
+   params.latitude  = 38.6986863;
+   params.longitude = -90.682877;
+   params.zoom      = 7.0;
+   params.bearing   = 0.0;
+   params.pitch     = 0.0;
+
+   return params;
+}
+
+void FinishFrame()
+{
+   glContext_->gl().glFinish();
+}
+
+} // namespace bench
+} // namespace scwx
+
+int main(int argc, char** argv)
+{
+   using namespace scwx;
+
+   scwx::util::Logger::Initialize();
+
+   // Application logging would dominate the measurements
+   spdlog::set_level(spdlog::level::off);
+
+   // Run headless with QT_QPA_PLATFORM=offscreen
+   QGuiApplication application(argc, argv);
+
+   QSurfaceFormat surfaceFormat {};
+   surfaceFormat.setVersion(3, 3);
+   surfaceFormat.setProfile(QSurfaceFormat::OpenGLContextProfile::CoreProfile);
+
+   QOpenGLContext openGLContext {};
+   openGLContext.setFormat(surfaceFormat);
+   if (!openGLContext.create())
+   {
+      bench::logger_->critical("Unable to create OpenGL context");
+      return 1;
+   }
+
+   QOffscreenSurface surface {};
+   surface.setFormat(openGLContext.format());
+   surface.create();
+
+   if (!openGLContext.makeCurrent(&surface))
+   {
+      bench::logger_->critical("Unable to make OpenGL context current");
+      return 1;
+   }
+
+   int result = 0;
+
+   {
+      QOpenGLFramebufferObject framebuffer {bench::kWidth_, bench::kHeight_};
+      framebuffer.bind();
+
+      qt::config::RadarSite::Initialize();
+      qt::manager::ResourceManager::Initialize();
+
+      bench::glContext_ = std::make_shared<qt::gl::GlContext>();
+      bench::glContext_->Initialize();
+
+      result = bench::RunBenchmarks(argc, argv);
+
+      bench::glContext_.reset();
+      framebuffer.release();
+   }
+
+   openGLContext.doneCurrent();
+
+   qt::manager::ThreadManager::Instance().StopThreads();
+   qt::manager::ResourceManager::Shutdown();
+
+   return result;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <scwx/qt/gl/dynamic_buffer.hpp>
+#include <scwx/qt/gl/gl_context.hpp>
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+#include <qmaplibre.hpp>
+
+namespace scwx
+{
+namespace bench
+{
+
+/**
+ * @brief Gets the OpenGL context used by the draw item benchmarks. The context
+ * is current on the benchmark thread, and renders to an offscreen
+ * framebuffer.
+ *
+ * @return OpenGL context
+ */
+std::shared_ptr<qt::gl::GlContext> GlContext();
+
+/**
+ * @brief Gets render parameters for a 1920x1080 map centered on St. Louis.
+ *
+ * @return Render parameters
+ */
+QMapLibre::CustomLayerRenderParameters RenderParameters();
+
+/**
+ * @brief Waits for the OpenGL commands issued in a frame to complete, so the
+ * time spent uploading buffers is included in the measurement.
+ */
+void FinishFrame();
+
+/**
+ * @brief Runs a draw item benchmark, and reports the number of vertices drawn
+ * and the bytes uploaded by dynamic buffers in each frame.
+ *
+ * @param [in] state Benchmark state
+ * @param [in] vertices Number of vertices drawn in each frame
+ * @param [in] frame Updates and renders the draw item for one frame
+ */
+template<class Frame>
+void RunFrames(benchmark::State& state, std::size_t vertices, Frame&& frame)
+{
+   const std::uint64_t begin = qt::gl::DynamicBuffer::uploaded_bytes();
+
+   for (auto _ : state)
+   {
+      frame();
+      FinishFrame();
+   }
+
+   state.counters["vertices"] = static_cast<double>(vertices);
+   state.counters["uploadBytes"] =
+      benchmark::Counter(static_cast<double>(
+                            qt::gl::DynamicBuffer::uploaded_bytes() - begin),
+                         benchmark::Counter::kAvgIterations,
+                         benchmark::Counter::OneK::kIs1024);
+}
+
+} // namespace bench
+} // namespace scwx
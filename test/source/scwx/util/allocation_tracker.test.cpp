@@ -0,0 +1,49 @@
+#include <scwx/util/allocation_tracker.hpp>
+
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(AllocationTrackerTest, Count)
+{
+   const AllocationCount processBegin = AllocationTracker::GetProcessCount();
+   const AllocationCount begin        = AllocationTracker::GetThreadCount();
+
+   auto value = std::make_unique<std::uint64_t>(0u);
+
+   const AllocationCount end = AllocationTracker::GetThreadCount();
+
+   // Each thread counts its own allocations
+   AllocationCount otherCount {};
+   std::thread     thread {[&otherCount]()
+                       {
+                          auto other = std::make_unique<std::uint32_t>(0u);
+                          otherCount = AllocationTracker::GetThreadCount();
+                       }};
+   thread.join();
+
+   const AllocationCount processEnd = AllocationTracker::GetProcessCount();
+
+   if (AllocationTracker::IsAvailable())
+   {
+      EXPECT_EQ(end.allocations_ - begin.allocations_, 1u);
+      EXPECT_EQ(end.bytes_ - begin.bytes_, sizeof(std::uint64_t));
+      EXPECT_GE(otherCount.allocations_, 1u);
+      EXPECT_GE(processEnd.allocations_ - processBegin.allocations_, 2u);
+   }
+   else
+   {
+      EXPECT_EQ(end.allocations_, 0u);
+      EXPECT_EQ(otherCount.allocations_, 0u);
+      EXPECT_EQ(processEnd.allocations_, 0u);
+   }
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,40 @@
+#include <scwx/util/arena.hpp>
+
+#include <map>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(ArenaTest, ObjectsShareArenaOwnership)
+{
+   auto                 arena = std::make_shared<Arena>(1024);
+   std::weak_ptr<Arena> weakArena {arena};
+
+   auto value = MakeShared<int>(arena, 42);
+   auto map   = MakeShared<std::pmr::map<int, int>>(arena, arena.get());
+   (*map)[1]  = 2;
+   arena.reset();
+
+   EXPECT_FALSE(weakArena.expired());
+   EXPECT_EQ(*value, 42);
+   EXPECT_EQ(map->at(1), 2);
+
+   value.reset();
+   map.reset();
+
+   EXPECT_TRUE(weakArena.expired());
+}
+
+TEST(ArenaTest, HeapWithoutArena)
+{
+   auto value = MakeShared<int>(nullptr, 7);
+
+   EXPECT_EQ(*value, 7);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,114 @@
+#include <scwx/util/buffer_pool.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(BufferPoolTest, ReusesReleasedBuffer)
+{
+   BufferPool pool {};
+
+   auto  buffer = pool.Acquire(1024);
+   char* data   = buffer->data();
+   buffer->resize(16);
+
+   EXPECT_EQ(pool.idle_count(), 0u);
+   buffer.reset();
+   EXPECT_EQ(pool.idle_count(), 1u);
+
+   buffer = pool.Acquire();
+   EXPECT_EQ(pool.idle_count(), 0u);
+   EXPECT_TRUE(buffer->empty());
+   EXPECT_GE(buffer->capacity(), 1024u);
+   EXPECT_EQ(buffer->data(), data);
+}
+
+TEST(BufferPoolTest, LimitsIdleBuffers)
+{
+   BufferPool pool {48, 64};
+
+   auto buffer1 = pool.Acquire(32);
+   auto buffer2 = pool.Acquire(32);
+   auto buffer3 = pool.Acquire(128);
+
+   const std::size_t capacity = buffer1->capacity();
+
+   buffer3.reset();
+   EXPECT_EQ(pool.idle_count(), 0u);
+
+   buffer1.reset();
+   buffer2.reset();
+   EXPECT_EQ(pool.idle_count(), 1u);
+   EXPECT_EQ(pool.idle_bytes(), capacity);
+
+   pool.Clear();
+   EXPECT_EQ(pool.idle_count(), 0u);
+   EXPECT_EQ(pool.idle_bytes(), 0u);
+}
+
+TEST(BufferPoolTest, AcquiresBestFit)
+{
+   BufferPool pool {};
+
+   auto small  = pool.Acquire(1000);
+   auto medium = pool.Acquire(4000);
+   auto large  = pool.Acquire(16000);
+
+   char* smallData  = small->data();
+   char* mediumData = medium->data();
+   char* largeData  = large->data();
+
+   small.reset();
+   medium.reset();
+   large.reset();
+   EXPECT_EQ(pool.idle_count(), 3u);
+
+   // The smallest buffer large enough is used
+   auto buffer = pool.Acquire(3500);
+   EXPECT_EQ(buffer->data(), mediumData);
+
+   // A buffer much larger than required is not used
+   auto unpooled = pool.Acquire(2000);
+   EXPECT_NE(unpooled->data(), smallData);
+   EXPECT_NE(unpooled->data(), largeData);
+   EXPECT_EQ(pool.idle_count(), 2u);
+
+   // Without a capacity, the largest buffer is used
+   auto growable = pool.Acquire();
+   EXPECT_EQ(growable->data(), largeData);
+}
+
+TEST(BufferPoolTest, ShrinkToFit)
+{
+   BufferPool pool {};
+
+   auto buffer = pool.Acquire(4096);
+   buffer->assign(100, 'x');
+
+   auto fitted = pool.ShrinkToFit(buffer);
+   EXPECT_NE(fitted, buffer);
+   EXPECT_EQ(*fitted, *buffer);
+   EXPECT_LT(fitted->capacity(), 4096u);
+
+   // A buffer without much unused capacity is returned as is
+   EXPECT_EQ(pool.ShrinkToFit(fitted), fitted);
+}
+
+TEST(BufferPoolTest, BufferOutlivesPool)
+{
+   std::shared_ptr<BufferPool::Buffer> buffer;
+
+   {
+      BufferPool pool {};
+      buffer = pool.Acquire(16);
+   }
+
+   buffer->push_back('x');
+   buffer.reset();
+}
+
+} // namespace util
+} // namespace scwx
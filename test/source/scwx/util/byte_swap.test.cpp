@@ -0,0 +1,114 @@
+#include <scwx/util/byte_swap.hpp>
+
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#ifdef _WIN32
+#   include <WinSock2.h>
+#else
+#   include <arpa/inet.h>
+#endif
+
+namespace scwx
+{
+namespace util
+{
+
+class ByteSwapTest : public testing::TestWithParam<std::size_t>
+{
+};
+
+TEST_P(ByteSwapTest, BigEndianToHost16)
+{
+   const std::size_t count = GetParam();
+
+   std::vector<std::uint16_t> data(count);
+   std::iota(data.begin(), data.end(), std::uint16_t {0x0102});
+   std::vector<std::uint16_t> expected(data);
+   for (auto& value : expected)
+   {
+      value = ntohs(value);
+   }
+
+   BigEndianToHost16(data.data(), data.size());
+
+   EXPECT_EQ(data, expected);
+}
+
+TEST_P(ByteSwapTest, BigEndianToHost32)
+{
+   const std::size_t count = GetParam();
+
+   std::vector<std::uint32_t> data(count);
+   std::iota(data.begin(), data.end(), std::uint32_t {0x01020304u});
+   std::vector<std::uint32_t> expected(data);
+   for (auto& value : expected)
+   {
+      value = ntohl(value);
+   }
+
+   BigEndianToHost32(data.data(), data.size());
+
+   EXPECT_EQ(data, expected);
+}
+
+TEST_P(ByteSwapTest, BigEndianToHost16Variants)
+{
+   const std::size_t count = GetParam();
+
+   std::vector<std::uint16_t> expected(count);
+   std::iota(expected.begin(), expected.end(), std::uint16_t {0x0102});
+   std::vector<std::uint16_t> source(expected);
+
+   BigEndianToHost16Kernels().kernels().back().function_(expected.data(),
+                                                         expected.size());
+
+   for (auto& kernel : BigEndianToHost16Kernels().kernels())
+   {
+      if (!IsInstructionSetSupported(kernel.instructionSet_))
+      {
+         continue;
+      }
+
+      std::vector<std::uint16_t> data(source);
+      kernel.function_(data.data(), data.size());
+
+      EXPECT_EQ(data, expected)
+         << GetInstructionSetName(kernel.instructionSet_);
+   }
+}
+
+TEST_P(ByteSwapTest, BigEndianToHost32Variants)
+{
+   const std::size_t count = GetParam();
+
+   std::vector<std::uint32_t> expected(count);
+   std::iota(expected.begin(), expected.end(), std::uint32_t {0x01020304u});
+   std::vector<std::uint32_t> source(expected);
+
+   BigEndianToHost32Kernels().kernels().back().function_(expected.data(),
+                                                         expected.size());
+
+   for (auto& kernel : BigEndianToHost32Kernels().kernels())
+   {
+      if (!IsInstructionSetSupported(kernel.instructionSet_))
+      {
+         continue;
+      }
+
+      std::vector<std::uint32_t> data(source);
+      kernel.function_(data.data(), data.size());
+
+      EXPECT_EQ(data, expected)
+         << GetInstructionSetName(kernel.instructionSet_);
+   }
+}
+
+INSTANTIATE_TEST_SUITE_P(ByteSwap,
+                         ByteSwapTest,
+                         testing::Values(0, 1, 7, 8, 15, 16, 17, 1840));
+
+} // namespace util
+} // namespace scwx
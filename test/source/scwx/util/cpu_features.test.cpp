@@ -0,0 +1,65 @@
+#include <scwx/util/cpu_features.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static int Kernel1()
+{
+   return 1;
+}
+
+static int Kernel2()
+{
+   return 2;
+}
+
+TEST(CpuFeaturesTest, InstructionSetName)
+{
+   for (InstructionSet instructionSet : InstructionSetIterator())
+   {
+      EXPECT_EQ(GetInstructionSet(GetInstructionSetName(instructionSet)),
+                instructionSet);
+   }
+
+   EXPECT_EQ(GetInstructionSet("avx-512"), InstructionSet::AVX512);
+   EXPECT_EQ(GetInstructionSet("invalid"), InstructionSet::Unknown);
+}
+
+TEST(CpuFeaturesTest, ScalarSupported)
+{
+   EXPECT_TRUE(IsInstructionSetSupported(InstructionSet::Scalar));
+   EXPECT_FALSE(IsInstructionSetSupported(InstructionSet::Unknown));
+
+#if defined(SCWX_ARCH_X86)
+   EXPECT_FALSE(IsInstructionSetSupported(InstructionSet::NEON));
+#elif defined(SCWX_ARCH_ARM)
+   EXPECT_FALSE(IsInstructionSetSupported(InstructionSet::AVX2));
+#endif
+}
+
+TEST(CpuFeaturesTest, KernelTableSelection)
+{
+   typedef int (*Function)();
+
+   // An unsupported variant is never selected
+   const KernelTable<Function> unknownTable {
+      {InstructionSet::Unknown, &Kernel2},
+      {InstructionSet::Scalar, &Kernel1}};
+
+   EXPECT_EQ(unknownTable.selected().instructionSet_, InstructionSet::Scalar);
+   EXPECT_EQ(unknownTable(), 1);
+   EXPECT_EQ(unknownTable.kernels().size(), 2u);
+
+   // The first supported variant is selected
+   const KernelTable<Function> scalarTable {{InstructionSet::Scalar, &Kernel2},
+                                            {InstructionSet::Scalar, &Kernel1}};
+
+   EXPECT_EQ(scalarTable(), 2);
+}
+
+} // namespace util
+} // namespace scwx
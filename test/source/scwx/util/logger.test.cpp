@@ -0,0 +1,69 @@
+#include <scwx/util/logger.hpp>
+
+#include <spdlog/sinks/ringbuffer_sink.h>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static std::vector<std::string>
+GetMessages(spdlog::sinks::ringbuffer_sink_mt& sink, const std::string& name)
+{
+   // Other loggers may be writing to the same sink
+   std::vector<std::string> messages {};
+   for (auto& message : sink.last_raw())
+   {
+      if (message.logger_name == name)
+      {
+         messages.emplace_back(message.payload.begin(), message.payload.end());
+      }
+   }
+   return messages;
+}
+
+TEST(LoggerTest, RepeatedMessages)
+{
+   const std::string name = "scwx::util::logger.test.repeated";
+
+   auto sink = std::make_shared<spdlog::sinks::ringbuffer_sink_mt>(64u);
+   Logger::AddSink(sink);
+   auto logger = Logger::Create(name);
+
+   for (int i = 0; i < 5; ++i)
+   {
+      logger->info("Repeated message");
+   }
+   logger->info("Different message");
+
+   EXPECT_EQ(GetMessages(*sink, name),
+             (std::vector<std::string> {"Repeated message",
+                                        "Previous message repeated 4 times",
+                                        "Different message"}));
+}
+
+TEST(LoggerTest, Async)
+{
+   const std::string name = "scwx::util::logger.test.async";
+
+   auto sink = std::make_shared<spdlog::sinks::ringbuffer_sink_mt>(64u);
+   Logger::AddSink(sink);
+   auto logger = Logger::Create(name);
+
+   Logger::SetAsync(true);
+   for (int i = 0; i < 3; ++i)
+   {
+      logger->info("Message {}", i);
+   }
+
+   // Queued messages are written before returning
+   Logger::Shutdown();
+
+   EXPECT_EQ(GetMessages(*sink, name),
+             (std::vector<std::string> {"Message 0", "Message 1", "Message 2"}));
+}
+
+} // namespace util
+} // namespace scwx
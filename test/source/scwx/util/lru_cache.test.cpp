@@ -0,0 +1,153 @@
+#include <scwx/util/lru_cache.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(LruCacheTest, EvictsLeastRecentlyUsedBytes)
+{
+   LruCache<std::string, int> cache {100};
+
+   auto a = std::make_shared<int>(1);
+   auto b = std::make_shared<int>(2);
+   auto c = std::make_shared<int>(3);
+
+   cache.Insert("x", a, 40);
+   cache.Insert("y", b, 40);
+
+   // Touching a makes b the least recently used
+   cache.Insert("x", a, 40);
+   cache.Insert("x", c, 40);
+
+   EXPECT_EQ(cache.size(), 2u);
+   EXPECT_EQ(cache.size_bytes(), 80u);
+   EXPECT_EQ(cache.size("x"), 2u);
+   EXPECT_EQ(cache.size("y"), 0u);
+   EXPECT_EQ(cache.size_bytes("x"), 80u);
+   EXPECT_EQ(b.use_count(), 1);
+   EXPECT_EQ(a.use_count(), 2);
+}
+
+TEST(LruCacheTest, RetainsMostRecentOversizedObject)
+{
+   LruCache<std::string, int> cache {100};
+
+   auto a = std::make_shared<int>(1);
+   auto b = std::make_shared<int>(2);
+
+   cache.Insert("x", a, 50);
+   cache.Insert("x", b, 200);
+
+   EXPECT_EQ(cache.size(), 1u);
+   EXPECT_EQ(cache.size_bytes(), 200u);
+   EXPECT_EQ(b.use_count(), 2);
+}
+
+TEST(LruCacheTest, GroupCountLimit)
+{
+   LruCache<std::string, int> cache {};
+
+   std::vector<std::shared_ptr<int>> values {};
+   for (int i = 0; i < 5; ++i)
+   {
+      values.push_back(std::make_shared<int>(i));
+   }
+
+   cache.set_count_limit("x", 2);
+
+   cache.Insert("x", values[0], 1);
+   cache.Insert("y", values[1], 1);
+   cache.Insert("x", values[2], 1);
+   cache.Insert("x", values[3], 1);
+
+   EXPECT_EQ(cache.size("x"), 2u);
+   EXPECT_EQ(cache.size("y"), 1u);
+   EXPECT_EQ(values[0].use_count(), 1);
+
+   cache.set_count_limit("x", 1);
+
+   EXPECT_EQ(cache.size("x"), 1u);
+   EXPECT_EQ(values[2].use_count(), 1);
+   EXPECT_EQ(values[3].use_count(), 2);
+}
+
+TEST(LruCacheTest, ReaccountsUpdatedSize)
+{
+   LruCache<std::string, int> cache {};
+
+   auto a = std::make_shared<int>(1);
+
+   cache.Insert("x", a, 10);
+   cache.Insert("x", a, 30);
+
+   EXPECT_EQ(cache.size(), 1u);
+   EXPECT_EQ(cache.size_bytes(), 30u);
+
+   cache.set_byte_limit(20);
+
+   // The most recently used object is retained
+   EXPECT_EQ(cache.size(), 1u);
+
+   cache.Erase(a);
+
+   EXPECT_EQ(cache.size(), 0u);
+   EXPECT_EQ(cache.size_bytes(), 0u);
+   EXPECT_EQ(a.use_count(), 1);
+}
+
+TEST(LruCacheTest, EraseGroup)
+{
+   LruCache<std::string, int> cache {};
+
+   auto a = std::make_shared<int>(1);
+   auto b = std::make_shared<int>(2);
+   auto c = std::make_shared<int>(3);
+
+   cache.Insert("x", a, 10);
+   cache.Insert("y", b, 20);
+   cache.Insert("x", c, 30);
+
+   cache.EraseGroup("x");
+
+   EXPECT_EQ(cache.size(), 1u);
+   EXPECT_EQ(cache.size_bytes(), 20u);
+   EXPECT_EQ(cache.size("x"), 0u);
+   EXPECT_EQ(cache.size_bytes("y"), 20u);
+}
+
+TEST(LruCacheTest, TouchAndTrim)
+{
+   LruCache<std::string, int> cache {};
+
+   auto a = std::make_shared<int>(1);
+   auto b = std::make_shared<int>(2);
+   auto c = std::make_shared<int>(3);
+
+   cache.Insert("x1", a, 10);
+   cache.Insert("y1", b, 20);
+   cache.Insert("x2", c, 30);
+
+   // Touching a makes b the least recently used
+   cache.Touch(a);
+
+   EXPECT_EQ(cache.size_bytes_if([](const std::string& group)
+                                 { return group.starts_with("x"); }),
+             40u);
+
+   EXPECT_EQ(cache.Trim(15), 20u);
+   EXPECT_EQ(b.use_count(), 1);
+   EXPECT_EQ(cache.size_bytes(), 40u);
+
+   // The most recently used object is retained
+   EXPECT_EQ(cache.Trim(100), 30u);
+   EXPECT_EQ(cache.size(), 1u);
+   EXPECT_EQ(a.use_count(), 2);
+}
+
+} // namespace util
+} // namespace scwx
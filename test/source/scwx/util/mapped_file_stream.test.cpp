@@ -0,0 +1,49 @@
+#include <scwx/util/mapped_file_stream.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string kLoremIpsum_ {std::string(SCWX_TEST_DATA_DIR) +
+                                       "/text/lorem-ipsum.txt"};
+
+TEST(MappedFileStream, Read)
+{
+   MappedFileStream is {kLoremIpsum_};
+
+   EXPECT_EQ(is.is_open(), true);
+   EXPECT_EQ(is.is_mapped(), true);
+   EXPECT_EQ(is.good(), true);
+
+   std::string s;
+   s.resize(5u);
+   is.read(s.data(), 5u);
+   EXPECT_EQ(is.good(), true);
+   EXPECT_EQ(s, "Lorem");
+
+   is.seekg(-8, std::ios_base::end);
+   is.read(s.data(), 5u);
+   EXPECT_EQ(is.good(), true);
+   EXPECT_EQ(s, "labor");
+
+   // The mapped data is the same as the data read from the stream
+   auto data = is.data();
+   ASSERT_GE(data.size(), 5u);
+   EXPECT_EQ(std::string(data.data(), 5u), "Lorem");
+}
+
+TEST(MappedFileStream, NotFound)
+{
+   MappedFileStream is {std::string(SCWX_TEST_DATA_DIR) + "/text/not-found"};
+
+   EXPECT_EQ(is.is_open(), false);
+   EXPECT_EQ(is.is_mapped(), false);
+   EXPECT_EQ(is.fail(), true);
+   EXPECT_EQ(is.data().empty(), true);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,53 @@
+#include <scwx/util/memory.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(MemoryTest, GetResidentMemory)
+{
+   EXPECT_GT(GetResidentMemory(), 0u);
+}
+
+static MemoryUsage GetCategoryUsage(const std::string& category)
+{
+   for (auto& usage : GetMemoryUsage())
+   {
+      if (usage.category_ == category)
+      {
+         return usage;
+      }
+   }
+   return {};
+}
+
+TEST(MemoryTest, MemoryCounter)
+{
+   static const std::string kCategory_ {"MemoryTest"};
+
+   {
+      MemoryCounter counter1 {kCategory_};
+      MemoryCounter counter2 {kCategory_};
+
+      counter1.set_bytes(1000u);
+      counter2.set_bytes(24u);
+      EXPECT_EQ(counter1.bytes(), 1000u);
+      EXPECT_EQ(GetCategoryUsage(kCategory_).bytes_, 1024u);
+      EXPECT_EQ(GetCategoryUsage(kCategory_).owners_, 2u);
+
+      counter1.set_bytes(500u);
+      EXPECT_EQ(GetCategoryUsage(kCategory_).bytes_, 524u);
+   }
+
+   // Destroyed counters are no longer accounted for
+   MemoryUsage usage = GetCategoryUsage(kCategory_);
+   EXPECT_EQ(usage.category_, kCategory_);
+   EXPECT_EQ(usage.bytes_, 0u);
+   EXPECT_EQ(usage.owners_, 0u);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,50 @@
+#include <scwx/util/metrics.hpp>
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(MetricsTest, Write)
+{
+   // Values are not recorded while disabled
+   Metrics::Add(Metric::RefreshFailures, "disabled");
+
+   Metrics::SetEnabled(true);
+
+   Metrics::Add(Metric::RefreshFailures, "unidata-nexrad-level2");
+   Metrics::Add(Metric::RefreshFailures, "unidata-nexrad-level2");
+   Metrics::Set(Metric::DataLatency, "KLSX", 90.0);
+   Metrics::Set(Metric::DataLatency, "KLSX", 120.5);
+   Metrics::Observe(Metric::DecodeSeconds, "Level 2", 0.25);
+   Metrics::Observe(Metric::DecodeSeconds, "Level 2", 0.5);
+   Metrics::Set(Metric::DataTime, "K\"X\"", 1.0);
+
+   Metrics::SetEnabled(false);
+
+   std::ostringstream os {};
+   Metrics::Write(os);
+   const std::string metrics = os.str();
+
+   EXPECT_EQ(metrics.find("disabled"), std::string::npos);
+   EXPECT_NE(metrics.find("# TYPE scwx_refresh_failures_total counter\n"
+                          "scwx_refresh_failures_total"
+                          "{source=\"unidata-nexrad-level2\"} 2\n"),
+             std::string::npos);
+   EXPECT_NE(metrics.find("# TYPE scwx_data_latency_seconds gauge\n"
+                          "scwx_data_latency_seconds{site=\"KLSX\"} 120.5\n"),
+             std::string::npos);
+   EXPECT_NE(metrics.find("scwx_decode_seconds_sum{product=\"Level 2\"} 0.75\n"
+                          "scwx_decode_seconds_count{product=\"Level 2\"} 2\n"),
+             std::string::npos);
+   EXPECT_NE(metrics.find("scwx_data_time_seconds{site=\"K\\\"X\\\"\"} 1\n"),
+             std::string::npos);
+   EXPECT_NE(metrics.find("scwx_resident_memory_bytes "), std::string::npos);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,110 @@
+#include <scwx/util/priority_thread_pool.hpp>
+#include <scwx/util/detached_task.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(PriorityThreadPoolTest, RunsHighPriorityFirst)
+{
+   PriorityThreadPool pool {1u};
+
+   std::mutex              mutex {};
+   std::condition_variable cv {};
+   bool                    started  = false;
+   bool                    released = false;
+   std::vector<int>        order {};
+
+   // Occupy the only worker until every task has been queued
+   pool.Post(PriorityThreadPool::Priority::Low,
+             [&]()
+             {
+                std::unique_lock lock {mutex};
+                started = true;
+                cv.notify_all();
+                cv.wait(lock, [&]() { return released; });
+             });
+
+   {
+      std::unique_lock lock {mutex};
+      cv.wait(lock, [&]() { return started; });
+   }
+
+   pool.Post(PriorityThreadPool::Priority::Background,
+             [&]() { order.push_back(4); });
+   pool.Post(PriorityThreadPool::Priority::Low, [&]() { order.push_back(1); });
+   pool.Post(PriorityThreadPool::Priority::Low, [&]() { order.push_back(2); });
+   pool.Post(PriorityThreadPool::Priority::High, [&]() { order.push_back(3); });
+
+   EXPECT_EQ(pool.pending_count(), 4u);
+
+   {
+      std::unique_lock lock {mutex};
+      released = true;
+      cv.notify_all();
+   }
+
+   pool.Join();
+
+   EXPECT_EQ(order, (std::vector<int> {3, 1, 2, 4}));
+   EXPECT_EQ(pool.pending_count(), 0u);
+}
+
+TEST(PriorityThreadPoolTest, ContinuesAfterException)
+{
+   PriorityThreadPool pool {0u};
+
+   bool ran = false;
+
+   pool.Post(PriorityThreadPool::Priority::High,
+             []() { throw std::runtime_error("Task failed"); });
+   pool.Post(PriorityThreadPool::Priority::High, [&]() { ran = true; });
+
+   pool.Join();
+
+   EXPECT_EQ(pool.thread_count(), 1u);
+   EXPECT_TRUE(ran);
+}
+
+static DetachedTask ScheduleStages(PriorityThreadPool&           first,
+                                   PriorityThreadPool&           second,
+                                   std::vector<std::thread::id>& threads)
+{
+   threads.push_back(std::this_thread::get_id());
+
+   co_await first.Schedule(PriorityThreadPool::Priority::High);
+   threads.push_back(std::this_thread::get_id());
+
+   co_await second.Schedule(PriorityThreadPool::Priority::Low);
+   threads.push_back(std::this_thread::get_id());
+}
+
+TEST(PriorityThreadPoolTest, ScheduleResumesOnPool)
+{
+   PriorityThreadPool first {1u};
+   PriorityThreadPool second {1u};
+
+   std::vector<std::thread::id> threads {};
+
+   ScheduleStages(first, second, threads);
+
+   first.Join();
+   second.Join();
+
+   ASSERT_EQ(threads.size(), 3u);
+   EXPECT_NE(threads[0], threads[1]);
+   EXPECT_NE(threads[1], threads[2]);
+   EXPECT_NE(threads[0], threads[2]);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,176 @@
+#include <scwx/util/profiler.hpp>
+
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(ProfilerTest, Labels)
+{
+   const std::uint16_t label1 = Profiler::RegisterLabel("ProfilerTest 1");
+   const std::uint16_t label2 = Profiler::RegisterLabel("ProfilerTest 2");
+
+   EXPECT_NE(label1, 0u);
+   EXPECT_NE(label1, label2);
+   EXPECT_EQ(Profiler::RegisterLabel("ProfilerTest 1"), label1);
+   EXPECT_EQ(Profiler::GetLabel(label2), "ProfilerTest 2");
+   EXPECT_EQ(Profiler::GetLabel(0u), "");
+}
+
+TEST(ProfilerTest, Samples)
+{
+   using namespace std::chrono_literals;
+
+   const auto since = std::chrono::steady_clock::now();
+
+   Profiler::SetEnabled(false);
+   {
+      ScopedTimer timer {ProfileStage::Parse};
+   }
+   EXPECT_TRUE(Profiler::GetSamples(since).empty());
+
+   Profiler::SetEnabled(true);
+
+   const std::uint16_t label = Profiler::RegisterLabel("ProfilerTest Layer");
+   {
+      ScopedTimer timer {ProfileStage::LayerRender, label};
+   }
+
+   // Samples recorded on other threads are retained after the thread exits
+   std::thread thread {[]()
+                       {
+                          const auto begin = std::chrono::steady_clock::now();
+                          Profiler::Record(
+                             ProfileStage::Download, 0u, begin, begin + 5ms);
+                       }};
+   thread.join();
+
+   Profiler::SetEnabled(false);
+
+   auto samples = Profiler::GetSamples(since);
+
+   ASSERT_EQ(samples.size(), 2u);
+   EXPECT_EQ(samples[0].stage_, ProfileStage::LayerRender);
+   EXPECT_EQ(samples[0].label_, label);
+   EXPECT_EQ(samples[1].stage_, ProfileStage::Download);
+   EXPECT_EQ(samples[1].duration_, 5ms);
+
+   // Only samples ending after the given time are returned
+   EXPECT_EQ(Profiler::GetSamples(samples[0].end_).size(), 1u);
+}
+
+TEST(ProfilerTest, Allocations)
+{
+   const auto since = std::chrono::steady_clock::now();
+
+   Profiler::SetEnabled(true);
+   {
+      ScopedTimer timer {ProfileStage::Parse};
+      auto        data = std::make_unique<std::vector<char>>(1000u);
+   }
+   Profiler::SetEnabled(false);
+
+   // Samples from previous tests may end in the future
+   auto samples = Profiler::GetSamples(since);
+   std::erase_if(samples,
+                 [](auto& sample)
+                 { return sample.stage_ != ProfileStage::Parse; });
+   ASSERT_EQ(samples.size(), 1u);
+
+   if (AllocationTracker::IsAvailable())
+   {
+      EXPECT_EQ(samples[0].allocations_.allocations_, 2u);
+      EXPECT_EQ(samples[0].allocations_.bytes_,
+                sizeof(std::vector<char>) + 1000u);
+   }
+   else
+   {
+      EXPECT_EQ(samples[0].allocations_.allocations_, 0u);
+      EXPECT_EQ(samples[0].allocations_.bytes_, 0u);
+   }
+}
+
+TEST(ProfilerTest, Overwrite)
+{
+   const auto since = std::chrono::steady_clock::now() + std::chrono::hours {1};
+
+   for (std::size_t i = 0; i < 20000u; ++i)
+   {
+      const auto end = since + std::chrono::nanoseconds {i + 1};
+      Profiler::Record(ProfileStage::Frame, 0u, end, end);
+   }
+
+   auto samples = Profiler::GetSamples(since);
+
+   // Only the most recent samples are retained
+   ASSERT_EQ(samples.size(), 16384u);
+   EXPECT_EQ(samples.back().end_, since + std::chrono::nanoseconds {20000});
+}
+
+TEST(ProfilerTest, WriteTrace)
+{
+   using namespace std::chrono_literals;
+
+   const auto since = std::chrono::steady_clock::now() + std::chrono::hours {2};
+
+   Profiler::SetThreadName("ProfilerTest \"Main\"");
+
+   const std::uint16_t label = Profiler::RegisterLabel("ProfilerTest Trace");
+   Profiler::Record(ProfileStage::Parse, label, since + 1ms, since + 3ms);
+   Profiler::Record(ProfileStage::Frame, 0u, since, since + 2ms);
+
+   auto samples = Profiler::GetSamples(since);
+   ASSERT_EQ(samples.size(), 2u);
+   EXPECT_EQ(Profiler::GetThreadName(samples[0].thread_),
+             "ProfilerTest \"Main\"");
+
+   std::ostringstream os {};
+   Profiler::WriteTrace(os, since);
+
+   const std::string trace = os.str();
+
+   // Allocations are written if they are being counted
+   const std::string allocationArgs =
+      AllocationTracker::IsAvailable() ?
+         ",\"args\":{\"allocations\":0,\"bytes\":0}" :
+         "";
+
+   // Timestamps are relative to the earliest sample, in microseconds
+   EXPECT_NE(trace.find(fmt::format(
+                "{{\"name\":\"Parse: ProfilerTest Trace\",\"cat\":\"Parse\","
+                "\"ph\":\"X\",\"ts\":1000.000,\"dur\":2000.000,\"pid\":1,"
+                "\"tid\":{}{}}}",
+                samples[0].thread_,
+                allocationArgs)),
+             std::string::npos);
+   EXPECT_NE(trace.find("\"ts\":0.000,\"dur\":2000.000"), std::string::npos);
+   EXPECT_NE(trace.find("\"args\":{\"name\":\"ProfilerTest \\\"Main\\\"\"}"),
+             std::string::npos);
+
+   // GPU samples are written to a separate thread
+   Profiler::Record(ProfileStage::GpuLayerRender, label, since, since + 1ms);
+
+   os.str({});
+   Profiler::WriteTrace(os, since);
+
+   const std::string gpuTrace = os.str();
+   EXPECT_NE(
+      gpuTrace.find("\"name\":\"GPU Layer Render: ProfilerTest Trace\","
+                    "\"cat\":\"GPU Layer Render\",\"ph\":\"X\","
+                    "\"ts\":0.000,\"dur\":1000.000,\"pid\":1,\"tid\":0}"),
+      std::string::npos);
+   EXPECT_NE(gpuTrace.find("\"tid\":0,\"args\":{\"name\":\"GPU\"}"),
+             std::string::npos);
+}
+
+} // namespace util
+} // namespace scwx
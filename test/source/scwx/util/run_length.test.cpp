@@ -0,0 +1,51 @@
+#include <scwx/util/run_length.hpp>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(RunLengthTest, Expand)
+{
+   const std::vector<std::uint8_t> data {0x31, 0x02, 0xf5, 0x1a, 0x00};
+
+   EXPECT_EQ(CountRunLength4(data.data(), data.size()), 19u);
+
+   std::vector<std::uint8_t> levels(24, 0xff);
+   std::size_t               count =
+      ExpandRunLength4(data.data(), data.size(), levels.data(), levels.size());
+
+   std::vector<std::uint8_t> expected {1, 1, 1};
+   expected.insert(expected.end(), 15, 5);
+   expected.push_back(10);
+   expected.resize(24, 0);
+
+   EXPECT_EQ(count, 19u);
+   EXPECT_EQ(levels, expected);
+}
+
+TEST(RunLengthTest, ExpandTruncated)
+{
+   const std::vector<std::uint8_t> data(40, 0xf3);
+
+   std::vector<std::uint8_t> levels(100, 0xff);
+   std::size_t               count =
+      ExpandRunLength4(data.data(), data.size(), levels.data(), levels.size());
+
+   EXPECT_EQ(count, 100u);
+   EXPECT_EQ(levels, std::vector<std::uint8_t>(100, 3));
+}
+
+TEST(RunLengthTest, ExpandEmpty)
+{
+   const std::vector<std::uint8_t> data(4, 0xf3);
+
+   EXPECT_EQ(ExpandRunLength4(data.data(), data.size(), nullptr, 0), 0u);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,109 @@
+#include <scwx/util/strand.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/asio/steady_timer.hpp>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(StrandTest, RunsTasksInOrder)
+{
+   Strand           strand {"Test"};
+   std::vector<int> order {};
+
+   for (int i = 0; i < 100; ++i)
+   {
+      strand.Post([&order, i]() { order.push_back(i); });
+   }
+
+   strand.Join();
+
+   ASSERT_EQ(order.size(), 100u);
+   for (int i = 0; i < 100; ++i)
+   {
+      EXPECT_EQ(order[i], i);
+   }
+}
+
+TEST(StrandTest, RunsTasksSerially)
+{
+   Strand           strand {"Test", Strand::Priority::Background};
+   std::atomic<int> running {0};
+   std::atomic<int> maxRunning {0};
+
+   for (int i = 0; i < 50; ++i)
+   {
+      strand.Post(
+         [&]()
+         {
+            int current = ++running;
+            maxRunning  = std::max(maxRunning.load(), current);
+            --running;
+         });
+   }
+
+   strand.Join();
+
+   EXPECT_EQ(maxRunning.load(), 1);
+}
+
+TEST(StrandTest, ContinuesAfterException)
+{
+   Strand strand {"Test"};
+   bool   ran = false;
+
+   strand.Post([]() { throw std::runtime_error("Test exception"); });
+   strand.Post([&]() { ran = true; });
+
+   strand.Join();
+
+   EXPECT_TRUE(ran);
+}
+
+TEST(StrandTest, DiscardsTasksAfterJoin)
+{
+   Strand strand {"Test"};
+   bool   ran = false;
+
+   strand.Join();
+   strand.Post([&]() { ran = true; });
+   strand.Join();
+
+   EXPECT_FALSE(ran);
+}
+
+TEST(StrandTest, JoinWaitsForWrappedHandler)
+{
+   Strand                    strand {"Test"};
+   boost::asio::steady_timer timer {strand.get_executor()};
+   bool                      ran = false;
+
+   timer.expires_after(std::chrono::milliseconds(10));
+   timer.async_wait(strand.Wrap([&](const boost::system::error_code& e)
+                                { ran = !e; }));
+
+   strand.Join();
+
+   EXPECT_TRUE(ran);
+}
+
+TEST(StrandTest, ThreadCount)
+{
+   EXPECT_GE(Strand::thread_count(Strand::Priority::Interactive), 1u);
+   EXPECT_GE(Strand::thread_count(Strand::Priority::Background), 1u);
+   EXPECT_LE(Strand::thread_count(Strand::Priority::Background),
+             Strand::thread_count(Strand::Priority::Interactive));
+   EXPECT_GE(Strand::thread_count(Strand::Priority::Blocking),
+             Strand::thread_count(Strand::Priority::Interactive));
+}
+
+} // namespace util
+} // namespace scwx
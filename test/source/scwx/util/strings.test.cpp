@@ -87,5 +87,65 @@ TEST(StringsTest, ParseTokensText)
    EXPECT_EQ(tokens[6], "discarded");
 }
 
+TEST(StringsTest, ParseTokensStringView)
+{
+   static const std::string line {
+      "Icon: 38.5, -90.2, 045, 1, 2, \"hover, text\""};
+
+   std::vector<std::string_view> tokens {};
+   ParseTokens(line, {",", ",", ",", ",", ","}, tokens, 5);
+
+   ASSERT_EQ(tokens.size(), 6);
+   EXPECT_EQ(tokens[0], "38.5");
+   EXPECT_EQ(tokens[1], "-90.2");
+   EXPECT_EQ(tokens[2], "045");
+   EXPECT_EQ(tokens[3], "1");
+   EXPECT_EQ(tokens[4], "2");
+   EXPECT_EQ(tokens[5], "\"hover, text\"");
+
+   // Tokens are cleared before parsing another string
+   ParseTokens(line, {":"}, tokens);
+
+   ASSERT_EQ(tokens.size(), 2);
+   EXPECT_EQ(tokens[0], "Icon");
+}
+
+TEST(StringsTest, SplitTokens)
+{
+   std::vector<std::string_view> tokens {};
+   SplitTokens("  LAT...LON 3862 9018\t3851  9034 ", " \t", tokens);
+
+   ASSERT_EQ(tokens.size(), 5);
+   EXPECT_EQ(tokens[0], "LAT...LON");
+   EXPECT_EQ(tokens[1], "3862");
+   EXPECT_EQ(tokens[2], "9018");
+   EXPECT_EQ(tokens[3], "3851");
+   EXPECT_EQ(tokens[4], "9034");
+
+   // Tokens are appended, and empty tokens are skipped
+   SplitTokens("MOC189-510>512--141800-", "-", tokens);
+
+   ASSERT_EQ(tokens.size(), 8);
+   EXPECT_EQ(tokens[5], "MOC189");
+   EXPECT_EQ(tokens[6], "510>512");
+   EXPECT_EQ(tokens[7], "141800");
+
+   SplitTokens("---", "-", tokens);
+   EXPECT_EQ(tokens.size(), 8);
+}
+
+TEST(StringsTest, ParseNumeric)
+{
+   EXPECT_EQ(ParseNumeric<int>(" -12"), -12);
+   EXPECT_EQ(ParseNumeric<int>("+7"), 7);
+   EXPECT_EQ(ParseNumeric<std::size_t>("2.5"), 2u);
+   EXPECT_DOUBLE_EQ(ParseNumeric<double>("38.125"), 38.125);
+   EXPECT_DOUBLE_EQ(ParseNumeric<double>("-90.5 "), -90.5);
+
+   EXPECT_THROW(ParseNumeric<int>(""), std::invalid_argument);
+   EXPECT_THROW(ParseNumeric<double>("abc"), std::invalid_argument);
+   EXPECT_THROW(ParseNumeric<int>("99999999999"), std::out_of_range);
+}
+
 } // namespace util
 } // namespace scwx
@@ -0,0 +1,36 @@
+#include <scwx/util/time.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(TimeTest, TimeString)
+{
+   using namespace std::chrono;
+   using namespace std::chrono_literals;
+
+   const system_clock::time_point time =
+      sys_days {2021y / May / 27d} + 17h + 57min + 12s;
+
+   EXPECT_EQ(TimeString(time), "2021-05-27 17:57:12 UTC");
+   EXPECT_EQ(TimeString(time, ClockFormat::_12Hour),
+             "2021-05-27 05:57:12 PM UTC");
+
+   // Cached strings are keyed by the time truncated to seconds
+   EXPECT_EQ(TimeString(time + 500ms), "2021-05-27 17:57:12 UTC");
+   EXPECT_EQ(TimeString(time + 1s), "2021-05-27 17:57:13 UTC");
+}
+
+TEST(TimeTest, TimeStringEpoch)
+{
+   const std::chrono::system_clock::time_point epoch {};
+
+   EXPECT_EQ(TimeString(epoch, ClockFormat::_24Hour, nullptr, false), "");
+   EXPECT_EQ(TimeString(epoch), "1970-01-01 00:00:00 UTC");
+}
+
+} // namespace util
+} // namespace scwx
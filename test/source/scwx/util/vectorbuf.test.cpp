@@ -79,5 +79,19 @@ TEST_F(vectorbuf_test, seekg_end)
    EXPECT_EQ(is_.fail(), false);
 }
 
+TEST_F(vectorbuf_test, seekg_pos)
+{
+   char data[4] = {0};
+   is_.read(data, 2);
+   std::streampos pos = is_.tellg();
+   is_.read(data, 3);
+   is_.seekg(pos);
+   is_.read(data, 3);
+
+   EXPECT_EQ(std::string(data), std::string("ile"));
+   EXPECT_EQ(is_.eof(), false);
+   EXPECT_EQ(is_.fail(), false);
+}
+
 } // namespace util
 } // namespace scwx
@@ -0,0 +1,101 @@
+#include <scwx/wsr88d/ar2v_export.hpp>
+#include <scwx/wsr88d/rda/columnar_sweep.hpp>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+class Ar2vExportTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      path_ = std::filesystem::temp_directory_path() / "scwx-ar2v-export-test";
+      std::filesystem::remove_all(path_);
+   }
+
+   void TearDown() override { std::filesystem::remove_all(path_); }
+
+   static std::string ReadFile(const std::filesystem::path& path)
+   {
+      std::ifstream ifs {path, std::ios_base::in | std::ios_base::binary};
+      return {std::istreambuf_iterator<char>(ifs),
+              std::istreambuf_iterator<char>()};
+   }
+
+   std::filesystem::path path_ {};
+};
+
+TEST_F(Ar2vExportTest, ExportZarr)
+{
+   Ar2vFile file;
+   ASSERT_EQ(file.LoadFile(std::string(SCWX_TEST_DATA_DIR) +
+                           "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v"),
+             true);
+
+   ZarrExportOptions options {};
+   options.chunkRadials_ = 100u;
+
+   ASSERT_TRUE(ExportZarr(file, path_.string(), options));
+
+   EXPECT_EQ(ReadFile(path_ / ".zgroup"), R"({"zarr_format": 2})");
+   EXPECT_NE(ReadFile(path_ / ".zattrs").find(R"("radar": "KLSX")"),
+             std::string::npos);
+
+   // The first sweep is the first elevation scan collected
+   auto  radarData     = file.radar_data();
+   auto& elevationScan = radarData.cbegin()->second;
+   auto  sweep =
+      rda::ColumnarSweep::Get(elevationScan, rda::DataBlockType::MomentRef);
+   ASSERT_NE(sweep, nullptr);
+
+   const std::filesystem::path momentPath = path_ / "sweep_00" / "REF";
+   const std::filesystem::path dataPath   = momentPath / "data";
+   EXPECT_NE(ReadFile(dataPath / ".zarray")
+                .find(fmt::format(R"("shape": [{}, {}])",
+                                  sweep->radial_count(),
+                                  sweep->stride())),
+             std::string::npos);
+   EXPECT_TRUE(std::filesystem::exists(momentPath / "azimuth" / "0"));
+   EXPECT_TRUE(std::filesystem::exists(momentPath / "range" / "0"));
+   EXPECT_TRUE(std::filesystem::exists(momentPath / "time" / "0"));
+
+   // Each chunk is full size, and contains the data moments of its radials
+   const std::string compressed = ReadFile(dataPath / "0.0");
+   std::string       chunk {};
+
+   boost::iostreams::filtering_istream in;
+   in.push(boost::iostreams::zlib_decompressor());
+   in.push(boost::iostreams::array_source(compressed.data(),
+                                          compressed.size()));
+   boost::iostreams::copy(in, boost::iostreams::back_inserter(chunk));
+
+   ASSERT_EQ(chunk.size(), options.chunkRadials_ * sweep->stride());
+
+   for (std::size_t i = 0; i < options.chunkRadials_; ++i)
+   {
+      auto moments = sweep->data_moments8(i);
+      EXPECT_EQ(std::memcmp(chunk.data() + i * sweep->stride(),
+                            moments.data(),
+                            moments.size()),
+                0);
+   }
+}
+
+} // namespace wsr88d
+} // namespace scwx
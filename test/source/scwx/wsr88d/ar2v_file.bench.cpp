@@ -0,0 +1,46 @@
+#include <scwx/wxbench.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/util/vectorbuf.hpp>
+
+#include <istream>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static void Ar2vFileLoadData(benchmark::State& state, const std::string& file)
+{
+   std::vector<char> data = bench::ReadTestData("/nexrad/level2/" + file);
+   if (data.empty())
+   {
+      state.SkipWithError("Could not read test data");
+      return;
+   }
+
+   bench::RunDecoder(state,
+                     data.size(),
+                     [&]()
+                     {
+                        util::vectorbuf buf {data};
+                        buf.update_read_pointers(data.size());
+                        std::istream is {&buf};
+
+                        Ar2vFile ar2vFile;
+                        return ar2vFile.LoadData(is);
+                     });
+}
+
+BENCHMARK_CAPTURE(Ar2vFileLoadData, KCLE, std::string {"KCLE20021110_221234"})
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Ar2vFileLoadData,
+                  KLSX,
+                  std::string {"Level2_KLSX_20210527_1757.ar2v"})
+   ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Ar2vFileLoadData,
+                  TSTL,
+                  std::string {"Level2_TSTL_20220213_2357.ar2v"})
+   ->Unit(benchmark::kMillisecond);
+
+} // namespace wsr88d
+} // namespace scwx
@@ -1,4 +1,10 @@
 #include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/rda/rda_status_data.hpp>
+#include <scwx/wsr88d/rda/rda_types.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
 
 #include <gtest/gtest.h>
 
@@ -34,5 +40,229 @@ INSTANTIATE_TEST_SUITE_P(
                    std::pair<std::string, std::size_t> //
                    {"/nexrad/level2/Level2_TSTL_20220213_2357.ar2v", 5763}));
 
+TEST(Ar2vFile, LoadLDMRecords)
+{
+   static constexpr std::size_t kVolumeHeaderSize = 24;
+
+   std::ifstream f(std::string(SCWX_TEST_DATA_DIR) +
+                      "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v",
+                   std::ios_base::in | std::ios_base::binary);
+   std::string   data {std::istreambuf_iterator<char>(f),
+                     std::istreambuf_iterator<char>()};
+
+   ASSERT_GT(data.size(), kVolumeHeaderSize + 4);
+
+   // Split the volume into the first LDM record, and the remaining records
+   const auto* controlWord =
+      reinterpret_cast<const std::uint8_t*>(&data[kVolumeHeaderSize]);
+   std::int32_t recordSize = static_cast<std::int32_t>(
+      (controlWord[0] << 24) | (controlWord[1] << 16) | (controlWord[2] << 8) |
+      controlWord[3]);
+   std::size_t firstChunkSize = kVolumeHeaderSize + 4 + std::abs(recordSize);
+
+   std::istringstream firstChunk {data.substr(0, firstChunkSize)};
+   std::istringstream nextChunk {data.substr(firstChunkSize)};
+
+   std::size_t completedElevations = 0;
+
+   Ar2vFile file;
+   file.SetElevationCompleteCallback([&](std::uint16_t, float)
+                                     { ++completedElevations; });
+
+   EXPECT_EQ(file.LoadData(firstChunk), true);
+   EXPECT_EQ(file.LoadLDMRecords(nextChunk), true);
+   EXPECT_EQ(file.message_count(), 11167);
+   EXPECT_EQ(completedElevations, file.radar_data().size());
+}
+
+TEST(Ar2vFile, ElevationCompleteCallback)
+{
+   Ar2vFile file;
+   ASSERT_EQ(file.LoadFile(std::string(SCWX_TEST_DATA_DIR) +
+                           "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v"),
+             true);
+
+   // Elevations completed before the callback is set are reported immediately
+   std::vector<float> elevationAngles {};
+   file.SetElevationCompleteCallback(
+      [&](std::uint16_t, float elevationAngle)
+      { elevationAngles.push_back(elevationAngle); });
+
+   ASSERT_EQ(elevationAngles.size(), file.radar_data().size());
+   EXPECT_NEAR(elevationAngles.front(), 0.5f, 0.05f);
+}
+
+TEST(Ar2vFile, LoadLDMRecordsPartial)
+{
+   static constexpr std::size_t kVolumeHeaderSize = 24;
+
+   const std::string filename = std::string(SCWX_TEST_DATA_DIR) +
+                                "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   std::string   data {std::istreambuf_iterator<char>(f),
+                     std::istreambuf_iterator<char>()};
+
+   ASSERT_GT(data.size(), kVolumeHeaderSize + 4);
+
+   auto recordEnd = [&data](std::size_t offset)
+   {
+      const auto* controlWord =
+         reinterpret_cast<const std::uint8_t*>(&data[offset]);
+      std::int32_t recordSize = static_cast<std::int32_t>(
+         (controlWord[0] << 24) | (controlWord[1] << 16) |
+         (controlWord[2] << 8) | controlWord[3]);
+      return std::min<std::size_t>(offset + 4 + std::abs(recordSize),
+                                   data.size());
+   };
+
+   std::size_t        offset = recordEnd(kVolumeHeaderSize);
+   std::istringstream firstChunk {data.substr(0, offset)};
+
+   Ar2vFile file;
+   ASSERT_EQ(file.LoadData(firstChunk), true);
+
+   // Load one LDM record at a time, as a ranged load would
+   while (offset + 4 < data.size())
+   {
+      std::size_t        end = recordEnd(offset);
+      std::istringstream chunk {data.substr(offset, end - offset)};
+      offset = end;
+
+      EXPECT_EQ(file.LoadLDMRecords(chunk, offset + 4 < data.size()), true);
+
+      // Elevation scans being loaded are not returned
+      for (auto& [elevationIndex, elevationScan] : file.radar_data())
+      {
+         ASSERT_FALSE(elevationScan->empty());
+
+         auto radialStatus = static_cast<rda::RadialStatus>(
+            elevationScan->crbegin()->second->radial_status());
+         EXPECT_TRUE(radialStatus == rda::RadialStatus::EndOfElevation ||
+                     radialStatus == rda::RadialStatus::EndOfVolumeScan);
+      }
+   }
+
+   Ar2vFile completeFile;
+   ASSERT_EQ(completeFile.LoadFile(filename), true);
+   EXPECT_EQ(file.radar_data().size(), completeFile.radar_data().size());
+}
+
+TEST(Ar2vFile, Compress)
+{
+   Ar2vFile file;
+   ASSERT_EQ(file.LoadFile(std::string(SCWX_TEST_DATA_DIR) +
+                           "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v"),
+             true);
+
+   auto volume = file.Compress();
+   ASSERT_NE(volume, nullptr);
+   EXPECT_LT(volume->compressed_size(), volume->decompressed_size());
+
+   Ar2vFile restoredFile;
+   EXPECT_EQ(restoredFile.LoadCompressed(*volume), true);
+   EXPECT_EQ(restoredFile.message_count(), file.message_count());
+   EXPECT_EQ(restoredFile.radar_data().size(), file.radar_data().size());
+   EXPECT_EQ(restoredFile.icao(), file.icao());
+   EXPECT_EQ(restoredFile.start_time(), file.start_time());
+}
+
+TEST(Ar2vFile, CompressAfterDecode)
+{
+   Ar2vFile file;
+   ASSERT_EQ(file.LoadFile(std::string(SCWX_TEST_DATA_DIR) +
+                           "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v"),
+             true);
+
+   // Accessing 16-bit moment data decodes it in place within the records
+   bool decoded = false;
+   for (auto& [elevationIndex, elevationScan] : file.radar_data())
+   {
+      for (auto& [azimuthIndex, radial] : *elevationScan)
+      {
+         for (rda::DataBlockType dataBlockType :
+              rda::MomentDataBlockTypeIterator())
+         {
+            auto momentData = radial->moment_data_block(dataBlockType);
+            if (momentData != nullptr && momentData->data_word_size() == 16)
+            {
+               momentData->data_moments();
+               decoded = true;
+            }
+         }
+      }
+   }
+
+   ASSERT_TRUE(decoded);
+   EXPECT_EQ(file.Compress(), nullptr);
+}
+
+TEST(Ar2vFile, Metadata)
+{
+   static const std::string kFilename {
+      std::string(SCWX_TEST_DATA_DIR) +
+      "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v"};
+
+   Ar2vFile file;
+   ASSERT_EQ(file.LoadFile(kFilename), true);
+
+   // Metadata messages are parsed when first accessed
+   auto rdaStatusData = file.rda_status_data();
+   ASSERT_NE(rdaStatusData, nullptr);
+   EXPECT_EQ(file.rda_status_data(), rdaStatusData);
+
+   Ar2vFile skippedFile;
+   skippedFile.SetMetadataEnabled(false);
+   ASSERT_EQ(skippedFile.LoadFile(kFilename), true);
+
+   EXPECT_EQ(skippedFile.rda_status_data(), nullptr);
+   EXPECT_EQ(skippedFile.performance_maintenance_data(), nullptr);
+   EXPECT_LT(skippedFile.message_count(), file.message_count());
+   EXPECT_EQ(skippedFile.radar_data().size(), file.radar_data().size());
+}
+
+TEST(Ar2vFile, ElevationScans)
+{
+   Ar2vFile file;
+   ASSERT_EQ(file.LoadFile(std::string(SCWX_TEST_DATA_DIR) +
+                           "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v"),
+             true);
+
+   auto elevationScans = file.elevation_scans(rda::DataBlockType::MomentRef);
+   ASSERT_FALSE(elevationScans.empty());
+
+   // The newest scan not newer than the selected time is selected, otherwise
+   // the first scan of the elevation
+   for (auto& [codedElevation, scans] : elevationScans)
+   {
+      float elevation = Ar2vFile::DecodeElevation(codedElevation);
+      EXPECT_EQ(Ar2vFile::CodeElevation(elevation), codedElevation);
+
+      auto [firstScan, firstCut, firstCuts] = file.GetElevationScan(
+         rda::DataBlockType::MomentRef, elevation, {});
+      EXPECT_EQ(firstScan, scans.cbegin()->second);
+      EXPECT_FLOAT_EQ(firstCut, elevation);
+      EXPECT_EQ(firstCuts.size(), elevationScans.size());
+
+      auto [latestScan, latestCut, latestCuts] =
+         file.GetElevationScan(rda::DataBlockType::MomentRef,
+                               elevation,
+                               std::chrono::system_clock::time_point::max());
+      EXPECT_EQ(latestScan, scans.crbegin()->second);
+
+      auto [foundScan, foundCut] = file.FindElevationScan(
+         rda::DataBlockType::MomentRef, elevation, {});
+      EXPECT_EQ(foundScan, firstScan);
+      EXPECT_FLOAT_EQ(foundCut, firstCut);
+   }
+
+   auto elevationCuts = file.elevation_cuts(rda::DataBlockType::MomentRef);
+   EXPECT_EQ(elevationCuts.size(), elevationScans.size());
+   EXPECT_TRUE(std::is_sorted(elevationCuts.cbegin(), elevationCuts.cend()));
+
+   EXPECT_TRUE(file.elevation_scans(rda::DataBlockType::Unknown).empty());
+   EXPECT_TRUE(file.elevation_cuts(rda::DataBlockType::Unknown).empty());
+}
+
 } // namespace wsr88d
 } // namespace scwx
@@ -0,0 +1,97 @@
+#include <scwx/wxbench.hpp>
+#include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/util/vectorbuf.hpp>
+
+#include <istream>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static void Level3FileLoadData(benchmark::State& state, const std::string& file)
+{
+   std::vector<char> data = bench::ReadTestData("/nexrad/level3/" + file);
+   if (data.empty())
+   {
+      state.SkipWithError("Could not read test data");
+      return;
+   }
+
+   bench::RunDecoder(state,
+                     data.size(),
+                     [&]()
+                     {
+                        util::vectorbuf buf {data};
+                        buf.update_read_pointers(data.size());
+                        std::istream is {&buf};
+
+                        Level3File level3File;
+                        return level3File.LoadData(is);
+                     });
+}
+
+// One file for each product type in the test data
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  GSM,
+                  std::string {"KLSX_NXUS63_GSMLSX_202112110238"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  N0R,
+                  std::string {"KLSX_SDUS53_N0RLSX_202105041639"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  N0Z,
+                  std::string {"KLSX_SDUS73_N0ZLSX_202105042031"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  N0V,
+                  std::string {"KLSX_SDUS53_N0VLSX_202105042201"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  NSW,
+                  std::string {"KLSX_SDUS63_NSWLSX_202112110135"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  N1M,
+                  std::string {"KLSX_SDUS83_N1MLSX_202112110200"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  OHA,
+                  std::string {"KLSX_SDUS83_OHALSX_202112110109"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  DAA,
+                  std::string {"KLSX_SDUS83_DAALSX_202112110135"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  PTA,
+                  std::string {"KLSX_SDUS33_PTALSX_202101201007"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  DTA,
+                  std::string {"KLSX_SDUS83_DTALSX_202112110209"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  DU3,
+                  std::string {"KLSX_SDUS83_DU3LSX_202112110209"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  DOD,
+                  std::string {"KLSX_SDUS83_DODLSX_202112110244"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  DSD,
+                  std::string {"KLSX_SDUS83_DSDLSX_202112110135"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  DPR,
+                  std::string {"KLSX_SDUS83_DPRLSX_202112110140"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  HHC,
+                  std::string {"KLSX_SDUS83_HHCLSX_202112110140"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  N1U,
+                  std::string {"Level3_LSX_N1U_20211228_0446.nids"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  NCR,
+                  std::string {"Level3_STL_NCR_20211211_0200.nids"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  TZ0,
+                  std::string {"Level3_STL_TZ0_20211211_0200.nids"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  TV0,
+                  std::string {"Level3_STL_TV0_20211211_0200.nids"});
+BENCHMARK_CAPTURE(Level3FileLoadData,
+                  TZL,
+                  std::string {"Level3_STL_TZL_20211211_0200.nids"});
+
+} // namespace wsr88d
+} // namespace scwx
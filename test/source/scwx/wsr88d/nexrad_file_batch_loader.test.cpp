@@ -0,0 +1,133 @@
+#include <scwx/wsr88d/nexrad_file_batch_loader.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/level3_file.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static const std::string kLevel2Filename_ =
+   std::string(SCWX_TEST_DATA_DIR) +
+   "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+static const std::string kLevel3Filename_ =
+   std::string(SCWX_TEST_DATA_DIR) +
+   "/nexrad/level3/KLSX_SDUS23_N2QLSX_202112110250";
+
+TEST(NexradFileBatchLoader, DeliversInOrder)
+{
+   NexradFileBatchLoader loader {4, 2};
+   loader.AddFiles({kLevel3Filename_,
+                    kLevel2Filename_,
+                    "invalid_file",
+                    kLevel3Filename_,
+                    kLevel2Filename_});
+
+   std::vector<std::size_t>                 indices {};
+   std::vector<std::string>                 sources {};
+   std::vector<std::shared_ptr<NexradFile>> files {};
+
+   loader.SetFileLoadedCallback(
+      [&](std::size_t                 index,
+          const std::string&          source,
+          std::shared_ptr<NexradFile> file)
+      {
+         indices.push_back(index);
+         sources.push_back(source);
+         files.push_back(file);
+      });
+
+   std::size_t loadedCount = loader.Run();
+
+   EXPECT_EQ(loadedCount, 4u);
+   ASSERT_EQ(indices.size(), 5u);
+   ASSERT_EQ(files.size(), 5u);
+
+   for (std::size_t i = 0; i < indices.size(); ++i)
+   {
+      EXPECT_EQ(indices[i], i);
+   }
+
+   // Sources are delivered in time order, with sources without a time first
+   EXPECT_EQ(sources,
+             (std::vector<std::string> {"invalid_file",
+                                        kLevel2Filename_,
+                                        kLevel2Filename_,
+                                        kLevel3Filename_,
+                                        kLevel3Filename_}));
+
+   EXPECT_EQ(files[0], nullptr);
+   EXPECT_NE(std::dynamic_pointer_cast<Ar2vFile>(files[1]), nullptr);
+   EXPECT_NE(std::dynamic_pointer_cast<Ar2vFile>(files[2]), nullptr);
+   EXPECT_NE(std::dynamic_pointer_cast<Level3File>(files[3]), nullptr);
+   EXPECT_NE(std::dynamic_pointer_cast<Level3File>(files[4]), nullptr);
+}
+
+TEST(NexradFileBatchLoader, DeliversInTimeOrder)
+{
+   NexradFileBatchLoader loader {2, 2};
+   loader.AddFiles({"KLSX20210527_180512_V06",
+                    "KLSX_SDUS23_N0BLSX_202105271750",
+                    "KLSX_N0B_2021_05_27_17_55_30",
+                    "KLSX20210527_175706_V06"});
+
+   std::vector<std::string> sources {};
+
+   loader.SetFileLoadedCallback(
+      [&](std::size_t /* index */,
+          const std::string& source,
+          std::shared_ptr<NexradFile> /* file */)
+      { sources.push_back(source); });
+
+   loader.Run();
+
+   EXPECT_EQ(sources,
+             (std::vector<std::string> {"KLSX_SDUS23_N0BLSX_202105271750",
+                                        "KLSX_N0B_2021_05_27_17_55_30",
+                                        "KLSX20210527_175706_V06",
+                                        "KLSX20210527_180512_V06"}));
+}
+
+TEST(NexradFileBatchLoader, Cancel)
+{
+   NexradFileBatchLoader loader {2, 2};
+   loader.AddFiles({kLevel3Filename_, kLevel3Filename_, kLevel3Filename_});
+
+   std::size_t callbackCount = 0;
+
+   loader.SetFileLoadedCallback(
+      [&](std::size_t /* index */,
+          const std::string& /* source */,
+          std::shared_ptr<NexradFile> /* file */)
+      {
+         ++callbackCount;
+         loader.Cancel();
+      });
+
+   loader.Run();
+
+   EXPECT_EQ(callbackCount, 1u);
+}
+
+TEST(NexradFileBatchLoader, CancelBeforeRun)
+{
+   NexradFileBatchLoader loader {2, 2};
+   loader.AddFiles({kLevel3Filename_, kLevel3Filename_});
+
+   std::size_t callbackCount = 0;
+
+   loader.SetFileLoadedCallback(
+      [&](std::size_t /* index */,
+          const std::string& /* source */,
+          std::shared_ptr<NexradFile> /* file */) { ++callbackCount; });
+
+   loader.Cancel();
+
+   EXPECT_EQ(loader.Run(), 0u);
+   EXPECT_EQ(callbackCount, 0u);
+}
+
+} // namespace wsr88d
+} // namespace scwx
@@ -50,5 +50,51 @@ TEST(NexradFileFactory, Level3)
    EXPECT_NE(level3File, nullptr);
 }
 
+TEST(NexradFileFactory, ProbeLevel2V06)
+{
+   std::string filename = std::string(SCWX_TEST_DATA_DIR) +
+                          "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+   std::optional<NexradFileInfo> info = NexradFileFactory::Probe(filename);
+   std::shared_ptr<Ar2vFile>     level2File =
+      std::dynamic_pointer_cast<Ar2vFile>(NexradFileFactory::Create(filename));
+
+   ASSERT_TRUE(info.has_value());
+   ASSERT_NE(level2File, nullptr);
+   ASSERT_NE(level2File->vcp_data(), nullptr);
+
+   EXPECT_EQ(info->group_, common::RadarProductGroup::Level2);
+   EXPECT_EQ(info->radarId_, "KLSX");
+   EXPECT_EQ(info->time_, level2File->start_time());
+   EXPECT_EQ(info->vcp_, level2File->vcp_data()->pattern_number());
+   EXPECT_EQ(info->elevationCuts_.size(),
+             level2File->vcp_data()->number_of_elevation_cuts());
+}
+
+TEST(NexradFileFactory, ProbeLevel2V06Gzip)
+{
+   std::string filename = std::string(SCWX_TEST_DATA_DIR) +
+                          "/nexrad/level2/KLSX20130206_175044_V06.gz";
+
+   std::optional<NexradFileInfo> info = NexradFileFactory::Probe(filename);
+
+   ASSERT_TRUE(info.has_value());
+   EXPECT_EQ(info->group_, common::RadarProductGroup::Level2);
+   EXPECT_EQ(info->radarId_, "KLSX");
+   EXPECT_FALSE(info->elevationCuts_.empty());
+}
+
+TEST(NexradFileFactory, ProbeLevel3)
+{
+   std::string filename = std::string(SCWX_TEST_DATA_DIR) +
+                          "/nexrad/level3/KLSX_SDUS23_N2QLSX_202112110250";
+
+   std::optional<NexradFileInfo> info = NexradFileFactory::Probe(filename);
+
+   ASSERT_TRUE(info.has_value());
+   EXPECT_EQ(info->group_, common::RadarProductGroup::Level3);
+   EXPECT_EQ(info->elevationCuts_.size(), 1u);
+}
+
 } // namespace wsr88d
 } // namespace scwx
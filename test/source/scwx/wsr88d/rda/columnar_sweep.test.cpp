@@ -0,0 +1,58 @@
+#include <scwx/wsr88d/rda/columnar_sweep.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+TEST(ColumnarSweep, MatchesElevationScan)
+{
+   Ar2vFile file;
+   ASSERT_EQ(file.LoadFile(std::string(SCWX_TEST_DATA_DIR) +
+                           "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v"),
+             true);
+
+   auto radarData = file.radar_data();
+   ASSERT_FALSE(radarData.empty());
+
+   auto& elevationScan = radarData.cbegin()->second;
+   auto  sweep = ColumnarSweep::Get(elevationScan, DataBlockType::MomentRef);
+
+   ASSERT_NE(sweep, nullptr);
+   EXPECT_TRUE(sweep->complete());
+   EXPECT_EQ(sweep->radial_count(), elevationScan->size());
+   EXPECT_EQ(sweep->data_word_size(), 8u);
+
+   // The sweep is shared while the elevation scan is unchanged
+   EXPECT_EQ(ColumnarSweep::Get(elevationScan, DataBlockType::MomentRef),
+             sweep);
+
+   std::size_t i = 0;
+   for (auto& radial : *elevationScan)
+   {
+      auto block = radial.second->moment_data_block(DataBlockType::MomentRef);
+      ASSERT_NE(block, nullptr);
+
+      EXPECT_EQ(sweep->radials()[i], radial.first);
+      EXPECT_EQ(sweep->azimuths()[i], radial.second->azimuth_angle().value());
+
+      auto moments = sweep->data_moments8(i);
+      ASSERT_EQ(moments.size(), block->number_of_data_moment_gates());
+      EXPECT_EQ(
+         std::memcmp(moments.data(), block->data_moments(), moments.size()),
+         0);
+
+      ++i;
+   }
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
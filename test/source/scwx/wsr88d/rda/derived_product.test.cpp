@@ -0,0 +1,328 @@
+#include <scwx/wsr88d/rda/derived_product.hpp>
+#include <scwx/wsr88d/rda/derived_radar_data.hpp>
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+class TestMomentDataBlock : public GenericRadarData::MomentDataBlock
+{
+public:
+   explicit TestMomentDataBlock(std::vector<std::uint8_t> dataMoments,
+                                float                     offset,
+                                float                     range    = 2.0f,
+                                float                     interval = 0.25f) :
+       dataMoments_ {std::move(dataMoments)},
+       offset_ {offset},
+       range_ {range},
+       interval_ {interval}
+   {
+   }
+
+   std::uint16_t number_of_data_moment_gates() const override
+   {
+      return static_cast<std::uint16_t>(dataMoments_.size());
+   }
+   units::kilometers<float> data_moment_range() const override
+   {
+      return units::kilometers<float> {range_};
+   }
+   std::int16_t data_moment_range_raw() const override
+   {
+      return static_cast<std::int16_t>(range_ * 1000.0f);
+   }
+   units::kilometers<float> data_moment_range_sample_interval() const override
+   {
+      return units::kilometers<float> {interval_};
+   }
+   std::uint16_t data_moment_range_sample_interval_raw() const override
+   {
+      return static_cast<std::uint16_t>(interval_ * 1000.0f);
+   }
+   std::int16_t snr_threshold_raw() const override { return 0; }
+   std::uint8_t data_word_size() const override { return 8; }
+   float        scale() const override { return 2.0f; }
+   float        offset() const override { return offset_; }
+   const void*  data_moments() const override { return dataMoments_.data(); }
+
+private:
+   std::vector<std::uint8_t> dataMoments_;
+   float                     offset_;
+   float                     range_;
+   float                     interval_;
+};
+
+class TestRadarData : public GenericRadarData
+{
+public:
+   explicit TestRadarData(float                                  azimuth,
+                          DataBlockType                          type,
+                          std::shared_ptr<TestMomentDataBlock> block) :
+       azimuth_ {azimuth}, type_ {type}, block_ {std::move(block)}
+   {
+   }
+
+   std::uint32_t collection_time() const override { return 0u; }
+   std::uint16_t modified_julian_date() const override { return 0u; }
+   units::degrees<float> azimuth_angle() const override
+   {
+      return units::degrees<float> {azimuth_};
+   }
+   std::uint16_t azimuth_number() const override { return 0u; }
+   std::uint16_t radial_status() const override { return 0u; }
+   std::uint16_t elevation_number() const override { return 0u; }
+   std::uint16_t volume_coverage_pattern_number() const override
+   {
+      return 0u;
+   }
+
+   std::shared_ptr<GenericRadarData::MomentDataBlock>
+   moment_data_block(DataBlockType type) const override
+   {
+      return (type == type_) ? block_ : nullptr;
+   }
+
+   bool Parse(std::istream&) override { return true; }
+
+private:
+   float                                azimuth_;
+   DataBlockType                        type_;
+   std::shared_ptr<TestMomentDataBlock> block_;
+};
+
+static std::uint8_t
+GetLevel(const std::shared_ptr<ElevationScan>& elevationScan,
+         std::uint16_t                         radial,
+         DataBlockType                         type,
+         std::uint16_t                         gate)
+{
+   auto block = elevationScan->at(radial)->moment_data_block(type);
+   return static_cast<const std::uint8_t*>(block->data_moments())[gate];
+}
+
+TEST(DerivedProduct, RegisteredProducts)
+{
+   EXPECT_NE(DerivedProduct::Get(common::Level2Product::DealiasedVelocity),
+             nullptr);
+   EXPECT_NE(DerivedProduct::Get(common::Level2Product::StormRelativeVelocity),
+             nullptr);
+   EXPECT_NE(DerivedProduct::Get(common::Level2Product::CompositeReflectivity),
+             nullptr);
+   EXPECT_NE(DerivedProduct::Get(common::Level2Product::EchoTops), nullptr);
+   EXPECT_EQ(DerivedProduct::Get(common::Level2Product::Reflectivity),
+             nullptr);
+
+   EXPECT_TRUE(DerivedProduct::Get(common::Level2Product::CompositeReflectivity)
+                  ->is_volume_product());
+   EXPECT_TRUE(DerivedProduct::Get(common::Level2Product::EchoTops)
+                  ->is_volume_product());
+   EXPECT_TRUE(DerivedProduct::Get(common::Level2Product::StormRelativeVelocity)
+                  ->is_storm_relative());
+}
+
+static void CreateVolume(std::shared_ptr<ElevationScan>& lowScan,
+                         std::shared_ptr<ElevationScan>& highScan)
+{
+   // Reflectivity is coded with a scale of 2 and an offset of 66
+   lowScan  = std::make_shared<ElevationScan>();
+   highScan = std::make_shared<ElevationScan>();
+
+   (*lowScan)[0] = std::make_shared<TestRadarData>(
+      0.25f,
+      DataBlockType::MomentRef,
+      std::make_shared<TestMomentDataBlock>(
+         std::vector<std::uint8_t> {106, 0, 126, 1}, 66.0f));
+   (*lowScan)[1] = std::make_shared<TestRadarData>(
+      0.75f,
+      DataBlockType::MomentRef,
+      std::make_shared<TestMomentDataBlock>(
+         std::vector<std::uint8_t> {86, 86, 86, 86}, 66.0f));
+
+   // A single 1 degree radial, with gates twice as long, covering both
+   (*highScan)[0] = std::make_shared<TestRadarData>(
+      0.5f,
+      DataBlockType::MomentRef,
+      std::make_shared<TestMomentDataBlock>(
+         std::vector<std::uint8_t> {116, 136}, 66.0f, 2.125f, 0.5f));
+}
+
+static std::uint8_t GetEchoTopLevel(float range, float elevationAngle)
+{
+   // Beam height assuming 4/3 earth radius, coded in tenths of a kilometer
+   // with an offset of 2
+   const double r     = 6371.0 * 4.0 / 3.0;
+   const double theta = elevationAngle * std::numbers::pi / 180.0;
+   const double height =
+      std::sqrt(range * range + r * r + 2.0 * range * r * std::sin(theta)) - r;
+
+   return static_cast<std::uint8_t>(std::round(height * 10.0 + 2.0));
+}
+
+TEST(DerivedProduct, CompositeReflectivity)
+{
+   std::shared_ptr<ElevationScan> lowScan {};
+   std::shared_ptr<ElevationScan> highScan {};
+   CreateVolume(lowScan, highScan);
+
+   DerivedProduct::Input input {};
+   input.volumeScans_ = {lowScan, highScan};
+
+   auto composite =
+      DerivedProduct::Get(common::Level2Product::CompositeReflectivity)
+         ->Compute(input);
+
+   ASSERT_NE(composite, nullptr);
+   ASSERT_EQ(composite->size(), 2u);
+
+   const auto type = DataBlockType::MomentRef;
+
+   // Gates 0-1 fall within the first high gate, gates 2-3 within the second
+   EXPECT_EQ(GetLevel(composite, 0, type, 0), 116u);
+   EXPECT_EQ(GetLevel(composite, 0, type, 1), 116u);
+   EXPECT_EQ(GetLevel(composite, 0, type, 2), 136u);
+   EXPECT_EQ(GetLevel(composite, 0, type, 3), 136u);
+   EXPECT_EQ(GetLevel(composite, 1, type, 0), 116u);
+   EXPECT_EQ(GetLevel(composite, 1, type, 2), 136u);
+
+   // Source data is unmodified
+   EXPECT_EQ(GetLevel(lowScan, 0, type, 0), 106u);
+}
+
+TEST(DerivedProduct, EchoTops)
+{
+   std::shared_ptr<ElevationScan> lowScan {};
+   std::shared_ptr<ElevationScan> highScan {};
+   CreateVolume(lowScan, highScan);
+
+   // The high gates are 25 and 35 dBZ, and 18 dBZ is level 102
+   (*highScan)[0] = std::make_shared<TestRadarData>(
+      0.5f,
+      DataBlockType::MomentRef,
+      std::make_shared<TestMomentDataBlock>(
+         std::vector<std::uint8_t> {116, 66}, 66.0f, 20.125f, 0.5f));
+   for (auto& radial : *lowScan)
+   {
+      radial.second = std::make_shared<TestRadarData>(
+         radial.second->azimuth_angle().value(),
+         DataBlockType::MomentRef,
+         std::make_shared<TestMomentDataBlock>(
+            std::vector<std::uint8_t> {106, 0, 126, 1}, 66.0f, 20.0f));
+   }
+
+   DerivedProduct::Input input {};
+   input.volumeScans_      = {lowScan, highScan};
+   input.volumeElevations_ = {0.5f, 10.0f};
+
+   auto echoTops =
+      DerivedProduct::Get(common::Level2Product::EchoTops)->Compute(input);
+
+   ASSERT_NE(echoTops, nullptr);
+   ASSERT_EQ(echoTops->size(), 2u);
+
+   const auto type = DataBlockType::MomentRef;
+
+   // The highest beam at or above 18 dBZ gives the echo top
+   EXPECT_EQ(GetLevel(echoTops, 0, type, 0), GetEchoTopLevel(20.0f, 10.0f));
+   EXPECT_EQ(GetLevel(echoTops, 0, type, 1), GetEchoTopLevel(20.25f, 10.0f));
+   EXPECT_EQ(GetLevel(echoTops, 0, type, 2), GetEchoTopLevel(20.5f, 0.5f));
+
+   // Gates without echo have no value
+   EXPECT_EQ(GetLevel(echoTops, 0, type, 3), 0u);
+}
+
+TEST(DerivedProduct, ColumnAccumulator)
+{
+   std::shared_ptr<ElevationScan> lowScan {};
+   std::shared_ptr<ElevationScan> highScan {};
+   CreateVolume(lowScan, highScan);
+
+   auto composite =
+      DerivedProduct::Get(common::Level2Product::CompositeReflectivity);
+   auto columnAccumulator = std::make_shared<ColumnAccumulator>(*lowScan);
+
+   DerivedProduct::Input input {};
+   input.volumeScans_       = {lowScan};
+   input.columnAccumulator_ = columnAccumulator;
+
+   const auto type = DataBlockType::MomentRef;
+
+   // Only the lowest elevation has completed
+   auto partial = composite->Compute(input);
+   ASSERT_NE(partial, nullptr);
+   EXPECT_EQ(columnAccumulator->elevation_count(), 1u);
+   EXPECT_EQ(GetLevel(partial, 0, type, 0), 106u);
+   EXPECT_EQ(GetLevel(partial, 0, type, 2), 126u);
+
+   // Only the new elevation is accumulated when the next completes
+   input.volumeScans_.push_back(highScan);
+   auto complete = composite->Compute(input);
+   ASSERT_NE(complete, nullptr);
+   EXPECT_EQ(columnAccumulator->elevation_count(), 2u);
+   EXPECT_FALSE(columnAccumulator->Accumulate(*highScan, 1.0f));
+
+   input.columnAccumulator_ = nullptr;
+   auto expected            = composite->Compute(input);
+   ASSERT_NE(expected, nullptr);
+
+   for (std::uint16_t radial = 0; radial < 2; ++radial)
+   {
+      for (std::uint16_t gate = 0; gate < 4; ++gate)
+      {
+         EXPECT_EQ(GetLevel(complete, radial, type, gate),
+                   GetLevel(expected, radial, type, gate));
+      }
+   }
+}
+
+TEST(DerivedProduct, StormRelativeVelocity)
+{
+   // Velocity is coded with a scale of 2 and an offset of 129
+   auto elevationScan = std::make_shared<ElevationScan>();
+
+   (*elevationScan)[0] = std::make_shared<TestRadarData>(
+      0.0f,
+      DataBlockType::MomentVel,
+      std::make_shared<TestMomentDataBlock>(
+         std::vector<std::uint8_t> {129, 149, 0, 1}, 129.0f));
+   (*elevationScan)[1] = std::make_shared<TestRadarData>(
+      90.0f,
+      DataBlockType::MomentVel,
+      std::make_shared<TestMomentDataBlock>(
+         std::vector<std::uint8_t> {129, 149, 0, 1}, 129.0f));
+
+   // Storms moving from the south at 10 m/s
+   DerivedProduct::Input input {};
+   input.elevationScan_  = elevationScan;
+   input.stormDirection_ = 180.0f;
+   input.stormSpeed_     = 10.0f;
+
+   auto srv = DerivedProduct::Get(common::Level2Product::StormRelativeVelocity)
+                 ->Compute(input);
+
+   ASSERT_NE(srv, nullptr);
+
+   const auto type = DataBlockType::MomentVel;
+
+   // Storm motion is removed along the north radial only
+   EXPECT_EQ(GetLevel(srv, 0, type, 0), 109u);
+   EXPECT_EQ(GetLevel(srv, 0, type, 1), 129u);
+   EXPECT_EQ(GetLevel(srv, 1, type, 0), 129u);
+   EXPECT_EQ(GetLevel(srv, 1, type, 1), 149u);
+
+   // Below threshold and range folded gates are unchanged
+   EXPECT_EQ(GetLevel(srv, 0, type, 2), 0u);
+   EXPECT_EQ(GetLevel(srv, 0, type, 3), 1u);
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
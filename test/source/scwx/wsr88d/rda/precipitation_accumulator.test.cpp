@@ -0,0 +1,304 @@
+#include <scwx/wsr88d/rda/precipitation_accumulator.hpp>
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+namespace
+{
+
+// Reflectivity coding of the test radials
+constexpr float kScale_  = 2.0f;
+constexpr float kOffset_ = 66.0f;
+
+constexpr std::uint16_t kGates_    = 8u;
+constexpr std::uint16_t kWetGates_ = 4u;
+
+const std::chrono::system_clock::time_point kStartTime_ {
+   std::chrono::hours {480000}};
+
+class ReflectivityBlock : public GenericRadarData::MomentDataBlock
+{
+public:
+   explicit ReflectivityBlock(std::vector<std::uint8_t> dataMoments) :
+       dataMoments_ {std::move(dataMoments)}
+   {
+   }
+
+   std::uint16_t number_of_data_moment_gates() const override
+   {
+      return static_cast<std::uint16_t>(dataMoments_.size());
+   }
+   units::kilometers<float> data_moment_range() const override
+   {
+      return units::kilometers<float> {0.125f};
+   }
+   std::int16_t data_moment_range_raw() const override { return 125; }
+   units::kilometers<float> data_moment_range_sample_interval() const override
+   {
+      return units::kilometers<float> {0.25f};
+   }
+   std::uint16_t data_moment_range_sample_interval_raw() const override
+   {
+      return 250u;
+   }
+   std::int16_t snr_threshold_raw() const override { return 0; }
+   std::uint8_t data_word_size() const override { return 8; }
+   float        scale() const override { return kScale_; }
+   float        offset() const override { return kOffset_; }
+   const void*  data_moments() const override { return dataMoments_.data(); }
+
+private:
+   std::vector<std::uint8_t> dataMoments_;
+};
+
+class ReflectivityRadial : public GenericRadarData
+{
+public:
+   explicit ReflectivityRadial(float                              azimuth,
+                               std::shared_ptr<ReflectivityBlock> block) :
+       azimuth_ {azimuth}, block_ {std::move(block)}
+   {
+   }
+
+   std::uint32_t collection_time() const override { return 0u; }
+   std::uint16_t modified_julian_date() const override { return 0u; }
+   units::degrees<float> azimuth_angle() const override
+   {
+      return units::degrees<float> {azimuth_};
+   }
+   std::uint16_t azimuth_number() const override { return 0u; }
+   std::uint16_t radial_status() const override { return 0u; }
+   std::uint16_t elevation_number() const override { return 0u; }
+   std::uint16_t volume_coverage_pattern_number() const override
+   {
+      return 0u;
+   }
+
+   std::shared_ptr<GenericRadarData::MomentDataBlock>
+   moment_data_block(DataBlockType type) const override
+   {
+      return (type == DataBlockType::MomentRef) ? block_ : nullptr;
+   }
+
+   bool Parse(std::istream&) override { return true; }
+
+private:
+   float                              azimuth_;
+   std::shared_ptr<ReflectivityBlock> block_;
+};
+
+/**
+ * @brief Creates a scan of 1 degree radials, with reflectivity in the first
+ * kWetGates_ gates of each radial, and no echo beyond.
+ */
+std::shared_ptr<ElevationScan> CreateScan(float reflectivity)
+{
+   auto elevationScan = std::make_shared<ElevationScan>();
+
+   std::vector<std::uint8_t> dataMoments(kGates_, 0u);
+   for (std::uint16_t gate = 0; gate < kWetGates_; ++gate)
+   {
+      dataMoments[gate] =
+         static_cast<std::uint8_t>(reflectivity * kScale_ + kOffset_);
+   }
+
+   for (std::uint16_t i = 0; i < 360u; ++i)
+   {
+      (*elevationScan)[i] = std::make_shared<ReflectivityRadial>(
+         static_cast<float>(i) + 0.5f,
+         std::make_shared<ReflectivityBlock>(dataMoments));
+   }
+
+   return elevationScan;
+}
+
+float RainRate(float reflectivity)
+{
+   return std::pow(std::pow(10.0f, reflectivity / 10.0f) / 300.0f,
+                   1.0f / 1.4f);
+}
+
+std::chrono::system_clock::time_point Minutes(int minutes)
+{
+   return kStartTime_ + std::chrono::minutes {minutes};
+}
+
+} // namespace
+
+TEST(PrecipitationAccumulatorTest, TimedWindowsExpireIntervals)
+{
+   const float rate = RainRate(40.0f);
+
+   PrecipitationAccumulator accumulator {};
+
+   for (int minutes = 0; minutes <= 90; minutes += 10)
+   {
+      // Each volume is a new scan, as a new volume would be
+      EXPECT_TRUE(accumulator.Accumulate(CreateScan(40.0f), Minutes(minutes)));
+
+      if (minutes == 60)
+      {
+         EXPECT_NEAR(
+            accumulator.depth(AccumulationWindow::OneHour, 0, 0), rate, 0.05f);
+         EXPECT_NEAR(accumulator.depth(AccumulationWindow::ThreeHour, 0, 0),
+                     rate,
+                     0.05f);
+      }
+   }
+
+   EXPECT_EQ(accumulator.end_time(), Minutes(90));
+   EXPECT_EQ(accumulator.begin_time(AccumulationWindow::OneHour), Minutes(30));
+   EXPECT_EQ(accumulator.begin_time(AccumulationWindow::ThreeHour), Minutes(0));
+
+   for (std::size_t radial : {0u, 179u, 359u})
+   {
+      EXPECT_NEAR(accumulator.depth(AccumulationWindow::OneHour, radial, 3),
+                  rate,
+                  0.05f);
+      EXPECT_NEAR(accumulator.depth(AccumulationWindow::ThreeHour, radial, 3),
+                  rate * 1.5f,
+                  0.05f);
+      EXPECT_NEAR(accumulator.depth(AccumulationWindow::StormTotal, radial, 3),
+                  rate * 1.5f,
+                  0.05f);
+      EXPECT_EQ(accumulator.depth(AccumulationWindow::OneHour, radial, 4),
+                0.0f);
+   }
+}
+
+TEST(PrecipitationAccumulatorTest, SkipsOldVolumesAndGaps)
+{
+   const float rate = RainRate(40.0f);
+
+   PrecipitationAccumulator accumulator {};
+
+   EXPECT_TRUE(accumulator.Accumulate(CreateScan(40.0f), Minutes(0)));
+   EXPECT_FALSE(accumulator.Accumulate(CreateScan(40.0f), Minutes(0)));
+
+   // A volume after a gap of more than 20 minutes only begins an interval
+   EXPECT_TRUE(accumulator.Accumulate(CreateScan(40.0f), Minutes(30)));
+   EXPECT_EQ(accumulator.depth(AccumulationWindow::OneHour, 0, 0), 0.0f);
+   EXPECT_FALSE(accumulator.Accumulate(CreateScan(40.0f), Minutes(20)));
+
+   EXPECT_TRUE(accumulator.Accumulate(CreateScan(40.0f), Minutes(40)));
+   EXPECT_NEAR(
+      accumulator.depth(AccumulationWindow::OneHour, 0, 0), rate / 6.0f, 0.01f);
+}
+
+TEST(PrecipitationAccumulatorTest, StormTotalRestartsAfterDryHour)
+{
+   const float rate = RainRate(40.0f);
+
+   PrecipitationAccumulator accumulator {};
+
+   accumulator.Accumulate(CreateScan(40.0f), Minutes(0));
+   accumulator.Accumulate(CreateScan(40.0f), Minutes(10));
+   accumulator.Accumulate(CreateScan(40.0f), Minutes(20));
+
+   // The interval to the first dry volume is half as wet
+   for (int minutes = 30; minutes <= 100; minutes += 10)
+   {
+      accumulator.Accumulate(CreateScan(0.0f), Minutes(minutes));
+   }
+
+   EXPECT_NEAR(accumulator.depth(AccumulationWindow::StormTotal, 0, 0),
+               rate * 5.0f / 12.0f,
+               0.02f);
+
+   accumulator.Accumulate(CreateScan(40.0f), Minutes(110));
+
+   EXPECT_EQ(accumulator.begin_time(AccumulationWindow::StormTotal),
+             Minutes(100));
+   EXPECT_NEAR(accumulator.depth(AccumulationWindow::StormTotal, 0, 0),
+               rate / 12.0f,
+               0.01f);
+   EXPECT_NEAR(accumulator.depth(AccumulationWindow::ThreeHour, 0, 0),
+               rate / 2.0f,
+               0.02f);
+}
+
+TEST(PrecipitationAccumulatorTest, SaveAndLoad)
+{
+   PrecipitationAccumulator accumulator {};
+
+   accumulator.Accumulate(CreateScan(40.0f), Minutes(0));
+   accumulator.Accumulate(CreateScan(45.0f), Minutes(10));
+   accumulator.Accumulate(CreateScan(35.0f), Minutes(20));
+
+   std::stringstream ss {};
+   ASSERT_TRUE(accumulator.Save(ss));
+
+   PrecipitationAccumulator loaded {};
+   ASSERT_TRUE(loaded.Load(ss));
+
+   EXPECT_EQ(loaded.end_time(), accumulator.end_time());
+
+   // Saved intervals continue to expire once loaded
+   for (int minutes = 30; minutes <= 80; minutes += 10)
+   {
+      accumulator.Accumulate(CreateScan(30.0f), Minutes(minutes));
+      loaded.Accumulate(CreateScan(30.0f), Minutes(minutes));
+   }
+
+   for (auto window : {AccumulationWindow::OneHour,
+                       AccumulationWindow::ThreeHour,
+                       AccumulationWindow::StormTotal})
+   {
+      for (std::size_t gate = 0; gate < kGates_; ++gate)
+      {
+         EXPECT_EQ(loaded.depth(window, 90, gate),
+                   accumulator.depth(window, 90, gate));
+      }
+   }
+
+   // Invalid state is not loaded
+   std::stringstream invalid {"QPE"};
+   EXPECT_FALSE(loaded.Load(invalid));
+   EXPECT_EQ(loaded.end_time(), accumulator.end_time());
+}
+
+TEST(PrecipitationAccumulatorTest, Accumulation)
+{
+   PrecipitationAccumulator accumulator {};
+
+   auto layoutScan = CreateScan(40.0f);
+
+   accumulator.Accumulate(layoutScan, Minutes(0));
+   accumulator.Accumulate(CreateScan(40.0f), Minutes(10));
+
+   auto accumulation =
+      accumulator.Accumulation(AccumulationWindow::OneHour, *layoutScan);
+   ASSERT_NE(accumulation, nullptr);
+   ASSERT_EQ(accumulation->size(), layoutScan->size());
+
+   auto block =
+      accumulation->at(45)->moment_data_block(DataBlockType::MomentRef);
+   ASSERT_NE(block, nullptr);
+   ASSERT_EQ(block->data_word_size(), 16);
+   EXPECT_EQ(block->scale(), PrecipitationAccumulator::kDepthScale);
+   EXPECT_EQ(block->offset(), PrecipitationAccumulator::kDepthOffset);
+
+   const auto* levels =
+      static_cast<const std::uint16_t*>(block->data_moments());
+   const float depth = accumulator.depth(AccumulationWindow::OneHour, 45, 0);
+
+   EXPECT_EQ(levels[0],
+             static_cast<std::uint16_t>(
+                std::round(depth * PrecipitationAccumulator::kDepthScale +
+                           PrecipitationAccumulator::kDepthOffset)));
+   EXPECT_EQ(levels[kWetGates_], 0u);
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
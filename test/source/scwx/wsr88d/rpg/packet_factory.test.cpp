@@ -0,0 +1,63 @@
+#include <scwx/wsr88d/rpg/packet_factory.hpp>
+#include <scwx/wsr88d/rpg/set_color_level_packet.hpp>
+#include <scwx/util/arena.hpp>
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rpg
+{
+
+// Set Color Level packet: code 0x0802, color value indicator 2, contour 5
+static const std::string kSetColorLevelPacket_ {"\x08\x02\x00\x02\x00\x05",
+                                                6};
+
+TEST(PacketFactory, CreateSetColorLevelPacket)
+{
+   std::istringstream is {kSetColorLevelPacket_};
+
+   auto packet = PacketFactory::Create(is);
+   auto setColorLevelPacket =
+      std::dynamic_pointer_cast<SetColorLevelPacket>(packet);
+
+   ASSERT_NE(setColorLevelPacket, nullptr);
+   EXPECT_EQ(setColorLevelPacket->packet_code(), 0x0802u);
+   EXPECT_EQ(setColorLevelPacket->value_of_contour(), 5u);
+}
+
+TEST(PacketFactory, CreateFromArena)
+{
+   auto                      arena = std::make_shared<util::Arena>(1024);
+   std::weak_ptr<util::Arena> weakArena {arena};
+
+   std::istringstream is {kSetColorLevelPacket_};
+
+   auto packet = PacketFactory::Create(is, arena);
+   arena.reset();
+
+   ASSERT_NE(packet, nullptr);
+   EXPECT_EQ(packet->packet_code(), 0x0802u);
+
+   // The packet keeps the arena alive
+   EXPECT_FALSE(weakArena.expired());
+
+   packet.reset();
+
+   EXPECT_TRUE(weakArena.expired());
+}
+
+TEST(PacketFactory, UnknownPacketCode)
+{
+   std::istringstream is {std::string {"\x00\x1B\x00\x00", 4}};
+
+   EXPECT_EQ(PacketFactory::Create(is), nullptr);
+}
+
+} // namespace rpg
+} // namespace wsr88d
+} // namespace scwx
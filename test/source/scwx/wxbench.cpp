@@ -0,0 +1,83 @@
+#include <scwx/wxbench.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <new>
+
+namespace scwx
+{
+namespace bench
+{
+
+#if !defined(SCWX_ALLOCATION_TRACKING)
+static std::atomic<std::uint64_t> allocationCount_ {0u};
+static std::atomic<std::uint64_t> allocationBytes_ {0u};
+#endif
+
+util::AllocationCount AllocationCount()
+{
+#if defined(SCWX_ALLOCATION_TRACKING)
+   return util::AllocationTracker::GetProcessCount();
+#else
+   return {.allocations_ = allocationCount_.load(std::memory_order_relaxed),
+           .bytes_       = allocationBytes_.load(std::memory_order_relaxed)};
+#endif
+}
+
+std::vector<char> ReadTestData(const std::string& filename)
+{
+   std::ifstream f(std::string(SCWX_TEST_DATA_DIR) + filename,
+                   std::ios_base::in | std::ios_base::binary);
+
+   return {std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>()};
+}
+
+} // namespace bench
+} // namespace scwx
+
+#if !defined(SCWX_ALLOCATION_TRACKING)
+
+// Count allocations made by the decoders. Nothrow allocations are forwarded to
+// these by the standard library, over-aligned allocations are not counted.
+// Allocation tracking builds replace operator new in wxdata instead.
+void* operator new(std::size_t size)
+{
+   scwx::bench::allocationCount_.fetch_add(1u, std::memory_order_relaxed);
+   scwx::bench::allocationBytes_.fetch_add(size, std::memory_order_relaxed);
+
+   void* p = std::malloc(size != 0u ? size : 1u);
+   if (p == nullptr)
+   {
+      throw std::bad_alloc();
+   }
+   return p;
+}
+
+void* operator new[](std::size_t size)
+{
+   return ::operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+   std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+   std::free(p);
+}
+
+void operator delete(void* p, std::size_t /* size */) noexcept
+{
+   std::free(p);
+}
+
+void operator delete[](void* p, std::size_t /* size */) noexcept
+{
+   std::free(p);
+}
+
+#endif
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <scwx/util/allocation_tracker.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace scwx
+{
+namespace bench
+{
+
+/**
+ * @brief Gets the number of allocations made by the process so far.
+ *
+ * @return Allocation count and allocated bytes
+ */
+util::AllocationCount AllocationCount();
+
+/**
+ * @brief Reads a file from the test data directory.
+ *
+ * @param [in] filename Filename relative to the test data directory
+ *
+ * @return File contents, or an empty vector if the file could not be read
+ */
+std::vector<char> ReadTestData(const std::string& filename);
+
+/**
+ * @brief Runs a decoder benchmark, and reports its throughput and the number
+ * of allocations and allocated bytes per decoded file.
+ *
+ * @param [in] state Benchmark state
+ * @param [in] size Size of the input data in bytes
+ * @param [in] decode Decodes the data once, returning false on failure
+ */
+template<class Decode>
+void RunDecoder(benchmark::State& state, std::size_t size, Decode&& decode)
+{
+   std::uint64_t allocations    = 0;
+   std::uint64_t allocatedBytes = 0;
+
+   for (auto _ : state)
+   {
+      const util::AllocationCount begin = AllocationCount();
+
+      if (!decode())
+      {
+         state.SkipWithError("Decoding failed");
+         break;
+      }
+
+      const util::AllocationCount end = AllocationCount();
+      allocations += end.allocations_ - begin.allocations_;
+      allocatedBytes += end.bytes_ - begin.bytes_;
+   }
+
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() *
+                                                     size));
+   state.counters["allocs/file"] =
+      benchmark::Counter(static_cast<double>(allocations),
+                         benchmark::Counter::kAvgIterations);
+   state.counters["bytes/file"] =
+      benchmark::Counter(static_cast<double>(allocatedBytes),
+                         benchmark::Counter::kAvgIterations,
+                         benchmark::Counter::kIs1024);
+}
+
+} // namespace bench
+} // namespace scwx
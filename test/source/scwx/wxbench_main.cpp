@@ -0,0 +1,14 @@
+#include <scwx/bench_runner.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <spdlog/spdlog.h>
+
+int main(int argc, char** argv)
+{
+   scwx::util::Logger::Initialize();
+
+   // Decoder logging would dominate the measurements
+   spdlog::set_level(spdlog::level::off);
+
+   return scwx::bench::RunBenchmarks(argc, argv);
+}
@@ -12,6 +12,7 @@ set(SRC_AWIPS_TESTS source/scwx/awips/coded_location.test.cpp
                     source/scwx/awips/coded_time_motion_location.test.cpp
                     source/scwx/awips/pvtec.test.cpp
                     source/scwx/awips/text_product_file.test.cpp
+                    source/scwx/awips/text_product_message.test.cpp
                     source/scwx/awips/ugc.test.cpp)
 set(SRC_COMMON_TESTS source/scwx/common/color_table.test.cpp
                      source/scwx/common/products.test.cpp)
@@ -19,6 +20,13 @@ set(SRC_GR_TESTS source/scwx/gr/placefile.test.cpp)
 set(SRC_NETWORK_TESTS source/scwx/network/dir_list.test.cpp)
 set(SRC_PROVIDER_TESTS source/scwx/provider/aws_level2_data_provider.test.cpp
                        source/scwx/provider/aws_level3_data_provider.test.cpp
+                       source/scwx/provider/local_nexrad_data_provider.test.cpp
+                       source/scwx/provider/nexrad_data_provider.test.cpp
+                       source/scwx/provider/nexrad_data_provider_factory.test.cpp
+                       source/scwx/provider/object_cache.test.cpp
+                       source/scwx/provider/refresh_schedule.test.cpp
+                       source/scwx/provider/replay_nexrad_data_provider.test.cpp
+                       source/scwx/provider/replay_warnings_provider.test.cpp
                        source/scwx/provider/warnings_provider.test.cpp)
 set(SRC_QT_CONFIG_TESTS source/scwx/qt/config/county_database.test.cpp
                         source/scwx/qt/config/radar_site.test.cpp)
@@ -27,19 +35,50 @@ set(SRC_QT_MANAGER_TESTS source/scwx/qt/manager/settings_manager.test.cpp
 set(SRC_QT_MAP_TESTS source/scwx/qt/map/map_provider.test.cpp)
 set(SRC_QT_MODEL_TESTS source/scwx/qt/model/imgui_context_model.test.cpp
                        source/scwx/qt/model/marker_model.test.cpp)
+set(SRC_QT_REQUEST_TESTS source/scwx/qt/request/nexrad_load_group.test.cpp)
 set(SRC_QT_SETTINGS_TESTS source/scwx/qt/settings/settings_container.test.cpp
                           source/scwx/qt/settings/settings_variable.test.cpp)
-set(SRC_QT_UTIL_TESTS source/scwx/qt/util/q_file_input_stream.test.cpp
+set(SRC_QT_UTIL_TESTS source/scwx/qt/util/alert_index.test.cpp
+                      source/scwx/qt/util/azimuth_index.test.cpp
+                      source/scwx/qt/util/coalesced_signal.test.cpp
+                      source/scwx/qt/util/cross_section.test.cpp
+                      source/scwx/qt/util/elevation_scan_inspector.test.cpp
+                      source/scwx/qt/util/q_file_input_stream.test.cpp
                       source/scwx/qt/util/geographic_lib.test.cpp
-                      source/scwx/qt/util/network.test.cpp)
-set(SRC_UTIL_TESTS source/scwx/util/float.test.cpp
+                      source/scwx/qt/util/line_simplification.test.cpp
+                      source/scwx/qt/util/mosaic_sweep.test.cpp
+                      source/scwx/qt/util/network.test.cpp
+                      source/scwx/qt/util/position_filter.test.cpp
+                      source/scwx/qt/util/spatial_index.test.cpp)
+set(SRC_UTIL_TESTS source/scwx/util/allocation_tracker.test.cpp
+                   source/scwx/util/arena.test.cpp
+                   source/scwx/util/buffer_pool.test.cpp
+                   source/scwx/util/byte_swap.test.cpp
+                   source/scwx/util/cpu_features.test.cpp
+                   source/scwx/util/float.test.cpp
+                   source/scwx/util/logger.test.cpp
+                   source/scwx/util/lru_cache.test.cpp
+                   source/scwx/util/mapped_file_stream.test.cpp
+                   source/scwx/util/memory.test.cpp
+                   source/scwx/util/metrics.test.cpp
+                   source/scwx/util/priority_thread_pool.test.cpp
+                   source/scwx/util/profiler.test.cpp
                    source/scwx/util/rangebuf.test.cpp
+                   source/scwx/util/run_length.test.cpp
                    source/scwx/util/streams.test.cpp
+                   source/scwx/util/strand.test.cpp
                    source/scwx/util/strings.test.cpp
+                   source/scwx/util/time.test.cpp
                    source/scwx/util/vectorbuf.test.cpp)
-set(SRC_WSR88D_TESTS source/scwx/wsr88d/ar2v_file.test.cpp
+set(SRC_WSR88D_TESTS source/scwx/wsr88d/ar2v_export.test.cpp
+                     source/scwx/wsr88d/ar2v_file.test.cpp
                      source/scwx/wsr88d/level3_file.test.cpp
+                     source/scwx/wsr88d/nexrad_file_batch_loader.test.cpp
                      source/scwx/wsr88d/nexrad_file_factory.test.cpp)
+set(SRC_WSR88D_RDA_TESTS source/scwx/wsr88d/rda/columnar_sweep.test.cpp
+                          source/scwx/wsr88d/rda/derived_product.test.cpp
+                          source/scwx/wsr88d/rda/precipitation_accumulator.test.cpp)
+set(SRC_WSR88D_RPG_TESTS source/scwx/wsr88d/rpg/packet_factory.test.cpp)
 
 set(CMAKE_FILES test.cmake)
 
@@ -53,10 +92,13 @@ add_executable(wxtest ${SRC_MAIN}
                       ${SRC_QT_MANAGER_TESTS}
                       ${SRC_QT_MAP_TESTS}
                       ${SRC_QT_MODEL_TESTS}
+                      ${SRC_QT_REQUEST_TESTS}
                       ${SRC_QT_SETTINGS_TESTS}
                       ${SRC_QT_UTIL_TESTS}
                       ${SRC_UTIL_TESTS}
                       ${SRC_WSR88D_TESTS}
+                      ${SRC_WSR88D_RDA_TESTS}
+                      ${SRC_WSR88D_RPG_TESTS}
                       ${CMAKE_FILES})
 
 source_group("Source Files\\main"         FILES ${SRC_MAIN})
@@ -69,10 +111,13 @@ source_group("Source Files\\qt\\config"   FILES ${SRC_QT_CONFIG_TESTS})
 source_group("Source Files\\qt\\manager"  FILES ${SRC_QT_MANAGER_TESTS})
 source_group("Source Files\\qt\\map"      FILES ${SRC_QT_MAP_TESTS})
 source_group("Source Files\\qt\\model"    FILES ${SRC_QT_MODEL_TESTS})
+source_group("Source Files\\qt\\request"  FILES ${SRC_QT_REQUEST_TESTS})
 source_group("Source Files\\qt\\settings" FILES ${SRC_QT_SETTINGS_TESTS})
 source_group("Source Files\\qt\\util"     FILES ${SRC_QT_UTIL_TESTS})
 source_group("Source Files\\util"         FILES ${SRC_UTIL_TESTS})
 source_group("Source Files\\wsr88d"       FILES ${SRC_WSR88D_TESTS})
+source_group("Source Files\\wsr88d\\rda"  FILES ${SRC_WSR88D_RDA_TESTS})
+source_group("Source Files\\wsr88d\\rpg"  FILES ${SRC_WSR88D_RPG_TESTS})
 
 target_include_directories(wxtest PRIVATE ${GTest_INCLUDE_DIRS})
 
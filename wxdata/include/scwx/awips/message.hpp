@@ -1,5 +1,7 @@
 #pragma once
 
+#include <scwx/util/byte_swap.hpp>
+
 #include <array>
 #include <cstring>
 #include <execution>
@@ -67,44 +69,29 @@ public:
    static void SwapArray(std::array<float, _Size>& arr,
                          std::size_t               size = _Size)
    {
-      std::transform(std::execution::par_unseq,
-                     arr.begin(),
-                     arr.begin() + size,
-                     arr.begin(),
-                     [](float f) { return SwapFloat(f); });
+      util::BigEndianToHostFloat(arr.data(), size);
    }
 
    template<std::size_t _Size>
    static void SwapArray(std::array<std::int16_t, _Size>& arr,
                          std::size_t                      size = _Size)
    {
-      std::transform(std::execution::par_unseq,
-                     arr.begin(),
-                     arr.begin() + size,
-                     arr.begin(),
-                     [](std::int16_t u) { return ntohs(u); });
+      util::BigEndianToHost16(reinterpret_cast<std::uint16_t*>(arr.data()),
+                              size);
    }
 
    template<std::size_t _Size>
    static void SwapArray(std::array<std::uint16_t, _Size>& arr,
                          std::size_t                       size = _Size)
    {
-      std::transform(std::execution::par_unseq,
-                     arr.begin(),
-                     arr.begin() + size,
-                     arr.begin(),
-                     [](std::uint16_t u) { return ntohs(u); });
+      util::BigEndianToHost16(arr.data(), size);
    }
 
    template<std::size_t _Size>
    static void SwapArray(std::array<std::uint32_t, _Size>& arr,
                          std::size_t                       size = _Size)
    {
-      std::transform(std::execution::par_unseq,
-                     arr.begin(),
-                     arr.begin() + size,
-                     arr.begin(),
-                     [](std::uint32_t u) { return ntohl(u); });
+      util::BigEndianToHost32(arr.data(), size);
    }
 
    template<typename T>
@@ -118,11 +105,7 @@ public:
 
    static void SwapVector(std::vector<std::uint16_t>& v)
    {
-      std::transform(std::execution::par_unseq,
-                     v.begin(),
-                     v.end(),
-                     v.begin(),
-                     [](std::uint16_t u) { return ntohs(u); });
+      util::BigEndianToHost16(v.data(), v.size());
    }
 
 private:
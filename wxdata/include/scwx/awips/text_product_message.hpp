@@ -107,6 +107,20 @@ public:
 
    std::size_t data_size() const override;
 
+   /**
+    * @brief Reduces the memory used by a message which is kept for reference.
+    * The raw message content is compressed, and is decompressed each time it
+    * is requested. The MND header, overview block, and the product content and
+    * UGC lines of each segment are released. The parsed segment headers,
+    * coded locations and motion are kept.
+    *
+    * Segments which are referenced outside of the message are not modified,
+    * and are compacted by a later call once they are released.
+    *
+    * @return true if the message is fully compacted
+    */
+   bool Compact();
+
    bool Parse(std::istream& is) override;
 
    static std::shared_ptr<TextProductMessage> Create(std::istream& is);
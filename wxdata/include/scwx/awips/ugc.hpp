@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace scwx
@@ -23,12 +26,24 @@ public:
    Ugc(Ugc&&) noexcept;
    Ugc& operator=(Ugc&&) noexcept;
 
-   std::vector<std::string> states() const;
-   std::vector<std::string> fips_ids() const;
-   std::string              product_expiration() const;
+   std::vector<std::string>   states() const;
+   std::vector<std::string>   fips_ids() const;
+   std::vector<std::uint32_t> fips_codes() const;
+   std::string                product_expiration() const;
 
    bool Parse(const std::vector<std::string>& ugcString);
 
+   /**
+    * @brief Converts a FIPS ID (SSFNNN) into an integer code. Each FIPS ID has
+    * a unique code, such that FIPS IDs can be compared without formatting or
+    * comparing strings. The codes of a parsed UGC are given by fips_codes().
+    *
+    * @param [in] fipsId FIPS ID
+    *
+    * @return FIPS code, or std::nullopt if the FIPS ID is invalid
+    */
+   static std::optional<std::uint32_t> GetFipsCode(std::string_view fipsId);
+
 private:
    std::unique_ptr<UgcImpl> p;
 };
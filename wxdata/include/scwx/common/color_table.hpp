@@ -2,6 +2,7 @@
 
 #include <istream>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -43,6 +44,18 @@ public:
    boost::gil::rgba8_pixel_t Color(float value) const;
    bool                      IsValid() const;
 
+   /**
+    * @brief Gets the colors of a range of values, equivalent to calling
+    * Color() for each value. If the scaled values are in ascending order, the
+    * color table entries are swept once for the range, instead of being
+    * searched for each value.
+    *
+    * @param [in] values Values, preferably in ascending order
+    * @param [out] colors Colors of each value, sized to match the values
+    */
+   void Colors(std::span<const float>               values,
+               std::span<boost::gil::rgba8_pixel_t> colors) const;
+
    static std::shared_ptr<ColorTable> Load(const std::string& filename);
    static std::shared_ptr<ColorTable> Load(std::istream& is);
 
@@ -31,11 +31,18 @@ enum class Level2Product
    DifferentialPhase,
    CorrelationCoefficient,
    ClutterFilterPowerRemoved,
+   DealiasedVelocity,
+   StormRelativeVelocity,
+   CompositeReflectivity,
+   EchoTops,
+   OneHourPrecipitation,
+   ThreeHourPrecipitation,
+   StormTotalPrecipitation,
    Unknown
 };
 typedef util::Iterator<Level2Product,
                        Level2Product::Reflectivity,
-                       Level2Product::ClutterFilterPowerRemoved>
+                       Level2Product::StormTotalPrecipitation>
    Level2ProductIterator;
 
 enum class Level3ProductCategory
@@ -3,6 +3,7 @@
 #include <scwx/gr/gr_types.hpp>
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <boost/gil/typedefs.hpp>
@@ -16,6 +17,11 @@ boost::gil::rgba8_pixel_t ParseColor(const std::vector<std::string>& tokenList,
                                      std::size_t                     startIndex,
                                      ColorMode                       colorMode,
                                      bool hasAlpha = true);
+boost::gil::rgba8_pixel_t
+ParseColor(const std::vector<std::string_view>& tokenList,
+           std::size_t                          startIndex,
+           ColorMode                            colorMode,
+           bool                                 hasAlpha = true);
 
 } // namespace gr
 } // namespace scwx
@@ -204,10 +204,48 @@ public:
    std::unordered_map<std::size_t, std::shared_ptr<Font>> fonts();
    std::shared_ptr<Font>                                  font(std::size_t i);
 
+   /**
+    * @brief Gets a hash of the contents of a draw item, used to determine
+    * whether a draw item has changed between loads of a placefile
+    *
+    * @param [in] di Draw item
+    *
+    * @return Draw item hash
+    */
+   static std::size_t GetDrawItemHash(const DrawItem& di);
+
    static std::shared_ptr<Placefile> Load(const std::string& filename);
    static std::shared_ptr<Placefile> Load(const std::string& name,
                                           std::istream&      is);
 
+   /**
+    * @brief Saves the parsed placefile in a compiled binary representation,
+    * which can be loaded without parsing the placefile text again. The file is
+    * written in the native byte order, and is only intended as a local cache.
+    *
+    * @param [in] filename Compiled placefile filename
+    * @param [in] contentHash Hash of the placefile text
+    *
+    * @return true if the compiled placefile was saved
+    */
+   bool SaveCompiled(const std::string& filename,
+                     std::uint64_t      contentHash) const;
+
+   /**
+    * @brief Loads a compiled placefile by memory mapping it.
+    *
+    * @param [in] name Placefile name
+    * @param [in] filename Compiled placefile filename
+    * @param [in] contentHash Hash of the placefile text. If the placefile was
+    * compiled from different text, it is not loaded.
+    *
+    * @return Placefile, or nullptr if the compiled placefile does not exist,
+    * is out of date, or is invalid
+    */
+   static std::shared_ptr<Placefile> LoadCompiled(const std::string& name,
+                                                  const std::string& filename,
+                                                  std::uint64_t contentHash);
+
 private:
    class Impl;
    std::unique_ptr<Impl> p;
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cpr/api.h>
 #include <cpr/cprtypes.h>
+#include <cpr/parameters.h>
+#include <cpr/response.h>
+#include <cpr/session.h>
 
 namespace scwx
 {
@@ -9,9 +13,83 @@ namespace network
 namespace cpr
 {
 
+/**
+ * @brief Validators of a previously received response. Sending them with a
+ * request makes the request conditional, such that the server responds with
+ * 304 Not Modified if the resource has not changed.
+ */
+struct Validators
+{
+   std::string eTag_ {};
+   std::string lastModified_ {};
+};
+
 ::cpr::Header GetHeader();
 void          SetUserAgent(const std::string& userAgent);
 
+/**
+ * @brief Performs a GET request using a pooled session. Sessions are pooled
+ * per host, such that connections are kept alive between requests, and the
+ * number of concurrent connections to each host is limited. HTTP/2 is used
+ * where the server supports it.
+ *
+ * @param url Request URL
+ * @param header Request header
+ * @param parameters Request parameters
+ *
+ * @return Response
+ */
+::cpr::Response Get(const ::cpr::Url&        url,
+                    const ::cpr::Header&     header     = GetHeader(),
+                    const ::cpr::Parameters& parameters = {});
+
+/**
+ * @brief Performs an asynchronous GET request using a pooled session.
+ */
+::cpr::AsyncResponse GetAsync(const ::cpr::Url&        url,
+                              const ::cpr::Header&     header = GetHeader(),
+                              const ::cpr::Parameters& parameters = {});
+
+/**
+ * @brief Adds conditional request headers for the validators to a header.
+ *
+ * @param header Request header
+ * @param validators Validators of the previous response
+ *
+ * @return Request header including If-None-Match and If-Modified-Since
+ */
+::cpr::Header ConditionalHeader(::cpr::Header     header,
+                                const Validators& validators);
+
+/**
+ * @brief Gets the validators of a response.
+ *
+ * @param response Response
+ *
+ * @return ETag and Last-Modified values of the response, which are empty if
+ * the server did not send them
+ */
+Validators GetValidators(const ::cpr::Response& response);
+
+/**
+ * @brief Gets the scheme, host and port of a URL, which identify the
+ * connections a request to the URL may use.
+ *
+ * @param url URL
+ *
+ * @return URL up to the end of the authority
+ */
+std::string GetHost(const std::string& url);
+
+/**
+ * @brief Configures a session which is not pooled, such as one requiring
+ * callbacks, to share TLS sessions and DNS lookups with pooled sessions, and
+ * to use HTTP/2 where the server supports it.
+ *
+ * @param session Session to configure
+ */
+void ConfigureSession(::cpr::Session& session);
+
 } // namespace cpr
 } // namespace network
 } // namespace scwx
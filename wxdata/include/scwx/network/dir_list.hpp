@@ -1,8 +1,13 @@
 #pragma once
 
+#include <scwx/network/cpr.hpp>
+
 #include <chrono>
 #include <filesystem>
+#include <functional>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace scwx
@@ -19,6 +24,13 @@ struct DirListRecord
    size_t size_ = 0u; ///< Approximate file size in bytes
 };
 
+/**
+ * @brief Directory listing filter, returning true for each filename to be
+ * included in the listing. Directory filenames do not include the trailing
+ * slash.
+ */
+typedef std::function<bool(std::string_view filename)> DirListFilter;
+
 /**
  * @brief Retrieve Directory Listing
  *
@@ -27,5 +39,37 @@ struct DirListRecord
  */
 std::vector<DirListRecord> DirList(const std::string& baseUrl);
 
+/**
+ * @brief Retrieve Directory Listing if Modified
+ *
+ * Retrieves a directory listing, unless it has not been modified since the
+ * validators were received. The validators are updated from the response.
+ *
+ * @param baseUrl Directory URL
+ * @param validators Validators of the previous listing
+ * @param filter Filenames to include, or all filenames if empty
+ *
+ * @return Directory listing, or empty if the listing has not been modified
+ */
+std::optional<std::vector<DirListRecord>>
+DirList(const std::string&   baseUrl,
+        cpr::Validators&     validators,
+        const DirListFilter& filter = {});
+
+/**
+ * @brief Parse Directory Listing
+ *
+ * Parses a default Apache-style directory listing, in either the preformatted
+ * or the table layout. Entries are parsed in place, and records are only
+ * created for filenames accepted by the filter.
+ *
+ * @param html Directory listing HTML
+ * @param filter Filenames to include, or all filenames if empty
+ *
+ * @return Directory listing
+ */
+std::vector<DirListRecord> ParseDirList(std::string_view     html,
+                                        const DirListFilter& filter = {});
+
 } // namespace network
 } // namespace scwx
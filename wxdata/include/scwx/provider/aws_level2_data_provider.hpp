@@ -17,6 +17,12 @@ public:
    explicit AwsLevel2DataProvider(const std::string& radarSite,
                                   const std::string& bucketName,
                                   const std::string& region);
+
+   /**
+    * Creates a provider for the default bucket, failing over to mirrors.
+    */
+   explicit AwsLevel2DataProvider(const std::string&           radarSite,
+                                  const std::vector<Endpoint>& mirrors);
    ~AwsLevel2DataProvider();
 
    AwsLevel2DataProvider(const AwsLevel2DataProvider&) = delete;
@@ -31,6 +37,14 @@ public:
    static std::chrono::system_clock::time_point
    GetTimePointFromKey(const std::string& key);
 
+   std::shared_ptr<wsr88d::NexradFile>
+   LoadObjectByKey(const std::string& key) override;
+   std::shared_ptr<wsr88d::NexradFile>
+   LoadObjectByKeyRanged(const std::string&         key,
+                         std::size_t                rangeSize,
+                         const RangeLoadedCallback& callback,
+                         const CancelledCallback&   cancelled = {}) override;
+
 protected:
    std::string GetPrefix(std::chrono::system_clock::time_point date);
 
@@ -19,6 +19,13 @@ public:
                                   const std::string& product,
                                   const std::string& bucketName,
                                   const std::string& region);
+
+   /**
+    * Creates a provider for the default bucket, failing over to mirrors.
+    */
+   explicit AwsLevel3DataProvider(const std::string&           radarSite,
+                                  const std::string&           product,
+                                  const std::vector<Endpoint>& mirrors);
    ~AwsLevel3DataProvider();
 
    AwsLevel3DataProvider(const AwsLevel3DataProvider&) = delete;
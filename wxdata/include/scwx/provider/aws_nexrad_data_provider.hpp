@@ -2,6 +2,9 @@
 
 #include <scwx/provider/nexrad_data_provider.hpp>
 
+#include <functional>
+#include <optional>
+
 namespace Aws
 {
 namespace S3
@@ -21,9 +24,31 @@ namespace provider
 class AwsNexradDataProvider : public NexradDataProvider
 {
 public:
+   /**
+    * @brief An S3 bucket containing NEXRAD data. Buckets mirroring each other
+    * must use the same key layout.
+    */
+   struct Endpoint
+   {
+      std::string bucketName_ {};
+      std::string region_ {};
+      std::string endpointOverride_ {}; ///< S3 compatible host, if not AWS
+   };
+
    explicit AwsNexradDataProvider(const std::string& radarSite,
                                   const std::string& bucketName,
                                   const std::string& region);
+
+   /**
+    * Creates a provider which requests objects from the fastest available
+    * endpoint, and fails over to the remaining endpoints. Objects are cached
+    * under the first endpoint.
+    *
+    * @param radarSite Radar site
+    * @param endpoints Buckets containing the same objects, must not be empty
+    */
+   explicit AwsNexradDataProvider(const std::string&           radarSite,
+                                  const std::vector<Endpoint>& endpoints);
    virtual ~AwsNexradDataProvider();
 
    AwsNexradDataProvider(const AwsNexradDataProvider&)            = delete;
@@ -44,12 +69,64 @@ public:
    std::tuple<bool, size_t, size_t>
    ListObjects(std::chrono::system_clock::time_point date) override;
    std::shared_ptr<wsr88d::NexradFile>
-                             LoadObjectByKey(const std::string& key) override;
+   LoadObjectByKey(const std::string& key) override;
+   std::shared_ptr<std::vector<char>>
+   DownloadObjectByKey(const std::string&       key,
+                       const CancelledCallback& cancelled = {}) override;
+   bool AddObject(const std::string&                    key,
+                  std::chrono::system_clock::time_point lastModified) override;
    std::pair<size_t, size_t> Refresh() override;
 
 protected:
+   struct ObjectRange
+   {
+      std::shared_ptr<std::vector<char>> data_ {};
+      std::size_t                        objectSize_ {};
+      std::string                        eTag_ {};
+   };
+
+   typedef std::function<void(const char* data, std::size_t size)>
+      DataReceivedCallback;
+
+   /**
+    * Gets the client of the first endpoint.
+    */
    std::shared_ptr<Aws::S3::S3Client> client();
 
+   /**
+    * Downloads a byte range of an object, bypassing the object cache.
+    *
+    * @param key NEXRAD data key
+    * @param offset Offset of the first byte to download
+    * @param length Maximum number of bytes to download
+    *
+    * @return Downloaded range, including the size of the entire object, or
+    * empty if the download failed
+    */
+   std::optional<ObjectRange> DownloadObjectRange(const std::string& key,
+                                                  std::size_t        offset,
+                                                  std::size_t        length);
+
+   /**
+    * Downloads an object, passing the body to a callback as it is received,
+    * bypassing the object cache.
+    *
+    * @param key NEXRAD data key
+    * @param callback Called from the downloading thread with each part of the
+    * body
+    *
+    * @return Entity tag of the object, or empty if the download failed. Data
+    * passed to the callback is only valid if the download was successful.
+    */
+   std::optional<std::string>
+   DownloadObjectStreamed(const std::string&          key,
+                          const DataReceivedCallback& callback);
+
+   /**
+    * Gets the key an object is stored under in the object cache.
+    */
+   std::string ObjectCacheKey(const std::string& key) const;
+
    virtual std::string
    GetPrefix(std::chrono::system_clock::time_point date) = 0;
 
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <scwx/provider/nexrad_data_provider.hpp>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief Local NEXRAD Data Provider
+ *
+ * Provides NEXRAD files from a local directory tree, such as one written by an
+ * LDM feed. Files must use the same names as the AWS buckets, e.g.,
+ * KLSX20210527_175717_V06 for Level 2 data and LSX_N0B_2021_05_27_17_59_00 for
+ * Level 3 data, and may be in any subdirectory. Keys are file paths relative
+ * to the directory. Files should be written completely before they are
+ * renamed into the directory.
+ */
+class LocalNexradDataProvider : public NexradDataProvider
+{
+public:
+   /**
+    * Creates a Level 2 data provider.
+    *
+    * @param directory Root of the directory tree
+    * @param radarSite Radar site
+    */
+   explicit LocalNexradDataProvider(const std::string& directory,
+                                    const std::string& radarSite);
+
+   /**
+    * Creates a Level 3 data provider.
+    *
+    * @param directory Root of the directory tree
+    * @param radarSite Radar site
+    * @param product Level 3 product (e.g., N0B)
+    */
+   explicit LocalNexradDataProvider(const std::string& directory,
+                                    const std::string& radarSite,
+                                    const std::string& product);
+   ~LocalNexradDataProvider();
+
+   LocalNexradDataProvider(const LocalNexradDataProvider&)            = delete;
+   LocalNexradDataProvider& operator=(const LocalNexradDataProvider&) = delete;
+
+   LocalNexradDataProvider(LocalNexradDataProvider&&) noexcept;
+   LocalNexradDataProvider& operator=(LocalNexradDataProvider&&) noexcept;
+
+   size_t cache_size() const override;
+
+   std::chrono::system_clock::time_point last_modified() const override;
+   std::chrono::seconds                  update_period() const override;
+
+   std::string FindKey(std::chrono::system_clock::time_point time) override;
+   std::string FindLatestKey() override;
+   std::vector<std::chrono::system_clock::time_point>
+   GetTimePointsByDate(std::chrono::system_clock::time_point date) override;
+   std::tuple<bool, size_t, size_t>
+   ListObjects(std::chrono::system_clock::time_point date) override;
+   std::shared_ptr<wsr88d::NexradFile>
+   LoadObjectByKey(const std::string& key) override;
+   bool AddObject(const std::string&                    key,
+                  std::chrono::system_clock::time_point lastModified) override;
+   std::pair<size_t, size_t> Refresh() override;
+
+   std::chrono::system_clock::time_point
+   GetTimePointByKey(const std::string& key) const override;
+
+   void                     RequestAvailableProducts() override;
+   std::vector<std::string> GetAvailableProducts() override;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace provider
+} // namespace scwx
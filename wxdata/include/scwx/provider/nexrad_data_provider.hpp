@@ -3,6 +3,7 @@
 #include <scwx/wsr88d/nexrad_file.hpp>
 
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -15,6 +16,39 @@ namespace provider
 class NexradDataProvider
 {
 public:
+   /**
+    * Invoked as each prefetched object completes loading. Parameters are the
+    * provider, the object key, the object time point, and the NEXRAD data,
+    * which is nullptr if the object failed to load.
+    */
+   typedef std::function<void(const std::shared_ptr<NexradDataProvider>&,
+                              const std::string&,
+                              std::chrono::system_clock::time_point,
+                              std::shared_ptr<wsr88d::NexradFile>)>
+      PrefetchCallback;
+
+   /**
+    * Invoked before each prefetched object is loaded, with the provider and
+    * the object time point. Returns false to skip the object, which is then
+    * neither loaded nor passed to the prefetch callback.
+    */
+   typedef std::function<bool(const std::shared_ptr<NexradDataProvider>&,
+                              std::chrono::system_clock::time_point)>
+      PrefetchFilter;
+
+   /**
+    * Invoked as a NEXRAD file object loaded in ranges is updated with more
+    * data. The parameter is the partially loaded NEXRAD data.
+    */
+   typedef std::function<void(const std::shared_ptr<wsr88d::NexradFile>&)>
+      RangeLoadedCallback;
+
+   /**
+    * Polled while an object is downloaded. Returns true once the object is no
+    * longer required, abandoning the download.
+    */
+   typedef std::function<bool()> CancelledCallback;
+
    explicit NexradDataProvider();
    virtual ~NexradDataProvider();
 
@@ -81,6 +115,57 @@ public:
    virtual std::shared_ptr<wsr88d::NexradFile>
    LoadObjectByKey(const std::string& key) = 0;
 
+   /**
+    * Downloads the raw data of a NEXRAD file object by the given key, without
+    * decoding it. This allows the download and decode to be scheduled
+    * separately. Providers which do not support this return nullptr, and the
+    * object must be loaded with LoadObjectByKey.
+    *
+    * @param key NEXRAD data key
+    * @param cancelled Polled during the download, abandoning the download
+    * once it returns true
+    *
+    * @return Raw NEXRAD data, or nullptr if the download was abandoned
+    */
+   virtual std::shared_ptr<std::vector<char>>
+   DownloadObjectByKey(const std::string&       key,
+                       const CancelledCallback& cancelled = {});
+
+   /**
+    * Loads a NEXRAD file object by the given key, downloading the object in
+    * ranges. The object is usable, and the callback is invoked, as soon as the
+    * first ranges have been decoded, and the remainder of the object continues
+    * loading into the same NEXRAD data. Providers which do not support ranged
+    * loading load the entire object, and invoke the callback once.
+    *
+    * @param key NEXRAD data key
+    * @param rangeSize Size of each range to download, in bytes
+    * @param callback Invoked each time more data has been loaded
+    * @param cancelled Polled between ranges, abandoning the load once it
+    * returns true
+    *
+    * @return NEXRAD data, once the entire object has been loaded, or nullptr
+    * if the load was abandoned
+    */
+   virtual std::shared_ptr<wsr88d::NexradFile>
+   LoadObjectByKeyRanged(const std::string&         key,
+                         std::size_t                rangeSize,
+                         const RangeLoadedCallback& callback,
+                         const CancelledCallback&   cancelled = {});
+
+   /**
+    * Adds a newly created NEXRAD object to the cache without listing, such as
+    * from an object notification. Objects which do not belong to this
+    * provider's radar site and product are ignored.
+    *
+    * @param key NEXRAD data key
+    * @param lastModified Time the object was created
+    *
+    * @return Whether the object was added to the cache
+    */
+   virtual bool AddObject(const std::string&                    key,
+                          std::chrono::system_clock::time_point lastModified);
+
    /**
     * Lists NEXRAD objects for the current date, and adds them to the cache. If
     * no objects have been added to the cache for the current date, the previous
@@ -113,6 +198,19 @@ public:
    virtual std::vector<std::chrono::system_clock::time_point>
    GetTimePointsByDate(std::chrono::system_clock::time_point date) = 0;
 
+   /**
+    * Gets NEXRAD data time points for each date in the range supplied. Dates
+    * which have not been listed are listed concurrently.
+    *
+    * @param firstDate First date for which to get NEXRAD data time points
+    * @param lastDate Last date for which to get NEXRAD data time points
+    *
+    * @return NEXRAD data time points, in order
+    */
+   virtual std::vector<std::chrono::system_clock::time_point>
+   GetTimePointsByDateRange(std::chrono::system_clock::time_point firstDate,
+                            std::chrono::system_clock::time_point lastDate);
+
    /**
     * Requests available NEXRAD products for the current radar site, and adds
     * the list to the cache.
@@ -126,6 +224,31 @@ public:
     */
    virtual std::vector<std::string> GetAvailableProducts();
 
+   /**
+    * Lists and loads all NEXRAD objects within a time range, for each of the
+    * providers supplied. Listings for every provider and date are issued
+    * concurrently, followed by the object loads, with no more than the
+    * maximum number of requests in flight at once. The callback is invoked
+    * as each object completes, in completion order. Invocations are
+    * serialized, but are made from worker threads.
+    *
+    * @param providers NEXRAD data providers, typically one per product
+    * @param startTime Start of the time range, inclusive
+    * @param endTime End of the time range, inclusive
+    * @param callback Invoked as each object completes loading
+    * @param maxInFlight Maximum number of concurrent requests
+    * @param filter Selects the objects to load, or nullptr to load all
+    *
+    * @return Number of objects successfully loaded
+    */
+   static std::size_t
+   Prefetch(const std::vector<std::shared_ptr<NexradDataProvider>>& providers,
+            std::chrono::system_clock::time_point startTime,
+            std::chrono::system_clock::time_point endTime,
+            const PrefetchCallback&               callback,
+            std::size_t                           maxInFlight = 8,
+            const PrefetchFilter&                 filter      = nullptr);
+
 private:
    class Impl;
    std::unique_ptr<Impl> p;
@@ -1,8 +1,11 @@
 #pragma once
 
-#include <scwx/provider/nexrad_data_provider.hpp>
+#include <scwx/provider/aws_nexrad_data_provider.hpp>
+#include <scwx/provider/replay_clock.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace scwx
 {
@@ -24,12 +27,62 @@ private:
    operator=(NexradDataProviderFactory&&) noexcept = delete;
 
 public:
+   typedef AwsNexradDataProvider::Endpoint Endpoint;
+
    static std::shared_ptr<NexradDataProvider>
    CreateLevel2DataProvider(const std::string& radarSite);
 
    static std::shared_ptr<NexradDataProvider>
    CreateLevel3DataProvider(const std::string& radarSite,
                             const std::string& product);
+
+   /**
+    * Sets buckets mirroring the default Level 2 bucket. Providers created
+    * afterward select the fastest available bucket, and fail over to the
+    * others.
+    */
+   static void SetLevel2Mirrors(const std::vector<Endpoint>& mirrors);
+
+   /**
+    * Sets buckets mirroring the default Level 3 bucket. Providers created
+    * afterward select the fastest available bucket, and fail over to the
+    * others.
+    */
+   static void SetLevel3Mirrors(const std::vector<Endpoint>& mirrors);
+
+   /**
+    * Parses a list of bucket mirrors, such as from a setting. Mirrors are
+    * separated by commas or whitespace, and are written as
+    * "bucket:region[:endpoint]", where the optional endpoint is the host of
+    * an S3 compatible service. Malformed mirrors are skipped.
+    *
+    * @param value List of mirrors
+    *
+    * @return Mirror endpoints
+    */
+   [[nodiscard]] static std::vector<Endpoint>
+   ParseMirrors(const std::string& value);
+
+   /**
+    * Sets a local directory tree providing NEXRAD data, such as one written by
+    * an LDM feed. Providers created afterward read from the directory instead
+    * of AWS. An empty directory restores the AWS providers.
+    *
+    * @param directory Local data directory
+    */
+   static void SetLocalDirectory(const std::string& directory);
+
+   /**
+    * Sets a recorded directory tree of NEXRAD data to replay, in the same
+    * format as a local data directory. Providers created afterward replay the
+    * recorded data according to the replay clock, instead of reading from AWS
+    * or a local directory. A null clock ends the replay.
+    *
+    * @param directory Recorded data directory
+    * @param clock Replay clock
+    */
+   static void SetReplay(const std::string&                 directory,
+                         std::shared_ptr<const ReplayClock> clock);
 };
 
 } // namespace provider
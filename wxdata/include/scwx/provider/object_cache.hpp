@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief A size-bounded on-disk cache of downloaded data provider objects.
+ *
+ * Objects are keyed by their full object key (e.g., bucket and S3 key), and
+ * are stored with the entity tag returned by the server, so cached objects can
+ * be revalidated. When the cache exceeds its maximum size, the least recently
+ * used objects are evicted. The cache is disabled until a path is set.
+ */
+class ObjectCache
+{
+public:
+   struct Object
+   {
+      std::string                        eTag_ {};
+      std::shared_ptr<std::vector<char>> data_ {};
+   };
+
+   explicit ObjectCache();
+   ~ObjectCache();
+
+   ObjectCache(const ObjectCache&)            = delete;
+   ObjectCache& operator=(const ObjectCache&) = delete;
+
+   ObjectCache(ObjectCache&&) noexcept;
+   ObjectCache& operator=(ObjectCache&&) noexcept;
+
+   /**
+    * @brief Gets whether the cache has a path and a non-zero maximum size.
+    */
+   bool enabled() const;
+
+   /**
+    * @brief Gets the maximum size of the cache, in bytes.
+    */
+   std::size_t max_size() const;
+
+   /**
+    * @brief Sets the directory cached objects are stored in. The directory is
+    * created if it does not exist. An empty path disables the cache.
+    *
+    * @param [in] path Cache directory
+    */
+   void SetPath(const std::string& path);
+
+   /**
+    * @brief Sets the maximum size of the cache, in bytes. A maximum size of
+    * zero disables the cache. Objects are evicted if the cache is over the new
+    * maximum size.
+    *
+    * @param [in] maxSize Maximum size
+    */
+   void SetMaxSize(std::size_t maxSize);
+
+   /**
+    * @brief Gets whether an object may be cached, without reading it.
+    *
+    * @param [in] key Object key
+    */
+   bool Contains(const std::string& key) const;
+
+   /**
+    * @brief Gets a cached object, marking it as recently used.
+    *
+    * @param [in] key Object key
+    *
+    * @return Cached object, or empty if the object is not cached
+    */
+   std::optional<Object> Get(const std::string& key);
+
+   /**
+    * @brief Stores an object, replacing any cached object with the same key.
+    *
+    * @param [in] key Object key
+    * @param [in] eTag Entity tag of the object
+    * @param [in] data Object data
+    */
+   void Put(const std::string&       key,
+            const std::string&       eTag,
+            const std::vector<char>& data);
+
+   /**
+    * @brief Removes a cached object.
+    *
+    * @param [in] key Object key
+    */
+   void Remove(const std::string& key);
+
+   /**
+    * @brief Evicts the least recently used objects until the cache is within
+    * its maximum size.
+    */
+   void Prune();
+
+   static ObjectCache& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace provider
+} // namespace scwx
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief Gets the interval until a data provider should next be refreshed.
+ *
+ * The next object is expected one update period after the latest object was
+ * last modified, and the refresh is scheduled for that time. Once the expected
+ * time has passed, refresh is repeated at the fast interval. For each update
+ * period the object is overdue, the interval is doubled, up to the slow
+ * interval.
+ *
+ * @param [in] lastModified Last modified time of the latest object
+ * @param [in] updatePeriod Expected time between objects
+ * @param [in] now Current time
+ * @param [in] fastInterval Minimum refresh interval
+ * @param [in] slowInterval Maximum refresh interval while overdue
+ *
+ * @return Refresh interval
+ */
+std::chrono::milliseconds
+GetRefreshInterval(std::chrono::system_clock::time_point lastModified,
+                   std::chrono::seconds                  updatePeriod,
+                   std::chrono::system_clock::time_point now,
+                   std::chrono::seconds                  fastInterval,
+                   std::chrono::seconds                  slowInterval);
+
+} // namespace provider
+} // namespace scwx
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief Maps wall-clock time to the time of recorded data being replayed.
+ * Replay begins at the start time when the clock is created, and advances at
+ * a multiple of wall-clock time (e.g., a speed of 36 replays 6 hours of data
+ * in 10 minutes).
+ */
+class ReplayClock
+{
+public:
+   /**
+    * @param [in] startTime Time of the recorded data when replay begins
+    * @param [in] speed Replay speed, as a multiple of wall-clock time
+    * @param [in] wallStartTime Wall-clock time when replay begins
+    */
+   explicit ReplayClock(std::chrono::system_clock::time_point startTime,
+                        double                                speed,
+                        std::chrono::system_clock::time_point wallStartTime =
+                           std::chrono::system_clock::now());
+
+   /**
+    * @brief Gets the replay speed.
+    *
+    * @return Replay speed, as a multiple of wall-clock time
+    */
+   double speed() const;
+
+   /**
+    * @brief Gets the time of the recorded data when replay began.
+    *
+    * @return Replay start time
+    */
+   std::chrono::system_clock::time_point start_time() const;
+
+   /**
+    * @brief Gets the current time of the recorded data.
+    *
+    * @param [in] wallTime Wall-clock time
+    *
+    * @return Replay time
+    */
+   std::chrono::system_clock::time_point
+   now(std::chrono::system_clock::time_point wallTime =
+          std::chrono::system_clock::now()) const;
+
+   /**
+    * @brief Gets the wall-clock time at which the recorded data reaches the
+    * time provided.
+    *
+    * @param [in] replayTime Replay time
+    *
+    * @return Wall-clock time
+    */
+   std::chrono::system_clock::time_point
+   GetWallTime(std::chrono::system_clock::time_point replayTime) const;
+
+   /**
+    * @brief Converts a duration of recorded data to a wall-clock duration.
+    *
+    * @param [in] duration Replay duration
+    *
+    * @return Wall-clock duration
+    */
+   std::chrono::system_clock::duration
+   GetWallDuration(std::chrono::system_clock::duration duration) const;
+
+private:
+   std::chrono::system_clock::time_point startTime_;
+   double                                speed_;
+   std::chrono::system_clock::time_point wallStartTime_;
+};
+
+} // namespace provider
+} // namespace scwx
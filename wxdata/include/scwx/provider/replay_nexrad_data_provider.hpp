@@ -0,0 +1,66 @@
+#pragma once
+
+#include <scwx/provider/nexrad_data_provider.hpp>
+#include <scwx/provider/replay_clock.hpp>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief Replay NEXRAD Data Provider
+ *
+ * Replays recorded NEXRAD data as if it were arriving live. Objects are
+ * provided by a recording provider, such as a local data provider reading a
+ * recorded directory, and become available as the replay clock reaches their
+ * time. Refresh timing is reported in wall-clock time, so consumers refresh at
+ * the accelerated rate.
+ */
+class ReplayNexradDataProvider : public NexradDataProvider
+{
+public:
+   /**
+    * @param recording Provider of the recorded data
+    * @param clock Replay clock
+    */
+   explicit ReplayNexradDataProvider(
+      const std::shared_ptr<NexradDataProvider>& recording,
+      const std::shared_ptr<const ReplayClock>&  clock);
+   ~ReplayNexradDataProvider();
+
+   ReplayNexradDataProvider(const ReplayNexradDataProvider&) = delete;
+   ReplayNexradDataProvider&
+   operator=(const ReplayNexradDataProvider&) = delete;
+
+   ReplayNexradDataProvider(ReplayNexradDataProvider&&) noexcept;
+   ReplayNexradDataProvider& operator=(ReplayNexradDataProvider&&) noexcept;
+
+   size_t cache_size() const override;
+
+   std::chrono::system_clock::time_point last_modified() const override;
+   std::chrono::seconds                  update_period() const override;
+
+   std::string FindKey(std::chrono::system_clock::time_point time) override;
+   std::string FindLatestKey() override;
+   std::vector<std::chrono::system_clock::time_point>
+   GetTimePointsByDate(std::chrono::system_clock::time_point date) override;
+   std::tuple<bool, size_t, size_t>
+   ListObjects(std::chrono::system_clock::time_point date) override;
+   std::shared_ptr<wsr88d::NexradFile>
+   LoadObjectByKey(const std::string& key) override;
+   std::pair<size_t, size_t> Refresh() override;
+
+   std::chrono::system_clock::time_point
+   GetTimePointByKey(const std::string& key) const override;
+
+   void                     RequestAvailableProducts() override;
+   std::vector<std::string> GetAvailableProducts() override;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace provider
+} // namespace scwx
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <scwx/provider/replay_clock.hpp>
+#include <scwx/provider/warnings_provider.hpp>
+
+#include <memory>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief Replay Warnings Provider
+ *
+ * Replays recorded warnings files as if they were being received live. Files
+ * must use the same names as the warnings provider, e.g.,
+ * warnings_20210527_17.txt, and may be in any subdirectory. Each product
+ * becomes available as the replay clock reaches the time in its WMO header.
+ */
+class ReplayWarningsProvider : public WarningsProvider
+{
+public:
+   /**
+    * @param directory Root of the recorded directory tree
+    * @param clock Replay clock
+    */
+   explicit ReplayWarningsProvider(
+      const std::string&                        directory,
+      const std::shared_ptr<const ReplayClock>& clock);
+   ~ReplayWarningsProvider();
+
+   ReplayWarningsProvider(const ReplayWarningsProvider&)            = delete;
+   ReplayWarningsProvider& operator=(const ReplayWarningsProvider&) = delete;
+
+   ReplayWarningsProvider(ReplayWarningsProvider&&) noexcept;
+   ReplayWarningsProvider& operator=(ReplayWarningsProvider&&) noexcept;
+
+   /**
+    * @brief Lists the recorded warnings files. Files containing products which
+    * have been reached by the replay clock, and have not yet been loaded, are
+    * counted as updated.
+    */
+   std::pair<size_t, size_t> ListFiles(
+      std::chrono::system_clock::time_point newerThan = {}) override;
+
+   /**
+    * @brief Loads the products which have been reached by the replay clock
+    * since the last call.
+    */
+   std::vector<std::shared_ptr<awips::TextProductFile>> LoadUpdatedFiles(
+      std::chrono::system_clock::time_point newerThan = {}) override;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace provider
+} // namespace scwx
@@ -2,6 +2,8 @@
 
 #include <scwx/awips/text_product_file.hpp>
 
+#include <map>
+
 namespace scwx
 {
 namespace provider
@@ -14,7 +16,7 @@ class WarningsProvider
 {
 public:
    explicit WarningsProvider(const std::string& baseUrl);
-   ~WarningsProvider();
+   virtual ~WarningsProvider();
 
    WarningsProvider(const WarningsProvider&)            = delete;
    WarningsProvider& operator=(const WarningsProvider&) = delete;
@@ -22,9 +24,45 @@ public:
    WarningsProvider(WarningsProvider&&) noexcept;
    WarningsProvider& operator=(WarningsProvider&&) noexcept;
 
-   std::pair<size_t, size_t>
+   /**
+    * @brief Gets the base URL of the warnings provider.
+    *
+    * @return Base URL
+    */
+   std::string base_url() const;
+
+   /**
+    * @brief Gets the number of bytes of each warnings file which have been
+    * loaded, in order to save the state of the provider.
+    *
+    * @return Loaded size of each warnings file, by filename
+    */
+   std::map<std::string, std::size_t> loaded_sizes() const;
+
+   /**
+    * @brief Restores the number of bytes of each warnings file which have
+    * already been loaded, e.g., in a previous session. When a restored file is
+    * next listed, only the data appended to it since is loaded. If the file is
+    * no longer listed, or has become smaller, the restored size is ignored.
+    *
+    * @param [in] loadedSizes Loaded size of each warnings file, by filename
+    */
+   void
+   RestoreLoadedSizes(const std::map<std::string, std::size_t>& loadedSizes);
+
+   virtual std::pair<size_t, size_t>
    ListFiles(std::chrono::system_clock::time_point newerThan = {});
-   std::vector<std::shared_ptr<awips::TextProductFile>>
+
+   /**
+    * @brief Loads warnings files which have been updated since the last call.
+    * Warnings files are only appended to, so once a file has been loaded, only
+    * the complete products appended to it since are requested and returned.
+    *
+    * @param [in] newerThan Only load files starting after this time
+    *
+    * @return Text product files containing the newly loaded products
+    */
+   virtual std::vector<std::shared_ptr<awips::TextProductFile>>
    LoadUpdatedFiles(std::chrono::system_clock::time_point newerThan = {});
 
 private:
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+namespace scwx
+{
+namespace util
+{
+
+struct AllocationCount
+{
+   std::uint64_t allocations_ {0u};
+   std::uint64_t bytes_ {0u};
+};
+
+/**
+ * @brief Counts heap allocations made with operator new, in order to find
+ * allocation storms in frequently executed code.
+ *
+ * Allocations are only counted when built with SCWX_ALLOCATION_TRACKING, which
+ * replaces the global operator new. Otherwise, all counts are zero. Memory
+ * which is freed is not subtracted.
+ */
+class AllocationTracker
+{
+public:
+   /**
+    * @brief Determines whether allocations are being counted.
+    */
+   static bool IsAvailable();
+
+   /**
+    * @brief Gets the allocations made by the calling thread since it started.
+    */
+   static AllocationCount GetThreadCount();
+
+   /**
+    * @brief Gets the allocations made by all threads since the process
+    * started.
+    */
+   static AllocationCount GetProcessCount();
+};
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief A thread-safe monotonic memory resource.
+ *
+ * Individual deallocations are no-ops. Memory is released in blocks when the
+ * arena is destroyed.
+ */
+class Arena : public std::pmr::memory_resource
+{
+public:
+   explicit Arena(std::size_t initialSize = 1u << 20);
+   ~Arena();
+
+   Arena(const Arena&)            = delete;
+   Arena& operator=(const Arena&) = delete;
+
+   Arena(Arena&&)            = delete;
+   Arena& operator=(Arena&&) = delete;
+
+   /**
+    * @brief Total bytes allocated from the arena.
+    */
+   std::size_t bytes_allocated() const;
+
+protected:
+   void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+   void  do_deallocate(void*       p,
+                       std::size_t bytes,
+                       std::size_t alignment) override;
+   bool  do_is_equal(const std::pmr::memory_resource& other)
+      const noexcept override;
+
+private:
+   std::mutex                          mutex_;
+   std::pmr::monotonic_buffer_resource resource_;
+   std::atomic<std::size_t>            bytesAllocated_ {0};
+};
+
+/**
+ * @brief An allocator sharing ownership of an arena. Objects allocated with
+ * std::allocate_shared keep the arena alive until they are destroyed.
+ */
+template<class T>
+class ArenaAllocator
+{
+public:
+   typedef T value_type;
+
+   explicit ArenaAllocator(std::shared_ptr<Arena> arena) :
+       arena_ {std::move(arena)}
+   {
+   }
+
+   template<class U>
+   ArenaAllocator(const ArenaAllocator<U>& other) : arena_ {other.arena()}
+   {
+   }
+
+   T* allocate(std::size_t n)
+   {
+      return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+   }
+
+   void deallocate(T* p, std::size_t n)
+   {
+      arena_->deallocate(p, n * sizeof(T), alignof(T));
+   }
+
+   const std::shared_ptr<Arena>& arena() const { return arena_; }
+
+   template<class U>
+   bool operator==(const ArenaAllocator<U>& other) const
+   {
+      return arena_ == other.arena();
+   }
+
+private:
+   std::shared_ptr<Arena> arena_;
+};
+
+/**
+ * @brief Creates a shared object in the arena if one is provided, otherwise
+ * on the heap.
+ */
+template<class T, class... Args>
+std::shared_ptr<T> MakeShared(const std::shared_ptr<Arena>& arena,
+                              Args&&... args)
+{
+   if (arena != nullptr)
+   {
+      return std::allocate_shared<T>(ArenaAllocator<T>(arena),
+                                     std::forward<Args>(args)...);
+   }
+
+   return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+} // namespace util
+} // namespace scwx
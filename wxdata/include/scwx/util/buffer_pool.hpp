@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief A thread-safe pool of growable byte buffers.
+ *
+ * Buffers acquired from the pool are returned to it when the last reference
+ * is released, retaining their capacity for the next load. Idle buffers are
+ * reused by best fit, and their total capacity is limited. Buffers may safely
+ * outlive the pool.
+ */
+class BufferPool
+{
+public:
+   typedef std::vector<char> Buffer;
+
+   /**
+    * @brief Constructs a buffer pool.
+    *
+    * @param maxIdleBytes Maximum total capacity of idle buffers retained
+    * @param maxBufferCapacity Maximum capacity of a single retained buffer
+    */
+   explicit BufferPool(std::size_t maxIdleBytes      = 256u << 20,
+                       std::size_t maxBufferCapacity = 32u << 20);
+   ~BufferPool();
+
+   BufferPool(const BufferPool&)            = delete;
+   BufferPool& operator=(const BufferPool&) = delete;
+
+   BufferPool(BufferPool&&) noexcept;
+   BufferPool& operator=(BufferPool&&) noexcept;
+
+   /**
+    * @brief Acquires an empty buffer from the pool. If a capacity is given,
+    * the smallest idle buffer large enough is used, unless it has much more
+    * capacity than required. Otherwise, the largest idle buffer is used.
+    *
+    * @param [in] capacity Minimum capacity to reserve
+    *
+    * @return Empty buffer, returned to the pool on release
+    */
+   std::shared_ptr<Buffer> Acquire(std::size_t capacity = 0);
+
+   /**
+    * @brief Gets a buffer with the contents of the given buffer, and little
+    * unused capacity, such that it may be retained. If the buffer has much
+    * more capacity than its size, its contents are copied to a buffer
+    * acquired for its size. Otherwise, the buffer itself is returned.
+    *
+    * @param [in] buffer Buffer to fit
+    *
+    * @return Buffer sized to its contents
+    */
+   std::shared_ptr<Buffer> ShrinkToFit(const std::shared_ptr<Buffer>& buffer);
+
+   /**
+    * @brief Gets the number of idle buffers held by the pool.
+    */
+   std::size_t idle_count() const;
+
+   /**
+    * @brief Gets the total capacity of idle buffers held by the pool.
+    */
+   std::size_t idle_bytes() const;
+
+   /**
+    * @brief Releases all idle buffers held by the pool.
+    */
+   void Clear();
+
+   static std::shared_ptr<BufferPool> Instance();
+
+private:
+   class Impl;
+   std::shared_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <scwx/util/cpu_features.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace scwx
+{
+namespace util
+{
+
+typedef void (*BigEndianToHost16Function)(std::uint16_t* data,
+                                          std::size_t    count);
+typedef void (*BigEndianToHost32Function)(std::uint32_t* data,
+                                          std::size_t    count);
+
+/**
+ * @brief Converts an array of big-endian 16-bit values to host byte order in
+ * place.
+ *
+ * @param [inout] data Values to convert
+ * @param [in] count Number of values
+ */
+void BigEndianToHost16(std::uint16_t* data, std::size_t count);
+
+/**
+ * @brief Converts an array of big-endian 32-bit values to host byte order in
+ * place.
+ *
+ * @param [inout] data Values to convert
+ * @param [in] count Number of values
+ */
+void BigEndianToHost32(std::uint32_t* data, std::size_t count);
+
+/**
+ * @brief Converts an array of big-endian IEEE 754 single precision values to
+ * host byte order in place.
+ *
+ * @param [inout] data Values to convert
+ * @param [in] count Number of values
+ */
+void BigEndianToHostFloat(float* data, std::size_t count);
+
+/**
+ * @brief Returns the variants of BigEndianToHost16, selected at runtime for the
+ * instruction sets supported by the processor.
+ */
+const KernelTable<BigEndianToHost16Function>& BigEndianToHost16Kernels();
+
+/**
+ * @brief Returns the variants of BigEndianToHost32, selected at runtime for the
+ * instruction sets supported by the processor.
+ */
+const KernelTable<BigEndianToHost32Function>& BigEndianToHost32Kernels();
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <scwx/util/iterator.hpp>
+
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) ||            \
+   defined(_M_IX86)
+#   define SCWX_ARCH_X86
+#elif defined(__aarch64__) || defined(_M_ARM64) || defined(__arm__) ||         \
+   defined(_M_ARM)
+#   define SCWX_ARCH_ARM
+#endif
+
+// Kernels for an instruction set above the compiler baseline are compiled with
+// a function target, such that a single binary may contain every variant.
+// MSVC permits any intrinsic without a target.
+#if defined(SCWX_ARCH_X86) && (defined(__GNUC__) || defined(__clang__))
+#   define SCWX_TARGET(isa) __attribute__((target(isa)))
+#else
+#   define SCWX_TARGET(isa)
+#endif
+
+namespace scwx
+{
+namespace util
+{
+
+enum class InstructionSet
+{
+   Scalar,
+   SSE2,
+   SSE4_2,
+   AVX2,
+   AVX512,
+   NEON,
+   Unknown
+};
+typedef scwx::util::
+   Iterator<InstructionSet, InstructionSet::Scalar, InstructionSet::NEON>
+      InstructionSetIterator;
+
+InstructionSet     GetInstructionSet(const std::string& name);
+const std::string& GetInstructionSetName(InstructionSet instructionSet);
+
+/**
+ * @brief Determines whether the instruction set is supported by the processor
+ * and operating system. Features are detected once, on first use. AVX-512
+ * requires the foundation and byte/word instructions.
+ *
+ * @param [in] instructionSet Instruction set
+ *
+ * @return true if kernels targeting the instruction set may be executed
+ */
+bool IsInstructionSetSupported(InstructionSet instructionSet);
+
+/**
+ * @brief Limits the instruction sets selected by kernel tables to the
+ * instruction set named in the SCWX_INSTRUCTION_SET environment variable, if
+ * set. This allows a variant to be forced when diagnosing a kernel.
+ *
+ * @return Instruction set limit, or Unknown if not limited
+ */
+InstructionSet GetInstructionSetLimit();
+
+/**
+ * @brief Variant of a kernel, implemented using an instruction set.
+ */
+template<typename Function>
+struct Kernel
+{
+   InstructionSet instructionSet_;
+   Function       function_;
+};
+
+/**
+ * @brief Table of kernel variants, from which the first variant supported by
+ * the processor is selected when the table is constructed. Variants are listed
+ * in order of preference, and the table must end with a scalar reference
+ * variant, which is always supported.
+ *
+ * Tables are intended to be constructed once as a function local static, such
+ * that each call is a single indirect call.
+ */
+template<typename Function>
+class KernelTable
+{
+public:
+   explicit KernelTable(std::initializer_list<Kernel<Function>> kernels) :
+       kernels_ {kernels}
+   {
+      const InstructionSet limit = GetInstructionSetLimit();
+
+      for (auto& kernel : kernels_)
+      {
+         if (IsInstructionSetSupported(kernel.instructionSet_) &&
+             (limit == InstructionSet::Unknown ||
+              kernel.instructionSet_ == InstructionSet::Scalar ||
+              kernel.instructionSet_ == limit))
+         {
+            selected_ = kernel;
+            break;
+         }
+      }
+   }
+
+   /**
+    * @brief Invokes the selected variant.
+    */
+   template<typename... Args>
+   auto operator()(Args&&... args) const
+   {
+      return selected_.function_(std::forward<Args>(args)...);
+   }
+
+   /**
+    * @brief Returns every variant, including those which are not supported.
+    * Used to compare each supported variant against the scalar reference.
+    */
+   const std::vector<Kernel<Function>>& kernels() const { return kernels_; }
+
+   /**
+    * @brief Returns the selected variant.
+    */
+   const Kernel<Function>& selected() const { return selected_; }
+
+private:
+   std::vector<Kernel<Function>> kernels_;
+   Kernel<Function> selected_ {InstructionSet::Unknown, nullptr};
+};
+
+} // namespace util
+} // namespace scwx
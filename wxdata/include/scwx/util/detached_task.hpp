@@ -0,0 +1,29 @@
+#pragma once
+
+#include <coroutine>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Return type of a coroutine which is started immediately, and runs to
+ * completion without being awaited. The coroutine frame is destroyed once it
+ * completes. An exception escaping the coroutine is logged.
+ */
+class DetachedTask
+{
+public:
+   struct promise_type
+   {
+      DetachedTask       get_return_object() noexcept { return {}; }
+      std::suspend_never initial_suspend() const noexcept { return {}; }
+      std::suspend_never final_suspend() const noexcept { return {}; }
+      void               return_void() const noexcept {}
+      void               unhandled_exception() const noexcept;
+   };
+};
+
+} // namespace util
+} // namespace scwx
@@ -8,6 +8,7 @@
 #endif
 
 #include <spdlog/logger.h>
+#include <spdlog/spdlog.h>
 
 #if defined(_MSC_VER)
 #   pragma warning(pop)
@@ -24,6 +25,29 @@ void                            Initialize();
 void                            AddFileSink(const std::string& baseFilename);
 std::shared_ptr<spdlog::logger> Create(const std::string& name);
 
+/**
+ * @brief Adds a sink which receives the messages of all loggers.
+ *
+ * @param [in] sink Log sink
+ */
+void AddSink(std::shared_ptr<spdlog::sinks::sink> sink);
+
+/**
+ * @brief Enables or disables asynchronous logging. When enabled, messages are
+ * formatted and written by a background thread instead of the logging thread.
+ * Messages are held in a bounded queue, and the oldest messages are dropped if
+ * the writer falls behind. Disabling asynchronous logging writes any queued
+ * messages before returning.
+ *
+ * @param [in] async Whether messages are written asynchronously
+ */
+void SetAsync(bool async);
+
+/**
+ * @brief Writes any queued messages, and stops the background writer.
+ */
+void Shutdown();
+
 } // namespace Logger
 } // namespace util
 } // namespace scwx
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief A least recently used cache of shared objects, bounded by the total
+ * number of bytes held. Objects are accounted by group, and each group may
+ * additionally be limited to a number of objects.
+ *
+ * The cache is not thread-safe, and must be externally synchronized.
+ */
+template<class Group, class T>
+class LruCache
+{
+public:
+   /**
+    * @brief Constructs a cache.
+    *
+    * @param byteLimit Maximum number of bytes held, or 0 for no limit
+    */
+   explicit LruCache(std::size_t byteLimit = 0) : byteLimit_ {byteLimit} {}
+   ~LruCache() = default;
+
+   LruCache(const LruCache&)            = delete;
+   LruCache& operator=(const LruCache&) = delete;
+
+   LruCache(LruCache&&) noexcept            = default;
+   LruCache& operator=(LruCache&&) noexcept = default;
+
+   std::size_t byte_limit() const { return byteLimit_; }
+   std::size_t size() const { return entries_.size(); }
+   std::size_t size_bytes() const { return totalBytes_; }
+
+   std::size_t size(const Group& group) const
+   {
+      auto it = groups_.find(group);
+      return (it != groups_.cend()) ? it->second.count_ : 0;
+   }
+
+   std::size_t size_bytes(const Group& group) const
+   {
+      auto it = groups_.find(group);
+      return (it != groups_.cend()) ? it->second.bytes_ : 0;
+   }
+
+   /**
+    * @brief Gets the number of bytes held by the groups matching a predicate.
+    *
+    * @param predicate Function taking a group, returning true if the group
+    * is to be included
+    */
+   template<class Predicate>
+   std::size_t size_bytes_if(Predicate predicate) const
+   {
+      std::size_t bytes = 0;
+      for (auto& group : groups_)
+      {
+         if (predicate(group.first))
+         {
+            bytes += group.second.bytes_;
+         }
+      }
+      return bytes;
+   }
+
+   /**
+    * @brief Sets the maximum number of bytes held, evicting the least recently
+    * used objects as required.
+    *
+    * @param byteLimit Maximum number of bytes held, or 0 for no limit
+    */
+   void set_byte_limit(std::size_t byteLimit)
+   {
+      byteLimit_ = byteLimit;
+      Evict();
+   }
+
+   /**
+    * @brief Sets the maximum number of objects held for a group, evicting the
+    * least recently used objects of the group as required.
+    *
+    * @param group Group
+    * @param countLimit Maximum number of objects, or 0 for no limit
+    */
+   void set_count_limit(const Group& group, std::size_t countLimit)
+   {
+      auto& groupInfo       = groups_[group];
+      groupInfo.countLimit_ = countLimit;
+      EvictGroup(group, groupInfo);
+   }
+
+   /**
+    * @brief Inserts an object as the most recently used, or marks it as the
+    * most recently used if it is already held. The most recently used object
+    * is never evicted, even if it alone exceeds the byte limit.
+    *
+    * @param group Group the object is accounted to
+    * @param value Object to hold
+    * @param bytes Size of the object in bytes
+    */
+   void Insert(const Group& group, std::shared_ptr<T> value, std::size_t bytes)
+   {
+      if (value == nullptr)
+      {
+         return;
+      }
+
+      auto it = index_.find(value.get());
+      if (it != index_.cend())
+      {
+         // Update the accounting of the existing entry, and move it to the
+         // front of the list
+         Account(*it->second, false);
+         it->second->group_ = group;
+         it->second->bytes_ = bytes;
+         entries_.splice(entries_.begin(), entries_, it->second);
+      }
+      else
+      {
+         entries_.push_front({group, value, bytes});
+         index_.emplace(value.get(), entries_.begin());
+      }
+
+      Account(entries_.front(), true);
+
+      auto& groupInfo = groups_[group];
+      EvictGroup(group, groupInfo);
+      Evict();
+   }
+
+   /**
+    * @brief Marks an object as the most recently used, if it is held.
+    *
+    * @param value Object to mark
+    */
+   void Touch(const std::shared_ptr<T>& value)
+   {
+      auto it = index_.find(value.get());
+      if (it != index_.cend())
+      {
+         entries_.splice(entries_.begin(), entries_, it->second);
+      }
+   }
+
+   /**
+    * @brief Removes the least recently used objects until at least the given
+    * number of bytes has been released. The most recently used object is
+    * retained.
+    *
+    * @param bytes Number of bytes to release
+    *
+    * @return Number of bytes released
+    */
+   std::size_t Trim(std::size_t bytes)
+   {
+      std::size_t released = 0;
+
+      while (released < bytes && entries_.size() > 1)
+      {
+         auto it = std::prev(entries_.end());
+         released += it->bytes_;
+         EraseEntry(it);
+      }
+
+      return released;
+   }
+
+   /**
+    * @brief Removes an object from the cache.
+    *
+    * @param value Object to remove
+    */
+   void Erase(const std::shared_ptr<T>& value)
+   {
+      auto it = index_.find(value.get());
+      if (it != index_.cend())
+      {
+         EraseEntry(it->second);
+      }
+   }
+
+   /**
+    * @brief Removes all objects of a group from the cache.
+    *
+    * @param group Group to remove
+    */
+   void EraseGroup(const Group& group)
+   {
+      for (auto it = entries_.begin(); it != entries_.end();)
+      {
+         auto next = std::next(it);
+         if (it->group_ == group)
+         {
+            EraseEntry(it);
+         }
+         it = next;
+      }
+
+      groups_.erase(group);
+   }
+
+   /**
+    * @brief Removes all objects from the cache.
+    */
+   void Clear()
+   {
+      entries_.clear();
+      index_.clear();
+      groups_.clear();
+      totalBytes_ = 0;
+   }
+
+private:
+   struct Entry
+   {
+      Group              group_;
+      std::shared_ptr<T> value_;
+      std::size_t        bytes_;
+   };
+
+   struct GroupInfo
+   {
+      std::size_t count_ {0};
+      std::size_t bytes_ {0};
+      std::size_t countLimit_ {0};
+   };
+
+   typedef typename std::list<Entry>::iterator EntryIterator;
+
+   void Account(const Entry& entry, bool add)
+   {
+      auto& groupInfo = groups_[entry.group_];
+
+      if (add)
+      {
+         ++groupInfo.count_;
+         groupInfo.bytes_ += entry.bytes_;
+         totalBytes_ += entry.bytes_;
+      }
+      else
+      {
+         --groupInfo.count_;
+         groupInfo.bytes_ -= entry.bytes_;
+         totalBytes_ -= entry.bytes_;
+      }
+   }
+
+   void EraseEntry(EntryIterator it)
+   {
+      Account(*it, false);
+      index_.erase(it->value_.get());
+      entries_.erase(it);
+   }
+
+   void Evict()
+   {
+      // Remove the least recently used objects, retaining the most recent
+      while (byteLimit_ > 0 && totalBytes_ > byteLimit_ && entries_.size() > 1)
+      {
+         EraseEntry(std::prev(entries_.end()));
+      }
+   }
+
+   void EvictGroup(const Group& group, const GroupInfo& groupInfo)
+   {
+      if (groupInfo.countLimit_ == 0)
+      {
+         return;
+      }
+
+      // Remove the least recently used objects of the group
+      for (auto it = entries_.end();
+           groupInfo.count_ > groupInfo.countLimit_ && it != entries_.begin();)
+      {
+         --it;
+         if (it->group_ == group)
+         {
+            EraseEntry(it++);
+         }
+      }
+   }
+
+   std::size_t byteLimit_;
+   std::size_t totalBytes_ {0};
+
+   std::list<Entry>                            entries_ {};
+   std::unordered_map<const T*, EntryIterator> index_ {};
+   std::map<Group, GroupInfo>                  groups_ {};
+};
+
+} // namespace util
+} // namespace scwx
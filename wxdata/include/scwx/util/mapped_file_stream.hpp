@@ -0,0 +1,62 @@
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Read-only input stream over a memory mapped file. Reads are served
+ * directly from the mapping, without a copy through a file buffer, and the
+ * mapped data is available as a contiguous span for decoders which do not
+ * require a stream. Files which cannot be mapped, such as empty files, are
+ * read as a file stream instead.
+ */
+class MappedFileStream : public std::istream
+{
+public:
+   /**
+    * @brief Opens a file for reading. If the file cannot be opened, sets
+    * setstate(failbit).
+    *
+    * @param filename The file name to open
+    */
+   explicit MappedFileStream(const std::string& filename);
+   ~MappedFileStream();
+
+   MappedFileStream(const MappedFileStream&)            = delete;
+   MappedFileStream& operator=(const MappedFileStream&) = delete;
+
+   MappedFileStream(MappedFileStream&&) noexcept            = delete;
+   MappedFileStream& operator=(MappedFileStream&&) noexcept = delete;
+
+   /**
+    * @brief Checks if the stream has an associated file
+    */
+   bool is_open() const;
+
+   /**
+    * @brief Checks if the file is memory mapped, rather than read as a file
+    * stream
+    */
+   bool is_mapped() const;
+
+   /**
+    * @brief Contents of the mapped file, valid for the lifetime of the stream
+    *
+    * @return File contents, or an empty span if the file is not mapped
+    */
+   std::span<const char> data() const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace util
+{
+
+struct MemoryUsage
+{
+   std::string category_ {};
+   std::size_t bytes_ {0u};
+   std::size_t owners_ {0u};
+};
+
+/**
+ * @brief Accounts for the memory held by an owner, such as a cache, a data
+ * buffer or a GPU buffer. Each owner reports its own size, and the sizes of
+ * all owners of a category are totaled. The memory is no longer accounted for
+ * once the counter is destroyed.
+ */
+class MemoryCounter
+{
+public:
+   /**
+    * @param [in] category Category of the memory, such as "Radar Records"
+    */
+   explicit MemoryCounter(const std::string& category);
+   ~MemoryCounter();
+
+   MemoryCounter(const MemoryCounter&)            = delete;
+   MemoryCounter& operator=(const MemoryCounter&) = delete;
+
+   MemoryCounter(MemoryCounter&&) noexcept            = delete;
+   MemoryCounter& operator=(MemoryCounter&&) noexcept = delete;
+
+   /**
+    * @brief Gets the number of bytes reported by the owner.
+    */
+   std::size_t bytes() const;
+
+   /**
+    * @brief Reports the number of bytes held by the owner. May be called from
+    * any thread.
+    *
+    * @param [in] bytes Bytes held
+    */
+   void set_bytes(std::size_t bytes);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+/**
+ * @brief Gets the resident set size of the current process.
+ *
+ * @return Resident memory in bytes, or 0 if it could not be determined
+ */
+std::size_t GetResidentMemory();
+
+/**
+ * @brief Gets the memory reported by each category of memory counter.
+ *
+ * @return Memory usage, ordered by category
+ */
+std::vector<MemoryUsage> GetMemoryUsage();
+
+/**
+ * @brief Logs the resident memory, and the memory reported by each category
+ * of memory counter.
+ */
+void LogMemoryUsage();
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <scwx/util/iterator.hpp>
+
+#include <ostream>
+#include <string>
+
+namespace scwx
+{
+namespace util
+{
+
+enum class Metric
+{
+   DataTime,
+   DataLatency,
+   DownloadBytes,
+   DecodeSeconds,
+   FrameSeconds,
+   RefreshFailures,
+   Unknown
+};
+typedef scwx::util::
+   Iterator<Metric, Metric::DataTime, Metric::RefreshFailures>
+      MetricIterator;
+
+const std::string& GetMetricName(Metric metric);
+
+/**
+ * @brief Collects runtime counters for monitoring, such as the age of the
+ * displayed data and the number of failed refreshes. Each metric is kept per
+ * label value, such as a radar site or a map pane.
+ *
+ * Values are only recorded while metrics are enabled.
+ */
+class Metrics
+{
+public:
+   /**
+    * @brief Determines whether values are being recorded.
+    */
+   static bool IsEnabled();
+
+   /**
+    * @brief Enables or disables recording values.
+    */
+   static void SetEnabled(bool enabled);
+
+   /**
+    * @brief Increments a counter.
+    *
+    * @param [in] metric Counter metric
+    * @param [in] label Label value
+    * @param [in] value Increment
+    */
+   static void
+   Add(Metric metric, const std::string& label, double value = 1.0);
+
+   /**
+    * @brief Sets the value of a gauge.
+    *
+    * @param [in] metric Gauge metric
+    * @param [in] label Label value
+    * @param [in] value Value
+    */
+   static void Set(Metric metric, const std::string& label, double value);
+
+   /**
+    * @brief Records an observation of a summary, such as a duration. The sum
+    * and count of observations are reported.
+    *
+    * @param [in] metric Summary metric
+    * @param [in] label Label value
+    * @param [in] value Observed value
+    */
+   static void Observe(Metric metric, const std::string& label, double value);
+
+   /**
+    * @brief Writes all recorded values, along with the memory reported by
+    * memory counters, in the Prometheus text exposition format.
+    *
+    * @param [in] os Output stream
+    */
+   static void Write(std::ostream& os);
+};
+
+} // namespace util
+} // namespace scwx
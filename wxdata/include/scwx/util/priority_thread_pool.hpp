@@ -0,0 +1,118 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief A fixed-size thread pool with priority lanes.
+ *
+ * Tasks are queued by priority, and each worker runs the oldest task of the
+ * highest priority lane available. Tasks already running are not preempted.
+ */
+class PriorityThreadPool
+{
+public:
+   enum class Priority
+   {
+      High,      ///< User visible
+      Low,       ///< Prefetch
+      Background ///< Not required by the user
+   };
+
+   typedef std::function<void()> Task;
+
+   /**
+    * @brief Creates a thread pool.
+    *
+    * @param [in] threadCount Number of worker threads, at least one
+    * @param [in] name Name of the worker threads in profiler traces
+    */
+   explicit PriorityThreadPool(std::size_t        threadCount,
+                               const std::string& name = {});
+   ~PriorityThreadPool();
+
+   PriorityThreadPool(const PriorityThreadPool&)            = delete;
+   PriorityThreadPool& operator=(const PriorityThreadPool&) = delete;
+
+   PriorityThreadPool(PriorityThreadPool&&) noexcept            = delete;
+   PriorityThreadPool& operator=(PriorityThreadPool&&) noexcept = delete;
+
+   /**
+    * @brief Gets the number of worker threads.
+    */
+   std::size_t thread_count() const;
+
+   /**
+    * @brief Gets the number of tasks waiting to run.
+    */
+   std::size_t pending_count() const;
+
+   /**
+    * @brief Queues a task. Exceptions thrown by the task are logged.
+    *
+    * @param [in] priority Task priority
+    * @param [in] task Task to run
+    */
+   void Post(Priority priority, Task task);
+
+   /**
+    * @brief Awaitable which resumes the awaiting coroutine as a task of the
+    * pool, queued by priority.
+    */
+   class Scheduler
+   {
+   public:
+      explicit Scheduler(PriorityThreadPool& pool, Priority priority) :
+          pool_ {pool}, priority_ {priority}
+      {
+      }
+
+      bool await_ready() const noexcept { return false; }
+      void await_suspend(std::coroutine_handle<> handle)
+      {
+         pool_.Post(priority_, [handle]() { handle.resume(); });
+      }
+      void await_resume() const noexcept {}
+
+   private:
+      PriorityThreadPool& pool_;
+      Priority            priority_;
+   };
+
+   /**
+    * @brief Moves the awaiting coroutine onto the pool.
+    *
+    * @param [in] priority Priority of the remainder of the coroutine, until
+    * it is next suspended
+    *
+    * @return Awaitable
+    */
+   Scheduler Schedule(Priority priority);
+
+   /**
+    * @brief Waits for all queued tasks to complete. No further tasks may be
+    * posted once the pool has been joined.
+    */
+   void Join();
+
+   /**
+    * @brief Gets the default number of worker threads for CPU bound tasks,
+    * the number of hardware threads available.
+    */
+   static std::size_t HardwareThreadCount();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <scwx/util/allocation_tracker.hpp>
+#include <scwx/util/iterator.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace util
+{
+
+enum class ProfileStage
+{
+   Frame,
+   LayerRender,
+   GpuLayerRender,
+   ImGui,
+   GlUpload,
+   ComputeSweep,
+   Download,
+   Decompress,
+   Parse,
+   ProductLoad,
+   ProviderRefresh,
+   PlacefileRefresh,
+   AlertUpdate,
+   Unknown
+};
+typedef scwx::util::
+   Iterator<ProfileStage, ProfileStage::Frame, ProfileStage::AlertUpdate>
+      ProfileStageIterator;
+
+const std::string& GetProfileStageName(ProfileStage stage);
+
+struct ProfileSample
+{
+   ProfileStage                          stage_ {ProfileStage::Unknown};
+   std::uint16_t                         label_ {0u};
+   std::uint32_t                         thread_ {0u};
+   std::chrono::steady_clock::time_point end_ {};
+   std::chrono::nanoseconds              duration_ {};
+   AllocationCount                       allocations_ {};
+};
+
+/**
+ * @brief Collects the durations of pipeline stages for display while the
+ * application is running.
+ *
+ * Each thread records samples to its own fixed size ring buffer without
+ * locking. When a buffer is full, the oldest samples are overwritten. Samples
+ * are only recorded while the profiler is enabled.
+ *
+ * GPU samples are recorded by the thread which reads the timer query, and
+ * begin when the commands were submitted. They are written to a separate GPU
+ * thread in traces.
+ */
+class Profiler
+{
+public:
+   /**
+    * @brief Determines whether samples are being recorded.
+    */
+   static bool IsEnabled();
+
+   /**
+    * @brief Enables or disables recording samples.
+    */
+   static void SetEnabled(bool enabled);
+
+   /**
+    * @brief Registers a label distinguishing samples of the same stage, such
+    * as the name of a layer. Registering the same label again returns the same
+    * identifier.
+    *
+    * @param [in] label Label
+    *
+    * @return Label identifier
+    */
+   static std::uint16_t RegisterLabel(const std::string& label);
+
+   /**
+    * @brief Gets a registered label.
+    *
+    * @param [in] label Label identifier
+    *
+    * @return Label, or an empty string for unlabeled samples
+    */
+   static std::string GetLabel(std::uint16_t label);
+
+   /**
+    * @brief Names the calling thread in exported traces.
+    *
+    * @param [in] name Thread name
+    */
+   static void SetThreadName(const std::string& name);
+
+   /**
+    * @brief Gets the name of a thread which has recorded samples.
+    *
+    * @param [in] thread Thread identifier of a sample
+    *
+    * @return Thread name, or an empty string if the thread was not named
+    */
+   static std::string GetThreadName(std::uint32_t thread);
+
+   /**
+    * @brief Records a sample on the calling thread.
+    *
+    * @param [in] stage Pipeline stage
+    * @param [in] label Label identifier
+    * @param [in] begin Time the stage began
+    * @param [in] end Time the stage ended
+    * @param [in] allocations Heap allocations made during the stage, if
+    * allocation tracking is available
+    */
+   static void Record(ProfileStage                          stage,
+                      std::uint16_t                         label,
+                      std::chrono::steady_clock::time_point begin,
+                      std::chrono::steady_clock::time_point end,
+                      const AllocationCount&                allocations = {});
+
+   /**
+    * @brief Gets the samples recorded on all threads.
+    *
+    * @param [in] since Only return samples which ended after this time
+    *
+    * @return Samples, ordered by end time
+    */
+   static std::vector<ProfileSample>
+   GetSamples(std::chrono::steady_clock::time_point since = {});
+
+   /**
+    * @brief Writes the samples recorded on all threads as Chrome trace event
+    * JSON, which may be viewed in Perfetto or chrome://tracing.
+    *
+    * @param [in] os Output stream
+    * @param [in] since Only write samples which ended after this time
+    */
+   static void WriteTrace(std::ostream&                         os,
+                          std::chrono::steady_clock::time_point since = {});
+};
+
+/**
+ * @brief Records the lifetime of the timer as a profiler sample, including the
+ * heap allocations made by the thread if allocation tracking is available.
+ */
+class ScopedTimer
+{
+public:
+   explicit ScopedTimer(ProfileStage stage, std::uint16_t label = 0u);
+   ~ScopedTimer();
+
+   ScopedTimer(const ScopedTimer&)            = delete;
+   ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+   const ProfileStage                    stage_;
+   const std::uint16_t                   label_;
+   const bool                            enabled_;
+   std::chrono::steady_clock::time_point begin_ {};
+   AllocationCount                       beginAllocations_ {};
+};
+
+} // namespace util
+} // namespace scwx
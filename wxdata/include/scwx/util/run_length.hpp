@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Gets the number of levels encoded in 4-bit run, 4-bit level run
+ * length encoded data.
+ *
+ * @param [in] data Run length encoded data
+ * @param [in] size Size of the run length encoded data in bytes
+ *
+ * @return Number of levels
+ */
+std::size_t CountRunLength4(const std::uint8_t* data, std::size_t size);
+
+/**
+ * @brief Expands 4-bit run, 4-bit level run length encoded data, where the
+ * upper nibble of each byte is the run and the lower nibble is the level.
+ * Levels not covered by a run are set to 0.
+ *
+ * @param [in] data Run length encoded data
+ * @param [in] size Size of the run length encoded data in bytes
+ * @param [out] levels Expanded levels
+ * @param [in] maxLevels Maximum number of levels to expand
+ *
+ * @return Number of levels written
+ */
+std::size_t ExpandRunLength4(const std::uint8_t* data,
+                             std::size_t         size,
+                             std::uint8_t*       levels,
+                             std::size_t         maxLevels);
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <boost/asio/strand.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/system/error_code.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief A serial strand of work, run on a thread pool shared by every strand
+ * of the same priority class.
+ *
+ * Tasks posted to a strand run one at a time, in the order posted, as on a
+ * dedicated single thread. The number of threads is fixed by the hardware,
+ * rather than growing with the number of owners.
+ */
+class Strand
+{
+public:
+   enum class Priority
+   {
+      Interactive, ///< Work the user is waiting on, such as rendering data
+      Background,  ///< Work the user is not waiting on, such as saving files
+      Blocking     ///< Work which waits on the network, such as refreshes
+   };
+
+   typedef std::function<void()>                                Task;
+   typedef std::function<void(const boost::system::error_code&)> Handler;
+   typedef boost::asio::strand<boost::asio::thread_pool::executor_type>
+      executor_type;
+
+   /**
+    * @brief Creates a strand.
+    *
+    * @param [in] name Name of the strand in logs and profiler traces
+    * @param [in] priority Priority class, selecting the shared thread pool
+    */
+   explicit Strand(const std::string& name,
+                   Priority           priority = Priority::Interactive);
+
+   /**
+    * @brief Destroys the strand, after waiting for outstanding work.
+    */
+   ~Strand();
+
+   Strand(const Strand&)            = delete;
+   Strand& operator=(const Strand&) = delete;
+
+   Strand(Strand&&) noexcept            = delete;
+   Strand& operator=(Strand&&) noexcept = delete;
+
+   /**
+    * @brief Gets the executor of the strand, such as for timers. Handlers
+    * dispatched directly to the executor are not waited on by Join unless
+    * wrapped with Wrap.
+    */
+   executor_type get_executor() const;
+
+   const std::string& name() const;
+
+   /**
+    * @brief Queues a task. Exceptions thrown by the task are logged. Tasks
+    * posted after the strand has been joined are discarded.
+    *
+    * @param [in] task Task to run
+    */
+   void Post(Task task);
+
+   /**
+    * @brief Wraps an asynchronous completion handler, such as that of a
+    * timer, such that Join waits for it to be invoked.
+    *
+    * @param [in] handler Completion handler
+    *
+    * @return Wrapped completion handler
+    */
+   Handler Wrap(Handler handler);
+
+   /**
+    * @brief Waits for all posted tasks and wrapped handlers to complete. No
+    * further tasks may be posted once the strand has been joined. Must not be
+    * called from a task of the strand.
+    */
+   void Join();
+
+   /**
+    * @brief Gets the number of threads shared by the strands of a priority
+    * class.
+    */
+   static std::size_t thread_count(Priority priority);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace scwx
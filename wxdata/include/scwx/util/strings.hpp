@@ -1,8 +1,10 @@
 #pragma once
 
 #include <cstdint>
+#include <initializer_list>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace scwx
@@ -39,15 +41,67 @@ std::vector<std::string> ParseTokens(const std::string&       s,
                                      std::vector<std::string> delimiters,
                                      std::size_t              pos = 0);
 
+/**
+ * @brief Parse a list of tokens from a string without allocating
+ *
+ * Tokenizes the string the same as ParseTokens, returning tokens which refer to
+ * the input string. The token vector is cleared first, allowing its storage to
+ * be reused for each string.
+ *
+ * @param [in] s Input string to tokenize
+ * @param [in] delimiters A list of delimiters to use for each token.
+ * @param [out] tokens Tokenized string
+ * @param [in] pos Search begin position. Default is 0.
+ */
+void ParseTokens(std::string_view                        s,
+                 std::initializer_list<std::string_view> delimiters,
+                 std::vector<std::string_view>&          tokens,
+                 std::size_t                             pos = 0);
+
+/**
+ * @brief Split a string into tokens without allocating
+ *
+ * The string is split on any of the delimiter characters. Empty tokens are
+ * skipped. Tokens refer to the input string, and are appended to the token
+ * vector.
+ *
+ * @param [in] s Input string to split
+ * @param [in] delimiters Delimiter characters
+ * @param [out] tokens Tokens
+ */
+void SplitTokens(std::string_view               s,
+                 std::string_view               delimiters,
+                 std::vector<std::string_view>& tokens);
+
 std::string ToString(const std::vector<std::string>& v);
 
 template<typename T>
 std::optional<T> TryParseNumeric(const std::string& str);
 
+/**
+ * @brief Parse a number from the beginning of a string without allocating
+ *
+ * Leading whitespace and characters following the number are ignored, as with
+ * std::stoi and std::stod.
+ *
+ * @param [in] str Input string
+ *
+ * @return Parsed number
+ *
+ * @throws std::invalid_argument if the string does not begin with a number
+ * @throws std::out_of_range if the number is out of range of the type
+ */
+template<typename T>
+T ParseNumeric(std::string_view str);
+
 #if defined(STRINGS_IMPLEMENTATION)
 template std::optional<std::uint16_t> TryParseNumeric(const std::string& str);
 template std::optional<std::uint32_t> TryParseNumeric(const std::string& str);
 template std::optional<float>         TryParseNumeric(const std::string& str);
+
+template int         ParseNumeric(std::string_view str);
+template std::size_t ParseNumeric(std::string_view str);
+template double      ParseNumeric(std::string_view str);
 #endif
 
 } // namespace util
@@ -25,6 +25,10 @@ protected:
            std::ios_base::seekdir  way,
            std::ios_base::openmode which = std::ios_base::in |
                                            std::ios_base::out) override;
+   pos_type
+   seekpos(pos_type                pos,
+           std::ios_base::openmode which = std::ios_base::in |
+                                           std::ios_base::out) override;
 
 private:
    std::vector<char>& v_;
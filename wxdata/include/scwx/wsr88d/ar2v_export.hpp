@@ -0,0 +1,63 @@
+#pragma once
+
+#include <scwx/wsr88d/ar2v_file.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+/**
+ * @brief Options for exporting a volume as a Zarr store.
+ */
+struct ZarrExportOptions
+{
+   /**
+    * @brief Number of radials in each chunk of moment data. Each chunk spans
+    * every gate of its radials.
+    */
+   std::size_t chunkRadials_ {120u};
+
+   /**
+    * @brief zlib compression level of moment data, from 0 (no compression) to
+    * 9 (best compression).
+    */
+   int compressionLevel_ {6};
+};
+
+/**
+ * @brief Exports the decoded sweeps of a volume as a Zarr (version 2)
+ * directory store, such that the volume may be read by columnar analysis
+ * tools (e.g., xarray) without an Archive II decoder.
+ *
+ * The store contains a group for each sweep, in order of collection time,
+ * named sweep_00, sweep_01, etc. Each sweep contains a group for each moment
+ * (REF, VEL, SW, ZDR, PHI, RHO, CFP) with the following arrays:
+ *
+ * - data: Raw data moments, dimensioned (azimuth, range). The physical value
+ *   is data * scale_factor + add_offset. Raw values of 0 (below threshold)
+ *   and 1 (range folded) are listed as missing values.
+ * - azimuth: Azimuth angle of each radial in degrees.
+ * - time: Collection time of each radial in milliseconds since the epoch.
+ * - range: Range to the center of each gate in meters.
+ *
+ * Chunks of moment data are compressed concurrently. When exporting a batch
+ * of volumes, this may be called from the file loaded callback of
+ * NexradFileBatchLoader with each file cast to Ar2vFile.
+ *
+ * @param [in] file Volume
+ * @param [in] path Directory of the store, which is created if it does not
+ * exist
+ * @param [in] options Export options
+ *
+ * @return true if every array was written
+ */
+bool ExportZarr(const Ar2vFile&          file,
+                const std::string&       path,
+                const ZarrExportOptions& options = {});
+
+} // namespace wsr88d
+} // namespace scwx
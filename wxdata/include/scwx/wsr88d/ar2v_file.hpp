@@ -5,13 +5,25 @@
 #include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
 
 #include <chrono>
+#include <functional>
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace scwx
 {
 namespace wsr88d
 {
+namespace rda
+{
+class ClutterFilterBypassMap;
+class ClutterFilterMap;
+class PerformanceMaintenanceData;
+class RdaAdaptationData;
+class RdaStatusData;
+} // namespace rda
 
 class Ar2vFileImpl;
 
@@ -23,6 +35,32 @@ class Ar2vFileImpl;
 class Ar2vFile : public NexradFile
 {
 public:
+   /**
+    * @brief Invoked when all radials of an elevation cut have been received.
+    * Parameters are the zero-based elevation index and the elevation angle
+    * in degrees.
+    */
+   typedef std::function<void(std::uint16_t, float)> ElevationCompleteCallback;
+
+   /**
+    * @brief The decompressed LDM records of a volume, compressed for storage
+    * in memory. Each record is an independent zlib stream.
+    */
+   struct CompressedVolume
+   {
+      std::string   tapeFilename_ {};
+      std::string   extensionNumber_ {};
+      std::uint32_t julianDate_ {0};
+      std::uint32_t milliseconds_ {0};
+      std::string   icao_ {};
+
+      std::vector<std::vector<char>> records_ {};
+      std::vector<std::size_t>       recordSizes_ {};
+
+      std::size_t compressed_size() const;
+      std::size_t decompressed_size() const;
+   };
+
    explicit Ar2vFile();
    ~Ar2vFile();
 
@@ -37,22 +75,206 @@ public:
    std::string   icao() const;
 
    std::size_t message_count() const;
+   std::size_t data_size() const override;
 
    std::chrono::system_clock::time_point start_time() const;
    std::chrono::system_clock::time_point end_time() const;
 
+   /**
+    * @brief Radar data by elevation index. While a volume is partially loaded
+    * with LoadLDMRecords, only elevation scans which have been completely
+    * loaded are returned, as the others may be modified by further records.
+    *
+    * @return Elevation scans by elevation index
+    */
    std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>
                                                          radar_data() const;
    std::shared_ptr<const rda::VolumeCoveragePatternData> vcp_data() const;
 
+   /**
+    * @brief RDA metadata messages of the volume. Only the location of each
+    * metadata message is kept when the volume is loaded, and the message is
+    * parsed when first accessed. If a message was received more than once,
+    * the last is returned.
+    *
+    * @return Metadata message, or nullptr if the volume does not contain the
+    * message, or metadata is disabled
+    */
+   std::shared_ptr<const rda::ClutterFilterBypassMap>
+   clutter_filter_bypass_map() const;
+   std::shared_ptr<const rda::ClutterFilterMap> clutter_filter_map() const;
+   std::shared_ptr<const rda::PerformanceMaintenanceData>
+   performance_maintenance_data() const;
+   std::shared_ptr<const rda::RdaAdaptationData> rda_adaptation_data() const;
+   std::shared_ptr<const rda::RdaStatusData>     rda_status_data() const;
+
+   /**
+    * @brief Gets the indexed elevation scans of a data block type, by coded
+    * elevation angle and scan time. Under SAILS and MESO-SAILS, an elevation
+    * has a scan for each time it was scanned in the volume.
+    *
+    * @param dataBlockType Data block type
+    *
+    * @return Elevation scans, keyed by coded elevation angle, then by the
+    * collection time of the first radial
+    */
+   std::map<std::uint16_t,
+            std::map<std::chrono::system_clock::time_point,
+                     std::shared_ptr<rda::ElevationScan>>>
+   elevation_scans(rda::DataBlockType dataBlockType) const;
+
+   /**
+    * @brief Gets the elevation cuts of a data block type, in degrees, sorted
+    * from lowest to highest.
+    *
+    * @param dataBlockType Data block type
+    *
+    * @return Elevation cuts
+    */
+   std::vector<float> elevation_cuts(rda::DataBlockType dataBlockType) const;
+
    std::tuple<std::shared_ptr<rda::ElevationScan>, float, std::vector<float>>
    GetElevationScan(rda::DataBlockType                    dataBlockType,
                     float                                 elevation,
                     std::chrono::system_clock::time_point time) const;
 
+   /**
+    * @brief Finds the elevation scan closest to an elevation, not newer than
+    * a time. If each scan of the elevation is newer than the time, the first
+    * scan is selected. Unlike GetElevationScan(), the list of elevation cuts
+    * is not copied, such that repeated lookups do not allocate.
+    *
+    * @param dataBlockType Data block type
+    * @param elevation Elevation angle in degrees
+    * @param time Selected time
+    *
+    * @return Elevation scan and the selected elevation cut in degrees
+    */
+   std::pair<std::shared_ptr<rda::ElevationScan>, float>
+   FindElevationScan(rda::DataBlockType                    dataBlockType,
+                     float                                 elevation,
+                     std::chrono::system_clock::time_point time) const;
+
+   /**
+    * @brief Converts an elevation angle in degrees to the coding used to key
+    * elevation scans.
+    */
+   static std::uint16_t CodeElevation(float elevation);
+
+   /**
+    * @brief Converts a coded elevation angle to degrees.
+    */
+   static float DecodeElevation(std::uint16_t codedElevation);
+
    bool LoadFile(const std::string& filename);
    bool LoadData(std::istream& is);
 
+   /**
+    * @brief Loads the Volume Header Record and the first LDM record, which
+    * contains volume metadata such as the VCP. Radial data is not loaded.
+    *
+    * @param is Input stream positioned at the start of the volume
+    *
+    * @return true if the Volume Header Record was valid
+    */
+   bool LoadHeader(std::istream& is);
+
+   /**
+    * @brief Loads additional LDM records into a volume which has already been
+    * started with LoadData. This is used for real-time chunked Level 2 data,
+    * where the first chunk contains the Volume Header Record, and subsequent
+    * chunks contain only compressed LDM records. Elevation scans that are
+    * complete will not be modified by further records. Records may be loaded
+    * while the volume is in use.
+    *
+    * @param is Input stream containing one or more LDM records
+    * @param partial Whether more records are expected. If set, elevation
+    * scans are not indexed or returned by radar_data() until all of their
+    * radials have been loaded.
+    *
+    * @return true if at least one LDM record was loaded
+    */
+   bool LoadLDMRecords(std::istream& is, bool partial = false);
+
+   /**
+    * @brief Sets the callback invoked as each elevation cut is completed by
+    * LoadData or LoadLDMRecords, on the thread loading the records. Elevation
+    * cuts which are already complete are reported immediately.
+    *
+    * @param callback Elevation complete callback, or nullptr to clear
+    */
+   void SetElevationCompleteCallback(ElevationCompleteCallback callback);
+
+   /**
+    * @brief Sets whether radials and elevation scans of the volume are
+    * allocated from a per-volume arena, such that releasing the volume frees
+    * a few large blocks rather than each object individually. Enabled by
+    * default. This must be called before data is loaded.
+    */
+   void SetArenaEnabled(bool enabled);
+
+   /**
+    * @brief Sets whether RDA metadata messages (RDA status, performance and
+    * maintenance, RDA adaptation, and clutter filter maps) are retained.
+    * Enabled by default. If disabled, metadata messages are skipped when
+    * loaded, and are not included in the message count. This must be called
+    * before data is loaded.
+    */
+   void SetMetadataEnabled(bool enabled);
+
+   /**
+    * @brief Loads a volume previously written with SaveCacheFile. The cache
+    * file contains already decompressed LDM records, so loading from it
+    * avoids bzip2 decompression entirely.
+    *
+    * @param filename Cache filename
+    *
+    * @return true if the cache file was valid
+    */
+   bool LoadCacheFile(const std::string& filename);
+
+   /**
+    * @brief Writes the decompressed LDM records of the volume to a cache file.
+    * Records are stored 8-byte aligned, such that the file may be memory
+    * mapped. This must be called before moment data is accessed, as 16-bit
+    * moment data is decoded in place within the record buffers. If 16-bit
+    * moment data has been decoded, no cache file is written.
+    *
+    * @param filename Cache filename
+    *
+    * @return true if the cache file was written
+    */
+   bool SaveCacheFile(const std::string& filename) const;
+
+   /**
+    * @brief Compresses the decompressed LDM records of the volume, such that
+    * an inactive volume may be retained in memory at a fraction of its size.
+    * Records are compressed concurrently at the fastest zlib level. As with
+    * SaveCacheFile, this must be called before moment data is accessed.
+    *
+    * @return Compressed volume, or nullptr if the volume has no records, or
+    * 16-bit moment data has been decoded
+    */
+   std::shared_ptr<const CompressedVolume> Compress() const;
+
+   /**
+    * @brief Loads a volume previously compressed with Compress. Records are
+    * decompressed concurrently.
+    *
+    * @param volume Compressed volume
+    *
+    * @return true if every record was decompressed
+    */
+   bool LoadCompressed(const CompressedVolume& volume);
+
+   /**
+    * @brief Gets the cache filename for a volume, keyed by radar ID and volume
+    * time.
+    */
+   static std::string
+   GetCacheFilename(const std::string&                    radarId,
+                    std::chrono::system_clock::time_point volumeTime);
+
 private:
    std::unique_ptr<Ar2vFileImpl> p;
 };
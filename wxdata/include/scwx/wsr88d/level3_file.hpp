@@ -29,6 +29,8 @@ public:
    std::shared_ptr<awips::WmoHeader>   wmo_header() const;
    std::shared_ptr<rpg::Level3Message> message() const;
 
+   std::size_t data_size() const override;
+
    bool LoadFile(const std::string& filename);
    bool LoadData(std::istream& is);
 
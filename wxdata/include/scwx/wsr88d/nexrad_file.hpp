@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -24,6 +25,11 @@ protected:
 public:
    virtual ~NexradFile();
 
+   /**
+    * @brief Approximate memory used by the loaded data, in bytes.
+    */
+   virtual std::size_t data_size() const = 0;
+
    virtual bool LoadFile(const std::string& filename) = 0;
    virtual bool LoadData(std::istream& is)            = 0;
 
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <scwx/wsr88d/nexrad_file.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace provider
+{
+class NexradDataProvider;
+} // namespace provider
+
+namespace wsr88d
+{
+
+/**
+ * @brief Loads a batch of NEXRAD files concurrently. File I/O, decompression
+ * and parsing are pipelined across a bounded worker pool. Loaded files are
+ * delivered in volume time order, with at most a bounded number of files
+ * loaded ahead of delivery. The time of a file is read from its filename, and
+ * the time of an object from its key. Sources without a time are delivered
+ * first, in the order they were added.
+ */
+class NexradFileBatchLoader
+{
+public:
+   /**
+    * @brief Invoked for each source in order. Parameters are the index of the
+    * source in delivery order, the filename or object key, and the loaded
+    * file, which is nullptr if the source failed to load.
+    */
+   typedef std::function<void(
+      std::size_t, const std::string&, std::shared_ptr<NexradFile>)>
+      FileLoadedCallback;
+
+   /**
+    * @brief Constructs a batch loader.
+    *
+    * @param threadCount Number of worker threads, or 0 to use the hardware
+    * concurrency
+    * @param maxPending Maximum number of files loaded or loading ahead of the
+    * next file to be delivered
+    */
+   explicit NexradFileBatchLoader(std::size_t threadCount = 0,
+                                  std::size_t maxPending  = 8);
+   ~NexradFileBatchLoader();
+
+   NexradFileBatchLoader(const NexradFileBatchLoader&)            = delete;
+   NexradFileBatchLoader& operator=(const NexradFileBatchLoader&) = delete;
+
+   NexradFileBatchLoader(NexradFileBatchLoader&&) noexcept;
+   NexradFileBatchLoader& operator=(NexradFileBatchLoader&&) noexcept;
+
+   std::size_t source_count() const;
+
+   void AddFiles(const std::vector<std::string>& filenames);
+   void AddKeys(std::shared_ptr<provider::NexradDataProvider> provider,
+                const std::vector<std::string>&               keys);
+
+   void SetFileLoadedCallback(FileLoadedCallback callback);
+
+   /**
+    * @brief Loads all sources, invoking the file loaded callback on the
+    * calling thread. Returns once every source has been delivered, or the
+    * load was cancelled.
+    *
+    * @return Number of sources successfully loaded
+    */
+   std::size_t Run();
+
+   /**
+    * @brief Stops a running load, or a load which has not started. Sources
+    * that have not yet been delivered are skipped. May be called from any
+    * thread, including the file loaded callback.
+    */
+   void Cancel();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace wsr88d
+} // namespace scwx
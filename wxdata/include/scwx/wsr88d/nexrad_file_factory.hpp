@@ -1,12 +1,27 @@
 #pragma once
 
+#include <scwx/common/products.hpp>
 #include <scwx/wsr88d/nexrad_file.hpp>
 
+#include <chrono>
+#include <optional>
+#include <vector>
+
 namespace scwx
 {
 namespace wsr88d
 {
 
+struct NexradFileInfo
+{
+   common::RadarProductGroup group_ {common::RadarProductGroup::Unknown};
+
+   std::string                           radarId_ {};
+   std::chrono::system_clock::time_point time_ {};
+   std::uint16_t                         vcp_ {0};
+   std::vector<float>                    elevationCuts_ {};
+};
+
 class NexradFileFactory
 {
 private:
@@ -22,6 +37,17 @@ private:
 public:
    static std::shared_ptr<NexradFile> Create(const std::string& filename);
    static std::shared_ptr<NexradFile> Create(std::istream& is);
+
+   /**
+    * @brief Reads the radar ID, volume time, VCP and elevation cuts of a file
+    * without decoding radial data. For Level 2 data, only the Volume Header
+    * Record and the first LDM record are read. Level 3 products are small,
+    * and are loaded in full.
+    *
+    * @return File info, or std::nullopt if the file is not valid
+    */
+   static std::optional<NexradFileInfo> Probe(const std::string& filename);
+   static std::optional<NexradFileInfo> Probe(std::istream& is);
 };
 
 } // namespace wsr88d
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <scwx/wsr88d/rda/generic_radar_data.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+/**
+ * @brief A columnar copy of a single moment of an elevation scan. The data
+ * moments of every radial are stored in one contiguous array, radial by
+ * radial, with the index, azimuth, time and gate count of each radial in
+ * parallel arrays. A sweep is then read linearly, rather than through the
+ * moment data block of each radial.
+ *
+ * Radials without the moment, or with a data word size other than that of the
+ * first radial, are not included.
+ */
+class ColumnarSweep
+{
+public:
+   explicit ColumnarSweep(const ElevationScan& elevationScan,
+                          DataBlockType        dataBlockType);
+   ~ColumnarSweep();
+
+   ColumnarSweep(const ColumnarSweep&)            = delete;
+   ColumnarSweep& operator=(const ColumnarSweep&) = delete;
+
+   ColumnarSweep(ColumnarSweep&&) noexcept            = delete;
+   ColumnarSweep& operator=(ColumnarSweep&&) noexcept = delete;
+
+   DataBlockType data_block_type() const;
+
+   /**
+    * @brief Number of radials included in the sweep.
+    */
+   std::size_t radial_count() const;
+
+   /**
+    * @brief Whether every radial of the elevation scan is included.
+    */
+   bool complete() const;
+
+   /**
+    * @brief Whether every radial shares the gate layout of the first radial.
+    */
+   bool uniform() const;
+
+   /**
+    * @brief Number of data moments stored for each radial, which is the
+    * greatest gate count of any radial. Radials with fewer gates are padded
+    * with zero.
+    */
+   std::uint16_t stride() const;
+
+   // Gate layout of the first radial
+   std::uint16_t number_of_data_moment_gates() const;
+   std::int16_t  data_moment_range_raw() const;
+   std::uint16_t data_moment_range_sample_interval_raw() const;
+   std::int16_t  snr_threshold_raw() const;
+   std::uint8_t  data_word_size() const;
+   float         scale() const;
+   float         offset() const;
+
+   std::span<const std::uint16_t>                         radials() const;
+   std::span<const float>                                 azimuths() const;
+   std::span<const std::chrono::system_clock::time_point> times() const;
+   std::span<const std::uint16_t>                         gate_counts() const;
+
+   /**
+    * @brief Gets the 8-bit data moments of a radial.
+    *
+    * @param [in] radial Position of the radial in the sweep
+    *
+    * @return Data moments, or empty if the data word size is not 8
+    */
+   std::span<const std::uint8_t> data_moments8(std::size_t radial) const;
+
+   /**
+    * @brief Gets the 16-bit data moments of a radial.
+    *
+    * @param [in] radial Position of the radial in the sweep
+    *
+    * @return Data moments, or empty if the data word size is not 16
+    */
+   std::span<const std::uint16_t> data_moments16(std::size_t radial) const;
+
+   std::size_t size_bytes() const;
+
+   /**
+    * @brief Gets the columnar sweep of an elevation scan. The sweep is built
+    * on first use, and shared until the elevation scan is released or radials
+    * are added to it.
+    *
+    * @param [in] elevationScan Elevation scan
+    * @param [in] dataBlockType Moment
+    *
+    * @return Columnar sweep, or nullptr if no radial has the moment
+    */
+   static std::shared_ptr<const ColumnarSweep>
+   Get(const std::shared_ptr<ElevationScan>& elevationScan,
+       DataBlockType                         dataBlockType);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
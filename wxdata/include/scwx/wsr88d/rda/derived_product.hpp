@@ -0,0 +1,198 @@
+#pragma once
+
+#include <scwx/common/products.hpp>
+#include <scwx/wsr88d/rda/generic_radar_data.hpp>
+#include <scwx/wsr88d/rda/precipitation_accumulator.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+/**
+ * @brief Running column state of a volume, on the gates of its lowest
+ * elevation scan. Each gate holds the maximum reflectivity of the column, and
+ * the height of the highest beam with reflectivity at or above the echo top
+ * threshold. Elevation scans are accumulated as they complete, such that
+ * volume products are updated at the cost of a single elevation rather than
+ * the whole volume. Accumulation and products may be used from any thread.
+ */
+class ColumnAccumulator
+{
+public:
+   // Reflectivity at or above which a beam contributes to echo tops (dBZ)
+   static constexpr float kEchoTopThreshold = 18.0f;
+
+   // Coding of echo top heights (km)
+   static constexpr float kEchoTopScale  = 10.0f;
+   static constexpr float kEchoTopOffset = 2.0f;
+
+   /**
+    * @brief Creates an empty column state.
+    *
+    * @param baseScan Lowest elevation scan of the volume, which is not yet
+    * accumulated
+    */
+   explicit ColumnAccumulator(const ElevationScan& baseScan);
+   ~ColumnAccumulator();
+
+   ColumnAccumulator(const ColumnAccumulator&)            = delete;
+   ColumnAccumulator& operator=(const ColumnAccumulator&) = delete;
+
+   ColumnAccumulator(ColumnAccumulator&&) noexcept            = delete;
+   ColumnAccumulator& operator=(ColumnAccumulator&&) noexcept = delete;
+
+   /**
+    * @brief Number of elevation scans accumulated.
+    */
+   std::size_t elevation_count() const;
+
+   /**
+    * @brief Accumulates the reflectivity of an elevation scan. Elevation
+    * scans which have already been accumulated are skipped.
+    *
+    * @param elevationScan Complete elevation scan of the volume
+    * @param elevationAngle Elevation angle of the scan (degrees)
+    *
+    * @return true if the elevation scan was accumulated
+    */
+   bool Accumulate(const ElevationScan& elevationScan, float elevationAngle);
+
+   /**
+    * @brief Creates a composite reflectivity elevation scan from the column
+    * maximums. Gates without reflectivity keep the level of the lowest
+    * elevation.
+    */
+   std::shared_ptr<ElevationScan> CompositeReflectivity() const;
+
+   /**
+    * @brief Creates an echo tops elevation scan, coded in kilometers with
+    * kEchoTopScale and kEchoTopOffset. Gates without echo are below threshold.
+    */
+   std::shared_ptr<ElevationScan> EchoTops() const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+/**
+ * @brief A Level 2 product derived from the elevation scans of a volume,
+ * rather than read from a data moment block. Derived elevation scans hold the
+ * radials of a source elevation scan, with the moment data block of
+ * data_block_type() replaced by the derived data.
+ *
+ * Derived products are registered by Level 2 product, and are computed by the
+ * radar product manager on a worker pool.
+ */
+class DerivedProduct
+{
+public:
+   struct Input
+   {
+      /**
+       * @brief Selected elevation scan, containing data_block_type(). Unused
+       * by volume products.
+       */
+      std::shared_ptr<ElevationScan> elevationScan_ {};
+
+      /**
+       * @brief Complete elevation scans of the volume containing
+       * data_block_type(), lowest elevation first. Only used by volume
+       * products.
+       */
+      std::vector<std::shared_ptr<ElevationScan>> volumeScans_ {};
+
+      /**
+       * @brief Elevation angles of volumeScans_ (degrees). Angles which are
+       * not specified are read from the radials.
+       */
+      std::vector<float> volumeElevations_ {};
+
+      /**
+       * @brief Column state shared between the volume products of a volume,
+       * which is updated with any volume scans not yet accumulated. If
+       * nullptr, the column state is accumulated from every volume scan.
+       */
+      std::shared_ptr<ColumnAccumulator> columnAccumulator_ {};
+
+      /**
+       * @brief Precipitation accumulation of the radar site, updated through
+       * the volume of volumeScans_. Only used by accumulation products.
+       */
+      std::shared_ptr<const PrecipitationAccumulator>
+         precipitationAccumulator_ {};
+
+      float stormDirection_ {0.0f}; // Direction storms move from (degrees)
+      float stormSpeed_ {0.0f};     // Storm speed (m/s)
+   };
+
+   explicit DerivedProduct();
+   virtual ~DerivedProduct();
+
+   DerivedProduct(const DerivedProduct&)            = delete;
+   DerivedProduct& operator=(const DerivedProduct&) = delete;
+
+   DerivedProduct(DerivedProduct&&) noexcept            = delete;
+   DerivedProduct& operator=(DerivedProduct&&) noexcept = delete;
+
+   /**
+    * @brief Data block type the product is derived from and stored as.
+    */
+   virtual DataBlockType data_block_type() const = 0;
+
+   /**
+    * @brief Whether the product is computed from every elevation of the
+    * volume, and is displayed at the lowest elevation only.
+    */
+   virtual bool is_volume_product() const = 0;
+
+   /**
+    * @brief Whether the product depends on the storm motion of the input.
+    */
+   virtual bool is_storm_relative() const = 0;
+
+   /**
+    * @brief Whether the product is computed from the precipitation
+    * accumulation of the input, which spans previous volumes.
+    */
+   virtual bool is_accumulation_product() const = 0;
+
+   /**
+    * @brief Computes the derived product.
+    *
+    * @param input Source elevation scans
+    *
+    * @return Derived elevation scan, or nullptr if it could not be computed
+    */
+   virtual std::shared_ptr<ElevationScan> Compute(const Input& input) const = 0;
+
+   /**
+    * @brief Gets the derived product registered for a Level 2 product.
+    *
+    * @param product Level 2 product
+    *
+    * @return Derived product, or nullptr if the product is not derived
+    */
+   static std::shared_ptr<const DerivedProduct>
+   Get(common::Level2Product product);
+
+   /**
+    * @brief Registers a derived product, replacing any product previously
+    * registered for the Level 2 product.
+    *
+    * @param product Level 2 product
+    * @param derivedProduct Derived product, or nullptr to unregister
+    */
+   static void Register(common::Level2Product                 product,
+                        std::shared_ptr<const DerivedProduct> derivedProduct);
+};
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <scwx/wsr88d/rda/generic_radar_data.hpp>
+
+#include <memory>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+/**
+ * @brief Radial data derived from a source radial. Radial metadata and moment
+ * data blocks are those of the source radial, except for moment data blocks
+ * which have been replaced with derived data.
+ */
+class DerivedRadarData : public GenericRadarData
+{
+public:
+   class MomentDataBlock;
+
+   explicit DerivedRadarData(std::shared_ptr<GenericRadarData> source);
+   ~DerivedRadarData();
+
+   DerivedRadarData(const DerivedRadarData&)            = delete;
+   DerivedRadarData& operator=(const DerivedRadarData&) = delete;
+
+   DerivedRadarData(DerivedRadarData&&) noexcept;
+   DerivedRadarData& operator=(DerivedRadarData&&) noexcept;
+
+   std::uint32_t         collection_time() const override;
+   std::uint16_t         modified_julian_date() const override;
+   units::degrees<float> azimuth_angle() const override;
+   std::uint16_t         azimuth_number() const override;
+   std::uint16_t         radial_status() const override;
+   std::uint16_t         elevation_number() const override;
+   std::uint16_t         volume_coverage_pattern_number() const override;
+
+   std::shared_ptr<GenericRadarData::MomentDataBlock>
+   moment_data_block(DataBlockType type) const override;
+
+   std::shared_ptr<GenericRadarData> source() const;
+
+   /**
+    * @brief Replaces a moment data block of the source radial.
+    *
+    * @param type Data block type
+    * @param block Derived moment data block
+    */
+   void
+   SetMomentDataBlock(DataBlockType                                      type,
+                      std::shared_ptr<GenericRadarData::MomentDataBlock> block);
+
+   /**
+    * @brief Derived radial data is not parsed from a stream.
+    *
+    * @return false
+    */
+   bool Parse(std::istream& is) override;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+/**
+ * @brief Moment data block holding derived gates, with the gate layout,
+ * scaling and word size of a source moment data block.
+ */
+class DerivedRadarData::MomentDataBlock :
+    public GenericRadarData::MomentDataBlock
+{
+public:
+   /**
+    * @brief Creates a moment data block with every gate below threshold.
+    *
+    * @param source Moment data block to take the gate layout from
+    */
+   explicit MomentDataBlock(const GenericRadarData::MomentDataBlock& source);
+
+   /**
+    * @brief Creates a moment data block with every gate below threshold, and
+    * with its own scaling, such as for a derived product in other units.
+    *
+    * @param source Moment data block to take the gate layout from
+    * @param scale Scale of the coded data moments
+    * @param offset Offset of the coded data moments
+    */
+   explicit MomentDataBlock(const GenericRadarData::MomentDataBlock& source,
+                            float                                    scale,
+                            float                                    offset);
+
+   /**
+    * @brief Creates a moment data block with every gate below threshold, and
+    * with its own scaling and word size, such as for a derived product whose
+    * range exceeds that of the source.
+    *
+    * @param source Moment data block to take the gate layout from
+    * @param scale Scale of the coded data moments
+    * @param offset Offset of the coded data moments
+    * @param dataWordSize Word size of the coded data moments (8 or 16)
+    */
+   explicit MomentDataBlock(const GenericRadarData::MomentDataBlock& source,
+                            float                                    scale,
+                            float                                    offset,
+                            std::uint8_t dataWordSize);
+   ~MomentDataBlock();
+
+   MomentDataBlock(const MomentDataBlock&)            = delete;
+   MomentDataBlock& operator=(const MomentDataBlock&) = delete;
+
+   MomentDataBlock(MomentDataBlock&&) noexcept;
+   MomentDataBlock& operator=(MomentDataBlock&&) noexcept;
+
+   std::uint16_t            number_of_data_moment_gates() const override;
+   units::kilometers<float> data_moment_range() const override;
+   std::int16_t             data_moment_range_raw() const override;
+   units::kilometers<float> data_moment_range_sample_interval() const override;
+   std::uint16_t data_moment_range_sample_interval_raw() const override;
+   std::int16_t  snr_threshold_raw() const override;
+   std::uint8_t  data_word_size() const override;
+   float         scale() const override;
+   float         offset() const override;
+   const void*   data_moments() const override;
+
+   /**
+    * @brief Sets the coded data moment of a gate.
+    *
+    * @param gate Gate index
+    * @param value Coded data moment
+    */
+   void SetDataMoment(std::uint16_t gate, std::uint16_t value);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -2,8 +2,16 @@
 
 #include <scwx/wsr88d/rda/generic_radar_data.hpp>
 
+#include <atomic>
+#include <vector>
+
 namespace scwx
 {
+namespace util
+{
+class Arena;
+} // namespace util
+
 namespace wsr88d
 {
 namespace rda
@@ -35,7 +43,7 @@ public:
    std::uint8_t          compression_indicator() const;
    std::uint16_t         radial_length() const;
    std::uint8_t          azimuth_resolution_spacing() const;
-   std::uint8_t          radial_status() const;
+   std::uint16_t         radial_status() const;
    std::uint16_t         elevation_number() const;
    std::uint8_t          cut_sector_number() const;
    units::degrees<float> elevation_angle() const;
@@ -55,6 +63,22 @@ public:
    static std::shared_ptr<DigitalRadarDataGeneric>
    Create(Level2MessageHeader&& header, std::istream& is);
 
+   /**
+    * @brief Creates a message whose moment data blocks reference the record
+    * buffer instead of copying their gates. The input stream must read from
+    * the record buffer, such that the stream position is an offset into the
+    * buffer. Only moment block headers are decoded during parsing. 16-bit
+    * gates are byte swapped in place within the buffer on first access, and
+    * momentsSwapped is set, if provided. If an arena is provided, the message
+    * and its moment data blocks are allocated from it.
+    */
+   static std::shared_ptr<DigitalRadarDataGeneric> CreateFromRecordBuffer(
+      Level2MessageHeader&&              header,
+      std::istream&                      is,
+      std::shared_ptr<std::vector<char>> recordBuffer,
+      std::shared_ptr<util::Arena>       arena          = nullptr,
+      std::shared_ptr<std::atomic<bool>> momentsSwapped = nullptr);
+
 private:
    class Impl;
    std::unique_ptr<Impl> p;
@@ -134,12 +158,24 @@ public:
    Create(const std::string& dataBlockType,
           const std::string& dataName,
           std::istream&      is);
+   static std::shared_ptr<MomentDataBlock>
+   Create(const std::string&                        dataBlockType,
+          const std::string&                        dataName,
+          std::istream&                             is,
+          const std::shared_ptr<std::vector<char>>& recordBuffer,
+          const std::shared_ptr<util::Arena>&       arena          = nullptr,
+          const std::shared_ptr<std::atomic<bool>>& momentsSwapped = nullptr);
 
 private:
    class Impl;
    std::unique_ptr<Impl> p;
 
-   bool Parse(std::istream& is);
+   bool Parse(std::istream&                             is,
+              const std::shared_ptr<std::vector<char>>& recordBuffer,
+              const std::shared_ptr<std::atomic<bool>>& momentsSwapped);
+   bool ParseView(std::istream&                             is,
+                  const std::shared_ptr<std::vector<char>>& recordBuffer,
+                  const std::shared_ptr<std::atomic<bool>>& momentsSwapped);
 };
 
 class DigitalRadarDataGeneric::RadialDataBlock : public DataBlock
@@ -156,6 +192,7 @@ public:
    RadialDataBlock& operator=(RadialDataBlock&&) noexcept;
 
    float unambiguous_range() const;
+   float nyquist_velocity() const;
 
    static std::shared_ptr<RadialDataBlock>
    Create(const std::string& dataBlockType,
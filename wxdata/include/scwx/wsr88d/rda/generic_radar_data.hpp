@@ -3,6 +3,9 @@
 #include <scwx/util/iterator.hpp>
 #include <scwx/wsr88d/rda/level2_message.hpp>
 
+#include <map>
+#include <memory_resource>
+
 #include <units/angle.h>
 #include <units/length.h>
 
@@ -33,7 +36,7 @@ typedef util::
 
 class GenericRadarData;
 
-typedef std::map<std::uint16_t, std::shared_ptr<GenericRadarData>>
+typedef std::pmr::map<std::uint16_t, std::shared_ptr<GenericRadarData>>
    ElevationScan;
 
 class GenericRadarData : public Level2Message
@@ -54,6 +57,7 @@ public:
    virtual std::uint16_t         modified_julian_date() const           = 0;
    virtual units::degrees<float> azimuth_angle() const                  = 0;
    virtual std::uint16_t         azimuth_number() const                 = 0;
+   virtual std::uint16_t         radial_status() const                  = 0;
    virtual std::uint16_t         elevation_number() const               = 0;
    virtual std::uint16_t         volume_coverage_pattern_number() const = 0;
 
@@ -2,8 +2,16 @@
 
 #include <scwx/wsr88d/rda/level2_message.hpp>
 
+#include <atomic>
+#include <vector>
+
 namespace scwx
 {
+namespace util
+{
+class Arena;
+} // namespace util
+
 namespace wsr88d
 {
 namespace rda
@@ -37,6 +45,19 @@ public:
    struct Context;
 
    static std::shared_ptr<Context> CreateContext();
+
+   /**
+    * @brief Creates a context for parsing messages from a decompressed record
+    * buffer. Digital Radar Data Generic messages created with this context
+    * reference moment data in the buffer rather than copying it, and are
+    * allocated from the arena if one is provided. The swapped flag, if
+    * provided, is set once 16-bit moment data is decoded in place within the
+    * buffer.
+    */
+   static std::shared_ptr<Context>
+   CreateContext(std::shared_ptr<std::vector<char>> recordBuffer,
+                 std::shared_ptr<util::Arena>       arena          = nullptr,
+                 std::shared_ptr<std::atomic<bool>> momentsSwapped = nullptr);
    static Level2MessageInfo        Create(std::istream&             is,
                                           std::shared_ptr<Context>& ctx);
 };
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <scwx/wsr88d/rda/generic_radar_data.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+enum class AccumulationWindow
+{
+   OneHour,
+   ThreeHour,
+   StormTotal
+};
+
+/**
+ * @brief Running precipitation accumulation of a radar site, estimated from
+ * the reflectivity of the lowest elevation of each volume. Rain rates use the
+ * WSR-88D convective Z-R relationship (Z = 300R^1.4), and the depth between
+ * two volumes is the mean of their rates over the interval.
+ *
+ * Accumulations are held on a fixed polar grid of 1 degree by 250 meter cells.
+ * The depth of each interval is kept for the longest timed window, and each
+ * window is a running sum. A new volume adds its interval to each window, and
+ * subtracts the intervals which have left the window, such that an update
+ * costs a fixed number of operations per cell. The storm total restarts when
+ * precipitation resumes after an hour without any.
+ *
+ * Accumulation and products may be used from any thread.
+ */
+class PrecipitationAccumulator
+{
+public:
+   static constexpr std::size_t kRadials   = 360u;
+   static constexpr std::size_t kGates     = 920u;
+   static constexpr float       kGateSize  = 250.0f; // Meters
+   static constexpr float       kDepthUnit = 0.01f;  // Millimeters
+
+   // Coding of accumulation depths (mm)
+   static constexpr float kDepthScale  = 50.0f;
+   static constexpr float kDepthOffset = 2.0f;
+
+   explicit PrecipitationAccumulator();
+   ~PrecipitationAccumulator();
+
+   PrecipitationAccumulator(const PrecipitationAccumulator&) = delete;
+   PrecipitationAccumulator&
+   operator=(const PrecipitationAccumulator&) = delete;
+
+   PrecipitationAccumulator(PrecipitationAccumulator&&) noexcept = delete;
+   PrecipitationAccumulator&
+   operator=(PrecipitationAccumulator&&) noexcept = delete;
+
+   /**
+    * @brief Time of the last volume accumulated, or the epoch if no volume has
+    * been accumulated.
+    */
+   std::chrono::system_clock::time_point end_time() const;
+
+   /**
+    * @brief Time at which an accumulation window begins, which is later than
+    * the window duration if fewer volumes have been accumulated.
+    */
+   std::chrono::system_clock::time_point
+   begin_time(AccumulationWindow window) const;
+
+   /**
+    * @brief Number of times the accumulation has changed, such that derived
+    * products can determine whether they are current.
+    */
+   std::uint64_t revision() const;
+
+   /**
+    * @brief Accumulates the reflectivity of the lowest elevation of a volume.
+    * Volumes at or before end_time() are skipped. Volumes more than 20 minutes
+    * after the previous volume only begin a new interval.
+    *
+    * @param elevationScan Complete lowest elevation scan of the volume
+    * @param time Time of the volume
+    *
+    * @return true if the volume was accumulated
+    */
+   bool Accumulate(const std::shared_ptr<ElevationScan>& elevationScan,
+                   std::chrono::system_clock::time_point time);
+
+   /**
+    * @brief Gets the accumulated depth of a grid cell.
+    *
+    * @param window Accumulation window
+    * @param radial Grid radial, from 0 degrees
+    * @param gate Grid gate, from the radar site
+    *
+    * @return Depth (mm)
+    */
+   float depth(AccumulationWindow window,
+               std::size_t        radial,
+               std::size_t        gate) const;
+
+   /**
+    * @brief Creates an accumulation elevation scan on the radials and gates of
+    * an elevation scan, coded in millimeters with kDepthScale and
+    * kDepthOffset as 16-bit reflectivity moments. Gates without precipitation
+    * are below threshold.
+    *
+    * @param window Accumulation window
+    * @param layoutScan Elevation scan to take the radials and gates from
+    */
+   std::shared_ptr<ElevationScan>
+   Accumulation(AccumulationWindow window,
+                const ElevationScan& layoutScan) const;
+
+   /**
+    * @brief Clears the accumulation.
+    */
+   void Reset();
+
+   /**
+    * @brief Writes the accumulation state to a binary stream.
+    *
+    * @return true if the state was written
+    */
+   bool Save(std::ostream& os) const;
+
+   /**
+    * @brief Reads accumulation state written by Save(), replacing the current
+    * state. The state is unchanged if the stream is not valid.
+    *
+    * @return true if the state was read
+    */
+   bool Load(std::istream& is);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace scwx
 {
 namespace wsr88d
@@ -13,11 +15,22 @@ enum class MessageId : std::uint8_t
    RdaStatusData              = 2,
    PerformanceMaintenanceData = 3,
    VolumeCoveragePatternData  = 5,
+   ClutterFilterBypassMap     = 13,
    ClutterFilterMap           = 15,
    RdaAdaptationData          = 18,
    DigitalRadarDataGeneric    = 31
 };
 
+enum class RadialStatus : std::uint16_t
+{
+   StartOfElevation      = 0,
+   IntermediateRadial    = 1,
+   EndOfElevation        = 2,
+   BeginningOfVolumeScan = 3,
+   EndOfVolumeScan       = 4,
+   StartOfLastElevation  = 5
+};
+
 } // namespace rda
 } // namespace wsr88d
 } // namespace scwx
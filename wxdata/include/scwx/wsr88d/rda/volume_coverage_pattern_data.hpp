@@ -2,6 +2,7 @@
 
 #include <scwx/wsr88d/rda/level2_message.hpp>
 
+#include <chrono>
 #include <string>
 
 namespace scwx
@@ -87,6 +88,12 @@ public:
    uint16_t     doppler_prf_number(uint16_t e, uint16_t s) const;
    uint16_t     doppler_prf_pulse_count_radial(uint16_t e, uint16_t s) const;
 
+   /**
+    * @brief Estimates the duration of a volume scan from the rotation time of
+    * each elevation cut, excluding antenna transitions between cuts.
+    */
+   std::chrono::seconds volume_scan_duration() const;
+
    bool Parse(std::istream& is);
 
    static std::shared_ptr<VolumeCoveragePatternData>
@@ -35,6 +35,12 @@ public:
    std::shared_ptr<GraphicAlphanumericBlock> graphic_block() const;
    std::shared_ptr<TabularAlphanumericBlock> tabular_block() const;
 
+   /**
+    * @brief Size of the product data after decompression, in bytes, or 0 if
+    * the product was not compressed.
+    */
+   std::size_t decompressed_size() const;
+
    bool Parse(std::istream& is) override;
 
    static std::shared_ptr<GraphicProductMessage>
@@ -2,8 +2,17 @@
 
 #include <scwx/wsr88d/rpg/packet.hpp>
 
+#include <optional>
+
 namespace scwx
 {
+namespace util
+{
+
+class Arena;
+
+} // namespace util
+
 namespace wsr88d
 {
 namespace rpg
@@ -23,6 +32,31 @@ private:
 
 public:
    static std::shared_ptr<Packet> Create(std::istream& is);
+
+   /**
+    * @brief Creates a packet, allocating the packet object from an arena.
+    *
+    * @param [in] is Input stream positioned at the start of the packet
+    * @param [in] arena Arena to allocate from, or nullptr to allocate on the
+    * heap
+    *
+    * @return Packet, or nullptr if the packet was invalid
+    */
+   static std::shared_ptr<Packet>
+   Create(std::istream& is, const std::shared_ptr<util::Arena>& arena);
+
+   /**
+    * @brief Gets the size of the packet at the start of the buffer from its
+    * length field, without decoding the packet.
+    *
+    * @param [in] data Packet data
+    * @param [in] size Size of the packet data available
+    *
+    * @return Packet size in bytes, or std::nullopt if the packet must be
+    * decoded to determine its size
+    */
+   static std::optional<std::size_t> GetPacketSize(const char* data,
+                                                   std::size_t size);
 };
 
 } // namespace rpg
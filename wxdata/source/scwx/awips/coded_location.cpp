@@ -1,7 +1,8 @@
 #include <scwx/awips/coded_location.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/strings.hpp>
 
-#include <sstream>
+#include <string_view>
 
 namespace scwx
 {
@@ -11,6 +12,9 @@ namespace awips
 static const std::string logPrefix_ = "scwx::awips::coded_location";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+// Whitespace characters separating tokens, as with std::istream
+static constexpr std::string_view kWhitespace_ {" \t\n\v\f\r"};
+
 class CodedLocationImpl
 {
 public:
@@ -43,17 +47,11 @@ bool CodedLocation::Parse(const StringRange& lines, const std::string& wfo)
    bool           dataValid = true;
    LocationFormat format {};
 
-   std::vector<std::string> tokenList;
+   std::vector<std::string_view> tokenList;
 
-   for (std::string line : lines)
+   for (const std::string& line : lines)
    {
-      std::string        token;
-      std::istringstream tokenStream {line};
-
-      while (tokenStream >> token)
-      {
-         tokenList.push_back(token);
-      }
+      util::SplitTokens(line, kWhitespace_, tokenList);
    }
 
    // First token is "LAT...LON"
@@ -87,9 +85,9 @@ bool CodedLocation::Parse(const StringRange& lines, const std::string& wfo)
 
             try
             {
-               latitude = std::stod(*token) * 0.01;
+               latitude = util::ParseNumeric<double>(*token) * 0.01;
                ++token;
-               longitude = std::stod(*token) * 0.01;
+               longitude = util::ParseNumeric<double>(*token) * 0.01;
             }
             catch (const std::exception& ex)
             {
@@ -139,8 +137,10 @@ bool CodedLocation::Parse(const StringRange& lines, const std::string& wfo)
 
             try
             {
-               latitude  = std::stod(token->substr(0, 4)) * 0.01;
-               longitude = std::stod(token->substr(4, 4)) * -0.01;
+               latitude =
+                  util::ParseNumeric<double>(token->substr(0, 4)) * 0.01;
+               longitude =
+                  util::ParseNumeric<double>(token->substr(4, 4)) * -0.01;
             }
             catch (const std::exception& ex)
             {
@@ -10,8 +10,11 @@
 
 #include <scwx/awips/coded_time_motion_location.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/strings.hpp>
 
-#include <sstream>
+#include <algorithm>
+#include <optional>
+#include <string_view>
 
 #if (__cpp_lib_chrono < 201907L)
 #   include <date/date.h>
@@ -25,6 +28,11 @@ namespace awips
 static const std::string logPrefix_ = "scwx::awips::coded_time_motion_location";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+// Whitespace characters separating tokens, as with std::istream
+static constexpr std::string_view kWhitespace_ {" \t\n\v\f\r"};
+
+static std::optional<std::chrono::minutes> ParseTime(std::string_view s);
+
 class CodedTimeMotionLocationImpl
 {
 public:
@@ -78,17 +86,11 @@ bool CodedTimeMotionLocation::Parse(const StringRange& lines,
 {
    bool dataValid = true;
 
-   std::vector<std::string> tokenList;
+   std::vector<std::string_view> tokenList;
 
-   for (std::string line : lines)
+   for (const std::string& line : lines)
    {
-      std::string        token;
-      std::istringstream tokenStream {line};
-
-      while (tokenStream >> token)
-      {
-         tokenList.push_back(token);
-      }
+      util::SplitTokens(line, kWhitespace_, tokenList);
    }
 
    // First token is "TIME...MOT...LOC"
@@ -103,23 +105,15 @@ bool CodedTimeMotionLocation::Parse(const StringRange& lines,
       bool       straddlesDateLine = false;
 
       // Time: hhmmZ
-      std::string time = tokenList.at(1);
+      std::string_view time = tokenList.at(1);
       {
          using namespace std::chrono;
 
-#if (__cpp_lib_chrono < 201907L)
-         using namespace date;
-#endif
-
-         static const std::string timeFormat {"%H%MZ"};
+         std::optional<minutes> tp = ParseTime(time);
 
-         std::istringstream in {time};
-         minutes            tp;
-         in >> parse(timeFormat, tp);
-
-         if (time.size() == 5 && !in.fail())
+         if (tp.has_value())
          {
-            p->time_ = std::chrono::hh_mm_ss {tp};
+            p->time_ = std::chrono::hh_mm_ss {*tp};
          }
          else
          {
@@ -130,13 +124,13 @@ bool CodedTimeMotionLocation::Parse(const StringRange& lines,
       }
 
       // Direction: dirDEG
-      std::string direction = tokenList.at(2);
+      std::string_view direction = tokenList.at(2);
       if (direction.size() == 6 && direction.ends_with("DEG"))
       {
          try
          {
-            p->direction_ =
-               static_cast<uint16_t>(std::stoul(direction.substr(0, 3)));
+            p->direction_ = static_cast<uint16_t>(
+               util::ParseNumeric<std::size_t>(direction.substr(0, 3)));
          }
          catch (const std::exception& ex)
          {
@@ -152,7 +146,7 @@ bool CodedTimeMotionLocation::Parse(const StringRange& lines,
       }
 
       // Speed: <sp>KT
-      std::string speed = tokenList.at(3);
+      std::string_view speed = tokenList.at(3);
       if (speed.size() >= 3 && speed.size() <= 5 && speed.ends_with("KT"))
       {
          try
@@ -160,7 +154,8 @@ bool CodedTimeMotionLocation::Parse(const StringRange& lines,
             // NWSI 10-1701 specifies a valid speed range of 0-99 knots.
             // However, sometimes text products are published with a larger
             // value. Instead, allow a value up to 255 knots.
-            auto parsedSpeed = std::stoul(speed.substr(0, speed.size() - 2));
+            auto parsedSpeed = util::ParseNumeric<std::size_t>(
+               speed.substr(0, speed.size() - 2));
             if (parsedSpeed <= 255u)
             {
                p->speed_ = static_cast<uint8_t>(parsedSpeed);
@@ -192,9 +187,9 @@ bool CodedTimeMotionLocation::Parse(const StringRange& lines,
 
          try
          {
-            latitude = std::stod(*token) * 0.01;
+            latitude = util::ParseNumeric<double>(*token) * 0.01;
             ++token;
-            longitude = std::stod(*token) * 0.01;
+            longitude = util::ParseNumeric<double>(*token) * 0.01;
          }
          catch (const std::exception& ex)
          {
@@ -264,5 +259,27 @@ CodedTimeMotionLocation::Create(const StringRange& lines,
    return motion;
 }
 
+static std::optional<std::chrono::minutes> ParseTime(std::string_view s)
+{
+   // Time takes the form hhmmZ
+   if (s.size() != 5 || s[4] != 'Z' ||
+       !std::all_of(s.cbegin(),
+                    s.cbegin() + 4,
+                    [](char c) { return c >= '0' && c <= '9'; }))
+   {
+      return std::nullopt;
+   }
+
+   const int hour   = (s[0] - '0') * 10 + (s[1] - '0');
+   const int minute = (s[2] - '0') * 10 + (s[3] - '0');
+
+   if (hour > 23 || minute > 59)
+   {
+      return std::nullopt;
+   }
+
+   return std::chrono::hours {hour} + std::chrono::minutes {minute};
+}
+
 } // namespace awips
 } // namespace scwx
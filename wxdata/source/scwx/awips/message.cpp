@@ -46,9 +46,11 @@ bool Message::ValidateMessage(std::istream& is, size_t bytesRead) const
 
       if (bytesRead < dataSize)
       {
-         logger_->trace("Message contents smaller than size: {} < {} bytes",
-                        bytesRead,
-                        dataSize);
+         SPDLOG_LOGGER_TRACE(
+            logger_,
+            "Message contents smaller than size: {} < {} bytes",
+            bytesRead,
+            dataSize);
       }
       if (bytesRead > dataSize)
       {
@@ -10,8 +10,11 @@
 
 #include <scwx/awips/pvtec.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/strings.hpp>
 
 #include <chrono>
+#include <optional>
+#include <string_view>
 
 #include <boost/assign.hpp>
 #include <boost/bimap.hpp>
@@ -33,6 +36,9 @@ typedef boost::bimap<boost::bimaps::unordered_set_of<PVtec::ProductType>,
                      boost::bimaps::unordered_set_of<std::string>>
    ProductTypeCodesBimap;
 
+static std::optional<std::chrono::sys_time<std::chrono::minutes>>
+ParseDateTime(std::string_view s);
+
 static const ProductTypeCodesBimap productTypeCodes_ =
    boost::assign::list_of<ProductTypeCodesBimap::relation>    //
    (PVtec::ProductType::Operational, "O")                     //
@@ -143,10 +149,6 @@ bool PVtec::Parse(const std::string& s)
 {
    using namespace std::chrono;
 
-#if (__cpp_lib_chrono < 201907L)
-   using namespace date;
-#endif
-
    // P-VTEC takes the form:
    // /k.aaa.cccc.pp.s.####.yymmddThhnnZ-yymmddThhnnZ/
    // 012345678901234567890123456789012345678901234567
@@ -176,12 +178,13 @@ bool PVtec::Parse(const std::string& s)
       p->phenomenon_      = GetPhenomenon(s.substr(pVtecOffsetPhenomenon_, 2));
       p->significance_ = GetSignificance(s.substr(pVtecOffsetSignificance_, 1));
 
-      std::string eventNumberString = s.substr(pVtecOffsetEventNumber_, 4);
+      std::string_view eventNumberString =
+         std::string_view {s}.substr(pVtecOffsetEventNumber_, 4);
 
       try
       {
          p->eventTrackingNumber_ =
-            static_cast<int16_t>(std::stoi(eventNumberString));
+            static_cast<int16_t>(util::ParseNumeric<int>(eventNumberString));
       }
       catch (const std::exception& ex)
       {
@@ -192,39 +195,13 @@ bool PVtec::Parse(const std::string& s)
          p->eventTrackingNumber_ = -1;
       }
 
-      static const std::string dateTimeFormat {"%y%m%dT%H%MZ"};
-
-      std::string sEventBegin = s.substr(pVtecOffsetEventBegin_, 12);
-      std::string sEventEnd   = s.substr(pVtecOffsetEventEnd_, 12);
-
-      std::istringstream ssEventBegin {sEventBegin};
-      std::istringstream ssEventEnd {sEventEnd};
-
-      std::chrono::sys_time<minutes> eventBegin;
-      std::chrono::sys_time<minutes> eventEnd;
-
-      ssEventBegin >> parse(dateTimeFormat, eventBegin);
-      ssEventEnd >> parse(dateTimeFormat, eventEnd);
-
-      if (!ssEventBegin.fail())
-      {
-         p->eventBegin_ = eventBegin;
-      }
-      else
-      {
-         // Time parsing expected to fail if time is "000000T0000Z"
-         p->eventBegin_ = {};
-      }
-
-      if (!ssEventEnd.fail())
-      {
-         p->eventEnd_ = eventEnd;
-      }
-      else
-      {
-         // Time parsing expected to fail if time is "000000T0000Z"
-         p->eventEnd_ = {};
-      }
+      // Time parsing expected to fail if time is "000000T0000Z"
+      p->eventBegin_ =
+         ParseDateTime(std::string_view {s}.substr(pVtecOffsetEventBegin_, 12))
+            .value_or(sys_time<minutes> {});
+      p->eventEnd_ =
+         ParseDateTime(std::string_view {s}.substr(pVtecOffsetEventEnd_, 12))
+            .value_or(sys_time<minutes> {});
    }
    else
    {
@@ -282,5 +259,61 @@ const std::string& PVtec::GetActionCode(PVtec::Action action)
    return actionCodes_.left.at(action);
 }
 
+static std::optional<std::chrono::sys_time<std::chrono::minutes>>
+ParseDateTime(std::string_view s)
+{
+   using namespace std::chrono;
+
+#if (__cpp_lib_chrono < 201907L)
+   using namespace date;
+#endif
+
+   // Date/time takes the form:
+   // yymmddThhnnZ
+   // 012345678901
+   static constexpr std::size_t kDateTimeLength_ = 12u;
+
+   if (s.size() != kDateTimeLength_ || s[6] != 'T' || s[11] != 'Z')
+   {
+      return std::nullopt;
+   }
+
+   auto digits = [&s](std::size_t pos) -> int
+   {
+      const char c0 = s[pos];
+      const char c1 = s[pos + 1];
+      if (c0 < '0' || c0 > '9' || c1 < '0' || c1 > '9')
+      {
+         return -1;
+      }
+      return (c0 - '0') * 10 + (c1 - '0');
+   };
+
+   const int yy     = digits(0);
+   const int mm     = digits(2);
+   const int dd     = digits(4);
+   const int hour   = digits(7);
+   const int minute = digits(9);
+
+   if (yy < 0 || mm < 0 || dd < 0 || hour < 0 || hour > 23 || minute < 0 ||
+       minute > 59)
+   {
+      return std::nullopt;
+   }
+
+   // Two digit years are interpreted the same as %y: 69-99 are 1969-1999, and
+   // 00-68 are 2000-2068
+   const year_month_day ymd {year {yy < 69 ? 2000 + yy : 1900 + yy},
+                             month {static_cast<unsigned int>(mm)},
+                             day {static_cast<unsigned int>(dd)}};
+
+   if (!ymd.ok())
+   {
+      return std::nullopt;
+   }
+
+   return sys_days {ymd} + hours {hour} + minutes {minute};
+}
+
 } // namespace awips
 } // namespace scwx
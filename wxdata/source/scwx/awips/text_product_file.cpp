@@ -1,7 +1,16 @@
 #include <scwx/awips/text_product_file.hpp>
+#include <scwx/common/characters.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <execution>
 #include <fstream>
+#include <numeric>
+#include <string_view>
+#include <unordered_map>
+
+#include <boost/container_hash/hash.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
 
 namespace scwx
 {
@@ -17,7 +26,17 @@ public:
    explicit TextProductFileImpl() : messages_ {} {};
    ~TextProductFileImpl() = default;
 
+   void AddMessage(const std::shared_ptr<TextProductMessage>& message);
+
+   static std::vector<std::string_view> SplitProducts(std::string_view data);
+   static std::vector<std::shared_ptr<TextProductMessage>>
+   ParseProducts(std::string_view data);
+   static std::size_t GetWmoHeaderHash(const WmoHeader& header);
+
    std::vector<std::shared_ptr<TextProductMessage>> messages_;
+
+   // Indices of messages by WMO header hash, used to discard duplicates
+   std::unordered_multimap<std::size_t, std::size_t> messageIndices_ {};
 };
 
 TextProductFile::TextProductFile() : p(std::make_unique<TextProductFileImpl>())
@@ -67,29 +86,111 @@ bool TextProductFile::LoadFile(const std::string& filename)
 
 bool TextProductFile::LoadData(std::istream& is)
 {
-   logger_->trace("Loading Data");
+   SPDLOG_LOGGER_TRACE(logger_, "Loading Data");
+
+   const std::string data {std::istreambuf_iterator<char>(is),
+                           std::istreambuf_iterator<char>()};
+
+   // Split the data on product boundaries, and parse the products in parallel
+   const std::vector<std::string_view> products =
+      TextProductFileImpl::SplitProducts(data);
+   std::vector<std::vector<std::shared_ptr<TextProductMessage>>> messages(
+      products.size());
+
+   std::vector<std::size_t> indices(products.size());
+   std::iota(indices.begin(), indices.end(), std::size_t {0});
+
+   std::for_each(std::execution::par,
+                 indices.cbegin(),
+                 indices.cend(),
+                 [&](std::size_t i)
+                 {
+                    messages[i] =
+                       TextProductFileImpl::ParseProducts(products[i]);
+                 });
+
+   // Add messages in the order they appear in the data
+   for (auto& productMessages : messages)
+   {
+      for (auto& message : productMessages)
+      {
+         p->AddMessage(message);
+      }
+   }
+
+   return !p->messages_.empty();
+}
+
+void TextProductFileImpl::AddMessage(
+   const std::shared_ptr<TextProductMessage>& message)
+{
+   const WmoHeader&  wmoHeader = *message->wmo_header();
+   const std::size_t hash      = GetWmoHeaderHash(wmoHeader);
+
+   auto range = messageIndices_.equal_range(hash);
+   for (auto it = range.first; it != range.second; ++it)
+   {
+      if (*messages_[it->second]->wmo_header() == wmoHeader)
+      {
+         // Discard duplicate message
+         return;
+      }
+   }
+
+   messageIndices_.emplace(hash, messages_.size());
+   messages_.push_back(message);
+}
+
+std::vector<std::string_view>
+TextProductFileImpl::SplitProducts(std::string_view data)
+{
+   std::vector<std::string_view> products {};
+
+   // Products in a file each begin with SOH. Data preceding the first SOH, or
+   // without SOH, is parsed as a single product.
+   std::size_t productBegin = 0;
+
+   while (productBegin < data.size())
+   {
+      std::size_t productEnd =
+         data.find(common::Characters::SOH, productBegin + 1);
+      if (productEnd == std::string_view::npos)
+      {
+         productEnd = data.size();
+      }
+
+      std::string_view product =
+         data.substr(productBegin, productEnd - productBegin);
+
+      // Skip data containing only padding between products
+      if (product.find_first_not_of(std::string_view {"\r\n \0\x03", 5}) !=
+          std::string_view::npos)
+      {
+         products.push_back(product);
+      }
+
+      productBegin = productEnd;
+   }
+
+   return products;
+}
+
+std::vector<std::shared_ptr<TextProductMessage>>
+TextProductFileImpl::ParseProducts(std::string_view data)
+{
+   std::vector<std::shared_ptr<TextProductMessage>> messages {};
+
+   boost::iostreams::stream<boost::iostreams::array_source> is {data.data(),
+                                                               data.size()};
 
    while (!is.eof())
    {
       std::shared_ptr<TextProductMessage> message =
          TextProductMessage::Create(is);
-      bool duplicate = false;
 
       if (message != nullptr)
       {
-         for (auto m : p->messages_)
-         {
-            if (*m->wmo_header().get() == *message->wmo_header().get())
-            {
-               duplicate = true;
-               break;
-            }
-         }
-
-         if (!duplicate)
-         {
-            p->messages_.push_back(message);
-         }
+         messages.push_back(message);
       }
       else
       {
@@ -97,7 +198,24 @@ bool TextProductFile::LoadData(std::istream& is)
       }
    }
 
-   return !p->messages_.empty();
+   return messages;
+}
+
+std::size_t TextProductFileImpl::GetWmoHeaderHash(const WmoHeader& header)
+{
+   std::size_t seed = 0;
+
+   boost::hash_combine(seed, header.sequence_number());
+   boost::hash_combine(seed, header.data_type());
+   boost::hash_combine(seed, header.geographic_designator());
+   boost::hash_combine(seed, header.bulletin_id());
+   boost::hash_combine(seed, header.icao());
+   boost::hash_combine(seed, header.date_time());
+   boost::hash_combine(seed, header.bbb_indicator());
+   boost::hash_combine(seed, header.product_category());
+   boost::hash_combine(seed, header.product_designator());
+
+   return seed;
 }
 
 } // namespace awips
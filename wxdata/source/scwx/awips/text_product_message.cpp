@@ -5,10 +5,17 @@
 
 #include <algorithm>
 #include <istream>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/trim.hpp>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
 #include <re2/re2.h>
 
 namespace scwx
@@ -55,6 +62,12 @@ public:
    std::vector<std::string>              mndHeader_;
    std::vector<std::string>              overviewBlock_;
    std::vector<std::shared_ptr<Segment>> segments_;
+
+   // Message content compressed with zlib, once the message is compacted
+   std::string compressedContent_ {};
+   bool        compact_ {false};
+
+   mutable std::shared_mutex mutex_ {};
 };
 
 TextProductMessage::TextProductMessage() :
@@ -69,7 +82,30 @@ TextProductMessage::operator=(TextProductMessage&&) noexcept = default;
 
 std::string TextProductMessage::message_content() const
 {
-   return p->messageContent_;
+   std::shared_lock lock(p->mutex_);
+
+   if (p->compressedContent_.empty())
+   {
+      return p->messageContent_;
+   }
+
+   std::string messageContent {};
+
+   try
+   {
+      boost::iostreams::filtering_istream in;
+      in.push(boost::iostreams::zlib_decompressor());
+      in.push(boost::iostreams::array_source(p->compressedContent_.data(),
+                                             p->compressedContent_.size()));
+      boost::iostreams::copy(in,
+                             boost::iostreams::back_inserter(messageContent));
+   }
+   catch (const boost::iostreams::zlib_error& ex)
+   {
+      logger_->warn("Error decompressing message content: {}", ex.what());
+   }
+
+   return messageContent;
 }
 
 std::shared_ptr<WmoHeader> TextProductMessage::wmo_header() const
@@ -79,11 +115,13 @@ std::shared_ptr<WmoHeader> TextProductMessage::wmo_header() const
 
 std::vector<std::string> TextProductMessage::mnd_header() const
 {
+   std::shared_lock lock(p->mutex_);
    return p->mndHeader_;
 }
 
 std::vector<std::string> TextProductMessage::overview_block() const
 {
+   std::shared_lock lock(p->mutex_);
    return p->overviewBlock_;
 }
 
@@ -94,6 +132,8 @@ size_t TextProductMessage::segment_count() const
 
 std::vector<std::shared_ptr<const Segment>> TextProductMessage::segments() const
 {
+   std::shared_lock lock(p->mutex_);
+
    std::vector<std::shared_ptr<const Segment>> segments(p->segments_.cbegin(),
                                                         p->segments_.cend());
    return segments;
@@ -101,6 +141,7 @@ std::vector<std::shared_ptr<const Segment>> TextProductMessage::segments() const
 
 std::shared_ptr<const Segment> TextProductMessage::segment(size_t s) const
 {
+   std::shared_lock lock(p->mutex_);
    return p->segments_[s];
 }
 
@@ -211,6 +252,68 @@ size_t TextProductMessage::data_size() const
    return 0;
 }
 
+bool TextProductMessage::Compact()
+{
+   std::unique_lock lock(p->mutex_);
+
+   if (p->compact_)
+   {
+      return true;
+   }
+
+   if (p->compressedContent_.empty() && !p->messageContent_.empty())
+   {
+      std::string compressedContent {};
+
+      try
+      {
+         boost::iostreams::filtering_ostream out;
+         out.push(boost::iostreams::zlib_compressor());
+         out.push(boost::iostreams::back_inserter(compressedContent));
+         out.write(p->messageContent_.data(), p->messageContent_.size());
+         boost::iostreams::close(out);
+      }
+      catch (const boost::iostreams::zlib_error& ex)
+      {
+         logger_->warn("Error compressing message content: {}", ex.what());
+         return false;
+      }
+
+      compressedContent.shrink_to_fit();
+      p->compressedContent_ = std::move(compressedContent);
+      p->messageContent_    = {};
+   }
+
+   p->mndHeader_     = {};
+   p->overviewBlock_ = {};
+
+   bool segmentsCompacted = true;
+
+   for (auto& segment : p->segments_)
+   {
+      // Segments can only be referenced outside of the message by copying them
+      // while holding the lock. If a segment is still referenced, it may be in
+      // use, and must not be modified.
+      if (segment.use_count() > 1)
+      {
+         segmentsCompacted = false;
+         continue;
+      }
+
+      segment->productContent_ = {};
+
+      if (segment->header_.has_value())
+      {
+         segment->header_->ugcString_ = {};
+         segment->header_->ugcNames_  = {};
+      }
+   }
+
+   p->compact_ = segmentsCompacted;
+
+   return p->compact_;
+}
+
 bool TextProductMessage::Parse(std::istream& is)
 {
    bool dataValid = true;
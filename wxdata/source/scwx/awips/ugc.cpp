@@ -1,13 +1,13 @@
 #include <scwx/awips/ugc.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/strings.hpp>
 
+#include <algorithm>
 #include <map>
 
 #include <boost/assign.hpp>
 #include <boost/bimap.hpp>
 #include <boost/bimap/unordered_set_of.hpp>
-#include <boost/tokenizer.hpp>
-#include <re2/re2.h>
 
 namespace scwx
 {
@@ -34,6 +34,13 @@ static const UgcFormatBimap ugcFormatMap_ =
    (UgcFormat::Zones, 'Z')                          //
    (UgcFormat::Unknown, '?');
 
+static bool          IsDigits(std::string_view s, std::size_t length);
+static bool          IsAnyFipsId(std::string_view s);
+static bool          IsUgcStart(std::string_view s);
+static std::uint16_t ParseFipsId(std::string_view s);
+static std::uint32_t
+EncodeFipsCode(const std::string& state, UgcFormat format, std::uint16_t id);
+
 class UgcImpl
 {
 public:
@@ -94,6 +101,21 @@ std::vector<std::string> Ugc::fips_ids() const
    return fipsIds;
 }
 
+std::vector<std::uint32_t> Ugc::fips_codes() const
+{
+   std::vector<std::uint32_t> fipsCodes {};
+
+   for (auto& fipsIdList : p->fipsIdMap_)
+   {
+      for (auto& id : fipsIdList.second)
+      {
+         fipsCodes.push_back(EncodeFipsCode(fipsIdList.first, p->format_, id));
+      }
+   }
+
+   return fipsCodes;
+}
+
 std::string Ugc::product_expiration() const
 {
    return p->productExpiration_;
@@ -104,16 +126,6 @@ bool Ugc::Parse(const std::vector<std::string>& ugcString)
    bool dataValid = false;
 
    // UGC takes the form SSFNNN-NNN>NNN-SSFNNN-DDHHMM- (NWSI 10-1702)
-   static constexpr LazyRE2 reStart          = {"[A-Z]{2}[CZ]([0-9]{3}|ALL)"};
-   static constexpr LazyRE2 reAnyFipsId      = {"([0-9]{3}|ALL)"};
-   static constexpr LazyRE2 reSpecificFipsId = {"[0-9]{3}"};
-   static constexpr LazyRE2 reProductExpiration = {"[0-9]{6}"};
-
-   std::stringstream ugcStream;
-   for (auto& line : ugcString)
-   {
-      ugcStream << line;
-   }
 
    // Concatenate UGC lines into a single string
    std::string ugc {};
@@ -122,41 +134,45 @@ bool Ugc::Parse(const std::vector<std::string>& ugcString)
       ugc += line;
    }
 
-   boost::char_separator<char> sectionDelimiter("-");
-   boost::char_separator<char> rangeDelimiter(">");
-   boost::tokenizer            tokens(ugc, sectionDelimiter);
+   std::vector<std::string_view> tokens {};
+   std::vector<std::string_view> rangeTokens {};
+   util::SplitTokens(ugc, "-", tokens);
 
    std::string currentState {};
 
-   for (auto& token : tokens)
+   for (std::string_view token : tokens)
    {
       // Product Expiration is the final token
-      if (RE2::FullMatch(token, *reProductExpiration))
+      if (IsDigits(token, 6))
       {
          p->productExpiration_ = token;
          dataValid             = true;
          break;
       }
 
-      // Tokenize string again by ">" (note there will always be at least one
-      // range token)
-      boost::tokenizer rangeTokens(token, rangeDelimiter);
-      const size_t     numRangeTokens =
-         std::distance(rangeTokens.begin(), rangeTokens.end());
-      bool        tokenValid = true;
-      bool        allFipsIds = false;
-      auto        tokenIt    = rangeTokens.begin();
-      std::string firstToken {tokenIt.current_token()};
-      UgcFormat   currentFormat {p->format_};
-      std::string firstFipsId {};
-      std::string secondFipsId {};
+      // Tokenize string again by ">"
+      rangeTokens.clear();
+      util::SplitTokens(token, ">", rangeTokens);
+
+      const size_t     numRangeTokens = rangeTokens.size();
+      bool             tokenValid     = true;
+      bool             allFipsIds     = false;
+      std::string_view firstToken {};
+      UgcFormat        currentFormat {p->format_};
+      std::string_view firstFipsId {};
+      std::string_view secondFipsId {};
+
+      if (numRangeTokens > 0)
+      {
+         firstToken = rangeTokens[0];
+      }
 
       // Look for the start of the UGC string (may be multiple per UGC string
       // for multiple states, territories, or marine area)
-      if (RE2::FullMatch(firstToken, *reStart))
+      if (IsUgcStart(firstToken))
       {
          currentState  = firstToken.substr(0, 2);
-         currentFormat = ugcFormatMap_.right.at(firstToken.at(2));
+         currentFormat = ugcFormatMap_.right.at(firstToken[2]);
          firstFipsId   = firstToken.substr(3, 3);
 
          // The UGC string must contain counties or zones, but not both
@@ -166,8 +182,7 @@ bool Ugc::Parse(const std::vector<std::string>& ugcString)
          }
       }
       // Look for additional FIPS IDs in the UGC string
-      else if (!currentState.empty() &&
-               RE2::FullMatch(firstToken, *reAnyFipsId))
+      else if (!currentState.empty() && IsAnyFipsId(firstToken))
       {
          firstFipsId = firstToken;
       }
@@ -186,10 +201,9 @@ bool Ugc::Parse(const std::vector<std::string>& ugcString)
       // Parse the second token in a range (i.e., NNN>XXX)
       if (numRangeTokens == 2)
       {
-         std::string secondToken {(++tokenIt).current_token()};
+         std::string_view secondToken {rangeTokens[1]};
 
-         if (RE2::FullMatch(secondToken, *reSpecificFipsId) &&
-             secondToken != "000")
+         if (IsDigits(secondToken, 3) && secondToken != "000")
          {
             secondFipsId = secondToken;
          }
@@ -217,15 +231,14 @@ bool Ugc::Parse(const std::vector<std::string>& ugcString)
       else
       {
          // Insert the FIPS ID (NNN) from the token
-         fipsIds.push_back(static_cast<uint16_t>(std::stoul(firstFipsId)));
+         fipsIds.push_back(ParseFipsId(firstFipsId));
 
          if (numRangeTokens == 2)
          {
             // Insert the remainder of the FIPS IDs in the range given by the
             // token (NNN>XXX)
             const uint16_t first = fipsIds.back();
-            const uint16_t last =
-               static_cast<uint16_t>(std::stoul(secondFipsId));
+            const uint16_t last  = ParseFipsId(secondFipsId);
 
             for (uint16_t i = first + 1; i <= last; i++)
             {
@@ -245,5 +258,61 @@ bool Ugc::Parse(const std::vector<std::string>& ugcString)
    return dataValid;
 }
 
+std::optional<std::uint32_t> Ugc::GetFipsCode(std::string_view fipsId)
+{
+   // FIPS IDs take the form SSFNNN
+   if (!IsUgcStart(fipsId) || !IsDigits(fipsId.substr(3), 3))
+   {
+      return std::nullopt;
+   }
+
+   return EncodeFipsCode(std::string {fipsId.substr(0, 2)},
+                         ugcFormatMap_.right.at(fipsId[2]),
+                         ParseFipsId(fipsId.substr(3)));
+}
+
+static bool IsDigits(std::string_view s, std::size_t length)
+{
+   return s.size() == length &&
+          std::all_of(s.cbegin(),
+                      s.cend(),
+                      [](char c) { return c >= '0' && c <= '9'; });
+}
+
+static bool IsAnyFipsId(std::string_view s)
+{
+   // Matches ([0-9]{3}|ALL)
+   return IsDigits(s, 3) || s == "ALL";
+}
+
+static bool IsUgcStart(std::string_view s)
+{
+   // Matches [A-Z]{2}[CZ]([0-9]{3}|ALL)
+   return s.size() == 6 &&                //
+          s[0] >= 'A' && s[0] <= 'Z' &&   //
+          s[1] >= 'A' && s[1] <= 'Z' &&   //
+          (s[2] == 'C' || s[2] == 'Z') && //
+          IsAnyFipsId(s.substr(3));
+}
+
+static std::uint16_t ParseFipsId(std::string_view s)
+{
+   // Assumes the FIPS ID has already been validated as 3 digits
+   return static_cast<std::uint16_t>((s[0] - '0') * 100 + (s[1] - '0') * 10 +
+                                     (s[2] - '0'));
+}
+
+static std::uint32_t
+EncodeFipsCode(const std::string& state, UgcFormat format, std::uint16_t id)
+{
+   // Combine the state letters, format and number into a unique code
+   const std::uint32_t stateCode =
+      static_cast<std::uint32_t>(state[0] - 'A') * 26u +
+      static_cast<std::uint32_t>(state[1] - 'A');
+   const std::uint32_t formatCode = (format == UgcFormat::Zones) ? 1u : 0u;
+
+   return (stateCode * 2u + formatCode) * 1000u + id;
+}
+
 } // namespace awips
 } // namespace scwx
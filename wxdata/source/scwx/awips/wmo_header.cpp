@@ -139,7 +139,7 @@ bool WmoHeader::Parse(std::istream& is)
 
    if (is.eof())
    {
-      logger_->trace("Reached end of file");
+      SPDLOG_LOGGER_TRACE(logger_, "Reached end of file");
       headerValid = false;
    }
    else
@@ -2,6 +2,7 @@
 #include <scwx/util/logger.hpp>
 #include <scwx/util/streams.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <limits>
@@ -43,6 +44,10 @@ ParseColor(const std::vector<std::string>& tokenList,
            size_t                          startIndex,
            ColorMode                       colorMode,
            bool                            hasAlpha = true);
+static boost::gil::rgba8_pixel_t
+Interpolate(const boost::gil::rgba8_pixel_t& color1,
+            const boost::gil::rgba8_pixel_t& color2,
+            float                            t);
 template<typename T>
 T RoundChannel(double value);
 template<typename T>
@@ -130,14 +135,7 @@ boost::gil::rgba8_pixel_t ColorTable::Color(float value) const
                                                   it->second.first;
 
             float t = (value - key1) / (key2 - key1);
-            color[0] =
-               RoundChannel<uint8_t>(std::lerp(color1[0], color2[0], t));
-            color[1] =
-               RoundChannel<uint8_t>(std::lerp(color1[1], color2[1], t));
-            color[2] =
-               RoundChannel<uint8_t>(std::lerp(color1[2], color2[2], t));
-            color[3] =
-               RoundChannel<uint8_t>(std::lerp(color1[3], color2[3], t));
+            color   = Interpolate(color1, color2, t);
          }
 
          found = true;
@@ -160,6 +158,68 @@ bool ColorTable::IsValid() const
    return p->colorMap_.size() > 0;
 }
 
+void ColorTable::Colors(std::span<const float>               values,
+                        std::span<boost::gil::rgba8_pixel_t> colors) const
+{
+   const std::size_t count = std::min(values.size(), colors.size());
+
+   if (p->colorMap_.empty())
+   {
+      std::fill_n(colors.begin(), count, boost::gil::rgba8_pixel_t {});
+      return;
+   }
+
+   std::vector<float> scaledValues(count);
+   std::transform(values.begin(),
+                  values.begin() + count,
+                  scaledValues.begin(),
+                  [this](float value)
+                  { return value * p->scale_ + p->offset_; });
+
+   // Unordered values are searched individually
+   if (!std::is_sorted(scaledValues.cbegin(), scaledValues.cend()) ||
+       std::any_of(scaledValues.cbegin(),
+                   scaledValues.cend(),
+                   [](float value) { return std::isnan(value); }))
+   {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         colors[i] = Color(values[i]);
+      }
+      return;
+   }
+
+   std::size_t i    = 0;
+   auto        prev = p->colorMap_.cbegin();
+
+   // Values below the first entry use the color of the first entry
+   for (; i < count && scaledValues[i] < prev->first; ++i)
+   {
+      colors[i] = prev->second.first;
+   }
+
+   // Interpolate values between each pair of entries
+   for (auto it = std::next(prev); it != p->colorMap_.cend(); prev = it++)
+   {
+      const float key1 = prev->first;
+      const float key2 = it->first;
+
+      const boost::gil::rgba8_pixel_t color1 = prev->second.first;
+      const boost::gil::rgba8_pixel_t color2 =
+         (prev->second.second) ? prev->second.second.value() :
+                                 it->second.first;
+
+      for (; i < count && scaledValues[i] < key2; ++i)
+      {
+         const float t = (scaledValues[i] - key1) / (key2 - key1);
+         colors[i]     = Interpolate(color1, color2, t);
+      }
+   }
+
+   // Values at or above the last entry use the color of the last entry
+   std::fill_n(colors.begin() + i, count - i, prev->second.first);
+}
+
 std::shared_ptr<ColorTable> ColorTable::Load(const std::string& filename)
 {
    logger_->debug("Loading color table: {}", filename);
@@ -343,6 +403,18 @@ ParseColor(const std::vector<std::string>& tokenList,
    return boost::gil::rgba8_pixel_t {r, g, b, a};
 }
 
+static boost::gil::rgba8_pixel_t
+Interpolate(const boost::gil::rgba8_pixel_t& color1,
+            const boost::gil::rgba8_pixel_t& color2,
+            float                            t)
+{
+   return boost::gil::rgba8_pixel_t {
+      RoundChannel<uint8_t>(std::lerp(color1[0], color2[0], t)),
+      RoundChannel<uint8_t>(std::lerp(color1[1], color2[1], t)),
+      RoundChannel<uint8_t>(std::lerp(color1[2], color2[2], t)),
+      RoundChannel<uint8_t>(std::lerp(color1[3], color2[3], t))};
+}
+
 template<typename T>
 T RoundChannel(double value)
 {
@@ -20,6 +20,13 @@ static const std::unordered_map<Level2Product, std::string> level2Name_ {
    {Level2Product::DifferentialPhase, "PHI"},
    {Level2Product::CorrelationCoefficient, "RHO"},
    {Level2Product::ClutterFilterPowerRemoved, "CFP"},
+   {Level2Product::DealiasedVelocity, "DVEL"},
+   {Level2Product::StormRelativeVelocity, "SRV"},
+   {Level2Product::CompositeReflectivity, "CREF"},
+   {Level2Product::EchoTops, "ETOP"},
+   {Level2Product::OneHourPrecipitation, "PRE1"},
+   {Level2Product::ThreeHourPrecipitation, "PRE3"},
+   {Level2Product::StormTotalPrecipitation, "PRET"},
    {Level2Product::Unknown, "?"}};
 
 static const std::unordered_map<Level2Product, std::string> level2Description_ {
@@ -30,6 +37,13 @@ static const std::unordered_map<Level2Product, std::string> level2Description_ {
    {Level2Product::DifferentialPhase, "Differential Phase"},
    {Level2Product::CorrelationCoefficient, "Correlation Coefficient"},
    {Level2Product::ClutterFilterPowerRemoved, "Clutter Filter Power Removed"},
+   {Level2Product::DealiasedVelocity, "Dealiased Velocity"},
+   {Level2Product::StormRelativeVelocity, "Storm Relative Velocity"},
+   {Level2Product::CompositeReflectivity, "Composite Reflectivity"},
+   {Level2Product::EchoTops, "Echo Tops"},
+   {Level2Product::OneHourPrecipitation, "One Hour Precipitation"},
+   {Level2Product::ThreeHourPrecipitation, "Three Hour Precipitation"},
+   {Level2Product::StormTotalPrecipitation, "Storm Total Precipitation"},
    {Level2Product::Unknown, "?"}};
 
 static const std::unordered_map<Level2Product, std::string> level2Palette_ {
@@ -40,6 +54,13 @@ static const std::unordered_map<Level2Product, std::string> level2Palette_ {
    {Level2Product::DifferentialPhase, "PHI2"},
    {Level2Product::CorrelationCoefficient, "CC"},
    {Level2Product::ClutterFilterPowerRemoved, "???"},
+   {Level2Product::DealiasedVelocity, "BV"},
+   {Level2Product::StormRelativeVelocity, "SRV"},
+   {Level2Product::CompositeReflectivity, "BR"},
+   {Level2Product::EchoTops, "ET"},
+   {Level2Product::OneHourPrecipitation, "OHP"},
+   {Level2Product::ThreeHourPrecipitation, "STP"},
+   {Level2Product::StormTotalPrecipitation, "STP"},
    {Level2Product::Unknown, "???"}};
 
 static const std::unordered_map<int, std::string> level3ProductCodeMap_ {
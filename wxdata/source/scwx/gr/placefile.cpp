@@ -14,11 +14,18 @@
 #include <scwx/util/streams.hpp>
 #include <scwx/util/strings.hpp>
 
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <type_traits>
 #include <unordered_map>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 
 #if (__cpp_lib_chrono < 201907L)
 #   include <date/date.h>
@@ -55,16 +62,18 @@ public:
       double y_ {};
    };
 
-   void ParseLocation(const std::string& latitudeToken,
-                      const std::string& longitudeToken,
-                      double&            latitude,
-                      double&            longitude,
-                      double&            x,
-                      double&            y);
+   void ParseLocation(std::string_view latitudeToken,
+                      std::string_view longitudeToken,
+                      double&          latitude,
+                      double&          longitude,
+                      double&          x,
+                      double&          y);
    void ProcessElement(const std::string& line);
    void ProcessElementEnd();
    void ProcessLine(const std::string& line);
 
+   static bool ParseDateTime(std::string_view                             s,
+                             std::chrono::sys_time<std::chrono::seconds>& time);
    static void ProcessEscapeCharacters(std::string& s);
    static void TrimQuotes(std::string& s);
 
@@ -90,6 +99,9 @@ public:
    std::unordered_map<std::size_t, std::shared_ptr<Font>>     fonts_ {};
 
    std::vector<std::shared_ptr<DrawItem>> drawItems_ {};
+
+   // Tokens of the line being parsed, reused between lines
+   std::vector<std::string_view> tokens_ {};
 };
 
 Placefile::Placefile() : p(std::make_unique<Impl>()) {}
@@ -152,6 +164,136 @@ std::shared_ptr<Placefile::Font> Placefile::font(std::size_t i)
    return nullptr;
 }
 
+static void HashCombine(std::size_t& seed, const boost::gil::rgba8_pixel_t& p)
+{
+   boost::hash_combine(seed, p[0]);
+   boost::hash_combine(seed, p[1]);
+   boost::hash_combine(seed, p[2]);
+   boost::hash_combine(seed, p[3]);
+}
+
+std::size_t Placefile::GetDrawItemHash(const DrawItem& di)
+{
+   std::size_t seed = 0;
+
+   boost::hash_combine(seed, static_cast<int>(di.itemType_));
+   boost::hash_combine(seed, di.threshold_.value());
+   boost::hash_combine(seed, di.startTime_.time_since_epoch().count());
+   boost::hash_combine(seed, di.endTime_.time_since_epoch().count());
+
+   switch (di.itemType_)
+   {
+   case ItemType::Icon:
+   {
+      auto& icon = static_cast<const IconDrawItem&>(di);
+      HashCombine(seed, icon.modulate_);
+      boost::hash_combine(seed, icon.latitude_);
+      boost::hash_combine(seed, icon.longitude_);
+      boost::hash_combine(seed, icon.x_);
+      boost::hash_combine(seed, icon.y_);
+      boost::hash_combine(seed, icon.angle_.value());
+      boost::hash_combine(seed, icon.fileNumber_);
+      boost::hash_combine(seed, icon.iconNumber_);
+      boost::hash_combine(seed, icon.hoverText_);
+      break;
+   }
+
+   case ItemType::Text:
+   {
+      auto& text = static_cast<const TextDrawItem&>(di);
+      HashCombine(seed, text.color_);
+      boost::hash_combine(seed, text.latitude_);
+      boost::hash_combine(seed, text.longitude_);
+      boost::hash_combine(seed, text.x_);
+      boost::hash_combine(seed, text.y_);
+      boost::hash_combine(seed, text.fontNumber_);
+      boost::hash_combine(seed, text.text_);
+      boost::hash_combine(seed, text.hoverText_);
+      break;
+   }
+
+   case ItemType::Line:
+   {
+      auto& line = static_cast<const LineDrawItem&>(di);
+      HashCombine(seed, line.color_);
+      boost::hash_combine(seed, line.width_);
+      boost::hash_combine(seed, line.flags_);
+      boost::hash_combine(seed, line.hoverText_);
+      for (auto& element : line.elements_)
+      {
+         boost::hash_combine(seed, element.latitude_);
+         boost::hash_combine(seed, element.longitude_);
+         boost::hash_combine(seed, element.x_);
+         boost::hash_combine(seed, element.y_);
+      }
+      break;
+   }
+
+   case ItemType::Triangles:
+   {
+      auto& triangles = static_cast<const TrianglesDrawItem&>(di);
+      HashCombine(seed, triangles.color_);
+      for (auto& element : triangles.elements_)
+      {
+         boost::hash_combine(seed, element.latitude_);
+         boost::hash_combine(seed, element.longitude_);
+         boost::hash_combine(seed, element.x_);
+         boost::hash_combine(seed, element.y_);
+         boost::hash_combine(seed, element.color_.has_value());
+         if (element.color_.has_value())
+         {
+            HashCombine(seed, *element.color_);
+         }
+      }
+      break;
+   }
+
+   case ItemType::Image:
+   {
+      auto& image = static_cast<const ImageDrawItem&>(di);
+      boost::hash_combine(seed, image.imageFile_);
+      for (auto& element : image.elements_)
+      {
+         boost::hash_combine(seed, element.latitude_);
+         boost::hash_combine(seed, element.longitude_);
+         boost::hash_combine(seed, element.x_);
+         boost::hash_combine(seed, element.y_);
+         boost::hash_combine(seed, element.tu_);
+         boost::hash_combine(seed, element.tv_);
+      }
+      break;
+   }
+
+   case ItemType::Polygon:
+   {
+      auto& polygon = static_cast<const PolygonDrawItem&>(di);
+      HashCombine(seed, polygon.color_);
+      for (auto& contour : polygon.contours_)
+      {
+         boost::hash_combine(seed, contour.size());
+         for (auto& element : contour)
+         {
+            boost::hash_combine(seed, element.latitude_);
+            boost::hash_combine(seed, element.longitude_);
+            boost::hash_combine(seed, element.x_);
+            boost::hash_combine(seed, element.y_);
+            boost::hash_combine(seed, element.color_.has_value());
+            if (element.color_.has_value())
+            {
+               HashCombine(seed, *element.color_);
+            }
+         }
+      }
+      break;
+   }
+
+   default:
+      break;
+   }
+
+   return seed;
+}
+
 std::shared_ptr<Placefile> Placefile::Load(const std::string& filename)
 {
    std::shared_ptr<Placefile> placefile = nullptr;
@@ -235,6 +377,517 @@ std::shared_ptr<Placefile> Placefile::Load(const std::string& name,
    return placefile;
 }
 
+// Compiled placefile header: magic, format version, and sizes of the native
+// types written, such that a file written by a different build is rejected
+static constexpr std::array<char, 8> kCompiledMagic_ {
+   'S', 'C', 'W', 'X', 'P', 'L', 'C', '\0'};
+static constexpr std::uint32_t kCompiledVersion_ = 1u;
+static constexpr std::uint32_t kCompiledTypeSizes_ =
+   (sizeof(std::size_t) << 16) | (sizeof(double) << 8) | sizeof(std::int64_t);
+
+class CompiledWriter
+{
+public:
+   explicit CompiledWriter(std::ostream& os) : os_ {os} {}
+
+   template<typename T>
+   void Write(const T& value)
+   {
+      static_assert(std::is_trivially_copyable_v<T>);
+      os_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+   }
+
+   void Write(const std::string& value)
+   {
+      Write(static_cast<std::uint64_t>(value.size()));
+      os_.write(value.data(), static_cast<std::streamsize>(value.size()));
+   }
+
+   void Write(const boost::gil::rgba8_pixel_t& color)
+   {
+      Write(
+         std::array<std::uint8_t, 4> {color[0], color[1], color[2], color[3]});
+   }
+
+   void Write(const std::optional<boost::gil::rgba8_pixel_t>& color)
+   {
+      Write(static_cast<std::uint8_t>(color.has_value()));
+      if (color.has_value())
+      {
+         Write(*color);
+      }
+   }
+
+private:
+   std::ostream& os_;
+};
+
+class CompiledReader
+{
+public:
+   explicit CompiledReader(const char* data, std::size_t size) :
+       data_ {data}, size_ {size}
+   {
+   }
+
+   template<typename T>
+   T Read()
+   {
+      static_assert(std::is_trivially_copyable_v<T>);
+      T value;
+      std::memcpy(&value, Advance(sizeof(T)), sizeof(T));
+      return value;
+   }
+
+   void Read(std::string& value)
+   {
+      const std::size_t size = ReadSize();
+      value.assign(Advance(size), size);
+   }
+
+   void Read(boost::gil::rgba8_pixel_t& color)
+   {
+      auto c = Read<std::array<std::uint8_t, 4>>();
+      color  = {c[0], c[1], c[2], c[3]};
+   }
+
+   void Read(std::optional<boost::gil::rgba8_pixel_t>& color)
+   {
+      if (Read<std::uint8_t>() != 0)
+      {
+         Read(color.emplace());
+      }
+   }
+
+   std::size_t ReadSize()
+   {
+      // Sizes never exceed the remaining data, as each element is at least
+      // one byte, guarding allocations against invalid files
+      const auto size = Read<std::uint64_t>();
+      if (size > size_ - offset_)
+      {
+         throw std::out_of_range("Invalid size");
+      }
+      return static_cast<std::size_t>(size);
+   }
+
+private:
+   const char* Advance(std::size_t size)
+   {
+      if (size > size_ - offset_)
+      {
+         throw std::out_of_range("Unexpected end of compiled placefile");
+      }
+      const char* data = data_ + offset_;
+      offset_ += size;
+      return data;
+   }
+
+   const char* data_;
+   std::size_t size_;
+   std::size_t offset_ {0u};
+};
+
+static void WriteDrawItem(CompiledWriter&             writer,
+                          const Placefile::DrawItem& di)
+{
+   writer.Write(di.itemType_);
+   writer.Write(di.threshold_.value());
+   writer.Write(di.startTime_.time_since_epoch().count());
+   writer.Write(di.endTime_.time_since_epoch().count());
+
+   switch (di.itemType_)
+   {
+   case Placefile::ItemType::Icon:
+   {
+      auto& icon = static_cast<const Placefile::IconDrawItem&>(di);
+      writer.Write(icon.modulate_);
+      writer.Write(icon.latitude_);
+      writer.Write(icon.longitude_);
+      writer.Write(icon.x_);
+      writer.Write(icon.y_);
+      writer.Write(icon.angle_.value());
+      writer.Write(icon.fileNumber_);
+      writer.Write(icon.iconNumber_);
+      writer.Write(icon.hoverText_);
+      break;
+   }
+
+   case Placefile::ItemType::Text:
+   {
+      auto& text = static_cast<const Placefile::TextDrawItem&>(di);
+      writer.Write(text.color_);
+      writer.Write(text.latitude_);
+      writer.Write(text.longitude_);
+      writer.Write(text.x_);
+      writer.Write(text.y_);
+      writer.Write(text.fontNumber_);
+      writer.Write(text.text_);
+      writer.Write(text.hoverText_);
+      break;
+   }
+
+   case Placefile::ItemType::Line:
+   {
+      auto& line = static_cast<const Placefile::LineDrawItem&>(di);
+      writer.Write(line.color_);
+      writer.Write(line.width_);
+      writer.Write(line.flags_);
+      writer.Write(line.hoverText_);
+      writer.Write(static_cast<std::uint64_t>(line.elements_.size()));
+      for (auto& element : line.elements_)
+      {
+         writer.Write(element);
+      }
+      break;
+   }
+
+   case Placefile::ItemType::Triangles:
+   {
+      auto& triangles = static_cast<const Placefile::TrianglesDrawItem&>(di);
+      writer.Write(triangles.color_);
+      writer.Write(static_cast<std::uint64_t>(triangles.elements_.size()));
+      for (auto& element : triangles.elements_)
+      {
+         writer.Write(element.latitude_);
+         writer.Write(element.longitude_);
+         writer.Write(element.x_);
+         writer.Write(element.y_);
+         writer.Write(element.color_);
+      }
+      break;
+   }
+
+   case Placefile::ItemType::Image:
+   {
+      auto& image = static_cast<const Placefile::ImageDrawItem&>(di);
+      writer.Write(image.imageFile_);
+      writer.Write(static_cast<std::uint64_t>(image.elements_.size()));
+      for (auto& element : image.elements_)
+      {
+         writer.Write(element);
+      }
+      break;
+   }
+
+   case Placefile::ItemType::Polygon:
+   {
+      auto& polygon = static_cast<const Placefile::PolygonDrawItem&>(di);
+      writer.Write(polygon.color_);
+      writer.Write(polygon.center_.latitude_);
+      writer.Write(polygon.center_.longitude_);
+      writer.Write(static_cast<std::uint64_t>(polygon.contours_.size()));
+      for (auto& contour : polygon.contours_)
+      {
+         writer.Write(static_cast<std::uint64_t>(contour.size()));
+         for (auto& element : contour)
+         {
+            writer.Write(element.latitude_);
+            writer.Write(element.longitude_);
+            writer.Write(element.x_);
+            writer.Write(element.y_);
+            writer.Write(element.color_);
+         }
+      }
+      break;
+   }
+
+   default:
+      break;
+   }
+}
+
+static std::shared_ptr<Placefile::DrawItem> ReadDrawItem(CompiledReader& reader)
+{
+   using seconds = std::chrono::seconds;
+
+   const auto itemType  = reader.Read<Placefile::ItemType>();
+   const auto threshold = reader.Read<double>();
+   const auto startTime = reader.Read<seconds::rep>();
+   const auto endTime   = reader.Read<seconds::rep>();
+
+   std::shared_ptr<Placefile::DrawItem> di {};
+
+   switch (itemType)
+   {
+   case Placefile::ItemType::Icon:
+   {
+      auto icon = std::make_shared<Placefile::IconDrawItem>();
+      reader.Read(icon->modulate_);
+      icon->latitude_   = reader.Read<double>();
+      icon->longitude_  = reader.Read<double>();
+      icon->x_          = reader.Read<double>();
+      icon->y_          = reader.Read<double>();
+      icon->angle_      = units::degrees<double> {reader.Read<double>()};
+      icon->fileNumber_ = reader.Read<std::size_t>();
+      icon->iconNumber_ = reader.Read<std::size_t>();
+      reader.Read(icon->hoverText_);
+      di = icon;
+      break;
+   }
+
+   case Placefile::ItemType::Text:
+   {
+      auto text = std::make_shared<Placefile::TextDrawItem>();
+      reader.Read(text->color_);
+      text->latitude_   = reader.Read<double>();
+      text->longitude_  = reader.Read<double>();
+      text->x_          = reader.Read<double>();
+      text->y_          = reader.Read<double>();
+      text->fontNumber_ = reader.Read<std::size_t>();
+      reader.Read(text->text_);
+      reader.Read(text->hoverText_);
+      di = text;
+      break;
+   }
+
+   case Placefile::ItemType::Line:
+   {
+      auto line = std::make_shared<Placefile::LineDrawItem>();
+      reader.Read(line->color_);
+      line->width_ = reader.Read<double>();
+      line->flags_ = reader.Read<std::int32_t>();
+      reader.Read(line->hoverText_);
+      line->elements_.resize(reader.ReadSize());
+      for (auto& element : line->elements_)
+      {
+         element = reader.Read<Placefile::LineDrawItem::Element>();
+      }
+      di = line;
+      break;
+   }
+
+   case Placefile::ItemType::Triangles:
+   {
+      auto triangles = std::make_shared<Placefile::TrianglesDrawItem>();
+      reader.Read(triangles->color_);
+      triangles->elements_.resize(reader.ReadSize());
+      for (auto& element : triangles->elements_)
+      {
+         element.latitude_  = reader.Read<double>();
+         element.longitude_ = reader.Read<double>();
+         element.x_         = reader.Read<double>();
+         element.y_         = reader.Read<double>();
+         reader.Read(element.color_);
+      }
+      di = triangles;
+      break;
+   }
+
+   case Placefile::ItemType::Image:
+   {
+      auto image = std::make_shared<Placefile::ImageDrawItem>();
+      reader.Read(image->imageFile_);
+      image->elements_.resize(reader.ReadSize());
+      for (auto& element : image->elements_)
+      {
+         element = reader.Read<Placefile::ImageDrawItem::Element>();
+      }
+      di = image;
+      break;
+   }
+
+   case Placefile::ItemType::Polygon:
+   {
+      auto polygon = std::make_shared<Placefile::PolygonDrawItem>();
+      reader.Read(polygon->color_);
+      polygon->center_.latitude_  = reader.Read<double>();
+      polygon->center_.longitude_ = reader.Read<double>();
+      polygon->contours_.resize(reader.ReadSize());
+      for (auto& contour : polygon->contours_)
+      {
+         contour.resize(reader.ReadSize());
+         for (auto& element : contour)
+         {
+            element.latitude_  = reader.Read<double>();
+            element.longitude_ = reader.Read<double>();
+            element.x_         = reader.Read<double>();
+            element.y_         = reader.Read<double>();
+            reader.Read(element.color_);
+         }
+      }
+      di = polygon;
+      break;
+   }
+
+   default:
+      throw std::invalid_argument("Invalid draw item type");
+   }
+
+   di->threshold_ = units::length::nautical_miles<double> {threshold};
+   di->startTime_ = std::chrono::sys_time<seconds> {seconds {startTime}};
+   di->endTime_   = std::chrono::sys_time<seconds> {seconds {endTime}};
+
+   return di;
+}
+
+bool Placefile::SaveCompiled(const std::string& filename,
+                             std::uint64_t      contentHash) const
+{
+   // Write to a temporary file, so an incomplete file is never loaded
+   const std::string tempFilename = filename + ".tmp";
+   std::error_code   error;
+
+   {
+      std::ofstream os {tempFilename,
+                        std::ios_base::out | std::ios_base::binary};
+      if (!os.is_open())
+      {
+         logger_->warn("Could not create compiled placefile: {}", filename);
+         return false;
+      }
+
+      CompiledWriter writer {os};
+
+      writer.Write(kCompiledMagic_);
+      writer.Write(kCompiledVersion_);
+      writer.Write(kCompiledTypeSizes_);
+      writer.Write(contentHash);
+
+      writer.Write(p->title_);
+      writer.Write(p->refresh_.count());
+
+      writer.Write(static_cast<std::uint64_t>(p->iconFiles_.size()));
+      for (auto& iconFile : p->iconFiles_)
+      {
+         writer.Write(iconFile.second->fileNumber_);
+         writer.Write(iconFile.second->iconWidth_);
+         writer.Write(iconFile.second->iconHeight_);
+         writer.Write(iconFile.second->hotX_);
+         writer.Write(iconFile.second->hotY_);
+         writer.Write(iconFile.second->filename_);
+      }
+
+      writer.Write(static_cast<std::uint64_t>(p->fonts_.size()));
+      for (auto& font : p->fonts_)
+      {
+         writer.Write(font.second->fontNumber_);
+         writer.Write(font.second->pixels_);
+         writer.Write(font.second->flags_);
+         writer.Write(font.second->face_);
+      }
+
+      writer.Write(static_cast<std::uint64_t>(p->drawItems_.size()));
+      for (auto& di : p->drawItems_)
+      {
+         WriteDrawItem(writer, *di);
+      }
+
+      if (!os.good())
+      {
+         logger_->warn("Could not write compiled placefile: {}", filename);
+         os.close();
+         std::filesystem::remove(tempFilename, error);
+         return false;
+      }
+   }
+
+   std::filesystem::rename(tempFilename, filename, error);
+   if (error)
+   {
+      logger_->warn("Could not save compiled placefile: {} ({})",
+                    filename,
+                    error.message());
+      std::filesystem::remove(tempFilename, error);
+      return false;
+   }
+
+   return true;
+}
+
+std::shared_ptr<Placefile> Placefile::LoadCompiled(const std::string& name,
+                                                   const std::string& filename,
+                                                   std::uint64_t contentHash)
+{
+   std::error_code error;
+   if (!std::filesystem::exists(filename, error))
+   {
+      return nullptr;
+   }
+
+   boost::iostreams::mapped_file_source file {};
+
+   try
+   {
+      file.open(filename);
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->warn("Could not map compiled placefile: {}", ex.what());
+      return nullptr;
+   }
+
+   if (!file.is_open())
+   {
+      return nullptr;
+   }
+
+   std::shared_ptr<Placefile> placefile = std::make_shared<Placefile>();
+   placefile->p->name_                  = name;
+
+   try
+   {
+      CompiledReader reader {file.data(), file.size()};
+
+      if (reader.Read<std::array<char, 8>>() != kCompiledMagic_ ||
+          reader.Read<std::uint32_t>() != kCompiledVersion_ ||
+          reader.Read<std::uint32_t>() != kCompiledTypeSizes_)
+      {
+         logger_->debug("Incompatible compiled placefile: {}", filename);
+         return nullptr;
+      }
+
+      if (reader.Read<std::uint64_t>() != contentHash)
+      {
+         // The placefile has changed since it was compiled
+         return nullptr;
+      }
+
+      reader.Read(placefile->p->title_);
+      placefile->p->refresh_ =
+         std::chrono::seconds {reader.Read<std::chrono::seconds::rep>()};
+
+      for (std::size_t i = reader.ReadSize(); i > 0; --i)
+      {
+         auto iconFile         = std::make_shared<IconFile>();
+         iconFile->fileNumber_ = reader.Read<std::size_t>();
+         iconFile->iconWidth_  = reader.Read<std::size_t>();
+         iconFile->iconHeight_ = reader.Read<std::size_t>();
+         iconFile->hotX_       = reader.Read<std::size_t>();
+         iconFile->hotY_       = reader.Read<std::size_t>();
+         reader.Read(iconFile->filename_);
+
+         placefile->p->iconFiles_.insert_or_assign(iconFile->fileNumber_,
+                                                   iconFile);
+      }
+
+      for (std::size_t i = reader.ReadSize(); i > 0; --i)
+      {
+         auto font         = std::make_shared<Font>();
+         font->fontNumber_ = reader.Read<std::size_t>();
+         font->pixels_     = reader.Read<std::size_t>();
+         font->flags_      = reader.Read<std::int32_t>();
+         reader.Read(font->face_);
+
+         placefile->p->fonts_.insert_or_assign(font->fontNumber_, font);
+      }
+
+      auto& drawItems = placefile->p->drawItems_;
+      drawItems.resize(reader.ReadSize());
+      for (auto& di : drawItems)
+      {
+         di = ReadDrawItem(reader);
+      }
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->warn("Invalid compiled placefile: {} ({})", filename, ex.what());
+      return nullptr;
+   }
+
+   return placefile;
+}
+
 void Placefile::Impl::ProcessLine(const std::string& line)
 {
    static const std::string titleKey_ {"Title:"};
@@ -272,42 +925,27 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, thresholdKey_))
    {
       // Threshold: nautical_miles
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, thresholdKey_.size());
+      util::ParseTokens(line, {" "}, tokens_, thresholdKey_.size());
 
-      if (tokenList.size() >= 1)
+      if (tokens_.size() >= 1)
       {
-         threshold_ =
-            units::length::nautical_miles<double>(std::stod(tokenList[0]));
+         threshold_ = units::length::nautical_miles<double>(
+            util::ParseNumeric<double>(tokens_[0]));
       }
    }
    else if (boost::istarts_with(line, timeRangeKey_))
    {
       // TimeRange: start_time end_time
       //   (YYYY-MM-DDThh:mm:ss)
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" ", " "}, timeRangeKey_.size());
+      util::ParseTokens(line, {" ", " "}, tokens_, timeRangeKey_.size());
 
-      if (tokenList.size() >= 2)
+      if (tokens_.size() >= 2)
       {
-         using namespace std::chrono;
-
-#if (__cpp_lib_chrono < 201907L)
-         using namespace date;
-#endif
-
-         static const std::string dateTimeFormat {"%Y-%m-%dT%H:%M:%S"};
-
-         std::istringstream ssStartTime {tokenList[0]};
-         std::istringstream ssEndTime {tokenList[1]};
-
-         std::chrono::sys_time<seconds> startTime;
-         std::chrono::sys_time<seconds> endTime;
-
-         ssStartTime >> parse(dateTimeFormat, startTime);
-         ssEndTime >> parse(dateTimeFormat, endTime);
+         std::chrono::sys_time<std::chrono::seconds> startTime;
+         std::chrono::sys_time<std::chrono::seconds> endTime;
 
-         if (!ssStartTime.fail() && !ssEndTime.fail())
+         if (ParseDateTime(tokens_[0], startTime) &&
+             ParseDateTime(tokens_[1], endTime))
          {
             startTime_ = startTime;
             endTime_   = endTime;
@@ -328,12 +966,11 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, hsluvKey_))
    {
       // HSLuv: value
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, hsluvKey_.size());
+      util::ParseTokens(line, {" "}, tokens_, hsluvKey_.size());
 
-      if (tokenList.size() >= 1)
+      if (tokens_.size() >= 1)
       {
-         if (boost::iequals(tokenList[0], "true"))
+         if (boost::iequals(tokens_[0], "true"))
          {
             colorMode_ = ColorMode::HSLuv;
          }
@@ -346,55 +983,53 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, colorKey_))
    {
       // Color: red green blue [alpha]
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" ", " ", " ", " "}, colorKey_.size());
+      util::ParseTokens(line, {" ", " ", " ", " "}, tokens_, colorKey_.size());
 
-      if (tokenList.size() >= 3)
+      if (tokens_.size() >= 3)
       {
-         color_ = ParseColor(tokenList, 0, colorMode_);
+         color_ = ParseColor(tokens_, 0, colorMode_);
       }
    }
    else if (boost::istarts_with(line, scwxModulateIconKey_))
    {
       // Supercell Wx Extension
       // scwx-ModulateIcon: red green blue [alpha]
-      std::vector<std::string> tokenList = util::ParseTokens(
-         line, {" ", " ", " ", " "}, scwxModulateIconKey_.size());
+      util::ParseTokens(
+         line, {" ", " ", " ", " "}, tokens_, scwxModulateIconKey_.size());
 
-      if (tokenList.size() >= 3)
+      if (tokens_.size() >= 3)
       {
-         iconModulate_ = ParseColor(tokenList, 0, colorMode_);
+         iconModulate_ = ParseColor(tokens_, 0, colorMode_);
       }
    }
    else if (boost::istarts_with(line, refreshKey_))
    {
       // Refresh: minutes
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, refreshKey_.size());
+      util::ParseTokens(line, {" "}, tokens_, refreshKey_.size());
 
-      if (tokenList.size() >= 1)
+      if (tokens_.size() >= 1)
       {
-         refresh_ = std::chrono::minutes {std::stoi(tokenList[0])};
+         refresh_ =
+            std::chrono::minutes {util::ParseNumeric<int>(tokens_[0])};
       }
    }
    else if (boost::istarts_with(line, refreshSecondsKey_))
    {
       // RefreshSeconds: seconds
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, refreshSecondsKey_.size());
+      util::ParseTokens(line, {" "}, tokens_, refreshSecondsKey_.size());
 
-      if (tokenList.size() >= 1)
+      if (tokens_.size() >= 1)
       {
-         refresh_ = std::chrono::seconds {std::stoi(tokenList[0])};
+         refresh_ =
+            std::chrono::seconds {util::ParseNumeric<int>(tokens_[0])};
       }
    }
    else if (boost::istarts_with(line, placeKey_))
    {
       // Place: latitude, longitude, string with spaces
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ","}, placeKey_.size());
+      util::ParseTokens(line, {",", ","}, tokens_, placeKey_.size());
 
-      if (tokenList.size() >= 3)
+      if (tokens_.size() >= 3)
       {
          std::shared_ptr<TextDrawItem> di = std::make_shared<TextDrawItem>();
 
@@ -403,15 +1038,15 @@ void Placefile::Impl::ProcessLine(const std::string& line)
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
 
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokens_[0],
+                       tokens_[1],
                        di->latitude_,
                        di->longitude_,
                        di->x_,
                        di->y_);
 
-         ProcessEscapeCharacters(tokenList[2]);
-         di->text_.swap(tokenList[2]);
+         di->text_ = tokens_[2];
+         ProcessEscapeCharacters(di->text_);
 
          drawItems_.emplace_back(std::move(di));
       }
@@ -423,21 +1058,21 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, iconFileKey_))
    {
       // IconFile: fileNumber, iconWidth, iconHeight, hotX, hotY, fileName
-      std::vector<std::string> tokenList = util::ParseTokens(
-         line, {",", ",", ",", ",", ","}, iconFileKey_.size());
+      util::ParseTokens(
+         line, {",", ",", ",", ",", ","}, tokens_, iconFileKey_.size());
 
-      if (tokenList.size() >= 6)
+      if (tokens_.size() >= 6)
       {
          std::shared_ptr<IconFile> iconFile = std::make_shared<IconFile>();
 
-         iconFile->fileNumber_ = std::stoul(tokenList[0]);
-         iconFile->iconWidth_  = std::stoul(tokenList[1]);
-         iconFile->iconHeight_ = std::stoul(tokenList[2]);
-         iconFile->hotX_       = std::stoul(tokenList[3]);
-         iconFile->hotY_       = std::stoul(tokenList[4]);
+         iconFile->fileNumber_ = util::ParseNumeric<std::size_t>(tokens_[0]);
+         iconFile->iconWidth_  = util::ParseNumeric<std::size_t>(tokens_[1]);
+         iconFile->iconHeight_ = util::ParseNumeric<std::size_t>(tokens_[2]);
+         iconFile->hotX_       = util::ParseNumeric<std::size_t>(tokens_[3]);
+         iconFile->hotY_       = util::ParseNumeric<std::size_t>(tokens_[4]);
 
-         TrimQuotes(tokenList[5]);
-         iconFile->filename_.swap(tokenList[5]);
+         iconFile->filename_ = tokens_[5];
+         TrimQuotes(iconFile->filename_);
 
          iconFiles_.insert_or_assign(iconFile->fileNumber_, iconFile);
       }
@@ -449,12 +1084,12 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, iconKey_))
    {
       // Icon: lat, lon, angle, fileNumber, iconNumber, hoverText
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ","}, iconKey_.size());
+      util::ParseTokens(
+         line, {",", ",", ",", ",", ","}, tokens_, iconKey_.size());
 
       std::shared_ptr<IconDrawItem> di = nullptr;
 
-      if (tokenList.size() >= 5)
+      if (tokens_.size() >= 5)
       {
          di = std::make_shared<IconDrawItem>();
 
@@ -463,23 +1098,24 @@ void Placefile::Impl::ProcessLine(const std::string& line)
          di->endTime_   = endTime_;
          di->modulate_  = iconModulate_;
 
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokens_[0],
+                       tokens_[1],
                        di->latitude_,
                        di->longitude_,
                        di->x_,
                        di->y_);
 
-         di->angle_ = units::angle::degrees<double>(std::stod(tokenList[2]));
+         di->angle_ = units::angle::degrees<double>(
+            util::ParseNumeric<double>(tokens_[2]));
 
-         di->fileNumber_ = std::stoul(tokenList[3]);
-         di->iconNumber_ = std::stoul(tokenList[4]);
+         di->fileNumber_ = util::ParseNumeric<std::size_t>(tokens_[3]);
+         di->iconNumber_ = util::ParseNumeric<std::size_t>(tokens_[4]);
       }
-      if (tokenList.size() >= 6)
+      if (tokens_.size() >= 6)
       {
-         ProcessEscapeCharacters(tokenList[5]);
-         TrimQuotes(tokenList[5]);
-         di->hoverText_.swap(tokenList[5]);
+         di->hoverText_ = tokens_[5];
+         ProcessEscapeCharacters(di->hoverText_);
+         TrimQuotes(di->hoverText_);
       }
 
       if (di != nullptr)
@@ -494,19 +1130,18 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, fontKey_))
    {
       // Font: fontNumber, pixels, flags, "face"
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ","}, fontKey_.size());
+      util::ParseTokens(line, {",", ",", ",", ","}, tokens_, fontKey_.size());
 
-      if (tokenList.size() >= 4)
+      if (tokens_.size() >= 4)
       {
          std::shared_ptr<Font> font = std::make_shared<Font>();
 
-         font->fontNumber_ = std::stoul(tokenList[0]);
-         font->pixels_     = std::stoul(tokenList[1]);
-         font->flags_      = std::stoi(tokenList[2]);
+         font->fontNumber_ = util::ParseNumeric<std::size_t>(tokens_[0]);
+         font->pixels_     = util::ParseNumeric<std::size_t>(tokens_[1]);
+         font->flags_      = util::ParseNumeric<int>(tokens_[2]);
 
-         TrimQuotes(tokenList[3]);
-         font->face_.swap(tokenList[3]);
+         font->face_ = tokens_[3];
+         TrimQuotes(font->face_);
 
          fonts_.insert_or_assign(font->fontNumber_, font);
       }
@@ -518,12 +1153,12 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    else if (boost::istarts_with(line, textKey_))
    {
       // Text: lat, lon, fontNumber, "string", "hover"
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ","}, textKey_.size());
+      util::ParseTokens(
+         line, {",", ",", ",", ",", ","}, tokens_, textKey_.size());
 
       std::shared_ptr<TextDrawItem> di = nullptr;
 
-      if (tokenList.size() >= 4)
+      if (tokens_.size() >= 4)
       {
          di = std::make_shared<TextDrawItem>();
 
@@ -532,24 +1167,24 @@ void Placefile::Impl::ProcessLine(const std::string& line)
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
 
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokens_[0],
+                       tokens_[1],
                        di->latitude_,
                        di->longitude_,
                        di->x_,
                        di->y_);
 
-         di->fontNumber_ = std::stoul(tokenList[2]);
+         di->fontNumber_ = util::ParseNumeric<std::size_t>(tokens_[2]);
 
-         ProcessEscapeCharacters(tokenList[3]);
-         TrimQuotes(tokenList[3]);
-         di->text_.swap(tokenList[3]);
+         di->text_ = tokens_[3];
+         ProcessEscapeCharacters(di->text_);
+         TrimQuotes(di->text_);
       }
-      if (tokenList.size() >= 5)
+      if (tokens_.size() >= 5)
       {
-         ProcessEscapeCharacters(tokenList[4]);
-         TrimQuotes(tokenList[4]);
-         di->hoverText_.swap(tokenList[4]);
+         di->hoverText_ = tokens_[4];
+         ProcessEscapeCharacters(di->hoverText_);
+         TrimQuotes(di->hoverText_);
       }
 
       if (di != nullptr)
@@ -566,16 +1201,15 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       // Object: lat, lon
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ","}, objectKey_.size());
+      util::ParseTokens(line, {",", ","}, tokens_, objectKey_.size());
 
       double latitude {};
       double longitude {};
 
-      if (tokenList.size() >= 2)
+      if (tokens_.size() >= 2)
       {
-         latitude  = std::stod(tokenList[0]);
-         longitude = std::stod(tokenList[1]);
+         latitude  = util::ParseNumeric<double>(tokens_[0]);
+         longitude = util::ParseNumeric<double>(tokens_[1]);
       }
       else
       {
@@ -598,14 +1232,13 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       //    lat, lon
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ","}, lineKey_.size());
+      util::ParseTokens(line, {",", ","}, tokens_, lineKey_.size());
 
       currentStatement_ = DrawingStatement::Line;
 
       std::shared_ptr<LineDrawItem> di = nullptr;
 
-      if (tokenList.size() >= 2)
+      if (tokens_.size() >= 2)
       {
          di = std::make_shared<LineDrawItem>();
 
@@ -614,18 +1247,20 @@ void Placefile::Impl::ProcessLine(const std::string& line)
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
 
-         di->width_ = std::stoul(tokenList[0]);
+         di->width_ =
+            static_cast<double>(util::ParseNumeric<std::size_t>(tokens_[0]));
 
-         if (!tokenList[1].empty())
+         if (!tokens_[1].empty())
          {
-            di->flags_ = std::stoul(tokenList[1]);
+            di->flags_ = static_cast<std::int32_t>(
+               util::ParseNumeric<std::size_t>(tokens_[1]));
          }
       }
-      if (tokenList.size() >= 3)
+      if (tokens_.size() >= 3)
       {
-         ProcessEscapeCharacters(tokenList[2]);
-         TrimQuotes(tokenList[2]);
-         di->hoverText_.swap(tokenList[2]);
+         di->hoverText_ = tokens_[2];
+         ProcessEscapeCharacters(di->hoverText_);
+         TrimQuotes(di->hoverText_);
       }
 
       if (di != nullptr)
@@ -663,14 +1298,13 @@ void Placefile::Impl::ProcessLine(const std::string& line)
       //    lat, lon, Tu [, Tv ]
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {" "}, imageKey_.size());
+      util::ParseTokens(line, {" "}, tokens_, imageKey_.size());
 
       currentStatement_ = DrawingStatement::Image;
 
       std::shared_ptr<ImageDrawItem> di = nullptr;
 
-      if (tokenList.size() >= 1)
+      if (tokens_.size() >= 1)
       {
          di = std::make_shared<ImageDrawItem>();
 
@@ -678,8 +1312,8 @@ void Placefile::Impl::ProcessLine(const std::string& line)
          di->startTime_ = startTime_;
          di->endTime_   = endTime_;
 
-         TrimQuotes(tokenList[0]);
-         di->imageFile_.swap(tokenList[0]);
+         di->imageFile_ = tokens_[0];
+         TrimQuotes(di->imageFile_);
 
          currentDrawItem_ = di;
          drawItems_.emplace_back(std::move(di));
@@ -715,7 +1349,7 @@ void Placefile::Impl::ProcessLine(const std::string& line)
    }
    else
    {
-      logger_->trace("Unknown statement: {}", line);
+      SPDLOG_LOGGER_TRACE(logger_, "Unknown statement: {}", line);
    }
 }
 
@@ -727,14 +1361,14 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    lat, lon
       //    ...
       // End:
-      std::vector<std::string> tokenList = util::ParseTokens(line, {",", ","});
+      util::ParseTokens(line, {",", ","}, tokens_);
 
-      if (tokenList.size() >= 2)
+      if (tokens_.size() >= 2)
       {
          LineDrawItem::Element element;
 
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokens_[0],
+                       tokens_[1],
                        element.latitude_,
                        element.longitude_,
                        element.x_,
@@ -754,20 +1388,19 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    lat, lon [, r, g, b [,a]]
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ",", ","});
+      util::ParseTokens(line, {",", ",", ",", ",", ",", ","}, tokens_);
 
       TrianglesDrawItem::Element element;
 
-      if (tokenList.size() >= 5)
+      if (tokens_.size() >= 5)
       {
-         element.color_ = ParseColor(tokenList, 2, colorMode_);
+         element.color_ = ParseColor(tokens_, 2, colorMode_);
       }
 
-      if (tokenList.size() >= 2)
+      if (tokens_.size() >= 2)
       {
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokens_[0],
+                       tokens_[1],
                        element.latitude_,
                        element.longitude_,
                        element.x_,
@@ -787,33 +1420,32 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    lat, lon, Tu [, Tv ]
       //    ...
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ","});
+      util::ParseTokens(line, {",", ",", ",", ","}, tokens_);
 
       ImageDrawItem::Element element;
 
-      if (tokenList.size() >= 3)
+      if (tokens_.size() >= 3)
       {
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokens_[0],
+                       tokens_[1],
                        element.latitude_,
                        element.longitude_,
                        element.x_,
                        element.y_);
 
-         element.tu_ = std::stod(tokenList[2]);
+         element.tu_ = util::ParseNumeric<double>(tokens_[2]);
       }
 
-      if (tokenList.size() >= 4)
+      if (tokens_.size() >= 4)
       {
-         element.tv_ = std::stod(tokenList[3]);
+         element.tv_ = util::ParseNumeric<double>(tokens_[3]);
       }
       else
       {
          element.tv_ = element.tu_;
       }
 
-      if (tokenList.size() >= 3)
+      if (tokens_.size() >= 3)
       {
          std::static_pointer_cast<ImageDrawItem>(currentDrawItem_)
             ->elements_.emplace_back(std::move(element));
@@ -835,20 +1467,19 @@ void Placefile::Impl::ProcessElement(const std::string& line)
       //    ...
       //    lat2, lon2                  ; and repeating it ends the contour
       // End:
-      std::vector<std::string> tokenList =
-         util::ParseTokens(line, {",", ",", ",", ",", ",", ","});
+      util::ParseTokens(line, {",", ",", ",", ",", ",", ","}, tokens_);
 
       PolygonDrawItem::Element element;
 
-      if (tokenList.size() >= 5)
+      if (tokens_.size() >= 5)
       {
-         element.color_ = ParseColor(tokenList, 2, colorMode_);
+         element.color_ = ParseColor(tokens_, 2, colorMode_);
       }
 
-      if (tokenList.size() >= 2)
+      if (tokens_.size() >= 2)
       {
-         ParseLocation(tokenList[0],
-                       tokenList[1],
+         ParseLocation(tokens_[0],
+                       tokens_[1],
                        element.latitude_,
                        element.longitude_,
                        element.x_,
@@ -915,19 +1546,19 @@ void Placefile::Impl::ProcessElementEnd()
    }
 }
 
-void Placefile::Impl::ParseLocation(const std::string& latitudeToken,
-                                    const std::string& longitudeToken,
-                                    double&            latitude,
-                                    double&            longitude,
-                                    double&            x,
-                                    double&            y)
+void Placefile::Impl::ParseLocation(std::string_view latitudeToken,
+                                    std::string_view longitudeToken,
+                                    double&          latitude,
+                                    double&          longitude,
+                                    double&          x,
+                                    double&          y)
 {
    if (objectStack_.empty())
    {
       // If an Object statement is not currently open, parse latitude and
       // longitude tokens as-is
-      latitude  = std::stod(latitudeToken);
-      longitude = std::stod(longitudeToken);
+      latitude  = util::ParseNumeric<double>(latitudeToken);
+      longitude = util::ParseNumeric<double>(longitudeToken);
    }
    else
    {
@@ -937,8 +1568,8 @@ void Placefile::Impl::ParseLocation(const std::string& latitudeToken,
       longitude = objectStack_[0].y_;
 
       // The latitude and longitude tokens are interpreted as x, y offsets
-      x = std::stod(latitudeToken);
-      y = std::stod(longitudeToken);
+      x = util::ParseNumeric<double>(latitudeToken);
+      y = util::ParseNumeric<double>(longitudeToken);
 
       // If there are inner Object statements open, treat these as x, y offsets
       for (std::size_t i = 1; i < objectStack_.size(); i++)
@@ -949,6 +1580,57 @@ void Placefile::Impl::ParseLocation(const std::string& latitudeToken,
    }
 }
 
+bool Placefile::Impl::ParseDateTime(
+   std::string_view s, std::chrono::sys_time<std::chrono::seconds>& time)
+{
+   using namespace std::chrono;
+
+#if (__cpp_lib_chrono < 201907L)
+   using namespace date;
+#endif
+
+   // YYYY-MM-DDThh:mm:ss
+   static constexpr std::array<char, 5> kSeparators_ {'-', '-', 'T', ':', ':'};
+
+   std::array<int, 6> fields {};
+   const char*        it  = s.data();
+   const char*        end = s.data() + s.size();
+
+   for (std::size_t i = 0; i < fields.size(); ++i)
+   {
+      if (i > 0)
+      {
+         if (it == end || *it != kSeparators_[i - 1])
+         {
+            return false;
+         }
+         ++it;
+      }
+
+      auto [ptr, ec] = std::from_chars(it, end, fields[i]);
+      if (ec != std::errc {} || fields[i] < 0)
+      {
+         return false;
+      }
+      it = ptr;
+   }
+
+   const year_month_day date {year {fields[0]},
+                              month {static_cast<unsigned>(fields[1])},
+                              day {static_cast<unsigned>(fields[2])}};
+
+   if (it != end || !date.ok() || fields[3] > 23 || fields[4] > 59 ||
+       fields[5] > 60)
+   {
+      return false;
+   }
+
+   time = sys_days {date} + hours {fields[3]} + minutes {fields[4]} +
+          seconds {fields[5]};
+
+   return true;
+}
+
 void Placefile::Impl::ProcessEscapeCharacters(std::string& s)
 {
    boost::replace_all(s, "\\r", "\r");
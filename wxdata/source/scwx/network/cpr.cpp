@@ -1,4 +1,14 @@
 #include <scwx/network/cpr.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <array>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <curl/curl.h>
 
 namespace scwx
 {
@@ -8,9 +18,52 @@ namespace cpr
 {
 
 static const std::string logPrefix_ = "scwx::network::cpr";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+// Maximum number of concurrent connections to a single host
+static constexpr std::size_t kMaxConnectionsPerHost_ = 6u;
 
 static ::cpr::Header header_ {};
 
+class SessionPool
+{
+public:
+   struct Host
+   {
+      std::vector<std::unique_ptr<::cpr::Session>> idleSessions_ {};
+      std::size_t                                  activeSessions_ {0u};
+   };
+
+   explicit SessionPool();
+   ~SessionPool();
+
+   SessionPool(const SessionPool&)            = delete;
+   SessionPool& operator=(const SessionPool&) = delete;
+
+   std::unique_ptr<::cpr::Session> Acquire(const std::string& host);
+   void Release(const std::string&              host,
+                std::unique_ptr<::cpr::Session> session);
+   void Share(::cpr::Session& session);
+
+   static SessionPool& Instance();
+
+private:
+   static void LockShare(CURL*            handle,
+                         curl_lock_data   data,
+                         curl_lock_access access,
+                         void*            userptr);
+   static void UnlockShare(CURL* handle, curl_lock_data data, void* userptr);
+
+   std::mutex                            mutex_ {};
+   std::condition_variable               condition_ {};
+   std::unordered_map<std::string, Host> hosts_ {};
+
+   // TLS sessions and DNS lookups are shared by all sessions. Connections are
+   // not, as libcurl does not support sharing connections between threads.
+   CURLSH*                                     share_ {nullptr};
+   std::array<std::mutex, CURL_LOCK_DATA_LAST> shareMutexes_ {};
+};
+
 ::cpr::Header GetHeader()
 {
    return header_;
@@ -21,6 +74,206 @@ void SetUserAgent(const std::string& userAgent)
    header_.insert_or_assign("User-Agent", userAgent);
 }
 
+::cpr::Response Get(const ::cpr::Url&        url,
+                    const ::cpr::Header&     header,
+                    const ::cpr::Parameters& parameters)
+{
+   SessionPool&      pool    = SessionPool::Instance();
+   const std::string host    = GetHost(url.str());
+   auto              session = pool.Acquire(host);
+
+   // Each option used by a pooled session is set for every request
+   session->SetUrl(url);
+   session->SetHeader(header);
+   session->SetParameters(parameters);
+
+   ::cpr::Response response = session->Get();
+
+   if (response.error.code == ::cpr::ErrorCode::OK)
+   {
+      pool.Release(host, std::move(session));
+   }
+   else
+   {
+      // Do not reuse a session which may hold a broken connection
+      pool.Release(host, nullptr);
+   }
+
+   return response;
+}
+
+::cpr::AsyncResponse GetAsync(const ::cpr::Url&        url,
+                              const ::cpr::Header&     header,
+                              const ::cpr::Parameters& parameters)
+{
+   return ::cpr::async([url, header, parameters]()
+                       { return Get(url, header, parameters); });
+}
+
+::cpr::Header ConditionalHeader(::cpr::Header     header,
+                                const Validators& validators)
+{
+   if (!validators.eTag_.empty())
+   {
+      header.insert_or_assign("If-None-Match", validators.eTag_);
+   }
+   if (!validators.lastModified_.empty())
+   {
+      header.insert_or_assign("If-Modified-Since", validators.lastModified_);
+   }
+
+   return header;
+}
+
+Validators GetValidators(const ::cpr::Response& response)
+{
+   Validators validators {};
+
+   // Header names are case insensitive
+   auto it = response.header.find("ETag");
+   if (it != response.header.cend())
+   {
+      validators.eTag_ = it->second;
+   }
+
+   it = response.header.find("Last-Modified");
+   if (it != response.header.cend())
+   {
+      validators.lastModified_ = it->second;
+   }
+
+   return validators;
+}
+
+std::string GetHost(const std::string& url)
+{
+   // Host includes the scheme and port, which each require a connection
+   const std::size_t schemeEnd = url.find("://");
+   const std::size_t hostBegin =
+      (schemeEnd == std::string::npos) ? 0u : schemeEnd + 3u;
+   const std::size_t hostEnd = url.find_first_of("/?#", hostBegin);
+
+   return url.substr(0, hostEnd);
+}
+
+void ConfigureSession(::cpr::Session& session)
+{
+   session.SetHttpVersion(
+      ::cpr::HttpVersion {::cpr::HttpVersionCode::VERSION_2_0_TLS});
+   SessionPool::Instance().Share(session);
+}
+
+SessionPool::SessionPool() : share_ {curl_share_init()}
+{
+   if (share_ != nullptr)
+   {
+      curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, &SessionPool::LockShare);
+      curl_share_setopt(
+         share_, CURLSHOPT_UNLOCKFUNC, &SessionPool::UnlockShare);
+      curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+      curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+      curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+   }
+   else
+   {
+      logger_->warn("Could not create shared connection data");
+   }
+}
+
+SessionPool::~SessionPool()
+{
+   // Sessions must be destroyed before the share they are attached to
+   hosts_.clear();
+
+   if (share_ != nullptr)
+   {
+      curl_share_cleanup(share_);
+   }
+}
+
+std::unique_ptr<::cpr::Session> SessionPool::Acquire(const std::string& host)
+{
+   std::unique_lock lock {mutex_};
+
+   Host& poolHost = hosts_[host];
+
+   // Wait for a connection to the host to become available
+   condition_.wait(
+      lock,
+      [&poolHost]()
+      { return poolHost.activeSessions_ < kMaxConnectionsPerHost_; });
+
+   ++poolHost.activeSessions_;
+
+   if (!poolHost.idleSessions_.empty())
+   {
+      auto session = std::move(poolHost.idleSessions_.back());
+      poolHost.idleSessions_.pop_back();
+      return session;
+   }
+
+   lock.unlock();
+
+   SPDLOG_LOGGER_TRACE(logger_, "Creating session: {}", host);
+
+   auto session = std::make_unique<::cpr::Session>();
+   session->SetSslOptions(::cpr::Ssl(::cpr::ssl::TLSv1_2 {}));
+   ConfigureSession(*session);
+
+   return session;
+}
+
+void SessionPool::Release(const std::string&              host,
+                          std::unique_ptr<::cpr::Session> session)
+{
+   {
+      std::unique_lock lock {mutex_};
+
+      Host& poolHost = hosts_[host];
+      --poolHost.activeSessions_;
+
+      if (session != nullptr)
+      {
+         poolHost.idleSessions_.push_back(std::move(session));
+      }
+   }
+
+   condition_.notify_all();
+}
+
+void SessionPool::Share(::cpr::Session& session)
+{
+   CURL* handle = session.GetCurlHolder()->handle;
+
+   if (share_ != nullptr)
+   {
+      curl_easy_setopt(handle, CURLOPT_SHARE, share_);
+   }
+
+   curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L);
+}
+
+void SessionPool::LockShare(CURL* /* handle */,
+                            curl_lock_data data,
+                            curl_lock_access /* access */,
+                            void*          userptr)
+{
+   static_cast<SessionPool*>(userptr)->shareMutexes_.at(data).lock();
+}
+
+void SessionPool::UnlockShare(CURL* /* handle */,
+                              curl_lock_data data,
+                              void*          userptr)
+{
+   static_cast<SessionPool*>(userptr)->shareMutexes_.at(data).unlock();
+}
+
+SessionPool& SessionPool::Instance()
+{
+   static SessionPool instance_ {};
+   return instance_;
+}
+
 } // namespace cpr
 } // namespace network
 } // namespace scwx
@@ -1,15 +1,17 @@
-#define LIBXML_HTML_ENABLED
-
 #include <scwx/network/dir_list.hpp>
+#include <scwx/network/cpr.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
 
 #if defined(_MSC_VER)
 #   pragma warning(push, 0)
 #endif
 
-#include <boost/algorithm/string/trim.hpp>
 #include <cpr/cpr.h>
-#include <libxml/HTMLparser.h>
 
 #if (__cpp_lib_chrono < 201907L)
 #   include <date/date.h>
@@ -27,26 +29,9 @@ namespace network
 static const std::string logPrefix_ = "scwx::network::dir_list";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
-static const cpr::SslOptions  kSslOptions_ = cpr::Ssl(cpr::ssl::TLSv1_2 {});
-static const cpr::HttpVersion kHttpVersion_ {
-   cpr::HttpVersionCode::VERSION_2_0_TLS};
-
-class DirListSAXHandler
-{
-public:
-   DirListSAXHandler() = delete;
-   static void StartDocument(void* userData);
-   static void EndDocument(void* userData);
-   static void
-   StartElement(void* userData, const xmlChar* name, const xmlChar** attrs);
-   static void EndElement(void* userData, const xmlChar* name);
-   static void Characters(void* userData, const xmlChar* ch, int len);
-   static void Warning(void* userData, const char* msg, ...);
-   static void Error(void* userData, const char* msg, ...);
-   static void Critical(void* userData, const char* msg, ...);
-};
+static constexpr std::string_view kWhitespace_ {" \t\r\n\f\v"};
 
-struct DirListSAXData
+struct DirListParseData
 {
    enum class State
    {
@@ -55,241 +40,441 @@ struct DirListSAXData
       UpdateLinkTimestamp,
       UpdateLinkSize
    };
-   State  state_ {State::FindingLink};
-   size_t warningCount_ {0u};
-   size_t errorCount_ {0u};
-   size_t criticalCount_ {0u};
+   State            state_ {State::FindingLink};
+   std::string_view previousLink_ {};
 
    std::vector<DirListRecord> records_;
 };
 
-// Unspecified fields are initialized to zero, ignore warning
-#if defined(__GNUC__)
-#   pragma GCC diagnostic push
-#   pragma GCC diagnostic ignored "-Wmissing-field-initializers"
-#endif
+static std::vector<DirListRecord>
+ParseResponse(const std::string&     baseUrl,
+              const ::cpr::Response& response,
+              const DirListFilter&   filter);
 
-static htmlSAXHandler saxHandler_ //
-   {.startElement = &DirListSAXHandler::StartElement,
-    .endElement   = &DirListSAXHandler::EndElement,
-    .characters   = &DirListSAXHandler::Characters,
-    .warning      = &DirListSAXHandler::Warning,
-    .error        = &DirListSAXHandler::Error,
-    .fatalError   = &DirListSAXHandler::Critical};
+static void ParseLink(DirListParseData&    data,
+                      std::string_view     attributes,
+                      const DirListFilter& filter);
+static void ParseText(DirListParseData& data, std::string_view text);
 
-#if defined(__GNUC__)
-#   pragma GCC diagnostic pop
-#endif
+static std::optional<std::string_view>
+FindAttribute(std::string_view attributes, std::string_view name);
+static std::optional<std::chrono::system_clock::time_point>
+ParseDateTime(std::string_view& text);
+static std::optional<std::size_t> ParseSize(std::string_view text);
+
+static bool EqualsIgnoreCase(std::string_view a, std::string_view b);
+static std::string_view TrimLeft(std::string_view text);
+static std::string_view Trim(std::string_view text);
 
 std::vector<DirListRecord> DirList(const std::string& baseUrl)
 {
-   using namespace std::chrono;
+   SPDLOG_LOGGER_TRACE(logger_, "DirList: {}", baseUrl);
 
-   logger_->trace("DirList: {}", baseUrl);
+   ::cpr::Response response = cpr::Get(::cpr::Url {baseUrl}, {});
 
-   cpr::Response response =
-      cpr::Get(cpr::Url {baseUrl}, kSslOptions_, kHttpVersion_);
-   DirListSAXData saxData {};
+   return ParseResponse(baseUrl, response, {});
+}
+
+std::optional<std::vector<DirListRecord>>
+DirList(const std::string&   baseUrl,
+        cpr::Validators&     validators,
+        const DirListFilter& filter)
+{
+   SPDLOG_LOGGER_TRACE(logger_, "DirList: {}", baseUrl);
 
-   if (response.status_code != cpr::status::HTTP_OK)
+   ::cpr::Response response = cpr::Get(::cpr::Url {baseUrl},
+                                        cpr::ConditionalHeader({}, validators));
+
+   if (response.status_code == ::cpr::status::HTTP_NOT_MODIFIED)
+   {
+      SPDLOG_LOGGER_TRACE(logger_,
+                          "Directory listing not modified: {}",
+                          baseUrl);
+      return std::nullopt;
+   }
+
+   if (response.status_code == ::cpr::status::HTTP_OK)
+   {
+      validators = cpr::GetValidators(response);
+   }
+
+   return ParseResponse(baseUrl, response, filter);
+}
+
+static std::vector<DirListRecord>
+ParseResponse(const std::string&     baseUrl,
+              const ::cpr::Response& response,
+              const DirListFilter&   filter)
+{
+   if (response.status_code != ::cpr::status::HTTP_OK)
    {
       logger_->warn("Bad response from {}: {} ({})",
                     baseUrl,
                     response.error.message,
                     response.status_code);
+
+      util::Metrics::Add(util::Metric::RefreshFailures, baseUrl);
+
+      return {};
    }
-   else
+
+   util::Metrics::Add(util::Metric::DownloadBytes,
+                      baseUrl,
+                      static_cast<double>(response.text.size()));
+
+   return ParseDirList(response.text, filter);
+}
+
+std::vector<DirListRecord> ParseDirList(std::string_view     html,
+                                        const DirListFilter& filter)
+{
+   DirListParseData data {};
+
+   std::size_t pos = 0;
+   while (pos < html.size())
    {
-      htmlParserCtxtPtr ctxt = htmlNewSAXParserCtxt(&saxHandler_, &saxData);
-      htmlDocPtr        doc  = nullptr;
+      // Characters up to the next tag
+      const std::size_t tagBegin = html.find('<', pos);
+      if (tagBegin != pos)
+      {
+         ParseText(data, html.substr(pos, tagBegin - pos));
+      }
+      if (tagBegin == std::string_view::npos)
+      {
+         break;
+      }
 
-      if (ctxt != nullptr)
+      // Skip comments, which may contain tags
+      if (html.substr(tagBegin).starts_with("<!--"))
       {
-         doc = htmlCtxtReadDoc(
-            ctxt,
-            reinterpret_cast<const xmlChar*>(response.text.c_str()),
-            baseUrl.c_str(),
-            nullptr,
-            HTML_PARSE_NONET);
-         htmlFreeParserCtxt(ctxt);
+         const std::size_t commentEnd = html.find("-->", tagBegin + 4);
+         pos = (commentEnd != std::string_view::npos) ? commentEnd + 3 :
+                                                        html.size();
+         continue;
       }
 
-      if (doc != nullptr)
+      const std::size_t tagEnd = html.find('>', tagBegin);
+      if (tagEnd == std::string_view::npos)
       {
-         xmlFreeDoc(doc);
+         break;
       }
-   }
 
-   return saxData.records_;
-}
+      std::string_view tag = html.substr(tagBegin + 1, tagEnd - tagBegin - 1);
+      pos                  = tagEnd + 1;
 
-void DirListSAXHandler::StartElement(void*           userData,
-                                     const xmlChar*  name,
-                                     const xmlChar** attrs)
-{
-   logger_->trace("SAX: Start Element: {}",
-                  reinterpret_cast<const char*>(name));
+      const bool endTag = tag.starts_with('/');
+      if (endTag)
+      {
+         tag.remove_prefix(1);
+      }
 
-   DirListSAXData* data = reinterpret_cast<DirListSAXData*>(userData);
+      const std::size_t      nameEnd = tag.find_first_of(kWhitespace_);
+      const std::string_view name    = tag.substr(0, nameEnd);
 
-   if (strcmp(reinterpret_cast<const char*>(name), "a") == 0)
-   {
-      // If an "a" element is found, search for an "href" attribute
-      for (int i = 0; attrs != nullptr && attrs[i] != nullptr; ++i)
+      // Only links are of interest, all other elements are skipped
+      if (!EqualsIgnoreCase(name, "a"))
       {
-         if (i > 0 &&
-             strcmp(reinterpret_cast<const char*>(attrs[i - 1]), "href") == 0)
-         {
-            // If the "href" attribute is found, treat this as a new file
-            std::string filename {reinterpret_cast<const char*>(attrs[i])};
-            std::filesystem::file_type fileType;
-
-            // Determine if the file is a directory
-            if (filename.ends_with("/"))
-            {
-               filename.pop_back();
-               fileType = std::filesystem::file_type::directory;
-            }
-            else
-            {
-               fileType = std::filesystem::file_type::regular;
-            }
+         continue;
+      }
 
-            // If the filename is valid, add it as a record
-            if (filename.size() > 0 && !filename.starts_with("?") &&
-                // And the filename is not a duplicate of the previous record
-                (data->records_.size() == 0 ||
-                 data->records_.back().filename_ != filename))
-            {
-               data->records_.emplace_back(filename, fileType);
-               data->state_ = DirListSAXData::State::FoundLink;
-               break;
-            }
+      if (endTag)
+      {
+         if (data.state_ == DirListParseData::State::FoundLink)
+         {
+            // The "a" element is closed, so begin looking for the timestamp
+            data.state_ = DirListParseData::State::UpdateLinkTimestamp;
          }
       }
+      else if (nameEnd != std::string_view::npos)
+      {
+         ParseLink(data, tag.substr(nameEnd), filter);
+      }
    }
-   for (int i = 0; attrs != nullptr && attrs[i] != nullptr; ++i)
-   {
-      logger_->trace("     Attribute: {}",
-                     reinterpret_cast<const char*>(attrs[i]));
-   }
+
+   return std::move(data.records_);
 }
 
-void DirListSAXHandler::EndElement(void* userData, const xmlChar* name)
+static void ParseLink(DirListParseData&    data,
+                      std::string_view     attributes,
+                      const DirListFilter& filter)
 {
-   logger_->trace("SAX: End Element: {}", reinterpret_cast<const char*>(name));
+   // If an "a" element is found, search for an "href" attribute
+   auto href = FindAttribute(attributes, "href");
+   if (!href.has_value())
+   {
+      return;
+   }
 
-   DirListSAXData* data = reinterpret_cast<DirListSAXData*>(userData);
+   // If the "href" attribute is found, treat this as a new file
+   std::string_view           filename = *href;
+   std::filesystem::file_type fileType;
 
-   if (data->state_ == DirListSAXData::State::FoundLink &&
-       strcmp(reinterpret_cast<const char*>(name), "a") == 0)
+   // Determine if the file is a directory
+   if (filename.ends_with('/'))
    {
-      // The "a" element is closed, so begin looking for the timestamp
-      data->state_ = DirListSAXData::State::UpdateLinkTimestamp;
+      filename.remove_suffix(1);
+      fileType = std::filesystem::file_type::directory;
+   }
+   else
+   {
+      fileType = std::filesystem::file_type::regular;
    }
-}
 
-void DirListSAXHandler::Characters(void* userData, const xmlChar* ch, int len)
-{
-   std::string characters(reinterpret_cast<const char*>(ch), len);
-   logger_->trace("SAX: Characters: {}", characters);
+   // The filename must be valid, and not a duplicate of the previous link
+   if (filename.empty() || filename.starts_with('?') ||
+       filename == data.previousLink_)
+   {
+      return;
+   }
 
-   DirListSAXData* data = reinterpret_cast<DirListSAXData*>(userData);
+   data.previousLink_ = filename;
 
-   if (data->state_ == DirListSAXData::State::UpdateLinkTimestamp)
+   if (filter && !filter(filename))
    {
-      using namespace std::chrono;
-
-#if (__cpp_lib_chrono < 201907L)
-      using namespace date;
-#endif
+      // Skip the fields of a filtered link
+      data.state_ = DirListParseData::State::FindingLink;
+      return;
+   }
 
-      // Date time format: yyyy-mm-dd hh:mm
-      static const std::string kDateTimeFormat {"%Y-%m-%d %H:%M"};
+   data.records_.emplace_back(std::string {filename}, fileType);
+   data.state_ = DirListParseData::State::FoundLink;
+}
 
+static void ParseText(DirListParseData& data, std::string_view text)
+{
+   if (data.state_ == DirListParseData::State::UpdateLinkTimestamp)
+   {
       // Attempt to parse the date time
-      std::istringstream             ssCharacters {characters};
-      std::chrono::sys_time<minutes> mtime;
-      ssCharacters >> parse(kDateTimeFormat, mtime);
+      auto mtime = ParseDateTime(text);
 
-      if (!ssCharacters.fail())
+      if (mtime.has_value())
       {
          // Date time parsing succeeded, look for link size
-         auto& record  = data->records_.back();
-         record.mtime_ = mtime;
+         auto& record  = data.records_.back();
+         record.mtime_ = *mtime;
 
          if (record.type_ == std::filesystem::file_type::directory)
          {
             // If the record is a directory, there is no size, skip to next link
-            data->state_ = DirListSAXData::State::FindingLink;
+            data.state_ = DirListParseData::State::FindingLink;
          }
          else
          {
-            // After the time is parsed, get the file size
-            data->state_ = DirListSAXData::State::UpdateLinkSize;
+            // After the time is parsed, get the file size, which follows in
+            // the same text in the preformatted layout
+            data.state_ = DirListParseData::State::UpdateLinkSize;
          }
       }
    }
-   else if (data->state_ == DirListSAXData::State::UpdateLinkSize)
-   {
-      // Trim the file size string
-      std::string fileSizeString {characters};
-      boost::trim(fileSizeString);
 
-      size_t fileSize   = 0u;
-      size_t multiplier = 1u;
+   if (data.state_ == DirListParseData::State::UpdateLinkSize)
+   {
+      auto fileSize = ParseSize(Trim(text));
 
-      // Look for size suffix
-      if (fileSizeString.ends_with("K"))
+      if (fileSize.has_value())
       {
-         fileSizeString.pop_back();
-         multiplier = 1024u;
+         data.records_.back().size_ = *fileSize;
+
+         // Look for the next link
+         data.state_ = DirListParseData::State::FindingLink;
       }
-      else if (fileSizeString.ends_with("M"))
+   }
+}
+
+static std::optional<std::string_view>
+FindAttribute(std::string_view attributes, std::string_view name)
+{
+   while (!(attributes = TrimLeft(attributes)).empty())
+   {
+      // Attribute name, optionally followed by a value
+      const std::size_t nameEnd = attributes.find_first_of("= \t\r\n\f\v");
+      const std::string_view attributeName = attributes.substr(0, nameEnd);
+      attributes.remove_prefix(attributeName.size());
+      attributes = TrimLeft(attributes);
+
+      std::string_view value {};
+
+      if (attributes.starts_with('='))
       {
-         fileSizeString.pop_back();
-         multiplier = 1024u * 1024u;
+         attributes = TrimLeft(attributes.substr(1));
+
+         if (attributes.starts_with('"') || attributes.starts_with('\''))
+         {
+            // Quoted value
+            const std::size_t valueEnd = attributes.find(attributes[0], 1);
+            if (valueEnd != std::string_view::npos)
+            {
+               value = attributes.substr(1, valueEnd - 1);
+               attributes.remove_prefix(valueEnd + 1);
+            }
+            else
+            {
+               value      = attributes.substr(1);
+               attributes = {};
+            }
+         }
+         else
+         {
+            // Unquoted value
+            const std::size_t valueEnd =
+               attributes.find_first_of(kWhitespace_);
+            value = attributes.substr(0, valueEnd);
+            attributes.remove_prefix(value.size());
+         }
       }
-      else if (fileSizeString.ends_with("G"))
+
+      if (EqualsIgnoreCase(attributeName, name))
       {
-         fileSizeString.pop_back();
-         multiplier = 1024u * 1024u * 1024u;
+         return value;
       }
-      else if (fileSizeString.ends_with("T"))
+
+      if (attributeName.empty() && value.empty())
       {
-         fileSizeString.pop_back();
-         multiplier = 1024ull * 1024ull * 1024ull * 1024ull;
+         // Malformed attribute, stop searching
+         break;
       }
+   }
+
+   return std::nullopt;
+}
+
+static std::optional<std::chrono::system_clock::time_point>
+ParseDateTime(std::string_view& text)
+{
+   using namespace std::chrono;
+
+#if (__cpp_lib_chrono < 201907L)
+   using namespace date;
+#endif
+
+   // Date time format: yyyy-mm-dd hh:mm
+   static constexpr std::string_view kDateTimeFormat {"0000-00-00 00:00"};
 
-      try
+   const std::string_view dateTime = TrimLeft(text);
+   if (dateTime.size() < kDateTimeFormat.size())
+   {
+      return std::nullopt;
+   }
+
+   // Digits and separators must match the format
+   for (std::size_t i = 0; i < kDateTimeFormat.size(); ++i)
+   {
+      const bool isDigit =
+         std::isdigit(static_cast<unsigned char>(dateTime[i])) != 0;
+      if ((kDateTimeFormat[i] == '0') ? !isDigit :
+                                        dateTime[i] != kDateTimeFormat[i])
       {
-         // Parse the remaining file size string, and multiply by the suffix
-         fileSize = static_cast<size_t>(std::stod(fileSizeString) * multiplier);
-         data->records_.back().size_ = fileSize;
+         return std::nullopt;
+      }
+   }
 
-         // Look for the next link
-         data->state_ = DirListSAXData::State::FindingLink;
+   auto field = [&dateTime](std::size_t offset, std::size_t length)
+   {
+      int value = 0;
+      std::from_chars(
+         dateTime.data() + offset, dateTime.data() + offset + length, value);
+      return value;
+   };
+
+   const year_month_day ymd {year {field(0, 4)},
+                             month {static_cast<unsigned>(field(5, 2))},
+                             day {static_cast<unsigned>(field(8, 2))}};
+   const int            hour   = field(11, 2);
+   const int            minute = field(14, 2);
+
+   if (!ymd.ok() || hour > 23 || minute > 59)
+   {
+      return std::nullopt;
+   }
+
+   text = dateTime.substr(kDateTimeFormat.size());
+
+   return sys_days {ymd} + hours {hour} + minutes {minute};
+}
+
+static std::optional<std::size_t> ParseSize(std::string_view text)
+{
+   const char* it  = text.data();
+   const char* end = text.data() + text.size();
+
+   // Whole number of units
+   std::size_t whole = 0u;
+   auto [ptr, ec]    = std::from_chars(it, end, whole);
+   if (ec != std::errc {})
+   {
+      // This is something other than a file size
+      return std::nullopt;
+   }
+
+   double fileSize = static_cast<double>(whole);
+
+   // Fractional number of units
+   if (ptr != end && *ptr == '.')
+   {
+      double place = 0.1;
+      for (++ptr; ptr != end && std::isdigit(static_cast<unsigned char>(*ptr));
+           ++ptr)
+      {
+         fileSize += (*ptr - '0') * place;
+         place *= 0.1;
       }
-      catch (const std::exception&)
+   }
+
+   // Look for size suffix
+   if (ptr != end)
+   {
+      switch (*ptr++)
       {
-         // This was something other than a file size
+      case 'K':
+         fileSize *= 1024.0;
+         break;
+      case 'M':
+         fileSize *= 1024.0 * 1024.0;
+         break;
+      case 'G':
+         fileSize *= 1024.0 * 1024.0 * 1024.0;
+         break;
+      case 'T':
+         fileSize *= 1024.0 * 1024.0 * 1024.0 * 1024.0;
+         break;
+      default:
+         return std::nullopt;
       }
    }
+
+   if (ptr != end)
+   {
+      return std::nullopt;
+   }
+
+   return static_cast<std::size_t>(fileSize);
 }
 
-void DirListSAXHandler::Warning(void* /* userData */, const char* msg, ...)
+static bool EqualsIgnoreCase(std::string_view a, std::string_view b)
 {
-   logger_->warn("SAX: {}", msg);
+   return a.size() == b.size() &&
+          std::equal(a.cbegin(),
+                     a.cend(),
+                     b.cbegin(),
+                     [](char ca, char cb)
+                     {
+                        return std::tolower(static_cast<unsigned char>(ca)) ==
+                               std::tolower(static_cast<unsigned char>(cb));
+                     });
 }
 
-void DirListSAXHandler::Error(void* /* userData */, const char* msg, ...)
+static std::string_view TrimLeft(std::string_view text)
 {
-   logger_->error("SAX: {}", msg);
+   const std::size_t begin = text.find_first_not_of(kWhitespace_);
+   return (begin != std::string_view::npos) ? text.substr(begin) :
+                                              std::string_view {};
 }
 
-void DirListSAXHandler::Critical(void* /* userData */, const char* msg, ...)
+static std::string_view Trim(std::string_view text)
 {
-   logger_->critical("SAX: {}", msg);
+   text                  = TrimLeft(text);
+   const std::size_t end = text.find_last_not_of(kWhitespace_);
+   return text.substr(0, (end != std::string_view::npos) ? end + 1 : 0);
 }
 
 } // namespace network
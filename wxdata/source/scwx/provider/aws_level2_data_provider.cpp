@@ -1,6 +1,24 @@
 #include <scwx/provider/aws_level2_data_provider.hpp>
+#include <scwx/provider/object_cache.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
+#include <scwx/util/vectorbuf.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/nexrad_file_factory.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+#if defined(_WIN32)
+#   include <WinSock2.h>
+#else
+#   include <arpa/inet.h>
+#endif
 
 #include <fmt/chrono.h>
 #include <fmt/format.h>
@@ -21,6 +39,12 @@ static const auto logger_ = util::Logger::Create(logPrefix_);
 static const std::string kDefaultBucketName_ = "noaa-nexrad-level2";
 static const std::string kDefaultRegion_     = "us-east-1";
 
+// Size of the Archive II Volume Header Record
+static constexpr std::size_t kVolumeHeaderSize_ = 24u;
+
+// Size of the control word preceding each LDM record
+static constexpr std::size_t kControlWordSize_ = 4u;
+
 class AwsLevel2DataProvider::Impl
 {
 public:
@@ -28,6 +52,41 @@ public:
 
    ~Impl() {}
 
+   static std::vector<Endpoint>
+   GetEndpoints(const std::vector<Endpoint>& mirrors);
+
+   // Decodes an Archive II volume incrementally, as its records are received
+   class VolumeDecoder
+   {
+   public:
+      enum class Status
+      {
+         Decoding,
+         Unsupported,
+         Error
+      };
+
+      /**
+       * Decodes the records received since the previous call.
+       *
+       * @param object Object data received so far
+       * @param objectComplete Whether the entire object has been received
+       * @param callback Called after additional records are decoded
+       */
+      Status Decode(std::vector<char>&         object,
+                    bool                       objectComplete,
+                    const RangeLoadedCallback& callback);
+
+      std::shared_ptr<wsr88d::Ar2vFile> ar2vFile_ {
+         std::make_shared<wsr88d::Ar2vFile>()};
+      std::size_t decodedSize_ {0};
+      bool        headerLoaded_ {false};
+   };
+
+   static std::size_t FindRecordsEnd(const std::vector<char>& data,
+                                     std::size_t              offset,
+                                     std::size_t              maxRecords);
+
    std::string radarSite_;
 };
 
@@ -42,6 +101,12 @@ AwsLevel2DataProvider::AwsLevel2DataProvider(const std::string& radarSite,
     p(std::make_unique<Impl>(radarSite))
 {
 }
+AwsLevel2DataProvider::AwsLevel2DataProvider(
+   const std::string& radarSite, const std::vector<Endpoint>& mirrors) :
+    AwsNexradDataProvider(radarSite, Impl::GetEndpoints(mirrors)),
+    p(std::make_unique<Impl>(radarSite))
+{
+}
 AwsLevel2DataProvider::~AwsLevel2DataProvider() = default;
 
 AwsLevel2DataProvider::AwsLevel2DataProvider(AwsLevel2DataProvider&&) noexcept =
@@ -105,5 +170,273 @@ AwsLevel2DataProvider::GetTimePointFromKey(const std::string& key)
    return time;
 }
 
+std::shared_ptr<wsr88d::NexradFile>
+AwsLevel2DataProvider::LoadObjectByKey(const std::string& key)
+{
+   ObjectCache&      objectCache = ObjectCache::Instance();
+   const std::string cacheKey    = ObjectCacheKey(key);
+
+   // Volumes compressed as a whole (prior to 2008) cannot be decoded until
+   // they are completely downloaded, and cached volumes need no download
+   if (key.ends_with(".gz") || objectCache.Contains(cacheKey))
+   {
+      return AwsNexradDataProvider::LoadObjectByKey(key);
+   }
+
+   // Records are decoded on this thread while the remainder of the object is
+   // downloaded
+   std::mutex              mutex {};
+   std::condition_variable cv {};
+   std::vector<char>       received {};
+   bool                    downloadComplete = false;
+
+   std::optional<std::string> eTag {};
+
+   std::thread downloadThread {
+      [&]()
+      {
+         eTag = DownloadObjectStreamed(
+            key,
+            [&](const char* data, std::size_t size)
+            {
+               {
+                  std::unique_lock lock {mutex};
+                  received.insert(received.end(), data, data + size);
+               }
+               cv.notify_one();
+            });
+
+         {
+            std::unique_lock lock {mutex};
+            downloadComplete = true;
+         }
+         cv.notify_one();
+      }};
+
+   Impl::VolumeDecoder decoder {};
+   std::vector<char>   object {};
+   auto                status = Impl::VolumeDecoder::Status::Decoding;
+   bool                objectComplete = false;
+
+   while (!objectComplete)
+   {
+      {
+         std::unique_lock lock {mutex};
+         cv.wait(lock, [&]() { return !received.empty() || downloadComplete; });
+
+         object.insert(object.end(), received.cbegin(), received.cend());
+         received.clear();
+         objectComplete = downloadComplete;
+      }
+
+      if (status == Impl::VolumeDecoder::Status::Decoding)
+      {
+         // Continue receiving the object if it could not be decoded, so it
+         // can still be loaded by the file factory
+         status = decoder.Decode(object, objectComplete, nullptr);
+      }
+   }
+
+   downloadThread.join();
+
+   if (!eTag.has_value())
+   {
+      // Either the download failed, or the data was not usable
+      return AwsNexradDataProvider::LoadObjectByKey(key);
+   }
+
+   std::shared_ptr<wsr88d::NexradFile> nexradFile = nullptr;
+
+   if (status == Impl::VolumeDecoder::Status::Decoding)
+   {
+      logger_->debug("Loaded object while downloading: {}", key);
+      nexradFile = decoder.ar2vFile_;
+   }
+   else
+   {
+      util::vectorbuf vb {object};
+      std::istream    is {&vb};
+
+      nexradFile = wsr88d::NexradFileFactory::Create(is);
+   }
+
+   if (nexradFile != nullptr)
+   {
+      objectCache.Put(cacheKey, eTag.value(), object);
+   }
+
+   return nexradFile;
+}
+
+std::shared_ptr<wsr88d::NexradFile>
+AwsLevel2DataProvider::LoadObjectByKeyRanged(
+   const std::string&         key,
+   std::size_t                rangeSize,
+   const RangeLoadedCallback& callback,
+   const CancelledCallback&   cancelled)
+{
+   ObjectCache&      objectCache = ObjectCache::Instance();
+   const std::string cacheKey    = ObjectCacheKey(key);
+
+   // Volumes compressed as a whole (prior to 2008) cannot be decoded until
+   // they are completely downloaded, and cached volumes need no download
+   if (rangeSize == 0 || key.ends_with(".gz") || objectCache.Contains(cacheKey))
+   {
+      return NexradDataProvider::LoadObjectByKeyRanged(
+         key, rangeSize, callback, cancelled);
+   }
+
+   Impl::VolumeDecoder decoder {};
+   std::vector<char>   object {};
+   std::string         eTag {};
+   std::size_t         objectSize = std::numeric_limits<std::size_t>::max();
+
+   while (object.size() < objectSize)
+   {
+      if (cancelled != nullptr && cancelled())
+      {
+         logger_->debug("Ranged load cancelled: {}", key);
+         return nullptr;
+      }
+
+      auto range = DownloadObjectRange(key, object.size(), rangeSize);
+
+      if (!range.has_value() || range->data_->empty())
+      {
+         return nullptr;
+      }
+
+      if (!eTag.empty() && range->eTag_ != eTag)
+      {
+         logger_->warn("Object changed during ranged download: {}", key);
+         return nullptr;
+      }
+
+      eTag       = range->eTag_;
+      objectSize = range->objectSize_;
+      object.insert(object.end(), range->data_->cbegin(), range->data_->cend());
+
+      switch (decoder.Decode(object, object.size() >= objectSize, callback))
+      {
+      case Impl::VolumeDecoder::Status::Unsupported:
+         // Not an Archive II volume with compressed LDM records
+         logger_->debug("Loading object without ranges: {}", key);
+         return NexradDataProvider::LoadObjectByKeyRanged(
+            key, 0u, callback, cancelled);
+
+      case Impl::VolumeDecoder::Status::Error:
+         logger_->warn("Could not decode volume: {}", key);
+         return nullptr;
+
+      default:
+         break;
+      }
+   }
+
+   logger_->debug("Loaded object in ranges: {} ({} bytes)", key, objectSize);
+
+   objectCache.Put(cacheKey, eTag, object);
+
+   return decoder.ar2vFile_;
+}
+
+AwsLevel2DataProvider::Impl::VolumeDecoder::Status
+AwsLevel2DataProvider::Impl::VolumeDecoder::Decode(
+   std::vector<char>&         object,
+   bool                       objectComplete,
+   const RangeLoadedCallback& callback)
+{
+   if (!headerLoaded_)
+   {
+      // The Volume Header Record and the metadata record must be complete
+      // before the volume can be started
+      const std::size_t headerEnd =
+         FindRecordsEnd(object, kVolumeHeaderSize_, 1u);
+
+      if (headerEnd == 0)
+      {
+         return objectComplete ? Status::Error : Status::Decoding;
+      }
+
+      if (std::strncmp(object.data(), "AR2V", 4) != 0)
+      {
+         return Status::Unsupported;
+      }
+
+      util::vectorbuf vb {object};
+      vb.update_read_pointers(headerEnd);
+      std::istream is {&vb};
+
+      if (!ar2vFile_->LoadHeader(is))
+      {
+         return Status::Error;
+      }
+
+      headerLoaded_ = true;
+      decodedSize_  = headerEnd;
+   }
+
+   // Decode each LDM record which has been completely received
+   const std::size_t recordsEnd = FindRecordsEnd(
+      object, decodedSize_, std::numeric_limits<std::size_t>::max());
+
+   if (recordsEnd > decodedSize_)
+   {
+      util::vectorbuf vb {object};
+      vb.update_read_pointers(recordsEnd);
+      std::istream is {&vb};
+      is.seekg(static_cast<std::streamoff>(decodedSize_));
+
+      ar2vFile_->LoadLDMRecords(is, !objectComplete);
+      decodedSize_ = recordsEnd;
+
+      if (callback != nullptr)
+      {
+         callback(ar2vFile_);
+      }
+   }
+
+   return Status::Decoding;
+}
+
+std::vector<AwsNexradDataProvider::Endpoint>
+AwsLevel2DataProvider::Impl::GetEndpoints(const std::vector<Endpoint>& mirrors)
+{
+   std::vector<Endpoint> endpoints {{kDefaultBucketName_, kDefaultRegion_}};
+   endpoints.insert(endpoints.end(), mirrors.cbegin(), mirrors.cend());
+   return endpoints;
+}
+
+std::size_t
+AwsLevel2DataProvider::Impl::FindRecordsEnd(const std::vector<char>& data,
+                                            std::size_t              offset,
+                                            std::size_t              maxRecords)
+{
+   std::size_t recordsEnd  = 0;
+   std::size_t recordCount = 0;
+
+   while (recordCount < maxRecords && offset + kControlWordSize_ <= data.size())
+   {
+      std::int32_t controlWord = 0;
+      std::memcpy(&controlWord, data.data() + offset, kControlWordSize_);
+
+      const std::size_t recordSize =
+         static_cast<std::size_t>(std::abs(static_cast<std::int32_t>(
+            ntohl(static_cast<std::uint32_t>(controlWord)))));
+
+      if (recordSize == 0 ||
+          offset + kControlWordSize_ + recordSize > data.size())
+      {
+         break;
+      }
+
+      offset += kControlWordSize_ + recordSize;
+      recordsEnd = offset;
+      ++recordCount;
+   }
+
+   return recordsEnd;
+}
+
 } // namespace provider
 } // namespace scwx
@@ -47,6 +47,9 @@ public:
    }
    ~Impl() = default;
 
+   static std::vector<Endpoint>
+   GetEndpoints(const std::vector<Endpoint>& mirrors);
+
    void ListProducts();
 
    AwsLevel3DataProvider* self_;
@@ -71,6 +74,14 @@ AwsLevel3DataProvider::AwsLevel3DataProvider(const std::string& radarSite,
     p(std::make_unique<Impl>(this, radarSite, product, bucketName))
 {
 }
+AwsLevel3DataProvider::AwsLevel3DataProvider(
+   const std::string&           radarSite,
+   const std::string&           product,
+   const std::vector<Endpoint>& mirrors) :
+    AwsNexradDataProvider(radarSite, Impl::GetEndpoints(mirrors)),
+    p(std::make_unique<Impl>(this, radarSite, product, kDefaultBucketName_))
+{
+}
 AwsLevel3DataProvider::~AwsLevel3DataProvider() = default;
 
 AwsLevel3DataProvider::AwsLevel3DataProvider(AwsLevel3DataProvider&&) noexcept =
@@ -151,6 +162,14 @@ std::vector<std::string> AwsLevel3DataProvider::GetAvailableProducts()
    return {};
 }
 
+std::vector<AwsNexradDataProvider::Endpoint>
+AwsLevel3DataProvider::Impl::GetEndpoints(const std::vector<Endpoint>& mirrors)
+{
+   std::vector<Endpoint> endpoints {{kDefaultBucketName_, kDefaultRegion_}};
+   endpoints.insert(endpoints.end(), mirrors.cbegin(), mirrors.cend());
+   return endpoints;
+}
+
 void AwsLevel3DataProvider::Impl::ListProducts()
 {
    std::shared_lock readLock(productMutex_);
@@ -1,15 +1,30 @@
 #define _SILENCE_STDEXT_ARR_ITERS_DEPRECATION_WARNING
 
 #include <scwx/provider/aws_nexrad_data_provider.hpp>
+#include <scwx/provider/object_cache.hpp>
 #include <scwx/util/environment.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/map.hpp>
+#include <scwx/util/metrics.hpp>
+#include <scwx/util/profiler.hpp>
 #include <scwx/util/time.hpp>
+#include <scwx/util/vectorbuf.hpp>
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <future>
+#include <iterator>
+#include <numeric>
+#include <set>
 #include <shared_mutex>
+#include <sstream>
+#include <streambuf>
 
 #include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
 #include <aws/s3/S3Client.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/ListObjectsV2Request.h>
@@ -29,6 +44,61 @@ static const auto logger_ = util::Logger::Create(logPrefix_);
 static const size_t kMinDatesBeforePruning_ = 6;
 static const size_t kMaxObjects_            = 2500;
 
+// Number of recent update intervals used to determine the update period
+static const size_t kUpdateIntervals_ = 6;
+
+// Suffix of object cache keys holding the listing of a prefix
+static const std::string kListingSuffix_ {"#listing"};
+
+// Minimum time before a date which failed to list is listed again
+static constexpr std::chrono::seconds kListRetryInterval_ {30};
+
+// Minimum time before an endpoint which could not be reached is preferred
+static constexpr std::chrono::seconds kEndpointRetryInterval_ {60};
+
+// Passes data written to a stream to a callback, without buffering
+class CallbackStreambuf : public std::streambuf
+{
+public:
+   explicit CallbackStreambuf(
+      const std::function<void(const char*, std::size_t)>& callback) :
+       callback_ {callback}
+   {
+   }
+
+   std::size_t bytes() const { return bytes_; }
+
+protected:
+   int_type overflow(int_type c) override
+   {
+      if (!traits_type::eq_int_type(c, traits_type::eof()))
+      {
+         const char ch = traits_type::to_char_type(c);
+         callback_(&ch, 1u);
+         ++bytes_;
+      }
+      return traits_type::not_eof(c);
+   }
+
+   std::streamsize xsputn(const char* s, std::streamsize n) override
+   {
+      callback_(s, static_cast<std::size_t>(n));
+      bytes_ += static_cast<std::size_t>(n);
+      return n;
+   }
+
+private:
+   const std::function<void(const char*, std::size_t)>& callback_;
+   std::size_t                                          bytes_ {0u};
+};
+
+static Aws::S3::Model::GetObjectOutcome
+GetS3Object(const Aws::S3::S3Client&                client,
+            const Aws::S3::Model::GetObjectRequest& request)
+{
+   return client.GetObject(request);
+}
+
 class AwsNexradDataProvider::Impl
 {
 public:
@@ -46,13 +116,22 @@ public:
       std::chrono::system_clock::time_point lastModified_;
    };
 
-   explicit Impl(const std::string& radarSite,
-                 const std::string& bucketName,
-                 const std::string& region) :
+   struct EndpointClient
+   {
+      Endpoint                           endpoint_;
+      std::shared_ptr<Aws::S3::S3Client> client_;
+
+      // Protected by endpointMutex_
+      std::chrono::steady_clock::duration   latency_ {};
+      std::chrono::steady_clock::time_point lastFailure_ {};
+      bool                                  failed_ {false};
+   };
+
+   explicit Impl(const std::string&           radarSite,
+                 const std::vector<Endpoint>& endpoints) :
        radarSite_ {radarSite},
-       bucketName_ {bucketName},
-       region_ {region},
-       client_ {nullptr},
+       bucketName_ {endpoints.at(0).bucketName_},
+       endpoints_ {},
        objects_ {},
        objectsMutex_ {},
        objectDates_ {},
@@ -67,28 +146,56 @@ public:
       // Use anonymous credentials
       Aws::Auth::AWSCredentials credentials {};
 
-      Aws::Client::ClientConfiguration config;
-      config.region           = region_;
-      config.connectTimeoutMs = 10000;
+      for (auto& endpoint : endpoints)
+      {
+         Aws::Client::ClientConfiguration config;
+         config.region           = endpoint.region_;
+         config.connectTimeoutMs = 10000;
+
+         if (!endpoint.endpointOverride_.empty())
+         {
+            config.endpointOverride = endpoint.endpointOverride_;
+         }
+
+         auto client = std::make_shared<Aws::S3::S3Client>(
+            credentials,
+            Aws::MakeShared<Aws::S3::S3EndpointProvider>(
+               Aws::S3::S3Client::GetAllocationTag()),
+            config);
 
-      client_ = std::make_shared<Aws::S3::S3Client>(
-         credentials,
-         Aws::MakeShared<Aws::S3::S3EndpointProvider>(
-            Aws::S3::S3Client::GetAllocationTag()),
-         config);
+         endpoints_.push_back({endpoint, std::move(client)});
+      }
    }
 
    ~Impl() {}
 
+   template<typename Request, typename Function>
+   auto Execute(Request& request, Function&& function, bool measureLatency);
+
+   std::vector<std::size_t> EndpointOrder();
+
+   void
+   UpdateEndpoint(std::size_t                                        index,
+                  bool                                               success,
+                  std::optional<std::chrono::steady_clock::duration> latency);
+
+   typedef std::vector<
+      std::pair<std::string, std::chrono::system_clock::time_point>>
+      ObjectListing;
+
+   bool IsDateListed(std::chrono::system_clock::time_point day);
    void PruneObjects();
+   bool ReadCachedListing(const std::string& prefix, ObjectListing& listing);
    void UpdateMetadata();
    void UpdateObjectDates(std::chrono::system_clock::time_point date);
+   void WriteCachedListing(const std::string&   prefix,
+                           const ObjectListing& listing);
 
    std::string radarSite_;
    std::string bucketName_;
-   std::string region_;
 
-   std::shared_ptr<Aws::S3::S3Client> client_;
+   std::vector<EndpointClient> endpoints_;
+   std::mutex                  endpointMutex_ {};
 
    std::map<std::chrono::system_clock::time_point, ObjectRecord> objects_;
    std::shared_mutex                                             objectsMutex_;
@@ -97,14 +204,68 @@ public:
    std::mutex                            refreshMutex_;
    std::chrono::system_clock::time_point refreshDate_;
 
+   // Dates being listed, and the time of the last failed listing of a date.
+   // Concurrent queries for a date which is not cached wait for one listing.
+   std::mutex                                      listMutex_ {};
+   std::condition_variable                         listCondition_ {};
+   std::set<std::chrono::system_clock::time_point> listingDates_ {};
+   std::map<std::chrono::system_clock::time_point,
+            std::chrono::steady_clock::time_point>
+      listFailures_ {};
+
    std::chrono::system_clock::time_point lastModified_;
    std::chrono::seconds                  updatePeriod_;
 };
 
+template<typename Request, typename Function>
+auto AwsNexradDataProvider::Impl::Execute(Request&   request,
+                                          Function&& function,
+                                          bool       measureLatency)
+{
+   decltype(function(*endpoints_.front().client_, request)) outcome {};
+
+   for (std::size_t index : EndpointOrder())
+   {
+      auto& endpoint = endpoints_[index];
+      request.SetBucket(endpoint.endpoint_.bucketName_);
+
+      const auto start = std::chrono::steady_clock::now();
+      outcome          = function(*endpoint.client_, request);
+      const auto end   = std::chrono::steady_clock::now();
+
+      // Errors such as a missing object are not resolved by another endpoint
+      if (outcome.IsSuccess() || !outcome.GetError().ShouldRetry())
+      {
+         UpdateEndpoint(index,
+                        true,
+                        measureLatency ? std::optional {end - start} :
+                                         std::nullopt);
+         break;
+      }
+
+      UpdateEndpoint(index, false, std::nullopt);
+
+      if (endpoints_.size() > 1)
+      {
+         logger_->warn("Endpoint unavailable: {}, {}",
+                       endpoint.endpoint_.bucketName_,
+                       outcome.GetError().GetMessage());
+      }
+   }
+
+   return outcome;
+}
+
 AwsNexradDataProvider::AwsNexradDataProvider(const std::string& radarSite,
                                              const std::string& bucketName,
                                              const std::string& region) :
-    p(std::make_unique<Impl>(radarSite, bucketName, region))
+    AwsNexradDataProvider(
+       radarSite, std::vector<Endpoint> {{bucketName, region}})
+{
+}
+AwsNexradDataProvider::AwsNexradDataProvider(
+   const std::string& radarSite, const std::vector<Endpoint>& endpoints) :
+    p(std::make_unique<Impl>(radarSite, endpoints))
 {
 }
 AwsNexradDataProvider::~AwsNexradDataProvider() = default;
@@ -121,7 +282,7 @@ size_t AwsNexradDataProvider::cache_size() const
 
 std::shared_ptr<Aws::S3::S3Client> AwsNexradDataProvider::client()
 {
-   return p->client_;
+   return p->endpoints_.front().client_;
 }
 
 std::chrono::seconds AwsNexradDataProvider::update_period() const
@@ -178,7 +339,9 @@ AwsNexradDataProvider::GetTimePointsByDate(
 
    std::vector<std::chrono::system_clock::time_point> timePoints {};
 
-   logger_->trace("GetTimePointsByDate: {}", util::TimeString(date));
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "GetTimePointsByDate: {}",
+                       util::TimeString(date));
 
    std::shared_lock lock(p->objectsMutex_);
 
@@ -191,13 +354,54 @@ AwsNexradDataProvider::GetTimePointsByDate(
       // Temporarily unlock mutex
       lock.unlock();
 
-      // List objects, since the date is not present in the date list
-      auto [success, newObjects, totalObjects] = ListObjects(date);
-      if (success)
+      // Dates in the future have no objects
+      const bool future =
+         day > std::chrono::floor<std::chrono::days>(
+                  std::chrono::system_clock::now());
+
+      // Wait for any listing of the date already in progress
+      std::unique_lock listLock {p->listMutex_};
+      p->listCondition_.wait(listLock,
+                             [&]() { return !p->listingDates_.contains(day); });
+
+      // Failed listings are retried after an interval
+      auto failure = p->listFailures_.find(day);
+
+      const bool retry =
+         failure == p->listFailures_.cend() ||
+         std::chrono::steady_clock::now() - failure->second >=
+            kListRetryInterval_;
+
+      if (!future && retry && !p->IsDateListed(day))
       {
-         p->UpdateObjectDates(date);
+         p->listingDates_.insert(day);
+         listLock.unlock();
+
+         // List objects, since the date is not present in the date list
+         auto [success, newObjects, totalObjects] = ListObjects(date);
+         if (success)
+         {
+            p->UpdateObjectDates(date);
+         }
+
+         listLock.lock();
+         p->listingDates_.erase(day);
+
+         if (success)
+         {
+            p->listFailures_.erase(day);
+         }
+         else
+         {
+            p->listFailures_.insert_or_assign(day,
+                                              std::chrono::steady_clock::now());
+         }
+
+         p->listCondition_.notify_all();
       }
 
+      listLock.unlock();
+
       // Re-lock mutex
       lock.lock();
 
@@ -234,71 +438,112 @@ AwsNexradDataProvider::GetTimePointsByDate(
 std::tuple<bool, size_t, size_t>
 AwsNexradDataProvider::ListObjects(std::chrono::system_clock::time_point date)
 {
+   using namespace std::chrono;
+
    const std::string prefix {GetPrefix(date)};
 
-   logger_->debug("ListObjects: {}", prefix);
+   // Objects are no longer added to dates before yesterday, so their listings
+   // are kept in the object cache
+   const bool complete =
+      floor<days>(date) < floor<days>(system_clock::now()) - days {1};
+
+   Impl::ObjectListing listing {};
+   bool                success = false;
+
+   if (complete && p->ReadCachedListing(prefix, listing))
+   {
+      logger_->debug("ListObjects: {} (cached)", prefix);
+      success = true;
+   }
+   else
+   {
+      logger_->debug("ListObjects: {}", prefix);
 
-   Aws::S3::Model::ListObjectsV2Request request;
-   request.SetBucket(p->bucketName_);
-   request.SetPrefix(prefix);
+      Aws::S3::Model::ListObjectsV2Request request;
+      request.SetPrefix(prefix);
 
-   auto outcome = p->client_->ListObjectsV2(request);
+      // Listings of more than 1000 objects are returned in pages
+      bool truncated = true;
 
-   size_t newObjects   = 0;
-   size_t totalObjects = 0;
+      while (truncated)
+      {
+         auto outcome = p->Execute(
+            request,
+            [](const Aws::S3::S3Client&                    client,
+               const Aws::S3::Model::ListObjectsV2Request& request)
+            { return client.ListObjectsV2(request); },
+            true);
+
+         if (!outcome.IsSuccess())
+         {
+            logger_->warn("Could not list objects: {}",
+                          outcome.GetError().GetMessage());
+            util::Metrics::Add(util::Metric::RefreshFailures, p->bucketName_);
+            break;
+         }
 
-   if (outcome.IsSuccess())
-   {
-      auto& objects = outcome.GetResult().GetContents();
+         auto& result  = outcome.GetResult();
+         auto& objects = result.GetContents();
 
-      logger_->debug("Found {} objects", objects.size());
+         logger_->debug("Found {} objects", objects.size());
 
-      // Store objects
-      std::for_each( //
-         objects.cbegin(),
-         objects.cend(),
-         [&](const Aws::S3::Model::Object& object)
+         for (auto& object : objects)
          {
             std::string key = object.GetKey();
 
             if (key.find("NWS_NEXRAD_") == std::string::npos &&
                 !key.ends_with("_MDM"))
             {
-               auto time = GetTimePointByKey(key);
-
-               std::chrono::seconds lastModifiedSeconds {
+               const seconds lastModifiedSeconds {
                   object.GetLastModified().Seconds()};
-               std::chrono::system_clock::time_point lastModified {
-                  lastModifiedSeconds};
 
-               std::unique_lock lock(p->objectsMutex_);
+               listing.emplace_back(std::move(key),
+                                    system_clock::time_point {
+                                       lastModifiedSeconds});
+            }
+         }
 
-               auto [it, inserted] = p->objects_.insert_or_assign(
-                  time, Impl::ObjectRecord {key, lastModified});
+         truncated = result.GetIsTruncated();
+         request.SetContinuationToken(result.GetNextContinuationToken());
+      }
 
-               if (inserted)
-               {
-                  newObjects++;
-               }
+      success = !truncated;
 
-               totalObjects++;
-            }
-         });
+      if (complete && success)
+      {
+         p->WriteCachedListing(prefix, listing);
+      }
+   }
+
+   size_t newObjects   = 0;
+   size_t totalObjects = 0;
+
+   // Store objects
+   for (auto& [key, lastModified] : listing)
+   {
+      auto time = GetTimePointByKey(key);
 
-      if (newObjects > 0)
+      std::unique_lock lock(p->objectsMutex_);
+
+      auto [it, inserted] = p->objects_.insert_or_assign(
+         time, Impl::ObjectRecord {key, lastModified});
+
+      if (inserted)
       {
-         p->UpdateObjectDates(date);
-         p->PruneObjects();
-         p->UpdateMetadata();
+         newObjects++;
       }
+
+      totalObjects++;
    }
-   else
+
+   if (newObjects > 0)
    {
-      logger_->warn("Could not list objects: {}",
-                    outcome.GetError().GetMessage());
+      p->UpdateObjectDates(date);
+      p->PruneObjects();
+      p->UpdateMetadata();
    }
 
-   return {outcome.IsSuccess(), newObjects, totalObjects};
+   return {success, newObjects, totalObjects};
 }
 
 std::shared_ptr<wsr88d::NexradFile>
@@ -306,17 +551,87 @@ AwsNexradDataProvider::LoadObjectByKey(const std::string& key)
 {
    std::shared_ptr<wsr88d::NexradFile> nexradFile = nullptr;
 
+   auto data = DownloadObjectByKey(key);
+
+   if (data != nullptr)
+   {
+      util::vectorbuf vb {*data};
+      std::istream    is {&vb};
+
+      nexradFile = wsr88d::NexradFileFactory::Create(is);
+   }
+
+   return nexradFile;
+}
+
+std::shared_ptr<std::vector<char>>
+AwsNexradDataProvider::DownloadObjectByKey(const std::string&       key,
+                                           const CancelledCallback& cancelled)
+{
+   std::shared_ptr<std::vector<char>> data = nullptr;
+
+   ObjectCache&      objectCache = ObjectCache::Instance();
+   const std::string cacheKey    = ObjectCacheKey(key);
+   auto              cached      = objectCache.Get(cacheKey);
+
    Aws::S3::Model::GetObjectRequest request;
-   request.SetBucket(p->bucketName_);
    request.SetKey(key);
 
-   auto outcome = p->client_->GetObject(request);
+   if (cached.has_value() && !cached->eTag_.empty())
+   {
+      // Only download the object if it has changed since it was cached
+      request.SetIfNoneMatch(cached->eTag_);
+   }
+
+   if (cancelled != nullptr)
+   {
+      // The transfer is aborted once the object is no longer required
+      request.SetContinueRequestHandler(
+         [&cancelled](const Aws::Http::HttpRequest*) { return !cancelled(); });
+   }
+
+   util::ScopedTimer timer {util::ProfileStage::Download};
+
+   auto outcome = p->Execute(request, GetS3Object, false);
+
+   if (cancelled != nullptr && cancelled())
+   {
+      logger_->debug("Object download cancelled: {}", key);
+      return nullptr;
+   }
 
    if (outcome.IsSuccess())
    {
-      auto& body = outcome.GetResultWithOwnership().GetBody();
+      auto       result        = outcome.GetResultWithOwnership();
+      auto&      body          = result.GetBody();
+      const auto contentLength = result.GetContentLength();
 
-      nexradFile = wsr88d::NexradFileFactory::Create(body);
+      data = std::make_shared<std::vector<char>>();
+      if (contentLength > 0)
+      {
+         data->reserve(static_cast<std::size_t>(contentLength));
+      }
+
+      data->assign(std::istreambuf_iterator<char>(body),
+                   std::istreambuf_iterator<char>());
+
+      util::Metrics::Add(util::Metric::DownloadBytes,
+                         p->bucketName_,
+                         static_cast<double>(data->size()));
+
+      objectCache.Put(cacheKey, result.GetETag(), *data);
+   }
+   else if (cached.has_value())
+   {
+      if (outcome.GetError().GetResponseCode() !=
+          Aws::Http::HttpResponseCode::NOT_MODIFIED)
+      {
+         // Archived objects do not change, the cached object is still usable
+         logger_->warn("Could not revalidate object, using cached copy: {}",
+                       outcome.GetError().GetMessage());
+      }
+
+      data = cached->data_;
    }
    else
    {
@@ -324,7 +639,149 @@ AwsNexradDataProvider::LoadObjectByKey(const std::string& key)
                     outcome.GetError().GetMessage());
    }
 
-   return nexradFile;
+   return data;
+}
+
+std::optional<AwsNexradDataProvider::ObjectRange>
+AwsNexradDataProvider::DownloadObjectRange(const std::string& key,
+                                           std::size_t        offset,
+                                           std::size_t        length)
+{
+   if (length == 0)
+   {
+      return std::nullopt;
+   }
+
+   Aws::S3::Model::GetObjectRequest request;
+   request.SetKey(key);
+   request.SetRange(fmt::format("bytes={}-{}", offset, offset + length - 1));
+
+   util::ScopedTimer timer {util::ProfileStage::Download};
+
+   auto outcome = p->Execute(request, GetS3Object, false);
+
+   if (!outcome.IsSuccess())
+   {
+      logger_->warn("Could not get object range: {}",
+                    outcome.GetError().GetMessage());
+      return std::nullopt;
+   }
+
+   auto  result = outcome.GetResultWithOwnership();
+   auto& body   = result.GetBody();
+
+   ObjectRange range {};
+   range.eTag_ = result.GetETag();
+   range.data_ = std::make_shared<std::vector<char>>(
+      std::istreambuf_iterator<char>(body), std::istreambuf_iterator<char>());
+
+   util::Metrics::Add(util::Metric::DownloadBytes,
+                      p->bucketName_,
+                      static_cast<double>(range.data_->size()));
+
+   // Content range format is "bytes first-last/size"
+   const std::string contentRange = result.GetContentRange();
+   const std::size_t separator    = contentRange.rfind('/');
+
+   if (separator != std::string::npos)
+   {
+      range.objectSize_ = static_cast<std::size_t>(
+         std::strtoull(contentRange.c_str() + separator + 1, nullptr, 10));
+   }
+   else
+   {
+      // The range was not honored, and the entire object was returned
+      if (offset != 0)
+      {
+         logger_->warn("Object range not returned: {}", key);
+         return std::nullopt;
+      }
+
+      range.objectSize_ = range.data_->size();
+   }
+
+   return range;
+}
+
+std::optional<std::string> AwsNexradDataProvider::DownloadObjectStreamed(
+   const std::string& key, const DataReceivedCallback& callback)
+{
+   CallbackStreambuf streambuf {callback};
+   bool              retried = false;
+
+   Aws::S3::Model::GetObjectRequest request;
+   request.SetKey(key);
+   request.SetResponseStreamFactory(
+      [&streambuf, &retried, attempts = 0]() mutable -> Aws::IOStream*
+      {
+         if (attempts++ > 0)
+         {
+            // Data from a failed attempt has already been passed on
+            retried = true;
+            return Aws::New<Aws::StringStream>(logPrefix_.c_str());
+         }
+         return Aws::New<Aws::IOStream>(logPrefix_.c_str(), &streambuf);
+      });
+
+   util::ScopedTimer timer {util::ProfileStage::Download};
+
+   auto outcome = p->Execute(request, GetS3Object, false);
+
+   util::Metrics::Add(util::Metric::DownloadBytes,
+                      p->bucketName_,
+                      static_cast<double>(streambuf.bytes()));
+
+   if (!outcome.IsSuccess())
+   {
+      logger_->warn("Could not get object: {}",
+                    outcome.GetError().GetMessage());
+      return std::nullopt;
+   }
+
+   if (retried)
+   {
+      logger_->debug("Object download was retried: {}", key);
+      return std::nullopt;
+   }
+
+   return outcome.GetResult().GetETag();
+}
+
+std::string AwsNexradDataProvider::ObjectCacheKey(const std::string& key) const
+{
+   return p->bucketName_ + "/" + key;
+}
+
+bool AwsNexradDataProvider::AddObject(
+   const std::string& key, std::chrono::system_clock::time_point lastModified)
+{
+   auto time = GetTimePointByKey(key);
+
+   // The key must be listed under this provider's prefix for its date, and
+   // must not be a metadata object
+   if (time == std::chrono::system_clock::time_point {} ||
+       !key.starts_with(GetPrefix(time)) ||
+       key.find("NWS_NEXRAD_") != std::string::npos || key.ends_with("_MDM"))
+   {
+      return false;
+   }
+
+   bool inserted;
+
+   {
+      std::unique_lock lock(p->objectsMutex_);
+
+      inserted = p->objects_.try_emplace(time, key, lastModified).second;
+   }
+
+   if (inserted)
+   {
+      logger_->debug("Added object: {}", key);
+
+      p->UpdateMetadata();
+   }
+
+   return inserted;
 }
 
 std::pair<size_t, size_t> AwsNexradDataProvider::Refresh()
@@ -341,20 +798,30 @@ std::pair<size_t, size_t> AwsNexradDataProvider::Refresh()
    size_t allNewObjects   = 0;
    size_t allTotalObjects = 0;
 
-   // If we haven't gotten any objects from today, first list objects for
+   // If we haven't gotten any objects from today, also list objects for
    // yesterday, to ensure we haven't missed any objects near midnight
+   std::future<std::tuple<bool, size_t, size_t>> yesterdayListing {};
    if (p->refreshDate_ < today)
    {
-      auto [success, newObjects, totalObjects] = ListObjects(yesterday);
-      allNewObjects                            = newObjects;
-      allTotalObjects                          = totalObjects;
-      if (totalObjects > 0)
+      yesterdayListing = std::async(std::launch::async,
+                                    [this, yesterday]()
+                                    { return ListObjects(yesterday); });
+   }
+
+   auto [success, newObjects, totalObjects] = ListObjects(today);
+
+   if (yesterdayListing.valid())
+   {
+      auto [yesterdaySuccess, yesterdayNewObjects, yesterdayTotalObjects] =
+         yesterdayListing.get();
+      allNewObjects   = yesterdayNewObjects;
+      allTotalObjects = yesterdayTotalObjects;
+      if (yesterdayTotalObjects > 0)
       {
          p->refreshDate_ = yesterday;
       }
    }
 
-   auto [success, newObjects, totalObjects] = ListObjects(today);
    allNewObjects += newObjects;
    allTotalObjects += totalObjects;
    if (totalObjects > 0)
@@ -365,6 +832,76 @@ std::pair<size_t, size_t> AwsNexradDataProvider::Refresh()
    return std::make_pair(allNewObjects, allTotalObjects);
 }
 
+std::vector<std::size_t> AwsNexradDataProvider::Impl::EndpointOrder()
+{
+   std::unique_lock lock {endpointMutex_};
+
+   const auto now = std::chrono::steady_clock::now();
+
+   std::vector<std::size_t> order(endpoints_.size());
+   std::iota(order.begin(), order.end(), 0u);
+
+   auto Available = [&](std::size_t index)
+   {
+      return !endpoints_[index].failed_ ||
+             now - endpoints_[index].lastFailure_ >= kEndpointRetryInterval_;
+   };
+
+   // Prefer available endpoints with the lowest latency. An endpoint with no
+   // measured latency is preferred, so each endpoint is measured once.
+   std::stable_sort(order.begin(),
+                    order.end(),
+                    [&](std::size_t a, std::size_t b)
+                    {
+                       const bool availableA = Available(a);
+                       const bool availableB = Available(b);
+
+                       if (availableA != availableB)
+                       {
+                          return availableA;
+                       }
+
+                       return endpoints_[a].latency_ < endpoints_[b].latency_;
+                    });
+
+   return order;
+}
+
+void AwsNexradDataProvider::Impl::UpdateEndpoint(
+   std::size_t                                        index,
+   bool                                               success,
+   std::optional<std::chrono::steady_clock::duration> latency)
+{
+   std::unique_lock lock {endpointMutex_};
+
+   auto& endpoint = endpoints_[index];
+
+   if (!success)
+   {
+      endpoint.failed_      = true;
+      endpoint.lastFailure_ = std::chrono::steady_clock::now();
+      return;
+   }
+
+   endpoint.failed_ = false;
+
+   if (latency.has_value())
+   {
+      // Smooth the latency, so a single slow request does not cause a switch
+      endpoint.latency_ = (endpoint.latency_.count() == 0) ?
+                             latency.value() :
+                             (endpoint.latency_ * 3 + latency.value()) / 4;
+   }
+}
+
+bool AwsNexradDataProvider::Impl::IsDateListed(
+   std::chrono::system_clock::time_point day)
+{
+   std::shared_lock lock(objectsMutex_);
+   return std::find(objectDates_.cbegin(), objectDates_.cend(), day) !=
+          objectDates_.cend();
+}
+
 void AwsNexradDataProvider::Impl::PruneObjects()
 {
    using namespace std::chrono;
@@ -395,23 +932,83 @@ void AwsNexradDataProvider::Impl::PruneObjects()
    }
 }
 
+bool AwsNexradDataProvider::Impl::ReadCachedListing(const std::string& prefix,
+                                                   ObjectListing&     listing)
+{
+   auto object = ObjectCache::Instance().Get(bucketName_ + "/" + prefix +
+                                             kListingSuffix_);
+
+   if (!object.has_value() || object->data_ == nullptr)
+   {
+      return false;
+   }
+
+   // Each line holds the last modified time in seconds, and the object key
+   std::string        text {object->data_->cbegin(), object->data_->cend()};
+   std::istringstream is {text};
+   std::int64_t       lastModifiedSeconds;
+   std::string        key;
+
+   while (is >> lastModifiedSeconds >> key)
+   {
+      listing.emplace_back(
+         std::move(key),
+         std::chrono::system_clock::time_point {
+            std::chrono::seconds {lastModifiedSeconds}});
+   }
+
+   return true;
+}
+
+void AwsNexradDataProvider::Impl::WriteCachedListing(
+   const std::string& prefix, const ObjectListing& listing)
+{
+   std::string text {};
+
+   for (auto& [key, lastModified] : listing)
+   {
+      text += fmt::format(
+         "{} {}\n",
+         std::chrono::duration_cast<std::chrono::seconds>(
+            lastModified.time_since_epoch())
+            .count(),
+         key);
+   }
+
+   ObjectCache::Instance().Put(bucketName_ + "/" + prefix + kListingSuffix_,
+                               {},
+                               std::vector<char> {text.cbegin(), text.cend()});
+}
+
 void AwsNexradDataProvider::Impl::UpdateMetadata()
 {
-   std::shared_lock lock(objectsMutex_);
+   // Metadata may be updated by concurrent listings
+   std::unique_lock lock(objectsMutex_);
 
    if (!objects_.empty())
    {
       lastModified_ = objects_.crbegin()->second.lastModified_;
    }
 
-   if (objects_.size() >= 2)
+   // Use the median of the most recent update intervals, so a single late or
+   // early object does not skew the update period
+   std::vector<std::chrono::seconds> intervals {};
+
+   for (auto it = objects_.crbegin();
+        it != objects_.crend() && std::next(it) != objects_.crend() &&
+        intervals.size() < kUpdateIntervals_;
+        ++it)
+   {
+      intervals.push_back(std::chrono::duration_cast<std::chrono::seconds>(
+         it->second.lastModified_ - std::next(it)->second.lastModified_));
+   }
+
+   if (!intervals.empty())
    {
-      auto it           = objects_.crbegin();
-      auto lastModified = it->second.lastModified_;
-      auto prevModified = (++it)->second.lastModified_;
-      auto delta        = lastModified - prevModified;
+      auto median = intervals.begin() + intervals.size() / 2;
+      std::nth_element(intervals.begin(), median, intervals.end());
 
-      updatePeriod_ = std::chrono::duration_cast<std::chrono::seconds>(delta);
+      updatePeriod_ = *median;
    }
 }
 
@@ -0,0 +1,467 @@
+#include <scwx/provider/local_nexrad_data_provider.hpp>
+#include <scwx/provider/aws_level2_data_provider.hpp>
+#include <scwx/provider/aws_level3_data_provider.hpp>
+#include <scwx/common/sites.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/map.hpp>
+#include <scwx/util/mapped_file_stream.hpp>
+#include <scwx/util/time.hpp>
+#include <scwx/wsr88d/nexrad_file_factory.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <shared_mutex>
+
+#include <fmt/format.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string logPrefix_ =
+   "scwx::provider::local_nexrad_data_provider";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+// Number of recent update intervals used to determine the update period
+static const size_t kUpdateIntervals_ = 6;
+
+class LocalNexradDataProvider::Impl
+{
+public:
+   struct ObjectRecord
+   {
+      std::string                           key_;
+      std::chrono::system_clock::time_point lastModified_;
+   };
+
+   explicit Impl(const std::string& directory,
+                 const std::string& radarSite,
+                 const std::string& product) :
+       directory_ {directory},
+       radarSite_ {radarSite},
+       siteId_ {common::GetSiteId(radarSite)},
+       product_ {product},
+       filenamePrefix_ {product.empty() ?
+                           radarSite :
+                           fmt::format("{}_{}_", siteId_, product)}
+   {
+   }
+   ~Impl() = default;
+
+   std::chrono::system_clock::time_point
+        GetTimePoint(const std::string& filename) const;
+   bool IsProviderFile(const std::string& filename) const;
+   void UpdateMetadata();
+
+   std::pair<size_t, size_t>
+   Scan(std::optional<std::chrono::system_clock::time_point> day);
+
+   static std::chrono::system_clock::time_point
+   GetLastModified(const std::filesystem::directory_entry& entry);
+
+   const std::filesystem::path directory_;
+   const std::string           radarSite_;
+   const std::string           siteId_;
+   const std::string           product_;
+   const std::string           filenamePrefix_;
+
+   std::map<std::chrono::system_clock::time_point, ObjectRecord> objects_ {};
+   std::set<std::chrono::system_clock::time_point> listedDates_ {};
+   std::chrono::system_clock::time_point           lastModified_ {};
+   std::chrono::seconds                            updatePeriod_ {};
+   mutable std::shared_mutex                       objectsMutex_ {};
+
+   std::vector<std::string> availableProducts_ {};
+   std::mutex               productsMutex_ {};
+};
+
+LocalNexradDataProvider::LocalNexradDataProvider(const std::string& directory,
+                                                 const std::string& radarSite) :
+    LocalNexradDataProvider(directory, radarSite, {})
+{
+}
+LocalNexradDataProvider::LocalNexradDataProvider(const std::string& directory,
+                                                 const std::string& radarSite,
+                                                 const std::string& product) :
+    p(std::make_unique<Impl>(directory, radarSite, product))
+{
+}
+LocalNexradDataProvider::~LocalNexradDataProvider() = default;
+
+LocalNexradDataProvider::LocalNexradDataProvider(
+   LocalNexradDataProvider&&) noexcept = default;
+LocalNexradDataProvider& LocalNexradDataProvider::operator=(
+   LocalNexradDataProvider&&) noexcept = default;
+
+size_t LocalNexradDataProvider::cache_size() const
+{
+   std::shared_lock lock(p->objectsMutex_);
+   return p->objects_.size();
+}
+
+std::chrono::system_clock::time_point
+LocalNexradDataProvider::last_modified() const
+{
+   std::shared_lock lock(p->objectsMutex_);
+   return p->lastModified_;
+}
+
+std::chrono::seconds LocalNexradDataProvider::update_period() const
+{
+   std::shared_lock lock(p->objectsMutex_);
+   return p->updatePeriod_;
+}
+
+std::string
+LocalNexradDataProvider::FindKey(std::chrono::system_clock::time_point time)
+{
+   logger_->debug("FindKey: {}", util::TimeString(time));
+
+   std::string key {};
+
+   std::shared_lock lock(p->objectsMutex_);
+
+   auto element = util::GetBoundedElement(p->objects_, time);
+
+   if (element.has_value())
+   {
+      key = element->key_;
+   }
+
+   return key;
+}
+
+std::string LocalNexradDataProvider::FindLatestKey()
+{
+   logger_->debug("FindLatestKey()");
+
+   std::string key {};
+
+   std::shared_lock lock(p->objectsMutex_);
+
+   if (!p->objects_.empty())
+   {
+      key = p->objects_.crbegin()->second.key_;
+   }
+
+   return key;
+}
+
+std::vector<std::chrono::system_clock::time_point>
+LocalNexradDataProvider::GetTimePointsByDate(
+   std::chrono::system_clock::time_point date)
+{
+   using namespace std::chrono;
+
+   const auto day = floor<days>(date);
+
+   bool listed;
+
+   {
+      std::shared_lock lock(p->objectsMutex_);
+      listed = p->listedDates_.contains(day);
+   }
+
+   if (!listed)
+   {
+      ListObjects(date);
+   }
+
+   std::vector<system_clock::time_point> timePoints {};
+
+   std::shared_lock lock(p->objectsMutex_);
+
+   auto objectsBegin = p->objects_.lower_bound(day);
+   auto objectsEnd   = p->objects_.lower_bound(day + days {1});
+
+   std::transform(objectsBegin,
+                  objectsEnd,
+                  std::back_inserter(timePoints),
+                  [](const auto& object) { return object.first; });
+
+   return timePoints;
+}
+
+std::tuple<bool, size_t, size_t>
+LocalNexradDataProvider::ListObjects(std::chrono::system_clock::time_point date)
+{
+   const auto day = std::chrono::floor<std::chrono::days>(date);
+
+   logger_->debug("ListObjects: {} ({})",
+                  util::TimeString(day),
+                  p->directory_.string());
+
+   std::error_code error {};
+   if (!std::filesystem::is_directory(p->directory_, error))
+   {
+      logger_->warn("Directory not found: {}", p->directory_.string());
+      return {false, 0, 0};
+   }
+
+   auto [newObjects, totalObjects] = p->Scan(day);
+
+   std::unique_lock lock(p->objectsMutex_);
+   p->listedDates_.insert(day);
+
+   return {true, newObjects, totalObjects};
+}
+
+std::shared_ptr<wsr88d::NexradFile>
+LocalNexradDataProvider::LoadObjectByKey(const std::string& key)
+{
+   const std::filesystem::path path = p->directory_ / key;
+
+   // Decode directly from the mapped file, without copying it into memory
+   util::MappedFileStream is {path.string()};
+   if (!is.good())
+   {
+      logger_->warn("Could not open file: {}", path.string());
+      return nullptr;
+   }
+
+   return wsr88d::NexradFileFactory::Create(is);
+}
+
+bool LocalNexradDataProvider::AddObject(
+   const std::string& key, std::chrono::system_clock::time_point lastModified)
+{
+   const std::string filename =
+      std::filesystem::path(key).filename().string();
+
+   if (!p->IsProviderFile(filename))
+   {
+      return false;
+   }
+
+   auto time = p->GetTimePoint(filename);
+
+   std::error_code error {};
+   if (time == std::chrono::system_clock::time_point {} ||
+       !std::filesystem::is_regular_file(p->directory_ / key, error))
+   {
+      return false;
+   }
+
+   std::unique_lock lock(p->objectsMutex_);
+
+   const bool inserted =
+      p->objects_.try_emplace(time, Impl::ObjectRecord {key, lastModified})
+         .second;
+
+   if (inserted)
+   {
+      logger_->debug("Added object: {}", key);
+
+      p->UpdateMetadata();
+   }
+
+   return inserted;
+}
+
+std::pair<size_t, size_t> LocalNexradDataProvider::Refresh()
+{
+   logger_->debug("Refresh()");
+
+   return p->Scan(std::nullopt);
+}
+
+std::chrono::system_clock::time_point
+LocalNexradDataProvider::GetTimePointByKey(const std::string& key) const
+{
+   return p->GetTimePoint(std::filesystem::path(key).filename().string());
+}
+
+void LocalNexradDataProvider::RequestAvailableProducts()
+{
+   // Level 2 data has no products, and Level 3 products are listed once
+   {
+      std::unique_lock lock(p->productsMutex_);
+
+      if (p->product_.empty() || !p->availableProducts_.empty())
+      {
+         return;
+      }
+   }
+
+   // Level 3 filename format is GGG_PPP_YYYY_MM_DD_HH_MM_SS
+   const std::string sitePrefix = p->siteId_ + "_";
+
+   std::set<std::string> products {};
+   std::error_code       error {};
+
+   for (auto it = std::filesystem::recursive_directory_iterator(
+           p->directory_,
+           std::filesystem::directory_options::skip_permission_denied,
+           error);
+        it != std::filesystem::recursive_directory_iterator();
+        it.increment(error))
+   {
+      const std::string filename = it->path().filename().string();
+
+      const std::size_t productEnd = filename.find('_', sitePrefix.size());
+
+      if (filename.starts_with(sitePrefix) && productEnd != std::string::npos)
+      {
+         products.insert(filename.substr(sitePrefix.size(),
+                                         productEnd - sitePrefix.size()));
+      }
+   }
+
+   std::unique_lock lock(p->productsMutex_);
+   p->availableProducts_.assign(products.cbegin(), products.cend());
+}
+
+std::vector<std::string> LocalNexradDataProvider::GetAvailableProducts()
+{
+   std::unique_lock lock(p->productsMutex_);
+   return p->availableProducts_;
+}
+
+std::chrono::system_clock::time_point
+LocalNexradDataProvider::Impl::GetTimePoint(const std::string& filename) const
+{
+   if (product_.empty())
+   {
+      // Level 2 keys are parsed from the radar site following the last
+      // separator
+      return AwsLevel2DataProvider::GetTimePointFromKey("/" + filename);
+   }
+
+   return AwsLevel3DataProvider::GetTimePointFromKey(filename);
+}
+
+bool LocalNexradDataProvider::Impl::IsProviderFile(
+   const std::string& filename) const
+{
+   // The time must immediately follow the prefix, this also excludes the
+   // files of other Level 3 products with the same prefix (e.g., N0B and N0BR)
+   return filename.size() > filenamePrefix_.size() &&
+          filename.starts_with(filenamePrefix_) &&
+          std::isdigit(
+             static_cast<unsigned char>(filename[filenamePrefix_.size()])) &&
+          filename.find("NWS_NEXRAD_") == std::string::npos &&
+          !filename.ends_with("_MDM");
+}
+
+std::pair<size_t, size_t> LocalNexradDataProvider::Impl::Scan(
+   std::optional<std::chrono::system_clock::time_point> day)
+{
+   using namespace std::chrono;
+
+   size_t newObjects   = 0;
+   size_t totalObjects = 0;
+
+   std::error_code error {};
+
+   for (auto it = std::filesystem::recursive_directory_iterator(
+           directory_,
+           std::filesystem::directory_options::skip_permission_denied,
+           error);
+        it != std::filesystem::recursive_directory_iterator();
+        it.increment(error))
+   {
+      const std::string filename = it->path().filename().string();
+
+      if (!it->is_regular_file(error) || !IsProviderFile(filename))
+      {
+         continue;
+      }
+
+      const auto time = GetTimePoint(filename);
+
+      if (time == system_clock::time_point {} ||
+          (day.has_value() && floor<days>(time) != day.value()))
+      {
+         continue;
+      }
+
+      const std::string key =
+         std::filesystem::relative(it->path(), directory_, error)
+            .generic_string();
+
+      if (error)
+      {
+         continue;
+      }
+
+      const auto lastModified = GetLastModified(*it);
+
+      std::unique_lock lock(objectsMutex_);
+
+      if (objects_.insert_or_assign(time, ObjectRecord {key, lastModified})
+             .second)
+      {
+         newObjects++;
+      }
+
+      totalObjects++;
+   }
+
+   if (newObjects > 0)
+   {
+      std::unique_lock lock(objectsMutex_);
+      UpdateMetadata();
+   }
+
+   logger_->debug("Found {} objects ({} new)", totalObjects, newObjects);
+
+   return {newObjects, totalObjects};
+}
+
+void LocalNexradDataProvider::Impl::UpdateMetadata()
+{
+   if (!objects_.empty())
+   {
+      lastModified_ = objects_.crbegin()->second.lastModified_;
+   }
+
+   // Use the median of the most recent update intervals, so a single late or
+   // early file does not skew the update period
+   std::vector<std::chrono::seconds> intervals {};
+
+   for (auto it = objects_.crbegin();
+        it != objects_.crend() && std::next(it) != objects_.crend() &&
+        intervals.size() < kUpdateIntervals_;
+        ++it)
+   {
+      intervals.push_back(std::chrono::duration_cast<std::chrono::seconds>(
+         it->second.lastModified_ - std::next(it)->second.lastModified_));
+   }
+
+   if (!intervals.empty())
+   {
+      auto median = intervals.begin() + intervals.size() / 2;
+      std::nth_element(intervals.begin(), median, intervals.end());
+
+      updatePeriod_ = *median;
+   }
+}
+
+std::chrono::system_clock::time_point
+LocalNexradDataProvider::Impl::GetLastModified(
+   const std::filesystem::directory_entry& entry)
+{
+   using namespace std::chrono;
+
+   std::error_code error {};
+   const auto      fileTime = entry.last_write_time(error);
+
+   if (error)
+   {
+      return system_clock::now();
+   }
+
+   // File times use an unspecified clock, convert relative to the present
+   return time_point_cast<system_clock::duration>(
+      system_clock::now() +
+      (fileTime - std::filesystem::file_time_type::clock::now()));
+}
+
+} // namespace provider
+} // namespace scwx
@@ -1,4 +1,13 @@
 #include <scwx/provider/nexrad_data_provider.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/time.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 
 namespace scwx
 {
@@ -6,6 +15,10 @@ namespace provider
 {
 
 static const std::string logPrefix_ = "scwx::provider::nexrad_data_provider";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+// Maximum number of dates listed at once
+static constexpr std::size_t kMaxConcurrentListings_ = 4u;
 
 class NexradDataProvider::Impl
 {
@@ -22,6 +35,93 @@ NexradDataProvider::NexradDataProvider(NexradDataProvider&&) noexcept = default;
 NexradDataProvider&
 NexradDataProvider::operator=(NexradDataProvider&&) noexcept = default;
 
+std::shared_ptr<std::vector<char>>
+NexradDataProvider::DownloadObjectByKey(
+   const std::string& /* key */, const CancelledCallback& /* cancelled */)
+{
+   return nullptr;
+}
+
+std::shared_ptr<wsr88d::NexradFile> NexradDataProvider::LoadObjectByKeyRanged(
+   const std::string& key,
+   std::size_t /* rangeSize */,
+   const RangeLoadedCallback& callback,
+   const CancelledCallback& /* cancelled */)
+{
+   auto nexradFile = LoadObjectByKey(key);
+
+   if (nexradFile != nullptr && callback != nullptr)
+   {
+      callback(nexradFile);
+   }
+
+   return nexradFile;
+}
+
+bool NexradDataProvider::AddObject(
+   const std::string& /* key */,
+   std::chrono::system_clock::time_point /* lastModified */)
+{
+   return false;
+}
+
+std::vector<std::chrono::system_clock::time_point>
+NexradDataProvider::GetTimePointsByDateRange(
+   std::chrono::system_clock::time_point firstDate,
+   std::chrono::system_clock::time_point lastDate)
+{
+   using namespace std::chrono;
+
+   std::vector<system_clock::time_point> dates {};
+   for (auto date = floor<days>(firstDate); date <= lastDate;
+        date += days {1})
+   {
+      dates.push_back(date);
+   }
+
+   if (dates.empty())
+   {
+      return {};
+   }
+
+   std::vector<std::vector<system_clock::time_point>> dateTimePoints(
+      dates.size());
+
+   {
+      boost::asio::thread_pool threadPool {
+         std::min(dates.size(), kMaxConcurrentListings_)};
+
+      for (std::size_t i = 0; i < dates.size(); ++i)
+      {
+         boost::asio::post(threadPool,
+                           [&, i]()
+                           {
+                              try
+                              {
+                                 dateTimePoints[i] =
+                                    GetTimePointsByDate(dates[i]);
+                              }
+                              catch (const std::exception& ex)
+                              {
+                                 logger_->warn("Error listing {}: {}",
+                                               util::TimeString(dates[i]),
+                                               ex.what());
+                              }
+                           });
+      }
+
+      threadPool.join();
+   }
+
+   std::vector<system_clock::time_point> timePoints {};
+   for (auto& date : dateTimePoints)
+   {
+      timePoints.insert(timePoints.end(), date.cbegin(), date.cend());
+   }
+
+   return timePoints;
+}
+
 void NexradDataProvider::RequestAvailableProducts() {}
 
 std::vector<std::string> NexradDataProvider::GetAvailableProducts()
@@ -29,5 +129,118 @@ std::vector<std::string> NexradDataProvider::GetAvailableProducts()
    return {};
 }
 
+std::size_t NexradDataProvider::Prefetch(
+   const std::vector<std::shared_ptr<NexradDataProvider>>& providers,
+   std::chrono::system_clock::time_point                   startTime,
+   std::chrono::system_clock::time_point                   endTime,
+   const PrefetchCallback&                                 callback,
+   std::size_t                                             maxInFlight,
+   const PrefetchFilter&                                   filter)
+{
+   using namespace std::chrono;
+
+   logger_->debug("Prefetch: {} providers, {} - {}",
+                  providers.size(),
+                  util::TimeString(startTime),
+                  util::TimeString(endTime));
+
+   if (providers.empty() || endTime < startTime)
+   {
+      return 0;
+   }
+
+   // Each thread has at most one request in flight
+   boost::asio::thread_pool threadPool {std::max<std::size_t>(maxInFlight, 1u)};
+
+   std::atomic<std::size_t> loadedCount {0};
+   std::mutex               callbackMutex {};
+
+   const auto firstDate = floor<days>(startTime);
+   const auto lastDate  = floor<days>(endTime);
+
+   // Objects are loaded as soon as the listing for their date is complete
+   auto LoadObject =
+      [&](const std::shared_ptr<NexradDataProvider>& provider,
+          system_clock::time_point                   time)
+   {
+      if (filter != nullptr && !filter(provider, time))
+      {
+         return;
+      }
+
+      std::shared_ptr<wsr88d::NexradFile> nexradFile = nullptr;
+
+      const std::string key = provider->FindKey(time);
+
+      if (!key.empty())
+      {
+         try
+         {
+            nexradFile = provider->LoadObjectByKey(key);
+         }
+         catch (const std::exception& ex)
+         {
+            logger_->warn("Error loading {}: {}", key, ex.what());
+         }
+      }
+
+      if (nexradFile != nullptr)
+      {
+         ++loadedCount;
+      }
+
+      if (callback != nullptr)
+      {
+         std::unique_lock lock {callbackMutex};
+         callback(provider, key, time, nexradFile);
+      }
+   };
+
+   for (auto& provider : providers)
+   {
+      if (provider == nullptr)
+      {
+         continue;
+      }
+
+      for (auto date = firstDate; date <= lastDate; date += days {1})
+      {
+         boost::asio::post(
+            threadPool,
+            [&, provider, date]()
+            {
+               std::vector<system_clock::time_point> timePoints {};
+
+               try
+               {
+                  timePoints = provider->GetTimePointsByDate(date);
+               }
+               catch (const std::exception& ex)
+               {
+                  logger_->warn("Error listing {}: {}",
+                                util::TimeString(date),
+                                ex.what());
+               }
+
+               for (auto& time : timePoints)
+               {
+                  if (startTime <= time && time <= endTime)
+                  {
+                     boost::asio::post(threadPool,
+                                       [&, provider, time]()
+                                       { LoadObject(provider, time); });
+                  }
+               }
+            });
+      }
+   }
+
+   threadPool.join();
+
+   logger_->debug("Prefetched {} objects", loadedCount.load());
+
+   return loadedCount;
+}
+
 } // namespace provider
 } // namespace scwx
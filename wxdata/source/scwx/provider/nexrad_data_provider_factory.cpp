@@ -1,6 +1,13 @@
 #include <scwx/provider/nexrad_data_provider_factory.hpp>
 #include <scwx/provider/aws_level2_data_provider.hpp>
 #include <scwx/provider/aws_level3_data_provider.hpp>
+#include <scwx/provider/local_nexrad_data_provider.hpp>
+#include <scwx/provider/replay_nexrad_data_provider.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/strings.hpp>
+
+#include <mutex>
+#include <string_view>
 
 namespace scwx
 {
@@ -9,19 +16,130 @@ namespace provider
 
 static const std::string logPrefix_ =
    "scwx::provider::nexrad_data_provider_factory";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+static std::vector<AwsNexradDataProvider::Endpoint> level2Mirrors_ {};
+static std::vector<AwsNexradDataProvider::Endpoint> level3Mirrors_ {};
+static std::string                                  localDirectory_ {};
+static std::string                                  replayDirectory_ {};
+static std::shared_ptr<const ReplayClock>           replayClock_ {};
+static std::mutex                                   providerMutex_ {};
 
 std::shared_ptr<NexradDataProvider>
 NexradDataProviderFactory::CreateLevel2DataProvider(
    const std::string& radarSite)
 {
-   return std::make_unique<AwsLevel2DataProvider>(radarSite);
+   std::unique_lock lock {providerMutex_};
+
+   if (replayClock_ != nullptr)
+   {
+      return std::make_shared<ReplayNexradDataProvider>(
+         std::make_shared<LocalNexradDataProvider>(replayDirectory_,
+                                                   radarSite),
+         replayClock_);
+   }
+
+   if (!localDirectory_.empty())
+   {
+      return std::make_unique<LocalNexradDataProvider>(localDirectory_,
+                                                       radarSite);
+   }
+
+   return std::make_unique<AwsLevel2DataProvider>(radarSite, level2Mirrors_);
 }
 
 std::shared_ptr<NexradDataProvider>
 NexradDataProviderFactory::CreateLevel3DataProvider(
    const std::string& radarSite, const std::string& product)
 {
-   return std::make_unique<AwsLevel3DataProvider>(radarSite, product);
+   std::unique_lock lock {providerMutex_};
+
+   if (replayClock_ != nullptr)
+   {
+      return std::make_shared<ReplayNexradDataProvider>(
+         std::make_shared<LocalNexradDataProvider>(
+            replayDirectory_, radarSite, product),
+         replayClock_);
+   }
+
+   if (!localDirectory_.empty())
+   {
+      return std::make_unique<LocalNexradDataProvider>(
+         localDirectory_, radarSite, product);
+   }
+
+   return std::make_unique<AwsLevel3DataProvider>(
+      radarSite, product, level3Mirrors_);
+}
+
+void NexradDataProviderFactory::SetLevel2Mirrors(
+   const std::vector<Endpoint>& mirrors)
+{
+   std::unique_lock lock {providerMutex_};
+   level2Mirrors_ = mirrors;
+}
+
+void NexradDataProviderFactory::SetLevel3Mirrors(
+   const std::vector<Endpoint>& mirrors)
+{
+   std::unique_lock lock {providerMutex_};
+   level3Mirrors_ = mirrors;
+}
+
+std::vector<NexradDataProviderFactory::Endpoint>
+NexradDataProviderFactory::ParseMirrors(const std::string& value)
+{
+   std::vector<Endpoint>         mirrors {};
+   std::vector<std::string_view> tokens {};
+
+   // Mirrors are separated by commas or whitespace
+   util::SplitTokens(value, ", \t\r\n", tokens);
+
+   for (std::string_view token : tokens)
+   {
+      // The endpoint is the remainder of the mirror, and may include a port
+      const std::size_t regionPos   = token.find(':');
+      const std::size_t endpointPos = (regionPos == std::string_view::npos) ?
+                                         std::string_view::npos :
+                                         token.find(':', regionPos + 1);
+
+      Endpoint mirror {};
+      mirror.bucketName_ = token.substr(0, regionPos);
+
+      if (regionPos != std::string_view::npos)
+      {
+         mirror.region_ =
+            token.substr(regionPos + 1, endpointPos - regionPos - 1);
+      }
+      if (endpointPos != std::string_view::npos)
+      {
+         mirror.endpointOverride_ = token.substr(endpointPos + 1);
+      }
+
+      if (mirror.bucketName_.empty() || mirror.region_.empty())
+      {
+         logger_->warn("Invalid bucket mirror: \"{}\"", token);
+         continue;
+      }
+
+      mirrors.push_back(std::move(mirror));
+   }
+
+   return mirrors;
+}
+
+void NexradDataProviderFactory::SetLocalDirectory(const std::string& directory)
+{
+   std::unique_lock lock {providerMutex_};
+   localDirectory_ = directory;
+}
+
+void NexradDataProviderFactory::SetReplay(
+   const std::string& directory, std::shared_ptr<const ReplayClock> clock)
+{
+   std::unique_lock lock {providerMutex_};
+   replayDirectory_ = directory;
+   replayClock_     = std::move(clock);
 }
 
 } // namespace provider
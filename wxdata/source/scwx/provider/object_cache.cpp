@@ -0,0 +1,375 @@
+#include <scwx/provider/object_cache.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+
+#include <fmt/format.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string logPrefix_ = "scwx::provider::object_cache";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+static constexpr std::array<char, 8> kMagic_ {
+   'S', 'C', 'W', 'X', 'O', 'B', 'J', '1'};
+static const std::string kExtension_ {".obj"};
+static const std::string kTempExtension_ {".tmp"};
+
+// Keys and entity tags are short, a larger length indicates a corrupt object
+static constexpr std::uint32_t kMaxStringLength_ = 4096u;
+
+class ObjectCache::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   std::filesystem::path ObjectPath(const std::string& key) const;
+   void                  PruneLocked();
+   void                  RemoveLocked(const std::filesystem::path& path);
+
+   static std::uint64_t Fnv1a(const std::string& key);
+
+   std::mutex            mutex_ {};
+   std::filesystem::path path_ {};
+   std::size_t           maxSize_ {0u};
+   std::size_t           totalSize_ {0u};
+};
+
+ObjectCache::ObjectCache() : p(std::make_unique<Impl>()) {}
+ObjectCache::~ObjectCache() = default;
+
+ObjectCache::ObjectCache(ObjectCache&&) noexcept            = default;
+ObjectCache& ObjectCache::operator=(ObjectCache&&) noexcept = default;
+
+bool ObjectCache::enabled() const
+{
+   std::unique_lock lock {p->mutex_};
+   return !p->path_.empty() && p->maxSize_ > 0u;
+}
+
+std::size_t ObjectCache::max_size() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->maxSize_;
+}
+
+void ObjectCache::SetPath(const std::string& path)
+{
+   std::unique_lock lock {p->mutex_};
+
+   p->path_.clear();
+   p->totalSize_ = 0u;
+
+   if (path.empty())
+   {
+      return;
+   }
+
+   std::error_code error {};
+   std::filesystem::create_directories(path, error);
+
+   if (error)
+   {
+      logger_->warn("Could not create object cache directory: {}, {}",
+                    path,
+                    error.message());
+      return;
+   }
+
+   p->path_ = path;
+
+   if (p->maxSize_ > 0u)
+   {
+      p->PruneLocked();
+   }
+}
+
+void ObjectCache::SetMaxSize(std::size_t maxSize)
+{
+   std::unique_lock lock {p->mutex_};
+
+   p->maxSize_ = maxSize;
+
+   if (!p->path_.empty() && p->maxSize_ > 0u)
+   {
+      p->PruneLocked();
+   }
+}
+
+bool ObjectCache::Contains(const std::string& key) const
+{
+   std::unique_lock lock {p->mutex_};
+
+   if (p->path_.empty() || p->maxSize_ == 0u)
+   {
+      return false;
+   }
+
+   // Objects with colliding keys are only distinguished when read
+   std::error_code error {};
+   return std::filesystem::exists(p->ObjectPath(key), error);
+}
+
+std::optional<ObjectCache::Object> ObjectCache::Get(const std::string& key)
+{
+   std::unique_lock lock {p->mutex_};
+
+   if (p->path_.empty() || p->maxSize_ == 0u)
+   {
+      return std::nullopt;
+   }
+
+   const std::filesystem::path path = p->ObjectPath(key);
+
+   std::ifstream is {path, std::ios_base::in | std::ios_base::binary};
+   if (!is.is_open())
+   {
+      return std::nullopt;
+   }
+
+   std::array<char, kMagic_.size()> magic {};
+   std::uint32_t                    keyLength  = 0u;
+   std::uint32_t                    eTagLength = 0u;
+
+   is.read(magic.data(), magic.size());
+   is.read(reinterpret_cast<char*>(&keyLength), sizeof(keyLength));
+   is.read(reinterpret_cast<char*>(&eTagLength), sizeof(eTagLength));
+
+   if (!is || magic != kMagic_ || keyLength > kMaxStringLength_ ||
+       eTagLength > kMaxStringLength_)
+   {
+      logger_->warn("Removing invalid cached object: {}", path.string());
+      is.close();
+      p->RemoveLocked(path);
+      return std::nullopt;
+   }
+
+   std::string objectKey(keyLength, '\0');
+   Object      object {};
+   object.eTag_.resize(eTagLength);
+
+   is.read(objectKey.data(), keyLength);
+   is.read(object.eTag_.data(), eTagLength);
+
+   if (!is || objectKey != key)
+   {
+      // Either truncated, or a different key with the same hash
+      return std::nullopt;
+   }
+
+   object.data_ = std::make_shared<std::vector<char>>(
+      std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+   is.close();
+
+   // Mark the object as recently used
+   std::error_code error {};
+   std::filesystem::last_write_time(
+      path, std::filesystem::file_time_type::clock::now(), error);
+
+   return object;
+}
+
+void ObjectCache::Put(const std::string&       key,
+                      const std::string&       eTag,
+                      const std::vector<char>& data)
+{
+   std::unique_lock lock {p->mutex_};
+
+   if (p->path_.empty() || p->maxSize_ == 0u ||
+       key.size() > kMaxStringLength_ || eTag.size() > kMaxStringLength_)
+   {
+      return;
+   }
+
+   const std::filesystem::path path     = p->ObjectPath(key);
+   std::filesystem::path       tempPath = path;
+   tempPath.replace_extension(kTempExtension_);
+
+   const std::uint32_t keyLength  = static_cast<std::uint32_t>(key.size());
+   const std::uint32_t eTagLength = static_cast<std::uint32_t>(eTag.size());
+
+   std::ofstream os {tempPath,
+                     std::ios_base::out | std::ios_base::binary |
+                        std::ios_base::trunc};
+
+   os.write(kMagic_.data(), kMagic_.size());
+   os.write(reinterpret_cast<const char*>(&keyLength), sizeof(keyLength));
+   os.write(reinterpret_cast<const char*>(&eTagLength), sizeof(eTagLength));
+   os.write(key.data(), keyLength);
+   os.write(eTag.data(), eTagLength);
+   os.write(data.data(), static_cast<std::streamsize>(data.size()));
+   os.close();
+
+   std::error_code error {};
+
+   if (!os)
+   {
+      logger_->warn("Could not write cached object: {}", tempPath.string());
+      std::filesystem::remove(tempPath, error);
+      return;
+   }
+
+   // Replace any existing object, keeping the cache size current
+   p->RemoveLocked(path);
+
+   const std::uintmax_t size = std::filesystem::file_size(tempPath, error);
+   std::filesystem::rename(tempPath, path, error);
+
+   if (error)
+   {
+      logger_->warn("Could not store cached object: {}, {}",
+                    path.string(),
+                    error.message());
+      std::filesystem::remove(tempPath, error);
+      return;
+   }
+
+   p->totalSize_ += static_cast<std::size_t>(size);
+
+   if (p->totalSize_ > p->maxSize_)
+   {
+      p->PruneLocked();
+   }
+}
+
+void ObjectCache::Remove(const std::string& key)
+{
+   std::unique_lock lock {p->mutex_};
+
+   if (!p->path_.empty())
+   {
+      p->RemoveLocked(p->ObjectPath(key));
+   }
+}
+
+void ObjectCache::Prune()
+{
+   std::unique_lock lock {p->mutex_};
+
+   if (!p->path_.empty() && p->maxSize_ > 0u)
+   {
+      p->PruneLocked();
+   }
+}
+
+std::filesystem::path
+ObjectCache::Impl::ObjectPath(const std::string& key) const
+{
+   return path_ / fmt::format("{:016x}{}", Fnv1a(key), kExtension_);
+}
+
+void ObjectCache::Impl::RemoveLocked(const std::filesystem::path& path)
+{
+   std::error_code      error {};
+   const std::uintmax_t size = std::filesystem::file_size(path, error);
+
+   if (!error && std::filesystem::remove(path, error))
+   {
+      totalSize_ -= std::min(totalSize_, static_cast<std::size_t>(size));
+   }
+}
+
+void ObjectCache::Impl::PruneLocked()
+{
+   struct CachedObject
+   {
+      std::filesystem::path           path_;
+      std::uintmax_t                  size_;
+      std::filesystem::file_time_type lastUsed_;
+   };
+
+   std::vector<CachedObject> objects {};
+   std::size_t               totalSize = 0u;
+   std::error_code           error {};
+
+   for (auto& entry : std::filesystem::directory_iterator(path_, error))
+   {
+      if (!entry.is_regular_file(error))
+      {
+         continue;
+      }
+
+      if (entry.path().extension() == kTempExtension_)
+      {
+         // Remove objects left behind by an interrupted write
+         std::filesystem::remove(entry.path(), error);
+         continue;
+      }
+
+      if (entry.path().extension() != kExtension_)
+      {
+         continue;
+      }
+
+      const std::uintmax_t size = entry.file_size(error);
+      if (error)
+      {
+         continue;
+      }
+
+      objects.push_back({entry.path(), size, entry.last_write_time(error)});
+      totalSize += static_cast<std::size_t>(size);
+   }
+
+   if (totalSize > maxSize_)
+   {
+      // Evict the least recently used objects first
+      std::sort(objects.begin(),
+                objects.end(),
+                [](const CachedObject& a, const CachedObject& b)
+                { return a.lastUsed_ < b.lastUsed_; });
+
+      for (auto& object : objects)
+      {
+         if (totalSize <= maxSize_)
+         {
+            break;
+         }
+
+         if (std::filesystem::remove(object.path_, error))
+         {
+            totalSize -= static_cast<std::size_t>(object.size_);
+         }
+      }
+
+      logger_->debug("Pruned object cache to {} bytes", totalSize);
+   }
+
+   totalSize_ = totalSize;
+}
+
+std::uint64_t ObjectCache::Impl::Fnv1a(const std::string& key)
+{
+   // A stable hash is required, as object filenames persist between runs
+   static constexpr std::uint64_t kOffsetBasis = 14695981039346656037ull;
+   static constexpr std::uint64_t kPrime       = 1099511628211ull;
+
+   std::uint64_t hash = kOffsetBasis;
+   for (char c : key)
+   {
+      hash ^= static_cast<std::uint8_t>(c);
+      hash *= kPrime;
+   }
+
+   return hash;
+}
+
+ObjectCache& ObjectCache::Instance()
+{
+   static ObjectCache instance_ {};
+   return instance_;
+}
+
+} // namespace provider
+} // namespace scwx
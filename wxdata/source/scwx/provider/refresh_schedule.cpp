@@ -0,0 +1,54 @@
+#include <scwx/provider/refresh_schedule.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace scwx
+{
+namespace provider
+{
+
+// Objects overdue by this many update periods are refreshed at the slow
+// interval
+static constexpr std::int64_t kMaxPeriodsOverdue_ = 4;
+
+std::chrono::milliseconds
+GetRefreshInterval(std::chrono::system_clock::time_point lastModified,
+                   std::chrono::seconds                  updatePeriod,
+                   std::chrono::system_clock::time_point now,
+                   std::chrono::seconds                  fastInterval,
+                   std::chrono::seconds                  slowInterval)
+{
+   using namespace std::chrono;
+
+   const milliseconds fast {fastInterval};
+   const milliseconds slow {slowInterval};
+
+   if (lastModified == system_clock::time_point {} || updatePeriod <= 0s)
+   {
+      // The next object cannot be predicted
+      return fast;
+   }
+
+   const auto expected = lastModified + updatePeriod;
+
+   if (now < expected)
+   {
+      // Wait for the expected time
+      return std::max(duration_cast<milliseconds>(expected - now), fast);
+   }
+
+   const std::int64_t periodsOverdue = (now - expected) / updatePeriod;
+
+   if (periodsOverdue >= kMaxPeriodsOverdue_)
+   {
+      return std::max(slow, fast);
+   }
+
+   return std::clamp(fast * (std::int64_t {1} << periodsOverdue),
+                     fast,
+                     std::max(slow, fast));
+}
+
+} // namespace provider
+} // namespace scwx
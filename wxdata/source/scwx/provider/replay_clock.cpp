@@ -0,0 +1,59 @@
+#include <scwx/provider/replay_clock.hpp>
+
+#include <algorithm>
+
+namespace scwx
+{
+namespace provider
+{
+
+// Replay speeds are limited to avoid dividing by zero
+static constexpr double kMinimumSpeed_ = 0.001;
+
+ReplayClock::ReplayClock(std::chrono::system_clock::time_point startTime,
+                         double                                speed,
+                         std::chrono::system_clock::time_point wallStartTime) :
+    startTime_ {startTime},
+    speed_ {std::max(speed, kMinimumSpeed_)},
+    wallStartTime_ {wallStartTime}
+{
+}
+
+double ReplayClock::speed() const
+{
+   return speed_;
+}
+
+std::chrono::system_clock::time_point ReplayClock::start_time() const
+{
+   return startTime_;
+}
+
+std::chrono::system_clock::time_point
+ReplayClock::now(std::chrono::system_clock::time_point wallTime) const
+{
+   using namespace std::chrono;
+
+   const duration<double> elapsed = wallTime - wallStartTime_;
+
+   return startTime_ +
+          duration_cast<system_clock::duration>(elapsed * speed_);
+}
+
+std::chrono::system_clock::time_point ReplayClock::GetWallTime(
+   std::chrono::system_clock::time_point replayTime) const
+{
+   return wallStartTime_ + GetWallDuration(replayTime - startTime_);
+}
+
+std::chrono::system_clock::duration
+ReplayClock::GetWallDuration(std::chrono::system_clock::duration duration) const
+{
+   using namespace std::chrono;
+
+   return duration_cast<system_clock::duration>(
+      duration_cast<std::chrono::duration<double>>(duration) / speed_);
+}
+
+} // namespace provider
+} // namespace scwx
@@ -0,0 +1,251 @@
+#include <scwx/provider/replay_nexrad_data_provider.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/map.hpp>
+#include <scwx/util/time.hpp>
+
+#include <algorithm>
+#include <map>
+#include <shared_mutex>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string logPrefix_ =
+   "scwx::provider::replay_nexrad_data_provider";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+// Recorded data available when replay begins, as it would be when a live
+// provider is first refreshed
+static constexpr std::chrono::hours kInitialHistory_ {24};
+
+class ReplayNexradDataProvider::Impl
+{
+public:
+   explicit Impl(const std::shared_ptr<NexradDataProvider>& recording,
+                 const std::shared_ptr<const ReplayClock>&  clock) :
+       recording_ {recording}, clock_ {clock}
+   {
+   }
+   ~Impl() = default;
+
+   std::size_t AddObjects(
+      const std::vector<std::chrono::system_clock::time_point>& timePoints,
+      std::chrono::system_clock::time_point                     now);
+
+   const std::shared_ptr<NexradDataProvider> recording_;
+   const std::shared_ptr<const ReplayClock>  clock_;
+
+   // Objects which have been replayed, by time
+   std::map<std::chrono::system_clock::time_point, std::string> objects_ {};
+
+   mutable std::shared_mutex objectsMutex_ {};
+};
+
+ReplayNexradDataProvider::ReplayNexradDataProvider(
+   const std::shared_ptr<NexradDataProvider>& recording,
+   const std::shared_ptr<const ReplayClock>&  clock) :
+    p(std::make_unique<Impl>(recording, clock))
+{
+}
+ReplayNexradDataProvider::~ReplayNexradDataProvider() = default;
+
+ReplayNexradDataProvider::ReplayNexradDataProvider(
+   ReplayNexradDataProvider&&) noexcept = default;
+ReplayNexradDataProvider& ReplayNexradDataProvider::operator=(
+   ReplayNexradDataProvider&&) noexcept = default;
+
+size_t ReplayNexradDataProvider::cache_size() const
+{
+   std::shared_lock lock(p->objectsMutex_);
+   return p->objects_.size();
+}
+
+std::chrono::system_clock::time_point
+ReplayNexradDataProvider::last_modified() const
+{
+   std::shared_lock lock(p->objectsMutex_);
+
+   if (p->objects_.empty())
+   {
+      return {};
+   }
+
+   // Objects are modified when the replay reaches their time
+   return p->clock_->GetWallTime(p->objects_.crbegin()->first);
+}
+
+std::chrono::seconds ReplayNexradDataProvider::update_period() const
+{
+   std::shared_lock lock(p->objectsMutex_);
+
+   if (p->objects_.size() < 2)
+   {
+      return std::chrono::seconds {0};
+   }
+
+   auto latest = p->objects_.crbegin();
+   return std::chrono::duration_cast<std::chrono::seconds>(
+      p->clock_->GetWallDuration(latest->first - std::next(latest)->first));
+}
+
+std::string
+ReplayNexradDataProvider::FindKey(std::chrono::system_clock::time_point time)
+{
+   logger_->debug("FindKey: {}", util::TimeString(time));
+
+   std::string key {};
+
+   std::shared_lock lock(p->objectsMutex_);
+
+   auto element = util::GetBoundedElement(p->objects_, time);
+
+   if (element.has_value())
+   {
+      key = element.value();
+   }
+
+   return key;
+}
+
+std::string ReplayNexradDataProvider::FindLatestKey()
+{
+   logger_->debug("FindLatestKey()");
+
+   std::string key {};
+
+   std::shared_lock lock(p->objectsMutex_);
+
+   if (!p->objects_.empty())
+   {
+      key = p->objects_.crbegin()->second;
+   }
+
+   return key;
+}
+
+std::vector<std::chrono::system_clock::time_point>
+ReplayNexradDataProvider::GetTimePointsByDate(
+   std::chrono::system_clock::time_point date)
+{
+   const auto now = p->clock_->now();
+
+   // Exclude objects which have not yet been replayed
+   auto timePoints = p->recording_->GetTimePointsByDate(date);
+   std::erase_if(timePoints, [&now](auto& time) { return time > now; });
+
+   return timePoints;
+}
+
+std::tuple<bool, size_t, size_t>
+ReplayNexradDataProvider::ListObjects(
+   std::chrono::system_clock::time_point date)
+{
+   const auto now = p->clock_->now();
+
+   if (!std::get<0>(p->recording_->ListObjects(date)))
+   {
+      return {false, 0, 0};
+   }
+
+   auto timePoints = p->recording_->GetTimePointsByDate(date);
+   std::erase_if(timePoints, [&now](auto& time) { return time > now; });
+
+   const std::size_t newObjects = p->AddObjects(timePoints, now);
+
+   return {true, newObjects, timePoints.size()};
+}
+
+std::shared_ptr<wsr88d::NexradFile>
+ReplayNexradDataProvider::LoadObjectByKey(const std::string& key)
+{
+   return p->recording_->LoadObjectByKey(key);
+}
+
+std::pair<size_t, size_t> ReplayNexradDataProvider::Refresh()
+{
+   using namespace std::chrono;
+
+   const auto now = p->clock_->now();
+
+   logger_->debug("Refresh(): {}", util::TimeString(now));
+
+   system_clock::time_point firstDate;
+
+   {
+      std::shared_lock lock(p->objectsMutex_);
+      firstDate = p->objects_.empty() ? now - kInitialHistory_ :
+                                        p->objects_.crbegin()->first;
+   }
+
+   auto timePoints = p->recording_->GetTimePointsByDateRange(firstDate, now);
+   std::erase_if(timePoints,
+                 [&](auto& time) { return time < firstDate || time > now; });
+
+   const std::size_t newObjects = p->AddObjects(timePoints, now);
+
+   std::shared_lock lock(p->objectsMutex_);
+   return {newObjects, p->objects_.size()};
+}
+
+std::chrono::system_clock::time_point
+ReplayNexradDataProvider::GetTimePointByKey(const std::string& key) const
+{
+   return p->recording_->GetTimePointByKey(key);
+}
+
+void ReplayNexradDataProvider::RequestAvailableProducts()
+{
+   p->recording_->RequestAvailableProducts();
+}
+
+std::vector<std::string> ReplayNexradDataProvider::GetAvailableProducts()
+{
+   return p->recording_->GetAvailableProducts();
+}
+
+std::size_t ReplayNexradDataProvider::Impl::AddObjects(
+   const std::vector<std::chrono::system_clock::time_point>& timePoints,
+   std::chrono::system_clock::time_point                     now)
+{
+   std::size_t newObjects = 0;
+
+   for (auto& time : timePoints)
+   {
+      if (time > now)
+      {
+         continue;
+      }
+
+      {
+         std::shared_lock lock(objectsMutex_);
+         if (objects_.contains(time))
+         {
+            continue;
+         }
+      }
+
+      std::string key = recording_->FindKey(time);
+      if (key.empty())
+      {
+         continue;
+      }
+
+      std::unique_lock lock(objectsMutex_);
+      if (objects_.try_emplace(time, std::move(key)).second)
+      {
+         ++newObjects;
+      }
+   }
+
+   if (newObjects > 0)
+   {
+      logger_->debug("Replayed {} objects", newObjects);
+   }
+
+   return newObjects;
+}
+
+} // namespace provider
+} // namespace scwx
@@ -0,0 +1,290 @@
+#include <scwx/provider/replay_warnings_provider.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <sstream>
+
+#if defined(_MSC_VER)
+#   pragma warning(push, 0)
+#endif
+
+#include <re2/re2.h>
+
+#if (__cpp_lib_chrono < 201907L)
+#   include <date/date.h>
+#endif
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string logPrefix_ =
+   "scwx::provider::replay_warnings_provider";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+class ReplayWarningsProvider::Impl
+{
+public:
+   struct ProductRecord
+   {
+      std::chrono::system_clock::time_point time_ {};
+      std::chrono::system_clock::time_point fileStartTime_ {};
+      std::string                           filename_ {};
+      std::string                           data_ {};
+   };
+
+   explicit Impl(const std::string&                        directory,
+                 const std::shared_ptr<const ReplayClock>& clock) :
+       directory_ {directory}, clock_ {clock}
+   {
+   }
+   ~Impl() = default;
+
+   void Scan();
+   void ScanFile(const std::filesystem::path&          path,
+                 std::chrono::system_clock::time_point fileStartTime);
+
+   static std::chrono::system_clock::time_point
+   GetProductTime(const std::string&                    data,
+                  std::chrono::system_clock::time_point fileStartTime);
+
+   const std::filesystem::path              directory_;
+   const std::shared_ptr<const ReplayClock> clock_;
+
+   std::mutex                 productsMutex_ {};
+   bool                       scanned_ {false};
+   std::size_t                fileCount_ {0u};
+   std::vector<ProductRecord> products_ {};
+   std::size_t                nextProduct_ {0u};
+};
+
+ReplayWarningsProvider::ReplayWarningsProvider(
+   const std::string&                        directory,
+   const std::shared_ptr<const ReplayClock>& clock) :
+    WarningsProvider(directory), p(std::make_unique<Impl>(directory, clock))
+{
+}
+ReplayWarningsProvider::~ReplayWarningsProvider() = default;
+
+ReplayWarningsProvider::ReplayWarningsProvider(
+   ReplayWarningsProvider&&) noexcept = default;
+ReplayWarningsProvider& ReplayWarningsProvider::operator=(
+   ReplayWarningsProvider&&) noexcept = default;
+
+std::pair<size_t, size_t> ReplayWarningsProvider::ListFiles(
+   std::chrono::system_clock::time_point newerThan)
+{
+   const auto now = p->clock_->now();
+
+   std::unique_lock lock(p->productsMutex_);
+
+   if (!p->scanned_)
+   {
+      p->Scan();
+      p->scanned_ = true;
+   }
+
+   // Files with products which have been reached, and not yet loaded
+   std::set<std::string> updatedFiles {};
+
+   for (std::size_t i = p->nextProduct_;
+        i < p->products_.size() && p->products_[i].time_ <= now;
+        ++i)
+   {
+      if (newerThan < p->products_[i].fileStartTime_)
+      {
+         updatedFiles.insert(p->products_[i].filename_);
+      }
+   }
+
+   return {updatedFiles.size(), p->fileCount_};
+}
+
+std::vector<std::shared_ptr<awips::TextProductFile>>
+ReplayWarningsProvider::LoadUpdatedFiles(
+   std::chrono::system_clock::time_point newerThan)
+{
+   const auto now = p->clock_->now();
+
+   std::string data {};
+   std::size_t productCount = 0;
+
+   std::unique_lock lock(p->productsMutex_);
+
+   for (; p->nextProduct_ < p->products_.size() &&
+          p->products_[p->nextProduct_].time_ <= now;
+        ++p->nextProduct_)
+   {
+      auto& product = p->products_[p->nextProduct_];
+
+      if (newerThan < product.fileStartTime_)
+      {
+         data += product.data_;
+         ++productCount;
+      }
+
+      // Loaded products are no longer needed
+      product.data_.clear();
+      product.data_.shrink_to_fit();
+   }
+
+   lock.unlock();
+
+   std::vector<std::shared_ptr<awips::TextProductFile>> updatedFiles {};
+
+   if (productCount == 0)
+   {
+      return updatedFiles;
+   }
+
+   logger_->debug("Loading {} products", productCount);
+
+   auto textProductFile = std::make_shared<awips::TextProductFile>();
+
+   std::istringstream is {data};
+   if (textProductFile->LoadData(is))
+   {
+      updatedFiles.push_back(textProductFile);
+   }
+
+   return updatedFiles;
+}
+
+void ReplayWarningsProvider::Impl::Scan()
+{
+   using namespace std::chrono;
+
+#if (__cpp_lib_chrono < 201907L)
+   using namespace date;
+#endif
+
+   static constexpr LazyRE2 reWarningsFilename = {
+      "warnings_[0-9]{8}_[0-9]{2}.txt"};
+   static const std::string dateTimeFormat {"warnings_%Y%m%d_%H.txt"};
+
+   std::error_code error {};
+
+   for (auto it = std::filesystem::recursive_directory_iterator(
+           directory_,
+           std::filesystem::directory_options::skip_permission_denied,
+           error);
+        it != std::filesystem::recursive_directory_iterator();
+        it.increment(error))
+   {
+      const std::string filename = it->path().filename().string();
+
+      if (!it->is_regular_file(error) ||
+          !RE2::FullMatch(filename, *reWarningsFilename))
+      {
+         continue;
+      }
+
+      std::chrono::sys_time<hours> startTime;
+      std::istringstream           ssFilename {filename};
+
+      ssFilename >> parse(dateTimeFormat, startTime);
+
+      if (!ssFilename.fail())
+      {
+         ScanFile(it->path(), startTime);
+         ++fileCount_;
+      }
+   }
+
+   // Replay products in order, regardless of the file containing them
+   std::stable_sort(products_.begin(),
+                    products_.end(),
+                    [](auto& a, auto& b) { return a.time_ < b.time_; });
+
+   logger_->info("Found {} products in {} files",
+                 products_.size(),
+                 fileCount_);
+}
+
+void ReplayWarningsProvider::Impl::ScanFile(
+   const std::filesystem::path&          path,
+   std::chrono::system_clock::time_point fileStartTime)
+{
+   // Each product ends with an ETX character
+   static constexpr char kEtx_ = '\x03';
+
+   std::ifstream f {path, std::ios_base::in | std::ios_base::binary};
+   if (!f.is_open())
+   {
+      logger_->warn("Could not open file: {}", path.string());
+      return;
+   }
+
+   std::ostringstream ss {};
+   ss << f.rdbuf();
+   const std::string data = ss.str();
+
+   const std::string filename = path.filename().string();
+
+   for (std::size_t begin = 0, end = data.find(kEtx_);
+        end != std::string::npos;
+        begin = end + 1, end = data.find(kEtx_, begin))
+   {
+      std::string product = data.substr(begin, end + 1 - begin);
+
+      products_.push_back({GetProductTime(product, fileStartTime),
+                           fileStartTime,
+                           filename,
+                           std::move(product)});
+   }
+}
+
+std::chrono::system_clock::time_point
+ReplayWarningsProvider::Impl::GetProductTime(
+   const std::string&                    data,
+   std::chrono::system_clock::time_point fileStartTime)
+{
+   using namespace std::chrono;
+
+#if (__cpp_lib_chrono < 201907L)
+   using namespace date;
+#endif
+
+   // WMO header date/time is in the format DDHHMM
+   static constexpr LazyRE2 reWmoDateTime = {
+      "(?m)^[A-Z0-9]{6} [A-Z0-9]{4} ([0-9]{2})([0-9]{2})([0-9]{2})"};
+
+   unsigned int dayOfMonth = 0;
+   int          hour       = 0;
+   int          minute     = 0;
+
+   if (!RE2::PartialMatch(
+          data, *reWmoDateTime, &dayOfMonth, &hour, &minute))
+   {
+      return fileStartTime;
+   }
+
+   // Combine the file year and month with the WMO date/time. If the product
+   // is after the file, it was issued the previous month.
+   const year_month_day fileDate {floor<days>(fileStartTime)};
+   year_month           productMonth {fileDate.year() / fileDate.month()};
+
+   auto productTime = sys_days {productMonth / day {dayOfMonth}} +
+                      hours {hour} + minutes {minute};
+
+   if (productTime > fileStartTime + 24h)
+   {
+      productMonth -= months {1};
+      productTime = sys_days {productMonth / day {dayOfMonth}} +
+                    hours {hour} + minutes {minute};
+   }
+
+   return productTime;
+}
+
+} // namespace provider
+} // namespace scwx
@@ -1,9 +1,14 @@
 #include <scwx/provider/warnings_provider.hpp>
+#include <scwx/network/cpr.hpp>
 #include <scwx/network/dir_list.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <charconv>
+#include <mutex>
+#include <optional>
 #include <ranges>
 #include <shared_mutex>
+#include <string_view>
 
 #if defined(_MSC_VER)
 #   pragma warning(push, 0)
@@ -11,8 +16,8 @@
 
 #define LIBXML_HTML_ENABLED
 #include <cpr/cpr.h>
+#include <fmt/format.h>
 #include <libxml/HTMLparser.h>
-#include <re2/re2.h>
 
 #if (__cpp_lib_chrono < 201907L)
 #   include <date/date.h>
@@ -39,6 +44,7 @@ public:
       std::chrono::system_clock::time_point lastModified_ {};
       size_t                                size_ {};
       bool                                  updated_ {};
+      size_t                                loadedSize_ {};
    };
 
    typedef std::map<std::string, FileInfoRecord> WarningFileMap;
@@ -50,10 +56,22 @@ public:
 
    ~Impl() {}
 
+   static std::size_t CompleteProductsSize(const std::string& data);
+   static std::optional<std::chrono::system_clock::time_point>
+   ParseStartTime(std::string_view filename);
+
    std::string baseUrl_;
 
-   WarningFileMap    files_;
-   std::shared_mutex filesMutex_;
+   WarningFileMap                     files_;
+   std::map<std::string, std::size_t> restoredSizes_ {};
+   mutable std::shared_mutex          filesMutex_;
+
+   std::mutex               listMutex_ {};
+   network::cpr::Validators listValidators_ {};
+
+   // Threshold of the last listing. Files not newer than the threshold were
+   // not processed, and are retained from earlier listings.
+   std::chrono::system_clock::time_point listNewerThan_ {};
 };
 
 WarningsProvider::WarningsProvider(const std::string& baseUrl) :
@@ -66,26 +84,84 @@ WarningsProvider::WarningsProvider(WarningsProvider&&) noexcept = default;
 WarningsProvider&
 WarningsProvider::operator=(WarningsProvider&&) noexcept = default;
 
-std::pair<size_t, size_t>
-WarningsProvider::ListFiles(std::chrono::system_clock::time_point newerThan)
+std::string WarningsProvider::base_url() const
 {
-   using namespace std::chrono;
+   return p->baseUrl_;
+}
 
-#if (__cpp_lib_chrono < 201907L)
-   using namespace date;
-#endif
+std::map<std::string, std::size_t> WarningsProvider::loaded_sizes() const
+{
+   std::map<std::string, std::size_t> loadedSizes {};
 
-   static constexpr LazyRE2 reWarningsFilename = {
-      "warnings_[0-9]{8}_[0-9]{2}.txt"};
-   static const std::string dateTimeFormat {"warnings_%Y%m%d_%H.txt"};
+   std::shared_lock lock(p->filesMutex_);
 
-   logger_->trace("Listing files");
+   for (auto& file : p->files_)
+   {
+      if (file.second.loadedSize_ > 0)
+      {
+         loadedSizes.emplace(file.first, file.second.loadedSize_);
+      }
+   }
+
+   return loadedSizes;
+}
+
+void WarningsProvider::RestoreLoadedSizes(
+   const std::map<std::string, std::size_t>& loadedSizes)
+{
+   std::unique_lock lock(p->filesMutex_);
+   p->restoredSizes_ = loadedSizes;
+}
+
+std::pair<size_t, size_t>
+WarningsProvider::ListFiles(std::chrono::system_clock::time_point newerThan)
+{
+   SPDLOG_LOGGER_TRACE(logger_, "Listing files");
 
    size_t updatedObjects = 0;
    size_t totalObjects   = 0;
 
-   // Perform a directory listing
-   auto records = network::DirList(p->baseUrl_);
+   std::unique_lock listLock(p->listMutex_);
+
+   // Files older than the threshold of the last listing were not processed, so
+   // a listing for an earlier threshold cannot be skipped as unmodified
+   if (newerThan < p->listNewerThan_)
+   {
+      p->listValidators_ = {};
+   }
+   p->listNewerThan_ = newerThan;
+
+   // Perform a directory listing, unless it is unchanged since the last
+   // listing. Only warnings files newer than the threshold are processed.
+   auto listing = network::DirList(
+      p->baseUrl_,
+      p->listValidators_,
+      [newerThan](std::string_view filename)
+      {
+         auto startTime = Impl::ParseStartTime(filename);
+         return startTime.has_value() && newerThan < startTime.value();
+      });
+
+   if (!listing.has_value())
+   {
+      std::shared_lock lock(p->filesMutex_);
+
+      for (auto& file : p->files_)
+      {
+         if (newerThan < file.second.startTime_)
+         {
+            if (file.second.updated_)
+            {
+               ++updatedObjects;
+            }
+            ++totalObjects;
+         }
+      }
+
+      return std::make_pair(updatedObjects, totalObjects);
+   }
+
+   auto& records = listing.value();
 
    // Sort records by filename
    std::sort(records.begin(),
@@ -97,72 +173,144 @@ WarningsProvider::ListFiles(std::chrono::system_clock::time_point newerThan)
       records |
       std::views::filter(
          [](auto& record)
-         {
-            return record.type_ == std::filesystem::file_type::regular &&
-                   RE2::FullMatch(record.filename_, *reWarningsFilename);
-         });
+         { return record.type_ == std::filesystem::file_type::regular; });
 
    std::unique_lock lock(p->filesMutex_);
 
    Impl::WarningFileMap warningFileMap;
 
+   // Retain files which were not processed, along with their loaded size
+   for (auto& file : p->files_)
+   {
+      if (file.second.startTime_ <= newerThan)
+      {
+         warningFileMap.insert(file);
+      }
+   }
+
    // Store records
    for (auto& record : warningRecords)
    {
-      // Determine start time
-      std::chrono::sys_time<hours> startTime;
-      std::istringstream           ssFilename {record.filename_};
-
-      ssFilename >> parse(dateTimeFormat, startTime);
-
-      // If start time is valid
-      if (!ssFilename.fail())
+      // Determine start time, which is valid for each listed file
+      auto startTime = Impl::ParseStartTime(record.filename_).value();
+
+      // Determine if the record should be marked updated
+      bool   updated    = true;
+      size_t loadedSize = 0;
+      auto   it         = p->files_.find(record.filename_);
+      if (it != p->files_.cend())
       {
-         // Determine if the record should be marked updated
-         bool updated = true;
-         auto it      = p->files_.find(record.filename_);
-         if (it != p->files_.cend())
-         {
-            auto& existingRecord = it->second;
+         auto& existingRecord = it->second;
 
-            updated = existingRecord.updated_ ||
-                      record.size_ != existingRecord.size_ ||
-                      record.mtime_ != existingRecord.lastModified_;
-         }
+         updated = existingRecord.updated_ ||
+                   record.size_ != existingRecord.size_ ||
+                   record.mtime_ != existingRecord.lastModified_;
 
-         // Update object counts, but only if newer than threshold
-         if (newerThan < startTime)
+         // Warnings files are only appended to. Keep the loaded size, unless
+         // the file has become smaller and has been replaced.
+         if (record.size_ >= existingRecord.size_)
          {
-            if (updated)
-            {
-               ++updatedObjects;
-            }
-            ++totalObjects;
+            loadedSize = existingRecord.loadedSize_;
          }
+      }
+      else if (auto restoredIt = p->restoredSizes_.find(record.filename_);
+               restoredIt != p->restoredSizes_.cend() &&
+               record.size_ >= restoredIt->second)
+      {
+         // The file was loaded in a previous session. Only the data appended
+         // since needs to be loaded.
+         loadedSize = restoredIt->second;
+         updated    = record.size_ > loadedSize;
+      }
 
-         // Store record
-         warningFileMap.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(record.filename_),
-            std::forward_as_tuple(
-               startTime, record.mtime_, record.size_, updated));
+      // Update object counts
+      if (updated)
+      {
+         ++updatedObjects;
       }
+      ++totalObjects;
+
+      // Store record
+      warningFileMap.emplace(
+         std::piecewise_construct,
+         std::forward_as_tuple(record.filename_),
+         std::forward_as_tuple(
+            startTime, record.mtime_, record.size_, updated, loadedSize));
    }
 
    p->files_ = std::move(warningFileMap);
 
+   // Restored sizes only apply to the first listing
+   p->restoredSizes_.clear();
+
    return std::make_pair(updatedObjects, totalObjects);
 }
 
+std::optional<std::chrono::system_clock::time_point>
+WarningsProvider::Impl::ParseStartTime(std::string_view filename)
+{
+   using namespace std::chrono;
+
+#if (__cpp_lib_chrono < 201907L)
+   using namespace date;
+#endif
+
+   // Filename format: warnings_yyyymmdd_hh.txt
+   static constexpr std::string_view kFilenameFormat {
+      "warnings_00000000_00.txt"};
+
+   if (filename.size() != kFilenameFormat.size())
+   {
+      return std::nullopt;
+   }
+
+   for (std::size_t i = 0; i < kFilenameFormat.size(); ++i)
+   {
+      const bool isDigit = filename[i] >= '0' && filename[i] <= '9';
+      if ((kFilenameFormat[i] == '0') ? !isDigit :
+                                        filename[i] != kFilenameFormat[i])
+      {
+         return std::nullopt;
+      }
+   }
+
+   auto field = [&filename](std::size_t offset, std::size_t length)
+   {
+      unsigned int value = 0;
+      std::from_chars(
+         filename.data() + offset, filename.data() + offset + length, value);
+      return value;
+   };
+
+   const year_month_day ymd {year {static_cast<int>(field(9, 4))},
+                             month {field(13, 2)},
+                             day {field(15, 2)}};
+   const unsigned int   hour = field(18, 2);
+
+   if (!ymd.ok() || hour > 23)
+   {
+      return std::nullopt;
+   }
+
+   return sys_days {ymd} + hours {hour};
+}
+
 std::vector<std::shared_ptr<awips::TextProductFile>>
 WarningsProvider::LoadUpdatedFiles(
    std::chrono::system_clock::time_point newerThan)
 {
    logger_->debug("Loading updated files");
 
+   struct AsyncFileResponse
+   {
+      std::string        filename_;
+      size_t             offset_;
+      cpr::AsyncResponse response_;
+   };
+
    std::vector<std::shared_ptr<awips::TextProductFile>> updatedFiles;
 
-   std::vector<std::pair<std::string, cpr::AsyncResponse>> asyncResponses;
+   std::vector<AsyncFileResponse> asyncResponses;
 
    std::unique_lock lock(p->filesMutex_);
 
@@ -172,10 +320,21 @@ WarningsProvider::LoadUpdatedFiles(
       // If file is updated, and time is later than the threshold
       if (record.second.updated_ && newerThan < record.second.startTime_)
       {
-         // Retrieve warning file
-         asyncResponses.emplace_back(
-            record.first,
-            cpr::GetAsync(cpr::Url {p->baseUrl_ + "/" + record.first}));
+         // Warnings files are only appended to. If part of the file has
+         // already been loaded, request only the data appended since.
+         const size_t offset = record.second.loadedSize_;
+         cpr::Header  header = network::cpr::GetHeader();
+         if (offset > 0)
+         {
+            header["Range"] = fmt::format("bytes={}-", offset);
+         }
+
+         // Retrieve warning file, reusing connections to the server
+         asyncResponses.push_back(
+            {record.first,
+             offset,
+             network::cpr::GetAsync(
+                cpr::Url {p->baseUrl_ + "/" + record.first}, header)});
 
          // Clear updated flag
          record.second.updated_ = false;
@@ -187,24 +346,81 @@ WarningsProvider::LoadUpdatedFiles(
    // Wait for warning files to load
    for (auto& asyncResponse : asyncResponses)
    {
-      cpr::Response response = asyncResponse.second.get();
+      cpr::Response response = asyncResponse.response_.get();
+
+      size_t offset;
       if (response.status_code == cpr::status::HTTP_OK)
       {
-         logger_->debug("Loading file: {}", asyncResponse.first);
+         // The server sent the entire file
+         offset = 0;
+      }
+      else if (response.status_code == cpr::status::HTTP_PARTIAL_CONTENT &&
+               response.header["Content-Range"].starts_with(
+                  fmt::format("bytes {}-", asyncResponse.offset_)))
+      {
+         // The server sent the data appended since the last load
+         offset = asyncResponse.offset_;
+      }
+      else
+      {
+         // No new data is available (e.g., 416 Range Not Satisfiable), or the
+         // request failed
+         continue;
+      }
+
+      // Only load complete products. A product still being written is loaded
+      // in full once it is complete.
+      size_t completeSize = Impl::CompleteProductsSize(response.text);
+      if (completeSize == 0)
+      {
+         if (offset > 0)
+         {
+            // No complete products have been appended
+            continue;
+         }
 
-         // Load file
-         std::shared_ptr<awips::TextProductFile> textProductFile {
-            std::make_shared<awips::TextProductFile>()};
-         std::istringstream responseBody {response.text};
-         if (textProductFile->LoadData(responseBody))
+         // The file is not delimited into products, and must be loaded in
+         // full each time it is updated
+         completeSize = response.text.size();
+      }
+      else
+      {
+         std::unique_lock recordLock(p->filesMutex_);
+
+         auto it = p->files_.find(asyncResponse.filename_);
+         if (it != p->files_.end())
          {
-            updatedFiles.push_back(textProductFile);
+            it->second.loadedSize_ = offset + completeSize;
          }
       }
+
+      logger_->debug("Loading file: {} ({} bytes from offset {})",
+                     asyncResponse.filename_,
+                     completeSize,
+                     offset);
+
+      // Load file
+      std::shared_ptr<awips::TextProductFile> textProductFile {
+         std::make_shared<awips::TextProductFile>()};
+      std::istringstream responseBody {response.text.substr(0, completeSize)};
+      if (textProductFile->LoadData(responseBody))
+      {
+         updatedFiles.push_back(textProductFile);
+      }
    }
 
    return updatedFiles;
 }
 
+std::size_t
+WarningsProvider::Impl::CompleteProductsSize(const std::string& data)
+{
+   // Each product ends with an ETX character
+   static constexpr char kEtx_ = '\x03';
+
+   const size_t lastEtx = data.rfind(kEtx_);
+   return (lastEtx == std::string::npos) ? 0 : lastEtx + 1;
+}
+
 } // namespace provider
 } // namespace scwx
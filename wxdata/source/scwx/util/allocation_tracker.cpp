@@ -0,0 +1,116 @@
+#include <scwx/util/allocation_tracker.hpp>
+
+#if defined(SCWX_ALLOCATION_TRACKING)
+#   include <algorithm>
+#   include <atomic>
+#   include <cstdlib>
+#   include <new>
+#endif
+
+namespace scwx
+{
+namespace util
+{
+
+#if defined(SCWX_ALLOCATION_TRACKING)
+
+// Thread counts are only written by their own thread, and are not atomic
+static thread_local AllocationCount threadCount_ {};
+
+static std::atomic<std::uint64_t> processAllocations_ {0u};
+static std::atomic<std::uint64_t> processBytes_ {0u};
+
+static void CountAllocation(std::size_t size)
+{
+   ++threadCount_.allocations_;
+   threadCount_.bytes_ += size;
+
+   processAllocations_.fetch_add(1u, std::memory_order_relaxed);
+   processBytes_.fetch_add(size, std::memory_order_relaxed);
+}
+
+#endif
+
+bool AllocationTracker::IsAvailable()
+{
+#if defined(SCWX_ALLOCATION_TRACKING)
+   return true;
+#else
+   return false;
+#endif
+}
+
+AllocationCount AllocationTracker::GetThreadCount()
+{
+#if defined(SCWX_ALLOCATION_TRACKING)
+   return threadCount_;
+#else
+   return {};
+#endif
+}
+
+AllocationCount AllocationTracker::GetProcessCount()
+{
+#if defined(SCWX_ALLOCATION_TRACKING)
+   return {.allocations_ = processAllocations_.load(std::memory_order_relaxed),
+           .bytes_       = processBytes_.load(std::memory_order_relaxed)};
+#else
+   return {};
+#endif
+}
+
+} // namespace util
+} // namespace scwx
+
+#if defined(SCWX_ALLOCATION_TRACKING)
+
+// The remaining forms of operator new and delete, including the array and
+// nothrow forms, forward to these by default
+void* operator new(std::size_t size)
+{
+   scwx::util::CountAllocation(size);
+
+   void* p = std::malloc(size != 0u ? size : 1u);
+   if (p == nullptr)
+   {
+      throw std::bad_alloc();
+   }
+   return p;
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+   scwx::util::CountAllocation(size);
+
+   const std::size_t align = static_cast<std::size_t>(alignment);
+
+#   if defined(_MSC_VER)
+   void* p = _aligned_malloc(size != 0u ? size : 1u, align);
+#   else
+   // The size must be a nonzero multiple of the alignment
+   const std::size_t alignedSize =
+      (std::max<std::size_t>(size, 1u) + align - 1u) / align * align;
+   void* p = std::aligned_alloc(align, alignedSize);
+#   endif
+   if (p == nullptr)
+   {
+      throw std::bad_alloc();
+   }
+   return p;
+}
+
+void operator delete(void* p) noexcept
+{
+   std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t /* alignment */) noexcept
+{
+#   if defined(_MSC_VER)
+   _aligned_free(p);
+#   else
+   std::free(p);
+#   endif
+}
+
+#endif
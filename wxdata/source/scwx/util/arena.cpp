@@ -0,0 +1,36 @@
+#include <scwx/util/arena.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+Arena::Arena(std::size_t initialSize) : mutex_ {}, resource_ {initialSize} {}
+Arena::~Arena() = default;
+
+std::size_t Arena::bytes_allocated() const
+{
+   return bytesAllocated_;
+}
+
+void* Arena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+   std::unique_lock lock(mutex_);
+   bytesAllocated_ += bytes;
+   return resource_.allocate(bytes, alignment);
+}
+
+void Arena::do_deallocate(void* /* p */,
+                          std::size_t /* bytes */,
+                          std::size_t /* alignment */)
+{
+   // Memory is released when the arena is destroyed
+}
+
+bool Arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+   return this == &other;
+}
+
+} // namespace util
+} // namespace scwx
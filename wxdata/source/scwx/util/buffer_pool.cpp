@@ -0,0 +1,187 @@
+#include <scwx/util/buffer_pool.hpp>
+
+#include <iterator>
+#include <map>
+#include <mutex>
+
+namespace scwx
+{
+namespace util
+{
+
+// A pooled buffer is only reused for a sized request if its capacity exceeds
+// the request by no more than a quarter
+static constexpr std::size_t kMaxSlackDivisor_ = 4u;
+
+class BufferPool::Impl
+{
+public:
+   explicit Impl(std::size_t maxIdleBytes, std::size_t maxBufferCapacity) :
+       maxIdleBytes_ {maxIdleBytes}, maxBufferCapacity_ {maxBufferCapacity}
+   {
+   }
+   ~Impl() = default;
+
+   std::unique_ptr<Buffer> Take(std::size_t capacity);
+   void                    Release(Buffer* buffer);
+
+   const std::size_t maxIdleBytes_;
+   const std::size_t maxBufferCapacity_;
+
+   // Idle buffers by capacity
+   std::multimap<std::size_t, std::unique_ptr<Buffer>> idleBuffers_ {};
+   std::size_t                                         idleBytes_ {0};
+   mutable std::mutex                                  idleBuffersMutex_ {};
+};
+
+BufferPool::BufferPool(std::size_t maxIdleBytes,
+                       std::size_t maxBufferCapacity) :
+    p(std::make_shared<Impl>(maxIdleBytes, maxBufferCapacity))
+{
+}
+BufferPool::~BufferPool() = default;
+
+BufferPool::BufferPool(BufferPool&&) noexcept            = default;
+BufferPool& BufferPool::operator=(BufferPool&&) noexcept = default;
+
+std::unique_ptr<BufferPool::Buffer>
+BufferPool::Impl::Take(std::size_t capacity)
+{
+   std::unique_lock lock(idleBuffersMutex_);
+
+   if (idleBuffers_.empty())
+   {
+      return nullptr;
+   }
+
+   auto it = idleBuffers_.end();
+
+   if (capacity == 0)
+   {
+      // The size is not known, so the buffer least likely to grow is used
+      it = std::prev(idleBuffers_.end());
+   }
+   else
+   {
+      // Use the smallest buffer large enough, if it is not much larger
+      it = idleBuffers_.lower_bound(capacity);
+      if (it != idleBuffers_.end() &&
+          it->first - capacity > capacity / kMaxSlackDivisor_)
+      {
+         it = idleBuffers_.end();
+      }
+   }
+
+   if (it == idleBuffers_.end())
+   {
+      return nullptr;
+   }
+
+   std::unique_ptr<Buffer> buffer = std::move(it->second);
+   idleBytes_ -= it->first;
+   idleBuffers_.erase(it);
+
+   return buffer;
+}
+
+std::shared_ptr<BufferPool::Buffer> BufferPool::Acquire(std::size_t capacity)
+{
+   std::unique_ptr<Buffer> buffer = p->Take(capacity);
+
+   if (buffer == nullptr)
+   {
+      buffer = std::make_unique<Buffer>();
+   }
+
+   buffer->reserve(capacity);
+
+   std::weak_ptr<Impl> pool = p;
+
+   return std::shared_ptr<Buffer>(buffer.release(),
+                                  [pool](Buffer* released)
+                                  {
+                                     auto impl = pool.lock();
+                                     if (impl != nullptr)
+                                     {
+                                        impl->Release(released);
+                                     }
+                                     else
+                                     {
+                                        delete released;
+                                     }
+                                  });
+}
+
+std::shared_ptr<BufferPool::Buffer>
+BufferPool::ShrinkToFit(const std::shared_ptr<Buffer>& buffer)
+{
+   const std::size_t size = buffer->size();
+
+   if (buffer->capacity() - size <= size / kMaxSlackDivisor_)
+   {
+      return buffer;
+   }
+
+   // Copy the contents to a buffer of the right size. The original buffer
+   // returns to the pool once released by the caller.
+   std::shared_ptr<Buffer> fitted = Acquire(size);
+   fitted->assign(buffer->cbegin(), buffer->cend());
+
+   return fitted;
+}
+
+void BufferPool::Impl::Release(Buffer* buffer)
+{
+   std::unique_ptr<Buffer> releasedBuffer {buffer};
+
+   const std::size_t capacity = releasedBuffer->capacity();
+
+   if (capacity == 0 || capacity > maxBufferCapacity_)
+   {
+      // Don't retain empty or oversized buffers
+      return;
+   }
+
+   releasedBuffer->clear();
+
+   std::unique_lock lock(idleBuffersMutex_);
+
+   if (idleBytes_ + capacity <= maxIdleBytes_)
+   {
+      idleBuffers_.emplace(capacity, std::move(releasedBuffer));
+      idleBytes_ += capacity;
+   }
+}
+
+std::size_t BufferPool::idle_count() const
+{
+   std::unique_lock lock(p->idleBuffersMutex_);
+   return p->idleBuffers_.size();
+}
+
+std::size_t BufferPool::idle_bytes() const
+{
+   std::unique_lock lock(p->idleBuffersMutex_);
+   return p->idleBytes_;
+}
+
+void BufferPool::Clear()
+{
+   std::multimap<std::size_t, std::unique_ptr<Buffer>> idleBuffers {};
+
+   {
+      std::unique_lock lock(p->idleBuffersMutex_);
+      idleBuffers.swap(p->idleBuffers_);
+      p->idleBytes_ = 0;
+   }
+}
+
+std::shared_ptr<BufferPool> BufferPool::Instance()
+{
+   static std::shared_ptr<BufferPool> bufferPool =
+      std::make_shared<BufferPool>();
+   return bufferPool;
+}
+
+} // namespace util
+} // namespace scwx
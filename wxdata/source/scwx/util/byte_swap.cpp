@@ -0,0 +1,238 @@
+#include <scwx/util/byte_swap.hpp>
+
+#include <array>
+#include <cstring>
+
+#ifdef _WIN32
+#   include <WinSock2.h>
+#else
+#   include <arpa/inet.h>
+#endif
+
+#if defined(SCWX_ARCH_X86)
+#   include <immintrin.h>
+#elif defined(__ARM_NEON) && !defined(__ARM_BIG_ENDIAN)
+#   include <arm_neon.h>
+#   define SCWX_BYTE_SWAP_NEON
+#endif
+
+namespace scwx
+{
+namespace util
+{
+
+#if defined(SCWX_ARCH_X86)
+static constexpr std::array<std::uint8_t, 32> kSwap16Mask_ = {
+   1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+   1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14};
+static constexpr std::array<std::uint8_t, 32> kSwap32Mask_ = {
+   3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+   3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12};
+#endif
+
+// The vector variants assume a little-endian host, which is true of every x86
+// and every supported ARM target. Any remainder is handled by the scalar
+// variant.
+
+static void BigEndianToHost16Scalar(std::uint16_t* data, std::size_t count)
+{
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      data[i] = ntohs(data[i]);
+   }
+}
+
+static void BigEndianToHost32Scalar(std::uint32_t* data, std::size_t count)
+{
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      data[i] = ntohl(data[i]);
+   }
+}
+
+#if defined(SCWX_ARCH_X86)
+SCWX_TARGET("sse2")
+static void BigEndianToHost16SSE2(std::uint16_t* data, std::size_t count)
+{
+   std::size_t i = 0;
+
+   for (; i + 8 <= count; i += 8)
+   {
+      __m128i* p = reinterpret_cast<__m128i*>(data + i);
+      __m128i  v = _mm_loadu_si128(p);
+      v          = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+      _mm_storeu_si128(p, v);
+   }
+
+   BigEndianToHost16Scalar(data + i, count - i);
+}
+
+SCWX_TARGET("sse2")
+static void BigEndianToHost32SSE2(std::uint32_t* data, std::size_t count)
+{
+   std::size_t i = 0;
+
+   for (; i + 4 <= count; i += 4)
+   {
+      __m128i* p = reinterpret_cast<__m128i*>(data + i);
+      __m128i  v = _mm_loadu_si128(p);
+
+      // Swap bytes within each 16-bit word, then swap the 16-bit words
+      v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+      v = _mm_or_si128(_mm_slli_epi32(v, 16), _mm_srli_epi32(v, 16));
+      _mm_storeu_si128(p, v);
+   }
+
+   BigEndianToHost32Scalar(data + i, count - i);
+}
+
+SCWX_TARGET("sse4.2")
+static void BigEndianToHost16SSE42(std::uint16_t* data, std::size_t count)
+{
+   std::size_t i = 0;
+
+   const __m128i mask =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(kSwap16Mask_.data()));
+   for (; i + 8 <= count; i += 8)
+   {
+      __m128i* p = reinterpret_cast<__m128i*>(data + i);
+      _mm_storeu_si128(p, _mm_shuffle_epi8(_mm_loadu_si128(p), mask));
+   }
+
+   BigEndianToHost16Scalar(data + i, count - i);
+}
+
+SCWX_TARGET("sse4.2")
+static void BigEndianToHost32SSE42(std::uint32_t* data, std::size_t count)
+{
+   std::size_t i = 0;
+
+   const __m128i mask =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(kSwap32Mask_.data()));
+   for (; i + 4 <= count; i += 4)
+   {
+      __m128i* p = reinterpret_cast<__m128i*>(data + i);
+      _mm_storeu_si128(p, _mm_shuffle_epi8(_mm_loadu_si128(p), mask));
+   }
+
+   BigEndianToHost32Scalar(data + i, count - i);
+}
+
+SCWX_TARGET("avx2")
+static void BigEndianToHost16AVX2(std::uint16_t* data, std::size_t count)
+{
+   std::size_t i = 0;
+
+   const __m256i mask = _mm256_loadu_si256(
+      reinterpret_cast<const __m256i*>(kSwap16Mask_.data()));
+   for (; i + 16 <= count; i += 16)
+   {
+      __m256i* p = reinterpret_cast<__m256i*>(data + i);
+      _mm256_storeu_si256(p,
+                          _mm256_shuffle_epi8(_mm256_loadu_si256(p), mask));
+   }
+
+   BigEndianToHost16Scalar(data + i, count - i);
+}
+
+SCWX_TARGET("avx2")
+static void BigEndianToHost32AVX2(std::uint32_t* data, std::size_t count)
+{
+   std::size_t i = 0;
+
+   const __m256i mask = _mm256_loadu_si256(
+      reinterpret_cast<const __m256i*>(kSwap32Mask_.data()));
+   for (; i + 8 <= count; i += 8)
+   {
+      __m256i* p = reinterpret_cast<__m256i*>(data + i);
+      _mm256_storeu_si256(p,
+                          _mm256_shuffle_epi8(_mm256_loadu_si256(p), mask));
+   }
+
+   BigEndianToHost32Scalar(data + i, count - i);
+}
+#endif
+
+#if defined(SCWX_BYTE_SWAP_NEON)
+static void BigEndianToHost16NEON(std::uint16_t* data, std::size_t count)
+{
+   std::size_t i = 0;
+
+   for (; i + 8 <= count; i += 8)
+   {
+      std::uint8_t* p = reinterpret_cast<std::uint8_t*>(data + i);
+      vst1q_u8(p, vrev16q_u8(vld1q_u8(p)));
+   }
+
+   BigEndianToHost16Scalar(data + i, count - i);
+}
+
+static void BigEndianToHost32NEON(std::uint32_t* data, std::size_t count)
+{
+   std::size_t i = 0;
+
+   for (; i + 4 <= count; i += 4)
+   {
+      std::uint8_t* p = reinterpret_cast<std::uint8_t*>(data + i);
+      vst1q_u8(p, vrev32q_u8(vld1q_u8(p)));
+   }
+
+   BigEndianToHost32Scalar(data + i, count - i);
+}
+#endif
+
+const KernelTable<BigEndianToHost16Function>& BigEndianToHost16Kernels()
+{
+   static const KernelTable<BigEndianToHost16Function> kernels_ {
+#if defined(SCWX_ARCH_X86)
+      {InstructionSet::AVX2, &BigEndianToHost16AVX2},
+      {InstructionSet::SSE4_2, &BigEndianToHost16SSE42},
+      {InstructionSet::SSE2, &BigEndianToHost16SSE2},
+#elif defined(SCWX_BYTE_SWAP_NEON)
+      {InstructionSet::NEON, &BigEndianToHost16NEON},
+#endif
+      {InstructionSet::Scalar, &BigEndianToHost16Scalar}};
+
+   return kernels_;
+}
+
+const KernelTable<BigEndianToHost32Function>& BigEndianToHost32Kernels()
+{
+   static const KernelTable<BigEndianToHost32Function> kernels_ {
+#if defined(SCWX_ARCH_X86)
+      {InstructionSet::AVX2, &BigEndianToHost32AVX2},
+      {InstructionSet::SSE4_2, &BigEndianToHost32SSE42},
+      {InstructionSet::SSE2, &BigEndianToHost32SSE2},
+#elif defined(SCWX_BYTE_SWAP_NEON)
+      {InstructionSet::NEON, &BigEndianToHost32NEON},
+#endif
+      {InstructionSet::Scalar, &BigEndianToHost32Scalar}};
+
+   return kernels_;
+}
+
+void BigEndianToHost16(std::uint16_t* data, std::size_t count)
+{
+   BigEndianToHost16Kernels()(data, count);
+}
+
+void BigEndianToHost32(std::uint32_t* data, std::size_t count)
+{
+   BigEndianToHost32Kernels()(data, count);
+}
+
+void BigEndianToHostFloat(float* data, std::size_t count)
+{
+   static_assert(sizeof(float) == sizeof(std::uint32_t));
+
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      std::uint32_t temp;
+      std::memcpy(&temp, &data[i], sizeof(std::uint32_t));
+      temp = ntohl(temp);
+      std::memcpy(&data[i], &temp, sizeof(float));
+   }
+}
+
+} // namespace util
+} // namespace scwx
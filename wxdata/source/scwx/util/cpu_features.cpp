@@ -0,0 +1,165 @@
+#include <scwx/util/cpu_features.hpp>
+#include <scwx/util/enum.hpp>
+#include <scwx/util/environment.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <array>
+#include <unordered_map>
+
+#include <boost/algorithm/string.hpp>
+
+#if defined(SCWX_ARCH_X86) && defined(_MSC_VER)
+#   include <intrin.h>
+#   include <immintrin.h>
+#endif
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ {"scwx::util::cpu_features"};
+static const auto        logger_ = util::Logger::Create(logPrefix_);
+
+static const std::unordered_map<InstructionSet, std::string>
+   instructionSetName_ {{InstructionSet::Scalar, "Scalar"},
+                        {InstructionSet::SSE2, "SSE2"},
+                        {InstructionSet::SSE4_2, "SSE4.2"},
+                        {InstructionSet::AVX2, "AVX2"},
+                        {InstructionSet::AVX512, "AVX-512"},
+                        {InstructionSet::NEON, "NEON"},
+                        {InstructionSet::Unknown, "?"}};
+
+struct CpuFeatures
+{
+   bool sse2_ {false};
+   bool sse4_2_ {false};
+   bool avx2_ {false};
+   bool avx512_ {false};
+   bool neon_ {false};
+};
+
+static CpuFeatures DetectCpuFeatures();
+
+SCWX_GET_ENUM(InstructionSet, GetInstructionSet, instructionSetName_)
+
+const std::string& GetInstructionSetName(InstructionSet instructionSet)
+{
+   return instructionSetName_.at(instructionSet);
+}
+
+bool IsInstructionSetSupported(InstructionSet instructionSet)
+{
+   static const CpuFeatures features = DetectCpuFeatures();
+
+   switch (instructionSet)
+   {
+   case InstructionSet::Scalar:
+      return true;
+   case InstructionSet::SSE2:
+      return features.sse2_;
+   case InstructionSet::SSE4_2:
+      return features.sse4_2_;
+   case InstructionSet::AVX2:
+      return features.avx2_;
+   case InstructionSet::AVX512:
+      return features.avx512_;
+   case InstructionSet::NEON:
+      return features.neon_;
+   default:
+      return false;
+   }
+}
+
+InstructionSet GetInstructionSetLimit()
+{
+   static const InstructionSet limit = []()
+   {
+      const std::string name = GetEnvironment("SCWX_INSTRUCTION_SET");
+      if (name.empty())
+      {
+         return InstructionSet::Unknown;
+      }
+
+      const InstructionSet instructionSet = GetInstructionSet(name);
+      if (instructionSet == InstructionSet::Unknown)
+      {
+         logger_->warn("Unknown instruction set: {}", name);
+      }
+      else
+      {
+         logger_->info("Instruction set limited to {}",
+                       GetInstructionSetName(instructionSet));
+      }
+
+      return instructionSet;
+   }();
+
+   return limit;
+}
+
+static CpuFeatures DetectCpuFeatures()
+{
+   CpuFeatures features {};
+
+#if defined(SCWX_ARCH_X86)
+#   if defined(_MSC_VER)
+   std::array<int, 4> info {};
+
+   __cpuid(info.data(), 0);
+   const int maxLeaf = info[0];
+
+   __cpuid(info.data(), 1);
+   const bool sse2    = (info[3] & (1 << 26)) != 0;
+   const bool sse4_2  = (info[2] & (1 << 20)) != 0;
+   const bool osxsave = (info[2] & (1 << 27)) != 0;
+   const bool avx     = (info[2] & (1 << 28)) != 0;
+
+   bool avx2     = false;
+   bool avx512f  = false;
+   bool avx512bw = false;
+   if (maxLeaf >= 7)
+   {
+      __cpuidex(info.data(), 7, 0);
+      avx2     = (info[1] & (1 << 5)) != 0;
+      avx512f  = (info[1] & (1 << 16)) != 0;
+      avx512bw = (info[1] & (1 << 30)) != 0;
+   }
+
+   // The operating system must save the vector registers on context switch
+   const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+   const bool               ymm  = (xcr0 & 0x06) == 0x06;
+   const bool               zmm  = (xcr0 & 0xe6) == 0xe6;
+
+   features.sse2_   = sse2;
+   features.sse4_2_ = sse4_2;
+   features.avx2_   = avx && avx2 && ymm;
+   features.avx512_ = features.avx2_ && avx512f && avx512bw && zmm;
+#   else
+   // The GCC and Clang builtins include the operating system support checks
+   __builtin_cpu_init();
+
+   features.sse2_   = __builtin_cpu_supports("sse2");
+   features.sse4_2_ = __builtin_cpu_supports("sse4.2");
+   features.avx2_   = __builtin_cpu_supports("avx2");
+   features.avx512_ = features.avx2_ && __builtin_cpu_supports("avx512f") &&
+                      __builtin_cpu_supports("avx512bw");
+#   endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+   // NEON is required by AArch64, and by any 32-bit ARM build with NEON enabled
+   features.neon_ = true;
+#endif
+
+   logger_->debug("CPU features: SSE2={}, SSE4.2={}, AVX2={}, AVX-512={}, "
+                  "NEON={}",
+                  features.sse2_,
+                  features.sse4_2_,
+                  features.avx2_,
+                  features.avx512_,
+                  features.neon_);
+
+   return features;
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,31 @@
+#include <scwx/util/detached_task.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <exception>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::detached_task";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+void DetachedTask::promise_type::unhandled_exception() const noexcept
+{
+   try
+   {
+      std::rethrow_exception(std::current_exception());
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->error(ex.what());
+   }
+   catch (...)
+   {
+      logger_->error("Unknown exception");
+   }
+}
+
+} // namespace util
+} // namespace scwx
@@ -1,9 +1,16 @@
 #include <scwx/util/logger.hpp>
 
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
+#include <thread>
+#include <vector>
 
-#include <spdlog/spdlog.h>
+#include <fmt/format.h>
+#include <spdlog/details/circular_q.h>
+#include <spdlog/details/log_msg_buffer.h>
 #include <spdlog/sinks/rotating_file_sink.h>
+#include <spdlog/sinks/sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
 namespace scwx
@@ -15,7 +22,252 @@ namespace Logger
 
 static const std::string logPattern_ = "[%Y-%m-%d %T.%e] [%t] [%^%l%$] [%n] %v";
 
-static std::vector<std::shared_ptr<spdlog::sinks::sink>> extraSinks_ {};
+/**
+ * Distributes the messages of all loggers to the registered sinks, either on
+ * the logging thread, or on a background thread. Consecutive identical
+ * messages are collapsed into a repeat count.
+ */
+class DispatchSink : public spdlog::sinks::sink
+{
+public:
+   explicit DispatchSink() = default;
+   ~DispatchSink() { SetAsync(false); }
+
+   DispatchSink(const DispatchSink&)            = delete;
+   DispatchSink& operator=(const DispatchSink&) = delete;
+
+   void log(const spdlog::details::log_msg& msg) override;
+   void flush() override;
+   void set_pattern(const std::string& pattern) override;
+   void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override;
+
+   void AddSink(std::shared_ptr<spdlog::sinks::sink> sink);
+   void SetAsync(bool async);
+   void WriteRepeatCount();
+
+private:
+   void Dispatch(const spdlog::details::log_msg& msg);
+   void DispatchRepeatCount();
+   void Write(const spdlog::details::log_msg& msg);
+   void WriteQueue();
+
+   static constexpr std::size_t kQueueSize_ = 8192u;
+
+   // Identical messages are collapsed for up to this long, after which the
+   // repeat count is written along with the message
+   static constexpr std::chrono::seconds kRepeatInterval_ {10};
+
+   std::mutex                                        sinksMutex_ {};
+   std::vector<std::shared_ptr<spdlog::sinks::sink>> sinks_ {};
+
+   std::mutex                    repeatMutex_ {};
+   std::string                   lastLoggerName_ {};
+   std::string                   lastPayload_ {};
+   spdlog::level::level_enum     lastLevel_ {spdlog::level::off};
+   spdlog::log_clock::time_point repeatStart_ {};
+   std::size_t                   repeatCount_ {0u};
+
+   std::mutex              queueMutex_ {};
+   std::condition_variable queueCondition_ {};
+   bool                    async_ {false};
+   bool                    stopping_ {false};
+   std::thread             writerThread_ {};
+   std::size_t             droppedCount_ {0u};
+
+   spdlog::details::circular_q<spdlog::details::log_msg_buffer> queue_ {
+      kQueueSize_};
+};
+
+static std::shared_ptr<DispatchSink> GetDispatchSink()
+{
+   // Loggers are created during static initialization, so the sink is created
+   // on first use
+   static auto dispatchSink = []()
+   {
+      auto sink = std::make_shared<DispatchSink>();
+      sink->AddSink(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
+      return sink;
+   }();
+   return dispatchSink;
+}
+
+void DispatchSink::log(const spdlog::details::log_msg& msg)
+{
+   std::unique_lock lock {repeatMutex_};
+
+   const bool repeated = msg.logger_name == lastLoggerName_ &&
+                         msg.payload == lastPayload_ &&
+                         msg.level == lastLevel_;
+
+   if (repeated && msg.time - repeatStart_ < kRepeatInterval_)
+   {
+      ++repeatCount_;
+      return;
+   }
+
+   DispatchRepeatCount();
+
+   lastLoggerName_.assign(msg.logger_name.begin(), msg.logger_name.end());
+   lastPayload_.assign(msg.payload.begin(), msg.payload.end());
+   lastLevel_   = msg.level;
+   repeatStart_ = msg.time;
+
+   Dispatch(msg);
+}
+
+void DispatchSink::WriteRepeatCount()
+{
+   std::unique_lock lock {repeatMutex_};
+   DispatchRepeatCount();
+}
+
+void DispatchSink::DispatchRepeatCount()
+{
+   if (repeatCount_ > 0u)
+   {
+      const std::string repeatPayload =
+         fmt::format("Previous message repeated {} times", repeatCount_);
+
+      Dispatch(spdlog::details::log_msg {
+         lastLoggerName_, lastLevel_, repeatPayload});
+      repeatCount_ = 0u;
+   }
+}
+
+void DispatchSink::Dispatch(const spdlog::details::log_msg& msg)
+{
+   {
+      std::unique_lock lock {queueMutex_};
+      if (async_)
+      {
+         // Copies the payload, and overwrites the oldest message if full
+         queue_.push_back(spdlog::details::log_msg_buffer {msg});
+         lock.unlock();
+         queueCondition_.notify_one();
+         return;
+      }
+   }
+
+   Write(msg);
+}
+
+void DispatchSink::Write(const spdlog::details::log_msg& msg)
+{
+   std::unique_lock lock {sinksMutex_};
+   for (auto& sink : sinks_)
+   {
+      if (sink->should_log(msg.level))
+      {
+         sink->log(msg);
+      }
+   }
+}
+
+void DispatchSink::WriteQueue()
+{
+   std::unique_lock lock {queueMutex_};
+
+   while (true)
+   {
+      queueCondition_.wait(lock,
+                           [this]() { return stopping_ || !queue_.empty(); });
+
+      const std::size_t dropped = queue_.overrun_counter() - droppedCount_;
+      droppedCount_             = queue_.overrun_counter();
+
+      if (queue_.empty())
+      {
+         // Stop once all queued messages have been written
+         break;
+      }
+
+      std::vector<spdlog::details::log_msg_buffer> messages {};
+      messages.reserve(queue_.size());
+      while (!queue_.empty())
+      {
+         messages.push_back(std::move(queue_.front()));
+         queue_.pop_front();
+      }
+
+      lock.unlock();
+
+      if (dropped > 0u)
+      {
+         const std::string droppedPayload =
+            fmt::format("{} log messages were dropped", dropped);
+         Write(spdlog::details::log_msg {
+            "scwx::util::logger", spdlog::level::warn, droppedPayload});
+      }
+
+      for (auto& message : messages)
+      {
+         Write(message);
+      }
+      flush();
+
+      lock.lock();
+   }
+}
+
+void DispatchSink::flush()
+{
+   std::unique_lock lock {sinksMutex_};
+   for (auto& sink : sinks_)
+   {
+      sink->flush();
+   }
+}
+
+void DispatchSink::set_pattern(const std::string& pattern)
+{
+   std::unique_lock lock {sinksMutex_};
+   for (auto& sink : sinks_)
+   {
+      sink->set_pattern(pattern);
+   }
+}
+
+void DispatchSink::set_formatter(std::unique_ptr<spdlog::formatter> formatter)
+{
+   std::unique_lock lock {sinksMutex_};
+   for (auto& sink : sinks_)
+   {
+      sink->set_formatter(formatter->clone());
+   }
+}
+
+void DispatchSink::AddSink(std::shared_ptr<spdlog::sinks::sink> sink)
+{
+   std::unique_lock lock {sinksMutex_};
+   sinks_.push_back(sink);
+}
+
+void DispatchSink::SetAsync(bool async)
+{
+   std::unique_lock lock {queueMutex_};
+
+   if (async == async_)
+   {
+      return;
+   }
+
+   if (async)
+   {
+      async_        = true;
+      stopping_     = false;
+      writerThread_ = std::thread {[this]() { WriteQueue(); }};
+   }
+   else
+   {
+      // Messages logged from here on are written by their own thread, after
+      // the writer has finished with the queue
+      async_    = false;
+      stopping_ = true;
+      lock.unlock();
+      queueCondition_.notify_one();
+      writerThread_.join();
+   }
+}
 
 void Initialize()
 {
@@ -33,31 +285,19 @@ void AddFileSink(const std::string& baseFilename)
 
    fileSink->set_pattern(logPattern_);
 
-   spdlog::apply_all(
-      [&](std::shared_ptr<spdlog::logger> logger)
-      {
-         auto& sinks = logger->sinks();
-         sinks.push_back(fileSink);
-      });
+   AddSink(fileSink);
+}
 
-   extraSinks_.push_back(fileSink);
+void AddSink(std::shared_ptr<spdlog::sinks::sink> sink)
+{
+   GetDispatchSink()->AddSink(sink);
 }
 
 std::shared_ptr<spdlog::logger> Create(const std::string& name)
 {
-   // Create a shared sink
-   static auto sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-
    // Create the logger
    std::shared_ptr<spdlog::logger> logger =
-      std::make_shared<spdlog::logger>(name, sink);
-
-   // Add additional registered sinks
-   for (auto& extraSink : extraSinks_)
-   {
-      auto& sinks = logger->sinks();
-      sinks.push_back(extraSink);
-   }
+      std::make_shared<spdlog::logger>(name, GetDispatchSink());
 
    // Register the logger, so it can be retrieved later using spdlog::get()
    spdlog::register_logger(logger);
@@ -65,6 +305,18 @@ std::shared_ptr<spdlog::logger> Create(const std::string& name)
    return logger;
 }
 
+void SetAsync(bool async)
+{
+   GetDispatchSink()->SetAsync(async);
+}
+
+void Shutdown()
+{
+   GetDispatchSink()->WriteRepeatCount();
+   GetDispatchSink()->SetAsync(false);
+   GetDispatchSink()->flush();
+}
+
 } // namespace Logger
 } // namespace util
 } // namespace scwx
@@ -0,0 +1,116 @@
+#include <scwx/util/mapped_file_stream.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/iostreams/stream_buffer.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::mapped_file_stream";
+static const auto        logger_    = Logger::Create(logPrefix_);
+
+class MappedFileStream::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   Impl(const Impl&)            = delete;
+   Impl& operator=(const Impl&) = delete;
+
+   Impl(Impl&&) noexcept            = delete;
+   Impl& operator=(Impl&&) noexcept = delete;
+
+   bool Map(const std::string& filename);
+
+   boost::iostreams::mapped_file_source file_ {};
+   boost::iostreams::stream_buffer<boost::iostreams::array_source>
+               mappedBuffer_ {};
+   std::filebuf fileBuffer_ {};
+};
+
+MappedFileStream::MappedFileStream(const std::string& filename) :
+    std::istream(nullptr), p(std::make_unique<Impl>())
+{
+   if (p->Map(filename))
+   {
+      std::istream::rdbuf(&p->mappedBuffer_);
+   }
+   else if (p->fileBuffer_.open(filename,
+                                std::ios_base::in | std::ios_base::binary) !=
+            nullptr)
+   {
+      // Fall back to reading the file as a stream
+      std::istream::rdbuf(&p->fileBuffer_);
+   }
+   else
+   {
+      setstate(std::ios_base::failbit);
+   }
+}
+
+MappedFileStream::~MappedFileStream()
+{
+   // Detach the buffer before the mapping is released
+   std::istream::rdbuf(nullptr);
+}
+
+bool MappedFileStream::Impl::Map(const std::string& filename)
+{
+   // Empty files cannot be mapped
+   std::error_code error;
+   if (std::filesystem::file_size(filename, error) == 0 || error)
+   {
+      return false;
+   }
+
+   try
+   {
+      file_.open(filename);
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->debug("Could not map file: {} ({})", filename, ex.what());
+      return false;
+   }
+
+   if (!file_.is_open())
+   {
+      return false;
+   }
+
+   mappedBuffer_.open(
+      boost::iostreams::array_source {file_.data(), file_.size()});
+
+   return mappedBuffer_.is_open();
+}
+
+bool MappedFileStream::is_open() const
+{
+   return p->file_.is_open() || p->fileBuffer_.is_open();
+}
+
+bool MappedFileStream::is_mapped() const
+{
+   return p->file_.is_open();
+}
+
+std::span<const char> MappedFileStream::data() const
+{
+   if (!p->file_.is_open())
+   {
+      return {};
+   }
+
+   return {p->file_.data(), p->file_.size()};
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,173 @@
+#include <scwx/util/memory.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#if defined(_WIN32)
+#   include <Windows.h>
+#   include <Psapi.h>
+#elif defined(__APPLE__)
+#   include <mach/mach.h>
+#else
+#   include <fstream>
+#   include <unistd.h>
+#endif
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ {"scwx::util::memory"};
+static const auto        logger_ = util::Logger::Create(logPrefix_);
+
+struct MemoryCategory
+{
+   std::atomic<std::size_t> bytes_ {0u};
+   std::atomic<std::size_t> owners_ {0u};
+};
+
+// Categories are never removed, so counters may reference them without locking
+static std::map<std::string, std::unique_ptr<MemoryCategory>> categories_ {};
+static std::mutex categoriesMutex_ {};
+
+class MemoryCounter::Impl
+{
+public:
+   explicit Impl(const std::string& category) :
+       category_ {GetCategory(category)}
+   {
+   }
+   ~Impl() = default;
+
+   static MemoryCategory& GetCategory(const std::string& category);
+
+   MemoryCategory&          category_;
+   std::atomic<std::size_t> bytes_ {0u};
+};
+
+MemoryCounter::MemoryCounter(const std::string& category) :
+    p(std::make_unique<Impl>(category))
+{
+   ++p->category_.owners_;
+}
+
+MemoryCounter::~MemoryCounter()
+{
+   set_bytes(0u);
+   --p->category_.owners_;
+}
+
+std::size_t MemoryCounter::bytes() const
+{
+   return p->bytes_.load(std::memory_order_relaxed);
+}
+
+void MemoryCounter::set_bytes(std::size_t bytes)
+{
+   const std::size_t previous = p->bytes_.exchange(bytes);
+
+   // Add before subtracting, so the category total does not wrap
+   p->category_.bytes_ += bytes;
+   p->category_.bytes_ -= previous;
+}
+
+MemoryCategory& MemoryCounter::Impl::GetCategory(const std::string& category)
+{
+   std::unique_lock lock {categoriesMutex_};
+
+   auto& entry = categories_[category];
+   if (entry == nullptr)
+   {
+      entry = std::make_unique<MemoryCategory>();
+   }
+
+   return *entry;
+}
+
+std::size_t GetResidentMemory()
+{
+   std::size_t residentMemory = 0;
+
+#if defined(_WIN32)
+   PROCESS_MEMORY_COUNTERS counters {};
+
+   if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+   {
+      residentMemory = counters.WorkingSetSize;
+   }
+#elif defined(__APPLE__)
+   mach_task_basic_info_data_t info {};
+   mach_msg_type_number_t      count = MACH_TASK_BASIC_INFO_COUNT;
+
+   if (task_info(mach_task_self(),
+                 MACH_TASK_BASIC_INFO,
+                 reinterpret_cast<task_info_t>(&info),
+                 &count) == KERN_SUCCESS)
+   {
+      residentMemory = info.resident_size;
+   }
+#else
+   // The second field of statm is the resident set size in pages
+   std::ifstream statm {"/proc/self/statm"};
+   std::size_t   totalPages    = 0;
+   std::size_t   residentPages = 0;
+
+   if (statm >> totalPages >> residentPages)
+   {
+      residentMemory =
+         residentPages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+   }
+#endif
+
+   if (residentMemory == 0)
+   {
+      SPDLOG_LOGGER_TRACE(logger_, "Could not determine resident memory");
+   }
+
+   return residentMemory;
+}
+
+std::vector<MemoryUsage> GetMemoryUsage()
+{
+   std::vector<MemoryUsage> usage {};
+
+   std::unique_lock lock {categoriesMutex_};
+
+   for (auto& [name, category] : categories_)
+   {
+      usage.push_back({.category_ = name,
+                       .bytes_    = category->bytes_.load(),
+                       .owners_   = category->owners_.load()});
+   }
+
+   return usage;
+}
+
+void LogMemoryUsage()
+{
+   auto usage = GetMemoryUsage();
+
+   std::size_t totalBytes = 0u;
+   for (auto& category : usage)
+   {
+      totalBytes += category.bytes_;
+   }
+
+   logger_->info("Memory: {} bytes resident, {} bytes accounted",
+                 GetResidentMemory(),
+                 totalBytes);
+
+   for (auto& category : usage)
+   {
+      logger_->info(" {}: {} bytes ({} owners)",
+                    category.category_,
+                    category.bytes_,
+                    category.owners_);
+   }
+}
+
+} // namespace util
+} // namespace scwx
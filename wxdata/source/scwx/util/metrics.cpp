@@ -0,0 +1,220 @@
+#include <scwx/util/metrics.hpp>
+#include <scwx/util/memory.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+namespace scwx
+{
+namespace util
+{
+
+enum class MetricType
+{
+   Counter,
+   Gauge,
+   Summary
+};
+
+struct MetricInfo
+{
+   std::string name_;
+   MetricType  type_;
+   std::string label_;
+   std::string help_;
+};
+
+static const std::unordered_map<Metric, MetricInfo> metricInfo_ {
+   {Metric::DataTime,
+    {"scwx_data_time_seconds",
+     MetricType::Gauge,
+     "site",
+     "Volume time of the most recently displayed radar data"}},
+   {Metric::DataLatency,
+    {"scwx_data_latency_seconds",
+     MetricType::Gauge,
+     "site",
+     "Time between the volume time and the display of radar data"}},
+   {Metric::DownloadBytes,
+    {"scwx_download_bytes_total",
+     MetricType::Counter,
+     "source",
+     "Bytes downloaded from a data source"}},
+   {Metric::DecodeSeconds,
+    {"scwx_decode_seconds",
+     MetricType::Summary,
+     "product",
+     "Time spent decoding radar products"}},
+   {Metric::FrameSeconds,
+    {"scwx_frame_seconds",
+     MetricType::Summary,
+     "pane",
+     "Time spent rendering map frames"}},
+   {Metric::RefreshFailures,
+    {"scwx_refresh_failures_total",
+     MetricType::Counter,
+     "source",
+     "Data source refreshes which failed"}},
+   {Metric::Unknown, {"?", MetricType::Gauge, "", ""}}};
+
+struct MetricValue
+{
+   double        value_ {0.0};
+   std::uint64_t count_ {0u};
+};
+
+typedef std::map<std::pair<Metric, std::string>, MetricValue> MetricValueMap;
+
+static std::atomic<bool> enabled_ {false};
+
+static std::mutex     valuesMutex_ {};
+static MetricValueMap values_ {};
+
+static std::string EscapeLabel(const std::string& label)
+{
+   std::string escaped {};
+   escaped.reserve(label.size());
+
+   for (char c : label)
+   {
+      switch (c)
+      {
+      case '\\':
+         escaped += "\\\\";
+         break;
+      case '"':
+         escaped += "\\\"";
+         break;
+      case '\n':
+         escaped += "\\n";
+         break;
+      default:
+         escaped += c;
+         break;
+      }
+   }
+
+   return escaped;
+}
+
+static const char* GetMetricTypeName(MetricType type)
+{
+   switch (type)
+   {
+   case MetricType::Counter:
+      return "counter";
+   case MetricType::Summary:
+      return "summary";
+   default:
+      return "gauge";
+   }
+}
+
+const std::string& GetMetricName(Metric metric)
+{
+   return metricInfo_.at(metric).name_;
+}
+
+bool Metrics::IsEnabled()
+{
+   return enabled_.load(std::memory_order_relaxed);
+}
+
+void Metrics::SetEnabled(bool enabled)
+{
+   enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void Metrics::Add(Metric metric, const std::string& label, double value)
+{
+   if (!IsEnabled())
+   {
+      return;
+   }
+
+   std::unique_lock lock {valuesMutex_};
+   values_[{metric, label}].value_ += value;
+}
+
+void Metrics::Set(Metric metric, const std::string& label, double value)
+{
+   if (!IsEnabled())
+   {
+      return;
+   }
+
+   std::unique_lock lock {valuesMutex_};
+   values_[{metric, label}].value_ = value;
+}
+
+void Metrics::Observe(Metric metric, const std::string& label, double value)
+{
+   if (!IsEnabled())
+   {
+      return;
+   }
+
+   std::unique_lock lock {valuesMutex_};
+   MetricValue&     metricValue = values_[{metric, label}];
+   metricValue.value_ += value;
+   ++metricValue.count_;
+}
+
+void Metrics::Write(std::ostream& os)
+{
+   MetricValueMap values {};
+   {
+      std::unique_lock lock {valuesMutex_};
+      values = values_;
+   }
+
+   Metric lastMetric = Metric::Unknown;
+
+   for (auto& [key, value] : values)
+   {
+      auto& [metric, label]  = key;
+      const MetricInfo& info = metricInfo_.at(metric);
+
+      if (metric != lastMetric)
+      {
+         os << fmt::format("# HELP {} {}\n", info.name_, info.help_);
+         os << fmt::format(
+            "# TYPE {} {}\n", info.name_, GetMetricTypeName(info.type_));
+         lastMetric = metric;
+      }
+
+      const std::string labels =
+         fmt::format("{{{}=\"{}\"}}", info.label_, EscapeLabel(label));
+
+      if (info.type_ == MetricType::Summary)
+      {
+         os << fmt::format("{}_sum{} {}\n", info.name_, labels, value.value_);
+         os << fmt::format("{}_count{} {}\n", info.name_, labels, value.count_);
+      }
+      else
+      {
+         os << fmt::format("{}{} {}\n", info.name_, labels, value.value_);
+      }
+   }
+
+   // Cache and buffer sizes are reported by memory counters
+   os << "# HELP scwx_resident_memory_bytes Resident memory of the process\n"
+      << "# TYPE scwx_resident_memory_bytes gauge\n"
+      << fmt::format("scwx_resident_memory_bytes {}\n", GetResidentMemory());
+
+   os << "# HELP scwx_memory_bytes Memory held by caches and buffers\n"
+      << "# TYPE scwx_memory_bytes gauge\n";
+   for (auto& usage : GetMemoryUsage())
+   {
+      os << fmt::format("scwx_memory_bytes{{category=\"{}\"}} {}\n",
+                        EscapeLabel(usage.category_),
+                        usage.bytes_);
+   }
+}
+
+} // namespace util
+} // namespace scwx
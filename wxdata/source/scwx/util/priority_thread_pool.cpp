@@ -0,0 +1,140 @@
+#include <scwx/util/priority_thread_pool.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/profiler.hpp>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::priority_thread_pool";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+static constexpr std::size_t kPriorityCount_ = 3u;
+
+class PriorityThreadPool::Impl
+{
+public:
+   explicit Impl(std::size_t threadCount, const std::string& name) :
+       threadCount_ {std::max<std::size_t>(threadCount, 1u)},
+       name_ {name},
+       threadPool_ {threadCount_}
+   {
+   }
+   ~Impl() = default;
+
+   void RunNext();
+
+   const std::size_t        threadCount_;
+   const std::string        name_;
+   boost::asio::thread_pool threadPool_;
+
+   std::array<std::deque<Task>, kPriorityCount_> lanes_ {};
+   mutable std::mutex                            lanesMutex_ {};
+};
+
+PriorityThreadPool::PriorityThreadPool(std::size_t        threadCount,
+                                       const std::string& name) :
+    p(std::make_unique<Impl>(threadCount, name))
+{
+}
+
+PriorityThreadPool::~PriorityThreadPool()
+{
+   Join();
+}
+
+std::size_t PriorityThreadPool::thread_count() const
+{
+   return p->threadCount_;
+}
+
+std::size_t PriorityThreadPool::pending_count() const
+{
+   std::unique_lock lock {p->lanesMutex_};
+
+   std::size_t count = 0u;
+   for (auto& lane : p->lanes_)
+   {
+      count += lane.size();
+   }
+
+   return count;
+}
+
+void PriorityThreadPool::Post(Priority priority, Task task)
+{
+   {
+      std::unique_lock lock {p->lanesMutex_};
+      p->lanes_[static_cast<std::size_t>(priority)].push_back(std::move(task));
+   }
+
+   // Each posted handler runs the highest priority task queued when a worker
+   // becomes available, which is not necessarily the task posted here
+   boost::asio::post(p->threadPool_, [this]() { p->RunNext(); });
+}
+
+PriorityThreadPool::Scheduler PriorityThreadPool::Schedule(Priority priority)
+{
+   return Scheduler {*this, priority};
+}
+
+void PriorityThreadPool::Join()
+{
+   p->threadPool_.join();
+}
+
+std::size_t PriorityThreadPool::HardwareThreadCount()
+{
+   return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+void PriorityThreadPool::Impl::RunNext()
+{
+   Task task {};
+
+   {
+      std::unique_lock lock {lanesMutex_};
+
+      for (auto& lane : lanes_)
+      {
+         if (!lane.empty())
+         {
+            task = std::move(lane.front());
+            lane.pop_front();
+            break;
+         }
+      }
+   }
+
+   if (!task)
+   {
+      return;
+   }
+
+   if (!name_.empty())
+   {
+      Profiler::SetThreadName(name_);
+   }
+
+   try
+   {
+      task();
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->error(ex.what());
+   }
+}
+
+} // namespace util
+} // namespace scwx
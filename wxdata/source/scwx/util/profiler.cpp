@@ -0,0 +1,415 @@
+#include <scwx/util/profiler.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+namespace scwx
+{
+namespace util
+{
+
+// Number of samples retained for each thread
+static constexpr std::size_t kBufferSize_ = 16384u;
+
+// Trace thread of GPU samples, thread identifiers are assigned from 1
+static constexpr std::uint32_t kGpuThread_ = 0u;
+
+static const std::unordered_map<ProfileStage, std::string> profileStageName_ {
+   {ProfileStage::Frame, "Frame"},
+   {ProfileStage::LayerRender, "Layer Render"},
+   {ProfileStage::GpuLayerRender, "GPU Layer Render"},
+   {ProfileStage::ImGui, "ImGui"},
+   {ProfileStage::GlUpload, "GL Upload"},
+   {ProfileStage::ComputeSweep, "Compute Sweep"},
+   {ProfileStage::Download, "Download"},
+   {ProfileStage::Decompress, "Decompress"},
+   {ProfileStage::Parse, "Parse"},
+   {ProfileStage::ProductLoad, "Product Load"},
+   {ProfileStage::ProviderRefresh, "Provider Refresh"},
+   {ProfileStage::PlacefileRefresh, "Placefile Refresh"},
+   {ProfileStage::AlertUpdate, "Alert Update"},
+   {ProfileStage::Unknown, "?"}};
+
+// Written only by the owning thread. Entries are atomic, so they may be read
+// while being written, although a sample being overwritten may be read with
+// fields from two different samples.
+struct SampleBuffer
+{
+   explicit SampleBuffer(std::uint32_t thread) : thread_ {thread} {}
+
+   struct Entry
+   {
+      std::atomic<std::uint32_t> key_ {};
+      std::atomic<std::int64_t>  end_ {};
+      std::atomic<std::int64_t>  duration_ {};
+      std::atomic<std::uint64_t> allocations_ {};
+      std::atomic<std::uint64_t> allocatedBytes_ {};
+   };
+
+   const std::uint32_t             thread_;
+   std::array<Entry, kBufferSize_> entries_ {};
+   std::atomic<std::uint64_t>      count_ {0u};
+};
+
+static std::atomic<bool> enabled_ {false};
+
+static std::vector<std::shared_ptr<SampleBuffer>> buffers_ {};
+static std::mutex                                 buffersMutex_ {};
+
+static std::vector<std::string>                        labels_ {""};
+static std::unordered_map<std::string, std::uint16_t> labelIds_ {};
+static std::mutex                                      labelsMutex_ {};
+
+static std::atomic<std::uint32_t>                     nextThread_ {1u};
+static std::unordered_map<std::uint32_t, std::string> threadNames_ {};
+static std::mutex                                     threadNamesMutex_ {};
+
+static std::uint32_t ThreadId()
+{
+   thread_local const std::uint32_t thread = nextThread_++;
+   return thread;
+}
+
+static std::string JsonString(const std::string& value);
+
+static SampleBuffer& ThreadBuffer()
+{
+   // The buffer is registered on first use, and is kept after the thread exits
+   // until its samples are no longer requested
+   thread_local std::shared_ptr<SampleBuffer> buffer = []()
+   {
+      auto newBuffer = std::make_shared<SampleBuffer>(ThreadId());
+
+      std::unique_lock lock {buffersMutex_};
+      buffers_.push_back(newBuffer);
+
+      return newBuffer;
+   }();
+
+   return *buffer;
+}
+
+const std::string& GetProfileStageName(ProfileStage stage)
+{
+   return profileStageName_.at(stage);
+}
+
+bool Profiler::IsEnabled()
+{
+   return enabled_.load(std::memory_order_relaxed);
+}
+
+void Profiler::SetEnabled(bool enabled)
+{
+   enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+std::uint16_t Profiler::RegisterLabel(const std::string& label)
+{
+   std::unique_lock lock {labelsMutex_};
+
+   auto it = labelIds_.find(label);
+   if (it != labelIds_.cend())
+   {
+      return it->second;
+   }
+
+   if (labels_.size() > std::numeric_limits<std::uint16_t>::max())
+   {
+      // Further labels are recorded as unlabeled
+      return 0u;
+   }
+
+   const std::uint16_t id = static_cast<std::uint16_t>(labels_.size());
+   labels_.push_back(label);
+   labelIds_.emplace(label, id);
+
+   return id;
+}
+
+std::string Profiler::GetLabel(std::uint16_t label)
+{
+   std::unique_lock lock {labelsMutex_};
+
+   return (label < labels_.size()) ? labels_[label] : std::string {};
+}
+
+void Profiler::SetThreadName(const std::string& name)
+{
+   // Pool workers name themselves for each task, avoid locking unless the name
+   // has changed
+   thread_local std::string threadName {};
+   if (name == threadName)
+   {
+      return;
+   }
+   threadName = name;
+
+   std::unique_lock lock {threadNamesMutex_};
+   threadNames_.insert_or_assign(ThreadId(), name);
+}
+
+std::string Profiler::GetThreadName(std::uint32_t thread)
+{
+   std::unique_lock lock {threadNamesMutex_};
+
+   auto it = threadNames_.find(thread);
+   return (it != threadNames_.cend()) ? it->second : std::string {};
+}
+
+void Profiler::Record(ProfileStage                          stage,
+                      std::uint16_t                         label,
+                      std::chrono::steady_clock::time_point begin,
+                      std::chrono::steady_clock::time_point end,
+                      const AllocationCount&                allocations)
+{
+   SampleBuffer& buffer = ThreadBuffer();
+
+   const std::uint64_t count = buffer.count_.load(std::memory_order_relaxed);
+   auto&               entry = buffer.entries_[count % kBufferSize_];
+
+   entry.key_.store(static_cast<std::uint32_t>(stage) << 16 | label,
+                    std::memory_order_relaxed);
+   entry.end_.store(end.time_since_epoch().count(), std::memory_order_relaxed);
+   entry.duration_.store(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count(),
+      std::memory_order_relaxed);
+   entry.allocations_.store(allocations.allocations_,
+                            std::memory_order_relaxed);
+   entry.allocatedBytes_.store(allocations.bytes_, std::memory_order_relaxed);
+
+   buffer.count_.store(count + 1u, std::memory_order_release);
+}
+
+std::vector<ProfileSample>
+Profiler::GetSamples(std::chrono::steady_clock::time_point since)
+{
+   std::vector<std::shared_ptr<SampleBuffer>> buffers {};
+
+   {
+      std::unique_lock lock {buffersMutex_};
+      buffers = buffers_;
+   }
+
+   std::vector<ProfileSample> samples {};
+   std::vector<SampleBuffer*> expiredBuffers {};
+
+   for (auto& buffer : buffers)
+   {
+      // The buffer is only referenced here and by the registry if its thread
+      // has exited
+      const bool        threadExited = (buffer.use_count() == 2);
+      const std::size_t previousSize = samples.size();
+
+      const std::uint64_t count =
+         buffer->count_.load(std::memory_order_acquire);
+      const std::uint64_t first =
+         (count > kBufferSize_) ? count - kBufferSize_ : 0u;
+
+      for (std::uint64_t i = first; i < count; ++i)
+      {
+         auto& entry = buffer->entries_[i % kBufferSize_];
+
+         const std::chrono::steady_clock::time_point end {
+            std::chrono::steady_clock::duration {
+               entry.end_.load(std::memory_order_relaxed)}};
+
+         if (end <= since)
+         {
+            continue;
+         }
+
+         const std::uint32_t key = entry.key_.load(std::memory_order_relaxed);
+
+         samples.push_back(
+            {.stage_    = static_cast<ProfileStage>(key >> 16),
+             .label_    = static_cast<std::uint16_t>(key & 0xffffu),
+             .thread_   = buffer->thread_,
+             .end_      = end,
+             .duration_ = std::chrono::nanoseconds {
+                entry.duration_.load(std::memory_order_relaxed)},
+             .allocations_ = {
+                .allocations_ =
+                   entry.allocations_.load(std::memory_order_relaxed),
+                .bytes_ =
+                   entry.allocatedBytes_.load(std::memory_order_relaxed)}});
+      }
+
+      // Buffers of exited threads are released once their samples are older
+      // than the requested time
+      if (threadExited && samples.size() == previousSize)
+      {
+         expiredBuffers.push_back(buffer.get());
+      }
+   }
+
+   if (!expiredBuffers.empty())
+   {
+      std::unique_lock lock {buffersMutex_};
+      std::erase_if(buffers_,
+                    [&](auto& buffer)
+                    {
+                       return std::find(expiredBuffers.cbegin(),
+                                        expiredBuffers.cend(),
+                                        buffer.get()) != expiredBuffers.cend();
+                    });
+   }
+
+   std::sort(samples.begin(),
+             samples.end(),
+             [](auto& a, auto& b) { return a.end_ < b.end_; });
+
+   return samples;
+}
+
+void Profiler::WriteTrace(std::ostream&                         os,
+                          std::chrono::steady_clock::time_point since)
+{
+   using Microseconds = std::chrono::duration<double, std::micro>;
+
+   auto samples = GetSamples(since);
+
+   // Timestamps are relative to the beginning of the earliest sample
+   std::chrono::steady_clock::time_point origin =
+      std::chrono::steady_clock::time_point::max();
+   for (auto& sample : samples)
+   {
+      origin = std::min(origin, sample.end_ - sample.duration_);
+   }
+
+   std::vector<std::uint32_t> threads {};
+
+   const bool allocationsAvailable = AllocationTracker::IsAvailable();
+
+   os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+   bool first = true;
+   for (auto& sample : samples)
+   {
+      const std::uint32_t thread =
+         (sample.stage_ == ProfileStage::GpuLayerRender) ? kGpuThread_ :
+                                                           sample.thread_;
+      const std::string&  stageName = GetProfileStageName(sample.stage_);
+      const std::string   label     = GetLabel(sample.label_);
+      const std::string   name =
+         label.empty() ? stageName : fmt::format("{}: {}", stageName, label);
+
+      // Allocations are only counted on CPU threads
+      std::string args {};
+      if (allocationsAvailable && thread != kGpuThread_)
+      {
+         args = fmt::format(",\"args\":{{\"allocations\":{},\"bytes\":{}}}",
+                            sample.allocations_.allocations_,
+                            sample.allocations_.bytes_);
+      }
+
+      os << (first ? "\n" : ",\n")
+         << fmt::format(
+               "{{\"name\":{},\"cat\":{},\"ph\":\"X\",\"ts\":{:.3f},"
+               "\"dur\":{:.3f},\"pid\":1,\"tid\":{}{}}}",
+               JsonString(name),
+               JsonString(stageName),
+               Microseconds(sample.end_ - sample.duration_ - origin).count(),
+               Microseconds(sample.duration_).count(),
+               thread,
+               args);
+      first = false;
+
+      if (std::find(threads.cbegin(), threads.cend(), thread) == threads.cend())
+      {
+         threads.push_back(thread);
+      }
+   }
+
+   // Name each thread which recorded a sample
+   for (std::uint32_t thread : threads)
+   {
+      std::string threadName =
+         (thread == kGpuThread_) ? "GPU" : GetThreadName(thread);
+      if (threadName.empty())
+      {
+         threadName = fmt::format("Thread {}", thread);
+      }
+
+      os << (first ? "\n" : ",\n")
+         << fmt::format("{{\"name\":\"thread_name\",\"ph\":\"M\","
+                        "\"pid\":1,\"tid\":{},\"args\":{{\"name\":{}}}}}",
+                        thread,
+                        JsonString(threadName));
+      first = false;
+   }
+
+   os << "\n]}\n";
+}
+
+static std::string JsonString(const std::string& value)
+{
+   std::string result {"\""};
+
+   for (char c : value)
+   {
+      switch (c)
+      {
+      case '"':
+         result += "\\\"";
+         break;
+      case '\\':
+         result += "\\\\";
+         break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20u)
+         {
+            result += fmt::format("\\u{:04x}", static_cast<int>(c));
+         }
+         else
+         {
+            result += c;
+         }
+         break;
+      }
+   }
+
+   result += '"';
+   return result;
+}
+
+ScopedTimer::ScopedTimer(ProfileStage stage, std::uint16_t label) :
+    stage_ {stage}, label_ {label}, enabled_ {Profiler::IsEnabled()}
+{
+   if (enabled_)
+   {
+      beginAllocations_ = AllocationTracker::GetThreadCount();
+      begin_            = std::chrono::steady_clock::now();
+   }
+}
+
+ScopedTimer::~ScopedTimer()
+{
+   if (enabled_)
+   {
+      const auto end = std::chrono::steady_clock::now();
+
+      // Allocations include those made by nested stages
+      const AllocationCount endAllocations =
+         AllocationTracker::GetThreadCount();
+
+      Profiler::Record(
+         stage_,
+         label_,
+         begin_,
+         end,
+         {.allocations_ =
+             endAllocations.allocations_ - beginAllocations_.allocations_,
+          .bytes_ = endAllocations.bytes_ - beginAllocations_.bytes_});
+   }
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,89 @@
+#include <scwx/util/run_length.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+   (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define SCWX_RUN_LENGTH_SSE2
+#elif defined(__ARM_NEON)
+#   include <arm_neon.h>
+#   define SCWX_RUN_LENGTH_NEON
+#endif
+
+namespace scwx
+{
+namespace util
+{
+
+// The maximum run is 15, so a single 16-byte store covers any run
+static constexpr std::size_t kMaxRun_ = 15u;
+static constexpr std::size_t kStore_  = 16u;
+
+std::size_t CountRunLength4(const std::uint8_t* data, std::size_t size)
+{
+   std::size_t count = 0;
+
+   for (std::size_t i = 0; i < size; ++i)
+   {
+      count += data[i] >> 4;
+   }
+
+   return count;
+}
+
+std::size_t ExpandRunLength4(const std::uint8_t* data,
+                             std::size_t         size,
+                             std::uint8_t*       levels,
+                             std::size_t         maxLevels)
+{
+   if (maxLevels == 0)
+   {
+      // The output may be null when there are no levels to write
+      return 0;
+   }
+
+   std::size_t i = 0;
+   std::size_t b = 0;
+
+#if defined(SCWX_RUN_LENGTH_SSE2) || defined(SCWX_RUN_LENGTH_NEON)
+   // Write a full vector of the level for each run, and advance by the run.
+   // Subsequent runs overwrite the excess, so this is only valid while a full
+   // vector fits within the output.
+   static_assert(kStore_ > kMaxRun_);
+
+   for (; i < size && b + kStore_ <= maxLevels; ++i)
+   {
+      const std::uint8_t run   = data[i] >> 4;
+      const std::uint8_t level = data[i] & 0x0f;
+
+#   if defined(SCWX_RUN_LENGTH_SSE2)
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(levels + b),
+                       _mm_set1_epi8(static_cast<char>(level)));
+#   else
+      vst1q_u8(levels + b, vdupq_n_u8(level));
+#   endif
+
+      b += run;
+   }
+#endif
+
+   for (; i < size && b < maxLevels; ++i)
+   {
+      const std::uint8_t run   = data[i] >> 4;
+      const std::uint8_t level = data[i] & 0x0f;
+      const std::size_t  count = std::min<std::size_t>(run, maxLevels - b);
+
+      std::memset(levels + b, level, count);
+      b += count;
+   }
+
+   // Clear any levels not covered by a run
+   std::memset(levels + b, 0, maxLevels - b);
+
+   return b;
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,186 @@
+#include <scwx/util/strand.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/priority_thread_pool.hpp>
+#include <scwx/util/profiler.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+#include <boost/asio/post.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::strand";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+// Work which waits on the network uses little processor time, so more threads
+// than hardware threads may wait at once
+static constexpr std::size_t kMinBlockingThreadCount_ = 8u;
+
+static boost::asio::thread_pool& SharedThreadPool(Strand::Priority priority)
+{
+   // Interactive work may use every hardware thread, while background work
+   // is limited to half, such that it cannot starve interactive work. Work
+   // which waits on the network has its own threads, such that a slow server
+   // does not delay other background work.
+   static boost::asio::thread_pool interactivePool {
+      Strand::thread_count(Strand::Priority::Interactive)};
+   static boost::asio::thread_pool backgroundPool {
+      Strand::thread_count(Strand::Priority::Background)};
+   static boost::asio::thread_pool blockingPool {
+      Strand::thread_count(Strand::Priority::Blocking)};
+
+   switch (priority)
+   {
+   case Strand::Priority::Background:
+      return backgroundPool;
+   case Strand::Priority::Blocking:
+      return blockingPool;
+   default:
+      return interactivePool;
+   }
+}
+
+class Strand::Impl
+{
+public:
+   explicit Impl(const std::string& name, Priority priority) :
+       name_ {name},
+       strand_ {boost::asio::make_strand(
+          SharedThreadPool(priority).get_executor())}
+   {
+   }
+   ~Impl() = default;
+
+   bool Begin();
+   void Run(const std::function<void()>& work);
+   void End();
+
+   const std::string name_;
+   executor_type     strand_;
+
+   std::size_t             outstanding_ {0u};
+   bool                    joined_ {false};
+   std::mutex              mutex_ {};
+   std::condition_variable condition_ {};
+};
+
+Strand::Strand(const std::string& name, Priority priority) :
+    p(std::make_unique<Impl>(name, priority))
+{
+}
+
+Strand::~Strand()
+{
+   Join();
+}
+
+Strand::executor_type Strand::get_executor() const
+{
+   return p->strand_;
+}
+
+const std::string& Strand::name() const
+{
+   return p->name_;
+}
+
+void Strand::Post(Task task)
+{
+   if (!p->Begin())
+   {
+      logger_->debug("Task posted to joined strand: {}", p->name_);
+      return;
+   }
+
+   boost::asio::post(p->strand_,
+                     [this, task = std::move(task)]()
+                     {
+                        p->Run(task);
+                        p->End();
+                     });
+}
+
+Strand::Handler Strand::Wrap(Handler handler)
+{
+   // Handlers are waited on even once joined, as a timer cancelled while its
+   // owner is destroyed still completes
+   {
+      std::unique_lock lock {p->mutex_};
+      ++p->outstanding_;
+   }
+
+   return [this, handler = std::move(handler)](
+             const boost::system::error_code& error)
+   {
+      p->Run([&]() { handler(error); });
+      p->End();
+   };
+}
+
+void Strand::Join()
+{
+   std::unique_lock lock {p->mutex_};
+   p->joined_ = true;
+   p->condition_.wait(lock, [this]() { return p->outstanding_ == 0u; });
+}
+
+std::size_t Strand::thread_count(Priority priority)
+{
+   const std::size_t hardwareThreads =
+      PriorityThreadPool::HardwareThreadCount();
+
+   switch (priority)
+   {
+   case Priority::Background:
+      return std::max<std::size_t>(hardwareThreads / 2u, 1u);
+   case Priority::Blocking:
+      return std::max(hardwareThreads, kMinBlockingThreadCount_);
+   default:
+      return hardwareThreads;
+   }
+}
+
+bool Strand::Impl::Begin()
+{
+   std::unique_lock lock {mutex_};
+
+   if (joined_)
+   {
+      return false;
+   }
+
+   ++outstanding_;
+   return true;
+}
+
+void Strand::Impl::Run(const std::function<void()>& work)
+{
+   Profiler::SetThreadName(name_);
+
+   try
+   {
+      work();
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->error("{}: {}", name_, ex.what());
+   }
+}
+
+void Strand::Impl::End()
+{
+   std::unique_lock lock {mutex_};
+
+   if (--outstanding_ == 0u)
+   {
+      condition_.notify_all();
+   }
+}
+
+} // namespace util
+} // namespace scwx
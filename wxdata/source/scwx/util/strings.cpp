@@ -2,6 +2,10 @@
 
 #include <scwx/util/strings.hpp>
 
+#include <cctype>
+#include <charconv>
+#include <stdexcept>
+
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/lexical_cast.hpp>
 #include <fmt/format.h>
@@ -74,19 +78,41 @@ std::string BytesToString(std::ptrdiff_t bytes)
    return fmt::format("{} TB", FormatNumber(terabytes));
 }
 
-std::vector<std::string> ParseTokens(const std::string&       s,
-                                     std::vector<std::string> delimiters,
-                                     std::size_t              pos)
+static bool IsSpace(char c)
+{
+   return std::isspace(static_cast<unsigned char>(c));
+}
+
+static std::string_view Trim(std::string_view s)
+{
+   while (!s.empty() && IsSpace(s.front()))
+   {
+      s.remove_prefix(1);
+   }
+   while (!s.empty() && IsSpace(s.back()))
+   {
+      s.remove_suffix(1);
+   }
+   return s;
+}
+
+template<typename Delimiters>
+static void ParseTokensImpl(std::string_view               s,
+                            const Delimiters&              delimiters,
+                            std::vector<std::string_view>& tokens,
+                            std::size_t                    pos)
 {
-   std::vector<std::string> tokens {};
-   std::size_t              findPos {};
+   std::size_t findPos {};
+
+   tokens.clear();
 
    // Iterate through each delimiter
-   for (std::size_t i = 0; i < delimiters.size() && pos != std::string::npos;
-        ++i)
+   for (auto it = delimiters.begin();
+        it != delimiters.end() && pos != std::string_view::npos;
+        ++it)
    {
       // Skip leading spaces
-      while (pos < s.size() && std::isspace(s[pos]))
+      while (pos < s.size() && IsSpace(s[pos]))
       {
          ++pos;
       }
@@ -97,7 +123,7 @@ std::vector<std::string> ParseTokens(const std::string&       s,
          findPos = s.find('"', pos + 1);
 
          // Increment search start to one after quotation mark
-         if (findPos != std::string::npos)
+         if (findPos != std::string_view::npos)
          {
             ++findPos;
          }
@@ -109,20 +135,19 @@ std::vector<std::string> ParseTokens(const std::string&       s,
       }
 
       // Search for delimiter
-      std::size_t nextPos = s.find_first_of(delimiters[i], findPos);
+      std::size_t nextPos = s.find_first_of(std::string_view {*it}, findPos);
 
       // If the delimiter was not found, stop processing tokens
-      if (nextPos == std::string::npos)
+      if (nextPos == std::string_view::npos)
       {
          break;
       }
 
       // Add the current substring as a token
-      auto& newToken = tokens.emplace_back(s.substr(pos, nextPos - pos));
-      boost::trim(newToken);
+      tokens.push_back(Trim(s.substr(pos, nextPos - pos)));
 
       // Increment nextPos until the next non-space character
-      while (++nextPos < s.size() && std::isspace(s[nextPos])) {}
+      while (++nextPos < s.size() && IsSpace(s[nextPos])) {}
 
       // Store new position value
       pos = nextPos;
@@ -131,11 +156,40 @@ std::vector<std::string> ParseTokens(const std::string&       s,
    // Add the remainder of the string as a token
    if (pos < s.size())
    {
-      auto& newToken = tokens.emplace_back(s.substr(pos));
-      boost::trim(newToken);
+      tokens.push_back(Trim(s.substr(pos)));
    }
+}
+
+std::vector<std::string> ParseTokens(const std::string&       s,
+                                     std::vector<std::string> delimiters,
+                                     std::size_t              pos)
+{
+   std::vector<std::string_view> viewTokens {};
+   ParseTokensImpl(s, delimiters, viewTokens, pos);
 
-   return tokens;
+   return std::vector<std::string>(viewTokens.cbegin(), viewTokens.cend());
+}
+
+void ParseTokens(std::string_view                        s,
+                 std::initializer_list<std::string_view> delimiters,
+                 std::vector<std::string_view>&          tokens,
+                 std::size_t                             pos)
+{
+   ParseTokensImpl(s, delimiters, tokens, pos);
+}
+
+void SplitTokens(std::string_view               s,
+                 std::string_view               delimiters,
+                 std::vector<std::string_view>& tokens)
+{
+   std::size_t pos = s.find_first_not_of(delimiters);
+
+   while (pos != std::string_view::npos)
+   {
+      const std::size_t endPos = s.find_first_of(delimiters, pos);
+      tokens.push_back(s.substr(pos, endPos - pos));
+      pos = s.find_first_not_of(delimiters, endPos);
+   }
 }
 
 std::string ToString(const std::vector<std::string>& v)
@@ -172,5 +226,34 @@ std::optional<T> TryParseNumeric(const std::string& str)
    return value;
 }
 
+template<typename T>
+T ParseNumeric(std::string_view str)
+{
+   // Unlike std::stod, std::from_chars does not skip whitespace or a plus sign
+   while (!str.empty() && IsSpace(str.front()))
+   {
+      str.remove_prefix(1);
+   }
+   if (!str.empty() && str.front() == '+')
+   {
+      str.remove_prefix(1);
+   }
+
+   T value {};
+
+   auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+
+   if (ec == std::errc::invalid_argument)
+   {
+      throw std::invalid_argument("ParseNumeric");
+   }
+   else if (ec == std::errc::result_out_of_range)
+   {
+      throw std::out_of_range("ParseNumeric");
+   }
+
+   return value;
+}
+
 } // namespace util
 } // namespace scwx
@@ -16,6 +16,7 @@
 #include <unordered_map>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/container_hash/hash.hpp>
 
 #if (__cpp_lib_chrono < 201907L)
 #   include <date/date.h>
@@ -29,6 +30,30 @@ namespace util
 static const std::string logPrefix_ = "scwx::util::time";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Formatted time strings retained per thread before the cache is reset
+static constexpr std::size_t kMaxCachedTimeStrings_ = 4096u;
+
+struct TimeStringKey
+{
+   std::chrono::sys_seconds time_;
+   ClockFormat              clockFormat_;
+   const time_zone*         timeZone_;
+
+   bool operator==(const TimeStringKey&) const = default;
+};
+
+struct TimeStringKeyHash
+{
+   std::size_t operator()(const TimeStringKey& key) const
+   {
+      std::size_t seed = 0;
+      boost::hash_combine(seed, key.time_.time_since_epoch().count());
+      boost::hash_combine(seed, static_cast<int>(key.clockFormat_));
+      boost::hash_combine(seed, key.timeZone_);
+      return seed;
+   }
+};
+
 static const std::unordered_map<ClockFormat, std::string> clockFormatName_ {
    {ClockFormat::_12Hour, "12-hour"},
    {ClockFormat::_24Hour, "24-hour"},
@@ -52,10 +77,9 @@ std::chrono::system_clock::time_point TimePoint(uint32_t modifiedJulianDate,
           std::chrono::milliseconds {milliseconds};
 }
 
-std::string TimeString(std::chrono::system_clock::time_point time,
-                       ClockFormat                           clockFormat,
-                       const time_zone*                      timeZone,
-                       bool                                  epochValid)
+static std::string FormatTimeString(std::chrono::sys_seconds timeInSeconds,
+                                    ClockFormat              clockFormat,
+                                    const time_zone*         timeZone)
 {
    using namespace std::chrono;
 
@@ -71,57 +95,91 @@ std::string TimeString(std::chrono::system_clock::time_point time,
    namespace df = date;
 #endif
 
-   auto               timeInSeconds = time_point_cast<seconds>(time);
    std::ostringstream os;
 
-   if (epochValid || time.time_since_epoch().count() != 0)
+   if (timeZone != nullptr)
    {
-      if (timeZone != nullptr)
+      try
       {
-         try
+         date::zoned_time zt = {timeZone, timeInSeconds};
+
+         if (clockFormat == ClockFormat::_24Hour)
          {
-            date::zoned_time zt = {timeZone, timeInSeconds};
-
-            if (clockFormat == ClockFormat::_24Hour)
-            {
-               os << df::format(FORMAT_STRING_24_HOUR, zt);
-            }
-            else
-            {
-               os << df::format(FORMAT_STRING_12_HOUR, zt);
-            }
+            os << df::format(FORMAT_STRING_24_HOUR, zt);
          }
-         catch (const std::exception& ex)
+         else
          {
-            static bool firstException = true;
-            if (firstException)
-            {
-               logger_->warn("Zoned time error: {}", ex.what());
-               firstException = false;
-            }
-
-            // In the case where there is a time zone error (e.g., timezone
-            // database, unicode issue, etc.), fall back to UTC
-            timeZone = nullptr;
+            os << df::format(FORMAT_STRING_12_HOUR, zt);
          }
       }
-
-      if (timeZone == nullptr)
+      catch (const std::exception& ex)
       {
-         if (clockFormat == ClockFormat::_24Hour)
+         static bool firstException = true;
+         if (firstException)
          {
-            os << df::format(FORMAT_STRING_24_HOUR, timeInSeconds);
-         }
-         else
-         {
-            os << df::format(FORMAT_STRING_12_HOUR, timeInSeconds);
+            logger_->warn("Zoned time error: {}", ex.what());
+            firstException = false;
          }
+
+         // In the case where there is a time zone error (e.g., timezone
+         // database, unicode issue, etc.), fall back to UTC
+         timeZone = nullptr;
+      }
+   }
+
+   if (timeZone == nullptr)
+   {
+      if (clockFormat == ClockFormat::_24Hour)
+      {
+         os << df::format(FORMAT_STRING_24_HOUR, timeInSeconds);
+      }
+      else
+      {
+         os << df::format(FORMAT_STRING_12_HOUR, timeInSeconds);
       }
    }
 
    return os.str();
 }
 
+std::string TimeString(std::chrono::system_clock::time_point time,
+                       ClockFormat                           clockFormat,
+                       const time_zone*                      timeZone,
+                       bool                                  epochValid)
+{
+   if (!epochValid && time.time_since_epoch().count() == 0)
+   {
+      return {};
+   }
+
+   // Time strings are formatted repeatedly while painting views and models,
+   // so formatted strings are cached per thread, keyed by the time truncated
+   // to seconds, the clock format and the time zone
+   thread_local std::
+      unordered_map<TimeStringKey, std::string, TimeStringKeyHash>
+         cache_ {};
+
+   const TimeStringKey key {
+      std::chrono::time_point_cast<std::chrono::seconds>(time),
+      clockFormat,
+      timeZone};
+
+   auto it = cache_.find(key);
+   if (it != cache_.cend())
+   {
+      return it->second;
+   }
+
+   if (cache_.size() >= kMaxCachedTimeStrings_)
+   {
+      cache_.clear();
+   }
+
+   return cache_
+      .emplace(key, FormatTimeString(key.time_, clockFormat, timeZone))
+      .first->second;
+}
+
 template<typename T>
 std::optional<std::chrono::sys_time<T>>
 TryParseDateTime(const std::string& dateTimeFormat, const std::string& str)
@@ -94,5 +94,11 @@ vectorbuf::pos_type vectorbuf::seekoff(std::streamoff          off,
    return pos_type(off);
 }
 
+vectorbuf::pos_type vectorbuf::seekpos(pos_type                pos,
+                                       std::ios_base::openmode which)
+{
+   return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
 } // namespace util
 } // namespace scwx
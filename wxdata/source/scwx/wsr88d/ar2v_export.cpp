@@ -0,0 +1,387 @@
+#include <scwx/wsr88d/ar2v_export.hpp>
+#include <scwx/wsr88d/rda/columnar_sweep.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <execution>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static const std::string logPrefix_ = "scwx::wsr88d::ar2v_export";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+static const std::unordered_map<rda::DataBlockType, std::string>
+   momentNames_ {{rda::DataBlockType::MomentRef, "REF"},
+                 {rda::DataBlockType::MomentVel, "VEL"},
+                 {rda::DataBlockType::MomentSw, "SW"},
+                 {rda::DataBlockType::MomentZdr, "ZDR"},
+                 {rda::DataBlockType::MomentPhi, "PHI"},
+                 {rda::DataBlockType::MomentRho, "RHO"},
+                 {rda::DataBlockType::MomentCfp, "CFP"}};
+
+// Zarr byte order of multi-byte values, which are written in native order
+static constexpr char kByteOrder_ =
+   (std::endian::native == std::endian::little) ? '<' : '>';
+
+/**
+ * @brief A chunk of moment data to be compressed and written.
+ */
+struct DataChunk
+{
+   std::shared_ptr<const rda::ColumnarSweep> sweep_ {};
+   std::filesystem::path                     path_ {};
+   std::size_t                               firstRadial_ {0u};
+};
+
+static std::string FormatTime(std::chrono::system_clock::time_point time);
+static bool        WriteFile(const std::filesystem::path& path,
+                             const void*                  data,
+                             std::size_t                  size);
+static bool        WriteText(const std::filesystem::path& path,
+                             const std::string&           text);
+static bool        WriteArray(const std::filesystem::path& path,
+                              const std::string&           dtype,
+                              const std::string&           dimension,
+                              const std::string&           attributes,
+                              const void*                  data,
+                              std::size_t                  count,
+                              std::size_t                  size);
+static bool        WriteChunk(const DataChunk&         chunk,
+                              const ZarrExportOptions& options);
+
+bool ExportZarr(const Ar2vFile&          file,
+                const std::string&       path,
+                const ZarrExportOptions& options)
+{
+   logger_->debug("ExportZarr: {}", path);
+
+   if (options.chunkRadials_ == 0u)
+   {
+      logger_->error("Chunk size must contain at least one radial");
+      return false;
+   }
+
+   const std::filesystem::path root {path};
+
+   std::error_code error;
+   std::filesystem::create_directories(root, error);
+   if (error)
+   {
+      logger_->error("Unable to create directory: \"{}\" ({})",
+                     path,
+                     error.message());
+      return false;
+   }
+
+   // Collect the elevation scans of each moment. The moments of a scan share
+   // the same elevation scan, which is ordered by its collection time.
+   typedef std::pair<std::chrono::system_clock::time_point,
+                     std::shared_ptr<rda::ElevationScan>>
+      SweepKey;
+
+   std::map<SweepKey, float> sweeps {};
+
+   for (auto dataBlockType : rda::MomentDataBlockTypeIterator())
+   {
+      for (auto& elevation : file.elevation_scans(dataBlockType))
+      {
+         for (auto& scan : elevation.second)
+         {
+            sweeps.try_emplace({scan.first, scan.second},
+                               Ar2vFile::DecodeElevation(elevation.first));
+         }
+      }
+   }
+
+   const auto vcpData = file.vcp_data();
+
+   bool valid = WriteText(root / ".zgroup", R"({"zarr_format": 2})");
+   valid &= WriteText(
+      root / ".zattrs",
+      fmt::format(R"({{"radar": "{}", "volume_start_time": "{}", "vcp": {}}})",
+                  file.icao(),
+                  FormatTime(file.start_time()),
+                  (vcpData != nullptr) ? vcpData->pattern_number() : 0u));
+
+   std::vector<DataChunk> chunks {};
+   std::size_t            sweepIndex = 0;
+
+   for (auto& sweep : sweeps)
+   {
+      const std::filesystem::path sweepPath =
+         root / fmt::format("sweep_{:02}", sweepIndex++);
+
+      std::filesystem::create_directories(sweepPath, error);
+
+      valid &= WriteText(sweepPath / ".zgroup", R"({"zarr_format": 2})");
+      valid &= WriteText(
+         sweepPath / ".zattrs",
+         fmt::format(R"({{"elevation_angle": {}, "sweep_start_time": "{}"}})",
+                     sweep.second,
+                     FormatTime(sweep.first.first)));
+
+      for (auto dataBlockType : rda::MomentDataBlockTypeIterator())
+      {
+         auto columnarSweep =
+            rda::ColumnarSweep::Get(sweep.first.second, dataBlockType);
+
+         if (columnarSweep == nullptr || columnarSweep->radial_count() == 0u)
+         {
+            continue;
+         }
+
+         const std::filesystem::path momentPath =
+            sweepPath / momentNames_.at(dataBlockType);
+         const std::size_t radialCount = columnarSweep->radial_count();
+         const std::size_t stride      = columnarSweep->stride();
+         const float       scale       = columnarSweep->scale();
+         const float       offset      = columnarSweep->offset();
+
+         std::filesystem::create_directories(momentPath / "data", error);
+
+         valid &= WriteText(momentPath / ".zgroup", R"({"zarr_format": 2})");
+
+         // Moment data, dimensioned by radial and gate
+         valid &= WriteText(
+            momentPath / "data" / ".zarray",
+            fmt::format(
+               R"({{"zarr_format": 2, "shape": [{}, {}], "chunks": [{}, {}], )"
+               R"("dtype": "{}", "compressor": {{"id": "zlib", "level": {}}}, )"
+               R"("fill_value": 0, "order": "C", "filters": null}})",
+               radialCount,
+               stride,
+               options.chunkRadials_,
+               stride,
+               (columnarSweep->data_word_size() == 8) ?
+                  std::string {"|u1"} :
+                  fmt::format("{}u2", kByteOrder_),
+               options.compressionLevel_));
+
+         std::string dataAttributes = fmt::format(
+            R"({{"_ARRAY_DIMENSIONS": ["azimuth", "range"], )"
+            R"("scale": {}, "offset": {}, "missing_value": [0, 1])",
+            scale,
+            offset);
+         if (scale != 0.0f)
+         {
+            // Physical value is (data - offset) / scale
+            dataAttributes +=
+               fmt::format(R"(, "scale_factor": {}, "add_offset": {})",
+                           1.0f / scale,
+                           -offset / scale);
+         }
+         dataAttributes += "}";
+
+         valid &= WriteText(momentPath / "data" / ".zattrs", dataAttributes);
+
+         // Radial coordinates
+         const auto azimuths = columnarSweep->azimuths();
+         valid &= WriteArray(momentPath / "azimuth",
+                             fmt::format("{}f4", kByteOrder_),
+                             "azimuth",
+                             R"("units": "degrees")",
+                             azimuths.data(),
+                             azimuths.size(),
+                             sizeof(float));
+
+         std::vector<std::int64_t> times {};
+         times.reserve(radialCount);
+         for (auto& time : columnarSweep->times())
+         {
+            times.push_back(
+               std::chrono::duration_cast<std::chrono::milliseconds>(
+                  time.time_since_epoch())
+                  .count());
+         }
+         valid &= WriteArray(
+            momentPath / "time",
+            fmt::format("{}i8", kByteOrder_),
+            "azimuth",
+            R"("units": "milliseconds since 1970-01-01T00:00:00Z")",
+            times.data(),
+            times.size(),
+            sizeof(std::int64_t));
+
+         // Gate coordinates
+         std::vector<float> ranges(stride);
+         for (std::size_t i = 0; i < stride; ++i)
+         {
+            ranges[i] = static_cast<float>(
+               columnarSweep->data_moment_range_raw() +
+               i * columnarSweep->data_moment_range_sample_interval_raw());
+         }
+         valid &= WriteArray(momentPath / "range",
+                             fmt::format("{}f4", kByteOrder_),
+                             "range",
+                             R"("units": "m")",
+                             ranges.data(),
+                             ranges.size(),
+                             sizeof(float));
+
+         for (std::size_t firstRadial = 0; firstRadial < radialCount;
+              firstRadial += options.chunkRadials_)
+         {
+            chunks.push_back(
+               {columnarSweep,
+                momentPath / "data" /
+                   fmt::format("{}.0", firstRadial / options.chunkRadials_),
+                firstRadial});
+         }
+      }
+   }
+
+   std::atomic<bool> chunksValid {true};
+
+   // Compress and write the chunks of every sweep concurrently
+   std::for_each(std::execution::par,
+                 chunks.cbegin(),
+                 chunks.cend(),
+                 [&](const DataChunk& chunk)
+                 {
+                    if (!WriteChunk(chunk, options))
+                    {
+                       chunksValid = false;
+                    }
+                 });
+
+   valid &= chunksValid;
+
+   logger_->debug(
+      "Exported {} sweeps in {} chunks", sweeps.size(), chunks.size());
+
+   return valid;
+}
+
+static std::string FormatTime(std::chrono::system_clock::time_point time)
+{
+   return fmt::format("{:%Y-%m-%dT%H:%M:%SZ}",
+                      std::chrono::floor<std::chrono::seconds>(time));
+}
+
+static bool WriteFile(const std::filesystem::path& path,
+                      const void*                  data,
+                      std::size_t                  size)
+{
+   std::ofstream ofs {path,
+                      std::ios_base::out | std::ios_base::binary |
+                         std::ios_base::trunc};
+   ofs.write(static_cast<const char*>(data),
+             static_cast<std::streamsize>(size));
+
+   if (!ofs.good())
+   {
+      logger_->error("Unable to write file: {}", path.string());
+      return false;
+   }
+
+   return true;
+}
+
+static bool WriteText(const std::filesystem::path& path,
+                      const std::string&           text)
+{
+   return WriteFile(path, text.data(), text.size());
+}
+
+static bool WriteArray(const std::filesystem::path& path,
+                       const std::string&           dtype,
+                       const std::string&           dimension,
+                       const std::string&           attributes,
+                       const void*                  data,
+                       std::size_t                  count,
+                       std::size_t                  size)
+{
+   std::error_code error;
+   std::filesystem::create_directories(path, error);
+
+   // Coordinate arrays are small, and are stored uncompressed in one chunk
+   bool valid = WriteText(
+      path / ".zarray",
+      fmt::format(R"({{"zarr_format": 2, "shape": [{}], "chunks": [{}], )"
+                  R"("dtype": "{}", "compressor": null, "fill_value": null, )"
+                  R"("order": "C", "filters": null}})",
+                  count,
+                  std::max<std::size_t>(count, 1u),
+                  dtype));
+   valid &= WriteText(
+      path / ".zattrs",
+      fmt::format(
+         R"({{"_ARRAY_DIMENSIONS": ["{}"], {}}})", dimension, attributes));
+   valid &= WriteFile(path / "0", data, count * size);
+
+   return valid;
+}
+
+static bool WriteChunk(const DataChunk&         chunk,
+                       const ZarrExportOptions& options)
+{
+   const rda::ColumnarSweep& sweep = *chunk.sweep_;
+
+   const std::size_t stride     = sweep.stride();
+   const std::size_t wordSize   = (sweep.data_word_size() == 8) ? 1u : 2u;
+   const std::size_t rowSize    = stride * wordSize;
+   const std::size_t lastRadial = std::min(
+      chunk.firstRadial_ + options.chunkRadials_, sweep.radial_count());
+
+   // Chunks are always full size, and the last chunk is padded with zero
+   std::vector<char> data(options.chunkRadials_ * rowSize, 0);
+
+   for (std::size_t radial = chunk.firstRadial_; radial < lastRadial; ++radial)
+   {
+      char* row = data.data() + (radial - chunk.firstRadial_) * rowSize;
+
+      if (wordSize == 1u)
+      {
+         auto moments = sweep.data_moments8(radial);
+         std::copy(moments.begin(),
+                   moments.end(),
+                   reinterpret_cast<std::uint8_t*>(row));
+      }
+      else
+      {
+         auto moments = sweep.data_moments16(radial);
+         std::copy(moments.begin(),
+                   moments.end(),
+                   reinterpret_cast<std::uint16_t*>(row));
+      }
+   }
+
+   std::vector<char> compressed {};
+
+   try
+   {
+      boost::iostreams::filtering_ostream out;
+      out.push(boost::iostreams::zlib_compressor(
+         boost::iostreams::zlib_params(options.compressionLevel_)));
+      out.push(boost::iostreams::back_inserter(compressed));
+      out.write(data.data(), static_cast<std::streamsize>(data.size()));
+      boost::iostreams::close(out);
+   }
+   catch (const boost::iostreams::zlib_error& ex)
+   {
+      logger_->warn(
+         "Error compressing chunk {}: {}", chunk.path_.string(), ex.what());
+      return false;
+   }
+
+   return WriteFile(chunk.path_, compressed.data(), compressed.size());
+}
+
+} // namespace wsr88d
+} // namespace scwx
@@ -1,13 +1,34 @@
 #include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/rda/clutter_filter_bypass_map.hpp>
+#include <scwx/wsr88d/rda/clutter_filter_map.hpp>
 #include <scwx/wsr88d/rda/digital_radar_data.hpp>
 #include <scwx/wsr88d/rda/level2_message_factory.hpp>
+#include <scwx/wsr88d/rda/performance_maintenance_data.hpp>
+#include <scwx/wsr88d/rda/rda_adaptation_data.hpp>
+#include <scwx/wsr88d/rda/rda_status_data.hpp>
 #include <scwx/wsr88d/rda/rda_types.hpp>
+#include <scwx/util/arena.hpp>
+#include <scwx/util/buffer_pool.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/rangebuf.hpp>
+#include <scwx/util/mapped_file_stream.hpp>
+#include <scwx/util/profiler.hpp>
 #include <scwx/util/time.hpp>
-
+#include <scwx/util/vectorbuf.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <execution>
+#include <filesystem>
 #include <fstream>
-#include <sstream>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
+
+#include <fmt/chrono.h>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -21,8 +42,13 @@
 
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/iostreams/filtering_streambuf.hpp>
 #include <boost/iostreams/filter/bzip2.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
 
 #if defined(__GNUC__)
 #   pragma GCC diagnostic pop
@@ -40,18 +66,62 @@ namespace wsr88d
 static const std::string logPrefix_ = "scwx::wsr88d::ar2v_file";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static constexpr std::array<char, 8> kCacheFileMagic_ {
+   'S', 'C', 'W', 'X', 'A', 'R', '2', 'C'};
+static constexpr std::uint32_t kCacheFileVersion_   = 1u;
+static constexpr std::size_t   kCacheFileAlignment_ = 8u;
+
+// Elevation angles are coded in units of 0.043945 / 8 degrees
+static constexpr float kElevationScaleFactor_ = 8.0f / 0.043945f;
+
+static constexpr std::size_t AlignCacheOffset(std::size_t offset)
+{
+   return (offset + kCacheFileAlignment_ - 1) & ~(kCacheFileAlignment_ - 1);
+}
+
 class Ar2vFileImpl
 {
 public:
+   /**
+    * @brief An RDA metadata message, which is parsed from its segments within
+    * the record buffers when first accessed
+    */
+   struct MetadataMessage
+   {
+      std::vector<std::pair<std::shared_ptr<std::vector<char>>, std::streampos>>
+                                          segments_ {};
+      std::shared_ptr<rda::Level2Message> message_ {};
+   };
+
    explicit Ar2vFileImpl() {};
    ~Ar2vFileImpl() = default;
 
-   std::size_t DecompressLDMRecords(std::istream& is);
+   static bool IsElevationComplete(const rda::ElevationScan& elevationScan);
+   static bool IsMetadataMessage(std::uint8_t messageType);
+
+   void DeferMetadataMessage(const rda::Level2MessageHeader&           header,
+                             const std::shared_ptr<std::vector<char>>& buffer,
+                             std::streampos messageStart);
+   std::shared_ptr<rda::Level2Message>
+   GetMetadataMessage(rda::MessageId messageId);
+
+   std::size_t DecompressLDMRecords(
+      std::istream& is,
+      std::size_t   maxRecords = std::numeric_limits<std::size_t>::max());
    void        HandleMessage(std::shared_ptr<rda::Level2Message>& message);
-   void        IndexFile();
+   float       GetElevationAngle(std::uint16_t elevationIndex) const;
+   void        IndexFile(bool completeOnly = false);
+   void        NotifyCompletedElevations();
    void        ParseLDMRecords();
-   void        ParseLDMRecord(std::istream& is);
+   void        ParseLDMRecord(
+             std::istream&                             is,
+             const std::shared_ptr<std::vector<char>>& recordBuffer = nullptr);
    void ProcessRadarData(const std::shared_ptr<rda::GenericRadarData>& message);
+   bool ReadVolumeHeader(std::istream& is);
+
+   bool                         arenaEnabled_ {true};
+   bool                         metadataEnabled_ {true};
+   std::shared_ptr<util::Arena> arena_ {nullptr};
 
    std::string   tapeFilename_ {};
    std::string   extensionNumber_ {};
@@ -70,7 +140,39 @@ public:
                               std::shared_ptr<rda::ElevationScan>>>>
       index_ {};
 
-   std::list<std::stringstream> rawRecords_ {};
+   // Sorted elevation cuts of each data block type, in degrees, derived from
+   // the index
+   std::map<rda::DataBlockType, std::vector<float>> elevationCuts_ {};
+
+   // Set while further records of a partially loaded volume are expected
+   bool partial_ {false};
+
+   std::list<std::shared_ptr<std::vector<char>>> rawRecords_ {};
+   std::vector<std::shared_ptr<std::vector<char>>> recordBuffers_ {};
+
+   // Set once 16-bit moment data has been decoded in place within the record
+   // buffers, after which they no longer hold the original records
+   std::shared_ptr<std::atomic<bool>> momentsSwapped_ {
+      std::make_shared<std::atomic<bool>>(false)};
+
+   std::vector<std::uint16_t> completedElevations_ {};
+   Ar2vFile::ElevationCompleteCallback elevationCompleteCallback_ {};
+
+   // Metadata messages by message type, and the message being received
+   std::map<std::uint8_t, MetadataMessage> metadata_ {};
+   std::pair<std::uint8_t, MetadataMessage> pendingMetadata_ {};
+   std::mutex                               metadataMutex_ {};
+
+   // Guards volume data while records are loaded into a volume in use
+   mutable std::shared_mutex mutex_ {};
+};
+
+struct LDMRecord
+{
+   std::size_t                        recordNumber_ {};
+   std::shared_ptr<std::vector<char>> compressedData_ {};
+   std::shared_ptr<std::vector<char>> decompressedData_ {};
+   bool                               valid_ {false};
 };
 
 Ar2vFile::Ar2vFile() : p(std::make_unique<Ar2vFileImpl>()) {}
@@ -96,9 +198,29 @@ std::string Ar2vFile::icao() const
 
 std::size_t Ar2vFile::message_count() const
 {
+   std::shared_lock lock {p->mutex_};
    return p->messageCount_;
 }
 
+std::size_t Ar2vFile::data_size() const
+{
+   std::shared_lock lock {p->mutex_};
+   std::size_t      dataSize = 0;
+
+   // Moment data references the decompressed records
+   for (auto& recordBuffer : p->recordBuffers_)
+   {
+      dataSize += recordBuffer->capacity();
+   }
+
+   if (p->arena_ != nullptr)
+   {
+      dataSize += p->arena_->bytes_allocated();
+   }
+
+   return dataSize;
+}
+
 std::chrono::system_clock::time_point Ar2vFile::start_time() const
 {
    return util::TimePoint(p->julianDate_, p->milliseconds_);
@@ -106,6 +228,7 @@ std::chrono::system_clock::time_point Ar2vFile::start_time() const
 
 std::chrono::system_clock::time_point Ar2vFile::end_time() const
 {
+   std::shared_lock                      lock {p->mutex_};
    std::chrono::system_clock::time_point endTime {};
 
    if (p->radarData_.size() > 0)
@@ -123,7 +246,25 @@ std::chrono::system_clock::time_point Ar2vFile::end_time() const
 std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>
 Ar2vFile::radar_data() const
 {
-   return p->radarData_;
+   std::shared_lock lock {p->mutex_};
+
+   if (!p->partial_)
+   {
+      return p->radarData_;
+   }
+
+   // Elevation scans still being loaded are modified as records arrive, and
+   // are not returned until they are complete
+   std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>> radarData {};
+   for (auto& [elevationIndex, elevationScan] : p->radarData_)
+   {
+      if (Ar2vFileImpl::IsElevationComplete(*elevationScan))
+      {
+         radarData.emplace(elevationIndex, elevationScan);
+      }
+   }
+
+   return radarData;
 }
 
 std::shared_ptr<const rda::VolumeCoveragePatternData> Ar2vFile::vcp_data() const
@@ -131,6 +272,81 @@ std::shared_ptr<const rda::VolumeCoveragePatternData> Ar2vFile::vcp_data() const
    return p->vcpData_;
 }
 
+std::shared_ptr<const rda::ClutterFilterBypassMap>
+Ar2vFile::clutter_filter_bypass_map() const
+{
+   return std::static_pointer_cast<rda::ClutterFilterBypassMap>(
+      p->GetMetadataMessage(rda::MessageId::ClutterFilterBypassMap));
+}
+
+std::shared_ptr<const rda::ClutterFilterMap>
+Ar2vFile::clutter_filter_map() const
+{
+   return std::static_pointer_cast<rda::ClutterFilterMap>(
+      p->GetMetadataMessage(rda::MessageId::ClutterFilterMap));
+}
+
+std::shared_ptr<const rda::PerformanceMaintenanceData>
+Ar2vFile::performance_maintenance_data() const
+{
+   return std::static_pointer_cast<rda::PerformanceMaintenanceData>(
+      p->GetMetadataMessage(rda::MessageId::PerformanceMaintenanceData));
+}
+
+std::shared_ptr<const rda::RdaAdaptationData>
+Ar2vFile::rda_adaptation_data() const
+{
+   return std::static_pointer_cast<rda::RdaAdaptationData>(
+      p->GetMetadataMessage(rda::MessageId::RdaAdaptationData));
+}
+
+std::shared_ptr<const rda::RdaStatusData> Ar2vFile::rda_status_data() const
+{
+   return std::static_pointer_cast<rda::RdaStatusData>(
+      p->GetMetadataMessage(rda::MessageId::RdaStatusData));
+}
+
+std::map<std::uint16_t,
+         std::map<std::chrono::system_clock::time_point,
+                  std::shared_ptr<rda::ElevationScan>>>
+Ar2vFile::elevation_scans(rda::DataBlockType dataBlockType) const
+{
+   std::shared_lock lock {p->mutex_};
+
+   auto it = p->index_.find(dataBlockType);
+   if (it == p->index_.cend())
+   {
+      return {};
+   }
+
+   return it->second;
+}
+
+std::uint16_t Ar2vFile::CodeElevation(float elevation)
+{
+   return static_cast<std::uint16_t>(
+      std::lroundf(elevation * kElevationScaleFactor_));
+}
+
+float Ar2vFile::DecodeElevation(std::uint16_t codedElevation)
+{
+   return codedElevation / kElevationScaleFactor_;
+}
+
+std::vector<float>
+Ar2vFile::elevation_cuts(rda::DataBlockType dataBlockType) const
+{
+   std::shared_lock lock {p->mutex_};
+
+   auto it = p->elevationCuts_.find(dataBlockType);
+   if (it == p->elevationCuts_.cend())
+   {
+      return {};
+   }
+
+   return it->second;
+}
+
 std::tuple<std::shared_ptr<rda::ElevationScan>, float, std::vector<float>>
 Ar2vFile::GetElevationScan(rda::DataBlockType                    dataBlockType,
                            float                                 elevation,
@@ -138,36 +354,38 @@ Ar2vFile::GetElevationScan(rda::DataBlockType                    dataBlockType,
 {
    logger_->debug("GetElevationScan: {} degrees", elevation);
 
-   constexpr float scaleFactor = 8.0f / 0.043945f;
+   auto [elevationScan, elevationCut] =
+      FindElevationScan(dataBlockType, elevation, time);
 
+   return {elevationScan, elevationCut, elevation_cuts(dataBlockType)};
+}
+
+std::pair<std::shared_ptr<rda::ElevationScan>, float>
+Ar2vFile::FindElevationScan(rda::DataBlockType                    dataBlockType,
+                            float                                 elevation,
+                            std::chrono::system_clock::time_point time) const
+{
    std::shared_ptr<rda::ElevationScan> elevationScan = nullptr;
    float                               elevationCut  = 0.0f;
-   std::vector<float>                  elevationCuts;
 
-   std::uint16_t codedElevation =
-      static_cast<std::uint16_t>(std::lroundf(elevation * scaleFactor));
+   std::uint16_t codedElevation = CodeElevation(elevation);
 
-   if (p->index_.contains(dataBlockType))
-   {
-      auto& scans = p->index_.at(dataBlockType);
-
-      std::uint16_t lowerBound = scans.cbegin()->first;
-      std::uint16_t upperBound = scans.crbegin()->first;
+   std::shared_lock lock {p->mutex_};
 
-      // Find closest elevation match
-      for (auto& scan : scans)
-      {
-         if (scan.first > lowerBound && scan.first <= codedElevation)
-         {
-            lowerBound = scan.first;
-         }
-         if (scan.first < upperBound && scan.first >= codedElevation)
-         {
-            upperBound = scan.first;
-         }
-
-         elevationCuts.push_back(scan.first / scaleFactor);
-      }
+   auto indexIt = p->index_.find(dataBlockType);
+   if (indexIt != p->index_.cend() && !indexIt->second.empty())
+   {
+      auto& scans = indexIt->second;
+
+      // Find closest elevation match, below and above the coded elevation
+      auto          upperIt    = scans.lower_bound(codedElevation);
+      auto          lowerIt    = scans.upper_bound(codedElevation);
+      std::uint16_t lowerBound = (lowerIt != scans.cbegin()) ?
+                                    std::prev(lowerIt)->first :
+                                    scans.cbegin()->first;
+      std::uint16_t upperBound = (upperIt != scans.cend()) ?
+                                    upperIt->first :
+                                    scans.crbegin()->first;
 
       std::int32_t lowerDelta =
          std::abs(static_cast<std::int32_t>(codedElevation) -
@@ -179,26 +397,24 @@ Ar2vFile::GetElevationScan(rda::DataBlockType                    dataBlockType,
       // Select closest elevation match
       std::uint16_t elevationIndex =
          (lowerDelta < upperDelta) ? lowerBound : upperBound;
-      elevationCut = elevationIndex / scaleFactor;
+      elevationCut = DecodeElevation(elevationIndex);
 
-      // Select closest time match, not newer than the selected time
-      std::chrono::system_clock::time_point foundTime {};
+      // Select closest time match, not newer than the selected time. If each
+      // scan is newer, select the first scan.
       auto& elevationScans = scans.at(elevationIndex);
+      auto  scanIt         = elevationScans.upper_bound(time);
 
-      for (auto& scan : elevationScans)
+      if (scanIt != elevationScans.cbegin())
       {
-         auto& scanTime = scan.first;
-
-         if (elevationScan == nullptr ||
-             (scanTime <= time && scanTime > foundTime))
-         {
-            elevationScan = scan.second;
-            foundTime     = scanTime;
-         }
+         elevationScan = std::prev(scanIt)->second;
+      }
+      else if (scanIt != elevationScans.cend())
+      {
+         elevationScan = scanIt->second;
       }
    }
 
-   return std::tie(elevationScan, elevationCut, elevationCuts);
+   return {elevationScan, elevationCut};
 }
 
 bool Ar2vFile::LoadFile(const std::string& filename)
@@ -206,7 +422,7 @@ bool Ar2vFile::LoadFile(const std::string& filename)
    logger_->debug("LoadFile: {}", filename);
    bool fileValid = true;
 
-   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   util::MappedFileStream f {filename};
    if (!f.good())
    {
       logger_->warn("Could not open file for reading: {}", filename);
@@ -221,25 +437,23 @@ bool Ar2vFile::LoadFile(const std::string& filename)
    return fileValid;
 }
 
-bool Ar2vFile::LoadData(std::istream& is)
+bool Ar2vFileImpl::ReadVolumeHeader(std::istream& is)
 {
-   logger_->debug("Loading Data");
-
    bool dataValid = true;
 
    // Read Volume Header Record
-   p->tapeFilename_.resize(9, ' ');
-   p->extensionNumber_.resize(3, ' ');
-   p->icao_.resize(4, ' ');
+   tapeFilename_.resize(9, ' ');
+   extensionNumber_.resize(3, ' ');
+   icao_.resize(4, ' ');
 
-   is.read(&p->tapeFilename_[0], 9);
-   is.read(&p->extensionNumber_[0], 3);
-   is.read(reinterpret_cast<char*>(&p->julianDate_), 4);
-   is.read(reinterpret_cast<char*>(&p->milliseconds_), 4);
-   is.read(&p->icao_[0], 4);
+   is.read(&tapeFilename_[0], 9);
+   is.read(&extensionNumber_[0], 3);
+   is.read(reinterpret_cast<char*>(&julianDate_), 4);
+   is.read(reinterpret_cast<char*>(&milliseconds_), 4);
+   is.read(&icao_[0], 4);
 
-   p->julianDate_   = ntohl(p->julianDate_);
-   p->milliseconds_ = ntohl(p->milliseconds_);
+   julianDate_   = ntohl(julianDate_);
+   milliseconds_ = ntohl(milliseconds_);
 
    if (is.eof())
    {
@@ -248,20 +462,33 @@ bool Ar2vFile::LoadData(std::istream& is)
    }
 
    // Trim spaces and null characters from the end of the ICAO
-   boost::trim_right_if(p->icao_,
+   boost::trim_right_if(icao_,
                         [](char x) { return std::isspace(x) || x == '\0'; });
 
    if (dataValid)
    {
-      logger_->debug("Filename:  {}", p->tapeFilename_);
-      logger_->debug("Extension: {}", p->extensionNumber_);
-      logger_->debug("Date:      {}", p->julianDate_);
-      logger_->debug("Time:      {}", p->milliseconds_);
-      logger_->debug("ICAO:      {}", p->icao_);
+      logger_->debug("Filename:  {}", tapeFilename_);
+      logger_->debug("Extension: {}", extensionNumber_);
+      logger_->debug("Date:      {}", julianDate_);
+      logger_->debug("Time:      {}", milliseconds_);
+      logger_->debug("ICAO:      {}", icao_);
+   }
+
+   return dataValid;
+}
 
+bool Ar2vFile::LoadData(std::istream& is)
+{
+   logger_->debug("Loading Data");
+
+   bool dataValid = p->ReadVolumeHeader(is);
+
+   if (dataValid)
+   {
       size_t decompressedRecords = p->DecompressLDMRecords(is);
       if (decompressedRecords == 0)
       {
+         util::ScopedTimer timer {util::ProfileStage::Parse};
          p->ParseLDMRecord(is);
       }
       else
@@ -271,17 +498,473 @@ bool Ar2vFile::LoadData(std::istream& is)
    }
 
    p->IndexFile();
+   p->NotifyCompletedElevations();
+
+   return dataValid;
+}
+
+bool Ar2vFile::LoadHeader(std::istream& is)
+{
+   logger_->debug("Loading Header");
+
+   bool dataValid = p->ReadVolumeHeader(is);
+
+   // The first LDM record contains the metadata messages (including the VCP)
+   if (dataValid && p->DecompressLDMRecords(is, 1u) > 0)
+   {
+      p->ParseLDMRecords();
+   }
 
    return dataValid;
 }
 
-std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
+bool Ar2vFile::LoadLDMRecords(std::istream& is, bool partial)
+{
+   logger_->debug("Loading LDM Records");
+
+   // Decompress before locking, the volume may be in use
+   std::size_t decompressedRecords = p->DecompressLDMRecords(is);
+
+   if (decompressedRecords > 0)
+   {
+      {
+         std::unique_lock lock {p->mutex_};
+         p->ParseLDMRecords();
+         p->IndexFile(partial);
+         p->partial_ = partial;
+      }
+
+      p->NotifyCompletedElevations();
+   }
+
+   return decompressedRecords > 0;
+}
+
+void Ar2vFile::SetElevationCompleteCallback(ElevationCompleteCallback callback)
+{
+   std::vector<std::pair<std::uint16_t, float>> completedElevations {};
+
+   {
+      std::unique_lock lock {p->mutex_};
+
+      p->elevationCompleteCallback_ = callback;
+
+      if (callback != nullptr)
+      {
+         for (auto& [elevationIndex, elevationScan] : p->radarData_)
+         {
+            if (Ar2vFileImpl::IsElevationComplete(*elevationScan))
+            {
+               completedElevations.emplace_back(
+                  elevationIndex, p->GetElevationAngle(elevationIndex));
+            }
+         }
+      }
+
+      // Pending elevations are reported here, and not again once loaded
+      p->completedElevations_.clear();
+   }
+
+   for (auto& [elevationIndex, elevationAngle] : completedElevations)
+   {
+      callback(elevationIndex, elevationAngle);
+   }
+}
+
+void Ar2vFile::SetArenaEnabled(bool enabled)
+{
+   p->arenaEnabled_ = enabled;
+}
+
+void Ar2vFile::SetMetadataEnabled(bool enabled)
+{
+   p->metadataEnabled_ = enabled;
+}
+
+std::string
+Ar2vFile::GetCacheFilename(const std::string&                    radarId,
+                           std::chrono::system_clock::time_point volumeTime)
+{
+   return fmt::format(
+      "{}_{:%Y%m%d_%H%M%S}.ar2c",
+      radarId,
+      std::chrono::time_point_cast<std::chrono::seconds>(volumeTime));
+}
+
+bool Ar2vFile::LoadCacheFile(const std::string& filename)
+{
+   logger_->debug("LoadCacheFile: {}", filename);
+
+   boost::iostreams::mapped_file_source file {};
+
+   try
+   {
+      file.open(filename);
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->warn("Could not open cache file: {} ({})", filename, ex.what());
+      return false;
+   }
+
+   const char*       data     = file.data();
+   const std::size_t dataSize = file.size();
+   std::size_t       offset   = 0;
+
+   auto read = [&](void* value, std::size_t size)
+   {
+      if (offset + size > dataSize)
+      {
+         return false;
+      }
+      std::memcpy(value, data + offset, size);
+      offset += size;
+      return true;
+   };
+
+   std::array<char, 8> magic {};
+   std::uint32_t       version     = 0;
+   std::uint32_t       recordCount = 0;
+
+   p->tapeFilename_.resize(9, ' ');
+   p->extensionNumber_.resize(3, ' ');
+   p->icao_.resize(4, ' ');
+
+   bool cacheValid = read(magic.data(), magic.size()) &&
+                     std::equal(magic.cbegin(),
+                                magic.cend(),
+                                kCacheFileMagic_.cbegin()) &&
+                     read(&version, 4) && version == kCacheFileVersion_ &&
+                     read(&recordCount, 4) &&
+                     read(p->tapeFilename_.data(), 9) &&
+                     read(p->extensionNumber_.data(), 3) &&
+                     read(&p->julianDate_, 4) && read(&p->milliseconds_, 4) &&
+                     read(p->icao_.data(), 4);
+
+   if (!cacheValid)
+   {
+      logger_->warn("Invalid cache file header: {}", filename);
+      return false;
+   }
+
+   boost::trim_right_if(p->icao_,
+                        [](char x) { return std::isspace(x) || x == '\0'; });
+
+   for (std::uint32_t i = 0; i < recordCount && cacheValid; ++i)
+   {
+      std::uint64_t recordSize = 0;
+
+      offset     = AlignCacheOffset(offset);
+      cacheValid = read(&recordSize, 8) && offset + recordSize <= dataSize;
+
+      if (cacheValid)
+      {
+         // Copy the record from the mapped file, as the record buffer is
+         // retained by parsed messages
+         offset = AlignCacheOffset(offset);
+         auto recordBuffer =
+            util::BufferPool::Instance()->Acquire(recordSize);
+         recordBuffer->assign(data + offset, data + offset + recordSize);
+         p->rawRecords_.push_back(std::move(recordBuffer));
+         offset += recordSize;
+      }
+   }
+
+   if (!cacheValid)
+   {
+      logger_->warn("Truncated cache file: {}", filename);
+      p->rawRecords_.clear();
+      return false;
+   }
+
+   p->ParseLDMRecords();
+   p->IndexFile();
+   p->NotifyCompletedElevations();
+
+   return true;
+}
+
+bool Ar2vFile::SaveCacheFile(const std::string& filename) const
+{
+   logger_->debug("SaveCacheFile: {}", filename);
+
+   if (p->recordBuffers_.empty())
+   {
+      logger_->debug("No records to cache");
+      return false;
+   }
+
+   if (p->momentsSwapped_->load())
+   {
+      logger_->warn("Moment data already decoded, not caching: {}", filename);
+      return false;
+   }
+
+   // Write to a temporary file first, so a partially written cache file is
+   // never loaded
+   const std::string tempFilename = filename + ".tmp";
+
+   std::ofstream f(tempFilename,
+                   std::ios_base::out | std::ios_base::binary |
+                      std::ios_base::trunc);
+   if (!f.good())
+   {
+      logger_->warn("Could not open cache file for writing: {}", tempFilename);
+      return false;
+   }
+
+   std::size_t offset = 0;
+
+   auto write = [&](const void* value, std::size_t size)
+   {
+      f.write(static_cast<const char*>(value),
+              static_cast<std::streamsize>(size));
+      offset += size;
+   };
+   auto pad = [&]()
+   {
+      static constexpr std::array<char, kCacheFileAlignment_> padding {};
+      write(padding.data(), AlignCacheOffset(offset) - offset);
+   };
+
+   const std::uint32_t recordCount =
+      static_cast<std::uint32_t>(p->recordBuffers_.size());
+
+   std::string icao = p->icao_;
+   icao.resize(4, ' ');
+
+   write(kCacheFileMagic_.data(), kCacheFileMagic_.size());
+   write(&kCacheFileVersion_, 4);
+   write(&recordCount, 4);
+   write(p->tapeFilename_.data(), 9);
+   write(p->extensionNumber_.data(), 3);
+   write(&p->julianDate_, 4);
+   write(&p->milliseconds_, 4);
+   write(icao.data(), 4);
+
+   for (auto& recordBuffer : p->recordBuffers_)
+   {
+      const std::uint64_t recordSize = recordBuffer->size();
+
+      pad();
+      write(&recordSize, 8);
+      pad();
+      write(recordBuffer->data(), recordBuffer->size());
+   }
+
+   f.close();
+
+   std::error_code error;
+
+   if (p->momentsSwapped_->load())
+   {
+      // Moment data was decoded while the records were being written
+      logger_->warn("Moment data decoded while caching: {}", filename);
+      std::filesystem::remove(tempFilename, error);
+      return false;
+   }
+
+   std::filesystem::rename(tempFilename, filename, error);
+
+   if (f.fail() || error)
+   {
+      logger_->warn("Could not write cache file: {}", filename);
+      std::filesystem::remove(tempFilename, error);
+      return false;
+   }
+
+   return true;
+}
+
+std::size_t Ar2vFile::CompressedVolume::compressed_size() const
+{
+   std::size_t size = 0;
+   for (auto& record : records_)
+   {
+      size += record.capacity();
+   }
+   return size;
+}
+
+std::size_t Ar2vFile::CompressedVolume::decompressed_size() const
+{
+   return std::accumulate(
+      recordSizes_.cbegin(), recordSizes_.cend(), std::size_t {0});
+}
+
+std::shared_ptr<const Ar2vFile::CompressedVolume> Ar2vFile::Compress() const
+{
+   std::shared_lock lock {p->mutex_};
+
+   if (p->recordBuffers_.empty())
+   {
+      logger_->debug("No records to compress");
+      return nullptr;
+   }
+
+   if (p->momentsSwapped_->load())
+   {
+      logger_->warn("Moment data already decoded, not compressing");
+      return nullptr;
+   }
+
+   auto volume              = std::make_shared<CompressedVolume>();
+   volume->tapeFilename_    = p->tapeFilename_;
+   volume->extensionNumber_ = p->extensionNumber_;
+   volume->julianDate_      = p->julianDate_;
+   volume->milliseconds_    = p->milliseconds_;
+   volume->icao_            = p->icao_;
+   volume->records_.resize(p->recordBuffers_.size());
+   volume->recordSizes_.resize(p->recordBuffers_.size());
+
+   std::vector<std::size_t> indices(p->recordBuffers_.size());
+   std::iota(indices.begin(), indices.end(), 0u);
+
+   std::atomic<bool> valid {true};
+
+   // Compress the records concurrently
+   std::for_each(
+      std::execution::par,
+      indices.cbegin(),
+      indices.cend(),
+      [&](std::size_t i)
+      {
+         const auto& recordBuffer = p->recordBuffers_[i];
+         auto&       record       = volume->records_[i];
+
+         try
+         {
+            boost::iostreams::filtering_ostream out;
+            out.push(boost::iostreams::zlib_compressor(
+               boost::iostreams::zlib_params(
+                  boost::iostreams::zlib::best_speed)));
+            out.push(boost::iostreams::back_inserter(record));
+            out.write(recordBuffer->data(),
+                      static_cast<std::streamsize>(recordBuffer->size()));
+            boost::iostreams::close(out);
+         }
+         catch (const boost::iostreams::zlib_error& ex)
+         {
+            logger_->warn("Error compressing record {}: {}", i, ex.what());
+            valid = false;
+         }
+
+         record.shrink_to_fit();
+         volume->recordSizes_[i] = recordBuffer->size();
+      });
+
+   if (!valid)
+   {
+      return nullptr;
+   }
+
+   if (p->momentsSwapped_->load())
+   {
+      logger_->warn("Moment data decoded while compressing");
+      return nullptr;
+   }
+
+   logger_->debug("Compressed {} LDM Records: {} to {} bytes",
+                  volume->records_.size(),
+                  volume->decompressed_size(),
+                  volume->compressed_size());
+
+   return volume;
+}
+
+bool Ar2vFile::LoadCompressed(const CompressedVolume& volume)
+{
+   logger_->debug("LoadCompressed: {} records", volume.records_.size());
+
+   if (volume.records_.empty() ||
+       volume.records_.size() != volume.recordSizes_.size())
+   {
+      return false;
+   }
+
+   p->tapeFilename_    = volume.tapeFilename_;
+   p->extensionNumber_ = volume.extensionNumber_;
+   p->julianDate_      = volume.julianDate_;
+   p->milliseconds_    = volume.milliseconds_;
+   p->icao_            = volume.icao_;
+
+   std::vector<LDMRecord> records(volume.records_.size());
+   auto                   bufferPool = util::BufferPool::Instance();
+
+   for (std::size_t i = 0; i < records.size(); ++i)
+   {
+      records[i].recordNumber_     = i;
+      records[i].decompressedData_ =
+         bufferPool->Acquire(volume.recordSizes_[i]);
+   }
+
+   {
+      util::ScopedTimer timer {util::ProfileStage::Decompress};
+
+      // Decompress the records concurrently
+      std::for_each(
+         std::execution::par,
+         records.begin(),
+         records.end(),
+         [&](LDMRecord& record)
+         {
+            const auto& compressedData = volume.records_[record.recordNumber_];
+
+            try
+            {
+               boost::iostreams::filtering_istream in;
+               in.push(boost::iostreams::zlib_decompressor());
+               in.push(boost::iostreams::array_source(compressedData.data(),
+                                                      compressedData.size()));
+               boost::iostreams::copy(in,
+                                      boost::iostreams::back_inserter(
+                                         *record.decompressedData_));
+
+               record.valid_ = (record.decompressedData_->size() ==
+                                volume.recordSizes_[record.recordNumber_]);
+            }
+            catch (const boost::iostreams::zlib_error& ex)
+            {
+               logger_->warn("Error decompressing record {}: {}",
+                             record.recordNumber_,
+                             ex.what());
+            }
+         });
+   }
+
+   if (!std::all_of(records.cbegin(),
+                    records.cend(),
+                    [](const LDMRecord& record) { return record.valid_; }))
+   {
+      logger_->warn("Invalid compressed volume");
+      return false;
+   }
+
+   for (auto& record : records)
+   {
+      p->rawRecords_.push_back(std::move(record.decompressedData_));
+   }
+
+   p->ParseLDMRecords();
+   p->IndexFile();
+   p->NotifyCompletedElevations();
+
+   return true;
+}
+
+std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is,
+                                               std::size_t   maxRecords)
 {
    logger_->debug("Decompressing LDM Records");
 
-   std::size_t numRecords = 0;
+   util::ScopedTimer timer {util::ProfileStage::Decompress};
 
-   while (is.peek() != EOF)
+   // Scan the record length prefixes, and read each compressed record into
+   // memory. Each LDM record is an independent bzip2 stream.
+   std::vector<LDMRecord> records {};
+   auto                   bufferPool = util::BufferPool::Instance();
+
+   while (records.size() < maxRecords && is.peek() != EOF)
    {
       std::streampos startPosition = is.tellg();
       std::int32_t   controlWord   = 0;
@@ -292,7 +975,9 @@ std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
       controlWord = ntohl(controlWord);
       recordSize  = std::abs(controlWord);
 
-      logger_->trace("LDM Record Found: Size = {} bytes", recordSize);
+      SPDLOG_LOGGER_TRACE(logger_,
+                          "LDM Record Found: Size = {} bytes",
+                          recordSize);
 
       if (recordSize == 0)
       {
@@ -300,31 +985,72 @@ std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
          break;
       }
 
-      boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
-      util::rangebuf r(is.rdbuf(), recordSize);
-      in.push(boost::iostreams::bzip2_decompressor());
-      in.push(r);
+      LDMRecord& record = records.emplace_back();
+      record.recordNumber_ = records.size() - 1;
+      record.compressedData_   = bufferPool->Acquire(recordSize);
+      record.decompressedData_ = bufferPool->Acquire();
+      record.compressedData_->resize(recordSize);
 
-      try
-      {
-         std::stringstream ss;
-         std::streamsize   bytesCopied = boost::iostreams::copy(in, ss);
-         logger_->trace("Decompressed record size = {} bytes", bytesCopied);
+      is.read(record.compressedData_->data(),
+              static_cast<std::streamsize>(recordSize));
+      record.compressedData_->resize(static_cast<std::size_t>(is.gcount()));
+   }
 
-         rawRecords_.push_back(std::move(ss));
-      }
-      catch (const boost::iostreams::bzip2_error& ex)
+   // Decompress the records concurrently
+   std::for_each(std::execution::par,
+                 records.begin(),
+                 records.end(),
+                 [&bufferPool](LDMRecord& record)
+                 {
+                    boost::iostreams::filtering_streambuf<
+                       boost::iostreams::input>
+                       in;
+                    in.push(boost::iostreams::bzip2_decompressor());
+                    in.push(boost::iostreams::array_source(
+                       record.compressedData_->data(),
+                       record.compressedData_->size()));
+
+                    try
+                    {
+                       [[maybe_unused]] std::streamsize bytesCopied =
+                          boost::iostreams::copy(
+                             in,
+                             boost::iostreams::back_inserter(
+                                *record.decompressedData_));
+                       SPDLOG_LOGGER_TRACE(
+                          logger_,
+                          "Decompressed record size = {} bytes",
+                          bytesCopied);
+
+                       // The record is retained by the volume, so capacity
+                       // left over from growing the buffer is released
+                       record.decompressedData_ =
+                          bufferPool->ShrinkToFit(record.decompressedData_);
+                       record.valid_ = true;
+                    }
+                    catch (const boost::iostreams::bzip2_error& ex)
+                    {
+                       logger_->warn("Error decompressing record {}: {}",
+                                     record.recordNumber_,
+                                     ex.what());
+                    }
+
+                    // Return the compressed data to the pool as soon as it is
+                    // consumed
+                    record.compressedData_.reset();
+                 });
+
+   // Stitch the decompressed records together in order
+   for (auto& record : records)
+   {
+      if (record.valid_)
       {
-         logger_->warn(
-            "Error decompressing record {}: {}", numRecords, ex.what());
-
-         is.seekg(startPosition + std::streampos(recordSize),
-                  std::ios_base::beg);
+         rawRecords_.push_back(std::move(record.decompressedData_));
       }
-
-      ++numRecords;
    }
 
+   std::size_t numRecords = records.size();
+
    logger_->debug("Decompressed {} LDM Records", numRecords);
 
    return numRecords;
@@ -334,26 +1060,50 @@ void Ar2vFileImpl::ParseLDMRecords()
 {
    logger_->debug("Parsing LDM Records");
 
-   std::size_t count = 0;
+   util::ScopedTimer timer {util::ProfileStage::Parse};
+
+   [[maybe_unused]] std::size_t count = 0;
 
    for (auto it = rawRecords_.begin(); it != rawRecords_.end(); it++)
    {
-      std::stringstream& ss = *it;
+      std::shared_ptr<std::vector<char>>& recordBuffer = *it;
 
-      logger_->trace("Record {}", count++);
+      util::vectorbuf vb {*recordBuffer};
+      vb.update_read_pointers(recordBuffer->size());
+      std::istream is {&vb};
 
-      ParseLDMRecord(ss);
+      SPDLOG_LOGGER_TRACE(logger_, "Record {}", count);
+      ++count;
+
+      // Moment data blocks reference the record buffer, which is kept alive
+      // for as long as any radial from the record is in use
+      ParseLDMRecord(is, recordBuffer);
+
+      // Retain the decompressed record for the cache file
+      recordBuffers_.push_back(recordBuffer);
    }
 
    rawRecords_.clear();
 }
 
-void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
+void Ar2vFileImpl::ParseLDMRecord(
+   std::istream& is, const std::shared_ptr<std::vector<char>>& recordBuffer)
 {
    static constexpr std::size_t kDefaultSegmentSize = 2432;
    static constexpr std::size_t kCtmHeaderSize      = 12;
 
-   auto ctx = rda::Level2MessageFactory::CreateContext();
+   if (arenaEnabled_ && arena_ == nullptr)
+   {
+      // Radials and elevation scans of the volume share a single arena, which
+      // is released once the last of them is destroyed
+      arena_ = std::make_shared<util::Arena>();
+   }
+
+   auto ctx =
+      (recordBuffer != nullptr) ?
+         rda::Level2MessageFactory::CreateContext(
+            recordBuffer, arena_, momentsSwapped_) :
+         rda::Level2MessageFactory::CreateContext();
 
    while (!is.eof() && !is.fail())
    {
@@ -395,13 +1145,26 @@ void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
             }
          }
 
-         // Parse the current message
-         rda::Level2MessageInfo msgInfo =
-            rda::Level2MessageFactory::Create(is, ctx);
-
-         if (msgInfo.messageValid)
+         if (IsMetadataMessage(messageType) &&
+             (!metadataEnabled_ || recordBuffer != nullptr))
          {
-            HandleMessage(msgInfo.message);
+            // Metadata messages are seldom used. Skip them, or only note
+            // where they are, such that they are parsed when first accessed.
+            if (metadataEnabled_)
+            {
+               DeferMetadataMessage(messageHeader, recordBuffer, messageStart);
+            }
+         }
+         else
+         {
+            // Parse the current message
+            rda::Level2MessageInfo msgInfo =
+               rda::Level2MessageFactory::Create(is, ctx);
+
+            if (msgInfo.messageValid)
+            {
+               HandleMessage(msgInfo.message);
+            }
          }
       }
 
@@ -429,10 +1192,117 @@ void Ar2vFileImpl::HandleMessage(std::shared_ptr<rda::Level2Message>& message)
       break;
 
    default:
+      if (IsMetadataMessage(message->header().message_type()))
+      {
+         // Metadata messages parsed without a record buffer
+         std::unique_lock lock {metadataMutex_};
+         metadata_[message->header().message_type()] = {{}, message};
+      }
       break;
    }
 }
 
+bool Ar2vFileImpl::IsMetadataMessage(std::uint8_t messageType)
+{
+   switch (messageType)
+   {
+   case static_cast<std::uint8_t>(rda::MessageId::RdaStatusData):
+   case static_cast<std::uint8_t>(rda::MessageId::PerformanceMaintenanceData):
+   case static_cast<std::uint8_t>(rda::MessageId::ClutterFilterBypassMap):
+   case static_cast<std::uint8_t>(rda::MessageId::ClutterFilterMap):
+   case static_cast<std::uint8_t>(rda::MessageId::RdaAdaptationData):
+      return true;
+
+   default:
+      return false;
+   }
+}
+
+void Ar2vFileImpl::DeferMetadataMessage(
+   const rda::Level2MessageHeader&           header,
+   const std::shared_ptr<std::vector<char>>& buffer,
+   std::streampos                            messageStart)
+{
+   const std::uint8_t  messageType   = header.message_type();
+   const std::uint16_t segment       = header.message_segment_number();
+   const std::uint16_t totalSegments = header.number_of_message_segments();
+
+   std::unique_lock lock {metadataMutex_};
+
+   auto& [pendingType, pendingMessage] = pendingMetadata_;
+
+   if (segment <= 1)
+   {
+      // Begin a new message
+      pendingType    = messageType;
+      pendingMessage = {};
+   }
+   else if (pendingType != messageType ||
+            pendingMessage.segments_.size() + 1 != segment)
+   {
+      // Segment does not continue the message being received
+      SPDLOG_LOGGER_TRACE(logger_,
+                          "Ignoring metadata segment {}/{}",
+                          segment,
+                          totalSegments);
+      pendingMessage = {};
+      return;
+   }
+
+   pendingMessage.segments_.emplace_back(buffer, messageStart);
+
+   if (segment >= totalSegments)
+   {
+      // All segments have been received, replacing any previous message
+      metadata_[messageType] = std::move(pendingMessage);
+      pendingMessage         = {};
+      ++messageCount_;
+   }
+}
+
+std::shared_ptr<rda::Level2Message>
+Ar2vFileImpl::GetMetadataMessage(rda::MessageId messageId)
+{
+   std::unique_lock lock {metadataMutex_};
+
+   auto it = metadata_.find(static_cast<std::uint8_t>(messageId));
+   if (it == metadata_.cend())
+   {
+      return nullptr;
+   }
+
+   MetadataMessage& metadata = it->second;
+
+   if (metadata.message_ == nullptr && !metadata.segments_.empty())
+   {
+      logger_->debug("Parsing metadata message {}",
+                     static_cast<unsigned>(messageId));
+
+      auto ctx = rda::Level2MessageFactory::CreateContext();
+
+      for (auto& [buffer, messageStart] : metadata.segments_)
+      {
+         util::vectorbuf vb {*buffer};
+         vb.update_read_pointers(buffer->size());
+         std::istream is {&vb};
+         is.seekg(messageStart, std::ios_base::beg);
+
+         rda::Level2MessageInfo msgInfo =
+            rda::Level2MessageFactory::Create(is, ctx);
+
+         if (msgInfo.messageValid)
+         {
+            metadata.message_ = msgInfo.message;
+         }
+      }
+
+      // The message is only parsed once, whether or not it was valid
+      metadata.segments_.clear();
+   }
+
+   return metadata.message_;
+}
+
 void Ar2vFileImpl::ProcessRadarData(
    const std::shared_ptr<rda::GenericRadarData>& message)
 {
@@ -441,13 +1311,97 @@ void Ar2vFileImpl::ProcessRadarData(
 
    if (radarData_[elevationIndex] == nullptr)
    {
-      radarData_[elevationIndex] = std::make_shared<rda::ElevationScan>();
+      std::pmr::memory_resource* resource =
+         (arena_ != nullptr) ? arena_.get() : std::pmr::get_default_resource();
+      radarData_[elevationIndex] =
+         util::MakeShared<rda::ElevationScan>(arena_, resource);
    }
 
    (*radarData_[elevationIndex])[azimuthIndex] = message;
+
+   rda::RadialStatus radialStatus =
+      static_cast<rda::RadialStatus>(message->radial_status());
+
+   if (radialStatus == rda::RadialStatus::EndOfElevation ||
+       radialStatus == rda::RadialStatus::EndOfVolumeScan)
+   {
+      completedElevations_.push_back(elevationIndex);
+   }
+}
+
+float Ar2vFileImpl::GetElevationAngle(std::uint16_t elevationIndex) const
+{
+   float elevationAngle = 0.0f;
+
+   if (vcpData_ != nullptr)
+   {
+      elevationAngle = vcpData_->elevation_angle_raw(elevationIndex) /
+                       kElevationScaleFactor_;
+   }
+   else
+   {
+      auto it = radarData_.find(elevationIndex);
+      std::shared_ptr<rda::DigitalRadarData> digitalRadarData0 = nullptr;
+
+      if (it != radarData_.cend() && !it->second->empty() &&
+          (digitalRadarData0 = std::dynamic_pointer_cast<rda::DigitalRadarData>(
+              it->second->cbegin()->second)) != nullptr)
+      {
+         elevationAngle =
+            digitalRadarData0->elevation_angle_raw() / kElevationScaleFactor_;
+      }
+   }
+
+   return elevationAngle;
 }
 
-void Ar2vFileImpl::IndexFile()
+void Ar2vFileImpl::NotifyCompletedElevations()
+{
+   std::vector<std::pair<std::uint16_t, float>> completedElevations {};
+   Ar2vFile::ElevationCompleteCallback          callback {};
+
+   {
+      // The callback is invoked without the lock, so it may access the volume
+      std::unique_lock lock {mutex_};
+
+      callback = elevationCompleteCallback_;
+
+      if (callback != nullptr)
+      {
+         for (std::uint16_t elevationIndex : completedElevations_)
+         {
+            completedElevations.emplace_back(elevationIndex,
+                                             GetElevationAngle(elevationIndex));
+         }
+      }
+
+      completedElevations_.clear();
+   }
+
+   for (auto& [elevationIndex, elevationAngle] : completedElevations)
+   {
+      logger_->debug(
+         "Elevation {} complete: {} degrees", elevationIndex, elevationAngle);
+
+      callback(elevationIndex, elevationAngle);
+   }
+}
+
+bool Ar2vFileImpl::IsElevationComplete(const rda::ElevationScan& elevationScan)
+{
+   if (elevationScan.empty())
+   {
+      return false;
+   }
+
+   const rda::RadialStatus radialStatus = static_cast<rda::RadialStatus>(
+      elevationScan.crbegin()->second->radial_status());
+
+   return radialStatus == rda::RadialStatus::EndOfElevation ||
+          radialStatus == rda::RadialStatus::EndOfVolumeScan;
+}
+
+void Ar2vFileImpl::IndexFile(bool completeOnly)
 {
    logger_->debug("Indexing file");
 
@@ -465,6 +1419,12 @@ void Ar2vFileImpl::IndexFile()
          continue;
       }
 
+      if (completeOnly && !IsElevationComplete(*elevationCut.second))
+      {
+         // Further radials of the elevation have not been loaded yet
+         continue;
+      }
+
       std::shared_ptr<rda::DigitalRadarData> digitalRadarData0 = nullptr;
 
       if (vcpData_ != nullptr)
@@ -508,6 +1468,22 @@ void Ar2vFileImpl::IndexFile()
          }
       }
    }
+
+   for (auto& [dataBlockType, scans] : index_)
+   {
+      auto& elevationCuts = elevationCuts_[dataBlockType];
+
+      if (elevationCuts.size() != scans.size())
+      {
+         elevationCuts.clear();
+         elevationCuts.reserve(scans.size());
+
+         for (auto& scan : scans)
+         {
+            elevationCuts.push_back(Ar2vFile::DecodeElevation(scan.first));
+         }
+      }
+   }
 }
 
 } // namespace wsr88d
@@ -1,10 +1,12 @@
 #include <scwx/wsr88d/level3_file.hpp>
 #include <scwx/wsr88d/rpg/ccb_header.hpp>
+#include <scwx/wsr88d/rpg/graphic_product_message.hpp>
 #include <scwx/wsr88d/rpg/level3_message_factory.hpp>
+#include <scwx/util/buffer_pool.hpp>
 #include <scwx/util/logger.hpp>
-
-#include <fstream>
-#include <sstream>
+#include <scwx/util/mapped_file_stream.hpp>
+#include <scwx/util/profiler.hpp>
+#include <scwx/util/vectorbuf.hpp>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -18,6 +20,7 @@
 #endif
 
 #include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/filtering_streambuf.hpp>
 #include <boost/iostreams/filter/zlib.hpp>
 
@@ -44,13 +47,16 @@ public:
        wmoHeader_ {}, ccbHeader_ {}, innerHeader_ {}, message_ {} {};
    ~Level3FileImpl() = default;
 
-   bool DecompressFile(std::istream& is, std::stringstream& ss);
+   bool DecompressFile(std::istream& is, std::vector<char>& buffer);
+   bool LoadDecompressedData(std::istream& is);
    bool LoadFileData(std::istream& is);
 
    std::shared_ptr<awips::WmoHeader>   wmoHeader_;
    std::shared_ptr<rpg::CcbHeader>     ccbHeader_;
    std::shared_ptr<awips::WmoHeader>   innerHeader_;
    std::shared_ptr<rpg::Level3Message> message_;
+
+   std::size_t dataSize_ {0};
 };
 
 Level3File::Level3File() : p(std::make_unique<Level3FileImpl>()) {}
@@ -69,12 +75,27 @@ std::shared_ptr<rpg::Level3Message> Level3File::message() const
    return p->message_;
 }
 
+std::size_t Level3File::data_size() const
+{
+   std::size_t dataSize = p->dataSize_;
+
+   // Compressed symbology is held decompressed
+   auto graphicMessage =
+      std::dynamic_pointer_cast<rpg::GraphicProductMessage>(p->message_);
+   if (graphicMessage != nullptr)
+   {
+      dataSize += graphicMessage->decompressed_size();
+   }
+
+   return dataSize;
+}
+
 bool Level3File::LoadFile(const std::string& filename)
 {
    logger_->debug("LoadFile: {}", filename);
    bool fileValid = true;
 
-   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   util::MappedFileStream f {filename};
    if (!f.good())
    {
       logger_->warn("Could not open file for reading: {}", filename);
@@ -108,26 +129,43 @@ bool Level3File::LoadData(std::istream& is)
       // If the header is compressed
       if (is.peek() == 0x78)
       {
-         std::stringstream ss;
+         auto buffer = util::BufferPool::Instance()->Acquire();
 
-         dataValid = p->DecompressFile(is, ss);
+         dataValid = p->DecompressFile(is, *buffer);
 
          if (dataValid)
          {
-            dataValid = p->LoadFileData(ss);
+            util::vectorbuf vb {*buffer};
+            vb.update_read_pointers(buffer->size());
+            std::istream ss {&vb};
+
+            dataValid = p->LoadDecompressedData(ss);
+
+            p->dataSize_ = buffer->size();
          }
       }
       else
       {
+         const std::streampos dataStart = is.tellg();
+
          dataValid = p->LoadFileData(is);
+
+         const std::streampos dataEnd = is.tellg();
+         if (dataStart != -1 && dataEnd > dataStart)
+         {
+            p->dataSize_ = static_cast<std::size_t>(dataEnd - dataStart);
+         }
       }
    }
 
    return dataValid;
 }
 
-bool Level3FileImpl::DecompressFile(std::istream& is, std::stringstream& ss)
+bool Level3FileImpl::DecompressFile(std::istream&      is,
+                                    std::vector<char>& buffer)
 {
+   util::ScopedTimer timer {util::ProfileStage::Decompress};
+
    bool dataValid = true;
 
    std::streampos  dataStart          = is.tellg();
@@ -142,8 +180,9 @@ bool Level3FileImpl::DecompressFile(std::istream& is, std::stringstream& ss)
          in.push(zlibDecompressor);
          in.push(is);
 
-         std::streamsize bytesCopied   = boost::iostreams::copy(in, ss);
-         int             bytesConsumed = zlibDecompressor.filter().total_in();
+         std::streamsize bytesCopied = boost::iostreams::copy(
+            in, boost::iostreams::back_inserter(buffer));
+         int bytesConsumed = zlibDecompressor.filter().total_in();
 
          totalBytesCopied += bytesCopied;
          totalBytesConsumed += bytesConsumed;
@@ -166,17 +205,33 @@ bool Level3FileImpl::DecompressFile(std::istream& is, std::stringstream& ss)
 
    if (dataValid)
    {
-      logger_->trace("Input data consumed = {} bytes", totalBytesCopied);
-      logger_->trace("Decompressed data size = {} bytes", totalBytesConsumed);
-
-      ccbHeader_ = std::make_shared<rpg::CcbHeader>();
-      dataValid  = ccbHeader_->Parse(ss);
+      SPDLOG_LOGGER_TRACE(logger_,
+                          "Input data consumed = {} bytes",
+                          totalBytesCopied);
+      SPDLOG_LOGGER_TRACE(logger_,
+                          "Decompressed data size = {} bytes",
+                          totalBytesConsumed);
    }
 
+   return dataValid;
+}
+
+bool Level3FileImpl::LoadDecompressedData(std::istream& is)
+{
+   util::ScopedTimer timer {util::ProfileStage::Parse};
+
+   ccbHeader_     = std::make_shared<rpg::CcbHeader>();
+   bool dataValid = ccbHeader_->Parse(is);
+
    if (dataValid)
    {
       innerHeader_ = std::make_shared<awips::WmoHeader>();
-      dataValid    = innerHeader_->Parse(ss);
+      dataValid    = innerHeader_->Parse(is);
+   }
+
+   if (dataValid)
+   {
+      dataValid = LoadFileData(is);
    }
 
    return dataValid;
@@ -184,6 +239,8 @@ bool Level3FileImpl::DecompressFile(std::istream& is, std::stringstream& ss)
 
 bool Level3FileImpl::LoadFileData(std::istream& is)
 {
+   util::ScopedTimer timer {util::ProfileStage::Parse};
+
    message_ = rpg::Level3MessageFactory::Create(is);
 
    return (message_ != nullptr);
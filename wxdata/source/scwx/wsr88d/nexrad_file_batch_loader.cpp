@@ -0,0 +1,273 @@
+#include <scwx/wsr88d/nexrad_file_batch_loader.hpp>
+#include <scwx/wsr88d/nexrad_file_factory.hpp>
+#include <scwx/provider/nexrad_data_provider.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <regex>
+#include <thread>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static const std::string logPrefix_ = "scwx::wsr88d::nexrad_file_batch_loader";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+struct BatchSource
+{
+   std::string                                   name_ {};
+   std::shared_ptr<provider::NexradDataProvider> provider_ {nullptr};
+   std::chrono::system_clock::time_point         time_ {};
+};
+
+class NexradFileBatchLoader::Impl
+{
+public:
+   explicit Impl(std::size_t threadCount, std::size_t maxPending) :
+       threadCount_ {threadCount > 0 ?
+                        threadCount :
+                        std::max(1u, std::thread::hardware_concurrency())},
+       maxPending_ {std::max<std::size_t>(maxPending, 1u)}
+   {
+   }
+   ~Impl() = default;
+
+   std::shared_ptr<NexradFile> Load(const BatchSource& source);
+
+   static std::chrono::system_clock::time_point
+   GetFileTime(const std::string& filename);
+
+   const std::size_t threadCount_;
+   const std::size_t maxPending_;
+
+   std::vector<BatchSource> sources_ {};
+   FileLoadedCallback       fileLoadedCallback_ {};
+
+   std::atomic<bool> cancelled_ {false};
+
+   std::map<std::size_t, std::shared_ptr<NexradFile>> loadedFiles_ {};
+   std::mutex                                         loadedFilesMutex_ {};
+   std::condition_variable                            loadedFilesCondition_ {};
+};
+
+NexradFileBatchLoader::NexradFileBatchLoader(std::size_t threadCount,
+                                             std::size_t maxPending) :
+    p(std::make_unique<Impl>(threadCount, maxPending))
+{
+}
+NexradFileBatchLoader::~NexradFileBatchLoader() = default;
+
+NexradFileBatchLoader::NexradFileBatchLoader(
+   NexradFileBatchLoader&&) noexcept = default;
+NexradFileBatchLoader&
+NexradFileBatchLoader::operator=(NexradFileBatchLoader&&) noexcept = default;
+
+std::size_t NexradFileBatchLoader::source_count() const
+{
+   return p->sources_.size();
+}
+
+void NexradFileBatchLoader::AddFiles(const std::vector<std::string>& filenames)
+{
+   for (auto& filename : filenames)
+   {
+      p->sources_.push_back({filename, nullptr, Impl::GetFileTime(filename)});
+   }
+}
+
+void NexradFileBatchLoader::AddKeys(
+   std::shared_ptr<provider::NexradDataProvider> provider,
+   const std::vector<std::string>&               keys)
+{
+   for (auto& key : keys)
+   {
+      std::chrono::system_clock::time_point time {};
+
+      try
+      {
+         time = provider->GetTimePointByKey(key);
+      }
+      catch (const std::exception& ex)
+      {
+         logger_->warn("Error reading time from {}: {}", key, ex.what());
+      }
+
+      p->sources_.push_back({key, provider, time});
+   }
+}
+
+void NexradFileBatchLoader::SetFileLoadedCallback(FileLoadedCallback callback)
+{
+   p->fileLoadedCallback_ = std::move(callback);
+}
+
+std::chrono::system_clock::time_point
+NexradFileBatchLoader::Impl::GetFileTime(const std::string& filename)
+{
+   using namespace std::chrono;
+
+   // Level 2 and Level 3 filenames contain the volume time as YYYYMMDD_HHMMSS,
+   // YYYYMMDDHHMM or YYYY_MM_DD_HH_MM_SS, with optional seconds
+   static const std::regex kTimeRegex {
+      R"((\d{4})_?(\d{2})_?(\d{2})_?(\d{2})_?(\d{2})(?:_?(\d{2}))?)"};
+
+   const std::string stem = std::filesystem::path(filename).filename().string();
+
+   std::smatch match {};
+   if (!std::regex_search(stem, match, kTimeRegex))
+   {
+      return {};
+   }
+
+   const year_month_day date {
+      year {std::stoi(match[1].str())},
+      month {static_cast<unsigned int>(std::stoi(match[2].str()))},
+      day {static_cast<unsigned int>(std::stoi(match[3].str()))}};
+   if (!date.ok())
+   {
+      return {};
+   }
+
+   return sys_days {date} + hours {std::stoi(match[4].str())} +
+          minutes {std::stoi(match[5].str())} +
+          seconds {match[6].matched ? std::stoi(match[6].str()) : 0};
+}
+
+std::shared_ptr<NexradFile>
+NexradFileBatchLoader::Impl::Load(const BatchSource& source)
+{
+   std::shared_ptr<NexradFile> nexradFile = nullptr;
+
+   try
+   {
+      if (source.provider_ != nullptr)
+      {
+         nexradFile = source.provider_->LoadObjectByKey(source.name_);
+      }
+      else
+      {
+         nexradFile = NexradFileFactory::Create(source.name_);
+      }
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->warn("Error loading {}: {}", source.name_, ex.what());
+   }
+
+   if (nexradFile == nullptr)
+   {
+      logger_->warn("Could not load: {}", source.name_);
+   }
+
+   return nexradFile;
+}
+
+std::size_t NexradFileBatchLoader::Run()
+{
+   logger_->debug("Loading {} sources", p->sources_.size());
+
+   // Deliver sources in volume time order, and in the order added otherwise
+   std::stable_sort(p->sources_.begin(),
+                    p->sources_.end(),
+                    [](const BatchSource& a, const BatchSource& b)
+                    { return a.time_ < b.time_; });
+
+   const std::size_t sourceCount = p->sources_.size();
+   std::size_t       nextLoad    = 0;
+   std::size_t       nextDeliver = 0;
+   std::size_t       loadedCount = 0;
+
+   p->loadedFiles_.clear();
+
+   boost::asio::thread_pool threadPool {p->threadCount_};
+
+   while (nextDeliver < sourceCount && !p->cancelled_)
+   {
+      // Keep the pipeline full, within the pending limit
+      while (nextLoad < sourceCount && nextLoad - nextDeliver < p->maxPending_)
+      {
+         boost::asio::post(threadPool,
+                           [this, index = nextLoad]()
+                           {
+                              std::shared_ptr<NexradFile> nexradFile =
+                                 nullptr;
+
+                              if (!p->cancelled_)
+                              {
+                                 nexradFile = p->Load(p->sources_[index]);
+                              }
+
+                              std::unique_lock lock(p->loadedFilesMutex_);
+                              p->loadedFiles_[index] = std::move(nexradFile);
+                              p->loadedFilesCondition_.notify_all();
+                           });
+         ++nextLoad;
+      }
+
+      // Wait for the next file in order
+      std::shared_ptr<NexradFile> nexradFile = nullptr;
+      {
+         std::unique_lock lock(p->loadedFilesMutex_);
+         p->loadedFilesCondition_.wait(
+            lock,
+            [&]()
+            {
+               return p->cancelled_ || p->loadedFiles_.contains(nextDeliver);
+            });
+
+         if (p->cancelled_)
+         {
+            break;
+         }
+
+         auto it    = p->loadedFiles_.find(nextDeliver);
+         nexradFile = std::move(it->second);
+         p->loadedFiles_.erase(it);
+      }
+
+      if (nexradFile != nullptr)
+      {
+         ++loadedCount;
+      }
+
+      if (p->fileLoadedCallback_ != nullptr && !p->cancelled_)
+      {
+         p->fileLoadedCallback_(
+            nextDeliver, p->sources_[nextDeliver].name_, nexradFile);
+      }
+
+      ++nextDeliver;
+   }
+
+   threadPool.join();
+   p->loadedFiles_.clear();
+
+   logger_->debug("Loaded {} of {} sources", loadedCount, sourceCount);
+
+   return loadedCount;
+}
+
+void NexradFileBatchLoader::Cancel()
+{
+   {
+      // Set under the mutex, so a waiting Run() cannot miss the notification
+      std::unique_lock lock(p->loadedFilesMutex_);
+      p->cancelled_ = true;
+   }
+
+   p->loadedFilesCondition_.notify_all();
+}
+
+} // namespace wsr88d
+} // namespace scwx
@@ -2,8 +2,9 @@
 #include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/level3_file.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/mapped_file_stream.hpp>
+#include <scwx/util/time.hpp>
 
-#include <fstream>
 #include <sstream>
 
 #if defined(_MSC_VER)
@@ -45,7 +46,7 @@ NexradFileFactory::Create(const std::string& filename)
    std::shared_ptr<NexradFile> nexradFile = nullptr;
    bool                        fileValid  = true;
 
-   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   util::MappedFileStream f {filename};
    if (!f.good())
    {
       logger_->warn("Could not open file for reading: {}", filename);
@@ -84,7 +85,8 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
 
       try
       {
-         std::streamsize bytesCopied = boost::iostreams::copy(in, ss);
+         [[maybe_unused]] std::streamsize bytesCopied =
+            boost::iostreams::copy(in, ss);
 
          pis      = &ss;
          pisBegin = ss.tellg();
@@ -93,7 +95,9 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
          dataValid = ss.good();
          ss.seekg(pisBegin, std::ios_base::beg);
 
-         logger_->trace("Decompressed file = {} bytes", bytesCopied);
+         SPDLOG_LOGGER_TRACE(logger_,
+                             "Decompressed file = {} bytes",
+                             bytesCopied);
 
          if (!dataValid)
          {
@@ -137,5 +141,169 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
    return message;
 }
 
+std::optional<NexradFileInfo>
+NexradFileFactory::Probe(const std::string& filename)
+{
+   logger_->debug("Probe: {}", filename);
+
+   std::optional<NexradFileInfo> info = std::nullopt;
+
+   util::MappedFileStream f {filename};
+   if (!f.good())
+   {
+      logger_->warn("Could not open file for reading: {}", filename);
+   }
+   else
+   {
+      info = Probe(f);
+   }
+
+   return info;
+}
+
+static NexradFileInfo GetLevel2Info(const Ar2vFile& level2File)
+{
+   NexradFileInfo info {};
+   info.group_   = common::RadarProductGroup::Level2;
+   info.radarId_ = level2File.icao();
+   info.time_    = level2File.start_time();
+
+   auto vcpData = level2File.vcp_data();
+   if (vcpData != nullptr)
+   {
+      info.vcp_ = vcpData->pattern_number();
+
+      for (std::uint16_t e = 0; e < vcpData->number_of_elevation_cuts(); ++e)
+      {
+         info.elevationCuts_.push_back(
+            static_cast<float>(vcpData->elevation_angle(e)));
+      }
+   }
+
+   return info;
+}
+
+static std::optional<NexradFileInfo>
+GetFileInfo(const std::shared_ptr<NexradFile>& nexradFile)
+{
+   auto level2File = std::dynamic_pointer_cast<Ar2vFile>(nexradFile);
+   auto level3File = std::dynamic_pointer_cast<Level3File>(nexradFile);
+
+   if (level2File != nullptr)
+   {
+      return GetLevel2Info(*level2File);
+   }
+   if (level3File == nullptr || level3File->message() == nullptr)
+   {
+      return std::nullopt;
+   }
+
+   auto message          = level3File->message();
+   auto descriptionBlock = message->description_block();
+
+   NexradFileInfo info {};
+   info.group_   = common::RadarProductGroup::Level3;
+   info.radarId_ = level3File->wmo_header()->icao();
+
+   if (descriptionBlock != nullptr)
+   {
+      info.time_ =
+         util::TimePoint(descriptionBlock->volume_scan_date(),
+                         descriptionBlock->volume_scan_start_time() * 1000u);
+      info.vcp_ = descriptionBlock->volume_coverage_pattern();
+      info.elevationCuts_.push_back(
+         static_cast<float>(descriptionBlock->elevation().value()));
+   }
+   else
+   {
+      info.time_ = util::TimePoint(message->header().date_of_message(),
+                                   message->header().time_of_message() * 1000u);
+   }
+
+   return info;
+}
+
+static std::optional<NexradFileInfo> ProbeLevel2(std::istream& is)
+{
+   Ar2vFile level2File {};
+   level2File.SetArenaEnabled(false);
+   level2File.SetMetadataEnabled(false);
+
+   if (!level2File.LoadHeader(is))
+   {
+      return std::nullopt;
+   }
+
+   return GetLevel2Info(level2File);
+}
+
+std::optional<NexradFileInfo> NexradFileFactory::Probe(std::istream& is)
+{
+   std::streampos pisBegin = is.tellg();
+   std::string    buffer;
+   bool           dataValid;
+
+   buffer.resize(8);
+
+   is.read(buffer.data(), 8);
+   dataValid = is.good();
+   is.seekg(pisBegin, std::ios_base::beg);
+
+   if (!dataValid)
+   {
+      logger_->warn("Error reading file");
+      return std::nullopt;
+   }
+
+   if (buffer.starts_with("\x1f\x8b"))
+   {
+      try
+      {
+         // Decompress only as much of the file as is needed
+         boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
+         in.push(boost::iostreams::gzip_decompressor());
+         in.push(is);
+
+         std::istream gis {&in};
+         gis.read(buffer.data(), 8);
+
+         // Return the magic bytes to the decompressed stream
+         for (std::size_t i = 0; i < buffer.size() && gis.good(); ++i)
+         {
+            gis.unget();
+         }
+
+         if (gis.good() &&
+             (buffer.starts_with("AR2V") || buffer.starts_with("ARCHIVE2")))
+         {
+            return ProbeLevel2(gis);
+         }
+      }
+      catch (const boost::iostreams::gzip_error& ex)
+      {
+         logger_->warn("Error decompressing file: {}", ex.what());
+         return std::nullopt;
+      }
+
+      // Level 3 products are small, load them in full
+      is.clear();
+      is.seekg(pisBegin, std::ios_base::beg);
+      return GetFileInfo(Create(is));
+   }
+
+   if (buffer.starts_with("AR2V") || buffer.starts_with("ARCHIVE2"))
+   {
+      return ProbeLevel2(is);
+   }
+
+   std::shared_ptr<Level3File> level3File = std::make_shared<Level3File>();
+   if (!level3File->LoadData(is))
+   {
+      return std::nullopt;
+   }
+
+   return GetFileInfo(level3File);
+}
+
 } // namespace wsr88d
 } // namespace scwx
@@ -61,7 +61,8 @@ ClutterFilterBypassMap::range_bin(uint16_t e, uint16_t r, uint16_t b) const
 
 bool ClutterFilterBypassMap::Parse(std::istream& is)
 {
-   logger_->trace("Parsing Clutter Filter Bypass Map (Message Type 13)");
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Parsing Clutter Filter Bypass Map (Message Type 13)");
 
    bool     messageValid         = true;
    size_t   bytesRead            = 0;
@@ -78,7 +79,7 @@ bool ClutterFilterBypassMap::Parse(std::istream& is)
 
    if (p->mapGenerationDate_ < 1)
    {
-      logger_->trace("Ignoring empty message");
+      SPDLOG_LOGGER_TRACE(logger_, "Ignoring empty message");
       messageValid = false;
    }
    else
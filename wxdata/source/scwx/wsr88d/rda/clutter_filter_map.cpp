@@ -74,7 +74,7 @@ uint16_t ClutterFilterMap::end_range(uint16_t e, uint16_t a, uint16_t z) const
 
 bool ClutterFilterMap::Parse(std::istream& is)
 {
-   logger_->trace("Parsing Clutter Filter Map (Message Type 15)");
+   SPDLOG_LOGGER_TRACE(logger_, "Parsing Clutter Filter Map (Message Type 15)");
 
    bool     messageValid         = true;
    size_t   bytesRead            = 0;
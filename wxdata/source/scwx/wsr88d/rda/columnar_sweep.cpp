@@ -0,0 +1,320 @@
+#include <scwx/wsr88d/rda/columnar_sweep.hpp>
+#include <scwx/util/memory.hpp>
+#include <scwx/util/time.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+class ColumnarSweep::Impl
+{
+public:
+   explicit Impl(DataBlockType dataBlockType) : dataBlockType_ {dataBlockType}
+   {
+   }
+   ~Impl() = default;
+
+   DataBlockType dataBlockType_;
+   bool          complete_ {true};
+   bool          uniform_ {true};
+   std::uint16_t stride_ {0u};
+
+   std::uint16_t numberOfDataMomentGates_ {0u};
+   std::int16_t  dataMomentRangeRaw_ {0};
+   std::uint16_t dataMomentRangeSampleIntervalRaw_ {0u};
+   std::int16_t  snrThresholdRaw_ {0};
+   std::uint8_t  dataWordSize_ {0u};
+   float         scale_ {0.0f};
+   float         offset_ {0.0f};
+
+   std::vector<std::uint16_t>                         radials_ {};
+   std::vector<float>                                 azimuths_ {};
+   std::vector<std::chrono::system_clock::time_point> times_ {};
+   std::vector<std::uint16_t>                         gateCounts_ {};
+
+   std::vector<std::uint8_t>  dataMoments8_ {};
+   std::vector<std::uint16_t> dataMoments16_ {};
+
+   util::MemoryCounter memory_ {"Columnar Sweeps"};
+};
+
+/**
+ * @brief Columnar sweeps by elevation scan and moment. Sweeps of elevation
+ * scans which have been released are removed on the next lookup.
+ */
+struct ColumnarSweepEntry
+{
+   std::weak_ptr<ElevationScan>         source_ {};
+   std::size_t                          radials_ {0u};
+   std::shared_ptr<const ColumnarSweep> sweep_ {};
+};
+
+static std::map<std::pair<const ElevationScan*, DataBlockType>,
+                ColumnarSweepEntry>
+                  sweepCache_ {};
+static std::mutex sweepCacheMutex_ {};
+
+ColumnarSweep::ColumnarSweep(const ElevationScan& elevationScan,
+                             DataBlockType        dataBlockType) :
+    p(std::make_unique<Impl>(dataBlockType))
+{
+   std::vector<std::shared_ptr<GenericRadarData::MomentDataBlock>> blocks {};
+   blocks.reserve(elevationScan.size());
+
+   p->radials_.reserve(elevationScan.size());
+   p->azimuths_.reserve(elevationScan.size());
+   p->times_.reserve(elevationScan.size());
+   p->gateCounts_.reserve(elevationScan.size());
+
+   for (auto& radial : elevationScan)
+   {
+      auto block = radial.second->moment_data_block(dataBlockType);
+
+      if (block == nullptr ||
+          (!blocks.empty() && block->data_word_size() != p->dataWordSize_))
+      {
+         p->complete_ = false;
+         continue;
+      }
+
+      if (blocks.empty())
+      {
+         p->numberOfDataMomentGates_ = block->number_of_data_moment_gates();
+         p->dataMomentRangeRaw_      = block->data_moment_range_raw();
+         p->dataMomentRangeSampleIntervalRaw_ =
+            block->data_moment_range_sample_interval_raw();
+         p->snrThresholdRaw_ = block->snr_threshold_raw();
+         p->dataWordSize_    = block->data_word_size();
+         p->scale_           = block->scale();
+         p->offset_          = block->offset();
+      }
+      else if (block->number_of_data_moment_gates() !=
+                  p->numberOfDataMomentGates_ ||
+               block->data_moment_range_raw() != p->dataMomentRangeRaw_ ||
+               block->data_moment_range_sample_interval_raw() !=
+                  p->dataMomentRangeSampleIntervalRaw_)
+      {
+         p->uniform_ = false;
+      }
+
+      p->radials_.push_back(radial.first);
+      p->azimuths_.push_back(radial.second->azimuth_angle().value());
+      p->times_.push_back(
+         util::TimePoint(radial.second->modified_julian_date(),
+                         radial.second->collection_time()));
+      p->gateCounts_.push_back(block->number_of_data_moment_gates());
+      p->stride_ =
+         std::max(p->stride_, block->number_of_data_moment_gates());
+
+      blocks.push_back(std::move(block));
+   }
+
+   const std::size_t size = blocks.size() * p->stride_;
+
+   if (p->dataWordSize_ == 8)
+   {
+      p->dataMoments8_.resize(size, 0u);
+   }
+   else
+   {
+      p->dataMoments16_.resize(size, 0u);
+   }
+
+   // Copy the data moments of each radial to its row
+   for (std::size_t i = 0; i < blocks.size(); ++i)
+   {
+      const std::size_t gates  = p->gateCounts_[i];
+      const std::size_t offset = i * p->stride_;
+
+      if (p->dataWordSize_ == 8)
+      {
+         std::memcpy(&p->dataMoments8_[offset],
+                     blocks[i]->data_moments(),
+                     gates * sizeof(std::uint8_t));
+      }
+      else
+      {
+         std::memcpy(&p->dataMoments16_[offset],
+                     blocks[i]->data_moments(),
+                     gates * sizeof(std::uint16_t));
+      }
+   }
+
+   p->memory_.set_bytes(size_bytes());
+}
+
+ColumnarSweep::~ColumnarSweep() = default;
+
+DataBlockType ColumnarSweep::data_block_type() const
+{
+   return p->dataBlockType_;
+}
+
+std::size_t ColumnarSweep::radial_count() const
+{
+   return p->radials_.size();
+}
+
+bool ColumnarSweep::complete() const
+{
+   return p->complete_;
+}
+
+bool ColumnarSweep::uniform() const
+{
+   return p->uniform_;
+}
+
+std::uint16_t ColumnarSweep::stride() const
+{
+   return p->stride_;
+}
+
+std::uint16_t ColumnarSweep::number_of_data_moment_gates() const
+{
+   return p->numberOfDataMomentGates_;
+}
+
+std::int16_t ColumnarSweep::data_moment_range_raw() const
+{
+   return p->dataMomentRangeRaw_;
+}
+
+std::uint16_t ColumnarSweep::data_moment_range_sample_interval_raw() const
+{
+   return p->dataMomentRangeSampleIntervalRaw_;
+}
+
+std::int16_t ColumnarSweep::snr_threshold_raw() const
+{
+   return p->snrThresholdRaw_;
+}
+
+std::uint8_t ColumnarSweep::data_word_size() const
+{
+   return p->dataWordSize_;
+}
+
+float ColumnarSweep::scale() const
+{
+   return p->scale_;
+}
+
+float ColumnarSweep::offset() const
+{
+   return p->offset_;
+}
+
+std::span<const std::uint16_t> ColumnarSweep::radials() const
+{
+   return p->radials_;
+}
+
+std::span<const float> ColumnarSweep::azimuths() const
+{
+   return p->azimuths_;
+}
+
+std::span<const std::chrono::system_clock::time_point>
+ColumnarSweep::times() const
+{
+   return p->times_;
+}
+
+std::span<const std::uint16_t> ColumnarSweep::gate_counts() const
+{
+   return p->gateCounts_;
+}
+
+std::span<const std::uint8_t>
+ColumnarSweep::data_moments8(std::size_t radial) const
+{
+   if (p->dataMoments8_.empty())
+   {
+      return {};
+   }
+
+   return std::span<const std::uint8_t> {p->dataMoments8_}.subspan(
+      radial * p->stride_, p->gateCounts_[radial]);
+}
+
+std::span<const std::uint16_t>
+ColumnarSweep::data_moments16(std::size_t radial) const
+{
+   if (p->dataMoments16_.empty())
+   {
+      return {};
+   }
+
+   return std::span<const std::uint16_t> {p->dataMoments16_}.subspan(
+      radial * p->stride_, p->gateCounts_[radial]);
+}
+
+std::size_t ColumnarSweep::size_bytes() const
+{
+   return p->dataMoments8_.capacity() * sizeof(std::uint8_t) +
+          p->dataMoments16_.capacity() * sizeof(std::uint16_t) +
+          p->radials_.capacity() * sizeof(std::uint16_t) +
+          p->azimuths_.capacity() * sizeof(float) +
+          p->times_.capacity() *
+             sizeof(std::chrono::system_clock::time_point) +
+          p->gateCounts_.capacity() * sizeof(std::uint16_t);
+}
+
+std::shared_ptr<const ColumnarSweep>
+ColumnarSweep::Get(const std::shared_ptr<ElevationScan>& elevationScan,
+                   DataBlockType                         dataBlockType)
+{
+   if (elevationScan == nullptr || elevationScan->empty())
+   {
+      return nullptr;
+   }
+
+   const std::pair<const ElevationScan*, DataBlockType> key {
+      elevationScan.get(), dataBlockType};
+   const std::size_t radials = elevationScan->size();
+
+   {
+      std::unique_lock lock {sweepCacheMutex_};
+
+      // Release sweeps of elevation scans which are no longer loaded
+      std::erase_if(sweepCache_,
+                    [](const auto& entry)
+                    { return entry.second.source_.expired(); });
+
+      auto it = sweepCache_.find(key);
+      if (it != sweepCache_.cend() &&
+          it->second.source_.lock() == elevationScan &&
+          it->second.radials_ == radials)
+      {
+         return it->second.sweep_;
+      }
+   }
+
+   // The sweep is built without holding the lock, such that sweeps of other
+   // elevation scans are not held up
+   std::shared_ptr<const ColumnarSweep> sweep =
+      std::make_shared<ColumnarSweep>(*elevationScan, dataBlockType);
+   if (sweep->radial_count() == 0)
+   {
+      sweep = nullptr;
+   }
+
+   std::unique_lock lock {sweepCacheMutex_};
+   sweepCache_[key] = {elevationScan, radials, sweep};
+
+   return sweep;
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
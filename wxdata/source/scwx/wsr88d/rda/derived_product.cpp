@@ -0,0 +1,782 @@
+#include <scwx/wsr88d/rda/derived_product.hpp>
+#include <scwx/wsr88d/rda/derived_radar_data.hpp>
+#include <scwx/wsr88d/rda/digital_radar_data.hpp>
+#include <scwx/wsr88d/rda/digital_radar_data_generic.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <numbers>
+#include <set>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+static const std::string logPrefix_ = "scwx::wsr88d::rda::derived_product";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+// Coded data moments below this level are below threshold or range folded
+static constexpr std::uint16_t kMinDataLevel_ = 2u;
+
+// Gates searched back along a radial for a dealiasing reference
+static constexpr std::uint16_t kMaxReferenceGap_ = 8u;
+
+// Half degree azimuth bins, used to find the radials of other elevations
+static constexpr std::size_t kAzimuthBins_    = 720u;
+static constexpr std::size_t kMaxAzimuthFill_ = 2u;
+
+// Effective earth radius for standard refraction (km)
+static constexpr double kEffectiveEarthRadius_ = 6371.0 * 4.0 / 3.0;
+
+typedef std::array<std::shared_ptr<GenericRadarData::MomentDataBlock>,
+                   kAzimuthBins_>
+   AzimuthIndex;
+
+class DealiasedVelocityProduct : public DerivedProduct
+{
+public:
+   DataBlockType data_block_type() const override
+   {
+      return DataBlockType::MomentVel;
+   }
+   bool is_volume_product() const override { return false; }
+   bool is_storm_relative() const override { return false; }
+   bool is_accumulation_product() const override { return false; }
+
+   std::shared_ptr<ElevationScan> Compute(const Input& input) const override;
+};
+
+class StormRelativeVelocityProduct : public DerivedProduct
+{
+public:
+   DataBlockType data_block_type() const override
+   {
+      return DataBlockType::MomentVel;
+   }
+   bool is_volume_product() const override { return false; }
+   bool is_storm_relative() const override { return true; }
+   bool is_accumulation_product() const override { return false; }
+
+   std::shared_ptr<ElevationScan> Compute(const Input& input) const override;
+};
+
+class CompositeReflectivityProduct : public DerivedProduct
+{
+public:
+   DataBlockType data_block_type() const override
+   {
+      return DataBlockType::MomentRef;
+   }
+   bool is_volume_product() const override { return true; }
+   bool is_storm_relative() const override { return false; }
+   bool is_accumulation_product() const override { return false; }
+
+   std::shared_ptr<ElevationScan> Compute(const Input& input) const override;
+};
+
+class EchoTopsProduct : public DerivedProduct
+{
+public:
+   DataBlockType data_block_type() const override
+   {
+      return DataBlockType::MomentRef;
+   }
+   bool is_volume_product() const override { return true; }
+   bool is_storm_relative() const override { return false; }
+   bool is_accumulation_product() const override { return false; }
+
+   std::shared_ptr<ElevationScan> Compute(const Input& input) const override;
+};
+
+class PrecipitationAccumulationProduct : public DerivedProduct
+{
+public:
+   explicit PrecipitationAccumulationProduct(AccumulationWindow window) :
+       window_ {window}
+   {
+   }
+
+   DataBlockType data_block_type() const override
+   {
+      return DataBlockType::MomentRef;
+   }
+   bool is_volume_product() const override { return true; }
+   bool is_storm_relative() const override { return false; }
+   bool is_accumulation_product() const override { return true; }
+
+   std::shared_ptr<ElevationScan> Compute(const Input& input) const override;
+
+private:
+   AccumulationWindow window_;
+};
+
+class DerivedProductRegistry
+{
+public:
+   explicit DerivedProductRegistry()
+   {
+      products_[common::Level2Product::DealiasedVelocity] =
+         std::make_shared<DealiasedVelocityProduct>();
+      products_[common::Level2Product::StormRelativeVelocity] =
+         std::make_shared<StormRelativeVelocityProduct>();
+      products_[common::Level2Product::CompositeReflectivity] =
+         std::make_shared<CompositeReflectivityProduct>();
+      products_[common::Level2Product::EchoTops] =
+         std::make_shared<EchoTopsProduct>();
+      products_[common::Level2Product::OneHourPrecipitation] =
+         std::make_shared<PrecipitationAccumulationProduct>(
+            AccumulationWindow::OneHour);
+      products_[common::Level2Product::ThreeHourPrecipitation] =
+         std::make_shared<PrecipitationAccumulationProduct>(
+            AccumulationWindow::ThreeHour);
+      products_[common::Level2Product::StormTotalPrecipitation] =
+         std::make_shared<PrecipitationAccumulationProduct>(
+            AccumulationWindow::StormTotal);
+   }
+
+   std::shared_mutex mutex_ {};
+   std::unordered_map<common::Level2Product,
+                      std::shared_ptr<const DerivedProduct>>
+      products_ {};
+};
+
+static DerivedProductRegistry& GetRegistry()
+{
+   static DerivedProductRegistry registry_ {};
+   return registry_;
+}
+
+static std::uint16_t
+GetDataMoment(const GenericRadarData::MomentDataBlock& block,
+              std::uint16_t                            gate)
+{
+   const void* data = block.data_moments();
+
+   if (data == nullptr || gate >= block.number_of_data_moment_gates())
+   {
+      return 0u;
+   }
+
+   // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+   if (block.data_word_size() == 8)
+   {
+      return static_cast<const std::uint8_t*>(data)[gate];
+   }
+
+   return static_cast<const std::uint16_t*>(data)[gate];
+   // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+static float DecodeDataMoment(const GenericRadarData::MomentDataBlock& block,
+                              std::uint16_t                            level)
+{
+   return (static_cast<float>(level) - block.offset()) / block.scale();
+}
+
+static std::uint16_t
+EncodeDataMoment(const GenericRadarData::MomentDataBlock& block, float value)
+{
+   const float maxLevel =
+      (block.data_word_size() == 8) ?
+         static_cast<float>(std::numeric_limits<std::uint8_t>::max()) :
+         static_cast<float>(std::numeric_limits<std::uint16_t>::max());
+
+   return static_cast<std::uint16_t>(
+      std::clamp(std::round(value * block.scale() + block.offset()),
+                 static_cast<float>(kMinDataLevel_),
+                 maxLevel));
+}
+
+static float GetNyquistVelocity(const std::shared_ptr<GenericRadarData>& radial)
+{
+   float nyquistVelocity = 0.0f;
+
+   if (auto derivedRadial = std::dynamic_pointer_cast<DerivedRadarData>(radial))
+   {
+      nyquistVelocity = GetNyquistVelocity(derivedRadial->source());
+   }
+   else if (auto genericRadial =
+               std::dynamic_pointer_cast<DigitalRadarDataGeneric>(radial))
+   {
+      auto radialDataBlock = genericRadial->radial_data_block();
+      if (radialDataBlock != nullptr)
+      {
+         nyquistVelocity = radialDataBlock->nyquist_velocity();
+      }
+   }
+   else if (auto digitalRadial =
+               std::dynamic_pointer_cast<DigitalRadarData>(radial))
+   {
+      // Nyquist velocity is in 0.01 m/s
+      nyquistVelocity =
+         static_cast<float>(digitalRadial->nyquist_velocity()) * 0.01f;
+   }
+
+   return nyquistVelocity;
+}
+
+static float GetElevationAngle(const std::shared_ptr<GenericRadarData>& radial)
+{
+   float elevationAngle = 0.0f;
+
+   if (auto derivedRadial = std::dynamic_pointer_cast<DerivedRadarData>(radial))
+   {
+      elevationAngle = GetElevationAngle(derivedRadial->source());
+   }
+   else if (auto genericRadial =
+               std::dynamic_pointer_cast<DigitalRadarDataGeneric>(radial))
+   {
+      elevationAngle = genericRadial->elevation_angle().value();
+   }
+   else if (auto digitalRadial =
+               std::dynamic_pointer_cast<DigitalRadarData>(radial))
+   {
+      elevationAngle = digitalRadial->elevation_angle().value();
+   }
+
+   return elevationAngle;
+}
+
+static float GetBeamHeight(float range, float elevationAngle)
+{
+   // Height of the beam center above the radar, at a slant range (km)
+   const double theta = elevationAngle * std::numbers::pi / 180.0;
+   const double r     = kEffectiveEarthRadius_;
+   const double d     = range;
+
+   return static_cast<float>(
+      std::sqrt(d * d + r * r + 2.0 * d * r * std::sin(theta)) - r);
+}
+
+static std::size_t GetAzimuthBin(units::degrees<float> azimuth)
+{
+   const float bin = std::floor(azimuth.value() * 2.0f);
+   const auto  bins = static_cast<std::int64_t>(kAzimuthBins_);
+
+   return static_cast<std::size_t>(
+      ((static_cast<std::int64_t>(bin) % bins) + bins) % bins);
+}
+
+static AzimuthIndex CreateAzimuthIndex(const ElevationScan& elevationScan,
+                                       DataBlockType        dataBlockType)
+{
+   AzimuthIndex azimuthIndex {};
+
+   for (auto& radial : elevationScan)
+   {
+      azimuthIndex[GetAzimuthBin(radial.second->azimuth_angle())] =
+         radial.second->moment_data_block(dataBlockType);
+   }
+
+   // Radials wider than a bin, such as 1 degree radials, leave bins between
+   // them empty. Fill the empty bins from the neighboring radials.
+   for (std::size_t fill = 0; fill < kMaxAzimuthFill_; ++fill)
+   {
+      AzimuthIndex filledIndex {azimuthIndex};
+
+      for (std::size_t bin = 0; bin < kAzimuthBins_; ++bin)
+      {
+         if (filledIndex[bin] == nullptr)
+         {
+            const auto& nextBlock = azimuthIndex[(bin + 1) % kAzimuthBins_];
+            filledIndex[bin] =
+               (nextBlock != nullptr) ?
+                  nextBlock :
+                  azimuthIndex[(bin + kAzimuthBins_ - 1) % kAzimuthBins_];
+         }
+      }
+
+      azimuthIndex = std::move(filledIndex);
+   }
+
+   return azimuthIndex;
+}
+
+static std::shared_ptr<ElevationScan>
+DealiasVelocity(const ElevationScan& elevationScan)
+{
+   auto derivedScan = std::make_shared<ElevationScan>();
+
+   // Dealiased velocities of the previous radial, NaN where there is no data
+   std::vector<float> previousRadial {};
+   std::vector<float> currentRadial {};
+
+   for (auto& [radialIndex, radial] : elevationScan)
+   {
+      auto derivedRadial = std::make_shared<DerivedRadarData>(radial);
+      (*derivedScan)[radialIndex] = derivedRadial;
+
+      auto sourceBlock = radial->moment_data_block(DataBlockType::MomentVel);
+      if (sourceBlock == nullptr)
+      {
+         previousRadial.clear();
+         continue;
+      }
+
+      auto block =
+         std::make_shared<DerivedRadarData::MomentDataBlock>(*sourceBlock);
+
+      const float         nyquistVelocity = GetNyquistVelocity(radial);
+      const float         interval        = 2.0f * nyquistVelocity;
+      const std::uint16_t gates = sourceBlock->number_of_data_moment_gates();
+
+      currentRadial.assign(gates, std::numeric_limits<float>::quiet_NaN());
+
+      bool          hasLastGate = false;
+      std::uint16_t lastGate    = 0u;
+
+      for (std::uint16_t gate = 0; gate < gates; ++gate)
+      {
+         const std::uint16_t level = GetDataMoment(*sourceBlock, gate);
+
+         if (level < kMinDataLevel_)
+         {
+            // Below threshold and range folded gates are passed through
+            block->SetDataMoment(gate, level);
+            continue;
+         }
+
+         float velocity = DecodeDataMoment(*sourceBlock, level);
+
+         // The reference velocity is taken from the nearest gate inward along
+         // the radial, and the same gate of the previous radial
+         float referenceSum   = 0.0f;
+         int   referenceCount = 0;
+
+         if (hasLastGate && gate - lastGate <= kMaxReferenceGap_)
+         {
+            referenceSum += currentRadial[lastGate];
+            ++referenceCount;
+         }
+         if (gate < previousRadial.size() && !std::isnan(previousRadial[gate]))
+         {
+            referenceSum += previousRadial[gate];
+            ++referenceCount;
+         }
+
+         if (referenceCount > 0 && interval > 0.0f)
+         {
+            // Unfold by the number of Nyquist intervals nearest the reference
+            const float reference =
+               referenceSum / static_cast<float>(referenceCount);
+            velocity +=
+               interval * std::round((reference - velocity) / interval);
+         }
+
+         currentRadial[gate] = velocity;
+         hasLastGate         = true;
+         lastGate            = gate;
+
+         block->SetDataMoment(gate, EncodeDataMoment(*block, velocity));
+      }
+
+      derivedRadial->SetMomentDataBlock(DataBlockType::MomentVel, block);
+
+      std::swap(previousRadial, currentRadial);
+   }
+
+   return derivedScan;
+}
+
+static std::shared_ptr<ColumnAccumulator>
+AccumulateVolume(const DerivedProduct::Input& input)
+{
+   if (input.volumeScans_.empty() || input.volumeScans_.front() == nullptr ||
+       input.volumeScans_.front()->empty())
+   {
+      return nullptr;
+   }
+
+   // The column state is kept on the radials of the lowest elevation
+   std::shared_ptr<ColumnAccumulator> columnAccumulator =
+      input.columnAccumulator_;
+   if (columnAccumulator == nullptr)
+   {
+      columnAccumulator =
+         std::make_shared<ColumnAccumulator>(*input.volumeScans_.front());
+   }
+
+   std::size_t accumulated = 0u;
+
+   for (std::size_t i = 0; i < input.volumeScans_.size(); ++i)
+   {
+      const auto& elevationScan = input.volumeScans_[i];
+      if (elevationScan == nullptr || elevationScan->empty())
+      {
+         continue;
+      }
+
+      const float elevationAngle =
+         (i < input.volumeElevations_.size()) ?
+            input.volumeElevations_[i] :
+            GetElevationAngle(elevationScan->cbegin()->second);
+
+      if (columnAccumulator->Accumulate(*elevationScan, elevationAngle))
+      {
+         ++accumulated;
+      }
+   }
+
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Accumulated {} of {} elevations",
+                       accumulated,
+                       columnAccumulator->elevation_count());
+
+   return columnAccumulator;
+}
+
+DerivedProduct::DerivedProduct()  = default;
+DerivedProduct::~DerivedProduct() = default;
+
+std::shared_ptr<const DerivedProduct>
+DerivedProduct::Get(common::Level2Product product)
+{
+   auto&            registry = GetRegistry();
+   std::shared_lock lock {registry.mutex_};
+
+   auto it = registry.products_.find(product);
+   return (it != registry.products_.cend()) ? it->second : nullptr;
+}
+
+void DerivedProduct::Register(
+   common::Level2Product                 product,
+   std::shared_ptr<const DerivedProduct> derivedProduct)
+{
+   auto&            registry = GetRegistry();
+   std::unique_lock lock {registry.mutex_};
+
+   if (derivedProduct != nullptr)
+   {
+      registry.products_[product] = std::move(derivedProduct);
+   }
+   else
+   {
+      registry.products_.erase(product);
+   }
+}
+
+std::shared_ptr<ElevationScan>
+DealiasedVelocityProduct::Compute(const Input& input) const
+{
+   if (input.elevationScan_ == nullptr || input.elevationScan_->empty())
+   {
+      return nullptr;
+   }
+
+   return DealiasVelocity(*input.elevationScan_);
+}
+
+std::shared_ptr<ElevationScan>
+StormRelativeVelocityProduct::Compute(const Input& input) const
+{
+   if (input.elevationScan_ == nullptr || input.elevationScan_->empty())
+   {
+      return nullptr;
+   }
+
+   auto derivedScan = DealiasVelocity(*input.elevationScan_);
+
+   // Storms move toward the opposite of the direction they move from
+   const float stormHeading =
+      (input.stormDirection_ + 180.0f) * std::numbers::pi_v<float> / 180.0f;
+
+   for (auto& radial : *derivedScan)
+   {
+      auto block = std::dynamic_pointer_cast<DerivedRadarData::MomentDataBlock>(
+         radial.second->moment_data_block(DataBlockType::MomentVel));
+      if (block == nullptr)
+      {
+         continue;
+      }
+
+      // Subtract the component of storm motion along the radial
+      const float azimuth = radial.second->azimuth_angle().value() *
+                            std::numbers::pi_v<float> / 180.0f;
+      const float stormVelocity =
+         input.stormSpeed_ * std::cos(azimuth - stormHeading);
+
+      const std::uint16_t gates = block->number_of_data_moment_gates();
+      for (std::uint16_t gate = 0; gate < gates; ++gate)
+      {
+         const std::uint16_t level = GetDataMoment(*block, gate);
+         if (level >= kMinDataLevel_)
+         {
+            block->SetDataMoment(
+               gate,
+               EncodeDataMoment(*block,
+                                DecodeDataMoment(*block, level) -
+                                   stormVelocity));
+         }
+      }
+   }
+
+   return derivedScan;
+}
+
+std::shared_ptr<ElevationScan>
+CompositeReflectivityProduct::Compute(const Input& input) const
+{
+   auto columnAccumulator = AccumulateVolume(input);
+   if (columnAccumulator == nullptr)
+   {
+      return nullptr;
+   }
+
+   return columnAccumulator->CompositeReflectivity();
+}
+
+std::shared_ptr<ElevationScan>
+EchoTopsProduct::Compute(const Input& input) const
+{
+   auto columnAccumulator = AccumulateVolume(input);
+   if (columnAccumulator == nullptr)
+   {
+      return nullptr;
+   }
+
+   return columnAccumulator->EchoTops();
+}
+
+std::shared_ptr<ElevationScan>
+PrecipitationAccumulationProduct::Compute(const Input& input) const
+{
+   if (input.precipitationAccumulator_ == nullptr ||
+       input.volumeScans_.empty() || input.volumeScans_.front() == nullptr ||
+       input.volumeScans_.front()->empty())
+   {
+      return nullptr;
+   }
+
+   // The accumulation is laid out on the radials of the lowest elevation
+   return input.precipitationAccumulator_->Accumulation(
+      window_, *input.volumeScans_.front());
+}
+
+class ColumnAccumulator::Impl
+{
+public:
+   struct Radial
+   {
+      std::uint16_t                                      index_ {};
+      std::shared_ptr<GenericRadarData>                  radial_ {};
+      std::shared_ptr<GenericRadarData::MomentDataBlock> baseBlock_ {};
+      std::size_t                                        azimuthBin_ {};
+      std::size_t                                        firstGate_ {};
+   };
+
+   explicit Impl(const ElevationScan& baseScan)
+   {
+      for (auto& [radialIndex, radial] : baseScan)
+      {
+         Radial entry {};
+         entry.index_      = radialIndex;
+         entry.radial_     = radial;
+         entry.baseBlock_ =
+            radial->moment_data_block(DataBlockType::MomentRef);
+         entry.azimuthBin_ = GetAzimuthBin(radial->azimuth_angle());
+         entry.firstGate_  = gateCount_;
+
+         if (entry.baseBlock_ != nullptr)
+         {
+            gateCount_ += entry.baseBlock_->number_of_data_moment_gates();
+         }
+
+         radials_.push_back(std::move(entry));
+      }
+
+      maxValues_.assign(gateCount_, std::numeric_limits<float>::lowest());
+      echoTops_.assign(gateCount_, std::numeric_limits<float>::quiet_NaN());
+   }
+   ~Impl() = default;
+
+   mutable std::mutex mutex_ {};
+
+   std::vector<Radial> radials_ {};
+   std::size_t         gateCount_ {0u};
+
+   // Column state of each gate, in order of radial
+   std::vector<float> maxValues_ {};
+   std::vector<float> echoTops_ {}; // Height above the radar (km)
+
+   // Elevation scans are only compared, and are not retained
+   std::set<const ElevationScan*> accumulated_ {};
+};
+
+ColumnAccumulator::ColumnAccumulator(const ElevationScan& baseScan) :
+    p(std::make_unique<Impl>(baseScan))
+{
+}
+ColumnAccumulator::~ColumnAccumulator() = default;
+
+std::size_t ColumnAccumulator::elevation_count() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->accumulated_.size();
+}
+
+bool ColumnAccumulator::Accumulate(const ElevationScan& elevationScan,
+                                   float                elevationAngle)
+{
+   std::unique_lock lock {p->mutex_};
+
+   if (!p->accumulated_.insert(&elevationScan).second)
+   {
+      // The elevation scan has already been accumulated
+      return false;
+   }
+
+   const AzimuthIndex azimuthIndex =
+      CreateAzimuthIndex(elevationScan, DataBlockType::MomentRef);
+
+   for (auto& radial : p->radials_)
+   {
+      const auto& sourceBlock = azimuthIndex[radial.azimuthBin_];
+      if (radial.baseBlock_ == nullptr || sourceBlock == nullptr)
+      {
+         continue;
+      }
+
+      const float sourceInterval =
+         sourceBlock->data_moment_range_sample_interval().value();
+      if (sourceInterval <= 0.0f)
+      {
+         continue;
+      }
+
+      const float baseRange = radial.baseBlock_->data_moment_range().value();
+      const float baseInterval =
+         radial.baseBlock_->data_moment_range_sample_interval().value();
+      const float sourceRange = sourceBlock->data_moment_range().value();
+      const std::uint16_t gates =
+         radial.baseBlock_->number_of_data_moment_gates();
+      const std::uint16_t sourceGates =
+         sourceBlock->number_of_data_moment_gates();
+
+      for (std::uint16_t gate = 0; gate < gates; ++gate)
+      {
+         // Take the gate at the same range and azimuth
+         const float range =
+            baseRange + static_cast<float>(gate) * baseInterval;
+         const float sourceGate =
+            std::round((range - sourceRange) / sourceInterval);
+         if (sourceGate < 0.0f || sourceGate >= static_cast<float>(sourceGates))
+         {
+            continue;
+         }
+
+         const std::uint16_t level = GetDataMoment(
+            *sourceBlock, static_cast<std::uint16_t>(sourceGate));
+         if (level < kMinDataLevel_)
+         {
+            continue;
+         }
+
+         const float       value = DecodeDataMoment(*sourceBlock, level);
+         const std::size_t index = radial.firstGate_ + gate;
+
+         p->maxValues_[index] = std::max(p->maxValues_[index], value);
+
+         if (value >= kEchoTopThreshold)
+         {
+            const float height = GetBeamHeight(range, elevationAngle);
+            if (std::isnan(p->echoTops_[index]) || height > p->echoTops_[index])
+            {
+               p->echoTops_[index] = height;
+            }
+         }
+      }
+   }
+
+   return true;
+}
+
+std::shared_ptr<ElevationScan> ColumnAccumulator::CompositeReflectivity() const
+{
+   std::unique_lock lock {p->mutex_};
+
+   auto derivedScan = std::make_shared<ElevationScan>();
+
+   for (auto& radial : p->radials_)
+   {
+      auto derivedRadial = std::make_shared<DerivedRadarData>(radial.radial_);
+      (*derivedScan)[radial.index_] = derivedRadial;
+
+      if (radial.baseBlock_ == nullptr)
+      {
+         continue;
+      }
+
+      auto block = std::make_shared<DerivedRadarData::MomentDataBlock>(
+         *radial.baseBlock_);
+
+      const std::uint16_t gates =
+         radial.baseBlock_->number_of_data_moment_gates();
+
+      for (std::uint16_t gate = 0; gate < gates; ++gate)
+      {
+         const float maxValue = p->maxValues_[radial.firstGate_ + gate];
+
+         // Gates without reflectivity keep below threshold and range folded
+         // levels of the lowest elevation
+         block->SetDataMoment(
+            gate,
+            (maxValue != std::numeric_limits<float>::lowest()) ?
+               EncodeDataMoment(*block, maxValue) :
+               GetDataMoment(*radial.baseBlock_, gate));
+      }
+
+      derivedRadial->SetMomentDataBlock(DataBlockType::MomentRef, block);
+   }
+
+   return derivedScan;
+}
+
+std::shared_ptr<ElevationScan> ColumnAccumulator::EchoTops() const
+{
+   std::unique_lock lock {p->mutex_};
+
+   auto derivedScan = std::make_shared<ElevationScan>();
+
+   for (auto& radial : p->radials_)
+   {
+      auto derivedRadial = std::make_shared<DerivedRadarData>(radial.radial_);
+      (*derivedScan)[radial.index_] = derivedRadial;
+
+      if (radial.baseBlock_ == nullptr)
+      {
+         continue;
+      }
+
+      auto block = std::make_shared<DerivedRadarData::MomentDataBlock>(
+         *radial.baseBlock_, kEchoTopScale, kEchoTopOffset);
+
+      const std::uint16_t gates =
+         radial.baseBlock_->number_of_data_moment_gates();
+
+      for (std::uint16_t gate = 0; gate < gates; ++gate)
+      {
+         const float echoTop = p->echoTops_[radial.firstGate_ + gate];
+         if (!std::isnan(echoTop))
+         {
+            block->SetDataMoment(gate, EncodeDataMoment(*block, echoTop));
+         }
+      }
+
+      derivedRadial->SetMomentDataBlock(DataBlockType::MomentRef, block);
+   }
+
+   return derivedScan;
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -0,0 +1,251 @@
+#include <scwx/wsr88d/rda/derived_radar_data.hpp>
+
+#include <map>
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+class DerivedRadarData::Impl
+{
+public:
+   explicit Impl(std::shared_ptr<GenericRadarData> source) :
+       source_ {std::move(source)}
+   {
+   }
+   ~Impl() = default;
+
+   std::shared_ptr<GenericRadarData> source_;
+   std::map<DataBlockType, std::shared_ptr<GenericRadarData::MomentDataBlock>>
+      momentDataBlocks_ {};
+};
+
+DerivedRadarData::DerivedRadarData(std::shared_ptr<GenericRadarData> source) :
+    GenericRadarData(), p(std::make_unique<Impl>(std::move(source)))
+{
+}
+DerivedRadarData::~DerivedRadarData() = default;
+
+DerivedRadarData::DerivedRadarData(DerivedRadarData&&) noexcept = default;
+DerivedRadarData&
+DerivedRadarData::operator=(DerivedRadarData&&) noexcept = default;
+
+std::uint32_t DerivedRadarData::collection_time() const
+{
+   return p->source_->collection_time();
+}
+
+std::uint16_t DerivedRadarData::modified_julian_date() const
+{
+   return p->source_->modified_julian_date();
+}
+
+units::degrees<float> DerivedRadarData::azimuth_angle() const
+{
+   return p->source_->azimuth_angle();
+}
+
+std::uint16_t DerivedRadarData::azimuth_number() const
+{
+   return p->source_->azimuth_number();
+}
+
+std::uint16_t DerivedRadarData::radial_status() const
+{
+   return p->source_->radial_status();
+}
+
+std::uint16_t DerivedRadarData::elevation_number() const
+{
+   return p->source_->elevation_number();
+}
+
+std::uint16_t DerivedRadarData::volume_coverage_pattern_number() const
+{
+   return p->source_->volume_coverage_pattern_number();
+}
+
+std::shared_ptr<GenericRadarData::MomentDataBlock>
+DerivedRadarData::moment_data_block(DataBlockType type) const
+{
+   auto it = p->momentDataBlocks_.find(type);
+   if (it != p->momentDataBlocks_.cend())
+   {
+      return it->second;
+   }
+
+   return p->source_->moment_data_block(type);
+}
+
+std::shared_ptr<GenericRadarData> DerivedRadarData::source() const
+{
+   return p->source_;
+}
+
+void DerivedRadarData::SetMomentDataBlock(
+   DataBlockType type, std::shared_ptr<GenericRadarData::MomentDataBlock> block)
+{
+   p->momentDataBlocks_[type] = std::move(block);
+}
+
+bool DerivedRadarData::Parse(std::istream& /* is */)
+{
+   return false;
+}
+
+class DerivedRadarData::MomentDataBlock::Impl
+{
+public:
+   explicit Impl(const GenericRadarData::MomentDataBlock& source,
+                 float                                    scale,
+                 float                                    offset,
+                 std::uint8_t                             dataWordSize) :
+       numberOfDataMomentGates_ {source.number_of_data_moment_gates()},
+       dataMomentRange_ {source.data_moment_range()},
+       dataMomentRangeRaw_ {source.data_moment_range_raw()},
+       dataMomentRangeSampleInterval_ {
+          source.data_moment_range_sample_interval()},
+       dataMomentRangeSampleIntervalRaw_ {
+          source.data_moment_range_sample_interval_raw()},
+       snrThresholdRaw_ {source.snr_threshold_raw()},
+       dataWordSize_ {dataWordSize},
+       scale_ {scale},
+       offset_ {offset}
+   {
+      if (dataWordSize_ == 8)
+      {
+         dataMoments8_.resize(numberOfDataMomentGates_, 0u);
+      }
+      else
+      {
+         dataMoments16_.resize(numberOfDataMomentGates_, 0u);
+      }
+   }
+   ~Impl() = default;
+
+   std::uint16_t            numberOfDataMomentGates_;
+   units::kilometers<float> dataMomentRange_;
+   std::int16_t             dataMomentRangeRaw_;
+   units::kilometers<float> dataMomentRangeSampleInterval_;
+   std::uint16_t            dataMomentRangeSampleIntervalRaw_;
+   std::int16_t             snrThresholdRaw_;
+   std::uint8_t             dataWordSize_;
+   float                    scale_;
+   float                    offset_;
+
+   std::vector<std::uint8_t>  dataMoments8_ {};
+   std::vector<std::uint16_t> dataMoments16_ {};
+};
+
+DerivedRadarData::MomentDataBlock::MomentDataBlock(
+   const GenericRadarData::MomentDataBlock& source) :
+    MomentDataBlock(source, source.scale(), source.offset())
+{
+}
+DerivedRadarData::MomentDataBlock::MomentDataBlock(
+   const GenericRadarData::MomentDataBlock& source,
+   float                                    scale,
+   float                                    offset) :
+    MomentDataBlock(source, scale, offset, source.data_word_size())
+{
+}
+DerivedRadarData::MomentDataBlock::MomentDataBlock(
+   const GenericRadarData::MomentDataBlock& source,
+   float                                    scale,
+   float                                    offset,
+   std::uint8_t                             dataWordSize) :
+    GenericRadarData::MomentDataBlock(),
+    p(std::make_unique<Impl>(source, scale, offset, dataWordSize))
+{
+}
+DerivedRadarData::MomentDataBlock::~MomentDataBlock() = default;
+
+DerivedRadarData::MomentDataBlock::MomentDataBlock(MomentDataBlock&&) noexcept =
+   default;
+DerivedRadarData::MomentDataBlock& DerivedRadarData::MomentDataBlock::operator=(
+   MomentDataBlock&&) noexcept = default;
+
+std::uint16_t
+DerivedRadarData::MomentDataBlock::number_of_data_moment_gates() const
+{
+   return p->numberOfDataMomentGates_;
+}
+
+units::kilometers<float>
+DerivedRadarData::MomentDataBlock::data_moment_range() const
+{
+   return p->dataMomentRange_;
+}
+
+std::int16_t DerivedRadarData::MomentDataBlock::data_moment_range_raw() const
+{
+   return p->dataMomentRangeRaw_;
+}
+
+units::kilometers<float>
+DerivedRadarData::MomentDataBlock::data_moment_range_sample_interval() const
+{
+   return p->dataMomentRangeSampleInterval_;
+}
+
+std::uint16_t
+DerivedRadarData::MomentDataBlock::data_moment_range_sample_interval_raw() const
+{
+   return p->dataMomentRangeSampleIntervalRaw_;
+}
+
+std::int16_t DerivedRadarData::MomentDataBlock::snr_threshold_raw() const
+{
+   return p->snrThresholdRaw_;
+}
+
+std::uint8_t DerivedRadarData::MomentDataBlock::data_word_size() const
+{
+   return p->dataWordSize_;
+}
+
+float DerivedRadarData::MomentDataBlock::scale() const
+{
+   return p->scale_;
+}
+
+float DerivedRadarData::MomentDataBlock::offset() const
+{
+   return p->offset_;
+}
+
+const void* DerivedRadarData::MomentDataBlock::data_moments() const
+{
+   if (p->dataWordSize_ == 8)
+   {
+      return p->dataMoments8_.data();
+   }
+
+   return p->dataMoments16_.data();
+}
+
+void DerivedRadarData::MomentDataBlock::SetDataMoment(std::uint16_t gate,
+                                                      std::uint16_t value)
+{
+   if (gate >= p->numberOfDataMomentGates_)
+   {
+      return;
+   }
+
+   if (p->dataWordSize_ == 8)
+   {
+      p->dataMoments8_[gate] = static_cast<std::uint8_t>(value);
+   }
+   else
+   {
+      p->dataMoments16_[gate] = value;
+   }
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
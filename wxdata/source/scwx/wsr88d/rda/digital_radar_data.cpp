@@ -421,7 +421,7 @@ DigitalRadarData::Impl::MomentDataBlock::data_moment_vector() const
 
 bool DigitalRadarData::Parse(std::istream& is)
 {
-   logger_->trace("Parsing Digital Radar Data (Message Type 1)");
+   SPDLOG_LOGGER_TRACE(logger_, "Parsing Digital Radar Data (Message Type 1)");
 
    bool        messageValid = true;
    std::size_t bytesRead    = 0;
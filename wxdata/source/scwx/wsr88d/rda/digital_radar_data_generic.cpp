@@ -1,6 +1,10 @@
 #include <scwx/wsr88d/rda/digital_radar_data_generic.hpp>
+#include <scwx/util/arena.hpp>
+#include <scwx/util/byte_swap.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <mutex>
+
 namespace scwx
 {
 namespace wsr88d
@@ -65,8 +69,31 @@ public:
 
    std::vector<std::uint8_t>  momentGates8_ {};
    std::vector<std::uint16_t> momentGates16_ {};
+
+   // Non-owning view of moment gates within a shared record buffer. 16-bit
+   // gates are byte swapped in place on first access, which is recorded in
+   // the shared flag.
+   std::shared_ptr<std::vector<char>> recordBuffer_ {nullptr};
+   char*                              momentGatesView_ {nullptr};
+   bool                               swapRequired_ {false};
+   std::once_flag                     swapFlag_ {};
+   std::shared_ptr<std::atomic<bool>> momentsSwapped_ {nullptr};
+
+   void SwapMomentGatesView();
 };
 
+void DigitalRadarDataGeneric::MomentDataBlock::Impl::SwapMomentGatesView()
+{
+   if (momentsSwapped_ != nullptr)
+   {
+      // Set before the buffer is modified
+      momentsSwapped_->store(true);
+   }
+
+   util::BigEndianToHost16(reinterpret_cast<std::uint16_t*>(momentGatesView_),
+                           numberOfDataMomentGates_);
+}
+
 DigitalRadarDataGeneric::MomentDataBlock::MomentDataBlock(
    const std::string& dataBlockType, const std::string& dataName) :
     DataBlock(dataBlockType, dataName), p(std::make_unique<Impl>())
@@ -140,6 +167,16 @@ const void* DigitalRadarDataGeneric::MomentDataBlock::data_moments() const
 {
    const void* dataMoments;
 
+   if (p->momentGatesView_ != nullptr)
+   {
+      if (p->swapRequired_)
+      {
+         std::call_once(p->swapFlag_, [this]() { p->SwapMomentGatesView(); });
+      }
+
+      return p->momentGatesView_;
+   }
+
    switch (p->dataWordSize_)
    {
    case 8:
@@ -161,11 +198,23 @@ DigitalRadarDataGeneric::MomentDataBlock::Create(
    const std::string& dataBlockType,
    const std::string& dataName,
    std::istream&      is)
+{
+   return Create(dataBlockType, dataName, is, nullptr);
+}
+
+std::shared_ptr<DigitalRadarDataGeneric::MomentDataBlock>
+DigitalRadarDataGeneric::MomentDataBlock::Create(
+   const std::string&                        dataBlockType,
+   const std::string&                        dataName,
+   std::istream&                             is,
+   const std::shared_ptr<std::vector<char>>& recordBuffer,
+   const std::shared_ptr<util::Arena>&       arena,
+   const std::shared_ptr<std::atomic<bool>>& momentsSwapped)
 {
    std::shared_ptr<MomentDataBlock> p =
-      std::make_shared<MomentDataBlock>(dataBlockType, dataName);
+      util::MakeShared<MomentDataBlock>(arena, dataBlockType, dataName);
 
-   if (!p->Parse(is))
+   if (!p->Parse(is, recordBuffer, momentsSwapped))
    {
       p.reset();
    }
@@ -173,7 +222,47 @@ DigitalRadarDataGeneric::MomentDataBlock::Create(
    return p;
 }
 
-bool DigitalRadarDataGeneric::MomentDataBlock::Parse(std::istream& is)
+bool DigitalRadarDataGeneric::MomentDataBlock::ParseView(
+   std::istream&                             is,
+   const std::shared_ptr<std::vector<char>>& recordBuffer,
+   const std::shared_ptr<std::atomic<bool>>& momentsSwapped)
+{
+   const std::size_t wordSize = p->dataWordSize_ / 8u;
+   const std::size_t dataSize = p->numberOfDataMomentGates_ * wordSize;
+
+   std::streampos position = is.tellg();
+   if (position < 0)
+   {
+      return false;
+   }
+
+   const std::size_t offset = static_cast<std::size_t>(position);
+
+   // The view must be contained within the buffer, and 16-bit gates must be
+   // properly aligned
+   if (offset + dataSize > recordBuffer->size() ||
+       (reinterpret_cast<std::uintptr_t>(recordBuffer->data() + offset) %
+        wordSize) != 0)
+   {
+      return false;
+   }
+
+   // Defer decoding 16-bit gates until the moment data is first accessed.
+   // The buffer region is owned by this block, so may be swapped in place.
+   p->recordBuffer_    = recordBuffer;
+   p->momentGatesView_ = recordBuffer->data() + offset;
+   p->swapRequired_    = (wordSize == 2);
+   p->momentsSwapped_  = p->swapRequired_ ? momentsSwapped : nullptr;
+
+   is.seekg(static_cast<std::streamoff>(dataSize), std::ios_base::cur);
+
+   return true;
+}
+
+bool DigitalRadarDataGeneric::MomentDataBlock::Parse(
+   std::istream&                             is,
+   const std::shared_ptr<std::vector<char>>& recordBuffer,
+   const std::shared_ptr<std::atomic<bool>>& momentsSwapped)
 {
    bool dataBlockValid = true;
 
@@ -199,7 +288,13 @@ bool DigitalRadarDataGeneric::MomentDataBlock::Parse(std::istream& is)
 
    if (p->numberOfDataMomentGates_ <= 1840)
    {
-      if (p->dataWordSize_ == 8)
+      if ((p->dataWordSize_ == 8 || p->dataWordSize_ == 16) &&
+          recordBuffer != nullptr &&
+          ParseView(is, recordBuffer, momentsSwapped))
+      {
+         // Moment gates reference the record buffer
+      }
+      else if (p->dataWordSize_ == 8)
       {
          p->momentGates8_.resize(p->numberOfDataMomentGates_);
          is.read(reinterpret_cast<char*>(p->momentGates8_.data()),
@@ -423,6 +518,11 @@ float DigitalRadarDataGeneric::RadialDataBlock::unambiguous_range() const
    return p->unambigiousRange_ / 10.0f;
 }
 
+float DigitalRadarDataGeneric::RadialDataBlock::nyquist_velocity() const
+{
+   return p->nyquistVelocity_ / 100.0f;
+}
+
 std::shared_ptr<DigitalRadarDataGeneric::RadialDataBlock>
 DigitalRadarDataGeneric::RadialDataBlock::Create(
    const std::string& dataBlockType,
@@ -498,6 +598,10 @@ public:
    std::shared_ptr<RadialDataBlock>    radialDataBlock_ {nullptr};
    std::unordered_map<DataBlockType, std::shared_ptr<MomentDataBlock>>
       momentDataBlock_ {};
+
+   std::shared_ptr<std::vector<char>> recordBuffer_ {nullptr};
+   std::shared_ptr<util::Arena>       arena_ {nullptr};
+   std::shared_ptr<std::atomic<bool>> momentsSwapped_ {nullptr};
 };
 
 DigitalRadarDataGeneric::DigitalRadarDataGeneric() :
@@ -551,7 +655,7 @@ std::uint8_t DigitalRadarDataGeneric::azimuth_resolution_spacing() const
    return p->azimuthResolutionSpacing_;
 }
 
-std::uint8_t DigitalRadarDataGeneric::radial_status() const
+std::uint16_t DigitalRadarDataGeneric::radial_status() const
 {
    return p->radialStatus_;
 }
@@ -632,7 +736,7 @@ DigitalRadarDataGeneric::moment_data_block(DataBlockType type) const
 
 bool DigitalRadarDataGeneric::Parse(std::istream& is)
 {
-   logger_->trace("Parsing Digital Radar Data (Message Type 31)");
+   SPDLOG_LOGGER_TRACE(logger_, "Parsing Digital Radar Data (Message Type 31)");
 
    bool        messageValid = true;
    std::size_t bytesRead    = 0;
@@ -739,7 +843,12 @@ bool DigitalRadarDataGeneric::Parse(std::istream& is)
       case DataBlockType::MomentRho:
       case DataBlockType::MomentCfp:
          p->momentDataBlock_[dataBlock] =
-            MomentDataBlock::Create(dataBlockType, dataName, is);
+            MomentDataBlock::Create(dataBlockType,
+                                    dataName,
+                                    is,
+                                    p->recordBuffer_,
+                                    p->arena_,
+                                    p->momentsSwapped_);
          break;
       default:
          logger_->warn("Unknown data name: {}", dataName);
@@ -771,6 +880,37 @@ DigitalRadarDataGeneric::Create(Level2MessageHeader&& header, std::istream& is)
    return message;
 }
 
+std::shared_ptr<DigitalRadarDataGeneric>
+DigitalRadarDataGeneric::CreateFromRecordBuffer(
+   Level2MessageHeader&&              header,
+   std::istream&                      is,
+   std::shared_ptr<std::vector<char>> recordBuffer,
+   std::shared_ptr<util::Arena>       arena,
+   std::shared_ptr<std::atomic<bool>> momentsSwapped)
+{
+   std::shared_ptr<DigitalRadarDataGeneric> message =
+      util::MakeShared<DigitalRadarDataGeneric>(arena);
+   message->set_header(std::move(header));
+   message->p->recordBuffer_   = std::move(recordBuffer);
+   message->p->arena_          = std::move(arena);
+   message->p->momentsSwapped_ = std::move(momentsSwapped);
+
+   bool messageValid = message->Parse(is);
+
+   // The record buffer, arena and swapped flag are only referenced by moment
+   // data blocks
+   message->p->recordBuffer_.reset();
+   message->p->arena_.reset();
+   message->p->momentsSwapped_.reset();
+
+   if (!messageValid)
+   {
+      message.reset();
+   }
+
+   return message;
+}
+
 } // namespace rda
 } // namespace wsr88d
 } // namespace scwx
@@ -1,5 +1,6 @@
 #include <scwx/wsr88d/rda/level2_message_factory.hpp>
 
+#include <scwx/util/arena.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/vectorbuf.hpp>
 #include <scwx/wsr88d/rda/clutter_filter_bypass_map.hpp>
@@ -9,6 +10,7 @@
 #include <scwx/wsr88d/rda/performance_maintenance_data.hpp>
 #include <scwx/wsr88d/rda/rda_adaptation_data.hpp>
 #include <scwx/wsr88d/rda/rda_status_data.hpp>
+#include <scwx/wsr88d/rda/rda_types.hpp>
 #include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
 
 #include <unordered_map>
@@ -54,6 +56,10 @@ struct Level2MessageFactory::Context
    util::vectorbuf   messageBuffer_;
    std::istream      messageBufferStream_;
    bool              bufferingData_ {false};
+
+   std::shared_ptr<std::vector<char>> recordBuffer_ {nullptr};
+   std::shared_ptr<util::Arena>       arena_ {nullptr};
+   std::shared_ptr<std::atomic<bool>> momentsSwapped_ {nullptr};
 };
 
 std::shared_ptr<Level2MessageFactory::Context>
@@ -62,6 +68,19 @@ Level2MessageFactory::CreateContext()
    return std::make_shared<Context>();
 }
 
+std::shared_ptr<Level2MessageFactory::Context>
+Level2MessageFactory::CreateContext(
+   std::shared_ptr<std::vector<char>> recordBuffer,
+   std::shared_ptr<util::Arena>       arena,
+   std::shared_ptr<std::atomic<bool>> momentsSwapped)
+{
+   std::shared_ptr<Context> ctx = std::make_shared<Context>();
+   ctx->recordBuffer_           = std::move(recordBuffer);
+   ctx->arena_                  = std::move(arena);
+   ctx->momentsSwapped_         = std::move(momentsSwapped);
+   return ctx;
+}
+
 Level2MessageInfo Level2MessageFactory::Create(std::istream&             is,
                                                std::shared_ptr<Context>& ctx)
 {
@@ -109,15 +128,18 @@ Level2MessageInfo Level2MessageFactory::Create(std::istream&             is,
 
       if (totalSegments == 1)
       {
-         logger_->trace("Found Message {}", static_cast<unsigned>(messageType));
+         SPDLOG_LOGGER_TRACE(logger_,
+                             "Found Message {}",
+                             static_cast<unsigned>(messageType));
          messageStream = &is;
       }
       else
       {
-         logger_->trace("Found Message {} Segment {}/{}",
-                        static_cast<unsigned>(messageType),
-                        segment,
-                        totalSegments);
+         SPDLOG_LOGGER_TRACE(logger_,
+                             "Found Message {} Segment {}/{}",
+                             static_cast<unsigned>(messageType),
+                             segment,
+                             totalSegments);
 
          if (segment == 1)
          {
@@ -130,9 +152,10 @@ Level2MessageInfo Level2MessageFactory::Create(std::istream&             is,
          else if (!ctx->bufferingData_)
          {
             // Segment number did not start at 1
-            logger_->trace("Ignoring Segment {}/{}, did not start at 1",
-                           segment,
-                           totalSegments);
+            SPDLOG_LOGGER_TRACE(logger_,
+                                "Ignoring Segment {}/{}, did not start at 1",
+                                segment,
+                                totalSegments);
             info.messageValid = false;
          }
 
@@ -172,6 +195,20 @@ Level2MessageInfo Level2MessageFactory::Create(std::istream&             is,
          }
       }
 
+      if (messageStream == &is && ctx->recordBuffer_ != nullptr &&
+          messageType ==
+             static_cast<std::uint8_t>(MessageId::DigitalRadarDataGeneric))
+      {
+         // Reference moment data within the record buffer
+         info.message = DigitalRadarDataGeneric::CreateFromRecordBuffer(
+            std::move(header),
+            is,
+            ctx->recordBuffer_,
+            ctx->arena_,
+            ctx->momentsSwapped_);
+         messageStream = nullptr;
+      }
+
       if (messageStream != nullptr)
       {
          info.message =
@@ -153,8 +153,9 @@ bool Level2MessageHeader::Parse(std::istream& is)
 
    if (headerValid)
    {
-      logger_->trace("Message type: {}",
-                     static_cast<unsigned>(p->messageType_));
+      SPDLOG_LOGGER_TRACE(logger_,
+                          "Message type: {}",
+                          static_cast<unsigned>(p->messageType_));
    }
 
    return headerValid;
@@ -1823,7 +1823,8 @@ uint16_t PerformanceMaintenanceData::version() const
 
 bool PerformanceMaintenanceData::Parse(std::istream& is)
 {
-   logger_->trace("Parsing Performance/Maintenance Data (Message Type 3)");
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Parsing Performance/Maintenance Data (Message Type 3)");
 
    bool   messageValid = true;
    size_t bytesRead    = 0;
@@ -0,0 +1,661 @@
+#include <scwx/wsr88d/rda/precipitation_accumulator.hpp>
+#include <scwx/wsr88d/rda/columnar_sweep.hpp>
+#include <scwx/wsr88d/rda/derived_radar_data.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <deque>
+#include <istream>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+static const std::string logPrefix_ =
+   "scwx::wsr88d::rda::precipitation_accumulator";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+static constexpr std::size_t kCells_ =
+   PrecipitationAccumulator::kRadials * PrecipitationAccumulator::kGates;
+
+// Coded data moments below this level are below threshold or range folded
+static constexpr std::uint16_t kMinDataLevel_ = 2u;
+
+// Rain rates are stored in hundredths of a millimeter per hour
+static constexpr float kRateUnit_ = 0.01f;
+
+// Convective Z-R relationship, with reflectivity limited to the hail cap
+static constexpr float kZrMultiplier_    = 300.0f;
+static constexpr float kZrExponent_      = 1.4f;
+static constexpr float kMinReflectivity_ = 10.0f; // dBZ
+static constexpr float kMaxReflectivity_ = 53.0f; // dBZ
+
+static constexpr auto kMaxInterval_       = std::chrono::minutes {20};
+static constexpr auto kStormTotalBreak_   = std::chrono::hours {1};
+static constexpr auto kOneHourDuration_   = std::chrono::hours {1};
+static constexpr auto kThreeHourDuration_ = std::chrono::hours {3};
+
+// Timed windows, in order of increasing duration
+static constexpr std::array<AccumulationWindow, 2> kTimedWindows_ {
+   AccumulationWindow::OneHour, AccumulationWindow::ThreeHour};
+
+static constexpr std::uint32_t kFileMagic_   = 0x31455051u; // "QPE1"
+static constexpr std::uint32_t kFileVersion_ = 1u;
+
+struct AccumulationInterval
+{
+   std::chrono::system_clock::time_point time_ {}; // End of the interval
+   std::vector<std::uint16_t>            depth_ {};
+};
+
+class PrecipitationAccumulator::Impl
+{
+public:
+   explicit Impl() { Clear(); }
+   ~Impl() = default;
+
+   void Clear();
+   void ExpireIntervals();
+
+   static std::chrono::system_clock::duration
+   GetDuration(AccumulationWindow window);
+   static std::vector<std::uint16_t> GetRainRates(const ColumnarSweep& sweep);
+
+   std::mutex mutex_ {};
+
+   std::chrono::system_clock::time_point firstTime_ {};
+   std::chrono::system_clock::time_point endTime_ {};
+   std::chrono::system_clock::time_point stormTotalBegin_ {};
+   std::chrono::system_clock::time_point lastPrecipitationTime_ {};
+   std::uint64_t                         revision_ {0u};
+
+   // Rain rates of the last volume accumulated
+   std::vector<std::uint16_t> rates_ {};
+
+   // Intervals of the longest timed window, oldest first, and the first
+   // interval of each timed window
+   std::deque<AccumulationInterval>                intervals_ {};
+   std::array<std::size_t, kTimedWindows_.size()> windowBegin_ {};
+
+   // Running sum of each window
+   std::array<std::vector<std::uint32_t>, 3> sums_ {};
+};
+
+PrecipitationAccumulator::PrecipitationAccumulator() :
+    p(std::make_unique<Impl>())
+{
+}
+PrecipitationAccumulator::~PrecipitationAccumulator() = default;
+
+void PrecipitationAccumulator::Impl::Clear()
+{
+   firstTime_             = {};
+   endTime_               = {};
+   stormTotalBegin_       = {};
+   lastPrecipitationTime_ = {};
+
+   rates_.assign(kCells_, 0u);
+   intervals_.clear();
+   windowBegin_.fill(0u);
+
+   for (auto& sum : sums_)
+   {
+      sum.assign(kCells_, 0u);
+   }
+}
+
+std::chrono::system_clock::duration
+PrecipitationAccumulator::Impl::GetDuration(AccumulationWindow window)
+{
+   return (window == AccumulationWindow::OneHour) ? kOneHourDuration_ :
+                                                    kThreeHourDuration_;
+}
+
+std::chrono::system_clock::time_point PrecipitationAccumulator::end_time() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->endTime_;
+}
+
+std::chrono::system_clock::time_point
+PrecipitationAccumulator::begin_time(AccumulationWindow window) const
+{
+   std::unique_lock lock {p->mutex_};
+
+   if (window == AccumulationWindow::StormTotal)
+   {
+      return (p->stormTotalBegin_ != std::chrono::system_clock::time_point {}) ?
+                p->stormTotalBegin_ :
+                p->endTime_;
+   }
+
+   return std::max(p->endTime_ - Impl::GetDuration(window), p->firstTime_);
+}
+
+std::uint64_t PrecipitationAccumulator::revision() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->revision_;
+}
+
+std::vector<std::uint16_t>
+PrecipitationAccumulator::Impl::GetRainRates(const ColumnarSweep& sweep)
+{
+   std::vector<std::uint16_t> rates(kCells_, 0u);
+
+   const float firstRange = static_cast<float>(sweep.data_moment_range_raw());
+   const float interval =
+      static_cast<float>(sweep.data_moment_range_sample_interval_raw());
+
+   if (interval <= 0.0f || sweep.radial_count() == 0u)
+   {
+      return rates;
+   }
+
+   // Rain rate of each data level
+   const std::size_t levels = (sweep.data_word_size() == 8) ?
+                                 std::numeric_limits<std::uint8_t>::max() + 1u :
+                                 std::numeric_limits<std::uint16_t>::max() + 1u;
+   std::vector<std::uint16_t> levelRates(levels, 0u);
+   for (std::size_t level = kMinDataLevel_; level < levels; ++level)
+   {
+      const float reflectivity =
+         (static_cast<float>(level) - sweep.offset()) / sweep.scale();
+      if (reflectivity < kMinReflectivity_)
+      {
+         continue;
+      }
+
+      const float z =
+         std::pow(10.0f, std::min(reflectivity, kMaxReflectivity_) / 10.0f);
+      const float rate = std::pow(z / kZrMultiplier_, 1.0f / kZrExponent_);
+
+      levelRates[level] = static_cast<std::uint16_t>(std::min(
+         std::round(rate / kRateUnit_),
+         static_cast<float>(std::numeric_limits<std::uint16_t>::max())));
+   }
+
+   // Find the radial nearest the center of each grid radial
+   std::array<std::size_t, kRadials> nearest {};
+   std::array<float, kRadials>       distance {};
+   nearest.fill(sweep.radial_count());
+   distance.fill(std::numeric_limits<float>::max());
+
+   const auto azimuths = sweep.azimuths();
+   for (std::size_t i = 0; i < sweep.radial_count(); ++i)
+   {
+      const float       azimuth = azimuths[i];
+      const std::size_t radial =
+         static_cast<std::size_t>(std::floor(azimuth)) % kRadials;
+      const float d = std::abs(azimuth - (std::floor(azimuth) + 0.5f));
+
+      if (d < distance[radial])
+      {
+         nearest[radial]  = i;
+         distance[radial] = d;
+      }
+   }
+
+   const auto gateCounts = sweep.gate_counts();
+
+   for (std::size_t radial = 0; radial < kRadials; ++radial)
+   {
+      const std::size_t i = nearest[radial];
+      if (i >= sweep.radial_count())
+      {
+         continue;
+      }
+
+      const auto moments8  = sweep.data_moments8(i);
+      const auto moments16 = sweep.data_moments16(i);
+
+      for (std::size_t gate = 0; gate < kGates; ++gate)
+      {
+         // Nearest source gate to the center of the grid gate
+         const float range = (static_cast<float>(gate) + 0.5f) * kGateSize;
+         const float sourceGate =
+            std::round((range - firstRange) / interval);
+
+         if (sourceGate < 0.0f)
+         {
+            continue;
+         }
+         if (sourceGate >= static_cast<float>(gateCounts[i]))
+         {
+            break;
+         }
+
+         const std::size_t   j     = static_cast<std::size_t>(sourceGate);
+         const std::uint16_t level = moments8.empty() ?
+                                        (j < moments16.size() ? moments16[j] :
+                                                                0u) :
+                                        (j < moments8.size() ? moments8[j] :
+                                                               0u);
+
+         rates[radial * kGates + gate] = levelRates[level];
+      }
+   }
+
+   return rates;
+}
+
+bool PrecipitationAccumulator::Accumulate(
+   const std::shared_ptr<ElevationScan>& elevationScan,
+   std::chrono::system_clock::time_point time)
+{
+   auto sweep = ColumnarSweep::Get(elevationScan, DataBlockType::MomentRef);
+   if (sweep == nullptr)
+   {
+      return false;
+   }
+
+   std::unique_lock lock {p->mutex_};
+
+   if (time <= p->endTime_)
+   {
+      return false;
+   }
+
+   std::vector<std::uint16_t> rates = Impl::GetRainRates(*sweep);
+
+   if (p->endTime_ == std::chrono::system_clock::time_point {})
+   {
+      p->firstTime_ = time;
+   }
+   else if (time - p->endTime_ <= kMaxInterval_)
+   {
+      // The depth of the interval is the mean of its rates over its duration
+      const float hours =
+         std::chrono::duration<float, std::chrono::hours::period> {
+            time - p->endTime_}
+            .count();
+
+      AccumulationInterval interval {time,
+                                     std::vector<std::uint16_t>(kCells_, 0u)};
+      bool                 precipitation = false;
+
+      for (std::size_t i = 0; i < kCells_; ++i)
+      {
+         const float rate =
+            (static_cast<float>(p->rates_[i]) + static_cast<float>(rates[i])) *
+            0.5f * kRateUnit_;
+         const float depth = std::round(rate * hours / kDepthUnit);
+
+         if (depth > 0.0f)
+         {
+            interval.depth_[i] = static_cast<std::uint16_t>(std::min(
+               depth,
+               static_cast<float>(std::numeric_limits<std::uint16_t>::max())));
+            precipitation = true;
+         }
+      }
+
+      if (precipitation)
+      {
+         // The storm total restarts after an hour without precipitation
+         if (p->stormTotalBegin_ == std::chrono::system_clock::time_point {} ||
+             p->endTime_ - p->lastPrecipitationTime_ >= kStormTotalBreak_)
+         {
+            auto& stormTotal = p->sums_[static_cast<std::size_t>(
+               AccumulationWindow::StormTotal)];
+            std::fill(stormTotal.begin(), stormTotal.end(), 0u);
+            p->stormTotalBegin_ = p->endTime_;
+         }
+
+         p->lastPrecipitationTime_ = time;
+      }
+
+      for (auto& sum : p->sums_)
+      {
+         for (std::size_t i = 0; i < kCells_; ++i)
+         {
+            sum[i] += interval.depth_[i];
+         }
+      }
+
+      p->intervals_.push_back(std::move(interval));
+   }
+   else
+   {
+      logger_->debug("Volume is more than {} after the previous volume",
+                     kMaxInterval_);
+   }
+
+   p->rates_   = std::move(rates);
+   p->endTime_ = time;
+   ++p->revision_;
+
+   p->ExpireIntervals();
+
+   return true;
+}
+
+void PrecipitationAccumulator::Impl::ExpireIntervals()
+{
+   for (std::size_t w = 0; w < kTimedWindows_.size(); ++w)
+   {
+      const AccumulationWindow window      = kTimedWindows_[w];
+      const auto               windowBegin = endTime_ - GetDuration(window);
+      auto&                    sum = sums_[static_cast<std::size_t>(window)];
+
+      // Subtract intervals which have left the window
+      while (windowBegin_[w] < intervals_.size() &&
+             intervals_[windowBegin_[w]].time_ <= windowBegin)
+      {
+         const auto& depth = intervals_[windowBegin_[w]].depth_;
+         for (std::size_t i = 0; i < kCells_; ++i)
+         {
+            sum[i] -= depth[i];
+         }
+
+         ++windowBegin_[w];
+      }
+   }
+
+   // Intervals which have left the longest window are no longer needed
+   const std::size_t expired =
+      *std::min_element(windowBegin_.cbegin(), windowBegin_.cend());
+   intervals_.erase(intervals_.begin(),
+                    intervals_.begin() + static_cast<std::ptrdiff_t>(expired));
+   for (auto& begin : windowBegin_)
+   {
+      begin -= expired;
+   }
+}
+
+float PrecipitationAccumulator::depth(AccumulationWindow window,
+                                      std::size_t        radial,
+                                      std::size_t        gate) const
+{
+   if (radial >= kRadials || gate >= kGates)
+   {
+      return 0.0f;
+   }
+
+   std::unique_lock lock {p->mutex_};
+
+   return static_cast<float>(
+             p->sums_[static_cast<std::size_t>(window)][radial * kGates +
+                                                          gate]) *
+          kDepthUnit;
+}
+
+std::shared_ptr<ElevationScan>
+PrecipitationAccumulator::Accumulation(AccumulationWindow   window,
+                                       const ElevationScan& layoutScan) const
+{
+   std::unique_lock lock {p->mutex_};
+
+   const auto& sum         = p->sums_[static_cast<std::size_t>(window)];
+   auto        derivedScan = std::make_shared<ElevationScan>();
+
+   for (auto& radial : layoutScan)
+   {
+      auto derivedRadial = std::make_shared<DerivedRadarData>(radial.second);
+      (*derivedScan)[radial.first] = derivedRadial;
+
+      auto baseBlock =
+         radial.second->moment_data_block(DataBlockType::MomentRef);
+      if (baseBlock == nullptr)
+      {
+         continue;
+      }
+
+      auto block = std::make_shared<DerivedRadarData::MomentDataBlock>(
+         *baseBlock, kDepthScale, kDepthOffset, std::uint8_t {16u});
+
+      const float firstRange =
+         static_cast<float>(baseBlock->data_moment_range_raw());
+      const float interval =
+         static_cast<float>(baseBlock->data_moment_range_sample_interval_raw());
+      const std::size_t gridRadial =
+         static_cast<std::size_t>(
+            std::floor(radial.second->azimuth_angle().value())) %
+         kRadials;
+
+      const std::uint16_t gates = baseBlock->number_of_data_moment_gates();
+      for (std::uint16_t gate = 0; gate < gates; ++gate)
+      {
+         const float range = firstRange + static_cast<float>(gate) * interval;
+         if (range < 0.0f)
+         {
+            continue;
+         }
+
+         const std::size_t gridGate =
+            static_cast<std::size_t>(range / kGateSize);
+         if (gridGate >= kGates)
+         {
+            break;
+         }
+
+         const std::uint32_t depth = sum[gridRadial * kGates + gridGate];
+         if (depth > 0u)
+         {
+            const float level = std::round(static_cast<float>(depth) *
+                                              kDepthUnit * kDepthScale +
+                                           kDepthOffset);
+            block->SetDataMoment(
+               gate,
+               static_cast<std::uint16_t>(std::clamp(
+                  level,
+                  static_cast<float>(kMinDataLevel_),
+                  static_cast<float>(
+                     std::numeric_limits<std::uint16_t>::max()))));
+         }
+      }
+
+      derivedRadial->SetMomentDataBlock(DataBlockType::MomentRef, block);
+   }
+
+   return derivedScan;
+}
+
+void PrecipitationAccumulator::Reset()
+{
+   std::unique_lock lock {p->mutex_};
+
+   p->Clear();
+   ++p->revision_;
+}
+
+template<typename T>
+static void WriteValue(std::ostream& os, const T& value)
+{
+   os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+static bool ReadValue(std::istream& is, T& value)
+{
+   is.read(reinterpret_cast<char*>(&value), sizeof(T));
+   return static_cast<bool>(is);
+}
+
+static void WriteTime(std::ostream& os, std::chrono::system_clock::time_point t)
+{
+   WriteValue(os,
+              static_cast<std::int64_t>(
+                 std::chrono::duration_cast<std::chrono::seconds>(
+                    t.time_since_epoch())
+                    .count()));
+}
+
+static bool ReadTime(std::istream& is, std::chrono::system_clock::time_point& t)
+{
+   std::int64_t seconds {};
+   if (!ReadValue(is, seconds))
+   {
+      return false;
+   }
+
+   t = std::chrono::system_clock::time_point {std::chrono::seconds {seconds}};
+   return true;
+}
+
+// Cells are written as runs of zero cells, each followed by a run of nonzero
+// cells, as most of the grid is usually without precipitation
+template<typename T>
+static void WriteCells(std::ostream& os, const std::vector<T>& cells)
+{
+   std::size_t i = 0;
+   while (i < cells.size())
+   {
+      const std::size_t zeroBegin = i;
+      while (i < cells.size() && cells[i] == 0)
+      {
+         ++i;
+      }
+
+      const std::size_t literalBegin = i;
+      while (i < cells.size() && cells[i] != 0)
+      {
+         ++i;
+      }
+
+      WriteValue(os, static_cast<std::uint32_t>(literalBegin - zeroBegin));
+      WriteValue(os, static_cast<std::uint32_t>(i - literalBegin));
+      os.write(reinterpret_cast<const char*>(&cells[literalBegin]),
+               static_cast<std::streamsize>((i - literalBegin) * sizeof(T)));
+   }
+}
+
+template<typename T>
+static bool ReadCells(std::istream& is, std::vector<T>& cells)
+{
+   cells.assign(kCells_, 0);
+
+   std::size_t i = 0;
+   while (i < kCells_)
+   {
+      std::uint32_t zeros {};
+      std::uint32_t literals {};
+
+      if (!ReadValue(is, zeros) || !ReadValue(is, literals) ||
+          zeros + literals == 0u || i + zeros + literals > kCells_)
+      {
+         return false;
+      }
+
+      i += zeros;
+      is.read(reinterpret_cast<char*>(&cells[i]),
+              static_cast<std::streamsize>(literals * sizeof(T)));
+      i += literals;
+   }
+
+   return static_cast<bool>(is);
+}
+
+bool PrecipitationAccumulator::Save(std::ostream& os) const
+{
+   std::unique_lock lock {p->mutex_};
+
+   WriteValue(os, kFileMagic_);
+   WriteValue(os, kFileVersion_);
+   WriteValue(os, static_cast<std::uint32_t>(kRadials));
+   WriteValue(os, static_cast<std::uint32_t>(kGates));
+
+   WriteTime(os, p->firstTime_);
+   WriteTime(os, p->endTime_);
+   WriteTime(os, p->stormTotalBegin_);
+   WriteTime(os, p->lastPrecipitationTime_);
+
+   WriteCells(os, p->rates_);
+   for (auto& sum : p->sums_)
+   {
+      WriteCells(os, sum);
+   }
+
+   WriteValue(os, static_cast<std::uint32_t>(p->intervals_.size()));
+   for (auto& begin : p->windowBegin_)
+   {
+      WriteValue(os, static_cast<std::uint32_t>(begin));
+   }
+   for (auto& interval : p->intervals_)
+   {
+      WriteTime(os, interval.time_);
+      WriteCells(os, interval.depth_);
+   }
+
+   return static_cast<bool>(os);
+}
+
+bool PrecipitationAccumulator::Load(std::istream& is)
+{
+   std::uint32_t magic {};
+   std::uint32_t version {};
+   std::uint32_t radials {};
+   std::uint32_t gates {};
+
+   if (!ReadValue(is, magic) || !ReadValue(is, version) ||
+       !ReadValue(is, radials) || !ReadValue(is, gates) ||
+       magic != kFileMagic_ || version != kFileVersion_ ||
+       radials != kRadials || gates != kGates)
+   {
+      logger_->warn("Unrecognized precipitation accumulation state");
+      return false;
+   }
+
+   Impl state {};
+
+   std::uint32_t intervalCount {};
+   bool          valid = ReadTime(is, state.firstTime_) &&
+                ReadTime(is, state.endTime_) &&
+                ReadTime(is, state.stormTotalBegin_) &&
+                ReadTime(is, state.lastPrecipitationTime_) &&
+                ReadCells(is, state.rates_);
+
+   for (std::size_t i = 0; valid && i < state.sums_.size(); ++i)
+   {
+      valid = ReadCells(is, state.sums_[i]);
+   }
+
+   valid = valid && ReadValue(is, intervalCount);
+
+   for (std::size_t i = 0; valid && i < state.windowBegin_.size(); ++i)
+   {
+      std::uint32_t begin {};
+      valid                 = ReadValue(is, begin) && begin <= intervalCount;
+      state.windowBegin_[i] = begin;
+   }
+
+   for (std::uint32_t i = 0; valid && i < intervalCount; ++i)
+   {
+      AccumulationInterval interval {};
+      valid = ReadTime(is, interval.time_) && ReadCells(is, interval.depth_);
+      state.intervals_.push_back(std::move(interval));
+   }
+
+   if (!valid)
+   {
+      logger_->warn("Precipitation accumulation state is incomplete");
+      return false;
+   }
+
+   std::unique_lock lock {p->mutex_};
+
+   p->firstTime_             = state.firstTime_;
+   p->endTime_               = state.endTime_;
+   p->stormTotalBegin_       = state.stormTotalBegin_;
+   p->lastPrecipitationTime_ = state.lastPrecipitationTime_;
+   p->rates_                 = std::move(state.rates_);
+   p->intervals_             = std::move(state.intervals_);
+   p->windowBegin_           = state.windowBegin_;
+   p->sums_                  = std::move(state.sums_);
+   ++p->revision_;
+
+   return true;
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
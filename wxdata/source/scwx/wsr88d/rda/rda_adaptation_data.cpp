@@ -1266,7 +1266,8 @@ float RdaAdaptationData::txb_alarm_thresh() const
 
 bool RdaAdaptationData::Parse(std::istream& is)
 {
-   logger_->trace("Parsing RDA Adaptation Data (Message Type 18)");
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Parsing RDA Adaptation Data (Message Type 18)");
 
    bool   messageValid = true;
    size_t bytesRead    = 0;
@@ -233,7 +233,7 @@ uint16_t RdaStatusData::status_version() const
 
 bool RdaStatusData::Parse(std::istream& is)
 {
-   logger_->trace("Parsing RDA Status Data (Message Type 2)");
+   SPDLOG_LOGGER_TRACE(logger_, "Parsing RDA Status Data (Message Type 2)");
 
    bool   messageValid = true;
    size_t bytesRead    = 0;
@@ -388,9 +388,27 @@ VolumeCoveragePatternData::doppler_prf_pulse_count_radial(uint16_t e,
    return p->elevationCuts_[e].sector_[s].dopplerPrfPulseCountRadial_;
 }
 
+std::chrono::seconds VolumeCoveragePatternData::volume_scan_duration() const
+{
+   double duration = 0.0;
+
+   // Each elevation cut is a full rotation at the azimuth rate (deg/s)
+   for (uint16_t e = 0; e < number_of_elevation_cuts(); ++e)
+   {
+      const double azimuthRate = azimuth_rate(e);
+      if (azimuthRate > 0.0)
+      {
+         duration += 360.0 / azimuthRate;
+      }
+   }
+
+   return std::chrono::seconds {static_cast<std::int64_t>(duration)};
+}
+
 bool VolumeCoveragePatternData::Parse(std::istream& is)
 {
-   logger_->trace("Parsing Volume Coverage Pattern Data (Message Type 5)");
+   SPDLOG_LOGGER_TRACE(logger_,
+                       "Parsing Volume Coverage Pattern Data (Message Type 5)");
 
    bool   messageValid = true;
    size_t bytesRead    = 0;
@@ -421,7 +439,7 @@ bool VolumeCoveragePatternData::Parse(std::istream& is)
 
    if (messageSize == 0)
    {
-      logger_->trace("Ignoring empty message");
+      SPDLOG_LOGGER_TRACE(logger_, "Ignoring empty message");
       messageValid = false;
    }
    else
@@ -116,7 +116,7 @@ bool GraphicAlphanumericBlock::Parse(std::istream& is)
 
       for (uint16_t i = 0; i < p->numberOfPages_; i++)
       {
-         logger_->trace("Page {}", (i + 1));
+         SPDLOG_LOGGER_TRACE(logger_, "Page {}", (i + 1));
 
          std::vector<std::shared_ptr<Packet>> packetList;
          uint32_t                             bytesRead = 0;
@@ -153,9 +153,11 @@ bool GraphicAlphanumericBlock::Parse(std::istream& is)
 
          if (bytesRead < lengthOfPage)
          {
-            logger_->trace("Page bytes read smaller than size: {} < {} bytes",
-                           bytesRead,
-                           lengthOfPage);
+            SPDLOG_LOGGER_TRACE(
+               logger_,
+               "Page bytes read smaller than size: {} < {} bytes",
+               bytesRead,
+               lengthOfPage);
             blockValid = false;
             is.seekg(pageEnd, std::ios_base::beg);
          }
@@ -3,6 +3,7 @@
 #include <scwx/util/rangebuf.hpp>
 
 #include <istream>
+#include <mutex>
 #include <sstream>
 #include <string>
 
@@ -53,10 +54,26 @@ public:
 
    bool LoadBlocks(std::istream& is);
 
+   template<class T>
+   std::shared_ptr<T> ParseBlock(std::shared_ptr<T>& block,
+                                 std::string&        blockData,
+                                 bool&               blockParsed);
+
+   static bool ReadBlockData(std::istream& is, std::string& blockData);
+
    std::shared_ptr<ProductDescriptionBlock>  descriptionBlock_;
    std::shared_ptr<ProductSymbologyBlock>    symbologyBlock_;
    std::shared_ptr<GraphicAlphanumericBlock> graphicBlock_;
    std::shared_ptr<TabularAlphanumericBlock> tabularBlock_;
+
+   // Alphanumeric blocks are retained unparsed until first accessed
+   std::string graphicBlockData_ {};
+   std::string tabularBlockData_ {};
+   bool        graphicBlockParsed_ {true};
+   bool        tabularBlockParsed_ {true};
+   std::mutex  blockMutex_ {};
+
+   std::size_t decompressedSize_ {0};
 };
 
 GraphicProductMessage::GraphicProductMessage() :
@@ -85,13 +102,20 @@ GraphicProductMessage::symbology_block() const
 std::shared_ptr<GraphicAlphanumericBlock>
 GraphicProductMessage::graphic_block() const
 {
-   return p->graphicBlock_;
+   return p->ParseBlock(
+      p->graphicBlock_, p->graphicBlockData_, p->graphicBlockParsed_);
 }
 
 std::shared_ptr<TabularAlphanumericBlock>
 GraphicProductMessage::tabular_block() const
 {
-   return p->tabularBlock_;
+   return p->ParseBlock(
+      p->tabularBlock_, p->tabularBlockData_, p->tabularBlockParsed_);
+}
+
+std::size_t GraphicProductMessage::decompressed_size() const
+{
+   return p->decompressedSize_;
 }
 
 bool GraphicProductMessage::Parse(std::istream& is)
@@ -100,6 +124,13 @@ bool GraphicProductMessage::Parse(std::istream& is)
 
    const std::streampos dataStart = is.tellg();
 
+   p->graphicBlock_       = nullptr;
+   p->tabularBlock_       = nullptr;
+   p->graphicBlockParsed_ = true;
+   p->tabularBlockParsed_ = true;
+   p->graphicBlockData_.clear();
+   p->tabularBlockData_.clear();
+
    p->descriptionBlock_ = std::make_shared<ProductDescriptionBlock>();
    dataValid            = p->descriptionBlock_->Parse(is);
 
@@ -122,7 +153,11 @@ bool GraphicProductMessage::Parse(std::istream& is)
          {
             std::stringstream ss;
             std::streamsize   bytesCopied = boost::iostreams::copy(in, ss);
-            logger_->trace("Decompressed data size = {} bytes", bytesCopied);
+            SPDLOG_LOGGER_TRACE(logger_,
+                                "Decompressed data size = {} bytes",
+                                bytesCopied);
+
+            p->decompressedSize_ = static_cast<std::size_t>(bytesCopied);
 
             dataValid = p->LoadBlocks(ss);
          }
@@ -183,37 +218,102 @@ bool GraphicProductMessageImpl::LoadBlocks(std::istream& is)
 
    if (offsetToGraphic >= offsetBase)
    {
-      graphicBlock_ = std::make_shared<GraphicAlphanumericBlock>();
-
       is.seekg(offsetToGraphic - offsetBase, std::ios_base::cur);
-      graphicValid = graphicBlock_->Parse(is);
+      graphicValid = ReadBlockData(is, graphicBlockData_);
       is.seekg(offsetBasePos, std::ios_base::beg);
 
-      logger_->debug("Graphic alphanumeric block valid: {}", graphicValid);
+      logger_->debug("Graphic alphanumeric block size: {} bytes",
+                     graphicBlockData_.size());
 
-      if (!graphicValid)
-      {
-         graphicBlock_ = nullptr;
-      }
+      graphicBlockParsed_ = !graphicValid;
    }
 
    if (offsetToTabular >= offsetBase)
    {
-      tabularBlock_ = std::make_shared<TabularAlphanumericBlock>();
-
       is.seekg(offsetToTabular - offsetBase, std::ios_base::cur);
-      tabularValid = tabularBlock_->Parse(is);
+      tabularValid = ReadBlockData(is, tabularBlockData_);
       is.seekg(offsetBasePos, std::ios_base::beg);
 
-      logger_->debug("Tabular alphanumeric block valid: {}", tabularValid);
+      logger_->debug("Tabular alphanumeric block size: {} bytes",
+                     tabularBlockData_.size());
+
+      tabularBlockParsed_ = !tabularValid;
+   }
+
+   return (symbologyValid && graphicValid && tabularValid);
+}
+
+bool GraphicProductMessageImpl::ReadBlockData(std::istream& is,
+                                              std::string&  blockData)
+{
+   // Block divider (2 bytes), block ID (2 bytes), length of block (4 bytes)
+   static constexpr std::size_t kBlockHeaderSize_ = 8u;
+
+   std::int16_t  blockDivider  = 0;
+   std::uint32_t lengthOfBlock = 0;
+
+   const std::streampos blockStart = is.tellg();
 
-      if (!tabularValid)
+   is.read(reinterpret_cast<char*>(&blockDivider), 2);
+   is.seekg(2, std::ios_base::cur);
+   is.read(reinterpret_cast<char*>(&lengthOfBlock), 4);
+
+   blockDivider  = static_cast<std::int16_t>(ntohs(blockDivider));
+   lengthOfBlock = ntohl(lengthOfBlock);
+
+   if (!is.good() || blockDivider != -1 || lengthOfBlock < kBlockHeaderSize_)
+   {
+      logger_->warn("Invalid alphanumeric block header");
+      is.clear();
+      return false;
+   }
+
+   blockData.resize(lengthOfBlock);
+
+   is.seekg(blockStart, std::ios_base::beg);
+   is.read(blockData.data(), lengthOfBlock);
+
+   if (is.gcount() != static_cast<std::streamsize>(lengthOfBlock))
+   {
+      logger_->warn("Alphanumeric block truncated: {} < {} bytes",
+                    is.gcount(),
+                    lengthOfBlock);
+      blockData.clear();
+      is.clear();
+      return false;
+   }
+
+   return true;
+}
+
+template<class T>
+std::shared_ptr<T>
+GraphicProductMessageImpl::ParseBlock(std::shared_ptr<T>& block,
+                                      std::string&        blockData,
+                                      bool&               blockParsed)
+{
+   std::unique_lock lock {blockMutex_};
+
+   if (!blockParsed)
+   {
+      std::istringstream blockStream {std::move(blockData)};
+
+      block = std::make_shared<T>();
+
+      bool blockValid = block->Parse(blockStream);
+
+      logger_->debug("Alphanumeric block valid: {}", blockValid);
+
+      if (!blockValid)
       {
-         tabularBlock_ = nullptr;
+         block = nullptr;
       }
+
+      blockData.clear();
+      blockParsed = true;
    }
 
-   return (symbologyValid && graphicValid && tabularValid);
+   return block;
 }
 
 std::shared_ptr<GraphicProductMessage>
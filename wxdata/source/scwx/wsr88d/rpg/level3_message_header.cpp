@@ -159,7 +159,7 @@ bool Level3MessageHeader::Parse(std::istream& is)
 
    if (headerValid)
    {
-      logger_->trace("Message code: {}", p->messageCode_);
+      SPDLOG_LOGGER_TRACE(logger_, "Message code: {}", p->messageCode_);
    }
 
    return headerValid;
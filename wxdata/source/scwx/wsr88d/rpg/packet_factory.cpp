@@ -1,5 +1,6 @@
 #include <scwx/wsr88d/rpg/packet_factory.hpp>
 
+#include <scwx/util/arena.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/wsr88d/rpg/cell_trend_data_packet.hpp>
 #include <scwx/wsr88d/rpg/cell_trend_volume_scan_times.hpp>
@@ -25,7 +26,14 @@
 #include <scwx/wsr88d/rpg/vector_arrow_data_packet.hpp>
 #include <scwx/wsr88d/rpg/wind_barb_data_packet.hpp>
 
-#include <unordered_map>
+#include <array>
+#include <cstring>
+
+#ifdef _WIN32
+#   include <WinSock2.h>
+#else
+#   include <arpa/inet.h>
+#endif
 
 namespace scwx
 {
@@ -37,46 +45,116 @@ namespace rpg
 static const std::string logPrefix_ = "scwx::wsr88d::rpg::packet_factory";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
-typedef std::function<std::shared_ptr<Packet>(std::istream&)>
-   CreateMessageFunction;
-
-static const std::unordered_map<unsigned int, CreateMessageFunction> create_ {
-   {1, TextAndSpecialSymbolPacket::Create},
-   {2, TextAndSpecialSymbolPacket::Create},
-   {3, MesocycloneSymbolPacket::Create},
-   {4, WindBarbDataPacket::Create},
-   {5, VectorArrowDataPacket::Create},
-   {6, LinkedVectorPacket::Create},
-   {7, UnlinkedVectorPacket::Create},
-   {8, TextAndSpecialSymbolPacket::Create},
-   {9, LinkedVectorPacket::Create},
-   {10, UnlinkedVectorPacket::Create},
-   {11, MesocycloneSymbolPacket::Create},
-   {12, PointGraphicSymbolPacket::Create},
-   {13, PointGraphicSymbolPacket::Create},
-   {14, PointGraphicSymbolPacket::Create},
-   {15, StormIdSymbolPacket::Create},
-   {16, DigitalRadialDataArrayPacket::Create},
-   {17, DigitalPrecipitationDataArrayPacket::Create},
-   {18, PrecipitationRateDataArrayPacket::Create},
-   {19, HdaHailSymbolPacket::Create},
-   {20, PointFeatureSymbolPacket::Create},
-   {21, CellTrendDataPacket::Create},
-   {22, CellTrendVolumeScanTimes::Create},
-   {23, ScitDataPacket::Create},
-   {24, ScitDataPacket::Create},
-   {25, StiCircleSymbolPacket::Create},
-   {26, PointGraphicSymbolPacket::Create},
-   {28, GenericDataPacket::Create},
-   {29, GenericDataPacket::Create},
-   {0x0802, SetColorLevelPacket::Create},
-   {0x0E03, LinkedContourVectorPacket::Create},
-   {0x3501, UnlinkedContourVectorPacket::Create},
-   {0xAF1F, RadialDataPacket::Create},
-   {0xBA07, RasterDataPacket::Create},
-   {0xBA0F, RasterDataPacket::Create}};
+typedef std::shared_ptr<Packet> (*CreatePacketFunction)(
+   std::istream& is, const std::shared_ptr<util::Arena>& arena);
+
+struct PacketCreator
+{
+   std::uint16_t        packetCode_;
+   CreatePacketFunction create_;
+};
+
+template<class T>
+static std::shared_ptr<Packet>
+CreatePacket(std::istream& is, const std::shared_ptr<util::Arena>& arena)
+{
+   std::shared_ptr<T> packet = util::MakeShared<T>(arena);
+
+   if (!packet->Parse(is))
+   {
+      packet.reset();
+   }
+
+   return packet;
+}
+
+static constexpr std::array<PacketCreator, 34> kPacketCreators_ {{
+   {1, CreatePacket<TextAndSpecialSymbolPacket>},
+   {2, CreatePacket<TextAndSpecialSymbolPacket>},
+   {3, CreatePacket<MesocycloneSymbolPacket>},
+   {4, CreatePacket<WindBarbDataPacket>},
+   {5, CreatePacket<VectorArrowDataPacket>},
+   {6, CreatePacket<LinkedVectorPacket>},
+   {7, CreatePacket<UnlinkedVectorPacket>},
+   {8, CreatePacket<TextAndSpecialSymbolPacket>},
+   {9, CreatePacket<LinkedVectorPacket>},
+   {10, CreatePacket<UnlinkedVectorPacket>},
+   {11, CreatePacket<MesocycloneSymbolPacket>},
+   {12, CreatePacket<PointGraphicSymbolPacket>},
+   {13, CreatePacket<PointGraphicSymbolPacket>},
+   {14, CreatePacket<PointGraphicSymbolPacket>},
+   {15, CreatePacket<StormIdSymbolPacket>},
+   {16, CreatePacket<DigitalRadialDataArrayPacket>},
+   {17, CreatePacket<DigitalPrecipitationDataArrayPacket>},
+   {18, CreatePacket<PrecipitationRateDataArrayPacket>},
+   {19, CreatePacket<HdaHailSymbolPacket>},
+   {20, CreatePacket<PointFeatureSymbolPacket>},
+   {21, CreatePacket<CellTrendDataPacket>},
+   {22, CreatePacket<CellTrendVolumeScanTimes>},
+   {23, CreatePacket<ScitDataPacket>},
+   {24, CreatePacket<ScitDataPacket>},
+   {25, CreatePacket<StiCircleSymbolPacket>},
+   {26, CreatePacket<PointGraphicSymbolPacket>},
+   {28, CreatePacket<GenericDataPacket>},
+   {29, CreatePacket<GenericDataPacket>},
+   {0x0802, CreatePacket<SetColorLevelPacket>},
+   {0x0E03, CreatePacket<LinkedContourVectorPacket>},
+   {0x3501, CreatePacket<UnlinkedContourVectorPacket>},
+   {0xAF1F, CreatePacket<RadialDataPacket>},
+   {0xBA07, CreatePacket<RasterDataPacket>},
+   {0xBA0F, CreatePacket<RasterDataPacket>},
+}};
+
+// Packet codes up to 29 are dispatched by direct index, the remaining codes by
+// a linear search
+static constexpr std::uint16_t kMaxIndexedPacketCode_ = 29;
+
+static constexpr auto kIndexedPacketCreators_ = []()
+{
+   std::array<CreatePacketFunction, kMaxIndexedPacketCode_ + 1> creators {};
+
+   for (auto& creator : kPacketCreators_)
+   {
+      if (creator.packetCode_ <= kMaxIndexedPacketCode_)
+      {
+         creators[creator.packetCode_] = creator.create_;
+      }
+   }
+
+   return creators;
+}();
+
+static constexpr CreatePacketFunction
+GetCreatePacketFunction(std::uint16_t packetCode)
+{
+   if (packetCode <= kMaxIndexedPacketCode_)
+   {
+      return kIndexedPacketCreators_[packetCode];
+   }
+
+   for (auto& creator : kPacketCreators_)
+   {
+      if (creator.packetCode_ == packetCode)
+      {
+         return creator.create_;
+      }
+   }
+
+   return nullptr;
+}
+
+static_assert(GetCreatePacketFunction(27) == nullptr);
+static_assert(GetCreatePacketFunction(0xBA0F) ==
+              CreatePacket<RasterDataPacket>);
 
 std::shared_ptr<Packet> PacketFactory::Create(std::istream& is)
+{
+   return Create(is, nullptr);
+}
+
+std::shared_ptr<Packet>
+PacketFactory::Create(std::istream&                       is,
+                      const std::shared_ptr<util::Arena>& arena)
 {
    std::shared_ptr<Packet> packet      = nullptr;
    bool                    packetValid = true;
@@ -93,7 +171,14 @@ std::shared_ptr<Packet> PacketFactory::Create(std::istream& is)
 
    is.seekg(-2, std::ios_base::cur);
 
-   if (packetValid && create_.find(packetCode) == create_.end())
+   CreatePacketFunction create = nullptr;
+
+   if (packetValid)
+   {
+      create = GetCreatePacketFunction(packetCode);
+   }
+
+   if (packetValid && create == nullptr)
    {
       logger_->warn("Unknown packet code: {0} (0x{0:x})", packetCode);
       packetValid = false;
@@ -101,13 +186,99 @@ std::shared_ptr<Packet> PacketFactory::Create(std::istream& is)
 
    if (packetValid)
    {
-      logger_->trace("Found packet code: {0} (0x{0:x})", packetCode);
-      packet = create_.at(packetCode)(is);
+      SPDLOG_LOGGER_TRACE(logger_,
+                          "Found packet code: {0} (0x{0:x})",
+                          packetCode);
+      packet = create(is, arena);
    }
 
    return packet;
 }
 
+static std::uint16_t ReadUInt16(const char* data)
+{
+   std::uint16_t value;
+   std::memcpy(&value, data, sizeof(std::uint16_t));
+   return ntohs(value);
+}
+
+static std::uint32_t ReadUInt32(const char* data)
+{
+   std::uint32_t value;
+   std::memcpy(&value, data, sizeof(std::uint32_t));
+   return ntohl(value);
+}
+
+std::optional<std::size_t> PacketFactory::GetPacketSize(const char* data,
+                                                        std::size_t size)
+{
+   std::optional<std::size_t> packetSize = std::nullopt;
+
+   if (size < 4)
+   {
+      return packetSize;
+   }
+
+   std::uint16_t packetCode = ReadUInt16(data);
+
+   switch (packetCode)
+   {
+   case 1:
+   case 2:
+   case 3:
+   case 4:
+   case 5:
+   case 6:
+   case 7:
+   case 8:
+   case 9:
+   case 10:
+   case 11:
+   case 12:
+   case 13:
+   case 14:
+   case 15:
+   case 19:
+   case 20:
+   case 21:
+   case 22:
+   case 23:
+   case 24:
+   case 25:
+   case 26:
+   case 0x3501:
+      // Packet code, length of block (excluding the 4 byte header)
+      packetSize = ReadUInt16(data + 2) + 4u;
+      break;
+
+   case 28:
+   case 29:
+      // Packet code, reserved, length of block (excluding the 8 byte header)
+      if (size >= 8)
+      {
+         packetSize = ReadUInt32(data + 4) + 8u;
+      }
+      break;
+
+   case 0x0802:
+      packetSize = SetColorLevelPacket::SIZE;
+      break;
+
+   case 0x0E03:
+      // Packet code, initial point indicator, I, J, length of vectors
+      if (size >= 10)
+      {
+         packetSize = ReadUInt16(data + 8) + 10u;
+      }
+      break;
+
+   default:
+      break;
+   }
+
+   return packetSize;
+}
+
 } // namespace rpg
 } // namespace wsr88d
 } // namespace scwx
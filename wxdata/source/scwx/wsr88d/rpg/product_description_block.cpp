@@ -828,7 +828,7 @@ bool ProductDescriptionBlock::Parse(std::istream& is)
 
    if (blockValid)
    {
-      logger_->trace("Product code: {}", p->productCode_);
+      SPDLOG_LOGGER_TRACE(logger_, "Product code: {}", p->productCode_);
    }
 
    const std::streampos blockEnd = is.tellg();
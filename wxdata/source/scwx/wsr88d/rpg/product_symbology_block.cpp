@@ -1,7 +1,13 @@
 #include <scwx/wsr88d/rpg/product_symbology_block.hpp>
 #include <scwx/wsr88d/rpg/packet_factory.hpp>
+#include <scwx/util/arena.hpp>
+#include <scwx/util/buffer_pool.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/vectorbuf.hpp>
 
+#include <algorithm>
+#include <execution>
+#include <numeric>
 #include <istream>
 #include <string>
 
@@ -16,6 +22,10 @@ static const std::string logPrefix_ =
    "scwx::wsr88d::rpg::product_symbology_block";
 static const auto logger_ = util::Logger::Create(logPrefix_);
 
+// Layers with many packets allocate the packet objects from a shared arena
+static constexpr std::size_t kArenaPacketThreshold_ = 64u;
+static constexpr std::size_t kArenaBytesPerPacket_  = 128u;
+
 class ProductSymbologyBlockImpl
 {
 public:
@@ -29,6 +39,9 @@ public:
    }
    ~ProductSymbologyBlockImpl() = default;
 
+   static std::vector<std::shared_ptr<Packet>>
+   ParseLayer(std::vector<char>& layerData);
+
    int16_t  blockDivider_;
    int16_t  blockId_;
    uint32_t lengthOfBlock_;
@@ -116,15 +129,13 @@ bool ProductSymbologyBlock::Parse(std::istream& is)
 
    if (blockValid)
    {
-      int16_t  layerDivider;
-      uint32_t lengthOfDataLayer;
+      std::vector<std::shared_ptr<std::vector<char>>> layerData {};
 
+      // Read each layer, such that layers can be decoded independently
       for (uint16_t i = 0; i < p->numberOfLayers_; i++)
       {
-         logger_->trace("Layer {}", i);
-
-         std::vector<std::shared_ptr<Packet>> packetList;
-         uint32_t                             bytesRead = 0;
+         int16_t  layerDivider;
+         uint32_t lengthOfDataLayer;
 
          is.read(reinterpret_cast<char*>(&layerDivider), 2);
          is.read(reinterpret_cast<char*>(&lengthOfDataLayer), 4);
@@ -132,42 +143,60 @@ bool ProductSymbologyBlock::Parse(std::istream& is)
          layerDivider      = ntohs(layerDivider);
          lengthOfDataLayer = ntohl(lengthOfDataLayer);
 
-         std::streampos layerStart = is.tellg();
-         std::streampos layerEnd =
-            layerStart + static_cast<std::streamoff>(lengthOfDataLayer);
+         if (is.eof() || lengthOfDataLayer > p->lengthOfBlock_)
+         {
+            logger_->warn("Invalid layer length: {} (Layer {})",
+                          lengthOfDataLayer,
+                          i);
+            blockValid = false;
+            break;
+         }
+
+         auto& data = layerData.emplace_back(
+            util::BufferPool::Instance()->Acquire(lengthOfDataLayer));
+         data->resize(lengthOfDataLayer);
+         is.read(data->data(), lengthOfDataLayer);
+         data->resize(static_cast<std::size_t>(is.gcount()));
+      }
+
+      p->layerList_.resize(layerData.size());
 
-         while (bytesRead < lengthOfDataLayer)
+      std::vector<std::size_t> layerIndices(layerData.size());
+      std::iota(layerIndices.begin(), layerIndices.end(), 0u);
+
+      std::for_each(std::execution::par,
+                    layerIndices.cbegin(),
+                    layerIndices.cend(),
+                    [&](std::size_t i)
+                    {
+                       p->layerList_[i] =
+                          ProductSymbologyBlockImpl::ParseLayer(*layerData[i]);
+                    });
+
+      for (std::size_t i = 0; i < layerData.size(); i++)
+      {
+         std::size_t bytesRead = 0;
+         for (auto& packet : p->layerList_[i])
          {
-            std::shared_ptr<Packet> packet = PacketFactory::Create(is);
-            if (packet != nullptr)
-            {
-               packetList.push_back(packet);
-               bytesRead += static_cast<uint32_t>(packet->data_size());
-            }
-            else
-            {
-               break;
-            }
+            bytesRead += packet->data_size();
          }
 
-         if (bytesRead < lengthOfDataLayer)
+         if (bytesRead < layerData[i]->size())
          {
-            logger_->trace("Layer bytes read smaller than size: {} < {} bytes",
-                           bytesRead,
-                           lengthOfDataLayer);
+            SPDLOG_LOGGER_TRACE(
+               logger_,
+               "Layer bytes read smaller than size: {} < {} bytes",
+               bytesRead,
+               layerData[i]->size());
             blockValid = false;
-            is.seekg(layerEnd, std::ios_base::beg);
          }
-         if (bytesRead > lengthOfDataLayer)
+         if (bytesRead > layerData[i]->size())
          {
             logger_->warn("Layer bytes read larger than size: {} > {} bytes",
                           bytesRead,
-                          lengthOfDataLayer);
+                          layerData[i]->size());
             blockValid = false;
-            is.seekg(layerEnd, std::ios_base::beg);
          }
-
-         p->layerList_.push_back(std::move(packetList));
       }
    }
 
@@ -180,6 +209,93 @@ bool ProductSymbologyBlock::Parse(std::istream& is)
    return blockValid;
 }
 
+std::vector<std::shared_ptr<Packet>>
+ProductSymbologyBlockImpl::ParseLayer(std::vector<char>& layerData)
+{
+   struct PacketEntry
+   {
+      std::size_t             offset_;
+      std::shared_ptr<Packet> packet_;
+   };
+
+   std::vector<PacketEntry> entries {};
+   std::size_t              offset = 0;
+
+   util::vectorbuf vb {layerData};
+   vb.update_read_pointers(layerData.size());
+   std::istream is {&vb};
+
+   // Index packet boundaries using packet length fields where available.
+   // Packets whose size is only known once decoded are decoded in place.
+   while (offset < layerData.size())
+   {
+      std::optional<std::size_t> packetSize = PacketFactory::GetPacketSize(
+         layerData.data() + offset, layerData.size() - offset);
+
+      if (packetSize.has_value() &&
+          offset + packetSize.value() <= layerData.size())
+      {
+         entries.push_back({offset, nullptr});
+         offset += packetSize.value();
+      }
+      else
+      {
+         is.clear();
+         is.seekg(static_cast<std::streamoff>(offset), std::ios_base::beg);
+
+         std::shared_ptr<Packet> packet = PacketFactory::Create(is);
+         if (packet == nullptr)
+         {
+            break;
+         }
+
+         entries.push_back({offset, packet});
+         offset += packet->data_size();
+      }
+   }
+
+   std::shared_ptr<util::Arena> arena = nullptr;
+   if (entries.size() >= kArenaPacketThreshold_)
+   {
+      arena = std::make_shared<util::Arena>(entries.size() *
+                                            kArenaBytesPerPacket_);
+   }
+
+   // Decode the remaining packets concurrently
+   std::for_each(std::execution::par,
+                 entries.begin(),
+                 entries.end(),
+                 [&layerData, &arena](PacketEntry& entry)
+                 {
+                    if (entry.packet_ == nullptr)
+                    {
+                       util::vectorbuf packetBuffer {layerData};
+                       packetBuffer.update_read_pointers(layerData.size());
+                       std::istream packetStream {&packetBuffer};
+                       packetStream.seekg(
+                          static_cast<std::streamoff>(entry.offset_),
+                          std::ios_base::beg);
+
+                       entry.packet_ =
+                          PacketFactory::Create(packetStream, arena);
+                    }
+                 });
+
+   std::vector<std::shared_ptr<Packet>> packetList {};
+
+   for (auto& entry : entries)
+   {
+      if (entry.packet_ == nullptr)
+      {
+         break;
+      }
+
+      packetList.push_back(std::move(entry.packet_));
+   }
+
+   return packetList;
+}
+
 } // namespace rpg
 } // namespace wsr88d
 } // namespace scwx
@@ -1,6 +1,8 @@
 #include <scwx/wsr88d/rpg/radial_data_packet.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/run_length.hpp>
 
+#include <array>
 #include <istream>
 #include <string>
 
@@ -22,14 +24,12 @@ public:
       uint16_t             numberOfRleHalfwords_;
       uint16_t             startAngle_;
       uint16_t             angleDelta_;
-      std::vector<uint8_t> data_;
       std::vector<uint8_t> level_;
 
       Radial() :
           numberOfRleHalfwords_ {0},
           startAngle_ {0},
           angleDelta_ {0},
-          data_ {},
           level_ {}
       {
       }
@@ -178,6 +178,10 @@ bool RadialDataPacket::Parse(std::istream& is)
    {
       p->radial_.resize(p->numberOfRadials_);
 
+      // Run Length Encoded data is read into a scratch buffer, and expanded
+      // directly into each radial
+      std::array<std::uint8_t, 460> rleData {};
+
       for (uint16_t r = 0; r < p->numberOfRadials_; r++)
       {
          auto& radial = p->radial_[r];
@@ -203,30 +207,16 @@ bool RadialDataPacket::Parse(std::istream& is)
 
          // Read RLE halfwords
          size_t dataSize = radial.numberOfRleHalfwords_ * 2;
-         radial.data_.resize(dataSize);
-         is.read(reinterpret_cast<char*>(radial.data_.data()), dataSize);
+         is.read(reinterpret_cast<char*>(rleData.data()), dataSize);
          bytesRead += dataSize;
 
-         // If the final byte is 0, truncate it
-         if (radial.data_.back() == 0)
-         {
-            radial.data_.pop_back();
-         }
-
-         // Unpack the levels from the Run Length Encoded data
+         // Unpack the levels from the Run Length Encoded data. A trailing 0
+         // byte has a run of 0, and does not contribute any levels.
          radial.level_.resize(p->numberOfRangeBins_);
-
-         uint16_t b = 0;
-         for (auto it = radial.data_.cbegin(); it != radial.data_.cend(); it++)
-         {
-            uint8_t run   = *it >> 4;
-            uint8_t level = *it & 0x0f;
-
-            for (int i = 0; i < run && b < p->numberOfRangeBins_; i++)
-            {
-               radial.level_[b++] = level;
-            }
-         }
+         util::ExpandRunLength4(rleData.data(),
+                                dataSize,
+                                radial.level_.data(),
+                                radial.level_.size());
       }
    }
 
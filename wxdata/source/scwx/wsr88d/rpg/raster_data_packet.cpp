@@ -1,6 +1,8 @@
 #include <scwx/wsr88d/rpg/raster_data_packet.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/run_length.hpp>
 
+#include <array>
 #include <istream>
 #include <string>
 
@@ -20,10 +22,9 @@ public:
    struct Row
    {
       uint16_t             numberOfBytes_;
-      std::vector<uint8_t> data_;
       std::vector<uint8_t> level_;
 
-      Row() : numberOfBytes_ {0}, data_ {}, level_ {} {}
+      Row() : numberOfBytes_ {0}, level_ {} {}
    };
 
    explicit RasterDataPacketImpl() :
@@ -182,6 +183,10 @@ bool RasterDataPacket::Parse(std::istream& is)
    {
       p->row_.resize(p->numberOfRows_);
 
+      // Run Length Encoded data is read into a scratch buffer, and expanded
+      // directly into each row
+      std::array<std::uint8_t, 920> rleData {};
+
       for (uint16_t r = 0; r < p->numberOfRows_; r++)
       {
          auto& row = p->row_[r];
@@ -203,37 +208,14 @@ bool RasterDataPacket::Parse(std::istream& is)
 
          // Read row data
          size_t dataSize = row.numberOfBytes_;
-         row.data_.resize(dataSize);
-         is.read(reinterpret_cast<char*>(row.data_.data()), dataSize);
+         is.read(reinterpret_cast<char*>(rleData.data()), dataSize);
          bytesRead += dataSize;
 
-         // If the final byte is 0, truncate it
-         if (row.data_.back() == 0)
-         {
-            row.data_.pop_back();
-         }
-
-         // Unpack the levels from the Run Length Encoded data
-         uint16_t binCount =
-            std::accumulate(row.data_.cbegin(),
-                            row.data_.cend(),
-                            static_cast<uint16_t>(0u),
-                            [](const uint16_t& a, const uint8_t& b) -> uint16_t
-                            { return a + (b >> 4); });
-
-         row.level_.resize(binCount);
-
-         uint16_t b = 0;
-         for (auto it = row.data_.cbegin(); it != row.data_.cend(); it++)
-         {
-            uint8_t run   = *it >> 4;
-            uint8_t level = *it & 0x0f;
-
-            for (int i = 0; i < run && b < binCount; i++)
-            {
-               row.level_[b++] = level;
-            }
-         }
+         // Unpack the levels from the Run Length Encoded data. A trailing 0
+         // byte has a run of 0, and does not contribute any levels.
+         row.level_.resize(util::CountRunLength4(rleData.data(), dataSize));
+         util::ExpandRunLength4(
+            rleData.data(), dataSize, row.level_.data(), row.level_.size());
       }
    }
 
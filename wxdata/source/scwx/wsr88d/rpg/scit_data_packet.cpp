@@ -77,9 +77,11 @@ bool ScitDataPacket::ParseData(std::istream& is)
 
       if (bytesRead < lengthOfBlock)
       {
-         logger_->trace("Block bytes read smaller than size: {} < {} bytes",
-                        bytesRead,
-                        lengthOfBlock);
+         SPDLOG_LOGGER_TRACE(
+            logger_,
+            "Block bytes read smaller than size: {} < {} bytes",
+            bytesRead,
+            lengthOfBlock);
          blockValid = false;
          is.seekg(dataEnd, std::ios_base::beg);
       }
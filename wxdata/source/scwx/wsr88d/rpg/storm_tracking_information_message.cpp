@@ -236,8 +236,9 @@ void StormTrackingInformationMessage::Impl::ParseGraphicBlock(
             break;
 
          default:
-            logger_->trace("Ignoring graphic alphanumeric packet type: {}",
-                           packet->packet_code());
+            SPDLOG_LOGGER_TRACE(logger_,
+                                "Ignoring graphic alphanumeric packet type: {}",
+                                packet->packet_code());
             break;
          }
       }
@@ -60,52 +60,98 @@ set(SRC_NETWORK source/scwx/network/cpr.cpp
 set(HDR_PROVIDER include/scwx/provider/aws_level2_data_provider.hpp
                  include/scwx/provider/aws_level3_data_provider.hpp
                  include/scwx/provider/aws_nexrad_data_provider.hpp
+                 include/scwx/provider/local_nexrad_data_provider.hpp
                  include/scwx/provider/nexrad_data_provider.hpp
                  include/scwx/provider/nexrad_data_provider_factory.hpp
+                 include/scwx/provider/object_cache.hpp
+                 include/scwx/provider/refresh_schedule.hpp
+                 include/scwx/provider/replay_clock.hpp
+                 include/scwx/provider/replay_nexrad_data_provider.hpp
+                 include/scwx/provider/replay_warnings_provider.hpp
                  include/scwx/provider/warnings_provider.hpp)
 set(SRC_PROVIDER source/scwx/provider/aws_level2_data_provider.cpp
                  source/scwx/provider/aws_level3_data_provider.cpp
                  source/scwx/provider/aws_nexrad_data_provider.cpp
+                 source/scwx/provider/local_nexrad_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider_factory.cpp
+                 source/scwx/provider/object_cache.cpp
+                 source/scwx/provider/refresh_schedule.cpp
+                 source/scwx/provider/replay_clock.cpp
+                 source/scwx/provider/replay_nexrad_data_provider.cpp
+                 source/scwx/provider/replay_warnings_provider.cpp
                  source/scwx/provider/warnings_provider.cpp)
-set(HDR_UTIL include/scwx/util/digest.hpp
+set(HDR_UTIL include/scwx/util/allocation_tracker.hpp
+             include/scwx/util/arena.hpp
+             include/scwx/util/buffer_pool.hpp
+             include/scwx/util/byte_swap.hpp
+             include/scwx/util/cpu_features.hpp
+             include/scwx/util/detached_task.hpp
+             include/scwx/util/digest.hpp
              include/scwx/util/enum.hpp
              include/scwx/util/environment.hpp
              include/scwx/util/float.hpp
              include/scwx/util/hash.hpp
              include/scwx/util/iterator.hpp
              include/scwx/util/logger.hpp
+             include/scwx/util/lru_cache.hpp
              include/scwx/util/map.hpp
+             include/scwx/util/mapped_file_stream.hpp
+             include/scwx/util/memory.hpp
+             include/scwx/util/metrics.hpp
+             include/scwx/util/priority_thread_pool.hpp
+             include/scwx/util/profiler.hpp
              include/scwx/util/rangebuf.hpp
+             include/scwx/util/run_length.hpp
              include/scwx/util/streams.hpp
+             include/scwx/util/strand.hpp
              include/scwx/util/strings.hpp
              include/scwx/util/threads.hpp
              include/scwx/util/time.hpp
              include/scwx/util/vectorbuf.hpp)
-set(SRC_UTIL source/scwx/util/digest.cpp
+set(SRC_UTIL source/scwx/util/allocation_tracker.cpp
+             source/scwx/util/arena.cpp
+             source/scwx/util/buffer_pool.cpp
+             source/scwx/util/byte_swap.cpp
+             source/scwx/util/cpu_features.cpp
+             source/scwx/util/detached_task.cpp
+             source/scwx/util/digest.cpp
              source/scwx/util/environment.cpp
              source/scwx/util/float.cpp
              source/scwx/util/hash.cpp
              source/scwx/util/logger.cpp
+             source/scwx/util/mapped_file_stream.cpp
+             source/scwx/util/memory.cpp
+             source/scwx/util/metrics.cpp
+             source/scwx/util/priority_thread_pool.cpp
+             source/scwx/util/profiler.cpp
              source/scwx/util/rangebuf.cpp
+             source/scwx/util/run_length.cpp
              source/scwx/util/streams.cpp
+             source/scwx/util/strand.cpp
              source/scwx/util/strings.cpp
              source/scwx/util/time.cpp
              source/scwx/util/threads.cpp
              source/scwx/util/vectorbuf.cpp)
-set(HDR_WSR88D include/scwx/wsr88d/ar2v_file.hpp
+set(HDR_WSR88D include/scwx/wsr88d/ar2v_export.hpp
+               include/scwx/wsr88d/ar2v_file.hpp
                include/scwx/wsr88d/level3_file.hpp
                include/scwx/wsr88d/nexrad_file.hpp
+               include/scwx/wsr88d/nexrad_file_batch_loader.hpp
                include/scwx/wsr88d/nexrad_file_factory.hpp
                include/scwx/wsr88d/wsr88d_types.hpp)
-set(SRC_WSR88D source/scwx/wsr88d/ar2v_file.cpp
+set(SRC_WSR88D source/scwx/wsr88d/ar2v_export.cpp
+               source/scwx/wsr88d/ar2v_file.cpp
                source/scwx/wsr88d/level3_file.cpp
                source/scwx/wsr88d/nexrad_file.cpp
+               source/scwx/wsr88d/nexrad_file_batch_loader.cpp
                source/scwx/wsr88d/nexrad_file_factory.cpp
                source/scwx/wsr88d/wsr88d_types.cpp)
 set(HDR_WSR88D_RDA include/scwx/wsr88d/rda/clutter_filter_bypass_map.hpp
                    include/scwx/wsr88d/rda/clutter_filter_map.hpp
+                   include/scwx/wsr88d/rda/columnar_sweep.hpp
+                   include/scwx/wsr88d/rda/derived_product.hpp
+                   include/scwx/wsr88d/rda/derived_radar_data.hpp
                    include/scwx/wsr88d/rda/digital_radar_data.hpp
                    include/scwx/wsr88d/rda/digital_radar_data_generic.hpp
                    include/scwx/wsr88d/rda/generic_radar_data.hpp
@@ -113,12 +159,16 @@ set(HDR_WSR88D_RDA include/scwx/wsr88d/rda/clutter_filter_bypass_map.hpp
                    include/scwx/wsr88d/rda/level2_message_factory.hpp
                    include/scwx/wsr88d/rda/level2_message_header.hpp
                    include/scwx/wsr88d/rda/performance_maintenance_data.hpp
+                   include/scwx/wsr88d/rda/precipitation_accumulator.hpp
                    include/scwx/wsr88d/rda/rda_adaptation_data.hpp
                    include/scwx/wsr88d/rda/rda_status_data.hpp
                    include/scwx/wsr88d/rda/rda_types.hpp
                    include/scwx/wsr88d/rda/volume_coverage_pattern_data.hpp)
 set(SRC_WSR88D_RDA source/scwx/wsr88d/rda/clutter_filter_bypass_map.cpp
                    source/scwx/wsr88d/rda/clutter_filter_map.cpp
+                   source/scwx/wsr88d/rda/columnar_sweep.cpp
+                   source/scwx/wsr88d/rda/derived_product.cpp
+                   source/scwx/wsr88d/rda/derived_radar_data.cpp
                    source/scwx/wsr88d/rda/digital_radar_data.cpp
                    source/scwx/wsr88d/rda/digital_radar_data_generic.cpp
                    source/scwx/wsr88d/rda/generic_radar_data.cpp
@@ -126,6 +176,7 @@ set(SRC_WSR88D_RDA source/scwx/wsr88d/rda/clutter_filter_bypass_map.cpp
                    source/scwx/wsr88d/rda/level2_message_factory.cpp
                    source/scwx/wsr88d/rda/level2_message_header.cpp
                    source/scwx/wsr88d/rda/performance_maintenance_data.cpp
+                   source/scwx/wsr88d/rda/precipitation_accumulator.cpp
                    source/scwx/wsr88d/rda/rda_adaptation_data.cpp
                    source/scwx/wsr88d/rda/rda_status_data.cpp
                    source/scwx/wsr88d/rda/volume_coverage_pattern_data.cpp)
@@ -272,6 +323,11 @@ target_compile_options(wxdata PRIVATE
     $<$<NOT:$<CXX_COMPILER_ID:MSVC>>:-Wall -Wextra -Wpedantic -Werror>
 )
 
+# Trace messages are only compiled into debug builds
+target_compile_definitions(wxdata PUBLIC
+    $<IF:$<CONFIG:Debug>,SPDLOG_ACTIVE_LEVEL=SPDLOG_LEVEL_TRACE,SPDLOG_ACTIVE_LEVEL=SPDLOG_LEVEL_DEBUG>
+)
+
 if (MSVC)
     # Don't include Windows macros
     target_compile_options(wxdata PRIVATE -DNOMINMAX)
@@ -299,7 +355,7 @@ target_link_libraries(wxdata INTERFACE Boost::iostreams
                                        hsluv-c)
 
 if (WIN32)
-    target_link_libraries(wxdata INTERFACE Ws2_32)
+    target_link_libraries(wxdata INTERFACE Ws2_32 Psapi)
 endif()
 
 if (NOT CHRONO_HAS_TIMEZONES_AND_CALENDERS)
@@ -321,3 +377,8 @@ if (SCWX_ADDRESS_SANITIZER)
         $<$<NOT:$<CXX_COMPILER_ID:MSVC>>:-fsanitize=address -fsanitize-recover=address>
     )
 endif()
+
+# Allocation tracking options
+if (SCWX_ALLOCATION_TRACKING)
+    target_compile_definitions(wxdata PUBLIC SCWX_ALLOCATION_TRACKING)
+endif()